@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+void BinaryEWAdd(benchmark::State& state, const Device& device) {
+    SizeVector shape{state.range(0), 3};
+    Tensor lhs = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor rhs = Tensor::Ones(shape, Dtype::Float32, device);
+
+    Tensor warm_up = lhs + rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+    }
+}
+
+void BinaryEWAddBroadcast(benchmark::State& state, const Device& device) {
+    Tensor lhs = Tensor::Ones({state.range(0), 3}, Dtype::Float32, device);
+    Tensor rhs = Tensor::Ones({1, 3}, Dtype::Float32, device);
+
+    Tensor warm_up = lhs + rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+    }
+}
+
+void BinaryEWAddInplace(benchmark::State& state, const Device& device) {
+    SizeVector shape{state.range(0), 3};
+    Tensor lhs = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor rhs = Tensor::Ones(shape, Dtype::Float32, device);
+
+    lhs += rhs;
+    for (auto _ : state) {
+        lhs += rhs;
+    }
+}
+
+void BinaryEWMulNonContiguous(benchmark::State& state, const Device& device) {
+    Tensor lhs = Tensor::Ones({3, state.range(0)}, Dtype::Float32, device).T();
+    Tensor rhs = Tensor::Ones({state.range(0), 3}, Dtype::Float32, device);
+
+    Tensor warm_up = lhs * rhs;
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs * rhs;
+    }
+}
+
+void BinaryEWGt(benchmark::State& state, const Device& device) {
+    SizeVector shape{state.range(0), 3};
+    Tensor lhs = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor rhs = Tensor::Zeros(shape, Dtype::Float32, device);
+
+    Tensor warm_up = lhs.Gt(rhs);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs.Gt(rhs);
+    }
+}
+
+#define ENUM_BINARY_EW_SIZE(FUNC, DEVICE_NAME, DEVICE) \
+    BENCHMARK_CAPTURE(FUNC, DEVICE_NAME, DEVICE)       \
+            ->Arg(1 << 16)                             \
+            ->Arg(1 << 20)                             \
+            ->Arg(1 << 24)                             \
+            ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+#define ENUM_BINARY_EW_DEVICE(FUNC)                 \
+    ENUM_BINARY_EW_SIZE(FUNC, CPU, Device("CPU:0")) \
+    ENUM_BINARY_EW_SIZE(FUNC, CUDA, Device("CUDA:0"))
+#else
+#define ENUM_BINARY_EW_DEVICE(FUNC) \
+    ENUM_BINARY_EW_SIZE(FUNC, CPU, Device("CPU:0"))
+#endif
+
+ENUM_BINARY_EW_DEVICE(BinaryEWAdd)
+ENUM_BINARY_EW_DEVICE(BinaryEWAddBroadcast)
+ENUM_BINARY_EW_DEVICE(BinaryEWAddInplace)
+ENUM_BINARY_EW_DEVICE(BinaryEWMulNonContiguous)
+ENUM_BINARY_EW_DEVICE(BinaryEWGt)
+
+}  // namespace core
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include <cmath>
 #include <random>
 
 #include "open3d/core/AdvancedIndexing.h"
@@ -393,6 +394,215 @@ void HashClearInt3(benchmark::State& state,
     }
 }
 
+/// Voxel coordinates (Int32 x 3) of points scanned row by row from a sphere
+/// surface, as a depth sensor would produce them. Consecutive keys are
+/// spatially close and each voxel is hit by about points_per_voxel points.
+class VoxelData {
+public:
+    VoxelData(int num_points, int points_per_voxel, int offset_x = 0) {
+        const double kPi = 3.14159265358979323846;
+        const double radius = std::max(
+                1.0, std::sqrt(double(num_points) /
+                               (4.0 * kPi * points_per_voxel)));
+        const int rows = std::max(1, int(std::sqrt(double(num_points))));
+        const int cols = (num_points + rows - 1) / rows;
+
+        std::default_random_engine rng(0);
+        std::uniform_real_distribution<double> jitter(0.0, 1.0);
+        coords_.reserve(3 * num_points);
+        for (int i = 0; i < num_points; ++i) {
+            const double theta = kPi * (i / cols + jitter(rng)) / rows;
+            const double phi = 2.0 * kPi * (i % cols + jitter(rng)) / cols;
+            coords_.push_back(int(std::floor(
+                    radius * std::sin(theta) * std::cos(phi) + offset_x)));
+            coords_.push_back(int(std::floor(radius * std::sin(theta) *
+                                             std::sin(phi))));
+            coords_.push_back(int(std::floor(radius * std::cos(theta))));
+        }
+    }
+
+    Tensor GetKeys(const Device& device) const {
+        const int64_t count = int64_t(coords_.size() / 3);
+        return Tensor(coords_, {count, 3}, Dtype::Int32, device);
+    }
+
+public:
+    std::vector<int> coords_;
+};
+
+/// Unique block coordinates (Int32 x 3) of a dense 64 x 64 x n grid.
+static Tensor BlockKeys(int count, const Device& device) {
+    std::vector<int> coords(3 * count);
+    for (int i = 0; i < count; ++i) {
+        coords[3 * i + 0] = i % 64;
+        coords[3 * i + 1] = (i / 64) % 64;
+        coords[3 * i + 2] = i / 4096;
+    }
+    return Tensor(coords, {count, 3}, Dtype::Int32, device);
+}
+
+void HashInsertVoxel(benchmark::State& state,
+                     int num_points,
+                     int points_per_voxel,
+                     const Device& device,
+                     const HashmapBackend& backend) {
+#ifdef BUILD_CUDA_MODULE
+    CUDACachedMemoryManager::ReleaseCache();
+#endif
+    Tensor keys = VoxelData(num_points, points_per_voxel).GetKeys(device);
+    Tensor values = Tensor::Arange(0, num_points, 1, Dtype::Int32, device);
+
+    Hashmap hashmap_warmup(num_points, Dtype::Int32, Dtype::Int32, {3}, {1},
+                           device, backend);
+    Tensor addrs, masks;
+    hashmap_warmup.Insert(keys, values, addrs, masks);
+    const int64_t num_voxels = hashmap_warmup.Size();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap(num_points, Dtype::Int32, Dtype::Int32, {3}, {1},
+                        device, backend);
+        Tensor addrs, masks;
+        state.ResumeTiming();
+
+        hashmap.Insert(keys, values, addrs, masks);
+
+        state.PauseTiming();
+        int64_t s = hashmap.Size();
+        if (s != num_voxels) {
+            utility::LogError(
+                    "Error returning hashmap size, expected {}, but got {}.",
+                    num_voxels, s);
+        }
+        state.ResumeTiming();
+    }
+    state.counters["voxels"] = double(num_voxels);
+}
+
+void HashFindVoxel(benchmark::State& state,
+                   int num_points,
+                   int points_per_voxel,
+                   const Device& device,
+                   const HashmapBackend& backend) {
+#ifdef BUILD_CUDA_MODULE
+    CUDACachedMemoryManager::ReleaseCache();
+#endif
+    Tensor keys = VoxelData(num_points, points_per_voxel).GetKeys(device);
+    Tensor values = Tensor::Arange(0, num_points, 1, Dtype::Int32, device);
+
+    Hashmap hashmap(num_points, Dtype::Int32, Dtype::Int32, {3}, {1}, device,
+                    backend);
+    Tensor addrs, masks;
+    hashmap.Insert(keys, values, addrs, masks);
+
+    for (auto _ : state) {
+        hashmap.Find(keys, addrs, masks);
+    }
+}
+
+/// Frames of a sensor moving along x: each frame activates and looks up its
+/// voxels, and the voxels of the frame leaving a sliding window of
+/// num_window_frames are erased.
+void HashMixedVoxel(benchmark::State& state,
+                    int num_points_per_frame,
+                    int num_frames,
+                    const Device& device,
+                    const HashmapBackend& backend) {
+    const int num_window_frames = 4;
+    const int points_per_voxel = 4;
+#ifdef BUILD_CUDA_MODULE
+    CUDACachedMemoryManager::ReleaseCache();
+#endif
+    std::vector<Tensor> frame_keys;
+    for (int f = 0; f < num_frames; ++f) {
+        frame_keys.push_back(
+                VoxelData(num_points_per_frame, points_per_voxel, 2 * f)
+                        .GetKeys(device));
+    }
+    const int capacity = num_points_per_frame * (num_window_frames + 1);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap(capacity, Dtype::Int32, Dtype::Int32, {3}, {1}, device,
+                        backend);
+        Tensor addrs, masks;
+        state.ResumeTiming();
+
+        for (int f = 0; f < num_frames; ++f) {
+            hashmap.Activate(frame_keys[f], addrs, masks);
+            hashmap.Find(frame_keys[f], addrs, masks);
+            if (f >= num_window_frames) {
+                hashmap.Erase(frame_keys[f - num_window_frames], masks);
+            }
+        }
+    }
+}
+
+/// Inserts unique block keys with value_size Float32 values per block, e.g.
+/// 1024 for the TSDF and weight of 8^3 voxels.
+void HashInsertBlock(benchmark::State& state,
+                     int num_blocks,
+                     int value_size,
+                     const Device& device,
+                     const HashmapBackend& backend) {
+#ifdef BUILD_CUDA_MODULE
+    CUDACachedMemoryManager::ReleaseCache();
+#endif
+    Tensor keys = BlockKeys(num_blocks, device);
+    Tensor values = Tensor::Ones({num_blocks, value_size}, Dtype::Float32,
+                                 device);
+
+    Hashmap hashmap_warmup(num_blocks, Dtype::Int32, Dtype::Float32, {3},
+                           {value_size}, device, backend);
+    Tensor addrs, masks;
+    hashmap_warmup.Insert(keys, values, addrs, masks);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap(num_blocks, Dtype::Int32, Dtype::Float32, {3},
+                        {value_size}, device, backend);
+        Tensor addrs, masks;
+        state.ResumeTiming();
+
+        hashmap.Insert(keys, values, addrs, masks);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * num_blocks *
+                            value_size * int64_t(sizeof(float)));
+}
+
+/// Doubles the bucket count of a hashmap filled with voxel keys.
+void HashRehashVoxel(benchmark::State& state,
+                     int num_points,
+                     int points_per_voxel,
+                     const Device& device,
+                     const HashmapBackend& backend) {
+#ifdef BUILD_CUDA_MODULE
+    CUDACachedMemoryManager::ReleaseCache();
+#endif
+    Tensor keys = VoxelData(num_points, points_per_voxel).GetKeys(device);
+    Tensor values = Tensor::Arange(0, num_points, 1, Dtype::Int32, device);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Hashmap hashmap(num_points, Dtype::Int32, Dtype::Int32, {3}, {1},
+                        device, backend);
+        Tensor addrs, masks;
+        hashmap.Insert(keys, values, addrs, masks);
+        const int64_t s = hashmap.Size();
+        state.ResumeTiming();
+
+        hashmap.Rehash(hashmap.GetBucketCount() * 2);
+
+        state.PauseTiming();
+        if (hashmap.Size() != s) {
+            utility::LogError(
+                    "Error returning hashmap size, expected {}, but got {}.",
+                    s, hashmap.Size());
+        }
+        state.ResumeTiming();
+    }
+}
+
 // Note: to enable large scale insertion (> 1M entries), change
 // default_max_load_factor() in stdgpu from 1.0 to 1.2~1.4.
 #define ENUM_BM_CAPACITY(FN, FACTOR, DEVICE, BACKEND)                          \
@@ -421,13 +631,15 @@ void HashClearInt3(benchmark::State& state,
     ENUM_BM_CAPACITY(FN, 32, DEVICE, BACKEND)
 
 #ifdef BUILD_CUDA_MODULE
-#define ENUM_BM_BACKEND(FN)                                    \
-    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashmapBackend::TBB)   \
-    ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashmapBackend::Slab) \
+#define ENUM_BM_BACKEND(FN)                                               \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashmapBackend::TBB)              \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashmapBackend::OpenAddressing)   \
+    ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashmapBackend::Slab)            \
     ENUM_BM_FACTOR(FN, Device("CUDA:0"), HashmapBackend::StdGPU)
 #else
-#define ENUM_BM_BACKEND(FN) \
-    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashmapBackend::TBB)
+#define ENUM_BM_BACKEND(FN)                                  \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashmapBackend::TBB) \
+    ENUM_BM_FACTOR(FN, Device("CPU:0"), HashmapBackend::OpenAddressing)
 #endif
 
 ENUM_BM_BACKEND(HashInsertInt)
@@ -439,5 +651,46 @@ ENUM_BM_BACKEND(HashFindInt3)
 ENUM_BM_BACKEND(HashClearInt)
 ENUM_BM_BACKEND(HashClearInt3)
 
+// Voxel workloads: (num_points, points_per_voxel), (num_points_per_frame,
+// num_frames) and (num_blocks, value_size).
+#define ENUM_BM_VOXEL(FN, DEVICE, BACKEND)                                    \
+    BENCHMARK_CAPTURE(FN, BACKEND##_100000_1, 100000, 1, DEVICE, BACKEND)     \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(FN, BACKEND##_100000_16, 100000, 16, DEVICE, BACKEND)   \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(FN, BACKEND##_1000000_16, 1000000, 16, DEVICE, BACKEND) \
+            ->Unit(benchmark::kMillisecond);
+
+#define ENUM_BM_MIXED(FN, DEVICE, BACKEND)                                  \
+    BENCHMARK_CAPTURE(FN, BACKEND##_100000_16, 100000, 16, DEVICE, BACKEND) \
+            ->Unit(benchmark::kMillisecond);
+
+#define ENUM_BM_BLOCK(FN, DEVICE, BACKEND)                                 \
+    BENCHMARK_CAPTURE(FN, BACKEND##_10000_1, 10000, 1, DEVICE, BACKEND)    \
+            ->Unit(benchmark::kMillisecond);                               \
+    BENCHMARK_CAPTURE(FN, BACKEND##_10000_64, 10000, 64, DEVICE, BACKEND)  \
+            ->Unit(benchmark::kMillisecond);                               \
+    BENCHMARK_CAPTURE(FN, BACKEND##_10000_1024, 10000, 1024, DEVICE,       \
+                      BACKEND)                                             \
+            ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+#define ENUM_BM_WORKLOAD_BACKEND(ENUM, FN)                     \
+    ENUM(FN, Device("CPU:0"), HashmapBackend::TBB)             \
+    ENUM(FN, Device("CPU:0"), HashmapBackend::OpenAddressing)  \
+    ENUM(FN, Device("CUDA:0"), HashmapBackend::Slab)           \
+    ENUM(FN, Device("CUDA:0"), HashmapBackend::StdGPU)
+#else
+#define ENUM_BM_WORKLOAD_BACKEND(ENUM, FN)         \
+    ENUM(FN, Device("CPU:0"), HashmapBackend::TBB) \
+    ENUM(FN, Device("CPU:0"), HashmapBackend::OpenAddressing)
+#endif
+
+ENUM_BM_WORKLOAD_BACKEND(ENUM_BM_VOXEL, HashInsertVoxel)
+ENUM_BM_WORKLOAD_BACKEND(ENUM_BM_VOXEL, HashFindVoxel)
+ENUM_BM_WORKLOAD_BACKEND(ENUM_BM_VOXEL, HashRehashVoxel)
+ENUM_BM_WORKLOAD_BACKEND(ENUM_BM_MIXED, HashMixedVoxel)
+ENUM_BM_WORKLOAD_BACKEND(ENUM_BM_BLOCK, HashInsertBlock)
+
 }  // namespace core
 }  // namespace open3d
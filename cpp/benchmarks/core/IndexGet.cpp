@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+// Random Int64 indices into a dimension of size n.
+static Tensor CreateRandomIndices(int64_t num_indices,
+                                  int64_t n,
+                                  const Device& device) {
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int64_t> dist(0, n - 1);
+    std::vector<int64_t> indices(num_indices);
+    for (auto& index : indices) {
+        index = dist(rng);
+    }
+    return Tensor(indices, {num_indices}, Dtype::Int64, device);
+}
+
+void IndexGetRows(benchmark::State& state, const Device& device) {
+    int64_t n = state.range(0);
+    Tensor src = Tensor::Ones({n, 3}, Dtype::Float32, device);
+    Tensor indices = CreateRandomIndices(n, n, device);
+
+    Tensor warm_up = src.IndexGet({indices});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.IndexGet({indices});
+    }
+}
+
+void IndexGetMask(benchmark::State& state, const Device& device) {
+    int64_t n = state.range(0);
+    Tensor src = Tensor::Ones({n, 3}, Dtype::Float32, device);
+    Tensor mask = CreateRandomIndices(n, 2, device).Eq(1);
+
+    Tensor warm_up = src.IndexGet({mask});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.IndexGet({mask});
+    }
+}
+
+void IndexSetRows(benchmark::State& state, const Device& device) {
+    int64_t n = state.range(0);
+    Tensor dst = Tensor::Zeros({n, 3}, Dtype::Float32, device);
+    Tensor src = Tensor::Ones({n, 3}, Dtype::Float32, device);
+    Tensor indices = CreateRandomIndices(n, n, device);
+
+    dst.IndexSet({indices}, src);
+    for (auto _ : state) {
+        dst.IndexSet({indices}, src);
+    }
+}
+
+#define ENUM_INDEXING_SIZE(FUNC, DEVICE_NAME, DEVICE) \
+    BENCHMARK_CAPTURE(FUNC, DEVICE_NAME, DEVICE)      \
+            ->Arg(1 << 16)                            \
+            ->Arg(1 << 20)                            \
+            ->Arg(1 << 24)                            \
+            ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+#define ENUM_INDEXING_DEVICE(FUNC)                 \
+    ENUM_INDEXING_SIZE(FUNC, CPU, Device("CPU:0")) \
+    ENUM_INDEXING_SIZE(FUNC, CUDA, Device("CUDA:0"))
+#else
+#define ENUM_INDEXING_DEVICE(FUNC) \
+    ENUM_INDEXING_SIZE(FUNC, CPU, Device("CPU:0"))
+#endif
+
+ENUM_INDEXING_DEVICE(IndexGetRows)
+ENUM_INDEXING_DEVICE(IndexGetMask)
+ENUM_INDEXING_DEVICE(IndexSetRows)
+
+}  // namespace core
+}  // namespace open3d
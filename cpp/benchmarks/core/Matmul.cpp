@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+void MatmulSquare(benchmark::State& state, const Device& device) {
+    int64_t n = state.range(0);
+    Tensor lhs = Tensor::Ones({n, n}, Dtype::Float32, device);
+    Tensor rhs = Tensor::Ones({n, n}, Dtype::Float32, device);
+
+    Tensor warm_up = lhs.Matmul(rhs);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = lhs.Matmul(rhs);
+    }
+}
+
+// Transformation of N points by a 3 x 3 matrix, as in the geometry kernels.
+void MatmulTallSkinny(benchmark::State& state, const Device& device) {
+    Tensor points = Tensor::Ones({state.range(0), 3}, Dtype::Float32, device);
+    Tensor rotation = Tensor::Eye(3, Dtype::Float32, device);
+
+    Tensor warm_up = points.Matmul(rotation);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = points.Matmul(rotation);
+    }
+}
+
+BENCHMARK_CAPTURE(MatmulSquare, CPU, Device("CPU:0"))
+        ->Arg(256)
+        ->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(MatmulTallSkinny, CPU, Device("CPU:0"))
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(MatmulSquare, CUDA, Device("CUDA:0"))
+        ->Arg(256)
+        ->Arg(1024)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(MatmulTallSkinny, CUDA, Device("CUDA:0"))
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace core
+}  // namespace open3d
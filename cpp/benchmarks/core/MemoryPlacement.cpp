@@ -0,0 +1,72 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace core {
+
+// Bandwidth-bound element-wise kernel on tensors allocated with the given
+// placement. The difference only shows on multi-socket machines with bound
+// threads, e.g. OMP_PROC_BIND=close.
+void AddPlacement(benchmark::State& state, CPUMemoryPlacement placement) {
+    const CPUMemoryPlacement prev_placement = CPUMemoryManager::GetPlacement();
+    CPUMemoryManager::SetPlacement(placement);
+
+    const Device device("CPU:0");
+    const int64_t n = int64_t(1) << 26;
+    Tensor a = Tensor::Empty({n}, Dtype::Float32, device);
+    Tensor b = Tensor::Empty({n}, Dtype::Float32, device);
+    {
+        // Fill on a single thread, which places all pages on one node with
+        // the default placement.
+        utility::ScopedNumThreads single_thread(1);
+        a.Fill(1);
+        b.Fill(2);
+    }
+    for (auto _ : state) {
+        a.Add_(b);
+    }
+    state.SetBytesProcessed(state.iterations() * n * 3 * sizeof(float));
+
+    CPUMemoryManager::SetPlacement(prev_placement);
+}
+
+BENCHMARK_CAPTURE(AddPlacement, Default, CPUMemoryPlacement::Default)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(AddPlacement,
+                  ParallelFirstTouch,
+                  CPUMemoryPlacement::ParallelFirstTouch)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(AddPlacement, Interleaved, CPUMemoryPlacement::Interleaved)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace core
+}  // namespace open3d
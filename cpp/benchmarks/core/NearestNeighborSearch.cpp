@@ -0,0 +1,525 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/NearestNeighborSearch.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <tuple>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/core/nns/KnnIndex.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+#ifdef WITH_FAISS
+#include "open3d/core/nns/FaissIndex.h"
+#endif
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// Synthetic point distributions. All generators are deterministic for a
+/// given number of points and seed.
+enum class PointDistribution {
+    /// Uniform in the unit cube.
+    Uniform,
+    /// 64-beam spinning LiDAR 1.8m above the ground, in a street with walls
+    /// 10m away on both sides and 80m range. Dense close to the sensor,
+    /// sparse rings far away.
+    LidarScan,
+    /// 640x480 depth frames from random poses in a 5x4x3m room with boxes,
+    /// with depth noise growing quadratically with the distance.
+    IndoorRGBD,
+};
+
+/// Backends that NearestNeighborSearch dispatches to.
+enum class NNSBackend { NanoFlann, FixedRadius, Faiss, Knn };
+
+static Tensor GenerateUniform(int64_t num_points, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> u(0, 1);
+    std::vector<float> points(num_points * 3);
+    for (float& v : points) {
+        v = u(rng);
+    }
+    return Tensor(points, {num_points, 3}, Dtype::Float32);
+}
+
+static Tensor GenerateLidarScan(int64_t num_points, uint32_t seed) {
+    const double kPi = 3.14159265358979323846;
+    const double sensor_height = 1.8;
+    const double wall_distance = 10.0;
+    const double max_range = 80.0;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> beam_dist(0, 63);
+    std::uniform_real_distribution<double> azimuth_dist(0, 2 * kPi);
+    std::normal_distribution<double> noise(0, 0.02);
+    std::vector<float> points(num_points * 3);
+    for (int64_t i = 0; i < num_points; ++i) {
+        // Beams evenly spaced from -24.8 to 2 degrees.
+        double elevation =
+                (-24.8 + beam_dist(rng) * (26.8 / 63.0)) * kPi / 180.0;
+        double azimuth = azimuth_dist(rng);
+        double dx = std::cos(elevation) * std::cos(azimuth);
+        double dy = std::cos(elevation) * std::sin(azimuth);
+        double dz = std::sin(elevation);
+        double range = max_range;
+        if (dz < 0) {
+            range = std::min(range, sensor_height / -dz);
+        }
+        if (dy != 0) {
+            range = std::min(range, wall_distance / std::abs(dy));
+        }
+        range += noise(rng);
+        points[3 * i + 0] = float(range * dx);
+        points[3 * i + 1] = float(range * dy);
+        points[3 * i + 2] = float(range * dz);
+    }
+    return Tensor(points, {num_points, 3}, Dtype::Float32);
+}
+
+/// Distance along the ray (o, d) to the first intersection with the
+/// axis-aligned box [lo, hi]: the entry distance if the origin is outside,
+/// the exit distance if it is inside, or infinity if there is none.
+static double IntersectBox(const double o[3],
+                           const double d[3],
+                           const double lo[3],
+                           const double hi[3]) {
+    double t_near = -INFINITY, t_far = INFINITY;
+    for (int k = 0; k < 3; ++k) {
+        double t0 = (lo[k] - o[k]) / d[k];
+        double t1 = (hi[k] - o[k]) / d[k];
+        t_near = std::max(t_near, std::min(t0, t1));
+        t_far = std::min(t_far, std::max(t0, t1));
+    }
+    if (t_near > t_far || t_far <= 0) {
+        return INFINITY;
+    }
+    return t_near > 0 ? t_near : t_far;
+}
+
+static Tensor GenerateIndoorRGBD(int64_t num_points, uint32_t seed) {
+    const double kPi = 3.14159265358979323846;
+    const int width = 640, height = 480;
+    const double focal = 525.0;
+    const double room_lo[3] = {0, 0, 0};
+    const double room_hi[3] = {5, 4, 3};
+    const double boxes[4][2][3] = {{{0.5, 0.5, 0}, {1.5, 2.0, 0.8}},
+                                   {{3.0, 3.0, 0}, {4.8, 3.8, 2.0}},
+                                   {{2.0, 1.0, 0}, {3.2, 1.8, 0.75}},
+                                   {{4.2, 0.2, 0}, {4.8, 0.8, 1.2}}};
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> u(0, 1);
+    std::normal_distribution<double> noise(0, 1);
+    std::vector<float> points(num_points * 3);
+    double o[3] = {0, 0, 0};
+    double yaw = 0, pitch = 0;
+    for (int64_t i = 0; i < num_points; ++i) {
+        // A new random camera pose for every frame.
+        if (i % (width * height) == 0) {
+            o[0] = 1.0 + 3.0 * u(rng);
+            o[1] = 1.0 + 2.0 * u(rng);
+            o[2] = 1.2 + 0.6 * u(rng);
+            yaw = 2 * kPi * u(rng);
+            pitch = -0.4 * u(rng);
+        }
+        // Camera looking along x, rotated by pitch then yaw.
+        double px = (u(rng) * width - width / 2.0) / focal;
+        double py = (u(rng) * height - height / 2.0) / focal;
+        double cx = 1, cy = -px, cz = -py;
+        double tx = cx * std::cos(pitch) - cz * std::sin(pitch);
+        double tz = cx * std::sin(pitch) + cz * std::cos(pitch);
+        double d[3] = {tx * std::cos(yaw) - cy * std::sin(yaw),
+                       tx * std::sin(yaw) + cy * std::cos(yaw), tz};
+        double t = IntersectBox(o, d, room_lo, room_hi);
+        for (const auto& box : boxes) {
+            t = std::min(t, IntersectBox(o, d, box[0], box[1]));
+        }
+        // Depth is t along the optical axis. Kinect-like axial noise.
+        double sigma = 0.0012 + 0.0019 * (t - 0.4) * (t - 0.4);
+        t += sigma * noise(rng);
+        for (int k = 0; k < 3; ++k) {
+            points[3 * i + k] = float(o[k] + t * d[k]);
+        }
+    }
+    return Tensor(points, {num_points, 3}, Dtype::Float32);
+}
+
+static Tensor GeneratePoints(PointDistribution distribution,
+                             int64_t num_points,
+                             uint32_t seed) {
+    switch (distribution) {
+        case PointDistribution::Uniform:
+            return GenerateUniform(num_points, seed);
+        case PointDistribution::LidarScan:
+            return GenerateLidarScan(num_points, seed);
+        case PointDistribution::IndoorRGBD:
+            return GenerateIndoorRGBD(num_points, seed);
+    }
+    utility::LogError("Unknown point distribution.");
+}
+
+/// Keeps the last generated points, so that consecutive benchmarks on the
+/// same dataset don't regenerate up to 100M points.
+class PointsCache {
+public:
+    const Tensor& Get(PointDistribution distribution,
+                      int64_t num_points,
+                      uint32_t seed,
+                      const Device& device) {
+        auto key = std::make_tuple(distribution, num_points, seed,
+                                   device.ToString());
+        if (key != key_) {
+            points_ = Tensor();
+            points_ = GeneratePoints(distribution, num_points, seed).To(device);
+            key_ = key;
+        }
+        return points_;
+    }
+
+private:
+    std::tuple<PointDistribution, int64_t, uint32_t, std::string> key_;
+    Tensor points_;
+};
+
+// Never destroyed: tensors must not outlive the memory managers on exit.
+static PointsCache& dataset_cache = *new PointsCache();
+static PointsCache& query_cache = *new PointsCache();
+
+/// Search radius giving about the same number of neighbors, 30 to 40, for
+/// every dataset size: the radius at 1M points scaled by the intrinsic
+/// dimension of the distribution.
+static double GetRadius(PointDistribution distribution, int64_t num_points) {
+    double scale = 1e6 / double(num_points);
+    switch (distribution) {
+        case PointDistribution::Uniform:
+            return 0.02 * std::cbrt(scale);
+        case PointDistribution::LidarScan:
+            return 0.2 * std::sqrt(scale);
+        case PointDistribution::IndoorRGBD:
+            return 0.03 * std::sqrt(scale);
+    }
+    utility::LogError("Unknown point distribution.");
+}
+
+static std::unique_ptr<NNSIndex> CreateIndex(NNSBackend backend,
+                                             const Tensor& dataset,
+                                             double radius) {
+    std::unique_ptr<NNSIndex> index;
+    switch (backend) {
+        case NNSBackend::NanoFlann:
+            index.reset(new NanoFlannIndex());
+            index->SetTensorData(dataset);
+            break;
+        case NNSBackend::FixedRadius:
+            index.reset(new FixedRadiusIndex());
+            index->SetTensorData(dataset, radius);
+            break;
+        case NNSBackend::Faiss:
+#ifdef WITH_FAISS
+            index.reset(new FaissIndex());
+            index->SetTensorData(dataset);
+#else
+            utility::LogError("Faiss is not available.");
+#endif
+            break;
+        case NNSBackend::Knn:
+            index.reset(new KnnIndex());
+            index->SetTensorData(dataset);
+            break;
+    }
+    return index;
+}
+
+static void Synchronize(const Device& device) {
+#ifdef BUILD_CUDA_MODULE
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    }
+#endif
+}
+
+/// Arguments: {num_dataset_points}.
+void BuildIndex(benchmark::State& state,
+                PointDistribution distribution,
+                NNSBackend backend,
+                const Device& device) {
+    const int64_t num_points = state.range(0);
+    const Tensor& dataset =
+            dataset_cache.Get(distribution, num_points, 0, device);
+    const double radius = GetRadius(distribution, num_points);
+
+    for (auto _ : state) {
+        std::unique_ptr<NNSIndex> index =
+                CreateIndex(backend, dataset, radius);
+        Synchronize(device);
+    }
+}
+
+/// Arguments: {num_dataset_points, num_query_points, knn}.
+void KnnSearch(benchmark::State& state,
+               PointDistribution distribution,
+               NNSBackend backend,
+               const Device& device) {
+    const int64_t num_points = state.range(0);
+    const Tensor& dataset =
+            dataset_cache.Get(distribution, num_points, 0, device);
+    const Tensor& queries =
+            query_cache.Get(distribution, state.range(1), 1, device);
+    const int knn = int(state.range(2));
+    std::unique_ptr<NNSIndex> index = CreateIndex(backend, dataset, 0);
+
+    // Warm up.
+    index->SearchKnn(queries, knn);
+    Synchronize(device);
+
+    for (auto _ : state) {
+        Tensor indices, distances;
+        std::tie(indices, distances) = index->SearchKnn(queries, knn);
+        Synchronize(device);
+    }
+    state.SetItemsProcessed(state.iterations() * queries.GetLength());
+}
+
+/// Arguments: {num_dataset_points, num_query_points}.
+void RadiusSearch(benchmark::State& state,
+                  PointDistribution distribution,
+                  NNSBackend backend,
+                  const Device& device) {
+    const int64_t num_points = state.range(0);
+    const Tensor& dataset =
+            dataset_cache.Get(distribution, num_points, 0, device);
+    const Tensor& queries =
+            query_cache.Get(distribution, state.range(1), 1, device);
+    const double radius = GetRadius(distribution, num_points);
+    std::unique_ptr<NNSIndex> index = CreateIndex(backend, dataset, radius);
+
+    // Warm up.
+    Tensor indices, distances, num_neighbors;
+    std::tie(indices, distances, num_neighbors) =
+            index->SearchRadius(queries, radius, true);
+    Synchronize(device);
+
+    for (auto _ : state) {
+        std::tie(indices, distances, num_neighbors) =
+                index->SearchRadius(queries, radius, true);
+        Synchronize(device);
+    }
+    state.SetItemsProcessed(state.iterations() * queries.GetLength());
+    state.counters["neighbors"] =
+            double(indices.GetLength()) / double(queries.GetLength());
+}
+
+/// Arguments: {num_dataset_points, num_query_points, max_knn}.
+void HybridSearch(benchmark::State& state,
+                  PointDistribution distribution,
+                  NNSBackend backend,
+                  const Device& device) {
+    const int64_t num_points = state.range(0);
+    const Tensor& dataset =
+            dataset_cache.Get(distribution, num_points, 0, device);
+    const Tensor& queries =
+            query_cache.Get(distribution, state.range(1), 1, device);
+    const int max_knn = int(state.range(2));
+    const double radius = GetRadius(distribution, num_points);
+    std::unique_ptr<NNSIndex> index = CreateIndex(backend, dataset, radius);
+
+    // Warm up.
+    index->SearchHybrid(queries, radius, max_knn);
+    Synchronize(device);
+
+    for (auto _ : state) {
+        Tensor indices, distances, counts;
+        std::tie(indices, distances, counts) =
+                index->SearchHybrid(queries, radius, max_knn);
+        Synchronize(device);
+    }
+    state.SetItemsProcessed(state.iterations() * queries.GetLength());
+}
+
+/// Dataset sizes from 10k to 100M points. Run a subset with
+/// --benchmark_filter, e.g. --benchmark_filter="KnnSearch/.*Uniform.*/10000/".
+static const std::vector<int64_t> kDatasetSizes = {
+        10000, 100000, 1000000, 10000000, 100000000};
+static const std::vector<int64_t> kQuerySizes = {1000, 100000};
+static const std::vector<int64_t> kKnns = {1, 8, 32};
+
+/// Brute-force search is quadratic, so it is only run up to 1M points.
+static const int64_t kMaxBruteForceSize = 1000000;
+
+static void BuildArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t num_points : kDatasetSizes) {
+        b->Args({num_points});
+    }
+}
+
+static void RadiusArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t num_points : kDatasetSizes) {
+        for (int64_t num_queries : kQuerySizes) {
+            b->Args({num_points, num_queries});
+        }
+    }
+}
+
+static void KnnArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t num_points : kDatasetSizes) {
+        for (int64_t num_queries : kQuerySizes) {
+            for (int64_t knn : kKnns) {
+                b->Args({num_points, num_queries, knn});
+            }
+        }
+    }
+}
+
+static void BruteForceKnnArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t num_points : kDatasetSizes) {
+        if (num_points > kMaxBruteForceSize) {
+            continue;
+        }
+        for (int64_t num_queries : kQuerySizes) {
+            for (int64_t knn : kKnns) {
+                b->Args({num_points, num_queries, knn});
+            }
+        }
+    }
+}
+
+#define ENUM_NNS_DISTRIBUTION(FUNC, NAME, BACKEND, DEVICE, ARGS)            \
+    BENCHMARK_CAPTURE(FUNC, NAME##_Uniform, PointDistribution::Uniform,     \
+                      BACKEND, DEVICE)                                      \
+            ->Apply(ARGS)                                                   \
+            ->Unit(benchmark::kMillisecond);                                \
+    BENCHMARK_CAPTURE(FUNC, NAME##_LidarScan, PointDistribution::LidarScan, \
+                      BACKEND, DEVICE)                                      \
+            ->Apply(ARGS)                                                   \
+            ->Unit(benchmark::kMillisecond);                                \
+    BENCHMARK_CAPTURE(FUNC, NAME##_IndoorRGBD,                              \
+                      PointDistribution::IndoorRGBD, BACKEND, DEVICE)       \
+            ->Apply(ARGS)                                                   \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_NNS_DISTRIBUTION(BuildIndex,
+                      NanoFlann_CPU,
+                      NNSBackend::NanoFlann,
+                      Device("CPU:0"),
+                      BuildArgs)
+ENUM_NNS_DISTRIBUTION(BuildIndex,
+                      FixedRadius_CPU,
+                      NNSBackend::FixedRadius,
+                      Device("CPU:0"),
+                      BuildArgs)
+ENUM_NNS_DISTRIBUTION(KnnSearch,
+                      NanoFlann_CPU,
+                      NNSBackend::NanoFlann,
+                      Device("CPU:0"),
+                      KnnArgs)
+ENUM_NNS_DISTRIBUTION(KnnSearch,
+                      Knn_CPU,
+                      NNSBackend::Knn,
+                      Device("CPU:0"),
+                      BruteForceKnnArgs)
+ENUM_NNS_DISTRIBUTION(RadiusSearch,
+                      NanoFlann_CPU,
+                      NNSBackend::NanoFlann,
+                      Device("CPU:0"),
+                      RadiusArgs)
+ENUM_NNS_DISTRIBUTION(RadiusSearch,
+                      FixedRadius_CPU,
+                      NNSBackend::FixedRadius,
+                      Device("CPU:0"),
+                      RadiusArgs)
+ENUM_NNS_DISTRIBUTION(HybridSearch,
+                      NanoFlann_CPU,
+                      NNSBackend::NanoFlann,
+                      Device("CPU:0"),
+                      KnnArgs)
+ENUM_NNS_DISTRIBUTION(HybridSearch,
+                      FixedRadius_CPU,
+                      NNSBackend::FixedRadius,
+                      Device("CPU:0"),
+                      KnnArgs)
+ENUM_NNS_DISTRIBUTION(HybridSearch,
+                      Knn_CPU,
+                      NNSBackend::Knn,
+                      Device("CPU:0"),
+                      BruteForceKnnArgs)
+
+#ifdef WITH_FAISS
+ENUM_NNS_DISTRIBUTION(BuildIndex,
+                      Faiss_CPU,
+                      NNSBackend::Faiss,
+                      Device("CPU:0"),
+                      BuildArgs)
+ENUM_NNS_DISTRIBUTION(KnnSearch,
+                      Faiss_CPU,
+                      NNSBackend::Faiss,
+                      Device("CPU:0"),
+                      BruteForceKnnArgs)
+#endif
+
+#ifdef BUILD_CUDA_MODULE
+ENUM_NNS_DISTRIBUTION(BuildIndex,
+                      FixedRadius_CUDA,
+                      NNSBackend::FixedRadius,
+                      Device("CUDA:0"),
+                      BuildArgs)
+ENUM_NNS_DISTRIBUTION(KnnSearch,
+                      Knn_CUDA,
+                      NNSBackend::Knn,
+                      Device("CUDA:0"),
+                      BruteForceKnnArgs)
+ENUM_NNS_DISTRIBUTION(RadiusSearch,
+                      FixedRadius_CUDA,
+                      NNSBackend::FixedRadius,
+                      Device("CUDA:0"),
+                      RadiusArgs)
+ENUM_NNS_DISTRIBUTION(HybridSearch,
+                      FixedRadius_CUDA,
+                      NNSBackend::FixedRadius,
+                      Device("CUDA:0"),
+                      KnnArgs)
+#ifdef WITH_FAISS
+ENUM_NNS_DISTRIBUTION(BuildIndex,
+                      Faiss_CUDA,
+                      NNSBackend::Faiss,
+                      Device("CUDA:0"),
+                      BuildArgs)
+ENUM_NNS_DISTRIBUTION(KnnSearch,
+                      Faiss_CUDA,
+                      NNSBackend::Faiss,
+                      Device("CUDA:0"),
+                      KnnArgs)
+#endif
+#endif
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -47,12 +47,41 @@ void Reduction(benchmark::State& state, const Device& device) {
     }
 }
 
+void ReductionTallSkinny(benchmark::State& state, const Device& device) {
+    SizeVector shape{1 << 24, 3};
+    Tensor src = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor warm_up = src.Sum({0});
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.Sum({0});
+    }
+}
+
+void ReductionMeanVariance(benchmark::State& state, const Device& device) {
+    SizeVector shape{1 << 24, 3};
+    Tensor src = Tensor::Ones(shape, Dtype::Float32, device);
+    Tensor warm_up = std::get<0>(src.MeanVariance({0}));
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor mean, variance;
+        std::tie(mean, variance) = src.MeanVariance({0});
+    }
+}
+
 BENCHMARK_CAPTURE(Reduction, CPU, Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionTallSkinny, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionMeanVariance, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
 
 #ifdef BUILD_CUDA_MODULE
 BENCHMARK_CAPTURE(Reduction, CUDA, Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionTallSkinny, CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReductionMeanVariance, CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
 #endif
 
 }  // namespace core
@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+// Tensor::To between devices, state.range(0) bytes per copy.
+void TensorTo(benchmark::State& state,
+              const Device& src_device,
+              const Device& dst_device) {
+    int64_t num_bytes = state.range(0);
+    Tensor src = Tensor::Ones({num_bytes}, Dtype::UInt8, src_device);
+
+    Tensor warm_up = src.To(dst_device, /*copy=*/true);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.To(dst_device, /*copy=*/true);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * num_bytes);
+}
+
+BENCHMARK_CAPTURE(TensorTo, CPU_CPU, Device("CPU:0"), Device("CPU:0"))
+        ->Arg(1 << 20)
+        ->Arg(1 << 26)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+// Host to device copy from pinned memory, which is asynchronous and does not
+// need staging.
+void TensorToFromPinned(benchmark::State& state, const Device& dst_device) {
+    int64_t num_bytes = state.range(0);
+    Tensor src = Tensor::Ones({num_bytes}, Dtype::UInt8, Device("CPU:0"))
+                         .PinMemory();
+
+    Tensor warm_up = src.To(dst_device, /*copy=*/true);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor dst = src.To(dst_device, /*copy=*/true);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * num_bytes);
+}
+
+BENCHMARK_CAPTURE(TensorTo, CPU_CUDA, Device("CPU:0"), Device("CUDA:0"))
+        ->Arg(1 << 20)
+        ->Arg(1 << 26)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TensorTo, CUDA_CPU, Device("CUDA:0"), Device("CPU:0"))
+        ->Arg(1 << 20)
+        ->Arg(1 << 26)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TensorTo, CUDA_CUDA, Device("CUDA:0"), Device("CUDA:0"))
+        ->Arg(1 << 20)
+        ->Arg(1 << 26)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(TensorToFromPinned, CUDA, Device("CUDA:0"))
+        ->Arg(1 << 20)
+        ->Arg(1 << 26)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace core
+}  // namespace open3d
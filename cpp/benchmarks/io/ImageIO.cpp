@@ -0,0 +1,179 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/ImageIO.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+enum class Backend : int { LEGACY = 0, TENSOR = 1 };
+
+struct ReadWriteImageArgs {
+    std::string filename;
+    int num_of_channels;
+    int bytes_per_channel;
+    // Formats that only the tensor IO supports.
+    bool tensor_only;
+};
+std::vector<ReadWriteImageArgs> g_image_args({
+        {"color.png", 3, 1, false},  // 0
+        {"color.jpg", 3, 1, false},  // 1
+        {"depth.png", 1, 2, false},  // 2
+        {"color.o3dt", 3, 1, true},  // 3
+        {"depth.o3dt", 1, 2, true},  // 4
+});
+
+int64_t GetFileSize(const std::string &filename) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        utility::LogError("Failed to open {}", filename);
+    }
+    return file.GetFileSize();
+}
+
+class TestImage {
+    geometry::Image image_;
+    t::geometry::Image timage_;
+    int args_id_ = -1;
+    int width_ = 0;
+
+public:
+    void Setup(int args_id, int width) {
+        if (args_id_ == args_id && width_ == width) return;
+        const auto &args = g_image_args[args_id];
+        const int height = width * 3 / 4;
+        utility::LogInfo("setup Image {} {}x{}", args.filename, width, height);
+        args_id_ = args_id;
+        width_ = width;
+
+        image_.Prepare(width, height, args.num_of_channels,
+                       args.bytes_per_channel);
+        // Smooth content with some noise, similar to captured frames, so
+        // that the compression of PNG and JPG does neither degenerate nor
+        // get a free pass.
+        for (int v = 0; v < height; ++v) {
+            for (int u = 0; u < width; ++u) {
+                const int64_t i = int64_t(v) * width + u;
+                const double s = std::sin(u * .0131) * std::cos(v * .0173);
+                if (args.bytes_per_channel == 2) {
+                    *image_.PointerAt<uint16_t>(u, v) =
+                            uint16_t(2000 + 1000 * s + (i * 7919) % 17);
+                } else {
+                    for (int c = 0; c < args.num_of_channels; ++c) {
+                        *image_.PointerAt<uint8_t>(u, v, c) = uint8_t(
+                                127 + 100 * s + (i * (c + 3) * 7919) % 23);
+                    }
+                }
+            }
+        }
+        timage_ = t::geometry::Image::FromLegacyImage(image_);
+    }
+
+    void Write(const std::string &filename, Backend backend) const {
+        const bool success = backend == Backend::TENSOR
+                                     ? t::io::WriteImage(filename, timage_)
+                                     : io::WriteImage(filename, image_);
+        if (!success) {
+            utility::LogError("Failed to write to {}", filename);
+        }
+    }
+};
+// reuse the same instance so we don't recreate the image every time
+TestImage test_image;
+
+}  // namespace
+
+// Args: {image_args_id, width, backend}, the height is 3/4 of the width. The
+// throughput is reported in bytes of the file per second.
+static void BM_WriteImage(::benchmark::State &state) {
+    const auto &args = g_image_args[state.range(0)];
+    const Backend backend = Backend(state.range(2));
+    test_image.Setup(state.range(0), state.range(1));
+
+    for (auto _ : state) {
+        test_image.Write(args.filename, backend);
+    }
+    state.SetBytesProcessed(state.iterations() * GetFileSize(args.filename));
+    state.SetLabel(args.filename +
+                   (backend == Backend::TENSOR ? " tensor" : " legacy"));
+}
+
+static void BM_ReadImage(::benchmark::State &state) {
+    const auto &args = g_image_args[state.range(0)];
+    const Backend backend = Backend(state.range(2));
+    test_image.Setup(state.range(0), state.range(1));
+    test_image.Write(args.filename, backend);
+
+    for (auto _ : state) {
+        bool success;
+        if (backend == Backend::TENSOR) {
+            t::geometry::Image image;
+            success = t::io::ReadImage(args.filename, image);
+        } else {
+            geometry::Image image;
+            success = io::ReadImage(args.filename, image);
+        }
+        if (!success) {
+            utility::LogError("Failed to read from {}", args.filename);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * GetFileSize(args.filename));
+    state.SetLabel(args.filename +
+                   (backend == Backend::TENSOR ? " tensor" : " legacy"));
+}
+
+static void BM_ImageIO_Args(benchmark::internal::Benchmark *b) {
+    for (int j : {640, 1280, 1920}) {
+        for (int i = 0; i < int(g_image_args.size()); ++i) {
+            if (!g_image_args[i].tensor_only) {
+                b->Args({i, j, int(Backend::LEGACY)});
+            }
+            b->Args({i, j, int(Backend::TENSOR)});
+        }
+    }
+}
+
+BENCHMARK(BM_WriteImage)
+        ->MinTime(0.1)
+        ->Apply(BM_ImageIO_Args)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReadImage)
+        ->MinTime(0.1)
+        ->Apply(BM_ImageIO_Args)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
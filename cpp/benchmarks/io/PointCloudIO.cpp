@@ -28,6 +28,8 @@
 
 #include <benchmark/benchmark.h>
 
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -118,6 +120,8 @@ public:
         }
     }
 
+    const geometry::PointCloud &GetPointCloud() const { return pc_; }
+
     void WriteRead(int pc_args_id) {
         const auto &args = g_pc_args[pc_args_id];
         const auto &pc = pc_;
@@ -177,5 +181,97 @@ static void BM_TestPCGrid0_Args(benchmark::internal::Benchmark *b) {
 
 BENCHMARK(BM_TestPCGrid0)->MinTime(0.1)->Apply(BM_TestPCGrid0_Args);
 
+namespace {
+
+enum class Backend : int { LEGACY = 0, TENSOR = 1 };
+
+int64_t GetFileSize(const std::string &filename) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        utility::LogError("Failed to open {}", filename);
+    }
+    return file.GetFileSize();
+}
+
+void WritePC(const ReadWritePCArgs &args,
+             const geometry::PointCloud &pc,
+             const t::geometry::PointCloud &tpc,
+             Backend backend) {
+    const io::WritePointCloudOption params(bool(args.write_ascii),
+                                           bool(args.compressed));
+    const bool success = backend == Backend::TENSOR
+                                 ? t::io::WritePointCloud(args.filename, tpc,
+                                                          params)
+                                 : WritePointCloud(args.filename, pc, params);
+    if (!success) {
+        utility::LogError("Failed to write to {}", args.filename);
+    }
+}
+
+}  // namespace
+
+// Args: {pc_args_id, number of points, backend}. The throughput is reported
+// in bytes of the written file per second.
+static void BM_WritePointCloud(::benchmark::State &state) {
+    const auto &args = g_pc_args[state.range(0)];
+    const Backend backend = Backend(state.range(2));
+    test_pc_grid0.Setup(state.range(1));
+    const geometry::PointCloud &pc = test_pc_grid0.GetPointCloud();
+    const t::geometry::PointCloud tpc =
+            t::geometry::PointCloud::FromLegacyPointCloud(pc);
+
+    for (auto _ : state) {
+        WritePC(args, pc, tpc, backend);
+    }
+    state.SetBytesProcessed(state.iterations() * GetFileSize(args.filename));
+    state.SetLabel(args.filename +
+                   (backend == Backend::TENSOR ? " tensor" : " legacy"));
+}
+
+static void BM_ReadPointCloud(::benchmark::State &state) {
+    const auto &args = g_pc_args[state.range(0)];
+    const Backend backend = Backend(state.range(2));
+    test_pc_grid0.Setup(state.range(1));
+    const geometry::PointCloud &pc = test_pc_grid0.GetPointCloud();
+    WritePC(args, pc, t::geometry::PointCloud(), Backend::LEGACY);
+
+    for (auto _ : state) {
+        bool success;
+        if (backend == Backend::TENSOR) {
+            t::geometry::PointCloud tpc;
+            success = t::io::ReadPointCloud(args.filename, tpc,
+                                            {"auto", false, false, false});
+        } else {
+            geometry::PointCloud pc2;
+            success = ReadPointCloud(args.filename, pc2,
+                                     {"auto", false, false, false});
+        }
+        if (!success) {
+            utility::LogError("Failed to read from {}", args.filename);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * GetFileSize(args.filename));
+    state.SetLabel(args.filename +
+                   (backend == Backend::TENSOR ? " tensor" : " legacy"));
+}
+
+static void BM_PointCloudIO_Args(benchmark::internal::Benchmark *b) {
+    for (int j = 4 * 1024; j <= 256 * 1024; j *= 8) {
+        for (int i = 0; i < int(g_pc_args.size()); ++i) {
+            b->Args({i, j, int(Backend::LEGACY)});
+            b->Args({i, j, int(Backend::TENSOR)});
+        }
+    }
+}
+
+BENCHMARK(BM_WritePointCloud)
+        ->MinTime(0.1)
+        ->Apply(BM_PointCloudIO_Args)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReadPointCloud)
+        ->MinTime(0.1)
+        ->Apply(BM_PointCloudIO_Args)
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace benchmarks
 }  // namespace open3d
@@ -0,0 +1,156 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/PoseGraphIO.h"
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Geometry>
+#include <cmath>
+
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+std::vector<std::string> g_pose_graph_filenames({
+        "test_pose_graph.json",  // 0
+        "test_pose_graph.bin",   // 1
+});
+
+int64_t GetFileSize(const std::string &filename) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        utility::LogError("Failed to open {}", filename);
+    }
+    return file.GetFileSize();
+}
+
+class TestPoseGraph {
+    pipelines::registration::PoseGraph pose_graph_;
+    int num_nodes_ = 0;
+
+public:
+    /// Creates a pose graph with odometry edges between consecutive nodes and
+    /// a loop closure edge every 4th node, like the fragment pose graphs of
+    /// the reconstruction system.
+    void Setup(int num_nodes) {
+        if (num_nodes_ == num_nodes) return;
+        utility::LogInfo("setup PoseGraph num_nodes={}", num_nodes);
+        num_nodes_ = num_nodes;
+        pose_graph_.nodes_.clear();
+        pose_graph_.edges_.clear();
+
+        auto pose = [](int i) {
+            const Eigen::Vector3d axis(std::sin(i * .3898546778), 1.0,
+                                       std::sin(i * .2509962463));
+            Eigen::Matrix4d T = Eigen::Matrix4d::Identity();
+            T.block<3, 3>(0, 0) =
+                    Eigen::AngleAxisd(std::sin(i * .8969920581),
+                                      axis.normalized())
+                            .toRotationMatrix();
+            T.block<3, 1>(0, 3) = Eigen::Vector3d(std::sin(i * .4472367685),
+                                                  std::sin(i * .9698787116),
+                                                  std::sin(i * .7072878517));
+            return T;
+        };
+        for (int i = 0; i < num_nodes; ++i) {
+            pose_graph_.nodes_.emplace_back(pose(i));
+        }
+        for (int i = 0; i + 1 < num_nodes; ++i) {
+            const Eigen::Matrix6d information =
+                    Eigen::Matrix6d::Identity() * (i + 1);
+            pose_graph_.edges_.emplace_back(i, i + 1, pose(num_nodes + i),
+                                            information, false);
+            if (i % 4 == 0 && i + 8 < num_nodes) {
+                pose_graph_.edges_.emplace_back(i, i + 8,
+                                                pose(2 * num_nodes + i),
+                                                information, true, 0.5);
+            }
+        }
+    }
+
+    void Write(const std::string &filename) const {
+        if (!io::WritePoseGraph(filename, pose_graph_)) {
+            utility::LogError("Failed to write to {}", filename);
+        }
+    }
+};
+// reuse the same instance so we don't recreate the pose graph every time
+TestPoseGraph test_pose_graph;
+
+}  // namespace
+
+// Args: {filename_id, number of nodes}. The throughput is reported in bytes of
+// the file per second.
+static void BM_WritePoseGraph(::benchmark::State &state) {
+    const std::string &filename = g_pose_graph_filenames[state.range(0)];
+    test_pose_graph.Setup(state.range(1));
+
+    for (auto _ : state) {
+        test_pose_graph.Write(filename);
+    }
+    state.SetBytesProcessed(state.iterations() * GetFileSize(filename));
+    state.SetLabel(filename);
+}
+
+static void BM_ReadPoseGraph(::benchmark::State &state) {
+    const std::string &filename = g_pose_graph_filenames[state.range(0)];
+    test_pose_graph.Setup(state.range(1));
+    test_pose_graph.Write(filename);
+
+    for (auto _ : state) {
+        pipelines::registration::PoseGraph pose_graph;
+        if (!io::ReadPoseGraph(filename, pose_graph)) {
+            utility::LogError("Failed to read from {}", filename);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * GetFileSize(filename));
+    state.SetLabel(filename);
+}
+
+static void BM_PoseGraphIO_Args(benchmark::internal::Benchmark *b) {
+    for (int j = 64; j <= 4096; j *= 8) {
+        for (int i = 0; i < int(g_pose_graph_filenames.size()); ++i) {
+            b->Args({i, j});
+        }
+    }
+}
+
+BENCHMARK(BM_WritePoseGraph)
+        ->MinTime(0.1)
+        ->Apply(BM_PoseGraphIO_Args)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReadPoseGraph)
+        ->MinTime(0.1)
+        ->Apply(BM_PoseGraphIO_Args)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/TriangleMeshIO.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace benchmarks {
+
+namespace {
+
+enum class IsAscii : bool { BINARY = false, ASCII = true };
+enum class Backend : int { LEGACY = 0, TENSOR = 1 };
+
+struct ReadWriteMeshArgs {
+    std::string filename;
+    IsAscii write_ascii;
+};
+std::vector<ReadWriteMeshArgs> g_mesh_args({
+        {"testb.ply", IsAscii::BINARY},  // 0
+        {"testa.ply", IsAscii::ASCII},   // 1
+        {"test.obj", IsAscii::ASCII},    // 2
+        {"test.stl", IsAscii::BINARY},   // 3
+        {"test.gltf", IsAscii::ASCII},   // 4
+        {"test.glb", IsAscii::BINARY},   // 5
+});
+
+int64_t GetFileSize(const std::string &filename) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        utility::LogError("Failed to open {}", filename);
+    }
+    return file.GetFileSize();
+}
+
+class TestMeshSphere {
+    geometry::TriangleMesh mesh_;
+    t::geometry::TriangleMesh tmesh_;
+    int resolution_ = 0;
+
+public:
+    void Setup(int resolution) {
+        if (resolution_ == resolution) return;
+        utility::LogInfo("setup MeshSphere resolution={}", resolution);
+        resolution_ = resolution;
+        mesh_ = *geometry::TriangleMesh::CreateSphere(1.0, resolution);
+        mesh_.ComputeVertexNormals();
+        mesh_.ComputeTriangleNormals();
+        mesh_.vertex_colors_.clear();
+        for (size_t i = 0; i < mesh_.vertices_.size(); ++i) {
+            mesh_.vertex_colors_.push_back({std::fmod(i * .4241490710, 1.0),
+                                            std::fmod(i * .6468026221, 1.0),
+                                            std::fmod(i * .5376722873, 1.0)});
+        }
+        tmesh_ = t::geometry::TriangleMesh::FromLegacyTriangleMesh(mesh_);
+    }
+
+    void Write(const ReadWriteMeshArgs &args, Backend backend) const {
+        const bool success =
+                backend == Backend::TENSOR
+                        ? t::io::WriteTriangleMesh(args.filename, tmesh_,
+                                                   bool(args.write_ascii))
+                        : io::WriteTriangleMesh(args.filename, mesh_,
+                                                bool(args.write_ascii));
+        if (!success) {
+            utility::LogError("Failed to write to {}", args.filename);
+        }
+    }
+};
+// reuse the same instance so we don't recreate the mesh every time
+TestMeshSphere test_mesh_sphere;
+
+}  // namespace
+
+// Args: {mesh_args_id, sphere resolution, backend}. A sphere of resolution r
+// has 2r(r-1)+2 vertices. The throughput is reported in bytes of the file per
+// second.
+static void BM_WriteTriangleMesh(::benchmark::State &state) {
+    const auto &args = g_mesh_args[state.range(0)];
+    const Backend backend = Backend(state.range(2));
+    test_mesh_sphere.Setup(state.range(1));
+
+    for (auto _ : state) {
+        test_mesh_sphere.Write(args, backend);
+    }
+    state.SetBytesProcessed(state.iterations() * GetFileSize(args.filename));
+    state.SetLabel(args.filename +
+                   (backend == Backend::TENSOR ? " tensor" : " legacy"));
+}
+
+static void BM_ReadTriangleMesh(::benchmark::State &state) {
+    const auto &args = g_mesh_args[state.range(0)];
+    const Backend backend = Backend(state.range(2));
+    test_mesh_sphere.Setup(state.range(1));
+    test_mesh_sphere.Write(args, Backend::LEGACY);
+
+    for (auto _ : state) {
+        bool success;
+        if (backend == Backend::TENSOR) {
+            t::geometry::TriangleMesh mesh;
+            success = t::io::ReadTriangleMesh(args.filename, mesh);
+        } else {
+            geometry::TriangleMesh mesh;
+            success = io::ReadTriangleMesh(args.filename, mesh);
+        }
+        if (!success) {
+            utility::LogError("Failed to read from {}", args.filename);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * GetFileSize(args.filename));
+    state.SetLabel(args.filename +
+                   (backend == Backend::TENSOR ? " tensor" : " legacy"));
+}
+
+static void BM_TriangleMeshIO_Args(benchmark::internal::Benchmark *b) {
+    for (int j = 20; j <= 320; j *= 4) {
+        for (int i = 0; i < int(g_mesh_args.size()); ++i) {
+            b->Args({i, j, int(Backend::LEGACY)});
+            b->Args({i, j, int(Backend::TENSOR)});
+        }
+    }
+}
+
+BENCHMARK(BM_WriteTriangleMesh)
+        ->MinTime(0.1)
+        ->Apply(BM_TriangleMeshIO_Args)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ReadTriangleMesh)
+        ->MinTime(0.1)
+        ->Apply(BM_TriangleMeshIO_Args)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -33,6 +33,9 @@
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/pipelines/registration/CorrespondenceChecker.h"
+#include "open3d/pipelines/registration/FastGlobalRegistration.h"
+#include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Logging.h"
 
@@ -53,6 +56,13 @@ static const int max_iterations = 1;
 // NNS parameter.
 static const double max_correspondence_distance = 0.15;
 
+// Iterations of the ICP runs to convergence over the registration pairs.
+static const int max_iterations_converged = 30;
+
+// Pairs (source, target) of ICP/cloud_bin_{}.pcd with decreasing overlap.
+static const std::vector<std::pair<int, int>> registration_pairs{
+        {1, 0}, {2, 1}, {2, 0}};
+
 namespace open3d {
 namespace pipelines {
 namespace registration {
@@ -131,6 +141,251 @@ BENCHMARK_CAPTURE(BenchmarkRegistrationICPLegacy,
                   TransformationEstimationType::PointToPoint)
         ->Unit(benchmark::kMillisecond);
 
+// Ground truth transformation of registration_pairs[pair], from the
+// transformations of ICP/init.log mapping cloud_bin_{j} to cloud_bin_{i}.
+static Eigen::Matrix4d GetGroundTruth(int pair) {
+    Eigen::Matrix4d T_01, T_12;
+    T_01 << 0.86214000, -0.13881100, 0.48729000, 0.32977900, 0.01137220,
+            0.96680300, 0.25528600, -0.39660460, -0.50654700, -0.21455100,
+            0.83509300, 1.62919450, 0.0, 0.0, 0.0, 1.0;
+    T_12 << 0.96329600, 0.08271910, -0.25539000, 0.22034280, -0.07796960,
+            0.99654800, 0.02868420, -0.02455154, 0.25688000, -0.00771860,
+            0.96641300, -0.30904690, 0.0, 0.0, 0.0, 1.0;
+    switch (pair) {
+        case 0:
+            return T_01;
+        case 1:
+            return T_12;
+        default:
+            return T_01 * T_12;
+    }
+}
+
+// Initial transformation of the ICP runs: the ground truth, perturbed by a
+// rotation of 0.05 rad and a translation of 5 cm.
+static Eigen::Matrix4d GetPerturbedGroundTruth(int pair) {
+    Eigen::Matrix4d perturbation = Eigen::Matrix4d::Identity();
+    perturbation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.05, Eigen::Vector3d(1, 1, 1).normalized())
+                    .toRotationMatrix();
+    perturbation.block<3, 1>(0, 3) = Eigen::Vector3d(0.05, 0, 0);
+    return perturbation * GetGroundTruth(pair);
+}
+
+static std::tuple<geometry::PointCloud, geometry::PointCloud> LoadPair(
+        int pair) {
+    return LoadPointCloud(
+            fmt::format(TEST_DATA_DIR "/ICP/cloud_bin_{}.pcd",
+                        registration_pairs[pair].first),
+            fmt::format(TEST_DATA_DIR "/ICP/cloud_bin_{}.pcd",
+                        registration_pairs[pair].second),
+            voxel_downsampling_factor);
+}
+
+// Reports the accuracy of a registration of pair as benchmark counters.
+static void SetAccuracyCounters(benchmark::State& state,
+                                const RegistrationResult& reg_result,
+                                int pair) {
+    Eigen::Matrix4d error =
+            GetGroundTruth(pair).inverse() * reg_result.transformation_;
+    double cos_angle = (error.block<3, 3>(0, 0).trace() - 1.0) / 2.0;
+    state.counters["Fitness"] = reg_result.fitness_;
+    state.counters["InlierRMSE"] = reg_result.inlier_rmse_;
+    state.counters["RotationErrorDeg"] =
+            std::acos(std::max(-1.0, std::min(1.0, cos_angle))) * 180.0 /
+            M_PI;
+    state.counters["TranslationError"] = error.block<3, 1>(0, 3).norm();
+}
+
+static std::shared_ptr<TransformationEstimation> CreateEstimation(
+        const TransformationEstimationType& type) {
+    if (type == TransformationEstimationType::PointToPlane) {
+        return std::make_shared<TransformationEstimationPointToPlane>();
+    }
+    return std::make_shared<TransformationEstimationPointToPoint>();
+}
+
+// Correspondences of the source transformed by transformation, as in an
+// iteration of RegistrationICP().
+static CorrespondenceSet SearchCorrespondences(
+        const geometry::PointCloud& source,
+        const geometry::KDTreeFlann& kdtree,
+        const Eigen::Matrix4d& transformation) {
+    geometry::PointCloud source_transformed = source;
+    source_transformed.Transform(transformation);
+    CorrespondenceSet corres;
+#pragma omp parallel
+    {
+        CorrespondenceSet corres_private;
+        std::vector<int> indices(1);
+        std::vector<double> dists(1);
+#pragma omp for nowait
+        for (int i = 0; i < int(source_transformed.points_.size()); ++i) {
+            if (kdtree.SearchHybrid(source_transformed.points_[i],
+                                    max_correspondence_distance, 1, indices,
+                                    dists) > 0) {
+                corres_private.emplace_back(i, indices[0]);
+            }
+        }
+#pragma omp critical
+        corres.insert(corres.end(), corres_private.begin(),
+                      corres_private.end());
+    }
+    return corres;
+}
+
+// ICP to convergence over registration_pairs, reporting its accuracy.
+static void BenchmarkRegistrationICPPairsLegacy(
+        benchmark::State& state, const TransformationEstimationType& type) {
+    const int pair = int(state.range(0));
+    geometry::PointCloud source, target;
+    std::tie(source, target) = LoadPair(pair);
+    auto estimation = CreateEstimation(type);
+    const Eigen::Matrix4d init_trans = GetPerturbedGroundTruth(pair);
+    const ICPConvergenceCriteria criteria(relative_fitness, relative_rmse,
+                                          max_iterations_converged);
+
+    RegistrationResult reg_result(init_trans);
+    for (auto _ : state) {
+        reg_result = RegistrationICP(source, target,
+                                     max_correspondence_distance, init_trans,
+                                     *estimation, criteria);
+    }
+    SetAccuracyCounters(state, reg_result, pair);
+}
+
+BENCHMARK_CAPTURE(BenchmarkRegistrationICPPairsLegacy,
+                  PointToPlane / CPU,
+                  TransformationEstimationType::PointToPlane)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkRegistrationICPPairsLegacy,
+                  PointToPoint / CPU,
+                  TransformationEstimationType::PointToPoint)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+// Stages of an ICP iteration: building the target index, the nearest
+// neighbor search and the reduction and solve of the transformation.
+static void BenchmarkICPStageKDTreeLegacy(benchmark::State& state) {
+    geometry::PointCloud source, target;
+    std::tie(source, target) = LoadPair(int(state.range(0)));
+    for (auto _ : state) {
+        geometry::KDTreeFlann kdtree(target);
+        benchmark::DoNotOptimize(kdtree);
+    }
+}
+
+BENCHMARK(BenchmarkICPStageKDTreeLegacy)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+static void BenchmarkICPStageNNSearchLegacy(benchmark::State& state) {
+    const int pair = int(state.range(0));
+    geometry::PointCloud source, target;
+    std::tie(source, target) = LoadPair(pair);
+    geometry::KDTreeFlann kdtree(target);
+    const Eigen::Matrix4d init_trans = GetPerturbedGroundTruth(pair);
+    for (auto _ : state) {
+        CorrespondenceSet corres =
+                SearchCorrespondences(source, kdtree, init_trans);
+        benchmark::DoNotOptimize(corres);
+    }
+}
+
+BENCHMARK(BenchmarkICPStageNNSearchLegacy)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+static void BenchmarkICPStageSolveLegacy(
+        benchmark::State& state, const TransformationEstimationType& type) {
+    const int pair = int(state.range(0));
+    geometry::PointCloud source, target;
+    std::tie(source, target) = LoadPair(pair);
+    auto estimation = CreateEstimation(type);
+    const Eigen::Matrix4d init_trans = GetPerturbedGroundTruth(pair);
+    source.Transform(init_trans);
+    CorrespondenceSet corres = SearchCorrespondences(
+            source, geometry::KDTreeFlann(target), Eigen::Matrix4d::Identity());
+    for (auto _ : state) {
+        Eigen::Matrix4d update =
+                estimation->ComputeTransformation(source, target, corres);
+        benchmark::DoNotOptimize(update);
+    }
+}
+
+BENCHMARK_CAPTURE(BenchmarkICPStageSolveLegacy,
+                  PointToPlane / CPU,
+                  TransformationEstimationType::PointToPlane)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkICPStageSolveLegacy,
+                  PointToPoint / CPU,
+                  TransformationEstimationType::PointToPoint)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+// Global registration from FPFH features, which are computed once outside of
+// the timed loop, and timed separately.
+static const double fpfh_radius = voxel_downsampling_factor * 5;
+static const double global_distance_threshold = voxel_downsampling_factor * 1.5;
+
+static void BenchmarkFPFHFeatureLegacy(benchmark::State& state) {
+    geometry::PointCloud source, target;
+    std::tie(source, target) = LoadPair(int(state.range(0)));
+    for (auto _ : state) {
+        auto feature = ComputeFPFHFeature(
+                source, geometry::KDTreeSearchParamHybrid(fpfh_radius, 100));
+        benchmark::DoNotOptimize(feature);
+    }
+}
+
+BENCHMARK(BenchmarkFPFHFeatureLegacy)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+static void BenchmarkGlobalRegistrationLegacy(benchmark::State& state,
+                                              bool use_fgr) {
+    const int pair = int(state.range(0));
+    geometry::PointCloud source, target;
+    std::tie(source, target) = LoadPair(pair);
+    const geometry::KDTreeSearchParamHybrid fpfh_param(fpfh_radius, 100);
+    auto source_feature = ComputeFPFHFeature(source, fpfh_param);
+    auto target_feature = ComputeFPFHFeature(target, fpfh_param);
+
+    CorrespondenceCheckerBasedOnEdgeLength check_edge_length(0.9);
+    CorrespondenceCheckerBasedOnDistance check_distance(
+            global_distance_threshold);
+    FastGlobalRegistrationOption fgr_option;
+    fgr_option.maximum_correspondence_distance_ = global_distance_threshold;
+
+    RegistrationResult reg_result;
+    for (auto _ : state) {
+        if (use_fgr) {
+            reg_result = FastGlobalRegistration(source, target, *source_feature,
+                                                *target_feature, fgr_option);
+        } else {
+            reg_result = RegistrationRANSACBasedOnFeatureMatching(
+                    source, target, *source_feature, *target_feature, true,
+                    global_distance_threshold,
+                    TransformationEstimationPointToPoint(false), 3,
+                    {check_edge_length, check_distance},
+                    RANSACConvergenceCriteria(100000, 0.999));
+        }
+    }
+    SetAccuracyCounters(state, reg_result, pair);
+}
+
+BENCHMARK_CAPTURE(BenchmarkGlobalRegistrationLegacy, RANSAC / CPU, false)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkGlobalRegistrationLegacy, FGR / CPU, true)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
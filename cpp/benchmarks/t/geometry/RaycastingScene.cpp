@@ -0,0 +1,202 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/RaycastingScene.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/io/TriangleMeshIO.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+static const std::string knot_path = std::string(TEST_DATA_DIR) + "/knot.ply";
+
+static void CreateScene(RaycastingScene& scene, const core::Device& device) {
+    auto legacy_mesh = open3d::io::CreateMeshFromFile(knot_path);
+    TriangleMesh mesh = TriangleMesh::FromLegacyTriangleMesh(
+            *legacy_mesh, core::Dtype::Float32, core::Dtype::UInt32, device);
+    scene.AddTriangles(mesh);
+}
+
+// Uniformly distributed query points in the bounding box of the knot, with a
+// margin of 10%.
+static core::Tensor CreateQueryPoints(int64_t num_points,
+                                      const core::Device& device) {
+    auto legacy_mesh = open3d::io::CreateMeshFromFile(knot_path);
+    Eigen::Vector3d min_bound = legacy_mesh->GetMinBound();
+    Eigen::Vector3d max_bound = legacy_mesh->GetMaxBound();
+    Eigen::Vector3d margin = 0.1 * (max_bound - min_bound);
+    min_bound -= margin;
+    max_bound += margin;
+
+    std::mt19937 rng(0);
+    std::vector<float> points(num_points * 3);
+    for (int64_t i = 0; i < num_points; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            std::uniform_real_distribution<float> dist(min_bound(k),
+                                                       max_bound(k));
+            points[3 * i + k] = dist(rng);
+        }
+    }
+    return core::Tensor(points, {num_points, 3}, core::Dtype::Float32, device);
+}
+
+// Rays of a 640 x 480 camera looking at the knot.
+static core::Tensor CreateRays(const core::Device& device) {
+    auto legacy_mesh = open3d::io::CreateMeshFromFile(knot_path);
+    Eigen::Vector3d center = legacy_mesh->GetCenter();
+    double extent = (legacy_mesh->GetMaxBound() - legacy_mesh->GetMinBound())
+                            .maxCoeff();
+    core::Tensor center_t(
+            std::vector<float>{float(center(0)), float(center(1)),
+                               float(center(2))},
+            {3}, core::Dtype::Float32);
+    core::Tensor eye_t(
+            std::vector<float>{float(center(0)), float(center(1)),
+                               float(center(2) + 2 * extent)},
+            {3}, core::Dtype::Float32);
+    core::Tensor up_t(std::vector<float>{0, 1, 0}, {3}, core::Dtype::Float32);
+    return RaycastingScene::CreateRaysPinhole(60, center_t, eye_t, up_t, 640,
+                                              480)
+            .To(device);
+}
+
+void CastRays(benchmark::State& state, const core::Device& device) {
+    RaycastingScene scene(device);
+    CreateScene(scene, device);
+    core::Tensor rays = CreateRays(device);
+
+    // Warm up, which also builds the acceleration structure.
+    auto result = scene.CastRays(rays);
+    (void)result;
+
+    for (auto _ : state) {
+        auto result = scene.CastRays(rays);
+    }
+}
+
+void CountIntersections(benchmark::State& state, const core::Device& device) {
+    RaycastingScene scene(device);
+    CreateScene(scene, device);
+    core::Tensor rays = CreateRays(device);
+
+    // Warm up.
+    core::Tensor result = scene.CountIntersections(rays);
+    (void)result;
+
+    for (auto _ : state) {
+        core::Tensor result = scene.CountIntersections(rays);
+    }
+}
+
+void ComputeDistance(benchmark::State& state, const core::Device& device) {
+    RaycastingScene scene(device);
+    CreateScene(scene, device);
+    core::Tensor query_points = CreateQueryPoints(state.range(0), device);
+
+    // Warm up.
+    core::Tensor result = scene.ComputeDistance(query_points);
+    (void)result;
+
+    for (auto _ : state) {
+        core::Tensor result = scene.ComputeDistance(query_points);
+    }
+}
+
+void ComputeSignedDistance(benchmark::State& state,
+                           const core::Device& device) {
+    RaycastingScene scene(device);
+    CreateScene(scene, device);
+    core::Tensor query_points = CreateQueryPoints(state.range(0), device);
+
+    // Warm up.
+    core::Tensor result = scene.ComputeSignedDistance(query_points);
+    (void)result;
+
+    for (auto _ : state) {
+        core::Tensor result = scene.ComputeSignedDistance(query_points);
+    }
+}
+
+void ComputeOccupancy(benchmark::State& state, const core::Device& device) {
+    RaycastingScene scene(device);
+    CreateScene(scene, device);
+    core::Tensor query_points = CreateQueryPoints(state.range(0), device);
+
+    // Warm up.
+    core::Tensor result = scene.ComputeOccupancy(query_points);
+    (void)result;
+
+    for (auto _ : state) {
+        core::Tensor result = scene.ComputeOccupancy(query_points);
+    }
+}
+
+BENCHMARK_CAPTURE(CastRays, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CountIntersections, CPU, core::Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ComputeDistance, CPU, core::Device("CPU:0"))
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ComputeSignedDistance, CPU, core::Device("CPU:0"))
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ComputeOccupancy, CPU, core::Device("CPU:0"))
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(CastRays, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CountIntersections, CUDA, core::Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ComputeDistance, CUDA, core::Device("CUDA:0"))
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ComputeSignedDistance, CUDA, core::Device("CUDA:0"))
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ComputeOccupancy, CUDA, core::Device("CUDA:0"))
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,201 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/io/ImageIO.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+static const float kSDFTruncMultiplier = 5.0f;
+static const int kBlockResolution = 16;
+static const int kBlockCount = 40000;
+
+// The RGBD sequence of the test data, on the device.
+struct RGBDSequence {
+    std::vector<Image> depths;
+    std::vector<Image> colors;
+    std::vector<core::Tensor> extrinsics;
+    core::Tensor intrinsics;
+};
+
+static RGBDSequence LoadRGBDSequence(const core::Device& device) {
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+
+    RGBDSequence sequence;
+    sequence.intrinsics = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    auto trajectory = open3d::io::CreatePinholeCameraTrajectoryFromFile(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log");
+    for (size_t i = 0; i < trajectory->parameters_.size(); ++i) {
+        sequence.depths.push_back(
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/depth/{:05d}.png",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device));
+        sequence.colors.push_back(
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device));
+        sequence.extrinsics.push_back(
+                core::eigen_converter::EigenMatrixToTensor(
+                        trajectory->parameters_[i].extrinsic_));
+    }
+    return sequence;
+}
+
+static TSDFVoxelGrid CreateVoxelGrid(const core::Device& device,
+                                     float voxel_size) {
+    return TSDFVoxelGrid({{"tsdf", core::Dtype::Float32},
+                          {"weight", core::Dtype::UInt16},
+                          {"color", core::Dtype::UInt16}},
+                         voxel_size, kSDFTruncMultiplier * voxel_size,
+                         kBlockResolution, kBlockCount, device);
+}
+
+static TSDFVoxelGrid CreateIntegratedVoxelGrid(const RGBDSequence& sequence,
+                                               const core::Device& device,
+                                               float voxel_size) {
+    TSDFVoxelGrid voxel_grid = CreateVoxelGrid(device, voxel_size);
+    for (size_t i = 0; i < sequence.depths.size(); ++i) {
+        voxel_grid.Integrate(sequence.depths[i], sequence.colors[i],
+                             sequence.intrinsics, sequence.extrinsics[i]);
+    }
+    return voxel_grid;
+}
+
+// Integrates one frame per iteration, cycling through the sequence.
+void Integrate(benchmark::State& state,
+               const core::Device& device,
+               float voxel_size) {
+    RGBDSequence sequence = LoadRGBDSequence(device);
+    size_t n = sequence.depths.size();
+
+    // Warm up.
+    TSDFVoxelGrid voxel_grid =
+            CreateIntegratedVoxelGrid(sequence, device, voxel_size);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        voxel_grid.Integrate(sequence.depths[i], sequence.colors[i],
+                             sequence.intrinsics, sequence.extrinsics[i]);
+        i = (i + 1) % n;
+    }
+}
+
+void RayCast(benchmark::State& state,
+             const core::Device& device,
+             float voxel_size) {
+    RGBDSequence sequence = LoadRGBDSequence(device);
+    TSDFVoxelGrid voxel_grid =
+            CreateIntegratedVoxelGrid(sequence, device, voxel_size);
+    int width = sequence.depths[0].GetCols();
+    int height = sequence.depths[0].GetRows();
+
+    // Warm up.
+    std::unordered_map<TSDFVoxelGrid::SurfaceMaskCode, core::Tensor> results;
+    voxel_grid.RayCast(results, sequence.intrinsics, sequence.extrinsics[0],
+                       width, height);
+
+    for (auto _ : state) {
+        voxel_grid.RayCast(results, sequence.intrinsics,
+                           sequence.extrinsics[0], width, height);
+    }
+}
+
+void ExtractSurfacePoints(benchmark::State& state,
+                          const core::Device& device,
+                          float voxel_size) {
+    RGBDSequence sequence = LoadRGBDSequence(device);
+    TSDFVoxelGrid voxel_grid =
+            CreateIntegratedVoxelGrid(sequence, device, voxel_size);
+
+    // Warm up.
+    PointCloud pcd = voxel_grid.ExtractSurfacePoints();
+    (void)pcd;
+
+    for (auto _ : state) {
+        PointCloud pcd = voxel_grid.ExtractSurfacePoints();
+    }
+}
+
+void ExtractSurfaceMesh(benchmark::State& state,
+                        const core::Device& device,
+                        float voxel_size) {
+    RGBDSequence sequence = LoadRGBDSequence(device);
+    TSDFVoxelGrid voxel_grid =
+            CreateIntegratedVoxelGrid(sequence, device, voxel_size);
+
+    // Warm up.
+    TriangleMesh mesh = voxel_grid.ExtractSurfaceMesh();
+    (void)mesh;
+
+    for (auto _ : state) {
+        TriangleMesh mesh = voxel_grid.ExtractSurfaceMesh();
+    }
+}
+
+#define ENUM_TSDF_VOXELSIZE(FUNC, DEVICE_NAME, DEVICE)           \
+    BENCHMARK_CAPTURE(FUNC, DEVICE_NAME##_0_004, DEVICE, 0.004f) \
+            ->Unit(benchmark::kMillisecond);                     \
+    BENCHMARK_CAPTURE(FUNC, DEVICE_NAME##_0_008, DEVICE, 0.008f) \
+            ->Unit(benchmark::kMillisecond);                     \
+    BENCHMARK_CAPTURE(FUNC, DEVICE_NAME##_0_016, DEVICE, 0.016f) \
+            ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+#define ENUM_TSDF_DEVICE(FUNC)                            \
+    ENUM_TSDF_VOXELSIZE(FUNC, CPU, core::Device("CPU:0")) \
+    ENUM_TSDF_VOXELSIZE(FUNC, CUDA, core::Device("CUDA:0"))
+#else
+#define ENUM_TSDF_DEVICE(FUNC) \
+    ENUM_TSDF_VOXELSIZE(FUNC, CPU, core::Device("CPU:0"))
+#endif
+
+ENUM_TSDF_DEVICE(Integrate)
+ENUM_TSDF_DEVICE(RayCast)
+ENUM_TSDF_DEVICE(ExtractSurfacePoints)
+ENUM_TSDF_DEVICE(ExtractSurfaceMesh)
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
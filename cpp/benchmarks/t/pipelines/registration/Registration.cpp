@@ -28,6 +28,7 @@
 
 #include <benchmark/benchmark.h>
 
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
@@ -49,6 +50,13 @@ static const int max_iterations = 1;
 // NNS parameter.
 static const double max_correspondence_distance = 0.15;
 
+// Iterations of the ICP runs to convergence over the registration pairs.
+static const int max_iterations_converged = 30;
+
+// Pairs (source, target) of ICP/cloud_bin_{}.pcd with decreasing overlap.
+static const std::vector<std::pair<int, int>> registration_pairs{
+        {1, 0}, {2, 1}, {2, 0}};
+
 // Initial transformation guess for registation.
 static const std::vector<float> initial_transform_flat{
         0.862, 0.011, -0.507, 0.5,  -0.139, 0.967, -0.215, 0.7,
@@ -176,6 +184,231 @@ BENCHMARK_CAPTURE(BenchmarkRegistrationICP,
         ->Unit(benchmark::kMillisecond);
 #endif
 
+// Ground truth transformation of registration_pairs[pair], from the
+// transformations of ICP/init.log mapping cloud_bin_{j} to cloud_bin_{i}.
+static Eigen::Matrix4d GetGroundTruth(int pair) {
+    Eigen::Matrix4d T_01, T_12;
+    T_01 << 0.86214000, -0.13881100, 0.48729000, 0.32977900, 0.01137220,
+            0.96680300, 0.25528600, -0.39660460, -0.50654700, -0.21455100,
+            0.83509300, 1.62919450, 0.0, 0.0, 0.0, 1.0;
+    T_12 << 0.96329600, 0.08271910, -0.25539000, 0.22034280, -0.07796960,
+            0.99654800, 0.02868420, -0.02455154, 0.25688000, -0.00771860,
+            0.96641300, -0.30904690, 0.0, 0.0, 0.0, 1.0;
+    switch (pair) {
+        case 0:
+            return T_01;
+        case 1:
+            return T_12;
+        default:
+            return T_01 * T_12;
+    }
+}
+
+// Initial transformation of the ICP runs: the ground truth, perturbed by a
+// rotation of 0.05 rad and a translation of 5 cm.
+static core::Tensor GetPerturbedGroundTruth(int pair) {
+    Eigen::Matrix4d perturbation = Eigen::Matrix4d::Identity();
+    perturbation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.05, Eigen::Vector3d(1, 1, 1).normalized())
+                    .toRotationMatrix();
+    perturbation.block<3, 1>(0, 3) = Eigen::Vector3d(0.05, 0, 0);
+    Eigen::Matrix4d init_trans = perturbation * GetGroundTruth(pair);
+    return core::eigen_converter::EigenMatrixToTensor(init_trans);
+}
+
+static std::tuple<geometry::PointCloud, geometry::PointCloud> LoadPair(
+        int pair, const core::Device& device) {
+    return LoadTensorPointCloudFromFile(
+            fmt::format("{}/ICP/cloud_bin_{}.pcd", TEST_DATA_DIR,
+                        registration_pairs[pair].first),
+            fmt::format("{}/ICP/cloud_bin_{}.pcd", TEST_DATA_DIR,
+                        registration_pairs[pair].second),
+            voxel_downsampling_factor, core::Dtype::Float32, device);
+}
+
+// Reports the accuracy of a registration of pair as benchmark counters.
+static void SetAccuracyCounters(benchmark::State& state,
+                                const RegistrationResult& reg_result,
+                                int pair) {
+    Eigen::Matrix4d transformation =
+            core::eigen_converter::TensorToEigenMatrixXd(
+                    reg_result.transformation_.To(core::Dtype::Float64));
+    Eigen::Matrix4d error = GetGroundTruth(pair).inverse() * transformation;
+    double cos_angle = (error.block<3, 3>(0, 0).trace() - 1.0) / 2.0;
+    state.counters["Fitness"] = reg_result.fitness_;
+    state.counters["InlierRMSE"] = reg_result.inlier_rmse_;
+    state.counters["RotationErrorDeg"] =
+            std::acos(std::max(-1.0, std::min(1.0, cos_angle))) * 180.0 /
+            M_PI;
+    state.counters["TranslationError"] = error.block<3, 1>(0, 3).norm();
+}
+
+static std::shared_ptr<TransformationEstimation> CreateEstimation(
+        const TransformationEstimationType& type) {
+    if (type == TransformationEstimationType::PointToPlane) {
+        return std::make_shared<TransformationEstimationPointToPlane>();
+    }
+    return std::make_shared<TransformationEstimationPointToPoint>();
+}
+
+// ICP to convergence over registration_pairs, reporting its accuracy.
+static void BenchmarkRegistrationICPPairs(
+        benchmark::State& state,
+        const core::Device& device,
+        const TransformationEstimationType& type) {
+    const int pair = int(state.range(0));
+    geometry::PointCloud source(device), target(device);
+    std::tie(source, target) = LoadPair(pair, device);
+    auto estimation = CreateEstimation(type);
+    core::Tensor init_trans = GetPerturbedGroundTruth(pair);
+    const ICPConvergenceCriteria criteria(relative_fitness, relative_rmse,
+                                          max_iterations_converged);
+
+    RegistrationResult reg_result(init_trans);
+    // Warm up.
+    reg_result = RegistrationICP(source, target, max_correspondence_distance,
+                                 init_trans, *estimation, criteria);
+    for (auto _ : state) {
+        reg_result = RegistrationICP(source, target,
+                                     max_correspondence_distance, init_trans,
+                                     *estimation, criteria);
+    }
+    SetAccuracyCounters(state, reg_result, pair);
+}
+
+BENCHMARK_CAPTURE(BenchmarkRegistrationICPPairs,
+                  PointToPlane / CPU,
+                  core::Device("CPU:0"),
+                  TransformationEstimationType::PointToPlane)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(BenchmarkRegistrationICPPairs,
+                  PointToPlane / CUDA,
+                  core::Device("CUDA:0"),
+                  TransformationEstimationType::PointToPlane)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+BENCHMARK_CAPTURE(BenchmarkRegistrationICPPairs,
+                  PointToPoint / CPU,
+                  core::Device("CPU:0"),
+                  TransformationEstimationType::PointToPoint)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(BenchmarkRegistrationICPPairs,
+                  PointToPoint / CUDA,
+                  core::Device("CUDA:0"),
+                  TransformationEstimationType::PointToPoint)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+// Stages of an ICP iteration: building the target index, the nearest
+// neighbor search and the reduction and solve of the transformation.
+static void BenchmarkICPStageIndex(benchmark::State& state,
+                                   const core::Device& device) {
+    geometry::PointCloud source(device), target(device);
+    std::tie(source, target) = LoadPair(int(state.range(0)), device);
+    for (auto _ : state) {
+        core::nns::NearestNeighborSearch nns(target.GetPoints());
+        nns.HybridIndex(max_correspondence_distance);
+    }
+}
+
+static void BenchmarkICPStageNNSearch(benchmark::State& state,
+                                      const core::Device& device) {
+    const int pair = int(state.range(0));
+    geometry::PointCloud source(device), target(device);
+    std::tie(source, target) = LoadPair(pair, device);
+    source.Transform(GetPerturbedGroundTruth(pair).To(device,
+                                                      core::Dtype::Float32));
+    core::nns::NearestNeighborSearch nns(target.GetPoints());
+    nns.HybridIndex(max_correspondence_distance);
+    // Warm up.
+    nns.HybridSearch(source.GetPoints(), max_correspondence_distance, 1);
+    for (auto _ : state) {
+        auto result = nns.HybridSearch(source.GetPoints(),
+                                       max_correspondence_distance, 1);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+static void BenchmarkICPStageSolve(benchmark::State& state,
+                                   const core::Device& device,
+                                   const TransformationEstimationType& type) {
+    const int pair = int(state.range(0));
+    geometry::PointCloud source(device), target(device);
+    std::tie(source, target) = LoadPair(pair, device);
+    auto estimation = CreateEstimation(type);
+    source.Transform(GetPerturbedGroundTruth(pair).To(device,
+                                                      core::Dtype::Float32));
+    core::nns::NearestNeighborSearch nns(target.GetPoints());
+    nns.HybridIndex(max_correspondence_distance);
+    core::Tensor target_indices;
+    std::tie(target_indices, std::ignore, std::ignore) = nns.HybridSearch(
+            source.GetPoints(), max_correspondence_distance, 1);
+    target_indices = target_indices.View({-1});
+    // Warm up.
+    estimation->ComputeTransformationFromIndices(source, target,
+                                                 target_indices);
+    for (auto _ : state) {
+        core::Tensor update = estimation->ComputeTransformationFromIndices(
+                source, target, target_indices);
+        benchmark::DoNotOptimize(update);
+    }
+}
+
+BENCHMARK_CAPTURE(BenchmarkICPStageIndex, CPU, core::Device("CPU:0"))
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkICPStageNNSearch, CPU, core::Device("CPU:0"))
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkICPStageSolve,
+                  PointToPlane / CPU,
+                  core::Device("CPU:0"),
+                  TransformationEstimationType::PointToPlane)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkICPStageSolve,
+                  PointToPoint / CPU,
+                  core::Device("CPU:0"),
+                  TransformationEstimationType::PointToPoint)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(BenchmarkICPStageIndex, CUDA, core::Device("CUDA:0"))
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkICPStageNNSearch, CUDA, core::Device("CUDA:0"))
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkICPStageSolve,
+                  PointToPlane / CUDA,
+                  core::Device("CUDA:0"),
+                  TransformationEstimationType::PointToPlane)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BenchmarkICPStageSolve,
+                  PointToPoint / CUDA,
+                  core::Device("CUDA:0"),
+                  TransformationEstimationType::PointToPoint)
+        ->DenseRange(0, 2)
+        ->Unit(benchmark::kMillisecond);
+#endif
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
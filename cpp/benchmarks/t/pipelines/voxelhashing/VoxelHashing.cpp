@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/t/pipelines/voxelhashing/Frame.h"
+#include "open3d/t/pipelines/voxelhashing/Model.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace voxelhashing {
+
+// Tracks, integrates and ray casts one frame of the RGBD test sequence per
+// iteration, cycling through the sequence.
+static void VoxelHashingPerFrame(benchmark::State& state,
+                                 const core::Device& device,
+                                 float voxel_size) {
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        return;
+    }
+
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const float depth_diff = 0.07;
+    const int num_frames = 5;
+
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    std::vector<Frame> input_frames;
+    for (int i = 0; i < num_frames; ++i) {
+        t::geometry::Image depth = *t::io::CreateImageFromFile(fmt::format(
+                "{}/RGBD/depth/{:05d}.png", std::string(TEST_DATA_DIR), i));
+        t::geometry::Image color = *t::io::CreateImageFromFile(fmt::format(
+                "{}/RGBD/color/{:05d}.jpg", std::string(TEST_DATA_DIR), i));
+        Frame frame(depth.GetRows(), depth.GetCols(), intrinsic_t, device);
+        frame.SetDataFromImage("depth", depth);
+        frame.SetDataFromImage("color", color);
+        input_frames.push_back(frame);
+    }
+
+    core::Tensor T_frame_to_model =
+            core::Tensor::Eye(4, core::Dtype::Float64, core::Device("CPU:0"));
+    Model model(voxel_size, 5 * voxel_size, 16, 40000, T_frame_to_model,
+                device);
+    Frame raycast_frame(input_frames[0].GetHeight(),
+                        input_frames[0].GetWidth(), intrinsic_t, device);
+
+    int frame_id = 0;
+    auto process_frame = [&]() {
+        const Frame& input_frame = input_frames[frame_id % num_frames];
+        if (frame_id > 0) {
+            auto result =
+                    model.TrackFrameToModel(input_frame, raycast_frame,
+                                            depth_scale, depth_max, depth_diff);
+            T_frame_to_model = T_frame_to_model.Matmul(result.transformation_);
+        }
+        model.UpdateFramePose(frame_id, T_frame_to_model);
+        model.Integrate(input_frame, depth_scale, depth_max);
+        model.SynthesizeModelFrame(raycast_frame, depth_scale, 0.1, depth_max);
+        ++frame_id;
+    };
+
+    // Warm up.
+    for (int i = 0; i < num_frames; ++i) {
+        process_frame();
+    }
+
+    for (auto _ : state) {
+        process_frame();
+    }
+}
+
+#define ENUM_VOXELHASHING_VOXELSIZE(DEVICE_NAME, DEVICE)                 \
+    BENCHMARK_CAPTURE(VoxelHashingPerFrame, DEVICE_NAME##_0_006, DEVICE, \
+                      0.006f)                                            \
+            ->Unit(benchmark::kMillisecond);                             \
+    BENCHMARK_CAPTURE(VoxelHashingPerFrame, DEVICE_NAME##_0_012, DEVICE, \
+                      0.012f)                                            \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_VOXELHASHING_VOXELSIZE(CPU, core::Device("CPU:0"))
+#ifdef BUILD_CUDA_MODULE
+ENUM_VOXELHASHING_VOXELSIZE(CUDA, core::Device("CUDA:0"))
+#endif
+
+}  // namespace voxelhashing
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
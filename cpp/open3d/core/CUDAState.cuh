@@ -33,11 +33,13 @@
 #include <cuda.h>
 #include <cuda_runtime_api.h>
 
+#include <functional>
 #include <memory>
 #include <vector>
 
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Device.h"
+#include "open3d/core/MemoryManager.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -108,6 +110,360 @@ private:
     int prev_device_id_;
 };
 
+/// \class CUDAStream
+///
+/// An owning wrapper of a CUDA stream created on a given CUDA device.
+///
+/// Kernels launched by Open3D's CUDA launchers and copies issued by
+/// MemoryManager::Memcpy are enqueued to the "current" stream of the calling
+/// thread, which is the legacy default stream unless changed with
+/// CUDAScopedStream. Work enqueued to different streams may run concurrently,
+/// e.g. uploading the next frame while the current frame is processed.
+///
+/// Streams are created as blocking streams, i.e. they still synchronize with
+/// work submitted to the legacy default stream, so code that is not
+/// stream-aware remains correct when mixed with stream-aware code.
+///
+/// \note Memory freed while a non-default stream is current is synchronized
+/// with that stream before it is returned to the cache. Tensors used on a
+/// stream should therefore be released in its scope, or after synchronizing
+/// the stream.
+///
+/// Example:
+/// ```cpp
+/// core::CUDAStream upload_stream(core::Device("CUDA:0"));
+/// core::CUDAEvent uploaded;
+/// {
+///     core::CUDAScopedStream scoped_stream(upload_stream);
+///     depth_cuda = depth_cpu.To(core::Device("CUDA:0"));
+///     uploaded.Record();
+/// }
+/// // Ops on the default stream wait for the upload without blocking the host.
+/// uploaded.Wait();
+/// ```
+class CUDAStream {
+public:
+    /// Creates a new stream on \p device. A \p non_blocking stream does not
+    /// synchronize with the legacy default stream.
+    explicit CUDAStream(const Device& device, bool non_blocking = false)
+        : device_(device) {
+        if (device.GetType() != Device::DeviceType::CUDA) {
+            utility::LogError("CUDAStream: {} is not a CUDA device.",
+                              device.ToString());
+        }
+        CUDADeviceSwitcher switcher(device);
+        OPEN3D_CUDA_CHECK(cudaStreamCreateWithFlags(
+                &stream_,
+                non_blocking ? cudaStreamNonBlocking : cudaStreamDefault));
+    }
+
+    ~CUDAStream() {
+        CUDADeviceSwitcher switcher(device_);
+        cudaStreamDestroy(stream_);
+    }
+
+    CUDAStream(CUDAStream const&) = delete;
+
+    void operator=(CUDAStream const&) = delete;
+
+    /// Returns the underlying CUDA stream handle.
+    cudaStream_t Get() const { return stream_; }
+
+    Device GetDevice() const { return device_; }
+
+    /// Blocks the calling host thread until all work in the stream completes.
+    void Synchronize() const {
+        OPEN3D_CUDA_CHECK(cudaStreamSynchronize(stream_));
+    }
+
+    /// Returns true if all work in the stream has completed.
+    bool Query() const {
+        cudaError_t err = cudaStreamQuery(stream_);
+        if (err == cudaErrorNotReady) {
+            cudaGetLastError();
+            return false;
+        }
+        OPEN3D_CUDA_CHECK(err);
+        return true;
+    }
+
+    /// Returns the current stream of the calling thread if it belongs to the
+    /// current CUDA device, and the legacy default stream otherwise.
+    static cudaStream_t GetCurrent() {
+        const CurrentStream& current = GetCurrentStorage();
+        if (current.stream_ == 0) {
+            return 0;
+        }
+        int device_id;
+        OPEN3D_CUDA_CHECK(cudaGetDevice(&device_id));
+        return device_id == current.device_id_ ? current.stream_ : 0;
+    }
+
+    /// Returns true if the current stream of the calling thread is the legacy
+    /// default stream.
+    static bool IsCurrentDefault() { return GetCurrent() == 0; }
+
+private:
+    friend class CUDAScopedStream;
+
+    struct CurrentStream {
+        cudaStream_t stream_ = 0;
+        int device_id_ = -1;
+    };
+
+    static CurrentStream& GetCurrentStorage() {
+        static thread_local CurrentStream current;
+        return current;
+    }
+
+    Device device_;
+    cudaStream_t stream_ = 0;
+};
+
+/// \class CUDAScopedStream
+///
+/// Sets the current stream of the calling thread (and switches to the
+/// stream's device) in the current scope. The previous stream and device are
+/// restored once leaving the scope.
+class CUDAScopedStream {
+public:
+    explicit CUDAScopedStream(const CUDAStream& stream)
+        : switcher_(stream.GetDevice()),
+          prev_(CUDAStream::GetCurrentStorage()) {
+        CUDAStream::CurrentStream& current = CUDAStream::GetCurrentStorage();
+        current.stream_ = stream.Get();
+        current.device_id_ = stream.GetDevice().GetID();
+    }
+
+    ~CUDAScopedStream() { CUDAStream::GetCurrentStorage() = prev_; }
+
+    CUDAScopedStream(CUDAScopedStream const&) = delete;
+
+    void operator=(CUDAScopedStream const&) = delete;
+
+private:
+    CUDADeviceSwitcher switcher_;
+    CUDAStream::CurrentStream prev_;
+};
+
+/// \class CUDAEvent
+///
+/// A CUDA event used to express dependencies between streams. Record() marks
+/// a point in a stream, and Wait() makes another stream wait for that point
+/// without blocking the host.
+class CUDAEvent {
+public:
+    CUDAEvent() {
+        OPEN3D_CUDA_CHECK(
+                cudaEventCreateWithFlags(&event_, cudaEventDisableTiming));
+    }
+
+    ~CUDAEvent() { cudaEventDestroy(event_); }
+
+    CUDAEvent(CUDAEvent const&) = delete;
+
+    void operator=(CUDAEvent const&) = delete;
+
+    /// Records the event in \p stream. By default, the current stream is used.
+    void Record(cudaStream_t stream) {
+        OPEN3D_CUDA_CHECK(cudaEventRecord(event_, stream));
+    }
+
+    void Record() { Record(CUDAStream::GetCurrent()); }
+
+    void Record(const CUDAStream& stream) { Record(stream.Get()); }
+
+    /// Makes all future work in \p stream wait for the recorded event. By
+    /// default, the current stream is used.
+    void Wait(cudaStream_t stream) const {
+        OPEN3D_CUDA_CHECK(cudaStreamWaitEvent(stream, event_, 0));
+    }
+
+    void Wait() const { Wait(CUDAStream::GetCurrent()); }
+
+    void Wait(const CUDAStream& stream) const { Wait(stream.Get()); }
+
+    /// Blocks the calling host thread until the recorded event completes.
+    void Synchronize() const {
+        OPEN3D_CUDA_CHECK(cudaEventSynchronize(event_));
+    }
+
+    /// Returns true if the recorded event has completed.
+    bool Query() const {
+        cudaError_t err = cudaEventQuery(event_);
+        if (err == cudaErrorNotReady) {
+            cudaGetLastError();
+            return false;
+        }
+        OPEN3D_CUDA_CHECK(err);
+        return true;
+    }
+
+    /// Returns the underlying CUDA event handle.
+    cudaEvent_t Get() const { return event_; }
+
+private:
+    cudaEvent_t event_;
+};
+
+/// \class CUDAGraph
+///
+/// Captures the work that a function enqueues to the current stream into a
+/// CUDA graph and launches it as a whole, which removes most of the launch
+/// overhead of pipelines made of many small kernels.
+///
+/// The function is captured on every Run(), but the executable graph is kept:
+/// as long as the captured work has the same topology, only its kernel
+/// arguments and launch dimensions are updated (cudaGraphExecUpdate), which is
+/// much cheaper than instantiating the graph again. The function must not
+/// synchronize with the host, e.g. read tensor values to the host, copy from
+/// pageable host memory or synchronize the device; use IsCapturing() to skip
+/// such calls. Memory freed while capturing is released once the graph has
+/// completed.
+///
+/// Example:
+/// ```cpp
+/// core::CUDAGraph graph(core::Device("CUDA:0"));
+/// for (const auto& frame : frames) {
+///     graph.Run([&]() { LaunchFixedShapeKernels(frame); });
+/// }
+/// ```
+class CUDAGraph {
+public:
+    explicit CUDAGraph(const Device& device)
+        : stream_(device, /*non_blocking=*/true) {}
+
+    ~CUDAGraph() {
+        if (scoped_stream_ != nullptr) {
+            AbortCapture();
+        }
+        if (graph_exec_ != nullptr) {
+            cudaGraphExecDestroy(graph_exec_);
+        }
+    }
+
+    CUDAGraph(CUDAGraph const&) = delete;
+
+    void operator=(CUDAGraph const&) = delete;
+
+    /// Captures the work \p func enqueues and runs it after the work enqueued
+    /// to the current stream so far. Returns once the work has completed.
+    void Run(const std::function<void()>& func) {
+        BeginCapture();
+        try {
+            func();
+        } catch (...) {
+            AbortCapture();
+            throw;
+        }
+        EndCaptureAndLaunch();
+    }
+
+    /// Starts capturing the work enqueued to the current stream, which is the
+    /// graph's stream until EndCaptureAndLaunch(). Prefer Run(), which also
+    /// ends the capture if an exception is thrown. A capture left open this
+    /// way is aborted by the next BeginCapture().
+    void BeginCapture() {
+        if (scoped_stream_ != nullptr) {
+            AbortCapture();
+        }
+        CUDAEvent ready;
+        ready.Record();
+        scoped_stream_.reset(new CUDAScopedStream(stream_));
+        ready.Wait(stream_);
+
+        MemoryManager::BeginDeferredFree();
+        // Relaxed, since cached memory managers may cudaMalloc new blocks.
+        OPEN3D_CUDA_CHECK(cudaStreamBeginCapture(stream_.Get(),
+                                                 cudaStreamCaptureModeRelaxed));
+        GetCapturingStorage() = true;
+    }
+
+    /// Ends the capture started by BeginCapture(), launches the graph and
+    /// returns once it has completed.
+    void EndCaptureAndLaunch() {
+        if (scoped_stream_ == nullptr) {
+            utility::LogError("CUDAGraph: no capture to end.");
+        }
+        GetCapturingStorage() = false;
+        cudaGraph_t graph = nullptr;
+        OPEN3D_CUDA_CHECK(cudaStreamEndCapture(stream_.Get(), &graph));
+
+        if (graph_exec_ != nullptr && !Update(graph)) {
+            cudaGraphExecDestroy(graph_exec_);
+            graph_exec_ = nullptr;
+        }
+        if (graph_exec_ == nullptr) {
+#if CUDART_VERSION >= 12000
+            OPEN3D_CUDA_CHECK(cudaGraphInstantiate(&graph_exec_, graph, 0));
+#else
+            OPEN3D_CUDA_CHECK(cudaGraphInstantiate(&graph_exec_, graph,
+                                                   nullptr, nullptr, 0));
+#endif
+            ++instantiation_count_;
+        }
+        OPEN3D_CUDA_CHECK(cudaGraphDestroy(graph));
+
+        OPEN3D_CUDA_CHECK(cudaGraphLaunch(graph_exec_, stream_.Get()));
+        stream_.Synchronize();
+        scoped_stream_.reset();
+        MemoryManager::EndDeferredFree();
+    }
+
+    /// Returns the number of times the graph has been instantiated, i.e. the
+    /// captured topology changed.
+    int64_t GetInstantiationCount() const { return instantiation_count_; }
+
+    /// Returns true if the calling thread is capturing a graph.
+    static bool IsCapturing() { return GetCapturingStorage(); }
+
+private:
+    /// Applies the parameters of \p graph to the executable graph. Returns
+    /// false if the topologies differ.
+    bool Update(cudaGraph_t graph) {
+#if CUDART_VERSION >= 12000
+        cudaGraphExecUpdateResultInfo result_info;
+        cudaError_t err = cudaGraphExecUpdate(graph_exec_, graph, &result_info);
+#else
+        cudaGraphNode_t error_node;
+        cudaGraphExecUpdateResult result;
+        cudaError_t err =
+                cudaGraphExecUpdate(graph_exec_, graph, &error_node, &result);
+#endif
+        if (err != cudaSuccess) {
+            // Clear the error, the graph is instantiated again.
+            cudaGetLastError();
+            return false;
+        }
+        return true;
+    }
+
+    /// Discards the open capture.
+    void AbortCapture() {
+        GetCapturingStorage() = false;
+        cudaGraph_t graph = nullptr;
+        cudaStreamEndCapture(stream_.Get(), &graph);
+        if (graph != nullptr) {
+            cudaGraphDestroy(graph);
+        }
+        // Clear the error of the invalidated capture.
+        cudaStreamSynchronize(stream_.Get());
+        cudaGetLastError();
+        scoped_stream_.reset();
+        MemoryManager::EndDeferredFree();
+    }
+
+    static bool& GetCapturingStorage() {
+        static thread_local bool capturing = false;
+        return capturing;
+    }
+
+    CUDAStream stream_;
+    std::unique_ptr<CUDAScopedStream> scoped_stream_;
+    cudaGraphExec_t graph_exec_ = nullptr;
+    int64_t instantiation_count_ = 0;
+};
+
 /// CUDAState is a lazy-evaluated singleton class that initializes and stores
 /// the states of CUDA devices.
 ///
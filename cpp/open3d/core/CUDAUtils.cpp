@@ -55,12 +55,13 @@ bool IsAvailable() { return cuda::DeviceCount() > 0; }
 
 void ReleaseCache() {
 #ifdef BUILD_CUDA_MODULE
+    CUDAPinnedMemoryManager::ReleaseCache();
 #ifdef BUILD_CACHED_CUDA_MANAGER
     CUDACachedMemoryManager::ReleaseCache();
 #else
     utility::LogWarning(
             "Built without cached CUDA memory manager, cuda::ReleaseCache() "
-            "has no effect.");
+            "only releases pinned host memory.");
 #endif
 
 #else
@@ -68,6 +69,71 @@ void ReleaseCache() {
 #endif
 }
 
+void SetMemoryLimit(const Device& device, size_t byte_size) {
+#if defined(BUILD_CUDA_MODULE) && defined(BUILD_CACHED_CUDA_MANAGER)
+    CUDACachedMemoryManager::SetMemoryLimit(device, byte_size);
+#else
+    utility::LogWarning(
+            "Built without cached CUDA memory manager, "
+            "cuda::SetMemoryLimit() has no effect.");
+#endif
+}
+
+size_t GetMemoryLimit(const Device& device) {
+#if defined(BUILD_CUDA_MODULE) && defined(BUILD_CACHED_CUDA_MANAGER)
+    return CUDACachedMemoryManager::GetMemoryLimit(device);
+#else
+    return 0;
+#endif
+}
+
+#ifdef BUILD_CUDA_MODULE
+/// Converts a DLPack stream handle to a CUDA stream.
+static cudaStream_t StreamFromHandle(intptr_t stream) {
+    if (stream == 1) {
+        return cudaStreamLegacy;
+    } else if (stream == 2) {
+        return cudaStreamPerThread;
+    } else if (stream > 2) {
+        return reinterpret_cast<cudaStream_t>(stream);
+    } else {
+        utility::LogError("Invalid DLPack stream handle {}.", stream);
+    }
+}
+#endif
+
+intptr_t GetCurrentStreamHandle(const Device& device) {
+#ifdef BUILD_CUDA_MODULE
+    if (device.GetType() != Device::DeviceType::CUDA) {
+        utility::LogError("{} is not a CUDA device.", device.ToString());
+    }
+    CUDADeviceSwitcher switcher(device);
+    cudaStream_t current_stream = CUDAStream::GetCurrent();
+    return current_stream == 0 ? 1 : reinterpret_cast<intptr_t>(current_stream);
+#else
+    utility::LogError("Built without CUDA module, cannot get CUDA stream.");
+#endif
+}
+
+void WaitForCurrentStream(const Device& device, intptr_t stream) {
+    if (device.GetType() != Device::DeviceType::CUDA || stream == -1) {
+        return;
+    }
+#ifdef BUILD_CUDA_MODULE
+    if (stream == GetCurrentStreamHandle(device)) {
+        return;
+    }
+    CUDADeviceSwitcher switcher(device);
+    // Destroying the event right away is fine, the pending wait keeps it alive
+    // on the CUDA side.
+    CUDAEvent event;
+    event.Record();
+    event.Wait(StreamFromHandle(stream));
+#else
+    utility::LogError("Built without CUDA module, cannot synchronize streams.");
+#endif
+}
+
 }  // namespace cuda
 }  // namespace core
 }  // namespace open3d
@@ -32,6 +32,9 @@
 
 #pragma once
 
+#include <cstdint>
+
+#include "open3d/core/Device.h"
 #include "open3d/utility/Logging.h"
 
 #ifdef BUILD_CUDA_MODULE
@@ -118,6 +121,27 @@ int DeviceCount();
 bool IsAvailable();
 void ReleaseCache();
 
+/// Limits the memory that the cached CUDA memory manager reserves on
+/// \p device to \p byte_size bytes, see
+/// CUDACachedMemoryManager::SetMemoryLimit(). 0 removes the limit.
+void SetMemoryLimit(const Device& device, size_t byte_size);
+
+/// Returns the memory limit of \p device, or 0 if there is no limit.
+size_t GetMemoryLimit(const Device& device);
+
+/// Returns the calling thread's current stream on \p device (see
+/// CUDAStream) as a DLPack stream handle: 1 for the legacy default stream,
+/// and the `cudaStream_t` value otherwise.
+intptr_t GetCurrentStreamHandle(const Device& device);
+
+/// Makes all future work in the DLPack stream handle \p stream wait for the
+/// work enqueued so far to the calling thread's current stream on \p device,
+/// without blocking the host. This is the producer side of DLPack's
+/// `__dlpack__(stream)` handshake. \p stream follows the DLPack convention:
+/// 1 is the legacy default stream, 2 is the per-thread default stream, other
+/// positive values are `cudaStream_t` handles and -1 skips synchronization.
+void WaitForCurrentStream(const Device& device, intptr_t stream);
+
 }  // namespace cuda
 }  // namespace core
 }  // namespace open3d
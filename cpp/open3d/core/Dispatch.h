@@ -26,7 +26,11 @@
 
 #pragma once
 
+#include <cstdint>
+#include <type_traits>
+
 #include "open3d/core/Dtype.h"
+#include "open3d/core/Half.h"
 #include "open3d/utility/Logging.h"
 
 /// Call a numerical templated function based on Dtype. Warp the function to
@@ -46,26 +50,28 @@
 ///
 /// Inspired by:
 ///     https://github.com/pytorch/pytorch/blob/master/aten/src/ATen/Dispatch.h
+///
+/// The most frequently used dtypes (Float32, Int64) are tested first.
 #define DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, ...)              \
     [&] {                                                   \
         if (DTYPE == open3d::core::Dtype::Float32) {        \
             using scalar_t = float;                         \
             return __VA_ARGS__();                           \
+        } else if (DTYPE == open3d::core::Dtype::Int64) {   \
+            using scalar_t = int64_t;                       \
+            return __VA_ARGS__();                           \
         } else if (DTYPE == open3d::core::Dtype::Float64) { \
             using scalar_t = double;                        \
             return __VA_ARGS__();                           \
+        } else if (DTYPE == open3d::core::Dtype::Int32) {   \
+            using scalar_t = int32_t;                       \
+            return __VA_ARGS__();                           \
         } else if (DTYPE == open3d::core::Dtype::Int8) {    \
             using scalar_t = int8_t;                        \
             return __VA_ARGS__();                           \
         } else if (DTYPE == open3d::core::Dtype::Int16) {   \
             using scalar_t = int16_t;                       \
             return __VA_ARGS__();                           \
-        } else if (DTYPE == open3d::core::Dtype::Int32) {   \
-            using scalar_t = int32_t;                       \
-            return __VA_ARGS__();                           \
-        } else if (DTYPE == open3d::core::Dtype::Int64) {   \
-            using scalar_t = int64_t;                       \
-            return __VA_ARGS__();                           \
         } else if (DTYPE == open3d::core::Dtype::UInt8) {   \
             using scalar_t = uint8_t;                       \
             return __VA_ARGS__();                           \
@@ -93,6 +99,33 @@
         }                                                   \
     }()
 
+/// Same as DISPATCH_DTYPE_TO_TEMPLATE, additionally dispatching the 16-bit
+/// floating point dtypes Float16 and BFloat16 to float16_t and bfloat16_t.
+/// Only use it for kernels whose body works with these storage types, i.e.
+/// kernels that do arithmetic through the implicit conversion to float.
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(DTYPE, ...)     \
+    [&] {                                                    \
+        if (DTYPE == open3d::core::Dtype::Float16) {         \
+            using scalar_t = open3d::core::float16_t;        \
+            return __VA_ARGS__();                            \
+        } else if (DTYPE == open3d::core::Dtype::BFloat16) { \
+            using scalar_t = open3d::core::bfloat16_t;       \
+            return __VA_ARGS__();                            \
+        } else {                                             \
+            DISPATCH_DTYPE_TO_TEMPLATE(DTYPE, __VA_ARGS__);  \
+        }                                                    \
+    }()
+
+#define DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(DTYPE, ...)     \
+    [&] {                                                             \
+        if (DTYPE == open3d::core::Dtype::Bool) {                     \
+            using scalar_t = bool;                                    \
+            return __VA_ARGS__();                                     \
+        } else {                                                      \
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(DTYPE, __VA_ARGS__); \
+        }                                                             \
+    }()
+
 #define DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(DTYPE, ...)        \
     [&] {                                                   \
         if (DTYPE == open3d::core::Dtype::Float32) {        \
@@ -105,3 +138,53 @@
             utility::LogError("Unsupported data type.");    \
         }                                                   \
     }()
+
+namespace open3d {
+namespace core {
+
+/// Compile-time list of scalar types. Kernels use it to declare the set of
+/// types for which a specialized code path is instantiated, e.g.:
+///
+///     if (ScalarTypeListContains<scalar_t, HotScalarTypes>::value) ...
+///
+/// Types outside of the list fall back to the kernel's generic path, which
+/// keeps the number of template instantiations (and the binary size) small.
+template <typename... Ts>
+struct ScalarTypeList {};
+
+/// Whether \p T is one of the types of the ScalarTypeList \p List.
+template <typename T, typename List>
+struct ScalarTypeListContains;
+
+template <typename T>
+struct ScalarTypeListContains<T, ScalarTypeList<>> : std::false_type {};
+
+template <typename T, typename Head, typename... Tail>
+struct ScalarTypeListContains<T, ScalarTypeList<Head, Tail...>>
+    : std::conditional<
+              std::is_same<T, Head>::value,
+              std::true_type,
+              ScalarTypeListContains<T, ScalarTypeList<Tail...>>>::type {};
+
+/// Scalar types of the commonly used dtypes: Float32/Float64 data, Int32/Int64
+/// indices, UInt8 images and Bool masks.
+using HotScalarTypes =
+        ScalarTypeList<float, double, int32_t, int64_t, uint8_t, bool>;
+
+/// Scalar types of all non-object dtypes.
+using AllScalarTypes = ScalarTypeList<float,
+                                      double,
+                                      float16_t,
+                                      bfloat16_t,
+                                      int8_t,
+                                      int16_t,
+                                      int32_t,
+                                      int64_t,
+                                      uint8_t,
+                                      uint16_t,
+                                      uint32_t,
+                                      uint64_t,
+                                      bool>;
+
+}  // namespace core
+}  // namespace open3d
@@ -30,6 +30,11 @@
 namespace open3d {
 namespace core {
 
+static_assert(sizeof(float16_t) == 2,
+              "Unsupported platform: float16_t must be 2 bytes.");
+static_assert(sizeof(bfloat16_t) == 2,
+              "Unsupported platform: bfloat16_t must be 2 bytes.");
+
 // clang-format off
 static_assert(sizeof(float   ) == 4, "Unsupported platform: float must be 4 bytes."   );
 static_assert(sizeof(double  ) == 8, "Unsupported platform: double must be 8 bytes."  );
@@ -47,6 +52,8 @@ static_assert(sizeof(bool    ) == 1, "Unsupported platform: bool must be 1 byte.
 const Dtype Dtype::Undefined(Dtype::DtypeCode::Undefined, 1, "Undefined");
 const Dtype Dtype::Float32  (Dtype::DtypeCode::Float,     4, "Float32"  );
 const Dtype Dtype::Float64  (Dtype::DtypeCode::Float,     8, "Float64"  );
+const Dtype Dtype::Float16  (Dtype::DtypeCode::Float,     2, "Float16"  );
+const Dtype Dtype::BFloat16 (Dtype::DtypeCode::Float,     2, "BFloat16" );
 const Dtype Dtype::Int8     (Dtype::DtypeCode::Int,       1, "Int8"     );
 const Dtype Dtype::Int16    (Dtype::DtypeCode::Int,       2, "Int16"    );
 const Dtype Dtype::Int32    (Dtype::DtypeCode::Int,       4, "Int32"    );
@@ -69,12 +76,5 @@ Dtype::Dtype(DtypeCode dtype_code, int64_t byte_size, const std::string &name)
     }
 }
 
-bool Dtype::operator==(const Dtype &other) const {
-    return dtype_code_ == other.dtype_code_ && byte_size_ == other.byte_size_ &&
-           std::strcmp(name_, other.name_) == 0;
-}
-
-bool Dtype::operator!=(const Dtype &other) const { return !(*this == other); }
-
 }  // namespace core
 }  // namespace open3d
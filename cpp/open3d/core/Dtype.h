@@ -31,6 +31,7 @@
 
 #include "open3d/Macro.h"
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/Half.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -41,6 +42,8 @@ public:
     static const Dtype Undefined;
     static const Dtype Float32;
     static const Dtype Float64;
+    static const Dtype Float16;
+    static const Dtype BFloat16;
     static const Dtype Int8;
     static const Dtype Int16;
     static const Dtype Int32;
@@ -80,9 +83,16 @@ public:
 
     std::string ToString() const { return name_; }
 
-    bool operator==(const Dtype &other) const;
+    // Inlined since the DISPATCH_DTYPE_TO_TEMPLATE macros compare dtypes on
+    // every op. The name comparison is only reached for dtypes with the same
+    // code and size, e.g. Float16 vs. BFloat16.
+    bool operator==(const Dtype &other) const {
+        return dtype_code_ == other.dtype_code_ &&
+               byte_size_ == other.byte_size_ &&
+               std::strcmp(name_, other.name_) == 0;
+    }
 
-    bool operator!=(const Dtype &other) const;
+    bool operator!=(const Dtype &other) const { return !(*this == other); }
 
 private:
     static constexpr size_t max_name_len_ = 16;
@@ -101,6 +111,16 @@ inline const Dtype Dtype::FromType<double>() {
     return Dtype::Float64;
 }
 
+template <>
+inline const Dtype Dtype::FromType<float16_t>() {
+    return Dtype::Float16;
+}
+
+template <>
+inline const Dtype Dtype::FromType<bfloat16_t>() {
+    return Dtype::BFloat16;
+}
+
 template <>
 inline const Dtype Dtype::FromType<int8_t>() {
     return Dtype::Int8;
@@ -26,9 +26,12 @@
 
 #include "open3d/core/EigenConverter.h"
 
+#include <memory>
 #include <type_traits>
+#include <utility>
 
-#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/Blob.h"
+#include "open3d/core/MemoryManager.h"
 
 namespace open3d {
 namespace core {
@@ -80,6 +83,18 @@ TensorToEigenMatrixXi(const core::Tensor &tensor) {
     return TensorToEigenMatrix<int>(tensor);
 }
 
+/// Wraps the memory of \p values as a (N, 3) CPU tensor without copying. The
+/// tensor does not own the memory, so it must not outlive \p values.
+template <typename T>
+static core::Tensor WrapEigenVector3xVector(
+        const std::vector<Eigen::Matrix<T, 3, 1>> &values) {
+    void *data_ptr = const_cast<T *>(values.data()->data());
+    auto blob = std::make_shared<Blob>(Device("CPU:0"), data_ptr,
+                                       [](void *) {});
+    return core::Tensor({static_cast<int64_t>(values.size()), 3}, {3, 1},
+                        data_ptr, core::Dtype::FromType<T>(), blob);
+}
+
 template <typename T>
 static std::vector<Eigen::Matrix<T, 3, 1>> TensorToEigenVector3xVector(
         const core::Tensor &tensor) {
@@ -101,10 +116,20 @@ static std::vector<Eigen::Matrix<T, 3, 1>> TensorToEigenVector3xVector(
     // safe to write directly into std vector memory, see:
     // https://eigen.tuxfamily.org/dox/group__TopicStlContainers.html.
     std::vector<Eigen::Matrix<T, 3, 1>> eigen_vector(tensor.GetLength());
-    core::Tensor t = tensor.Contiguous().To(dtype);
-    MemoryManager::MemcpyToHost(eigen_vector.data(), t.GetDataPtr(),
-                                t.GetDevice(),
-                                t.GetDtype().ByteSize() * t.NumElements());
+    if (eigen_vector.empty()) {
+        return eigen_vector;
+    }
+    if (tensor.GetDevice().GetType() == Device::DeviceType::CPU) {
+        // Converts the dtype and layout in one parallel pass, without an
+        // intermediate tensor.
+        core::Tensor dst = WrapEigenVector3xVector(eigen_vector);
+        dst.AsRvalue() = tensor;
+    } else {
+        core::Tensor t = tensor.Contiguous().To(dtype);
+        MemoryManager::MemcpyToHost(eigen_vector.data(), t.GetDataPtr(),
+                                    t.GetDevice(),
+                                    t.GetDtype().ByteSize() * t.NumElements());
+    }
     return eigen_vector;
 }
 
@@ -117,27 +142,40 @@ static core::Tensor EigenVector3xVectorToTensor(
     // keep consistency, we only allow double and int.
     static_assert(std::is_same<T, double>::value || std::is_same<T, int>::value,
                   "Only supports double and int (Vector3d and Vector3i).");
-    // Init CPU Tensor.
-    int64_t num_values = static_cast<int64_t>(values.size());
-    core::Tensor tensor_cpu =
-            core::Tensor::Empty({num_values, 3}, dtype, Device("CPU:0"));
-
-    // Fill Tensor. This takes care of dtype conversion at the same time.
-    core::Indexer indexer({tensor_cpu}, tensor_cpu,
-                          core::DtypePolicy::ALL_SAME);
-    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
-        kernel::cpu_launcher::LaunchIndexFillKernel(
-                indexer, [&](void *ptr, int64_t workload_idx) {
-                    // Fills the flattened tensor tensor_cpu[:] with dtype
-                    // casting. tensor_cpu[:][i] corresponds to the (i/3)-th
-                    // element's (i%3)-th coordinate value.
-                    *static_cast<scalar_t *>(ptr) = static_cast<scalar_t>(
-                            values[workload_idx / 3](workload_idx % 3));
-                });
-    });
-
-    // Copy Tensor to device if necessary.
-    return tensor_cpu.To(device);
+    if (values.empty()) {
+        return core::Tensor::Empty({0, 3}, dtype, device);
+    }
+    core::Tensor view = WrapEigenVector3xVector(values);
+    if (view.GetDtype() == dtype) {
+        // A single copy, straight to the target device.
+        return view.To(device, /*copy=*/true);
+    } else {
+        // The dtype conversion copies in parallel on the CPU.
+        return view.To(dtype).To(device);
+    }
+}
+
+template <typename T>
+static core::Tensor EigenVector3xVectorToTensor(
+        std::vector<Eigen::Matrix<T, 3, 1>> &&values,
+        core::Dtype dtype,
+        const core::Device &device) {
+    static_assert(std::is_same<T, double>::value || std::is_same<T, int>::value,
+                  "Only supports double and int (Vector3d and Vector3i).");
+    if (values.empty() || dtype != core::Dtype::FromType<T>() ||
+        device.GetType() != Device::DeviceType::CPU) {
+        return EigenVector3xVectorToTensor(
+                static_cast<const std::vector<Eigen::Matrix<T, 3, 1>> &>(
+                        values),
+                dtype, device);
+    }
+    // The blob takes over the vector, whose storage the tensor aliases.
+    auto owner = std::make_shared<std::vector<Eigen::Matrix<T, 3, 1>>>(
+            std::move(values));
+    void *data_ptr = owner->data()->data();
+    auto blob = std::make_shared<Blob>(device, data_ptr, [owner](void *) {});
+    return core::Tensor({static_cast<int64_t>(owner->size()), 3}, {3, 1},
+                        data_ptr, dtype, blob);
 }
 
 std::vector<Eigen::Vector3d> TensorToEigenVector3dVector(
@@ -164,6 +202,18 @@ core::Tensor EigenVector3iVectorToTensor(
     return EigenVector3xVectorToTensor(values, dtype, device);
 }
 
+core::Tensor EigenVector3dVectorToTensor(std::vector<Eigen::Vector3d> &&values,
+                                         core::Dtype dtype,
+                                         const core::Device &device) {
+    return EigenVector3xVectorToTensor(std::move(values), dtype, device);
+}
+
+core::Tensor EigenVector3iVectorToTensor(std::vector<Eigen::Vector3i> &&values,
+                                         core::Dtype dtype,
+                                         const core::Device &device) {
+    return EigenVector3xVectorToTensor(std::move(values), dtype, device);
+}
+
 }  // namespace eigen_converter
 }  // namespace core
 }  // namespace open3d
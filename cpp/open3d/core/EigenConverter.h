@@ -119,6 +119,32 @@ core::Tensor EigenVector3iVectorToTensor(
         core::Dtype dtype,
         const core::Device &device);
 
+/// \brief Converts a vector of Eigen::Vector3d to a (N, 3) tensor, taking
+/// ownership of \p values. If \p dtype is Float64 and \p device is a CPU
+/// device, the tensor aliases the vector's storage without copying. Otherwise
+/// this is the same as the copying overload.
+///
+/// \param values A vector of Eigen::Vector3d values, e.g. a list of 3D points.
+/// \param dtype Dtype of the output tensor.
+/// \param device Device of the output tensor.
+/// \return A tensor of shape (N, 3) with the specified dtype and device.
+core::Tensor EigenVector3dVectorToTensor(std::vector<Eigen::Vector3d> &&values,
+                                         core::Dtype dtype,
+                                         const core::Device &device);
+
+/// \brief Converts a vector of Eigen::Vector3i to a (N, 3) tensor, taking
+/// ownership of \p values. If \p dtype is Int32 and \p device is a CPU
+/// device, the tensor aliases the vector's storage without copying. Otherwise
+/// this is the same as the copying overload.
+///
+/// \param values A vector of Eigen::Vector3i values, e.g. a list of 3D points.
+/// \param dtype Dtype of the output tensor.
+/// \param device Device of the output tensor.
+/// \return A tensor of shape (N, 3) with the specified dtype and device.
+core::Tensor EigenVector3iVectorToTensor(std::vector<Eigen::Vector3i> &&values,
+                                         core::Dtype dtype,
+                                         const core::Device &device);
+
 }  // namespace eigen_converter
 }  // namespace core
 }  // namespace open3d
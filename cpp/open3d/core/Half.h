@@ -0,0 +1,265 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+/// \file Half.h
+/// \brief 16-bit floating point storage types.
+///
+/// float16_t (IEEE 754 binary16) and bfloat16_t (brain floating point) are
+/// storage-only types: arithmetic is performed in float and the result is
+/// rounded back to 16 bits (round-to-nearest-even). Both types are usable from
+/// host and device code.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "open3d/core/CUDAUtils.h"
+
+namespace open3d {
+namespace core {
+
+namespace half_util {
+
+OPEN3D_HOST_DEVICE inline uint32_t FloatToBits(float f) {
+#if defined(__CUDA_ARCH__)
+    return __float_as_uint(f);
+#else
+    uint32_t x;
+    std::memcpy(&x, &f, sizeof(x));
+    return x;
+#endif
+}
+
+OPEN3D_HOST_DEVICE inline float BitsToFloat(uint32_t x) {
+#if defined(__CUDA_ARCH__)
+    return __uint_as_float(x);
+#else
+    float f;
+    std::memcpy(&f, &x, sizeof(f));
+    return f;
+#endif
+}
+
+/// float32 -> IEEE binary16 bits, round-to-nearest-even.
+OPEN3D_HOST_DEVICE inline uint16_t FloatToHalfBits(float f) {
+    const uint32_t x = FloatToBits(f);
+    const uint16_t sign = static_cast<uint16_t>((x >> 16) & 0x8000u);
+    const uint32_t abs_x = x & 0x7FFFFFFFu;
+    if (abs_x >= 0x7F800000u) {
+        // Inf or NaN. NaN keeps a quiet bit set.
+        return sign | (abs_x > 0x7F800000u ? 0x7E00u : 0x7C00u);
+    }
+    if (abs_x >= 0x477FF000u) {
+        // Rounds to a magnitude above 65504.
+        return sign | 0x7C00u;
+    }
+    if (abs_x < 0x33000000u) {
+        // Below half of the smallest subnormal.
+        return sign;
+    }
+    const uint32_t exp = abs_x >> 23;
+    if (exp < 113) {
+        // Subnormal half.
+        const uint32_t mant = (abs_x & 0x007FFFFFu) | 0x00800000u;
+        const uint32_t shift = 126 - exp;
+        uint32_t h = mant >> shift;
+        const uint32_t rem = mant & ((1u << shift) - 1);
+        const uint32_t halfway = 1u << (shift - 1);
+        if (rem > halfway || (rem == halfway && (h & 1u))) {
+            ++h;
+        }
+        return sign | static_cast<uint16_t>(h);
+    }
+    // Normal half. A mantissa carry correctly bumps the exponent.
+    uint32_t h = ((exp - 112) << 10) | ((abs_x >> 13) & 0x03FFu);
+    const uint32_t rem = abs_x & 0x1FFFu;
+    if (rem > 0x1000u || (rem == 0x1000u && (h & 1u))) {
+        ++h;
+    }
+    return sign | static_cast<uint16_t>(h);
+}
+
+/// IEEE binary16 bits -> float32 (exact).
+OPEN3D_HOST_DEVICE inline float HalfBitsToFloat(uint16_t h) {
+    const uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+    uint32_t exp = (h >> 10) & 0x1Fu;
+    uint32_t mant = h & 0x03FFu;
+    if (exp == 0x1Fu) {
+        return BitsToFloat(sign | 0x7F800000u | (mant << 13));
+    }
+    if (exp == 0) {
+        if (mant == 0) {
+            return BitsToFloat(sign);
+        }
+        // Normalize the subnormal.
+        exp = 113;
+        while ((mant & 0x0400u) == 0) {
+            mant <<= 1;
+            --exp;
+        }
+        mant &= 0x03FFu;
+        return BitsToFloat(sign | (exp << 23) | (mant << 13));
+    }
+    return BitsToFloat(sign | ((exp + 112) << 23) | (mant << 13));
+}
+
+/// float32 -> bfloat16 bits, round-to-nearest-even.
+OPEN3D_HOST_DEVICE inline uint16_t FloatToBFloat16Bits(float f) {
+    const uint32_t x = FloatToBits(f);
+    if ((x & 0x7FFFFFFFu) > 0x7F800000u) {
+        return static_cast<uint16_t>(((x >> 16) & 0x8000u) | 0x7FC0u);
+    }
+    const uint32_t lsb = (x >> 16) & 1u;
+    return static_cast<uint16_t>((x + 0x7FFFu + lsb) >> 16);
+}
+
+/// bfloat16 bits -> float32 (exact).
+OPEN3D_HOST_DEVICE inline float BFloat16BitsToFloat(uint16_t b) {
+    return BitsToFloat(static_cast<uint32_t>(b) << 16);
+}
+
+}  // namespace half_util
+
+/// IEEE 754 half precision floating point number.
+struct float16_t {
+    uint16_t x;
+
+    float16_t() = default;
+
+    OPEN3D_HOST_DEVICE float16_t(float f)
+        : x(half_util::FloatToHalfBits(f)) {}
+
+    /// Construct from the raw binary16 bit pattern.
+    static constexpr float16_t FromBits(uint16_t bits) {
+        return float16_t(bits, FromBitsTag());
+    }
+
+    OPEN3D_HOST_DEVICE operator float() const {
+        return half_util::HalfBitsToFloat(x);
+    }
+
+    OPEN3D_HOST_DEVICE float16_t& operator+=(float16_t rhs) {
+        return *this = float(*this) + float(rhs);
+    }
+    OPEN3D_HOST_DEVICE float16_t& operator-=(float16_t rhs) {
+        return *this = float(*this) - float(rhs);
+    }
+    OPEN3D_HOST_DEVICE float16_t& operator*=(float16_t rhs) {
+        return *this = float(*this) * float(rhs);
+    }
+    OPEN3D_HOST_DEVICE float16_t& operator/=(float16_t rhs) {
+        return *this = float(*this) / float(rhs);
+    }
+
+private:
+    struct FromBitsTag {};
+    constexpr float16_t(uint16_t bits, FromBitsTag) : x(bits) {}
+};
+
+/// Brain floating point number: float32 with the 16 low mantissa bits dropped.
+struct bfloat16_t {
+    uint16_t x;
+
+    bfloat16_t() = default;
+
+    OPEN3D_HOST_DEVICE bfloat16_t(float f)
+        : x(half_util::FloatToBFloat16Bits(f)) {}
+
+    /// Construct from the raw bfloat16 bit pattern.
+    static constexpr bfloat16_t FromBits(uint16_t bits) {
+        return bfloat16_t(bits, FromBitsTag());
+    }
+
+    OPEN3D_HOST_DEVICE operator float() const {
+        return half_util::BFloat16BitsToFloat(x);
+    }
+
+    OPEN3D_HOST_DEVICE bfloat16_t& operator+=(bfloat16_t rhs) {
+        return *this = float(*this) + float(rhs);
+    }
+    OPEN3D_HOST_DEVICE bfloat16_t& operator-=(bfloat16_t rhs) {
+        return *this = float(*this) - float(rhs);
+    }
+    OPEN3D_HOST_DEVICE bfloat16_t& operator*=(bfloat16_t rhs) {
+        return *this = float(*this) * float(rhs);
+    }
+    OPEN3D_HOST_DEVICE bfloat16_t& operator/=(bfloat16_t rhs) {
+        return *this = float(*this) / float(rhs);
+    }
+
+private:
+    struct FromBitsTag {};
+    constexpr bfloat16_t(uint16_t bits, FromBitsTag) : x(bits) {}
+};
+
+}  // namespace core
+}  // namespace open3d
+
+namespace std {
+
+template <>
+class numeric_limits<open3d::core::float16_t> {
+    using T = open3d::core::float16_t;
+
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 11;
+    static constexpr T min() { return T::FromBits(0x0400); }
+    static constexpr T max() { return T::FromBits(0x7BFF); }
+    static constexpr T lowest() { return T::FromBits(0xFBFF); }
+    static constexpr T epsilon() { return T::FromBits(0x1400); }
+    static constexpr T infinity() { return T::FromBits(0x7C00); }
+    static constexpr T quiet_NaN() { return T::FromBits(0x7E00); }
+};
+
+template <>
+class numeric_limits<open3d::core::bfloat16_t> {
+    using T = open3d::core::bfloat16_t;
+
+public:
+    static constexpr bool is_specialized = true;
+    static constexpr bool is_signed = true;
+    static constexpr bool is_integer = false;
+    static constexpr bool is_exact = false;
+    static constexpr bool has_infinity = true;
+    static constexpr bool has_quiet_NaN = true;
+    static constexpr int digits = 8;
+    static constexpr T min() { return T::FromBits(0x0080); }
+    static constexpr T max() { return T::FromBits(0x7F7F); }
+    static constexpr T lowest() { return T::FromBits(0xFF7F); }
+    static constexpr T epsilon() { return T::FromBits(0x3C00); }
+    static constexpr T infinity() { return T::FromBits(0x7F80); }
+    static constexpr T quiet_NaN() { return T::FromBits(0x7FC0); }
+};
+
+}  // namespace std
@@ -29,6 +29,102 @@
 namespace open3d {
 namespace core {
 
+/// Returns true if \p ref was constructed from a tensor with the same shape,
+/// strides and element size as \p tensor.
+static bool HasSameLayout(const TensorRef& ref, const Tensor& tensor) {
+    if (ref.ndims_ != tensor.NumDims() ||
+        ref.dtype_byte_size_ != tensor.GetDtype().ByteSize()) {
+        return false;
+    }
+    for (int64_t i = 0; i < ref.ndims_; ++i) {
+        if (ref.shape_[i] != tensor.GetShape(i) ||
+            ref.byte_strides_[i] !=
+                    tensor.GetStride(i) * ref.dtype_byte_size_) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Per-thread cache of recently constructed Indexers. Ops that are repeatedly
+/// applied to operands of the same shapes and strides, e.g. to 4x4
+/// transformation matrices, reuse the broadcasted, reordered and coalesced
+/// layout of a cached Indexer and only replace its data pointers.
+class IndexerCache {
+public:
+    const Indexer* Find(const std::vector<Tensor>& input_tensors,
+                        const std::vector<Tensor>& output_tensors,
+                        const SizeVector& reduction_dims) const {
+        for (const Entry& entry : entries_) {
+            if (entry.IsSame(input_tensors, output_tensors, reduction_dims)) {
+                return &entry.indexer_;
+            }
+        }
+        return nullptr;
+    }
+
+    void Insert(const std::vector<Tensor>& input_tensors,
+                const std::vector<Tensor>& output_tensors,
+                const SizeVector& reduction_dims,
+                const Indexer& indexer) {
+        Entry& entry = entries_[next_entry_];
+        next_entry_ = (next_entry_ + 1) % INDEXER_CACHE_SIZE;
+        entry.num_inputs_ = static_cast<int64_t>(input_tensors.size());
+        entry.num_outputs_ = static_cast<int64_t>(output_tensors.size());
+        for (int64_t i = 0; i < entry.num_inputs_; ++i) {
+            entry.inputs_[i] = TensorRef(input_tensors[i]);
+        }
+        for (int64_t i = 0; i < entry.num_outputs_; ++i) {
+            entry.outputs_[i] = TensorRef(output_tensors[i]);
+        }
+        entry.reduction_dims_ = reduction_dims;
+        entry.indexer_ = indexer;
+    }
+
+private:
+    static constexpr int64_t INDEXER_CACHE_SIZE = 4;
+
+    struct Entry {
+        bool IsSame(const std::vector<Tensor>& input_tensors,
+                    const std::vector<Tensor>& output_tensors,
+                    const SizeVector& reduction_dims) const {
+            if (num_inputs_ != static_cast<int64_t>(input_tensors.size()) ||
+                num_outputs_ != static_cast<int64_t>(output_tensors.size()) ||
+                reduction_dims_ != reduction_dims) {
+                return false;
+            }
+            for (int64_t i = 0; i < num_inputs_; ++i) {
+                if (!HasSameLayout(inputs_[i], input_tensors[i])) {
+                    return false;
+                }
+            }
+            for (int64_t i = 0; i < num_outputs_; ++i) {
+                if (!HasSameLayout(outputs_[i], output_tensors[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // An empty entry (num_inputs_ == 0) never matches, since Indexers
+        // have at least one input.
+        int64_t num_inputs_ = 0;
+        int64_t num_outputs_ = 0;
+        TensorRef inputs_[MAX_INPUTS];
+        TensorRef outputs_[MAX_OUTPUTS];
+        SizeVector reduction_dims_;
+        Indexer indexer_;
+    };
+
+    Entry entries_[INDEXER_CACHE_SIZE];
+    int64_t next_entry_ = 0;
+};
+
+static IndexerCache& GetIndexerCache() {
+    static thread_local IndexerCache cache;
+    return cache;
+}
+
 Indexer::Indexer(const std::vector<Tensor>& input_tensors,
                  const Tensor& output_tensor,
                  DtypePolicy dtype_policy,
@@ -110,6 +206,23 @@ Indexer::Indexer(const std::vector<Tensor>& input_tensors,
         utility::LogError("Unimplemented dtype policy");
     }
 
+    // Operands with the same layout as a cached Indexer only differ in their
+    // data pointers.
+    IndexerCache& cache = GetIndexerCache();
+    if (const Indexer* cached_indexer =
+                cache.Find(input_tensors, output_tensors, reduction_dims)) {
+        *this = *cached_indexer;
+        for (int64_t i = 0; i < num_inputs_; ++i) {
+            inputs_[i].data_ptr_ =
+                    const_cast<void*>(input_tensors[i].GetDataPtr());
+        }
+        for (int64_t i = 0; i < num_outputs_; ++i) {
+            outputs_[i].data_ptr_ =
+                    const_cast<void*>(output_tensors[i].GetDataPtr());
+        }
+        return;
+    }
+
     // Convert to TensorRef.
     for (int64_t i = 0; i < num_inputs_; ++i) {
         inputs_[i] = TensorRef(input_tensors[i]);
@@ -187,6 +300,8 @@ Indexer::Indexer(const std::vector<Tensor>& input_tensors,
 
     // Fill global strides master_strides_.
     UpdateMasterStrides();
+
+    cache.Insert(input_tensors, output_tensors, reduction_dims, *this);
 }
 
 bool Indexer::CanUse32BitIndexing() const {
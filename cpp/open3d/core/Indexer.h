@@ -337,6 +337,9 @@ public:
     /// Number of input Tensors.
     int64_t NumInputs() const { return num_inputs_; }
 
+    /// Number of output Tensors.
+    int64_t NumOutputs() const { return num_outputs_; }
+
     /// Returns input TensorRef.
     TensorRef& GetInput(int64_t i) {
         if (i >= num_inputs_ || i < 0) {
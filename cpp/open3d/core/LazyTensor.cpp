@@ -0,0 +1,358 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/LazyTensor.h"
+
+#include <vector>
+
+#include "open3d/core/Indexer.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+struct LazyTensor::Node {
+    enum class Kind { Leaf, Scalar, Unary, Binary };
+
+    Kind kind_;
+    kernel::FusedEWOpCode op_code_ = kernel::FusedEWOpCode::Input;
+    Tensor tensor_;
+    Scalar scalar_ = 0.0;
+    std::shared_ptr<const Node> lhs_ = nullptr;
+    std::shared_ptr<const Node> rhs_ = nullptr;
+
+    SizeVector shape_;
+    Dtype dtype_ = Dtype::Undefined;
+    Device device_;
+    int64_t num_nodes_ = 1;
+};
+
+using Node = LazyTensor::Node;
+
+static std::shared_ptr<const Node> MakeLeafNode(const Tensor& tensor) {
+    auto node = std::make_shared<Node>();
+    node->kind_ = Node::Kind::Leaf;
+    node->op_code_ = kernel::FusedEWOpCode::Input;
+    node->tensor_ = tensor;
+    node->shape_ = tensor.GetShape();
+    node->dtype_ = tensor.GetDtype();
+    node->device_ = tensor.GetDevice();
+    return node;
+}
+
+static std::shared_ptr<const Node> MakeScalarNode(Scalar value,
+                                                  Dtype dtype,
+                                                  const Device& device) {
+    auto node = std::make_shared<Node>();
+    node->kind_ = Node::Kind::Scalar;
+    node->op_code_ = kernel::FusedEWOpCode::Scalar;
+    node->scalar_ = value;
+    node->shape_ = {};
+    node->dtype_ = dtype;
+    node->device_ = device;
+    return node;
+}
+
+static std::shared_ptr<const Node> MakeUnaryNode(
+        kernel::FusedEWOpCode op_code,
+        const std::shared_ptr<const Node>& src) {
+    if ((op_code == kernel::FusedEWOpCode::Sqrt ||
+         op_code == kernel::FusedEWOpCode::Exp ||
+         op_code == kernel::FusedEWOpCode::Sin ||
+         op_code == kernel::FusedEWOpCode::Cos) &&
+        src->dtype_ != Dtype::Float32 && src->dtype_ != Dtype::Float64) {
+        utility::LogError("Only supports Float32 and Float64, but {} is used.",
+                          src->dtype_.ToString());
+    }
+    auto node = std::make_shared<Node>();
+    node->kind_ = Node::Kind::Unary;
+    node->op_code_ = op_code;
+    node->lhs_ = src;
+    node->shape_ = src->shape_;
+    node->dtype_ = src->dtype_;
+    node->device_ = src->device_;
+    node->num_nodes_ = src->num_nodes_ + 1;
+    return node;
+}
+
+static std::shared_ptr<const Node> MakeBinaryNode(
+        kernel::FusedEWOpCode op_code,
+        const std::shared_ptr<const Node>& lhs,
+        const std::shared_ptr<const Node>& rhs) {
+    if (lhs->device_ != rhs->device_) {
+        utility::LogError("Device mismatch {} != {}.",
+                          lhs->device_.ToString(), rhs->device_.ToString());
+    }
+    if (lhs->dtype_ != rhs->dtype_) {
+        utility::LogError("Dtype mismatch {} != {}.", lhs->dtype_.ToString(),
+                          rhs->dtype_.ToString());
+    }
+    auto node = std::make_shared<Node>();
+    node->kind_ = Node::Kind::Binary;
+    node->op_code_ = op_code;
+    node->lhs_ = lhs;
+    node->rhs_ = rhs;
+    node->shape_ = shape_util::BroadcastedShape(lhs->shape_, rhs->shape_);
+    node->dtype_ = lhs->dtype_;
+    node->device_ = lhs->device_;
+    node->num_nodes_ = lhs->num_nodes_ + rhs->num_nodes_ + 1;
+    return node;
+}
+
+/// Flattens an expression graph into a postfix program for kernel::FusedEW.
+/// Leaf tensors that are the same tensor are only passed to the kernel once.
+class FusedEWCompiler {
+public:
+    void Emit(const Node& node) {
+        switch (node.kind_) {
+            case Node::Kind::Leaf: {
+                int64_t input_idx = -1;
+                for (size_t i = 0; i < inputs_.size(); ++i) {
+                    if (inputs_[i].IsSame(node.tensor_)) {
+                        input_idx = static_cast<int64_t>(i);
+                        break;
+                    }
+                }
+                if (input_idx < 0) {
+                    input_idx = static_cast<int64_t>(inputs_.size());
+                    inputs_.push_back(node.tensor_);
+                }
+                program_.emplace_back(kernel::FusedEWOpCode::Input, input_idx);
+                break;
+            }
+            case Node::Kind::Scalar:
+                program_.emplace_back(kernel::FusedEWOpCode::Scalar, -1,
+                                      node.scalar_);
+                break;
+            case Node::Kind::Unary:
+                Emit(*node.lhs_);
+                program_.emplace_back(node.op_code_);
+                break;
+            case Node::Kind::Binary:
+                Emit(*node.lhs_);
+                Emit(*node.rhs_);
+                program_.emplace_back(node.op_code_);
+                break;
+        }
+    }
+
+    /// Returns true if the emitted program fits into a single fused kernel.
+    bool Fits() const {
+        return static_cast<int64_t>(inputs_.size()) <= MAX_INPUTS &&
+               static_cast<int64_t>(program_.size()) <=
+                       kernel::MAX_FUSED_EW_INSTRUCTIONS &&
+               kernel::FusedEWStackDepth(program_) <=
+                       kernel::MAX_FUSED_EW_STACK_DEPTH;
+    }
+
+    const std::vector<Tensor>& GetInputs() const { return inputs_; }
+
+    const std::vector<kernel::FusedEWInstruction>& GetProgram() const {
+        return program_;
+    }
+
+private:
+    std::vector<Tensor> inputs_;
+    std::vector<kernel::FusedEWInstruction> program_;
+};
+
+/// Returns an equivalent node whose operands are materialized leaves. Such a
+/// node always fits into a single fused kernel.
+static std::shared_ptr<const Node> MaterializeOperands(
+        const std::shared_ptr<const Node>& node);
+
+static void EvalNodeInto(const std::shared_ptr<const Node>& node, Tensor& dst) {
+    FusedEWCompiler compiler;
+    compiler.Emit(*node);
+    if (!compiler.Fits()) {
+        // The expression is too large for one kernel. Evaluate the operands
+        // separately (each of them fused as much as possible) and then apply
+        // the top-level op.
+        compiler = FusedEWCompiler();
+        compiler.Emit(*MaterializeOperands(node));
+    }
+    kernel::FusedEW(compiler.GetInputs(), compiler.GetProgram(), dst);
+}
+
+static Tensor EvalNode(const std::shared_ptr<const Node>& node) {
+    if (node->kind_ == Node::Kind::Leaf) {
+        return node->tensor_;
+    }
+    Tensor dst(node->shape_, node->dtype_, node->device_);
+    EvalNodeInto(node, dst);
+    return dst;
+}
+
+static std::shared_ptr<const Node> MaterializeOperands(
+        const std::shared_ptr<const Node>& node) {
+    auto materialize = [](const std::shared_ptr<const Node>& operand) {
+        if (operand->kind_ == Node::Kind::Leaf ||
+            operand->kind_ == Node::Kind::Scalar) {
+            return operand;
+        }
+        return MakeLeafNode(EvalNode(operand));
+    };
+    if (node->kind_ == Node::Kind::Unary) {
+        return MakeUnaryNode(node->op_code_, materialize(node->lhs_));
+    } else if (node->kind_ == Node::Kind::Binary) {
+        return MakeBinaryNode(node->op_code_, materialize(node->lhs_),
+                              materialize(node->rhs_));
+    } else {
+        return node;
+    }
+}
+
+/// Returns true if writing to \p dst may overwrite elements of a leaf before
+/// they are read. A leaf that is exactly \p dst is safe, since every element is
+/// read before it is written.
+static bool OverlapsLeaf(const Node& node, const Tensor& dst) {
+    switch (node.kind_) {
+        case Node::Kind::Leaf:
+            return node.tensor_.GetBlob() == dst.GetBlob() &&
+                   !node.tensor_.IsSame(dst);
+        case Node::Kind::Scalar:
+            return false;
+        case Node::Kind::Unary:
+            return OverlapsLeaf(*node.lhs_, dst);
+        case Node::Kind::Binary:
+            return OverlapsLeaf(*node.lhs_, dst) ||
+                   OverlapsLeaf(*node.rhs_, dst);
+    }
+    return false;
+}
+
+LazyTensor::LazyTensor(const Tensor& tensor) : node_(MakeLeafNode(tensor)) {}
+
+LazyTensor::LazyTensor(const std::shared_ptr<const Node>& node)
+    : node_(node) {}
+
+Tensor LazyTensor::Eval() const { return EvalNode(node_); }
+
+void LazyTensor::EvalInto(Tensor& dst) const {
+    dst.AssertShape(node_->shape_);
+    dst.AssertDtype(node_->dtype_);
+    dst.AssertDevice(node_->device_);
+    if (OverlapsLeaf(*node_, dst)) {
+        dst.AsRvalue() = EvalNode(node_);
+    } else {
+        EvalNodeInto(node_, dst);
+    }
+}
+
+SizeVector LazyTensor::GetShape() const { return node_->shape_; }
+
+Dtype LazyTensor::GetDtype() const { return node_->dtype_; }
+
+Device LazyTensor::GetDevice() const { return node_->device_; }
+
+bool LazyTensor::IsLeaf() const { return node_->kind_ == Node::Kind::Leaf; }
+
+int64_t LazyTensor::NumNodes() const { return node_->num_nodes_; }
+
+LazyTensor LazyTensor::Add(const LazyTensor& value) const {
+    return LazyTensor(
+            MakeBinaryNode(kernel::FusedEWOpCode::Add, node_, value.node_));
+}
+
+LazyTensor LazyTensor::Add(Scalar value) const {
+    return LazyTensor(MakeBinaryNode(
+            kernel::FusedEWOpCode::Add, node_,
+            MakeScalarNode(value, node_->dtype_, node_->device_)));
+}
+
+LazyTensor LazyTensor::Sub(const LazyTensor& value) const {
+    return LazyTensor(
+            MakeBinaryNode(kernel::FusedEWOpCode::Sub, node_, value.node_));
+}
+
+LazyTensor LazyTensor::Sub(Scalar value) const {
+    return LazyTensor(MakeBinaryNode(
+            kernel::FusedEWOpCode::Sub, node_,
+            MakeScalarNode(value, node_->dtype_, node_->device_)));
+}
+
+LazyTensor LazyTensor::Mul(const LazyTensor& value) const {
+    return LazyTensor(
+            MakeBinaryNode(kernel::FusedEWOpCode::Mul, node_, value.node_));
+}
+
+LazyTensor LazyTensor::Mul(Scalar value) const {
+    return LazyTensor(MakeBinaryNode(
+            kernel::FusedEWOpCode::Mul, node_,
+            MakeScalarNode(value, node_->dtype_, node_->device_)));
+}
+
+LazyTensor LazyTensor::Div(const LazyTensor& value) const {
+    return LazyTensor(
+            MakeBinaryNode(kernel::FusedEWOpCode::Div, node_, value.node_));
+}
+
+LazyTensor LazyTensor::Div(Scalar value) const {
+    return LazyTensor(MakeBinaryNode(
+            kernel::FusedEWOpCode::Div, node_,
+            MakeScalarNode(value, node_->dtype_, node_->device_)));
+}
+
+LazyTensor LazyTensor::RSub(Scalar value) const {
+    return LazyTensor(MakeBinaryNode(
+            kernel::FusedEWOpCode::Sub,
+            MakeScalarNode(value, node_->dtype_, node_->device_), node_));
+}
+
+LazyTensor LazyTensor::RDiv(Scalar value) const {
+    return LazyTensor(MakeBinaryNode(
+            kernel::FusedEWOpCode::Div,
+            MakeScalarNode(value, node_->dtype_, node_->device_), node_));
+}
+
+LazyTensor LazyTensor::Neg() const {
+    return LazyTensor(MakeUnaryNode(kernel::FusedEWOpCode::Neg, node_));
+}
+
+LazyTensor LazyTensor::Abs() const {
+    return LazyTensor(MakeUnaryNode(kernel::FusedEWOpCode::Abs, node_));
+}
+
+LazyTensor LazyTensor::Sqrt() const {
+    return LazyTensor(MakeUnaryNode(kernel::FusedEWOpCode::Sqrt, node_));
+}
+
+LazyTensor LazyTensor::Exp() const {
+    return LazyTensor(MakeUnaryNode(kernel::FusedEWOpCode::Exp, node_));
+}
+
+LazyTensor LazyTensor::Sin() const {
+    return LazyTensor(MakeUnaryNode(kernel::FusedEWOpCode::Sin, node_));
+}
+
+LazyTensor LazyTensor::Cos() const {
+    return LazyTensor(MakeUnaryNode(kernel::FusedEWOpCode::Cos, node_));
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,198 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Scalar.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// \class LazyTensor
+///
+/// A deferred element-wise expression over Tensors. Arithmetic and unary math
+/// ops on a LazyTensor do not compute anything; they record a small
+/// expression graph instead. When the expression is evaluated, via Eval(),
+/// EvalInto() or an implicit conversion to Tensor, the whole graph is compiled
+/// into one fused element-wise kernel, so intermediate results never
+/// materialize in memory.
+///
+/// Example:
+/// ```cpp
+/// // One pass over memory and one output allocation, instead of three.
+/// core::Tensor normalized = (points.Lazy() - mean) * scale + offset;
+/// ```
+///
+/// Fused evaluation gives the same results as the equivalent chain of
+/// non-fused Tensor ops: broadcasting rules, dtype checks and scalar casting
+/// are identical, and every intermediate value is computed in the dtype of the
+/// operands. Expressions that exceed the fused kernel limits (see
+/// kernel::MAX_FUSED_EW_INSTRUCTIONS) fall back to op-by-op evaluation.
+class LazyTensor {
+public:
+    /// Wraps an existing tensor as a leaf of an expression.
+    LazyTensor(const Tensor& tensor);
+
+    LazyTensor(const LazyTensor& other) = default;
+    LazyTensor& operator=(const LazyTensor& other) = default;
+
+    /// Evaluates the expression into a newly allocated contiguous tensor. For a
+    /// leaf expression, the wrapped tensor is returned without a copy.
+    Tensor Eval() const;
+
+    /// Evaluates the expression into an existing tensor. \p dst must have the
+    /// broadcasted shape, dtype and device of the expression. \p dst may alias
+    /// one of the leaf tensors.
+    void EvalInto(Tensor& dst) const;
+
+    /// Implicit evaluation, e.g. `core::Tensor t = a.Lazy() + b;`.
+    operator Tensor() const { return Eval(); }
+
+    SizeVector GetShape() const;
+    Dtype GetDtype() const;
+    Device GetDevice() const;
+
+    LazyTensor Add(const LazyTensor& value) const;
+    LazyTensor Add(Scalar value) const;
+    LazyTensor Sub(const LazyTensor& value) const;
+    LazyTensor Sub(Scalar value) const;
+    LazyTensor Mul(const LazyTensor& value) const;
+    LazyTensor Mul(Scalar value) const;
+    LazyTensor Div(const LazyTensor& value) const;
+    LazyTensor Div(Scalar value) const;
+
+    /// Reflected subtraction, i.e. value - *this.
+    LazyTensor RSub(Scalar value) const;
+    /// Reflected division, i.e. value / *this.
+    LazyTensor RDiv(Scalar value) const;
+
+    LazyTensor Neg() const;
+    LazyTensor Abs() const;
+    LazyTensor Sqrt() const;
+    LazyTensor Exp() const;
+    LazyTensor Sin() const;
+    LazyTensor Cos() const;
+
+    /// Returns true if the expression is a leaf, i.e. a wrapped Tensor.
+    bool IsLeaf() const;
+
+    /// Returns the number of nodes in the expression graph.
+    int64_t NumNodes() const;
+
+    struct Node;
+
+private:
+    explicit LazyTensor(const std::shared_ptr<const Node>& node);
+
+    std::shared_ptr<const Node> node_;
+};
+
+// The overloads below are spelled out for every operand combination, so that
+// mixing Tensor and LazyTensor operands always selects the lazy version
+// instead of the implicit LazyTensor -> Tensor conversion.
+inline LazyTensor operator+(const LazyTensor& lhs, const LazyTensor& rhs) {
+    return lhs.Add(rhs);
+}
+inline LazyTensor operator+(const LazyTensor& lhs, const Tensor& rhs) {
+    return lhs.Add(rhs);
+}
+inline LazyTensor operator+(const Tensor& lhs, const LazyTensor& rhs) {
+    return LazyTensor(lhs).Add(rhs);
+}
+inline LazyTensor operator+(const LazyTensor& lhs, Scalar rhs) {
+    return lhs.Add(rhs);
+}
+
+inline LazyTensor operator-(const LazyTensor& lhs, const LazyTensor& rhs) {
+    return lhs.Sub(rhs);
+}
+inline LazyTensor operator-(const LazyTensor& lhs, const Tensor& rhs) {
+    return lhs.Sub(rhs);
+}
+inline LazyTensor operator-(const Tensor& lhs, const LazyTensor& rhs) {
+    return LazyTensor(lhs).Sub(rhs);
+}
+inline LazyTensor operator-(const LazyTensor& lhs, Scalar rhs) {
+    return lhs.Sub(rhs);
+}
+
+inline LazyTensor operator*(const LazyTensor& lhs, const LazyTensor& rhs) {
+    return lhs.Mul(rhs);
+}
+inline LazyTensor operator*(const LazyTensor& lhs, const Tensor& rhs) {
+    return lhs.Mul(rhs);
+}
+inline LazyTensor operator*(const Tensor& lhs, const LazyTensor& rhs) {
+    return LazyTensor(lhs).Mul(rhs);
+}
+inline LazyTensor operator*(const LazyTensor& lhs, Scalar rhs) {
+    return lhs.Mul(rhs);
+}
+
+inline LazyTensor operator/(const LazyTensor& lhs, const LazyTensor& rhs) {
+    return lhs.Div(rhs);
+}
+inline LazyTensor operator/(const LazyTensor& lhs, const Tensor& rhs) {
+    return lhs.Div(rhs);
+}
+inline LazyTensor operator/(const Tensor& lhs, const LazyTensor& rhs) {
+    return LazyTensor(lhs).Div(rhs);
+}
+inline LazyTensor operator/(const LazyTensor& lhs, Scalar rhs) {
+    return lhs.Div(rhs);
+}
+
+inline LazyTensor operator-(const LazyTensor& value) { return value.Neg(); }
+
+template <typename T>
+inline LazyTensor operator+(T scalar_lhs, const LazyTensor& rhs) {
+    return rhs + scalar_lhs;
+}
+
+template <typename T>
+inline LazyTensor operator-(T scalar_lhs, const LazyTensor& rhs) {
+    return rhs.RSub(scalar_lhs);
+}
+
+template <typename T>
+inline LazyTensor operator*(T scalar_lhs, const LazyTensor& rhs) {
+    return rhs * scalar_lhs;
+}
+
+template <typename T>
+inline LazyTensor operator/(T scalar_lhs, const LazyTensor& rhs) {
+    return rhs.RDiv(scalar_lhs);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -26,8 +26,11 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <memory>
 #include <numeric>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "open3d/core/Blob.h"
 #include "open3d/core/Device.h"
@@ -44,13 +47,46 @@ void* MemoryManager::Malloc(size_t byte_size, const Device& device) {
     return ptr;
 }
 
+/// CUDA memory freed since BeginDeferredFree() on the calling thread, or
+/// nullptr if frees are not deferred.
+static std::unique_ptr<std::vector<std::pair<void*, Device>>>&
+GetDeferredFrees() {
+    static thread_local std::unique_ptr<std::vector<std::pair<void*, Device>>>
+            deferred_frees;
+    return deferred_frees;
+}
+
 void MemoryManager::Free(void* ptr, const Device& device) {
+    auto& deferred_frees = GetDeferredFrees();
+    if (deferred_frees != nullptr &&
+        device.GetType() == Device::DeviceType::CUDA) {
+        deferred_frees->emplace_back(ptr, device);
+        return;
+    }
     // Update statistics before freeing the memory. This ensures a consistent
     // order in case a subsequent Malloc requires the currently freed memory.
     MemoryManagerStatistic::GetInstance().CountFree(ptr, device);
     GetDeviceMemoryManager(device)->Free(ptr, device);
 }
 
+void MemoryManager::BeginDeferredFree() {
+    auto& deferred_frees = GetDeferredFrees();
+    if (deferred_frees != nullptr) {
+        utility::LogError("Frees are already deferred on this thread.");
+    }
+    deferred_frees.reset(new std::vector<std::pair<void*, Device>>());
+}
+
+void MemoryManager::EndDeferredFree() {
+    std::unique_ptr<std::vector<std::pair<void*, Device>>> deferred_frees =
+            std::move(GetDeferredFrees());
+    if (deferred_frees != nullptr) {
+        for (const auto& ptr_device : *deferred_frees) {
+            Free(ptr_device.first, ptr_device.second);
+        }
+    }
+}
+
 void MemoryManager::Memcpy(void* dst_ptr,
                            const Device& dst_device,
                            const void* src_ptr,
@@ -99,14 +135,56 @@ void MemoryManager::MemcpyToHost(void* host_ptr,
     Memcpy(host_ptr, Device("CPU:0"), src_ptr, src_device, num_bytes);
 }
 
+#ifdef BUILD_CUDA_MODULE
+static CUDAPinnedMemoryManager& GetPinnedMemoryManager() {
+    static CUDAPinnedMemoryManager pinned_mm;
+    return pinned_mm;
+}
+#endif
+
+void* MemoryManager::MallocPinned(size_t byte_size) {
+#ifdef BUILD_CUDA_MODULE
+    const Device host("CPU:0");
+    void* ptr = GetPinnedMemoryManager().Malloc(byte_size, host);
+    MemoryManagerStatistic::GetInstance().CountMalloc(ptr, byte_size, host);
+    return ptr;
+#else
+    utility::LogError("Not compiled with CUDA, pinned memory is unavailable.");
+    return nullptr;
+#endif
+}
+
+void MemoryManager::FreePinned(void* ptr) {
+#ifdef BUILD_CUDA_MODULE
+    const Device host("CPU:0");
+    MemoryManagerStatistic::GetInstance().CountFree(ptr, host);
+    GetPinnedMemoryManager().Free(ptr, host);
+#else
+    utility::LogError("Not compiled with CUDA, pinned memory is unavailable.");
+#endif
+}
+
+bool MemoryManager::IsPinned(const void* ptr) {
+#ifdef BUILD_CUDA_MODULE
+    return CUDAPinnedMemoryManager::IsPinnedPointer(ptr);
+#else
+    return false;
+#endif
+}
+
 std::shared_ptr<DeviceMemoryManager> MemoryManager::GetDeviceMemoryManager(
         const Device& device) {
     static std::unordered_map<Device::DeviceType,
                               std::shared_ptr<DeviceMemoryManager>,
                               utility::hash_enum_class>
             map_device_type_to_memory_manager = {
+#ifdef BUILD_CACHED_CPU_MANAGER
+                    {Device::DeviceType::CPU,
+                     std::make_shared<CPUCachedMemoryManager>()},
+#else
                     {Device::DeviceType::CPU,
                      std::make_shared<CPUMemoryManager>()},
+#endif  // BUILD_CACHED_CPU_MANAGER
 #ifdef BUILD_CUDA_MODULE
 #ifdef BUILD_CACHED_CUDA_MANAGER
                     {Device::DeviceType::CUDA,
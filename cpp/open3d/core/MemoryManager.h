@@ -59,6 +59,22 @@ public:
                              const Device& src_device,
                              size_t num_bytes);
 
+    /// Allocates page-locked (pinned) host memory. Copies between pinned host
+    /// memory and CUDA devices are asynchronous and run at full PCIe
+    /// bandwidth. Freed buffers are cached for reuse. Requires CUDA.
+    static void* MallocPinned(size_t byte_size);
+    /// Frees memory allocated with MallocPinned.
+    static void FreePinned(void* ptr);
+    /// Returns true if \p ptr points into memory allocated with MallocPinned.
+    static bool IsPinned(const void* ptr);
+
+    /// Until EndDeferredFree(), Free() of CUDA memory on the calling thread
+    /// only records the memory instead of freeing it. Used while capturing a
+    /// CUDA graph, whose work may still use the memory, see CUDAGraph.
+    static void BeginDeferredFree();
+    /// Frees the memory recorded since BeginDeferredFree().
+    static void EndDeferredFree();
+
 protected:
     static std::shared_ptr<DeviceMemoryManager> GetDeviceMemoryManager(
             const Device& device);
@@ -76,6 +92,22 @@ public:
     virtual ~DeviceMemoryManager() {}
 };
 
+/// Placement of the pages of large CPU allocations on NUMA systems.
+enum class CPUMemoryPlacement {
+    /// The OS places each page on the node of the thread that first writes
+    /// to it. Tensors filled by a single thread end up on one node.
+    Default,
+    /// New allocations are first touched in parallel with the static OpenMP
+    /// partitioning of the CPU launchers, so that the part of a tensor that a
+    /// thread processes is on the node of that thread. This requires bound
+    /// threads, e.g. OMP_PROC_BIND=close.
+    ParallelFirstTouch,
+    /// The pages are interleaved across all NUMA nodes, which balances the
+    /// bandwidth independent of the threads. Linux only, other platforms use
+    /// Default.
+    Interleaved,
+};
+
 class CPUMemoryManager : public DeviceMemoryManager {
 public:
     CPUMemoryManager();
@@ -86,6 +118,42 @@ public:
                 const void* src_ptr,
                 const Device& src_device,
                 size_t num_bytes) override;
+
+public:
+    /// Sets the placement of new CPU allocations of at least \p min_byte_size
+    /// bytes. Smaller allocations share pages and are not placed. Applies to
+    /// the cached CPU memory manager as well.
+    static void SetPlacement(CPUMemoryPlacement placement,
+                             size_t min_byte_size = size_t(4) << 20);
+
+    static CPUMemoryPlacement GetPlacement();
+
+    /// Places the pages of the new allocation [ptr, ptr + byte_size) according
+    /// to GetPlacement(). The content of the memory is undefined afterwards.
+    static void PlacePages(void* ptr, size_t byte_size);
+};
+
+/// Caching allocator for CPU memory.
+///
+/// Freed blocks are kept in per-thread caches and a shared pool, grouped by
+/// size class, and reused by following allocations. Blocks larger than 256 MiB
+/// are not cached, and at most 1 GiB is cached in total; freed blocks beyond
+/// that are returned to the system. Used for CPU tensors only if Open3D is
+/// built with BUILD_CACHED_CPU_MANAGER=ON.
+class CPUCachedMemoryManager : public DeviceMemoryManager {
+public:
+    CPUCachedMemoryManager();
+    void* Malloc(size_t byte_size, const Device& device) override;
+    void Free(void* ptr, const Device& device) override;
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+public:
+    /// Frees all cached CPU memory blocks.
+    static void ReleaseCache();
 };
 
 #ifdef BUILD_CUDA_MODULE
@@ -107,6 +175,13 @@ protected:
     bool IsCUDAPointer(const void* ptr);
 };
 
+/// Caching allocator for CUDA memory.
+///
+/// Freed blocks are kept per device for reuse. Blocks are split for smaller
+/// requests and merged with free neighbours when freed. If an allocation fails
+/// or would exceed the device's memory limit, the cached memory of the device
+/// is released and the allocation is retried. Statistics are reported through
+/// MemoryManagerStatistic::GetCacheStatistics().
 class CUDACachedMemoryManager : public DeviceMemoryManager {
 public:
     CUDACachedMemoryManager();
@@ -119,11 +194,64 @@ public:
                 size_t num_bytes) override;
 
 public:
+    /// Frees the cached memory of all devices.
     static void ReleaseCache();
 
+    /// Frees the cached memory of \p device.
+    static void ReleaseCache(const Device& device);
+
+    /// Limits the memory that the cache reserves on \p device, in use or
+    /// cached, to \p byte_size bytes. Allocations beyond the limit fail after
+    /// releasing the cached memory. 0 removes the limit, which is the default.
+    static void SetMemoryLimit(const Device& device, size_t byte_size);
+
+    /// Returns the memory limit of \p device, or 0 if there is no limit.
+    static size_t GetMemoryLimit(const Device& device);
+
 protected:
     bool IsCUDAPointer(const void* ptr);
 };
+
+/// Allocates page-locked host memory with cudaHostAlloc. The memory is on the
+/// CPU device, and freed blocks are cached for reuse.
+class CUDAPinnedMemoryManager : public DeviceMemoryManager {
+public:
+    CUDAPinnedMemoryManager();
+    void* Malloc(size_t byte_size, const Device& device) override;
+    void Free(void* ptr, const Device& device) override;
+    void Memcpy(void* dst_ptr,
+                const Device& dst_device,
+                const void* src_ptr,
+                const Device& src_device,
+                size_t num_bytes) override;
+
+public:
+    /// Returns true if \p ptr points into a pinned block.
+    static bool IsPinnedPointer(const void* ptr);
+
+    /// If \p ptr points into a pinned block, marks the block as used by the
+    /// current CUDA stream. The block is not reused after being freed until
+    /// the work enqueued to the stream so far has completed.
+    static void RecordCurrentStream(const void* ptr);
+
+    /// Copies \p num_bytes from host memory to the current CUDA device on the
+    /// current stream. Large copies from pageable memory are split into
+    /// chunks staged through two pinned buffers, so that filling one buffer
+    /// overlaps with the DMA transfer from the other. Returns once
+    /// \p host_ptr may be modified or freed.
+    static void MemcpyHostToDevice(void* dst_ptr,
+                                   const void* host_ptr,
+                                   size_t num_bytes);
+
+    /// Copies \p num_bytes from the current CUDA device to host memory on the
+    /// current stream, staging large copies to pageable memory like
+    /// MemcpyHostToDevice. Returns once the data is in \p host_ptr.
+    static void MemcpyDeviceToHost(void* host_ptr,
+                                   const void* src_ptr,
+                                   size_t num_bytes);
+
+    static void ReleaseCache();
+};
 #endif
 
 }  // namespace core
@@ -24,13 +24,34 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <atomic>
+#include <cstdint>
 #include <cstdlib>
 
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 #include "open3d/core/MemoryManager.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace core {
 
+static std::atomic<CPUMemoryPlacement> g_placement(CPUMemoryPlacement::Default);
+static std::atomic<size_t> g_placement_min_byte_size(size_t(4) << 20);
+
+static size_t GetPageSize() {
+#ifdef __linux__
+    static const size_t page_size = size_t(sysconf(_SC_PAGESIZE));
+    return page_size;
+#else
+    return 4096;
+#endif
+}
+
 CPUMemoryManager::CPUMemoryManager() {}
 
 void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
@@ -39,6 +60,7 @@ void* CPUMemoryManager::Malloc(size_t byte_size, const Device& device) {
     if (byte_size != 0 && !ptr) {
         utility::LogError("CPU malloc failed");
     }
+    PlacePages(ptr, byte_size);
     return ptr;
 }
 
@@ -56,5 +78,58 @@ void CPUMemoryManager::Memcpy(void* dst_ptr,
     std::memcpy(dst_ptr, src_ptr, num_bytes);
 }
 
+void CPUMemoryManager::SetPlacement(CPUMemoryPlacement placement,
+                                    size_t min_byte_size) {
+    g_placement_min_byte_size.store(min_byte_size);
+    g_placement.store(placement);
+}
+
+CPUMemoryPlacement CPUMemoryManager::GetPlacement() {
+    return g_placement.load();
+}
+
+void CPUMemoryManager::PlacePages(void* ptr, size_t byte_size) {
+    const CPUMemoryPlacement placement = g_placement.load();
+    if (ptr == nullptr || placement == CPUMemoryPlacement::Default ||
+        byte_size < g_placement_min_byte_size.load()) {
+        return;
+    }
+    // Only the pages that are completely inside the allocation are placed,
+    // since the others may be shared with other allocations.
+    const size_t page_size = GetPageSize();
+    const uintptr_t begin =
+            (reinterpret_cast<uintptr_t>(ptr) + page_size - 1) / page_size *
+            page_size;
+    const uintptr_t end =
+            (reinterpret_cast<uintptr_t>(ptr) + byte_size) / page_size *
+            page_size;
+    if (begin >= end) {
+        return;
+    }
+
+    if (placement == CPUMemoryPlacement::Interleaved) {
+#ifdef __linux__
+        // The kernel restricts the mask to the nodes with memory that the
+        // process may use.
+        const unsigned long node_mask = ~0UL;
+        if (syscall(SYS_mbind, reinterpret_cast<void*>(begin), end - begin,
+                    MPOL_INTERLEAVE, &node_mask, sizeof(node_mask) * 8,
+                    0) != 0) {
+            utility::LogDebug("mbind failed, the pages are not interleaved.");
+        }
+#endif
+        return;
+    }
+
+    // Write the first byte of each page with the same static partitioning as
+    // the CPU launchers.
+    char* const pages = reinterpret_cast<char*>(begin);
+    const int64_t num_pages = int64_t((end - begin) / page_size);
+#pragma omp parallel for schedule(static) num_threads(utility::GetNumThreads())
+    for (int64_t i = 0; i < num_pages; ++i) {
+        pages[i * page_size] = 0;
+    }
+}
+
 }  // namespace core
 }  // namespace open3d
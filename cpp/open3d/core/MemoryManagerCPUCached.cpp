@@ -0,0 +1,328 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/MemoryManagerStatistic.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+// Every block starts with a header that records its size class, so that Free
+// does not need a global pointer lookup. The header size keeps the alignment
+// guaranteed by std::malloc for the returned pointer.
+struct CPUBlockHeader {
+    int64_t size_class_;
+    int64_t block_size_;
+};
+static constexpr size_t kHeaderSize = 64;
+static_assert(sizeof(CPUBlockHeader) <= kHeaderSize, "Header is too large.");
+
+// Blocks are grouped into size classes with 4 classes per power of two, i.e.
+// at most 25% of a block is wasted. Class 0 holds blocks up to 64 bytes.
+// Requests larger than 2^kMaxCachedSizeLog2 bytes are not cached.
+static constexpr int kMinSizeLog2 = 6;
+static constexpr int kMaxCachedSizeLog2 = 28;
+static constexpr int kNumSizeClasses =
+        1 + (kMaxCachedSizeLog2 - kMinSizeLog2) * 4;
+
+// Limits of the per-thread caches. Blocks exceeding the limits are returned to
+// the shared pool.
+static constexpr size_t kMaxThreadCacheBytes = 32 << 20;
+static constexpr size_t kMaxThreadCacheBlocksPerClass = 8;
+
+// Limit of all cached bytes, in the thread caches and the shared pool. Freed
+// blocks exceeding the limit are returned to the system.
+static constexpr int64_t kMaxCachedBytes = int64_t(1) << 30;
+
+/// Returns the size class of \p byte_size, or -1 if it is not cached.
+static int64_t GetSizeClass(size_t byte_size) {
+    if (byte_size <= (size_t(1) << kMinSizeLog2)) {
+        return 0;
+    }
+    if (byte_size > (size_t(1) << kMaxCachedSizeLog2)) {
+        return -1;
+    }
+    // 2^k <= s < 2^(k+1), and the classes of this range are 2^(k-2) apart.
+    size_t s = byte_size - 1;
+    int64_t k = kMinSizeLog2;
+    while ((s >> (k + 1)) != 0) {
+        ++k;
+    }
+    int64_t sub_class = (s >> (k - 2)) & 3;
+    return 1 + (k - kMinSizeLog2) * 4 + sub_class;
+}
+
+/// Returns the block size of \p size_class.
+static size_t GetSizeClassBlockSize(int64_t size_class) {
+    if (size_class == 0) {
+        return size_t(1) << kMinSizeLog2;
+    }
+    int64_t k = (size_class - 1) / 4 + kMinSizeLog2;
+    int64_t sub_class = (size_class - 1) % 4;
+    return (5 + sub_class) * (size_t(1) << (k - 2));
+}
+
+class CPUCacher;
+
+// Per-thread cache, so that allocations of temporaries in OpenMP regions do not
+// contend for the shared pool. Its mutex is only contended by ReleaseCache.
+struct CPUThreadCache {
+    CPUThreadCache();
+    ~CPUThreadCache();
+
+    std::mutex mutex_;
+    std::vector<std::vector<CPUBlockHeader*>> blocks_;
+    size_t cached_byte_size_ = 0;
+};
+
+// Singleton cacher.
+// Freed blocks are kept in the calling thread's cache or in the shared pool,
+// and reused by following Malloc calls of the same size class. To clear the
+// cache, use CPUCachedMemoryManager::ReleaseCache().
+class CPUCacher {
+public:
+    static CPUCacher& GetInstance() {
+        // Intentionally leaked, since thread caches may return their blocks
+        // after static objects have been destroyed.
+        static CPUCacher* instance = new CPUCacher();
+        return *instance;
+    }
+
+    void* Malloc(size_t byte_size) {
+        if (byte_size == 0) return nullptr;
+
+        const int64_t size_class = GetSizeClass(byte_size);
+        if (size_class < 0) {
+            return AllocateBlock(size_class, byte_size);
+        }
+
+        CPUThreadCache* thread_cache = GetThreadCache();
+        if (thread_cache != nullptr) {
+            std::lock_guard<std::mutex> lock(thread_cache->mutex_);
+            auto& blocks = thread_cache->blocks_[size_class];
+            if (!blocks.empty()) {
+                CPUBlockHeader* header = blocks.back();
+                blocks.pop_back();
+                thread_cache->cached_byte_size_ -= header->block_size_;
+                OnHit(header);
+                return GetDataPtr(header);
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto& blocks = pool_[size_class];
+            if (!blocks.empty()) {
+                CPUBlockHeader* header = blocks.back();
+                blocks.pop_back();
+                OnHit(header);
+                return GetDataPtr(header);
+            }
+        }
+        count_miss_++;
+        return AllocateBlock(size_class, GetSizeClassBlockSize(size_class));
+    }
+
+    void Free(void* ptr) {
+        if (ptr == nullptr) return;
+
+        CPUBlockHeader* header = reinterpret_cast<CPUBlockHeader*>(
+                static_cast<char*>(ptr) - kHeaderSize);
+        const int64_t size_class = header->size_class_;
+        if (size_class < 0) {
+            std::free(header);
+            return;
+        }
+        if (cached_byte_size_.fetch_add(header->block_size_) +
+                    header->block_size_ >
+            kMaxCachedBytes) {
+            cached_byte_size_ -= header->block_size_;
+            std::free(header);
+            return;
+        }
+
+        CPUThreadCache* thread_cache = GetThreadCache();
+        if (thread_cache != nullptr) {
+            std::lock_guard<std::mutex> lock(thread_cache->mutex_);
+            auto& blocks = thread_cache->blocks_[size_class];
+            if (blocks.size() < kMaxThreadCacheBlocksPerClass &&
+                thread_cache->cached_byte_size_ + header->block_size_ <=
+                        kMaxThreadCacheBytes) {
+                blocks.push_back(header);
+                thread_cache->cached_byte_size_ += header->block_size_;
+                return;
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        pool_[size_class].push_back(header);
+    }
+
+    void ReleaseCache() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (CPUThreadCache* thread_cache : thread_caches_) {
+            std::lock_guard<std::mutex> thread_lock(thread_cache->mutex_);
+            for (auto& blocks : thread_cache->blocks_) {
+                FreeBlocks(blocks);
+            }
+            thread_cache->cached_byte_size_ = 0;
+        }
+        for (auto& blocks : pool_) {
+            FreeBlocks(blocks);
+        }
+    }
+
+    MemoryManagerStatistic::CacheStatistics GetStatistics() const {
+        MemoryManagerStatistic::CacheStatistics statistics;
+        statistics.count_hit_ = count_hit_;
+        statistics.count_miss_ = count_miss_;
+        statistics.cached_byte_size_ = cached_byte_size_;
+        return statistics;
+    }
+
+    void RegisterThreadCache(CPUThreadCache* thread_cache) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        thread_caches_.insert(thread_cache);
+    }
+
+    /// Moves the blocks of an exiting thread to the shared pool.
+    void UnregisterThreadCache(CPUThreadCache* thread_cache) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::lock_guard<std::mutex> thread_lock(thread_cache->mutex_);
+        for (int64_t size_class = 0; size_class < kNumSizeClasses;
+             ++size_class) {
+            auto& blocks = thread_cache->blocks_[size_class];
+            pool_[size_class].insert(pool_[size_class].end(), blocks.begin(),
+                                     blocks.end());
+            blocks.clear();
+        }
+        thread_cache->cached_byte_size_ = 0;
+        thread_caches_.erase(thread_cache);
+    }
+
+private:
+    CPUCacher() : pool_(kNumSizeClasses) {
+        MemoryManagerStatistic::GetInstance().RegisterCache(
+                Device("CPU:0"), [this]() { return GetStatistics(); });
+    }
+
+    /// Returns the calling thread's cache, or nullptr if the thread is exiting
+    /// and its cache has already been destroyed.
+    static CPUThreadCache* GetThreadCache() {
+        static thread_local bool destroyed = false;
+        if (destroyed) {
+            return nullptr;
+        }
+        struct Guard {
+            ~Guard() { destroyed = true; }
+            CPUThreadCache thread_cache_;
+        };
+        static thread_local Guard guard;
+        return &guard.thread_cache_;
+    }
+
+    static void* GetDataPtr(CPUBlockHeader* header) {
+        return reinterpret_cast<char*>(header) + kHeaderSize;
+    }
+
+    void OnHit(const CPUBlockHeader* header) {
+        count_hit_++;
+        cached_byte_size_ -= header->block_size_;
+    }
+
+    void* AllocateBlock(int64_t size_class, size_t block_size) {
+        void* raw_ptr = std::malloc(kHeaderSize + block_size);
+        if (raw_ptr == nullptr) {
+            // Return cached memory to the system and retry.
+            ReleaseCache();
+            raw_ptr = std::malloc(kHeaderSize + block_size);
+            if (raw_ptr == nullptr) {
+                utility::LogError("CPU malloc failed");
+            }
+        }
+        CPUBlockHeader* header = static_cast<CPUBlockHeader*>(raw_ptr);
+        header->size_class_ = size_class;
+        header->block_size_ = static_cast<int64_t>(block_size);
+        void* ptr = GetDataPtr(header);
+        CPUMemoryManager::PlacePages(ptr, block_size);
+        return ptr;
+    }
+
+    void FreeBlocks(std::vector<CPUBlockHeader*>& blocks) {
+        for (CPUBlockHeader* header : blocks) {
+            cached_byte_size_ -= header->block_size_;
+            std::free(header);
+        }
+        blocks.clear();
+    }
+
+    std::mutex mutex_;
+    std::vector<std::vector<CPUBlockHeader*>> pool_;
+    std::unordered_set<CPUThreadCache*> thread_caches_;
+
+    std::atomic<int64_t> count_hit_{0};
+    std::atomic<int64_t> count_miss_{0};
+    std::atomic<int64_t> cached_byte_size_{0};
+};
+
+CPUThreadCache::CPUThreadCache() : blocks_(kNumSizeClasses) {
+    CPUCacher::GetInstance().RegisterThreadCache(this);
+}
+
+CPUThreadCache::~CPUThreadCache() {
+    CPUCacher::GetInstance().UnregisterThreadCache(this);
+}
+
+CPUCachedMemoryManager::CPUCachedMemoryManager() {}
+
+void* CPUCachedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    return CPUCacher::GetInstance().Malloc(byte_size);
+}
+
+void CPUCachedMemoryManager::Free(void* ptr, const Device& device) {
+    CPUCacher::GetInstance().Free(ptr);
+}
+
+void CPUCachedMemoryManager::Memcpy(void* dst_ptr,
+                                    const Device& dst_device,
+                                    const void* src_ptr,
+                                    const Device& src_device,
+                                    size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+void CPUCachedMemoryManager::ReleaseCache() {
+    CPUCacher::GetInstance().ReleaseCache();
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -27,13 +27,17 @@
 #include <cuda.h>
 #include <cuda_runtime.h>
 
+#include <algorithm>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "open3d/core/CUDAState.cuh"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/MemoryManager.h"
+#include "open3d/core/MemoryManagerStatistic.h"
 
 namespace open3d {
 namespace core {
@@ -50,10 +54,12 @@ struct Block {
     size_t size_;  // block size in bytes
     void* ptr_;    // memory address
 
+    // Neighbouring blocks of the same segment, i.e. of the same cudaMalloc.
     BlockPtr prev_;
     BlockPtr next_;
 
     bool in_use_;
+    bool is_small_;  // Whether the block belongs to the small block pool.
 
     Block(int device,
           size_t size,
@@ -65,16 +71,12 @@ struct Block {
           ptr_(ptr),
           prev_(prev),
           next_(next),
-          in_use_(false) {}
+          in_use_(false),
+          is_small_(false) {}
 };
 
 struct BlockComparator {
     bool operator()(const BlockPtr& a, const BlockPtr& b) const {
-        // Not on the same device: treat as smaller, will be filtered in
-        // lower_bound operation.
-        if (a->device_ != b->device_) {
-            return true;
-        }
         if (a->size_ != b->size_) {
             return a->size_ < b->size_;
         }
@@ -82,12 +84,33 @@ struct BlockComparator {
     }
 };
 
+// All sizes are rounded up to multiples of the minimum block size.
+static constexpr size_t kMinBlockSize = 512;
+// Largest "small" allocation, 1 MiB.
+static constexpr size_t kSmallSize = 1048576;
+// Small allocations are carved out of 2 MiB segments.
+static constexpr size_t kSmallBuffer = 2097152;
+// Allocations up to 10 MiB are carved out of 20 MiB segments.
+static constexpr size_t kMinLargeAlloc = 10485760;
+static constexpr size_t kLargeBuffer = 20971520;
+// Larger segments are rounded up to multiples of 2 MiB.
+static constexpr size_t kRoundLarge = 2097152;
+
+static size_t RoundUp(size_t byte_size, size_t alignment) {
+    return ((byte_size + alignment - 1) / alignment) * alignment;
+}
+
 // Singleton cacher.
 // To improve performance, the cacher will not release cuda memory when Free is
 // called. Instead, it will cache these memory in trees' nodes, and reuse them
 // in following Malloc calls via size queries. Each node can be split to smaller
 // nodes upon malloc requests, and merged when they are all freed.
 // To clear the cache, use cuda::ReleaseCache().
+//
+// Small and large allocations come from separate segments, so that long-lived
+// small tensors do not pin down large segments. If an allocation fails or would
+// exceed the device's memory limit, the cached segments of the device are
+// released and the allocation is retried.
 class CUDACacher {
 public:
     static std::shared_ptr<CUDACacher> GetInstance() {
@@ -100,20 +123,28 @@ public:
 public:
     typedef std::set<BlockPtr, BlockComparator> BlockPool;
 
-    inline std::shared_ptr<BlockPool>& get_pool(size_t byte_size) {
-        // largest "small" allocation is 1 MiB (1024 * 1024)
-        constexpr size_t kSmallSize = 1048576;
-        return byte_size <= kSmallSize ? small_block_pool_ : large_block_pool_;
-    }
+    /// Blocks and counters of one device.
+    struct DeviceCache {
+        BlockPool small_block_pool_;
+        BlockPool large_block_pool_;
 
-    inline size_t align_bytes(size_t byte_size, size_t alignment = 8) {
-        return ((byte_size + alignment - 1) / alignment) * alignment;
-    }
+        /// Bytes allocated with cudaMalloc, in use or cached.
+        size_t reserved_byte_size_ = 0;
+        /// Bytes of the free blocks in the pools.
+        size_t cached_byte_size_ = 0;
+        /// Upper bound of reserved_byte_size_, or 0 for no limit.
+        size_t memory_limit_ = 0;
 
-    CUDACacher() {
-        small_block_pool_ = std::make_shared<BlockPool>();
-        large_block_pool_ = std::make_shared<BlockPool>();
-    }
+        int64_t count_hit_ = 0;
+        int64_t count_miss_ = 0;
+        int64_t count_flush_ = 0;
+
+        BlockPool& GetPool(bool is_small) {
+            return is_small ? small_block_pool_ : large_block_pool_;
+        }
+    };
+
+    CUDACacher() {}
 
     ~CUDACacher() {
         if (!allocated_blocks_.empty()) {
@@ -124,144 +155,208 @@ public:
     }
 
     void* Malloc(size_t byte_size, const Device& device) {
-        auto find_free_block = [&](BlockPtr query_block) -> BlockPtr {
-            auto pool = get_pool(query_block->size_);
-            auto it = pool->lower_bound(query_block);
-            if (it != pool->end()) {
-                BlockPtr block = *it;
-                pool->erase(it);
-                return block;
-            }
-            return nullptr;
-        };
+        RegisterStatistics(device);
+        std::lock_guard<std::mutex> lock(mutex_);
+        DeviceCache& cache = device_caches_[device.GetID()];
 
-        void* ptr;
-        size_t alloc_size = align_bytes(byte_size);
+        const size_t alloc_size = RoundUp(byte_size, kMinBlockSize);
+        const bool is_small = alloc_size <= kSmallSize;
+        BlockPool& pool = cache.GetPool(is_small);
+
+        BlockPtr block = nullptr;
         Block query_block = Block(device.GetID(), alloc_size);
-        BlockPtr found_block = find_free_block(&query_block);
-
-        if (found_block == nullptr) {
-            // Allocate a new block and insert it to the allocated pool
-            OPEN3D_CUDA_CHECK(cudaMalloc(&ptr, alloc_size));
-            BlockPtr new_block = new Block(device.GetID(), alloc_size, ptr);
-            new_block->in_use_ = true;
-            allocated_blocks_.insert({ptr, new_block});
+        auto it = pool.lower_bound(&query_block);
+        if (it != pool.end()) {
+            block = *it;
+            pool.erase(it);
+            cache.cached_byte_size_ -= block->size_;
+            cache.count_hit_++;
         } else {
-            ptr = found_block->ptr_;
-
-            size_t remain_size = found_block->size_ - alloc_size;
-            if (remain_size > 0) {
-                // Split block
-                // found_block <-> remain_block <-> found_block->next_
-                BlockPtr next_block = found_block->next_;
-                BlockPtr remain_block =
-                        new Block(device.GetID(), remain_size,
-                                  static_cast<char*>(ptr) + alloc_size,
-                                  found_block, next_block);
-                found_block->next_ = remain_block;
-                if (next_block) {
-                    next_block->prev_ = remain_block;
-                }
+            cache.count_miss_++;
+            size_t segment_size = GetSegmentSize(alloc_size);
+            void* ptr =
+                    AllocateSegment(cache, device, alloc_size, segment_size);
+            block = new Block(device.GetID(), segment_size, ptr);
+            block->is_small_ = is_small;
+        }
 
-                // Place the remain block to cache pool
-                get_pool(remain_size)->emplace(remain_block);
+        // Split the block, unless the remainder would be a sliver of a large
+        // segment that only small allocations could use.
+        const size_t remain_size = block->size_ - alloc_size;
+        if (is_small ? remain_size >= kMinBlockSize
+                     : remain_size > kSmallSize) {
+            // block <-> remain_block <-> block->next_
+            BlockPtr next_block = block->next_;
+            BlockPtr remain_block =
+                    new Block(device.GetID(), remain_size,
+                              static_cast<char*>(block->ptr_) + alloc_size,
+                              block, next_block);
+            remain_block->is_small_ = is_small;
+            block->next_ = remain_block;
+            if (next_block) {
+                next_block->prev_ = remain_block;
             }
+            block->size_ = alloc_size;
 
-            found_block->size_ = alloc_size;
-            found_block->in_use_ = true;
-            allocated_blocks_.insert({ptr, found_block});
+            pool.emplace(remain_block);
+            cache.cached_byte_size_ += remain_size;
         }
 
-        return ptr;
+        block->in_use_ = true;
+        allocated_blocks_.insert({block->ptr_, block});
+        return block->ptr_;
     }
 
     void Free(void* ptr, const Device& device) {
-        auto release_block = [&](BlockPtr block) {
-            auto block_pool = get_pool(block->size_);
-            auto it = block_pool->find(block);
-            if (it == block_pool->end()) {
-                // Should never reach here
-                utility::LogError(
-                        "[CUDACacher] Linked list node {} not found in pool.",
-                        fmt::ptr(block));
-            }
-            block_pool->erase(it);
-            delete block;
-        };
-
+        std::lock_guard<std::mutex> lock(mutex_);
         auto it = allocated_blocks_.find(ptr);
-
         if (it == allocated_blocks_.end()) {
             // Should never reach here
             utility::LogError("[CUDACacher] Block should have been recorded.");
-        } else {
-            // Release memory and check if merge is required
-            BlockPtr block = it->second;
-            allocated_blocks_.erase(it);
-
-            // Merge free blocks towards 'next' direction
-            BlockPtr block_it = block;
-            while (block_it != nullptr && block_it->next_ != nullptr) {
-                BlockPtr next_block = block_it->next_;
-                if (next_block->prev_ != block_it) {
-                    // Should never reach here
-                    utility::LogError(
-                            "[CUDACacher] Linked list nodes mismatch in "
-                            "forward-direction merge.");
-                }
+        }
+        BlockPtr block = it->second;
+        allocated_blocks_.erase(it);
+
+        DeviceCache& cache = device_caches_[block->device_];
+        BlockPool& pool = cache.GetPool(block->is_small_);
+        block->in_use_ = false;
+        cache.cached_byte_size_ += block->size_;
+
+        // Free neighbours have been merged when they were freed, so at most
+        // one merge per direction is needed.
+        BlockPtr next_block = block->next_;
+        if (next_block != nullptr && !next_block->in_use_) {
+            RemoveFromPool(pool, next_block);
+            block->size_ += next_block->size_;
+            block->next_ = next_block->next_;
+            if (block->next_) {
+                block->next_->prev_ = block;
+            }
+            delete next_block;
+        }
+        BlockPtr prev_block = block->prev_;
+        if (prev_block != nullptr && !prev_block->in_use_) {
+            RemoveFromPool(pool, prev_block);
+            prev_block->size_ += block->size_;
+            prev_block->next_ = block->next_;
+            if (prev_block->next_) {
+                prev_block->next_->prev_ = prev_block;
+            }
+            delete block;
+            block = prev_block;
+        }
+        pool.emplace(block);
+    }
 
-                if (next_block->in_use_) {
-                    break;
-                }
+    void ReleaseCache() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& kv : device_caches_) {
+            ReleaseDeviceCache(kv.first, kv.second);
+        }
+    }
 
-                // Merge
-                block_it->next_ = next_block->next_;
-                if (block_it->next_) {
-                    block_it->next_->prev_ = block_it;
-                }
-                block_it->size_ += next_block->size_;
-                release_block(next_block);
+    void ReleaseCache(const Device& device) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ReleaseDeviceCache(device.GetID(), device_caches_[device.GetID()]);
+    }
 
-                block_it = block_it->next_;
-            }
+    void SetMemoryLimit(const Device& device, size_t byte_size) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        DeviceCache& cache = device_caches_[device.GetID()];
+        cache.memory_limit_ = byte_size;
+        if (byte_size > 0 && cache.reserved_byte_size_ > byte_size) {
+            ReleaseDeviceCache(device.GetID(), cache);
+        }
+    }
 
-            // Merge free blocks towards 'prev' direction
-            block_it = block;
-            while (block_it != nullptr && block_it->prev_ != nullptr) {
-                BlockPtr prev_block = block_it->prev_;
-                if (prev_block->next_ != block_it) {
-                    // Should never reach here.
-                    utility::LogError(
-                            "[CUDACacher]: linked list nodes mismatch in "
-                            "backward-direction merge.");
-                }
+    size_t GetMemoryLimit(const Device& device) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return device_caches_[device.GetID()].memory_limit_;
+    }
 
-                if (prev_block->in_use_) {
-                    break;
-                }
+    MemoryManagerStatistic::CacheStatistics GetStatistics(int device_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const DeviceCache& cache = device_caches_[device_id];
+        MemoryManagerStatistic::CacheStatistics statistics;
+        statistics.count_hit_ = cache.count_hit_;
+        statistics.count_miss_ = cache.count_miss_;
+        statistics.cached_byte_size_ = cache.cached_byte_size_;
+        statistics.reserved_byte_size_ = cache.reserved_byte_size_;
+        statistics.count_flush_ = cache.count_flush_;
+        for (const BlockPool* pool :
+             {&cache.small_block_pool_, &cache.large_block_pool_}) {
+            if (!pool->empty()) {
+                statistics.largest_cached_block_size_ =
+                        std::max(statistics.largest_cached_block_size_,
+                                 (*pool->rbegin())->size_);
+            }
+        }
+        return statistics;
+    }
 
-                // Merge
-                block_it->prev_ = prev_block->prev_;
-                if (block_it->prev_) {
-                    block_it->prev_->next_ = block_it;
-                }
-                block_it->size_ += prev_block->size_;
-                block_it->ptr_ = prev_block->ptr_;
-                release_block(prev_block);
+private:
+    static size_t GetSegmentSize(size_t alloc_size) {
+        if (alloc_size <= kSmallSize) {
+            return kSmallBuffer;
+        } else if (alloc_size < kMinLargeAlloc) {
+            return kLargeBuffer;
+        } else {
+            return RoundUp(alloc_size, kRoundLarge);
+        }
+    }
 
-                block_it = block_it->prev_;
+    /// Allocates a new segment of \p segment_size bytes. If this fails or
+    /// exceeds the memory limit, the cache of the device is released and the
+    /// allocation retried, falling back to a segment of \p alloc_size bytes.
+    void* AllocateSegment(DeviceCache& cache,
+                          const Device& device,
+                          size_t alloc_size,
+                          size_t& segment_size) {
+        auto try_malloc = [&](size_t byte_size) -> void* {
+            if (cache.memory_limit_ > 0 &&
+                cache.reserved_byte_size_ + byte_size > cache.memory_limit_) {
+                return nullptr;
+            }
+            void* ptr = nullptr;
+            cudaError_t err = cudaMalloc(&ptr, byte_size);
+            if (err == cudaErrorMemoryAllocation) {
+                // Clear the sticky error state before retrying.
+                cudaGetLastError();
+                return nullptr;
             }
+            OPEN3D_CUDA_CHECK(err);
+            return ptr;
+        };
 
-            block->in_use_ = false;
-            get_pool(block->size_)->emplace(block);
+        void* ptr = try_malloc(segment_size);
+        if (ptr == nullptr) {
+            cache.count_flush_++;
+            ReleaseDeviceCache(device.GetID(), cache);
+            ptr = try_malloc(segment_size);
+        }
+        if (ptr == nullptr && segment_size > alloc_size) {
+            segment_size = alloc_size;
+            ptr = try_malloc(segment_size);
+        }
+        if (ptr == nullptr) {
+            utility::LogError(
+                    "[CUDACacher] Out of memory on {} allocating {} bytes: {} "
+                    "bytes reserved, {} bytes in use, memory limit {} bytes.",
+                    device.ToString(), alloc_size, cache.reserved_byte_size_,
+                    cache.reserved_byte_size_ - cache.cached_byte_size_,
+                    cache.memory_limit_);
         }
+        cache.reserved_byte_size_ += segment_size;
+        return ptr;
     }
 
-    void ReleaseCache() {
+    /// Frees the segments of the device that are entirely cached.
+    void ReleaseDeviceCache(int device_id, DeviceCache& cache) {
+        CUDADeviceSwitcher switcher(device_id);
         size_t total_bytes = 0;
         // Reference:
         // https://stackoverflow.com/questions/2874441/deleting-elements-from-stdset-while-iterating
-        auto release_pool = [&](std::set<BlockPtr, BlockComparator>& pool) {
+        auto release_pool = [&](BlockPool& pool) {
             auto it = pool.begin();
             auto end = pool.end();
             while (it != end) {
@@ -277,16 +372,52 @@ public:
             }
         };
 
-        release_pool(*small_block_pool_);
-        release_pool(*large_block_pool_);
+        release_pool(cache.small_block_pool_);
+        release_pool(cache.large_block_pool_);
+        cache.reserved_byte_size_ -= total_bytes;
+        cache.cached_byte_size_ -= total_bytes;
 
-        utility::LogDebug("[CUDACacher] {} bytes released.", total_bytes);
+        utility::LogDebug("[CUDACacher] {} bytes released on CUDA:{}.",
+                          total_bytes, device_id);
     }
 
-private:
+    static void RemoveFromPool(BlockPool& pool, BlockPtr block) {
+        auto it = pool.find(block);
+        if (it == pool.end()) {
+            // Should never reach here
+            utility::LogError(
+                    "[CUDACacher] Linked list node {} not found in pool.",
+                    fmt::ptr(block));
+        }
+        pool.erase(it);
+    }
+
+    /// Registers the cache statistics of \p device once. This does not hold
+    /// mutex_, since MemoryManagerStatistic calls GetStatistics() under its
+    /// own lock.
+    void RegisterStatistics(const Device& device) {
+        std::lock_guard<std::mutex> lock(register_mutex_);
+        if (registered_devices_.insert(device.GetID()).second) {
+            // The statistics may be printed after the cacher is destroyed at
+            // program end.
+            std::weak_ptr<CUDACacher> weak_instance = instance_;
+            const int device_id = device.GetID();
+            MemoryManagerStatistic::GetInstance().RegisterCache(
+                    device, [weak_instance, device_id]() {
+                        if (auto instance = weak_instance.lock()) {
+                            return instance->GetStatistics(device_id);
+                        }
+                        return MemoryManagerStatistic::CacheStatistics();
+                    });
+        }
+    }
+
+    std::mutex mutex_;
     std::unordered_map<void*, BlockPtr> allocated_blocks_;
-    std::shared_ptr<BlockPool> small_block_pool_;
-    std::shared_ptr<BlockPool> large_block_pool_;
+    std::unordered_map<int, DeviceCache> device_caches_;
+
+    std::mutex register_mutex_;
+    std::unordered_set<int> registered_devices_;
 
     static std::shared_ptr<CUDACacher> instance_;
 };
@@ -320,6 +451,12 @@ void CUDACachedMemoryManager::Free(void* ptr, const Device& device) {
 
     if (device.GetType() == Device::DeviceType::CUDA) {
         if (ptr && IsCUDAPointer(ptr)) {
+            // The cached block may be handed out to another stream right
+            // away, so pending work on the current stream must finish first.
+            if (!CUDAStream::IsCurrentDefault()) {
+                OPEN3D_CUDA_CHECK(
+                        cudaStreamSynchronize(CUDAStream::GetCurrent()));
+            }
             std::shared_ptr<CUDACacher> instance = CUDACacher::GetInstance();
             instance->Free(ptr, device);
         } else {
@@ -343,16 +480,16 @@ void CUDACachedMemoryManager::Memcpy(void* dst_ptr,
         if (!IsCUDAPointer(dst_ptr)) {
             utility::LogError("dst_ptr is not a CUDA pointer.");
         }
-        OPEN3D_CUDA_CHECK(cudaMemcpy(dst_ptr, src_ptr, num_bytes,
-                                     cudaMemcpyHostToDevice));
+        CUDAPinnedMemoryManager::MemcpyHostToDevice(dst_ptr, src_ptr,
+                                                    num_bytes);
     } else if (dst_device.GetType() == Device::DeviceType::CPU &&
                src_device.GetType() == Device::DeviceType::CUDA) {
         CUDADeviceSwitcher switcher(src_device);
         if (!IsCUDAPointer(src_ptr)) {
             utility::LogError("src_ptr is not a CUDA pointer.");
         }
-        OPEN3D_CUDA_CHECK(cudaMemcpy(dst_ptr, src_ptr, num_bytes,
-                                     cudaMemcpyDeviceToHost));
+        CUDAPinnedMemoryManager::MemcpyDeviceToHost(dst_ptr, src_ptr,
+                                                    num_bytes);
     } else if (dst_device.GetType() == Device::DeviceType::CUDA &&
                src_device.GetType() == Device::DeviceType::CUDA) {
         CUDADeviceSwitcher switcher(dst_device);
@@ -366,13 +503,14 @@ void CUDACachedMemoryManager::Memcpy(void* dst_ptr,
 
         if (dst_device == src_device) {
             switcher.SwitchTo(src_device);
-            OPEN3D_CUDA_CHECK(cudaMemcpy(dst_ptr, src_ptr, num_bytes,
-                                         cudaMemcpyDeviceToDevice));
+            OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                              cudaMemcpyDeviceToDevice,
+                                              CUDAStream::GetCurrent()));
         } else if (CUDAState::GetInstance()->IsP2PEnabled(src_device.GetID(),
                                                           dst_device.GetID())) {
-            OPEN3D_CUDA_CHECK(cudaMemcpyPeer(dst_ptr, dst_device.GetID(),
-                                             src_ptr, src_device.GetID(),
-                                             num_bytes));
+            OPEN3D_CUDA_CHECK(cudaMemcpyPeerAsync(
+                    dst_ptr, dst_device.GetID(), src_ptr, src_device.GetID(),
+                    num_bytes, CUDAStream::GetCurrent()));
         } else {
             void* cpu_buf = MemoryManager::Malloc(num_bytes, Device("CPU:0"));
             switcher.SwitchTo(src_device);
@@ -402,5 +540,27 @@ void CUDACachedMemoryManager::ReleaseCache() {
     instance->ReleaseCache();
 }
 
+void CUDACachedMemoryManager::ReleaseCache(const Device& device) {
+    std::shared_ptr<CUDACacher> instance = CUDACacher::GetInstance();
+    instance->ReleaseCache(device);
+}
+
+void CUDACachedMemoryManager::SetMemoryLimit(const Device& device,
+                                             size_t byte_size) {
+    if (device.GetType() != Device::DeviceType::CUDA) {
+        utility::LogError(
+                "[CUDACachedMemoryManager] SetMemoryLimit: {} is not a CUDA "
+                "device.",
+                device.ToString());
+    }
+    std::shared_ptr<CUDACacher> instance = CUDACacher::GetInstance();
+    instance->SetMemoryLimit(device, byte_size);
+}
+
+size_t CUDACachedMemoryManager::GetMemoryLimit(const Device& device) {
+    std::shared_ptr<CUDACacher> instance = CUDACacher::GetInstance();
+    return instance->GetMemoryLimit(device);
+}
+
 }  // namespace core
 }  // namespace open3d
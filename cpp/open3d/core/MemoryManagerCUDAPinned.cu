@@ -0,0 +1,363 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "open3d/core/CUDAState.cuh"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/MemoryManager.h"
+
+namespace open3d {
+namespace core {
+
+struct PinnedBlock {
+    size_t size_;
+    bool in_use_;
+    // Event of the last copy from/to the block on each stream. The block can
+    // only be reused once all of them have completed.
+    std::map<cudaStream_t, cudaEvent_t> events_;
+};
+
+// Singleton cacher of page-locked host memory.
+// cudaHostAlloc and cudaFreeHost are expensive and synchronize the device, so
+// freed blocks are kept and reused by subsequent Malloc calls of a similar
+// size. To clear the cache, use cuda::ReleaseCache().
+class CUDAPinnedCacher {
+public:
+    static CUDAPinnedCacher& GetInstance() {
+        // Intentionally leaked: the CUDA driver may already be shut down when
+        // static objects are destroyed.
+        static CUDAPinnedCacher* instance = new CUDAPinnedCacher();
+        return *instance;
+    }
+
+    void* Malloc(size_t byte_size) {
+        if (byte_size == 0) return nullptr;
+        size_t alloc_size = AlignBytes(byte_size);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Reuse a cached block, but do not waste more than half of it.
+        for (auto it = free_blocks_.lower_bound(alloc_size);
+             it != free_blocks_.end() && it->first <= 2 * alloc_size; ++it) {
+            PinnedBlock& block = blocks_.at(static_cast<char*>(it->second));
+            if (QueryEvents(block)) {
+                void* ptr = it->second;
+                block.in_use_ = true;
+                free_blocks_.erase(it);
+                return ptr;
+            }
+        }
+
+        void* ptr = nullptr;
+        cudaError_t err =
+                cudaHostAlloc(&ptr, alloc_size, cudaHostAllocPortable);
+        if (err != cudaSuccess) {
+            // Release the cache and retry.
+            cudaGetLastError();
+            ReleaseCacheLocked();
+            OPEN3D_CUDA_CHECK(
+                    cudaHostAlloc(&ptr, alloc_size, cudaHostAllocPortable));
+        }
+        blocks_.emplace(static_cast<char*>(ptr),
+                        PinnedBlock{alloc_size, true, {}});
+        return ptr;
+    }
+
+    void Free(void* ptr) {
+        if (ptr == nullptr) return;
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = blocks_.find(static_cast<char*>(ptr));
+        if (it == blocks_.end() || !it->second.in_use_) {
+            utility::LogError(
+                    "[CUDAPinnedMemoryManager] Free: Invalid pointer.");
+        }
+        it->second.in_use_ = false;
+        QueryEvents(it->second);
+        free_blocks_.emplace(it->second.size_, ptr);
+    }
+
+    bool IsPinnedPointer(const void* ptr) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return FindBlock(ptr) != blocks_.end();
+    }
+
+    void RecordCurrentStream(const void* ptr) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = FindBlock(ptr);
+        if (it == blocks_.end()) {
+            return;
+        }
+        // Completed events of other streams are no longer needed, and the
+        // event of the current stream is re-recorded, so that a block that is
+        // copied repeatedly keeps at most one event per stream.
+        QueryEvents(it->second);
+        cudaStream_t stream = CUDAStream::GetCurrent();
+        auto event_it = it->second.events_.find(stream);
+        if (event_it == it->second.events_.end()) {
+            cudaEvent_t event;
+            OPEN3D_CUDA_CHECK(
+                    cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+            event_it = it->second.events_.emplace(stream, event).first;
+        }
+        OPEN3D_CUDA_CHECK(cudaEventRecord(event_it->second, stream));
+    }
+
+    void ReleaseCache() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ReleaseCacheLocked();
+    }
+
+private:
+    CUDAPinnedCacher() {}
+
+    static size_t AlignBytes(size_t byte_size, size_t alignment = 512) {
+        return ((byte_size + alignment - 1) / alignment) * alignment;
+    }
+
+    /// Returns the block that contains \p ptr.
+    std::map<char*, PinnedBlock>::iterator FindBlock(const void* ptr) {
+        const char* query = static_cast<const char*>(ptr);
+        auto it = blocks_.upper_bound(const_cast<char*>(query));
+        if (it == blocks_.begin()) {
+            return blocks_.end();
+        }
+        --it;
+        return query < it->first + it->second.size_ ? it : blocks_.end();
+    }
+
+    /// Returns true if all recorded events of \p block have completed.
+    /// Completed events are destroyed.
+    static bool QueryEvents(PinnedBlock& block) {
+        for (auto it = block.events_.begin(); it != block.events_.end();) {
+            cudaError_t err = cudaEventQuery(it->second);
+            if (err == cudaErrorNotReady) {
+                cudaGetLastError();
+                ++it;
+                continue;
+            }
+            OPEN3D_CUDA_CHECK(err);
+            OPEN3D_CUDA_CHECK(cudaEventDestroy(it->second));
+            it = block.events_.erase(it);
+        }
+        return block.events_.empty();
+    }
+
+    void ReleaseCacheLocked() {
+        for (auto& size_and_ptr : free_blocks_) {
+            auto it = blocks_.find(static_cast<char*>(size_and_ptr.second));
+            for (auto& stream_event : it->second.events_) {
+                OPEN3D_CUDA_CHECK(cudaEventSynchronize(stream_event.second));
+                OPEN3D_CUDA_CHECK(cudaEventDestroy(stream_event.second));
+            }
+            OPEN3D_CUDA_CHECK(cudaFreeHost(it->first));
+            blocks_.erase(it);
+        }
+        free_blocks_.clear();
+    }
+
+    std::mutex mutex_;
+    // All blocks, keyed by their starting address.
+    std::map<char*, PinnedBlock> blocks_;
+    // Blocks that are not in use, keyed by their size.
+    std::multimap<size_t, void*> free_blocks_;
+};
+
+// Copies from/to pageable host memory of at least this size are split into
+// chunks and staged through two pinned buffers.
+static constexpr size_t STAGED_MEMCPY_MIN_BYTES = 32 << 20;
+static constexpr size_t STAGED_MEMCPY_CHUNK_BYTES = 8 << 20;
+
+// Double-buffered pinned staging area for one chunked copy.
+class StagingBuffers {
+public:
+    StagingBuffers() {
+        for (int i = 0; i < 2; ++i) {
+            buffers_[i] = static_cast<char*>(
+                    CUDAPinnedCacher::GetInstance().Malloc(
+                            STAGED_MEMCPY_CHUNK_BYTES));
+            OPEN3D_CUDA_CHECK(cudaEventCreateWithFlags(
+                    &events_[i], cudaEventDisableTiming));
+        }
+    }
+
+    ~StagingBuffers() {
+        for (int i = 0; i < 2; ++i) {
+            // Copies from the buffers may still be in flight.
+            CUDAPinnedCacher::GetInstance().RecordCurrentStream(buffers_[i]);
+            CUDAPinnedCacher::GetInstance().Free(buffers_[i]);
+            cudaEventDestroy(events_[i]);
+        }
+    }
+
+    StagingBuffers(StagingBuffers const&) = delete;
+
+    void operator=(StagingBuffers const&) = delete;
+
+    char* GetBuffer(int i) const { return buffers_[i]; }
+
+    /// Records that all work enqueued to \p stream uses buffer \p i.
+    void Record(int i, cudaStream_t stream) {
+        OPEN3D_CUDA_CHECK(cudaEventRecord(events_[i], stream));
+    }
+
+    /// Blocks until the work recorded for buffer \p i has completed.
+    void Synchronize(int i) const {
+        OPEN3D_CUDA_CHECK(cudaEventSynchronize(events_[i]));
+    }
+
+private:
+    char* buffers_[2];
+    cudaEvent_t events_[2];
+};
+
+CUDAPinnedMemoryManager::CUDAPinnedMemoryManager() {}
+
+void* CUDAPinnedMemoryManager::Malloc(size_t byte_size, const Device& device) {
+    if (device.GetType() != Device::DeviceType::CPU) {
+        utility::LogError(
+                "[CUDAPinnedMemoryManager] Malloc: Pinned memory can only be "
+                "allocated on CPU, but {} is used.",
+                device.ToString());
+    }
+    return CUDAPinnedCacher::GetInstance().Malloc(byte_size);
+}
+
+void CUDAPinnedMemoryManager::Free(void* ptr, const Device& device) {
+    if (device.GetType() != Device::DeviceType::CPU) {
+        utility::LogError(
+                "[CUDAPinnedMemoryManager] Free: Pinned memory can only be "
+                "allocated on CPU, but {} is used.",
+                device.ToString());
+    }
+    CUDAPinnedCacher::GetInstance().Free(ptr);
+}
+
+void CUDAPinnedMemoryManager::Memcpy(void* dst_ptr,
+                                     const Device& dst_device,
+                                     const void* src_ptr,
+                                     const Device& src_device,
+                                     size_t num_bytes) {
+    std::memcpy(dst_ptr, src_ptr, num_bytes);
+}
+
+bool CUDAPinnedMemoryManager::IsPinnedPointer(const void* ptr) {
+    return CUDAPinnedCacher::GetInstance().IsPinnedPointer(ptr);
+}
+
+void CUDAPinnedMemoryManager::RecordCurrentStream(const void* ptr) {
+    CUDAPinnedCacher::GetInstance().RecordCurrentStream(ptr);
+}
+
+void CUDAPinnedMemoryManager::MemcpyHostToDevice(void* dst_ptr,
+                                                 const void* host_ptr,
+                                                 size_t num_bytes) {
+    cudaStream_t stream = CUDAStream::GetCurrent();
+    if (num_bytes < STAGED_MEMCPY_MIN_BYTES || IsPinnedPointer(host_ptr)) {
+        // Copies from pinned memory return before the data has been read,
+        // so the pinned block must not be reused until the copy is done.
+        OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, host_ptr, num_bytes,
+                                          cudaMemcpyHostToDevice, stream));
+        RecordCurrentStream(host_ptr);
+        return;
+    }
+
+    // Filling one staging buffer overlaps with the DMA from the other one.
+    StagingBuffers staging;
+    char* dst = static_cast<char*>(dst_ptr);
+    const char* src = static_cast<const char*>(host_ptr);
+    for (size_t offset = 0, chunk_idx = 0; offset < num_bytes;
+         offset += STAGED_MEMCPY_CHUNK_BYTES, ++chunk_idx) {
+        const int buffer_idx = chunk_idx % 2;
+        const size_t chunk_bytes =
+                std::min(STAGED_MEMCPY_CHUNK_BYTES, num_bytes - offset);
+        if (chunk_idx >= 2) {
+            staging.Synchronize(buffer_idx);
+        }
+        char* buffer = staging.GetBuffer(buffer_idx);
+        std::memcpy(buffer, src + offset, chunk_bytes);
+        OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst + offset, buffer, chunk_bytes,
+                                          cudaMemcpyHostToDevice, stream));
+        staging.Record(buffer_idx, stream);
+    }
+}
+
+void CUDAPinnedMemoryManager::MemcpyDeviceToHost(void* host_ptr,
+                                                 const void* src_ptr,
+                                                 size_t num_bytes) {
+    cudaStream_t stream = CUDAStream::GetCurrent();
+    if (num_bytes < STAGED_MEMCPY_MIN_BYTES || IsPinnedPointer(host_ptr)) {
+        // The host may read host_ptr right after returning.
+        OPEN3D_CUDA_CHECK(cudaMemcpyAsync(host_ptr, src_ptr, num_bytes,
+                                          cudaMemcpyDeviceToHost, stream));
+        OPEN3D_CUDA_CHECK(cudaStreamSynchronize(stream));
+        return;
+    }
+
+    // Draining one staging buffer overlaps with the DMA into the other one.
+    StagingBuffers staging;
+    char* dst = static_cast<char*>(host_ptr);
+    const char* src = static_cast<const char*>(src_ptr);
+    const size_t num_chunks =
+            (num_bytes + STAGED_MEMCPY_CHUNK_BYTES - 1) /
+            STAGED_MEMCPY_CHUNK_BYTES;
+    for (size_t chunk_idx = 0; chunk_idx <= num_chunks; ++chunk_idx) {
+        if (chunk_idx < num_chunks) {
+            const int buffer_idx = chunk_idx % 2;
+            const size_t offset = chunk_idx * STAGED_MEMCPY_CHUNK_BYTES;
+            const size_t chunk_bytes =
+                    std::min(STAGED_MEMCPY_CHUNK_BYTES, num_bytes - offset);
+            OPEN3D_CUDA_CHECK(cudaMemcpyAsync(staging.GetBuffer(buffer_idx),
+                                              src + offset, chunk_bytes,
+                                              cudaMemcpyDeviceToHost, stream));
+            staging.Record(buffer_idx, stream);
+        }
+        if (chunk_idx > 0) {
+            const size_t prev_idx = chunk_idx - 1;
+            const int buffer_idx = prev_idx % 2;
+            const size_t offset = prev_idx * STAGED_MEMCPY_CHUNK_BYTES;
+            const size_t chunk_bytes =
+                    std::min(STAGED_MEMCPY_CHUNK_BYTES, num_bytes - offset);
+            staging.Synchronize(buffer_idx);
+            std::memcpy(dst + offset, staging.GetBuffer(buffer_idx),
+                        chunk_bytes);
+        }
+    }
+}
+
+void CUDAPinnedMemoryManager::ReleaseCache() {
+    CUDAPinnedCacher::GetInstance().ReleaseCache();
+}
+
+}  // namespace core
+}  // namespace open3d
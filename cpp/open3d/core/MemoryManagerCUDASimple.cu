@@ -71,16 +71,16 @@ void CUDASimpleMemoryManager::Memcpy(void* dst_ptr,
         if (!IsCUDAPointer(dst_ptr)) {
             utility::LogError("dst_ptr is not a CUDA pointer.");
         }
-        OPEN3D_CUDA_CHECK(cudaMemcpy(dst_ptr, src_ptr, num_bytes,
-                                     cudaMemcpyHostToDevice));
+        CUDAPinnedMemoryManager::MemcpyHostToDevice(dst_ptr, src_ptr,
+                                                    num_bytes);
     } else if (dst_device.GetType() == Device::DeviceType::CPU &&
                src_device.GetType() == Device::DeviceType::CUDA) {
         CUDADeviceSwitcher switcher(src_device);
         if (!IsCUDAPointer(src_ptr)) {
             utility::LogError("src_ptr is not a CUDA pointer.");
         }
-        OPEN3D_CUDA_CHECK(cudaMemcpy(dst_ptr, src_ptr, num_bytes,
-                                     cudaMemcpyDeviceToHost));
+        CUDAPinnedMemoryManager::MemcpyDeviceToHost(dst_ptr, src_ptr,
+                                                    num_bytes);
     } else if (dst_device.GetType() == Device::DeviceType::CUDA &&
                src_device.GetType() == Device::DeviceType::CUDA) {
         CUDADeviceSwitcher switcher(dst_device);
@@ -94,13 +94,14 @@ void CUDASimpleMemoryManager::Memcpy(void* dst_ptr,
 
         if (dst_device == src_device) {
             switcher.SwitchTo(src_device);
-            OPEN3D_CUDA_CHECK(cudaMemcpy(dst_ptr, src_ptr, num_bytes,
-                                         cudaMemcpyDeviceToDevice));
+            OPEN3D_CUDA_CHECK(cudaMemcpyAsync(dst_ptr, src_ptr, num_bytes,
+                                              cudaMemcpyDeviceToDevice,
+                                              CUDAStream::GetCurrent()));
         } else if (CUDAState::GetInstance()->IsP2PEnabled(src_device.GetID(),
                                                           dst_device.GetID())) {
-            OPEN3D_CUDA_CHECK(cudaMemcpyPeer(dst_ptr, dst_device.GetID(),
-                                             src_ptr, src_device.GetID(),
-                                             num_bytes));
+            OPEN3D_CUDA_CHECK(cudaMemcpyPeerAsync(
+                    dst_ptr, dst_device.GetID(), src_ptr, src_device.GetID(),
+                    num_bytes, CUDAStream::GetCurrent()));
         } else {
             void* cpu_buf = MemoryManager::Malloc(num_bytes, Device("CPU:0"));
             switcher.SwitchTo(src_device);
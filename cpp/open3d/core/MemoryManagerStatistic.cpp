@@ -30,6 +30,7 @@
 #include <cstdlib>
 #include <numeric>
 
+#include "open3d/core/Profiler.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -119,6 +120,25 @@ void MemoryManagerStatistic::Print() const {
     }
     utility::LogInfo("---------------------------------------------");
 
+    if (level_ == PrintLevel::All) {
+        std::lock_guard<std::mutex> lock(cache_mutex_);
+        for (const auto& value_pair : cache_statistics_) {
+            const CacheStatistics statistics = value_pair.second();
+            utility::LogInfo("{} cache: {} hits, {} misses, {} bytes cached",
+                             value_pair.first.ToString(), statistics.count_hit_,
+                             statistics.count_miss_,
+                             statistics.cached_byte_size_);
+            if (statistics.reserved_byte_size_ > 0) {
+                utility::LogInfo(
+                        "    {} bytes reserved, largest cached block {} "
+                        "bytes, fragmentation {:.2f}, {} flushes",
+                        statistics.reserved_byte_size_,
+                        statistics.largest_cached_block_size_,
+                        statistics.Fragmentation(), statistics.count_flush_);
+            }
+        }
+    }
+
     // Restore old verbosity level.
     utility::SetVerbosityLevel(old_level);
 }
@@ -143,6 +163,9 @@ void MemoryManagerStatistic::CountMalloc(void* ptr,
     auto it = statistics_[device].active_allocations_.emplace(ptr, byte_size);
     if (it.second) {
         statistics_[device].count_malloc_++;
+        if (Profiler::IsEnabled()) {
+            Profiler::GetInstance().RecordMalloc(byte_size, device);
+        }
     } else {
         utility::LogError(
                 "{} @ {} bytes on {} is still active and was not freed before",
@@ -158,6 +181,13 @@ void MemoryManagerStatistic::CountFree(void* ptr, const Device& device) {
         return;
     }
 
+    if (Profiler::IsEnabled()) {
+        auto it = statistics_[device].active_allocations_.find(ptr);
+        if (it != statistics_[device].active_allocations_.end()) {
+            Profiler::GetInstance().RecordFree(it->second, device);
+        }
+    }
+
     auto num_erased = statistics_[device].active_allocations_.erase(ptr);
     if (num_erased == 1) {
         statistics_[device].count_free_++;
@@ -177,6 +207,23 @@ void MemoryManagerStatistic::Reset() {
     statistics_.clear();
 }
 
+void MemoryManagerStatistic::RegisterCache(
+        const Device& device,
+        const std::function<CacheStatistics()>& get_statistics) {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    cache_statistics_[device] = get_statistics;
+}
+
+MemoryManagerStatistic::CacheStatistics
+MemoryManagerStatistic::GetCacheStatistics(const Device& device) const {
+    std::lock_guard<std::mutex> lock(cache_mutex_);
+    auto it = cache_statistics_.find(device);
+    if (it == cache_statistics_.end()) {
+        return CacheStatistics();
+    }
+    return it->second();
+}
+
 bool MemoryManagerStatistic::MemoryStatistics::IsBalanced() const {
     return count_malloc_ == count_free_;
 }
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <map>
 #include <mutex>
 #include <unordered_map>
@@ -48,6 +49,37 @@ public:
         None = 2,
     };
 
+    /// Statistics of a caching memory manager, which keeps freed memory for
+    /// reuse instead of returning it to the system.
+    struct CacheStatistics {
+        /// Number of allocations served from the cache.
+        int64_t count_hit_ = 0;
+        /// Number of allocations that required new memory from the system.
+        int64_t count_miss_ = 0;
+        /// Total bytes currently held by the cache and not in use.
+        size_t cached_byte_size_ = 0;
+        /// Total bytes held from the system, in use or cached. Only reported
+        /// by the CUDA cached memory manager.
+        size_t reserved_byte_size_ = 0;
+        /// Size of the largest cached block. Only reported by the CUDA cached
+        /// memory manager.
+        size_t largest_cached_block_size_ = 0;
+        /// Number of times the cache was released to retry an allocation
+        /// that failed or exceeded the memory limit.
+        int64_t count_flush_ = 0;
+
+        /// Returns the fraction of the cached bytes that are not in the
+        /// largest cached block, between 0 and 1. High values mean that the
+        /// cached memory cannot serve large allocations.
+        double Fragmentation() const {
+            if (cached_byte_size_ == 0) {
+                return 0.0;
+            }
+            return 1.0 - static_cast<double>(largest_cached_block_size_) /
+                                 static_cast<double>(cached_byte_size_);
+        }
+    };
+
     static MemoryManagerStatistic& GetInstance();
 
     MemoryManagerStatistic(const MemoryManagerStatistic&) = delete;
@@ -81,6 +113,16 @@ public:
     /// Resets the statistics.
     void Reset();
 
+    /// Registers a function reporting the cache statistics of \p device. This
+    /// is called by caching memory managers. The counters are kept by the
+    /// memory manager itself, so that its fast paths do not need to lock.
+    void RegisterCache(const Device& device,
+                       const std::function<CacheStatistics()>& get_statistics);
+
+    /// Returns the cache statistics of \p device. All values are zero if the
+    /// device's memory manager does not cache.
+    CacheStatistics GetCacheStatistics(const Device& device) const;
+
 private:
     MemoryManagerStatistic() = default;
 
@@ -101,6 +143,9 @@ private:
 
     std::mutex statistics_mutex_;
     std::map<Device, MemoryStatistics> statistics_;
+
+    mutable std::mutex cache_mutex_;
+    std::map<Device, std::function<CacheStatistics()>> cache_statistics_;
 };
 
 }  // namespace core
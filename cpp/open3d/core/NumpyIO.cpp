@@ -50,6 +50,17 @@
 
 #include "open3d/core/NumpyIO.h"
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <regex>
@@ -80,6 +91,7 @@ static char DtypeToChar(const Dtype& dtype) {
     // '?': object
     if (dtype == Dtype::Float32) return 'f';
     if (dtype == Dtype::Float64) return 'f';
+    if (dtype == Dtype::Float16) return 'f';
     if (dtype == Dtype::Int8) return 'i';
     if (dtype == Dtype::Int16) return 'i';
     if (dtype == Dtype::Int32) return 'i';
@@ -245,6 +257,18 @@ NumpyArray::NumpyArray(const SizeVector& shape,
     blob_ = std::make_shared<Blob>(num_elements_ * word_size_, Device("CPU:0"));
 }
 
+NumpyArray::NumpyArray(const SizeVector& shape,
+                       char type,
+                       int64_t word_size,
+                       bool fortran_order,
+                       const std::shared_ptr<Blob>& blob)
+    : blob_(blob),
+      shape_(shape),
+      type_(type),
+      word_size_(word_size),
+      fortran_order_(fortran_order),
+      num_elements_(shape.NumElements()) {}
+
 NumpyArray::NumpyArray(const Tensor& t)
     : shape_(t.GetShape()),
       type_(DtypeToChar(t.GetDtype())),
@@ -257,6 +281,7 @@ NumpyArray::NumpyArray(const Tensor& t)
 Dtype NumpyArray::GetDtype() const {
     if (type_ == 'f' && word_size_ == 4) return Dtype::Float32;
     if (type_ == 'f' && word_size_ == 8) return Dtype::Float64;
+    if (type_ == 'f' && word_size_ == 2) return Dtype::Float16;
     if (type_ == 'i' && word_size_ == 1) return Dtype::Int8;
     if (type_ == 'i' && word_size_ == 2) return Dtype::Int16;
     if (type_ == 'i' && word_size_ == 4) return Dtype::Int32;
@@ -286,7 +311,70 @@ Tensor NumpyArray::ToTensor() const {
     return t;
 }
 
-NumpyArray NumpyArray::Load(const std::string& file_name) {
+std::shared_ptr<Blob> MapFile(const std::string& file_name,
+                              int64_t data_offset,
+                              int64_t num_bytes,
+                              bool copy_on_write) {
+    const size_t map_size = static_cast<size_t>(data_offset + num_bytes);
+#ifdef _WIN32
+    HANDLE file = CreateFileA(file_name.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        utility::LogError("Load: Unable to open file {}.", file_name);
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) ||
+        file_size.QuadPart < static_cast<LONGLONG>(map_size)) {
+        CloseHandle(file);
+        utility::LogError("Load: file {} is truncated.", file_name);
+    }
+    HANDLE mapping = CreateFileMappingA(
+            file, nullptr, copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY, 0,
+            0, nullptr);
+    void* map_ptr = nullptr;
+    if (mapping != nullptr) {
+        map_ptr = MapViewOfFile(mapping,
+                                copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ,
+                                0, 0, map_size);
+        // The view keeps the mapping alive.
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+    if (map_ptr == nullptr) {
+        utility::LogError("Load: failed to map file {}, error code {}.",
+                          file_name, GetLastError());
+    }
+    auto deleter = [map_ptr](void*) { UnmapViewOfFile(map_ptr); };
+#else
+    int fd = open(file_name.c_str(), O_RDONLY);
+    if (fd < 0) {
+        utility::LogError("Load: Unable to open file {}.", file_name);
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 ||
+        file_stat.st_size < static_cast<off_t>(map_size)) {
+        close(fd);
+        utility::LogError("Load: file {} is truncated.", file_name);
+    }
+    void* map_ptr = mmap(nullptr, map_size,
+                         copy_on_write ? PROT_READ | PROT_WRITE : PROT_READ,
+                         copy_on_write ? MAP_PRIVATE : MAP_SHARED, fd, 0);
+    // The mapping stays valid after closing the file descriptor.
+    close(fd);
+    if (map_ptr == MAP_FAILED) {
+        utility::LogError("Load: failed to mmap file {}: {}.", file_name,
+                          std::strerror(errno));
+    }
+    auto deleter = [map_ptr, map_size](void*) { munmap(map_ptr, map_size); };
+#endif
+    return std::make_shared<Blob>(Device("CPU:0"),
+                                  static_cast<char*>(map_ptr) + data_offset,
+                                  deleter);
+}
+
+NumpyArray NumpyArray::Load(const std::string& file_name,
+                            Tensor::MmapMode mmap_mode) {
     FILE* fp = fopen(file_name.c_str(), "rb");
     if (!fp) {
         utility::LogError("Load: Unable to open file {}.", file_name);
@@ -297,6 +385,17 @@ NumpyArray NumpyArray::Load(const std::string& file_name) {
     bool fortran_order;
     char type;
     std::tie(type, word_size, shape, fortran_order) = ParseNumpyHeader(fp);
+
+    const int64_t num_bytes = shape.NumElements() * word_size;
+    if (mmap_mode != Tensor::MmapMode::None && num_bytes > 0) {
+        const int64_t data_offset = static_cast<int64_t>(ftell(fp));
+        fclose(fp);
+        std::shared_ptr<Blob> blob =
+                MapFile(file_name, data_offset, num_bytes,
+                        mmap_mode == Tensor::MmapMode::CopyOnWrite);
+        return NumpyArray(shape, type, word_size, fortran_order, blob);
+    }
+
     NumpyArray arr(shape, type, word_size, fortran_order);
     size_t nread = fread(arr.GetDataPtr<char>(), 1,
                          static_cast<size_t>(arr.NumBytes()), fp);
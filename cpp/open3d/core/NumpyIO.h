@@ -26,6 +26,9 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+
 #include "open3d/core/Blob.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
@@ -45,6 +48,14 @@ public:
                int64_t word_size,
                bool fortran_order);
 
+    /// Constructs a NumpyArray backed by an existing CPU \p blob, e.g. a
+    /// memory-mapped file.
+    NumpyArray(const SizeVector& shape,
+               char type,
+               int64_t word_size,
+               bool fortran_order,
+               const std::shared_ptr<Blob>& blob);
+
     template <typename T>
     T* GetDataPtr() {
         return reinterpret_cast<T*>(blob_->GetDataPtr());
@@ -65,7 +76,9 @@ public:
 
     Tensor ToTensor() const;
 
-    static NumpyArray Load(const std::string& file_name);
+    static NumpyArray Load(
+            const std::string& file_name,
+            Tensor::MmapMode mmap_mode = Tensor::MmapMode::None);
 
     void Save(std::string file_name) const;
 
@@ -78,5 +91,14 @@ private:
     int64_t num_elements_;
 };
 
+/// Maps bytes [0, data_offset + num_bytes) of \p file_name into memory and
+/// returns a CPU blob starting at \p data_offset. The mapping is released
+/// when the blob is destroyed. If \p copy_on_write is true, the mapping is
+/// writable and modified pages are private to the process.
+std::shared_ptr<Blob> MapFile(const std::string& file_name,
+                              int64_t data_offset,
+                              int64_t num_bytes,
+                              bool copy_on_write);
+
 }  // namespace core
 }  // namespace open3d
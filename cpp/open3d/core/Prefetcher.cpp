@@ -0,0 +1,65 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Prefetcher.h"
+
+#ifdef BUILD_CUDA_MODULE
+#include "open3d/core/CUDAState.cuh"
+#endif
+
+namespace open3d {
+namespace core {
+
+struct UploadStream::Impl {
+#ifdef BUILD_CUDA_MODULE
+    // The scoped stream is destroyed before the stream.
+    std::unique_ptr<CUDAStream> stream_;
+    std::unique_ptr<CUDAScopedStream> scoped_stream_;
+#endif
+};
+
+UploadStream::UploadStream(const Device& device) : impl_(new Impl()) {
+#ifdef BUILD_CUDA_MODULE
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        impl_->stream_ = std::make_unique<CUDAStream>(device);
+        impl_->scoped_stream_ =
+                std::make_unique<CUDAScopedStream>(*impl_->stream_);
+    }
+#endif
+}
+
+UploadStream::~UploadStream() {}
+
+void UploadStream::Synchronize() {
+#ifdef BUILD_CUDA_MODULE
+    if (impl_->stream_) {
+        impl_->stream_->Synchronize();
+    }
+#endif
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,231 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "open3d/core/Device.h"
+
+namespace open3d {
+namespace core {
+
+/// \class UploadStream
+///
+/// \brief While alive, makes a dedicated CUDA stream the current stream of
+/// the calling thread if \p device is a CUDA device, so that the uploads of a
+/// loader thread overlap with the kernels of other threads. Does nothing for
+/// other devices.
+class UploadStream {
+public:
+    explicit UploadStream(const Device& device);
+    ~UploadStream();
+
+    UploadStream(const UploadStream&) = delete;
+    UploadStream& operator=(const UploadStream&) = delete;
+
+    /// Waits for the work queued on the stream, so that the uploaded data
+    /// can be used on the streams of other threads.
+    void Synchronize();
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// \class Prefetcher
+///
+/// \brief Loads a sequence of items with a pool of background threads ahead
+/// of the caller and returns them in order, so that loading item k + 1,
+/// k + 2, ... overlaps with processing item k. Each loader thread runs with
+/// an UploadStream of the device, and only hands over items whose uploads
+/// have completed.
+///
+/// At most capacity items are loaded or being loaded ahead of Pop(): the
+/// loader threads wait while they are claimed, and Pop() waits while the
+/// next item is not loaded yet.
+template <typename T>
+class Prefetcher {
+public:
+    /// Loads the item \p index into \p item on a loader thread. Returns false
+    /// if there is no such item, i.e. at the end of the sequence. The indices
+    /// are claimed in increasing order, so with a single loader thread the
+    /// function is called for 0, 1, 2, ... in turn. Exceptions are rethrown
+    /// by Pop() for the item.
+    using LoadFunction = std::function<bool(size_t index, T& item)>;
+
+    /// \brief Parameterized Constructor, starting the loader threads.
+    ///
+    /// \param load Function loading the items.
+    /// \param device Device of the upload streams of the loader threads.
+    /// \param capacity Maximum number of items loaded ahead of Pop().
+    /// \param num_threads Number of loader threads, at most \p capacity.
+    Prefetcher(const LoadFunction& load,
+               const Device& device,
+               size_t capacity,
+               size_t num_threads = 1)
+        : load_(load),
+          device_(device),
+          capacity_(std::max(capacity, size_t(1))) {
+        num_threads = std::min(std::max(num_threads, size_t(1)), capacity_);
+        for (size_t i = 0; i < num_threads; ++i) {
+            threads_.emplace_back(&Prefetcher::Run, this);
+        }
+    }
+
+    /// Stops and joins the loader threads, dropping the items not popped.
+    ~Prefetcher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        not_full_.notify_all();
+        for (std::thread& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    Prefetcher(const Prefetcher&) = delete;
+    Prefetcher& operator=(const Prefetcher&) = delete;
+
+    /// Moves the next item into \p item. Returns false once all items have
+    /// been popped. Rethrows the exception of the load function if the item
+    /// failed to load.
+    bool Pop(T& item) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [this] {
+            return items_.count(next_pop_) != 0 || next_pop_ >= end_;
+        });
+        if (next_pop_ >= end_) {
+            return false;
+        }
+        auto it = items_.find(next_pop_);
+        LoadedItem loaded = std::move(it->second);
+        items_.erase(it);
+        ++next_pop_;
+        lock.unlock();
+        not_full_.notify_all();
+
+        if (loaded.error_) {
+            std::rethrow_exception(loaded.error_);
+        }
+        item = std::move(loaded.item_);
+        return true;
+    }
+
+    /// Returns true if all items have been popped, i.e. if Pop() returns
+    /// false. Returns false while the end of the sequence is not known yet.
+    bool IsEnd() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return next_pop_ >= end_;
+    }
+
+    /// Number of items popped so far, i.e. the index of the next item.
+    size_t GetNumPopped() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return next_pop_;
+    }
+
+private:
+    struct LoadedItem {
+        T item_;
+        std::exception_ptr error_;
+    };
+
+    void Run() {
+        UploadStream upload_stream(device_);
+        while (true) {
+            size_t index;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                not_full_.wait(lock, [this] {
+                    return next_load_ < next_pop_ + capacity_ ||
+                           next_load_ >= end_ || stop_;
+                });
+                if (stop_ || next_load_ >= end_) {
+                    break;
+                }
+                index = next_load_++;
+            }
+
+            LoadedItem loaded;
+            bool has_item = true;
+            try {
+                has_item = load_(index, loaded.item_);
+                // Only complete uploads are handed over to the caller.
+                upload_stream.Synchronize();
+            } catch (...) {
+                loaded.error_ = std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!has_item) {
+                    end_ = std::min(end_, index);
+                } else if (index < end_) {
+                    items_.emplace(index, std::move(loaded));
+                }
+            }
+            // The end of the sequence also wakes up the waiting loaders.
+            not_empty_.notify_all();
+            if (!has_item) {
+                not_full_.notify_all();
+            }
+        }
+    }
+
+    LoadFunction load_;
+    Device device_;
+    size_t capacity_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+    /// Loaded items waiting for Pop(), by index.
+    std::map<size_t, LoadedItem> items_;
+    /// Index of the next item to load.
+    size_t next_load_ = 0;
+    /// Index of the next item to pop.
+    size_t next_pop_ = 0;
+    /// Index of the first missing item, once it is known.
+    size_t end_ = std::numeric_limits<size_t>::max();
+    bool stop_ = false;
+
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,363 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Profiler.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <mutex>
+
+#include "open3d/utility/IJsonConvertible.h"
+#include "open3d/utility/Logging.h"
+
+#ifdef BUILD_CUDA_MODULE
+#include "open3d/core/CUDAState.cuh"
+#if __has_include(<nvtx3/nvToolsExt.h>)
+#include <nvtx3/nvToolsExt.h>
+#define OPEN3D_USE_NVTX
+#endif
+#endif
+
+namespace open3d {
+namespace core {
+
+namespace {
+
+/// A scope opened by the calling thread.
+struct OpenScope {
+    const char* name_;
+    Device device_;
+    int64_t generation_;
+    double start_us_;
+    size_t allocated_byte_size_;
+    size_t peak_byte_size_;
+#ifdef BUILD_CUDA_MODULE
+    cudaEvent_t cuda_start_ = nullptr;
+#endif
+};
+
+std::vector<OpenScope>& GetOpenScopes() {
+    static thread_local std::vector<OpenScope> open_scopes;
+    return open_scopes;
+}
+
+#ifdef BUILD_CUDA_MODULE
+cudaEvent_t RecordCUDAEvent(const Device& device) {
+    CUDADeviceSwitcher switcher(device);
+    cudaEvent_t event;
+    OPEN3D_CUDA_CHECK(cudaEventCreate(&event));
+    OPEN3D_CUDA_CHECK(cudaEventRecord(event, CUDAStream::GetCurrent()));
+    return event;
+}
+#endif
+
+bool IsEnvironmentVariableSet(const char* name) {
+    const char* value = std::getenv(name);
+    return value != nullptr && value[0] != '\0' && std::string(value) != "0";
+}
+
+bool InitEnabled() {
+    if (std::getenv("OPEN3D_PROFILE_TRACE") != nullptr) {
+        // Construct the profiler, which exports the trace at program end.
+        Profiler::GetInstance();
+        return true;
+    }
+    return IsEnvironmentVariableSet("OPEN3D_PROFILE");
+}
+
+}  // namespace
+
+struct Profiler::Impl {
+    struct PendingEvent {
+        Event event_;
+#ifdef BUILD_CUDA_MODULE
+        cudaEvent_t cuda_start_ = nullptr;
+        cudaEvent_t cuda_stop_ = nullptr;
+#endif
+    };
+
+    double GetTimeUs() const {
+        return std::chrono::duration<double, std::micro>(
+                       std::chrono::steady_clock::now() - epoch_)
+                .count();
+    }
+
+    /// Waits for pending CUDA events and computes their durations.
+    void ResolvePendingEvents() {
+#ifdef BUILD_CUDA_MODULE
+        for (PendingEvent& pending : events_) {
+            if (pending.cuda_stop_ == nullptr) {
+                continue;
+            }
+            OPEN3D_CUDA_CHECK(cudaEventSynchronize(pending.cuda_stop_));
+            float duration_ms = 0.0f;
+            OPEN3D_CUDA_CHECK(cudaEventElapsedTime(
+                    &duration_ms, pending.cuda_start_, pending.cuda_stop_));
+            pending.event_.duration_us_ = duration_ms * 1000.0;
+            DestroyCUDAEvents(pending);
+        }
+#endif
+    }
+
+    /// Drops the oldest events exceeding max_num_events_.
+    void DropOldestEvents() {
+        while (max_num_events_ > 0 && events_.size() > max_num_events_) {
+#ifdef BUILD_CUDA_MODULE
+            DestroyCUDAEvents(events_.front());
+#endif
+            events_.pop_front();
+        }
+    }
+
+    void ClearEvents() {
+#ifdef BUILD_CUDA_MODULE
+        for (PendingEvent& pending : events_) {
+            DestroyCUDAEvents(pending);
+        }
+#endif
+        events_.clear();
+    }
+
+#ifdef BUILD_CUDA_MODULE
+    static void DestroyCUDAEvents(PendingEvent& pending) {
+        if (pending.cuda_start_ != nullptr) {
+            cudaEventDestroy(pending.cuda_start_);
+            pending.cuda_start_ = nullptr;
+        }
+        if (pending.cuda_stop_ != nullptr) {
+            cudaEventDestroy(pending.cuda_stop_);
+            pending.cuda_stop_ = nullptr;
+        }
+    }
+#endif
+
+    mutable std::mutex mutex_;
+    std::chrono::steady_clock::time_point epoch_ =
+            std::chrono::steady_clock::now();
+    /// Incremented by Reset() to discard scopes opened before.
+    int64_t generation_ = 0;
+    std::deque<PendingEvent> events_;
+    /// Maximal size of events_, or 0 if unlimited.
+    size_t max_num_events_ = 0;
+    std::map<Device, int64_t> current_byte_size_;
+    std::map<Device, int64_t> peak_byte_size_;
+
+    std::atomic<int64_t> next_thread_id_{0};
+    std::string trace_file_name_;
+};
+
+std::atomic<bool> Profiler::enabled_{InitEnabled()};
+
+Profiler& Profiler::GetInstance() {
+    // Ensure the static Logger instance is instantiated before the Profiler,
+    // so that the trace can be exported and logged at program end.
+    utility::Logger::GetInstance();
+
+    // Intentionally leaked, since memory may be freed during static
+    // destruction.
+    static Profiler* instance = new Profiler();
+    return *instance;
+}
+
+Profiler::Profiler() : impl_(new Impl()) {
+    if (const char* trace_file_name = std::getenv("OPEN3D_PROFILE_TRACE")) {
+        impl_->trace_file_name_ = trace_file_name;
+        std::atexit([]() {
+            try {
+                GetInstance().ExportChromeTrace(
+                        GetInstance().impl_->trace_file_name_);
+            } catch (const std::exception& e) {
+                utility::LogWarning("Failed to export the profiling trace: {}",
+                                    e.what());
+            }
+        });
+    }
+}
+
+void Profiler::SetEnabled(bool enabled) { enabled_ = enabled; }
+
+std::vector<Profiler::Event> Profiler::GetEvents() {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    impl_->ResolvePendingEvents();
+    std::vector<Event> events;
+    events.reserve(impl_->events_.size());
+    for (const Impl::PendingEvent& pending : impl_->events_) {
+        events.push_back(pending.event_);
+    }
+    return events;
+}
+
+size_t Profiler::GetPeakByteSize(const Device& device) const {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    auto it = impl_->peak_byte_size_.find(device);
+    return it == impl_->peak_byte_size_.end() ? 0 : it->second;
+}
+
+void Profiler::Reset() {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    impl_->ClearEvents();
+    impl_->epoch_ = std::chrono::steady_clock::now();
+    impl_->generation_++;
+    // Keep the bytes in use, so that later frees remain balanced.
+    impl_->peak_byte_size_ = impl_->current_byte_size_;
+}
+
+void Profiler::SetMaxNumEvents(size_t max_num_events) {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    impl_->max_num_events_ = max_num_events;
+    impl_->DropOldestEvents();
+}
+
+void Profiler::ExportChromeTrace(const std::string& file_name) {
+    Json::Value trace_events(Json::arrayValue);
+    for (const Event& event : GetEvents()) {
+        Json::Value trace_event;
+        trace_event["name"] = event.name_;
+        trace_event["cat"] = event.device_.ToString();
+        trace_event["ph"] = "X";
+        trace_event["ts"] = event.start_us_;
+        trace_event["dur"] = event.duration_us_;
+        trace_event["pid"] = 0;
+        trace_event["tid"] = Json::Int64(event.thread_id_);
+        trace_event["args"]["device"] = event.device_.ToString();
+        trace_event["args"]["allocated_bytes"] =
+                Json::UInt64(event.allocated_byte_size_);
+        trace_event["args"]["peak_bytes"] = Json::UInt64(event.peak_byte_size_);
+        trace_events.append(trace_event);
+    }
+    Json::Value trace;
+    trace["traceEvents"] = trace_events;
+    trace["displayTimeUnit"] = "ms";
+
+    std::ofstream file(file_name);
+    if (!file.is_open()) {
+        utility::LogError("Failed to open {} for writing.", file_name);
+    }
+    file << utility::JsonToString(trace);
+    utility::LogInfo("Profiling trace with {} events written to {}.",
+                     trace_events.size(), file_name);
+}
+
+void Profiler::BeginScope(const char* name, const Device& device) {
+    OpenScope scope;
+    scope.name_ = name;
+    scope.device_ = device;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+        scope.generation_ = impl_->generation_;
+        scope.start_us_ = impl_->GetTimeUs();
+        auto it = impl_->current_byte_size_.find(device);
+        scope.peak_byte_size_ =
+                it == impl_->current_byte_size_.end() ? 0 : it->second;
+    }
+    scope.allocated_byte_size_ = 0;
+#ifdef BUILD_CUDA_MODULE
+    if (device.GetType() == Device::DeviceType::CUDA) {
+        scope.cuda_start_ = RecordCUDAEvent(device);
+    }
+#endif
+    GetOpenScopes().push_back(scope);
+#ifdef OPEN3D_USE_NVTX
+    nvtxRangePushA(name);
+#endif
+}
+
+void Profiler::EndScope() {
+    std::vector<OpenScope>& open_scopes = GetOpenScopes();
+    if (open_scopes.empty()) {
+        utility::LogWarning("Profiler::EndScope() called without open scope.");
+        return;
+    }
+    const OpenScope scope = open_scopes.back();
+    open_scopes.pop_back();
+#ifdef OPEN3D_USE_NVTX
+    nvtxRangePop();
+#endif
+
+    Impl::PendingEvent pending;
+#ifdef BUILD_CUDA_MODULE
+    if (scope.cuda_start_ != nullptr) {
+        pending.cuda_start_ = scope.cuda_start_;
+        pending.cuda_stop_ = RecordCUDAEvent(scope.device_);
+    }
+#endif
+    static thread_local int64_t thread_id = impl_->next_thread_id_++;
+    pending.event_.name_ = scope.name_;
+    pending.event_.device_ = scope.device_;
+    pending.event_.thread_id_ = thread_id;
+    pending.event_.depth_ = static_cast<int64_t>(open_scopes.size());
+    pending.event_.start_us_ = scope.start_us_;
+    pending.event_.allocated_byte_size_ = scope.allocated_byte_size_;
+    pending.event_.peak_byte_size_ = scope.peak_byte_size_;
+
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    if (scope.generation_ != impl_->generation_) {
+#ifdef BUILD_CUDA_MODULE
+        Impl::DestroyCUDAEvents(pending);
+#endif
+        return;
+    }
+    pending.event_.duration_us_ = impl_->GetTimeUs() - scope.start_us_;
+    impl_->events_.push_back(pending);
+    impl_->DropOldestEvents();
+}
+
+void Profiler::RecordMalloc(size_t byte_size, const Device& device) {
+    int64_t current_byte_size;
+    {
+        std::lock_guard<std::mutex> lock(impl_->mutex_);
+        current_byte_size = impl_->current_byte_size_[device] +=
+                static_cast<int64_t>(byte_size);
+        int64_t& peak_byte_size = impl_->peak_byte_size_[device];
+        peak_byte_size = std::max(peak_byte_size, current_byte_size);
+    }
+    for (OpenScope& scope : GetOpenScopes()) {
+        if (scope.device_ == device) {
+            scope.allocated_byte_size_ += byte_size;
+            scope.peak_byte_size_ = std::max(
+                    scope.peak_byte_size_,
+                    static_cast<size_t>(current_byte_size));
+        }
+    }
+}
+
+void Profiler::RecordFree(size_t byte_size, const Device& device) {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    int64_t& current_byte_size = impl_->current_byte_size_[device];
+    // Memory allocated while profiling was disabled is not counted.
+    current_byte_size =
+            std::max(current_byte_size - static_cast<int64_t>(byte_size),
+                     int64_t(0));
+}
+
+}  // namespace core
+}  // namespace open3d
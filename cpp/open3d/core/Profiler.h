@@ -0,0 +1,185 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open3d/Macro.h"
+#include "open3d/core/Device.h"
+
+namespace open3d {
+namespace core {
+
+/// \class Profiler
+///
+/// Records the duration and memory usage of profiled scopes, e.g. Tensor
+/// kernels, and exports them as Chrome trace JSON (chrome://tracing or
+/// https://ui.perfetto.dev).
+///
+/// Profiling is disabled by default. It is enabled by SetEnabled(true) or by
+/// setting the environment variable OPEN3D_PROFILE=1. Setting
+/// OPEN3D_PROFILE_TRACE=<file> also enables profiling and writes the trace to
+/// <file> at program end. When disabled, a ProfileScope only costs a relaxed
+/// atomic load. Configuring with -DENABLE_PROFILING=OFF removes the library's
+/// scopes at compile time, and so does defining OPEN3D_DISABLE_PROFILING for
+/// other code.
+///
+/// For long running processes, SetMaxNumEvents() keeps only the latest events
+/// in a ring buffer. In CUDA builds with NVTX, scopes are also annotated as
+/// NVTX ranges for Nsight Systems while profiling is enabled.
+///
+/// Example:
+/// ```cpp
+/// core::Profiler::SetEnabled(true);
+/// {
+///     OPEN3D_PROFILE_SCOPE("Odometry", device);
+///     // ... Tensor ops, each recorded as a nested scope ...
+/// }
+/// core::Profiler::GetInstance().ExportChromeTrace("trace.json");
+/// ```
+class Profiler {
+public:
+    /// A finished profiled scope.
+    struct Event {
+        std::string name_;
+        Device device_;
+        /// Sequential id of the recording thread, starting from 0.
+        int64_t thread_id_ = 0;
+        /// Nesting depth of the scope in the recording thread.
+        int64_t depth_ = 0;
+        /// Start time in microseconds, relative to the last Reset().
+        double start_us_ = 0.0;
+        /// Duration in microseconds. For CUDA devices, this is the GPU time
+        /// measured with CUDA events on the current stream.
+        double duration_us_ = 0.0;
+        /// Bytes allocated on the device within the scope, including nested
+        /// scopes.
+        size_t allocated_byte_size_ = 0;
+        /// Peak number of bytes in use on the device within the scope.
+        size_t peak_byte_size_ = 0;
+    };
+
+    static Profiler& GetInstance();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(Profiler&) = delete;
+
+    /// Returns true if profiling is enabled.
+    static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    /// Enables or disables profiling. Scopes opened before enabling are not
+    /// recorded.
+    static void SetEnabled(bool enabled);
+
+    /// Returns all events recorded since the last Reset(), ordered by their
+    /// end time. Waits for pending CUDA events.
+    std::vector<Event> GetEvents();
+
+    /// Returns the peak number of bytes in use on \p device since the last
+    /// Reset(). Only allocations made while profiling is enabled are counted.
+    size_t GetPeakByteSize(const Device& device) const;
+
+    /// Clears all recorded events and memory watermarks. Scopes that are open
+    /// during the reset are not recorded.
+    void Reset();
+
+    /// Limits the number of stored events. Once the limit is reached, every
+    /// new event replaces the oldest one. 0 stores all events, which is the
+    /// default.
+    void SetMaxNumEvents(size_t max_num_events);
+
+    /// Writes all recorded events to \p file_name in the Chrome trace event
+    /// format.
+    void ExportChromeTrace(const std::string& file_name);
+
+    /// Opens a scope in the calling thread. Use ProfileScope instead.
+    void BeginScope(const char* name, const Device& device);
+
+    /// Closes the innermost scope of the calling thread. Use ProfileScope
+    /// instead.
+    void EndScope();
+
+    /// Records an allocation. Called by MemoryManagerStatistic.
+    void RecordMalloc(size_t byte_size, const Device& device);
+
+    /// Records a deallocation. Called by MemoryManagerStatistic.
+    void RecordFree(size_t byte_size, const Device& device);
+
+private:
+    Profiler();
+
+    static std::atomic<bool> enabled_;
+
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+/// \class ProfileScope
+///
+/// Records the enclosing scope with the Profiler if profiling is enabled.
+class ProfileScope {
+public:
+    /// \param name Name of the scope. Must outlive the scope, e.g. a string
+    /// literal.
+    /// \param device Device the scope runs on. CUDA scopes are timed with CUDA
+    /// events.
+    ProfileScope(const char* name, const Device& device = Device())
+        : active_(Profiler::IsEnabled()) {
+        if (active_) {
+            Profiler::GetInstance().BeginScope(name, device);
+        }
+    }
+
+    ~ProfileScope() {
+        if (active_) {
+            Profiler::GetInstance().EndScope();
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    bool active_;
+};
+
+}  // namespace core
+}  // namespace open3d
+
+/// Profiles the enclosing scope, see core::ProfileScope.
+#ifdef OPEN3D_DISABLE_PROFILING
+#define OPEN3D_PROFILE_SCOPE(...) static_cast<void>(0)
+#else
+#define OPEN3D_PROFILE_SCOPE(...)                  \
+    open3d::core::ProfileScope OPEN3D_CONCATENATE( \
+            open3d_profile_scope_, __LINE__)(__VA_ARGS__)
+#endif
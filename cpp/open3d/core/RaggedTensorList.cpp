@@ -0,0 +1,76 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/RaggedTensorList.h"
+
+#include <string>
+
+#include "open3d/core/ShapeUtil.h"
+
+namespace open3d {
+namespace core {
+
+RaggedTensorList::RaggedTensorList(const SizeVector& element_shape,
+                                   Dtype dtype,
+                                   const Device& device)
+    : values_(element_shape, dtype, device),
+      offsets_(TensorList::FromTensor(
+              Tensor::Zeros({1}, Dtype::Int64, Device("CPU:0")))) {}
+
+void RaggedTensorList::Reserve(int64_t num_batches, int64_t num_elements) {
+    values_.Reserve(num_elements);
+    offsets_.Reserve(num_batches + 1);
+}
+
+void RaggedTensorList::PushBack(const Tensor& batch) {
+    values_.Extend(batch);
+    offsets_.PushBack(Tensor::Init<int64_t>(values_.GetSize()));
+}
+
+Tensor RaggedTensorList::operator[](int64_t index) const {
+    // WrapDim asserts index is within range.
+    index = shape_util::WrapDim(index, GetSize());
+    const int64_t* offsets_ptr =
+            offsets_.GetInternalTensor().GetDataPtr<int64_t>();
+    return values_.GetInternalTensor().Slice(0, offsets_ptr[index],
+                                             offsets_ptr[index + 1]);
+}
+
+void RaggedTensorList::Clear() {
+    values_.Clear();
+    offsets_.Resize(1);
+}
+
+std::string RaggedTensorList::ToString() const {
+    return fmt::format(
+            "RaggedTensorList[size: {}, num_elements: {}, element_shape: {}, "
+            "dtype: {}, device: {}]",
+            GetSize(), GetNumElements(), GetElementShape().ToString(),
+            GetDtype().ToString(), GetDevice().ToString());
+}
+
+}  // namespace core
+}  // namespace open3d
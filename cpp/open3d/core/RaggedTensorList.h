@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorList.h"
+
+namespace open3d {
+namespace core {
+
+/// A ragged tensorlist is a list of variable-length batches of elements of the
+/// same shape, e.g. the points observed in each frame of a sequence. All
+/// batches are stored back to back in one TensorList of elements, and the
+/// batch boundaries are stored in an offsets tensor, so that pushing back a
+/// batch is a single copy and no re-concatenation is needed.
+///
+/// Example: batches of 2 and 3 points with element_shape (3,):
+/// - AsTensor().shape: (5, 3)
+/// - GetOffsets()    : [0, 2, 5]
+/// - (*this)[1]      : AsTensor().Slice(0, 2, 5)
+class RaggedTensorList {
+public:
+    /// Useful to support operator[] in a map.
+    RaggedTensorList() : RaggedTensorList(SizeVector({}), Dtype::Float32) {}
+
+    /// Constructs an empty ragged tensorlist.
+    ///
+    /// \param element_shape Shape of the elements in each batch, e.g. {3,}.
+    /// \param dtype Data type of the elements. e.g. Dtype::Float32.
+    /// \param device Device of the elements. e.g. Device("CPU:0").
+    RaggedTensorList(const SizeVector& element_shape,
+                     Dtype dtype,
+                     const Device& device = Device("CPU:0"));
+
+    /// Reserve memory for at least \p num_batches batches with
+    /// \p num_elements elements in total.
+    void Reserve(int64_t num_batches, int64_t num_elements);
+
+    /// Push back a batch of elements. The values will be copied.
+    ///
+    /// \param batch Tensor of shape (N, *element_shape) with the same dtype
+    /// and device as the ragged tensorlist. N may be 0.
+    void PushBack(const Tensor& batch);
+
+    /// Extract the i-th batch of shape (N_i, *element_shape), returning a new
+    /// view.
+    Tensor operator[](int64_t index) const;
+
+    /// Returns all elements of shape (GetNumElements(), *element_shape) with
+    /// shared memory.
+    Tensor AsTensor() const { return values_.AsTensor(); }
+
+    /// Returns the Int64 offsets of shape (GetSize() + 1,) with shared memory.
+    /// Batch i consists of elements [offsets[i], offsets[i + 1]). The offsets
+    /// are always kept on CPU:0, regardless of the device of the elements.
+    Tensor GetOffsets() const { return offsets_.AsTensor(); }
+
+    /// Clear the ragged tensorlist by disgarding all batches.
+    void Clear();
+
+    std::string ToString() const;
+
+    SizeVector GetElementShape() const { return values_.GetElementShape(); }
+
+    Device GetDevice() const { return values_.GetDevice(); }
+
+    Dtype GetDtype() const { return values_.GetDtype(); }
+
+    /// Returns the number of batches.
+    int64_t GetSize() const { return offsets_.GetSize() - 1; }
+
+    /// Returns the total number of elements in all batches.
+    int64_t GetNumElements() const { return values_.GetSize(); }
+
+protected:
+    /// All elements of all batches, stored back to back.
+    TensorList values_;
+
+    /// Scalar Int64 offsets on CPU:0, starting with 0.
+    TensorList offsets_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "open3d/core/Tensor.h"
 
+#include <cmath>
 #include <sstream>
 
 #include "open3d/core/AdvancedIndexing.h"
@@ -33,6 +34,7 @@
 #include "open3d/core/Device.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
+#include "open3d/core/LazyTensor.h"
 #include "open3d/core/NumpyIO.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/SizeVector.h"
@@ -55,6 +57,8 @@ namespace core {
 static DLDataTypeCode DtypeToDLDataTypeCode(const Dtype& dtype) {
     if (dtype == Dtype::Float32) return DLDataTypeCode::kDLFloat;
     if (dtype == Dtype::Float64) return DLDataTypeCode::kDLFloat;
+    if (dtype == Dtype::Float16) return DLDataTypeCode::kDLFloat;
+    if (dtype == Dtype::BFloat16) return DLDataTypeCode::kDLBfloat;
     if (dtype == Dtype::Int8) return DLDataTypeCode::kDLInt;
     if (dtype == Dtype::Int16) return DLDataTypeCode::kDLInt;
     if (dtype == Dtype::Int32) return DLDataTypeCode::kDLInt;
@@ -105,6 +109,8 @@ static Dtype DLDataTypeToDtype(const DLDataType& dltype) {
             break;
         case DLDataTypeCode::kDLFloat:
             switch (dltype.bits) {
+                case 16:
+                    return Dtype::Float16;
                 case 32:
                     return Dtype::Float32;
                 case 64:
@@ -114,6 +120,12 @@ static Dtype DLDataTypeToDtype(const DLDataType& dltype) {
                                       dltype.bits);
             }
             break;
+        case DLDataTypeCode::kDLBfloat:
+            if (dltype.bits == 16) {
+                return Dtype::BFloat16;
+            }
+            utility::LogError("Unsupported kDLBfloat bits {}", dltype.bits);
+            break;
         default:
             utility::LogError("Unsupported dtype code {}", dltype.code);
     }
@@ -237,6 +249,15 @@ Tensor Tensor::Empty(const SizeVector& shape,
     return Tensor(shape, dtype, device);
 }
 
+Tensor Tensor::EmptyPinned(const SizeVector& shape, Dtype dtype) {
+    void* ptr = MemoryManager::MallocPinned(shape.NumElements() *
+                                            dtype.ByteSize());
+    auto blob = std::make_shared<Blob>(Device("CPU:0"), ptr, [ptr](void*) {
+        MemoryManager::FreePinned(ptr);
+    });
+    return Tensor(shape, shape_util::DefaultStrides(shape), ptr, dtype, blob);
+}
+
 Tensor Tensor::Zeros(const SizeVector& shape,
                      Dtype dtype,
                      const Device& device) {
@@ -566,8 +587,32 @@ Tensor Tensor::To(const Device& device, Dtype dtype, bool copy) const {
     return dst_tensor;
 }
 
+std::future<Tensor> Tensor::ToAsync(const Device& device, bool copy) const {
+    // The worker holds a reference to the source, keeping its blob alive.
+    Tensor src = *this;
+    return std::async(std::launch::async, [src, device, copy]() {
+        return src.To(device, copy);
+    });
+}
+
 void Tensor::CopyFrom(const Tensor& other) { AsRvalue() = other; }
 
+LazyTensor Tensor::Lazy() const { return LazyTensor(*this); }
+
+Tensor Tensor::PinMemory() const {
+    if (IsContiguous() && IsPinned()) {
+        return *this;
+    }
+    Tensor dst_tensor = EmptyPinned(shape_, dtype_);
+    kernel::Copy(*this, dst_tensor);
+    return dst_tensor;
+}
+
+bool Tensor::IsPinned() const {
+    return GetDevice().GetType() == Device::DeviceType::CPU &&
+           data_ptr_ != nullptr && MemoryManager::IsPinned(data_ptr_);
+}
+
 Tensor Tensor::Contiguous() const {
     if (IsContiguous()) {
         return *this;
@@ -627,6 +672,12 @@ std::string Tensor::ScalarPtrToString(const void* ptr) const {
         str = *static_cast<const unsigned char*>(ptr) ? "True" : "False";
     } else if (dtype_.IsObject()) {
         str = fmt::format("{}", fmt::ptr(ptr));
+    } else if (dtype_ == Dtype::Float16) {
+        str = fmt::format("{}", static_cast<float>(
+                                        *static_cast<const float16_t*>(ptr)));
+    } else if (dtype_ == Dtype::BFloat16) {
+        str = fmt::format("{}", static_cast<float>(
+                                        *static_cast<const bfloat16_t*>(ptr)));
     } else {
         DISPATCH_DTYPE_TO_TEMPLATE(dtype_, [&]() {
             str = fmt::format("{}", *static_cast<const scalar_t*>(ptr));
@@ -702,6 +753,25 @@ Tensor Tensor::Slice(int64_t dim,
 }
 
 Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
+    // Fast paths for selecting whole rows of a contiguous tensor with a single
+    // 1D index or boolean mask, e.g. points[indices] or points[mask].
+    if (index_tensors.size() == 1 && NumDims() > 0 && IsContiguous() &&
+        index_tensors[0].NumDims() == 1) {
+        const Tensor& index = index_tensors[0];
+        if (index.GetDtype() == Dtype::Int64) {
+            SizeVector dst_shape = shape_;
+            dst_shape[0] = index.GetLength();
+            Tensor dst(dst_shape, dtype_, GetDevice());
+            kernel::IndexGetRows(*this, dst,
+                                 index.To(GetDevice()).Contiguous());
+            return dst;
+        } else if (index.GetDtype() == Dtype::Bool &&
+                   index.GetLength() == shape_[0]) {
+            return kernel::IndexGetMasked(*this,
+                                          index.To(GetDevice()).Contiguous());
+        }
+    }
+
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor dst = Tensor(aip.GetOutputShape(), dtype_, GetDevice());
     kernel::IndexGet(aip.GetTensor(), dst, aip.GetIndexTensors(),
@@ -712,6 +782,22 @@ Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
 
 void Tensor::IndexSet(const std::vector<Tensor>& index_tensors,
                       const Tensor& src_tensor) {
+    // Fast path for writing whole rows of a contiguous tensor with a single 1D
+    // index, when no broadcasting of src_tensor is needed.
+    if (index_tensors.size() == 1 && NumDims() > 0 && IsContiguous() &&
+        index_tensors[0].NumDims() == 1 &&
+        index_tensors[0].GetDtype() == Dtype::Int64 &&
+        src_tensor.GetDtype() == dtype_) {
+        const Tensor& index = index_tensors[0];
+        SizeVector src_shape = shape_;
+        src_shape[0] = index.GetLength();
+        if (src_tensor.GetShape() == src_shape) {
+            kernel::IndexSetRows(src_tensor.To(GetDevice()).Contiguous(),
+                                 *this, index.To(GetDevice()).Contiguous());
+            return;
+        }
+    }
+
     AdvancedIndexPreprocessor aip(*this, index_tensors);
     Tensor pre_processed_dst = aip.GetTensor();
     kernel::IndexSet(src_tensor, pre_processed_dst, aip.GetIndexTensors(),
@@ -793,7 +879,7 @@ Tensor Tensor::Add(const Tensor& value) const {
 
 Tensor Tensor::Add(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Add(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -806,7 +892,7 @@ Tensor Tensor::Add_(const Tensor& value) {
 }
 
 Tensor Tensor::Add_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Add_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -821,7 +907,7 @@ Tensor Tensor::Sub(const Tensor& value) const {
 
 Tensor Tensor::Sub(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Sub(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -834,7 +920,7 @@ Tensor Tensor::Sub_(const Tensor& value) {
 }
 
 Tensor Tensor::Sub_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Sub_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -849,7 +935,7 @@ Tensor Tensor::Mul(const Tensor& value) const {
 
 Tensor Tensor::Mul(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Mul(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -862,7 +948,7 @@ Tensor Tensor::Mul_(const Tensor& value) {
 }
 
 Tensor Tensor::Mul_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Mul_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -877,7 +963,7 @@ Tensor Tensor::Div(const Tensor& value) const {
 
 Tensor Tensor::Div(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = Div(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -890,7 +976,7 @@ Tensor Tensor::Div_(const Tensor& value) {
 }
 
 Tensor Tensor::Div_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Div_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -921,6 +1007,15 @@ Tensor Tensor::Mean(const SizeVector& dims, bool keepdim) const {
     return sum * factor;
 }
 
+std::tuple<Tensor, Tensor> Tensor::MeanVariance(const SizeVector& dims,
+                                                bool keepdim) const {
+    SizeVector dst_shape = shape_util::ReductionShape(shape_, dims, keepdim);
+    Tensor mean(dst_shape, dtype_, GetDevice());
+    Tensor variance(dst_shape, dtype_, GetDevice());
+    kernel::ReductionMeanVariance(*this, mean, variance, dims, keepdim);
+    return std::make_tuple(mean, variance);
+}
+
 Tensor Tensor::Prod(const SizeVector& dims, bool keepdim) const {
     Tensor dst(shape_util::ReductionShape(shape_, dims, keepdim), dtype_,
                GetDevice());
@@ -1123,7 +1218,7 @@ Tensor Tensor::LogicalAnd(const Tensor& value) const {
 
 Tensor Tensor::LogicalAnd(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = LogicalAnd(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1136,7 +1231,7 @@ Tensor Tensor::LogicalAnd_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalAnd_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         LogicalAnd_(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1153,7 +1248,7 @@ Tensor Tensor::LogicalOr(const Tensor& value) const {
 
 Tensor Tensor::LogicalOr(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = LogicalOr(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1166,7 +1261,7 @@ Tensor Tensor::LogicalOr_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalOr_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         LogicalOr_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1182,7 +1277,7 @@ Tensor Tensor::LogicalXor(const Tensor& value) const {
 
 Tensor Tensor::LogicalXor(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor = LogicalXor(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1195,7 +1290,7 @@ Tensor Tensor::LogicalXor_(const Tensor& value) {
 }
 
 Tensor Tensor::LogicalXor_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         LogicalXor_(
                 Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1211,7 +1306,7 @@ Tensor Tensor::Gt(const Tensor& value) const {
 
 Tensor Tensor::Gt(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Gt(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1224,7 +1319,7 @@ Tensor Tensor::Gt_(const Tensor& value) {
 }
 
 Tensor Tensor::Gt_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Gt_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1239,7 +1334,7 @@ Tensor Tensor::Lt(const Tensor& value) const {
 
 Tensor Tensor::Lt(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Lt(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1252,7 +1347,7 @@ Tensor Tensor::Lt_(const Tensor& value) {
 }
 
 Tensor Tensor::Lt_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Lt_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1267,7 +1362,7 @@ Tensor Tensor::Ge(const Tensor& value) const {
 
 Tensor Tensor::Ge(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Ge(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1280,7 +1375,7 @@ Tensor Tensor::Ge_(const Tensor& value) {
 }
 
 Tensor Tensor::Ge_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Ge_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1295,7 +1390,7 @@ Tensor Tensor::Le(const Tensor& value) const {
 
 Tensor Tensor::Le(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Le(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1308,7 +1403,7 @@ Tensor Tensor::Le_(const Tensor& value) {
 }
 
 Tensor Tensor::Le_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Le_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1323,7 +1418,7 @@ Tensor Tensor::Eq(const Tensor& value) const {
 
 Tensor Tensor::Eq(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Eq(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1336,7 +1431,7 @@ Tensor Tensor::Eq_(const Tensor& value) {
 }
 
 Tensor Tensor::Eq_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Eq_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1351,7 +1446,7 @@ Tensor Tensor::Ne(const Tensor& value) const {
 
 Tensor Tensor::Ne(Scalar value) const {
     Tensor dst_tensor;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         dst_tensor =
                 Ne(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
@@ -1364,7 +1459,7 @@ Tensor Tensor::Ne_(const Tensor& value) {
 }
 
 Tensor Tensor::Ne_(Scalar value) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         Ne_(Tensor::Full({}, value.To<scalar_t>(), dtype_, GetDevice()));
     });
     return *this;
@@ -1381,6 +1476,215 @@ std::vector<Tensor> Tensor::NonZeroNumpy() const {
 
 Tensor Tensor::NonZero() const { return kernel::NonZero(*this); }
 
+Tensor Tensor::Sort() const {
+    Tensor dst, indices;
+    kernel::Sort(*this, dst, indices);
+    return dst;
+}
+
+Tensor Tensor::ArgSort() const {
+    Tensor dst, indices;
+    kernel::Sort(*this, dst, indices);
+    return indices;
+}
+
+std::tuple<Tensor, Tensor> Tensor::TopK(int64_t k,
+                                        int64_t dim,
+                                        bool largest,
+                                        bool sorted) const {
+    if (NumDims() == 0) {
+        utility::LogError("TopK: tensor has shape (), no dimension to select.");
+    }
+    dim = shape_util::WrapDim(dim, NumDims());
+    const int64_t last = NumDims() - 1;
+
+    // Select along the rows of a 2D view with dim moved last.
+    Tensor src = Transpose(dim, last).Contiguous();
+    SizeVector shape = src.GetShape();
+    const int64_t n = shape[last];
+    int64_t rows = 1;
+    for (int64_t d = 0; d < last; ++d) {
+        rows *= shape[d];
+    }
+    Tensor values, indices;
+    kernel::TopK(src.Reshape({rows, n}), k, largest, sorted, values, indices);
+
+    shape[last] = k;
+    return std::make_tuple(
+            values.Reshape(shape).Transpose(dim, last).Contiguous(),
+            indices.Reshape(shape).Transpose(dim, last).Contiguous());
+}
+
+std::tuple<Tensor, Tensor> Tensor::KthValue(int64_t k,
+                                            int64_t dim,
+                                            bool keepdim) const {
+    if (NumDims() == 0) {
+        utility::LogError(
+                "KthValue: tensor has shape (), no dimension to select.");
+    }
+    dim = shape_util::WrapDim(dim, NumDims());
+    if (k < 1 || k > shape_[dim]) {
+        utility::LogError("KthValue: k must be in [1, {}], but got {}.",
+                          shape_[dim], k);
+    }
+    Tensor values, indices;
+    std::tie(values, indices) = TopK(k, dim, /*largest=*/false,
+                                     /*sorted=*/false);
+    if (keepdim) {
+        return std::make_tuple(values.Slice(dim, k - 1, k).Contiguous(),
+                               indices.Slice(dim, k - 1, k).Contiguous());
+    }
+    return std::make_tuple(values.IndexExtract(dim, k - 1).Contiguous(),
+                           indices.IndexExtract(dim, k - 1).Contiguous());
+}
+
+Tensor Tensor::Quantile(double q, int64_t dim, bool keepdim) const {
+    if (dtype_ != Dtype::Float32 && dtype_ != Dtype::Float64) {
+        utility::LogError("Quantile: expected Float32 or Float64, but got {}.",
+                          dtype_.ToString());
+    }
+    if (!(q >= 0 && q <= 1)) {
+        utility::LogError("Quantile: q must be in [0, 1], but got {}.", q);
+    }
+    if (NumDims() == 0) {
+        utility::LogError(
+                "Quantile: tensor has shape (), no dimension to reduce.");
+    }
+    dim = shape_util::WrapDim(dim, NumDims());
+    const int64_t n = shape_[dim];
+    if (n == 0) {
+        utility::LogError("Quantile: dimension {} is empty.", dim);
+    }
+
+    // Two selections are cheaper than sorting the rows.
+    const double pos = q * (n - 1);
+    const int64_t lower_pos = static_cast<int64_t>(std::floor(pos));
+    const double frac = pos - lower_pos;
+    Tensor lower = std::get<0>(KthValue(lower_pos + 1, dim, keepdim));
+    if (frac == 0) {
+        return lower;
+    }
+    Tensor upper = std::get<0>(KthValue(lower_pos + 2, dim, keepdim));
+    return lower + (upper - lower) * frac;
+}
+
+std::tuple<Tensor, Tensor, Tensor> Tensor::Unique(bool return_inverse,
+                                                  bool return_counts) const {
+    Tensor sorted, indices;
+    kernel::Sort(*this, sorted, indices);
+    const int64_t n = sorted.GetLength();
+    Device device = GetDevice();
+    if (n == 0) {
+        return std::make_tuple(
+                sorted,
+                return_inverse ? Tensor::Empty({0}, Dtype::Int64, device)
+                               : Tensor(),
+                return_counts ? Tensor::Empty({0}, Dtype::Int64, device)
+                              : Tensor());
+    }
+
+    // A unique element starts wherever the sorted value changes.
+    Tensor starts = sorted.Slice(0, 1, n).Ne(sorted.Slice(0, 0, n - 1))
+                            .NonZero()[0]
+                            .Add_(1);
+    const int64_t num_unique = starts.GetLength() + 1;
+    Tensor offsets = Tensor::Empty({num_unique + 1}, Dtype::Int64, device);
+    offsets.Slice(0, 0, 1).Fill(0);
+    offsets.Slice(0, 1, num_unique) = starts;
+    offsets.Slice(0, num_unique, num_unique + 1).Fill(n);
+
+    Tensor unique = sorted.IndexGet({offsets.Slice(0, 0, num_unique)});
+    Tensor inverse, counts;
+    if (return_inverse) {
+        inverse = Tensor::Empty({n}, Dtype::Int64, device);
+        kernel::SegmentFill(offsets, indices, inverse);
+    }
+    if (return_counts) {
+        counts = offsets.Slice(0, 1, num_unique + 1) -
+                 offsets.Slice(0, 0, num_unique);
+    }
+    return std::make_tuple(unique, inverse, counts);
+}
+
+/// Shared implementation of the Tensor::Segment*() reductions.
+static Tensor SegmentReduce(const Tensor& src,
+                            const Tensor& segment_ids,
+                            int64_t num_segments,
+                            kernel::SegmentReductionOpCode op_code) {
+    if (src.NumDims() == 0) {
+        utility::LogError("Segment reduction does not support 0D tensors.");
+    }
+    if (segment_ids.GetDtype() != Dtype::Int64 ||
+        segment_ids.NumDims() != 1 ||
+        segment_ids.GetLength() != src.GetLength()) {
+        utility::LogError(
+                "segment_ids must be an Int64 tensor of shape {{{}}}, but got "
+                "{} tensor of shape {}.",
+                src.GetLength(), segment_ids.GetDtype().ToString(),
+                segment_ids.GetShape());
+    }
+    if (segment_ids.GetDevice() != src.GetDevice()) {
+        utility::LogError("segment_ids device {} mismatch with device {}.",
+                          segment_ids.GetDevice().ToString(),
+                          src.GetDevice().ToString());
+    }
+    if (num_segments < 0) {
+        utility::LogError("num_segments must be non-negative, but got {}.",
+                          num_segments);
+    }
+
+    const int64_t n = segment_ids.GetLength();
+    if (n > 0) {
+        if (segment_ids[0].Item<int64_t>() < 0 ||
+            segment_ids[n - 1].Item<int64_t>() >= num_segments) {
+            utility::LogError("segment_ids must be in [0, {}).",
+                              num_segments);
+        }
+        if (n > 1 && !segment_ids.Slice(0, 1, n)
+                              .Ge(segment_ids.Slice(0, 0, n - 1))
+                              .All()) {
+            utility::LogError("segment_ids must be sorted.");
+        }
+    }
+
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = num_segments;
+    Tensor dst = Tensor::Empty(dst_shape, src.GetDtype(), src.GetDevice());
+    Tensor offsets = kernel::SegmentOffsets(segment_ids, num_segments);
+    kernel::SegmentReduce(src.Contiguous(), offsets, dst, op_code);
+    return dst;
+}
+
+Tensor Tensor::SegmentSum(const Tensor& segment_ids,
+                          int64_t num_segments) const {
+    return SegmentReduce(*this, segment_ids, num_segments,
+                         kernel::SegmentReductionOpCode::Sum);
+}
+
+Tensor Tensor::SegmentMean(const Tensor& segment_ids,
+                           int64_t num_segments) const {
+    return SegmentReduce(*this, segment_ids, num_segments,
+                         kernel::SegmentReductionOpCode::Mean);
+}
+
+Tensor Tensor::SegmentMax(const Tensor& segment_ids,
+                          int64_t num_segments) const {
+    return SegmentReduce(*this, segment_ids, num_segments,
+                         kernel::SegmentReductionOpCode::Max);
+}
+
+Tensor Tensor::SegmentFirst(const Tensor& segment_ids,
+                            int64_t num_segments) const {
+    return SegmentReduce(*this, segment_ids, num_segments,
+                         kernel::SegmentReductionOpCode::First);
+}
+
+Tensor Tensor::CumSum(int64_t dim, bool exclusive) const {
+    Tensor dst(shape_, kernel::CumSumDtype(dtype_), GetDevice());
+    kernel::CumSum(*this, dst, dim, exclusive);
+    return dst;
+}
+
 bool Tensor::IsNonZero() const {
     if (shape_.NumElements() != 1) {
         utility::LogError(
@@ -1388,7 +1692,7 @@ bool Tensor::IsNonZero() const {
                 "boolean.");
     }
     bool rc = false;
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype_, [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dtype_, [&]() {
         rc = Item<scalar_t>() != static_cast<scalar_t>(0);
     });
     return rc;
@@ -1418,6 +1722,11 @@ Tensor Tensor::FromDLPack(const DLManagedTensor* src) {
         case DLDeviceType::kDLCPU:
             device = Device("CPU", src->dl_tensor.ctx.device_id);
             break;
+        case DLDeviceType::kDLCPUPinned:
+            // Pinned host memory is regular CPU memory that CUDA devices can
+            // also access directly.
+            device = Device("CPU", 0);
+            break;
         case DLDeviceType::kDLGPU:
             device = Device("CUDA", src->dl_tensor.ctx.device_id);
             break;
@@ -1460,8 +1769,8 @@ void Tensor::Save(const std::string& file_name) const {
     NumpyArray(*this).Save(file_name);
 }
 
-Tensor Tensor::Load(const std::string& file_name) {
-    return NumpyArray::Load(file_name).ToTensor();
+Tensor Tensor::Load(const std::string& file_name, MmapMode mmap_mode) {
+    return NumpyArray::Load(file_name, mmap_mode).ToTensor();
 }
 
 bool Tensor::AllClose(const Tensor& other, double rtol, double atol) const {
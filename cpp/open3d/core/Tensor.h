@@ -27,8 +27,10 @@
 #pragma once
 
 #include <cstddef>
+#include <future>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <type_traits>
 
 #include "open3d/core/Blob.h"
@@ -44,6 +46,8 @@
 namespace open3d {
 namespace core {
 
+class LazyTensor;
+
 /// A Tensor is a "view" of a data Blob with shape, stride, data_ptr.
 /// Tensor can also be used to perform numerical operations.
 class Tensor {
@@ -184,6 +188,11 @@ public:
                         Dtype dtype,
                         const Device& device = Device("CPU:0"));
 
+    /// Create a CPU tensor with uninitialized values in page-locked (pinned)
+    /// host memory. Copies of pinned tensors to CUDA devices are asynchronous
+    /// w.r.t. the host and run at full transfer bandwidth. Requires CUDA.
+    static Tensor EmptyPinned(const SizeVector& shape, Dtype dtype);
+
     /// Create a tensor with uninitialized values with the same Dtype and Device
     /// as the other tensor.
     static Tensor EmptyLike(const Tensor& other) {
@@ -415,6 +424,18 @@ public:
     /// and have the targeted dtype.
     Tensor To(const Device& device, Dtype dtype, bool copy = false) const;
 
+    /// Same as To(device, copy), but the copy runs on a worker thread and the
+    /// returned future becomes ready once the destination tensor can be used.
+    /// Large transfers between pageable host memory and CUDA devices are
+    /// chunked and double-buffered through pinned memory.
+    std::future<Tensor> ToAsync(const Device& device, bool copy = false) const;
+
+    /// Returns a LazyTensor wrapping this tensor. Element-wise ops on the
+    /// returned object are recorded instead of executed, and the whole
+    /// expression is evaluated by a single fused kernel when converted back to
+    /// a Tensor, e.g. `Tensor c = (a.Lazy() - mean) * scale + offset;`.
+    LazyTensor Lazy() const;
+
     std::string ToString(bool with_suffix = true,
                          const std::string& indent = "") const;
 
@@ -565,6 +586,13 @@ public:
     /// \param keepdim If true, the reduced dims will be retained as size 1.
     Tensor Mean(const SizeVector& dims, bool keepdim = false) const;
 
+    /// Returns the mean and the population variance of the tensor along the
+    /// given \p dims, computed in a single pass over the data.
+    /// \param dims A list of dimensions to be reduced.
+    /// \param keepdim If true, the reduced dims will be retained as size 1.
+    std::tuple<Tensor, Tensor> MeanVariance(const SizeVector& dims,
+                                            bool keepdim = false) const;
+
     /// Returns the product of the tensor along the given \p dims.
     /// \param dims A list of dimensions to be reduced.
     /// \param keepdim If true, the reduced dims will be retained as size 1.
@@ -811,6 +839,79 @@ public:
     /// tensor.
     Tensor NonZero() const;
 
+    /// Returns a 1D tensor with the elements of the 1D tensor sorted in
+    /// ascending order.
+    Tensor Sort() const;
+
+    /// Returns the Int64 indices that stably sort the 1D tensor in ascending
+    /// order, i.e. t.Sort() == t.IndexGet({t.ArgSort()}).
+    Tensor ArgSort() const;
+
+    /// Returns the \p k largest (or smallest) elements along dimension
+    /// \p dim and their Int64 indices along \p dim, as a tuple {values,
+    /// indices} whose dimension \p dim has size k. If \p sorted, the
+    /// elements are sorted, the largest (smallest) first. Equal elements are
+    /// ordered by their index, and NaN is larger than all other values. The
+    /// selection runs in linear time per row on CPU, so small k are much
+    /// cheaper than a full sort.
+    std::tuple<Tensor, Tensor> TopK(int64_t k,
+                                    int64_t dim = -1,
+                                    bool largest = true,
+                                    bool sorted = true) const;
+
+    /// Returns the \p k-th smallest element (k = 1 is the minimum) along
+    /// dimension \p dim and its Int64 index along \p dim, as a tuple
+    /// {values, indices}. Dimension \p dim is removed unless \p keepdim.
+    std::tuple<Tensor, Tensor> KthValue(int64_t k,
+                                        int64_t dim = -1,
+                                        bool keepdim = false) const;
+
+    /// Returns the \p q-th quantile, 0 <= q <= 1, along dimension \p dim,
+    /// interpolated linearly between the two nearest elements, e.g. q = 0.5
+    /// is the median. Supports Float32 and Float64. Dimension \p dim is
+    /// removed unless \p keepdim.
+    Tensor Quantile(double q, int64_t dim = -1, bool keepdim = false) const;
+
+    /// Finds the unique elements of the 1D tensor.
+    ///
+    /// \param return_inverse If true, also returns the Int64 indices into the
+    /// unique elements that reconstruct the tensor, i.e.
+    /// t == unique.IndexGet({inverse}).
+    /// \param return_counts If true, also returns the Int64 number of
+    /// occurrences of each unique element.
+    /// \return Tuple {unique, inverse, counts}, where unique is sorted in
+    /// ascending order. Outputs that are not requested are empty tensors.
+    std::tuple<Tensor, Tensor, Tensor> Unique(bool return_inverse = false,
+                                              bool return_counts = false) const;
+
+    /// Sums the rows of the tensor {n, ...} per segment.
+    ///
+    /// \param segment_ids Int64 tensor {n} of segment ids sorted in
+    /// non-decreasing order, with values in [0, num_segments).
+    /// \param num_segments Number of segments.
+    /// \return Tensor {num_segments, ...}. Empty segments are 0.
+    Tensor SegmentSum(const Tensor& segment_ids, int64_t num_segments) const;
+
+    /// Averages the rows of the tensor {n, ...} per segment. See SegmentSum().
+    Tensor SegmentMean(const Tensor& segment_ids, int64_t num_segments) const;
+
+    /// Takes the maximum of the rows of the tensor {n, ...} per segment,
+    /// element-wise. See SegmentSum().
+    Tensor SegmentMax(const Tensor& segment_ids, int64_t num_segments) const;
+
+    /// Takes the first row of the tensor {n, ...} of each segment. See
+    /// SegmentSum().
+    Tensor SegmentFirst(const Tensor& segment_ids, int64_t num_segments) const;
+
+    /// Returns the cumulative sum of the tensor along \p dim. Boolean and
+    /// integer tensors are summed in Int64; floating point tensors keep their
+    /// dtype.
+    ///
+    /// \param dim The dimension to sum along.
+    /// \param exclusive If true, element i is the sum of the elements before
+    /// i, and the first element is 0.
+    Tensor CumSum(int64_t dim, bool exclusive = false) const;
+
     /// Evaluate a single-element Tensor as a boolean value. This can be used to
     /// implement Tensor.__bool__() in Python, e.g.
     /// ```python
@@ -891,6 +992,13 @@ public:
         return values;
     }
 
+    /// Returns a contiguous copy of the tensor in pinned host memory. If the
+    /// tensor is already a contiguous pinned tensor, it is returned directly.
+    Tensor PinMemory() const;
+
+    /// Returns true if the tensor's data lives in pinned host memory.
+    bool IsPinned() const;
+
     /// Returns True if the underlying memory buffer is contiguous. A contiguous
     /// Tensor's data_ptr_ does not need to point to the beginning of blob_.
     inline bool IsContiguous() const {
@@ -903,7 +1011,8 @@ public:
     Tensor Contiguous() const;
 
     /// Computes matrix multiplication with *this and rhs and returns the
-    /// result.
+    /// result. Leading batch dimensions of operands with more than 2
+    /// dimensions are broadcasted.
     Tensor Matmul(const Tensor& rhs) const;
 
     /// Solves the linear system AX = B with LU decomposition and returns X.
@@ -1053,8 +1162,27 @@ public:
     /// Save tensor to numpy's npy format.
     void Save(const std::string& file_name) const;
 
+    /// Memory mapping mode of Load().
+    enum class MmapMode {
+        /// Read the whole file into newly allocated memory.
+        None,
+        /// Map the file read-only. Pages are loaded on first access and shared
+        /// between processes mapping the same file. The Tensor must not be
+        /// modified, writing to it crashes the program.
+        ReadOnly,
+        /// Map the file copy-on-write. Modified pages are private to the
+        /// process and are never written back to the file.
+        CopyOnWrite,
+    };
+
     /// Load tensor from numpy's npy format.
-    static Tensor Load(const std::string& file_name);
+    ///
+    /// \param file_name Path of the .npy file.
+    /// \param mmap_mode If not MmapMode::None, the returned CPU Tensor is
+    /// backed directly by the memory-mapped file instead of a copy. The file
+    /// stays mapped as long as the Tensor's blob is alive.
+    static Tensor Load(const std::string& file_name,
+                       MmapMode mmap_mode = MmapMode::None);
 
     /// Assert that the Tensor has the specified shape.
     void AssertShape(const SizeVector& expected_shape,
@@ -1182,7 +1310,7 @@ inline bool Tensor::Item() const {
 
 template <typename S>
 inline void Tensor::Fill(S v) {
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(GetDtype(), [&]() {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(GetDtype(), [&]() {
         scalar_t casted_v = static_cast<scalar_t>(v);
         Tensor tmp(std::vector<scalar_t>({casted_v}), SizeVector({}),
                    GetDtype(), GetDevice());
@@ -26,6 +26,7 @@
 
 #include "open3d/core/TensorList.h"
 
+#include <algorithm>
 #include <string>
 
 #include "open3d/core/SizeVector.h"
@@ -90,6 +91,15 @@ Tensor TensorList::AsTensor() const {
     return internal_tensor_.Slice(0, 0, size_);
 }
 
+void TensorList::Reserve(int64_t new_reserved_size) {
+    AssertIsResizable(*this, __FUNCTION__);
+
+    // Expand as if resizing to new_reserved_size, but keep the current size.
+    int64_t old_size = size_;
+    ResizeWithExpand(std::max(old_size, new_reserved_size));
+    size_ = old_size;
+}
+
 void TensorList::Resize(int64_t new_size) {
     AssertIsResizable(*this, __FUNCTION__);
 
@@ -147,6 +157,35 @@ void TensorList::Extend(const TensorList& other) {
             other.AsTensor().Slice(0, 0, other_size);
 }
 
+void TensorList::Extend(const Tensor& tensors) {
+    AssertIsResizable(*this, __FUNCTION__);
+
+    // Check consistency
+    SizeVector shape = tensors.GetShape();
+    if (shape.size() == 0 ||
+        SizeVector(std::next(shape.begin()), shape.end()) != element_shape_) {
+        utility::LogError(
+                "TensorList has element shape {}, but tensors have shape {}.",
+                element_shape_, shape);
+    }
+    if (GetDevice() != tensors.GetDevice()) {
+        utility::LogError("TensorList device {} and {} are inconsistent.",
+                          GetDevice().ToString(),
+                          tensors.GetDevice().ToString());
+    }
+    if (GetDtype() != tensors.GetDtype()) {
+        utility::LogError("TensorList dtype {} and {} are inconsistent.",
+                          GetDtype().ToString(), tensors.GetDtype().ToString());
+    }
+
+    // tensors may be a view of the internal tensor. It keeps the old buffer
+    // alive if *this is reallocated, and otherwise does not overlap with the
+    // newly added range.
+    int64_t num_tensors = shape[0];
+    ResizeWithExpand(size_ + num_tensors);
+    internal_tensor_.Slice(0, size_ - num_tensors, size_) = tensors;
+}
+
 TensorList TensorList::Concatenate(const TensorList& a, const TensorList& b) {
     // A full copy of a is required.
     TensorList result = a.Clone();
@@ -208,8 +208,17 @@ public:
     TensorList Clone() const;
 
     /// Return the reference of the contained valid tensors with shared memory.
+    /// No data is copied. The view remains valid after the tensorlist grows,
+    /// but it will not see elements added after it was created.
     Tensor AsTensor() const;
 
+    /// Reserve memory for at least \p new_reserved_size tensors. The reserved
+    /// size follows the same growth policy as PushBack(), so the tensorlist
+    /// can grow up to \p new_reserved_size tensors without reallocating. If
+    /// enough memory is already reserved, no operation will be performed. This
+    /// operation is only valid for resizable tensorlist.
+    void Reserve(int64_t new_reserved_size);
+
     /// Resize tensorlist.
     /// If the size increases, the increased part will be initialized with 0.
     /// If the size decreases, the reserved_size_ remain unchanged. This
@@ -230,6 +239,13 @@ public:
     /// resizable tensorlist.
     void Extend(const TensorList& other);
 
+    /// Extend the current tensorlist with the tensors stacked along the first
+    /// dimension of \p tensors, i.e. tensors[0], tensors[1], ... are appended
+    /// with a single copy. \p tensors must have shape (N, *element_shape) and
+    /// the same dtype and device as the tensorlist. This operation is only
+    /// valid for resizable tensorlist.
+    void Extend(const Tensor& tensors);
+
     /// Concatenate two tensorlists.
     /// Return a new tensorlists with data copied.
     /// Two tensorlists must have the same element_shape, type, and device.
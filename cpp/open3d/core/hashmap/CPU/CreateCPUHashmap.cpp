@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/core/hashmap/CPU/OpenAddressingHashmap.h"
 #include "open3d/core/hashmap/CPU/TBBHashmap.h"
 #include "open3d/core/hashmap/Dispatch.h"
 #include "open3d/core/hashmap/Hashmap.h"
@@ -40,7 +41,8 @@ std::shared_ptr<DeviceHashmap> CreateCPUHashmap(
         const SizeVector& element_shape_value,
         const Device& device,
         const HashmapBackend& backend) {
-    if (backend != HashmapBackend::Default && backend != HashmapBackend::TBB) {
+    if (backend != HashmapBackend::Default && backend != HashmapBackend::TBB &&
+        backend != HashmapBackend::OpenAddressing) {
         utility::LogError("Unsupported backend for CPU hashmap.");
     }
 
@@ -52,8 +54,14 @@ std::shared_ptr<DeviceHashmap> CreateCPUHashmap(
 
     std::shared_ptr<DeviceHashmap> device_hashmap_ptr;
     DISPATCH_DTYPE_AND_DIM_TO_TEMPLATE(dtype_key, dim, [&] {
-        device_hashmap_ptr = std::make_shared<TBBHashmap<key_t, hash_t>>(
-                init_capacity, dsize_key, dsize_value, device);
+        if (backend == HashmapBackend::OpenAddressing) {
+            device_hashmap_ptr =
+                    std::make_shared<OpenAddressingHashmap<key_t, hash_t>>(
+                            init_capacity, dsize_key, dsize_value, device);
+        } else {
+            device_hashmap_ptr = std::make_shared<TBBHashmap<key_t, hash_t>>(
+                    init_capacity, dsize_key, dsize_value, device);
+        }
     });
     return device_hashmap_ptr;
 }
@@ -0,0 +1,750 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "open3d/core/hashmap/CPU/CPUHashmapBufferAccessor.hpp"
+#include "open3d/core/hashmap/DeviceHashmap.h"
+
+namespace open3d {
+namespace core {
+
+/// Lock-free open-addressing hashmap for CPU.
+///
+/// The table is a flat array of cache-line sized buckets, each holding
+/// kSlotsPerBucket slot tags (1 byte) and buffer addresses. A tag is either
+/// empty, busy (claimed by an inserting thread), a tombstone, or a 7-bit
+/// fingerprint of the key hash. Buckets are probed linearly. Threads claim
+/// empty slots with a compare-and-swap on the tag, so concurrent inserts of
+/// the same key always race for the same slot and never create duplicates.
+/// Keys and values are stored in the shared HashmapBuffer.
+///
+/// With HashmapGrowthPolicy::incremental, growing keeps buffer addresses
+/// and moves the current table aside. Its buckets are then migrated
+/// migration_batch_size at a time at the start of each Insert, Activate,
+/// Find and Erase call, and both tables are searched until it is done.
+template <typename Key, typename Hash>
+class OpenAddressingHashmap : public DeviceHashmap {
+public:
+    OpenAddressingHashmap(int64_t init_capacity,
+                          int64_t dsize_key,
+                          int64_t dsize_value,
+                          const Device& device);
+    ~OpenAddressingHashmap();
+
+    void Rehash(int64_t buckets) override;
+
+    void Insert(const void* input_keys,
+                const void* input_values,
+                addr_t* output_addrs,
+                bool* output_masks,
+                int64_t count) override;
+
+    void Activate(const void* input_keys,
+                  addr_t* output_addrs,
+                  bool* output_masks,
+                  int64_t count) override;
+
+    void Find(const void* input_keys,
+              addr_t* output_addrs,
+              bool* output_masks,
+              int64_t count) override;
+
+    void Erase(const void* input_keys,
+               bool* output_masks,
+               int64_t count) override;
+
+    int64_t GetActiveIndices(addr_t* output_indices) override;
+
+    void Clear() override;
+
+    bool SupportsIncrementalRehash() const override { return true; }
+    bool IsRehashing() const override { return old_table_.bucket_count_ > 0; }
+
+    int64_t Size() const override;
+    int64_t GetBucketCount() const override;
+    /// During an incremental migration, only the new table is counted.
+    std::vector<int64_t> BucketSizes() const override;
+    /// Counts the buckets visited from the home bucket of each key, in both
+    /// tables during an incremental migration.
+    std::vector<int64_t> ProbeLengthHistogram() const override;
+    float LoadFactor() const override;
+
+protected:
+    static constexpr int kSlotsPerBucket = 12;
+    static constexpr int kBucketAlignment = 64;
+    /// Maximum fraction of slots (including tombstones) in use.
+    static constexpr float kMaxLoadFactor = 0.75f;
+
+    static constexpr uint8_t kEmpty = 0;
+    static constexpr uint8_t kBusy = 1;
+    static constexpr uint8_t kTombstone = 2;
+    static constexpr uint8_t kFingerprintBit = 0x80;
+
+    struct alignas(64) Bucket {
+        // 16 tags so that they can be matched by one SSE2 comparison.
+        std::atomic<uint8_t> tags_[16];
+        addr_t addrs_[kSlotsPerBucket];
+    };
+    static_assert(sizeof(Bucket) == kBucketAlignment,
+                  "Bucket must occupy exactly one cache line.");
+
+    /// Power-of-two array of buckets.
+    struct Table {
+        void Allocate(int64_t bucket_count);
+        void Release();
+        void Reset() {
+            std::memset(static_cast<void*>(buckets_), 0,
+                        sizeof(Bucket) * bucket_count_);
+        }
+
+        /// Bucket storage, aligned to kBucketAlignment inside memory_.
+        std::vector<uint8_t> memory_;
+        Bucket* buckets_ = nullptr;
+        int64_t bucket_count_ = 0;
+    };
+
+    enum class EraseResult { NotFound, Erased, Lost };
+
+    /// Mixes the key hash so that both the bucket index (low bits) and the
+    /// fingerprint (high bits) are well distributed.
+    static uint64_t Mix(uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    static uint8_t Fingerprint(uint64_t h) {
+        return kFingerprintBit | static_cast<uint8_t>(h >> 57);
+    }
+
+    /// Smallest power-of-two bucket count keeping the load factor below
+    /// kMaxLoadFactor at full \p capacity.
+    static int64_t BucketCountForCapacity(int64_t capacity);
+
+    /// Bitmask of the slots in the bucket whose tag equals \p tag.
+    static uint32_t MatchTags(const Bucket& bucket, uint8_t tag);
+
+    const Key& KeyAt(addr_t addr) const {
+        return *static_cast<const Key*>(
+                buffer_ctx_->ExtractIterator(addr).first);
+    }
+
+    /// Looks up a key in \p table. Must not run concurrently with writers
+    /// to the same table.
+    bool FindIn(const Table& table,
+                const Key& key,
+                uint64_t h,
+                addr_t& addr) const;
+
+    /// Replaces the slot of a key in \p table with a tombstone. Lost means
+    /// that another thread erased the same key first.
+    EraseResult EraseIn(Table& table,
+                        const Key& key,
+                        uint64_t h,
+                        addr_t& addr);
+
+    /// Publishes an existing buffer address in the first free slot of
+    /// \p table without checking for duplicates.
+    void PlaceIn(Table& table, uint64_t h, addr_t addr);
+
+    /// Writes the key and value of input \p i to a newly allocated buffer
+    /// entry, and publishes it in a slot claimed by the calling thread.
+    addr_t InsertAt(Bucket& bucket,
+                    int slot,
+                    uint8_t fingerprint,
+                    const Key& key,
+                    const void* input_values,
+                    int64_t i);
+
+    void InsertImpl(const void* input_keys,
+                    const void* input_values,
+                    addr_t* output_addrs,
+                    bool* output_masks,
+                    int64_t count);
+
+    void Allocate(int64_t capacity);
+    void AllocateBuffer(int64_t capacity);
+
+    /// Grows the buffers to \p capacity keeping all addresses, and starts
+    /// migrating the current table into a new one.
+    void StartMigration(int64_t capacity);
+    /// Migrates up to \p max_buckets buckets of the old table.
+    void Migrate(int64_t max_buckets);
+    void FinishMigration() { Migrate(old_table_.bucket_count_); }
+
+    Table table_;
+    /// Table being migrated, empty if no migration is in progress. Buckets
+    /// before migrated_buckets_ have been copied to table_.
+    Table old_table_;
+    int64_t migrated_buckets_ = 0;
+
+    std::atomic<int64_t> tombstone_count_;
+
+    std::shared_ptr<CPUHashmapBufferAccessor> buffer_ctx_;
+};
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Table::Allocate(int64_t bucket_count) {
+    // C++14 operator new does not honor over-alignment, so align manually.
+    bucket_count_ = bucket_count;
+    memory_.assign(sizeof(Bucket) * bucket_count_ + kBucketAlignment, 0);
+    uintptr_t base = reinterpret_cast<uintptr_t>(memory_.data());
+    base = (base + kBucketAlignment - 1) & ~uintptr_t(kBucketAlignment - 1);
+    buckets_ = reinterpret_cast<Bucket*>(base);
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Table::Release() {
+    std::vector<uint8_t>().swap(memory_);
+    buckets_ = nullptr;
+    bucket_count_ = 0;
+}
+
+template <typename Key, typename Hash>
+OpenAddressingHashmap<Key, Hash>::OpenAddressingHashmap(
+        int64_t init_capacity,
+        int64_t dsize_key,
+        int64_t dsize_value,
+        const Device& device)
+    : DeviceHashmap(init_capacity, dsize_key, dsize_value, device) {
+    Allocate(init_capacity);
+}
+
+template <typename Key, typename Hash>
+OpenAddressingHashmap<Key, Hash>::~OpenAddressingHashmap() {}
+
+template <typename Key, typename Hash>
+int64_t OpenAddressingHashmap<Key, Hash>::Size() const {
+    return buffer_ctx_->HeapCounter();
+}
+
+template <typename Key, typename Hash>
+int64_t OpenAddressingHashmap<Key, Hash>::BucketCountForCapacity(
+        int64_t capacity) {
+    int64_t min_buckets = int64_t(
+            std::ceil(float(std::max<int64_t>(capacity, 1)) /
+                      (kMaxLoadFactor * kSlotsPerBucket)));
+    int64_t bucket_count = 1;
+    while (bucket_count < min_buckets) {
+        bucket_count <<= 1;
+    }
+    return bucket_count;
+}
+
+template <typename Key, typename Hash>
+uint32_t OpenAddressingHashmap<Key, Hash>::MatchTags(const Bucket& bucket,
+                                                     uint8_t tag) {
+#if defined(__SSE2__)
+    // Tags are only read here; concurrent writers are excluded by the
+    // callers, so a plain vector load of the atomics is sufficient.
+    __m128i tags = _mm_load_si128(reinterpret_cast<const __m128i*>(
+            static_cast<const void*>(bucket.tags_)));
+    uint32_t mask = static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(tags, _mm_set1_epi8(tag))));
+    return mask & ((1u << kSlotsPerBucket) - 1);
+#else
+    uint32_t mask = 0;
+    for (int s = 0; s < kSlotsPerBucket; ++s) {
+        mask |= uint32_t(bucket.tags_[s].load(std::memory_order_relaxed) ==
+                         tag)
+                << s;
+    }
+    return mask;
+#endif
+}
+
+template <typename Key, typename Hash>
+bool OpenAddressingHashmap<Key, Hash>::FindIn(const Table& table,
+                                              const Key& key,
+                                              uint64_t h,
+                                              addr_t& addr) const {
+    const uint8_t fingerprint = Fingerprint(h);
+    const int64_t mask = table.bucket_count_ - 1;
+
+    int64_t b = static_cast<int64_t>(h) & mask;
+    for (int64_t probe = 0; probe < table.bucket_count_; ++probe) {
+        const Bucket& bucket = table.buckets_[b];
+        uint32_t matches = MatchTags(bucket, fingerprint);
+        for (int s = 0; matches != 0; ++s, matches >>= 1) {
+            if ((matches & 1) && KeyAt(bucket.addrs_[s]) == key) {
+                addr = bucket.addrs_[s];
+                return true;
+            }
+        }
+        // Slots never return to empty, so the key cannot be further along
+        // the probe sequence once an empty slot is seen.
+        if (MatchTags(bucket, kEmpty)) {
+            return false;
+        }
+        b = (b + 1) & mask;
+    }
+    return false;
+}
+
+template <typename Key, typename Hash>
+typename OpenAddressingHashmap<Key, Hash>::EraseResult
+OpenAddressingHashmap<Key, Hash>::EraseIn(Table& table,
+                                          const Key& key,
+                                          uint64_t h,
+                                          addr_t& addr) {
+    const uint8_t fingerprint = Fingerprint(h);
+    const int64_t mask = table.bucket_count_ - 1;
+
+    int64_t b = static_cast<int64_t>(h) & mask;
+    for (int64_t probe = 0; probe < table.bucket_count_; ++probe) {
+        Bucket& bucket = table.buckets_[b];
+        for (int s = 0; s < kSlotsPerBucket; ++s) {
+            uint8_t tag = bucket.tags_[s].load(std::memory_order_acquire);
+            if (tag == kEmpty) {
+                return EraseResult::NotFound;
+            }
+            if (tag == fingerprint && KeyAt(bucket.addrs_[s]) == key) {
+                // Only one of several threads erasing the same key wins.
+                if (!bucket.tags_[s].compare_exchange_strong(tag,
+                                                             kTombstone)) {
+                    return EraseResult::Lost;
+                }
+                addr = bucket.addrs_[s];
+                return EraseResult::Erased;
+            }
+        }
+        b = (b + 1) & mask;
+    }
+    return EraseResult::NotFound;
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::PlaceIn(Table& table,
+                                               uint64_t h,
+                                               addr_t addr) {
+    const int64_t mask = table.bucket_count_ - 1;
+
+    int64_t b = static_cast<int64_t>(h) & mask;
+    for (int64_t probe = 0; probe < table.bucket_count_; ++probe) {
+        Bucket& bucket = table.buckets_[b];
+        for (int s = 0; s < kSlotsPerBucket; ++s) {
+            uint8_t tag = kEmpty;
+            if (bucket.tags_[s].compare_exchange_strong(tag, kBusy)) {
+                bucket.addrs_[s] = addr;
+                bucket.tags_[s].store(Fingerprint(h),
+                                      std::memory_order_release);
+                return;
+            }
+        }
+        b = (b + 1) & mask;
+    }
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Insert(const void* input_keys,
+                                              const void* input_values,
+                                              addr_t* output_addrs,
+                                              bool* output_masks,
+                                              int64_t count) {
+    Migrate(this->growth_policy_.migration_batch_size);
+
+    int64_t new_size = Size() + count;
+    if (new_size > this->capacity_) {
+        int64_t expected_buckets = this->GetExpectedBucketCount(new_size);
+        if (this->growth_policy_.incremental) {
+            float avg_capacity_per_bucket =
+                    float(this->capacity_) / float(GetBucketCount());
+            StartMigration(int64_t(
+                    std::ceil(expected_buckets * avg_capacity_per_bucket)));
+        } else {
+            Rehash(expected_buckets);
+        }
+    } else if (new_size + tombstone_count_.load() >
+               kMaxLoadFactor * table_.bucket_count_ * kSlotsPerBucket) {
+        // Too many tombstones: rebuild to shorten probe sequences.
+        if (this->growth_policy_.incremental) {
+            StartMigration(this->capacity_);
+        } else {
+            Rehash(GetBucketCount());
+        }
+    }
+    InsertImpl(input_keys, input_values, output_addrs, output_masks, count);
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Activate(const void* input_keys,
+                                                addr_t* output_addrs,
+                                                bool* output_masks,
+                                                int64_t count) {
+    Insert(input_keys, nullptr, output_addrs, output_masks, count);
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Find(const void* input_keys,
+                                            addr_t* output_addrs,
+                                            bool* output_masks,
+                                            int64_t count) {
+    Migrate(this->growth_policy_.migration_batch_size);
+
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    const bool rehashing = IsRehashing();
+
+#pragma omp parallel for
+    for (int64_t i = 0; i < count; ++i) {
+        const Key& key = input_keys_templated[i];
+        const uint64_t h = Mix(Hash()(key));
+        addr_t addr = 0;
+        output_masks[i] = FindIn(table_, key, h, addr) ||
+                          (rehashing && FindIn(old_table_, key, h, addr));
+        output_addrs[i] = addr;
+    }
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Erase(const void* input_keys,
+                                             bool* output_masks,
+                                             int64_t count) {
+    Migrate(this->growth_policy_.migration_batch_size);
+
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    const bool rehashing = IsRehashing();
+
+#pragma omp parallel for
+    for (int64_t i = 0; i < count; ++i) {
+        const Key& key = input_keys_templated[i];
+        const uint64_t h = Mix(Hash()(key));
+        addr_t addr = 0;
+
+        EraseResult result = EraseIn(table_, key, h, addr);
+        if (result == EraseResult::Erased) {
+            tombstone_count_.fetch_add(1);
+            if (rehashing) {
+                // Also drop the stale copy left in a migrated old bucket.
+                addr_t old_addr;
+                EraseIn(old_table_, key, h, old_addr);
+            }
+        } else if (result == EraseResult::NotFound && rehashing) {
+            result = EraseIn(old_table_, key, h, addr);
+        }
+
+        output_masks[i] = (result == EraseResult::Erased);
+        if (output_masks[i]) {
+            buffer_ctx_->DeviceFree(addr);
+        }
+    }
+}
+
+template <typename Key, typename Hash>
+int64_t OpenAddressingHashmap<Key, Hash>::GetActiveIndices(
+        addr_t* output_indices) {
+    int64_t count = 0;
+    auto collect = [&](const Table& table, int64_t begin) {
+        for (int64_t b = begin; b < table.bucket_count_; ++b) {
+            const Bucket& bucket = table.buckets_[b];
+            for (int s = 0; s < kSlotsPerBucket; ++s) {
+                if (bucket.tags_[s].load(std::memory_order_relaxed) &
+                    kFingerprintBit) {
+                    output_indices[count++] = bucket.addrs_[s];
+                }
+            }
+        }
+    };
+    collect(table_, 0);
+    collect(old_table_, migrated_buckets_);
+    return count;
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Clear() {
+    old_table_.Release();
+    table_.Reset();
+    tombstone_count_ = 0;
+    buffer_ctx_->Reset();
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Rehash(int64_t buckets) {
+    FinishMigration();
+
+    int64_t iterator_count = Size();
+
+    Tensor active_keys;
+    Tensor active_values;
+
+    if (iterator_count > 0) {
+        Tensor active_addrs({iterator_count}, Dtype::Int32, this->device_);
+        GetActiveIndices(static_cast<addr_t*>(active_addrs.GetDataPtr()));
+
+        Tensor active_indices = active_addrs.To(Dtype::Int64);
+        active_keys = this->GetKeyBuffer().IndexGet({active_indices});
+        active_values = this->GetValueBuffer().IndexGet({active_indices});
+    }
+
+    float avg_capacity_per_bucket =
+            float(this->capacity_) / float(GetBucketCount());
+    int64_t new_capacity =
+            int64_t(std::ceil(buckets * avg_capacity_per_bucket));
+
+    Allocate(new_capacity);
+
+    if (iterator_count > 0) {
+        Tensor output_addrs({iterator_count}, Dtype::Int32, this->device_);
+        Tensor output_masks({iterator_count}, Dtype::Bool, this->device_);
+
+        InsertImpl(active_keys.GetDataPtr(), active_values.GetDataPtr(),
+                   static_cast<addr_t*>(output_addrs.GetDataPtr()),
+                   output_masks.GetDataPtr<bool>(), iterator_count);
+    }
+}
+
+template <typename Key, typename Hash>
+int64_t OpenAddressingHashmap<Key, Hash>::GetBucketCount() const {
+    return table_.bucket_count_;
+}
+
+template <typename Key, typename Hash>
+std::vector<int64_t> OpenAddressingHashmap<Key, Hash>::BucketSizes() const {
+    std::vector<int64_t> ret(table_.bucket_count_, 0);
+    for (int64_t b = 0; b < table_.bucket_count_; ++b) {
+        for (int s = 0; s < kSlotsPerBucket; ++s) {
+            ret[b] += (table_.buckets_[b].tags_[s].load(
+                               std::memory_order_relaxed) &
+                       kFingerprintBit) != 0;
+        }
+    }
+    return ret;
+}
+
+template <typename Key, typename Hash>
+std::vector<int64_t> OpenAddressingHashmap<Key, Hash>::ProbeLengthHistogram()
+        const {
+    std::vector<int64_t> histogram;
+    for (const Table* table : {&table_, &old_table_}) {
+        const int64_t mask = table->bucket_count_ - 1;
+        for (int64_t b = 0; b < table->bucket_count_; ++b) {
+            const Bucket& bucket = table->buckets_[b];
+            for (int s = 0; s < kSlotsPerBucket; ++s) {
+                if ((bucket.tags_[s].load(std::memory_order_relaxed) &
+                     kFingerprintBit) == 0) {
+                    continue;
+                }
+                const Key& key = KeyAt(bucket.addrs_[s]);
+                const int64_t home =
+                        static_cast<int64_t>(Mix(Hash()(key))) & mask;
+                const size_t probe_length = size_t((b - home) & mask) + 1;
+                if (probe_length > histogram.size()) {
+                    histogram.resize(probe_length, 0);
+                }
+                ++histogram[probe_length - 1];
+            }
+        }
+    }
+    return histogram;
+}
+
+template <typename Key, typename Hash>
+float OpenAddressingHashmap<Key, Hash>::LoadFactor() const {
+    return float(Size()) / float(table_.bucket_count_);
+}
+
+template <typename Key, typename Hash>
+addr_t OpenAddressingHashmap<Key, Hash>::InsertAt(Bucket& bucket,
+                                                  int slot,
+                                                  uint8_t fingerprint,
+                                                  const Key& key,
+                                                  const void* input_values,
+                                                  int64_t i) {
+    addr_t dst_kv_addr = buffer_ctx_->DeviceAllocate();
+    auto dst_kv_iter = buffer_ctx_->ExtractIterator(dst_kv_addr);
+
+    // Publish the key before the fingerprint so that threads waiting on this
+    // slot can compare against it.
+    *static_cast<Key*>(dst_kv_iter.first) = key;
+    bucket.addrs_[slot] = dst_kv_addr;
+    bucket.tags_[slot].store(fingerprint, std::memory_order_release);
+
+    // Copy/reset non-templated value in buffer
+    uint8_t* dst_value = static_cast<uint8_t*>(dst_kv_iter.second);
+    if (input_values != nullptr) {
+        const uint8_t* src_value = static_cast<const uint8_t*>(input_values) +
+                                   this->dsize_value_ * i;
+        std::memcpy(dst_value, src_value, this->dsize_value_);
+    } else {
+        std::memset(dst_value, 0, this->dsize_value_);
+    }
+    return dst_kv_addr;
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::InsertImpl(const void* input_keys,
+                                                  const void* input_values,
+                                                  addr_t* output_addrs,
+                                                  bool* output_masks,
+                                                  int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    const int64_t mask = table_.bucket_count_ - 1;
+    const bool rehashing = IsRehashing();
+
+#pragma omp parallel for
+    for (int64_t i = 0; i < count; ++i) {
+        output_addrs[i] = 0;
+        output_masks[i] = false;
+
+        const Key& key = input_keys_templated[i];
+        const uint64_t h = Mix(Hash()(key));
+        const uint8_t fingerprint = Fingerprint(h);
+
+        // Keys that are not migrated yet only live in the old table, which
+        // is read-only here.
+        addr_t old_addr;
+        bool done = rehashing && FindIn(old_table_, key, h, old_addr);
+
+        int64_t b = static_cast<int64_t>(h) & mask;
+        for (int64_t probe = 0; probe < table_.bucket_count_ && !done;
+             ++probe) {
+            Bucket& bucket = table_.buckets_[b];
+            for (int s = 0; s < kSlotsPerBucket && !done;) {
+                uint8_t tag = bucket.tags_[s].load(std::memory_order_acquire);
+                if (tag == kEmpty) {
+                    if (bucket.tags_[s].compare_exchange_strong(
+                                tag, kBusy, std::memory_order_acq_rel)) {
+                        output_addrs[i] = InsertAt(bucket, s, fingerprint, key,
+                                                   input_values, i);
+                        output_masks[i] = true;
+                        done = true;
+                    }
+                    // A failed claim re-examines the same slot.
+                    continue;
+                }
+
+                // Another thread is writing this slot: wait for its key.
+                while (tag == kBusy) {
+                    tag = bucket.tags_[s].load(std::memory_order_acquire);
+                }
+                // Duplicate key.
+                done = (tag == fingerprint && KeyAt(bucket.addrs_[s]) == key);
+                ++s;
+            }
+            b = (b + 1) & mask;
+        }
+    }
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::AllocateBuffer(int64_t capacity) {
+    this->capacity_ = capacity;
+
+    this->buffer_ =
+            std::make_shared<HashmapBuffer>(this->capacity_, this->dsize_key_,
+                                            this->dsize_value_, this->device_);
+
+    buffer_ctx_ = std::make_shared<CPUHashmapBufferAccessor>(
+            this->capacity_, this->dsize_key_, this->dsize_value_,
+            this->buffer_->GetKeyBuffer(), this->buffer_->GetValueBuffer(),
+            this->buffer_->GetHeap());
+    buffer_ctx_->Reset();
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Allocate(int64_t capacity) {
+    AllocateBuffer(capacity);
+
+    old_table_.Release();
+    table_.Allocate(BucketCountForCapacity(capacity));
+    tombstone_count_ = 0;
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::StartMigration(int64_t capacity) {
+    FinishMigration();
+
+    if (capacity > this->capacity_) {
+        // Grow the buffers in place of a rehash, so that existing addresses
+        // and the heap of free addresses remain valid.
+        Tensor old_keys = this->buffer_->GetKeyBuffer();
+        Tensor old_values = this->buffer_->GetValueBuffer();
+        Tensor old_heap = this->buffer_->GetHeap();
+        const int old_heap_counter = buffer_ctx_->HeapCounter();
+        const int64_t old_capacity = this->capacity_;
+
+        AllocateBuffer(capacity);
+        std::memcpy(buffer_ctx_->keys_, old_keys.GetDataPtr(),
+                    old_capacity * this->dsize_key_);
+        std::memcpy(buffer_ctx_->values_, old_values.GetDataPtr(),
+                    old_capacity * this->dsize_value_);
+        std::memcpy(buffer_ctx_->heap_, old_heap.GetDataPtr(),
+                    old_capacity * sizeof(addr_t));
+        buffer_ctx_->heap_counter_ = old_heap_counter;
+    }
+
+    old_table_ = std::move(table_);
+    table_.Allocate(BucketCountForCapacity(this->capacity_));
+    migrated_buckets_ = 0;
+    tombstone_count_ = 0;
+
+    Migrate(this->growth_policy_.migration_batch_size);
+}
+
+template <typename Key, typename Hash>
+void OpenAddressingHashmap<Key, Hash>::Migrate(int64_t max_buckets) {
+    if (!IsRehashing()) {
+        return;
+    }
+
+    const int64_t begin = migrated_buckets_;
+    const int64_t end =
+            std::min(old_table_.bucket_count_, begin + max_buckets);
+
+#pragma omp parallel for
+    for (int64_t b = begin; b < end; ++b) {
+        const Bucket& bucket = old_table_.buckets_[b];
+        for (int s = 0; s < kSlotsPerBucket; ++s) {
+            if (bucket.tags_[s].load(std::memory_order_relaxed) &
+                kFingerprintBit) {
+                addr_t addr = bucket.addrs_[s];
+                PlaceIn(table_, Mix(Hash()(KeyAt(addr))), addr);
+            }
+        }
+    }
+
+    migrated_buckets_ = end;
+    if (migrated_buckets_ == old_table_.bucket_count_) {
+        old_table_.Release();
+        migrated_buckets_ = 0;
+    }
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -62,6 +62,12 @@ public:
               bool* output_masks,
               int64_t count) override;
 
+    bool SupportsFindValues() const override { return true; }
+    void FindValues(const void* input_keys,
+                    void* output_values,
+                    bool* output_masks,
+                    int64_t count) override;
+
     void Erase(const void* input_keys,
                bool* output_masks,
                int64_t count) override;
@@ -72,6 +78,10 @@ public:
     int64_t Size() const override;
     int64_t GetBucketCount() const override;
     std::vector<int64_t> BucketSizes() const override;
+    /// Counts the slabs visited in the linked list of each bucket.
+    std::vector<int64_t> ProbeLengthHistogram() const override;
+    void GetNodeAllocatorUsage(int64_t& allocated_nodes,
+                               int64_t& node_capacity) const override;
     float LoadFactor() const override;
 
     SlabHashmapImpl<Key, Hash> GetImpl() { return impl_; }
@@ -160,12 +170,7 @@ void SlabHashmap<Key, Hash>::Insert(const void* input_keys,
                                     int64_t count) {
     int64_t new_size = Size() + count;
     if (new_size > this->capacity_) {
-        float avg_capacity_per_bucket =
-                float(this->capacity_) / float(this->bucket_count_);
-        int64_t expected_buckets = std::max(
-                int64_t(this->bucket_count_ * 2),
-                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
-        Rehash(expected_buckets);
+        Rehash(this->GetExpectedBucketCount(new_size));
     }
 
     InsertImpl(input_keys, input_values, output_addrs, output_masks, count);
@@ -198,6 +203,21 @@ void SlabHashmap<Key, Hash>::Find(const void* input_keys,
     OPEN3D_CUDA_CHECK(cudaGetLastError());
 }
 
+template <typename Key, typename Hash>
+void SlabHashmap<Key, Hash>::FindValues(const void* input_keys,
+                                        void* output_values,
+                                        bool* output_masks,
+                                        int64_t count) {
+    if (count == 0) return;
+
+    const int64_t num_blocks =
+            (count + kThreadsPerBlock - 1) / kThreadsPerBlock;
+    FindValuesKernel<<<num_blocks, kThreadsPerBlock>>>(
+            impl_, input_keys, output_values, output_masks, count);
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
 template <typename Key, typename Hash>
 void SlabHashmap<Key, Hash>::Erase(const void* input_keys,
                                    bool* output_masks,
@@ -289,6 +309,23 @@ std::vector<int64_t> SlabHashmap<Key, Hash>::BucketSizes() const {
     return result;
 }
 
+template <typename Key, typename Hash>
+std::vector<int64_t> SlabHashmap<Key, Hash>::ProbeLengthHistogram() const {
+    // The last lane of each slab holds the pointer to the next slab.
+    return ChainProbeLengthHistogram(BucketSizes(), kWarpSize - 1);
+}
+
+template <typename Key, typename Hash>
+void SlabHashmap<Key, Hash>::GetNodeAllocatorUsage(
+        int64_t& allocated_nodes, int64_t& node_capacity) const {
+    allocated_nodes = 0;
+    for (int count : node_mgr_->CountSlabsPerSuperblock()) {
+        allocated_nodes += count;
+    }
+    node_capacity = int64_t(kSuperBlocks) * kBlocksPerSuperBlock *
+                    kSlabsPerBlock;
+}
+
 template <typename Key, typename Hash>
 float SlabHashmap<Key, Hash>::LoadFactor() const {
     return float(Size()) / float(this->bucket_count_);
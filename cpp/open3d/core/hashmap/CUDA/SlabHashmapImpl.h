@@ -147,6 +147,13 @@ __global__ void FindKernel(SlabHashmapImpl<Key, Hash> impl,
                            bool* output_masks,
                            int64_t count);
 
+template <typename Key, typename Hash>
+__global__ void FindValuesKernel(SlabHashmapImpl<Key, Hash> impl,
+                                 const void* input_keys,
+                                 void* output_values,
+                                 bool* output_masks,
+                                 int64_t count);
+
 template <typename Key, typename Hash>
 __global__ void EraseKernelPass0(SlabHashmapImpl<Key, Hash> impl,
                                  const void* input_keys,
@@ -624,6 +631,80 @@ __global__ void FindKernel(SlabHashmapImpl<Key, Hash> impl,
     }
 }
 
+template <typename Key, typename Hash>
+__global__ void FindValuesKernel(SlabHashmapImpl<Key, Hash> impl,
+                                 const void* input_keys,
+                                 void* output_values,
+                                 bool* output_masks,
+                                 int64_t count) {
+    const Key* input_keys_templated = static_cast<const Key*>(input_keys);
+    uint32_t tid = threadIdx.x + blockIdx.x * blockDim.x;
+    uint32_t lane_id = threadIdx.x & 0x1F;
+
+    // This warp is idle.
+    if ((tid - lane_id) >= count) {
+        return;
+    }
+
+    // Initialize the memory allocator on each warp.
+    impl.node_mgr_impl_.Init(tid, lane_id);
+
+    bool lane_active = false;
+    uint32_t bucket_id = 0;
+
+    // Dummy for warp sync
+    Key key;
+    Pair<addr_t, bool> result;
+
+    if (tid < count) {
+        lane_active = true;
+        key = input_keys_templated[tid];
+        bucket_id = impl.ComputeBucket(key);
+    }
+
+    result = impl.Find(lane_active, lane_id, bucket_id, key);
+
+    if (tid < count) {
+        output_masks[tid] = result.second;
+    }
+
+    // The warp copies the values of its queries one after another, with the
+    // lanes copying consecutive words so that loads and stores coalesce.
+    const int64_t dsize_value = impl.buffer_accessor_.dsize_value_;
+    const bool word_aligned = (dsize_value % sizeof(int)) == 0;
+    const uint32_t warp_tid = tid - lane_id;
+    for (uint32_t src_lane = 0; src_lane < kWarpSize; ++src_lane) {
+        const addr_t src_addr =
+                __shfl_sync(kSyncLanesMask, result.first, src_lane, kWarpSize);
+        const int src_found = __shfl_sync(
+                kSyncLanesMask, int(result.second), src_lane, kWarpSize);
+        const int64_t dst_idx = int64_t(warp_tid) + src_lane;
+        if (dst_idx >= count) {
+            break;
+        }
+
+        uint8_t* dst = static_cast<uint8_t*>(output_values) +
+                       dst_idx * dsize_value;
+        const uint8_t* src =
+                src_found ? static_cast<const uint8_t*>(
+                                    impl.buffer_accessor_
+                                            .ExtractIterator(src_addr)
+                                            .second)
+                          : nullptr;
+        if (word_aligned) {
+            const int64_t num_words = dsize_value / sizeof(int);
+            for (int64_t i = lane_id; i < num_words; i += kWarpSize) {
+                reinterpret_cast<int*>(dst)[i] =
+                        src_found ? reinterpret_cast<const int*>(src)[i] : 0;
+            }
+        } else {
+            for (int64_t i = lane_id; i < dsize_value; i += kWarpSize) {
+                dst[i] = src_found ? src[i] : 0;
+            }
+        }
+    }
+}
+
 template <typename Key, typename Hash>
 __global__ void EraseKernelPass0(SlabHashmapImpl<Key, Hash> impl,
                                  const void* input_keys,
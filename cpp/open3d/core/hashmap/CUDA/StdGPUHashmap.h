@@ -129,13 +129,7 @@ void StdGPUHashmap<Key, Hash>::Insert(const void* input_keys,
                                       int64_t count) {
     int64_t new_size = Size() + count;
     if (new_size > this->capacity_) {
-        int64_t bucket_count = GetBucketCount();
-        float avg_capacity_per_bucket =
-                float(this->capacity_) / float(bucket_count);
-        int64_t expected_buckets = std::max(
-                bucket_count * 2,
-                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
-        Rehash(expected_buckets);
+        Rehash(this->GetExpectedBucketCount(new_size));
     }
     InsertImpl(input_keys, input_values, output_addrs, output_masks, count);
 }
@@ -26,16 +26,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
 #include "open3d/core/hashmap/HashmapBuffer.h"
+#include "open3d/utility/Logging.h"
 
 namespace open3d {
 namespace core {
 
-enum class HashmapBackend;
-
 class DeviceHashmap {
 public:
     /// Comprehensive constructor for the developer.
@@ -78,6 +82,19 @@ public:
                       bool* output_masks,
                       int64_t count) = 0;
 
+    /// Return true if the backend implements FindValues.
+    virtual bool SupportsFindValues() const { return false; }
+
+    /// Parallel find a contiguous array of keys and copy the values of the
+    /// found keys to output_values in the same kernel. Values of keys that
+    /// are not found are zero.
+    virtual void FindValues(const void* input_keys,
+                            void* output_values,
+                            bool* output_masks,
+                            int64_t count) {
+        utility::LogError("[DeviceHashmap] FindValues is not supported.");
+    }
+
     /// Parallel erase a contiguous array of keys.
     virtual void Erase(const void* input_keys,
                        bool* output_masks,
@@ -89,6 +106,13 @@ public:
     /// Clear stored map without reallocating memory.
     virtual void Clear() = 0;
 
+    /// Return true if the backend can migrate buckets incrementally, see
+    /// HashmapGrowthPolicy::incremental.
+    virtual bool SupportsIncrementalRehash() const { return false; }
+
+    /// Return true if an incremental migration is in progress.
+    virtual bool IsRehashing() const { return false; }
+
     virtual int64_t Size() const = 0;
     virtual int64_t GetBucketCount() const = 0;
     virtual float LoadFactor() const = 0;
@@ -105,6 +129,52 @@ public:
     /// High performance not required, so directly returns a vector.
     virtual std::vector<int64_t> BucketSizes() const = 0;
 
+    /// Return the number of entries reached after k + 1 probes at index k.
+    /// By default, buckets are chains of single entries, see
+    /// ChainProbeLengthHistogram.
+    virtual std::vector<int64_t> ProbeLengthHistogram() const {
+        return ChainProbeLengthHistogram(BucketSizes(), 1);
+    }
+
+    /// Return the used and total nodes of the backend's node allocator, or 0
+    /// if it has none.
+    virtual void GetNodeAllocatorUsage(int64_t& allocated_nodes,
+                                       int64_t& node_capacity) const {
+        allocated_nodes = 0;
+        node_capacity = 0;
+    }
+
+    /// Bucket count to grow to when the size reaches \p new_size, following
+    /// growth_policy_ and keeping the average capacity per bucket.
+    int64_t GetExpectedBucketCount(int64_t new_size) const {
+        int64_t bucket_count = GetBucketCount();
+        float avg_capacity_per_bucket =
+                float(capacity_) / float(bucket_count);
+        return std::max(
+                int64_t(std::ceil(bucket_count * growth_policy_.growth_factor)),
+                int64_t(std::ceil(new_size / avg_capacity_per_bucket)));
+    }
+
+    /// Probe length histogram of buckets that are chains of nodes holding
+    /// \p entries_per_node entries each.
+    static std::vector<int64_t> ChainProbeLengthHistogram(
+            const std::vector<int64_t>& bucket_sizes,
+            int64_t entries_per_node) {
+        std::vector<int64_t> histogram;
+        for (int64_t bucket_size : bucket_sizes) {
+            const int64_t num_nodes =
+                    (bucket_size + entries_per_node - 1) / entries_per_node;
+            if (num_nodes > int64_t(histogram.size())) {
+                histogram.resize(num_nodes, 0);
+            }
+            for (int64_t k = 0; k < num_nodes; ++k) {
+                histogram[k] += std::min(entries_per_node,
+                                         bucket_size - k * entries_per_node);
+            }
+        }
+        return histogram;
+    }
+
 public:
     int64_t capacity_;
     int64_t dsize_key_;
@@ -113,6 +183,8 @@ public:
     Device device_;
 
     std::shared_ptr<HashmapBuffer> buffer_;
+
+    HashmapGrowthPolicy growth_policy_;
 };
 
 /// Factory functions:
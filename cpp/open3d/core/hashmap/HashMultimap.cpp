@@ -0,0 +1,175 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/hashmap/HashMultimap.h"
+
+#include "open3d/core/TensorKey.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+HashMultimap::HashMultimap(int64_t init_capacity,
+                           const Dtype& dtype_key,
+                           const Dtype& dtype_value,
+                           const SizeVector& element_shape_key,
+                           const SizeVector& element_shape_value,
+                           const Device& device,
+                           const HashmapBackend& backend)
+    // The hashmap only stores the keys, so its values are a single byte.
+    : hashmap_(init_capacity,
+               dtype_key,
+               Dtype::UInt8,
+               element_shape_key,
+               {1},
+               device,
+               backend),
+      keys_(element_shape_key, dtype_key, device),
+      values_(element_shape_value, dtype_value, device) {}
+
+void HashMultimap::Insert(const Tensor& input_keys,
+                          const Tensor& input_values) {
+    if (input_keys.NumDims() == 0 || input_values.NumDims() == 0 ||
+        input_keys.GetLength() != input_values.GetLength()) {
+        utility::LogError(
+                "[HashMultimap] Expected keys and values of the same length, "
+                "but got shapes {} and {}.",
+                input_keys.GetShape().ToString(),
+                input_values.GetShape().ToString());
+    }
+
+    Tensor addrs, masks;
+    hashmap_.Activate(input_keys, addrs, masks);
+    keys_.Extend(input_keys);
+    values_.Extend(input_values);
+    csr_valid_ = false;
+}
+
+void HashMultimap::Find(const Tensor& input_keys,
+                        Tensor& output_offsets,
+                        Tensor& output_values) {
+    BuildCSR();
+
+    Tensor addrs, masks;
+    hashmap_.Find(input_keys, addrs, masks);
+    const Tensor indices = addrs.To(Dtype::Int64);
+    const Tensor counts =
+            address_counts_.IndexGet({indices}) * masks.To(Dtype::Int64);
+    const Tensor starts = address_starts_.IndexGet({indices});
+
+    const int64_t n = input_keys.GetLength();
+    output_offsets = Tensor::Zeros({n + 1}, Dtype::Int64, GetDevice());
+    output_offsets.Slice(0, 1, n + 1).AsRvalue() = counts.CumSum(0);
+    const int64_t num_values =
+            output_offsets[n].To(Device("CPU:0")).Item<int64_t>();
+
+    SizeVector value_shape = values_.GetElementShape();
+    value_shape.insert(value_shape.begin(), num_values);
+    if (num_values == 0) {
+        output_values =
+                Tensor::Empty(value_shape, values_.GetDtype(), GetDevice());
+        return;
+    }
+
+    // Expand the ranges [start, start + count) of the found keys into value
+    // indices with a cumulative sum over +1 steps, where the first element
+    // of each range jumps from the last element of the previous one (or
+    // from 0 for the first range).
+    const Tensor non_empty = counts.Gt(0);
+    const Tensor range_starts = starts.IndexGet({non_empty});
+    const Tensor range_offsets =
+            output_offsets.Slice(0, 0, n).IndexGet({non_empty});
+    const Tensor range_lasts =
+            range_starts + counts.IndexGet({non_empty}) - 1;
+    const int64_t num_ranges = range_starts.GetLength();
+
+    Tensor prev_lasts = Tensor::Zeros({num_ranges}, Dtype::Int64, GetDevice());
+    prev_lasts.Slice(0, 1, num_ranges).AsRvalue() =
+            range_lasts.Slice(0, 0, num_ranges - 1);
+    Tensor steps = Tensor::Ones({num_values}, Dtype::Int64, GetDevice());
+    steps.IndexSet({range_offsets}, range_starts - prev_lasts);
+    output_values = sorted_values_.IndexGet({steps.CumSum(0)});
+}
+
+void HashMultimap::Erase(const Tensor& input_keys, Tensor& output_masks) {
+    hashmap_.Erase(input_keys, output_masks);
+    if (GetNumValues() == 0 || !output_masks.Any()) {
+        return;
+    }
+
+    Tensor keys = keys_.AsTensor();
+    Tensor values = values_.AsTensor();
+    Tensor addrs, masks;
+    hashmap_.Find(keys, addrs, masks);
+
+    keys_.Clear();
+    values_.Clear();
+    if (masks.Any()) {
+        keys_.Extend(keys.IndexGet({masks}));
+        values_.Extend(values.IndexGet({masks}));
+    }
+    csr_valid_ = false;
+}
+
+void HashMultimap::Clear() {
+    hashmap_.Clear();
+    keys_.Clear();
+    values_.Clear();
+    csr_valid_ = false;
+}
+
+void HashMultimap::BuildCSR() {
+    if (csr_valid_) {
+        return;
+    }
+
+    const int64_t capacity = hashmap_.GetCapacity();
+    if (GetNumValues() == 0) {
+        address_counts_ = Tensor::Zeros({capacity}, Dtype::Int64, GetDevice());
+        address_starts_ = address_counts_;
+        sorted_values_ = values_.AsTensor();
+        csr_valid_ = true;
+        return;
+    }
+
+    // Addresses change when the hashmap is rehashed, so they are looked up
+    // again instead of being stored on insertion.
+    Tensor addrs, masks;
+    hashmap_.Find(keys_.AsTensor(), addrs, masks);
+    const Tensor indices = addrs.To(Dtype::Int64);
+
+    // The sort is stable, so values keep their insertion order per key.
+    const Tensor order = indices.ArgSort();
+    const Tensor sorted_indices = indices.IndexGet({order});
+    sorted_values_ = values_.AsTensor().IndexGet({order});
+    address_counts_ = Tensor::Ones({GetNumValues()}, Dtype::Int64, GetDevice())
+                              .SegmentSum(sorted_indices, capacity);
+    address_starts_ = address_counts_.CumSum(0, /*exclusive=*/true);
+    csr_valid_ = true;
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorList.h"
+#include "open3d/core/hashmap/Hashmap.h"
+
+namespace open3d {
+namespace core {
+
+/// A map from keys to lists of values, e.g. from voxel coordinates to the
+/// indices of the points inside each voxel.
+///
+/// Unique keys are stored in a Hashmap of the chosen backend. Values are
+/// appended in insertion order and grouped by key into a CSR layout, which is
+/// rebuilt on the first query after a modification. Query results are
+/// returned CSR-style: for query i, the values are
+/// output_values[output_offsets[i]:output_offsets[i + 1]], in insertion
+/// order.
+class HashMultimap {
+public:
+    HashMultimap(int64_t init_capacity,
+                 const Dtype& dtype_key,
+                 const Dtype& dtype_value,
+                 const SizeVector& element_shape_key,
+                 const SizeVector& element_shape_value,
+                 const Device& device,
+                 const HashmapBackend& backend = HashmapBackend::Default);
+
+    /// Parallel insert arrays of keys and values in Tensors. Values of keys
+    /// that already exist are appended to their lists.
+    void Insert(const Tensor& input_keys, const Tensor& input_values);
+
+    /// Parallel find an array of keys in Tensor.
+    /// Return offsets: Int64 {n + 1} offsets of the values of each key in
+    /// output_values. Keys that are not found have no values.
+    /// values: {output_offsets[n], *element_shape_value} values.
+    void Find(const Tensor& input_keys,
+              Tensor& output_offsets,
+              Tensor& output_values);
+
+    /// Parallel erase an array of keys in Tensor and all their values.
+    /// Return masks: Bool {n}, true for keys that were found.
+    void Erase(const Tensor& input_keys, Tensor& output_masks);
+
+    /// Clear all keys and values.
+    void Clear();
+
+    /// Return the number of unique keys.
+    int64_t Size() const { return hashmap_.Size(); }
+
+    /// Return the total number of values.
+    int64_t GetNumValues() const { return values_.GetSize(); }
+
+    Device GetDevice() const { return hashmap_.GetDevice(); }
+
+    /// The Hashmap storing the unique keys.
+    const Hashmap& GetHashmap() const { return hashmap_; }
+
+protected:
+    /// Groups the values by the current addresses of their keys.
+    void BuildCSR();
+
+    Hashmap hashmap_;
+
+    /// Key and value of each inserted pair, in insertion order.
+    TensorList keys_;
+    TensorList values_;
+
+    /// Values sorted by key address, and the Int64 {capacity} start and
+    /// number of values of each address. Valid if csr_valid_ is true.
+    Tensor sorted_values_;
+    Tensor address_starts_;
+    Tensor address_counts_;
+    bool csr_valid_ = false;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -26,10 +26,14 @@
 
 #include "open3d/core/hashmap/Hashmap.h"
 
+#include <algorithm>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/DeviceHashmap.h"
+#include "open3d/t/io/HashmapIO.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Timer.h"
 
 namespace open3d {
 namespace core {
@@ -67,6 +71,30 @@ void Hashmap::Rehash(int64_t buckets) {
     return device_hashmap_->Rehash(buckets);
 }
 
+void Hashmap::SetGrowthPolicy(const HashmapGrowthPolicy& policy) {
+    if (!(policy.growth_factor > 1.0)) {
+        utility::LogError("[Hashmap] growth_factor must be > 1, but got {}",
+                          policy.growth_factor);
+    }
+    if (policy.migration_batch_size <= 0) {
+        utility::LogError(
+                "[Hashmap] migration_batch_size must be > 0, but got {}",
+                policy.migration_batch_size);
+    }
+    if (policy.incremental && !device_hashmap_->SupportsIncrementalRehash()) {
+        utility::LogError(
+                "[Hashmap] Incremental rehash is not supported by this "
+                "backend.");
+    }
+    device_hashmap_->growth_policy_ = policy;
+}
+
+const HashmapGrowthPolicy& Hashmap::GetGrowthPolicy() const {
+    return device_hashmap_->growth_policy_;
+}
+
+bool Hashmap::IsRehashing() const { return device_hashmap_->IsRehashing(); }
+
 void Hashmap::Insert(const Tensor& input_keys,
                      const Tensor& input_values,
                      Tensor& output_addrs,
@@ -103,9 +131,11 @@ void Hashmap::Insert(const Tensor& input_keys,
     output_addrs = Tensor({count}, Dtype::Int32, GetDevice());
     output_masks = Tensor({count}, Dtype::Bool, GetDevice());
 
+    const double start_ms = BeginCall(insert_stats_);
     device_hashmap_->Insert(input_keys.GetDataPtr(), input_values.GetDataPtr(),
                             static_cast<addr_t*>(output_addrs.GetDataPtr()),
                             output_masks.GetDataPtr<bool>(), count);
+    EndCall(insert_stats_, start_ms, count);
 }
 
 void Hashmap::Activate(const Tensor& input_keys,
@@ -130,9 +160,11 @@ void Hashmap::Activate(const Tensor& input_keys,
     output_addrs = Tensor({count}, Dtype::Int32, GetDevice());
     output_masks = Tensor({count}, Dtype::Bool, GetDevice());
 
+    const double start_ms = BeginCall(activate_stats_);
     device_hashmap_->Activate(input_keys.GetDataPtr(),
                               static_cast<addr_t*>(output_addrs.GetDataPtr()),
                               output_masks.GetDataPtr<bool>(), count);
+    EndCall(activate_stats_, start_ms, count);
 }
 
 void Hashmap::Find(const Tensor& input_keys,
@@ -157,9 +189,57 @@ void Hashmap::Find(const Tensor& input_keys,
     output_masks = Tensor({count}, Dtype::Bool, GetDevice());
     output_addrs = Tensor({count}, Dtype::Int32, GetDevice());
 
+    const double start_ms = BeginCall(find_stats_);
     device_hashmap_->Find(input_keys.GetDataPtr(),
                           static_cast<addr_t*>(output_addrs.GetDataPtr()),
                           output_masks.GetDataPtr<bool>(), count);
+    EndCall(find_stats_, start_ms, count);
+}
+
+void Hashmap::FindValues(const Tensor& input_keys,
+                         Tensor& output_values,
+                         Tensor& output_masks) {
+    if (!device_hashmap_->SupportsFindValues()) {
+        Tensor addrs;
+        Find(input_keys, addrs, output_masks);
+        output_values = GetValueTensor().IndexGet({addrs.To(Dtype::Int64)});
+        const Tensor not_found = output_masks.LogicalNot().NonZero()[0];
+        if (not_found.GetLength() > 0) {
+            SizeVector zeros_shape = element_shape_value_;
+            zeros_shape.insert(zeros_shape.begin(), not_found.GetLength());
+            output_values.IndexSet(
+                    {not_found},
+                    Tensor::Zeros(zeros_shape, dtype_value_, GetDevice()));
+        }
+        return;
+    }
+
+    SizeVector input_key_elem_shape(input_keys.GetShape());
+    input_key_elem_shape.erase(input_key_elem_shape.begin());
+    AssertKeyDtype(input_keys.GetDtype(), input_key_elem_shape);
+
+    SizeVector shape = input_keys.GetShape();
+    if (shape.size() == 0 || shape[0] == 0) {
+        utility::LogError("[Hashmap]: Invalid key tensor shape");
+    }
+    if (input_keys.GetDevice() != GetDevice()) {
+        utility::LogError(
+                "[Hashmap]: Incompatible device, expected {}, but got {}",
+                GetDevice().ToString(), input_keys.GetDevice().ToString());
+    }
+
+    int64_t count = shape[0];
+
+    SizeVector value_shape = element_shape_value_;
+    value_shape.insert(value_shape.begin(), count);
+    output_masks = Tensor({count}, Dtype::Bool, GetDevice());
+    output_values = Tensor(value_shape, dtype_value_, GetDevice());
+
+    const double start_ms = BeginCall(find_stats_);
+    device_hashmap_->FindValues(input_keys.GetDataPtr(),
+                                output_values.GetDataPtr(),
+                                output_masks.GetDataPtr<bool>(), count);
+    EndCall(find_stats_, start_ms, count);
 }
 
 void Hashmap::Erase(const Tensor& input_keys, Tensor& output_masks) {
@@ -180,8 +260,10 @@ void Hashmap::Erase(const Tensor& input_keys, Tensor& output_masks) {
     int64_t count = shape[0];
     output_masks = Tensor({count}, Dtype::Bool, GetDevice());
 
+    const double start_ms = BeginCall(erase_stats_);
     device_hashmap_->Erase(input_keys.GetDataPtr(),
                            output_masks.GetDataPtr<bool>(), count);
+    EndCall(erase_stats_, start_ms, count);
 }
 
 void Hashmap::GetActiveIndices(Tensor& output_addrs) const {
@@ -192,8 +274,61 @@ void Hashmap::GetActiveIndices(Tensor& output_addrs) const {
             static_cast<addr_t*>(output_addrs.GetDataPtr()));
 }
 
+void Hashmap::ForEachActiveChunk(int64_t chunk_size,
+                                 const ActiveChunkCallback& callback) const {
+    if (chunk_size <= 0) {
+        utility::LogError("[Hashmap] chunk_size must be > 0, but got {}",
+                          chunk_size);
+    }
+
+    // The buffer is scanned in windows of chunk_size addresses. An address
+    // is active iff looking up its stored key returns the address itself;
+    // free slots hold stale or uninitialized keys that are either absent or
+    // stored at another address.
+    const Tensor keys = GetKeyTensor();
+    const Tensor values = GetValueTensor();
+    const int64_t capacity = GetCapacity();
+    for (int64_t start = 0; start < capacity; start += chunk_size) {
+        const int64_t end = std::min(start + chunk_size, capacity);
+        const Tensor window_keys = keys.Slice(0, start, end);
+        Tensor found_addrs({end - start}, Dtype::Int32, GetDevice());
+        Tensor found_masks({end - start}, Dtype::Bool, GetDevice());
+        device_hashmap_->Find(window_keys.GetDataPtr(),
+                              static_cast<addr_t*>(found_addrs.GetDataPtr()),
+                              found_masks.GetDataPtr<bool>(), end - start);
+
+        const Tensor window_addrs =
+                Tensor::Arange(start, end, 1, Dtype::Int32, GetDevice());
+        const Tensor active =
+                found_masks.LogicalAnd(found_addrs.Eq(window_addrs));
+        const Tensor addrs = window_addrs.IndexGet({active});
+        if (addrs.GetLength() == 0) {
+            continue;
+        }
+        const Tensor indices = addrs.To(Dtype::Int64);
+        callback(addrs, keys.IndexGet({indices}), values.IndexGet({indices}));
+    }
+}
+
 void Hashmap::Clear() { device_hashmap_->Clear(); }
 
+void Hashmap::Save(const std::string& file_name) const {
+    if (!t::io::WriteHashmap(file_name, *this)) {
+        utility::LogError("[Hashmap] Failed to save to {}.", file_name);
+    }
+}
+
+Hashmap Hashmap::Load(const std::string& file_name,
+                      const Device& device,
+                      const HashmapBackend& backend) {
+    std::shared_ptr<Hashmap> hashmap =
+            t::io::CreateHashmapFromFile(file_name, device, backend);
+    if (hashmap == nullptr) {
+        utility::LogError("[Hashmap] Failed to load from {}.", file_name);
+    }
+    return *hashmap;
+}
+
 Hashmap Hashmap::Clone() const { return To(GetDevice(), /*copy=*/true); }
 
 Hashmap Hashmap::To(const Device& device, bool copy) const {
@@ -275,6 +410,76 @@ std::vector<int64_t> Hashmap::BucketSizes() const {
 /// Return size / bucket_count.
 float Hashmap::LoadFactor() const { return device_hashmap_->LoadFactor(); }
 
+HashmapStatistics Hashmap::GetStatistics() const {
+    HashmapStatistics stats;
+    stats.size = Size();
+    stats.capacity = GetCapacity();
+    stats.bucket_count = GetBucketCount();
+    stats.load_factor = LoadFactor();
+
+    stats.probe_length_histogram = device_hashmap_->ProbeLengthHistogram();
+    int64_t num_entries = 0;
+    int64_t total_probe_length = 0;
+    for (size_t k = 0; k < stats.probe_length_histogram.size(); ++k) {
+        const int64_t num_k = stats.probe_length_histogram[k];
+        num_entries += num_k;
+        total_probe_length += num_k * int64_t(k + 1);
+        if (num_k > 0) {
+            stats.max_probe_length = int64_t(k + 1);
+        }
+    }
+    if (num_entries > 0) {
+        stats.mean_probe_length = double(total_probe_length) / num_entries;
+        stats.collision_rate =
+                double(num_entries - stats.probe_length_histogram[0]) /
+                num_entries;
+    }
+
+    device_hashmap_->GetNodeAllocatorUsage(stats.allocated_nodes,
+                                           stats.node_capacity);
+
+    stats.insert = insert_stats_;
+    stats.activate = activate_stats_;
+    stats.find = find_stats_;
+    stats.erase = erase_stats_;
+    return stats;
+}
+
+void Hashmap::SetTimingSampleInterval(int64_t interval) {
+    if (interval < 0) {
+        utility::LogError(
+                "[Hashmap] Timing sample interval must be >= 0, but got {}",
+                interval);
+    }
+    timing_sample_interval_ = interval;
+}
+
+void Hashmap::ResetStatistics() {
+    insert_stats_ = HashmapCallStatistics();
+    activate_stats_ = HashmapCallStatistics();
+    find_stats_ = HashmapCallStatistics();
+    erase_stats_ = HashmapCallStatistics();
+}
+
+double Hashmap::BeginCall(HashmapCallStatistics& stats) const {
+    const bool sampled = timing_sample_interval_ > 0 &&
+                         stats.num_calls % timing_sample_interval_ == 0;
+    ++stats.num_calls;
+    return sampled ? utility::Timer::GetSystemTimeInMilliseconds() : -1.0;
+}
+
+void Hashmap::EndCall(HashmapCallStatistics& stats,
+                      double start_ms,
+                      int64_t count) const {
+    if (start_ms < 0) {
+        return;
+    }
+    ++stats.num_sampled_calls;
+    stats.num_sampled_keys += count;
+    stats.sampled_time_ms +=
+            utility::Timer::GetSystemTimeInMilliseconds() - start_ms;
+}
+
 void Hashmap::AssertKeyDtype(const Dtype& dtype_key,
                              const SizeVector& element_shape_key) const {
     int64_t elem_byte_size =
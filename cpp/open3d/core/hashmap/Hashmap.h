@@ -26,6 +26,10 @@
 
 #pragma once
 
+#include <functional>
+#include <string>
+#include <vector>
+
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/HashmapBuffer.h"
@@ -35,7 +39,62 @@ namespace core {
 
 class DeviceHashmap;
 
-enum class HashmapBackend { Slab, StdGPU, TBB, Default };
+enum class HashmapBackend { Slab, StdGPU, TBB, OpenAddressing, Default };
+
+/// Controls how a hashmap grows when an insertion exceeds its capacity.
+struct HashmapGrowthPolicy {
+    /// Minimum factor by which the bucket count grows on overflow. Must be
+    /// larger than 1.
+    double growth_factor = 2.0;
+
+    /// If true, growing reallocates the buffers (preserving addresses) and
+    /// migrates the old buckets gradually across subsequent Insert, Activate,
+    /// Find and Erase calls, instead of rebuilding the whole table at once.
+    /// Only supported by HashmapBackend::OpenAddressing.
+    bool incremental = false;
+
+    /// Number of old buckets migrated per call in incremental mode.
+    int64_t migration_batch_size = 1024;
+};
+
+/// Number of calls and sampled wall time of one Hashmap operation.
+struct HashmapCallStatistics {
+    int64_t num_calls = 0;
+    /// Calls whose duration was measured, see
+    /// Hashmap::SetTimingSampleInterval.
+    int64_t num_sampled_calls = 0;
+    /// Number of input keys of the sampled calls.
+    int64_t num_sampled_keys = 0;
+    /// Total duration of the sampled calls in milliseconds.
+    double sampled_time_ms = 0.0;
+};
+
+/// Occupancy and timing statistics of a Hashmap, see
+/// Hashmap::GetStatistics.
+struct HashmapStatistics {
+    int64_t size = 0;
+    int64_t capacity = 0;
+    int64_t bucket_count = 0;
+    float load_factor = 0.0f;
+
+    /// Element k is the number of entries reached after k + 1 probes, i.e.
+    /// visited chain nodes (TBB, StdGPU), slabs (Slab) or buckets
+    /// (OpenAddressing).
+    std::vector<int64_t> probe_length_histogram;
+    double mean_probe_length = 0.0;
+    int64_t max_probe_length = 0;
+    /// Fraction of entries that are not reached on the first probe.
+    double collision_rate = 0.0;
+
+    /// Used and total nodes of the backend's node allocator (Slab), or 0.
+    int64_t allocated_nodes = 0;
+    int64_t node_capacity = 0;
+
+    HashmapCallStatistics insert;
+    HashmapCallStatistics activate;
+    HashmapCallStatistics find;
+    HashmapCallStatistics erase;
+};
 
 class Hashmap {
 public:
@@ -59,8 +118,16 @@ public:
     /// 2) deallocate old hash table
     /// 3) create a new hash table
     /// 4) parallel insert dumped key value pairs
+    /// If an incremental migration is in progress, it is completed first.
     void Rehash(int64_t buckets);
 
+    /// Set the policy used to grow the hashmap on overflow.
+    void SetGrowthPolicy(const HashmapGrowthPolicy& policy);
+    const HashmapGrowthPolicy& GetGrowthPolicy() const;
+
+    /// Return true if an incremental migration is in progress.
+    bool IsRehashing() const;
+
     /// Parallel insert arrays of keys and values in Tensors.
     /// Return addrs: internal indices that can be directly used for advanced
     /// indexing in Tensor key/value buffers.
@@ -91,6 +158,16 @@ public:
               Tensor& output_addrs,
               Tensor& output_masks);
 
+    /// Parallel find an array of keys in Tensor and gather their values.
+    /// Return values: {n, *element_shape_value} copies of the values, zero
+    /// for keys that are not found.
+    /// masks: Bool {n}, true for keys that were found.
+    /// Backends with a fused kernel (Slab) look up and copy in one pass;
+    /// the others gather the values after Find.
+    void FindValues(const Tensor& input_keys,
+                    Tensor& output_values,
+                    Tensor& output_masks);
+
     /// Parallel erase an array of keys in Tensor.
     /// Output masks is a bool Tensor.
     /// Return masks: success insertions, must be combined with addrs in
@@ -102,9 +179,33 @@ public:
     /// indexing in Tensor key/value buffers.
     void GetActiveIndices(Tensor& output_indices) const;
 
+    /// Callback of ForEachActiveChunk, taking the Int32 {m} addresses and
+    /// the {m, *element_shape} keys and values of a chunk.
+    using ActiveChunkCallback = std::function<void(
+            const Tensor& addrs, const Tensor& keys, const Tensor& values)>;
+
+    /// Call \p callback on the active entries in chunks of at most
+    /// \p chunk_size entries, on the device of the hashmap. The buffer is
+    /// scanned in windows of \p chunk_size addresses, so the extra memory is
+    /// O(chunk_size) and the cost is one lookup per buffer slot. Entries are
+    /// visited in address order. The hashmap must not be modified until the
+    /// iteration is finished.
+    void ForEachActiveChunk(int64_t chunk_size,
+                            const ActiveChunkCallback& callback) const;
+
     /// Clear stored map without reallocating memory.
     void Clear();
 
+    /// Save the active keys and values to a file, see t::io::WriteHashmap.
+    void Save(const std::string& file_name) const;
+
+    /// Load a hashmap saved by Save() onto \p device, see
+    /// t::io::CreateHashmapFromFile.
+    static Hashmap Load(
+            const std::string& file_name,
+            const Device& device = Device("CPU:0"),
+            const HashmapBackend& backend = HashmapBackend::Default);
+
     Hashmap Clone() const;
     Hashmap To(const Device& device, bool copy = false) const;
     Hashmap CPU() const;
@@ -131,6 +232,22 @@ public:
     /// Return size / bucket_count.
     float LoadFactor() const;
 
+    /// Return occupancy statistics of the table and the call statistics
+    /// recorded since construction or the last ResetStatistics(). Collecting
+    /// the occupancy is O(capacity) and meant for tuning, not for every
+    /// frame.
+    HashmapStatistics GetStatistics() const;
+
+    /// Measure the duration of one in \p interval calls of Insert, Activate,
+    /// Find and Erase. 0 (default) disables timing; calls are still counted.
+    /// CUDA backends synchronize at the end of each call, so the wall time
+    /// includes the kernels.
+    void SetTimingSampleInterval(int64_t interval);
+    int64_t GetTimingSampleInterval() const { return timing_sample_interval_; }
+
+    /// Reset the call statistics.
+    void ResetStatistics();
+
     std::shared_ptr<DeviceHashmap> GetDeviceHashmap() const {
         return device_hashmap_;
     }
@@ -144,6 +261,13 @@ protected:
     Dtype GetKeyDtype() const { return dtype_key_; }
     Dtype GetValueDtype() const { return dtype_value_; }
 
+    /// Counts a call in \p stats and returns the start time in milliseconds
+    /// if it is sampled, or a negative value otherwise.
+    double BeginCall(HashmapCallStatistics& stats) const;
+    void EndCall(HashmapCallStatistics& stats,
+                 double start_ms,
+                 int64_t count) const;
+
 private:
     std::shared_ptr<DeviceHashmap> device_hashmap_;
 
@@ -152,6 +276,12 @@ private:
 
     SizeVector element_shape_key_;
     SizeVector element_shape_value_;
+
+    int64_t timing_sample_interval_ = 0;
+    HashmapCallStatistics insert_stats_;
+    HashmapCallStatistics activate_stats_;
+    HashmapCallStatistics find_stats_;
+    HashmapCallStatistics erase_stats_;
 };
 
 }  // namespace core
@@ -0,0 +1,214 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/hashmap/ShardedHashmap.h"
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+ShardedHashmap::ShardedHashmap(int64_t init_capacity_per_shard,
+                               const Dtype& dtype_key,
+                               const Dtype& dtype_value,
+                               const SizeVector& element_shape_key,
+                               const SizeVector& element_shape_value,
+                               const std::vector<Device>& devices,
+                               const HashmapBackend& backend)
+    : devices_(devices) {
+    if (devices.empty()) {
+        utility::LogError("[ShardedHashmap] At least one device is required.");
+    }
+    for (const Device& device : devices) {
+        shards_.emplace_back(init_capacity_per_shard, dtype_key, dtype_value,
+                             element_shape_key, element_shape_value, device,
+                             backend);
+    }
+
+    // Odd 24-bit weights keep the weighted byte sum far from overflow.
+    const int64_t key_byte_size =
+            dtype_key.ByteSize() * element_shape_key.NumElements();
+    std::vector<int64_t> weights(key_byte_size);
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    for (int64_t& weight : weights) {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        weight = static_cast<int64_t>((state >> 40) | 1);
+    }
+    hash_weights_ = Tensor(weights, {key_byte_size}, Dtype::Int64);
+}
+
+Tensor ShardedHashmap::GetShardIds(const Tensor& input_keys) const {
+    SizeVector input_key_elem_shape(input_keys.GetShape());
+    input_key_elem_shape.erase(input_key_elem_shape.begin());
+    const int64_t key_byte_size = hash_weights_.GetLength();
+    const int64_t input_key_byte_size = input_keys.GetDtype().ByteSize() *
+                                        input_key_elem_shape.NumElements();
+    if (input_key_byte_size != key_byte_size) {
+        utility::LogError(
+                "[ShardedHashmap] Inconsistent element-wise key byte size, "
+                "expected {}, but got {}",
+                key_byte_size, input_key_byte_size);
+    }
+
+    const int64_t count = input_keys.GetLength();
+    const Device device = input_keys.GetDevice();
+    if (GetShardCount() == 1 || count == 0) {
+        return Tensor::Zeros({count}, Dtype::Int64, device);
+    }
+
+    // View each key as its raw bytes.
+    const Tensor keys = input_keys.Contiguous();
+    const Tensor key_bytes({count, key_byte_size}, {key_byte_size, 1},
+                           const_cast<void*>(keys.GetDataPtr()), Dtype::UInt8,
+                           keys.GetBlob());
+
+    const Tensor hashes =
+            key_bytes.To(Dtype::Int64).Mul(hash_weights_.To(device)).Sum({1});
+    return hashes.Sub(hashes.Div(GetShardCount()).Mul(GetShardCount()));
+}
+
+void ShardedHashmap::Dispatch(Operation op,
+                              const Tensor& input_keys,
+                              const Tensor* input_values,
+                              Tensor& output_shards,
+                              Tensor& output_addrs,
+                              Tensor& output_masks) {
+    const int64_t count = input_keys.GetLength();
+    const Device device = input_keys.GetDevice();
+    output_shards = GetShardIds(input_keys);
+    output_addrs = Tensor::Zeros({count}, Dtype::Int32, device);
+    // Bool tensors are not supported by IndexSet.
+    Tensor output_flags = Tensor::Zeros({count}, Dtype::UInt8, device);
+
+    for (int64_t i = 0; i < GetShardCount(); ++i) {
+        const Tensor indices = output_shards.Eq(i).NonZero()[0];
+        if (indices.GetLength() == 0) {
+            continue;
+        }
+        const Tensor keys = input_keys.IndexGet({indices}).To(devices_[i]);
+
+        Tensor addrs, masks;
+        switch (op) {
+            case Operation::Insert:
+                shards_[i].Insert(keys,
+                                  input_values->IndexGet({indices})
+                                          .To(devices_[i]),
+                                  addrs, masks);
+                break;
+            case Operation::Activate:
+                shards_[i].Activate(keys, addrs, masks);
+                break;
+            case Operation::Find:
+                shards_[i].Find(keys, addrs, masks);
+                break;
+        }
+        output_addrs.IndexSet({indices}, addrs.To(device));
+        output_flags.IndexSet({indices}, masks.To(device, Dtype::UInt8));
+    }
+    output_masks = output_flags.To(Dtype::Bool);
+}
+
+void ShardedHashmap::Insert(const Tensor& input_keys,
+                            const Tensor& input_values,
+                            Tensor& output_shards,
+                            Tensor& output_addrs,
+                            Tensor& output_masks) {
+    Dispatch(Operation::Insert, input_keys, &input_values, output_shards,
+             output_addrs, output_masks);
+}
+
+void ShardedHashmap::Activate(const Tensor& input_keys,
+                              Tensor& output_shards,
+                              Tensor& output_addrs,
+                              Tensor& output_masks) {
+    Dispatch(Operation::Activate, input_keys, nullptr, output_shards,
+             output_addrs, output_masks);
+}
+
+void ShardedHashmap::Find(const Tensor& input_keys,
+                          Tensor& output_shards,
+                          Tensor& output_addrs,
+                          Tensor& output_masks) {
+    Dispatch(Operation::Find, input_keys, nullptr, output_shards, output_addrs,
+             output_masks);
+}
+
+void ShardedHashmap::Erase(const Tensor& input_keys, Tensor& output_masks) {
+    const int64_t count = input_keys.GetLength();
+    const Device device = input_keys.GetDevice();
+    const Tensor shard_ids = GetShardIds(input_keys);
+    Tensor output_flags = Tensor::Zeros({count}, Dtype::UInt8, device);
+
+    for (int64_t i = 0; i < GetShardCount(); ++i) {
+        const Tensor indices = shard_ids.Eq(i).NonZero()[0];
+        if (indices.GetLength() == 0) {
+            continue;
+        }
+        Tensor masks;
+        shards_[i].Erase(input_keys.IndexGet({indices}).To(devices_[i]),
+                         masks);
+        output_flags.IndexSet({indices}, masks.To(device, Dtype::UInt8));
+    }
+    output_masks = output_flags.To(Dtype::Bool);
+}
+
+void ShardedHashmap::GetActiveIndices(Tensor& output_shards,
+                                      Tensor& output_addrs) const {
+    std::vector<Tensor> shards, addrs;
+    for (int64_t i = 0; i < GetShardCount(); ++i) {
+        Tensor shard_addrs;
+        shards_[i].GetActiveIndices(shard_addrs);
+        shards.push_back(Tensor::Full({shard_addrs.GetLength()}, i,
+                                      Dtype::Int64, devices_[0]));
+        addrs.push_back(shard_addrs.To(devices_[0]));
+    }
+    output_shards = Tensor::Zeros({Size()}, Dtype::Int64, devices_[0]);
+    output_addrs = Tensor::Zeros({Size()}, Dtype::Int32, devices_[0]);
+    int64_t offset = 0;
+    for (int64_t i = 0; i < GetShardCount(); ++i) {
+        const int64_t length = addrs[i].GetLength();
+        output_shards.Slice(0, offset, offset + length) = shards[i];
+        output_addrs.Slice(0, offset, offset + length) = addrs[i];
+        offset += length;
+    }
+}
+
+void ShardedHashmap::Clear() {
+    for (Hashmap& shard : shards_) {
+        shard.Clear();
+    }
+}
+
+int64_t ShardedHashmap::Size() const {
+    int64_t size = 0;
+    for (const Hashmap& shard : shards_) {
+        size += shard.Size();
+    }
+    return size;
+}
+
+}  // namespace core
+}  // namespace open3d
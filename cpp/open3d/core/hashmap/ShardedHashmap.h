@@ -0,0 +1,128 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+
+namespace open3d {
+namespace core {
+
+/// A hashmap partitioned across several devices, e.g. all the GPUs of a
+/// machine.
+///
+/// Each key is owned by exactly one shard, chosen by a hash of its bytes.
+/// Batched operations split the input by owner, copy each part to the
+/// owning device (peer-to-peer between CUDA devices) and gather the results
+/// back in input order on the device of the input keys. An entry is
+/// identified by its shard id and its address within that shard.
+class ShardedHashmap {
+public:
+    ShardedHashmap(int64_t init_capacity_per_shard,
+                   const Dtype& dtype_key,
+                   const Dtype& dtype_value,
+                   const SizeVector& element_shape_key,
+                   const SizeVector& element_shape_value,
+                   const std::vector<Device>& devices,
+                   const HashmapBackend& backend = HashmapBackend::Default);
+
+    /// Parallel insert arrays of keys and values in Tensors.
+    /// Return shards: Int64 {n} owning shard of each key.
+    /// addrs: Int32 {n} addresses of the keys within their shards.
+    /// masks: Bool {n}, true for keys that were inserted.
+    void Insert(const Tensor& input_keys,
+                const Tensor& input_values,
+                Tensor& output_shards,
+                Tensor& output_addrs,
+                Tensor& output_masks);
+
+    /// Parallel activate arrays of keys in Tensor. Specifically useful for
+    /// large value elements (e.g., a tensor), where we can do in-place
+    /// management after activation.
+    void Activate(const Tensor& input_keys,
+                  Tensor& output_shards,
+                  Tensor& output_addrs,
+                  Tensor& output_masks);
+
+    /// Parallel find an array of keys in Tensor.
+    void Find(const Tensor& input_keys,
+              Tensor& output_shards,
+              Tensor& output_addrs,
+              Tensor& output_masks);
+
+    /// Parallel erase an array of keys in Tensor.
+    /// Return masks: Bool {n}, true for keys that were found.
+    void Erase(const Tensor& input_keys, Tensor& output_masks);
+
+    /// Parallel collect the shard ids and addresses of all active entries,
+    /// on the first device.
+    void GetActiveIndices(Tensor& output_shards, Tensor& output_addrs) const;
+
+    /// Clear stored map without reallocating memory.
+    void Clear();
+
+    /// Return the total number of entries over all shards.
+    int64_t Size() const;
+
+    /// Return the Int64 {n} owning shard of each key, on the device of the
+    /// keys.
+    Tensor GetShardIds(const Tensor& input_keys) const;
+
+    int64_t GetShardCount() const {
+        return static_cast<int64_t>(shards_.size());
+    }
+    const std::vector<Device>& GetDevices() const { return devices_; }
+
+    /// The Hashmap of shard i, on devices[i].
+    Hashmap& GetShard(int64_t i) { return shards_.at(i); }
+    const Hashmap& GetShard(int64_t i) const { return shards_.at(i); }
+
+protected:
+    enum class Operation { Insert, Activate, Find };
+
+    /// Routes the keys (and values) to their shards, applies the operation
+    /// and gathers shard ids, addresses and masks in input order.
+    void Dispatch(Operation op,
+                  const Tensor& input_keys,
+                  const Tensor* input_values,
+                  Tensor& output_shards,
+                  Tensor& output_addrs,
+                  Tensor& output_masks);
+
+    std::vector<Device> devices_;
+    std::vector<Hashmap> shards_;
+
+    /// Int64 {key byte size} weights of the key bytes in the shard hash.
+    Tensor hash_weights_;
+};
+
+}  // namespace core
+}  // namespace open3d
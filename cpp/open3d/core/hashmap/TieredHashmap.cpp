@@ -0,0 +1,234 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/hashmap/TieredHashmap.h"
+
+#include "open3d/core/hashmap/DeviceHashmap.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+TieredHashmap::TieredHashmap(int64_t device_capacity,
+                             const Dtype& dtype_key,
+                             const Dtype& dtype_value,
+                             const SizeVector& element_shape_key,
+                             const SizeVector& element_shape_value,
+                             const Device& device,
+                             int64_t max_idle_frames,
+                             const HashmapBackend& backend)
+    : device_hashmap_(device_capacity,
+                      dtype_key,
+                      dtype_value,
+                      element_shape_key,
+                      element_shape_value,
+                      device,
+                      backend),
+      host_hashmap_(device_capacity,
+                    dtype_key,
+                    dtype_value,
+                    element_shape_key,
+                    element_shape_value,
+                    Device("CPU:0")),
+      max_idle_frames_(max_idle_frames) {
+    if (device_capacity <= 0) {
+        utility::LogError(
+                "[TieredHashmap] device_capacity must be > 0, but got {}.",
+                device_capacity);
+    }
+    // last_access_ is indexed by address, so the device hashmap must not
+    // move entries. It never grows, but the open-addressing backend also
+    // rebuilds its table to drop tombstones, which keeps the addresses only
+    // in incremental mode.
+    if (device_hashmap_.GetDeviceHashmap()->SupportsIncrementalRehash()) {
+        HashmapGrowthPolicy policy = device_hashmap_.GetGrowthPolicy();
+        policy.incremental = true;
+        device_hashmap_.SetGrowthPolicy(policy);
+    }
+    last_access_ = Tensor::Full({device_hashmap_.GetCapacity()}, -1,
+                                Dtype::Int64, device);
+}
+
+void TieredHashmap::Insert(const Tensor& input_keys,
+                           const Tensor& input_values,
+                           Tensor& output_addrs,
+                           Tensor& output_masks) {
+    InsertMissing(input_keys, &input_values, output_addrs, output_masks);
+}
+
+void TieredHashmap::Activate(const Tensor& input_keys,
+                             Tensor& output_addrs,
+                             Tensor& output_masks) {
+    InsertMissing(input_keys, nullptr, output_addrs, output_masks);
+}
+
+void TieredHashmap::Find(const Tensor& input_keys,
+                         Tensor& output_addrs,
+                         Tensor& output_masks) {
+    FaultIn(input_keys);
+    device_hashmap_.Find(input_keys, output_addrs, output_masks);
+}
+
+void TieredHashmap::Erase(const Tensor& input_keys, Tensor& output_masks) {
+    Tensor host_masks;
+    device_hashmap_.Erase(input_keys, output_masks);
+    host_hashmap_.Erase(input_keys.To(Device("CPU:0")), host_masks);
+    output_masks = output_masks.LogicalOr(host_masks.To(GetDevice()));
+}
+
+int64_t TieredHashmap::NextFrame() {
+    ++frame_;
+    return max_idle_frames_ >= 0 ? Evict(max_idle_frames_) : 0;
+}
+
+int64_t TieredHashmap::Evict(int64_t max_idle_frames) {
+    if (device_hashmap_.Size() == 0) {
+        return 0;
+    }
+    Tensor active_addrs;
+    device_hashmap_.GetActiveIndices(active_addrs);
+    const Tensor addrs = active_addrs.To(Dtype::Int64);
+    const Tensor idle =
+            last_access_.IndexGet({addrs}).Lt(frame_ - max_idle_frames);
+    const Tensor idle_addrs = addrs.IndexGet({idle});
+    Spill(idle_addrs);
+    return idle_addrs.GetLength();
+}
+
+void TieredHashmap::Touch(const Tensor& addrs, const Tensor& masks) {
+    const Tensor touched = addrs.IndexGet({masks}).To(Dtype::Int64);
+    if (touched.GetLength() > 0) {
+        last_access_.IndexSet({touched},
+                              Tensor::Full({touched.GetLength()}, frame_,
+                                           Dtype::Int64, GetDevice()));
+    }
+}
+
+void TieredHashmap::Spill(const Tensor& addrs) {
+    if (addrs.GetLength() == 0) {
+        return;
+    }
+    const Tensor keys = device_hashmap_.GetKeyTensor().IndexGet({addrs});
+    const Tensor values = device_hashmap_.GetValueTensor().IndexGet({addrs});
+
+    Tensor host_addrs, masks;
+    host_hashmap_.Insert(keys.To(Device("CPU:0")), values.To(Device("CPU:0")),
+                         host_addrs, masks);
+    device_hashmap_.Erase(keys, masks);
+}
+
+void TieredHashmap::Reserve(int64_t count) {
+    const int64_t capacity = device_hashmap_.GetCapacity();
+    const int64_t num_spills = device_hashmap_.Size() + count - capacity;
+    if (num_spills <= 0) {
+        return;
+    }
+
+    Tensor active_addrs;
+    device_hashmap_.GetActiveIndices(active_addrs);
+    const Tensor addrs = active_addrs.To(Dtype::Int64);
+    const Tensor last_access = last_access_.IndexGet({addrs});
+    const Tensor order = last_access.ArgSort().Slice(0, 0, num_spills);
+
+    // Entries accessed in the current frame are in use by the caller.
+    if (num_spills > addrs.GetLength() ||
+        last_access.IndexGet({order}).Ge(frame_).Any()) {
+        utility::LogError(
+                "[TieredHashmap] The entries accessed in frame {} exceed the "
+                "device capacity {}.",
+                frame_, capacity);
+    }
+    Spill(addrs.IndexGet({order}));
+}
+
+Tensor TieredHashmap::FaultIn(const Tensor& keys) {
+    Tensor addrs, masks;
+    device_hashmap_.Find(keys, addrs, masks);
+    Touch(addrs, masks);
+
+    Tensor missing = masks.LogicalNot();
+    if (host_hashmap_.Size() == 0 || !missing.Any()) {
+        return missing;
+    }
+
+    const Tensor missing_keys = keys.IndexGet({missing}).To(Device("CPU:0"));
+    Tensor host_addrs, host_masks;
+    host_hashmap_.Find(missing_keys, host_addrs, host_masks);
+    if (!host_masks.Any()) {
+        return missing;
+    }
+
+    const Tensor host_keys = missing_keys.IndexGet({host_masks});
+    const Tensor host_values = host_hashmap_.GetValueTensor().IndexGet(
+            {host_addrs.IndexGet({host_masks}).To(Dtype::Int64)});
+    Reserve(host_keys.GetLength());
+    device_hashmap_.Insert(host_keys.To(GetDevice()),
+                           host_values.To(GetDevice()), addrs, masks);
+    Touch(addrs, masks);
+    host_hashmap_.Erase(host_keys, host_masks);
+
+    device_hashmap_.Find(keys, addrs, masks);
+    return masks.LogicalNot();
+}
+
+void TieredHashmap::InsertMissing(const Tensor& input_keys,
+                                  const Tensor* input_values,
+                                  Tensor& output_addrs,
+                                  Tensor& output_masks) {
+    const int64_t count = input_keys.GetLength();
+    output_addrs = Tensor::Zeros({count}, Dtype::Int32, GetDevice());
+    output_masks = Tensor::Zeros({count}, Dtype::Bool, GetDevice());
+
+    const Tensor missing = FaultIn(input_keys);
+    const Tensor missing_indices = missing.NonZero()[0];
+    const int64_t num_missing = missing_indices.GetLength();
+    if (num_missing == 0) {
+        return;
+    }
+
+    // Only the missing keys are inserted, so that the device hashmap never
+    // needs to grow and rehash, which would invalidate last_access_.
+    Reserve(num_missing);
+    const Tensor missing_keys = input_keys.IndexGet({missing_indices});
+    Tensor addrs, masks;
+    if (input_values != nullptr) {
+        device_hashmap_.Insert(missing_keys,
+                               input_values->IndexGet({missing_indices}),
+                               addrs, masks);
+    } else {
+        device_hashmap_.Activate(missing_keys, addrs, masks);
+    }
+    Touch(addrs, masks);
+
+    // Bool tensors are not supported by IndexSet.
+    Tensor output_flags = Tensor::Zeros({count}, Dtype::UInt8, GetDevice());
+    output_addrs.IndexSet({missing_indices}, addrs);
+    output_flags.IndexSet({missing_indices}, masks.To(Dtype::UInt8));
+    output_masks = output_flags.To(Dtype::Bool);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,141 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+
+namespace open3d {
+namespace core {
+
+/// A hashmap with a bounded working set on a (typically CUDA) device, backed
+/// by a CPU hashmap holding the cold entries.
+///
+/// Each entry lives in exactly one tier. The last frame in which a device
+/// entry was accessed is tracked per buffer address. Entries are spilled to
+/// the host tier when they have been idle for too long (see NextFrame() and
+/// Evict()), or in least recently used order when the device tier runs out
+/// of capacity. Find, Activate and Insert transparently fault host entries,
+/// including their values, back into the device tier.
+///
+/// Returned addresses index the buffers of GetDeviceHashmap(), which never
+/// grows beyond its initial capacity.
+class TieredHashmap {
+public:
+    /// \param device_capacity Maximum number of entries on \p device.
+    /// \param max_idle_frames Entries not accessed for more than this number
+    /// of frames are spilled by NextFrame(). Negative to only spill when the
+    /// device tier is full.
+    TieredHashmap(int64_t device_capacity,
+                  const Dtype& dtype_key,
+                  const Dtype& dtype_value,
+                  const SizeVector& element_shape_key,
+                  const SizeVector& element_shape_value,
+                  const Device& device,
+                  int64_t max_idle_frames = -1,
+                  const HashmapBackend& backend = HashmapBackend::Default);
+
+    /// Parallel insert arrays of keys and values in Tensors. Keys found in
+    /// either tier are not overwritten.
+    /// Return addrs and masks as in Hashmap::Insert, for the device tier.
+    void Insert(const Tensor& input_keys,
+                const Tensor& input_values,
+                Tensor& output_addrs,
+                Tensor& output_masks);
+
+    /// Parallel activate arrays of keys in Tensor. Keys in the host tier are
+    /// restored with their values and are not reported as activated.
+    void Activate(const Tensor& input_keys,
+                  Tensor& output_addrs,
+                  Tensor& output_masks);
+
+    /// Parallel find an array of keys in Tensor, faulting host entries into
+    /// the device tier.
+    void Find(const Tensor& input_keys,
+              Tensor& output_addrs,
+              Tensor& output_masks);
+
+    /// Parallel erase an array of keys in Tensor from both tiers.
+    void Erase(const Tensor& input_keys, Tensor& output_masks);
+
+    /// Advance the frame counter, and spill the entries idle for more than
+    /// max_idle_frames frames. Return the number of spilled entries.
+    int64_t NextFrame();
+
+    /// Spill the device entries not accessed in the last \p max_idle_frames
+    /// frames to the host tier. Return the number of spilled entries.
+    int64_t Evict(int64_t max_idle_frames);
+
+    int64_t GetFrame() const { return frame_; }
+
+    /// Return the number of entries in both tiers.
+    int64_t Size() const {
+        return device_hashmap_.Size() + host_hashmap_.Size();
+    }
+    int64_t GetDeviceSize() const { return device_hashmap_.Size(); }
+    int64_t GetHostSize() const { return host_hashmap_.Size(); }
+
+    Device GetDevice() const { return device_hashmap_.GetDevice(); }
+
+    /// The working set. Do not insert into it directly, since the access
+    /// recency would not be tracked.
+    const Hashmap& GetDeviceHashmap() const { return device_hashmap_; }
+    const Hashmap& GetHostHashmap() const { return host_hashmap_; }
+
+protected:
+    /// Marks the device entries at \p addrs[masks] as accessed this frame.
+    void Touch(const Tensor& addrs, const Tensor& masks);
+
+    /// Moves the device entries at Int64 \p addrs to the host tier.
+    void Spill(const Tensor& addrs);
+
+    /// Spills least recently used entries until \p count more entries fit.
+    void Reserve(int64_t count);
+
+    /// Moves the host entries of \p keys to the device tier, and touches the
+    /// device entries of \p keys. Return the Bool mask of keys that are not
+    /// in either tier.
+    Tensor FaultIn(const Tensor& keys);
+
+    /// Inserts the keys, and values if defined, that are in neither tier.
+    void InsertMissing(const Tensor& input_keys,
+                       const Tensor* input_values,
+                       Tensor& output_addrs,
+                       Tensor& output_masks);
+
+    Hashmap device_hashmap_;
+    Hashmap host_hashmap_;
+
+    /// Int64 {device capacity}: last accessed frame per device address.
+    Tensor last_access_;
+    int64_t frame_ = 0;
+    int64_t max_idle_frames_;
+};
+
+}  // namespace core
+}  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "open3d/core/kernel/Arange.h"
 
+#include "open3d/core/Profiler.h"
 #include "open3d/core/Tensor.h"
 
 namespace open3d {
@@ -33,6 +34,8 @@ namespace core {
 namespace kernel {
 
 Tensor Arange(const Tensor& start, const Tensor& stop, const Tensor& step) {
+    OPEN3D_PROFILE_SCOPE("Arange", start.GetDevice());
+
     start.AssertShape({}, "Start tensor must have shape {}.");
     stop.AssertShape({}, "Stop tensor must have shape {}.");
     step.AssertShape({}, "Step tensor must have shape {}.");
@@ -28,6 +28,7 @@
 
 #include <vector>
 
+#include "open3d/core/Profiler.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Logging.h"
@@ -45,10 +46,22 @@ const std::unordered_set<BinaryEWOpCode, utility::hash_enum_class>
                 BinaryEWOpCode::Ne,
         };
 
+// Profiling scope names, in the order of BinaryEWOpCode.
+static const char* const s_binary_ew_op_names[] = {
+        "BinaryEW::Add",        "BinaryEW::Sub",        "BinaryEW::Mul",
+        "BinaryEW::Div",        "BinaryEW::LogicalAnd", "BinaryEW::LogicalOr",
+        "BinaryEW::LogicalXor", "BinaryEW::Gt",         "BinaryEW::Lt",
+        "BinaryEW::Ge",         "BinaryEW::Le",         "BinaryEW::Eq",
+        "BinaryEW::Ne",
+};
+
 void BinaryEW(const Tensor& lhs,
               const Tensor& rhs,
               Tensor& dst,
               BinaryEWOpCode op_code) {
+    OPEN3D_PROFILE_SCOPE(s_binary_ew_op_names[static_cast<int>(op_code)],
+                         lhs.GetDevice());
+
     // lhs, rhs and dst must be on the same device.
     for (auto device :
          std::vector<Device>({rhs.GetDevice(), dst.GetDevice()})) {
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <type_traits>
+
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
@@ -37,91 +39,172 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
+// The element kernels take and return values so that they can be inlined into
+// the vectorized loops of the contiguous path.
+
 template <typename scalar_t>
-static void CPUAddElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<scalar_t*>(dst) = *static_cast<const scalar_t*>(lhs) +
-                                   *static_cast<const scalar_t*>(rhs);
-}
+struct CPUAddElementKernel {
+    scalar_t operator()(scalar_t lhs, scalar_t rhs) const { return lhs + rhs; }
+};
 
 template <typename scalar_t>
-static void CPUSubElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<scalar_t*>(dst) = *static_cast<const scalar_t*>(lhs) -
-                                   *static_cast<const scalar_t*>(rhs);
-}
+struct CPUSubElementKernel {
+    scalar_t operator()(scalar_t lhs, scalar_t rhs) const { return lhs - rhs; }
+};
 
 template <typename scalar_t>
-static void CPUMulElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<scalar_t*>(dst) = *static_cast<const scalar_t*>(lhs) *
-                                   *static_cast<const scalar_t*>(rhs);
-}
+struct CPUMulElementKernel {
+    scalar_t operator()(scalar_t lhs, scalar_t rhs) const { return lhs * rhs; }
+};
 
 template <typename scalar_t>
-static void CPUDivElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<scalar_t*>(dst) = *static_cast<const scalar_t*>(lhs) /
-                                   *static_cast<const scalar_t*>(rhs);
-}
+struct CPUDivElementKernel {
+    scalar_t operator()(scalar_t lhs, scalar_t rhs) const { return lhs / rhs; }
+};
 
 template <typename src_t, typename dst_t>
-static void CPULogicalAndElementKernel(const void* lhs,
-                                       const void* rhs,
-                                       void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            static_cast<bool>(*static_cast<const src_t*>(lhs)) &&
-            static_cast<bool>(*static_cast<const src_t*>(rhs)));
-}
+struct CPULogicalAndElementKernel {
+    dst_t operator()(src_t lhs, src_t rhs) const {
+        return static_cast<dst_t>(static_cast<bool>(lhs) &&
+                                  static_cast<bool>(rhs));
+    }
+};
 
 template <typename src_t, typename dst_t>
-static void CPULogicalOrElementKernel(const void* lhs,
-                                      const void* rhs,
-                                      void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            static_cast<bool>(*static_cast<const src_t*>(lhs)) ||
-            static_cast<bool>(*static_cast<const src_t*>(rhs)));
-}
+struct CPULogicalOrElementKernel {
+    dst_t operator()(src_t lhs, src_t rhs) const {
+        return static_cast<dst_t>(static_cast<bool>(lhs) ||
+                                  static_cast<bool>(rhs));
+    }
+};
 
 template <typename src_t, typename dst_t>
-static void CPULogicalXorElementKernel(const void* lhs,
-                                       const void* rhs,
-                                       void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            static_cast<bool>(*static_cast<const src_t*>(lhs)) !=
-            static_cast<bool>(*static_cast<const src_t*>(rhs)));
-}
+struct CPULogicalXorElementKernel {
+    dst_t operator()(src_t lhs, src_t rhs) const {
+        return static_cast<dst_t>(static_cast<bool>(lhs) !=
+                                  static_cast<bool>(rhs));
+    }
+};
 
 template <typename src_t, typename dst_t>
-static void CPUGtElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) > *static_cast<const src_t*>(rhs));
-}
+struct CPUGtElementKernel {
+    dst_t operator()(src_t lhs, src_t rhs) const {
+        return static_cast<dst_t>(lhs > rhs);
+    }
+};
 
 template <typename src_t, typename dst_t>
-static void CPULtElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) < *static_cast<const src_t*>(rhs));
-}
+struct CPULtElementKernel {
+    dst_t operator()(src_t lhs, src_t rhs) const {
+        return static_cast<dst_t>(lhs < rhs);
+    }
+};
 
 template <typename src_t, typename dst_t>
-static void CPUGeqElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) >= *static_cast<const src_t*>(rhs));
-}
+struct CPUGeqElementKernel {
+    dst_t operator()(src_t lhs, src_t rhs) const {
+        return static_cast<dst_t>(lhs >= rhs);
+    }
+};
 
 template <typename src_t, typename dst_t>
-static void CPULeqElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) <= *static_cast<const src_t*>(rhs));
-}
+struct CPULeqElementKernel {
+    dst_t operator()(src_t lhs, src_t rhs) const {
+        return static_cast<dst_t>(lhs <= rhs);
+    }
+};
 
 template <typename src_t, typename dst_t>
-static void CPUEqElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) == *static_cast<const src_t*>(rhs));
-}
+struct CPUEqElementKernel {
+    dst_t operator()(src_t lhs, src_t rhs) const {
+        return static_cast<dst_t>(lhs == rhs);
+    }
+};
 
 template <typename src_t, typename dst_t>
-static void CPUNeqElementKernel(const void* lhs, const void* rhs, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            *static_cast<const src_t*>(lhs) != *static_cast<const src_t*>(rhs));
+struct CPUNeqElementKernel {
+    dst_t operator()(src_t lhs, src_t rhs) const {
+        return static_cast<dst_t>(lhs != rhs);
+    }
+};
+
+/// Returns true if \p src can be read as a raw array aligned with the
+/// contiguous \p dst, either element by element or as a broadcasted scalar.
+static bool IsContiguousOperand(const Tensor& src, const Tensor& dst) {
+    return src.IsContiguous() &&
+           (src.GetShape() == dst.GetShape() || src.NumElements() == 1);
+}
+
+template <typename src_t, typename dst_t, typename element_kernel_t>
+static void LaunchBinaryEWIndexerKernel(
+        const Tensor& lhs,
+        const Tensor& rhs,
+        Tensor& dst,
+        DtypePolicy dtype_policy,
+        const element_kernel_t& element_kernel) {
+    Indexer indexer({lhs, rhs}, dst, dtype_policy);
+    cpu_launcher::LaunchBinaryEWKernel(
+            indexer,
+            [&](const void* lhs_ptr, const void* rhs_ptr, void* dst_ptr) {
+                *static_cast<dst_t*>(dst_ptr) =
+                        element_kernel(*static_cast<const src_t*>(lhs_ptr),
+                                       *static_cast<const src_t*>(rhs_ptr));
+            });
+}
+
+template <typename src_t, typename dst_t, typename element_kernel_t>
+static void LaunchBinaryEWCPUKernel(const Tensor& lhs,
+                                    const Tensor& rhs,
+                                    Tensor& dst,
+                                    DtypePolicy dtype_policy,
+                                    const element_kernel_t& element_kernel,
+                                    std::true_type /*has_contiguous_path*/) {
+    if (lhs.GetDtype() == rhs.GetDtype() &&
+        dst.GetDtype() == Dtype::FromType<dst_t>() && dst.IsContiguous() &&
+        IsContiguousOperand(lhs, dst) && IsContiguousOperand(rhs, dst)) {
+        const int64_t num_elements = dst.NumElements();
+        cpu_launcher::LaunchBinaryEWContiguousKernel(
+                static_cast<const src_t*>(lhs.GetDataPtr()),
+                lhs.NumElements() != num_elements,
+                static_cast<const src_t*>(rhs.GetDataPtr()),
+                rhs.NumElements() != num_elements,
+                static_cast<dst_t*>(dst.GetDataPtr()), num_elements,
+                element_kernel);
+    } else {
+        LaunchBinaryEWIndexerKernel<src_t, dst_t>(lhs, rhs, dst, dtype_policy,
+                                                  element_kernel);
+    }
+}
+
+template <typename src_t, typename dst_t, typename element_kernel_t>
+static void LaunchBinaryEWCPUKernel(const Tensor& lhs,
+                                    const Tensor& rhs,
+                                    Tensor& dst,
+                                    DtypePolicy dtype_policy,
+                                    const element_kernel_t& element_kernel,
+                                    std::false_type /*has_contiguous_path*/) {
+    LaunchBinaryEWIndexerKernel<src_t, dst_t>(lhs, rhs, dst, dtype_policy,
+                                              element_kernel);
+}
+
+/// Launches \p element_kernel over all elements of \p dst. When all operands
+/// are contiguous and no strided broadcasting is involved, the kernel runs on
+/// raw pointers. Otherwise, the Indexer computes the per-element offsets.
+///
+/// The raw pointer path is only instantiated for the HotScalarTypes. Rare
+/// dtypes, e.g. Int8 or Float16, always use the Indexer.
+template <typename src_t, typename dst_t, typename element_kernel_t>
+static void LaunchBinaryEWCPUKernel(const Tensor& lhs,
+                                    const Tensor& rhs,
+                                    Tensor& dst,
+                                    DtypePolicy dtype_policy,
+                                    const element_kernel_t& element_kernel) {
+    using has_contiguous_path = std::integral_constant<
+            bool, ScalarTypeListContains<src_t, HotScalarTypes>::value &&
+                          ScalarTypeListContains<dst_t, HotScalarTypes>::value>;
+    LaunchBinaryEWCPUKernel<src_t, dst_t>(lhs, rhs, dst, dtype_policy,
+                                          element_kernel,
+                                          has_contiguous_path());
 }
 
 template <typename src_t, typename dst_t>
@@ -129,43 +212,52 @@ static void LaunchBoolBinaryEWCPUKernel(const Tensor& lhs,
                                         const Tensor& rhs,
                                         Tensor& dst,
                                         BinaryEWOpCode op_code,
-                                        const Indexer& indexer) {
+                                        DtypePolicy dtype_policy) {
     switch (op_code) {
         case BinaryEWOpCode::LogicalAnd:
-            cpu_launcher::LaunchBinaryEWKernel(
-                    indexer, CPULogicalAndElementKernel<src_t, dst_t>);
+            LaunchBinaryEWCPUKernel<src_t, dst_t>(
+                    lhs, rhs, dst, dtype_policy,
+                    CPULogicalAndElementKernel<src_t, dst_t>());
             break;
         case BinaryEWOpCode::LogicalOr:
-            cpu_launcher::LaunchBinaryEWKernel(
-                    indexer, CPULogicalOrElementKernel<src_t, dst_t>);
+            LaunchBinaryEWCPUKernel<src_t, dst_t>(
+                    lhs, rhs, dst, dtype_policy,
+                    CPULogicalOrElementKernel<src_t, dst_t>());
             break;
         case BinaryEWOpCode::LogicalXor:
-            cpu_launcher::LaunchBinaryEWKernel(
-                    indexer, CPULogicalXorElementKernel<src_t, dst_t>);
+            LaunchBinaryEWCPUKernel<src_t, dst_t>(
+                    lhs, rhs, dst, dtype_policy,
+                    CPULogicalXorElementKernel<src_t, dst_t>());
             break;
         case BinaryEWOpCode::Gt:
-            cpu_launcher::LaunchBinaryEWKernel(
-                    indexer, CPUGtElementKernel<src_t, dst_t>);
+            LaunchBinaryEWCPUKernel<src_t, dst_t>(
+                    lhs, rhs, dst, dtype_policy,
+                    CPUGtElementKernel<src_t, dst_t>());
             break;
         case BinaryEWOpCode::Lt:
-            cpu_launcher::LaunchBinaryEWKernel(
-                    indexer, CPULtElementKernel<src_t, dst_t>);
+            LaunchBinaryEWCPUKernel<src_t, dst_t>(
+                    lhs, rhs, dst, dtype_policy,
+                    CPULtElementKernel<src_t, dst_t>());
             break;
         case BinaryEWOpCode::Ge:
-            cpu_launcher::LaunchBinaryEWKernel(
-                    indexer, CPUGeqElementKernel<src_t, dst_t>);
+            LaunchBinaryEWCPUKernel<src_t, dst_t>(
+                    lhs, rhs, dst, dtype_policy,
+                    CPUGeqElementKernel<src_t, dst_t>());
             break;
         case BinaryEWOpCode::Le:
-            cpu_launcher::LaunchBinaryEWKernel(
-                    indexer, CPULeqElementKernel<src_t, dst_t>);
+            LaunchBinaryEWCPUKernel<src_t, dst_t>(
+                    lhs, rhs, dst, dtype_policy,
+                    CPULeqElementKernel<src_t, dst_t>());
             break;
         case BinaryEWOpCode::Eq:
-            cpu_launcher::LaunchBinaryEWKernel(
-                    indexer, CPUEqElementKernel<src_t, dst_t>);
+            LaunchBinaryEWCPUKernel<src_t, dst_t>(
+                    lhs, rhs, dst, dtype_policy,
+                    CPUEqElementKernel<src_t, dst_t>());
             break;
         case BinaryEWOpCode::Ne:
-            cpu_launcher::LaunchBinaryEWKernel(
-                    indexer, CPUNeqElementKernel<src_t, dst_t>);
+            LaunchBinaryEWCPUKernel<src_t, dst_t>(
+                    lhs, rhs, dst, dtype_policy,
+                    CPUNeqElementKernel<src_t, dst_t>());
             break;
         default:
             break;
@@ -181,20 +273,18 @@ void BinaryEWCPU(const Tensor& lhs,
 
     if (s_boolean_binary_ew_op_codes.find(op_code) !=
         s_boolean_binary_ew_op_codes.end()) {
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
                 // Inplace boolean op's output type is the same as the
                 // input. e.g. np.logical_and(a, b, out=a), where a, b are
                 // floats.
-                Indexer indexer({lhs, rhs}, dst, DtypePolicy::ALL_SAME);
                 LaunchBoolBinaryEWCPUKernel<scalar_t, scalar_t>(
-                        lhs, rhs, dst, op_code, indexer);
+                        lhs, rhs, dst, op_code, DtypePolicy::ALL_SAME);
             } else if (dst_dtype == Dtype::Bool) {
                 // By default, output is boolean type.
-                Indexer indexer({lhs, rhs}, dst,
-                                DtypePolicy::INPUT_SAME_OUTPUT_BOOL);
-                LaunchBoolBinaryEWCPUKernel<scalar_t, bool>(lhs, rhs, dst,
-                                                            op_code, indexer);
+                LaunchBoolBinaryEWCPUKernel<scalar_t, bool>(
+                        lhs, rhs, dst, op_code,
+                        DtypePolicy::INPUT_SAME_OUTPUT_BOOL);
             } else {
                 utility::LogError(
                         "Boolean op's output type must be boolean or the "
@@ -202,24 +292,27 @@ void BinaryEWCPU(const Tensor& lhs,
             }
         });
     } else {
-        Indexer indexer({lhs, rhs}, dst, DtypePolicy::ALL_SAME);
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             switch (op_code) {
                 case BinaryEWOpCode::Add:
-                    cpu_launcher::LaunchBinaryEWKernel(
-                            indexer, CPUAddElementKernel<scalar_t>);
+                    LaunchBinaryEWCPUKernel<scalar_t, scalar_t>(
+                            lhs, rhs, dst, DtypePolicy::ALL_SAME,
+                            CPUAddElementKernel<scalar_t>());
                     break;
                 case BinaryEWOpCode::Sub:
-                    cpu_launcher::LaunchBinaryEWKernel(
-                            indexer, CPUSubElementKernel<scalar_t>);
+                    LaunchBinaryEWCPUKernel<scalar_t, scalar_t>(
+                            lhs, rhs, dst, DtypePolicy::ALL_SAME,
+                            CPUSubElementKernel<scalar_t>());
                     break;
                 case BinaryEWOpCode::Mul:
-                    cpu_launcher::LaunchBinaryEWKernel(
-                            indexer, CPUMulElementKernel<scalar_t>);
+                    LaunchBinaryEWCPUKernel<scalar_t, scalar_t>(
+                            lhs, rhs, dst, DtypePolicy::ALL_SAME,
+                            CPUMulElementKernel<scalar_t>());
                     break;
                 case BinaryEWOpCode::Div:
-                    cpu_launcher::LaunchBinaryEWKernel(
-                            indexer, CPUDivElementKernel<scalar_t>);
+                    LaunchBinaryEWCPUKernel<scalar_t, scalar_t>(
+                            lhs, rhs, dst, DtypePolicy::ALL_SAME,
+                            CPUDivElementKernel<scalar_t>());
                     break;
                 default:
                     break;
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 #include "open3d/core/AdvancedIndexing.h"
@@ -34,11 +35,23 @@
 #include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/utility/Logging.h"
 
+// `#pragma omp simd` requires OpenMP 4.0. Older OpenMP implementations (e.g.
+// MSVC) rely on the compiler's auto-vectorizer instead.
+#if defined(_OPENMP) && _OPENMP >= 201307
+#define OPEN3D_PRAGMA_OMP_SIMD _Pragma("omp simd")
+#else
+#define OPEN3D_PRAGMA_OMP_SIMD
+#endif
+
 namespace open3d {
 namespace core {
 namespace kernel {
 namespace cpu_launcher {
 
+/// Minimum number of elements processed by each thread in the contiguous
+/// element-wise kernels. Smaller workloads do not benefit from more threads.
+static constexpr int64_t CONTIGUOUS_EW_GRAIN_SIZE = 32768;
+
 /// \brief Run a function in parallel on CPU.
 ///
 /// This is typically used together with cuda_launcher::ParallelFor() to
@@ -67,7 +80,7 @@ namespace cpu_launcher {
 /// to be used on both CPU and CUDA, capture the variables by value.
 template <typename func_t>
 void ParallelFor(int64_t n, const func_t& func) {
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(GetMaxThreads())
     for (int64_t i = 0; i < n; ++i) {
         func(i);
     }
@@ -75,6 +88,9 @@ void ParallelFor(int64_t n, const func_t& func) {
 
 /// Fills tensor[:][i] with func(i).
 ///
+/// This and the other Launch*Kernel() functions run on the calling thread if
+/// the number of workloads is below GetParallelThreshold().
+///
 /// \param indexer The input tensor and output tensor to the indexer are the
 /// same (as a hack), since the tensor are filled in-place.
 /// \param func A function that takes pointer location and
@@ -82,7 +98,8 @@ void ParallelFor(int64_t n, const func_t& func) {
 /// pointer location.
 template <typename func_t>
 void LaunchIndexFillKernel(const Indexer& indexer, const func_t& func) {
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(GetMaxThreads()) \
+        if (ShouldParallelize(indexer.NumWorkloads()))
     for (int64_t i = 0; i < indexer.NumWorkloads(); ++i) {
         func(indexer.GetInputPtr(0, i), i);
     }
@@ -90,7 +107,8 @@ void LaunchIndexFillKernel(const Indexer& indexer, const func_t& func) {
 
 template <typename func_t>
 void LaunchUnaryEWKernel(const Indexer& indexer, const func_t& func) {
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(GetMaxThreads()) \
+        if (ShouldParallelize(indexer.NumWorkloads()))
     for (int64_t i = 0; i < indexer.NumWorkloads(); ++i) {
         func(indexer.GetInputPtr(0, i), indexer.GetOutputPtr(i));
     }
@@ -98,17 +116,110 @@ void LaunchUnaryEWKernel(const Indexer& indexer, const func_t& func) {
 
 template <typename func_t>
 void LaunchBinaryEWKernel(const Indexer& indexer, const func_t& func) {
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(GetMaxThreads()) \
+        if (ShouldParallelize(indexer.NumWorkloads()))
     for (int64_t i = 0; i < indexer.NumWorkloads(); ++i) {
         func(indexer.GetInputPtr(0, i), indexer.GetInputPtr(1, i),
              indexer.GetOutputPtr(i));
     }
 }
 
+/// \brief Run a function in parallel on disjoint ranges covering [0, n).
+///
+/// Each thread gets one contiguous range of at least \p grain_size workloads,
+/// so that \p func can run a tight (vectorizable) loop over the range.
+///
+/// \param n The number of workloads.
+/// \param grain_size The minimum number of workloads per range.
+/// \param func The function to be executed in parallel, with signature
+/// `void func(int64_t start, int64_t end)`.
+template <typename func_t>
+void ParallelForRange(int64_t n, int64_t grain_size, const func_t& func) {
+    if (n <= 0) {
+        return;
+    }
+    const int64_t num_ranges = std::max<int64_t>(
+            1, std::min<int64_t>(GetMaxThreads(), n / grain_size));
+    if (num_ranges == 1) {
+        // Skip the parallel region setup for small workloads.
+        func(0, n);
+        return;
+    }
+    const int64_t range_size = (n + num_ranges - 1) / num_ranges;
+#pragma omp parallel for schedule(static) num_threads(num_ranges)
+    for (int64_t range_idx = 0; range_idx < num_ranges; ++range_idx) {
+        const int64_t start = range_idx * range_size;
+        const int64_t end = std::min(start + range_size, n);
+        if (start < end) {
+            func(start, end);
+        }
+    }
+}
+
+/// Runs `dst[i] = op(src[i])` over contiguous raw arrays of \p n elements.
+///
+/// Unlike LaunchUnaryEWKernel(), the element types are known at compile time
+/// and no per-element offset is computed, which allows the compiler to
+/// vectorize the loop with the instruction set it targets (SSE/AVX/AVX-512 or
+/// NEON).
+template <typename src_t, typename dst_t, typename op_t>
+void LaunchUnaryEWContiguousKernel(const src_t* src,
+                                   dst_t* dst,
+                                   int64_t n,
+                                   const op_t& op) {
+    ParallelForRange(n, CONTIGUOUS_EW_GRAIN_SIZE,
+                     [&](int64_t start, int64_t end) {
+                         OPEN3D_PRAGMA_OMP_SIMD
+                         for (int64_t i = start; i < end; ++i) {
+                             dst[i] = op(src[i]);
+                         }
+                     });
+}
+
+/// Runs `dst[i] = op(lhs[i], rhs[i])` over contiguous raw arrays of \p n
+/// elements. If \p lhs_is_scalar (resp. \p rhs_is_scalar) is true, lhs[0]
+/// (resp. rhs[0]) is broadcasted to all elements.
+template <typename src_t, typename dst_t, typename op_t>
+void LaunchBinaryEWContiguousKernel(const src_t* lhs,
+                                    bool lhs_is_scalar,
+                                    const src_t* rhs,
+                                    bool rhs_is_scalar,
+                                    dst_t* dst,
+                                    int64_t n,
+                                    const op_t& op) {
+    ParallelForRange(
+            n, CONTIGUOUS_EW_GRAIN_SIZE, [&](int64_t start, int64_t end) {
+                if (lhs_is_scalar && rhs_is_scalar) {
+                    const dst_t value = op(lhs[0], rhs[0]);
+                    for (int64_t i = start; i < end; ++i) {
+                        dst[i] = value;
+                    }
+                } else if (lhs_is_scalar) {
+                    const src_t lhs_value = lhs[0];
+                    OPEN3D_PRAGMA_OMP_SIMD
+                    for (int64_t i = start; i < end; ++i) {
+                        dst[i] = op(lhs_value, rhs[i]);
+                    }
+                } else if (rhs_is_scalar) {
+                    const src_t rhs_value = rhs[0];
+                    OPEN3D_PRAGMA_OMP_SIMD
+                    for (int64_t i = start; i < end; ++i) {
+                        dst[i] = op(lhs[i], rhs_value);
+                    }
+                } else {
+                    OPEN3D_PRAGMA_OMP_SIMD
+                    for (int64_t i = start; i < end; ++i) {
+                        dst[i] = op(lhs[i], rhs[i]);
+                    }
+                }
+            });
+}
+
 template <typename func_t>
 void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
                                  const func_t& func) {
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(GetMaxThreads()) \
+        if (ShouldParallelize(indexer.NumWorkloads()))
     for (int64_t i = 0; i < indexer.NumWorkloads(); ++i) {
         func(indexer.GetInputPtr(i), indexer.GetOutputPtr(i));
     }
@@ -138,7 +249,7 @@ void LaunchReductionKernelTwoPass(const Indexer& indexer,
             (num_workloads + num_threads - 1) / num_threads;
     std::vector<scalar_t> thread_results(num_threads, identity);
 
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(num_threads)
     for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
         int64_t start = thread_idx * workload_per_thread;
         int64_t end = std::min(start + workload_per_thread, num_workloads);
@@ -179,7 +290,7 @@ void LaunchReductionParallelDim(const Indexer& indexer, const func_t& func) {
                 "LaunchReductionKernelTwoPass instead.");
     }
 
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) num_threads(num_threads)
     for (int64_t i = 0; i < indexer_shape[best_dim]; ++i) {
         Indexer sub_indexer(indexer);
         sub_indexer.ShrinkDim(best_dim, i, 1);
@@ -30,6 +30,7 @@
 #include <cuda_runtime.h>
 
 #include "open3d/core/AdvancedIndexing.h"
+#include "open3d/core/CUDAState.cuh"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/SizeVector.h"
@@ -40,6 +41,9 @@
 //
 // The kernel launch mechanism is inspired by PyTorch's launch Loops.cuh.
 // See: https://tinyurl.com/y4lak257
+//
+// All kernels are launched to the current stream of the calling thread, see
+// CUDAStream and CUDAScopedStream.
 
 static constexpr int64_t default_block_size = 128;
 static constexpr int64_t default_thread_size = 4;
@@ -99,7 +103,8 @@ void ParallelFor(int64_t n, const func_t& func) {
     int64_t grid_size = (n + items_per_block - 1) / items_per_block;
 
     ElementWiseKernel<default_block_size, default_thread_size>
-            <<<grid_size, default_block_size, 0>>>(n, func);
+            <<<grid_size, default_block_size, 0, CUDAStream::GetCurrent()>>>(
+                    n, func);
     OPEN3D_GET_LAST_CUDA_ERROR("ParallelFor failed.");
 }
 
@@ -119,7 +124,8 @@ void LaunchUnaryEWKernel(const Indexer& indexer, const func_t& func) {
     };
 
     ElementWiseKernel<default_block_size, default_thread_size>
-            <<<grid_size, default_block_size, 0>>>(n, f);
+            <<<grid_size, default_block_size, 0, CUDAStream::GetCurrent()>>>(
+                    n, f);
     OPEN3D_GET_LAST_CUDA_ERROR("LaunchUnaryEWKernel failed.");
 }
 
@@ -140,7 +146,8 @@ void LaunchBinaryEWKernel(const Indexer& indexer, const func_t& func) {
     };
 
     ElementWiseKernel<default_block_size, default_thread_size>
-            <<<grid_size, default_block_size, 0>>>(n, f);
+            <<<grid_size, default_block_size, 0, CUDAStream::GetCurrent()>>>(
+                    n, f);
     OPEN3D_GET_LAST_CUDA_ERROR("LaunchBinaryEWKernel failed.");
 }
 
@@ -161,7 +168,8 @@ void LaunchAdvancedIndexerKernel(const AdvancedIndexer& indexer,
     };
 
     ElementWiseKernel<default_block_size, default_thread_size>
-            <<<grid_size, default_block_size, 0>>>(n, f);
+            <<<grid_size, default_block_size, 0, CUDAStream::GetCurrent()>>>(
+                    n, f);
     OPEN3D_GET_LAST_CUDA_ERROR("LaunchAdvancedIndexerKernel failed.");
 }
 
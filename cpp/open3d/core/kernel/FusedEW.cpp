@@ -0,0 +1,155 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/FusedEW.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "open3d/core/Indexer.h"
+#include "open3d/core/Profiler.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+int64_t FusedEWStackDepth(const std::vector<FusedEWInstruction>& program) {
+    int64_t depth = 0;
+    int64_t max_depth = 0;
+    for (const FusedEWInstruction& instruction : program) {
+        switch (instruction.op_code_) {
+            case FusedEWOpCode::Input:
+            case FusedEWOpCode::Scalar:
+                depth++;
+                break;
+            case FusedEWOpCode::Add:
+            case FusedEWOpCode::Sub:
+            case FusedEWOpCode::Mul:
+            case FusedEWOpCode::Div:
+                if (depth < 2) {
+                    utility::LogError(
+                            "Malformed fused program: binary op requires two "
+                            "operands.");
+                }
+                depth--;
+                break;
+            default:
+                if (depth < 1) {
+                    utility::LogError(
+                            "Malformed fused program: unary op requires one "
+                            "operand.");
+                }
+                break;
+        }
+        max_depth = std::max(max_depth, depth);
+    }
+    if (depth != 1) {
+        utility::LogError(
+                "Malformed fused program: {} values left on the stack, "
+                "expected 1.",
+                depth);
+    }
+    return max_depth;
+}
+
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst) {
+    OPEN3D_PROFILE_SCOPE("FusedEW", dst.GetDevice());
+
+    if (inputs.empty()) {
+        utility::LogError("FusedEW requires at least one input tensor.");
+    }
+    if (static_cast<int64_t>(inputs.size()) > MAX_INPUTS) {
+        utility::LogError("FusedEW supports at most {} inputs, but got {}.",
+                          MAX_INPUTS, inputs.size());
+    }
+    if (static_cast<int64_t>(program.size()) > MAX_FUSED_EW_INSTRUCTIONS) {
+        utility::LogError(
+                "FusedEW supports at most {} instructions, but got {}.",
+                MAX_FUSED_EW_INSTRUCTIONS, program.size());
+    }
+    if (FusedEWStackDepth(program) > MAX_FUSED_EW_STACK_DEPTH) {
+        utility::LogError("FusedEW supports a stack depth of at most {}.",
+                          MAX_FUSED_EW_STACK_DEPTH);
+    }
+
+    const Dtype dtype = dst.GetDtype();
+    const Device device = dst.GetDevice();
+    for (const Tensor& input : inputs) {
+        if (input.GetDevice() != device) {
+            utility::LogError("Device mismatch {} != {}.",
+                              input.GetDevice().ToString(), device.ToString());
+        }
+        if (input.GetDtype() != dtype) {
+            utility::LogError("Dtype mismatch {} != {}.",
+                              input.GetDtype().ToString(), dtype.ToString());
+        }
+        if (!shape_util::CanBeBrocastedToShape(input.GetShape(),
+                                               dst.GetShape())) {
+            utility::LogError("Shape {} cannot be broadcasted to {}.",
+                              input.GetShape(), dst.GetShape());
+        }
+    }
+
+    for (const FusedEWInstruction& instruction : program) {
+        if (instruction.op_code_ == FusedEWOpCode::Input &&
+            (instruction.input_idx_ < 0 ||
+             instruction.input_idx_ >= static_cast<int64_t>(inputs.size()))) {
+            utility::LogError("Fused program input index {} out of range.",
+                              instruction.input_idx_);
+        }
+        if ((instruction.op_code_ == FusedEWOpCode::Sqrt ||
+             instruction.op_code_ == FusedEWOpCode::Exp ||
+             instruction.op_code_ == FusedEWOpCode::Sin ||
+             instruction.op_code_ == FusedEWOpCode::Cos) &&
+            dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+            utility::LogError(
+                    "Only supports Float32 and Float64, but {} is used.",
+                    dtype.ToString());
+        }
+    }
+
+    Device::DeviceType device_type = device.GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        FusedEWCPU(inputs, program, dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FusedEWCUDA(inputs, program, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("FusedEW: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Scalar.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Op codes of a fused element-wise program. A program is a list of
+/// instructions in postfix (reverse Polish) order that operates on a small
+/// per-element value stack: Input and Scalar push one value, unary ops replace
+/// the top value and binary ops pop two values and push the result.
+enum class FusedEWOpCode {
+    Input,
+    Scalar,
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Neg,
+    Abs,
+    Sqrt,
+    Exp,
+    Sin,
+    Cos,
+};
+
+/// Maximum number of instructions in one fused element-wise program.
+static constexpr int64_t MAX_FUSED_EW_INSTRUCTIONS = 32;
+
+/// Maximum per-element stack depth required by a fused element-wise program.
+static constexpr int64_t MAX_FUSED_EW_STACK_DEPTH = 8;
+
+struct FusedEWInstruction {
+    FusedEWInstruction(FusedEWOpCode op_code,
+                       int64_t input_idx = -1,
+                       Scalar scalar = 0.0)
+        : op_code_(op_code), input_idx_(input_idx), scalar_(scalar) {}
+
+    FusedEWOpCode op_code_;
+    /// Index into the input tensor list, only used by FusedEWOpCode::Input.
+    int64_t input_idx_;
+    /// Constant value, only used by FusedEWOpCode::Scalar. The value is casted
+    /// to the dtype of the inputs, same as e.g. Tensor::Add(Scalar).
+    Scalar scalar_;
+};
+
+/// Returns the per-element stack depth required to run \p program. Throws an
+/// exception if the program is malformed, i.e. it does not leave exactly one
+/// value on the stack.
+int64_t FusedEWStackDepth(const std::vector<FusedEWInstruction>& program);
+
+/// Evaluates \p program element-wise in a single pass.
+///
+/// \param inputs Input tensors referenced by FusedEWOpCode::Input. All inputs
+/// must have the same dtype and device as \p dst and must be broadcastable to
+/// the shape of \p dst. At most MAX_INPUTS inputs are supported.
+/// \param program Postfix instruction list, see FusedEWOpCode.
+/// \param dst Output tensor. Values are computed in the dtype of \p dst, so the
+/// results are the same as running the ops one by one.
+void FusedEW(const std::vector<Tensor>& inputs,
+             const std::vector<FusedEWInstruction>& program,
+             Tensor& dst);
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+void FusedEWCUDA(const std::vector<Tensor>& inputs,
+                 const std::vector<FusedEWInstruction>& program,
+                 Tensor& dst);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,156 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/core/kernel/FusedEWImpl.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Number of elements evaluated together by one interpreter step. The program
+/// is interpreted once per block instead of once per element, and the inner
+/// loops over the block are simple enough to be auto-vectorized.
+static constexpr int64_t FUSED_EW_CPU_BLOCK_SIZE = 256;
+
+template <typename scalar_t>
+static void LaunchFusedEWCPUKernel(
+        const Indexer& indexer,
+        const FusedEWKernelProgram<scalar_t>& program,
+        const std::vector<const scalar_t*>& contiguous_inputs,
+        scalar_t* contiguous_output) {
+    const int64_t num_workloads = indexer.NumWorkloads();
+    const int64_t num_blocks =
+            (num_workloads + FUSED_EW_CPU_BLOCK_SIZE - 1) /
+            FUSED_EW_CPU_BLOCK_SIZE;
+
+#pragma omp parallel for schedule(static)
+    for (int64_t block_idx = 0; block_idx < num_blocks; ++block_idx) {
+        scalar_t stack[MAX_FUSED_EW_STACK_DEPTH][FUSED_EW_CPU_BLOCK_SIZE];
+        const int64_t start = block_idx * FUSED_EW_CPU_BLOCK_SIZE;
+        const int64_t size =
+                std::min(FUSED_EW_CPU_BLOCK_SIZE, num_workloads - start);
+
+        int64_t top = -1;
+        for (int64_t pc = 0; pc < program.num_instructions_; ++pc) {
+            const FusedEWOpCode op_code = program.op_codes_[pc];
+            if (op_code == FusedEWOpCode::Input) {
+                ++top;
+                const int64_t input_idx = program.input_indices_[pc];
+                const scalar_t* src = contiguous_inputs[input_idx];
+                if (src != nullptr) {
+                    std::copy(src + start, src + start + size, stack[top]);
+                } else {
+                    for (int64_t i = 0; i < size; ++i) {
+                        stack[top][i] = *reinterpret_cast<const scalar_t*>(
+                                indexer.GetInputPtr(input_idx, start + i));
+                    }
+                }
+            } else if (op_code == FusedEWOpCode::Scalar) {
+                ++top;
+                std::fill(stack[top], stack[top] + size,
+                          program.scalars_[pc]);
+            } else if (IsFusedEWBinaryOp(op_code)) {
+                scalar_t* lhs = stack[top - 1];
+                const scalar_t* rhs = stack[top];
+                switch (op_code) {
+                    case FusedEWOpCode::Add:
+                        for (int64_t i = 0; i < size; ++i) {
+                            lhs[i] = lhs[i] + rhs[i];
+                        }
+                        break;
+                    case FusedEWOpCode::Sub:
+                        for (int64_t i = 0; i < size; ++i) {
+                            lhs[i] = lhs[i] - rhs[i];
+                        }
+                        break;
+                    case FusedEWOpCode::Mul:
+                        for (int64_t i = 0; i < size; ++i) {
+                            lhs[i] = lhs[i] * rhs[i];
+                        }
+                        break;
+                    default:
+                        for (int64_t i = 0; i < size; ++i) {
+                            lhs[i] = FusedEWBinaryOp(op_code, lhs[i], rhs[i]);
+                        }
+                        break;
+                }
+                --top;
+            } else {
+                scalar_t* x = stack[top];
+                for (int64_t i = 0; i < size; ++i) {
+                    x[i] = FusedEWUnaryOp(op_code, x[i]);
+                }
+            }
+        }
+
+        if (contiguous_output != nullptr) {
+            std::copy(stack[0], stack[0] + size, contiguous_output + start);
+        } else {
+            for (int64_t i = 0; i < size; ++i) {
+                *reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(start + i)) =
+                        stack[0][i];
+            }
+        }
+    }
+}
+
+void FusedEWCPU(const std::vector<Tensor>& inputs,
+                const std::vector<FusedEWInstruction>& program,
+                Tensor& dst) {
+    Indexer indexer(inputs, dst, DtypePolicy::ALL_SAME);
+
+    // Inputs that are contiguous and not broadcasted are read through raw
+    // pointers, bypassing the Indexer's offset computation.
+    const bool dst_contiguous = dst.IsContiguous();
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        std::vector<const scalar_t*> contiguous_inputs(inputs.size(), nullptr);
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            if (dst_contiguous && inputs[i].IsContiguous() &&
+                inputs[i].GetShape() == dst.GetShape()) {
+                contiguous_inputs[i] =
+                        static_cast<const scalar_t*>(inputs[i].GetDataPtr());
+            }
+        }
+        scalar_t* contiguous_output =
+                dst_contiguous ? static_cast<scalar_t*>(dst.GetDataPtr())
+                               : nullptr;
+        LaunchFusedEWCPUKernel<scalar_t>(
+                indexer, ToFusedEWKernelProgram<scalar_t>(program),
+                contiguous_inputs, contiguous_output);
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,88 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <vector>
+
+#include "open3d/core/CUDAState.cuh"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Indexer.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/core/kernel/FusedEW.h"
+#include "open3d/core/kernel/FusedEWImpl.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+template <typename scalar_t>
+static OPEN3D_DEVICE void CUDAFusedEWElementKernel(
+        const Indexer& indexer,
+        const FusedEWKernelProgram<scalar_t>& program,
+        int64_t workload_idx) {
+    scalar_t stack[MAX_FUSED_EW_STACK_DEPTH];
+    int64_t top = -1;
+    for (int64_t pc = 0; pc < program.num_instructions_; ++pc) {
+        const FusedEWOpCode op_code = program.op_codes_[pc];
+        if (op_code == FusedEWOpCode::Input) {
+            stack[++top] = *reinterpret_cast<const scalar_t*>(
+                    indexer.GetInputPtr(program.input_indices_[pc],
+                                        workload_idx));
+        } else if (op_code == FusedEWOpCode::Scalar) {
+            stack[++top] = program.scalars_[pc];
+        } else if (IsFusedEWBinaryOp(op_code)) {
+            stack[top - 1] =
+                    FusedEWBinaryOp(op_code, stack[top - 1], stack[top]);
+            --top;
+        } else {
+            stack[top] = FusedEWUnaryOp(op_code, stack[top]);
+        }
+    }
+    *reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(workload_idx)) =
+            stack[0];
+}
+
+void FusedEWCUDA(const std::vector<Tensor>& inputs,
+                 const std::vector<FusedEWInstruction>& program,
+                 Tensor& dst) {
+    CUDADeviceSwitcher switcher(dst.GetDevice());
+    Indexer indexer(inputs, dst, DtypePolicy::ALL_SAME);
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        FusedEWKernelProgram<scalar_t> kernel_program =
+                ToFusedEWKernelProgram<scalar_t>(program);
+        cuda_launcher::ParallelFor(
+                indexer.NumWorkloads(),
+                [indexer, kernel_program] OPEN3D_DEVICE(int64_t i) {
+                    CUDAFusedEWElementKernel<scalar_t>(indexer,
+                                                       kernel_program, i);
+                });
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Shared element-level helpers for FusedEWCPU.cpp and FusedEWCUDA.cu.
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/kernel/FusedEW.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Plain-old-data version of a fused element-wise program, with scalars
+/// already casted to scalar_t. It is small enough to be passed to CUDA kernels
+/// by value.
+template <typename scalar_t>
+struct FusedEWKernelProgram {
+    int64_t num_instructions_ = 0;
+    FusedEWOpCode op_codes_[MAX_FUSED_EW_INSTRUCTIONS];
+    int64_t input_indices_[MAX_FUSED_EW_INSTRUCTIONS];
+    scalar_t scalars_[MAX_FUSED_EW_INSTRUCTIONS];
+};
+
+template <typename scalar_t>
+static FusedEWKernelProgram<scalar_t> ToFusedEWKernelProgram(
+        const std::vector<FusedEWInstruction>& program) {
+    FusedEWKernelProgram<scalar_t> kernel_program;
+    kernel_program.num_instructions_ = static_cast<int64_t>(program.size());
+    for (size_t i = 0; i < program.size(); ++i) {
+        kernel_program.op_codes_[i] = program[i].op_code_;
+        kernel_program.input_indices_[i] = program[i].input_idx_;
+        kernel_program.scalars_[i] = program[i].scalar_.To<scalar_t>();
+    }
+    return kernel_program;
+}
+
+// The math functions follow the same conventions as UnaryEWCPU.cpp and
+// UnaryEWCUDA.cu, such that fused and non-fused evaluation give the same
+// results on the same device.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE scalar_t
+FusedEWUnaryOp(FusedEWOpCode op_code, scalar_t x) {
+#if defined(__CUDACC__)
+    switch (op_code) {
+        case FusedEWOpCode::Neg:
+            return -x;
+        case FusedEWOpCode::Abs:
+            return static_cast<scalar_t>(abs(static_cast<double>(x)));
+        case FusedEWOpCode::Sqrt:
+            return static_cast<scalar_t>(sqrt(static_cast<double>(x)));
+        case FusedEWOpCode::Exp:
+            return static_cast<scalar_t>(exp(static_cast<double>(x)));
+        case FusedEWOpCode::Sin:
+            return static_cast<scalar_t>(sin(static_cast<double>(x)));
+        case FusedEWOpCode::Cos:
+            return static_cast<scalar_t>(cos(static_cast<double>(x)));
+        default:
+            return x;
+    }
+#else
+    switch (op_code) {
+        case FusedEWOpCode::Neg:
+            return static_cast<scalar_t>(-x);
+        case FusedEWOpCode::Abs:
+            return static_cast<scalar_t>(std::abs(static_cast<double>(x)));
+        case FusedEWOpCode::Sqrt:
+            return static_cast<scalar_t>(std::sqrt(x));
+        case FusedEWOpCode::Exp:
+            return static_cast<scalar_t>(std::exp(x));
+        case FusedEWOpCode::Sin:
+            return static_cast<scalar_t>(std::sin(x));
+        case FusedEWOpCode::Cos:
+            return static_cast<scalar_t>(std::cos(x));
+        default:
+            return x;
+    }
+#endif
+}
+
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE scalar_t
+FusedEWBinaryOp(FusedEWOpCode op_code, scalar_t lhs, scalar_t rhs) {
+    switch (op_code) {
+        case FusedEWOpCode::Add:
+            return lhs + rhs;
+        case FusedEWOpCode::Sub:
+            return lhs - rhs;
+        case FusedEWOpCode::Mul:
+            return lhs * rhs;
+        case FusedEWOpCode::Div:
+            return lhs / rhs;
+        default:
+            return lhs;
+    }
+}
+
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE bool IsFusedEWBinaryOp(
+        FusedEWOpCode op_code) {
+    return op_code == FusedEWOpCode::Add || op_code == FusedEWOpCode::Sub ||
+           op_code == FusedEWOpCode::Mul || op_code == FusedEWOpCode::Div;
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
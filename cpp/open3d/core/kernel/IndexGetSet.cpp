@@ -28,6 +28,7 @@
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
+#include "open3d/core/Profiler.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/UnaryEW.h"
@@ -42,6 +43,8 @@ void IndexGet(const Tensor& src,
               const std::vector<Tensor>& index_tensors,
               const SizeVector& indexed_shape,
               const SizeVector& indexed_strides) {
+    OPEN3D_PROFILE_SCOPE("IndexGet", src.GetDevice());
+
     // index_tensors has been preprocessed to be on the same device as src,
     // however, dst may be in a different device.
     if (dst.GetDevice() != src.GetDevice()) {
@@ -68,6 +71,8 @@ void IndexSet(const Tensor& src,
               const std::vector<Tensor>& index_tensors,
               const SizeVector& indexed_shape,
               const SizeVector& indexed_strides) {
+    OPEN3D_PROFILE_SCOPE("IndexSet", dst.GetDevice());
+
     // index_tensors has been preprocessed to be on the same device as dst,
     // however, src may be on a different device.
     Tensor src_same_device = src.To(dst.GetDevice());
@@ -85,6 +90,114 @@ void IndexSet(const Tensor& src,
     }
 }
 
+/// Checks the arguments of IndexGetRows() and IndexSetRows(). \p table is the
+/// tensor being indexed and \p rows holds one row per index.
+static void CheckRowIndexArgs(const Tensor& table,
+                              const Tensor& rows,
+                              const Tensor& index) {
+    if (!table.IsContiguous() || !rows.IsContiguous() ||
+        !index.IsContiguous()) {
+        utility::LogError("Row indexing requires contiguous tensors.");
+    }
+    if (table.GetDtype() != rows.GetDtype()) {
+        utility::LogError("Dtype mismatch {} != {}.",
+                          table.GetDtype().ToString(),
+                          rows.GetDtype().ToString());
+    }
+    if (table.GetDevice() != rows.GetDevice() ||
+        table.GetDevice() != index.GetDevice()) {
+        utility::LogError("Row indexing requires tensors on the same device.");
+    }
+    if (index.GetDtype() != Dtype::Int64 || index.NumDims() != 1) {
+        utility::LogError("Row index tensor must be a 1D Int64 tensor.");
+    }
+    if (table.NumDims() == 0) {
+        utility::LogError("Cannot index rows of a 0-dim tensor.");
+    }
+    SizeVector rows_shape = table.GetShape();
+    rows_shape[0] = index.GetLength();
+    if (rows.GetShape() != rows_shape) {
+        utility::LogError("Row tensor shape {} does not match expected {}.",
+                          rows.GetShape(), rows_shape);
+    }
+    if (table.GetLength() == 0 && index.GetLength() != 0) {
+        utility::LogError("Index is out of bounds for dimension with size 0");
+    }
+}
+
+void IndexGetRows(const Tensor& src, Tensor& dst, const Tensor& index) {
+    OPEN3D_PROFILE_SCOPE("IndexGetRows", src.GetDevice());
+    CheckRowIndexArgs(src, dst, index);
+    if (dst.NumElements() == 0) {
+        return;
+    }
+
+    if (src.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexGetRowsCPU(src, dst, index);
+    } else if (src.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        IndexGetRowsCUDA(src, dst, index);
+#endif
+    } else {
+        utility::LogError("IndexGetRows: Unimplemented device");
+    }
+}
+
+void IndexSetRows(const Tensor& src, Tensor& dst, const Tensor& index) {
+    OPEN3D_PROFILE_SCOPE("IndexSetRows", dst.GetDevice());
+    CheckRowIndexArgs(dst, src, index);
+    if (src.NumElements() == 0) {
+        return;
+    }
+
+    if (dst.GetDevice().GetType() == Device::DeviceType::CPU) {
+        IndexSetRowsCPU(src, dst, index);
+    } else if (dst.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        IndexSetRowsCUDA(src, dst, index);
+#endif
+    } else {
+        utility::LogError("IndexSetRows: Unimplemented device");
+    }
+}
+
+Tensor IndexGetMasked(const Tensor& src, const Tensor& mask) {
+    OPEN3D_PROFILE_SCOPE("IndexGetMasked", src.GetDevice());
+    if (!src.IsContiguous() || !mask.IsContiguous()) {
+        utility::LogError("Masked indexing requires contiguous tensors.");
+    }
+    if (src.GetDevice() != mask.GetDevice()) {
+        utility::LogError(
+                "Masked indexing requires tensors on the same device.");
+    }
+    if (src.NumDims() == 0) {
+        utility::LogError("Cannot index rows of a 0-dim tensor.");
+    }
+    if (mask.GetDtype() != Dtype::Bool ||
+        mask.GetShape() != SizeVector{src.GetLength()}) {
+        utility::LogError(
+                "Mask must be a 1D Bool tensor of length {}, but got {} {}.",
+                src.GetLength(), mask.GetDtype().ToString(), mask.GetShape());
+    }
+    if (src.NumElements() == 0) {
+        SizeVector dst_shape = src.GetShape();
+        dst_shape[0] = mask.To(Dtype::Int64).Sum({0}).Item<int64_t>();
+        return Tensor(dst_shape, src.GetDtype(), src.GetDevice());
+    }
+
+    if (src.GetDevice().GetType() == Device::DeviceType::CPU) {
+        return IndexGetMaskedCPU(src, mask);
+    } else if (src.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        return IndexGetMaskedCUDA(src, mask);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("IndexGetMasked: Unimplemented device");
+    }
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -73,6 +73,54 @@ void IndexSetCUDA(const Tensor& src,
                   const SizeVector& indexed_strides);
 #endif
 
+/// Gathers whole rows of a contiguous \p src along dim 0, i.e.
+/// dst[i] = src[index[i]]. The rows are moved as raw bytes.
+///
+/// \param src The contiguous source tensor with at least one dimension.
+/// \param dst The contiguous destination tensor on the same device as \p src,
+/// with shape {index.GetLength()} + src.GetShape()[1:].
+/// \param index The 1D Int64 contiguous index tensor, on the same device as
+/// \p src. Negative indices count from the end.
+void IndexGetRows(const Tensor& src, Tensor& dst, const Tensor& index);
+
+void IndexGetRowsCPU(const Tensor& src, Tensor& dst, const Tensor& index);
+
+#ifdef BUILD_CUDA_MODULE
+void IndexGetRowsCUDA(const Tensor& src, Tensor& dst, const Tensor& index);
+#endif
+
+/// Scatters whole rows of \p src into a contiguous \p dst along dim 0, i.e.
+/// dst[index[i]] = src[i]. With duplicated indices, the row written last is
+/// unspecified.
+///
+/// \param src The contiguous source tensor with shape
+/// {index.GetLength()} + dst.GetShape()[1:].
+/// \param dst The contiguous destination tensor on the same device as \p src.
+/// \param index The 1D Int64 contiguous index tensor, on the same device as
+/// \p dst. Negative indices count from the end.
+void IndexSetRows(const Tensor& src, Tensor& dst, const Tensor& index);
+
+void IndexSetRowsCPU(const Tensor& src, Tensor& dst, const Tensor& index);
+
+#ifdef BUILD_CUDA_MODULE
+void IndexSetRowsCUDA(const Tensor& src, Tensor& dst, const Tensor& index);
+#endif
+
+/// Returns the rows of a contiguous \p src whose entry in \p mask is true,
+/// in order. The rows are compacted directly from a prefix sum of the mask,
+/// without materializing the indices of the true entries.
+///
+/// \param src The contiguous source tensor with at least one dimension.
+/// \param mask The 1D Bool contiguous tensor of length src.GetLength(), on the
+/// same device as \p src.
+Tensor IndexGetMasked(const Tensor& src, const Tensor& mask);
+
+Tensor IndexGetMaskedCPU(const Tensor& src, const Tensor& mask);
+
+#ifdef BUILD_CUDA_MODULE
+Tensor IndexGetMaskedCUDA(const Tensor& src, const Tensor& mask);
+#endif
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -24,11 +24,17 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/CPULauncher.h"
 #include "open3d/core/kernel/IndexGetSet.h"
+#include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -63,7 +69,7 @@ void IndexGetCPU(const Tensor& src,
                     CPUCopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             cpu_launcher::LaunchAdvancedIndexerKernel(
                     ai, CPUCopyElementKernel<scalar_t>);
         });
@@ -85,13 +91,98 @@ void IndexSetCPU(const Tensor& src,
                     CPUCopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             cpu_launcher::LaunchAdvancedIndexerKernel(
                     ai, CPUCopyElementKernel<scalar_t>);
         });
     }
 }
 
+/// Minimum number of mask entries per thread for masked row compaction.
+static constexpr int64_t MASKED_ROWS_GRAIN_SIZE = 32768;
+
+void IndexGetRowsCPU(const Tensor& src, Tensor& dst, const Tensor& index) {
+    const int64_t num_src_rows = src.GetLength();
+    const int64_t row_byte_size =
+            src.NumElements() / num_src_rows * src.GetDtype().ByteSize();
+    const char* src_ptr = static_cast<const char*>(src.GetDataPtr());
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    const int64_t* index_ptr = index.GetDataPtr<int64_t>();
+    cpu_launcher::ParallelFor(index.GetLength(), [&](int64_t i) {
+        int64_t row = index_ptr[i];
+        OPEN3D_ASSERT(row >= -num_src_rows && row < num_src_rows &&
+                      "Index out of bounds.");
+        row += num_src_rows * (row < 0);
+        std::memcpy(dst_ptr + i * row_byte_size,
+                    src_ptr + row * row_byte_size, row_byte_size);
+    });
+}
+
+void IndexSetRowsCPU(const Tensor& src, Tensor& dst, const Tensor& index) {
+    const int64_t num_dst_rows = dst.GetLength();
+    const int64_t row_byte_size =
+            dst.NumElements() / num_dst_rows * dst.GetDtype().ByteSize();
+    const char* src_ptr = static_cast<const char*>(src.GetDataPtr());
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+    const int64_t* index_ptr = index.GetDataPtr<int64_t>();
+    cpu_launcher::ParallelFor(index.GetLength(), [&](int64_t i) {
+        int64_t row = index_ptr[i];
+        OPEN3D_ASSERT(row >= -num_dst_rows && row < num_dst_rows &&
+                      "Index out of bounds.");
+        row += num_dst_rows * (row < 0);
+        std::memcpy(dst_ptr + row * row_byte_size,
+                    src_ptr + i * row_byte_size, row_byte_size);
+    });
+}
+
+Tensor IndexGetMaskedCPU(const Tensor& src, const Tensor& mask) {
+    const int64_t num_rows = src.GetLength();
+    const int64_t row_byte_size =
+            src.NumElements() / num_rows * src.GetDtype().ByteSize();
+    const bool* mask_ptr = mask.GetDataPtr<bool>();
+
+    // Each range counts its true entries, then copies its rows starting from
+    // the exclusive prefix sum of the counts.
+    const int64_t num_ranges = std::max<int64_t>(
+            1, std::min<int64_t>(GetMaxThreads(),
+                                 num_rows / MASKED_ROWS_GRAIN_SIZE));
+    const int64_t range_size = (num_rows + num_ranges - 1) / num_ranges;
+    std::vector<int64_t> range_offsets(num_ranges + 1, 0);
+#pragma omp parallel for schedule(static) num_threads(num_ranges)
+    for (int64_t range_idx = 0; range_idx < num_ranges; ++range_idx) {
+        const int64_t start = range_idx * range_size;
+        const int64_t end = std::min(start + range_size, num_rows);
+        int64_t count = 0;
+        for (int64_t i = start; i < end; ++i) {
+            count += mask_ptr[i];
+        }
+        range_offsets[range_idx + 1] = count;
+    }
+    std::partial_sum(range_offsets.begin(), range_offsets.end(),
+                     range_offsets.begin());
+
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = range_offsets.back();
+    Tensor dst(dst_shape, src.GetDtype(), src.GetDevice());
+    const char* src_ptr = static_cast<const char*>(src.GetDataPtr());
+    char* dst_ptr = static_cast<char*>(dst.GetDataPtr());
+#pragma omp parallel for schedule(static) num_threads(num_ranges)
+    for (int64_t range_idx = 0; range_idx < num_ranges; ++range_idx) {
+        const int64_t start = range_idx * range_size;
+        const int64_t end = std::min(start + range_size, num_rows);
+        char* range_dst_ptr =
+                dst_ptr + range_offsets[range_idx] * row_byte_size;
+        for (int64_t i = start; i < end; ++i) {
+            if (mask_ptr[i]) {
+                std::memcpy(range_dst_ptr, src_ptr + i * row_byte_size,
+                            row_byte_size);
+                range_dst_ptr += row_byte_size;
+            }
+        }
+    }
+    return dst;
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
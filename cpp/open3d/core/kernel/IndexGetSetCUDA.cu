@@ -24,12 +24,17 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstdint>
+
 #include "open3d/core/CUDAState.cuh"
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/CUDALauncher.cuh"
 #include "open3d/core/kernel/IndexGetSet.h"
+#include "open3d/core/kernel/Scan.h"
+#include "open3d/utility/Logging.h"
 
 namespace open3d {
 namespace core {
@@ -66,7 +71,7 @@ void IndexGetCUDA(const Tensor& src,
                     CUDACopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             cuda_launcher::LaunchAdvancedIndexerKernel(
                     ai,
                     // Need to wrap as extended CUDA lambda function
@@ -93,7 +98,7 @@ void IndexSetCUDA(const Tensor& src,
                     CUDACopyObjectElementKernel(src, dst, object_byte_size);
                 });
     } else {
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             cuda_launcher::LaunchAdvancedIndexerKernel(
                     ai,
                     // Need to wrap as extended CUDA lambda function
@@ -104,6 +109,194 @@ void IndexSetCUDA(const Tensor& src,
     }
 }
 
+/// Rows are moved in the widest word that divides the row byte size and the
+/// alignment of the data pointers, up to 16 bytes (one uint4).
+static int64_t GetRowWordSize(int64_t row_byte_size,
+                              const void* src,
+                              const void* dst) {
+    const uintptr_t address_bits = reinterpret_cast<uintptr_t>(src) |
+                                   reinterpret_cast<uintptr_t>(dst) |
+                                   static_cast<uintptr_t>(row_byte_size);
+    for (int64_t word_size : {16, 8, 4, 2}) {
+        if (address_bits % word_size == 0) {
+            return word_size;
+        }
+    }
+    return 1;
+}
+
+#define DISPATCH_ROW_WORD_TO_TEMPLATE(WORD_SIZE, ...)                     \
+    [&] {                                                                 \
+        if (WORD_SIZE == 16) {                                            \
+            using word_t = uint4;                                         \
+            return __VA_ARGS__();                                         \
+        } else if (WORD_SIZE == 8) {                                      \
+            using word_t = uint2;                                         \
+            return __VA_ARGS__();                                         \
+        } else if (WORD_SIZE == 4) {                                      \
+            using word_t = uint32_t;                                      \
+            return __VA_ARGS__();                                         \
+        } else if (WORD_SIZE == 2) {                                      \
+            using word_t = uint16_t;                                      \
+            return __VA_ARGS__();                                         \
+        } else {                                                          \
+            using word_t = uint8_t;                                       \
+            return __VA_ARGS__();                                         \
+        }                                                                 \
+    }()
+
+/// One thread per word of the gathered rows. Consecutive threads move
+/// consecutive words of a row, so each row is read and written coalesced.
+template <typename word_t>
+__global__ void GatherRowsKernel(const word_t* src,
+                                 word_t* dst,
+                                 const int64_t* index,
+                                 int64_t num_indices,
+                                 int64_t num_src_rows,
+                                 int64_t words_per_row) {
+    const int64_t num_words = num_indices * words_per_row;
+    for (int64_t w = static_cast<int64_t>(blockIdx.x) * blockDim.x +
+                     threadIdx.x;
+         w < num_words; w += static_cast<int64_t>(gridDim.x) * blockDim.x) {
+        const int64_t i = w / words_per_row;
+        int64_t row = index[i];
+        OPEN3D_ASSERT(row >= -num_src_rows && row < num_src_rows &&
+                      "Index out of bounds.");
+        row += num_src_rows * (row < 0);
+        dst[w] = src[row * words_per_row + (w - i * words_per_row)];
+    }
+}
+
+template <typename word_t>
+__global__ void ScatterRowsKernel(const word_t* src,
+                                  word_t* dst,
+                                  const int64_t* index,
+                                  int64_t num_indices,
+                                  int64_t num_dst_rows,
+                                  int64_t words_per_row) {
+    const int64_t num_words = num_indices * words_per_row;
+    for (int64_t w = static_cast<int64_t>(blockIdx.x) * blockDim.x +
+                     threadIdx.x;
+         w < num_words; w += static_cast<int64_t>(gridDim.x) * blockDim.x) {
+        const int64_t i = w / words_per_row;
+        int64_t row = index[i];
+        OPEN3D_ASSERT(row >= -num_dst_rows && row < num_dst_rows &&
+                      "Index out of bounds.");
+        row += num_dst_rows * (row < 0);
+        dst[row * words_per_row + (w - i * words_per_row)] = src[w];
+    }
+}
+
+/// \p positions is the inclusive prefix sum of the mask, so a selected row r
+/// goes to output row positions[r] - 1.
+template <typename word_t>
+__global__ void CompactRowsKernel(const word_t* src,
+                                  word_t* dst,
+                                  const bool* mask,
+                                  const int64_t* positions,
+                                  int64_t num_rows,
+                                  int64_t words_per_row) {
+    const int64_t num_words = num_rows * words_per_row;
+    for (int64_t w = static_cast<int64_t>(blockIdx.x) * blockDim.x +
+                     threadIdx.x;
+         w < num_words; w += static_cast<int64_t>(gridDim.x) * blockDim.x) {
+        const int64_t row = w / words_per_row;
+        if (mask[row]) {
+            dst[(positions[row] - 1) * words_per_row +
+                (w - row * words_per_row)] = src[w];
+        }
+    }
+}
+
+static constexpr int64_t ROW_KERNEL_BLOCK_SIZE = 256;
+static constexpr int64_t ROW_KERNEL_MAX_GRID_SIZE = 65535;
+
+static int64_t GetRowKernelGridSize(int64_t num_words) {
+    return std::min(
+            (num_words + ROW_KERNEL_BLOCK_SIZE - 1) / ROW_KERNEL_BLOCK_SIZE,
+            ROW_KERNEL_MAX_GRID_SIZE);
+}
+
+void IndexGetRowsCUDA(const Tensor& src, Tensor& dst, const Tensor& index) {
+    CUDADeviceSwitcher switcher(src.GetDevice());
+    cudaStream_t stream = CUDAStream::GetCurrent();
+    const int64_t num_src_rows = src.GetLength();
+    const int64_t num_indices = index.GetLength();
+    const int64_t row_byte_size =
+            src.NumElements() / num_src_rows * src.GetDtype().ByteSize();
+    const int64_t word_size = GetRowWordSize(row_byte_size, src.GetDataPtr(),
+                                             dst.GetDataPtr());
+    const int64_t words_per_row = row_byte_size / word_size;
+    const int64_t grid_size = GetRowKernelGridSize(num_indices * words_per_row);
+    DISPATCH_ROW_WORD_TO_TEMPLATE(word_size, [&]() {
+        GatherRowsKernel<word_t><<<grid_size, ROW_KERNEL_BLOCK_SIZE, 0,
+                                   stream>>>(
+                static_cast<const word_t*>(src.GetDataPtr()),
+                static_cast<word_t*>(dst.GetDataPtr()),
+                index.GetDataPtr<int64_t>(), num_indices, num_src_rows,
+                words_per_row);
+    });
+    OPEN3D_GET_LAST_CUDA_ERROR("IndexGetRowsCUDA failed.");
+}
+
+void IndexSetRowsCUDA(const Tensor& src, Tensor& dst, const Tensor& index) {
+    CUDADeviceSwitcher switcher(dst.GetDevice());
+    cudaStream_t stream = CUDAStream::GetCurrent();
+    const int64_t num_dst_rows = dst.GetLength();
+    const int64_t num_indices = index.GetLength();
+    const int64_t row_byte_size =
+            dst.NumElements() / num_dst_rows * dst.GetDtype().ByteSize();
+    const int64_t word_size = GetRowWordSize(row_byte_size, src.GetDataPtr(),
+                                             dst.GetDataPtr());
+    const int64_t words_per_row = row_byte_size / word_size;
+    const int64_t grid_size = GetRowKernelGridSize(num_indices * words_per_row);
+    DISPATCH_ROW_WORD_TO_TEMPLATE(word_size, [&]() {
+        ScatterRowsKernel<word_t><<<grid_size, ROW_KERNEL_BLOCK_SIZE, 0,
+                                    stream>>>(
+                static_cast<const word_t*>(src.GetDataPtr()),
+                static_cast<word_t*>(dst.GetDataPtr()),
+                index.GetDataPtr<int64_t>(), num_indices, num_dst_rows,
+                words_per_row);
+    });
+    OPEN3D_GET_LAST_CUDA_ERROR("IndexSetRowsCUDA failed.");
+}
+
+Tensor IndexGetMaskedCUDA(const Tensor& src, const Tensor& mask) {
+    Device device = src.GetDevice();
+    CUDADeviceSwitcher switcher(device);
+    cudaStream_t stream = CUDAStream::GetCurrent();
+    const int64_t num_rows = src.GetLength();
+    const int64_t row_byte_size =
+            src.NumElements() / num_rows * src.GetDtype().ByteSize();
+
+    // Inclusive prefix sum of the mask, the last entry is the output length.
+    const bool* mask_ptr = mask.GetDataPtr<bool>();
+    Tensor positions = Tensor::Empty({num_rows}, Dtype::Int64, device);
+    CumSumCUDA(mask, positions, false);
+    const int64_t* positions_ptr = positions.GetDataPtr<int64_t>();
+
+    SizeVector dst_shape = src.GetShape();
+    dst_shape[0] = positions[num_rows - 1].Item<int64_t>();
+    Tensor dst(dst_shape, src.GetDtype(), device);
+    if (dst_shape[0] == 0) {
+        return dst;
+    }
+
+    const int64_t word_size = GetRowWordSize(row_byte_size, src.GetDataPtr(),
+                                             dst.GetDataPtr());
+    const int64_t words_per_row = row_byte_size / word_size;
+    const int64_t grid_size = GetRowKernelGridSize(num_rows * words_per_row);
+    DISPATCH_ROW_WORD_TO_TEMPLATE(word_size, [&]() {
+        CompactRowsKernel<word_t><<<grid_size, ROW_KERNEL_BLOCK_SIZE, 0,
+                                    stream>>>(
+                static_cast<const word_t*>(src.GetDataPtr()),
+                static_cast<word_t*>(dst.GetDataPtr()), mask_ptr,
+                positions_ptr, num_rows, words_per_row);
+    });
+    OPEN3D_GET_LAST_CUDA_ERROR("IndexGetMaskedCUDA failed.");
+    return dst;
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
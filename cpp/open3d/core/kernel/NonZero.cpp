@@ -27,6 +27,7 @@
 #include "open3d/core/kernel/NonZero.h"
 
 #include "open3d/core/Device.h"
+#include "open3d/core/Profiler.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Logging.h"
 
@@ -35,6 +36,8 @@ namespace core {
 namespace kernel {
 
 Tensor NonZero(const Tensor& src) {
+    OPEN3D_PROFILE_SCOPE("NonZero", src.GetDevice());
+
     Device::DeviceType device_type = src.GetDevice().GetType();
     if (device_type == Device::DeviceType::CPU) {
         return NonZeroCPU(src);
@@ -24,26 +24,19 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
-#include <thrust/device_vector.h>
 #include <thrust/execution_policy.h>
 #include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 
 #include "open3d/core/Indexer.h"
 #include "open3d/core/kernel/NonZero.h"
+#include "open3d/core/kernel/Scan.h"
 
 namespace open3d {
 namespace core {
 namespace kernel {
 
-template <typename T>
-struct NonZeroFunctor {
-    NonZeroFunctor() {}
-    __host__ __device__ bool operator()(T value) const {
-        return static_cast<float>(value) != 0.0;
-    }
-};
-
 struct FlatIndexTransformFunctor {
     FlatIndexTransformFunctor(const TensorIterator& iter,
                               int64_t num_non_zeros,
@@ -75,41 +68,29 @@ protected:
 };
 
 Tensor NonZeroCUDA(const Tensor& src) {
-    Tensor src_contiguous = src.Contiguous();
-    const int64_t num_elements = src_contiguous.NumElements();
-    const int64_t num_bytes =
-            num_elements * src_contiguous.GetDtype().ByteSize();
-
-    thrust::counting_iterator<int64_t> index_first(0);
-    thrust::counting_iterator<int64_t> index_last = index_first + num_elements;
-
     // Get flattened non-zero indices.
-    thrust::device_vector<int64_t> non_zero_indices(num_elements);
-    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
-        thrust::device_ptr<const scalar_t> src_ptr(static_cast<const scalar_t*>(
-                src_contiguous.GetBlob()->GetDataPtr()));
-
-        auto it = thrust::copy_if(index_first, index_last, src_ptr,
-                                  non_zero_indices.begin(),
-                                  NonZeroFunctor<scalar_t>());
-        non_zero_indices.resize(thrust::distance(non_zero_indices.begin(), it));
-    });
+    Tensor non_zero_indices = Compact(src);
+    thrust::device_ptr<const int64_t> non_zero_indices_first(
+            non_zero_indices.GetDataPtr<int64_t>());
+    thrust::device_ptr<const int64_t> non_zero_indices_last =
+            non_zero_indices_first + non_zero_indices.GetLength();
 
     // Transform flattend indices to indices in each dimension.
     SizeVector shape = src.GetShape();
     const int64_t num_dims = src.NumDims();
-    const size_t num_non_zeros = non_zero_indices.size();
+    const int64_t num_non_zeros = non_zero_indices.GetLength();
 
-    SizeVector result_shape{num_dims, static_cast<int64_t>(num_non_zeros)};
+    SizeVector result_shape{num_dims, num_non_zeros};
     Tensor result(result_shape, Dtype::Int64, src.GetDevice());
     TensorIterator result_iter(result);
 
-    index_last = index_first + num_non_zeros;
+    thrust::counting_iterator<int64_t> index_first(0);
+    thrust::counting_iterator<int64_t> index_last = index_first + num_non_zeros;
     thrust::for_each(thrust::device,
                      thrust::make_zip_iterator(thrust::make_tuple(
-                             index_first, non_zero_indices.begin())),
+                             index_first, non_zero_indices_first)),
                      thrust::make_zip_iterator(thrust::make_tuple(
-                             index_last, non_zero_indices.end())),
+                             index_last, non_zero_indices_last)),
                      FlatIndexTransformFunctor(result_iter, num_non_zeros,
                                                num_dims, shape));
 
@@ -0,0 +1,56 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/ParallelUtil.h"
+
+#include <atomic>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Default value of GetParallelThreshold().
+static constexpr int64_t DEFAULT_PARALLEL_THRESHOLD = 1024;
+
+static std::atomic<int64_t> g_parallel_threshold(DEFAULT_PARALLEL_THRESHOLD);
+
+int64_t GetParallelThreshold() {
+    return g_parallel_threshold.load(std::memory_order_relaxed);
+}
+
+void SetParallelThreshold(int64_t threshold) {
+    if (threshold < 0) {
+        utility::LogError("Parallel threshold must be >= 0, but got {}.",
+                          threshold);
+    }
+    g_parallel_threshold.store(threshold, std::memory_order_relaxed);
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
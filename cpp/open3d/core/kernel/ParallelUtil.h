@@ -26,17 +26,23 @@
 
 #pragma once
 
+#include <cstdint>
+
 #ifdef _OPENMP
 #include <omp.h>
 #endif
 
+#include "open3d/utility/Parallel.h"
+
 namespace open3d {
 namespace core {
 namespace kernel {
 
+/// Returns the number of threads of the CPU launchers, which follows
+/// utility::SetNumThreads() and utility::ScopedNumThreads.
 inline int GetMaxThreads() {
 #ifdef _OPENMP
-    return omp_get_max_threads();
+    return utility::GetNumThreads();
 #else
     return 1;
 #endif
@@ -50,6 +56,21 @@ inline bool InParallel() {
 #endif
 }
 
+/// Returns the minimum number of workloads for which the CPU element-wise,
+/// indexing and reduction launchers start an OpenMP parallel region. Smaller
+/// workloads, e.g. ops on 4x4 transformation matrices, run on the calling
+/// thread since setting up the parallel region would dominate the run time.
+int64_t GetParallelThreshold();
+
+/// Sets the threshold returned by GetParallelThreshold(). A threshold of 0
+/// always uses a parallel region.
+void SetParallelThreshold(int64_t threshold);
+
+/// Returns true if \p num_workloads is large enough to be run in parallel.
+inline bool ShouldParallelize(int64_t num_workloads) {
+    return num_workloads >= GetParallelThreshold();
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
@@ -26,17 +26,30 @@
 
 #include "open3d/core/kernel/Reduction.h"
 
+#include <limits>
+
+#include "open3d/core/Profiler.h"
 #include "open3d/core/SizeVector.h"
 
 namespace open3d {
 namespace core {
 namespace kernel {
 
+// Profiling scope names, in the order of ReductionOpCode.
+static const char* const s_reduction_op_names[] = {
+        "Reduction::Sum", "Reduction::Prod",   "Reduction::Min",
+        "Reduction::Max", "Reduction::ArgMin", "Reduction::ArgMax",
+        "Reduction::All", "Reduction::Any",
+};
+
 void Reduction(const Tensor& src,
                Tensor& dst,
                const SizeVector& dims,
                bool keepdim,
                ReductionOpCode op_code) {
+    OPEN3D_PROFILE_SCOPE(s_reduction_op_names[static_cast<int>(op_code)],
+                         src.GetDevice());
+
     // For ArgMin and ArgMax, keepdim == false, and dims can only contain one or
     // all dimensions.
     if (s_arg_reduce_ops.find(op_code) != s_arg_reduce_ops.end()) {
@@ -88,8 +101,16 @@ void Reduction(const Tensor& src,
                           dst.GetDevice().ToString());
     }
 
+    // Sum and Prod of 16-bit floats accumulate in Float32, so that the
+    // rounding error does not grow with the number of reduced elements.
+    const Dtype src_dtype = src.GetDtype();
     Device::DeviceType device_type = src.GetDevice().GetType();
-    if (device_type == Device::DeviceType::CPU) {
+    if ((src_dtype == Dtype::Float16 || src_dtype == Dtype::BFloat16) &&
+        (op_code == ReductionOpCode::Sum || op_code == ReductionOpCode::Prod)) {
+        Tensor dst_acc(dst.GetShape(), Dtype::Float32, dst.GetDevice());
+        Reduction(src.To(Dtype::Float32), dst_acc, dims, true, op_code);
+        dst.AsRvalue() = dst_acc.To(src_dtype);
+    } else if (device_type == Device::DeviceType::CPU) {
         ReductionCPU(src, dst, dims, keepdim, op_code);
     } else if (device_type == Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
@@ -106,6 +127,91 @@ void Reduction(const Tensor& src,
     }
 }
 
+void ReductionMeanVariance(const Tensor& src,
+                           Tensor& mean,
+                           Tensor& variance,
+                           const SizeVector& dims,
+                           bool keepdim) {
+    OPEN3D_PROFILE_SCOPE("Reduction::MeanVariance", src.GetDevice());
+
+    const Dtype dtype = src.GetDtype();
+    const bool is_half = dtype == Dtype::Float16 || dtype == Dtype::BFloat16;
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64 && !is_half) {
+        utility::LogError(
+                "Mean-variance reduction only supports floating point "
+                "dtypes, but {} is used.",
+                dtype.ToString());
+    }
+    SizeVector keepdim_shape =
+            shape_util::ReductionShape(src.GetShape(), dims, true);
+    SizeVector expected_shape =
+            keepdim ? keepdim_shape
+                    : shape_util::ReductionShape(src.GetShape(), dims, false);
+    for (const Tensor& dst : {mean, variance}) {
+        if (dst.GetShape() != expected_shape) {
+            utility::LogError("Expected output shape {} but got {}.",
+                              expected_shape.ToString(),
+                              dst.GetShape().ToString());
+        }
+        if (dst.GetDtype() != dtype) {
+            utility::LogError("Expected output dtype {} but got {}.",
+                              dtype.ToString(), dst.GetDtype().ToString());
+        }
+        if (dst.GetDevice() != src.GetDevice()) {
+            utility::LogError("Device mismatch {} != {}.",
+                              src.GetDevice().ToString(),
+                              dst.GetDevice().ToString());
+        }
+    }
+
+    if (dims.size() == 0) {
+        mean.AsRvalue() = src;
+        variance.Fill(0);
+        return;
+    }
+    if (src.NumElements() == 0) {
+        // Same as NumPy, the statistics of an empty set are NaN.
+        mean.Fill(std::numeric_limits<float>::quiet_NaN());
+        variance.Fill(std::numeric_limits<float>::quiet_NaN());
+        return;
+    }
+
+    // 16-bit floats are reduced in Float32, see Reduction().
+    if (is_half) {
+        Tensor mean_acc(keepdim_shape, Dtype::Float32, src.GetDevice());
+        Tensor variance_acc(keepdim_shape, Dtype::Float32, src.GetDevice());
+        ReductionMeanVariance(src.To(Dtype::Float32), mean_acc, variance_acc,
+                              dims, true);
+        mean.AsRvalue() = mean_acc.To(dtype).Reshape(expected_shape);
+        variance.AsRvalue() = variance_acc.To(dtype).Reshape(expected_shape);
+        return;
+    }
+
+    // Always reshape to keepdim case. This reshaping is copy-free.
+    if (!keepdim) {
+        mean = mean.Reshape(keepdim_shape);
+        variance = variance.Reshape(keepdim_shape);
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        ReductionMeanVarianceCPU(src, mean, variance, dims);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ReductionMeanVarianceCUDA(src, mean, variance, dims);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    if (!keepdim) {
+        mean = mean.Reshape(expected_shape);
+        variance = variance.Reshape(expected_shape);
+    }
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
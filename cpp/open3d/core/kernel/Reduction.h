@@ -86,6 +86,27 @@ void ReductionCUDA(const Tensor& src,
                    ReductionOpCode op_code);
 #endif
 
+/// Computes the mean and the population variance of \p src over \p dims in a
+/// single pass over the data. \p mean and \p variance must have the reduced
+/// shape, and the dtype of \p src, which must be a floating point dtype.
+void ReductionMeanVariance(const Tensor& src,
+                           Tensor& mean,
+                           Tensor& variance,
+                           const SizeVector& dims,
+                           bool keepdim);
+
+void ReductionMeanVarianceCPU(const Tensor& src,
+                              Tensor& mean,
+                              Tensor& variance,
+                              const SizeVector& dims);
+
+#ifdef BUILD_CUDA_MODULE
+void ReductionMeanVarianceCUDA(const Tensor& src,
+                               Tensor& mean,
+                               Tensor& variance,
+                               const SizeVector& dims);
+#endif
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
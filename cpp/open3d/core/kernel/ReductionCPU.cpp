@@ -24,7 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
@@ -85,6 +87,86 @@ static inline std::pair<int64_t, scalar_t> CPUArgMaxReductionKernel(
     }
 }
 
+/// Running mean, sum of squared deviations (m2) and count of Welford's online
+/// algorithm.
+template <typename scalar_t>
+struct CPUWelfordData {
+    scalar_t mean = 0;
+    scalar_t m2 = 0;
+    int64_t n = 0;
+
+    void Update(scalar_t val) {
+        n++;
+        const scalar_t delta = val - mean;
+        mean += delta / static_cast<scalar_t>(n);
+        m2 += delta * (val - mean);
+    }
+
+    void Merge(const CPUWelfordData& other) {
+        if (other.n == 0) {
+            return;
+        }
+        const int64_t merged_n = n + other.n;
+        const scalar_t other_ratio = static_cast<scalar_t>(other.n) /
+                                     static_cast<scalar_t>(merged_n);
+        const scalar_t delta = other.mean - mean;
+        mean += delta * other_ratio;
+        m2 += other.m2 + delta * delta * static_cast<scalar_t>(n) * other_ratio;
+        n = merged_n;
+    }
+};
+
+/// The indexer's first output receives the mean and the second output the
+/// population variance.
+template <typename scalar_t>
+static void CPUMeanVarianceReduction(const Indexer& indexer) {
+    const int64_t num_output_elements = indexer.NumOutputElements();
+    const bool parallel = ShouldParallelize(indexer.NumWorkloads());
+    if (num_output_elements == 1 && parallel && GetMaxThreads() > 1 &&
+        !InParallel()) {
+        // Per-thread partial statistics, merged at the end.
+        const int64_t num_workloads = indexer.NumWorkloads();
+        const int64_t num_threads = GetMaxThreads();
+        const int64_t workload_per_thread =
+                (num_workloads + num_threads - 1) / num_threads;
+        std::vector<CPUWelfordData<scalar_t>> thread_results(num_threads);
+#pragma omp parallel for schedule(static)
+        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            int64_t start = thread_idx * workload_per_thread;
+            int64_t end = std::min(start + workload_per_thread, num_workloads);
+            for (int64_t workload_idx = start; workload_idx < end;
+                 ++workload_idx) {
+                thread_results[thread_idx].Update(*reinterpret_cast<scalar_t*>(
+                        indexer.GetInputPtr(0, workload_idx)));
+            }
+        }
+        for (int64_t thread_idx = 1; thread_idx < num_threads; ++thread_idx) {
+            thread_results[0].Merge(thread_results[thread_idx]);
+        }
+        *reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(0, 0)) =
+                thread_results[0].mean;
+        *reinterpret_cast<scalar_t*>(indexer.GetOutputPtr(1, 0)) =
+                thread_results[0].m2 / static_cast<scalar_t>(num_workloads);
+        return;
+    }
+
+#pragma omp parallel for schedule(static) if (parallel)
+    for (int64_t output_idx = 0; output_idx < num_output_elements;
+         output_idx++) {
+        Indexer sub_indexer = indexer.GetPerOutputIndexer(output_idx);
+        CPUWelfordData<scalar_t> result;
+        for (int64_t workload_idx = 0;
+             workload_idx < sub_indexer.NumWorkloads(); workload_idx++) {
+            result.Update(*reinterpret_cast<scalar_t*>(
+                    sub_indexer.GetInputPtr(0, workload_idx)));
+        }
+        *reinterpret_cast<scalar_t*>(sub_indexer.GetOutputPtr(0, 0)) =
+                result.mean;
+        *reinterpret_cast<scalar_t*>(sub_indexer.GetOutputPtr(1, 0)) =
+                result.m2 / static_cast<scalar_t>(result.n);
+    }
+}
+
 class CPUReductionEngine {
 public:
     CPUReductionEngine(const CPUReductionEngine&) = delete;
@@ -95,11 +177,18 @@ public:
     void Run(const func_t& reduce_func, scalar_t identity) {
         // See: PyTorch's TensorIterator::parallel_reduce for the reference
         // design of reduction strategy.
-        if (GetMaxThreads() == 1 || InParallel()) {
+        if (indexer_.NumWorkloads() == 0) {
+            // The output has already been filled with the identity.
+            return;
+        } else if (GetMaxThreads() == 1 || InParallel() ||
+                   !ShouldParallelize(indexer_.NumWorkloads())) {
             LaunchReductionKernelSerial<scalar_t>(indexer_, reduce_func);
         } else if (indexer_.NumOutputElements() <= 1) {
             LaunchReductionKernelTwoPass<scalar_t>(indexer_, reduce_func,
                                                    identity);
+        } else if (indexer_.NumOutputElements() <= kMaxTiledOutputs) {
+            LaunchReductionKernelTiled<scalar_t>(indexer_, reduce_func,
+                                                 identity);
         } else {
             LaunchReductionParallelDim<scalar_t>(indexer_, reduce_func);
         }
@@ -154,6 +243,144 @@ private:
         }
     }
 
+    /// Reduces \p n elements starting at \p src into the elements starting at
+    /// \p dst. A zero \p dst_stride reduces all elements into one output.
+    template <typename scalar_t, typename func_t>
+    static void ReduceLine(const char* src,
+                           int64_t src_stride,
+                           char* dst,
+                           int64_t dst_stride,
+                           int64_t n,
+                           func_t element_kernel) {
+        const int64_t byte_size = static_cast<int64_t>(sizeof(scalar_t));
+        if (dst_stride == 0) {
+            scalar_t result = *reinterpret_cast<scalar_t*>(dst);
+            if (src_stride == byte_size) {
+                const scalar_t* src_vals =
+                        reinterpret_cast<const scalar_t*>(src);
+                for (int64_t i = 0; i < n; ++i) {
+                    result = element_kernel(src_vals[i], result);
+                }
+            } else {
+                for (int64_t i = 0; i < n; ++i) {
+                    result = element_kernel(*reinterpret_cast<const scalar_t*>(
+                                                    src + i * src_stride),
+                                            result);
+                }
+            }
+            *reinterpret_cast<scalar_t*>(dst) = result;
+        } else if (src_stride == byte_size && dst_stride == byte_size) {
+            // Contiguous input and output, which the compiler can vectorize.
+            const scalar_t* src_vals = reinterpret_cast<const scalar_t*>(src);
+            scalar_t* dst_vals = reinterpret_cast<scalar_t*>(dst);
+            for (int64_t i = 0; i < n; ++i) {
+                dst_vals[i] = element_kernel(src_vals[i], dst_vals[i]);
+            }
+        } else {
+            for (int64_t i = 0; i < n; ++i) {
+                scalar_t* dst_val =
+                        reinterpret_cast<scalar_t*>(dst + i * dst_stride);
+                *dst_val = element_kernel(
+                        *reinterpret_cast<const scalar_t*>(src +
+                                                           i * src_stride),
+                        *dst_val);
+            }
+        }
+    }
+
+    /// Reductions with few outputs, e.g. the per-column sums of an (N, 3)
+    /// tensor. LaunchReductionParallelDim() would use at most one thread per
+    /// output, so instead the workloads are split evenly over the threads,
+    /// which reduce into per-thread partial outputs merged at the end.
+    ///
+    /// Each thread walks its range in lines of the two innermost dims, so that
+    /// the input and output pointers are computed once per plane and the
+    /// inner loops run with constant strides.
+    template <typename scalar_t, typename func_t>
+    static void LaunchReductionKernelTiled(const Indexer& indexer,
+                                           func_t element_kernel,
+                                           scalar_t identity) {
+        const int64_t num_workloads = indexer.NumWorkloads();
+        const int64_t num_output_elements = indexer.NumOutputElements();
+        const int64_t num_threads = GetMaxThreads();
+        const int64_t workload_per_thread =
+                (num_workloads + num_threads - 1) / num_threads;
+
+        const int64_t ndims = indexer.NumDims();
+        const int64_t* indexer_shape = indexer.GetMasterShape();
+        const int64_t num_cols = indexer_shape[ndims - 1];
+        const int64_t num_rows = ndims > 1 ? indexer_shape[ndims - 2] : 1;
+        const int64_t plane_size = num_rows * num_cols;
+
+        // The partial outputs of each thread are contiguous, in the order of
+        // Indexer::GetPerOutputIndexer().
+        std::vector<scalar_t> thread_results(num_threads * num_output_elements);
+        SizeVector partial_byte_strides(ndims, 0);
+        int64_t stride = static_cast<int64_t>(sizeof(scalar_t));
+        for (int64_t dim = ndims - 1; dim >= 0; --dim) {
+            if (!indexer.IsReductionDim(dim)) {
+                partial_byte_strides[dim] = stride;
+                stride *= indexer_shape[dim];
+            }
+        }
+        const int64_t src_col_stride =
+                indexer.GetInput(0).byte_strides_[ndims - 1];
+        const int64_t src_row_stride =
+                ndims > 1 ? indexer.GetInput(0).byte_strides_[ndims - 2] : 0;
+        const int64_t dst_col_stride = partial_byte_strides[ndims - 1];
+        const int64_t dst_row_stride =
+                ndims > 1 ? partial_byte_strides[ndims - 2] : 0;
+
+#pragma omp parallel for schedule(static)
+        for (int64_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            // Thread-local to avoid false sharing between the threads.
+            std::vector<scalar_t> partial_vals(num_output_elements, identity);
+            Indexer thread_indexer(indexer);
+            TensorRef& partial = thread_indexer.GetOutput();
+            partial.data_ptr_ = partial_vals.data();
+            for (int64_t dim = 0; dim < ndims; ++dim) {
+                partial.byte_strides_[dim] = partial_byte_strides[dim];
+            }
+
+            int64_t workload_idx = thread_idx * workload_per_thread;
+            const int64_t end =
+                    std::min(workload_idx + workload_per_thread, num_workloads);
+            while (workload_idx < end) {
+                const int64_t plane_end = std::min(
+                        end, (workload_idx / plane_size + 1) * plane_size);
+                const char* src = thread_indexer.GetInputPtr(0, workload_idx);
+                char* dst = thread_indexer.GetOutputPtr(workload_idx);
+                int64_t col = workload_idx % num_cols;
+                while (workload_idx < plane_end) {
+                    const int64_t n =
+                            std::min(num_cols - col, plane_end - workload_idx);
+                    ReduceLine<scalar_t>(src, src_col_stride, dst,
+                                         dst_col_stride, n, element_kernel);
+                    workload_idx += n;
+                    src += src_row_stride - col * src_col_stride;
+                    dst += dst_row_stride - col * dst_col_stride;
+                    col = 0;
+                }
+            }
+            std::copy(partial_vals.begin(), partial_vals.end(),
+                      thread_results.begin() +
+                              thread_idx * num_output_elements);
+        }
+
+        for (int64_t output_idx = 0; output_idx < num_output_elements;
+             ++output_idx) {
+            scalar_t* dst = reinterpret_cast<scalar_t*>(
+                    indexer.GetPerOutputIndexer(output_idx).GetOutputPtr(0));
+            for (int64_t thread_idx = 0; thread_idx < num_threads;
+                 ++thread_idx) {
+                *dst = element_kernel(
+                        thread_results[thread_idx * num_output_elements +
+                                       output_idx],
+                        *dst);
+            }
+        }
+    }
+
     template <typename scalar_t, typename func_t>
     static void LaunchReductionParallelDim(const Indexer& indexer,
                                            func_t element_kernel) {
@@ -191,6 +418,10 @@ private:
     }
 
 private:
+    /// Reductions with at most this many outputs use per-thread partial
+    /// outputs, see LaunchReductionKernelTiled().
+    static constexpr int64_t kMaxTiledOutputs = 1024;
+
     Indexer indexer_;
 };
 
@@ -208,7 +439,8 @@ public:
         // sub-iteration.
         int64_t num_output_elements = indexer_.NumOutputElements();
 
-#pragma omp parallel for schedule(static)
+#pragma omp parallel for schedule(static) \
+        if (ShouldParallelize(indexer_.NumWorkloads()))
         for (int64_t output_idx = 0; output_idx < num_output_elements;
              output_idx++) {
             // sub_indexer.NumWorkloads() == ipo.
@@ -240,7 +472,7 @@ void ReductionCPU(const Tensor& src,
     if (s_regular_reduce_ops.find(op_code) != s_regular_reduce_ops.end()) {
         Indexer indexer({src}, dst, DtypePolicy::ALL_SAME, dims);
         CPUReductionEngine re(indexer);
-        DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src.GetDtype(), [&]() {
             scalar_t identity;
             switch (op_code) {
                 case ReductionOpCode::Sum:
@@ -287,7 +519,7 @@ void ReductionCPU(const Tensor& src,
 
         Indexer indexer({src}, {dst, dst_acc}, DtypePolicy::INPUT_SAME, dims);
         CPUArgReductionEngine re(indexer);
-        DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src.GetDtype(), [&]() {
             scalar_t identity;
             switch (op_code) {
                 case ReductionOpCode::ArgMin:
@@ -347,6 +579,16 @@ void ReductionCPU(const Tensor& src,
     }
 }
 
+void ReductionMeanVarianceCPU(const Tensor& src,
+                              Tensor& mean,
+                              Tensor& variance,
+                              const SizeVector& dims) {
+    Indexer indexer({src}, {mean, variance}, DtypePolicy::ALL_SAME, dims);
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        CPUMeanVarianceReduction<scalar_t>(indexer);
+    });
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
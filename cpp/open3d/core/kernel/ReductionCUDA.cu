@@ -88,6 +88,27 @@ OPEN3D_DEVICE __forceinline__ T WARP_SHFL_DOWN(T value,
 #endif
 }
 
+// 16-bit floats are shuffled through their bit patterns.
+OPEN3D_DEVICE __forceinline__ open3d::core::float16_t WARP_SHFL_DOWN(
+        open3d::core::float16_t value,
+        unsigned int delta,
+        int width = warpSize,
+        unsigned int mask = 0xffffffff) {
+    value.x = static_cast<uint16_t>(WARP_SHFL_DOWN<unsigned int>(
+            value.x, delta, width, mask));
+    return value;
+}
+
+OPEN3D_DEVICE __forceinline__ open3d::core::bfloat16_t WARP_SHFL_DOWN(
+        open3d::core::bfloat16_t value,
+        unsigned int delta,
+        int width = warpSize,
+        unsigned int mask = 0xffffffff) {
+    value.x = static_cast<uint16_t>(WARP_SHFL_DOWN<unsigned int>(
+            value.x, delta, width, mask));
+    return value;
+}
+
 namespace open3d {
 namespace core {
 namespace kernel {
@@ -118,12 +139,15 @@ public:
     static constexpr int BLOCK_Y = 1;
     static constexpr int CTA = 2;
     static constexpr int MAX_NUM_THREADS = 512;
+    /// Number of input elements per vectorized load.
+    static constexpr int INPUT_VEC_SIZE = 4;
 
     int num_inputs_per_output_;
     int num_outputs_;
     int step_input_ = 1;
     int step_output_ = 1;
     int ctas_per_output_ = 1;
+    bool vectorize_input_ = false;
 
 private:
     int element_size_bytes_;
@@ -134,7 +158,9 @@ private:
     int num_threads_;
 
 public:
-    ReduceConfig(int element_size_bytes, const Indexer& indexer)
+    ReduceConfig(int element_size_bytes,
+                 int input_element_size_bytes,
+                 const Indexer& indexer)
         : element_size_bytes_(element_size_bytes) {
         num_outputs_ = indexer.NumOutputElements();
         num_inputs_per_output_ = indexer.NumWorkloads() / num_outputs_;
@@ -163,6 +189,15 @@ public:
             //   2. block.y now max out to num_outputs.
             dim0 = indexer.GetMasterShape()[0];
             dim1 = num_outputs_;
+
+            // A single contiguous reduction dimension is read with aligned
+            // vector loads. Each lane then covers INPUT_VEC_SIZE elements.
+            if (dim0 > 128 && indexer.NumReductionDims() == 1 &&
+                indexer.GetInput(0).byte_strides_[0] ==
+                        input_element_size_bytes) {
+                vectorize_input_ = true;
+                dim0 /= INPUT_VEC_SIZE;
+            }
         } else {
             // Map block.x to the fastest non reducing dimension. It implies:
             //   1. BlockXReduce is turned off.
@@ -269,6 +304,14 @@ public:
         return input_mult_[CTA] != 0;
     }
 
+    /// The unaligned head and the tail of a vectorized input slice are only
+    /// reduced once per output: by the first warp row if the warp rows split
+    /// the input, and by the first CTA if the CTAs split the input.
+    OPEN3D_DEVICE bool ShouldReduceTail() const {
+        return (!ShouldBlockYReduce() || threadIdx.y == 0) &&
+               (!ShouldGlobalReduce() || blockIdx.y == 0);
+    }
+
     OPEN3D_DEVICE bool ShouldStore(int output_idx) const {
         return output_idx < num_outputs_ &&
                (!ShouldBlockXReduce() || threadIdx.x == 0) &&
@@ -348,12 +391,13 @@ public:
                 "REDUCEConfig(element_size_bytes_={}, "
                 "num_inputs_per_output_={}, num_outputs_={}, "
                 "step_input_={}, step_output_={}, ctas_per_output_={}, "
-                "input_mult_={}, output_mult_={}, values_per_thread={}, "
-                "block={}, grid={}, global_memory_size={})",
+                "vectorize_input_={}, input_mult_={}, output_mult_={}, "
+                "values_per_thread={}, block={}, grid={}, "
+                "global_memory_size={})",
                 element_size_bytes_, num_inputs_per_output_, num_outputs_,
-                step_input_, step_output_, ctas_per_output_, input_mult_str,
-                output_mult_str, ValuesPerThread(), block_str, grid_str,
-                GlobalMemorySize());
+                step_input_, step_output_, ctas_per_output_, vectorize_input_,
+                input_mult_str, output_mult_str, ValuesPerThread(), block_str,
+                grid_str, GlobalMemorySize());
         return str;
     }
 };
@@ -364,17 +408,22 @@ __global__ void ReduceKernel(R reduction) {
     reduction.Run();
 }
 
-template <typename index_t>
-static OffsetCalculator<2, index_t> MakeOutputCalculator(
+/// The offsets are ordered as {output 0, input, output 1, ...}.
+template <typename index_t, int num_outputs = 1>
+static OffsetCalculator<num_outputs + 1, index_t> MakeOutputCalculator(
         const Indexer& indexer) {
     int num_reduction_dims = indexer.NumReductionDims();
     int num_output_dims = indexer.NumDims() - num_reduction_dims;
-    std::array<const int64_t*, 2> strides = {
-            indexer.GetOutput().byte_strides_ + num_reduction_dims,
-            indexer.GetInput(0).byte_strides_ + num_reduction_dims,
-    };
+    std::array<const int64_t*, num_outputs + 1> strides;
+    strides[0] = indexer.GetOutput(0).byte_strides_ + num_reduction_dims;
+    strides[1] = indexer.GetInput(0).byte_strides_ + num_reduction_dims;
+    for (int i = 1; i < num_outputs; ++i) {
+        strides[i + 1] =
+                indexer.GetOutput(i).byte_strides_ + num_reduction_dims;
+    }
     const int64_t* shape = indexer.GetMasterShape() + num_reduction_dims;
-    return OffsetCalculator<2, index_t>(num_output_dims, shape, strides.data());
+    return OffsetCalculator<num_outputs + 1, index_t>(num_output_dims, shape,
+                                                      strides.data());
 }
 
 template <typename index_t>
@@ -409,6 +458,11 @@ OPEN3D_DEVICE void StridedIterate(func_t f,
     }
 }
 
+template <typename scalar_t, int vec_size>
+struct alignas(sizeof(scalar_t) * vec_size) AlignedVector {
+    scalar_t val[vec_size];
+};
+
 /// Combime() and Reduce() are the same for regular reduction ops.
 template <typename out_scalar_t, typename func_t>
 class RegularReduceOps {
@@ -487,17 +541,76 @@ ArgReduceOps<func_t> WrapArgReduceOps(const func_t& comp_func) {
     return ArgReduceOps<func_t>{comp_func};
 }
 
+template <typename acc_t>
+struct WelfordData {
+    acc_t mean;
+    acc_t m2;
+    int64_t n;
+};
+
+/// Single-pass mean and population variance with Welford's online update.
+/// Partial results are merged with Chan et al.'s pairwise update, which avoids
+/// the cancellation of the naive sum and sum-of-squares formulation.
+template <typename scalar_t>
+class WelfordOps {
+    using acc_t = scalar_t;
+    using arg_t = WelfordData<acc_t>;
+
+public:
+    static OPEN3D_DEVICE thrust::pair<scalar_t, scalar_t> Project(arg_t arg) {
+        return thrust::pair<scalar_t, scalar_t>(
+                arg.mean, arg.m2 / static_cast<acc_t>(arg.n));
+    }
+
+    static OPEN3D_DEVICE arg_t WarpShflDown(arg_t arg, int offset) {
+        return arg_t{WARP_SHFL_DOWN(arg.mean, offset),
+                     WARP_SHFL_DOWN(arg.m2, offset),
+                     WARP_SHFL_DOWN(arg.n, offset)};
+    }
+
+    OPEN3D_DEVICE inline arg_t Combine(arg_t a, arg_t b) const {
+        if (a.n == 0) {
+            return b;
+        }
+        if (b.n == 0) {
+            return a;
+        }
+        const int64_t n = a.n + b.n;
+        const acc_t b_ratio = static_cast<acc_t>(b.n) / static_cast<acc_t>(n);
+        const acc_t delta = b.mean - a.mean;
+        return arg_t{a.mean + delta * b_ratio,
+                     a.m2 + b.m2 +
+                             delta * delta * static_cast<acc_t>(a.n) * b_ratio,
+                     n};
+    }
+
+    /// Idx is ignored for WelfordOps.
+    OPEN3D_DEVICE inline arg_t Reduce(arg_t acc,
+                                      scalar_t val,
+                                      int64_t idx) const {
+        const int64_t n = acc.n + 1;
+        const acc_t delta = static_cast<acc_t>(val) - acc.mean;
+        const acc_t mean = acc.mean + delta / static_cast<acc_t>(n);
+        return arg_t{mean, acc.m2 + delta * (static_cast<acc_t>(val) - mean),
+                     n};
+    }
+};
+
+/// Reduces one input into \p num_outputs outputs. With multiple outputs,
+/// ops_t::Project() returns a thrust::pair holding the two output values.
 template <typename scalar_t,
           typename ops_t,
           typename index_t,
           typename out_scalar_t = scalar_t,
-          int vt0 = 4>
+          int vt0 = 4,
+          int num_outputs = 1>
 class ReduceOp {
     using traits = FunctionTraits<decltype(&ops_t::Reduce)>;
     using arg_t =
             typename std::decay<typename traits::template arg<0>::type>::type;
     using InputCalculator = OffsetCalculator<1, index_t>;
-    using OutputCalculator = OffsetCalculator<2, index_t>;
+    using OutputCalculator = OffsetCalculator<num_outputs + 1, index_t>;
+    using OutputOffsets = SmallArray<index_t, num_outputs + 1>;
 
 public:
     ReduceOp(ops_t ops,
@@ -505,7 +618,7 @@ public:
              InputCalculator input_calc,
              OutputCalculator output_calc,
              const void* src,
-             char* dst,
+             SmallArray<char*, num_outputs> dst,
              void* acc_buf,
              void* cta_buf,
              int* semaphores,
@@ -545,7 +658,7 @@ public:
             value = BlockXReduce(value, shared_memory);
         }
 
-        auto out = (out_scalar_t*)((char*)dst_ + base_offsets[0]);
+        auto out = (out_scalar_t*)(dst_[0] + base_offsets[0]);
         arg_t* acc = nullptr;
         if (acc_buf_ != nullptr) {
             int64_t numerator = (int64_t)sizeof(arg_t);
@@ -564,7 +677,7 @@ public:
                                                                          value);
                 }
                 if (final_output_) {
-                    SetResultsToOutput(value, base_offsets[0]);
+                    SetResultsToOutput(value, base_offsets);
                 } else {
                     *out = GetAccumulatedOutput<can_accumulate_in_output>(
                             out, value);
@@ -574,7 +687,7 @@ public:
                     value = ops_.Combine(*acc, value);
                 }
                 if (final_output_) {
-                    SetResultsToOutput(value, base_offsets[0]);
+                    SetResultsToOutput(value, base_offsets);
                 } else {
                     *acc = value;
                 }
@@ -583,6 +696,9 @@ public:
     }
 
     OPEN3D_DEVICE arg_t ThreadReduce(const scalar_t* data) const {
+        if (config_.vectorize_input_) {
+            return InputVectorizedThreadReduce(data);
+        }
         index_t idx = config_.InputIdx();
         // Multiple accumulators to remove dependency between unrolled loops.
         arg_t value_list[vt0];
@@ -630,6 +746,72 @@ public:
         return value_list[0];
     }
 
+    /// ThreadReduce() for a contiguous input slice, using aligned vector loads
+    /// of ReduceConfig::INPUT_VEC_SIZE elements.
+    OPEN3D_DEVICE arg_t InputVectorizedThreadReduce(
+            const scalar_t* data) const {
+        constexpr int vec_size = ReduceConfig::INPUT_VEC_SIZE;
+        using load_t = AlignedVector<scalar_t, vec_size>;
+        constexpr int align_bytes = alignof(load_t);
+        constexpr int align_elements = align_bytes / sizeof(scalar_t);
+        index_t end = config_.num_inputs_per_output_;
+
+        // Handle the head of the input slice where data is not aligned.
+        arg_t value = identity_;
+        index_t shift =
+                (reinterpret_cast<uintptr_t>(data) % align_bytes) /
+                sizeof(scalar_t);
+        if (shift > 0) {
+            data -= shift;
+            end += shift;
+            if (threadIdx.x >= shift && threadIdx.x < align_elements &&
+                config_.ShouldReduceTail()) {
+                value = ops_.Reduce(value, data[threadIdx.x],
+                                    threadIdx.x - shift);
+            }
+            end -= align_elements;
+            data += align_elements;
+            shift = align_elements - shift;
+        }
+
+        // Multiple accumulators to remove dependency between unrolled loops.
+        arg_t value_list[vec_size];
+        value_list[0] = value;
+#pragma unroll
+        for (int i = 1; i < vec_size; i++) {
+            value_list[i] = identity_;
+        }
+
+        index_t idx = config_.InputIdx();
+        const index_t stride = config_.step_input_;
+        const load_t* vec_data = reinterpret_cast<const load_t*>(data);
+        while (idx * vec_size + vec_size - 1 < end) {
+            const load_t values = vec_data[idx];
+#pragma unroll
+            for (index_t i = 0; i < vec_size; i++) {
+                value_list[i] = ops_.Reduce(value_list[i], values.val[i],
+                                            shift + idx * vec_size + i);
+            }
+            idx += stride;
+        }
+
+        // Handle the tail that does not fill a whole vector.
+        index_t tail_start = end - end % vec_size;
+        if (config_.ShouldReduceTail()) {
+            index_t tail_idx = tail_start + threadIdx.x;
+            if (tail_idx < end) {
+                value_list[0] = ops_.Reduce(value_list[0], data[tail_idx],
+                                            tail_idx + shift);
+            }
+        }
+
+#pragma unroll
+        for (int i = 1; i < vec_size; i++) {
+            value_list[0] = ops_.Combine(value_list[0], value_list[i]);
+        }
+        return value_list[0];
+    }
+
     OPEN3D_DEVICE arg_t BlockXReduce(arg_t value, char* shared_memory) const {
         int dim_x = blockDim.x;
         arg_t* shared = (arg_t*)shared_memory;
@@ -726,15 +908,25 @@ public:
     }
 
     template <class T>
-    OPEN3D_DEVICE void SetResults(const T x, const index_t base_offset) const {
-        auto res = (out_scalar_t*)((char*)dst_ + base_offset);
+    OPEN3D_DEVICE void SetResults(const T x,
+                                  const OutputOffsets& base_offsets) const {
+        auto res = (out_scalar_t*)(dst_[0] + base_offsets[0]);
         *res = x;
     }
 
-    OPEN3D_DEVICE void SetResultsToOutput(arg_t value,
-                                          index_t base_offset) const {
+    /// Two outputs, the second output's offset follows the input offset.
+    template <class T>
+    OPEN3D_DEVICE void SetResults(const thrust::pair<T, T> x,
+                                  const OutputOffsets& base_offsets) const {
+        static_assert(num_outputs == 2, "Project() output count mismatch.");
+        *(out_scalar_t*)(dst_[0] + base_offsets[0]) = x.first;
+        *(out_scalar_t*)(dst_[1] + base_offsets[2]) = x.second;
+    }
+
+    OPEN3D_DEVICE void SetResultsToOutput(
+            arg_t value, const OutputOffsets& base_offsets) const {
         OPEN3D_ASSERT(final_output_);
-        SetResults(ops_.Project(value), base_offset);
+        SetResults(ops_.Project(value), base_offsets);
     }
 
     OPEN3D_DEVICE arg_t GlobalReduce(arg_t value,
@@ -743,7 +935,7 @@ public:
         arg_t* reduce_buffer = (arg_t*)cta_buf_;
         index_t output_idx = config_.OutputIdx();
         auto base_offsets = output_calc_.get(output_idx);
-        auto out = (out_scalar_t*)((char*)dst_ + base_offsets[0]);
+        auto out = (out_scalar_t*)(dst_[0] + base_offsets[0]);
 
         bool should_store = config_.ShouldStore(config_.OutputIdx());
         if (should_store) {
@@ -788,7 +980,7 @@ public:
                                 out, value);
                     }
                     if (final_output_) {
-                        SetResultsToOutput(value, base_offsets[0]);
+                        SetResultsToOutput(value, base_offsets);
                     } else {
                         *out = GetAccumulatedOutput<can_accumulate_in_output>(
                                 out, value);
@@ -798,7 +990,7 @@ public:
                         value = ops_.Combine(*acc, value);
                     }
                     if (final_output_) {
-                        SetResultsToOutput(value, base_offsets[0]);
+                        SetResultsToOutput(value, base_offsets);
                     } else {
                         *acc = value;
                     }
@@ -820,7 +1012,7 @@ private:
     InputCalculator input_calc_;
     OutputCalculator output_calc_;
     const void* src_;
-    const char* dst_;
+    SmallArray<char*, num_outputs> dst_;
     // acc_buf_ used for accumulation among sub Tensor Iterator when
     // accumulation on output is not permissible
     void* acc_buf_;
@@ -832,6 +1024,99 @@ private:
     bool final_output_;
 };
 
+/// Reductions of a contiguous [num_rows, num_cols] array with at most
+/// TALL_SKINNY_MAX_COLS columns, e.g. an (N, 3) point array, are handled by
+/// dedicated kernels. ReduceConfig maps such shapes to blocks only a few lanes
+/// wide, which reads the input with poorly coalesced loads.
+constexpr int64_t TALL_SKINNY_MAX_COLS = 32;
+constexpr int64_t TALL_SKINNY_MIN_ROWS = 1024;
+constexpr int TALL_SKINNY_THREADS = 256;
+constexpr int TALL_SKINNY_ROW_THREADS = 128;
+constexpr int64_t TALL_SKINNY_VALUES_PER_THREAD = 16;
+constexpr int64_t TALL_SKINNY_MAX_BLOCKS = 1024;
+
+/// Reduces a contiguous [num_elements / num_cols, num_cols] array over its
+/// rows. Threads read consecutive elements and the grid stride is a multiple
+/// of num_cols, so each thread always accumulates the same column. Block b
+/// writes its num_cols partial results to dst[b * num_cols + col].
+template <typename scalar_t, typename func_t>
+__global__ void TallSkinnyReduceRowsKernel(const scalar_t* src,
+                                           scalar_t* dst,
+                                           int64_t num_elements,
+                                           int num_cols,
+                                           func_t reduce_func,
+                                           scalar_t identity) {
+    __shared__ scalar_t shared[TALL_SKINNY_THREADS];
+    const int num_lanes = (blockDim.x / num_cols) * num_cols;
+    const int tid = threadIdx.x;
+
+    scalar_t value = identity;
+    if (tid < num_lanes) {
+        const int64_t stride = static_cast<int64_t>(gridDim.x) * num_lanes;
+        for (int64_t i = static_cast<int64_t>(blockIdx.x) * num_lanes + tid;
+             i < num_elements; i += stride) {
+            value = reduce_func(value, src[i]);
+        }
+    }
+    shared[tid] = value;
+    __syncthreads();
+
+    // Tree reduction over the lane rows of each column.
+    const int num_lane_rows = num_lanes / num_cols;
+    const int lane_row = tid / num_cols;
+    int offset = 1;
+    while (offset < num_lane_rows) {
+        offset <<= 1;
+    }
+    for (offset >>= 1; offset > 0; offset >>= 1) {
+        if (tid < num_lanes && lane_row < offset &&
+            lane_row + offset < num_lane_rows) {
+            shared[tid] = reduce_func(shared[tid],
+                                      shared[tid + offset * num_cols]);
+        }
+        __syncthreads();
+    }
+    if (tid < num_cols) {
+        dst[static_cast<int64_t>(blockIdx.x) * num_cols + tid] = shared[tid];
+    }
+}
+
+/// Reduces each row of a contiguous [num_rows, num_cols] array. A block first
+/// stages blockDim.x rows in shared memory with coalesced loads, then each
+/// thread reduces one row.
+template <typename scalar_t, typename func_t>
+__global__ void TallSkinnyReduceColsKernel(const scalar_t* src,
+                                           scalar_t* dst,
+                                           int64_t num_rows,
+                                           int num_cols,
+                                           func_t reduce_func,
+                                           scalar_t identity) {
+    __shared__ scalar_t shared[TALL_SKINNY_ROW_THREADS * TALL_SKINNY_MAX_COLS];
+    const int64_t rows_per_iter = static_cast<int64_t>(gridDim.x) * blockDim.x;
+    for (int64_t row_begin = static_cast<int64_t>(blockIdx.x) * blockDim.x;
+         row_begin < num_rows; row_begin += rows_per_iter) {
+        const int64_t remaining_rows = num_rows - row_begin;
+        const int64_t block_rows = remaining_rows < blockDim.x
+                                           ? remaining_rows
+                                           : static_cast<int64_t>(blockDim.x);
+        const scalar_t* block_src = src + row_begin * num_cols;
+        __syncthreads();
+        for (int64_t i = threadIdx.x; i < block_rows * num_cols;
+             i += blockDim.x) {
+            shared[i] = block_src[i];
+        }
+        __syncthreads();
+        if (threadIdx.x < block_rows) {
+            scalar_t value = identity;
+            for (int col = 0; col < num_cols; ++col) {
+                value = reduce_func(value,
+                                    shared[threadIdx.x * num_cols + col]);
+            }
+            dst[row_begin + threadIdx.x] = value;
+        }
+    }
+}
+
 class AccumulationBuffer {
 public:
     AccumulationBuffer() {}
@@ -909,18 +1194,130 @@ public:
         } else {
             // func_t is a regular reduction function.
             // Signature: (scalar_t, scalar_t) -> scalar_t.
-            RunReduce<scalar_t, scalar_t>(
-                    indexer_, WrapRegularReduceOps<scalar_t>(reduce_func),
-                    identity);
+            if (!RunTallSkinnyReduce(indexer_, reduce_func, identity)) {
+                RunReduce<scalar_t, scalar_t>(
+                        indexer_, WrapRegularReduceOps<scalar_t>(reduce_func),
+                        identity);
+            }
         }
     }
 
+    /// Computes the mean and the population variance of the input in a single
+    /// pass. The indexer's two outputs receive the mean and the variance.
+    template <typename scalar_t>
+    void RunMeanVariance() {
+        if (indexer_.NumWorkloads() == 0) {
+            utility::LogError(
+                    "0-sized input should be handled outside of the reudction "
+                    "engine.");
+        }
+        if (indexer_.NumInputs() != 1 || indexer_.NumOutputs() != 2) {
+            utility::LogError(
+                    "Mean-variance reduction must have exactly one input and "
+                    "two outputs.");
+        }
+        RunReduce<scalar_t, scalar_t, 4, 2>(indexer_, WelfordOps<scalar_t>(),
+                                            WelfordData<scalar_t>{0, 0, 0});
+    }
+
 private:
+    /// Runs the tall-skinny kernels if the indexer reduces either axis of a
+    /// contiguous [N, C] input with a small C into a contiguous output.
+    /// Returns false if the reduction is not of this form.
+    template <typename scalar_t, typename func_t>
+    static bool RunTallSkinnyReduce(const Indexer& indexer,
+                                    const func_t& reduce_func,
+                                    scalar_t identity) {
+        if (indexer.NumDims() != 2 || indexer.NumReductionDims() != 1 ||
+            indexer.ShouldAccumulate() || !indexer.IsFinalOutput()) {
+            return false;
+        }
+        // The reduction dimension is dim 0 of the master shape.
+        const int64_t* shape = indexer.GetMasterShape();
+        const int64_t* src_strides = indexer.GetInput(0).byte_strides_;
+        const int64_t element_size = sizeof(scalar_t);
+        if (indexer.GetOutput(0).byte_strides_[1] != element_size) {
+            return false;
+        }
+        bool reduce_rows;
+        int64_t num_rows;
+        int64_t num_cols;
+        if (src_strides[1] == element_size &&
+            src_strides[0] == element_size * shape[1]) {
+            // [N, C] -> [C].
+            reduce_rows = true;
+            num_rows = shape[0];
+            num_cols = shape[1];
+        } else if (src_strides[0] == element_size &&
+                   src_strides[1] == element_size * shape[0]) {
+            // [N, C] -> [N].
+            reduce_rows = false;
+            num_rows = shape[1];
+            num_cols = shape[0];
+        } else {
+            return false;
+        }
+        if (num_cols > TALL_SKINNY_MAX_COLS ||
+            num_rows < TALL_SKINNY_MIN_ROWS) {
+            return false;
+        }
+
+        const scalar_t* src =
+                static_cast<const scalar_t*>(indexer.GetInput(0).data_ptr_);
+        scalar_t* dst = static_cast<scalar_t*>(indexer.GetOutput(0).data_ptr_);
+        const int cols = static_cast<int>(num_cols);
+        cudaStream_t stream = CUDAStream::GetCurrent();
+        std::unique_ptr<Blob> partial_blob;
+        if (reduce_rows) {
+            const int64_t num_elements = num_rows * num_cols;
+            const int64_t num_lanes =
+                    (TALL_SKINNY_THREADS / num_cols) * num_cols;
+            const int64_t num_blocks = std::min(
+                    DivUp(num_elements,
+                          num_lanes * TALL_SKINNY_VALUES_PER_THREAD),
+                    TALL_SKINNY_MAX_BLOCKS);
+            if (num_blocks == 1) {
+                TallSkinnyReduceRowsKernel<<<1, TALL_SKINNY_THREADS, 0,
+                                             stream>>>(src, dst, num_elements,
+                                                       cols, reduce_func,
+                                                       identity);
+            } else {
+                // The per-block partial results are reduced by a second
+                // single-block launch.
+                int device_id = CUDAState::GetInstance()->GetCurentDeviceID();
+                partial_blob = std::make_unique<Blob>(
+                        num_blocks * num_cols * element_size,
+                        Device(Device::DeviceType::CUDA, device_id));
+                scalar_t* partial =
+                        static_cast<scalar_t*>(partial_blob->GetDataPtr());
+                TallSkinnyReduceRowsKernel<<<num_blocks, TALL_SKINNY_THREADS, 0,
+                                             stream>>>(src, partial,
+                                                       num_elements, cols,
+                                                       reduce_func, identity);
+                TallSkinnyReduceRowsKernel<<<1, TALL_SKINNY_THREADS, 0,
+                                             stream>>>(
+                        partial, dst, num_blocks * num_cols, cols, reduce_func,
+                        identity);
+            }
+        } else {
+            const int64_t num_blocks =
+                    std::min(DivUp(num_rows, TALL_SKINNY_ROW_THREADS),
+                             static_cast<int64_t>(65535));
+            TallSkinnyReduceColsKernel<<<num_blocks, TALL_SKINNY_ROW_THREADS, 0,
+                                         stream>>>(src, dst, num_rows, cols,
+                                                   reduce_func, identity);
+        }
+        OPEN3D_CUDA_CHECK(cudaStreamSynchronize(stream));
+        OPEN3D_CUDA_CHECK(cudaGetLastError());
+        return true;
+    }
+
     /// If the index cannot be represented in 32 bits, RunReduce calls itself
     /// recursively.
     template <typename scalar_t,
               typename out_scalar_t,
               int vt0 = 4,
+              int num_outputs = 1,
               typename ops_t,
               typename ident_t>
     static void RunReduce(Indexer& indexer,
@@ -946,11 +1343,11 @@ private:
                     output_memory_size = std::max(
                             output_memory_size,
                             indexer.GetMasterShape()[dim] *
-                                    indexer.GetOutput().byte_strides_[dim]);
+                                    indexer.GetOutput(0).byte_strides_[dim]);
                 }
                 owned_buf_ptr.reset(new AccumulationBuffer(
                         sizeof(arg_t), sizeof(out_scalar_t),
-                        (char*)indexer.GetOutput().data_ptr_,
+                        (char*)indexer.GetOutput(0).data_ptr_,
                         output_memory_size * sizeof(arg_t)));
             } else {
                 owned_buf_ptr.reset(new AccumulationBuffer());
@@ -960,13 +1357,14 @@ private:
 
         if (!can_use_32bit_indexing) {
             for (auto& sub_indexer : indexer.SplitTo32BitIndexing()) {
-                RunReduce<scalar_t, out_scalar_t, vt0>(sub_indexer, ops,
-                                                       identity, acc_buf_ptr);
+                RunReduce<scalar_t, out_scalar_t, vt0, num_outputs>(
+                        sub_indexer, ops, identity, acc_buf_ptr);
             }
             return;
         }
 
-        ReduceConfig config(sizeof(arg_t), indexer);
+        ReduceConfig config(sizeof(arg_t), sizeof(scalar_t), indexer);
+        cudaStream_t stream = CUDAStream::GetCurrent();
 
         std::unique_ptr<Blob> buffer_blob;
         std::unique_ptr<Blob> semaphores_blob;
@@ -982,18 +1380,22 @@ private:
                     std::make_unique<Blob>(config.SemaphoreSize(), device);
             buffer = buffer_blob->GetDataPtr();
             semaphores = semaphores_blob->GetDataPtr();
-            OPEN3D_CUDA_CHECK(
-                    cudaMemset(semaphores, 0, config.SemaphoreSize()));
+            OPEN3D_CUDA_CHECK(cudaMemsetAsync(semaphores, 0,
+                                              config.SemaphoreSize(), stream));
         }
 
         OPEN3D_ASSERT(can_use_32bit_indexing);
         const char* in_data = (char*)indexer.GetInput(0).data_ptr_;
-        char* out_data = (char*)indexer.GetOutput().data_ptr_;
-        char* acc_data = acc_buf_ptr->GetAccSlice(out_data);
-        auto output_calc = MakeOutputCalculator<uint32_t>(indexer);
+        SmallArray<char*, num_outputs> out_data;
+        for (int i = 0; i < num_outputs; ++i) {
+            out_data[i] = (char*)indexer.GetOutput(i).data_ptr_;
+        }
+        char* acc_data = acc_buf_ptr->GetAccSlice(out_data[0]);
+        auto output_calc = MakeOutputCalculator<uint32_t, num_outputs>(indexer);
         auto input_calc = MakeInputCalculator<uint32_t>(indexer);
 
-        auto reduce_op = ReduceOp<scalar_t, ops_t, uint32_t, out_scalar_t, vt0>(
+        auto reduce_op = ReduceOp<scalar_t, ops_t, uint32_t, out_scalar_t, vt0,
+                                  num_outputs>(
                 ops, config, input_calc, output_calc, in_data, out_data,
                 acc_data, buffer, (int*)semaphores, identity,
                 indexer.ShouldAccumulate(), indexer.IsFinalOutput());
@@ -1001,9 +1403,9 @@ private:
         // Launch reduce kernel
         int shared_memory = config.SharedMemorySize();
         ReduceKernel<ReduceConfig::MAX_NUM_THREADS>
-                <<<config.GridDim(), config.BlockDim(), shared_memory>>>(
-                        reduce_op);
-        OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+                <<<config.GridDim(), config.BlockDim(), shared_memory,
+                   stream>>>(reduce_op);
+        OPEN3D_CUDA_CHECK(cudaStreamSynchronize(stream));
         OPEN3D_CUDA_CHECK(cudaGetLastError());
     }
 
@@ -1021,7 +1423,7 @@ void ReductionCUDA(const Tensor& src,
         CUDAReductionEngine re(indexer);
         Dtype dtype = src.GetDtype();
         CUDADeviceSwitcher switcher(src.GetDevice());
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             switch (op_code) {
                 case ReductionOpCode::Sum:
                     if (indexer.NumWorkloads() == 0) {
@@ -1079,7 +1481,7 @@ void ReductionCUDA(const Tensor& src,
         CUDAReductionEngine re(indexer);
         Dtype dtype = src.GetDtype();
         CUDADeviceSwitcher switcher(src.GetDevice());
-        DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(dtype, [&]() {
             switch (op_code) {
                 case ReductionOpCode::ArgMin:
                     if (indexer.NumWorkloads() == 0) {
@@ -1149,6 +1551,18 @@ void ReductionCUDA(const Tensor& src,
     }
 }
 
+void ReductionMeanVarianceCUDA(const Tensor& src,
+                               Tensor& mean,
+                               Tensor& variance,
+                               const SizeVector& dims) {
+    Indexer indexer({src}, {mean, variance}, DtypePolicy::ALL_SAME, dims);
+    CUDAReductionEngine re(indexer);
+    CUDADeviceSwitcher switcher(src.GetDevice());
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        re.RunMeanVariance<scalar_t>();
+    });
+}
+
 }  // namespace kernel
 }  // namespace core
 }  // namespace open3d
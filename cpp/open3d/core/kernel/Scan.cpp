@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Scan.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Profiler.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+Dtype CumSumDtype(const Dtype& dtype) {
+    if (dtype.GetDtypeCode() == Dtype::DtypeCode::Float) {
+        return dtype;
+    } else if (dtype.GetDtypeCode() == Dtype::DtypeCode::Bool ||
+               dtype.GetDtypeCode() == Dtype::DtypeCode::Int ||
+               dtype.GetDtypeCode() == Dtype::DtypeCode::UInt) {
+        return Dtype::Int64;
+    } else {
+        utility::LogError("CumSum does not support dtype {}.",
+                          dtype.ToString());
+    }
+}
+
+void CumSum(const Tensor& src, Tensor& dst, int64_t dim, bool exclusive) {
+    OPEN3D_PROFILE_SCOPE("CumSum", src.GetDevice());
+
+    if (src.NumDims() == 0) {
+        utility::LogError("CumSum does not support 0-dim tensors.");
+    }
+    dim = shape_util::WrapDim(dim, src.NumDims());
+    const Dtype dst_dtype = CumSumDtype(src.GetDtype());
+    if (dst.GetShape() != src.GetShape() || dst.GetDtype() != dst_dtype ||
+        dst.GetDevice() != src.GetDevice()) {
+        utility::LogError(
+                "CumSum expects dst with shape {}, dtype {} and device {}, "
+                "but got {}, {} and {}.",
+                src.GetShape(), dst_dtype.ToString(),
+                src.GetDevice().ToString(), dst.GetShape(),
+                dst.GetDtype().ToString(), dst.GetDevice().ToString());
+    }
+    if (src.NumElements() == 0) {
+        return;
+    }
+
+    // Half types are scanned in Float32.
+    if (src.GetDtype() == Dtype::Float16 || src.GetDtype() == Dtype::BFloat16) {
+        Tensor src_f32 = src.To(Dtype::Float32);
+        Tensor dst_f32(src.GetShape(), Dtype::Float32, src.GetDevice());
+        CumSum(src_f32, dst_f32, dim, exclusive);
+        dst.AsRvalue() = dst_f32.To(dst.GetDtype());
+        return;
+    }
+
+    // Implementations scan the last dimension of contiguous tensors. The
+    // scanned dimension is swapped to the end and swapped back afterwards.
+    const int64_t last_dim = src.NumDims() - 1;
+    Tensor src_lines = src.Transpose(dim, last_dim).Contiguous();
+    Tensor dst_lines = dst;
+    if (dim != last_dim || !dst.IsContiguous()) {
+        dst_lines = Tensor(src_lines.GetShape(), dst_dtype, src.GetDevice());
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        CumSumCPU(src_lines, dst_lines, exclusive);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        CumSumCUDA(src_lines, dst_lines, exclusive);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("CumSum: Unimplemented device");
+    }
+
+    if (!dst_lines.IsSame(dst)) {
+        dst.AsRvalue() = dst_lines.Transpose(dim, last_dim);
+    }
+}
+
+Tensor Compact(const Tensor& mask) {
+    OPEN3D_PROFILE_SCOPE("Compact", mask.GetDevice());
+
+    Tensor mask_contiguous = mask.Contiguous();
+    if (mask.NumElements() == 0) {
+        return Tensor(SizeVector{0}, Dtype::Int64, mask.GetDevice());
+    }
+
+    Device::DeviceType device_type = mask.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return CompactCPU(mask_contiguous);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        return CompactCUDA(mask_contiguous);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Compact: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
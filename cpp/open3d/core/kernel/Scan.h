@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Returns the dtype CumSum() accumulates and outputs \p dtype in: Int64 for
+/// boolean and integer dtypes, \p dtype itself for floating point dtypes.
+Dtype CumSumDtype(const Dtype& dtype);
+
+/// Inclusive or exclusive prefix sum of \p src along \p dim.
+///
+/// \param src The input tensor. Float16 and BFloat16 accumulate in Float32.
+/// \param dst Output tensor with the shape of \p src and dtype
+/// CumSumDtype(src.GetDtype()), on the same device as \p src.
+/// \param dim The dimension to scan along.
+/// \param exclusive If true, dst[i] is the sum of the elements before i and
+/// dst[0] is 0. Otherwise dst[i] includes src[i].
+void CumSum(const Tensor& src, Tensor& dst, int64_t dim, bool exclusive);
+
+/// CPU and CUDA implementations scan the last dimension of a contiguous \p src
+/// into a contiguous \p dst.
+void CumSumCPU(const Tensor& src, Tensor& dst, bool exclusive);
+
+#ifdef BUILD_CUDA_MODULE
+void CumSumCUDA(const Tensor& src, Tensor& dst, bool exclusive);
+#endif
+
+/// Stream compaction of the non-zero elements of \p mask.
+///
+/// Returns a 1D Int64 tensor with the flat (row-major) indices of the non-zero
+/// elements of \p mask, in increasing order. The output positions come from a
+/// parallel prefix sum of the mask instead of an atomic counter, so the
+/// result is deterministic.
+///
+/// This is the building block for kernels with a data-dependent number of
+/// outputs: compute a mask over the candidates, Compact() it, then run one
+/// workload per selected candidate.
+Tensor Compact(const Tensor& mask);
+
+Tensor CompactCPU(const Tensor& mask);
+
+#ifdef BUILD_CUDA_MODULE
+Tensor CompactCUDA(const Tensor& mask);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,178 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/core/kernel/Scan.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Minimum number of elements per thread for the parallel scan of a single
+/// line and for Compact().
+static constexpr int64_t SCAN_GRAIN_SIZE = 32768;
+
+template <typename scalar_t, typename acc_t>
+static void CPUScanRange(const scalar_t* src,
+                         acc_t* dst,
+                         int64_t n,
+                         acc_t init,
+                         bool exclusive) {
+    acc_t sum = init;
+    if (exclusive) {
+        for (int64_t i = 0; i < n; ++i) {
+            dst[i] = sum;
+            sum += static_cast<acc_t>(src[i]);
+        }
+    } else {
+        for (int64_t i = 0; i < n; ++i) {
+            sum += static_cast<acc_t>(src[i]);
+            dst[i] = sum;
+        }
+    }
+}
+
+template <typename scalar_t, typename acc_t>
+static void CPUCumSumLines(const Tensor& src, Tensor& dst, bool exclusive) {
+    const int64_t line_len = src.GetShape().back();
+    const int64_t num_lines = src.NumElements() / line_len;
+    const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+    acc_t* dst_ptr = dst.GetDataPtr<acc_t>();
+    const int64_t num_threads = GetMaxThreads();
+
+    if (num_lines >= num_threads || line_len < 2 * SCAN_GRAIN_SIZE) {
+#pragma omp parallel for schedule(static)
+        for (int64_t line = 0; line < num_lines; ++line) {
+            CPUScanRange(src_ptr + line * line_len, dst_ptr + line * line_len,
+                         line_len, acc_t(0), exclusive);
+        }
+        return;
+    }
+
+    // Few long lines: each line is split into chunks, which are summed in
+    // parallel, and then scanned in parallel starting from the prefix sum of
+    // the chunk sums.
+    const int64_t num_chunks =
+            std::min(num_threads, line_len / SCAN_GRAIN_SIZE);
+    const int64_t chunk_size = (line_len + num_chunks - 1) / num_chunks;
+    std::vector<acc_t> chunk_offsets(num_chunks + 1);
+    for (int64_t line = 0; line < num_lines; ++line) {
+        const scalar_t* line_src = src_ptr + line * line_len;
+        acc_t* line_dst = dst_ptr + line * line_len;
+        chunk_offsets[0] = acc_t(0);
+#pragma omp parallel for schedule(static) num_threads(num_chunks)
+        for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+            const int64_t start = chunk * chunk_size;
+            const int64_t end = std::min(start + chunk_size, line_len);
+            acc_t sum = acc_t(0);
+            for (int64_t i = start; i < end; ++i) {
+                sum += static_cast<acc_t>(line_src[i]);
+            }
+            chunk_offsets[chunk + 1] = sum;
+        }
+        std::partial_sum(chunk_offsets.begin(), chunk_offsets.end(),
+                         chunk_offsets.begin());
+#pragma omp parallel for schedule(static) num_threads(num_chunks)
+        for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+            const int64_t start = chunk * chunk_size;
+            const int64_t end = std::min(start + chunk_size, line_len);
+            if (start < end) {
+                CPUScanRange(line_src + start, line_dst + start, end - start,
+                             chunk_offsets[chunk], exclusive);
+            }
+        }
+    }
+}
+
+void CumSumCPU(const Tensor& src, Tensor& dst, bool exclusive) {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        using acc_t = typename std::conditional<
+                std::is_floating_point<scalar_t>::value, scalar_t,
+                int64_t>::type;
+        CPUCumSumLines<scalar_t, acc_t>(src, dst, exclusive);
+    });
+}
+
+template <typename scalar_t>
+static Tensor CPUCompact(const Tensor& mask) {
+    const int64_t n = mask.NumElements();
+    const scalar_t* mask_ptr = mask.GetDataPtr<scalar_t>();
+    const scalar_t zero = static_cast<scalar_t>(0);
+
+    // Each range counts its non-zero elements, then writes their indices
+    // starting from the exclusive prefix sum of the counts.
+    const int64_t num_ranges = std::max<int64_t>(
+            1, std::min<int64_t>(GetMaxThreads(), n / SCAN_GRAIN_SIZE));
+    const int64_t range_size = (n + num_ranges - 1) / num_ranges;
+    std::vector<int64_t> range_offsets(num_ranges + 1, 0);
+#pragma omp parallel for schedule(static) num_threads(num_ranges)
+    for (int64_t range_idx = 0; range_idx < num_ranges; ++range_idx) {
+        const int64_t start = range_idx * range_size;
+        const int64_t end = std::min(start + range_size, n);
+        int64_t count = 0;
+        for (int64_t i = start; i < end; ++i) {
+            count += (mask_ptr[i] != zero);
+        }
+        range_offsets[range_idx + 1] = count;
+    }
+    std::partial_sum(range_offsets.begin(), range_offsets.end(),
+                     range_offsets.begin());
+
+    Tensor indices(SizeVector{range_offsets.back()}, Dtype::Int64,
+                   mask.GetDevice());
+    int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+#pragma omp parallel for schedule(static) num_threads(num_ranges)
+    for (int64_t range_idx = 0; range_idx < num_ranges; ++range_idx) {
+        const int64_t start = range_idx * range_size;
+        const int64_t end = std::min(start + range_size, n);
+        int64_t* range_indices_ptr = indices_ptr + range_offsets[range_idx];
+        for (int64_t i = start; i < end; ++i) {
+            if (mask_ptr[i] != zero) {
+                *range_indices_ptr++ = i;
+            }
+        }
+    }
+    return indices;
+}
+
+Tensor CompactCPU(const Tensor& mask) {
+    Tensor indices;
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(mask.GetDtype(), [&]() {
+        indices = CPUCompact<scalar_t>(mask);
+    });
+    return indices;
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include <cub/cub.cuh>
+#include <limits>
+#include <type_traits>
+
+#include "open3d/core/CUDAState.cuh"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/kernel/Scan.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+template <typename scalar_t, typename acc_t>
+struct CastToAccFunctor {
+    __host__ __device__ acc_t operator()(scalar_t value) const {
+        return static_cast<acc_t>(value);
+    }
+};
+
+/// Maps a flat element index to the index of its line, the scan key.
+struct LineIndexFunctor {
+    int64_t line_len_;
+    __host__ __device__ int64_t operator()(int64_t i) const {
+        return i / line_len_;
+    }
+};
+
+template <typename scalar_t>
+struct IsNonZeroFunctor {
+    __host__ __device__ bool operator()(scalar_t value) const {
+        return value != static_cast<scalar_t>(0);
+    }
+};
+
+void CumSumCUDA(const Tensor& src, Tensor& dst, bool exclusive) {
+    CUDADeviceSwitcher switcher(src.GetDevice());
+    auto policy = thrust::cuda::par.on(CUDAStream::GetCurrent());
+    const int64_t n = src.NumElements();
+    const int64_t line_len = src.GetShape().back();
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        using acc_t = typename std::conditional<
+                std::is_floating_point<scalar_t>::value, scalar_t,
+                int64_t>::type;
+        auto values = thrust::make_transform_iterator(
+                thrust::device_pointer_cast(src.GetDataPtr<scalar_t>()),
+                CastToAccFunctor<scalar_t, acc_t>());
+        thrust::device_ptr<acc_t> dst_ptr(dst.GetDataPtr<acc_t>());
+        if (line_len == n) {
+            if (exclusive) {
+                thrust::exclusive_scan(policy, values, values + n, dst_ptr,
+                                       acc_t(0));
+            } else {
+                thrust::inclusive_scan(policy, values, values + n, dst_ptr);
+            }
+        } else {
+            // Several lines are scanned at once, keyed by their line index.
+            auto keys = thrust::make_transform_iterator(
+                    thrust::counting_iterator<int64_t>(0),
+                    LineIndexFunctor{line_len});
+            if (exclusive) {
+                thrust::exclusive_scan_by_key(policy, keys, keys + n, values,
+                                              dst_ptr, acc_t(0));
+            } else {
+                thrust::inclusive_scan_by_key(policy, keys, keys + n, values,
+                                              dst_ptr);
+            }
+        }
+    });
+    OPEN3D_GET_LAST_CUDA_ERROR("CumSumCUDA failed.");
+}
+
+Tensor CompactCUDA(const Tensor& mask) {
+    Device device = mask.GetDevice();
+    CUDADeviceSwitcher switcher(device);
+    cudaStream_t stream = CUDAStream::GetCurrent();
+    const int64_t n = mask.NumElements();
+    if (n > std::numeric_limits<int>::max()) {
+        utility::LogError(
+                "CompactCUDA supports at most {} elements, but got {}.",
+                std::numeric_limits<int>::max(), n);
+    }
+
+    // Selected indices are written to a buffer of the worst-case size, then
+    // copied out once the number of selected elements is known.
+    Tensor indices_buffer(SizeVector{n}, Dtype::Int64, device);
+    Tensor num_selected(SizeVector{1}, Dtype::Int64, device);
+    cub::CountingInputIterator<int64_t> index_it(0);
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(mask.GetDtype(), [&]() {
+        cub::TransformInputIterator<bool, IsNonZeroFunctor<scalar_t>,
+                                    const scalar_t*>
+                flag_it(mask.GetDataPtr<scalar_t>(),
+                        IsNonZeroFunctor<scalar_t>());
+        size_t temp_bytes = 0;
+        OPEN3D_CUDA_CHECK(cub::DeviceSelect::Flagged(
+                nullptr, temp_bytes, index_it, flag_it,
+                indices_buffer.GetDataPtr<int64_t>(),
+                num_selected.GetDataPtr<int64_t>(), static_cast<int>(n),
+                stream));
+        Tensor temp = Tensor::Empty({static_cast<int64_t>(temp_bytes)},
+                                    Dtype::UInt8, device);
+        OPEN3D_CUDA_CHECK(cub::DeviceSelect::Flagged(
+                temp.GetDataPtr(), temp_bytes, index_it, flag_it,
+                indices_buffer.GetDataPtr<int64_t>(),
+                num_selected.GetDataPtr<int64_t>(), static_cast<int>(n),
+                stream));
+    });
+    return indices_buffer.Slice(0, 0, num_selected[0].Item<int64_t>())
+            .Clone();
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
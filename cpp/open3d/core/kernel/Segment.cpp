@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Segment.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Profiler.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+Tensor SegmentOffsets(const Tensor& segment_ids, int64_t num_segments) {
+    OPEN3D_PROFILE_SCOPE("SegmentOffsets", segment_ids.GetDevice());
+
+    Device::DeviceType device_type = segment_ids.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        return SegmentOffsetsCPU(segment_ids.Contiguous(), num_segments);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        return SegmentOffsetsCUDA(segment_ids.Contiguous(), num_segments);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("SegmentOffsets: Unimplemented device");
+    }
+}
+
+void SegmentReduce(const Tensor& src,
+                   const Tensor& offsets,
+                   Tensor& dst,
+                   SegmentReductionOpCode op_code) {
+    OPEN3D_PROFILE_SCOPE("SegmentReduce", src.GetDevice());
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SegmentReduceCPU(src, offsets, dst, op_code);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SegmentReduceCUDA(src, offsets, dst, op_code);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("SegmentReduce: Unimplemented device");
+    }
+}
+
+void SegmentFill(const Tensor& offsets, const Tensor& indices, Tensor& dst) {
+    OPEN3D_PROFILE_SCOPE("SegmentFill", offsets.GetDevice());
+
+    Device::DeviceType device_type = offsets.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SegmentFillCPU(offsets, indices, dst);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SegmentFillCUDA(offsets, indices, dst);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("SegmentFill: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+enum class SegmentReductionOpCode { Sum, Mean, Max, First };
+
+/// Returns Int64 offsets {num_segments + 1} of the segments in the sorted
+/// Int64 \p segment_ids, i.e. segment s spans [offsets[s], offsets[s + 1]).
+/// Segment ids must lie in [0, num_segments).
+Tensor SegmentOffsets(const Tensor& segment_ids, int64_t num_segments);
+
+/// Reduces the rows of the contiguous \p src {n, ...} in each segment given by
+/// \p offsets into \p dst {num_segments, ...}. Empty segments are 0.
+void SegmentReduce(const Tensor& src,
+                   const Tensor& offsets,
+                   Tensor& dst,
+                   SegmentReductionOpCode op_code);
+
+/// Writes the segment id s to dst[indices[i]] for every i in segment s.
+/// \p dst is a pre-allocated Int64 tensor {n}.
+void SegmentFill(const Tensor& offsets, const Tensor& indices, Tensor& dst);
+
+Tensor SegmentOffsetsCPU(const Tensor& segment_ids, int64_t num_segments);
+
+void SegmentReduceCPU(const Tensor& src,
+                      const Tensor& offsets,
+                      Tensor& dst,
+                      SegmentReductionOpCode op_code);
+
+void SegmentFillCPU(const Tensor& offsets, const Tensor& indices, Tensor& dst);
+
+#ifdef BUILD_CUDA_MODULE
+Tensor SegmentOffsetsCUDA(const Tensor& segment_ids, int64_t num_segments);
+
+void SegmentReduceCUDA(const Tensor& src,
+                       const Tensor& offsets,
+                       Tensor& dst,
+                       SegmentReductionOpCode op_code);
+
+void SegmentFillCUDA(const Tensor& offsets, const Tensor& indices, Tensor& dst);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
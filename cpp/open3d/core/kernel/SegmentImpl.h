@@ -0,0 +1,168 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Segment.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+#if defined(__CUDACC__)
+Tensor SegmentOffsetsCUDA
+#else
+Tensor SegmentOffsetsCPU
+#endif
+        (const Tensor& segment_ids, int64_t num_segments) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    const int64_t n = segment_ids.GetLength();
+    const int64_t* ids_ptr = segment_ids.GetDataPtr<int64_t>();
+    Tensor offsets = Tensor::Empty({num_segments + 1}, Dtype::Int64,
+                                   segment_ids.GetDevice());
+    int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+
+    // Binary search for the first id not less than s.
+    launcher::ParallelFor(num_segments + 1, [=] OPEN3D_DEVICE(int64_t s) {
+        int64_t lo = 0, hi = n;
+        while (lo < hi) {
+            int64_t mid = lo + (hi - lo) / 2;
+            if (ids_ptr[mid] < s) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        offsets_ptr[s] = lo;
+    });
+    return offsets;
+}
+
+#if defined(__CUDACC__)
+void SegmentReduceCUDA
+#else
+void SegmentReduceCPU
+#endif
+        (const Tensor& src,
+         const Tensor& offsets,
+         Tensor& dst,
+         SegmentReductionOpCode op_code) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    const int64_t num_segments = offsets.GetLength() - 1;
+    const int64_t n = src.GetLength();
+    const int64_t num_cols = n == 0 ? 0 : src.NumElements() / n;
+    const int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+    const bool mean = op_code == SegmentReductionOpCode::Mean;
+    const bool max = op_code == SegmentReductionOpCode::Max;
+    const bool first = op_code == SegmentReductionOpCode::First;
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        scalar_t* dst_ptr = dst.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(
+                num_segments * num_cols, [=] OPEN3D_DEVICE(int64_t workload) {
+                    const int64_t s = workload / num_cols;
+                    const int64_t col = workload % num_cols;
+                    const int64_t begin = offsets_ptr[s];
+                    const int64_t end = offsets_ptr[s + 1];
+                    if (end == begin) {
+                        dst_ptr[workload] = 0;
+                        return;
+                    }
+                    if (first) {
+                        dst_ptr[workload] = src_ptr[begin * num_cols + col];
+                        return;
+                    }
+                    if (max) {
+                        scalar_t value = src_ptr[begin * num_cols + col];
+                        for (int64_t i = begin + 1; i < end; ++i) {
+                            scalar_t v = src_ptr[i * num_cols + col];
+                            value = v > value ? v : value;
+                        }
+                        dst_ptr[workload] = value;
+                        return;
+                    }
+                    scalar_t sum = 0;
+                    for (int64_t i = begin; i < end; ++i) {
+                        sum += src_ptr[i * num_cols + col];
+                    }
+                    if (mean) {
+                        sum = sum / static_cast<scalar_t>(end - begin);
+                    }
+                    dst_ptr[workload] = sum;
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void SegmentFillCUDA
+#else
+void SegmentFillCPU
+#endif
+        (const Tensor& offsets, const Tensor& indices, Tensor& dst) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    const int64_t num_segments = offsets.GetLength() - 1;
+    const int64_t n = indices.GetLength();
+    const int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+    const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    int64_t* dst_ptr = dst.GetDataPtr<int64_t>();
+
+    // Binary search for the last segment starting at or before i, which keeps
+    // the work per element balanced for skewed segment sizes.
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t i) {
+        int64_t lo = 0, hi = num_segments;
+        while (hi - lo > 1) {
+            int64_t mid = lo + (hi - lo) / 2;
+            if (offsets_ptr[mid] <= i) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+        dst_ptr[indices_ptr[i]] = lo;
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/Sort.h"
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Profiler.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+void Sort(const Tensor& src, Tensor& dst, Tensor& indices) {
+    OPEN3D_PROFILE_SCOPE("Sort", src.GetDevice());
+
+    if (src.NumDims() != 1) {
+        utility::LogError("Sort only supports 1D tensors, but got {}D.",
+                          src.NumDims());
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        SortCPU(src, dst, indices);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        SortCUDA(src, dst, indices);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Sort: Unimplemented device");
+    }
+}
+
+void TopK(const Tensor& src,
+          int64_t k,
+          bool largest,
+          bool sorted,
+          Tensor& values,
+          Tensor& indices) {
+    OPEN3D_PROFILE_SCOPE("TopK", src.GetDevice());
+
+    if (src.NumDims() != 2) {
+        utility::LogError("TopK only supports 2D tensors, but got {}D.",
+                          src.NumDims());
+    }
+    if (k < 0 || k > src.GetShape(1)) {
+        utility::LogError("TopK: k must be in [0, {}], but got {}.",
+                          src.GetShape(1), k);
+    }
+
+    Device::DeviceType device_type = src.GetDevice().GetType();
+    if (device_type == Device::DeviceType::CPU) {
+        TopKCPU(src, k, largest, sorted, values, indices);
+    } else if (device_type == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        TopKCUDA(src, k, largest, sorted, values, indices);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("TopK: Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
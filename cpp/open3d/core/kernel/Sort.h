@@ -0,0 +1,87 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Stable ascending sort of the 1D tensor \p src.
+///
+/// \param src The 1D tensor to be sorted. All dtypes are supported.
+/// \param dst Output tensor with the sorted values.
+/// \param indices Output Int64 tensor such that dst = src[indices].
+void Sort(const Tensor& src, Tensor& dst, Tensor& indices);
+
+void SortCPU(const Tensor& src, Tensor& dst, Tensor& indices);
+
+#ifdef BUILD_CUDA_MODULE
+void SortCUDA(const Tensor& src, Tensor& dst, Tensor& indices);
+#endif
+
+/// Selects the \p k smallest or largest elements of every row of the 2D
+/// tensor \p src. Equal elements are ordered by their index, and NaN is
+/// larger than all other values.
+///
+/// \param src The 2D tensor of shape {rows, n}. All dtypes are supported.
+/// \param k Number of elements to select per row, 0 <= k <= n.
+/// \param largest If true, selects the largest elements, otherwise the
+/// smallest.
+/// \param sorted If true, the selected elements of a row are sorted, the
+/// largest (smallest) first. Otherwise only the k-th element is at column
+/// k - 1, preceded by the other selected elements in unspecified order.
+/// \param values Output tensor of shape {rows, k} with the selected elements.
+/// \param indices Output Int64 tensor of shape {rows, k} with their column
+/// indices in \p src.
+void TopK(const Tensor& src,
+          int64_t k,
+          bool largest,
+          bool sorted,
+          Tensor& values,
+          Tensor& indices);
+
+void TopKCPU(const Tensor& src,
+             int64_t k,
+             bool largest,
+             bool sorted,
+             Tensor& values,
+             Tensor& indices);
+
+#ifdef BUILD_CUDA_MODULE
+void TopKCUDA(const Tensor& src,
+              int64_t k,
+              bool largest,
+              bool sorted,
+              Tensor& values,
+              Tensor& indices);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,255 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// Radix keys are unsigned integers with the same ordering as the values.
+static inline uint8_t ToRadixKey(bool v) { return static_cast<uint8_t>(v); }
+static inline uint8_t ToRadixKey(uint8_t v) { return v; }
+static inline uint16_t ToRadixKey(uint16_t v) { return v; }
+static inline uint32_t ToRadixKey(uint32_t v) { return v; }
+static inline uint64_t ToRadixKey(uint64_t v) { return v; }
+
+static inline uint8_t ToRadixKey(int8_t v) {
+    return static_cast<uint8_t>(v) ^ (uint8_t(1) << 7);
+}
+static inline uint16_t ToRadixKey(int16_t v) {
+    return static_cast<uint16_t>(v) ^ (uint16_t(1) << 15);
+}
+static inline uint32_t ToRadixKey(int32_t v) {
+    return static_cast<uint32_t>(v) ^ (uint32_t(1) << 31);
+}
+static inline uint64_t ToRadixKey(int64_t v) {
+    return static_cast<uint64_t>(v) ^ (uint64_t(1) << 63);
+}
+
+// Negative floats have all bits flipped, positive floats the sign bit.
+template <typename float_t, typename ukey_t>
+static inline ukey_t FloatToRadixKey(float_t v) {
+    // -0.0 and +0.0 compare equal, map them to the same key.
+    if (v == 0) {
+        v = 0;
+    }
+    constexpr ukey_t sign_bit = ukey_t(1) << (sizeof(ukey_t) * 8 - 1);
+    ukey_t bits;
+    std::memcpy(&bits, &v, sizeof(ukey_t));
+    return (bits & sign_bit) ? ~bits : (bits | sign_bit);
+}
+static inline uint32_t ToRadixKey(float v) {
+    return FloatToRadixKey<float, uint32_t>(v);
+}
+static inline uint64_t ToRadixKey(double v) {
+    return FloatToRadixKey<double, uint64_t>(v);
+}
+
+/// Stable LSD radix sort of \p keys with 8-bit digits, permuting \p values
+/// along. Each pass builds per-thread digit histograms, so that every thread
+/// scatters its chunk to disjoint positions. Passes where all keys share the
+/// same digit are skipped.
+template <typename ukey_t>
+static void RadixSortPairs(std::vector<ukey_t>& keys,
+                           std::vector<int64_t>& values) {
+    constexpr int kRadixBits = 8;
+    constexpr int64_t kNumBuckets = int64_t(1) << kRadixBits;
+    constexpr int64_t kMinSizePerThread = 1 << 14;
+    const int64_t n = static_cast<int64_t>(keys.size());
+
+    const int64_t num_threads = std::max<int64_t>(
+            1, std::min<int64_t>(GetMaxThreads(), n / kMinSizePerThread));
+    const int64_t chunk_size = (n + num_threads - 1) / num_threads;
+
+    std::vector<ukey_t> keys_tmp(n);
+    std::vector<int64_t> values_tmp(n);
+    std::vector<int64_t> offsets(num_threads * kNumBuckets);
+
+    for (size_t shift = 0; shift < sizeof(ukey_t) * 8; shift += kRadixBits) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int64_t t = 0; t < num_threads; ++t) {
+            int64_t* histogram = offsets.data() + t * kNumBuckets;
+            const int64_t end = std::min(n, (t + 1) * chunk_size);
+            for (int64_t i = t * chunk_size; i < end; ++i) {
+                histogram[(keys[i] >> shift) & (kNumBuckets - 1)]++;
+            }
+        }
+
+        // Exclusive scan in (digit, thread) order keeps the sort stable.
+        bool all_same_digit = false;
+        int64_t sum = 0;
+        for (int64_t d = 0; d < kNumBuckets; ++d) {
+            int64_t digit_count = 0;
+            for (int64_t t = 0; t < num_threads; ++t) {
+                int64_t count = offsets[t * kNumBuckets + d];
+                offsets[t * kNumBuckets + d] = sum;
+                sum += count;
+                digit_count += count;
+            }
+            if (digit_count == n) {
+                all_same_digit = true;
+                break;
+            }
+        }
+        if (all_same_digit) {
+            continue;
+        }
+
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int64_t t = 0; t < num_threads; ++t) {
+            int64_t* offset = offsets.data() + t * kNumBuckets;
+            const int64_t end = std::min(n, (t + 1) * chunk_size);
+            for (int64_t i = t * chunk_size; i < end; ++i) {
+                int64_t pos = offset[(keys[i] >> shift) & (kNumBuckets - 1)]++;
+                keys_tmp[pos] = keys[i];
+                values_tmp[pos] = values[i];
+            }
+        }
+        keys.swap(keys_tmp);
+        values.swap(values_tmp);
+    }
+}
+
+template <typename scalar_t>
+static void SortCPU(const scalar_t* src_ptr,
+                    scalar_t* dst_ptr,
+                    int64_t* indices_ptr,
+                    int64_t n) {
+    // Small inputs are not worth the radix passes.
+    constexpr int64_t kMinRadixSortSize = 1024;
+    using ukey_t = decltype(ToRadixKey(scalar_t()));
+
+    std::vector<ukey_t> keys(n);
+    std::vector<int64_t> order(n);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < n; ++i) {
+        keys[i] = ToRadixKey(src_ptr[i]);
+        order[i] = i;
+    }
+
+    if (n < kMinRadixSortSize) {
+        std::stable_sort(order.begin(), order.end(),
+                         [&keys](int64_t lhs, int64_t rhs) {
+                             return keys[lhs] < keys[rhs];
+                         });
+    } else {
+        RadixSortPairs(keys, order);
+    }
+
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < n; ++i) {
+        indices_ptr[i] = order[i];
+        dst_ptr[i] = src_ptr[order[i]];
+    }
+}
+
+void SortCPU(const Tensor& src, Tensor& dst, Tensor& indices) {
+    Tensor src_contiguous = src.Contiguous();
+    const int64_t n = src.NumElements();
+    dst = Tensor::Empty({n}, src.GetDtype(), src.GetDevice());
+    indices = Tensor::Empty({n}, Dtype::Int64, src.GetDevice());
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        SortCPU(src_contiguous.GetDataPtr<scalar_t>(),
+                dst.GetDataPtr<scalar_t>(), indices.GetDataPtr<int64_t>(), n);
+    });
+}
+
+template <typename scalar_t>
+static void TopKCPU(const scalar_t* src_ptr,
+                    scalar_t* values_ptr,
+                    int64_t* indices_ptr,
+                    int64_t rows,
+                    int64_t n,
+                    int64_t k,
+                    bool largest,
+                    bool sorted) {
+    using ukey_t = decltype(ToRadixKey(scalar_t()));
+
+    // Rows are processed in parallel. Each row is partitioned around its k-th
+    // element by std::nth_element (introselect), in O(n).
+#pragma omp parallel for schedule(static) if (rows > 1)
+    for (int64_t row = 0; row < rows; ++row) {
+        const scalar_t* row_ptr = src_ptr + row * n;
+        std::vector<ukey_t> keys(n);
+        std::vector<int64_t> order(n);
+        for (int64_t i = 0; i < n; ++i) {
+            // Inverted keys select the largest elements.
+            keys[i] = largest ? static_cast<ukey_t>(~ToRadixKey(row_ptr[i]))
+                              : ToRadixKey(row_ptr[i]);
+            order[i] = i;
+        }
+        // Ties are ordered by index, which makes the order strict.
+        auto less = [&keys](int64_t lhs, int64_t rhs) {
+            return keys[lhs] < keys[rhs] ||
+                   (keys[lhs] == keys[rhs] && lhs < rhs);
+        };
+        std::nth_element(order.begin(), order.begin() + k - 1, order.end(),
+                         less);
+        if (sorted) {
+            std::sort(order.begin(), order.begin() + k - 1, less);
+        }
+        for (int64_t i = 0; i < k; ++i) {
+            values_ptr[row * k + i] = row_ptr[order[i]];
+            indices_ptr[row * k + i] = order[i];
+        }
+    }
+}
+
+void TopKCPU(const Tensor& src,
+             int64_t k,
+             bool largest,
+             bool sorted,
+             Tensor& values,
+             Tensor& indices) {
+    Tensor src_contiguous = src.Contiguous();
+    const int64_t rows = src.GetShape(0);
+    const int64_t n = src.GetShape(1);
+    values = Tensor::Empty({rows, k}, src.GetDtype(), src.GetDevice());
+    indices = Tensor::Empty({rows, k}, Dtype::Int64, src.GetDevice());
+    if (k == 0) {
+        return;
+    }
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        TopKCPU(src_contiguous.GetDataPtr<scalar_t>(),
+                values.GetDataPtr<scalar_t>(), indices.GetDataPtr<int64_t>(),
+                rows, n, k, largest, sorted);
+    });
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,165 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cub/cub.cuh>
+#include <limits>
+
+#include "open3d/core/CUDAState.cuh"
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+// CUB radix-sorts bool keys through their byte representation.
+template <typename scalar_t>
+struct RadixSortKey {
+    using type = scalar_t;
+};
+
+template <>
+struct RadixSortKey<bool> {
+    using type = uint8_t;
+};
+
+void SortCUDA(const Tensor& src, Tensor& dst, Tensor& indices) {
+    Device device = src.GetDevice();
+    CUDADeviceSwitcher switcher(device);
+    cudaStream_t stream = CUDAStream::GetCurrent();
+
+    const int64_t n = src.NumElements();
+    if (n > std::numeric_limits<int>::max()) {
+        utility::LogError("SortCUDA supports at most {} elements, but got {}.",
+                          std::numeric_limits<int>::max(), n);
+    }
+    Tensor src_contiguous = src.Contiguous();
+    Tensor order = Tensor::Arange(0, n, 1, Dtype::Int64, device);
+    dst = Tensor::Empty({n}, src.GetDtype(), device);
+    indices = Tensor::Empty({n}, Dtype::Int64, device);
+    if (n == 0) {
+        return;
+    }
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        using key_t = typename RadixSortKey<scalar_t>::type;
+        const key_t* keys_in =
+                static_cast<const key_t*>(src_contiguous.GetDataPtr());
+        key_t* keys_out = static_cast<key_t*>(dst.GetDataPtr());
+        const int64_t* values_in =
+                static_cast<const int64_t*>(order.GetDataPtr());
+        int64_t* values_out = static_cast<int64_t*>(indices.GetDataPtr());
+
+        size_t temp_bytes = 0;
+        OPEN3D_CUDA_CHECK(cub::DeviceRadixSort::SortPairs(
+                nullptr, temp_bytes, keys_in, keys_out, values_in, values_out,
+                static_cast<int>(n), 0, sizeof(key_t) * 8, stream));
+        Tensor temp = Tensor::Empty({static_cast<int64_t>(temp_bytes)},
+                                    Dtype::UInt8, device);
+        OPEN3D_CUDA_CHECK(cub::DeviceRadixSort::SortPairs(
+                temp.GetDataPtr(), temp_bytes, keys_in, keys_out, values_in,
+                values_out, static_cast<int>(n), 0, sizeof(key_t) * 8,
+                stream));
+    });
+}
+
+void TopKCUDA(const Tensor& src,
+              int64_t k,
+              bool largest,
+              bool sorted,
+              Tensor& values,
+              Tensor& indices) {
+    Device device = src.GetDevice();
+    CUDADeviceSwitcher switcher(device);
+    cudaStream_t stream = CUDAStream::GetCurrent();
+
+    const int64_t rows = src.GetShape(0);
+    const int64_t n = src.GetShape(1);
+    if (rows * n > std::numeric_limits<int>::max()) {
+        utility::LogError("TopKCUDA supports at most {} elements, but got {}.",
+                          std::numeric_limits<int>::max(), rows * n);
+    }
+    if (k == 0 || rows == 0) {
+        values = Tensor::Empty({rows, k}, src.GetDtype(), device);
+        indices = Tensor::Empty({rows, k}, Dtype::Int64, device);
+        return;
+    }
+
+    // The rows are sorted as segments by a stable radix sort, which also
+    // orders equal elements by their index. The first k columns are the
+    // selection, sorted whether requested or not.
+    Tensor src_contiguous = src.Contiguous();
+    Tensor order = Tensor::Arange(0, n, 1, Dtype::Int64, device)
+                           .Reshape({1, n})
+                           .Expand({rows, n})
+                           .Contiguous();
+    Tensor offsets =
+            Tensor::Arange(0, (rows + 1) * n, n, Dtype::Int32, device);
+    Tensor sorted_values = Tensor::Empty({rows, n}, src.GetDtype(), device);
+    Tensor sorted_indices = Tensor::Empty({rows, n}, Dtype::Int64, device);
+    const int num_items = static_cast<int>(rows * n);
+    const int num_segments = static_cast<int>(rows);
+    const int* offsets_ptr = offsets.GetDataPtr<int>();
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        using key_t = typename RadixSortKey<scalar_t>::type;
+        const key_t* keys_in =
+                static_cast<const key_t*>(src_contiguous.GetDataPtr());
+        key_t* keys_out = static_cast<key_t*>(sorted_values.GetDataPtr());
+        const int64_t* values_in =
+                static_cast<const int64_t*>(order.GetDataPtr());
+        int64_t* values_out =
+                static_cast<int64_t*>(sorted_indices.GetDataPtr());
+
+        auto sort_pairs = [&](void* temp_ptr, size_t& temp_bytes) {
+            if (largest) {
+                return cub::DeviceSegmentedRadixSort::SortPairsDescending(
+                        temp_ptr, temp_bytes, keys_in, keys_out, values_in,
+                        values_out, num_items, num_segments, offsets_ptr,
+                        offsets_ptr + 1, 0, sizeof(key_t) * 8, stream);
+            } else {
+                return cub::DeviceSegmentedRadixSort::SortPairs(
+                        temp_ptr, temp_bytes, keys_in, keys_out, values_in,
+                        values_out, num_items, num_segments, offsets_ptr,
+                        offsets_ptr + 1, 0, sizeof(key_t) * 8, stream);
+            }
+        };
+        size_t temp_bytes = 0;
+        OPEN3D_CUDA_CHECK(sort_pairs(nullptr, temp_bytes));
+        Tensor temp = Tensor::Empty({static_cast<int64_t>(temp_bytes)},
+                                    Dtype::UInt8, device);
+        OPEN3D_CUDA_CHECK(sort_pairs(temp.GetDataPtr(), temp_bytes));
+    });
+
+    values = sorted_values.Slice(1, 0, k).Contiguous();
+    indices = sorted_indices.Slice(1, 0, k).Contiguous();
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "open3d/core/kernel/UnaryEW.h"
 
+#include "open3d/core/Profiler.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Logging.h"
@@ -34,7 +35,19 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
+// Profiling scope names, in the order of UnaryEWOpCode.
+static const char* const s_unary_ew_op_names[] = {
+        "UnaryEW::Sqrt",  "UnaryEW::Sin",        "UnaryEW::Cos",
+        "UnaryEW::Neg",   "UnaryEW::Exp",        "UnaryEW::Abs",
+        "UnaryEW::IsNan", "UnaryEW::IsInf",      "UnaryEW::IsFinite",
+        "UnaryEW::Floor", "UnaryEW::Ceil",       "UnaryEW::Round",
+        "UnaryEW::Trunc", "UnaryEW::LogicalNot",
+};
+
 void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
+    OPEN3D_PROFILE_SCOPE(s_unary_ew_op_names[static_cast<int>(op_code)],
+                         src.GetDevice());
+
     // Check shape
     if (!shape_util::CanBeBrocastedToShape(src.GetShape(), dst.GetShape())) {
         utility::LogError("Shape {} can not be broadcasted to {}.",
@@ -63,6 +76,13 @@ void UnaryEW(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
 }
 
 void Copy(const Tensor& src, Tensor& dst) {
+    // Cross-device copies are timed on the CUDA device.
+    const Device profile_device =
+            src.GetDevice().GetType() == Device::DeviceType::CUDA
+                    ? src.GetDevice()
+                    : dst.GetDevice();
+    OPEN3D_PROFILE_SCOPE("Copy", profile_device);
+
     // Check shape
     if (!shape_util::CanBeBrocastedToShape(src.GetShape(), dst.GetShape())) {
         utility::LogError("Shape {} can not be broadcasted to {}.",
@@ -26,6 +26,7 @@
 
 #include <cmath>
 #include <cstring>
+#include <type_traits>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -40,11 +41,13 @@ namespace open3d {
 namespace core {
 namespace kernel {
 
+// The element kernels take and return values so that they can be inlined into
+// the vectorized loops of the contiguous path.
+
 template <typename src_t, typename dst_t>
-static void CPUCopyElementKernel(const void* src, void* dst) {
-    *static_cast<dst_t*>(dst) =
-            static_cast<dst_t>(*static_cast<const src_t*>(src));
-}
+struct CPUCopyElementKernel {
+    dst_t operator()(src_t src) const { return static_cast<dst_t>(src); }
+};
 
 static void CPUCopyObjectElementKernel(const void* src,
                                        void* dst,
@@ -55,87 +58,165 @@ static void CPUCopyObjectElementKernel(const void* src,
 }
 
 template <typename scalar_t>
-static void CPUSqrtElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
-            std::sqrt(*static_cast<const scalar_t*>(src)));
-}
+struct CPUSqrtElementKernel {
+    scalar_t operator()(scalar_t src) const {
+        return static_cast<scalar_t>(std::sqrt(src));
+    }
+};
 
 template <typename scalar_t>
-static void CPUSinElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) =
-            static_cast<scalar_t>(std::sin(*static_cast<const scalar_t*>(src)));
-}
+struct CPUSinElementKernel {
+    scalar_t operator()(scalar_t src) const {
+        return static_cast<scalar_t>(std::sin(src));
+    }
+};
 
 template <typename scalar_t>
-static void CPUCosElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) =
-            static_cast<scalar_t>(std::cos(*static_cast<const scalar_t*>(src)));
-}
+struct CPUCosElementKernel {
+    scalar_t operator()(scalar_t src) const {
+        return static_cast<scalar_t>(std::cos(src));
+    }
+};
 
 template <typename scalar_t>
-static void CPUNegElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) =
-            static_cast<scalar_t>(-*static_cast<const scalar_t*>(src));
-}
+struct CPUNegElementKernel {
+    scalar_t operator()(scalar_t src) const {
+        return static_cast<scalar_t>(-src);
+    }
+};
 
 template <typename scalar_t>
-static void CPUExpElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) =
-            static_cast<scalar_t>(std::exp(*static_cast<const scalar_t*>(src)));
-}
+struct CPUExpElementKernel {
+    scalar_t operator()(scalar_t src) const {
+        return static_cast<scalar_t>(std::exp(src));
+    }
+};
 
 template <typename scalar_t>
-static void CPUAbsElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
-            std::abs(static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
+struct CPUAbsElementKernel {
+    scalar_t operator()(scalar_t src) const {
+        return static_cast<scalar_t>(std::abs(static_cast<double>(src)));
+    }
+};
 
 template <typename scalar_t>
-static void CPUIsNanElementKernel(const void* src, void* dst) {
-    *static_cast<bool*>(dst) =
-            std::isnan(static_cast<float>(*static_cast<const scalar_t*>(src)));
-}
+struct CPUIsNanElementKernel {
+    bool operator()(scalar_t src) const {
+        return std::isnan(static_cast<float>(src));
+    }
+};
 
 template <typename scalar_t>
-static void CPUIsInfElementKernel(const void* src, void* dst) {
-    *static_cast<bool*>(dst) =
-            std::isinf(static_cast<float>(*static_cast<const scalar_t*>(src)));
-}
+struct CPUIsInfElementKernel {
+    bool operator()(scalar_t src) const {
+        return std::isinf(static_cast<float>(src));
+    }
+};
 
 template <typename scalar_t>
-static void CPUIsFiniteElementKernel(const void* src, void* dst) {
-    *static_cast<bool*>(dst) = std::isfinite(
-            static_cast<float>(*static_cast<const scalar_t*>(src)));
-}
+struct CPUIsFiniteElementKernel {
+    bool operator()(scalar_t src) const {
+        return std::isfinite(static_cast<float>(src));
+    }
+};
 
 template <typename scalar_t>
-static void CPUFloorElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(std::floor(
-            static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
+struct CPUFloorElementKernel {
+    scalar_t operator()(scalar_t src) const {
+        return static_cast<scalar_t>(std::floor(static_cast<double>(src)));
+    }
+};
 
 template <typename scalar_t>
-static void CPUCeilElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(
-            std::ceil(static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
+struct CPUCeilElementKernel {
+    scalar_t operator()(scalar_t src) const {
+        return static_cast<scalar_t>(std::ceil(static_cast<double>(src)));
+    }
+};
 
 template <typename scalar_t>
-static void CPURoundElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(std::round(
-            static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
+struct CPURoundElementKernel {
+    scalar_t operator()(scalar_t src) const {
+        return static_cast<scalar_t>(std::round(static_cast<double>(src)));
+    }
+};
 
 template <typename scalar_t>
-static void CPUTruncElementKernel(const void* src, void* dst) {
-    *static_cast<scalar_t*>(dst) = static_cast<scalar_t>(std::trunc(
-            static_cast<double>(*static_cast<const scalar_t*>(src))));
-}
+struct CPUTruncElementKernel {
+    scalar_t operator()(scalar_t src) const {
+        return static_cast<scalar_t>(std::trunc(static_cast<double>(src)));
+    }
+};
 
 template <typename src_t, typename dst_t>
-static void CPULogicalNotElementKernel(const void* src, void* dst) {
-    *static_cast<dst_t*>(dst) = static_cast<dst_t>(
-            !static_cast<bool>(*static_cast<const src_t*>(src)));
+struct CPULogicalNotElementKernel {
+    dst_t operator()(src_t src) const {
+        return static_cast<dst_t>(!static_cast<bool>(src));
+    }
+};
+
+template <typename src_t, typename dst_t, typename element_kernel_t>
+static void LaunchUnaryEWIndexerKernel(const Tensor& src,
+                                       Tensor& dst,
+                                       DtypePolicy dtype_policy,
+                                       const element_kernel_t& element_kernel) {
+    Indexer indexer({src}, dst, dtype_policy);
+    cpu_launcher::LaunchUnaryEWKernel(
+            indexer, [&](const void* src_ptr, void* dst_ptr) {
+                *static_cast<dst_t*>(dst_ptr) =
+                        element_kernel(*static_cast<const src_t*>(src_ptr));
+            });
+}
+
+template <typename src_t, typename dst_t, typename element_kernel_t>
+static void LaunchUnaryEWCPUKernel(const Tensor& src,
+                                   Tensor& dst,
+                                   DtypePolicy dtype_policy,
+                                   const element_kernel_t& element_kernel,
+                                   std::true_type /*has_contiguous_path*/) {
+    if (src.IsContiguous() && dst.IsContiguous() &&
+        src.GetShape() == dst.GetShape() &&
+        dst.GetDtype() == Dtype::FromType<dst_t>()) {
+        cpu_launcher::LaunchUnaryEWContiguousKernel(
+                static_cast<const src_t*>(src.GetDataPtr()),
+                static_cast<dst_t*>(dst.GetDataPtr()), dst.NumElements(),
+                element_kernel);
+    } else {
+        LaunchUnaryEWIndexerKernel<src_t, dst_t>(src, dst, dtype_policy,
+                                                 element_kernel);
+    }
+}
+
+template <typename src_t, typename dst_t, typename element_kernel_t>
+static void LaunchUnaryEWCPUKernel(const Tensor& src,
+                                   Tensor& dst,
+                                   DtypePolicy dtype_policy,
+                                   const element_kernel_t& element_kernel,
+                                   std::false_type /*has_contiguous_path*/) {
+    LaunchUnaryEWIndexerKernel<src_t, dst_t>(src, dst, dtype_policy,
+                                             element_kernel);
+}
+
+/// Launches \p element_kernel over all elements of \p dst. When \p src and
+/// \p dst are contiguous and have the same shape, the kernel runs on raw
+/// pointers. Otherwise, the Indexer computes the per-element offsets.
+///
+/// The raw pointer path is only instantiated if both \p src_t and \p dst_t
+/// are in \p contiguous_types_t. Other types always use the Indexer.
+template <typename src_t,
+          typename dst_t,
+          typename contiguous_types_t = HotScalarTypes,
+          typename element_kernel_t>
+static void LaunchUnaryEWCPUKernel(const Tensor& src,
+                                   Tensor& dst,
+                                   DtypePolicy dtype_policy,
+                                   const element_kernel_t& element_kernel) {
+    using has_contiguous_path = std::integral_constant<
+            bool,
+            ScalarTypeListContains<src_t, contiguous_types_t>::value &&
+                    ScalarTypeListContains<dst_t, contiguous_types_t>::value>;
+    LaunchUnaryEWCPUKernel<src_t, dst_t>(src, dst, dtype_policy,
+                                         element_kernel, has_contiguous_path());
 }
 
 void CopyCPU(const Tensor& src, Tensor& dst) {
@@ -152,32 +233,32 @@ void CopyCPU(const Tensor& src, Tensor& dst) {
                src.NumElements() == 1 && !src_dtype.IsObject()) {
         int64_t num_elements = dst.NumElements();
 
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dst_dtype, [&]() {
             scalar_t scalar_element = src.To(dst_dtype).Item<scalar_t>();
             scalar_t* dst_ptr = static_cast<scalar_t*>(dst.GetDataPtr());
             cpu_launcher::ParallelFor(num_elements, [&](int64_t workload_idx) {
                 dst_ptr[workload_idx] = scalar_element;
             });
         });
-    } else {
+    } else if (src_dtype.IsObject()) {
         Indexer indexer({src}, dst, DtypePolicy::NONE);
-        if (src.GetDtype().IsObject()) {
-            int64_t object_byte_size = src.GetDtype().ByteSize();
-            cpu_launcher::LaunchUnaryEWKernel(
-                    indexer, [&](const void* src, void* dst) {
-                        CPUCopyObjectElementKernel(src, dst, object_byte_size);
-                    });
-
-        } else {
-            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
-                using src_t = scalar_t;
-                DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dst_dtype, [&]() {
-                    using dst_t = scalar_t;
-                    cpu_launcher::LaunchUnaryEWKernel(
-                            indexer, CPUCopyElementKernel<src_t, dst_t>);
+        int64_t object_byte_size = src_dtype.ByteSize();
+        cpu_launcher::LaunchUnaryEWKernel(
+                indexer, [&](const void* src, void* dst) {
+                    CPUCopyObjectElementKernel(src, dst, object_byte_size);
                 });
+    } else {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
+            using src_t = scalar_t;
+            DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(dst_dtype, [&]() {
+                using dst_t = scalar_t;
+                // Type conversions, e.g. of UInt8 images to Float32, keep
+                // the raw pointer path for all dtypes.
+                LaunchUnaryEWCPUKernel<src_t, dst_t, AllScalarTypes>(
+                        src, dst, DtypePolicy::NONE,
+                        CPUCopyElementKernel<src_t, dst_t>());
             });
-        }
+        });
     }
 }
 
@@ -187,25 +268,25 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
     Dtype dst_dtype = dst.GetDtype();
 
     auto assert_dtype_is_float = [](Dtype dtype) -> void {
-        if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        if (dtype != Dtype::Float32 && dtype != Dtype::Float64 &&
+            dtype != Dtype::Float16 && dtype != Dtype::BFloat16) {
             utility::LogError(
-                    "Only supports Float32 and Float64, but {} is used.",
+                    "Only supports Float32, Float64, Float16 and BFloat16, "
+                    "but {} is used.",
                     dtype.ToString());
         }
     };
 
     if (op_code == UnaryEWOpCode::LogicalNot) {
-        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL_AND_HALF(src_dtype, [&]() {
             if (dst_dtype == src_dtype) {
-                Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
-                cpu_launcher::LaunchUnaryEWKernel(
-                        indexer,
-                        CPULogicalNotElementKernel<scalar_t, scalar_t>);
+                LaunchUnaryEWCPUKernel<scalar_t, scalar_t>(
+                        src, dst, DtypePolicy::ALL_SAME,
+                        CPULogicalNotElementKernel<scalar_t, scalar_t>());
             } else if (dst_dtype == Dtype::Bool) {
-                Indexer indexer({src}, dst,
-                                DtypePolicy::INPUT_SAME_OUTPUT_BOOL);
-                cpu_launcher::LaunchUnaryEWKernel(
-                        indexer, CPULogicalNotElementKernel<scalar_t, bool>);
+                LaunchUnaryEWCPUKernel<scalar_t, bool>(
+                        src, dst, DtypePolicy::INPUT_SAME_OUTPUT_BOOL,
+                        CPULogicalNotElementKernel<scalar_t, bool>());
             } else {
                 utility::LogError(
                         "Boolean op's output type must be boolean or the "
@@ -216,67 +297,78 @@ void UnaryEWCPU(const Tensor& src, Tensor& dst, UnaryEWOpCode op_code) {
                op_code == UnaryEWOpCode::IsInf ||
                op_code == UnaryEWOpCode::IsFinite) {
         assert_dtype_is_float(src_dtype);
-        Indexer indexer({src}, dst, DtypePolicy::INPUT_SAME_OUTPUT_BOOL);
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             if (op_code == UnaryEWOpCode::IsNan) {
-                cpu_launcher::LaunchUnaryEWKernel(
-                        indexer, CPUIsNanElementKernel<scalar_t>);
+                LaunchUnaryEWCPUKernel<scalar_t, bool>(
+                        src, dst, DtypePolicy::INPUT_SAME_OUTPUT_BOOL,
+                        CPUIsNanElementKernel<scalar_t>());
             } else if (op_code == UnaryEWOpCode::IsInf) {
-                cpu_launcher::LaunchUnaryEWKernel(
-                        indexer, CPUIsInfElementKernel<scalar_t>);
+                LaunchUnaryEWCPUKernel<scalar_t, bool>(
+                        src, dst, DtypePolicy::INPUT_SAME_OUTPUT_BOOL,
+                        CPUIsInfElementKernel<scalar_t>());
 
             } else if (op_code == UnaryEWOpCode::IsFinite) {
-                cpu_launcher::LaunchUnaryEWKernel(
-                        indexer, CPUIsFiniteElementKernel<scalar_t>);
+                LaunchUnaryEWCPUKernel<scalar_t, bool>(
+                        src, dst, DtypePolicy::INPUT_SAME_OUTPUT_BOOL,
+                        CPUIsFiniteElementKernel<scalar_t>());
             }
         });
     } else {
-        Indexer indexer({src}, dst, DtypePolicy::ALL_SAME);
-        DISPATCH_DTYPE_TO_TEMPLATE(src_dtype, [&]() {
+        DISPATCH_DTYPE_TO_TEMPLATE_WITH_HALF(src_dtype, [&]() {
             switch (op_code) {
                 case UnaryEWOpCode::Sqrt:
                     assert_dtype_is_float(src_dtype);
-                    cpu_launcher::LaunchUnaryEWKernel(
-                            indexer, CPUSqrtElementKernel<scalar_t>);
+                    LaunchUnaryEWCPUKernel<scalar_t, scalar_t>(
+                            src, dst, DtypePolicy::ALL_SAME,
+                            CPUSqrtElementKernel<scalar_t>());
                     break;
                 case UnaryEWOpCode::Sin:
                     assert_dtype_is_float(src_dtype);
-                    cpu_launcher::LaunchUnaryEWKernel(
-                            indexer, CPUSinElementKernel<scalar_t>);
+                    LaunchUnaryEWCPUKernel<scalar_t, scalar_t>(
+                            src, dst, DtypePolicy::ALL_SAME,
+                            CPUSinElementKernel<scalar_t>());
                     break;
                 case UnaryEWOpCode::Cos:
                     assert_dtype_is_float(src_dtype);
-                    cpu_launcher::LaunchUnaryEWKernel(
-                            indexer, CPUCosElementKernel<scalar_t>);
+                    LaunchUnaryEWCPUKernel<scalar_t, scalar_t>(
+                            src, dst, DtypePolicy::ALL_SAME,
+                            CPUCosElementKernel<scalar_t>());
                     break;
                 case UnaryEWOpCode::Neg:
-                    cpu_launcher::LaunchUnaryEWKernel(
-                            indexer, CPUNegElementKernel<scalar_t>);
+                    LaunchUnaryEWCPUKernel<scalar_t, scalar_t>(
+                            src, dst, DtypePolicy::ALL_SAME,
+                            CPUNegElementKernel<scalar_t>());
                     break;
                 case UnaryEWOpCode::Exp:
                     assert_dtype_is_float(src_dtype);
-                    cpu_launcher::LaunchUnaryEWKernel(
-                            indexer, CPUExpElementKernel<scalar_t>);
+                    LaunchUnaryEWCPUKernel<scalar_t, scalar_t>(
+                            src, dst, DtypePolicy::ALL_SAME,
+                            CPUExpElementKernel<scalar_t>());
                     break;
                 case UnaryEWOpCode::Abs:
-                    cpu_launcher::LaunchUnaryEWKernel(
-                            indexer, CPUAbsElementKernel<scalar_t>);
+                    LaunchUnaryEWCPUKernel<scalar_t, scalar_t>(
+                            src, dst, DtypePolicy::ALL_SAME,
+                            CPUAbsElementKernel<scalar_t>());
                     break;
                 case UnaryEWOpCode::Floor:
-                    cpu_launcher::LaunchUnaryEWKernel(
-                            indexer, CPUFloorElementKernel<scalar_t>);
+                    LaunchUnaryEWCPUKernel<scalar_t, scalar_t>(
+                            src, dst, DtypePolicy::ALL_SAME,
+                            CPUFloorElementKernel<scalar_t>());
                     break;
                 case UnaryEWOpCode::Ceil:
-                    cpu_launcher::LaunchUnaryEWKernel(
-                            indexer, CPUCeilElementKernel<scalar_t>);
+                    LaunchUnaryEWCPUKernel<scalar_t, scalar_t>(
+                            src, dst, DtypePolicy::ALL_SAME,
+                            CPUCeilElementKernel<scalar_t>());
                     break;
                 case UnaryEWOpCode::Round:
-                    cpu_launcher::LaunchUnaryEWKernel(
-                            indexer, CPURoundElementKernel<scalar_t>);
+                    LaunchUnaryEWCPUKernel<scalar_t, scalar_t>(
+                            src, dst, DtypePolicy::ALL_SAME,
+                            CPURoundElementKernel<scalar_t>());
                     break;
                 case UnaryEWOpCode::Trunc:
-                    cpu_launcher::LaunchUnaryEWKernel(
-                            indexer, CPUTruncElementKernel<scalar_t>);
+                    LaunchUnaryEWCPUKernel<scalar_t, scalar_t>(
+                            src, dst, DtypePolicy::ALL_SAME,
+                            CPUTruncElementKernel<scalar_t>());
                     break;
                 default:
                     utility::LogError("Unimplemented op_code for UnaryEWCPU");
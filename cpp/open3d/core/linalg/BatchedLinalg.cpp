@@ -0,0 +1,161 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/linalg/BatchedLinalg.h"
+
+#include <string>
+
+#include "open3d/core/Profiler.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+
+/// Checks that A is a batch of non-empty square Float32 or Float64 matrices.
+static void AssertBatchedSquare(const Tensor& A, const std::string& op_name) {
+    Dtype dtype = A.GetDtype();
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError(
+                "{}: only tensors with Float32 or Float64 are supported, but "
+                "received {}.",
+                op_name, dtype.ToString());
+    }
+    SizeVector A_shape = A.GetShape();
+    if (A_shape.size() != 3) {
+        utility::LogError(
+                "{}: tensor A must be 3D {{batch, n, n}}, but got {}.",
+                op_name, A_shape);
+    }
+    if (A_shape[1] != A_shape[2]) {
+        utility::LogError("{}: matrices must be square, but got {} x {}.",
+                          op_name, A_shape[1], A_shape[2]);
+    }
+    if (A_shape[1] == 0) {
+        utility::LogError("{}: matrices must not be empty.", op_name);
+    }
+}
+
+void BatchedSolve(const Tensor& A, const Tensor& B, Tensor& X) {
+    OPEN3D_PROFILE_SCOPE("BatchedSolve", A.GetDevice());
+
+    AssertBatchedSquare(A, "BatchedSolve");
+    Device device = A.GetDevice();
+    if (device != B.GetDevice()) {
+        utility::LogError("Tensor A device {} and Tensor B device {} mismatch.",
+                          A.GetDevice().ToString(), B.GetDevice().ToString());
+    }
+    if (A.GetDtype() != B.GetDtype()) {
+        utility::LogError("Tensor A dtype {} and Tensor B dtype {} mismatch.",
+                          A.GetDtype().ToString(), B.GetDtype().ToString());
+    }
+
+    SizeVector A_shape = A.GetShape();
+    SizeVector B_shape = B.GetShape();
+    if (B_shape.size() != 2 && B_shape.size() != 3) {
+        utility::LogError(
+                "Tensor B must be 2D {{batch, n}} or 3D {{batch, n, k}}, but "
+                "got {}.",
+                B_shape);
+    }
+    if (B_shape[0] != A_shape[0] || B_shape[1] != A_shape[1]) {
+        utility::LogError("Tensor A {} and B {} shapes mismatch.", A_shape,
+                          B_shape);
+    }
+
+    const int64_t batch = A_shape[0];
+    const int64_t n = A_shape[1];
+    const int64_t k = B_shape.size() == 3 ? B_shape[2] : 1;
+    if (k == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+
+    // X is solved in-place.
+    X = B.Clone();
+    if (batch == 0) {
+        return;
+    }
+    Tensor A_contiguous = A.Contiguous();
+    Tensor X_view = X.View({batch, n, k});
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        BatchedSolveCUDA(A_contiguous, X_view);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        BatchedSolveCPU(A_contiguous, X_view);
+    }
+}
+
+void BatchedInverse(const Tensor& A, Tensor& output) {
+    OPEN3D_PROFILE_SCOPE("BatchedInverse", A.GetDevice());
+
+    AssertBatchedSquare(A, "BatchedInverse");
+    Device device = A.GetDevice();
+    output = Tensor::Empty(A.GetShape(), A.GetDtype(), device);
+    if (A.GetShape()[0] == 0) {
+        return;
+    }
+    Tensor A_contiguous = A.Contiguous();
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        BatchedInverseCUDA(A_contiguous, output);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        BatchedInverseCPU(A_contiguous, output);
+    }
+}
+
+void BatchedSVD(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT) {
+    OPEN3D_PROFILE_SCOPE("BatchedSVD", A.GetDevice());
+
+    AssertBatchedSquare(A, "BatchedSVD");
+    Device device = A.GetDevice();
+    const int64_t batch = A.GetShape()[0];
+    const int64_t n = A.GetShape()[1];
+    U = Tensor::Empty({batch, n, n}, A.GetDtype(), device);
+    S = Tensor::Empty({batch, n}, A.GetDtype(), device);
+    VT = Tensor::Empty({batch, n, n}, A.GetDtype(), device);
+    if (batch == 0) {
+        return;
+    }
+    Tensor A_contiguous = A.Contiguous();
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        BatchedSVDCUDA(A_contiguous, U, S, VT);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        BatchedSVDCPU(A_contiguous, U, S, VT);
+    }
+}
+
+}  // namespace core
+}  // namespace open3d
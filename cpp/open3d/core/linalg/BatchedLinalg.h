@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+/// Solves A_i X_i = B_i for a batch of square matrices with LU decomposition.
+///
+/// Matrices of size 3x3, 4x4 and 6x6 use unrolled fixed-size kernels with one
+/// thread per matrix. Other sizes fall back to per-matrix LAPACK calls on CPU
+/// and to batched cuBLAS on CUDA.
+///
+/// \param A Tensor of shape {batch, n, n}.
+/// \param B Tensor of shape {batch, n} or {batch, n, k}.
+/// \param X Output tensor of the same shape as B.
+void BatchedSolve(const Tensor& A, const Tensor& B, Tensor& X);
+
+/// Inverts a batch of square matrices.
+///
+/// \param A Tensor of shape {batch, n, n}.
+/// \param output Output tensor of shape {batch, n, n}.
+void BatchedInverse(const Tensor& A, Tensor& output);
+
+/// Computes the SVD A_i = U_i S_i VT_i of a batch of square matrices.
+///
+/// Matrices of size 3x3, 4x4 and 6x6 use unrolled fixed-size Jacobi kernels.
+/// Other sizes fall back to per-matrix LAPACK calls on CPU and to batched
+/// Jacobi SVD of cuSOLVER on CUDA.
+///
+/// \param A Tensor of shape {batch, n, n}.
+/// \param U Output tensor of shape {batch, n, n}.
+/// \param S Output tensor of shape {batch, n}, in descending order.
+/// \param VT Output tensor of shape {batch, n, n}.
+void BatchedSVD(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+
+/// Solves in-place with contiguous A {batch, n, n} and X {batch, n, k}, where
+/// X contains B on input.
+void BatchedSolveCPU(const Tensor& A, Tensor& X);
+
+void BatchedInverseCPU(const Tensor& A, Tensor& output);
+
+void BatchedSVDCPU(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+
+#ifdef BUILD_CUDA_MODULE
+void BatchedSolveCUDA(const Tensor& A, Tensor& X);
+
+void BatchedInverseCUDA(const Tensor& A, Tensor& output);
+
+void BatchedSVDCUDA(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT);
+#endif
+
+}  // namespace core
+}  // namespace open3d
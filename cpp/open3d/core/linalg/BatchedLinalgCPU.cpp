@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <atomic>
+
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
+#include "open3d/core/linalg/Inverse.h"
+#include "open3d/core/linalg/LinalgUtils.h"
+#include "open3d/core/linalg/SVD.h"
+#include "open3d/core/linalg/Solve.h"
+#include "open3d/core/linalg/kernel/SmallMatrix.h"
+
+namespace open3d {
+namespace core {
+
+template <typename scalar_t, int N>
+static bool BatchedSolveFixedSizeCPU(const Tensor& A, Tensor& X) {
+    const scalar_t* A_ptr = static_cast<const scalar_t*>(A.GetDataPtr());
+    scalar_t* X_ptr = static_cast<scalar_t*>(X.GetDataPtr());
+    const int64_t k = X.GetShape()[2];
+    std::atomic<bool> success(true);
+    kernel::cpu_launcher::ParallelFor(A.GetShape()[0], [&](int64_t b) {
+        if (!linalg::kernel::solve_NxN<scalar_t, N>(A_ptr + b * N * N,
+                                                    X_ptr + b * N * k, k)) {
+            success = false;
+        }
+    });
+    return success;
+}
+
+template <typename scalar_t, int N>
+static bool BatchedInverseFixedSizeCPU(const Tensor& A, Tensor& output) {
+    const scalar_t* A_ptr = static_cast<const scalar_t*>(A.GetDataPtr());
+    scalar_t* output_ptr = static_cast<scalar_t*>(output.GetDataPtr());
+    std::atomic<bool> success(true);
+    kernel::cpu_launcher::ParallelFor(A.GetShape()[0], [&](int64_t b) {
+        if (!linalg::kernel::inverse_NxN<scalar_t, N>(
+                    A_ptr + b * N * N, output_ptr + b * N * N)) {
+            success = false;
+        }
+    });
+    return success;
+}
+
+template <typename scalar_t, int N>
+static void BatchedSVDFixedSizeCPU(const Tensor& A,
+                                   Tensor& U,
+                                   Tensor& S,
+                                   Tensor& VT) {
+    const scalar_t* A_ptr = static_cast<const scalar_t*>(A.GetDataPtr());
+    scalar_t* U_ptr = static_cast<scalar_t*>(U.GetDataPtr());
+    scalar_t* S_ptr = static_cast<scalar_t*>(S.GetDataPtr());
+    scalar_t* VT_ptr = static_cast<scalar_t*>(VT.GetDataPtr());
+    kernel::cpu_launcher::ParallelFor(A.GetShape()[0], [&](int64_t b) {
+        linalg::kernel::svd_NxN<scalar_t, N>(A_ptr + b * N * N,
+                                             U_ptr + b * N * N, S_ptr + b * N,
+                                             VT_ptr + b * N * N);
+    });
+}
+
+void BatchedSolveCPU(const Tensor& A, Tensor& X) {
+    const int64_t batch = A.GetShape()[0];
+    const int64_t n = A.GetShape()[1];
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        bool success;
+        if (n == 3) {
+            success = BatchedSolveFixedSizeCPU<scalar_t, 3>(A, X);
+        } else if (n == 4) {
+            success = BatchedSolveFixedSizeCPU<scalar_t, 4>(A, X);
+        } else if (n == 6) {
+            success = BatchedSolveFixedSizeCPU<scalar_t, 6>(A, X);
+        } else {
+            // Large matrices are dominated by the factorization, not by the
+            // per-call overhead.
+            for (int64_t b = 0; b < batch; ++b) {
+                Tensor X_b;
+                Solve(A[b], X[b], X_b);
+                X[b] = X_b;
+            }
+            success = true;
+        }
+        if (!success) {
+            utility::LogError(
+                    "BatchedSolveCPU: singular condition detected.");
+        }
+    });
+}
+
+void BatchedInverseCPU(const Tensor& A, Tensor& output) {
+    const int64_t batch = A.GetShape()[0];
+    const int64_t n = A.GetShape()[1];
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        bool success;
+        if (n == 3) {
+            success = BatchedInverseFixedSizeCPU<scalar_t, 3>(A, output);
+        } else if (n == 4) {
+            success = BatchedInverseFixedSizeCPU<scalar_t, 4>(A, output);
+        } else if (n == 6) {
+            success = BatchedInverseFixedSizeCPU<scalar_t, 6>(A, output);
+        } else {
+            for (int64_t b = 0; b < batch; ++b) {
+                Tensor output_b;
+                Inverse(A[b], output_b);
+                output[b] = output_b;
+            }
+            success = true;
+        }
+        if (!success) {
+            utility::LogError(
+                    "BatchedInverseCPU: singular condition detected.");
+        }
+    });
+}
+
+void BatchedSVDCPU(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT) {
+    const int64_t batch = A.GetShape()[0];
+    const int64_t n = A.GetShape()[1];
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        if (n == 3) {
+            BatchedSVDFixedSizeCPU<scalar_t, 3>(A, U, S, VT);
+        } else if (n == 4) {
+            BatchedSVDFixedSizeCPU<scalar_t, 4>(A, U, S, VT);
+        } else if (n == 6) {
+            BatchedSVDFixedSizeCPU<scalar_t, 6>(A, U, S, VT);
+        } else {
+            for (int64_t b = 0; b < batch; ++b) {
+                Tensor U_b, S_b, VT_b;
+                SVD(A[b], U_b, S_b, VT_b);
+                U[b] = U_b;
+                S[b] = S_b;
+                VT[b] = VT_b;
+            }
+        }
+    });
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,426 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <vector>
+
+#include "open3d/core/CUDAState.cuh"
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/core/linalg/BatchedLinalg.h"
+#include "open3d/core/linalg/LinalgUtils.h"
+#include "open3d/core/linalg/SVD.h"
+#include "open3d/core/linalg/kernel/SmallMatrix.h"
+
+namespace open3d {
+namespace core {
+
+// cuBLAS and cuSOLVER batched routines for matrix sizes without fixed-size
+// kernels.
+static cublasStatus_t GetrfBatched(cublasHandle_t handle,
+                                   int n,
+                                   float* const A_array[],
+                                   int lda,
+                                   int* ipiv,
+                                   int* info,
+                                   int batch) {
+    return cublasSgetrfBatched(handle, n, A_array, lda, ipiv, info, batch);
+}
+
+static cublasStatus_t GetrfBatched(cublasHandle_t handle,
+                                   int n,
+                                   double* const A_array[],
+                                   int lda,
+                                   int* ipiv,
+                                   int* info,
+                                   int batch) {
+    return cublasDgetrfBatched(handle, n, A_array, lda, ipiv, info, batch);
+}
+
+static cublasStatus_t GetrsBatched(cublasHandle_t handle,
+                                   cublasOperation_t trans,
+                                   int n,
+                                   int nrhs,
+                                   const float* const A_array[],
+                                   int lda,
+                                   const int* ipiv,
+                                   float* const B_array[],
+                                   int ldb,
+                                   int* info,
+                                   int batch) {
+    return cublasSgetrsBatched(handle, trans, n, nrhs, A_array, lda, ipiv,
+                               B_array, ldb, info, batch);
+}
+
+static cublasStatus_t GetrsBatched(cublasHandle_t handle,
+                                   cublasOperation_t trans,
+                                   int n,
+                                   int nrhs,
+                                   const double* const A_array[],
+                                   int lda,
+                                   const int* ipiv,
+                                   double* const B_array[],
+                                   int ldb,
+                                   int* info,
+                                   int batch) {
+    return cublasDgetrsBatched(handle, trans, n, nrhs, A_array, lda, ipiv,
+                               B_array, ldb, info, batch);
+}
+
+static cublasStatus_t GetriBatched(cublasHandle_t handle,
+                                   int n,
+                                   const float* const A_array[],
+                                   int lda,
+                                   const int* ipiv,
+                                   float* const C_array[],
+                                   int ldc,
+                                   int* info,
+                                   int batch) {
+    return cublasSgetriBatched(handle, n, A_array, lda, ipiv, C_array, ldc,
+                               info, batch);
+}
+
+static cublasStatus_t GetriBatched(cublasHandle_t handle,
+                                   int n,
+                                   const double* const A_array[],
+                                   int lda,
+                                   const int* ipiv,
+                                   double* const C_array[],
+                                   int ldc,
+                                   int* info,
+                                   int batch) {
+    return cublasDgetriBatched(handle, n, A_array, lda, ipiv, C_array, ldc,
+                               info, batch);
+}
+
+static cusolverStatus_t GesvdjBatchedBufferSize(cusolverDnHandle_t handle,
+                                                int n,
+                                                const float* A,
+                                                const float* S,
+                                                const float* U,
+                                                const float* V,
+                                                int* lwork,
+                                                gesvdjInfo_t params,
+                                                int batch) {
+    return cusolverDnSgesvdjBatched_bufferSize(
+            handle, CUSOLVER_EIG_MODE_VECTOR, n, n, A, n, S, U, n, V, n, lwork,
+            params, batch);
+}
+
+static cusolverStatus_t GesvdjBatchedBufferSize(cusolverDnHandle_t handle,
+                                                int n,
+                                                const double* A,
+                                                const double* S,
+                                                const double* U,
+                                                const double* V,
+                                                int* lwork,
+                                                gesvdjInfo_t params,
+                                                int batch) {
+    return cusolverDnDgesvdjBatched_bufferSize(
+            handle, CUSOLVER_EIG_MODE_VECTOR, n, n, A, n, S, U, n, V, n, lwork,
+            params, batch);
+}
+
+static cusolverStatus_t GesvdjBatched(cusolverDnHandle_t handle,
+                                      int n,
+                                      float* A,
+                                      float* S,
+                                      float* U,
+                                      float* V,
+                                      float* work,
+                                      int lwork,
+                                      int* info,
+                                      gesvdjInfo_t params,
+                                      int batch) {
+    return cusolverDnSgesvdjBatched(handle, CUSOLVER_EIG_MODE_VECTOR, n, n, A,
+                                    n, S, U, n, V, n, work, lwork, info,
+                                    params, batch);
+}
+
+static cusolverStatus_t GesvdjBatched(cusolverDnHandle_t handle,
+                                      int n,
+                                      double* A,
+                                      double* S,
+                                      double* U,
+                                      double* V,
+                                      double* work,
+                                      int lwork,
+                                      int* info,
+                                      gesvdjInfo_t params,
+                                      int batch) {
+    return cusolverDnDgesvdjBatched(handle, CUSOLVER_EIG_MODE_VECTOR, n, n, A,
+                                    n, S, U, n, V, n, work, lwork, info,
+                                    params, batch);
+}
+
+/// Returns a device array with the address of each matrix of the contiguous
+/// batched tensor \p t.
+template <typename scalar_t>
+static Tensor GetMatrixPointers(const Tensor& t) {
+    const int64_t batch = t.GetShape()[0];
+    const int64_t stride = t.GetStrides()[0];
+    scalar_t* base_ptr =
+            const_cast<scalar_t*>(static_cast<const scalar_t*>(t.GetDataPtr()));
+    std::vector<int64_t> pointers(batch);
+    for (int64_t b = 0; b < batch; ++b) {
+        pointers[b] = reinterpret_cast<int64_t>(base_ptr + b * stride);
+    }
+    return Tensor(pointers, {batch}, Dtype::Int64, t.GetDevice());
+}
+
+template <typename scalar_t>
+static scalar_t** GetPointerArray(Tensor& pointers) {
+    return static_cast<scalar_t**>(pointers.GetDataPtr());
+}
+
+/// Throws if any of the per-matrix cuBLAS/cuSOLVER info values is non-zero.
+static void AssertBatchedInfo(const Tensor& info, const std::string& msg) {
+    std::vector<int> info_host = info.ToFlatVector<int>();
+    for (int value : info_host) {
+        if (value < 0) {
+            utility::LogError("{}: {}-th parameter is invalid.", msg, -value);
+        } else if (value > 0) {
+            utility::LogError("{}: singular condition detected.", msg);
+        }
+    }
+}
+
+template <typename scalar_t, int N>
+static bool BatchedSolveFixedSizeCUDA(const Tensor& A, Tensor& X) {
+    const scalar_t* A_ptr = static_cast<const scalar_t*>(A.GetDataPtr());
+    scalar_t* X_ptr = static_cast<scalar_t*>(X.GetDataPtr());
+    const int64_t k = X.GetShape()[2];
+    Tensor success = Tensor::Ones({}, Dtype::Int32, A.GetDevice());
+    int* success_ptr = static_cast<int*>(success.GetDataPtr());
+    kernel::cuda_launcher::ParallelFor(
+            A.GetShape()[0], [=] OPEN3D_DEVICE(int64_t b) {
+                if (!linalg::kernel::solve_NxN<scalar_t, N>(
+                            A_ptr + b * N * N, X_ptr + b * N * k, k)) {
+                    *success_ptr = 0;
+                }
+            });
+    return success.Item<int>() == 1;
+}
+
+template <typename scalar_t, int N>
+static bool BatchedInverseFixedSizeCUDA(const Tensor& A, Tensor& output) {
+    const scalar_t* A_ptr = static_cast<const scalar_t*>(A.GetDataPtr());
+    scalar_t* output_ptr = static_cast<scalar_t*>(output.GetDataPtr());
+    Tensor success = Tensor::Ones({}, Dtype::Int32, A.GetDevice());
+    int* success_ptr = static_cast<int*>(success.GetDataPtr());
+    kernel::cuda_launcher::ParallelFor(
+            A.GetShape()[0], [=] OPEN3D_DEVICE(int64_t b) {
+                if (!linalg::kernel::inverse_NxN<scalar_t, N>(
+                            A_ptr + b * N * N, output_ptr + b * N * N)) {
+                    *success_ptr = 0;
+                }
+            });
+    return success.Item<int>() == 1;
+}
+
+template <typename scalar_t, int N>
+static void BatchedSVDFixedSizeCUDA(const Tensor& A,
+                                    Tensor& U,
+                                    Tensor& S,
+                                    Tensor& VT) {
+    const scalar_t* A_ptr = static_cast<const scalar_t*>(A.GetDataPtr());
+    scalar_t* U_ptr = static_cast<scalar_t*>(U.GetDataPtr());
+    scalar_t* S_ptr = static_cast<scalar_t*>(S.GetDataPtr());
+    scalar_t* VT_ptr = static_cast<scalar_t*>(VT.GetDataPtr());
+    kernel::cuda_launcher::ParallelFor(
+            A.GetShape()[0], [=] OPEN3D_DEVICE(int64_t b) {
+                linalg::kernel::svd_NxN<scalar_t, N>(
+                        A_ptr + b * N * N, U_ptr + b * N * N, S_ptr + b * N,
+                        VT_ptr + b * N * N);
+            });
+}
+
+void BatchedSolveCUDA(const Tensor& A, Tensor& X) {
+    Device device = A.GetDevice();
+    CUDADeviceSwitcher switcher(device);
+    const int64_t batch = A.GetShape()[0];
+    const int64_t n = A.GetShape()[1];
+    const int64_t k = X.GetShape()[2];
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        bool success = true;
+        if (n == 3) {
+            success = BatchedSolveFixedSizeCUDA<scalar_t, 3>(A, X);
+        } else if (n == 4) {
+            success = BatchedSolveFixedSizeCUDA<scalar_t, 4>(A, X);
+        } else if (n == 6) {
+            success = BatchedSolveFixedSizeCUDA<scalar_t, 6>(A, X);
+        } else {
+            cublasHandle_t handle = CuBLASContext::GetInstance()->GetHandle();
+
+            // Row-major A is column-major A^T, which is factorized in-place
+            // and solved transposed. B is converted to column-major.
+            Tensor A_factor = A.Clone();
+            Tensor X_col_major = X.Transpose(1, 2).Contiguous();
+            Tensor ipiv = Tensor::Empty({batch, n}, Dtype::Int32, device);
+            Tensor info = Tensor::Zeros({batch}, Dtype::Int32, device);
+            Tensor A_pointers = GetMatrixPointers<scalar_t>(A_factor);
+            Tensor X_pointers = GetMatrixPointers<scalar_t>(X_col_major);
+
+            OPEN3D_CUBLAS_CHECK(
+                    GetrfBatched(handle, n,
+                                 GetPointerArray<scalar_t>(A_pointers), n,
+                                 static_cast<int*>(ipiv.GetDataPtr()),
+                                 static_cast<int*>(info.GetDataPtr()), batch),
+                    "getrfBatched failed in BatchedSolveCUDA");
+            AssertBatchedInfo(info, "getrfBatched failed in BatchedSolveCUDA");
+
+            int getrs_info = 0;
+            OPEN3D_CUBLAS_CHECK(
+                    GetrsBatched(handle, CUBLAS_OP_T, n, k,
+                                 GetPointerArray<scalar_t>(A_pointers), n,
+                                 static_cast<int*>(ipiv.GetDataPtr()),
+                                 GetPointerArray<scalar_t>(X_pointers), n,
+                                 &getrs_info, batch),
+                    "getrsBatched failed in BatchedSolveCUDA");
+            if (getrs_info != 0) {
+                utility::LogError(
+                        "getrsBatched failed in BatchedSolveCUDA: {}-th "
+                        "parameter is invalid.",
+                        -getrs_info);
+            }
+            X.AsRvalue() = X_col_major.Transpose(1, 2);
+        }
+        if (!success) {
+            utility::LogError(
+                    "BatchedSolveCUDA: singular condition detected.");
+        }
+    });
+}
+
+void BatchedInverseCUDA(const Tensor& A, Tensor& output) {
+    Device device = A.GetDevice();
+    CUDADeviceSwitcher switcher(device);
+    const int64_t batch = A.GetShape()[0];
+    const int64_t n = A.GetShape()[1];
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        bool success = true;
+        if (n == 3) {
+            success = BatchedInverseFixedSizeCUDA<scalar_t, 3>(A, output);
+        } else if (n == 4) {
+            success = BatchedInverseFixedSizeCUDA<scalar_t, 4>(A, output);
+        } else if (n == 6) {
+            success = BatchedInverseFixedSizeCUDA<scalar_t, 6>(A, output);
+        } else {
+            cublasHandle_t handle = CuBLASContext::GetInstance()->GetHandle();
+
+            // inv(A^T) = inv(A)^T, so the row-major layout needs no
+            // transposes.
+            Tensor A_factor = A.Clone();
+            Tensor ipiv = Tensor::Empty({batch, n}, Dtype::Int32, device);
+            Tensor info = Tensor::Zeros({batch}, Dtype::Int32, device);
+            Tensor A_pointers = GetMatrixPointers<scalar_t>(A_factor);
+            Tensor output_pointers = GetMatrixPointers<scalar_t>(output);
+
+            OPEN3D_CUBLAS_CHECK(
+                    GetrfBatched(handle, n,
+                                 GetPointerArray<scalar_t>(A_pointers), n,
+                                 static_cast<int*>(ipiv.GetDataPtr()),
+                                 static_cast<int*>(info.GetDataPtr()), batch),
+                    "getrfBatched failed in BatchedInverseCUDA");
+            AssertBatchedInfo(info,
+                              "getrfBatched failed in BatchedInverseCUDA");
+
+            OPEN3D_CUBLAS_CHECK(
+                    GetriBatched(handle, n,
+                                 GetPointerArray<scalar_t>(A_pointers), n,
+                                 static_cast<int*>(ipiv.GetDataPtr()),
+                                 GetPointerArray<scalar_t>(output_pointers), n,
+                                 static_cast<int*>(info.GetDataPtr()), batch),
+                    "getriBatched failed in BatchedInverseCUDA");
+            AssertBatchedInfo(info,
+                              "getriBatched failed in BatchedInverseCUDA");
+        }
+        if (!success) {
+            utility::LogError(
+                    "BatchedInverseCUDA: singular condition detected.");
+        }
+    });
+}
+
+void BatchedSVDCUDA(const Tensor& A, Tensor& U, Tensor& S, Tensor& VT) {
+    Device device = A.GetDevice();
+    CUDADeviceSwitcher switcher(device);
+    const int64_t batch = A.GetShape()[0];
+    const int64_t n = A.GetShape()[1];
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(A.GetDtype(), [&]() {
+        if (n == 3) {
+            BatchedSVDFixedSizeCUDA<scalar_t, 3>(A, U, S, VT);
+        } else if (n == 4) {
+            BatchedSVDFixedSizeCUDA<scalar_t, 4>(A, U, S, VT);
+        } else if (n == 6) {
+            BatchedSVDFixedSizeCUDA<scalar_t, 6>(A, U, S, VT);
+        } else if (n <= 32) {
+            // gesvdjBatched supports matrices up to 32 x 32. It decomposes
+            // the column-major A^T = V S U^T, hence its U is our VT in
+            // row-major, and its V is our U in column-major.
+            cusolverDnHandle_t handle =
+                    CuSolverContext::GetInstance()->GetHandle();
+            gesvdjInfo_t params;
+            OPEN3D_CUSOLVER_CHECK(cusolverDnCreateGesvdjInfo(&params),
+                                  "cusolverDnCreateGesvdjInfo failed");
+
+            Tensor A_work = A.Clone();
+            Tensor U_col_major = Tensor::Empty({batch, n, n}, A.GetDtype(),
+                                               device);
+            Tensor info = Tensor::Zeros({batch}, Dtype::Int32, device);
+            scalar_t* A_ptr = static_cast<scalar_t*>(A_work.GetDataPtr());
+            scalar_t* S_ptr = static_cast<scalar_t*>(S.GetDataPtr());
+            scalar_t* VT_ptr = static_cast<scalar_t*>(VT.GetDataPtr());
+            scalar_t* U_ptr = static_cast<scalar_t*>(U_col_major.GetDataPtr());
+
+            int lwork = 0;
+            OPEN3D_CUSOLVER_CHECK(
+                    GesvdjBatchedBufferSize(handle, n, A_ptr, S_ptr, VT_ptr,
+                                            U_ptr, &lwork, params, batch),
+                    "gesvdjBatched_bufferSize failed in BatchedSVDCUDA");
+            Tensor work = Tensor::Empty({lwork}, A.GetDtype(), device);
+            OPEN3D_CUSOLVER_CHECK(
+                    GesvdjBatched(handle, n, A_ptr, S_ptr, VT_ptr, U_ptr,
+                                  static_cast<scalar_t*>(work.GetDataPtr()),
+                                  lwork, static_cast<int*>(info.GetDataPtr()),
+                                  params, batch),
+                    "gesvdjBatched failed in BatchedSVDCUDA");
+            cusolverDnDestroyGesvdjInfo(params);
+            AssertBatchedInfo(info, "gesvdjBatched failed in BatchedSVDCUDA");
+
+            U.AsRvalue() = U_col_major.Transpose(1, 2);
+        } else {
+            for (int64_t b = 0; b < batch; ++b) {
+                Tensor U_b, S_b, VT_b;
+                SVD(A[b], U_b, S_b, VT_b);
+                U[b] = U_b;
+                S[b] = S_b;
+                VT[b] = VT_b;
+            }
+        }
+    });
+}
+
+}  // namespace core
+}  // namespace open3d
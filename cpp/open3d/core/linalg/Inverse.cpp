@@ -28,12 +28,15 @@
 
 #include <unordered_map>
 
+#include "open3d/core/Profiler.h"
 #include "open3d/core/linalg/LinalgHeadersCPU.h"
 
 namespace open3d {
 namespace core {
 
 void Inverse(const Tensor &A, Tensor &output) {
+    OPEN3D_PROFILE_SCOPE("Inverse", A.GetDevice());
+
     // Check devices
     Device device = A.GetDevice();
 
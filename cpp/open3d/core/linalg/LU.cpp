@@ -26,6 +26,7 @@
 
 #include "open3d/core/linalg/LU.h"
 
+#include "open3d/core/Profiler.h"
 #include "open3d/core/linalg/LUImpl.h"
 #include "open3d/core/linalg/LinalgHeadersCPU.h"
 #include "open3d/core/linalg/Tri.h"
@@ -79,6 +80,8 @@ static void OutputToPLU(const Tensor& output,
 }
 
 void LUIpiv(const Tensor& A, Tensor& ipiv, Tensor& output) {
+    OPEN3D_PROFILE_SCOPE("LUIpiv", A.GetDevice());
+
     Device device = A.GetDevice();
     // Check dtypes.
     Dtype dtype = A.GetDtype();
@@ -28,10 +28,14 @@
 
 #include <unordered_map>
 
+#include "open3d/core/Profiler.h"
+
 namespace open3d {
 namespace core {
 
 void LeastSquares(const Tensor &A, const Tensor &B, Tensor &X) {
+    OPEN3D_PROFILE_SCOPE("LeastSquares", A.GetDevice());
+
     // Check devices
     Device device = A.GetDevice();
     if (device != B.GetDevice()) {
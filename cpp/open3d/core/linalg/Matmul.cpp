@@ -28,10 +28,114 @@
 
 #include <unordered_map>
 
+#include "open3d/core/Profiler.h"
+#include "open3d/core/ShapeUtil.h"
+
 namespace open3d {
 namespace core {
 
+/// Returns \p X as a contiguous {batch, rows, cols} tensor in \p dtype
+/// broadcasted to \p batch_shape, together with the element stride between
+/// its matrices. Operands without batch dimensions are not broadcasted and get
+/// a stride of 0, so that the same matrix is shared by the whole batch.
+static Tensor PrepareBatchedOperand(const Tensor& X,
+                                    const SizeVector& batch_shape,
+                                    Dtype dtype,
+                                    int64_t& stride) {
+    SizeVector X_shape = X.GetShape();
+    int64_t rows = X_shape[X_shape.size() - 2];
+    int64_t cols = X_shape[X_shape.size() - 1];
+    SizeVector X_batch_shape(X_shape.begin(), X_shape.end() - 2);
+    if (X_batch_shape.NumElements() == 1) {
+        stride = 0;
+        return X.Reshape({rows, cols}).Contiguous().To(dtype);
+    }
+
+    SizeVector dst_shape = batch_shape;
+    dst_shape.push_back(rows);
+    dst_shape.push_back(cols);
+    stride = rows * cols;
+    return X.Broadcast(dst_shape).Contiguous().To(dtype);
+}
+
+/// Matmul of operands with batch dimensions, i.e. (..., m, k) x (..., k, n).
+static void BatchedMatmul(const Tensor& A,
+                          const Tensor& B,
+                          Tensor& output,
+                          Dtype dtype,
+                          Dtype dtype_original) {
+    Device device = A.GetDevice();
+    SizeVector A_shape = A.GetShape();
+    SizeVector B_shape = B.GetShape();
+
+    if (A_shape.size() < 2 || B_shape.size() < 2) {
+        utility::LogError(
+                "Tensor A and B must be at least 2D for batched Matmul, but "
+                "got {}D and {}D.",
+                A_shape.size(), B_shape.size());
+    }
+
+    int64_t m = A_shape[A_shape.size() - 2];
+    int64_t k = A_shape[A_shape.size() - 1];
+    int64_t n = B_shape[B_shape.size() - 1];
+    if (k != B_shape[B_shape.size() - 2]) {
+        utility::LogError("Tensor A columns {} mismatch with Tensor B rows {}.",
+                          k, B_shape[B_shape.size() - 2]);
+    }
+    if (m == 0 || k == 0 || n == 0) {
+        utility::LogError(
+                "Tensor shapes should not contain dimensions with zero.");
+    }
+
+    SizeVector A_batch_shape(A_shape.begin(), A_shape.end() - 2);
+    SizeVector B_batch_shape(B_shape.begin(), B_shape.end() - 2);
+    if (!shape_util::IsCompatibleBroadcastShape(A_batch_shape,
+                                                B_batch_shape)) {
+        utility::LogError(
+                "Tensor A batch shape {} and Tensor B batch shape {} are not "
+                "broadcastable.",
+                A_batch_shape, B_batch_shape);
+    }
+    SizeVector batch_shape =
+            shape_util::BroadcastedShape(A_batch_shape, B_batch_shape);
+    int64_t batch_size = batch_shape.NumElements();
+
+    SizeVector output_shape = batch_shape;
+    output_shape.push_back(m);
+    output_shape.push_back(n);
+    output = Tensor::Empty(output_shape, dtype, device);
+    if (batch_size == 0) {
+        output = output.To(dtype_original);
+        return;
+    }
+
+    int64_t stride_A = 0, stride_B = 0;
+    Tensor A_batched =
+            PrepareBatchedOperand(A, batch_shape, dtype, stride_A);
+    Tensor B_batched =
+            PrepareBatchedOperand(B, batch_shape, dtype, stride_B);
+    void* A_data = A_batched.GetDataPtr();
+    void* B_data = B_batched.GetDataPtr();
+    void* C_data = output.GetDataPtr();
+
+    if (device.GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        MatmulBatchedCUDA(A_data, B_data, C_data, m, k, n, batch_size,
+                          stride_A, stride_B, dtype);
+#else
+        utility::LogError("Unimplemented device.");
+#endif
+    } else {
+        MatmulBatchedCPU(A_data, B_data, C_data, m, k, n, batch_size,
+                         stride_A, stride_B, dtype);
+    }
+
+    output = output.To(dtype_original);
+}
+
 void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
+    OPEN3D_PROFILE_SCOPE("Matmul", A.GetDevice());
+
     // Check devices
     Device device = A.GetDevice();
     if (device != B.GetDevice()) {
@@ -56,6 +160,11 @@ void Matmul(const Tensor& A, const Tensor& B, Tensor& output) {
     SizeVector A_shape = A.GetShape();
     SizeVector B_shape = B.GetShape();
 
+    if (A_shape.size() > 2 || B_shape.size() > 2) {
+        BatchedMatmul(A, B, output, dtype, dtype_original);
+        return;
+    }
+
     if (A_shape.size() != 2) {
         utility::LogError("Tensor A must be 2D, but got {}D.", A_shape.size());
     }
@@ -32,6 +32,11 @@ namespace open3d {
 namespace core {
 
 /// Computes matrix multiplication C = AB.
+///
+/// A and B are 2D matrices, or B is a 1D vector. If either operand has more
+/// than 2 dimensions, the last two dimensions are multiplied as matrices and
+/// the leading batch dimensions are broadcasted, i.e.
+/// (..., m, k) x (..., k, n) -> (..., m, n).
 void Matmul(const Tensor& A, const Tensor& B, Tensor& C);
 
 #ifdef BUILD_CUDA_MODULE
@@ -42,6 +47,19 @@ void MatmulCUDA(void* A_data,
                 int64_t k,
                 int64_t n,
                 Dtype dtype);
+
+/// Batched row-major C_i = A_i B_i, where matrix i of A starts at element
+/// i * stride_A, and likewise for B. C is contiguous.
+void MatmulBatchedCUDA(void* A_data,
+                       void* B_data,
+                       void* C_data,
+                       int64_t m,
+                       int64_t k,
+                       int64_t n,
+                       int64_t batch_size,
+                       int64_t stride_A,
+                       int64_t stride_B,
+                       Dtype dtype);
 #endif
 void MatmulCPU(void* A_data,
                void* B_data,
@@ -50,5 +68,16 @@ void MatmulCPU(void* A_data,
                int64_t k,
                int64_t n,
                Dtype dtype);
+
+void MatmulBatchedCPU(void* A_data,
+                      void* B_data,
+                      void* C_data,
+                      int64_t m,
+                      int64_t k,
+                      int64_t n,
+                      int64_t batch_size,
+                      int64_t stride_A,
+                      int64_t stride_B,
+                      Dtype dtype);
 }  // namespace core
 }  // namespace open3d
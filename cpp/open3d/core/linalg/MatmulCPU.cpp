@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/core/kernel/CPULauncher.h"
 #include "open3d/core/linalg/BlasWrapper.h"
 #include "open3d/core/linalg/LinalgUtils.h"
 #include "open3d/core/linalg/Matmul.h"
@@ -46,5 +47,38 @@ void MatmulCPU(void* A_data,
     });
 }
 
+void MatmulBatchedCPU(void* A_data,
+                      void* B_data,
+                      void* C_data,
+                      int64_t m,
+                      int64_t k,
+                      int64_t n,
+                      int64_t batch_size,
+                      int64_t stride_A,
+                      int64_t stride_B,
+                      Dtype dtype) {
+    // Small matrices are parallelized over the batch, each with a
+    // single-threaded GEMM. Large matrices use the threaded BLAS per GEMM.
+    constexpr int64_t kMaxParallelBatchFlops = 64 * 64 * 64;
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        const scalar_t* A_ptr = static_cast<const scalar_t*>(A_data);
+        const scalar_t* B_ptr = static_cast<const scalar_t*>(B_data);
+        scalar_t* C_ptr = static_cast<scalar_t*>(C_data);
+        auto gemm = [&](int64_t b) {
+            gemm_cpu<scalar_t>(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n,
+                               k, 1, A_ptr + b * stride_A, k,
+                               B_ptr + b * stride_B, n, 0, C_ptr + b * m * n,
+                               n);
+        };
+        if (m * n * k <= kMaxParallelBatchFlops) {
+            kernel::cpu_launcher::ParallelFor(batch_size, gemm);
+        } else {
+            for (int64_t b = 0; b < batch_size; ++b) {
+                gemm(b);
+            }
+        }
+    });
+}
+
 }  // namespace core
 }  // namespace open3d
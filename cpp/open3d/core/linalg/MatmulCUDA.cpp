@@ -52,5 +52,31 @@ void MatmulCUDA(void* A_data,
     });
 }
 
+void MatmulBatchedCUDA(void* A_data,
+                       void* B_data,
+                       void* C_data,
+                       int64_t m,
+                       int64_t k,
+                       int64_t n,
+                       int64_t batch_size,
+                       int64_t stride_A,
+                       int64_t stride_B,
+                       Dtype dtype) {
+    cublasHandle_t handle = CuBLASContext::GetInstance()->GetHandle();
+    DISPATCH_LINALG_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t alpha = 1, beta = 0;
+        // Row-major C = AB is column-major C^T = B^T A^T, so the row-major
+        // buffers are passed directly with A and B swapped.
+        OPEN3D_CUBLAS_CHECK(
+                gemm_strided_batched_cuda<scalar_t>(
+                        handle, CUBLAS_OP_N, CUBLAS_OP_N, n, m, k, &alpha,
+                        static_cast<const scalar_t*>(B_data), n, stride_B,
+                        static_cast<const scalar_t*>(A_data), k, stride_A,
+                        &beta, static_cast<scalar_t*>(C_data), n, m * n,
+                        batch_size),
+                "cuda strided batched gemm failed");
+    });
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -28,10 +28,14 @@
 
 #include <unordered_map>
 
+#include "open3d/core/Profiler.h"
+
 namespace open3d {
 namespace core {
 
 void SVD(const Tensor &A, Tensor &U, Tensor &S, Tensor &VT) {
+    OPEN3D_PROFILE_SCOPE("SVD", A.GetDevice());
+
     // Check devices
     Device device = A.GetDevice();
 
@@ -32,12 +32,15 @@
 
 #include <unordered_map>
 
+#include "open3d/core/Profiler.h"
 #include "open3d/core/linalg/LinalgHeadersCPU.h"
 
 namespace open3d {
 namespace core {
 
 void Solve(const Tensor &A, const Tensor &B, Tensor &X) {
+    OPEN3D_PROFILE_SCOPE("Solve", A.GetDevice());
+
     // Check devices
     Device device = A.GetDevice();
     if (device != B.GetDevice()) {
@@ -0,0 +1,299 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+
+namespace open3d {
+namespace core {
+namespace linalg {
+namespace kernel {
+
+// Fixed-size kernels for small dense row-major N x N matrices. The loop
+// bounds are compile-time constants, so that the compiler fully unrolls them
+// and keeps the matrices in registers. They are shared by the CPU and CUDA
+// batched linear algebra backends.
+
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE void swap_scalar(scalar_t& a,
+                                                        scalar_t& b) {
+    scalar_t tmp = a;
+    a = b;
+    b = tmp;
+}
+
+/// Solves A X = B with Gaussian elimination and partial pivoting.
+///
+/// \param A_NxN Input matrix A, not modified.
+/// \param X_NxK On input the right hand side B, on output the solution X.
+/// \param k Number of right hand sides.
+/// \return False if A is singular.
+template <typename scalar_t, int N>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE bool solve_NxN(const scalar_t* A_NxN,
+                                                      scalar_t* X_NxK,
+                                                      int64_t k) {
+    scalar_t a[N * N];
+    for (int i = 0; i < N * N; ++i) {
+        a[i] = A_NxN[i];
+    }
+
+    for (int col = 0; col < N; ++col) {
+        int pivot = col;
+        scalar_t pivot_abs = fabs(a[col * N + col]);
+        for (int row = col + 1; row < N; ++row) {
+            const scalar_t candidate_abs = fabs(a[row * N + col]);
+            if (candidate_abs > pivot_abs) {
+                pivot = row;
+                pivot_abs = candidate_abs;
+            }
+        }
+        if (pivot_abs == 0) {
+            return false;
+        }
+        if (pivot != col) {
+            for (int j = 0; j < N; ++j) {
+                swap_scalar(a[col * N + j], a[pivot * N + j]);
+            }
+            for (int64_t j = 0; j < k; ++j) {
+                swap_scalar(X_NxK[col * k + j], X_NxK[pivot * k + j]);
+            }
+        }
+
+        const scalar_t inv_pivot = scalar_t(1) / a[col * N + col];
+        for (int row = col + 1; row < N; ++row) {
+            const scalar_t factor = a[row * N + col] * inv_pivot;
+            for (int j = col + 1; j < N; ++j) {
+                a[row * N + j] -= factor * a[col * N + j];
+            }
+            for (int64_t j = 0; j < k; ++j) {
+                X_NxK[row * k + j] -= factor * X_NxK[col * k + j];
+            }
+        }
+    }
+
+    // Back substitution.
+    for (int row = N - 1; row >= 0; --row) {
+        const scalar_t inv_diag = scalar_t(1) / a[row * N + row];
+        for (int64_t j = 0; j < k; ++j) {
+            scalar_t sum = X_NxK[row * k + j];
+            for (int col = row + 1; col < N; ++col) {
+                sum -= a[row * N + col] * X_NxK[col * k + j];
+            }
+            X_NxK[row * k + j] = sum * inv_diag;
+        }
+    }
+    return true;
+}
+
+/// Inverts A with Gauss-Jordan elimination and partial pivoting.
+///
+/// \return False if A is singular.
+template <typename scalar_t, int N>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE bool inverse_NxN(const scalar_t* A_NxN,
+                                                        scalar_t* output_NxN) {
+    scalar_t a[N * N];
+    scalar_t inv[N * N];
+    for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+            a[i * N + j] = A_NxN[i * N + j];
+            inv[i * N + j] = i == j ? scalar_t(1) : scalar_t(0);
+        }
+    }
+
+    for (int col = 0; col < N; ++col) {
+        int pivot = col;
+        scalar_t pivot_abs = fabs(a[col * N + col]);
+        for (int row = col + 1; row < N; ++row) {
+            const scalar_t candidate_abs = fabs(a[row * N + col]);
+            if (candidate_abs > pivot_abs) {
+                pivot = row;
+                pivot_abs = candidate_abs;
+            }
+        }
+        if (pivot_abs == 0) {
+            return false;
+        }
+        if (pivot != col) {
+            for (int j = 0; j < N; ++j) {
+                swap_scalar(a[col * N + j], a[pivot * N + j]);
+                swap_scalar(inv[col * N + j], inv[pivot * N + j]);
+            }
+        }
+
+        const scalar_t inv_pivot = scalar_t(1) / a[col * N + col];
+        for (int j = 0; j < N; ++j) {
+            a[col * N + j] *= inv_pivot;
+            inv[col * N + j] *= inv_pivot;
+        }
+        for (int row = 0; row < N; ++row) {
+            if (row == col) continue;
+            const scalar_t factor = a[row * N + col];
+            for (int j = 0; j < N; ++j) {
+                a[row * N + j] -= factor * a[col * N + j];
+                inv[row * N + j] -= factor * inv[col * N + j];
+            }
+        }
+    }
+
+    for (int i = 0; i < N * N; ++i) {
+        output_NxN[i] = inv[i];
+    }
+    return true;
+}
+
+/// Computes the SVD A = U S VT with one-sided Jacobi rotations. The singular
+/// values are non-negative and sorted in descending order, and U and VT are
+/// orthonormal, matching the convention of LAPACK's gesvd.
+template <typename scalar_t, int N>
+OPEN3D_HOST_DEVICE OPEN3D_FORCE_INLINE void svd_NxN(const scalar_t* A_NxN,
+                                                    scalar_t* U_NxN,
+                                                    scalar_t* S_N,
+                                                    scalar_t* VT_NxN) {
+    const scalar_t eps = sizeof(scalar_t) == 4 ? scalar_t(1e-7)
+                                               : scalar_t(1e-15);
+    constexpr int kMaxSweeps = 32;
+
+    // The columns of u converge to U * S, the columns of v to V.
+    scalar_t u[N * N];
+    scalar_t v[N * N];
+    for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+            u[i * N + j] = A_NxN[i * N + j];
+            v[i * N + j] = i == j ? scalar_t(1) : scalar_t(0);
+        }
+    }
+
+    for (int sweep = 0; sweep < kMaxSweeps; ++sweep) {
+        bool converged = true;
+        for (int p = 0; p < N - 1; ++p) {
+            for (int q = p + 1; q < N; ++q) {
+                scalar_t alpha = 0, beta = 0, gamma = 0;
+                for (int i = 0; i < N; ++i) {
+                    alpha += u[i * N + p] * u[i * N + p];
+                    beta += u[i * N + q] * u[i * N + q];
+                    gamma += u[i * N + p] * u[i * N + q];
+                }
+                if (gamma == 0 || fabs(gamma) <= eps * sqrt(alpha * beta)) {
+                    continue;
+                }
+                converged = false;
+
+                const scalar_t zeta = (beta - alpha) / (2 * gamma);
+                const scalar_t t = (zeta >= 0 ? scalar_t(1) : scalar_t(-1)) /
+                                   (fabs(zeta) + sqrt(1 + zeta * zeta));
+                const scalar_t c = 1 / sqrt(1 + t * t);
+                const scalar_t s = c * t;
+                for (int i = 0; i < N; ++i) {
+                    const scalar_t up = u[i * N + p];
+                    const scalar_t uq = u[i * N + q];
+                    u[i * N + p] = c * up - s * uq;
+                    u[i * N + q] = s * up + c * uq;
+                    const scalar_t vp = v[i * N + p];
+                    const scalar_t vq = v[i * N + q];
+                    v[i * N + p] = c * vp - s * vq;
+                    v[i * N + q] = s * vp + c * vq;
+                }
+            }
+        }
+        if (converged) break;
+    }
+
+    for (int j = 0; j < N; ++j) {
+        scalar_t norm = 0;
+        for (int i = 0; i < N; ++i) {
+            norm += u[i * N + j] * u[i * N + j];
+        }
+        S_N[j] = sqrt(norm);
+    }
+
+    // Sort the singular values in descending order.
+    for (int j = 0; j < N - 1; ++j) {
+        int max_j = j;
+        for (int l = j + 1; l < N; ++l) {
+            if (S_N[l] > S_N[max_j]) max_j = l;
+        }
+        if (max_j != j) {
+            swap_scalar(S_N[j], S_N[max_j]);
+            for (int i = 0; i < N; ++i) {
+                swap_scalar(u[i * N + j], u[i * N + max_j]);
+                swap_scalar(v[i * N + j], v[i * N + max_j]);
+            }
+        }
+    }
+
+    // Normalize the columns of U. Columns of zero singular values are
+    // completed to an orthonormal basis with Gram-Schmidt.
+    const scalar_t tiny = eps * (S_N[0] > 0 ? S_N[0] : scalar_t(1));
+    for (int j = 0; j < N; ++j) {
+        if (S_N[j] > tiny) {
+            const scalar_t inv_s = 1 / S_N[j];
+            for (int i = 0; i < N; ++i) {
+                U_NxN[i * N + j] = u[i * N + j] * inv_s;
+            }
+            continue;
+        }
+        // Project the unit vectors onto the orthogonal complement of the
+        // previous columns and take the longest projection.
+        scalar_t best_norm = -1;
+        for (int e = 0; e < N; ++e) {
+            scalar_t w[N];
+            for (int i = 0; i < N; ++i) {
+                w[i] = i == e ? scalar_t(1) : scalar_t(0);
+            }
+            for (int l = 0; l < j; ++l) {
+                const scalar_t dot = U_NxN[e * N + l];
+                for (int i = 0; i < N; ++i) {
+                    w[i] -= dot * U_NxN[i * N + l];
+                }
+            }
+            scalar_t norm = 0;
+            for (int i = 0; i < N; ++i) {
+                norm += w[i] * w[i];
+            }
+            norm = sqrt(norm);
+            if (norm > best_norm) {
+                best_norm = norm;
+                for (int i = 0; i < N; ++i) {
+                    U_NxN[i * N + j] = w[i] / norm;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < N; ++i) {
+        for (int j = 0; j < N; ++j) {
+            VT_NxN[i * N + j] = v[j * N + i];
+        }
+    }
+}
+
+}  // namespace kernel
+}  // namespace linalg
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,302 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/BatchedNearestNeighborSearch.h"
+
+#include <string>
+
+#include "open3d/core/nns/KnnIndex.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// Returns the row splits on the host after checking that they cover
+/// num_rows rows.
+static std::vector<int64_t> RowSplitsToVector(const Tensor &row_splits,
+                                              int64_t num_rows,
+                                              const std::string &name) {
+    row_splits.AssertDtype(Dtype::Int64);
+    if (row_splits.NumDims() != 1 || row_splits.GetLength() < 2) {
+        utility::LogError(
+                "[BatchedNearestNeighborSearch] {} must be 1D with at least "
+                "2 elements, but got shape {}.",
+                name, row_splits.GetShape());
+    }
+    std::vector<int64_t> splits =
+            row_splits.To(Device("CPU:0")).ToFlatVector<int64_t>();
+    if (splits.front() != 0 || splits.back() != num_rows) {
+        utility::LogError(
+                "[BatchedNearestNeighborSearch] {} must start at 0 and end at "
+                "{}, but got {} and {}.",
+                name, num_rows, splits.front(), splits.back());
+    }
+    for (size_t i = 1; i < splits.size(); ++i) {
+        if (splits[i] < splits[i - 1]) {
+            utility::LogError(
+                    "[BatchedNearestNeighborSearch] {} must be "
+                    "non-decreasing.",
+                    name);
+        }
+    }
+    return splits;
+}
+
+/// Concatenates 1D tensors.
+static Tensor Concatenate(const std::vector<Tensor> &tensors,
+                          Dtype dtype,
+                          const Device &device) {
+    int64_t total = 0;
+    for (const Tensor &t : tensors) {
+        total += t.GetLength();
+    }
+    Tensor dst = Tensor::Empty({total}, dtype, device);
+    int64_t offset = 0;
+    for (const Tensor &t : tensors) {
+        const int64_t length = t.GetLength();
+        if (length > 0) {
+            dst.Slice(0, offset, offset + length) = t;
+        }
+        offset += length;
+    }
+    return dst;
+}
+
+BatchedNearestNeighborSearch::BatchedNearestNeighborSearch(
+        const Tensor &dataset_points,
+        const Tensor &points_row_splits,
+        Metric metric)
+    : dataset_points_(dataset_points.Contiguous()), metric_(metric) {
+    if (dataset_points_.NumDims() != 2) {
+        utility::LogError(
+                "[BatchedNearestNeighborSearch] dataset_points must be 2D "
+                "matrix, with shape {n_dataset_points, d}.");
+    }
+    points_row_splits_ =
+            RowSplitsToVector(points_row_splits, dataset_points_.GetLength(),
+                              "points_row_splits");
+}
+
+BatchedNearestNeighborSearch::~BatchedNearestNeighborSearch(){};
+
+bool BatchedNearestNeighborSearch::BuildIndex() {
+    const bool is_cuda =
+            dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA;
+    indices_.clear();
+    indices_.resize(GetBatchSize());
+    for (int64_t i = 0; i < GetBatchSize(); ++i) {
+        if (points_row_splits_[i] == points_row_splits_[i + 1]) {
+            continue;
+        }
+        Tensor cloud = dataset_points_.Slice(0, points_row_splits_[i],
+                                             points_row_splits_[i + 1]);
+        if (is_cuda || metric_ != L2) {
+            KnnIndex *knn_index = new KnnIndex();
+            knn_index->SetMetric(metric_);
+            indices_[i].reset(knn_index);
+        } else {
+            indices_[i].reset(new NanoFlannIndex());
+        }
+        if (!indices_[i]->SetTensorData(cloud)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<int64_t> BatchedNearestNeighborSearch::GetQueriesRowSplits(
+        const Tensor &query_points, const Tensor &queries_row_splits) const {
+    if (indices_.size() != points_row_splits_.size() - 1) {
+        utility::LogError(
+                "[BatchedNearestNeighborSearch] Index is not set. Call "
+                "BuildIndex() first.");
+    }
+    query_points.AssertDtype(dataset_points_.GetDtype());
+    query_points.AssertDevice(dataset_points_.GetDevice());
+    query_points.AssertShapeCompatible(
+            {utility::nullopt, dataset_points_.GetShape()[1]});
+    std::vector<int64_t> splits = RowSplitsToVector(
+            queries_row_splits, query_points.GetLength(), "queries_row_splits");
+    if (splits.size() != points_row_splits_.size()) {
+        utility::LogError(
+                "[BatchedNearestNeighborSearch] queries_row_splits has {} "
+                "clouds, but the dataset has {}.",
+                splits.size() - 1, GetBatchSize());
+    }
+    return splits;
+}
+
+std::tuple<Tensor, Tensor, Tensor> BatchedNearestNeighborSearch::KnnSearch(
+        const Tensor &query_points,
+        const Tensor &queries_row_splits,
+        int knn) {
+    std::vector<int64_t> splits =
+            GetQueriesRowSplits(query_points, queries_row_splits);
+    if (knn <= 0) {
+        utility::LogError(
+                "[BatchedNearestNeighborSearch::KnnSearch] knn should be "
+                "larger than 0.");
+    }
+    Device device = dataset_points_.GetDevice();
+    Dtype dtype = dataset_points_.GetDtype();
+
+    std::vector<Tensor> batch_indices, batch_distances;
+    std::vector<int64_t> neighbors_row_splits(query_points.GetLength() + 1, 0);
+    for (int64_t i = 0; i < GetBatchSize(); ++i) {
+        const int64_t num_queries = splits[i + 1] - splits[i];
+        int64_t num_neighbors = 0;
+        if (indices_[i] && num_queries > 0) {
+            Tensor indices, distances;
+            std::tie(indices, distances) = indices_[i]->SearchKnn(
+                    query_points.Slice(0, splits[i], splits[i + 1]), knn);
+            num_neighbors = indices.GetShape()[1];
+            batch_indices.push_back(
+                    indices.Add(points_row_splits_[i]).View({-1}));
+            batch_distances.push_back(distances.Contiguous().View({-1}));
+        }
+        for (int64_t j = splits[i]; j < splits[i + 1]; ++j) {
+            neighbors_row_splits[j + 1] =
+                    neighbors_row_splits[j] + num_neighbors;
+        }
+    }
+    return std::make_tuple(
+            Concatenate(batch_indices, Dtype::Int64, device),
+            Concatenate(batch_distances, dtype, device),
+            Tensor(neighbors_row_splits,
+                   {static_cast<int64_t>(neighbors_row_splits.size())},
+                   Dtype::Int64, device));
+}
+
+std::tuple<Tensor, Tensor, Tensor>
+BatchedNearestNeighborSearch::FixedRadiusSearch(
+        const Tensor &query_points,
+        const Tensor &queries_row_splits,
+        double radius,
+        bool sort) {
+    if (radius <= 0) {
+        utility::LogError(
+                "[BatchedNearestNeighborSearch::FixedRadiusSearch] radius "
+                "should be larger than 0.");
+    }
+    Tensor radii = Tensor::Full({query_points.GetLength()}, radius,
+                                dataset_points_.GetDtype(),
+                                dataset_points_.GetDevice());
+    return RadiusSearch(query_points, queries_row_splits, radii, sort);
+}
+
+std::tuple<Tensor, Tensor, Tensor> BatchedNearestNeighborSearch::RadiusSearch(
+        const Tensor &query_points,
+        const Tensor &queries_row_splits,
+        const Tensor &radii,
+        bool sort) {
+    std::vector<int64_t> splits =
+            GetQueriesRowSplits(query_points, queries_row_splits);
+    radii.AssertDtype(dataset_points_.GetDtype());
+    radii.AssertDevice(dataset_points_.GetDevice());
+    radii.AssertShape({query_points.GetLength()});
+    Device device = dataset_points_.GetDevice();
+    Dtype dtype = dataset_points_.GetDtype();
+
+    std::vector<Tensor> batch_indices, batch_distances, batch_row_splits;
+    int64_t num_neighbors = 0;
+    for (int64_t i = 0; i < GetBatchSize(); ++i) {
+        const int64_t num_queries = splits[i + 1] - splits[i];
+        if (num_queries == 0) {
+            continue;
+        }
+        if (!indices_[i]) {
+            batch_row_splits.push_back(Tensor::Full(
+                    {num_queries}, num_neighbors, Dtype::Int64, device));
+            continue;
+        }
+        Tensor indices, distances, row_splits;
+        std::tie(indices, distances, row_splits) = indices_[i]->SearchRadius(
+                query_points.Slice(0, splits[i], splits[i + 1]),
+                radii.Slice(0, splits[i], splits[i + 1]), sort);
+        row_splits = row_splits.To(device);
+        batch_indices.push_back(indices.To(device).Add(points_row_splits_[i]));
+        batch_distances.push_back(distances.To(device));
+        batch_row_splits.push_back(
+                row_splits.Slice(0, 1, num_queries + 1).Add(num_neighbors));
+        num_neighbors += indices.GetLength();
+    }
+    batch_row_splits.insert(batch_row_splits.begin(),
+                            Tensor::Zeros({1}, Dtype::Int64, device));
+    return std::make_tuple(Concatenate(batch_indices, Dtype::Int64, device),
+                           Concatenate(batch_distances, dtype, device),
+                           Concatenate(batch_row_splits, Dtype::Int64, device));
+}
+
+std::tuple<Tensor, Tensor, Tensor> BatchedNearestNeighborSearch::HybridSearch(
+        const Tensor &query_points,
+        const Tensor &queries_row_splits,
+        double radius,
+        int max_knn) {
+    std::vector<int64_t> splits =
+            GetQueriesRowSplits(query_points, queries_row_splits);
+    if (max_knn <= 0) {
+        utility::LogError(
+                "[BatchedNearestNeighborSearch::HybridSearch] max_knn should "
+                "be larger than 0.");
+    }
+    if (radius <= 0) {
+        utility::LogError(
+                "[BatchedNearestNeighborSearch::HybridSearch] radius should "
+                "be larger than 0.");
+    }
+    Device device = dataset_points_.GetDevice();
+    Dtype dtype = dataset_points_.GetDtype();
+
+    const int64_t num_query_points = query_points.GetLength();
+    Tensor indices = Tensor::Full({num_query_points, max_knn}, -1,
+                                  Dtype::Int64, device);
+    Tensor distances =
+            Tensor::Zeros({num_query_points, max_knn}, dtype, device);
+    Tensor counts = Tensor::Zeros({num_query_points}, Dtype::Int64, device);
+    for (int64_t i = 0; i < GetBatchSize(); ++i) {
+        if (!indices_[i] || splits[i] == splits[i + 1]) {
+            continue;
+        }
+        Tensor cloud_indices, cloud_distances, cloud_counts;
+        std::tie(cloud_indices, cloud_distances, cloud_counts) =
+                indices_[i]->SearchHybrid(
+                        query_points.Slice(0, splits[i], splits[i + 1]),
+                        radius, max_knn);
+        // Offset the valid indices, keeping the -1 padding.
+        Tensor valid = cloud_indices.Ge(0).To(Dtype::Int64);
+        indices.Slice(0, splits[i], splits[i + 1]) =
+                cloud_indices.Add(valid.Mul_(points_row_splits_[i]));
+        distances.Slice(0, splits[i], splits[i + 1]) = cloud_distances;
+        counts.Slice(0, splits[i], splits[i + 1]) = cloud_counts;
+    }
+    return std::make_tuple(indices, distances, counts);
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,169 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NNSIndex.h"
+#include "open3d/core/nns/NeighborSearchCommon.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// \class BatchedNearestNeighborSearch
+///
+/// \brief Nearest neighbor search over a batch of point clouds.
+///
+/// The clouds are given as one concatenated points tensor with row splits, as
+/// in the ML neighbor search ops. Every query cloud is searched against the
+/// dataset cloud with the same batch index. CPU clouds are indexed with
+/// NanoFlannIndex and CUDA clouds with KnnIndex. Neighbor indices refer to
+/// rows of the concatenated dataset points. This is the search engine behind
+/// the knn and radius search ops of the ML module on CUDA.
+///
+/// For the L1 and Linf metrics all clouds are indexed with KnnIndex. Distances
+/// and radius thresholds are squared for L2 only.
+class BatchedNearestNeighborSearch {
+public:
+    /// Constructor.
+    ///
+    /// \param dataset_points Concatenated dataset points of all clouds. Must be
+    /// 2D, with shape {n, d}.
+    /// \param points_row_splits Int64 tensor of shape {batch_size + 1,}. Cloud
+    /// i consists of the rows points_row_splits[i], ...,
+    /// points_row_splits[i + 1] - 1.
+    /// \param metric Distance metric of all searches.
+    BatchedNearestNeighborSearch(const Tensor &dataset_points,
+                                 const Tensor &points_row_splits,
+                                 Metric metric = L2);
+    ~BatchedNearestNeighborSearch();
+    BatchedNearestNeighborSearch(const BatchedNearestNeighborSearch &) = delete;
+    BatchedNearestNeighborSearch &operator=(
+            const BatchedNearestNeighborSearch &) = delete;
+
+public:
+    /// Builds the index of each cloud. The same index serves knn, radius and
+    /// hybrid search.
+    ///
+    /// \return Returns true if building index success, otherwise false.
+    bool BuildIndex();
+
+    /// Perform knn search per cloud.
+    ///
+    /// \param query_points Concatenated query points. Must be 2D, with shape
+    /// {n_query, d}.
+    /// \param queries_row_splits Int64 tensor of shape {batch_size + 1,}.
+    /// \param knn Number of neighbors to search per query point.
+    /// \return Tuple of Tensors, (indices, distances, neighbors_row_splits):
+    /// - indices: Tensor of shape {total_number_of_neighbors,}, with dtype
+    /// Int64. A query gets min(knn, cloud size) neighbors, sorted by distance.
+    /// - distances: Tensor of shape {total_number_of_neighbors,}, same dtype
+    /// with query_points. The L2 distances are squared.
+    /// - neighbors_row_splits: Tensor of shape {n_query + 1,}, with dtype
+    /// Int64.
+    std::tuple<Tensor, Tensor, Tensor> KnnSearch(
+            const Tensor &query_points,
+            const Tensor &queries_row_splits,
+            int knn);
+
+    /// Perform fixed radius search per cloud.
+    ///
+    /// \param query_points Concatenated query points. Must be 2D, with shape
+    /// {n_query, d}.
+    /// \param queries_row_splits Int64 tensor of shape {batch_size + 1,}.
+    /// \param radius Radius.
+    /// \param sort If true, the neighbors of each query are sorted by
+    /// distance.
+    /// \return Tuple of Tensors, (indices, distances, neighbors_row_splits),
+    /// see KnnSearch().
+    std::tuple<Tensor, Tensor, Tensor> FixedRadiusSearch(
+            const Tensor &query_points,
+            const Tensor &queries_row_splits,
+            double radius,
+            bool sort = true);
+
+    /// Perform radius search with one radius per query point.
+    ///
+    /// \param query_points Concatenated query points. Must be 2D, with shape
+    /// {n_query, d}.
+    /// \param queries_row_splits Int64 tensor of shape {batch_size + 1,}.
+    /// \param radii Radius of each query point. Must be 1D, with shape
+    /// {n_query,} and the same dtype and device with query_points.
+    /// \param sort If true, the neighbors of each query are sorted by
+    /// distance.
+    /// \return Tuple of Tensors, (indices, distances, neighbors_row_splits),
+    /// see KnnSearch().
+    std::tuple<Tensor, Tensor, Tensor> RadiusSearch(
+            const Tensor &query_points,
+            const Tensor &queries_row_splits,
+            const Tensor &radii,
+            bool sort = true);
+
+    /// Perform hybrid search per cloud.
+    ///
+    /// \param query_points Concatenated query points. Must be 2D, with shape
+    /// {n_query, d}.
+    /// \param queries_row_splits Int64 tensor of shape {batch_size + 1,}.
+    /// \param radius Radius.
+    /// \param max_knn Maximum number of neighbor to search per query.
+    /// \return Tuple of Tensors, (indices, distances, counts):
+    /// - indices: Tensor of shape {n_query, max_knn}, with dtype Int64, padded
+    /// with -1.
+    /// - distances: Tensor of shape {n_query, max_knn}, same dtype with
+    /// query_points, padded with 0.
+    /// - counts: Tensor of shape {n_query,}, with dtype Int64.
+    std::tuple<Tensor, Tensor, Tensor> HybridSearch(
+            const Tensor &query_points,
+            const Tensor &queries_row_splits,
+            double radius,
+            int max_knn);
+
+    /// Returns the number of clouds.
+    int64_t GetBatchSize() const {
+        return static_cast<int64_t>(points_row_splits_.size()) - 1;
+    }
+
+private:
+    /// Checks the queries and returns their row splits on the host.
+    std::vector<int64_t> GetQueriesRowSplits(
+            const Tensor &query_points,
+            const Tensor &queries_row_splits) const;
+
+protected:
+    /// Index of each cloud, nullptr for empty clouds.
+    std::vector<std::unique_ptr<NNSIndex>> indices_;
+    std::vector<int64_t> points_row_splits_;
+    const Tensor dataset_points_;
+    const Metric metric_;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -30,10 +30,13 @@
 #endif
 #include "open3d/core/nns/FaissIndex.h"
 
+#include <algorithm>
 #include <faiss/IndexFlat.h>
+#include <faiss/IndexIVFPQ.h>
 
 #ifdef BUILD_CUDA_MODULE
 #include <faiss/gpu/GpuIndexFlat.h>
+#include <faiss/gpu/GpuIndexIVFPQ.h>
 #include <faiss/gpu/StandardGpuResources.h>
 #endif
 
@@ -95,6 +98,71 @@ bool FaissIndex::SetTensorData(const Tensor &dataset_points) {
     return true;
 }
 
+bool FaissIndex::SetTensorDataIVFPQ(const Tensor &dataset_points,
+                                    int nlist,
+                                    int pq_m,
+                                    int pq_nbits,
+                                    int nprobe) {
+    if (dataset_points.NumDims() != 2) {
+        utility::LogError(
+                "[FaissIndex::SetTensorDataIVFPQ] dataset_points must be "
+                "2D matrix, with shape {n_dataset_points, d}.");
+    }
+    dataset_points.AssertDtype(Dtype::Float32);
+    dataset_points_ = dataset_points.Contiguous();
+    const int64_t dataset_size = GetDatasetSize();
+    const int dimension = GetDimension();
+    if (nlist <= 0 || pq_m <= 0 || pq_nbits <= 0 || nprobe <= 0 ||
+        dimension % pq_m != 0) {
+        utility::LogError(
+                "[FaissIndex::SetTensorDataIVFPQ] Invalid parameters nlist={}, "
+                "pq_m={}, pq_nbits={}, nprobe={} for dimension {}.",
+                nlist, pq_m, pq_nbits, nprobe, dimension);
+    }
+    const int64_t min_size = std::max<int64_t>(nlist, int64_t(1) << pq_nbits);
+    if (dataset_size < min_size) {
+        utility::LogError(
+                "[FaissIndex::SetTensorDataIVFPQ] Training needs at least {} "
+                "points, but got {}.",
+                min_size, dataset_size);
+    }
+
+    if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        res.reset(new faiss::gpu::StandardGpuResources());
+        faiss::gpu::GpuIndexIVFPQConfig config;
+        config.device = dataset_points_.GetDevice().GetID();
+
+        CUDACachedMemoryManager::ReleaseCache();
+        auto gpu_index = new faiss::gpu::GpuIndexIVFPQ(
+                res.get(), dimension, nlist, pq_m, pq_nbits,
+                faiss::MetricType::METRIC_L2, config);
+        gpu_index->setNumProbes(nprobe);
+        index.reset(gpu_index);
+#else
+        utility::LogError(
+                "[FaissIndex::SetTensorDataIVFPQ] GPU Tensor is not supported "
+                "when BUILD_CUDA_MODULE=OFF. Please recompile Open3D with "
+                "BUILD_CUDA_MODULE=ON.");
+#endif
+    } else {
+        auto cpu_index = new faiss::IndexIVFPQ(
+                new faiss::IndexFlatL2(dimension), dimension, nlist, pq_m,
+                pq_nbits);
+        // The index deletes its coarse quantizer.
+        cpu_index->own_fields = true;
+        cpu_index->nprobe = nprobe;
+        index.reset(cpu_index);
+    }
+    // The k-means clustering and the residuals of the training read the
+    // points on the host, also for GPU indices.
+    Tensor train_points = dataset_points_.To(Device("CPU:0"));
+    index->train(dataset_size, train_points.GetDataPtr<float>());
+    float *_data_ptr = dataset_points_.GetDataPtr<float>();
+    index->add(dataset_size, _data_ptr);
+    return true;
+}
+
 std::pair<Tensor, Tensor> FaissIndex::SearchKnn(const Tensor &query_points,
                                                 int knn) const {
     // Check dtype.
@@ -69,6 +69,25 @@ public:
                 "FaissIndex::SetTensorData with radius not implemented.");
     }
 
+    /// Builds an approximate inverted file index with product quantization
+    /// (IVF-PQ) instead of the exact flat index. The dataset points are
+    /// clustered into \p nlist inverted lists, and each point is stored as
+    /// \p pq_m codes of \p pq_nbits bits. Searches scan the \p nprobe lists
+    /// closest to the query, and return distances computed from the codes.
+    ///
+    /// \param dataset_points Float32 dataset points, with shape {n, d}. At
+    /// least max(nlist, 2^pq_nbits) points are needed for training.
+    /// \param nlist Number of inverted lists.
+    /// \param pq_m Number of sub-quantizers, must divide d.
+    /// \param pq_nbits Number of bits per sub-quantizer code.
+    /// \param nprobe Number of inverted lists visited per query. Larger values
+    /// increase the recall at a higher query cost.
+    bool SetTensorDataIVFPQ(const Tensor &dataset_points,
+                            int nlist,
+                            int pq_m,
+                            int pq_nbits,
+                            int nprobe);
+
     /// Perform K nearest neighbor search.
     ///
     /// \param query_points Query points. Must be Float32, 2D, with shape {n,
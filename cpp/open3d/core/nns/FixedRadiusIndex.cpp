@@ -37,6 +37,37 @@ namespace open3d {
 namespace core {
 namespace nns {
 
+/// Concatenates two tensors along the first dimension.
+static Tensor Concatenate(const Tensor &a, const Tensor &b) {
+    SizeVector shape = a.GetShape();
+    shape[0] += b.GetLength();
+    Tensor dst = Tensor::Empty(shape, a.GetDtype(), a.GetDevice());
+    if (a.GetLength() > 0) {
+        dst.Slice(0, 0, a.GetLength()) = a;
+    }
+    if (b.GetLength() > 0) {
+        dst.Slice(0, a.GetLength(), shape[0]) = b;
+    }
+    return dst;
+}
+
+/// Returns the query (row) index of each neighbor from the {n + 1} row splits.
+static Tensor RowIdsFromSplits(const Tensor &row_splits) {
+    const int64_t num_queries = row_splits.GetLength() - 1;
+    const int64_t total = row_splits[num_queries].Item<int64_t>();
+    // Mark the first neighbor of every row after the first, counting empty
+    // rows that start at the same position, and accumulate the marks.
+    Tensor marks =
+            Tensor::Zeros({total + 1}, Dtype::Int64, row_splits.GetDevice());
+    if (num_queries > 1) {
+        Tensor starts, counts;
+        std::tie(starts, std::ignore, counts) =
+                row_splits.Slice(0, 1, num_queries).Unique(false, true);
+        marks.IndexSet({starts}, counts);
+    }
+    return marks.Slice(0, 0, total).CumSum(0);
+}
+
 FixedRadiusIndex::FixedRadiusIndex(){};
 
 FixedRadiusIndex::FixedRadiusIndex(const Tensor &dataset_points,
@@ -59,77 +90,279 @@ bool FixedRadiusIndex::SetTensorData(const Tensor &dataset_points,
                 "[FixedRadiusIndex::SetTensorData] radius should be positive.");
     }
     dataset_points_ = dataset_points.Contiguous();
+    radius_ = radius;
     Device device = GetDevice();
-    Dtype dtype = GetDtype();
-
     int64_t num_dataset_points = GetDatasetSize();
+    BuildHashTable(dataset_points_, hash_table_);
+
+    pending_points_ = Tensor::Empty({0, GetDimension()}, GetDtype(), device);
+    pending_hash_table_ = SpatialHashTable();
+    point_ids_ = Tensor::Arange(0, num_dataset_points, 1, Dtype::Int64, device);
+    pending_ids_ = Tensor::Empty({0}, Dtype::Int64, device);
+    removed_ = Tensor::Zeros({num_dataset_points}, Dtype::UInt8, device);
+    next_id_ = num_dataset_points;
+    num_removed_ = 0;
+    ids_are_positions_ = true;
+    return true;
+#else
+    utility::LogError(
+            "FixedRadiusIndex::SetTensorData BUILD_CUDA_MODULE is OFF. Please "
+            "compile Open3d with BUILD_CUDA_MODULE=ON.");
+#endif
+};
+
+void FixedRadiusIndex::BuildHashTable(const Tensor &points,
+                                      SpatialHashTable &table) const {
+#ifdef BUILD_CUDA_MODULE
+    Device device = points.GetDevice();
+    Dtype dtype = points.GetDtype();
+    int64_t num_points = points.GetLength();
     int64_t hash_table_size = std::min<int64_t>(
-            std::max<int64_t>(hash_table_size_factor * num_dataset_points, 1),
+            std::max<int64_t>(hash_table_size_factor * num_points, 1),
             max_hash_tabls_size);
-    points_row_splits_ = std::vector<int64_t>({0, num_dataset_points});
-    hash_table_splits_ = std::vector<int64_t>({0, hash_table_size});
+    table.points_row_splits = std::vector<int64_t>({0, num_points});
+    table.hash_table_splits = std::vector<int64_t>({0, hash_table_size});
 
-    hash_table_index_ =
-            Tensor::Empty({num_dataset_points}, Dtype::Int64, device);
-    hash_table_cell_splits_ = Tensor::Empty({hash_table_splits_.back() + 1},
-                                            Dtype::Int64, device);
+    table.hash_table_index = Tensor::Empty({num_points}, Dtype::Int64, device);
+    table.hash_table_cell_splits = Tensor::Empty(
+            {table.hash_table_splits.back() + 1}, Dtype::Int64, device);
 
     void *temp_ptr = nullptr;
     size_t temp_size = 0;
 
     DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
         // Determine temp_size.
-        BuildSpatialHashTableCUDA(temp_ptr, temp_size, num_dataset_points,
-                                  dataset_points_.GetDataPtr<scalar_t>(),
-                                  scalar_t(radius), points_row_splits_.size(),
-                                  points_row_splits_.data(),
-                                  hash_table_splits_.data(),
-                                  hash_table_cell_splits_.GetShape()[0],
-                                  hash_table_cell_splits_.GetDataPtr<int64_t>(),
-                                  hash_table_index_.GetDataPtr<int64_t>());
+        BuildSpatialHashTableCUDA(
+                temp_ptr, temp_size, num_points, points.GetDataPtr<scalar_t>(),
+                scalar_t(radius_), table.points_row_splits.size(),
+                table.points_row_splits.data(),
+                table.hash_table_splits.data(),
+                table.hash_table_cell_splits.GetShape()[0],
+                table.hash_table_cell_splits.GetDataPtr<int64_t>(),
+                table.hash_table_index.GetDataPtr<int64_t>());
         Tensor temp_tensor =
                 Tensor::Empty({int64_t(temp_size)}, Dtype::UInt8, device);
         temp_ptr = temp_tensor.GetDataPtr();
 
         // Actually run the function.
-        BuildSpatialHashTableCUDA(temp_ptr, temp_size, num_dataset_points,
-                                  dataset_points_.GetDataPtr<scalar_t>(),
-                                  scalar_t(radius), points_row_splits_.size(),
-                                  points_row_splits_.data(),
-                                  hash_table_splits_.data(),
-                                  hash_table_cell_splits_.GetShape()[0],
-                                  hash_table_cell_splits_.GetDataPtr<int64_t>(),
-                                  hash_table_index_.GetDataPtr<int64_t>());
+        BuildSpatialHashTableCUDA(
+                temp_ptr, temp_size, num_points, points.GetDataPtr<scalar_t>(),
+                scalar_t(radius_), table.points_row_splits.size(),
+                table.points_row_splits.data(),
+                table.hash_table_splits.data(),
+                table.hash_table_cell_splits.GetShape()[0],
+                table.hash_table_cell_splits.GetDataPtr<int64_t>(),
+                table.hash_table_index.GetDataPtr<int64_t>());
     });
-    return true;
 #else
     utility::LogError(
-            "FixedRadiusIndex::SetTensorData BUILD_CUDA_MODULE is OFF. Please "
+            "FixedRadiusIndex::BuildHashTable BUILD_CUDA_MODULE is OFF. Please "
             "compile Open3d with BUILD_CUDA_MODULE=ON.");
 #endif
-};
+}
+
+Tensor FixedRadiusIndex::InsertPoints(const Tensor &points) {
+    if (radius_ <= 0) {
+        utility::LogError(
+                "[FixedRadiusIndex::InsertPoints] SetTensorData must be "
+                "called first.");
+    }
+    points.AssertDtype(GetDtype());
+    points.AssertDevice(GetDevice());
+    points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+
+    const int64_t num_points = points.GetLength();
+    Tensor ids = Tensor::Arange(next_id_, next_id_ + num_points, 1,
+                                Dtype::Int64, GetDevice());
+    if (num_points == 0) {
+        return ids;
+    }
+    next_id_ += num_points;
+    pending_points_ = Concatenate(pending_points_, points.Contiguous());
+    pending_ids_ = Concatenate(pending_ids_, ids);
+    removed_ = Concatenate(
+            removed_, Tensor::Zeros({num_points}, Dtype::UInt8, GetDevice()));
+
+    if (pending_points_.GetLength() + num_removed_ >
+        rebuild_fraction_ * GetDatasetSize()) {
+        Rebuild();
+    } else {
+        BuildHashTable(pending_points_, pending_hash_table_);
+    }
+    return ids;
+}
+
+void FixedRadiusIndex::RemovePoints(const Tensor &ids) {
+    if (radius_ <= 0) {
+        utility::LogError(
+                "[FixedRadiusIndex::RemovePoints] SetTensorData must be "
+                "called first.");
+    }
+    ids.AssertDtype(Dtype::Int64);
+    if (ids.NumDims() != 1) {
+        utility::LogError(
+                "[FixedRadiusIndex::RemovePoints] ids must be 1D, but got "
+                "shape {}.",
+                ids.GetShape());
+    }
+    if (ids.GetLength() == 0) {
+        return;
+    }
+    Tensor unique_ids = std::get<0>(ids.To(GetDevice()).Unique());
+    if (unique_ids[0].Item<int64_t>() < 0 ||
+        unique_ids[-1].Item<int64_t>() >= next_id_) {
+        utility::LogError(
+                "[FixedRadiusIndex::RemovePoints] ids must be in [0, {}).",
+                next_id_);
+    }
+    num_removed_ += removed_.IndexGet({unique_ids})
+                            .Eq(0)
+                            .To(Dtype::Int64)
+                            .Sum({0})
+                            .Item<int64_t>();
+    removed_.IndexSet(
+            {unique_ids},
+            Tensor::Ones({unique_ids.GetLength()}, Dtype::UInt8, GetDevice()));
+
+    if (pending_points_.GetLength() + num_removed_ >
+        rebuild_fraction_ * GetDatasetSize()) {
+        Rebuild();
+    }
+}
+
+void FixedRadiusIndex::Rebuild() {
+    Tensor points = Concatenate(dataset_points_, pending_points_);
+    Tensor ids = Concatenate(point_ids_, pending_ids_);
+    if (num_removed_ > 0) {
+        Tensor keep = removed_.IndexGet({ids}).Eq(0);
+        points = points.IndexGet({keep});
+        ids = ids.IndexGet({keep});
+        ids_are_positions_ = false;
+    }
+    dataset_points_ = points;
+    point_ids_ = ids;
+    pending_points_ =
+            Tensor::Empty({0, GetDimension()}, GetDtype(), GetDevice());
+    pending_ids_ = Tensor::Empty({0}, Dtype::Int64, GetDevice());
+    pending_hash_table_ = SpatialHashTable();
+    num_removed_ = 0;
+    BuildHashTable(dataset_points_, hash_table_);
+}
+
+void FixedRadiusIndex::SetRebuildFraction(double rebuild_fraction) {
+    if (rebuild_fraction < 0) {
+        utility::LogError(
+                "[FixedRadiusIndex::SetRebuildFraction] rebuild_fraction "
+                "must be non-negative, but got {}.",
+                rebuild_fraction);
+    }
+    rebuild_fraction_ = rebuild_fraction;
+}
+
+int64_t FixedRadiusIndex::GetNumPendingPoints() const {
+    return pending_points_.GetLength();
+}
+
+int64_t FixedRadiusIndex::GetNumPoints() const {
+    return GetDatasetSize() + pending_points_.GetLength() - num_removed_;
+}
+
+bool FixedRadiusIndex::IsUpdated() const {
+    return pending_points_.GetLength() > 0 || num_removed_ > 0;
+}
 
 std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         const Tensor &query_points, double radius, bool sort) const {
-#ifdef BUILD_CUDA_MODULE
-    Dtype dtype = GetDtype();
-    Device device = GetDevice();
-    int64_t num_dataset_points = GetDatasetSize();
-
     // Check dtype.
-    query_points.AssertDtype(dtype);
+    query_points.AssertDtype(GetDtype());
 
     // Check shape.
     query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
 
     // Check device.
-    query_points.AssertDevice(device);
+    query_points.AssertDevice(GetDevice());
 
     if (radius <= 0) {
         utility::LogError(
                 "[FixedRadiusIndex::SearchRadius] radius should be positive.");
     }
 
+    if (IsUpdated()) {
+        return SearchRadiusUpdated(query_points, radius, sort);
+    }
+    Tensor indices, distances, row_splits;
+    std::tie(indices, distances, row_splits) = SearchRadiusInTable(
+            dataset_points_, hash_table_, query_points, radius, sort);
+    if (!ids_are_positions_) {
+        indices = point_ids_.IndexGet({indices});
+    }
+    return std::make_tuple(indices, distances, row_splits);
+}
+
+std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadiusUpdated(
+        const Tensor &query_points, double radius, bool sort) const {
+    const int64_t num_query_points = query_points.GetLength();
+    Device device = GetDevice();
+
+    // Collect the neighbors of both tables as (row, id, distance) triplets.
+    Tensor indices, distances, row_splits;
+    std::tie(indices, distances, row_splits) = SearchRadiusInTable(
+            dataset_points_, hash_table_, query_points, radius, false);
+    Tensor ids = point_ids_.IndexGet({indices});
+    Tensor rows = RowIdsFromSplits(row_splits);
+    if (pending_points_.GetLength() > 0) {
+        Tensor pending_indices, pending_distances, pending_row_splits;
+        std::tie(pending_indices, pending_distances, pending_row_splits) =
+                SearchRadiusInTable(pending_points_, pending_hash_table_,
+                                    query_points, radius, false);
+        ids = Concatenate(ids, pending_ids_.IndexGet({pending_indices}));
+        distances = Concatenate(distances, pending_distances);
+        rows = Concatenate(rows, RowIdsFromSplits(pending_row_splits));
+    }
+
+    if (num_removed_ > 0) {
+        Tensor keep = removed_.IndexGet({ids}).Eq(0);
+        ids = ids.IndexGet({keep});
+        distances = distances.IndexGet({keep});
+        rows = rows.IndexGet({keep});
+    }
+
+    // Group by row with stable sorts. Within a row, neighbors are ordered by
+    // distance if sort is true, otherwise main table neighbors come first.
+    if (ids.GetLength() > 0) {
+        Tensor order;
+        if (sort) {
+            order = distances.ArgSort();
+            order = order.IndexGet({rows.IndexGet({order}).ArgSort()});
+        } else {
+            order = rows.ArgSort();
+        }
+        ids = ids.IndexGet({order});
+        distances = distances.IndexGet({order});
+        rows = rows.IndexGet({order});
+    }
+
+    Tensor counts = Tensor::Ones({ids.GetLength()}, Dtype::Int64, device)
+                            .SegmentSum(rows, num_query_points);
+    Tensor merged_row_splits =
+            Tensor::Zeros({num_query_points + 1}, Dtype::Int64, device);
+    if (num_query_points > 0) {
+        merged_row_splits.Slice(0, 1, num_query_points + 1) = counts.CumSum(0);
+    }
+    return std::make_tuple(ids, distances, merged_row_splits);
+}
+
+std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadiusInTable(
+        const Tensor &points,
+        const SpatialHashTable &table,
+        const Tensor &query_points,
+        double radius,
+        bool sort) const {
+#ifdef BUILD_CUDA_MODULE
+    Dtype dtype = GetDtype();
+    Device device = GetDevice();
+    int64_t num_dataset_points = points.GetLength();
+
     Tensor query_points_ = query_points.Contiguous();
     int64_t num_query_points = query_points_.GetShape()[0];
     std::vector<int64_t> queries_row_splits({0, num_query_points});
@@ -147,14 +380,14 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         // Determine temp_size.
         FixedRadiusSearchCUDA(
                 temp_ptr, temp_size, neighbors_row_splits.GetDataPtr<int64_t>(),
-                num_dataset_points, dataset_points_.GetDataPtr<scalar_t>(),
+                num_dataset_points, points.GetDataPtr<scalar_t>(),
                 num_query_points, query_points_.GetDataPtr<scalar_t>(),
-                scalar_t(radius), points_row_splits_.size(),
-                points_row_splits_.data(), queries_row_splits.size(),
-                queries_row_splits.data(), hash_table_splits_.data(),
-                hash_table_cell_splits_.GetShape()[0],
-                hash_table_cell_splits_.GetDataPtr<int64_t>(),
-                hash_table_index_.GetDataPtr<int64_t>(), output_allocator);
+                scalar_t(radius), table.points_row_splits.size(),
+                table.points_row_splits.data(), queries_row_splits.size(),
+                queries_row_splits.data(), table.hash_table_splits.data(),
+                table.hash_table_cell_splits.GetShape()[0],
+                table.hash_table_cell_splits.GetDataPtr<int64_t>(),
+                table.hash_table_index.GetDataPtr<int64_t>(), output_allocator);
 
         Tensor temp_tensor =
                 Tensor::Empty({int64_t(temp_size)}, Dtype::UInt8, device);
@@ -163,14 +396,14 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
         // Actually run the function.
         FixedRadiusSearchCUDA(
                 temp_ptr, temp_size, neighbors_row_splits.GetDataPtr<int64_t>(),
-                num_dataset_points, dataset_points_.GetDataPtr<scalar_t>(),
+                num_dataset_points, points.GetDataPtr<scalar_t>(),
                 num_query_points, query_points_.GetDataPtr<scalar_t>(),
-                scalar_t(radius), points_row_splits_.size(),
-                points_row_splits_.data(), queries_row_splits.size(),
-                queries_row_splits.data(), hash_table_splits_.data(),
-                hash_table_cell_splits_.GetShape()[0],
-                hash_table_cell_splits_.GetDataPtr<int64_t>(),
-                hash_table_index_.GetDataPtr<int64_t>(), output_allocator);
+                scalar_t(radius), table.points_row_splits.size(),
+                table.points_row_splits.data(), queries_row_splits.size(),
+                queries_row_splits.data(), table.hash_table_splits.data(),
+                table.hash_table_cell_splits.GetShape()[0],
+                table.hash_table_cell_splits.GetDataPtr<int64_t>(),
+                table.hash_table_index.GetDataPtr<int64_t>(), output_allocator);
 
         Tensor indices_unsorted = output_allocator.NeighborsIndex();
         Tensor distances_unsorted = output_allocator.NeighborsDistance();
@@ -220,29 +453,77 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchRadius(
             "FixedRadiusIndex::SearchRadius BUILD_CUDA_MODULE is OFF. Please "
             "compile Open3d with BUILD_CUDA_MODULE=ON.");
 #endif
-};
+}
 
 std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchHybrid(
         const Tensor &query_points, double radius, int max_knn) const {
-#ifdef BUILD_CUDA_MODULE
-    Dtype dtype = GetDtype();
-    Device device = GetDevice();
-    int64_t num_dataset_points = GetDatasetSize();
-
     // Check dtype.
-    query_points.AssertDtype(dtype);
+    query_points.AssertDtype(GetDtype());
 
     // Check shape.
     query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
 
     // Check device.
-    query_points.AssertDevice(device);
+    query_points.AssertDevice(GetDevice());
 
     if (radius <= 0) {
         utility::LogError(
                 "[FixedRadiusIndex::SearchRadius] radius should be positive.");
     }
 
+    if (!IsUpdated()) {
+        Tensor indices, distances, counts;
+        std::tie(indices, distances, counts) = SearchHybridInTable(
+                dataset_points_, hash_table_, query_points, radius, max_knn);
+        if (!ids_are_positions_) {
+            Tensor valid = indices.Ge(0);
+            indices.IndexSet({valid},
+                             point_ids_.IndexGet({indices.IndexGet({valid})}));
+        }
+        return std::make_tuple(indices, distances, counts);
+    }
+
+    // Keep the max_knn closest neighbors of the merged, sorted radius search,
+    // so that removed points never hide valid neighbors.
+    const int64_t num_query_points = query_points.GetLength();
+    Device device = GetDevice();
+    Tensor ids, distances, row_splits;
+    std::tie(ids, distances, row_splits) =
+            SearchRadiusUpdated(query_points, radius, true);
+    Tensor rows = RowIdsFromSplits(row_splits);
+    Tensor positions =
+            Tensor::Arange(0, ids.GetLength(), 1, Dtype::Int64, device)
+                    .Sub_(row_splits.IndexGet({rows}));
+    Tensor keep = positions.Lt(max_knn);
+    Tensor flat_positions = rows.IndexGet({keep})
+                                    .Mul_(max_knn)
+                                    .Add_(positions.IndexGet({keep}));
+
+    Tensor indices = Tensor::Full({num_query_points * max_knn}, -1,
+                                  Dtype::Int64, device);
+    Tensor hybrid_distances =
+            Tensor::Zeros({num_query_points * max_knn}, GetDtype(), device);
+    indices.IndexSet({flat_positions}, ids.IndexGet({keep}));
+    hybrid_distances.IndexSet({flat_positions}, distances.IndexGet({keep}));
+    Tensor counts = row_splits.Slice(0, 1, num_query_points + 1)
+                            .Sub(row_splits.Slice(0, 0, num_query_points))
+                            .Clip_(0, max_knn);
+    return std::make_tuple(indices.View({num_query_points, max_knn}),
+                           hybrid_distances.View({num_query_points, max_knn}),
+                           counts);
+}
+
+std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchHybridInTable(
+        const Tensor &points,
+        const SpatialHashTable &table,
+        const Tensor &query_points,
+        double radius,
+        int max_knn) const {
+#ifdef BUILD_CUDA_MODULE
+    Dtype dtype = GetDtype();
+    Device device = GetDevice();
+    int64_t num_dataset_points = points.GetLength();
+
     Tensor query_points_ = query_points.Contiguous();
     int64_t num_query_points = query_points_.GetShape()[0];
     std::vector<int64_t> queries_row_splits({0, num_query_points});
@@ -253,14 +534,14 @@ std::tuple<Tensor, Tensor, Tensor> FixedRadiusIndex::SearchHybrid(
         NeighborSearchAllocator<scalar_t> output_allocator(device);
         // Determine temp_size.
         HybridSearchCUDA(
-                num_dataset_points, dataset_points_.GetDataPtr<scalar_t>(),
+                num_dataset_points, points.GetDataPtr<scalar_t>(),
                 num_query_points, query_points_.GetDataPtr<scalar_t>(),
-                scalar_t(radius), max_knn, points_row_splits_.size(),
-                points_row_splits_.data(), queries_row_splits.size(),
-                queries_row_splits.data(), hash_table_splits_.data(),
-                hash_table_cell_splits_.GetShape()[0],
-                hash_table_cell_splits_.GetDataPtr<int64_t>(),
-                hash_table_index_.GetDataPtr<int64_t>(), output_allocator);
+                scalar_t(radius), max_knn, table.points_row_splits.size(),
+                table.points_row_splits.data(), queries_row_splits.size(),
+                queries_row_splits.data(), table.hash_table_splits.data(),
+                table.hash_table_cell_splits.GetShape()[0],
+                table.hash_table_cell_splits.GetDataPtr<int64_t>(),
+                table.hash_table_index.GetDataPtr<int64_t>(), output_allocator);
 
         neighbors_index = output_allocator.NeighborsIndex();
         neighbors_distance = output_allocator.NeighborsDistance();
@@ -85,14 +85,98 @@ public:
                                                     double radius,
                                                     int max_knn) const override;
 
+    /// Inserts points into the index without rebuilding the spatial hash of
+    /// the existing points. The new points are hashed into a separate pending
+    /// table, which is merged into the main table by Rebuild().
+    ///
+    /// \param points Points of shape {n, d}, same dtype and device with the
+    /// dataset points.
+    /// \return Int64 ids of the inserted points, of shape {n}. The ids of the
+    /// initial dataset points are 0, ..., num_dataset_points - 1, and search
+    /// results refer to points by id.
+    Tensor InsertPoints(const Tensor& points);
+
+    /// Removes points from the index. Removed points are excluded from search
+    /// results immediately, and dropped from the hash tables by Rebuild().
+    ///
+    /// \param ids Int64 ids of the points to remove, of shape {n}.
+    void RemovePoints(const Tensor& ids);
+
+    /// Merges the pending points into the main spatial hash and drops the
+    /// removed points. This is called automatically when the number of pending
+    /// and removed points exceeds GetRebuildFraction() of the main points.
+    void Rebuild();
+
+    /// Sets the fraction of the main points that pending and removed points
+    /// may reach before InsertPoints() and RemovePoints() trigger Rebuild().
+    void SetRebuildFraction(double rebuild_fraction);
+
+    double GetRebuildFraction() const { return rebuild_fraction_; }
+
+    /// Returns the number of points inserted since the last rebuild.
+    int64_t GetNumPendingPoints() const;
+
+    /// Returns the number of searchable points.
+    int64_t GetNumPoints() const;
+
     const double hash_table_size_factor = 1.0 / 32;
     const int64_t max_hash_tabls_size = 33554432;
 
 protected:
-    std::vector<int64_t> points_row_splits_;
-    std::vector<int64_t> hash_table_splits_;
-    Tensor hash_table_cell_splits_;
-    Tensor hash_table_index_;
+    /// Spatial hash table over a set of points, as built by
+    /// BuildSpatialHashTableCUDA.
+    struct SpatialHashTable {
+        std::vector<int64_t> points_row_splits;
+        std::vector<int64_t> hash_table_splits;
+        Tensor hash_table_cell_splits;
+        Tensor hash_table_index;
+    };
+
+    /// Builds \p table over \p points with cells of size radius_.
+    void BuildHashTable(const Tensor& points, SpatialHashTable& table) const;
+
+    /// Searches the points of a single table. The returned indices are
+    /// positions in \p points.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadiusInTable(
+            const Tensor& points,
+            const SpatialHashTable& table,
+            const Tensor& query_points,
+            double radius,
+            bool sort) const;
+
+    /// Hybrid search in the points of a single table. The returned indices
+    /// are positions in \p points.
+    std::tuple<Tensor, Tensor, Tensor> SearchHybridInTable(
+            const Tensor& points,
+            const SpatialHashTable& table,
+            const Tensor& query_points,
+            double radius,
+            int max_knn) const;
+
+    /// Radius search merging the main and pending tables and skipping the
+    /// removed points.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadiusUpdated(
+            const Tensor& query_points, double radius, bool sort) const;
+
+    /// Returns true if there are pending or removed points.
+    bool IsUpdated() const;
+
+    SpatialHashTable hash_table_;
+    SpatialHashTable pending_hash_table_;
+    /// Points inserted since the last rebuild.
+    Tensor pending_points_;
+    /// Ids of the dataset points and of the pending points.
+    Tensor point_ids_;
+    Tensor pending_ids_;
+    /// UInt8 flags indexed by id, 1 for removed points.
+    Tensor removed_;
+    double radius_ = 0;
+    double rebuild_fraction_ = 0.1;
+    int64_t next_id_ = 0;
+    /// Number of removed points that are still in the hash tables.
+    int64_t num_removed_ = 0;
+    /// True while point_ids_ is 0, ..., num_dataset_points - 1.
+    bool ids_are_positions_ = true;
 };
 
 template <class T>
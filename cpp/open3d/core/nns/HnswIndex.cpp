@@ -0,0 +1,480 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/HnswIndex.h"
+
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <random>
+#include <utility>
+
+#include "open3d/core/Dispatch.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+struct HnswGraph {
+    /// links_[i][l] are the neighbors of point i in layer l, for l from 0 to
+    /// the level of point i.
+    std::vector<std::vector<std::vector<int64_t>>> links_;
+    int64_t entry_point_ = -1;
+    int max_level_ = -1;
+};
+
+namespace {
+
+/// Marks the points visited by a search. Each search uses a new tag, so that
+/// the marks do not need to be cleared.
+class VisitedSet {
+public:
+    void Reset(int64_t size) {
+        if (tags_.size() < static_cast<size_t>(size)) {
+            tags_.resize(size, 0);
+        }
+        if (++tag_ == 0) {
+            std::fill(tags_.begin(), tags_.end(), 0);
+            tag_ = 1;
+        }
+    }
+
+    /// Returns false if \p i was already visited by the current search.
+    bool Visit(int64_t i) {
+        if (tags_[i] == tag_) {
+            return false;
+        }
+        tags_[i] = tag_;
+        return true;
+    }
+
+private:
+    std::vector<uint32_t> tags_;
+    uint32_t tag_ = 0;
+};
+
+/// Graph search and construction for one dtype. While the graph is built,
+/// \p locks guard the neighbor lists of the points; searches on a built graph
+/// pass no locks.
+template <typename scalar_t>
+class HnswSearcher {
+public:
+    /// (distance, point) pair, ordered by distance.
+    typedef std::pair<scalar_t, int64_t> Candidate;
+
+    HnswSearcher(HnswGraph &graph,
+                 const scalar_t *data,
+                 int64_t dimension,
+                 std::vector<std::mutex> *locks = nullptr)
+        : graph_(graph), data_(data), dimension_(dimension), locks_(locks) {}
+
+    scalar_t Distance(const scalar_t *query, int64_t point) const {
+        const scalar_t *p = data_ + point * dimension_;
+        scalar_t distance = 0;
+        for (int64_t k = 0; k < dimension_; ++k) {
+            const scalar_t diff = query[k] - p[k];
+            distance += diff * diff;
+        }
+        return distance;
+    }
+
+    /// Copies the neighbors of \p point in layer \p level to \p links.
+    void GetLinks(int64_t point,
+                  int level,
+                  std::vector<int64_t> &links) const {
+        if (locks_) {
+            std::lock_guard<std::mutex> lock((*locks_)[point]);
+            links = graph_.links_[point][level];
+        } else {
+            links = graph_.links_[point][level];
+        }
+    }
+
+    /// Walks from \p entry_point to the closest point to \p query in layer
+    /// \p level. \p distance is the distance of the entry point and is updated.
+    int64_t SearchClosest(const scalar_t *query,
+                          int64_t entry_point,
+                          scalar_t &distance,
+                          int level,
+                          std::vector<int64_t> &links) const {
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            GetLinks(entry_point, level, links);
+            for (int64_t neighbor : links) {
+                const scalar_t d = Distance(query, neighbor);
+                if (d < distance) {
+                    distance = d;
+                    entry_point = neighbor;
+                    changed = true;
+                }
+            }
+        }
+        return entry_point;
+    }
+
+    /// Best-first search in layer \p level keeping \p ef candidates. Returns
+    /// the candidates sorted by distance.
+    std::vector<Candidate> SearchLayer(const scalar_t *query,
+                                       const std::vector<Candidate> &entries,
+                                       int64_t ef,
+                                       int level,
+                                       std::vector<int64_t> &links) const {
+        thread_local VisitedSet visited;
+        visited.Reset(static_cast<int64_t>(graph_.links_.size()));
+        std::priority_queue<Candidate, std::vector<Candidate>,
+                            std::greater<Candidate>>
+                candidates;
+        std::priority_queue<Candidate> results;
+        for (const Candidate &entry : entries) {
+            if (visited.Visit(entry.second)) {
+                candidates.push(entry);
+                results.push(entry);
+                if (int64_t(results.size()) > ef) {
+                    results.pop();
+                }
+            }
+        }
+        while (!candidates.empty()) {
+            const Candidate current = candidates.top();
+            if (current.first > results.top().first) {
+                break;
+            }
+            candidates.pop();
+            GetLinks(current.second, level, links);
+            for (int64_t neighbor : links) {
+                if (!visited.Visit(neighbor)) {
+                    continue;
+                }
+                const scalar_t d = Distance(query, neighbor);
+                if (int64_t(results.size()) < ef || d < results.top().first) {
+                    candidates.emplace(d, neighbor);
+                    results.emplace(d, neighbor);
+                    if (int64_t(results.size()) > ef) {
+                        results.pop();
+                    }
+                }
+            }
+        }
+        std::vector<Candidate> sorted(results.size());
+        for (auto it = sorted.rbegin(); it != sorted.rend(); ++it) {
+            *it = results.top();
+            results.pop();
+        }
+        return sorted;
+    }
+
+    /// Selects up to \p max_links of the \p candidates sorted by distance,
+    /// skipping candidates closer to an already selected point than to the
+    /// query. This keeps links in diverse directions.
+    std::vector<int64_t> SelectNeighbors(
+            const std::vector<Candidate> &candidates,
+            int64_t max_links) const {
+        std::vector<int64_t> selected;
+        selected.reserve(max_links);
+        for (const Candidate &candidate : candidates) {
+            if (int64_t(selected.size()) >= max_links) {
+                break;
+            }
+            const scalar_t *p = data_ + candidate.second * dimension_;
+            bool diverse = true;
+            for (int64_t other : selected) {
+                if (Distance(p, other) < candidate.first) {
+                    diverse = false;
+                    break;
+                }
+            }
+            if (diverse) {
+                selected.push_back(candidate.second);
+            }
+        }
+        return selected;
+    }
+
+    /// Adds a link from \p point to \p neighbor in layer \p level, pruning the
+    /// neighbors of \p point to \p max_links.
+    void Connect(int64_t point,
+                 int64_t neighbor,
+                 int level,
+                 int64_t max_links) {
+        std::lock_guard<std::mutex> lock((*locks_)[point]);
+        std::vector<int64_t> &links = graph_.links_[point][level];
+        if (int64_t(links.size()) < max_links) {
+            links.push_back(neighbor);
+            return;
+        }
+        const scalar_t *p = data_ + point * dimension_;
+        std::vector<Candidate> candidates;
+        candidates.reserve(links.size() + 1);
+        for (int64_t link : links) {
+            candidates.emplace_back(Distance(p, link), link);
+        }
+        candidates.emplace_back(Distance(p, neighbor), neighbor);
+        std::sort(candidates.begin(), candidates.end());
+        links = SelectNeighbors(candidates, max_links);
+    }
+
+    /// Inserts \p point into all layers up to its level. The entry point of the
+    /// graph must exist.
+    void Insert(int64_t point, int m, int ef_construction, std::mutex &entry) {
+        const int level = int(graph_.links_[point].size()) - 1;
+        std::unique_lock<std::mutex> entry_lock(entry);
+        const int max_level = graph_.max_level_;
+        int64_t entry_point = graph_.entry_point_;
+        // A point that becomes the new entry point keeps the lock until it is
+        // connected.
+        if (level <= max_level) {
+            entry_lock.unlock();
+        }
+
+        const scalar_t *query = data_ + point * dimension_;
+        std::vector<int64_t> links;
+        scalar_t distance = Distance(query, entry_point);
+        for (int l = max_level; l > level; --l) {
+            entry_point =
+                    SearchClosest(query, entry_point, distance, l, links);
+        }
+        std::vector<Candidate> entries{Candidate(distance, entry_point)};
+        for (int l = std::min(level, max_level); l >= 0; --l) {
+            entries = SearchLayer(query, entries, ef_construction, l, links);
+            const int64_t max_links = l == 0 ? 2 * m : m;
+            std::vector<int64_t> neighbors = SelectNeighbors(entries, m);
+            {
+                std::lock_guard<std::mutex> lock((*locks_)[point]);
+                graph_.links_[point][l] = neighbors;
+            }
+            for (int64_t neighbor : neighbors) {
+                Connect(neighbor, point, l, max_links);
+            }
+        }
+        if (level > max_level) {
+            graph_.entry_point_ = point;
+            graph_.max_level_ = level;
+        }
+    }
+
+    /// Writes the \p knn nearest neighbors of \p query found with \p ef
+    /// candidates to \p indices and \p distances.
+    void Search(const scalar_t *query,
+                int64_t knn,
+                int64_t ef,
+                int64_t *indices,
+                scalar_t *distances) const {
+        std::vector<int64_t> links;
+        int64_t entry_point = graph_.entry_point_;
+        scalar_t distance = Distance(query, entry_point);
+        for (int l = graph_.max_level_; l > 0; --l) {
+            entry_point =
+                    SearchClosest(query, entry_point, distance, l, links);
+        }
+        const std::vector<Candidate> results =
+                SearchLayer(query, {Candidate(distance, entry_point)},
+                            std::max(ef, knn), 0, links);
+        const int64_t num_results =
+                std::min(knn, static_cast<int64_t>(results.size()));
+        for (int64_t k = 0; k < num_results; ++k) {
+            distances[k] = results[k].first;
+            indices[k] = results[k].second;
+        }
+    }
+
+private:
+    HnswGraph &graph_;
+    const scalar_t *data_;
+    int64_t dimension_;
+    std::vector<std::mutex> *locks_;
+};
+
+}  // namespace
+
+HnswIndex::HnswIndex(int m, int ef_construction)
+    : m_(m), ef_construction_(ef_construction) {
+    if (m < 2 || ef_construction < 1) {
+        utility::LogError(
+                "[HnswIndex] m must be at least 2 and ef_construction "
+                "positive, but got {} and {}.",
+                m, ef_construction);
+    }
+}
+
+HnswIndex::HnswIndex(const Tensor &dataset_points, int m, int ef_construction)
+    : HnswIndex(m, ef_construction) {
+    SetTensorData(dataset_points);
+}
+
+HnswIndex::~HnswIndex() {}
+
+bool HnswIndex::SetTensorData(const Tensor &dataset_points) {
+    if (dataset_points.NumDims() != 2) {
+        utility::LogError(
+                "[HnswIndex::SetTensorData] dataset_points must be 2D matrix, "
+                "with shape {n_dataset_points, d}.");
+    }
+    dataset_points.AssertDevice(Device("CPU:0"));
+    Dtype dtype = dataset_points.GetDtype();
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError(
+                "[HnswIndex::SetTensorData] dataset_points must be Float32 or "
+                "Float64, but got {}.",
+                dtype.ToString());
+    }
+    dataset_points_ = dataset_points.Contiguous();
+    const int64_t num_points = GetDatasetSize();
+    graph_.reset(new HnswGraph());
+    if (num_points == 0) {
+        return true;
+    }
+
+    // Levels follow a geometric distribution with ratio 1 / m. They are drawn
+    // sequentially, so that the layer sizes do not depend on the threads.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    const double level_scale = 1.0 / std::log(double(m_));
+    graph_->links_.resize(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        const int level = int(-std::log(1.0 - uniform(rng)) * level_scale);
+        graph_->links_[i].resize(level + 1);
+        graph_->links_[i][0].reserve(2 * m_ + 1);
+    }
+    graph_->entry_point_ = 0;
+    graph_->max_level_ = int(graph_->links_[0].size()) - 1;
+
+    std::vector<std::mutex> locks(num_points);
+    std::mutex entry;
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        HnswSearcher<scalar_t> searcher(*graph_,
+                                        dataset_points_.GetDataPtr<scalar_t>(),
+                                        GetDimension(), &locks);
+        tbb::parallel_for(tbb::blocked_range<int64_t>(1, num_points),
+                          [&](const tbb::blocked_range<int64_t> &r) {
+                              for (int64_t i = r.begin(); i != r.end(); ++i) {
+                                  searcher.Insert(i, m_, ef_construction_,
+                                                  entry);
+                              }
+                          });
+    });
+    return true;
+}
+
+void HnswIndex::SetEfSearch(int ef_search) {
+    if (ef_search <= 0) {
+        utility::LogError(
+                "[HnswIndex::SetEfSearch] ef_search must be positive, but got "
+                "{}.",
+                ef_search);
+    }
+    ef_search_ = ef_search;
+}
+
+std::pair<Tensor, Tensor> HnswIndex::SearchKnn(const Tensor &query_points,
+                                               int knn) const {
+    query_points.AssertDtype(GetDtype());
+    query_points.AssertDevice(GetDevice());
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+    if (knn <= 0) {
+        utility::LogError(
+                "[HnswIndex::SearchKnn] knn should be larger than 0.");
+    }
+
+    const int64_t num_queries = query_points.GetLength();
+    const int64_t num_neighbors =
+            std::min<int64_t>(knn, static_cast<int64_t>(GetDatasetSize()));
+    Tensor indices = Tensor::Full({num_queries, num_neighbors}, -1,
+                                  Dtype::Int64, GetDevice());
+    Tensor distances = Tensor::Zeros({num_queries, num_neighbors}, GetDtype(),
+                                     GetDevice());
+    if (num_queries == 0 || num_neighbors == 0) {
+        return std::make_pair(indices, distances);
+    }
+
+    const Tensor queries = query_points.Contiguous();
+    const int64_t dimension = GetDimension();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        const HnswSearcher<scalar_t> searcher(
+                *graph_, dataset_points_.GetDataPtr<scalar_t>(), dimension);
+        const scalar_t *query_ptr = queries.GetDataPtr<scalar_t>();
+        int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+        scalar_t *distances_ptr = distances.GetDataPtr<scalar_t>();
+        tbb::parallel_for(
+                tbb::blocked_range<int64_t>(0, num_queries),
+                [&](const tbb::blocked_range<int64_t> &r) {
+                    for (int64_t i = r.begin(); i != r.end(); ++i) {
+                        searcher.Search(query_ptr + i * dimension,
+                                        num_neighbors, ef_search_,
+                                        indices_ptr + i * num_neighbors,
+                                        distances_ptr + i * num_neighbors);
+                    }
+                });
+    });
+    return std::make_pair(indices, distances);
+}
+
+std::tuple<Tensor, Tensor, Tensor> HnswIndex::SearchHybrid(
+        const Tensor &query_points, double radius, int max_knn) const {
+    if (max_knn <= 0) {
+        utility::LogError(
+                "[HnswIndex::SearchHybrid] max_knn should be larger than 0.");
+    }
+    if (radius <= 0) {
+        utility::LogError(
+                "[HnswIndex::SearchHybrid] radius should be larger than 0.");
+    }
+
+    const int64_t num_queries = query_points.GetLength();
+    Tensor indices = Tensor::Full({num_queries, max_knn}, -1, Dtype::Int64,
+                                  GetDevice());
+    Tensor distances =
+            Tensor::Zeros({num_queries, max_knn}, GetDtype(), GetDevice());
+    Tensor knn_indices, knn_distances;
+    std::tie(knn_indices, knn_distances) = SearchKnn(query_points, max_knn);
+    const int64_t num_neighbors = knn_indices.GetShape()[1];
+    if (num_queries == 0 || num_neighbors == 0) {
+        return std::make_tuple(indices, distances,
+                               Tensor::Zeros({num_queries}, Dtype::Int64,
+                                             GetDevice()));
+    }
+
+    // The knn results are sorted, so the neighbors within the radius are a
+    // prefix of each row.
+    Tensor within =
+            knn_distances.Le(radius * radius).LogicalAnd(knn_indices.Ge(0));
+    Tensor within_int = within.To(Dtype::Int64);
+    indices.Slice(1, 0, num_neighbors) =
+            knn_indices.Add(1).Mul_(within_int).Sub_(1);
+    distances.Slice(1, 0, num_neighbors) =
+            knn_distances.Mul_(within.To(GetDtype()));
+    Tensor counts = within_int.Sum({1});
+    return std::make_tuple(indices, distances, counts);
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,148 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NNSIndex.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// Proximity graph layers of a HnswIndex.
+struct HnswGraph;
+
+/// \class HnswIndex
+///
+/// \brief Approximate knn index on CPU based on hierarchical navigable small
+/// world graphs (HNSW, Malkov and Yashunin, 2018).
+///
+/// Every point is inserted into a stack of proximity graphs whose upper layers
+/// hold exponentially fewer points. A query descends the layers greedily and
+/// then runs a best-first search over the bottom layer that keeps ef_search
+/// candidates, see SetEfSearch(). Larger m and ef_construction build a better
+/// connected graph at a higher build cost, and a larger ef_search increases
+/// the recall at a higher query cost. The returned neighbors are sorted by
+/// distance, but may miss some of the exact nearest neighbors.
+class HnswIndex : public NNSIndex {
+public:
+    /// \brief Default Constructor.
+    ///
+    /// \param m Number of graph neighbors per point in the upper layers. The
+    /// bottom layer keeps up to 2 * m neighbors per point.
+    /// \param ef_construction Number of candidates kept while inserting a
+    /// point into the graph.
+    explicit HnswIndex(int m = 16, int ef_construction = 200);
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param dataset_points Provides a set of data points as Tensor for the
+    /// graph construction.
+    /// \param m Number of graph neighbors per point, see HnswIndex().
+    /// \param ef_construction Number of candidates kept while inserting a
+    /// point into the graph.
+    HnswIndex(const Tensor &dataset_points,
+              int m = 16,
+              int ef_construction = 200);
+    ~HnswIndex();
+    HnswIndex(const HnswIndex &) = delete;
+    HnswIndex &operator=(const HnswIndex &) = delete;
+
+public:
+    /// Builds the graph. dataset_points must be a Float32 or Float64 CPU
+    /// tensor. The points are inserted in parallel.
+    bool SetTensorData(const Tensor &dataset_points) override;
+
+    bool SetTensorData(const Tensor &dataset_points, double radius) override {
+        utility::LogError(
+                "HnswIndex::SetTensorData with radius not implemented.");
+    }
+
+    /// Perform approximate K nearest neighbor search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}, same
+    /// dtype with dataset_points.
+    /// \param knn Number of nearest neighbor to search.
+    /// \return Pair of Tensors: (indices, distances):
+    /// - indices: Tensor of shape {n, min(knn, num_dataset_points)}, with
+    /// dtype Int64, padded with -1 if the search finds fewer neighbors.
+    /// - distainces: Tensor of shape {n, min(knn, num_dataset_points)}, same
+    /// dtype with dataset_points, padded with 0. The neighbors of each query
+    /// are sorted by distance.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn) const override;
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(const Tensor &query_points,
+                                                    const Tensor &radii,
+                                                    bool sort) const override {
+        utility::LogError("HnswIndex::SearchRadius not implemented.");
+    }
+
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(const Tensor &query_points,
+                                                    double radius,
+                                                    bool sort) const override {
+        utility::LogError("HnswIndex::SearchRadius not implemented.");
+    }
+
+    /// Perform approximate hybrid search, keeping the knn results within the
+    /// radius.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}.
+    /// \param radius Radius.
+    /// \param max_knn Maximum number of neighbor to search per query point.
+    /// \return Tuple of Tensors, (indices, distances, counts):
+    /// - indices: Tensor of shape {n, max_knn}, with dtype Int64, padded with
+    /// -1.
+    /// - distances: Tensor of shape {n, max_knn}, same dtype with
+    /// dataset_points, padded with 0.
+    /// - counts: Counts of neighbour for each query points. [Tensor
+    /// of shape {n}, with dtype Int64].
+    std::tuple<Tensor, Tensor, Tensor> SearchHybrid(const Tensor &query_points,
+                                                    double radius,
+                                                    int max_knn) const override;
+
+    /// Sets the number of candidates kept while searching the bottom layer.
+    /// At least knn candidates are always kept. The default is 64.
+    void SetEfSearch(int ef_search);
+
+    /// Get the number of candidates kept while searching the bottom layer.
+    int GetEfSearch() const { return ef_search_; }
+
+protected:
+    int m_;
+    int ef_construction_;
+    int ef_search_ = 64;
+    std::unique_ptr<HnswGraph> graph_;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,216 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/KDTreeIO.h"
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/NumpyIO.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+// File layout, with integers in little-endian byte order:
+//   char[8] magic "O3DKDT"
+//   uint32  format version
+//   uint32  point dtype, see PointDtype
+//   int64   number of points
+//   int64   dimension
+//   int64   byte size of the tree index type
+//   int64   offset of the points block from the beginning of the file
+//   Points, row-major, aligned to POINTS_ALIGNMENT bytes.
+//   Tree, as written by the tree serializer.
+static const char KDTREE_MAGIC[8] = {'O', '3', 'D', 'K', 'D', 'T', 0, 0};
+static constexpr uint32_t KDTREE_VERSION = 1;
+static constexpr int64_t POINTS_ALIGNMENT = 64;
+
+enum class PointDtype : uint32_t { Float32 = 0, Float64 = 1 };
+
+using FilePtr = std::unique_ptr<FILE, int (*)(FILE*)>;
+
+template <typename T>
+static bool WriteValue(FILE* fp, T value) {
+    return fwrite(&value, sizeof(T), 1, fp) == 1;
+}
+
+template <typename T>
+static bool ReadValue(FILE* fp, T& value) {
+    return fread(&value, sizeof(T), 1, fp) == 1;
+}
+
+static bool Seek(FILE* fp, int64_t offset) {
+#ifdef _WIN32
+    return _fseeki64(fp, offset, SEEK_SET) == 0;
+#else
+    return fseeko(fp, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
+
+void WriteKDTreeFile(const std::string& file_name,
+                     const Tensor& points,
+                     int64_t index_byte_size,
+                     const std::function<void(FILE*)>& write_tree) {
+    if (points.NumDims() != 2) {
+        utility::LogError(
+                "[WriteKDTreeFile] points must be 2D, with shape {n, d}, but "
+                "got {}.",
+                points.GetShape());
+    }
+    PointDtype point_dtype;
+    if (points.GetDtype() == Dtype::Float32) {
+        point_dtype = PointDtype::Float32;
+    } else if (points.GetDtype() == Dtype::Float64) {
+        point_dtype = PointDtype::Float64;
+    } else {
+        utility::LogError(
+                "[WriteKDTreeFile] points must be Float32 or Float64, but got "
+                "{}.",
+                points.GetDtype().ToString());
+    }
+    const Tensor cpu_points = points.To(Device("CPU:0")).Contiguous();
+    const int64_t num_bytes =
+            cpu_points.NumElements() * cpu_points.GetDtype().ByteSize();
+
+    FilePtr fp(fopen(file_name.c_str(), "wb"), fclose);
+    if (!fp) {
+        utility::LogError("[WriteKDTreeFile] Unable to open file {}.",
+                          file_name);
+    }
+    bool success = fwrite(KDTREE_MAGIC, sizeof(KDTREE_MAGIC), 1, fp.get()) == 1;
+    success = success && WriteValue<uint32_t>(fp.get(), KDTREE_VERSION);
+    success = success && WriteValue<uint32_t>(
+                                 fp.get(), static_cast<uint32_t>(point_dtype));
+    success = success && WriteValue<int64_t>(fp.get(), cpu_points.GetLength());
+    success = success &&
+              WriteValue<int64_t>(fp.get(), cpu_points.GetShape()[1]);
+    success = success && WriteValue<int64_t>(fp.get(), index_byte_size);
+    success = success && WriteValue<int64_t>(fp.get(), POINTS_ALIGNMENT);
+    // Pad the header up to the aligned points block.
+    const long header_bytes = success ? ftell(fp.get()) : -1;
+    if (header_bytes < 0 || header_bytes > POINTS_ALIGNMENT) {
+        success = false;
+    } else {
+        std::vector<char> padding(POINTS_ALIGNMENT - header_bytes, 0);
+        success = padding.empty() ||
+                  fwrite(padding.data(), 1, padding.size(), fp.get()) ==
+                          padding.size();
+    }
+    success = success &&
+              (num_bytes == 0 ||
+               fwrite(cpu_points.GetDataPtr(), 1, num_bytes, fp.get()) ==
+                       static_cast<size_t>(num_bytes));
+    if (!success) {
+        utility::LogError("[WriteKDTreeFile] Failed to write file {}.",
+                          file_name);
+    }
+    write_tree(fp.get());
+    if (fflush(fp.get()) != 0) {
+        utility::LogError("[WriteKDTreeFile] Failed to write file {}.",
+                          file_name);
+    }
+}
+
+Tensor ReadKDTreeFile(
+        const std::string& file_name,
+        int64_t index_byte_size,
+        Tensor::MmapMode mmap_mode,
+        const std::function<void(const Tensor&, FILE*)>& read_tree) {
+    FilePtr fp(fopen(file_name.c_str(), "rb"), fclose);
+    if (!fp) {
+        utility::LogError("[ReadKDTreeFile] Unable to open file {}.",
+                          file_name);
+    }
+    char magic[sizeof(KDTREE_MAGIC)];
+    uint32_t version = 0;
+    uint32_t point_dtype = 0;
+    int64_t num_points = 0;
+    int64_t dimension = 0;
+    int64_t file_index_byte_size = 0;
+    int64_t data_offset = 0;
+    bool success = fread(magic, sizeof(magic), 1, fp.get()) == 1 &&
+                   std::memcmp(magic, KDTREE_MAGIC, sizeof(magic)) == 0;
+    success = success && ReadValue(fp.get(), version) &&
+              version == KDTREE_VERSION;
+    success = success && ReadValue(fp.get(), point_dtype) &&
+              ReadValue(fp.get(), num_points) &&
+              ReadValue(fp.get(), dimension) &&
+              ReadValue(fp.get(), file_index_byte_size) &&
+              ReadValue(fp.get(), data_offset);
+    if (!success || num_points < 0 || dimension <= 0 || data_offset < 0) {
+        utility::LogError("[ReadKDTreeFile] {} is not a valid KD-tree file.",
+                          file_name);
+    }
+    if (file_index_byte_size != index_byte_size) {
+        utility::LogError(
+                "[ReadKDTreeFile] {} stores a tree with {}-byte indices, but "
+                "{}-byte indices are expected.",
+                file_name, file_index_byte_size, index_byte_size);
+    }
+    Dtype dtype;
+    if (point_dtype == static_cast<uint32_t>(PointDtype::Float32)) {
+        dtype = Dtype::Float32;
+    } else if (point_dtype == static_cast<uint32_t>(PointDtype::Float64)) {
+        dtype = Dtype::Float64;
+    } else {
+        utility::LogError("[ReadKDTreeFile] {} has an unknown point dtype {}.",
+                          file_name, point_dtype);
+    }
+
+    const SizeVector shape{num_points, dimension};
+    const int64_t num_bytes = shape.NumElements() * dtype.ByteSize();
+    Tensor points;
+    if (mmap_mode != Tensor::MmapMode::None && num_bytes > 0) {
+        std::shared_ptr<Blob> blob =
+                MapFile(file_name, data_offset, num_bytes,
+                        mmap_mode == Tensor::MmapMode::CopyOnWrite);
+        points = Tensor(shape, shape_util::DefaultStrides(shape),
+                        blob->GetDataPtr(), dtype, blob);
+    } else {
+        points = Tensor(shape, dtype);
+        success = Seek(fp.get(), data_offset) &&
+                  (num_bytes == 0 ||
+                   fread(points.GetDataPtr(), 1, num_bytes, fp.get()) ==
+                           static_cast<size_t>(num_bytes));
+        if (!success) {
+            utility::LogError("[ReadKDTreeFile] {} is truncated.", file_name);
+        }
+    }
+    if (!Seek(fp.get(), data_offset + num_bytes)) {
+        utility::LogError("[ReadKDTreeFile] {} is truncated.", file_name);
+    }
+    read_tree(points, fp.get());
+    return points;
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,76 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// Writes a prebuilt KD-tree to \p file_name. The file stores a header, the
+/// dataset points in a 64-byte aligned block that can be memory-mapped by
+/// ReadKDTreeFile(), and the tree itself, which is written by \p write_tree
+/// with the file positioned right after the points.
+///
+/// \param file_name Path to the file, typically with the extension ".o3dkd".
+/// \param points Dataset points with shape {n, d} and dtype Float32 or
+/// Float64.
+/// \param index_byte_size Size of the index type of the tree, checked when
+/// reading.
+/// \param write_tree Serializes the tree to the given file.
+void WriteKDTreeFile(const std::string& file_name,
+                     const Tensor& points,
+                     int64_t index_byte_size,
+                     const std::function<void(FILE*)>& write_tree);
+
+/// Reads a KD-tree written by WriteKDTreeFile().
+///
+/// \param file_name Path to the file.
+/// \param index_byte_size Size of the index type of the tree, must match the
+/// one written.
+/// \param mmap_mode If not MmapMode::None, the returned points are backed by
+/// the memory-mapped file, so that processes loading the same file share one
+/// copy of the points in the page cache. See Tensor::Load.
+/// \param read_tree Deserializes the tree from the given file, positioned
+/// right after the points. It is called with the loaded points, which outlive
+/// the call as long as the returned Tensor is alive.
+/// \return The dataset points, a contiguous CPU Tensor with shape {n, d}.
+Tensor ReadKDTreeFile(
+        const std::string& file_name,
+        int64_t index_byte_size,
+        Tensor::MmapMode mmap_mode,
+        const std::function<void(const Tensor&, FILE*)>& read_tree);
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
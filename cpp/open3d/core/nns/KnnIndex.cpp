@@ -0,0 +1,302 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/KnnIndex.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// Above this knn, neighbors are selected by sorting instead of ArgMin passes.
+static constexpr int64_t MAX_KNN_FOR_SELECTION = 16;
+
+/// Concatenates 1D tensors on the same device.
+static Tensor Concatenate1D(const std::vector<Tensor> &tensors,
+                            Dtype dtype,
+                            const Device &device) {
+    int64_t total = 0;
+    for (const Tensor &t : tensors) {
+        total += t.GetLength();
+    }
+    Tensor dst = Tensor::Empty({total}, dtype, device);
+    int64_t offset = 0;
+    for (const Tensor &t : tensors) {
+        const int64_t length = t.GetLength();
+        if (length > 0) {
+            dst.Slice(0, offset, offset + length) = t;
+        }
+        offset += length;
+    }
+    return dst;
+}
+
+KnnIndex::KnnIndex(){};
+
+KnnIndex::KnnIndex(const Tensor &dataset_points) {
+    SetTensorData(dataset_points);
+};
+
+KnnIndex::~KnnIndex(){};
+
+bool KnnIndex::SetTensorData(const Tensor &dataset_points) {
+    if (dataset_points.NumDims() != 2) {
+        utility::LogError(
+                "[KnnIndex::SetTensorData] dataset_points must be 2D matrix, "
+                "with shape {n_dataset_points, d}.");
+    }
+    Dtype dtype = dataset_points.GetDtype();
+    if (dtype != Dtype::Float32 && dtype != Dtype::Float64) {
+        utility::LogError(
+                "[KnnIndex::SetTensorData] dataset_points must be Float32 or "
+                "Float64, but got {}.",
+                dtype.ToString());
+    }
+    dataset_points_ = dataset_points.Contiguous();
+    return true;
+}
+
+void KnnIndex::SetTileSize(int64_t tile_size) {
+    if (tile_size <= 0) {
+        utility::LogError(
+                "[KnnIndex::SetTileSize] tile_size must be positive, but got "
+                "{}.",
+                tile_size);
+    }
+    tile_size_ = tile_size;
+}
+
+int64_t KnnIndex::GetQueriesPerTile() const {
+    const int64_t pair_size =
+            std::max<int64_t>(1, GetDatasetSize() * GetDimension());
+    return std::max<int64_t>(1, tile_size_ / pair_size);
+}
+
+Tensor KnnIndex::ComputeDistances(const Tensor &query_points) const {
+    const int64_t num_queries = query_points.GetLength();
+    const int64_t num_points = GetDatasetSize();
+    const int64_t dimension = GetDimension();
+    // Explicit differences keep the distances exact, matching the CPU path.
+    Tensor diff =
+            query_points.View({num_queries, 1, dimension})
+                    .Sub(dataset_points_.View({1, num_points, dimension}));
+    switch (metric_) {
+        case L1:
+            return diff.Abs_().Sum({2});
+        case Linf:
+            return diff.Abs_().Max({2});
+        default:
+            return diff.Mul_(diff).Sum({2});
+    }
+}
+
+Tensor KnnIndex::RadiiToThresholds(const Tensor &radii) const {
+    Tensor thresholds = radii.To(GetDevice());
+    return metric_ == L2 ? thresholds.Mul(thresholds) : thresholds;
+}
+
+std::pair<Tensor, Tensor> KnnIndex::SelectKnn(Tensor &distances,
+                                              int64_t knn) const {
+    const int64_t num_queries = distances.GetShape()[0];
+    const int64_t num_points = distances.GetShape()[1];
+    Device device = distances.GetDevice();
+    Dtype dtype = distances.GetDtype();
+
+    if (knn <= MAX_KNN_FOR_SELECTION) {
+        Tensor indices =
+                Tensor::Empty({num_queries, knn}, Dtype::Int64, device);
+        Tensor knn_distances =
+                Tensor::Empty({num_queries, knn}, dtype, device);
+        Tensor rows = Tensor::Arange(0, num_queries, 1, Dtype::Int64, device);
+        Tensor inf = Tensor::Full({num_queries},
+                                  std::numeric_limits<double>::infinity(),
+                                  dtype, device);
+        for (int64_t k = 0; k < knn; ++k) {
+            Tensor cols = distances.ArgMin({1});
+            indices.Slice(1, k, k + 1) = cols.View({num_queries, 1});
+            knn_distances.Slice(1, k, k + 1) =
+                    distances.IndexGet({rows, cols}).View({num_queries, 1});
+            distances.IndexSet({rows, cols}, inf);
+        }
+        return std::make_pair(indices, knn_distances);
+    }
+
+    // Sort all distances of the tile, then stably regroup them by row so that
+    // each row is in ascending order of distance.
+    Tensor flat_distances = distances.View({num_queries * num_points});
+    Tensor order = flat_distances.ArgSort();
+    Tensor order_rows = order.Div(num_points);
+    Tensor row_order = order_rows.ArgSort();
+    order = order.IndexGet({row_order}).View({num_queries, num_points});
+    order = order.Slice(1, 0, knn).Contiguous();
+    Tensor rows = Tensor::Arange(0, num_queries, 1, Dtype::Int64, device)
+                          .View({num_queries, 1});
+    Tensor indices = order.Sub(rows.Mul(num_points));
+    Tensor knn_distances =
+            flat_distances.IndexGet({order.View({num_queries * knn})})
+                    .View({num_queries, knn});
+    return std::make_pair(indices, knn_distances);
+}
+
+std::pair<Tensor, Tensor> KnnIndex::SearchKnn(const Tensor &query_points,
+                                              int knn) const {
+    query_points.AssertDtype(GetDtype());
+    query_points.AssertDevice(GetDevice());
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+    if (knn <= 0) {
+        utility::LogError("[KnnIndex::SearchKnn] knn should be larger than 0.");
+    }
+
+    const int64_t num_queries = query_points.GetLength();
+    const int64_t num_neighbors =
+            std::min<int64_t>(knn, static_cast<int64_t>(GetDatasetSize()));
+    Tensor indices = Tensor::Empty({num_queries, num_neighbors}, Dtype::Int64,
+                                   GetDevice());
+    Tensor distances = Tensor::Empty({num_queries, num_neighbors},
+                                     GetDtype(), GetDevice());
+    if (num_queries == 0 || num_neighbors == 0) {
+        return std::make_pair(indices, distances);
+    }
+
+    const int64_t queries_per_tile = GetQueriesPerTile();
+    for (int64_t start = 0; start < num_queries; start += queries_per_tile) {
+        const int64_t end = std::min(start + queries_per_tile, num_queries);
+        Tensor tile_distances =
+                ComputeDistances(query_points.Slice(0, start, end));
+        Tensor tile_indices;
+        std::tie(tile_indices, tile_distances) =
+                SelectKnn(tile_distances, num_neighbors);
+        indices.Slice(0, start, end) = tile_indices;
+        distances.Slice(0, start, end) = tile_distances;
+    }
+    return std::make_pair(indices, distances);
+}
+
+std::tuple<Tensor, Tensor, Tensor> KnnIndex::SearchRadius(
+        const Tensor &query_points, const Tensor &radii, bool sort) const {
+    query_points.AssertDtype(GetDtype());
+    query_points.AssertDevice(GetDevice());
+    radii.AssertDtype(GetDtype());
+    const int64_t num_queries = query_points.GetLength();
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+    radii.AssertShape({num_queries});
+    if (radii.Le(0).Any()) {
+        utility::LogError(
+                "[KnnIndex::SearchRadius] radius should be larger than 0.");
+    }
+
+    Device device = GetDevice();
+    Tensor thresholds = RadiiToThresholds(radii);
+    Tensor counts = Tensor::Zeros({num_queries}, Dtype::Int64, device);
+    std::vector<Tensor> tile_indices;
+    std::vector<Tensor> tile_distances;
+
+    const int64_t queries_per_tile = GetQueriesPerTile();
+    for (int64_t start = 0; start < num_queries; start += queries_per_tile) {
+        const int64_t end = std::min(start + queries_per_tile, num_queries);
+        Tensor distances = ComputeDistances(query_points.Slice(0, start, end));
+        Tensor within = distances.Le(
+                thresholds.Slice(0, start, end).View({end - start, 1}));
+        counts.Slice(0, start, end) = within.To(Dtype::Int64).Sum({1});
+
+        // NonZero is row-major, so the neighbors are grouped by query and
+        // sorted by index.
+        Tensor nonzero = within.NonZero();
+        Tensor rows = nonzero[0];
+        Tensor cols = nonzero[1];
+        Tensor neighbor_distances = distances.IndexGet({rows, cols});
+        if (sort && cols.GetLength() > 0) {
+            Tensor order = neighbor_distances.ArgSort();
+            order = order.IndexGet({rows.IndexGet({order}).ArgSort()});
+            cols = cols.IndexGet({order});
+            neighbor_distances = neighbor_distances.IndexGet({order});
+        }
+        tile_indices.push_back(cols);
+        tile_distances.push_back(neighbor_distances);
+    }
+
+    Tensor row_splits = Tensor::Zeros({num_queries + 1}, Dtype::Int64, device);
+    if (num_queries > 0) {
+        row_splits.Slice(0, 1, num_queries + 1) = counts.CumSum(0);
+    }
+    return std::make_tuple(Concatenate1D(tile_indices, Dtype::Int64, device),
+                           Concatenate1D(tile_distances, GetDtype(), device),
+                           row_splits);
+}
+
+std::tuple<Tensor, Tensor, Tensor> KnnIndex::SearchRadius(
+        const Tensor &query_points, double radius, bool sort) const {
+    const int64_t num_queries = query_points.GetLength();
+    Tensor radii = Tensor::Full({num_queries}, radius, GetDtype(), GetDevice());
+    return SearchRadius(query_points, radii, sort);
+}
+
+std::tuple<Tensor, Tensor, Tensor> KnnIndex::SearchHybrid(
+        const Tensor &query_points, double radius, int max_knn) const {
+    query_points.AssertDtype(GetDtype());
+    query_points.AssertDevice(GetDevice());
+    query_points.AssertShapeCompatible({utility::nullopt, GetDimension()});
+    if (max_knn <= 0) {
+        utility::LogError(
+                "[KnnIndex::SearchHybrid] max_knn should be larger than 0.");
+    }
+    if (radius <= 0) {
+        utility::LogError(
+                "[KnnIndex::SearchHybrid] radius should be larger than 0.");
+    }
+
+    const int64_t num_queries = query_points.GetLength();
+    Tensor indices = Tensor::Full({num_queries, max_knn}, -1, Dtype::Int64,
+                                  GetDevice());
+    Tensor distances =
+            Tensor::Zeros({num_queries, max_knn}, GetDtype(), GetDevice());
+    Tensor counts = Tensor::Zeros({num_queries}, Dtype::Int64, GetDevice());
+    if (num_queries == 0 || GetDatasetSize() == 0) {
+        return std::make_tuple(indices, distances, counts);
+    }
+
+    // The knn results are sorted, so the neighbors within the radius are a
+    // prefix of each row.
+    Tensor knn_indices, knn_distances;
+    std::tie(knn_indices, knn_distances) = SearchKnn(query_points, max_knn);
+    const int64_t num_neighbors = knn_indices.GetShape()[1];
+    Tensor within = knn_distances.Le(metric_ == L2 ? radius * radius : radius);
+    Tensor within_int = within.To(Dtype::Int64);
+    indices.Slice(1, 0, num_neighbors) =
+            knn_indices.Add(1).Mul_(within_int).Sub_(1);
+    distances.Slice(1, 0, num_neighbors) =
+            knn_distances.Mul_(within.To(GetDtype()));
+    counts = within_int.Sum({1});
+    return std::make_tuple(indices, distances, counts);
+}
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
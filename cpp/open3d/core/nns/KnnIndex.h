@@ -0,0 +1,166 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NNSIndex.h"
+#include "open3d/core/nns/NeighborSearchCommon.h"
+
+namespace open3d {
+namespace core {
+namespace nns {
+
+/// \class KnnIndex
+///
+/// \brief Brute-force index for knn, multi-radius and hybrid search on any
+/// device.
+///
+/// The queries are processed in tiles (see KnnIndex::GetTileSize()). For each
+/// tile, the distances to all dataset points are evaluated with Tensor
+/// operations, so the search runs natively on CUDA tensors without copying the
+/// points to the host. Small knn values are selected with repeated ArgMin
+/// passes, larger ones by sorting the distances of each tile. The returned
+/// layouts follow NanoFlannIndex.
+///
+/// The metric defaults to L2, for which squared distances are returned and
+/// compared against squared radii. For L1 and Linf the plain distances are
+/// used.
+class KnnIndex : public NNSIndex {
+public:
+    /// \brief Default Constructor.
+    KnnIndex();
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param dataset_points Provides a set of data points as Tensor for the
+    /// search.
+    KnnIndex(const Tensor &dataset_points);
+    ~KnnIndex();
+    KnnIndex(const KnnIndex &) = delete;
+    KnnIndex &operator=(const KnnIndex &) = delete;
+
+public:
+    bool SetTensorData(const Tensor &dataset_points) override;
+
+    /// The radius is not needed for building the index and is ignored.
+    bool SetTensorData(const Tensor &dataset_points, double radius) override {
+        return SetTensorData(dataset_points);
+    }
+
+    /// Perform K nearest neighbor search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}, same
+    /// dtype and device with dataset_points.
+    /// \param knn Number of nearest neighbor to search.
+    /// \return Pair of Tensors: (indices, distances):
+    /// - indices: Tensor of shape {n, min(knn, num_dataset_points)}, with
+    /// dtype Int64.
+    /// - distainces: Tensor of shape {n, min(knn, num_dataset_points)}, same
+    /// dtype with dataset_points. The neighbors of each query are sorted by
+    /// distance.
+    std::pair<Tensor, Tensor> SearchKnn(const Tensor &query_points,
+                                        int knn) const override;
+
+    /// Perform radius search with multiple radii.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}, same
+    /// dtype and device with dataset_points.
+    /// \param radii list of radius. Must be 1D, with shape {n, }.
+    /// \param sort If true, the neighbors of each query are sorted by
+    /// distance, otherwise by index.
+    /// \return Tuple of Tensors: (indices, distances, row_splits):
+    /// - indicecs: Tensor of shape {total_num_neighbors,}, dtype Int64.
+    /// - distances: Tensor of shape {total_num_neighbors,}, same dtype with
+    /// dataset_points.
+    /// - row_splits: Tensor of shape {n + 1,}, dtype Int64.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points,
+            const Tensor &radii,
+            bool sort = true) const override;
+
+    /// Perform radius search. See the multi-radii overload.
+    std::tuple<Tensor, Tensor, Tensor> SearchRadius(
+            const Tensor &query_points,
+            double radius,
+            bool sort = true) const override;
+
+    /// Perform hybrid search.
+    ///
+    /// \param query_points Query points. Must be 2D, with shape {n, d}.
+    /// \param radius Radius.
+    /// \param max_knn Maximum number of neighbor to search per query point.
+    /// \return Tuple of Tensors, (indices, distances, counts):
+    /// - indices: Tensor of shape {n, max_knn}, with dtype Int64, padded with
+    /// -1.
+    /// - distances: Tensor of shape {n, max_knn}, same dtype with
+    /// dataset_points, padded with 0.
+    /// - counts: Counts of neighbour for each query points. [Tensor
+    /// of shape {n}, with dtype Int64].
+    std::tuple<Tensor, Tensor, Tensor> SearchHybrid(const Tensor &query_points,
+                                                    double radius,
+                                                    int max_knn) const override;
+
+    /// Sets the maximum number of query-dataset coordinate pairs evaluated at
+    /// once, which bounds the temporary memory of a search. The default is
+    /// 1 << 22.
+    void SetTileSize(int64_t tile_size);
+
+    /// Get the maximum number of query-dataset coordinate pairs evaluated at
+    /// once.
+    int64_t GetTileSize() const { return tile_size_; }
+
+    /// Sets the distance metric used by all searches.
+    void SetMetric(Metric metric) { metric_ = metric; }
+
+    /// Get the distance metric.
+    Metric GetMetric() const { return metric_; }
+
+protected:
+    /// Returns the number of queries processed per tile.
+    int64_t GetQueriesPerTile() const;
+
+    /// Returns the {m, num_dataset_points} distances between the queries and
+    /// the dataset points, squared for L2.
+    Tensor ComputeDistances(const Tensor &query_points) const;
+
+    /// Returns the distance threshold corresponding to \p radii, i.e. the
+    /// squared radii for L2.
+    Tensor RadiiToThresholds(const Tensor &radii) const;
+
+    /// Selects the \p knn nearest dataset points in each row of \p distances,
+    /// sorted by distance. \p distances is modified.
+    std::pair<Tensor, Tensor> SelectKnn(Tensor &distances, int64_t knn) const;
+
+    int64_t tile_size_ = 1 << 22;
+    Metric metric_ = L2;
+};
+
+}  // namespace nns
+}  // namespace core
+}  // namespace open3d
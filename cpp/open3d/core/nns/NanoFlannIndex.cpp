@@ -32,6 +32,7 @@
 #include <nanoflann.hpp>
 
 #include "open3d/core/Dispatch.h"
+#include "open3d/core/nns/KDTreeIO.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/ParallelScan.h"
 
@@ -67,6 +68,36 @@ bool NanoFlannIndex::SetTensorData(const Tensor &dataset_points) {
     return true;
 };
 
+void NanoFlannIndex::Save(const std::string &file_name) const {
+    if (!holder_) {
+        utility::LogError(
+                "[NanoFlannIndex::Save] The index is empty, call "
+                "SetTensorData first.");
+    }
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(GetDtype(), [&]() {
+        auto holder = static_cast<NanoFlannIndexHolder<L2, scalar_t> *>(
+                holder_.get());
+        WriteKDTreeFile(file_name, dataset_points_, sizeof(int64_t),
+                        [&](FILE *fp) { holder->SaveIndex(fp); });
+    });
+}
+
+bool NanoFlannIndex::Load(const std::string &file_name,
+                          Tensor::MmapMode mmap_mode) {
+    holder_.reset();
+    dataset_points_ = ReadKDTreeFile(
+            file_name, sizeof(int64_t), mmap_mode,
+            [&](const Tensor &points, FILE *fp) {
+                DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+                    holder_.reset(new NanoFlannIndexHolder<L2, scalar_t>(
+                            points.GetLength(),
+                            static_cast<int>(points.GetShape()[1]),
+                            points.GetDataPtr<scalar_t>(), fp));
+                });
+            });
+    return true;
+}
+
 std::pair<Tensor, Tensor> NanoFlannIndex::SearchKnn(const Tensor &query_points,
                                                     int knn) const {
     // Check dtype.
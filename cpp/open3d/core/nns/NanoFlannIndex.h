@@ -26,10 +26,12 @@
 
 #pragma once
 
+#include <cstdio>
 #include <vector>
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/nns/NNSIndex.h"
+#include "open3d/core/nns/NeighborSearchCommon.h"
 #include "open3d/utility/Logging.h"
 
 // Forward declarations.
@@ -51,9 +53,6 @@ namespace open3d {
 namespace core {
 namespace nns {
 
-/// Distance metric enum.
-enum Metric { L1, L2, Linf };
-
 /// Base struct for Index holder
 struct NanoFlannIndexHolderBase {
     virtual ~NanoFlannIndexHolderBase() {}
@@ -115,6 +114,18 @@ struct NanoFlannIndexHolder : NanoFlannIndexHolderBase {
         index_->buildIndex();
     }
 
+    /// Restores a tree saved with SaveIndex() instead of building it.
+    NanoFlannIndexHolder(size_t dataset_size,
+                         int dimension,
+                         const T *data_ptr,
+                         FILE *index_file) {
+        adaptor_.reset(new DataAdaptor(dataset_size, dimension, data_ptr));
+        index_.reset(new KDTree_t(dimension, *adaptor_.get()));
+        index_->loadIndex(index_file);
+    }
+
+    void SaveIndex(FILE *index_file) const { index_->saveIndex(index_file); }
+
     std::unique_ptr<KDTree_t> index_;
     std::unique_ptr<DataAdaptor> adaptor_;
 };
@@ -200,6 +211,23 @@ public:
                                                     double radius,
                                                     int max_knn) const override;
 
+    /// Save the dataset points and the built tree to a file, so that the
+    /// index can be restored by Load() without rebuilding the tree.
+    ///
+    /// \param file_name Path to the file, typically with the extension
+    /// ".o3dkd".
+    void Save(const std::string &file_name) const;
+
+    /// Load an index saved by Save(), replacing the current dataset points.
+    ///
+    /// \param file_name Path to the file.
+    /// \param mmap_mode If not MmapMode::None, the dataset points are backed
+    /// by the memory-mapped file instead of being read, so that processes
+    /// loading the same file share one copy of the points in the page cache.
+    /// The tree nodes are always read into memory.
+    bool Load(const std::string &file_name,
+              Tensor::MmapMode mmap_mode = Tensor::MmapMode::ReadOnly);
+
 protected:
     // Tensor dataset_points_;
     std::unique_ptr<NanoFlannIndexHolderBase> holder_;
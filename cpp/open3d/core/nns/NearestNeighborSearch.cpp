@@ -26,6 +26,9 @@
 
 #include "open3d/core/nns/NearestNeighborSearch.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -39,29 +42,82 @@ bool NearestNeighborSearch::SetIndex() {
     return nanoflann_index_->SetTensorData(dataset_points_);
 };
 
+bool NearestNeighborSearch::SetKnnIndex() {
+    knn_index_.reset(new nns::KnnIndex());
+    return knn_index_->SetTensorData(dataset_points_);
+}
+
 bool NearestNeighborSearch::KnnIndex() {
+    hnsw_index_.reset();
+    faiss_index_.reset();
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
 #ifdef WITH_FAISS
         faiss_index_.reset(new FaissIndex());
         return faiss_index_->SetTensorData(dataset_points_);
 #else
-        utility::LogError(
-                "[NearestNeighborSearch::KnnIndex] Currently, Faiss is "
-                "disabled. Please recompile Open3D with WITH_FAISS=ON.");
+        return SetKnnIndex();
 #endif
     } else {
         return SetIndex();
     }
 };
 
-bool NearestNeighborSearch::MultiRadiusIndex() { return SetIndex(); };
+bool NearestNeighborSearch::ApproximateKnnIndex(
+        const ApproximateKnnParams& params) {
+    hnsw_index_.reset();
+    faiss_index_.reset();
+    if (params.method == ApproximateKnnMethod::HNSW) {
+        if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
+            utility::LogError(
+                    "[NearestNeighborSearch::ApproximateKnnIndex] HNSW "
+                    "requires CPU tensors.");
+        }
+        hnsw_index_.reset(
+                new HnswIndex(params.hnsw_m, params.hnsw_ef_construction));
+        hnsw_index_->SetEfSearch(params.hnsw_ef_search);
+        return hnsw_index_->SetTensorData(dataset_points_);
+    }
+#ifdef WITH_FAISS
+    const int64_t dataset_size = dataset_points_.GetLength();
+    const int dimension = int(dataset_points_.GetShape()[1]);
+    int nlist = params.ivf_nlist;
+    if (nlist <= 0) {
+        nlist = std::max(1, int(4 * std::sqrt(double(dataset_size))));
+    }
+    int pq_m = params.pq_m;
+    if (pq_m <= 0) {
+        pq_m = 1;
+        for (int m = dimension / 2; m > 1; --m) {
+            if (dimension % m == 0) {
+                pq_m = m;
+                break;
+            }
+        }
+    }
+    faiss_index_.reset(new FaissIndex());
+    return faiss_index_->SetTensorDataIVFPQ(dataset_points_, nlist, pq_m,
+                                            params.pq_nbits,
+                                            params.ivf_nprobe);
+#else
+    utility::LogError(
+            "[NearestNeighborSearch::ApproximateKnnIndex] IVF-PQ requires "
+            "Faiss. Please recompile Open3D with WITH_FAISS=ON.");
+#endif
+}
+
+bool NearestNeighborSearch::MultiRadiusIndex() {
+    if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
+        return SetKnnIndex();
+    } else {
+        return SetIndex();
+    }
+};
 
 bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
-        if (!radius.has_value())
-            utility::LogError(
-                    "[NearestNeighborSearch::FixedRadiusIndex] radius is "
-                    "required for GPU FixedRadiusIndex.");
+        if (!radius.has_value()) {
+            return SetKnnIndex();
+        }
 #ifdef BUILD_CUDA_MODULE
         fixed_radius_index_.reset(new nns::FixedRadiusIndex());
         return fixed_radius_index_->SetTensorData(dataset_points_,
@@ -80,10 +136,9 @@ bool NearestNeighborSearch::FixedRadiusIndex(utility::optional<double> radius) {
 
 bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
     if (dataset_points_.GetDevice().GetType() == Device::DeviceType::CUDA) {
-        if (!radius.has_value())
-            utility::LogError(
-                    "[NearestNeighborSearch::HybridIndex] radius is "
-                    "required for GPU HybridIndex.");
+        if (!radius.has_value()) {
+            return SetKnnIndex();
+        }
 #ifdef BUILD_CUDA_MODULE
         fixed_radius_index_.reset(new nns::FixedRadiusIndex());
         return fixed_radius_index_->SetTensorData(dataset_points_,
@@ -102,12 +157,17 @@ bool NearestNeighborSearch::HybridIndex(utility::optional<double> radius) {
 
 std::pair<Tensor, Tensor> NearestNeighborSearch::KnnSearch(
         const Tensor& query_points, int knn) {
+    if (hnsw_index_) {
+        return hnsw_index_->SearchKnn(query_points, knn);
+    }
 #ifdef WITH_FAISS
     if (faiss_index_) {
         return faiss_index_->SearchKnn(query_points, knn);
     }
 #endif
-    if (nanoflann_index_) {
+    if (knn_index_) {
+        return knn_index_->SearchKnn(query_points, knn);
+    } else if (nanoflann_index_) {
         return nanoflann_index_->SearchKnn(query_points, knn);
     } else {
         utility::LogError(
@@ -121,6 +181,8 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
         if (fixed_radius_index_) {
             return fixed_radius_index_->SearchRadius(query_points, radius,
                                                      sort);
+        } else if (knn_index_) {
+            return knn_index_->SearchRadius(query_points, radius, sort);
         } else {
             utility::LogError(
                     "[NearsetNeighborSearch::FixedRadiusSearch] Index is not "
@@ -139,8 +201,7 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::FixedRadiusSearch(
 
 std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
         const Tensor& query_points, const Tensor& radii) {
-    AssertNotCUDA(query_points);
-    if (!nanoflann_index_) {
+    if (!nanoflann_index_ && !knn_index_) {
         utility::LogError(
                 "[NearestNeighborSearch::MultiRadiusSearch] Index is not set.");
     }
@@ -155,6 +216,9 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::MultiRadiusSearch(
                 "[NearsetNeighborSearch::MultiRadiusSearch] radii and data "
                 "have different data type.");
     }
+    if (knn_index_) {
+        return knn_index_->SearchRadius(query_points, radii);
+    }
     return nanoflann_index_->SearchRadius(query_points, radii);
 }
 
@@ -164,6 +228,8 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::HybridSearch(
         if (fixed_radius_index_) {
             return fixed_radius_index_->SearchHybrid(query_points, radius,
                                                      max_knn);
+        } else if (knn_index_) {
+            return knn_index_->SearchHybrid(query_points, radius, max_knn);
         } else {
             utility::LogError(
                     "[NearestNeighborSearch::HybridSearch] Index is not set.");
@@ -179,14 +245,6 @@ std::tuple<Tensor, Tensor, Tensor> NearestNeighborSearch::HybridSearch(
     }
 }
 
-void NearestNeighborSearch::AssertNotCUDA(const Tensor& t) const {
-    if (t.GetDevice().GetType() == Device::DeviceType::CUDA) {
-        utility::LogError(
-                "TODO: NearestNeighborSearch does not support CUDA tensor "
-                "yet.");
-    }
-}
-
 }  // namespace nns
 }  // namespace core
 }  // namespace open3d
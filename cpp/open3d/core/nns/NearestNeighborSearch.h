@@ -31,6 +31,8 @@
 #include "open3d/core/Tensor.h"
 #include "open3d/core/nns/FaissIndex.h"
 #include "open3d/core/nns/FixedRadiusIndex.h"
+#include "open3d/core/nns/HnswIndex.h"
+#include "open3d/core/nns/KnnIndex.h"
 #include "open3d/core/nns/NanoFlannIndex.h"
 #include "open3d/utility/Optional.h"
 
@@ -38,6 +40,45 @@ namespace open3d {
 namespace core {
 namespace nns {
 
+/// Approximate knn index types, see
+/// NearestNeighborSearch::ApproximateKnnIndex().
+enum class ApproximateKnnMethod {
+    /// Built-in hierarchical navigable small world graph on CPU, see
+    /// HnswIndex.
+    HNSW,
+    /// Faiss inverted file with product quantization on CPU or CUDA, see
+    /// FaissIndex::SetTensorDataIVFPQ(). Requires Open3D to be built with
+    /// WITH_FAISS=ON.
+    IVFPQ,
+};
+
+/// Parameters of an approximate knn index, trading recall for speed.
+struct ApproximateKnnParams {
+    ApproximateKnnMethod method = ApproximateKnnMethod::HNSW;
+
+    /// HNSW: number of graph neighbors per point. Larger values increase the
+    /// recall, the memory and the build time.
+    int hnsw_m = 16;
+    /// HNSW: number of candidates kept while building the graph.
+    int hnsw_ef_construction = 200;
+    /// HNSW: number of candidates kept while searching, at least knn. Larger
+    /// values increase the recall and the query time.
+    int hnsw_ef_search = 64;
+
+    /// IVF-PQ: number of inverted lists. If 0, about 4 * sqrt(n) lists are
+    /// used for n dataset points.
+    int ivf_nlist = 0;
+    /// IVF-PQ: number of inverted lists visited per query. Larger values
+    /// increase the recall and the query time.
+    int ivf_nprobe = 16;
+    /// IVF-PQ: number of sub-quantizers, must divide the dimension. If 0, the
+    /// largest divisor of the dimension with at least two dimensions per
+    /// sub-quantizer is used.
+    int pq_m = 0;
+    /// IVF-PQ: number of bits per sub-quantizer code.
+    int pq_nbits = 8;
+};
+
 /// \class NearestNeighborSearch
 ///
 /// \brief A Class for nearest neighbor search.
@@ -55,24 +96,39 @@ public:
     NearestNeighborSearch &operator=(const NearestNeighborSearch &) = delete;
 
 public:
-    /// Set index for knn search.
+    /// Set index for knn search. CUDA tensors use the Faiss index when Open3D
+    /// is built with WITH_FAISS=ON, and the native brute-force KnnIndex
+    /// otherwise. This replaces an index set by ApproximateKnnIndex().
     ///
     /// \return Returns true if building index success, otherwise false.
     bool KnnIndex();
 
-    /// Set index for multi-radius search.
+    /// Set an approximate index for knn search, used by KnnSearch() instead
+    /// of the exact index until KnnIndex() is called again.
+    ///
+    /// \param params Index type and recall/speed parameters. HNSW requires a
+    /// CPU dataset, IVF-PQ a Float32 dataset.
+    /// \return Returns true if building index success, otherwise false.
+    bool ApproximateKnnIndex(
+            const ApproximateKnnParams &params = ApproximateKnnParams());
+
+    /// Set index for multi-radius search. CUDA tensors use the brute-force
+    /// KnnIndex.
     ///
     /// \return Returns true if building index success, otherwise false.
     bool MultiRadiusIndex();
 
     /// Set index for fixed-radius search.
     ///
-    /// \param radius optional radius parameter. required for gpu fixed radius
-    /// index. \return Returns true if building index success, otherwise false.
+    /// \param radius optional radius parameter. For CUDA tensors, the grid
+    /// based FixedRadiusIndex is built when the radius is given, and the
+    /// brute-force KnnIndex otherwise.
+    /// \return Returns true if building index success, otherwise false.
     bool FixedRadiusIndex(utility::optional<double> radius = {});
 
     /// Set index for hybrid search.
     ///
+    /// \param radius optional radius parameter. See FixedRadiusIndex().
     /// \return Returns true if building index success, otherwise false.
     bool HybridIndex(utility::optional<double> radius = {});
 
@@ -133,13 +189,15 @@ public:
 private:
     bool SetIndex();
 
-    /// Assert a Tensor is not CUDA tensoer. This will be removed in the future.
-    void AssertNotCUDA(const Tensor &t) const;
+    /// Builds the brute-force index used for CUDA tensors.
+    bool SetKnnIndex();
 
 protected:
     std::unique_ptr<NanoFlannIndex> nanoflann_index_;
     std::unique_ptr<FaissIndex> faiss_index_;
     std::unique_ptr<nns::FixedRadiusIndex> fixed_radius_index_;
+    std::unique_ptr<nns::KnnIndex> knn_index_;
+    std::unique_ptr<HnswIndex> hnsw_index_;
     const Tensor dataset_points_;
 };
 }  // namespace nns
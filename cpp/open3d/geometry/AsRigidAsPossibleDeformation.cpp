@@ -0,0 +1,291 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/AsRigidAsPossibleDeformation.h"
+
+#include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <algorithm>
+#include <chrono>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace geometry {
+
+struct AsRigidAsPossibleDeformation::Solver {
+    Eigen::SparseLU<Eigen::SparseMatrix<double>> lu;
+};
+
+AsRigidAsPossibleDeformation::AsRigidAsPossibleDeformation(
+        const TriangleMesh &mesh,
+        const std::vector<int> &constraint_vertex_indices,
+        MeshBase::DeformAsRigidAsPossibleEnergy energy,
+        double smoothed_alpha)
+    : vertices_(mesh.vertices_),
+      triangles_(mesh.triangles_),
+      energy_model_(energy),
+      smoothed_alpha_(smoothed_alpha),
+      constraint_vertex_indices_(constraint_vertex_indices),
+      solver_(new Solver()) {
+    const int num_vertices = int(vertices_.size());
+
+    utility::LogDebug("[DeformAsRigidAsPossible] setting up S'");
+    TriangleMesh rest;
+    rest.vertices_ = vertices_;
+    rest.triangles_ = triangles_;
+    rest.ComputeAdjacencyList();
+    auto edges_to_vertices = rest.GetEdgeToVerticesMap();
+    auto edge_weights =
+            rest.ComputeEdgeWeightsCot(edges_to_vertices, /*min_weight=*/0);
+    if (energy_model_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed) {
+        surface_area_ = rest.GetSurfaceArea();
+    }
+
+    // Flat adjacency with the edge weights, so that the iterations do not
+    // hash edges.
+    offsets_.resize(num_vertices + 1, 0);
+    for (int i = 0; i < num_vertices; ++i) {
+        offsets_[i + 1] = offsets_[i] + int(rest.adjacency_list_[i].size());
+    }
+    neighbors_.resize(offsets_.back());
+    weights_.resize(offsets_.back());
+    for (int i = 0; i < num_vertices; ++i) {
+        auto begin = neighbors_.begin() + offsets_[i];
+        std::copy(rest.adjacency_list_[i].begin(),
+                  rest.adjacency_list_[i].end(), begin);
+        std::sort(begin, neighbors_.begin() + offsets_[i + 1]);
+        for (int k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+            weights_[k] = edge_weights.at(
+                    TriangleMesh::GetOrderedEdge(i, neighbors_[k]));
+        }
+    }
+    utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
+
+    constraint_slots_.resize(num_vertices, -1);
+    constraint_positions_.resize(constraint_vertex_indices_.size());
+    for (size_t idx = 0; idx < constraint_vertex_indices_.size(); ++idx) {
+        const int vidx = constraint_vertex_indices_[idx];
+        if (vidx < 0 || vidx >= num_vertices) {
+            utility::LogError(
+                    "[DeformAsRigidAsPossible] Constraint vertex index {} is "
+                    "out of range.",
+                    vidx);
+        }
+        // The last constraint of a vertex wins.
+        constraint_slots_[vidx] = int(idx);
+        constraint_positions_[idx] = vertices_[vidx];
+    }
+
+    // Build system matrix L and factorize it once for all iterations.
+    utility::LogDebug("[DeformAsRigidAsPossible] setting up system matrix L");
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(neighbors_.size() + num_vertices);
+    for (int i = 0; i < num_vertices; ++i) {
+        if (constraint_slots_[i] >= 0) {
+            triplets.push_back(Eigen::Triplet<double>(i, i, 1));
+        } else {
+            double W = 0;
+            for (int k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+                triplets.push_back(
+                        Eigen::Triplet<double>(i, neighbors_[k], -weights_[k]));
+                W += weights_[k];
+            }
+            if (W > 0) {
+                triplets.push_back(Eigen::Triplet<double>(i, i, W));
+            }
+        }
+    }
+    Eigen::SparseMatrix<double> L(num_vertices, num_vertices);
+    L.setFromTriplets(triplets.begin(), triplets.end());
+    utility::LogDebug(
+            "[DeformAsRigidAsPossible] done setting up system matrix L");
+
+    utility::LogDebug("[DeformAsRigidAsPossible] setting up sparse solver");
+    solver_->lu.analyzePattern(L);
+    solver_->lu.factorize(L);
+    if (solver_->lu.info() != Eigen::Success) {
+        utility::LogError(
+                "[DeformAsRigidAsPossible] Failed to build solver (factorize)");
+    } else {
+        utility::LogDebug(
+                "[DeformAsRigidAsPossible] done setting up sparse solver");
+    }
+
+    Reset();
+}
+
+AsRigidAsPossibleDeformation::~AsRigidAsPossibleDeformation() {}
+
+void AsRigidAsPossibleDeformation::SetConstraintPositions(
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions) {
+    if (constraint_vertex_positions.size() != constraint_positions_.size()) {
+        utility::LogError(
+                "[DeformAsRigidAsPossible] Expected {} constraint positions, "
+                "but got {}.",
+                constraint_positions_.size(),
+                constraint_vertex_positions.size());
+    }
+    constraint_positions_ = constraint_vertex_positions;
+}
+
+void AsRigidAsPossibleDeformation::Reset() {
+    deformed_vertices_ = vertices_;
+    Rs_.assign(vertices_.size(), Eigen::Matrix3d::Identity());
+    if (energy_model_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed) {
+        Rs_old_.assign(vertices_.size(), Eigen::Matrix3d::Identity());
+    }
+    num_iterations_ = 0;
+    energy_ = -1;
+}
+
+size_t AsRigidAsPossibleDeformation::Iterate(size_t max_iter,
+                                             double max_seconds) {
+    const auto start = std::chrono::steady_clock::now();
+    size_t iter = 0;
+    for (; iter < max_iter; ++iter) {
+        if (iter > 0 && max_seconds > 0 &&
+            std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                          start)
+                            .count() >= max_seconds) {
+            break;
+        }
+        UpdateRotations();
+        UpdatePositions();
+        energy_ = ComputeEnergy();
+        utility::LogDebug("[DeformAsRigidAsPossible] iter={}, energy={:e}",
+                          num_iterations_, energy_);
+        num_iterations_++;
+    }
+    return iter;
+}
+
+std::shared_ptr<TriangleMesh> AsRigidAsPossibleDeformation::GetDeformedMesh()
+        const {
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = deformed_vertices_;
+    mesh->triangles_ = triangles_;
+    return mesh;
+}
+
+void AsRigidAsPossibleDeformation::UpdateRotations() {
+    const bool smoothed =
+            energy_model_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed;
+    if (smoothed) {
+        std::swap(Rs_, Rs_old_);
+    }
+
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < int(vertices_.size()); ++i) {
+        Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
+        Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
+        const int n_nbs = offsets_[i + 1] - offsets_[i];
+        for (int k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+            const int j = neighbors_[k];
+            Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
+            Eigen::Vector3d e1 = deformed_vertices_[i] - deformed_vertices_[j];
+            S += weights_[k] * (e0 * e1.transpose());
+            if (smoothed) {
+                R += Rs_old_[j];
+            }
+        }
+        if (smoothed && num_iterations_ > 0 && n_nbs > 0) {
+            S = 2 * S +
+                (4 * smoothed_alpha_ * surface_area_ / n_nbs) * R.transpose();
+        }
+        Eigen::JacobiSVD<Eigen::Matrix3d> svd(
+                S, Eigen::ComputeFullU | Eigen::ComputeFullV);
+        Eigen::Matrix3d U = svd.matrixU();
+        Eigen::Matrix3d V = svd.matrixV();
+        Eigen::Vector3d D(1, 1, (V * U.transpose()).determinant());
+        // ensure rotation:
+        // http://graphics.stanford.edu/~smr/ICP/comparison/eggert_comparison_mva97.pdf
+        Rs_[i] = V * D.asDiagonal() * U.transpose();
+        if (Rs_[i].determinant() <= 0) {
+            utility::LogError(
+                    "[DeformAsRigidAsPossible] something went wrong with "
+                    "updating R");
+        }
+    }
+}
+
+void AsRigidAsPossibleDeformation::UpdatePositions() {
+    const int num_vertices = int(vertices_.size());
+    Eigen::MatrixXd b(num_vertices, 3);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < num_vertices; ++i) {
+        Eigen::Vector3d bi(0, 0, 0);
+        if (constraint_slots_[i] >= 0) {
+            bi = constraint_positions_[constraint_slots_[i]];
+        } else {
+            for (int k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+                const int j = neighbors_[k];
+                bi += weights_[k] / 2 *
+                      ((Rs_[i] + Rs_[j]) * (vertices_[i] - vertices_[j]));
+            }
+        }
+        b.row(i) = bi.transpose();
+    }
+#pragma omp parallel for schedule(static)
+    for (int comp = 0; comp < 3; ++comp) {
+        Eigen::VectorXd p_prime = solver_->lu.solve(b.col(comp));
+        if (solver_->lu.info() != Eigen::Success) {
+            utility::LogError(
+                    "[DeformAsRigidAsPossible] Cholesky solve failed");
+        }
+        for (int i = 0; i < num_vertices; ++i) {
+            deformed_vertices_[i](comp) = p_prime(i);
+        }
+    }
+}
+
+double AsRigidAsPossibleDeformation::ComputeEnergy() const {
+    const bool smoothed =
+            energy_model_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed;
+    double energy = 0;
+    double reg = 0;
+#pragma omp parallel for schedule(static) reduction(+ : energy, reg)
+    for (int i = 0; i < int(vertices_.size()); ++i) {
+        for (int k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+            const int j = neighbors_[k];
+            Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
+            Eigen::Vector3d e1 = deformed_vertices_[i] - deformed_vertices_[j];
+            Eigen::Vector3d diff = e1 - Rs_[i] * e0;
+            energy += weights_[k] * diff.squaredNorm();
+            if (smoothed) {
+                reg += (Rs_[i] - Rs_[j]).squaredNorm();
+            }
+        }
+    }
+    if (smoothed) {
+        energy = energy + smoothed_alpha_ * surface_area_ * reg;
+    }
+    return energy;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/MeshBase.h"
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class AsRigidAsPossibleDeformation
+///
+/// \brief Reusable state of TriangleMesh::DeformAsRigidAsPossible for a fixed
+/// set of constraint vertices.
+///
+/// The system matrix only depends on the mesh and on which vertices are
+/// constrained, so it is factorized once in the constructor. Moving the
+/// constraints with SetConstraintPositions() keeps the factorization, the
+/// rotations and the deformed vertices, so that the following iterations
+/// start from the previous solution. This suits interactive editing, where
+/// the constraints are dragged and a few iterations per frame suffice.
+class AsRigidAsPossibleDeformation {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param mesh Mesh in its rest pose.
+    /// \param constraint_vertex_indices Indices of the constrained vertices.
+    /// \param energy Energy model that is minimized.
+    /// \param smoothed_alpha Alpha parameter of the smoothed ARAP model.
+    AsRigidAsPossibleDeformation(
+            const TriangleMesh &mesh,
+            const std::vector<int> &constraint_vertex_indices,
+            MeshBase::DeformAsRigidAsPossibleEnergy energy =
+                    MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+            double smoothed_alpha = 0.01);
+    ~AsRigidAsPossibleDeformation();
+
+public:
+    /// \brief Sets the target positions of the constrained vertices, in the
+    /// order of the constraint_vertex_indices passed to the constructor.
+    /// Until the first call, the constrained vertices keep their rest
+    /// positions.
+    void SetConstraintPositions(
+            const std::vector<Eigen::Vector3d> &constraint_vertex_positions);
+
+    /// \brief Runs up to \p max_iter iterations, continuing from the current
+    /// deformation.
+    ///
+    /// \param max_iter Maximal number of iterations.
+    /// \param max_seconds If positive, no further iteration is started once
+    /// this time has passed, so at least one iteration is run.
+    /// \return The number of iterations run.
+    size_t Iterate(size_t max_iter, double max_seconds = 0);
+
+    /// Restores the rest pose, keeping the factorization.
+    void Reset();
+
+    /// Returns the deformed vertices.
+    const std::vector<Eigen::Vector3d> &GetVertices() const {
+        return deformed_vertices_;
+    }
+
+    /// Returns a copy of the mesh with the deformed vertices.
+    std::shared_ptr<TriangleMesh> GetDeformedMesh() const;
+
+    /// Returns the energy after the last iteration, or -1 before the first
+    /// iteration.
+    double GetEnergy() const { return energy_; }
+
+    /// Returns the number of iterations since construction or Reset().
+    size_t GetNumIterations() const { return num_iterations_; }
+
+private:
+    void UpdateRotations();
+    void UpdatePositions();
+    double ComputeEnergy() const;
+
+private:
+    struct Solver;
+
+    std::vector<Eigen::Vector3d> vertices_;
+    std::vector<Eigen::Vector3i> triangles_;
+    MeshBase::DeformAsRigidAsPossibleEnergy energy_model_;
+    double smoothed_alpha_;
+    double surface_area_ = -1;
+
+    /// Neighbors of vertex i are neighbors_[offsets_[i]] to
+    /// neighbors_[offsets_[i + 1] - 1], with the cotangent weights of the
+    /// edges in weights_.
+    std::vector<int> offsets_;
+    std::vector<int> neighbors_;
+    std::vector<double> weights_;
+    /// Index into constraint_positions_ per vertex, -1 if unconstrained.
+    std::vector<int> constraint_slots_;
+    std::vector<int> constraint_vertex_indices_;
+    std::vector<Eigen::Vector3d> constraint_positions_;
+    std::unique_ptr<Solver> solver_;
+
+    std::vector<Eigen::Vector3d> deformed_vertices_;
+    std::vector<Eigen::Matrix3d> Rs_;
+    std::vector<Eigen::Matrix3d> Rs_old_;
+    size_t num_iterations_ = 0;
+    double energy_ = -1;
+};
+
+}  // namespace geometry
+}  // namespace open3d
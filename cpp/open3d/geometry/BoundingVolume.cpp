@@ -145,14 +145,41 @@ OrientedBoundingBox OrientedBoundingBox::CreateFromAxisAlignedBoundingBox(
     return obox;
 }
 
-OrientedBoundingBox OrientedBoundingBox::CreateFromPoints(
-        const std::vector<Eigen::Vector3d>& points) {
-    PointCloud hull_pcd;
-    hull_pcd.points_ = std::get<0>(Qhull::ComputeConvexHull(points))->vertices_;
+/// Returns the box of points[0] to points[n - 1] aligned with their principal
+/// axes, in the order of decreasing variance.
+static OrientedBoundingBox CreateFromPrincipalAxes(
+        const Eigen::Vector3d* points, size_t n) {
+    OrientedBoundingBox obox;
+    if (n == 0) {
+        return obox;
+    }
 
-    Eigen::Vector3d mean;
+    Eigen::Matrix<double, 9, 1> cumulants;
+    cumulants.setZero();
+    for (size_t i = 0; i < n; ++i) {
+        const Eigen::Vector3d& point = points[i];
+        cumulants(0) += point(0);
+        cumulants(1) += point(1);
+        cumulants(2) += point(2);
+        cumulants(3) += point(0) * point(0);
+        cumulants(4) += point(0) * point(1);
+        cumulants(5) += point(0) * point(2);
+        cumulants(6) += point(1) * point(1);
+        cumulants(7) += point(1) * point(2);
+        cumulants(8) += point(2) * point(2);
+    }
+    cumulants /= (double)n;
+    const Eigen::Vector3d mean = cumulants.head<3>();
     Eigen::Matrix3d cov;
-    std::tie(mean, cov) = hull_pcd.ComputeMeanAndCovariance();
+    cov(0, 0) = cumulants(3) - cumulants(0) * cumulants(0);
+    cov(1, 1) = cumulants(6) - cumulants(1) * cumulants(1);
+    cov(2, 2) = cumulants(8) - cumulants(2) * cumulants(2);
+    cov(0, 1) = cumulants(4) - cumulants(0) * cumulants(1);
+    cov(1, 0) = cov(0, 1);
+    cov(0, 2) = cumulants(5) - cumulants(0) * cumulants(2);
+    cov(2, 0) = cov(0, 2);
+    cov(1, 2) = cumulants(7) - cumulants(1) * cumulants(2);
+    cov(2, 1) = cov(1, 2);
 
     Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> es(cov);
     Eigen::Vector3d evals = es.eigenvalues();
@@ -180,19 +207,71 @@ OrientedBoundingBox OrientedBoundingBox::CreateFromPoints(
         R.col(1) = tmp;
     }
 
-    for (auto& pt : hull_pcd.points_) {
-        pt = R.transpose() * (pt - mean);
+    // Bounds in the frame of the principal axes, without copying the points.
+    Eigen::Vector3d min_bound = R.transpose() * (points[0] - mean);
+    Eigen::Vector3d max_bound = min_bound;
+    for (size_t i = 1; i < n; ++i) {
+        const Eigen::Vector3d pt = R.transpose() * (points[i] - mean);
+        min_bound = min_bound.cwiseMin(pt);
+        max_bound = max_bound.cwiseMax(pt);
     }
-    const auto aabox = hull_pcd.GetAxisAlignedBoundingBox();
 
-    OrientedBoundingBox obox;
-    obox.center_ = R * aabox.GetCenter() + mean;
+    obox.center_ = R * ((min_bound + max_bound) * 0.5) + mean;
     obox.R_ = R;
-    obox.extent_ = aabox.GetExtent();
-
+    obox.extent_ = max_bound - min_bound;
     return obox;
 }
 
+OrientedBoundingBox OrientedBoundingBox::CreateFromPoints(
+        const std::vector<Eigen::Vector3d>& points) {
+    const std::vector<Eigen::Vector3d> hull_points =
+            std::get<0>(Qhull::ComputeConvexHull(points))->vertices_;
+    return CreateFromPrincipalAxes(hull_points.data(), hull_points.size());
+}
+
+std::vector<OrientedBoundingBox> OrientedBoundingBox::CreateFromPointSets(
+        const std::vector<Eigen::Vector3d>& points,
+        const std::vector<size_t>& offsets,
+        bool use_convex_hull) {
+    if (offsets.empty() || offsets.back() != points.size()) {
+        utility::LogError(
+                "offsets must end with the number of points {}, but the last "
+                "offset is {}.",
+                points.size(), offsets.empty() ? 0 : offsets.back());
+    }
+    for (size_t i = 1; i < offsets.size(); ++i) {
+        if (offsets[i] < offsets[i - 1]) {
+            utility::LogError("offsets must be non-decreasing.");
+        }
+    }
+
+    const int64_t num_sets = int64_t(offsets.size()) - 1;
+    std::vector<OrientedBoundingBox> boxes(num_sets);
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t i = 0; i < num_sets; ++i) {
+        const Eigen::Vector3d* set_points = points.data() + offsets[i];
+        const size_t n = offsets[i + 1] - offsets[i];
+        if (use_convex_hull && n >= 4) {
+            // Qhull throws for degenerate sets, which must not leave the
+            // parallel loop.
+            try {
+                const std::vector<Eigen::Vector3d> hull_points =
+                        std::get<0>(Qhull::ComputeConvexHull(
+                                            std::vector<Eigen::Vector3d>(
+                                                    set_points,
+                                                    set_points + n)))
+                                ->vertices_;
+                boxes[i] = CreateFromPrincipalAxes(hull_points.data(),
+                                                   hull_points.size());
+                continue;
+            } catch (const std::exception&) {
+            }
+        }
+        boxes[i] = CreateFromPrincipalAxes(set_points, n);
+    }
+    return boxes;
+}
+
 AxisAlignedBoundingBox& AxisAlignedBoundingBox::Clear() {
     min_bound_.setZero();
     max_bound_.setZero();
@@ -128,6 +128,21 @@ public:
     static OrientedBoundingBox CreateFromPoints(
             const std::vector<Eigen::Vector3d>& points);
 
+    /// Creates the oriented bounding boxes of many point sets in parallel.
+    ///
+    /// \param points Points of all sets, where set i is points[offsets[i]] to
+    /// points[offsets[i + 1] - 1].
+    /// \param offsets Start of each set followed by points.size().
+    /// \param use_convex_hull If true, the boxes are computed from the convex
+    /// hulls like CreateFromPoints(). Sets without a hull, e.g. planar ones,
+    /// fall back to the principal axes of their points. If false, the boxes
+    /// are aligned with the principal axes of all points of each set, which
+    /// is faster but more sensitive to the sampling density.
+    static std::vector<OrientedBoundingBox> CreateFromPointSets(
+            const std::vector<Eigen::Vector3d>& points,
+            const std::vector<size_t>& offsets,
+            bool use_convex_hull = true);
+
 public:
     /// The center point of the bounding box.
     Eigen::Vector3d center_;
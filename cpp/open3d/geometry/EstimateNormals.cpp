@@ -24,11 +24,17 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Eigenvalues>
-#include <queue>
+#include <algorithm>
+#include <iterator>
+#include <limits>
 #include <tuple>
 
 #include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/MinimumSpanningTree.h"
+#include "open3d/geometry/NeighborCache.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TetraMesh.h"
 #include "open3d/utility/Eigen.h"
@@ -239,71 +245,42 @@ Eigen::Vector3d ComputeNormal(const PointCloud &cloud,
     }
 }
 
-// Disjoint set data structure to find cycles in graphs
-class DisjointSet {
-public:
-    DisjointSet(size_t size) : parent_(size), size_(size) {
-        for (size_t idx = 0; idx < size; idx++) {
-            parent_[idx] = idx;
-            size_[idx] = 0;
-        }
-    }
-
-    // find representative element for given x
-    // using path compression
-    size_t Find(size_t x) {
-        if (x != parent_[x]) {
-            parent_[x] = Find(parent_[x]);
-        }
-        return parent_[x];
+/// Estimates the normals of \p cloud from the neighbors returned by
+/// search(i, indices, distance2) for every point i.
+template <typename SearchFunc>
+void EstimateNormalsFromNeighbors(PointCloud &cloud,
+                                  SearchFunc search,
+                                  bool fast_normal_computation) {
+    bool has_normal = cloud.HasNormals();
+    if (!has_normal) {
+        cloud.normals_.resize(cloud.points_.size());
     }
-
-    // combine two sets using size of sets
-    void Union(size_t x, size_t y) {
-        x = Find(x);
-        y = Find(y);
-        if (x != y) {
-            if (size_[x] < size_[y]) {
-                size_[y] += size_[x];
-                parent_[x] = y;
+#pragma omp parallel
+    {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+#pragma omp for schedule(static)
+        for (int i = 0; i < (int)cloud.points_.size(); i++) {
+            Eigen::Vector3d normal;
+            if (search(i, indices, distance2) >= 3) {
+                normal = ComputeNormal(cloud, indices,
+                                       fast_normal_computation);
+                if (normal.norm() == 0.0) {
+                    if (has_normal) {
+                        normal = cloud.normals_[i];
+                    } else {
+                        normal = Eigen::Vector3d(0.0, 0.0, 1.0);
+                    }
+                }
+                if (has_normal && normal.dot(cloud.normals_[i]) < 0.0) {
+                    normal *= -1.0;
+                }
+                cloud.normals_[i] = normal;
             } else {
-                size_[x] += size_[y];
-                parent_[y] = x;
+                cloud.normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
             }
         }
     }
-
-private:
-    std::vector<size_t> parent_;
-    std::vector<size_t> size_;
-};
-
-struct WeightedEdge {
-    WeightedEdge(size_t v0, size_t v1, double weight)
-        : v0_(v0), v1_(v1), weight_(weight) {}
-    size_t v0_;
-    size_t v1_;
-    double weight_;
-};
-
-// Minimum Spanning Tree algorithm (Kruskal's algorithm)
-std::vector<WeightedEdge> Kruskal(std::vector<WeightedEdge> &edges,
-                                  size_t n_vertices) {
-    std::sort(edges.begin(), edges.end(),
-              [](WeightedEdge &e0, WeightedEdge &e1) {
-                  return e0.weight_ < e1.weight_;
-              });
-    DisjointSet disjoint_set(n_vertices);
-    std::vector<WeightedEdge> mst;
-    for (size_t eidx = 0; eidx < edges.size(); ++eidx) {
-        size_t set0 = disjoint_set.Find(edges[eidx].v0_);
-        size_t set1 = disjoint_set.Find(edges[eidx].v1_);
-        if (set0 != set1) {
-            mst.push_back(edges[eidx]);
-            disjoint_set.Union(set0, set1);
-        }
-    }
-    return mst;
 }
 
 }  // unnamed namespace
@@ -313,34 +290,41 @@ namespace geometry {
 void PointCloud::EstimateNormals(
         const KDTreeSearchParam &search_param /* = KDTreeSearchParamKNN()*/,
         bool fast_normal_computation /* = true */) {
-    bool has_normal = HasNormals();
-    if (!has_normal) {
-        normals_.resize(points_.size());
-    }
     KDTreeFlann kdtree;
     kdtree.SetGeometry(*this);
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)points_.size(); i++) {
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        Eigen::Vector3d normal;
-        if (kdtree.Search(points_[i], search_param, indices, distance2) >= 3) {
-            normal = ComputeNormal(*this, indices, fast_normal_computation);
-            if (normal.norm() == 0.0) {
-                if (has_normal) {
-                    normal = normals_[i];
-                } else {
-                    normal = Eigen::Vector3d(0.0, 0.0, 1.0);
-                }
-            }
-            if (has_normal && normal.dot(normals_[i]) < 0.0) {
-                normal *= -1.0;
-            }
-            normals_[i] = normal;
-        } else {
-            normals_[i] = Eigen::Vector3d(0.0, 0.0, 1.0);
-        }
+    EstimateNormalsFromNeighbors(
+            *this,
+            [&](int i, std::vector<int> &indices,
+                std::vector<double> &distance2) {
+                return kdtree.Search(points_[i], search_param, indices,
+                                     distance2);
+            },
+            fast_normal_computation);
+}
+
+void PointCloud::EstimateNormals(
+        const NeighborCache &neighbor_cache,
+        const KDTreeSearchParam &search_param,
+        bool fast_normal_computation /* = true */) {
+    if (neighbor_cache.NumQueries() != points_.size()) {
+        utility::LogError(
+                "[EstimateNormals] The neighbor cache has {} queries, but the "
+                "point cloud has {} points.",
+                neighbor_cache.NumQueries(), points_.size());
+    }
+    if (!neighbor_cache.Covers(search_param)) {
+        utility::LogError(
+                "[EstimateNormals] The search is not covered by the neighbor "
+                "cache.");
     }
+    EstimateNormalsFromNeighbors(
+            *this,
+            [&](int i, std::vector<int> &indices,
+                std::vector<double> &distance2) {
+                return neighbor_cache.Search(i, search_param, indices,
+                                             distance2);
+            },
+            fast_normal_computation);
 }
 
 void PointCloud::OrientNormalsToAlignWithDirection(
@@ -393,107 +377,129 @@ void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
                 "PointCloud. Call EstimateNormals() first.");
     }
 
+    const size_t n = points_.size();
+    if (n == 0) {
+        return;
+    }
+    auto EdgeIndex = [n](size_t v0, size_t v1) -> size_t {
+        return std::min(v0, v1) * n + std::max(v0, v1);
+    };
+    auto NormalWeight = [&](size_t v0, size_t v1) -> double {
+        return 1.0 - std::abs(normals_[v0].dot(normals_[v1]));
+    };
+
     // Create Riemannian graph (Euclidian MST + kNN)
     // Euclidian MST is subgraph of Delaunay triangulation
     std::shared_ptr<TetraMesh> delaunay_mesh;
     std::vector<size_t> pt_map;
     std::tie(delaunay_mesh, pt_map) = TetraMesh::CreateFromPointCloud(*this);
-    std::vector<WeightedEdge> delaunay_graph;
-    std::unordered_set<size_t> graph_edges;
-    auto EdgeIndex = [&](size_t v0, size_t v1) -> size_t {
-        return std::min(v0, v1) * points_.size() + std::max(v0, v1);
-    };
-    auto AddEdgeToDelaunayGraph = [&](size_t v0, size_t v1) {
-        v0 = pt_map[v0];
-        v1 = pt_map[v1];
-        size_t edge = EdgeIndex(v0, v1);
-        if (graph_edges.count(edge) == 0) {
-            double dist = (points_[v0] - points_[v1]).squaredNorm();
-            delaunay_graph.push_back(WeightedEdge(v0, v1, dist));
-            graph_edges.insert(edge);
+    const auto &tetras = delaunay_mesh->tetras_;
+    std::vector<size_t> delaunay_edges(tetras.size() * 6);
+#pragma omp parallel for schedule(static)
+    for (int64_t tidx = 0; tidx < int64_t(tetras.size()); ++tidx) {
+        const Eigen::Vector4i &tetra = tetras[tidx];
+        size_t *edges = &delaunay_edges[6 * tidx];
+        for (int i = 0; i < 4; ++i) {
+            for (int j = i + 1; j < 4; ++j) {
+                *edges++ = EdgeIndex(pt_map[tetra[i]], pt_map[tetra[j]]);
+            }
         }
-    };
-    for (const Eigen::Vector4i &tetra : delaunay_mesh->tetras_) {
-        AddEdgeToDelaunayGraph(tetra[0], tetra[1]);
-        AddEdgeToDelaunayGraph(tetra[0], tetra[2]);
-        AddEdgeToDelaunayGraph(tetra[0], tetra[3]);
-        AddEdgeToDelaunayGraph(tetra[1], tetra[2]);
-        AddEdgeToDelaunayGraph(tetra[1], tetra[3]);
-        AddEdgeToDelaunayGraph(tetra[2], tetra[3]);
     }
+    tbb::parallel_sort(delaunay_edges.begin(), delaunay_edges.end());
+    delaunay_edges.erase(
+            std::unique(delaunay_edges.begin(), delaunay_edges.end()),
+            delaunay_edges.end());
 
-    std::vector<WeightedEdge> mst = Kruskal(delaunay_graph, points_.size());
-
-    auto NormalWeight = [&](size_t v0, size_t v1) -> double {
-        return 1.0 - std::abs(normals_[v0].dot(normals_[v1]));
-    };
-    for (auto &edge : mst) {
+    std::vector<WeightedEdge> delaunay_graph(delaunay_edges.size(),
+                                             WeightedEdge(0, 0, 0.0));
+#pragma omp parallel for schedule(static)
+    for (int64_t eidx = 0; eidx < int64_t(delaunay_edges.size()); ++eidx) {
+        const size_t v0 = delaunay_edges[eidx] / n;
+        const size_t v1 = delaunay_edges[eidx] % n;
+        delaunay_graph[eidx] = WeightedEdge(
+                v0, v1, (points_[v0] - points_[v1]).squaredNorm());
+    }
+    std::vector<WeightedEdge> riemannian_graph =
+            MinimumSpanningTree(delaunay_graph, n);
+#pragma omp parallel for schedule(static)
+    for (int64_t eidx = 0; eidx < int64_t(riemannian_graph.size()); ++eidx) {
+        WeightedEdge &edge = riemannian_graph[eidx];
         edge.weight_ = NormalWeight(edge.v0_, edge.v1_);
     }
 
-    // Add k nearest neighbors to Riemannian graph
+    // Add k nearest neighbors to Riemannian graph, except for the other
+    // edges of the Delaunay graph.
     KDTreeFlann kdtree(*this);
-    for (size_t v0 = 0; v0 < points_.size(); ++v0) {
+    const size_t kInvalidEdge = std::numeric_limits<size_t>::max();
+    std::vector<size_t> knn_edges(n * k, kInvalidEdge);
+#pragma omp parallel
+    {
         std::vector<int> neighbors;
         std::vector<double> dists2;
-        kdtree.SearchKNN(points_[v0], int(k), neighbors, dists2);
-        for (size_t vidx1 = 0; vidx1 < neighbors.size(); ++vidx1) {
-            size_t v1 = size_t(neighbors[vidx1]);
-            if (v0 == v1) {
-                continue;
-            }
-            size_t edge = EdgeIndex(v0, v1);
-            if (graph_edges.count(edge) == 0) {
-                double weight = NormalWeight(v0, v1);
-                mst.push_back(WeightedEdge(v0, v1, weight));
-                graph_edges.insert(edge);
+#pragma omp for schedule(static)
+        for (int64_t v0 = 0; v0 < int64_t(n); ++v0) {
+            kdtree.SearchKNN(points_[v0], int(k), neighbors, dists2);
+            for (size_t vidx1 = 0; vidx1 < neighbors.size(); ++vidx1) {
+                const size_t v1 = size_t(neighbors[vidx1]);
+                if (size_t(v0) != v1) {
+                    knn_edges[v0 * k + vidx1] = EdgeIndex(v0, v1);
+                }
             }
         }
     }
+    tbb::parallel_sort(knn_edges.begin(), knn_edges.end());
+    knn_edges.erase(std::unique(knn_edges.begin(), knn_edges.end()),
+                    knn_edges.end());
+    if (!knn_edges.empty() && knn_edges.back() == kInvalidEdge) {
+        knn_edges.pop_back();
+    }
+    std::vector<size_t> new_edges;
+    std::set_difference(knn_edges.begin(), knn_edges.end(),
+                        delaunay_edges.begin(), delaunay_edges.end(),
+                        std::back_inserter(new_edges));
+    const size_t num_mst_edges = riemannian_graph.size();
+    riemannian_graph.resize(num_mst_edges + new_edges.size(),
+                            WeightedEdge(0, 0, 0.0));
+#pragma omp parallel for schedule(static)
+    for (int64_t eidx = 0; eidx < int64_t(new_edges.size()); ++eidx) {
+        const size_t v0 = new_edges[eidx] / n;
+        const size_t v1 = new_edges[eidx] % n;
+        riemannian_graph[num_mst_edges + eidx] =
+                WeightedEdge(v0, v1, NormalWeight(v0, v1));
+    }
 
     // extract MST from Riemannian graph
-    mst = Kruskal(mst, points_.size());
-
-    // convert list of edges to graph
-    std::vector<std::unordered_set<size_t>> mst_graph(points_.size());
-    for (const auto &edge : mst) {
-        size_t v0 = edge.v0_;
-        size_t v1 = edge.v1_;
-        mst_graph[v0].insert(v1);
-        mst_graph[v1].insert(v0);
-    }
+    const std::vector<WeightedEdge> mst =
+            MinimumSpanningTree(riemannian_graph, n);
 
     // find start node for tree traversal
     // init with node that maximizes z
     double max_z = std::numeric_limits<double>::lowest();
     size_t v0 = 0;
-    for (size_t vidx = 0; vidx < points_.size(); ++vidx) {
+    for (size_t vidx = 0; vidx < n; ++vidx) {
         const Eigen::Vector3d &v = points_[vidx];
         if (v(2) > max_z) {
             max_z = v(2);
             v0 = vidx;
         }
     }
+    if (normals_[v0].dot(Eigen::Vector3d(0, 0, 1)) < 0) {
+        normals_[v0] *= -1;
+    }
 
-    // traverse MST and orient normals consistently
-    std::queue<size_t> traversal_queue;
-    std::vector<bool> visited(points_.size(), false);
-    traversal_queue.push(v0);
-    auto TestAndOrientNormal = [&](const Eigen::Vector3d &n0,
-                                   Eigen::Vector3d &n1) {
-        if (n0.dot(n1) < 0) {
-            n1 *= -1;
-        }
-    };
-    TestAndOrientNormal(Eigen::Vector3d(0, 0, 1), normals_[v0]);
-    while (!traversal_queue.empty()) {
-        v0 = traversal_queue.front();
-        traversal_queue.pop();
-        visited[v0] = true;
-        for (size_t v1 : mst_graph[v0]) {
-            if (!visited[v1]) {
-                traversal_queue.push(v1);
-                TestAndOrientNormal(normals_[v0], normals_[v1]);
+    // traverse MST level by level and orient normals consistently with the
+    // normal of the parent
+    std::vector<int64_t> order, level_offsets, parents;
+    BreadthFirstTraversal(mst, n, {int64_t(v0)}, order, level_offsets,
+                          parents);
+    for (size_t level = 1; level + 1 < level_offsets.size(); ++level) {
+        const int64_t begin = level_offsets[level];
+        const int64_t end = level_offsets[level + 1];
+#pragma omp parallel for schedule(static) if (end - begin >= 1024)
+        for (int64_t i = begin; i < end; ++i) {
+            const int64_t v1 = order[i];
+            if (normals_[parents[v1]].dot(normals_[v1]) < 0) {
+                normals_[v1] *= -1;
             }
         }
     }
@@ -30,13 +30,16 @@
 
 #include <Eigen/Core>
 #include <Eigen/Eigenvalues>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <memory>
 #include <tuple>
 #include <vector>
 
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/Keypoint.h"
+#include "open3d/geometry/NeighborCache.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Eigen.h"
 #include "open3d/utility/Logging.h"
@@ -99,13 +102,50 @@ std::shared_ptr<PointCloud> ComputeISSKeypoints(
                 salient_radius, non_max_radius);
     }
 
+    // Both searches are answered from the neighbors within the larger radius.
+    NeighborCache neighbor_cache(
+            kdtree, points,
+            KDTreeSearchParamRadius(std::max(salient_radius, non_max_radius)));
+    return ComputeISSKeypoints(input, neighbor_cache, salient_radius,
+                               non_max_radius, gamma_21, gamma_32,
+                               min_neighbors);
+}
+
+std::shared_ptr<PointCloud> ComputeISSKeypoints(
+        const PointCloud& input,
+        const NeighborCache& neighbor_cache,
+        double salient_radius,
+        double non_max_radius,
+        double gamma_21 /* = 0.975 */,
+        double gamma_32 /* = 0.975 */,
+        int min_neighbors /*= 5 */) {
+    if (input.points_.empty()) {
+        utility::LogWarning("[ComputeISSKeypoints] Input PointCloud is empty!");
+        return std::make_shared<PointCloud>();
+    }
+    if (neighbor_cache.NumQueries() != input.points_.size()) {
+        utility::LogError(
+                "[ComputeISSKeypoints] The neighbor cache has {} queries, but "
+                "the point cloud has {} points.",
+                neighbor_cache.NumQueries(), input.points_.size());
+    }
+    const KDTreeSearchParamRadius salient_param(salient_radius);
+    const KDTreeSearchParamRadius non_max_param(non_max_radius);
+    if (!neighbor_cache.Covers(salient_param) ||
+        !neighbor_cache.Covers(non_max_param)) {
+        utility::LogError(
+                "[ComputeISSKeypoints] The radius searches are not covered by "
+                "the neighbor cache.");
+    }
+    const auto& points = input.points_;
+
     std::vector<double> third_eigen_values(points.size());
 #pragma omp parallel for schedule(static) shared(third_eigen_values)
     for (int i = 0; i < (int)points.size(); i++) {
         std::vector<int> indices;
         std::vector<double> dist;
         int nb_neighbors =
-                kdtree.SearchRadius(points[i], salient_radius, indices, dist);
+                neighbor_cache.Search(i, salient_param, indices, dist);
         if (nb_neighbors < min_neighbors) {
             continue;
         }
@@ -125,22 +165,27 @@ std::shared_ptr<PointCloud> ComputeISSKeypoints(
         }
     }
 
-    std::vector<size_t> kp_indices;
-    kp_indices.reserve(points.size());
-#pragma omp parallel for schedule(static) shared(kp_indices)
+    std::vector<uint8_t> is_keypoint(points.size(), 0);
+#pragma omp parallel for schedule(static) shared(is_keypoint)
     for (int i = 0; i < (int)points.size(); i++) {
         if (third_eigen_values[i] > 0.0) {
             std::vector<int> nn_indices;
             std::vector<double> dist;
-            int nb_neighbors = kdtree.SearchRadius(points[i], non_max_radius,
-                                                   nn_indices, dist);
+            int nb_neighbors =
+                    neighbor_cache.Search(i, non_max_param, nn_indices, dist);
 
             if (nb_neighbors >= min_neighbors &&
                 IsLocalMaxima(i, nn_indices, third_eigen_values)) {
-                kp_indices.emplace_back(i);
+                is_keypoint[i] = 1;
             }
         }
     }
+    std::vector<size_t> kp_indices;
+    for (size_t i = 0; i < points.size(); i++) {
+        if (is_keypoint[i]) {
+            kp_indices.push_back(i);
+        }
+    }
 
     utility::LogDebug("[ComputeISSKeypoints] Extracted {} keypoints",
                       kp_indices.size());
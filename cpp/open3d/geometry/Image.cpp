@@ -26,6 +26,14 @@
 
 #include "open3d/geometry/Image.h"
 
+#include <algorithm>
+
+#ifdef WITH_IPPICV
+#include "open3d/core/Blob.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/IPPImage.h"
+#endif
+
 namespace {
 /// Isotropic 2D kernels are separable:
 /// two 1D kernels are applied in x and y direction.
@@ -35,6 +43,76 @@ const std::vector<double> Gaussian7 = {0.03125, 0.109375, 0.21875, 0.28125,
                                        0.21875, 0.109375, 0.03125};
 const std::vector<double> Sobel31 = {-1.0, 0.0, 1.0};
 const std::vector<double> Sobel32 = {1.0, 2.0, 1.0};
+
+bool use_ipp = false;
+
+/// Correlates the row \p in of \p width pixels with \p kernel, replicating
+/// the border pixels, and writes the result to \p out. \p padded and \p acc
+/// are scratch buffers of width + kernel.size() - 1 and width entries.
+///
+/// The taps are iterated in the outer loop so that the inner loop over the
+/// pixels vectorizes, while every pixel still accumulates its taps in order.
+void FilterRow(const float *in,
+               int width,
+               const std::vector<float> &kernel,
+               std::vector<float> &padded,
+               std::vector<double> &acc,
+               float *out) {
+    const int half_kernel_size = int(kernel.size()) / 2;
+    std::fill(padded.begin(), padded.begin() + half_kernel_size, in[0]);
+    std::copy(in, in + width, padded.begin() + half_kernel_size);
+    std::fill(padded.begin() + half_kernel_size + width, padded.end(),
+              in[width - 1]);
+    std::fill(acc.begin(), acc.end(), 0.0);
+    for (size_t i = 0; i < kernel.size(); i++) {
+        const float k = kernel[i];
+        const float *pi = padded.data() + i;
+        for (int x = 0; x < width; x++) {
+            acc[x] += pi[x] * k;
+        }
+    }
+    for (int x = 0; x < width; x++) {
+        out[x] = (float)acc[x];
+    }
+}
+
+/// Correlates the columns of \p rows, a \p width x \p height row-major
+/// image, with \p kernel at row \p y, replicating the border rows. This is
+/// FilterRow() on the transposed image, computed on whole rows instead.
+void FilterColumns(const float *rows,
+                   int width,
+                   int height,
+                   int y,
+                   const std::vector<float> &kernel,
+                   std::vector<double> &acc,
+                   float *out) {
+    const int half_kernel_size = int(kernel.size()) / 2;
+    std::fill(acc.begin(), acc.end(), 0.0);
+    for (int i = -half_kernel_size; i <= half_kernel_size; i++) {
+        const int y_shift = std::min(std::max(y + i, 0), height - 1);
+        const float k = kernel[i + half_kernel_size];
+        const float *pi = rows + (size_t)y_shift * width;
+        for (int x = 0; x < width; x++) {
+            acc[x] += pi[x] * k;
+        }
+    }
+    for (int x = 0; x < width; x++) {
+        out[x] = (float)acc[x];
+    }
+}
+
+#ifdef WITH_IPPICV
+/// Wraps the buffer of a single channel float image into a tensor without
+/// copying it. The image must outlive the tensor.
+open3d::core::Tensor ToTensorView(const open3d::geometry::Image &image) {
+    void *data_ptr = const_cast<uint8_t *>(image.data_.data());
+    auto blob = std::make_shared<open3d::core::Blob>(
+            open3d::core::Device("CPU:0"), data_ptr, [](void *) {});
+    return open3d::core::Tensor({image.height_, image.width_, 1},
+                                {image.width_, 1, 1}, data_ptr,
+                                open3d::core::Dtype::Float32, blob);
+}
+#endif
 }  // unnamed namespace
 
 namespace open3d {
@@ -154,19 +232,14 @@ std::shared_ptr<Image> Image::Downsample() const {
     int half_height = (int)floor((double)height_ / 2.0);
     output->Prepare(half_width, half_height, 1, 4);
 
-#ifdef _WIN32
 #pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
     for (int y = 0; y < output->height_; y++) {
+        const float *p1 = PointerAt<float>(0, y * 2);
+        const float *p2 = PointerAt<float>(0, y * 2 + 1);
+        float *p = output->PointerAt<float>(0, y);
         for (int x = 0; x < output->width_; x++) {
-            float *p1 = PointerAt<float>(x * 2, y * 2);
-            float *p2 = PointerAt<float>(x * 2 + 1, y * 2);
-            float *p3 = PointerAt<float>(x * 2, y * 2 + 1);
-            float *p4 = PointerAt<float>(x * 2 + 1, y * 2 + 1);
-            float *p = output->PointerAt<float>(x, y);
-            *p = (*p1 + *p2 + *p3 + *p4) / 4.0f;
+            p[x] = (p1[x * 2] + p1[x * 2 + 1] + p2[x * 2] + p2[x * 2 + 1]) /
+                   4.0f;
         }
     }
     return output;
@@ -183,25 +256,19 @@ std::shared_ptr<Image> Image::FilterHorizontal(
     }
     output->Prepare(width_, height_, 1, 4);
 
-    const int half_kernel_size = (int)(floor((double)kernel.size() / 2.0));
+    if (width_ == 0 || height_ == 0) {
+        return output;
+    }
 
-#ifdef _WIN32
-#pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
-    for (int y = 0; y < height_; y++) {
-        for (int x = 0; x < width_; x++) {
-            float *po = output->PointerAt<float>(x, y, 0);
-            double temp = 0;
-            for (int i = -half_kernel_size; i <= half_kernel_size; i++) {
-                int x_shift = x + i;
-                if (x_shift < 0) x_shift = 0;
-                if (x_shift > width_ - 1) x_shift = width_ - 1;
-                float *pi = PointerAt<float>(x_shift, y, 0);
-                temp += (*pi * (float)kernel[i + half_kernel_size]);
-            }
-            *po = (float)temp;
+    const std::vector<float> kernel_float(kernel.begin(), kernel.end());
+#pragma omp parallel
+    {
+        std::vector<float> padded(width_ + kernel.size() - 1);
+        std::vector<double> acc(width_);
+#pragma omp for schedule(static)
+        for (int y = 0; y < height_; y++) {
+            FilterRow(PointerAt<float>(0, y), width_, kernel_float, padded,
+                      acc, output->PointerAt<float>(0, y));
         }
     }
     return output;
@@ -253,13 +320,55 @@ std::shared_ptr<Image> Image::Filter(const std::vector<double> &dx,
         utility::LogError("[Filter] Unsupported image format.");
     }
 
-    auto temp1 = FilterHorizontal(dx);
-    auto temp2 = temp1->Transpose();
-    auto temp3 = temp2->FilterHorizontal(dy);
-    auto temp4 = temp3->Transpose();
-    return temp4;
+    if (dx.size() % 2 != 1 || dy.size() % 2 != 1) {
+        utility::LogError("[Filter] Unsupported kernel size.");
+    }
+
+#ifdef WITH_IPPICV
+    if (use_ipp && width_ > 0 && height_ > 0) {
+        output->Prepare(width_, height_, 1, 4);
+        std::vector<float> kernel_2d;
+        kernel_2d.reserve(dx.size() * dy.size());
+        for (double ky : dy) {
+            for (double kx : dx) {
+                kernel_2d.push_back((float)(ky * kx));
+            }
+        }
+        core::Tensor kernel(kernel_2d,
+                            {(int64_t)dy.size(), (int64_t)dx.size()},
+                            core::Dtype::Float32);
+        core::Tensor dst = ToTensorView(*output);
+        t::geometry::ipp::Filter(ToTensorView(*this), dst, kernel);
+        return output;
+    }
+#endif
+
+    // The vertical pass filters whole rows of the horizontally filtered
+    // image, which gives the same result as filtering its transpose.
+    auto temp = FilterHorizontal(dx);
+    output->Prepare(width_, height_, 1, 4);
+    if (width_ == 0 || height_ == 0) {
+        return output;
+    }
+
+    const std::vector<float> kernel_float(dy.begin(), dy.end());
+    const float *rows = temp->PointerAt<float>(0, 0);
+#pragma omp parallel
+    {
+        std::vector<double> acc(width_);
+#pragma omp for schedule(static)
+        for (int y = 0; y < height_; y++) {
+            FilterColumns(rows, width_, height_, y, kernel_float, acc,
+                          output->PointerAt<float>(0, y));
+        }
+    }
+    return output;
 }
 
+void Image::SetUseIPP(bool enable) { use_ipp = enable; }
+
+bool Image::GetUseIPP() { return use_ipp; }
+
 std::shared_ptr<Image> Image::Transpose() const {
     auto output = std::make_shared<Image>();
     output->Prepare(height_, width_, num_of_channels_, bytes_per_channel_);
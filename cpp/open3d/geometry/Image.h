@@ -187,6 +187,14 @@ public:
     std::shared_ptr<Image> Filter(const std::vector<double> &dx,
                                   const std::vector<double> &dy) const;
 
+    /// Function to route Filter() through the IPP implementation used by
+    /// t::geometry::Image. The buffers are shared with IPP without copies.
+    /// Results may differ from the default implementation in the last bits.
+    /// Has no effect if Open3D is built without IPP. Disabled by default.
+    static void SetUseIPP(bool enable);
+    /// Returns true if Filter() is routed through IPP when available.
+    static bool GetUseIPP();
+
     std::shared_ptr<Image> FilterHorizontal(
             const std::vector<double> &kernel) const;
 
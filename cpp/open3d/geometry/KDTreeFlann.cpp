@@ -32,7 +32,10 @@
 #include "open3d/geometry/KDTreeFlann.h"
 
 #include <nanoflann.hpp>
+#include <new>
 
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/KDTreeIO.h"
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
@@ -43,11 +46,21 @@ namespace geometry {
 
 KDTreeFlann::KDTreeFlann() {}
 
-KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data) { SetMatrixData(data); }
+KDTreeFlann::KDTreeFlann(Precision precision) : precision_(precision) {}
 
-KDTreeFlann::KDTreeFlann(const Geometry &geometry) { SetGeometry(geometry); }
+KDTreeFlann::KDTreeFlann(const Eigen::MatrixXd &data, Precision precision)
+    : precision_(precision) {
+    SetMatrixData(data);
+}
+
+KDTreeFlann::KDTreeFlann(const Geometry &geometry, Precision precision)
+    : precision_(precision) {
+    SetGeometry(geometry);
+}
 
-KDTreeFlann::KDTreeFlann(const pipelines::registration::Feature &feature) {
+KDTreeFlann::KDTreeFlann(const pipelines::registration::Feature &feature,
+                         Precision precision)
+    : precision_(precision) {
     SetFeature(feature);
 }
 
@@ -116,15 +129,16 @@ int KDTreeFlann::SearchKNN(const T &query,
     // This is optimized code for heavily repeated search.
     // Other flann::Index::knnSearch() implementations lose performance due to
     // memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
+    if (dataset_size_ <= 0 ||
         size_t(query.rows()) != dimension_ || knn < 0) {
         return -1;
     }
     indices.resize(knn);
     distance2.resize(knn);
-    std::vector<Eigen::Index> indices_eigen(knn);
-    int k = nanoflann_index_->index->knnSearch(
-            query.data(), knn, indices_eigen.data(), distance2.data());
+    thread_local std::vector<Eigen::Index> indices_eigen;
+    indices_eigen.resize(knn);
+    int k = SearchKNNRaw(query.data(), knn, indices_eigen.data(),
+                         distance2.data());
     indices.resize(k);
     distance2.resize(k);
     std::copy_n(indices_eigen.begin(), k, indices.begin());
@@ -140,19 +154,37 @@ int KDTreeFlann::SearchRadius(const T &query,
     // Since max_nn is not given, we let flann to do its own memory management.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory management and CPU caching.
-    if (data_.empty() || dataset_size_ <= 0 ||
+    if (dataset_size_ <= 0 ||
         size_t(query.rows()) != dimension_) {
         return -1;
     }
-    std::vector<std::pair<Eigen::Index, double>> indices_dists;
-    int k = nanoflann_index_->index->radiusSearch(
-            query.data(), radius * radius, indices_dists,
-            nanoflann::SearchParams(-1, 0.0));
-    indices.resize(k);
-    distance2.resize(k);
-    for (int i = 0; i < k; ++i) {
-        indices[i] = indices_dists[i].first;
-        distance2[i] = indices_dists[i].second;
+    int k = 0;
+    if (precision_ == Precision::Float64) {
+        thread_local std::vector<std::pair<Eigen::Index, double>>
+                indices_dists;
+        k = nanoflann_index_->index->radiusSearch(
+                query.data(), radius * radius, indices_dists,
+                nanoflann::SearchParams(-1, 0.0));
+        indices.resize(k);
+        distance2.resize(k);
+        for (int i = 0; i < k; ++i) {
+            indices[i] = indices_dists[i].first;
+            distance2[i] = indices_dists[i].second;
+        }
+    } else {
+        thread_local std::vector<float> query_float;
+        thread_local std::vector<std::pair<Eigen::Index, float>>
+                indices_dists;
+        query_float.assign(query.data(), query.data() + dimension_);
+        k = nanoflann_index_float_->index->radiusSearch(
+                query_float.data(), float(radius * radius), indices_dists,
+                nanoflann::SearchParams(-1, 0.0));
+        indices.resize(k);
+        distance2.resize(k);
+        for (int i = 0; i < k; ++i) {
+            indices[i] = indices_dists[i].first;
+            distance2[i] = indices_dists[i].second;
+        }
     }
     return k;
 }
@@ -167,14 +199,15 @@ int KDTreeFlann::SearchHybrid(const T &query,
     // It is also the recommended setting for search.
     // Other flann::Index::radiusSearch() implementations lose performance due
     // to memory allocation/deallocation.
-    if (data_.empty() || dataset_size_ <= 0 ||
+    if (dataset_size_ <= 0 ||
         size_t(query.rows()) != dimension_ || max_nn < 0) {
         return -1;
     }
     distance2.resize(max_nn);
-    std::vector<Eigen::Index> indices_eigen(max_nn);
-    int k = nanoflann_index_->index->knnSearch(
-            query.data(), max_nn, indices_eigen.data(), distance2.data());
+    thread_local std::vector<Eigen::Index> indices_eigen;
+    indices_eigen.resize(max_nn);
+    int k = SearchKNNRaw(query.data(), max_nn, indices_eigen.data(),
+                         distance2.data());
     k = std::distance(distance2.begin(),
                       std::lower_bound(distance2.begin(), distance2.begin() + k,
                                        radius * radius));
@@ -184,6 +217,86 @@ int KDTreeFlann::SearchHybrid(const T &query,
     return k;
 }
 
+bool KDTreeFlann::SearchKNN(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                            int knn,
+                            int *indices,
+                            double *distance2,
+                            int *counts) const {
+    if (dataset_size_ <= 0 || size_t(queries.rows()) != dimension_ ||
+        knn < 0) {
+        return false;
+    }
+    const int64_t num_queries = queries.cols();
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_queries; ++i) {
+        thread_local std::vector<Eigen::Index> indices_eigen;
+        indices_eigen.resize(knn);
+        int *row_indices = indices + i * knn;
+        double *row_distance2 = distance2 + i * knn;
+        int k = SearchKNNRaw(queries.col(i).data(), knn, indices_eigen.data(),
+                             row_distance2);
+        std::copy_n(indices_eigen.begin(), k, row_indices);
+        std::fill(row_indices + k, row_indices + knn, -1);
+        std::fill(row_distance2 + k, row_distance2 + knn, 0.0);
+        if (counts) {
+            counts[i] = k;
+        }
+    }
+    return true;
+}
+
+bool KDTreeFlann::SearchHybrid(
+        const Eigen::Ref<const Eigen::MatrixXd> &queries,
+        double radius,
+        int max_nn,
+        int *indices,
+        double *distance2,
+        int *counts) const {
+    if (dataset_size_ <= 0 || size_t(queries.rows()) != dimension_ ||
+        max_nn < 0) {
+        return false;
+    }
+    const int64_t num_queries = queries.cols();
+    const double radius2 = radius * radius;
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_queries; ++i) {
+        thread_local std::vector<Eigen::Index> indices_eigen;
+        indices_eigen.resize(max_nn);
+        int *row_indices = indices + i * max_nn;
+        double *row_distance2 = distance2 + i * max_nn;
+        int k = SearchKNNRaw(queries.col(i).data(), max_nn,
+                             indices_eigen.data(), row_distance2);
+        k = std::distance(row_distance2,
+                          std::lower_bound(row_distance2, row_distance2 + k,
+                                           radius2));
+        std::copy_n(indices_eigen.begin(), k, row_indices);
+        std::fill(row_indices + k, row_indices + max_nn, -1);
+        std::fill(row_distance2 + k, row_distance2 + max_nn, 0.0);
+        if (counts) {
+            counts[i] = k;
+        }
+    }
+    return true;
+}
+
+int KDTreeFlann::SearchKNNRaw(const double *query,
+                              int knn,
+                              Eigen::Index *indices,
+                              double *distance2) const {
+    if (precision_ == Precision::Float64) {
+        return int(nanoflann_index_->index->knnSearch(query, knn, indices,
+                                                      distance2));
+    }
+    thread_local std::vector<float> query_float;
+    thread_local std::vector<float> distance2_float;
+    query_float.assign(query, query + dimension_);
+    distance2_float.resize(knn);
+    int k = int(nanoflann_index_float_->index->knnSearch(
+            query_float.data(), knn, indices, distance2_float.data()));
+    std::copy_n(distance2_float.begin(), k, distance2);
+    return k;
+}
+
 bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
     dimension_ = data.rows();
     dataset_size_ = data.cols();
@@ -191,6 +304,24 @@ bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
         utility::LogWarning("[KDTreeFlann::SetRawData] Failed due to no data.");
         return false;
     }
+    loaded_data_.reset();
+    if (precision_ == Precision::Float32) {
+        data_.clear();
+        data_interface_.reset();
+        nanoflann_index_.reset();
+        data_float_.resize(dataset_size_ * dimension_);
+        std::copy_n(data.data(), dataset_size_ * dimension_,
+                    data_float_.begin());
+        data_interface_float_.reset(new Eigen::Map<const Eigen::MatrixXf>(
+                data_float_.data(), dimension_, dataset_size_));
+        nanoflann_index_float_.reset(new KDTreeFloat_t(
+                dimension_, std::cref(*data_interface_float_), 15));
+        nanoflann_index_float_->index->buildIndex();
+        return true;
+    }
+    data_float_.clear();
+    data_interface_float_.reset();
+    nanoflann_index_float_.reset();
     data_.resize(dataset_size_ * dimension_);
     memcpy(data_.data(), data.data(),
            dataset_size_ * dimension_ * sizeof(double));
@@ -201,6 +332,82 @@ bool KDTreeFlann::SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data) {
     return true;
 }
 
+bool KDTreeFlann::Save(const std::string &file_name) const {
+    if (dataset_size_ == 0) {
+        utility::LogWarning("[KDTreeFlann::Save] Failed due to no data.");
+        return false;
+    }
+    const bool is_float = precision_ == Precision::Float32;
+    void *data_ptr =
+            is_float ? const_cast<float *>(data_interface_float_->data())
+                     : static_cast<void *>(
+                               const_cast<double *>(data_interface_->data()));
+    // Column-major {dimension_, dataset_size_} data is row-major
+    // {dataset_size_, dimension_}.
+    const int64_t dimension = static_cast<int64_t>(dimension_);
+    auto blob = std::make_shared<core::Blob>(core::Device("CPU:0"), data_ptr,
+                                             [](void *) {});
+    core::Tensor points({static_cast<int64_t>(dataset_size_), dimension},
+                        {dimension, 1}, data_ptr,
+                        is_float ? core::Dtype::Float32 : core::Dtype::Float64,
+                        blob);
+    core::nns::WriteKDTreeFile(
+            file_name, points, sizeof(Eigen::Index), [&](FILE *fp) {
+                if (is_float) {
+                    nanoflann_index_float_->index->saveIndex(fp);
+                } else {
+                    nanoflann_index_->index->saveIndex(fp);
+                }
+            });
+    return true;
+}
+
+bool KDTreeFlann::Load(const std::string &file_name, bool memory_map) {
+    data_.clear();
+    data_interface_.reset();
+    nanoflann_index_.reset();
+    data_float_.clear();
+    data_interface_float_.reset();
+    nanoflann_index_float_.reset();
+    loaded_data_.reset();
+    // The nanoflann adaptor builds its tree on construction, so it is created
+    // on an empty view of the data, which is then extended to all points
+    // before the saved tree is read.
+    const core::Tensor data = core::nns::ReadKDTreeFile(
+            file_name, sizeof(Eigen::Index),
+            memory_map ? core::Tensor::MmapMode::ReadOnly
+                       : core::Tensor::MmapMode::None,
+            [&](const core::Tensor &points, FILE *fp) {
+                dataset_size_ = static_cast<size_t>(points.GetLength());
+                dimension_ = static_cast<size_t>(points.GetShape()[1]);
+                if (points.GetDtype() == core::Dtype::Float32) {
+                    using Map_t = Eigen::Map<const Eigen::MatrixXf>;
+                    precision_ = Precision::Float32;
+                    const float *data_ptr = points.GetDataPtr<float>();
+                    data_interface_float_.reset(
+                            new Map_t(data_ptr, dimension_, 0));
+                    nanoflann_index_float_.reset(new KDTreeFloat_t(
+                            dimension_, std::cref(*data_interface_float_),
+                            15));
+                    new (data_interface_float_.get())
+                            Map_t(data_ptr, dimension_, dataset_size_);
+                    nanoflann_index_float_->index->loadIndex(fp);
+                } else {
+                    using Map_t = Eigen::Map<const Eigen::MatrixXd>;
+                    precision_ = Precision::Float64;
+                    const double *data_ptr = points.GetDataPtr<double>();
+                    data_interface_.reset(new Map_t(data_ptr, dimension_, 0));
+                    nanoflann_index_.reset(new KDTree_t(
+                            dimension_, std::cref(*data_interface_), 15));
+                    new (data_interface_.get())
+                            Map_t(data_ptr, dimension_, dataset_size_);
+                    nanoflann_index_->index->loadIndex(fp);
+                }
+            });
+    loaded_data_ = std::make_shared<core::Tensor>(data);
+    return true;
+}
+
 template int KDTreeFlann::Search<Eigen::Vector3d>(
         const Eigen::Vector3d &query,
         const KDTreeSearchParam &param,
@@ -28,6 +28,7 @@
 
 #include <Eigen/Core>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "open3d/geometry/Geometry.h"
@@ -50,21 +51,43 @@ namespace geometry {
 /// \brief KDTree with FLANN for nearest neighbor search.
 class KDTreeFlann {
 public:
+    /// \enum Precision
+    ///
+    /// \brief Floating point precision of the data stored in the KDTree.
+    enum class Precision {
+        /// Stores a double precision copy of the data.
+        Float64,
+        /// Stores a single precision copy of the data, using half the memory.
+        /// Queries are converted to float and the returned squared distances
+        /// are computed in single precision.
+        Float32,
+    };
+
     /// \brief Default Constructor.
     KDTreeFlann();
+    /// \brief Constructor selecting the precision of the data.
+    ///
+    /// \param precision Precision used by the subsequent Set*() calls.
+    explicit KDTreeFlann(Precision precision);
     /// \brief Parameterized Constructor.
     ///
     /// \param data Provides set of data points for KDTree construction.
-    KDTreeFlann(const Eigen::MatrixXd &data);
+    /// \param precision Precision of the data stored in the KDTree.
+    KDTreeFlann(const Eigen::MatrixXd &data,
+                Precision precision = Precision::Float64);
     /// \brief Parameterized Constructor.
     ///
     /// \param geometry Provides geometry from which KDTree is constructed.
-    KDTreeFlann(const Geometry &geometry);
+    /// \param precision Precision of the data stored in the KDTree.
+    KDTreeFlann(const Geometry &geometry,
+                Precision precision = Precision::Float64);
     /// \brief Parameterized Constructor.
     ///
     /// \param feature Provides a set of features from which the KDTree is
     /// constructed.
-    KDTreeFlann(const pipelines::registration::Feature &feature);
+    /// \param precision Precision of the data stored in the KDTree.
+    KDTreeFlann(const pipelines::registration::Feature &feature,
+                Precision precision = Precision::Float64);
     ~KDTreeFlann();
     KDTreeFlann(const KDTreeFlann &) = delete;
     KDTreeFlann &operator=(const KDTreeFlann &) = delete;
@@ -108,6 +131,53 @@ public:
                      std::vector<int> &indices,
                      std::vector<double> &distance2) const;
 
+    /// Batched knn search over all columns of \p queries in parallel.
+    ///
+    /// \param queries Query points, one per column, with shape {dimension, n}.
+    /// \param knn Number of neighbors per query.
+    /// \param indices Preallocated buffer of n * knn indices. Row i starts at
+    /// i * knn and is padded with -1 if fewer than knn points exist.
+    /// \param distance2 Preallocated buffer of n * knn squared distances,
+    /// padded with 0.
+    /// \param counts Optional preallocated buffer of n neighbor counts.
+    /// \return False if the KDTree is empty or the input is invalid.
+    bool SearchKNN(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                   int knn,
+                   int *indices,
+                   double *distance2,
+                   int *counts = nullptr) const;
+
+    /// Batched hybrid search over all columns of \p queries in parallel. See
+    /// the batched SearchKNN() for the buffer layout, with max_nn entries per
+    /// query.
+    bool SearchHybrid(const Eigen::Ref<const Eigen::MatrixXd> &queries,
+                      double radius,
+                      int max_nn,
+                      int *indices,
+                      double *distance2,
+                      int *counts = nullptr) const;
+
+    /// Saves the data and the built tree to a file, so that the KDTree can be
+    /// restored by Load() without rebuilding it. The file format is shared
+    /// with core::nns::NanoFlannIndex::Save().
+    ///
+    /// \param file_name Path to the file, typically with the extension
+    /// ".o3dkd".
+    /// \return False if the KDTree is empty.
+    bool Save(const std::string &file_name) const;
+
+    /// Loads a KDTree saved by Save(), replacing the current data. The
+    /// precision is restored as saved.
+    ///
+    /// \param file_name Path to the file.
+    /// \param memory_map If true, the data is backed by the read-only
+    /// memory-mapped file instead of being read, so that processes loading the
+    /// same file share one copy of the data in the page cache.
+    bool Load(const std::string &file_name, bool memory_map = true);
+
+    /// Returns the precision of the data stored in the KDTree.
+    Precision GetPrecision() const { return precision_; }
+
 private:
     /// \brief Sets the KDTree data from the data provided by the other methods.
     ///
@@ -115,16 +185,34 @@ private:
     /// features, geometry, etc.
     bool SetRawData(const Eigen::Map<const Eigen::MatrixXd> &data);
 
+    /// Knn search of a single query of dimension_ values in either precision.
+    /// Returns the number of neighbors found.
+    int SearchKNNRaw(const double *query,
+                     int knn,
+                     Eigen::Index *indices,
+                     double *distance2) const;
+
 protected:
     using KDTree_t = nanoflann::KDTreeEigenMatrixAdaptor<
             Eigen::Map<const Eigen::MatrixXd>,
             -1,
             nanoflann::metric_L2,
             false>;
+    using KDTreeFloat_t = nanoflann::KDTreeEigenMatrixAdaptor<
+            Eigen::Map<const Eigen::MatrixXf>,
+            -1,
+            nanoflann::metric_L2,
+            false>;
 
+    Precision precision_ = Precision::Float64;
     std::vector<double> data_;
     std::unique_ptr<Eigen::Map<const Eigen::MatrixXd>> data_interface_;
     std::unique_ptr<KDTree_t> nanoflann_index_;
+    std::vector<float> data_float_;
+    std::unique_ptr<Eigen::Map<const Eigen::MatrixXf>> data_interface_float_;
+    std::unique_ptr<KDTreeFloat_t> nanoflann_index_float_;
+    /// Keeps the data read by Load() alive.
+    std::shared_ptr<void> loaded_data_;
     size_t dimension_ = 0;
     size_t dataset_size_ = 0;
 };
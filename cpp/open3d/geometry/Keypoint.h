@@ -35,6 +35,7 @@
 namespace open3d {
 namespace geometry {
 
+class NeighborCache;
 class PointCloud;
 
 namespace keypoint {
@@ -64,6 +65,30 @@ std::shared_ptr<PointCloud> ComputeISSKeypoints(const PointCloud &input,
                                                 double gamma_32 = 0.975,
                                                 int min_neighbors = 5);
 
+/// \brief Function that computes the ISS Keypoints from an input point cloud
+/// and precomputed neighbors, which can be shared with other algorithms.
+///
+/// \param input The input PointCloud where to compute the ISS Keypoints.
+/// \param neighbor_cache The neighbors of every point of \p input. It has to
+/// cover radius searches with \p salient_radius and \p non_max_radius.
+/// \param salient_radius The radius of the spherical neighborhood used to
+/// detect the keypoints
+/// \param non_max_radius The non maxima supression radius.
+/// \param gamma_21 The upper bound on the ratio between the second and the
+/// first eigenvalue
+/// \param gamma_32 The upper bound on the ratio between the third and the
+/// second eigenvalue
+/// \param min_neighbors Minimum number of neighbors that has to be found to
+/// consider a keypoint.
+std::shared_ptr<PointCloud> ComputeISSKeypoints(
+        const PointCloud &input,
+        const NeighborCache &neighbor_cache,
+        double salient_radius,
+        double non_max_radius,
+        double gamma_21 = 0.975,
+        double gamma_32 = 0.975,
+        int min_neighbors = 5);
+
 }  // namespace keypoint
 }  // namespace geometry
 }  // namespace open3d
@@ -0,0 +1,380 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <limits>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace geometry {
+
+/// Maximum depth such that 3 * depth bits fit in a 64-bit Morton code.
+static constexpr size_t kMaxLinearOctreeDepth = 21;
+
+/// Code of points out of bound, larger than any valid Morton code.
+static constexpr uint64_t kInvalidCode = std::numeric_limits<uint64_t>::max();
+
+/// Inserts two zero bits between each of the 21 lowest bits of v.
+static uint64_t SpreadBits(uint64_t v) {
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffff;
+    v = (v | v << 16) & 0x1f0000ff0000ff;
+    v = (v | v << 8) & 0x100f00f00f00f00f;
+    v = (v | v << 4) & 0x10c30c30c30c30c3;
+    v = (v | v << 2) & 0x1249249249249249;
+    return v;
+}
+
+/// Inverse of SpreadBits.
+static uint64_t CompactBits(uint64_t v) {
+    v &= 0x1249249249249249;
+    v = (v ^ (v >> 2)) & 0x10c30c30c30c30c3;
+    v = (v ^ (v >> 4)) & 0x100f00f00f00f00f;
+    v = (v ^ (v >> 8)) & 0x1f0000ff0000ff;
+    v = (v ^ (v >> 16)) & 0x1f00000000ffff;
+    v = (v ^ (v >> 32)) & 0x1fffff;
+    return v;
+}
+
+static uint64_t EncodeMorton(const Eigen::Vector3i& grid_index) {
+    return SpreadBits(grid_index(0)) | SpreadBits(grid_index(1)) << 1 |
+           SpreadBits(grid_index(2)) << 2;
+}
+
+static Eigen::Vector3i DecodeMorton(uint64_t code) {
+    return Eigen::Vector3i(int(CompactBits(code)), int(CompactBits(code >> 1)),
+                           int(CompactBits(code >> 2)));
+}
+
+/// Returns the positions i where codes[i] >> shift differs from
+/// codes[i - 1] >> shift, starting with 0 and followed by codes.size().
+static std::vector<size_t> SegmentBoundaries(const std::vector<uint64_t>& codes,
+                                             int shift) {
+    const size_t n = codes.size();
+    std::vector<size_t> flags(n);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, n),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                          for (size_t i = r.begin(); i < r.end(); ++i) {
+                              flags[i] = i == 0 ||
+                                         (codes[i] >> shift) !=
+                                                 (codes[i - 1] >> shift);
+                          }
+                      });
+    std::vector<size_t> positions(n);
+    utility::InclusivePrefixSum(flags.data(), flags.data() + n,
+                                positions.data());
+    const size_t num_segments = n == 0 ? 0 : positions.back();
+    std::vector<size_t> boundaries(num_segments + 1);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, n),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                          for (size_t i = r.begin(); i < r.end(); ++i) {
+                              if (flags[i]) boundaries[positions[i] - 1] = i;
+                          }
+                      });
+    boundaries[num_segments] = n;
+    return boundaries;
+}
+
+LinearOctree::LinearOctree(size_t max_depth)
+    : LinearOctree(max_depth, Eigen::Vector3d::Zero(), 0) {}
+
+LinearOctree::LinearOctree(size_t max_depth,
+                           const Eigen::Vector3d& origin,
+                           double size)
+    : origin_(origin), size_(size), max_depth_(max_depth) {
+    if (max_depth_ > kMaxLinearOctreeDepth) {
+        utility::LogError("max_depth must be at most {}, but got {}.",
+                          kMaxLinearOctreeDepth, max_depth_);
+    }
+}
+
+LinearOctree& LinearOctree::Clear() {
+    node_codes_.clear();
+    node_offsets_.clear();
+    point_indices_.clear();
+    leaf_colors_.clear();
+    return *this;
+}
+
+bool LinearOctree::IsEmpty() const { return node_codes_.empty(); }
+
+void LinearOctree::ConvertFromPointCloud(
+        const geometry::PointCloud& point_cloud, double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+
+    // Set bounds
+    Eigen::Array3d min_bound = point_cloud.GetMinBound();
+    Eigen::Array3d max_bound = point_cloud.GetMaxBound();
+    Eigen::Array3d center = (min_bound + max_bound) / 2;
+    Eigen::Array3d half_sizes = center - min_bound;
+    double max_half_size = half_sizes.maxCoeff();
+    origin_ = min_bound.min(center - max_half_size);
+    if (max_half_size == 0) {
+        size_ = size_expand;
+    } else {
+        size_ = max_half_size * 2 * (1 + size_expand);
+    }
+
+    Build(point_cloud.points_, point_cloud.colors_);
+}
+
+void LinearOctree::Build(const std::vector<Eigen::Vector3d>& points,
+                         const std::vector<Eigen::Vector3d>& colors) {
+    if (max_depth_ > kMaxLinearOctreeDepth) {
+        utility::LogError("max_depth must be at most {}, but got {}.",
+                          kMaxLinearOctreeDepth, max_depth_);
+    }
+    if (!colors.empty() && colors.size() != points.size()) {
+        utility::LogError(
+                "colors must be empty or of the same size as points, but got "
+                "{} colors for {} points.",
+                colors.size(), points.size());
+    }
+    Clear();
+
+    // Morton codes of the leaf containing each point.
+    const size_t num_points = points.size();
+    const int num_cells = 1 << max_depth_;
+    const double cell_scale = num_cells / size_;
+    std::vector<std::pair<uint64_t, size_t>> code_indices(num_points);
+    tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, num_points),
+            [&](const tbb::blocked_range<size_t>& r) {
+                for (size_t i = r.begin(); i < r.end(); ++i) {
+                    uint64_t code = kInvalidCode;
+                    if (Octree::IsPointInBound(points[i], origin_, size_)) {
+                        Eigen::Vector3i grid_index =
+                                ((points[i] - origin_) * cell_scale)
+                                        .array()
+                                        .floor()
+                                        .cast<int>()
+                                        .min(num_cells - 1)
+                                        .max(0);
+                        code = EncodeMorton(grid_index);
+                    }
+                    code_indices[i] = std::make_pair(code, i);
+                }
+            });
+    tbb::parallel_sort(code_indices.begin(), code_indices.end());
+
+    const size_t num_valid =
+            std::lower_bound(code_indices.begin(), code_indices.end(),
+                             std::make_pair(kInvalidCode, size_t(0))) -
+            code_indices.begin();
+    if (num_valid == 0) {
+        return;
+    }
+    std::vector<uint64_t> point_codes(num_valid);
+    point_indices_.resize(num_valid);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_valid),
+                      [&](const tbb::blocked_range<size_t>& r) {
+                          for (size_t i = r.begin(); i < r.end(); ++i) {
+                              point_codes[i] = code_indices[i].first;
+                              point_indices_[i] = code_indices[i].second;
+                          }
+                      });
+    code_indices.clear();
+    code_indices.shrink_to_fit();
+
+    // Leaf nodes, then parents by dropping the 3 lowest bits of the codes.
+    node_codes_.resize(max_depth_ + 1);
+    node_offsets_.resize(max_depth_ + 1);
+    const std::vector<uint64_t>* child_codes = &point_codes;
+    int shift = 0;
+    for (int depth = int(max_depth_); depth >= 0; --depth) {
+        std::vector<size_t> boundaries = SegmentBoundaries(*child_codes, shift);
+        const size_t num_nodes = boundaries.size() - 1;
+        std::vector<uint64_t>& codes = node_codes_[depth];
+        codes.resize(num_nodes);
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, num_nodes),
+                          [&](const tbb::blocked_range<size_t>& r) {
+                              for (size_t i = r.begin(); i < r.end(); ++i) {
+                                  codes[i] = (*child_codes)[boundaries[i]] >>
+                                             shift;
+                              }
+                          });
+        node_offsets_[depth] = std::move(boundaries);
+        child_codes = &codes;
+        shift = 3;
+    }
+
+    // Leaf colors from the last point of each leaf.
+    const std::vector<size_t>& leaf_offsets = node_offsets_[max_depth_];
+    const size_t num_leaves = leaf_offsets.size() - 1;
+    leaf_colors_.resize(num_leaves, Eigen::Vector3d::Zero());
+    if (!colors.empty()) {
+        tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, num_leaves),
+                [&](const tbb::blocked_range<size_t>& r) {
+                    for (size_t i = r.begin(); i < r.end(); ++i) {
+                        size_t last = point_indices_[leaf_offsets[i + 1] - 1];
+                        leaf_colors_[i] = colors[last];
+                    }
+                });
+    }
+}
+
+void LinearOctree::Traverse(
+        const std::function<bool(const OctreeNodeInfo& node_info,
+                                 size_t node_index,
+                                 size_t point_begin,
+                                 size_t point_end)>& f) const {
+    if (IsEmpty()) {
+        return;
+    }
+    // Explicit DFS stack of (depth, node index).
+    std::vector<std::pair<size_t, size_t>> stack = {{0, 0}};
+    while (!stack.empty()) {
+        const size_t depth = stack.back().first;
+        const size_t node_index = stack.back().second;
+        stack.pop_back();
+
+        const uint64_t code = node_codes_[depth][node_index];
+        const double node_size = size_ / double(uint64_t(1) << depth);
+        OctreeNodeInfo node_info(
+                origin_ + DecodeMorton(code).cast<double>() * node_size,
+                node_size, depth, depth == 0 ? 0 : code & 7);
+        size_t begin = node_index;
+        size_t end = node_index + 1;
+        for (size_t d = depth; d <= max_depth_; ++d) {
+            begin = node_offsets_[d][begin];
+            end = node_offsets_[d][end];
+        }
+        if (f(node_info, node_index, begin, end) || depth == max_depth_) {
+            continue;
+        }
+        const std::vector<size_t>& offsets = node_offsets_[depth];
+        for (size_t child = offsets[node_index + 1];
+             child > offsets[node_index]; --child) {
+            stack.emplace_back(depth + 1, child - 1);
+        }
+    }
+}
+
+int64_t LinearOctree::LocateLeafNode(const Eigen::Vector3d& point) const {
+    if (IsEmpty() || !Octree::IsPointInBound(point, origin_, size_)) {
+        return -1;
+    }
+    const int num_cells = 1 << max_depth_;
+    Eigen::Vector3i grid_index = ((point - origin_) * (num_cells / size_))
+                                         .array()
+                                         .floor()
+                                         .cast<int>()
+                                         .min(num_cells - 1)
+                                         .max(0);
+    const uint64_t code = EncodeMorton(grid_index);
+    const std::vector<uint64_t>& leaf_codes = node_codes_[max_depth_];
+    auto it = std::lower_bound(leaf_codes.begin(), leaf_codes.end(), code);
+    if (it == leaf_codes.end() || *it != code) {
+        return -1;
+    }
+    return it - leaf_codes.begin();
+}
+
+OctreeNodeInfo LinearOctree::GetLeafNodeInfo(size_t leaf_index) const {
+    const uint64_t code = node_codes_[max_depth_].at(leaf_index);
+    const double leaf_size = size_ / double(uint64_t(1) << max_depth_);
+    return OctreeNodeInfo(
+            origin_ + DecodeMorton(code).cast<double>() * leaf_size, leaf_size,
+            max_depth_, max_depth_ == 0 ? 0 : code & 7);
+}
+
+std::pair<size_t, size_t> LinearOctree::GetLeafPointRange(
+        size_t leaf_index) const {
+    const std::vector<size_t>& leaf_offsets = node_offsets_[max_depth_];
+    return std::make_pair(leaf_offsets.at(leaf_index),
+                          leaf_offsets.at(leaf_index + 1));
+}
+
+size_t LinearOctree::GetNumNodes(size_t depth) const {
+    if (depth >= node_codes_.size()) {
+        return 0;
+    }
+    return node_codes_[depth].size();
+}
+
+std::shared_ptr<geometry::VoxelGrid> LinearOctree::ToVoxelGrid() const {
+    auto voxel_grid = std::make_shared<geometry::VoxelGrid>();
+    voxel_grid->origin_ = origin_;
+    voxel_grid->voxel_size_ = size_ / double(uint64_t(1) << max_depth_);
+    const size_t num_leaves = GetNumLeafNodes();
+    voxel_grid->voxels_.reserve(num_leaves);
+    for (size_t i = 0; i < num_leaves; ++i) {
+        voxel_grid->AddVoxel(Voxel(DecodeMorton(node_codes_[max_depth_][i]),
+                                   leaf_colors_[i]));
+    }
+    return voxel_grid;
+}
+
+std::shared_ptr<geometry::Octree> LinearOctree::ToOctree() const {
+    auto octree =
+            std::make_shared<geometry::Octree>(max_depth_, origin_, size_);
+    // Internal node of each depth on the current DFS path.
+    std::vector<std::shared_ptr<OctreeInternalPointNode>> path(max_depth_);
+    auto f_build = [&](const OctreeNodeInfo& node_info, size_t node_index,
+                       size_t point_begin, size_t point_end) -> bool {
+        std::vector<size_t> indices(point_indices_.begin() + point_begin,
+                                    point_indices_.begin() + point_end);
+        std::shared_ptr<OctreeNode> node;
+        if (node_info.depth_ == max_depth_) {
+            auto leaf_node = std::make_shared<OctreePointColorLeafNode>();
+            leaf_node->color_ = leaf_colors_[node_index];
+            leaf_node->indices_ = std::move(indices);
+            node = leaf_node;
+        } else {
+            // Octree keeps the indices of internal nodes in insertion order.
+            std::sort(indices.begin(), indices.end());
+            auto internal_node = std::make_shared<OctreeInternalPointNode>();
+            internal_node->indices_ = std::move(indices);
+            path[node_info.depth_] = internal_node;
+            node = internal_node;
+        }
+        if (node_info.depth_ == 0) {
+            octree->root_node_ = node;
+        } else {
+            path[node_info.depth_ - 1]->children_[node_info.child_index_] =
+                    node;
+        }
+        return false;
+    };
+    Traverse(f_build);
+    return octree;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,189 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "open3d/geometry/Octree.h"
+
+namespace open3d {
+namespace geometry {
+
+class PointCloud;
+class VoxelGrid;
+
+/// \class LinearOctree
+///
+/// \brief Pointer-free octree stored as flat arrays sorted by Morton code.
+///
+/// Every node is identified by the Morton code of its integer coordinates at
+/// its depth. The bits of each level are ordered (z, y, x), so the child index
+/// of a node is x_index + y_index * 2 + z_index * 4, following the children
+/// ordering of OctreeInternalNode, and sorting the codes of one depth gives
+/// the DFS order of Octree::Traverse. For each depth, the nodes are kept as a
+/// sorted array of codes and an offsets array delimiting their children in
+/// the next depth. The offsets of the leaf depth delimit ranges of the sorted
+/// point indices instead.
+///
+/// The octree is built in parallel by computing the Morton codes of all
+/// points and sorting them, so it does not support incremental insertion.
+/// The maximum depth is limited to 21 to fit the codes in 64 bits.
+class LinearOctree {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the LinearOctree.
+    LinearOctree(size_t max_depth = 0);
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Sets the value of the max depth of the LinearOctree.
+    /// \param origin Sets the global min bound of the LinearOctree.
+    /// \param size Sets the outer bounding box edge size for the whole octree.
+    LinearOctree(size_t max_depth, const Eigen::Vector3d& origin, double size);
+
+    ~LinearOctree() {}
+
+public:
+    /// Clear all nodes, leaving origin, size and max_depth untouched.
+    LinearOctree& Clear();
+
+    /// Returns true if the octree has no node.
+    bool IsEmpty() const;
+
+    /// \brief Convert octree from point cloud.
+    ///
+    /// Bounds are computed as in Octree::ConvertFromPointCloud.
+    ///
+    /// \param point_cloud Input point cloud.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accomodate all
+    /// points.
+    void ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
+                               double size_expand = 0.01);
+
+    /// \brief Build the octree from points within the current bounds.
+    ///
+    /// Points out of bound are ignored. Leaf colors are taken from the last
+    /// point of each leaf, as Octree::ConvertFromPointCloud does.
+    ///
+    /// \param points Coordinates of the points.
+    /// \param colors Colors of the points. Empty or of the same size as
+    /// points.
+    void Build(const std::vector<Eigen::Vector3d>& points,
+               const std::vector<Eigen::Vector3d>& colors = {});
+
+    /// \brief DFS traversal of LinearOctree from the root, with callback
+    /// function called for each node.
+    ///
+    /// \param f Callback which fires with each traversed node. Arguments are
+    /// the node information, the index of the node among the nodes of its
+    /// depth, and the range [point_begin, point_end) into GetPointIndices()
+    /// of the points contained in the node. For leaf nodes (depth equal to
+    /// max_depth_), the node index is the leaf index. If f returns true,
+    /// children of this node will not be traversed.
+    void Traverse(const std::function<bool(const OctreeNodeInfo& node_info,
+                                           size_t node_index,
+                                           size_t point_begin,
+                                           size_t point_end)>& f) const;
+
+    /// \brief Returns the index of the leaf node where the query point
+    /// resides, or -1 if the point is out of bound or its leaf is empty.
+    ///
+    /// \param point Coordinates of the point.
+    int64_t LocateLeafNode(const Eigen::Vector3d& point) const;
+
+    /// \brief Returns the OctreeNodeInfo of a leaf node.
+    ///
+    /// \param leaf_index Index of the leaf node.
+    OctreeNodeInfo GetLeafNodeInfo(size_t leaf_index) const;
+
+    /// \brief Returns the range [point_begin, point_end) into
+    /// GetPointIndices() of the points contained in a leaf node.
+    ///
+    /// \param leaf_index Index of the leaf node.
+    std::pair<size_t, size_t> GetLeafPointRange(size_t leaf_index) const;
+
+    /// Returns the number of non-empty nodes at a depth.
+    size_t GetNumNodes(size_t depth) const;
+
+    /// Returns the number of non-empty leaf nodes.
+    size_t GetNumLeafNodes() const { return GetNumNodes(max_depth_); }
+
+    /// Returns the point indices, grouped by leaf node in DFS order.
+    const std::vector<size_t>& GetPointIndices() const {
+        return point_indices_;
+    }
+
+    /// Returns the colors of the leaf nodes.
+    const std::vector<Eigen::Vector3d>& GetLeafColors() const {
+        return leaf_colors_;
+    }
+
+    /// Convert to VoxelGrid, with one voxel per leaf node.
+    std::shared_ptr<geometry::VoxelGrid> ToVoxelGrid() const;
+
+    /// Convert to an Octree of OctreeInternalPointNode and
+    /// OctreePointColorLeafNode.
+    std::shared_ptr<geometry::Octree> ToOctree() const;
+
+public:
+    /// Global min bound (include). A point is within bound iff
+    /// origin_ <= point < origin_ + size_.
+    Eigen::Vector3d origin_;
+
+    /// Outer bounding box edge size for the whole octree. A point is within
+    /// bound iff origin_ <= point < origin_ + size_.
+    double size_;
+
+    /// Max depth of octree. The depth is defined as the distance from the
+    /// deepest leaf node to root. A tree with only the root node has depth 0.
+    size_t max_depth_;
+
+private:
+    /// Morton codes of the nodes at each depth, sorted.
+    std::vector<std::vector<uint64_t>> node_codes_;
+
+    /// For depth < max_depth_, node i has the children
+    /// [offsets[i], offsets[i + 1]) at depth + 1. For the leaf depth, the
+    /// offsets delimit ranges of point_indices_.
+    std::vector<std::vector<size_t>> node_offsets_;
+
+    /// Point indices sorted by leaf Morton code.
+    std::vector<size_t> point_indices_;
+
+    /// Colors of the leaf nodes.
+    std::vector<Eigen::Vector3d> leaf_colors_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
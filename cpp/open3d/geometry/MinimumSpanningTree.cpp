@@ -0,0 +1,208 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/MinimumSpanningTree.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace geometry {
+
+std::vector<WeightedEdge> MinimumSpanningTree(
+        const std::vector<WeightedEdge> &edges,
+        size_t num_vertices,
+        std::vector<int64_t> *components) {
+    const int64_t n = int64_t(num_vertices);
+    const int64_t num_edges = int64_t(edges.size());
+    for (const WeightedEdge &edge : edges) {
+        if (edge.v0_ >= num_vertices || edge.v1_ >= num_vertices) {
+            utility::LogError(
+                    "[MinimumSpanningTree] Edge ({}, {}) is out of range of "
+                    "{} vertices.",
+                    edge.v0_, edge.v1_, num_vertices);
+        }
+    }
+
+    // Total order of the edges, ties of the weights are broken by the index.
+    auto Less = [&edges](int64_t e0, int64_t e1) {
+        return edges[e0].weight_ < edges[e1].weight_ ||
+               (edges[e0].weight_ == edges[e1].weight_ && e0 < e1);
+    };
+
+    // Every vertex points to the representative vertex of its component.
+    std::vector<int64_t> component(n);
+    std::iota(component.begin(), component.end(), 0);
+    std::vector<int64_t> parent(n);
+    std::vector<int64_t> next_parent(n);
+    std::vector<std::atomic<int64_t>> cheapest(n);
+    std::vector<char> in_tree(num_edges, 0);
+    // Edges between different components.
+    std::vector<int64_t> candidates(num_edges);
+    std::iota(candidates.begin(), candidates.end(), 0);
+
+    while (true) {
+        candidates.erase(
+                std::remove_if(candidates.begin(), candidates.end(),
+                               [&](int64_t e) {
+                                   return component[edges[e].v0_] ==
+                                          component[edges[e].v1_];
+                               }),
+                candidates.end());
+        if (candidates.empty()) {
+            break;
+        }
+#pragma omp parallel for schedule(static)
+        for (int64_t c = 0; c < n; ++c) {
+            cheapest[c].store(-1, std::memory_order_relaxed);
+        }
+
+        // Cheapest edge leaving every component.
+        const int64_t num_candidates = int64_t(candidates.size());
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_candidates; ++i) {
+            const int64_t e = candidates[i];
+            for (int64_t c : {component[edges[e].v0_],
+                              component[edges[e].v1_]}) {
+                int64_t current = cheapest[c].load(std::memory_order_relaxed);
+                while ((current == -1 || Less(e, current)) &&
+                       !cheapest[c].compare_exchange_weak(current, e)) {
+                }
+            }
+        }
+
+        // Hook every component to the component across its cheapest edge.
+        // The cheapest edges form a forest, except for pairs of components
+        // with the same cheapest edge, where the smaller one stays the root.
+#pragma omp parallel for schedule(static)
+        for (int64_t c = 0; c < n; ++c) {
+            parent[c] = component[c];
+            const int64_t e = cheapest[c].load(std::memory_order_relaxed);
+            if (component[c] != c || e == -1) {
+                continue;
+            }
+            const int64_t c0 = component[edges[e].v0_];
+            const int64_t other = c0 == c ? component[edges[e].v1_] : c0;
+            if (cheapest[other].load(std::memory_order_relaxed) == e &&
+                c < other) {
+                continue;
+            }
+            parent[c] = other;
+            in_tree[e] = 1;
+        }
+
+        // Pointer jumping until every component points to its new root.
+        int64_t num_changed = 1;
+        while (num_changed > 0) {
+            num_changed = 0;
+#pragma omp parallel for schedule(static) reduction(+ : num_changed)
+            for (int64_t c = 0; c < n; ++c) {
+                next_parent[c] = parent[parent[c]];
+                num_changed += next_parent[c] != parent[c];
+            }
+            std::swap(parent, next_parent);
+        }
+#pragma omp parallel for schedule(static)
+        for (int64_t v = 0; v < n; ++v) {
+            component[v] = parent[component[v]];
+        }
+    }
+
+    std::vector<WeightedEdge> tree;
+    tree.reserve(std::max<int64_t>(n - 1, 0));
+    for (int64_t e = 0; e < num_edges; ++e) {
+        if (in_tree[e]) {
+            tree.push_back(edges[e]);
+        }
+    }
+    if (components != nullptr) {
+        *components = std::move(component);
+    }
+    return tree;
+}
+
+void BreadthFirstTraversal(const std::vector<WeightedEdge> &tree,
+                           size_t num_vertices,
+                           const std::vector<int64_t> &roots,
+                           std::vector<int64_t> &order,
+                           std::vector<int64_t> &level_offsets,
+                           std::vector<int64_t> &parents) {
+    const int64_t n = int64_t(num_vertices);
+
+    // Adjacency lists of the forest in compressed row form.
+    std::vector<int64_t> adjacency_offsets(n + 1, 0);
+    for (const WeightedEdge &edge : tree) {
+        ++adjacency_offsets[edge.v0_ + 1];
+        ++adjacency_offsets[edge.v1_ + 1];
+    }
+    std::partial_sum(adjacency_offsets.begin(), adjacency_offsets.end(),
+                     adjacency_offsets.begin());
+    std::vector<int64_t> adjacency(adjacency_offsets[n]);
+    std::vector<int64_t> fill(adjacency_offsets.begin(),
+                              adjacency_offsets.end() - 1);
+    for (const WeightedEdge &edge : tree) {
+        adjacency[fill[edge.v0_]++] = int64_t(edge.v1_);
+        adjacency[fill[edge.v1_]++] = int64_t(edge.v0_);
+    }
+
+    parents.assign(n, -1);
+    order = roots;
+    order.reserve(n);
+    level_offsets = {0, int64_t(order.size())};
+    // Small levels, e.g. along long branches, are not worth a parallel region.
+    const int64_t kMinParallelLevelSize = 1024;
+    while (level_offsets.back() > level_offsets[level_offsets.size() - 2]) {
+        const int64_t begin = level_offsets[level_offsets.size() - 2];
+        const int64_t end = level_offsets.back();
+#pragma omp parallel if (end - begin >= kMinParallelLevelSize)
+        {
+            std::vector<int64_t> next_level;
+#pragma omp for schedule(static)
+            for (int64_t i = begin; i < end; ++i) {
+                const int64_t v = order[i];
+                // In a forest, every neighbor but the parent is a new child.
+                for (int64_t j = adjacency_offsets[v];
+                     j < adjacency_offsets[v + 1]; ++j) {
+                    const int64_t w = adjacency[j];
+                    if (w != parents[v]) {
+                        parents[w] = v;
+                        next_level.push_back(w);
+                    }
+                }
+            }
+#pragma omp critical
+            order.insert(order.end(), next_level.begin(), next_level.end());
+        }
+        level_offsets.push_back(int64_t(order.size()));
+    }
+    level_offsets.pop_back();
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// Edge of an undirected weighted graph.
+struct WeightedEdge {
+    WeightedEdge(size_t v0, size_t v1, double weight)
+        : v0_(v0), v1_(v1), weight_(weight) {}
+    size_t v0_;
+    size_t v1_;
+    double weight_;
+};
+
+/// \brief Computes a minimum spanning forest of a graph with Borůvka's
+/// algorithm.
+///
+/// In every round, the cheapest edge leaving each component is found in
+/// parallel with atomic updates, and the components are merged along these
+/// edges by hooking and pointer jumping. The number of components at least
+/// halves every round. Ties of the weights are broken by the edge index, so
+/// that the result is unique.
+///
+/// \param edges Edges of the graph.
+/// \param num_vertices Number of vertices, all vertex indices of the edges
+/// must be smaller.
+/// \param components If not null, set to the component of every vertex, the
+/// index of a representative vertex of the component.
+/// \return The edges of the forest, in the order of \p edges.
+std::vector<WeightedEdge> MinimumSpanningTree(
+        const std::vector<WeightedEdge> &edges,
+        size_t num_vertices,
+        std::vector<int64_t> *components = nullptr);
+
+/// \brief Traverses a forest breadth-first from \p roots, processing each
+/// level in parallel.
+///
+/// \param tree Edges of the forest, e.g. from MinimumSpanningTree().
+/// \param num_vertices Number of vertices.
+/// \param roots Start vertices, at most one per tree.
+/// \param order Set to the reached vertices level by level, starting with
+/// the roots. The order within a level is unspecified.
+/// \param level_offsets Set such that the vertices of level l are
+/// order[level_offsets[l]] to order[level_offsets[l + 1] - 1].
+/// \param parents Set to the parent of every reached vertex, -1 for the roots
+/// and the vertices that are not reached.
+void BreadthFirstTraversal(const std::vector<WeightedEdge> &tree,
+                           size_t num_vertices,
+                           const std::vector<int64_t> &roots,
+                           std::vector<int64_t> &order,
+                           std::vector<int64_t> &level_offsets,
+                           std::vector<int64_t> &parents);
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,164 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/NeighborCache.h"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Returns the radius and the maximal number of neighbors of \p search_param,
+/// infinite and -1 respectively if unlimited.
+std::pair<double, int> GetSearchLimits(const KDTreeSearchParam &search_param) {
+    switch (search_param.GetSearchType()) {
+        case KDTreeSearchParam::SearchType::Knn:
+            return std::make_pair(
+                    std::numeric_limits<double>::infinity(),
+                    static_cast<const KDTreeSearchParamKNN &>(search_param)
+                            .knn_);
+        case KDTreeSearchParam::SearchType::Radius:
+            return std::make_pair(
+                    static_cast<const KDTreeSearchParamRadius &>(search_param)
+                            .radius_,
+                    -1);
+        case KDTreeSearchParam::SearchType::Hybrid: {
+            const auto &hybrid_param =
+                    static_cast<const KDTreeSearchParamHybrid &>(search_param);
+            return std::make_pair(hybrid_param.radius_, hybrid_param.max_nn_);
+        }
+        default:
+            utility::LogError("Unsupported KDTree search type.");
+    }
+    return std::make_pair(0.0, 0);
+}
+
+}  // namespace
+
+NeighborCache::NeighborCache(const KDTreeFlann &kdtree,
+                             const std::vector<Eigen::Vector3d> &queries,
+                             const KDTreeSearchParam &search_param) {
+    std::tie(radius_, max_nn_) = GetSearchLimits(search_param);
+    const int num_queries = int(queries.size());
+    offsets_.assign(num_queries + 1, 0);
+
+    // The queries are searched in blocks, whose results are concatenated in
+    // order.
+    const int block_size = 1024;
+    const int num_blocks = (num_queries + block_size - 1) / block_size;
+    std::vector<std::vector<int>> block_indices(num_blocks);
+    std::vector<std::vector<double>> block_distance2(num_blocks);
+#pragma omp parallel
+    {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+#pragma omp for schedule(dynamic)
+        for (int block = 0; block < num_blocks; ++block) {
+            const int end = std::min(num_queries, (block + 1) * block_size);
+            for (int i = block * block_size; i < end; ++i) {
+                int k = std::max(kdtree.Search(queries[i], search_param,
+                                               indices, distance2),
+                                 0);
+                offsets_[i + 1] = k;
+                block_indices[block].insert(block_indices[block].end(),
+                                            indices.begin(),
+                                            indices.begin() + k);
+                block_distance2[block].insert(block_distance2[block].end(),
+                                              distance2.begin(),
+                                              distance2.begin() + k);
+            }
+        }
+    }
+    for (int i = 0; i < num_queries; ++i) {
+        offsets_[i + 1] += offsets_[i];
+    }
+
+    indices_.resize(offsets_.back());
+    distance2_.resize(offsets_.back());
+#pragma omp parallel for schedule(static)
+    for (int block = 0; block < num_blocks; ++block) {
+        const int64_t begin = offsets_[block * block_size];
+        std::copy(block_indices[block].begin(), block_indices[block].end(),
+                  indices_.begin() + begin);
+        std::copy(block_distance2[block].begin(), block_distance2[block].end(),
+                  distance2_.begin() + begin);
+    }
+}
+
+NeighborCache::NeighborCache(const PointCloud &pcd,
+                             const KDTreeSearchParam &search_param)
+    : NeighborCache(KDTreeFlann(pcd), pcd.points_, search_param) {}
+
+bool NeighborCache::Covers(const KDTreeSearchParam &search_param) const {
+    double radius;
+    int max_nn;
+    std::tie(radius, max_nn) = GetSearchLimits(search_param);
+    if (radius > radius_) {
+        return false;
+    }
+    return max_nn_ < 0 || (max_nn >= 0 && max_nn <= max_nn_);
+}
+
+int NeighborCache::Search(size_t query_idx,
+                          const KDTreeSearchParam &search_param,
+                          std::vector<int> &indices,
+                          std::vector<double> &distance2) const {
+    if (!Covers(search_param)) {
+        utility::LogError(
+                "[NeighborCache::Search] The search is not covered by the "
+                "cached search.");
+    }
+    double radius;
+    int max_nn;
+    std::tie(radius, max_nn) = GetSearchLimits(search_param);
+    const double radius2 = radius * radius;
+    const int64_t begin = offsets_[query_idx];
+    int64_t end = offsets_[query_idx + 1];
+    if (max_nn >= 0) {
+        end = std::min(end, begin + max_nn);
+    }
+    if (radius < radius_) {
+        // The strict comparison matches KDTreeFlann::SearchHybrid().
+        end = std::lower_bound(distance2_.begin() + begin,
+                               distance2_.begin() + end, radius2) -
+              distance2_.begin();
+    }
+    indices.assign(indices_.begin() + begin, indices_.begin() + end);
+    distance2.assign(distance2_.begin() + begin, distance2_.begin() + end);
+    return int(end - begin);
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <vector>
+
+#include "open3d/geometry/KDTreeSearchParam.h"
+
+namespace open3d {
+namespace geometry {
+
+class KDTreeFlann;
+class PointCloud;
+
+/// \class NeighborCache
+///
+/// \brief Neighbors of a set of query points, searched once in parallel and
+/// stored in flat arrays, so that several algorithms can share them.
+///
+/// The neighbors of query i are indices_[offsets_[i]] to
+/// indices_[offsets_[i + 1] - 1], sorted by increasing distance. Searches with
+/// a smaller radius or fewer neighbors than the cached search are answered
+/// from prefixes of these lists, see Covers().
+class NeighborCache {
+public:
+    /// \brief Default Constructor.
+    NeighborCache() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param kdtree KDTree in which the neighbors are searched.
+    /// \param queries Query points.
+    /// \param search_param KDTree search parameters of the cached search.
+    NeighborCache(const KDTreeFlann &kdtree,
+                  const std::vector<Eigen::Vector3d> &queries,
+                  const KDTreeSearchParam &search_param);
+    /// \brief Parameterized Constructor searching the neighbors of every point
+    /// of \p pcd among the points of \p pcd.
+    ///
+    /// \param pcd Point cloud providing the queries and the KDTree data.
+    /// \param search_param KDTree search parameters of the cached search.
+    NeighborCache(const PointCloud &pcd, const KDTreeSearchParam &search_param);
+
+public:
+    /// Returns the number of query points.
+    size_t NumQueries() const {
+        return offsets_.empty() ? 0 : offsets_.size() - 1;
+    }
+
+    /// Returns the number of cached neighbors of query \p query_idx.
+    int NumNeighbors(size_t query_idx) const {
+        return int(offsets_[query_idx + 1] - offsets_[query_idx]);
+    }
+
+    /// Returns true if the results of \p search_param are prefixes of the
+    /// cached neighbor lists, i.e. if its radius is at most the cached radius
+    /// and, unless the cached search is a pure radius search, if it is limited
+    /// to at most as many neighbors as the cached search.
+    bool Covers(const KDTreeSearchParam &search_param) const;
+
+    /// Returns the neighbors of query \p query_idx for \p search_param, which
+    /// has to be covered by the cache, like KDTreeFlann::Search() does for the
+    /// query point.
+    int Search(size_t query_idx,
+               const KDTreeSearchParam &search_param,
+               std::vector<int> &indices,
+               std::vector<double> &distance2) const;
+
+public:
+    /// Offsets of the neighbor lists of the queries in indices_ and
+    /// distance2_, with a final entry of the total number of neighbors. The
+    /// total can exceed the range of int for large caches.
+    std::vector<int64_t> offsets_;
+    /// Concatenated neighbor indices of all queries.
+    std::vector<int> indices_;
+    /// Squared distances of the neighbors in indices_.
+    std::vector<double> distance2_;
+    /// Radius of the cached search, infinite for a KNN search.
+    double radius_ = 0;
+    /// Maximal number of neighbors of the cached search, -1 for a radius
+    /// search.
+    int max_nn_ = 0;
+};
+
+}  // namespace geometry
+}  // namespace open3d
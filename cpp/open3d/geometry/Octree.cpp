@@ -27,6 +27,7 @@
 #include "open3d/geometry/Octree.h"
 
 #include <json/json.h>
+#include <tbb/parallel_for.h>
 
 #include <Eigen/Dense>
 #include <algorithm>
@@ -555,6 +556,68 @@ Octree& Octree::Rotate(const Eigen::Matrix3d& R,
     return *this;
 }
 
+/// Minimum number of points of a node to build its children concurrently.
+static constexpr size_t kParallelBuildGrainSize = 4096;
+
+/// Builds the subtree of OctreeInternalPointNode and OctreePointColorLeafNode
+/// containing the points \p indices, which are within the bound of the node
+/// and in insertion order.
+static std::shared_ptr<OctreeNode> BuildPointColorSubtree(
+        const geometry::PointCloud& point_cloud,
+        const OctreeNodeInfo& node_info,
+        size_t max_depth,
+        std::vector<size_t> indices) {
+    if (node_info.depth_ == max_depth) {
+        auto leaf_node = std::make_shared<OctreePointColorLeafNode>();
+        if (point_cloud.HasColors() && !indices.empty()) {
+            leaf_node->color_ = point_cloud.colors_[indices.back()];
+        }
+        leaf_node->indices_ = std::move(indices);
+        return leaf_node;
+    }
+
+    // Partition the points by child, as in GetInsertionNodeInfo.
+    const double child_size = node_info.size_ / 2.0;
+    const Eigen::Vector3d center =
+            node_info.origin_ + Eigen::Vector3d::Constant(child_size);
+    std::vector<std::vector<size_t>> child_indices(8);
+    for (size_t idx : indices) {
+        const Eigen::Vector3d& point = point_cloud.points_[idx];
+        size_t child_index = (point(0) < center(0) ? 0 : 1) +
+                             (point(1) < center(1) ? 0 : 2) +
+                             (point(2) < center(2) ? 0 : 4);
+        child_indices[child_index].push_back(idx);
+    }
+
+    auto internal_node = std::make_shared<OctreeInternalPointNode>();
+    auto build_child = [&](size_t child_index) {
+        if (child_indices[child_index].empty()) {
+            return;
+        }
+        size_t x_index = child_index % 2;
+        size_t y_index = (child_index / 2) % 2;
+        size_t z_index = (child_index / 4) % 2;
+        Eigen::Vector3d child_origin =
+                node_info.origin_ + Eigen::Vector3d(x_index * child_size,
+                                                    y_index * child_size,
+                                                    z_index * child_size);
+        internal_node->children_[child_index] = BuildPointColorSubtree(
+                point_cloud,
+                OctreeNodeInfo(child_origin, child_size, node_info.depth_ + 1,
+                               child_index),
+                max_depth, std::move(child_indices[child_index]));
+    };
+    if (indices.size() >= kParallelBuildGrainSize) {
+        tbb::parallel_for(size_t(0), size_t(8), build_child);
+    } else {
+        for (size_t child_index = 0; child_index < 8; ++child_index) {
+            build_child(child_index);
+        }
+    }
+    internal_node->indices_ = std::move(indices);
+    return internal_node;
+}
+
 void Octree::ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
                                    double size_expand) {
     if (size_expand > 1 || size_expand < 0) {
@@ -575,17 +638,21 @@ void Octree::ConvertFromPointCloud(const geometry::PointCloud& point_cloud,
         size_ = max_half_size * 2 * (1 + size_expand);
     }
 
-    // Insert points
-    const bool has_colors = point_cloud.HasColors();
+    // Bulk insert points, building the subtrees of the octants concurrently.
+    // The result is the same as calling InsertPoint for each point in order.
+    if (point_cloud.points_.empty()) {
+        return;
+    }
+    std::vector<size_t> indices;
+    indices.reserve(point_cloud.points_.size());
     for (size_t idx = 0; idx < point_cloud.points_.size(); idx++) {
-        const Eigen::Vector3d& color =
-                has_colors ? point_cloud.colors_[idx] : Eigen::Vector3d::Zero();
-        InsertPoint(point_cloud.points_[idx],
-                    OctreePointColorLeafNode::GetInitFunction(),
-                    OctreePointColorLeafNode::GetUpdateFunction(idx, color),
-                    OctreeInternalPointNode::GetInitFunction(),
-                    OctreeInternalPointNode::GetUpdateFunction(idx));
+        if (IsPointInBound(point_cloud.points_[idx], origin_, size_)) {
+            indices.push_back(idx);
+        }
     }
+    root_node_ = BuildPointColorSubtree(
+            point_cloud, OctreeNodeInfo(origin_, size_, 0, 0), max_depth_,
+            std::move(indices));
 }
 
 void Octree::InsertPoint(
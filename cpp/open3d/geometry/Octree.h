@@ -311,6 +311,10 @@ public:
 public:
     /// \brief Convert octree from point cloud.
     ///
+    /// The points are partitioned by octant and the subtrees are built
+    /// concurrently. The result is the same as inserting the points one by one
+    /// with OctreePointColorLeafNode and OctreeInternalPointNode.
+    ///
     /// \param point_cloud Input point cloud.
     /// \param size_expand A small expansion size such that the octree is
     /// slightly bigger than the original point cloud bounds to accomodate all
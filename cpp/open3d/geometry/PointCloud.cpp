@@ -26,10 +26,13 @@
 
 #include "open3d/geometry/PointCloud.h"
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
 #include <algorithm>
 #include <numeric>
 #include <random>
+#include <tuple>
 
 #include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/KDTreeFlann.h"
@@ -301,6 +304,141 @@ private:
     std::vector<point_cubic_id> original_id;
     std::unordered_map<int, int> classes;
 };
+
+/// Stable parallel LSD radix sort of (key, point id) pairs by the low
+/// num_key_bits bits of the keys. The result does not depend on the number of
+/// threads.
+void RadixSortByKey(std::vector<std::pair<uint64_t, size_t>> &pairs,
+                    int num_key_bits) {
+    const int digit_bits = 11;
+    const size_t num_buckets = size_t(1) << digit_bits;
+    const int64_t chunk_size = 1 << 16;
+    const int64_t num_points = int64_t(pairs.size());
+    const int64_t num_chunks = (num_points + chunk_size - 1) / chunk_size;
+    std::vector<std::pair<uint64_t, size_t>> buffer(num_points);
+    std::vector<size_t> offsets(num_chunks * num_buckets);
+    for (int shift = 0; shift < num_key_bits; shift += digit_bits) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+#pragma omp parallel for schedule(static)
+        for (int64_t c = 0; c < num_chunks; c++) {
+            size_t *counts = offsets.data() + c * num_buckets;
+            int64_t end = std::min(num_points, (c + 1) * chunk_size);
+            for (int64_t i = c * chunk_size; i < end; i++) {
+                counts[(pairs[i].first >> shift) & (num_buckets - 1)]++;
+            }
+        }
+        // Scanning in (bucket, chunk) order keeps every pass stable.
+        size_t sum = 0;
+        for (size_t bucket = 0; bucket < num_buckets; bucket++) {
+            for (int64_t c = 0; c < num_chunks; c++) {
+                size_t &offset = offsets[c * num_buckets + bucket];
+                size_t count = offset;
+                offset = sum;
+                sum += count;
+            }
+        }
+#pragma omp parallel for schedule(static)
+        for (int64_t c = 0; c < num_chunks; c++) {
+            size_t *chunk_offsets = offsets.data() + c * num_buckets;
+            int64_t end = std::min(num_points, (c + 1) * chunk_size);
+            for (int64_t i = c * chunk_size; i < end; i++) {
+                size_t bucket = (pairs[i].first >> shift) & (num_buckets - 1);
+                buffer[chunk_offsets[bucket]++] = pairs[i];
+            }
+        }
+        pairs.swap(buffer);
+    }
+}
+
+/// Groups the points by voxel. On return, sorted_ids holds the point ids
+/// sorted by voxel index and then by point id, and the points of voxel v are
+/// sorted_ids[voxel_offsets[v]] to sorted_ids[voxel_offsets[v + 1] - 1]. The
+/// voxels are sorted lexicographically by voxel index.
+void GroupPointsByVoxel(const std::vector<Eigen::Vector3d> &points,
+                        const Eigen::Vector3d &voxel_min_bound,
+                        double voxel_size,
+                        std::vector<size_t> &sorted_ids,
+                        std::vector<size_t> &voxel_offsets) {
+    const int64_t num_points = int64_t(points.size());
+    std::vector<Eigen::Vector3i> voxel_indices(num_points);
+    Eigen::Vector3i index_min =
+            Eigen::Vector3i::Constant(std::numeric_limits<int>::max());
+    Eigen::Vector3i index_max =
+            Eigen::Vector3i::Constant(std::numeric_limits<int>::min());
+#pragma omp parallel
+    {
+        Eigen::Vector3i local_min = index_min;
+        Eigen::Vector3i local_max = index_max;
+#pragma omp for schedule(static)
+        for (int64_t i = 0; i < num_points; i++) {
+            Eigen::Vector3d ref_coord =
+                    (points[i] - voxel_min_bound) / voxel_size;
+            voxel_indices[i] << int(floor(ref_coord(0))),
+                    int(floor(ref_coord(1))), int(floor(ref_coord(2)));
+            local_min = local_min.cwiseMin(voxel_indices[i]);
+            local_max = local_max.cwiseMax(voxel_indices[i]);
+        }
+#pragma omp critical
+        {
+            index_min = index_min.cwiseMin(local_min);
+            index_max = index_max.cwiseMax(local_max);
+        }
+    }
+
+    // Pack the voxel indices, relative to their minimum, into 64-bit keys with
+    // the same lexicographic order, using only as many bits as they span.
+    int bits[3] = {0, 0, 0};
+    for (int c = 0; c < 3 && num_points > 0; c++) {
+        uint64_t span = uint64_t(int64_t(index_max(c)) - index_min(c));
+        while (bits[c] < 64 && (span >> bits[c]) != 0) {
+            bits[c]++;
+        }
+    }
+    const int num_key_bits = bits[0] + bits[1] + bits[2];
+
+    std::vector<std::pair<uint64_t, size_t>> keys(num_points);
+    if (num_key_bits <= 64) {
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_points; i++) {
+            uint64_t key = 0;
+            for (int c = 0; c < 3; c++) {
+                key = (key << bits[c]) |
+                      uint64_t(int64_t(voxel_indices[i](c)) - index_min(c));
+            }
+            keys[i] = std::make_pair(key, size_t(i));
+        }
+        // Radix sort passes are stable, so that point ids stay sorted within
+        // each voxel.
+        RadixSortByKey(keys, num_key_bits);
+    } else {
+        // Rank the distinct voxel indices instead.
+        std::vector<size_t> ids(num_points);
+        std::iota(ids.begin(), ids.end(), size_t(0));
+        tbb::parallel_sort(ids.begin(), ids.end(), [&](size_t a, size_t b) {
+            return std::tie(voxel_indices[a](0), voxel_indices[a](1),
+                            voxel_indices[a](2), a) <
+                   std::tie(voxel_indices[b](0), voxel_indices[b](1),
+                            voxel_indices[b](2), b);
+        });
+        uint64_t rank = 0;
+        for (int64_t i = 0; i < num_points; i++) {
+            if (i > 0 && voxel_indices[ids[i]] != voxel_indices[ids[i - 1]]) {
+                rank++;
+            }
+            keys[i] = std::make_pair(rank, ids[i]);
+        }
+    }
+
+    sorted_ids.resize(num_points);
+    voxel_offsets.clear();
+    for (int64_t i = 0; i < num_points; i++) {
+        sorted_ids[i] = keys[i].second;
+        if (i == 0 || keys[i].first != keys[i - 1].first) {
+            voxel_offsets.push_back(size_t(i));
+        }
+    }
+    voxel_offsets.push_back(size_t(num_points));
+}
 }  // namespace
 
 std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
@@ -317,27 +455,34 @@ std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
+    // Sorting by voxel lets every voxel be averaged independently, summing
+    // its points in increasing index order as a serial pass would.
+    std::vector<size_t> sorted_ids, voxel_offsets;
+    GroupPointsByVoxel(points_, voxel_min_bound, voxel_size, sorted_ids,
+                       voxel_offsets);
+    const int64_t num_voxels = int64_t(voxel_offsets.size()) - 1;
 
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
-    }
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+#pragma omp parallel for schedule(static)
+    for (int64_t v = 0; v < num_voxels; v++) {
+        AccumulatedPoint accpoint;
+        for (size_t i = voxel_offsets[v]; i < voxel_offsets[v + 1]; i++) {
+            accpoint.AddPoint(*this, int(sorted_ids[i]));
+        }
+        output->points_[v] = accpoint.GetAveragePoint();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[v] = accpoint.GetAverageNormal();
         }
         if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
+            output->colors_[v] = accpoint.GetAverageColor();
         }
     }
     utility::LogDebug(
@@ -366,51 +511,56 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("[VoxelDownSample] voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPointForTrace,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    int cid_temp[3] = {1, 2, 4};
-    for (size_t i = 0; i < points_.size(); i++) {
-        auto ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        auto voxel_index = Eigen::Vector3i(int(floor(ref_coord(0))),
-                                           int(floor(ref_coord(1))),
-                                           int(floor(ref_coord(2))));
-        int cid = 0;
-        for (int c = 0; c < 3; c++) {
-            if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
-                cid += cid_temp[c];
-            }
-        }
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i, cid,
-                                                     approximate_class);
-    }
+    std::vector<size_t> sorted_ids, voxel_offsets;
+    GroupPointsByVoxel(points_, voxel_min_bound, voxel_size, sorted_ids,
+                       voxel_offsets);
+    const int64_t num_voxels = int64_t(voxel_offsets.size()) - 1;
+
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
-    int cnt = 0;
-    cubic_id.resize(voxelindex_to_accpoint.size(), 8);
+    int cid_temp[3] = {1, 2, 4};
+    cubic_id.resize(num_voxels, 8);
     cubic_id.setConstant(-1);
-    std::vector<std::vector<int>> original_indices(
-            voxelindex_to_accpoint.size());
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    std::vector<std::vector<int>> original_indices(num_voxels);
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+#pragma omp parallel for schedule(static)
+    for (int64_t v = 0; v < num_voxels; v++) {
+        AccumulatedPointForTrace accpoint;
+        for (size_t i = voxel_offsets[v]; i < voxel_offsets[v + 1]; i++) {
+            size_t pid = sorted_ids[i];
+            auto ref_coord = (points_[pid] - voxel_min_bound) / voxel_size;
+            int cid = 0;
+            for (int c = 0; c < 3; c++) {
+                if ((ref_coord(c) - floor(ref_coord(c))) >= 0.5) {
+                    cid += cid_temp[c];
+                }
+            }
+            accpoint.AddPoint(*this, pid, cid, approximate_class);
+        }
+        output->points_[v] = accpoint.GetAveragePoint();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[v] = accpoint.GetAverageNormal();
         }
         if (has_colors) {
             if (approximate_class) {
-                output->colors_.push_back(accpoint.second.GetMaxClass());
+                output->colors_[v] = accpoint.GetMaxClass();
             } else {
-                output->colors_.push_back(accpoint.second.GetAverageColor());
+                output->colors_[v] = accpoint.GetAverageColor();
             }
         }
-        auto original_id = accpoint.second.GetOriginalID();
+        auto original_id = accpoint.GetOriginalID();
         for (int i = 0; i < (int)original_id.size(); i++) {
             size_t pid = original_id[i].point_id;
             int cid = original_id[i].cubic_id;
-            cubic_id(cnt, cid) = int(pid);
-            original_indices[cnt].push_back(int(pid));
+            cubic_id(v, cid) = int(pid);
+            original_indices[v].push_back(int(pid));
         }
-        cnt++;
     }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
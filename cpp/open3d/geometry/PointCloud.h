@@ -43,6 +43,7 @@ class PinholeCameraIntrinsic;
 namespace geometry {
 
 class Image;
+class NeighborCache;
 class RGBDImage;
 class TriangleMesh;
 class VoxelGrid;
@@ -219,6 +220,17 @@ public:
             const KDTreeSearchParam &search_param = KDTreeSearchParamKNN(),
             bool fast_normal_computation = true);
 
+    /// \brief Function to compute the normals of a point cloud from
+    /// precomputed neighbors.
+    ///
+    /// \param neighbor_cache The neighbors of every point of the point cloud.
+    /// \param search_param The KDTree search parameters for neighborhood
+    /// search, which have to be covered by \p neighbor_cache.
+    /// \param fast_normal_computation See EstimateNormals() above.
+    void EstimateNormals(const NeighborCache &neighbor_cache,
+                         const KDTreeSearchParam &search_param,
+                         bool fast_normal_computation = true);
+
     /// \brief Function to orient the normals of a point cloud.
     ///
     /// \param orientation_reference Normals are oriented with respect to
@@ -288,7 +300,11 @@ public:
     /// in Large Spatial Databases with Noise", 1996
     ///
     /// Returns a list of point labels, -1 indicates noise according to
-    /// the algorithm.
+    /// the algorithm. The clusters are numbered in the order of their first
+    /// core point, and border points take the first cluster that reaches
+    /// them. Neighbors are scanned from a uniform grid of cells in parallel
+    /// instead of being precomputed, so that memory stays linear in the
+    /// number of points.
     ///
     /// \param eps Density parameter that is used to find neighbouring points.
     /// \param min_points Minimum number of points to form a cluster.
@@ -300,17 +316,48 @@ public:
 
     /// \brief Segment PointCloud plane using the RANSAC algorithm.
     ///
+    /// The hypotheses are evaluated in parallel. For large point clouds, each
+    /// hypothesis is first scored on a random subset of the points and is
+    /// discarded early if it cannot beat the best one.
+    ///
     /// \param distance_threshold Max distance a point can be from the plane
     /// model, and still be considered an inlier.
     /// \param ransac_n Number of initial points to be considered inliers in
     /// each iteration.
-    /// \param num_iterations Number of iterations.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// The iterations stop early once enough hypotheses have been sampled for
+    /// the inlier ratio of the best plane so far.
     /// \return Returns the plane model ax + by + cz + d = 0 and the indices of
     /// the plane inliers.
     std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlane(
             const double distance_threshold = 0.01,
             const int ransac_n = 3,
-            const int num_iterations = 100) const;
+            const int num_iterations = 100,
+            const double probability = 0.99999999) const;
+
+    /// \brief Segment several planes from the PointCloud by repeating
+    /// SegmentPlane on the points that are not inliers of the previous
+    /// planes, without copying the point cloud.
+    ///
+    /// \param distance_threshold Max distance a point can be from a plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations per plane.
+    /// \param max_num_planes Maximum number of planes to segment.
+    /// \param min_num_inliers Segmentation stops when a plane would have
+    /// fewer inliers.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \return Returns the plane models and the indices of the inliers of
+    /// each plane, in the order in which the planes were found.
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+    SegmentPlanes(const double distance_threshold = 0.01,
+                  const int ransac_n = 3,
+                  const int num_iterations = 100,
+                  const int max_num_planes = 1,
+                  const size_t min_num_inliers = 3,
+                  const double probability = 0.99999999) const;
 
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
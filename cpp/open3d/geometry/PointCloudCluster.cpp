@@ -24,88 +24,409 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
-#include <unordered_set>
+#include <atomic>
+#include <numeric>
+#include <tuple>
 
-#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
 namespace geometry {
 
-std::vector<int> PointCloud::ClusterDBSCAN(double eps,
-                                           size_t min_points,
-                                           bool print_progress) const {
-    KDTreeFlann kdtree(*this);
+namespace {
+
+typedef Eigen::Matrix<int64_t, 3, 1> CellIndex;
+/// Ranges [first, second) of consecutive cells.
+typedef std::vector<std::pair<int64_t, int64_t>> CellRanges;
 
-    // Precompute all neighbors.
-    utility::LogDebug("Precompute neighbors.");
-    utility::ConsoleProgressBar progress_bar(
-            points_.size(), "Precompute neighbors.", print_progress);
-    std::vector<std::vector<int>> nbs(points_.size());
+/// Points sorted into a uniform grid of cubic cells of size eps / 2,
+/// lexicographically by cell index. All the points of a cell lie within eps
+/// of each other, and all the neighbors of a point within eps lie in the
+/// 5 x 5 x 5 cells around the cell of the point.
+///
+/// The non-empty cells are grouped into columns of cells with the same x and
+/// y indices, and the columns into rows of columns with the same x index.
+/// The cells around a cell then form 25 ranges of consecutive cells, which
+/// are found by sweeping over the sorted rows, columns and cells without any
+/// lookup.
+class PointGrid {
+public:
+    PointGrid(const std::vector<Eigen::Vector3d> &points, double cell_size) {
+        const int num_points = int(points.size());
+        const Eigen::Vector3d min_bound = ComputeMinBound(points);
+        std::vector<CellIndex> point_cells(num_points);
 #pragma omp parallel for schedule(static)
-    for (int idx = 0; idx < int(points_.size()); ++idx) {
-        std::vector<double> dists2;
-        kdtree.SearchRadius(points_[idx], eps, nbs[idx], dists2);
+        for (int i = 0; i < num_points; i++) {
+            Eigen::Vector3d ref_coord = (points[i] - min_bound) / cell_size;
+            point_cells[i] << int64_t(floor(ref_coord(0))),
+                    int64_t(floor(ref_coord(1))), int64_t(floor(ref_coord(2)));
+        }
+        sorted_ids_.resize(num_points);
+        std::iota(sorted_ids_.begin(), sorted_ids_.end(), 0);
+        tbb::parallel_sort(
+                sorted_ids_.begin(), sorted_ids_.end(), [&](int a, int b) {
+                    return std::tie(point_cells[a](0), point_cells[a](1),
+                                    point_cells[a](2), a) <
+                           std::tie(point_cells[b](0), point_cells[b](1),
+                                    point_cells[b](2), b);
+                });
+
+        sorted_points_.resize(num_points);
+#pragma omp parallel for schedule(static)
+        for (int s = 0; s < num_points; s++) {
+            sorted_points_[s] = points[sorted_ids_[s]];
+        }
+        for (int s = 0; s < num_points; s++) {
+            const CellIndex &cell = point_cells[sorted_ids_[s]];
+            const CellIndex *prev_cell =
+                    s > 0 ? &point_cells[sorted_ids_[s - 1]] : nullptr;
+            if (prev_cell == nullptr || cell(0) != (*prev_cell)(0)) {
+                row_x_.push_back(cell(0));
+                row_offsets_.push_back(int64_t(column_y_.size()));
+            }
+            if (prev_cell == nullptr ||
+                cell.head<2>() != prev_cell->head<2>()) {
+                column_y_.push_back(cell(1));
+                column_offsets_.push_back(int64_t(cell_z_.size()));
+            }
+            if (prev_cell == nullptr || cell != *prev_cell) {
+                cell_z_.push_back(cell(2));
+                cell_offsets_.push_back(s);
+            }
+        }
+        row_offsets_.push_back(int64_t(column_y_.size()));
+        column_offsets_.push_back(int64_t(cell_z_.size()));
+        cell_offsets_.push_back(num_points);
+    }
+
+    int64_t NumCells() const { return int64_t(cell_z_.size()); }
 
+    /// First sorted position of the points of cell c.
+    int CellBegin(int64_t c) const { return cell_offsets_[c]; }
+
+    /// Last sorted position + 1 of the points of cell c.
+    int CellEnd(int64_t c) const { return cell_offsets_[c + 1]; }
+
+    /// Calls f(c, ranges) for every cell c in parallel, where ranges holds
+    /// the cells around c, including c itself. The cells are processed row
+    /// by row, advancing progress_bar by the points of each row.
+    template <typename F>
+    void ParallelForEachCell(utility::ConsoleProgressBar &progress_bar,
+                             F f) const {
+        const int64_t num_rows = int64_t(row_x_.size());
+        size_t progress = 0;
+#pragma omp parallel
+        {
+            CellRanges ranges;
+#pragma omp for schedule(dynamic, 1)
+            for (int64_t row = 0; row < num_rows; row++) {
+                ForEachCellInRow(row, ranges, f);
 #pragma omp critical(ClusterDBSCAN)
-        { ++progress_bar; }
+                {
+                    progress +=
+                            CellBegin(column_offsets_[row_offsets_[row + 1]]) -
+                            CellBegin(column_offsets_[row_offsets_[row]]);
+                    progress_bar.SetCurrentCount(progress);
+                }
+            }
+        }
     }
-    utility::LogDebug("Done Precompute neighbors.");
 
-    // Set all labels to undefined (-2).
-    utility::LogDebug("Compute Clusters");
-    progress_bar.Reset(points_.size(), "Clustering", print_progress);
-    std::vector<int> labels(points_.size(), -2);
-    int cluster_label = 0;
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        // Label is not undefined.
-        if (labels[idx] != -2) {
-            continue;
+    /// Index of the point at each sorted position.
+    std::vector<int> sorted_ids_;
+    /// Points in sorted order, for local access during the neighbor scans.
+    std::vector<Eigen::Vector3d> sorted_points_;
+
+private:
+    static Eigen::Vector3d ComputeMinBound(
+            const std::vector<Eigen::Vector3d> &points) {
+        return std::accumulate(
+                points.begin(), points.end(), points[0],
+                [](const Eigen::Vector3d &a, const Eigen::Vector3d &b) {
+                    return a.array().min(b.array()).matrix();
+                });
+    }
+
+    /// Advances begin over the sorted keys below min_key, and returns the end
+    /// of the following run of keys up to max_key.
+    static int64_t Sweep(const std::vector<int64_t> &keys,
+                         int64_t &begin,
+                         int64_t end,
+                         int64_t min_key,
+                         int64_t max_key) {
+        while (begin < end && keys[begin] < min_key) {
+            begin++;
         }
+        int64_t run_end = begin;
+        while (run_end < end && keys[run_end] <= max_key) {
+            run_end++;
+        }
+        return run_end;
+    }
 
-        // Check density.
-        if (nbs[idx].size() < min_points) {
-            labels[idx] = -1;
-            continue;
+    /// Calls f(c, ranges) for each cell c of row.
+    template <typename F>
+    void ForEachCellInRow(int64_t row, CellRanges &ranges, F &f) const {
+        // Current and end columns of the neighboring rows, and current and
+        // end cells of the neighboring columns. The current columns and cells
+        // only move forward, as the columns and cells are sorted.
+        int64_t nb_columns[5], nb_column_ends[5];
+        int num_nb_rows = 0;
+        int64_t nb_row = std::max<int64_t>(row - 2, 0);
+        const int64_t nb_row_end =
+                Sweep(row_x_, nb_row, int64_t(row_x_.size()), row_x_[row] - 2,
+                      row_x_[row] + 2);
+        for (; nb_row < nb_row_end; nb_row++) {
+            nb_columns[num_nb_rows] = row_offsets_[nb_row];
+            nb_column_ends[num_nb_rows] = row_offsets_[nb_row + 1];
+            num_nb_rows++;
+        }
+        int64_t nb_cells[25], nb_cell_ends[25];
+        for (int64_t col = row_offsets_[row]; col < row_offsets_[row + 1];
+             col++) {
+            const int64_t y = column_y_[col];
+            int num_nb_columns = 0;
+            for (int k = 0; k < num_nb_rows; k++) {
+                int64_t run_end = Sweep(column_y_, nb_columns[k],
+                                        nb_column_ends[k], y - 2, y + 2);
+                for (int64_t nb_col = nb_columns[k]; nb_col < run_end;
+                     nb_col++) {
+                    nb_cells[num_nb_columns] = column_offsets_[nb_col];
+                    nb_cell_ends[num_nb_columns] = column_offsets_[nb_col + 1];
+                    num_nb_columns++;
+                }
+            }
+            for (int64_t c = column_offsets_[col];
+                 c < column_offsets_[col + 1]; c++) {
+                const int64_t z = cell_z_[c];
+                ranges.clear();
+                for (int k = 0; k < num_nb_columns; k++) {
+                    int64_t run_end = Sweep(cell_z_, nb_cells[k],
+                                            nb_cell_ends[k], z - 2, z + 2);
+                    if (run_end > nb_cells[k]) {
+                        ranges.emplace_back(nb_cells[k], run_end);
+                    }
+                }
+                f(c, ranges);
+            }
         }
+    }
 
-        std::unordered_set<int> nbs_next(nbs[idx].begin(), nbs[idx].end());
-        std::unordered_set<int> nbs_visited;
-        nbs_visited.insert(int(idx));
+    /// x index and first column of each row.
+    std::vector<int64_t> row_x_;
+    std::vector<int64_t> row_offsets_;
+    /// y index and first cell of each column.
+    std::vector<int64_t> column_y_;
+    std::vector<int64_t> column_offsets_;
+    /// z index and first sorted position of each cell.
+    std::vector<int64_t> cell_z_;
+    std::vector<int> cell_offsets_;
+};
 
-        labels[idx] = cluster_label;
-        ++progress_bar;
-        while (!nbs_next.empty()) {
-            int nb = *nbs_next.begin();
-            nbs_next.erase(nbs_next.begin());
-            nbs_visited.insert(nb);
+/// Lock-free union-find. Roots are always linked below smaller roots, so
+/// that the root of every set is its smallest element regardless of the
+/// order of the unions.
+class ConcurrentUnionFind {
+public:
+    explicit ConcurrentUnionFind(int size) : parents_(size) {
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < size; i++) {
+            parents_[i].store(i, std::memory_order_relaxed);
+        }
+    }
 
-            // Noise label.
-            if (labels[nb] == -1) {
-                labels[nb] = cluster_label;
-                ++progress_bar;
+    int Find(int x) {
+        while (true) {
+            int parent = parents_[x].load();
+            if (parent == x) {
+                return x;
             }
-            // Not undefined label.
-            if (labels[nb] != -2) {
-                continue;
+            // Path halving: parents only ever decrease, so a failed exchange
+            // can safely be ignored.
+            int grandparent = parents_[parent].load();
+            if (grandparent != parent) {
+                parents_[x].compare_exchange_weak(parent, grandparent);
             }
-            labels[nb] = cluster_label;
-            ++progress_bar;
+            x = grandparent;
+        }
+    }
 
-            if (nbs[nb].size() >= min_points) {
-                for (int qnb : nbs[nb]) {
-                    if (nbs_visited.count(qnb) == 0) {
-                        nbs_next.insert(qnb);
+    void Union(int a, int b) {
+        while (true) {
+            a = Find(a);
+            b = Find(b);
+            if (a == b) {
+                return;
+            }
+            if (a < b) {
+                std::swap(a, b);
+            }
+            int expected = a;
+            if (parents_[a].compare_exchange_strong(expected, b)) {
+                return;
+            }
+        }
+    }
+
+private:
+    std::vector<std::atomic<int>> parents_;
+};
+
+}  // namespace
+
+std::vector<int> PointCloud::ClusterDBSCAN(double eps,
+                                           size_t min_points,
+                                           bool print_progress) const {
+    const int num_points = int(points_.size());
+    std::vector<int> labels(num_points, -1);
+    if (num_points == 0) {
+        return labels;
+    }
+
+    // The neighbors of every point are scanned from the grid cells around it
+    // whenever they are needed, instead of being stored. The cells are made
+    // slightly larger than eps / 2 so that rounding in the cell computation
+    // cannot move two neighbors further apart than 2 cells.
+    utility::LogDebug("Build grid.");
+    const double cell_size = std::abs(eps) * 0.5 * (1.0 + 1e-6);
+    PointGrid grid(points_, cell_size > 0 ? cell_size : 1.0);
+    const std::vector<int> &sorted_ids = grid.sorted_ids_;
+    const std::vector<Eigen::Vector3d> &sorted_points = grid.sorted_points_;
+    const int64_t num_cells = grid.NumCells();
+    const double eps2 = eps * eps;
+    auto is_neighbor = [&](int s, int t) {
+        return (sorted_points[s] - sorted_points[t]).squaredNorm() < eps2;
+    };
+    utility::LogDebug("Done build grid.");
+
+    // Find the core points, i.e. the points with at least min_points
+    // neighbors, counting the point itself. The points of a cell are all
+    // neighbors of each other, so that all the points of a cell with at least
+    // min_points points are core points.
+    utility::LogDebug("Find core points.");
+    utility::ConsoleProgressBar progress_bar(num_points, "Find core points.",
+                                             print_progress);
+    std::vector<uint8_t> is_core(num_points, 0);
+    // First core point of each cell, or -1.
+    std::vector<int> cell_cores(num_cells, -1);
+    grid.ParallelForEachCell(progress_bar, [&](int64_t c,
+                                               const CellRanges &ranges) {
+        const int begin = grid.CellBegin(c);
+        const int end = grid.CellEnd(c);
+        for (int s = begin; s < end; s++) {
+            size_t count = size_t(end - begin);
+            for (size_t k = 0; k < ranges.size() && count < min_points; k++) {
+                const int nb_begin = grid.CellBegin(ranges[k].first);
+                const int nb_end = grid.CellBegin(ranges[k].second);
+                for (int t = nb_begin; t < nb_end && count < min_points; t++) {
+                    count += (t < begin || t >= end) && is_neighbor(s, t);
+                }
+            }
+            is_core[s] = count >= min_points;
+            if (is_core[s] && cell_cores[c] < 0) {
+                cell_cores[c] = s;
+            }
+        }
+    });
+    utility::LogDebug("Done find core points.");
+
+    // Connect the core points of every cell, and then the neighboring cells
+    // with a pair of core points within eps of each other. Each pair of cells
+    // is visited once, from the cell that comes later in the grid order.
+    utility::LogDebug("Compute Clusters");
+    progress_bar.Reset(num_points, "Clustering", print_progress);
+    ConcurrentUnionFind union_find(num_points);
+    grid.ParallelForEachCell(progress_bar, [&](int64_t c,
+                                               const CellRanges &ranges) {
+        if (cell_cores[c] < 0) {
+            return;
+        }
+        const int end = grid.CellEnd(c);
+        const int core = sorted_ids[cell_cores[c]];
+        for (int s = cell_cores[c] + 1; s < end; s++) {
+            if (is_core[s]) {
+                union_find.Union(core, sorted_ids[s]);
+            }
+        }
+        for (const auto &range : ranges) {
+            for (int64_t nb = range.first; nb < range.second && nb < c; nb++) {
+                if (cell_cores[nb] < 0 ||
+                    union_find.Find(core) ==
+                            union_find.Find(sorted_ids[cell_cores[nb]])) {
+                    continue;
+                }
+                bool connected = false;
+                for (int s = cell_cores[c]; s < end && !connected; s++) {
+                    for (int t = cell_cores[nb];
+                         t < grid.CellEnd(nb) && !connected; t++) {
+                        connected = is_core[s] && is_core[t] &&
+                                    is_neighbor(s, t);
                     }
                 }
+                if (connected) {
+                    union_find.Union(core, sorted_ids[cell_cores[nb]]);
+                }
             }
         }
+    });
 
-        cluster_label++;
+    // Every cluster is rooted at its smallest core point. Numbering the
+    // roots in increasing order gives the labels of a serial expansion that
+    // starts a new cluster at each unvisited core point in index order.
+    std::vector<int> roots(num_points, -1);
+#pragma omp parallel for schedule(static)
+    for (int s = 0; s < num_points; s++) {
+        if (is_core[s]) {
+            roots[sorted_ids[s]] = union_find.Find(sorted_ids[s]);
+        }
+    }
+    std::vector<int> root_labels(num_points, -1);
+    int cluster_label = 0;
+    for (int idx = 0; idx < num_points; idx++) {
+        if (roots[idx] == idx) {
+            root_labels[idx] = cluster_label++;
+        }
     }
 
+    // Core points take the label of their cluster. Border points, i.e. points
+    // that are not core points but lie within eps of one, take the first
+    // cluster that reaches them, as in the serial expansion. The rest is
+    // noise.
+    progress_bar.Reset(num_points, "Labeling", print_progress);
+    grid.ParallelForEachCell(progress_bar, [&](int64_t c,
+                                               const CellRanges &ranges) {
+        for (int s = grid.CellBegin(c); s < grid.CellEnd(c); s++) {
+            const int idx = sorted_ids[s];
+            if (is_core[s]) {
+                labels[idx] = root_labels[roots[idx]];
+                continue;
+            }
+            // All the core points of a cell are in the same cluster.
+            for (const auto &range : ranges) {
+                for (int64_t nb = range.first; nb < range.second; nb++) {
+                    if (cell_cores[nb] < 0) {
+                        continue;
+                    }
+                    const int label =
+                            root_labels[roots[sorted_ids[cell_cores[nb]]]];
+                    if (labels[idx] != -1 && labels[idx] <= label) {
+                        continue;
+                    }
+                    for (int t = cell_cores[nb]; t < grid.CellEnd(nb); t++) {
+                        if (is_core[t] && is_neighbor(s, t)) {
+                            labels[idx] = label;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+    });
+
     utility::LogDebug("Done Compute Clusters: {:d}", cluster_label);
     return labels;
 }
@@ -51,39 +51,69 @@ public:
     double inlier_rmse_;
 };
 
-// Calculates the number of inliers given a list of points and a plane model,
+// Calculates the number of inliers among the points with the given indices,
 // and the total distance between the inliers and the plane. These numbers are
 // then used to evaluate how well the plane model fits the given points.
 RANSACResult EvaluateRANSACBasedOnDistance(
         const std::vector<Eigen::Vector3d> &points,
+        const std::vector<size_t> &indices,
         const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
-        double distance_threshold,
-        double error) {
+        double distance_threshold) {
     RANSACResult result;
 
-    for (size_t idx = 0; idx < points.size(); ++idx) {
+    size_t inlier_num = 0;
+    double error = 0;
+    for (size_t idx : indices) {
         Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
                               1);
         double distance = std::abs(plane_model.dot(point));
 
         if (distance < distance_threshold) {
             error += distance;
-            inliers.emplace_back(idx);
+            inlier_num++;
         }
     }
 
-    size_t inlier_num = inliers.size();
     if (inlier_num == 0) {
         result.fitness_ = 0;
         result.inlier_rmse_ = 0;
     } else {
-        result.fitness_ = (double)inlier_num / (double)points.size();
+        result.fitness_ = (double)inlier_num / (double)indices.size();
         result.inlier_rmse_ = error / std::sqrt((double)inlier_num);
     }
     return result;
 }
 
+// Counts the inliers of a plane model among the points with the given
+// indices.
+size_t CountRANSACInliers(const std::vector<Eigen::Vector3d> &points,
+                          const std::vector<size_t> &indices,
+                          const Eigen::Vector4d plane_model,
+                          double distance_threshold) {
+    size_t inlier_num = 0;
+    for (size_t idx : indices) {
+        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
+                              1);
+        inlier_num += std::abs(plane_model.dot(point)) < distance_threshold;
+    }
+    return inlier_num;
+}
+
+// Returns the number of iterations needed to sample, with the given
+// probability, at least one set of ransac_n inliers when a fraction
+// inlier_ratio of the points are inliers.
+int ComputeRANSACIterations(double probability,
+                            double inlier_ratio,
+                            int ransac_n,
+                            int max_iterations) {
+    const double den = std::log(1.0 - std::pow(inlier_ratio, ransac_n));
+    if (inlier_ratio <= 0 || den >= 0) {
+        return max_iterations;
+    }
+    const double num = std::log(1.0 - probability);
+    return int(std::min<double>(std::ceil(num / den), max_iterations));
+}
+
 // Find the plane such that the summed squared distance from the
 // plane to all points is minimized.
 //
@@ -132,87 +162,194 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
     return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
 }
 
-std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
-        const double distance_threshold /* = 0.01 */,
-        const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */) const {
-    RANSACResult result;
-    double error = 0;
+// Runs RANSAC on the points with the given indices, and returns the plane
+// model and the inliers among them.
+//
+// The hypotheses are evaluated in parallel, in batches of RANSAC_BATCH_SIZE
+// drawn serially from rng, so that the result does not depend on the number
+// of threads. The number of iterations is reduced as better models are found,
+// so that a model with as many inliers as the best one has been sampled with
+// the given probability. For large point sets, each hypothesis is first
+// scored on a fixed random subset of the points, and is only scored on all
+// the points if it could beat the best model.
+std::tuple<Eigen::Vector4d, std::vector<size_t>> SegmentPlaneRANSAC(
+        const std::vector<Eigen::Vector3d> &points,
+        const std::vector<size_t> &indices,
+        const double distance_threshold,
+        const int ransac_n,
+        const int num_iterations,
+        const double probability,
+        std::mt19937 &rng) {
+    static const int RANSAC_BATCH_SIZE = 64;
+    static const size_t RANSAC_PREEMPTIVE_SIZE = 1000;
 
-    // Initialize the plane model ax + by + cz + d = 0.
-    Eigen::Vector4d plane_model = Eigen::Vector4d(0, 0, 0, 0);
-    // Initialize the best plane model.
+    RANSACResult result;
+    // Initialize the best plane model ax + by + cz + d = 0.
     Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
 
-    // Initialize consensus set.
-    std::vector<size_t> inliers;
-
-    size_t num_points = points_.size();
-    std::vector<size_t> indices(num_points);
-    std::iota(std::begin(indices), std::end(indices), 0);
-
-    std::random_device rd;
-    std::mt19937 rng(rd());
-
-    // Return if ransac_n is less than the required plane model parameters.
-    if (ransac_n < 3) {
-        utility::LogError(
-                "ransac_n should be set to higher than or equal to 3.");
-        return std::make_tuple(best_plane_model, inliers);
-    }
-    if (num_points < size_t(ransac_n)) {
-        utility::LogError("There must be at least 'ransac_n' points.");
-        return std::make_tuple(best_plane_model, inliers);
+    const size_t num_points = indices.size();
+    std::vector<size_t> sample_indices = indices;
+    std::vector<size_t> preemptive_indices;
+    if (num_points > 4 * RANSAC_PREEMPTIVE_SIZE) {
+        std::uniform_int_distribution<size_t> dist(0, num_points - 1);
+        preemptive_indices.resize(RANSAC_PREEMPTIVE_SIZE);
+        for (size_t &idx : preemptive_indices) {
+            idx = indices[dist(rng)];
+        }
     }
+    const double preemptive_size = double(preemptive_indices.size());
 
-    for (int itr = 0; itr < num_iterations; itr++) {
-        for (int i = 0; i < ransac_n; ++i) {
-            std::swap(indices[i], indices[rng() % num_points]);
-        }
-        inliers.clear();
-        for (int idx = 0; idx < ransac_n; ++idx) {
-            inliers.emplace_back(indices[idx]);
+    std::vector<Eigen::Vector4d> plane_models(RANSAC_BATCH_SIZE);
+    std::vector<RANSACResult> results(RANSAC_BATCH_SIZE);
+    int max_iterations = num_iterations;
+    for (int itr = 0; itr < max_iterations; itr += RANSAC_BATCH_SIZE) {
+        const int batch_size =
+                std::min(RANSAC_BATCH_SIZE, max_iterations - itr);
+        for (int b = 0; b < batch_size; b++) {
+            for (int i = 0; i < ransac_n; ++i) {
+                std::swap(sample_indices[i],
+                          sample_indices[rng() % num_points]);
+            }
+            // Fit model to num_model_parameters randomly selected points
+            // among the inliers.
+            plane_models[b] = TriangleMesh::ComputeTrianglePlane(
+                    points[sample_indices[0]], points[sample_indices[1]],
+                    points[sample_indices[2]]);
         }
 
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        plane_model = TriangleMesh::ComputeTrianglePlane(
-                points_[inliers[0]], points_[inliers[1]], points_[inliers[2]]);
-        if (plane_model.isZero(0)) {
-            continue;
+        // A hypothesis with the best fitness is expected to have
+        // preemptive_size * fitness inliers in the subset. Hypotheses more
+        // than three standard deviations below that are rejected.
+        const double min_preemptive_inliers =
+                preemptive_size * result.fitness_ -
+                3.0 * std::sqrt(preemptive_size * result.fitness_ *
+                                (1.0 - result.fitness_));
+#pragma omp parallel for schedule(dynamic)
+        for (int b = 0; b < batch_size; b++) {
+            results[b] = RANSACResult();
+            if (plane_models[b].isZero(0)) {
+                continue;
+            }
+            if (!preemptive_indices.empty() &&
+                double(CountRANSACInliers(points, preemptive_indices,
+                                          plane_models[b],
+                                          distance_threshold)) <
+                        min_preemptive_inliers) {
+                continue;
+            }
+            results[b] = EvaluateRANSACBasedOnDistance(
+                    points, indices, plane_models[b], distance_threshold);
         }
 
-        error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-        if (this_result.fitness_ > result.fitness_ ||
-            (this_result.fitness_ == result.fitness_ &&
-             this_result.inlier_rmse_ < result.inlier_rmse_)) {
-            result = this_result;
-            best_plane_model = plane_model;
+        for (int b = 0; b < batch_size; b++) {
+            const RANSACResult &this_result = results[b];
+            if (this_result.fitness_ > result.fitness_ ||
+                (this_result.fitness_ == result.fitness_ &&
+                 this_result.inlier_rmse_ < result.inlier_rmse_)) {
+                result = this_result;
+                best_plane_model = plane_models[b];
+            }
         }
+        max_iterations = ComputeRANSACIterations(probability, result.fitness_,
+                                                 ransac_n, num_iterations);
     }
 
     // Find the final inliers using best_plane_model.
-    inliers.clear();
-    for (size_t idx = 0; idx < points_.size(); ++idx) {
-        Eigen::Vector4d point(points_[idx](0), points_[idx](1), points_[idx](2),
-                              1);
-        double distance = std::abs(best_plane_model.dot(point));
-
-        if (distance < distance_threshold) {
-            inliers.emplace_back(idx);
+    std::vector<uint8_t> is_inlier(num_points);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < int64_t(num_points); ++i) {
+        const Eigen::Vector3d &p = points[indices[i]];
+        Eigen::Vector4d point(p(0), p(1), p(2), 1);
+        is_inlier[i] = std::abs(best_plane_model.dot(point)) <
+                       distance_threshold;
+    }
+    std::vector<size_t> inliers;
+    for (size_t i = 0; i < num_points; ++i) {
+        if (is_inlier[i]) {
+            inliers.emplace_back(indices[i]);
         }
     }
 
     // Improve best_plane_model using the final inliers.
-    best_plane_model = GetPlaneFromPoints(points_, inliers);
+    best_plane_model = GetPlaneFromPoints(points, inliers);
 
     utility::LogDebug("RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}",
                       inliers.size(), result.fitness_, result.inlier_rmse_);
     return std::make_tuple(best_plane_model, inliers);
 }
 
+void CheckRANSACParameters(const int ransac_n, const double probability) {
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("probability must be > 0 and <= 1.0");
+    }
+}
+
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
+        const double distance_threshold /* = 0.01 */,
+        const int ransac_n /* = 3 */,
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */) const {
+    CheckRANSACParameters(ransac_n, probability);
+    size_t num_points = points_.size();
+    if (num_points < size_t(ransac_n)) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+
+    std::vector<size_t> indices(num_points);
+    std::iota(std::begin(indices), std::end(indices), 0);
+
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    return SegmentPlaneRANSAC(points_, indices, distance_threshold, ransac_n,
+                              num_iterations, probability, rng);
+}
+
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+PointCloud::SegmentPlanes(const double distance_threshold /* = 0.01 */,
+                          const int ransac_n /* = 3 */,
+                          const int num_iterations /* = 100 */,
+                          const int max_num_planes /* = 1 */,
+                          const size_t min_num_inliers /* = 3 */,
+                          const double probability /* = 0.99999999 */) const {
+    CheckRANSACParameters(ransac_n, probability);
+
+    // The remaining points are tracked by index, so that the cloud is never
+    // copied.
+    std::vector<size_t> remaining(points_.size());
+    std::iota(std::begin(remaining), std::end(remaining), 0);
+
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+    while (int(planes.size()) < max_num_planes &&
+           remaining.size() >= size_t(ransac_n) &&
+           remaining.size() >= min_num_inliers) {
+        Eigen::Vector4d plane_model;
+        std::vector<size_t> inliers;
+        std::tie(plane_model, inliers) = SegmentPlaneRANSAC(
+                points_, remaining, distance_threshold, ransac_n,
+                num_iterations, probability, rng);
+        if (inliers.size() < min_num_inliers || plane_model.isZero(0)) {
+            break;
+        }
+
+        // Both index lists are sorted.
+        std::vector<size_t> outliers;
+        outliers.reserve(remaining.size() - inliers.size());
+        std::set_difference(remaining.begin(), remaining.end(),
+                            inliers.begin(), inliers.end(),
+                            std::back_inserter(outliers));
+        remaining.swap(outliers);
+        planes.emplace_back(plane_model, std::move(inliers));
+    }
+    utility::LogDebug("RANSAC | Planes: {:d}, Remaining points: {:d}",
+                      planes.size(), remaining.size());
+    return planes;
+}
+
 }  // namespace geometry
 }  // namespace open3d
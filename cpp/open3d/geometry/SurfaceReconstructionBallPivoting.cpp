@@ -27,11 +27,13 @@
 #include <Eigen/Dense>
 #include <iostream>
 #include <list>
+#include <unordered_map>
 
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -159,6 +161,19 @@ BallPivotingVertexPtr BallPivotingEdge::GetOppositeVertex() {
     }
 }
 
+/// Front of the ball pivoting in one region of the point cloud. A front
+/// restricted to a cell only creates triangles between the vertices of this
+/// cell, and defers the edges whose pivoting ball hits another cell.
+class BallPivotingFront {
+public:
+    int cell_ = -1;
+    std::list<BallPivotingEdgePtr> edge_front_;
+    std::list<BallPivotingEdgePtr> border_edges_;
+    std::vector<BallPivotingEdgePtr> deferred_edges_;
+    std::vector<Eigen::Vector3i> triangles_;
+    std::vector<Eigen::Vector3d> triangle_normals_;
+};
+
 class BallPivoting {
 public:
     BallPivoting(const PointCloud& pcd)
@@ -246,10 +261,16 @@ public:
         return nullptr;
     }
 
+    bool IsOwned(const BallPivotingFront& front,
+                 const BallPivotingVertexPtr& v) const {
+        return front.cell_ < 0 || vertex_cells_[v->idx_] == front.cell_;
+    }
+
     void CreateTriangle(const BallPivotingVertexPtr& v0,
                         const BallPivotingVertexPtr& v1,
                         const BallPivotingVertexPtr& v2,
-                        const Eigen::Vector3d& center) {
+                        const Eigen::Vector3d& center,
+                        BallPivotingFront& front) {
         utility::LogDebug(
                 "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}",
                 v0->idx_, v1->idx_, v2->idx_);
@@ -287,13 +308,24 @@ public:
         Eigen::Vector3d face_normal =
                 ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
         if (face_normal.dot(v0->normal_) > -1e-16) {
-            mesh_->triangles_.emplace_back(
+            front.triangles_.emplace_back(
                     Eigen::Vector3i(v0->idx_, v1->idx_, v2->idx_));
         } else {
-            mesh_->triangles_.emplace_back(
+            front.triangles_.emplace_back(
                     Eigen::Vector3i(v0->idx_, v2->idx_, v1->idx_));
         }
-        mesh_->triangle_normals_.push_back(face_normal);
+        front.triangle_normals_.push_back(face_normal);
+    }
+
+    void AppendTriangles(BallPivotingFront& front) {
+        mesh_->triangles_.insert(mesh_->triangles_.end(),
+                                 front.triangles_.begin(),
+                                 front.triangles_.end());
+        mesh_->triangle_normals_.insert(mesh_->triangle_normals_.end(),
+                                        front.triangle_normals_.begin(),
+                                        front.triangle_normals_.end());
+        front.triangles_.clear();
+        front.triangle_normals_.clear();
     }
 
     Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
@@ -477,11 +509,11 @@ public:
         return min_candidate;
     }
 
-    void ExpandTriangulation(double radius) {
+    void ExpandTriangulation(double radius, BallPivotingFront& front) {
         utility::LogDebug("[ExpandTriangulation] radius={}", radius);
-        while (!edge_front_.empty()) {
-            BallPivotingEdgePtr edge = edge_front_.front();
-            edge_front_.pop_front();
+        while (!front.edge_front_.empty()) {
+            BallPivotingEdgePtr edge = front.edge_front_.front();
+            front.edge_front_.pop_front();
             if (edge->type_ != BallPivotingEdge::Front) {
                 continue;
             }
@@ -489,11 +521,15 @@ public:
             Eigen::Vector3d center;
             BallPivotingVertexPtr candidate =
                     FindCandidateVertex(edge, radius, center);
+            if (candidate != nullptr && !IsOwned(front, candidate)) {
+                front.deferred_edges_.push_back(edge);
+                continue;
+            }
             if (candidate == nullptr ||
                 candidate->type_ == BallPivotingVertex::Type::Inner ||
                 !IsCompatible(candidate, edge->source_, edge->target_)) {
                 edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+                front.border_edges_.push_back(edge);
                 continue;
             }
 
@@ -502,19 +538,20 @@ public:
             if ((e0 != nullptr && e0->type_ != BallPivotingEdge::Type::Front) ||
                 (e1 != nullptr && e1->type_ != BallPivotingEdge::Type::Front)) {
                 edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+                front.border_edges_.push_back(edge);
                 continue;
             }
 
-            CreateTriangle(edge->source_, edge->target_, candidate, center);
+            CreateTriangle(edge->source_, edge->target_, candidate, center,
+                           front);
 
             e0 = GetLinkingEdge(candidate, edge->source_);
             e1 = GetLinkingEdge(candidate, edge->target_);
             if (e0->type_ == BallPivotingEdge::Type::Front) {
-                edge_front_.push_front(e0);
+                front.edge_front_.push_front(e0);
             }
             if (e1->type_ == BallPivotingEdge::Type::Front) {
-                edge_front_.push_front(e1);
+                front.edge_front_.push_front(e1);
             }
         }
     }
@@ -577,7 +614,9 @@ public:
         return true;
     }
 
-    bool TrySeed(BallPivotingVertexPtr& v, double radius) {
+    bool TrySeed(BallPivotingVertexPtr& v,
+                 double radius,
+                 BallPivotingFront& front) {
         utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
                           radius);
         std::vector<int> indices;
@@ -589,7 +628,8 @@ public:
 
         for (size_t nbidx0 = 0; nbidx0 < indices.size(); ++nbidx0) {
             const BallPivotingVertexPtr& nb0 = vertices[indices[nbidx0]];
-            if (nb0->type_ != BallPivotingVertex::Type::Orphan) {
+            if (!IsOwned(front, nb0) ||
+                nb0->type_ != BallPivotingVertex::Type::Orphan) {
                 continue;
             }
             if (nb0->idx_ == v->idx_) {
@@ -601,7 +641,8 @@ public:
             for (size_t nbidx1 = nbidx0 + 1; nbidx1 < indices.size();
                  ++nbidx1) {
                 const BallPivotingVertexPtr& nb1 = vertices[indices[nbidx1]];
-                if (nb1->type_ != BallPivotingVertex::Type::Orphan) {
+                if (!IsOwned(front, nb1) ||
+                    nb1->type_ != BallPivotingVertex::Type::Orphan) {
                     continue;
                 }
                 if (nb1->idx_ == v->idx_) {
@@ -632,22 +673,22 @@ public:
                     continue;
                 }
 
-                CreateTriangle(v, nb0, nb1, center);
+                CreateTriangle(v, nb0, nb1, center, front);
 
                 e0 = GetLinkingEdge(v, nb1);
                 e1 = GetLinkingEdge(nb0, nb1);
                 e2 = GetLinkingEdge(v, nb0);
                 if (e0->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e0);
+                    front.edge_front_.push_front(e0);
                 }
                 if (e1->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e1);
+                    front.edge_front_.push_front(e1);
                 }
                 if (e2->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e2);
+                    front.edge_front_.push_front(e2);
                 }
 
-                if (edge_front_.size() > 0) {
+                if (front.edge_front_.size() > 0) {
                     utility::LogDebug(
                             "[TrySeed] edge_front_.size() > 0 => return "
                             "true");
@@ -665,8 +706,85 @@ public:
             utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
                               radius, vidx);
             if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
-                if (TrySeed(vertices[vidx], radius)) {
-                    ExpandTriangulation(radius);
+                if (TrySeed(vertices[vidx], radius, front_)) {
+                    ExpandTriangulation(radius, front_);
+                }
+            }
+        }
+    }
+
+    /// Seeds and grows independent fronts in cells of the point cloud in
+    /// parallel. The edges deferred at the cell boundaries are then expanded
+    /// by the global front, and the orphan vertices close to the boundaries
+    /// are seeded again without the cell restriction.
+    void FindSeedTrianglePartitioned(double radius) {
+        // Cells are large compared to the ball, so that most fronts close
+        // inside a single cell.
+        const Eigen::Vector3d min_bound = mesh_->GetMinBound();
+        const Eigen::Vector3d max_bound = mesh_->GetMaxBound();
+        const double cell_size = std::max(
+                32 * radius, (max_bound - min_bound).maxCoeff() / 16);
+        std::unordered_map<Eigen::Vector3i, int,
+                           utility::hash_eigen<Eigen::Vector3i>>
+                cell_ids;
+        std::vector<std::vector<int>> cell_vertices;
+        vertex_cells_.resize(vertices.size());
+        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
+            Eigen::Vector3i cell_index =
+                    ((vertices[vidx]->point_ - min_bound) / cell_size)
+                            .array()
+                            .floor()
+                            .cast<int>();
+            auto it = cell_ids.emplace(cell_index, int(cell_vertices.size()));
+            if (it.second) {
+                cell_vertices.emplace_back();
+            }
+            vertex_cells_[vidx] = it.first->second;
+            cell_vertices[it.first->second].push_back(int(vidx));
+        }
+        if (cell_vertices.size() < 2) {
+            FindSeedTriangle(radius);
+            return;
+        }
+        utility::LogDebug("[FindSeedTrianglePartitioned] {:d} cells",
+                          cell_vertices.size());
+
+        std::vector<BallPivotingFront> fronts(cell_vertices.size());
+#pragma omp parallel for schedule(dynamic)
+        for (int cidx = 0; cidx < int(cell_vertices.size()); ++cidx) {
+            BallPivotingFront& front = fronts[cidx];
+            front.cell_ = cidx;
+            for (int vidx : cell_vertices[cidx]) {
+                if (vertices[vidx]->type_ ==
+                            BallPivotingVertex::Type::Orphan &&
+                    TrySeed(vertices[vidx], radius, front)) {
+                    ExpandTriangulation(radius, front);
+                }
+            }
+        }
+
+        // Merge the fronts at the cell boundaries.
+        for (BallPivotingFront& front : fronts) {
+            AppendTriangles(front);
+            front_.border_edges_.splice(front_.border_edges_.end(),
+                                        front.border_edges_);
+            front_.edge_front_.insert(front_.edge_front_.end(),
+                                      front.deferred_edges_.begin(),
+                                      front.deferred_edges_.end());
+        }
+        ExpandTriangulation(radius, front_);
+        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
+            if (vertices[vidx]->type_ != BallPivotingVertex::Type::Orphan) {
+                continue;
+            }
+            Eigen::Vector3d offset = vertices[vidx]->point_ - min_bound;
+            Eigen::Vector3d cell_offset =
+                    offset - (offset / cell_size).array().floor().matrix() *
+                                     cell_size;
+            if (cell_offset.minCoeff() < 2 * radius ||
+                cell_size - cell_offset.maxCoeff() < 2 * radius) {
+                if (TrySeed(vertices[vidx], radius, front_)) {
+                    ExpandTriangulation(radius, front_);
                 }
             }
         }
@@ -688,7 +806,8 @@ public:
             }
 
             // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
+            for (auto it = front_.border_edges_.begin();
+                 it != front_.border_edges_.end();) {
                 BallPivotingEdgePtr edge = *it;
                 BallPivotingTrianglePtr triangle = edge->triangle0_;
                 utility::LogDebug(
@@ -720,10 +839,10 @@ public:
                     if (empty_ball) {
                         utility::LogDebug(
                                 "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
+                                front_.edge_front_.size());
                         edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
+                        front_.edge_front_.push_back(edge);
+                        it = front_.border_edges_.erase(it);
                         continue;
                     }
                 }
@@ -731,11 +850,12 @@ public:
             }
 
             // do the reconstruction
-            if (edge_front_.empty()) {
-                FindSeedTriangle(radius);
+            if (front_.edge_front_.empty()) {
+                FindSeedTrianglePartitioned(radius);
             } else {
-                ExpandTriangulation(radius);
+                ExpandTriangulation(radius, front_);
             }
+            AppendTriangles(front_);
 
             utility::LogDebug("[Run] mesh_ has {:d} triangles",
                               mesh_->triangles_.size());
@@ -747,9 +867,9 @@ public:
 private:
     bool has_normals_;
     KDTreeFlann kdtree_;
-    std::list<BallPivotingEdgePtr> edge_front_;
-    std::list<BallPivotingEdgePtr> border_edges_;
+    BallPivotingFront front_;
     std::vector<BallPivotingVertexPtr> vertices;
+    std::vector<int> vertex_cells_;
     std::shared_ptr<TriangleMesh> mesh_;
 };
 
@@ -25,15 +25,20 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
+#include <limits>
 #include <list>
+#include <numeric>
+#include <unordered_map>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
 
 // clang-format off
@@ -734,6 +739,159 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                       Time() - startTime, FEMTree<Dim, Real>::MaxMemoryUsage());
 }
 
+// Appends the triangles of tile_mesh whose centroid lies in the box
+// [core_min, core_max) to mesh, together with their vertices in the original
+// order and the vertex densities. vertex_tiles records the tile of every
+// vertex of mesh.
+void AppendTileTriangles(const TriangleMesh& tile_mesh,
+                         const std::vector<double>& tile_densities,
+                         const Eigen::Vector3d& core_min,
+                         const Eigen::Vector3d& core_max,
+                         int tile_id,
+                         TriangleMesh& mesh,
+                         std::vector<double>& densities,
+                         std::vector<int>& vertex_tiles) {
+    std::vector<bool> keep_triangle(tile_mesh.triangles_.size(), false);
+    std::vector<int> vertex_map(tile_mesh.vertices_.size(), -1);
+    for (size_t t = 0; t < tile_mesh.triangles_.size(); t++) {
+        const Eigen::Vector3i& triangle = tile_mesh.triangles_[t];
+        Eigen::Vector3d centroid = (tile_mesh.vertices_[triangle(0)] +
+                                    tile_mesh.vertices_[triangle(1)] +
+                                    tile_mesh.vertices_[triangle(2)]) /
+                                   3.0;
+        if ((centroid.array() >= core_min.array()).all() &&
+            (centroid.array() < core_max.array()).all()) {
+            keep_triangle[t] = true;
+            vertex_map[triangle(0)] = vertex_map[triangle(1)] =
+                    vertex_map[triangle(2)] = 0;
+        }
+    }
+    for (size_t v = 0; v < tile_mesh.vertices_.size(); v++) {
+        if (vertex_map[v] < 0) {
+            continue;
+        }
+        vertex_map[v] = int(mesh.vertices_.size());
+        mesh.vertices_.push_back(tile_mesh.vertices_[v]);
+        if (tile_mesh.HasVertexNormals()) {
+            mesh.vertex_normals_.push_back(tile_mesh.vertex_normals_[v]);
+        }
+        if (tile_mesh.HasVertexColors()) {
+            mesh.vertex_colors_.push_back(tile_mesh.vertex_colors_[v]);
+        }
+        densities.push_back(tile_densities[v]);
+        vertex_tiles.push_back(tile_id);
+    }
+    for (size_t t = 0; t < tile_mesh.triangles_.size(); t++) {
+        if (keep_triangle[t]) {
+            const Eigen::Vector3i& triangle = tile_mesh.triangles_[t];
+            mesh.triangles_.push_back(Eigen::Vector3i(vertex_map[triangle(0)],
+                                                      vertex_map[triangle(1)],
+                                                      vertex_map[triangle(2)]));
+        }
+    }
+}
+
+// Closes the cracks between the meshes of neighboring tiles. Vertices within
+// distance of an inner tile boundary are merged into the closest vertex of
+// another tile within distance, and the triangles that collapse and the
+// vertices that are no longer used are removed.
+void StitchTileBoundaries(const Eigen::Vector3d& origin,
+                          double tile_size,
+                          double distance,
+                          const std::vector<int>& vertex_tiles,
+                          TriangleMesh& mesh,
+                          std::vector<double>& densities) {
+    const int num_vertices = int(mesh.vertices_.size());
+    std::vector<int> merged(num_vertices);
+    std::iota(merged.begin(), merged.end(), 0);
+    std::unordered_map<Eigen::Vector3i, std::vector<int>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            cells;
+    for (int v = 0; v < num_vertices; v++) {
+        const Eigen::Vector3d& vertex = mesh.vertices_[v];
+        Eigen::Vector3d tile_coord = (vertex - origin) / tile_size;
+        Eigen::Vector3d boundary_dist =
+                (tile_coord.array() - tile_coord.array().round()).abs() *
+                tile_size;
+        if (boundary_dist.minCoeff() >= distance) {
+            continue;
+        }
+        Eigen::Vector3d cell_coord = vertex / distance;
+        Eigen::Vector3i cell(int(std::floor(cell_coord(0))),
+                             int(std::floor(cell_coord(1))),
+                             int(std::floor(cell_coord(2))));
+        double best_dist = distance;
+        for (int dx = -1; dx <= 1; dx++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dz = -1; dz <= 1; dz++) {
+                    auto it = cells.find(cell + Eigen::Vector3i(dx, dy, dz));
+                    if (it == cells.end()) {
+                        continue;
+                    }
+                    for (int u : it->second) {
+                        double dist = (mesh.vertices_[u] - vertex).norm();
+                        if (vertex_tiles[u] != vertex_tiles[v] &&
+                            dist < best_dist) {
+                            best_dist = dist;
+                            merged[v] = u;
+                        }
+                    }
+                }
+            }
+        }
+        if (merged[v] == v) {
+            cells[cell].push_back(v);
+        }
+    }
+
+    std::vector<int> vertex_map(num_vertices, -1);
+    std::vector<Eigen::Vector3i> triangles;
+    for (const Eigen::Vector3i& triangle : mesh.triangles_) {
+        Eigen::Vector3i new_triangle(merged[triangle(0)], merged[triangle(1)],
+                                     merged[triangle(2)]);
+        if (new_triangle(0) == new_triangle(1) ||
+            new_triangle(1) == new_triangle(2) ||
+            new_triangle(2) == new_triangle(0)) {
+            continue;
+        }
+        vertex_map[new_triangle(0)] = vertex_map[new_triangle(1)] =
+                vertex_map[new_triangle(2)] = 0;
+        triangles.push_back(new_triangle);
+    }
+    int num_used = 0;
+    for (int v = 0; v < num_vertices; v++) {
+        if (vertex_map[v] < 0) {
+            continue;
+        }
+        vertex_map[v] = num_used;
+        mesh.vertices_[num_used] = mesh.vertices_[v];
+        if (mesh.HasVertexNormals()) {
+            mesh.vertex_normals_[num_used] = mesh.vertex_normals_[v];
+        }
+        if (mesh.HasVertexColors()) {
+            mesh.vertex_colors_[num_used] = mesh.vertex_colors_[v];
+        }
+        densities[num_used] = densities[v];
+        num_used++;
+    }
+    const bool has_normals = mesh.HasVertexNormals();
+    const bool has_colors = mesh.HasVertexColors();
+    mesh.vertices_.resize(num_used);
+    if (has_normals) {
+        mesh.vertex_normals_.resize(num_used);
+    }
+    if (has_colors) {
+        mesh.vertex_colors_.resize(num_used);
+    }
+    densities.resize(num_used);
+    for (Eigen::Vector3i& triangle : triangles) {
+        triangle = Eigen::Vector3i(vertex_map[triangle(0)],
+                                   vertex_map[triangle(1)],
+                                   vertex_map[triangle(2)]);
+    }
+    mesh.triangles_ = std::move(triangles);
+}
+
 }  // namespace poisson
 
 std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
@@ -775,5 +933,131 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
     return std::make_tuple(mesh, densities);
 }
 
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+TriangleMesh::CreateFromPointCloudPoissonTiled(const PointCloud& pcd,
+                                               double tile_size,
+                                               double overlap,
+                                               size_t depth,
+                                               float scale,
+                                               bool linear_fit,
+                                               int n_threads) {
+    if (!pcd.HasNormals()) {
+        utility::LogError(
+                "[CreateFromPointCloudPoissonTiled] pcd has no normals");
+    }
+    if (tile_size <= 0) {
+        utility::LogError(
+                "[CreateFromPointCloudPoissonTiled] tile_size (={}) has to be "
+                "> 0",
+                tile_size);
+    }
+    if (overlap < 0 || overlap > tile_size) {
+        utility::LogError(
+                "[CreateFromPointCloudPoissonTiled] overlap (={}) has to be "
+                "in [0, tile_size]",
+                overlap);
+    }
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    std::vector<double> densities;
+    if (pcd.IsEmpty()) {
+        return std::make_tuple(mesh, densities);
+    }
+
+    // Bucket the points by tile. As the overlap is at most one tile, every
+    // tile gathers its points from the 27 tiles around it.
+    const Eigen::Vector3d origin = pcd.GetMinBound();
+    std::unordered_map<Eigen::Vector3i, std::vector<size_t>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            tile_points;
+    Eigen::Vector3i tile_min =
+            Eigen::Vector3i::Constant(std::numeric_limits<int>::max());
+    Eigen::Vector3i tile_max =
+            Eigen::Vector3i::Constant(std::numeric_limits<int>::min());
+    for (size_t i = 0; i < pcd.points_.size(); i++) {
+        Eigen::Vector3d tile_coord = (pcd.points_[i] - origin) / tile_size;
+        Eigen::Vector3i tile(int(std::floor(tile_coord(0))),
+                             int(std::floor(tile_coord(1))),
+                             int(std::floor(tile_coord(2))));
+        tile_points[tile].push_back(i);
+        tile_min = tile_min.cwiseMin(tile);
+        tile_max = tile_max.cwiseMax(tile);
+    }
+    std::vector<Eigen::Vector3i> tiles;
+    for (const auto& it : tile_points) {
+        tiles.push_back(it.first);
+    }
+    std::sort(tiles.begin(), tiles.end(),
+              [](const Eigen::Vector3i& a, const Eigen::Vector3i& b) {
+                  return std::lexicographical_compare(a.data(), a.data() + 3,
+                                                      b.data(), b.data() + 3);
+              });
+
+    // Reconstruct one tile at a time, so that only the points and the octree
+    // of a single tile are held besides the input and the output. Each tile
+    // keeps the triangles whose centroid lies in the tile. The outer tiles
+    // also keep the triangles beyond the outer sides of the grid.
+    const double inf = std::numeric_limits<double>::infinity();
+    std::vector<int> vertex_tiles;
+    for (size_t t = 0; t < tiles.size(); t++) {
+        const Eigen::Vector3i& tile = tiles[t];
+        const Eigen::Vector3d tile_origin =
+                origin + tile.cast<double>() * tile_size;
+        const Eigen::Vector3d box_min =
+                tile_origin - Eigen::Vector3d::Constant(overlap);
+        const Eigen::Vector3d box_max =
+                tile_origin + Eigen::Vector3d::Constant(tile_size + overlap);
+        std::vector<size_t> indices;
+        for (int dx = -1; dx <= 1; dx++) {
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dz = -1; dz <= 1; dz++) {
+                    auto it = tile_points.find(tile +
+                                               Eigen::Vector3i(dx, dy, dz));
+                    if (it == tile_points.end()) {
+                        continue;
+                    }
+                    for (size_t idx : it->second) {
+                        const Eigen::Vector3d& p = pcd.points_[idx];
+                        if ((p.array() >= box_min.array()).all() &&
+                            (p.array() <= box_max.array()).all()) {
+                            indices.push_back(idx);
+                        }
+                    }
+                }
+            }
+        }
+        std::sort(indices.begin(), indices.end());
+
+        std::shared_ptr<TriangleMesh> tile_mesh;
+        std::vector<double> tile_densities;
+        std::tie(tile_mesh, tile_densities) = CreateFromPointCloudPoisson(
+                *pcd.SelectByIndex(indices), depth, 0, scale, linear_fit,
+                n_threads);
+
+        Eigen::Vector3d core_min, core_max;
+        for (int c = 0; c < 3; c++) {
+            core_min(c) = tile(c) == tile_min(c) ? -inf : tile_origin(c);
+            core_max(c) =
+                    tile(c) == tile_max(c) ? inf : tile_origin(c) + tile_size;
+        }
+        poisson::AppendTileTriangles(*tile_mesh, tile_densities, core_min,
+                                     core_max, int(t), *mesh, densities,
+                                     vertex_tiles);
+        utility::LogDebug(
+                "[CreateFromPointCloudPoissonTiled] Tile {:d}/{:d}: {:d} "
+                "points, {:d} triangles",
+                t + 1, tiles.size(), indices.size(),
+                tile_mesh->triangles_.size());
+    }
+
+    // The cracks between the tiles are about one finest octree cell wide.
+    const double cell_size = (tile_size + 2 * overlap) *
+                             std::max(double(scale), 1.0) /
+                             double(size_t(1) << depth);
+    poisson::StitchTileBoundaries(origin, tile_size, cell_size, vertex_tiles,
+                                  *mesh, densities);
+    return std::make_tuple(mesh, densities);
+}
+
 }  // namespace geometry
 }  // namespace open3d
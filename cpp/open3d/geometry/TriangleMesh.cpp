@@ -26,7 +26,12 @@
 
 #include "open3d/geometry/TriangleMesh.h"
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
+#include <array>
+#include <atomic>
+#include <cstring>
 #include <numeric>
 #include <queue>
 #include <random>
@@ -37,6 +42,7 @@
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
+#include "open3d/geometry/TriangleMeshBVH.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -51,6 +57,7 @@ TriangleMesh &TriangleMesh::Clear() {
     materials_.clear();
     triangle_material_ids_.clear();
     textures_.clear();
+    topology_cache_.reset();
 
     return *this;
 }
@@ -160,19 +167,65 @@ TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized /* = true*/) {
 }
 
 TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
+    auto topology = GetTopology();
     adjacency_list_.clear();
     adjacency_list_.resize(vertices_.size());
-    for (const auto &triangle : triangles_) {
-        adjacency_list_[triangle(0)].insert(triangle(1));
-        adjacency_list_[triangle(0)].insert(triangle(2));
-        adjacency_list_[triangle(1)].insert(triangle(0));
-        adjacency_list_[triangle(1)].insert(triangle(2));
-        adjacency_list_[triangle(2)].insert(triangle(0));
-        adjacency_list_[triangle(2)].insert(triangle(1));
+#pragma omp parallel for schedule(static)
+    for (int vidx = 0; vidx < int(vertices_.size()); ++vidx) {
+        const auto nbs_begin = topology->neighbors_.begin();
+        adjacency_list_[vidx].insert(
+                nbs_begin + topology->neighbor_offsets_[vidx],
+                nbs_begin + topology->neighbor_offsets_[vidx + 1]);
     }
     return *this;
 }
 
+namespace {
+
+uint64_t MixBits(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/// Returns a fingerprint of the triangles and of the number of vertices,
+/// computed in parallel.
+uint64_t ComputeTopologyFingerprint(
+        const std::vector<Eigen::Vector3i> &triangles, size_t num_vertices) {
+    uint64_t sum = 0;
+#pragma omp parallel for reduction(+ : sum) schedule(static)
+    for (int64_t tidx = 0; tidx < int64_t(triangles.size()); ++tidx) {
+        const Eigen::Vector3i &triangle = triangles[tidx];
+        uint64_t h = uint64_t(tidx);
+        for (int k = 0; k < 3; ++k) {
+            h = MixBits((h << 32) ^ h ^ uint32_t(triangle(k)));
+        }
+        sum += h;
+    }
+    return MixBits(sum ^ MixBits(uint64_t(triangles.size()) ^
+                                 (uint64_t(num_vertices) << 32)));
+}
+
+}  // namespace
+
+std::shared_ptr<const TriangleMeshTopology> TriangleMesh::GetTopology() const {
+    uint64_t fingerprint =
+            ComputeTopologyFingerprint(triangles_, vertices_.size());
+    auto cache = std::atomic_load(&topology_cache_);
+    if (cache && cache->fingerprint == fingerprint) {
+        return cache->topology;
+    }
+    auto topology = std::make_shared<const TriangleMeshTopology>(
+            triangles_, int(vertices_.size()));
+    std::atomic_store(&topology_cache_,
+                      std::shared_ptr<const CachedTopology>(
+                              new CachedTopology{fingerprint, topology}));
+    return topology;
+}
+
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
         int number_of_iterations, double strength, FilterScope scope) const {
     bool filter_vertex =
@@ -194,16 +247,18 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    auto topology = GetTopology();
+    mesh->topology_cache_ = std::atomic_load(&topology_cache_);
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#pragma omp parallel for schedule(static)
+        for (int vidx = 0; vidx < int(mesh->vertices_.size()); ++vidx) {
             Eigen::Vector3d vertex_sum(0, 0, 0);
             Eigen::Vector3d normal_sum(0, 0, 0);
             Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
+            for (int i = topology->neighbor_offsets_[vidx];
+                 i < topology->neighbor_offsets_[vidx + 1]; ++i) {
+                int nbidx = topology->neighbors_[i];
                 if (filter_vertex) {
                     vertex_sum += prev_vertices[nbidx];
                 }
@@ -215,7 +270,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
                 }
             }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
+            size_t nb_size = topology->NumNeighbors(vidx);
             if (filter_vertex) {
                 mesh->vertices_[vidx] =
                         prev_vertices[vidx] +
@@ -265,16 +320,18 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    auto topology = GetTopology();
+    mesh->topology_cache_ = std::atomic_load(&topology_cache_);
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#pragma omp parallel for schedule(static)
+        for (int vidx = 0; vidx < int(mesh->vertices_.size()); ++vidx) {
             Eigen::Vector3d vertex_sum(0, 0, 0);
             Eigen::Vector3d normal_sum(0, 0, 0);
             Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
+            for (int i = topology->neighbor_offsets_[vidx];
+                 i < topology->neighbor_offsets_[vidx + 1]; ++i) {
+                int nbidx = topology->neighbors_[i];
                 if (filter_vertex) {
                     vertex_sum += prev_vertices[nbidx];
                 }
@@ -286,7 +343,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
                 }
             }
 
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
+            size_t nb_size = topology->NumNeighbors(vidx);
             if (filter_vertex) {
                 mesh->vertices_[vidx] =
                         (prev_vertices[vidx] + vertex_sum) / (1 + nb_size);
@@ -315,17 +372,20 @@ void TriangleMesh::FilterSmoothLaplacianHelper(
         const std::vector<Eigen::Vector3d> &prev_vertices,
         const std::vector<Eigen::Vector3d> &prev_vertex_normals,
         const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-        const std::vector<std::unordered_set<int>> &adjacency_list,
+        const TriangleMeshTopology &topology,
         double lambda,
         bool filter_vertex,
         bool filter_normal,
         bool filter_color) const {
-    for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
+#pragma omp parallel for schedule(static)
+    for (int vidx = 0; vidx < int(mesh->vertices_.size()); ++vidx) {
         Eigen::Vector3d vertex_sum(0, 0, 0);
         Eigen::Vector3d normal_sum(0, 0, 0);
         Eigen::Vector3d color_sum(0, 0, 0);
         double total_weight = 0;
-        for (int nbidx : mesh->adjacency_list_[vidx]) {
+        for (int i = topology.neighbor_offsets_[vidx];
+             i < topology.neighbor_offsets_[vidx + 1]; ++i) {
+            int nbidx = topology.neighbors_[i];
             auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
             double dist = diff.norm();
             double weight = 1. / (dist + 1e-12);
@@ -381,15 +441,13 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    auto topology = GetTopology();
+    mesh->topology_cache_ = std::atomic_load(&topology_cache_);
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, *topology, lambda,
+                                    filter_vertex, filter_normal, filter_color);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -423,21 +481,18 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
     mesh->vertex_colors_.resize(vertex_colors_.size());
     mesh->triangles_ = triangles_;
     mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    auto topology = GetTopology();
+    mesh->topology_cache_ = std::atomic_load(&topology_cache_);
     for (int iter = 0; iter < number_of_iterations; ++iter) {
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, *topology, lambda,
+                                    filter_vertex, filter_normal, filter_color);
         std::swap(mesh->vertices_, prev_vertices);
         std::swap(mesh->vertex_normals_, prev_vertex_normals);
         std::swap(mesh->vertex_colors_, prev_vertex_colors);
         FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    mu, filter_vertex, filter_normal,
-                                    filter_color);
+                                    prev_vertex_colors, *topology, mu,
+                                    filter_vertex, filter_normal, filter_color);
         if (iter < number_of_iterations - 1) {
             std::swap(mesh->vertices_, prev_vertices);
             std::swap(mesh->vertex_normals_, prev_vertex_normals);
@@ -686,34 +741,354 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
     return pcl;
 }
 
+namespace {
+
+/// Returns for every key the smallest index of an equal key. The keys are
+/// grouped with a parallel sort, so that the result does not depend on the
+/// number of threads.
+template <typename Key>
+std::vector<int> FindFirstOccurrences(const std::vector<Key> &keys) {
+    const int num_keys = int(keys.size());
+    std::vector<int> sorted_ids(num_keys);
+    std::iota(sorted_ids.begin(), sorted_ids.end(), 0);
+    tbb::parallel_sort(sorted_ids.begin(), sorted_ids.end(),
+                       [&](int a, int b) {
+                           return std::tie(keys[a], a) < std::tie(keys[b], b);
+                       });
+    std::vector<int> first_ids(num_keys);
+    int first = 0;
+    for (int i = 0; i < num_keys; i++) {
+        if (i > 0 && keys[sorted_ids[i]] != keys[sorted_ids[i - 1]]) {
+            first = sorted_ids[i];
+        }
+        first_ids[sorted_ids[i]] = first;
+    }
+    return first_ids;
+}
+
+/// Returns the bits of a coordinate, with -0.0 mapped to 0.0 as they compare
+/// equal.
+uint64_t CoordinateBits(double coord) {
+    if (coord == 0.0) {
+        coord = 0.0;
+    }
+    uint64_t bits;
+    std::memcpy(&bits, &coord, sizeof(bits));
+    return bits;
+}
+
+/// Moves the elements i with keep[i] to new_ids[i], in parallel.
+template <typename T>
+void CompactInParallel(std::vector<T> &values,
+                       const std::vector<uint8_t> &keep,
+                       const std::vector<int> &new_ids,
+                       int num_kept) {
+    std::vector<T> compacted(num_kept);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < int(values.size()); i++) {
+        if (keep[i]) {
+            compacted[new_ids[i]] = values[i];
+        }
+    }
+    values.swap(compacted);
+}
+
+}  // namespace
+
+std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDiskParallel(
+        size_t number_of_points,
+        double init_factor /* = 5 */,
+        const std::shared_ptr<PointCloud> pcl_init /* = nullptr */,
+        bool use_triangle_normal /* = false */,
+        int seed /* = -1 */) {
+    if (number_of_points <= 0) {
+        utility::LogError(
+                "[SamplePointsPoissonDiskParallel] number_of_points <= 0");
+    }
+    if (triangles_.size() == 0) {
+        utility::LogError(
+                "[SamplePointsPoissonDiskParallel] input mesh has no "
+                "triangles");
+    }
+    if (pcl_init == nullptr && init_factor < 1) {
+        utility::LogError(
+                "[SamplePointsPoissonDiskParallel] either pass pcl_init with "
+                "#points > number_of_points or init_factor > 1");
+    }
+    if (pcl_init != nullptr && pcl_init->points_.size() < number_of_points) {
+        utility::LogError(
+                "[SamplePointsPoissonDiskParallel] either pass pcl_init with "
+                "#points > number_of_points, or init_factor > 1");
+    }
+
+    // Compute area of each triangle and sum surface area
+    std::vector<double> triangle_areas;
+    double surface_area = GetSurfaceArea(triangle_areas);
+
+    // Compute init points using uniform sampling
+    std::shared_ptr<PointCloud> pcl;
+    if (pcl_init == nullptr) {
+        pcl = SamplePointsUniformlyImpl(size_t(init_factor * number_of_points),
+                                        triangle_areas, surface_area,
+                                        use_triangle_normal, seed);
+    } else {
+        pcl = std::make_shared<PointCloud>();
+        pcl->points_ = pcl_init->points_;
+        pcl->normals_ = pcl_init->normals_;
+        pcl->colors_ = pcl_init->colors_;
+    }
+    const int num_points = int(pcl->points_.size());
+
+    // Set-up sample elimination as in SamplePointsPoissonDisk
+    double alpha = 8;    // constant defined in paper
+    double beta = 0.5;   // constant defined in paper
+    double gamma = 1.5;  // constant defined in paper
+    double ratio = double(number_of_points) / double(num_points);
+    double r_max = 2 * std::sqrt((surface_area / number_of_points) /
+                                 (2 * std::sqrt(3.)));
+    double r_min = r_max * beta * (1 - std::pow(ratio, gamma));
+    auto WeightFcn = [&](double d2) {
+        double d = std::sqrt(d2);
+        if (d < r_min) {
+            d = r_min;
+        }
+        return std::pow(1 - d / r_max, alpha);
+    };
+
+    // Sort the points into grid cells of size r_max, so that the neighbors
+    // of a point are in the 27 cells around it.
+    const Eigen::Vector3d min_bound = pcl->GetMinBound();
+    std::vector<std::pair<std::array<int, 3>, int>> keys(num_points);
+#pragma omp parallel for schedule(static)
+    for (int pidx = 0; pidx < num_points; ++pidx) {
+        Eigen::Vector3i cell = ((pcl->points_[pidx] - min_bound) / r_max)
+                                       .array()
+                                       .floor()
+                                       .cast<int>();
+        keys[pidx] = std::make_pair(
+                std::array<int, 3>{cell(0), cell(1), cell(2)}, pidx);
+    }
+    tbb::parallel_sort(keys.begin(), keys.end());
+    std::vector<int> sorted_points(num_points);
+    std::vector<std::array<int, 3>> cell_keys;
+    std::vector<int> cell_offsets;
+    for (int i = 0; i < num_points; ++i) {
+        sorted_points[i] = keys[i].second;
+        if (i == 0 || keys[i].first != keys[i - 1].first) {
+            cell_keys.push_back(keys[i].first);
+            cell_offsets.push_back(i);
+        }
+    }
+    const int num_cells = int(cell_keys.size());
+    cell_offsets.push_back(num_points);
+
+    // The neighbor cells of every cell, including itself.
+    std::vector<int> neighbor_offsets(num_cells + 1, 0);
+    std::vector<int> neighbor_cells(27 * size_t(num_cells), -1);
+#pragma omp parallel for schedule(static)
+    for (int cidx = 0; cidx < num_cells; ++cidx) {
+        int num_neighbors = 0;
+        for (int dx = -1; dx <= 1; ++dx) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dz = -1; dz <= 1; ++dz) {
+                    std::array<int, 3> key = {cell_keys[cidx][0] + dx,
+                                              cell_keys[cidx][1] + dy,
+                                              cell_keys[cidx][2] + dz};
+                    auto it = std::lower_bound(cell_keys.begin(),
+                                               cell_keys.end(), key);
+                    if (it != cell_keys.end() && *it == key) {
+                        neighbor_cells[27 * cidx + num_neighbors++] =
+                                int(it - cell_keys.begin());
+                    }
+                }
+            }
+        }
+        neighbor_offsets[cidx + 1] = num_neighbors;
+    }
+    for (int cidx = 0; cidx < num_cells; ++cidx) {
+        int begin = neighbor_offsets[cidx];
+        std::copy(neighbor_cells.begin() + 27 * cidx,
+                  neighbor_cells.begin() + 27 * cidx +
+                          neighbor_offsets[cidx + 1],
+                  neighbor_cells.begin() + begin);
+        neighbor_offsets[cidx + 1] += begin;
+    }
+    neighbor_cells.resize(neighbor_offsets[num_cells]);
+
+    std::vector<double> weights(num_points, 0);
+    std::vector<uint8_t> deleted(num_points, 0);
+    const double r_max2 = r_max * r_max;
+    auto ForEachNeighbor = [&](int cidx, int pidx0, auto f) {
+        const Eigen::Vector3d &p0 = pcl->points_[pidx0];
+        for (int n = neighbor_offsets[cidx]; n < neighbor_offsets[cidx + 1];
+             ++n) {
+            int ncidx = neighbor_cells[n];
+            for (int i = cell_offsets[ncidx]; i < cell_offsets[ncidx + 1];
+                 ++i) {
+                int pidx1 = sorted_points[i];
+                if (pidx1 == pidx0 || deleted[pidx1]) {
+                    continue;
+                }
+                double d2 = (pcl->points_[pidx1] - p0).squaredNorm();
+                if (d2 < r_max2) {
+                    f(pidx1, d2);
+                }
+            }
+        }
+    };
+    // Points are eliminated by decreasing weight, equal weights by
+    // increasing index.
+    auto EliminatedBefore = [&](int pidx0, int pidx1) {
+        return weights[pidx0] > weights[pidx1] ||
+               (weights[pidx0] == weights[pidx1] && pidx0 < pidx1);
+    };
+    std::vector<int> cell_max(num_cells, -1);
+    auto UpdateCellMax = [&](int cidx) {
+        cell_max[cidx] = -1;
+        for (int i = cell_offsets[cidx]; i < cell_offsets[cidx + 1]; ++i) {
+            int pidx = sorted_points[i];
+            if (!deleted[pidx] && (cell_max[cidx] < 0 ||
+                                   EliminatedBefore(pidx, cell_max[cidx]))) {
+                cell_max[cidx] = pidx;
+            }
+        }
+    };
+#pragma omp parallel for schedule(static)
+    for (int cidx = 0; cidx < num_cells; ++cidx) {
+        for (int i = cell_offsets[cidx]; i < cell_offsets[cidx + 1]; ++i) {
+            int pidx = sorted_points[i];
+            ForEachNeighbor(cidx, pidx, [&](int, double d2) {
+                weights[pidx] += WeightFcn(d2);
+            });
+        }
+    }
+#pragma omp parallel for schedule(static)
+    for (int cidx = 0; cidx < num_cells; ++cidx) {
+        UpdateCellMax(cidx);
+    }
+
+    // Cells whose coordinates are equal modulo 3 form a phase group. Their
+    // neighborhoods are disjoint, so that the points of a phase group are
+    // eliminated concurrently.
+    std::vector<std::vector<int>> phase_cells(27);
+    for (int cidx = 0; cidx < num_cells; ++cidx) {
+        int phase = 0;
+        for (int c = 0; c < 3; ++c) {
+            phase = 3 * phase + ((cell_keys[cidx][c] % 3) + 3) % 3;
+        }
+        phase_cells[phase].push_back(cidx);
+    }
+
+    // Every cell of a phase group eliminates its heaviest point if no
+    // neighboring cell has a heavier one. The global heaviest point always
+    // qualifies, so that every round eliminates at least one point.
+    size_t num_remove = num_points - std::min(size_t(num_points),
+                                              number_of_points);
+    while (num_remove > 0) {
+        for (const std::vector<int> &cells : phase_cells) {
+            if (num_remove == 0) {
+                break;
+            }
+            std::vector<int> candidates(cells.size(), -1);
+#pragma omp parallel for schedule(static)
+            for (int i = 0; i < int(cells.size()); ++i) {
+                int cidx = cells[i];
+                int pidx = cell_max[cidx];
+                if (pidx < 0) {
+                    continue;
+                }
+                bool is_heaviest = true;
+                for (int n = neighbor_offsets[cidx];
+                     n < neighbor_offsets[cidx + 1] && is_heaviest; ++n) {
+                    int npidx = cell_max[neighbor_cells[n]];
+                    is_heaviest = npidx < 0 || npidx == pidx ||
+                                  !EliminatedBefore(npidx, pidx);
+                }
+                if (is_heaviest) {
+                    candidates[i] = cidx;
+                }
+            }
+            candidates.erase(
+                    std::remove(candidates.begin(), candidates.end(), -1),
+                    candidates.end());
+            if (candidates.size() > num_remove) {
+                std::nth_element(candidates.begin(),
+                                 candidates.begin() + num_remove,
+                                 candidates.end(), [&](int c0, int c1) {
+                                     return EliminatedBefore(cell_max[c0],
+                                                             cell_max[c1]);
+                                 });
+                candidates.resize(num_remove);
+            }
+#pragma omp parallel for schedule(static)
+            for (int i = 0; i < int(candidates.size()); ++i) {
+                int cidx = candidates[i];
+                int pidx = cell_max[cidx];
+                deleted[pidx] = 1;
+                ForEachNeighbor(cidx, pidx, [&](int pidx1, double d2) {
+                    weights[pidx1] -= WeightFcn(d2);
+                });
+                for (int n = neighbor_offsets[cidx];
+                     n < neighbor_offsets[cidx + 1]; ++n) {
+                    UpdateCellMax(neighbor_cells[n]);
+                }
+            }
+            num_remove -= candidates.size();
+        }
+    }
+
+    // update pcl
+    bool has_vert_normal = pcl->HasNormals();
+    bool has_vert_color = pcl->HasColors();
+    std::vector<uint8_t> keep(num_points);
+    std::vector<int> new_ids(num_points);
+    int num_kept = 0;
+    for (int pidx = 0; pidx < num_points; ++pidx) {
+        keep[pidx] = !deleted[pidx];
+        new_ids[pidx] = num_kept;
+        num_kept += keep[pidx];
+    }
+    CompactInParallel(pcl->points_, keep, new_ids, num_kept);
+    if (has_vert_normal) {
+        CompactInParallel(pcl->normals_, keep, new_ids, num_kept);
+    }
+    if (has_vert_color) {
+        CompactInParallel(pcl->colors_, keep, new_ids, num_kept);
+    }
+    return pcl;
+}
+
 TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
-    typedef std::tuple<double, double, double> Coordinate3;
-    std::unordered_map<Coordinate3, size_t, utility::hash_tuple<Coordinate3>>
-            point_to_old_index;
-    std::vector<int> index_old_to_new(vertices_.size());
+    const int old_vertex_num = int(vertices_.size());
+    std::vector<std::array<uint64_t, 3>> coords(old_vertex_num);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < old_vertex_num; i++) {
+        coords[i] = {CoordinateBits(vertices_[i](0)),
+                     CoordinateBits(vertices_[i](1)),
+                     CoordinateBits(vertices_[i](2))};
+    }
+    // Every vertex is replaced by the first vertex at its coordinates.
+    std::vector<int> first_ids = FindFirstOccurrences(coords);
+    std::vector<uint8_t> keep(old_vertex_num);
+    std::vector<int> index_old_to_new(old_vertex_num);
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
-    size_t old_vertex_num = vertices_.size();
-    size_t k = 0;                                  // new index
-    for (size_t i = 0; i < old_vertex_num; i++) {  // old index
-        Coordinate3 coord = std::make_tuple(vertices_[i](0), vertices_[i](1),
-                                            vertices_[i](2));
-        if (point_to_old_index.find(coord) == point_to_old_index.end()) {
-            point_to_old_index[coord] = i;
-            vertices_[k] = vertices_[i];
-            if (has_vert_normal) vertex_normals_[k] = vertex_normals_[i];
-            if (has_vert_color) vertex_colors_[k] = vertex_colors_[i];
-            index_old_to_new[i] = (int)k;
-            k++;
-        } else {
-            index_old_to_new[i] = index_old_to_new[point_to_old_index[coord]];
-        }
+    int k = 0;  // new index
+    for (int i = 0; i < old_vertex_num; i++) {
+        keep[i] = first_ids[i] == i;
+        index_old_to_new[i] = keep[i] ? k++ : index_old_to_new[first_ids[i]];
     }
-    vertices_.resize(k);
-    if (has_vert_normal) vertex_normals_.resize(k);
-    if (has_vert_color) vertex_colors_.resize(k);
     if (k < old_vertex_num) {
-        for (auto &triangle : triangles_) {
+        CompactInParallel(vertices_, keep, index_old_to_new, k);
+        if (has_vert_normal) {
+            CompactInParallel(vertex_normals_, keep, index_old_to_new, k);
+        }
+        if (has_vert_color) {
+            CompactInParallel(vertex_colors_, keep, index_old_to_new, k);
+        }
+#pragma omp parallel for schedule(static)
+        for (int tidx = 0; tidx < int(triangles_.size()); tidx++) {
+            Eigen::Vector3i &triangle = triangles_[tidx];
             triangle(0) = index_old_to_new[triangle(0)];
             triangle(1) = index_old_to_new[triangle(1)];
             triangle(2) = index_old_to_new[triangle(2)];
@@ -724,7 +1099,7 @@ TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
     }
     utility::LogDebug(
             "[RemoveDuplicatedVertices] {:d} vertices have been removed.",
-            (int)(old_vertex_num - k));
+            old_vertex_num - k);
 
     return *this;
 }
@@ -735,48 +1110,49 @@ TriangleMesh &TriangleMesh::RemoveDuplicatedTriangles() {
                 "[RemoveDuplicatedTriangles] This mesh contains triangle uvs "
                 "that are not handled in this function");
     }
-    typedef std::tuple<int, int, int> Index3;
-    std::unordered_map<Index3, size_t, utility::hash_tuple<Index3>>
-            triangle_to_old_index;
-    bool has_tri_normal = HasTriangleNormals();
-    size_t old_triangle_num = triangles_.size();
-    size_t k = 0;
-    for (size_t i = 0; i < old_triangle_num; i++) {
-        Index3 index;
+    const int old_triangle_num = int(triangles_.size());
+    std::vector<std::array<int, 3>> indices(old_triangle_num);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < old_triangle_num; i++) {
         // We first need to find the minimum index. Because triangle (0-1-2)
         // and triangle (2-0-1) are the same.
-        if (triangles_[i](0) <= triangles_[i](1)) {
-            if (triangles_[i](0) <= triangles_[i](2)) {
-                index = std::make_tuple(triangles_[i](0), triangles_[i](1),
-                                        triangles_[i](2));
+        const Eigen::Vector3i &triangle = triangles_[i];
+        if (triangle(0) <= triangle(1)) {
+            if (triangle(0) <= triangle(2)) {
+                indices[i] = {triangle(0), triangle(1), triangle(2)};
             } else {
-                index = std::make_tuple(triangles_[i](2), triangles_[i](0),
-                                        triangles_[i](1));
+                indices[i] = {triangle(2), triangle(0), triangle(1)};
             }
         } else {
-            if (triangles_[i](1) <= triangles_[i](2)) {
-                index = std::make_tuple(triangles_[i](1), triangles_[i](2),
-                                        triangles_[i](0));
+            if (triangle(1) <= triangle(2)) {
+                indices[i] = {triangle(1), triangle(2), triangle(0)};
             } else {
-                index = std::make_tuple(triangles_[i](2), triangles_[i](0),
-                                        triangles_[i](1));
+                indices[i] = {triangle(2), triangle(0), triangle(1)};
             }
         }
-        if (triangle_to_old_index.find(index) == triangle_to_old_index.end()) {
-            triangle_to_old_index[index] = i;
-            triangles_[k] = triangles_[i];
-            if (has_tri_normal) triangle_normals_[k] = triangle_normals_[i];
-            k++;
-        }
     }
-    triangles_.resize(k);
-    if (has_tri_normal) triangle_normals_.resize(k);
-    if (k < old_triangle_num && HasAdjacencyList()) {
-        ComputeAdjacencyList();
+    std::vector<int> first_ids = FindFirstOccurrences(indices);
+    std::vector<uint8_t> keep(old_triangle_num);
+    std::vector<int> index_old_to_new(old_triangle_num);
+    bool has_tri_normal = HasTriangleNormals();
+    int k = 0;
+    for (int i = 0; i < old_triangle_num; i++) {
+        keep[i] = first_ids[i] == i;
+        index_old_to_new[i] = k;
+        k += keep[i];
+    }
+    if (k < old_triangle_num) {
+        CompactInParallel(triangles_, keep, index_old_to_new, k);
+        if (has_tri_normal) {
+            CompactInParallel(triangle_normals_, keep, index_old_to_new, k);
+        }
+        if (HasAdjacencyList()) {
+            ComputeAdjacencyList();
+        }
     }
     utility::LogDebug(
             "[RemoveDuplicatedTriangles] {:d} triangles have been removed.",
-            (int)(old_triangle_num - k));
+            old_triangle_num - k);
 
     return *this;
 }
@@ -866,10 +1242,15 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
     bool mesh_is_edge_manifold = false;
     while (!mesh_is_edge_manifold) {
         mesh_is_edge_manifold = true;
-        auto edges_to_triangles = GetEdgeToTrianglesMap();
-
-        for (auto &kv : edges_to_triangles) {
-            size_t n_edge_triangle_refs = kv.second.size();
+        auto topology = GetTopology();
+
+        for (int eidx = 0; eidx < topology->NumEdges(); ++eidx) {
+            const auto trias_begin = topology->edge_triangles_.begin();
+            auto edge_triangles_begin =
+                    trias_begin + topology->edge_triangle_offsets_[eidx];
+            auto edge_triangles_end =
+                    trias_begin + topology->edge_triangle_offsets_[eidx + 1];
+            size_t n_edge_triangle_refs = topology->NumEdgeTriangles(eidx);
             // check if the given edge is manifold
             // (has exactly 1, or 2 adjacent triangles)
             if (n_edge_triangle_refs == 1u || n_edge_triangle_refs == 2u) {
@@ -886,7 +1267,9 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
             // is <= 2.
             // 1) count triangles that are not marked deleted
             int n_triangles = 0;
-            for (int tidx : kv.second) {
+            for (auto it = edge_triangles_begin; it != edge_triangles_end;
+                 ++it) {
+                int tidx = *it;
                 if (triangle_areas[tidx] > 0) {
                     n_triangles++;
                 }
@@ -898,7 +1281,9 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
                 // find triangle with smallest area
                 int min_tidx = -1;
                 double min_area = std::numeric_limits<double>::max();
-                for (int tidx : kv.second) {
+                for (auto it = edge_triangles_begin; it != edge_triangles_end;
+                 ++it) {
+                int tidx = *it;
                     double area = triangle_areas[tidx];
                     if (area > 0 && area < min_area) {
                         min_tidx = tidx;
@@ -946,50 +1331,63 @@ TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
     }
     utility::LogDebug("Done Precompute Neighbours");
 
-    bool has_vertex_normals = HasVertexNormals();
-    bool has_vertex_colors = HasVertexColors();
-    std::vector<Eigen::Vector3d> new_vertices;
-    std::vector<Eigen::Vector3d> new_vertex_normals;
-    std::vector<Eigen::Vector3d> new_vertex_colors;
-    std::unordered_map<int, int> new_vert_mapping;
-    for (int vidx = 0; vidx < int(vertices_.size()); ++vidx) {
-        if (new_vert_mapping.count(vidx) > 0) {
+    // Every vertex that is not merged yet takes its unmerged neighbours, in
+    // vertex order. The members of a new vertex are stored in the order in
+    // which they are summed up, so that the averages can be computed in
+    // parallel.
+    const int num_vertices = int(vertices_.size());
+    std::vector<int> new_vert_mapping(num_vertices, -1);
+    std::vector<int> members;
+    members.reserve(num_vertices);
+    std::vector<int> member_offsets(1, 0);
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        if (new_vert_mapping[vidx] >= 0) {
             continue;
         }
-
-        int new_vidx = int(new_vertices.size());
+        int new_vidx = int(member_offsets.size()) - 1;
         new_vert_mapping[vidx] = new_vidx;
-
-        Eigen::Vector3d vertex = vertices_[vidx];
-        Eigen::Vector3d normal;
-        if (has_vertex_normals) {
-            normal = vertex_normals_[vidx];
-        }
-        Eigen::Vector3d color;
-        if (has_vertex_colors) {
-            color = vertex_colors_[vidx];
-        }
-        int n = 1;
+        members.push_back(vidx);
         for (int nb : nbs[vidx]) {
-            if (vidx == nb || new_vert_mapping.count(nb) > 0) {
+            if (vidx == nb || new_vert_mapping[nb] >= 0) {
                 continue;
             }
-            vertex += vertices_[nb];
+            new_vert_mapping[nb] = new_vidx;
+            members.push_back(nb);
+        }
+        member_offsets.push_back(int(members.size()));
+    }
+    nbs.clear();
+
+    bool has_vertex_normals = HasVertexNormals();
+    bool has_vertex_colors = HasVertexColors();
+    const int num_new_vertices = int(member_offsets.size()) - 1;
+    std::vector<Eigen::Vector3d> new_vertices(num_new_vertices);
+    std::vector<Eigen::Vector3d> new_vertex_normals(
+            has_vertex_normals ? num_new_vertices : 0);
+    std::vector<Eigen::Vector3d> new_vertex_colors(
+            has_vertex_colors ? num_new_vertices : 0);
+#pragma omp parallel for schedule(static)
+    for (int new_vidx = 0; new_vidx < num_new_vertices; ++new_vidx) {
+        Eigen::Vector3d vertex = Eigen::Vector3d::Zero();
+        Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+        Eigen::Vector3d color = Eigen::Vector3d::Zero();
+        for (int i = member_offsets[new_vidx];
+             i < member_offsets[new_vidx + 1]; ++i) {
+            vertex += vertices_[members[i]];
             if (has_vertex_normals) {
-                normal += vertex_normals_[nb];
+                normal += vertex_normals_[members[i]];
             }
             if (has_vertex_colors) {
-                color += vertex_colors_[nb];
+                color += vertex_colors_[members[i]];
             }
-            new_vert_mapping[nb] = new_vidx;
-            n += 1;
         }
-        new_vertices.push_back(vertex / n);
+        int n = member_offsets[new_vidx + 1] - member_offsets[new_vidx];
+        new_vertices[new_vidx] = vertex / n;
         if (has_vertex_normals) {
-            new_vertex_normals.push_back(normal / n);
+            new_vertex_normals[new_vidx] = normal / n;
         }
         if (has_vertex_colors) {
-            new_vertex_colors.push_back(color / n);
+            new_vertex_colors[new_vidx] = color / n;
         }
     }
     utility::LogDebug("Merged {} vertices",
@@ -999,7 +1397,9 @@ TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
     std::swap(vertex_normals_, new_vertex_normals);
     std::swap(vertex_colors_, new_vertex_colors);
 
-    for (auto &triangle : triangles_) {
+#pragma omp parallel for schedule(static)
+    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
+        Eigen::Vector3i &triangle = triangles_[tidx];
         triangle(0) = new_vert_mapping[triangle(0)];
         triangle(1) = new_vert_mapping[triangle(1)];
         triangle(2) = new_vert_mapping[triangle(2)];
@@ -1266,15 +1666,7 @@ Eigen::Vector4d TriangleMesh::GetTrianglePlane(size_t triangle_idx) const {
 }
 
 int TriangleMesh::EulerPoincareCharacteristic() const {
-    std::unordered_set<Eigen::Vector2i, utility::hash_eigen<Eigen::Vector2i>>
-            edges;
-    for (auto triangle : triangles_) {
-        edges.emplace(GetOrderedEdge(triangle(0), triangle(1)));
-        edges.emplace(GetOrderedEdge(triangle(0), triangle(2)));
-        edges.emplace(GetOrderedEdge(triangle(1), triangle(2)));
-    }
-
-    int E = int(edges.size());
+    int E = GetTopology()->NumEdges();
     int V = int(vertices_.size());
     int F = int(triangles_.size());
     return V + F - E;
@@ -1282,13 +1674,14 @@ int TriangleMesh::EulerPoincareCharacteristic() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
+    auto topology = GetTopology();
     std::vector<Eigen::Vector2i> non_manifold_edges;
-    for (auto &kv : edges) {
+    for (int eidx = 0; eidx < topology->NumEdges(); ++eidx) {
+        int n_edge_triangles = topology->NumEdgeTriangles(eidx);
         if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
-            non_manifold_edges.push_back(kv.first);
+             (n_edge_triangles < 1 || n_edge_triangles > 2)) ||
+            (!allow_boundary_edges && n_edge_triangles != 2)) {
+            non_manifold_edges.push_back(topology->edges_[eidx]);
         }
     }
     return non_manifold_edges;
@@ -1296,15 +1689,18 @@ std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
 
 bool TriangleMesh::IsEdgeManifold(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
-    for (auto &kv : edges) {
+    auto topology = GetTopology();
+    int n_non_manifold_edges = 0;
+#pragma omp parallel for reduction(+ : n_non_manifold_edges) schedule(static)
+    for (int eidx = 0; eidx < topology->NumEdges(); ++eidx) {
+        int n_edge_triangles = topology->NumEdgeTriangles(eidx);
         if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
-            return false;
+             (n_edge_triangles < 1 || n_edge_triangles > 2)) ||
+            (!allow_boundary_edges && n_edge_triangles != 2)) {
+            n_non_manifold_edges++;
         }
     }
-    return true;
+    return n_non_manifold_edges == 0;
 }
 
 std::vector<int> TriangleMesh::GetNonManifoldVertices() const {
@@ -1369,33 +1765,57 @@ bool TriangleMesh::IsVertexManifold() const {
 
 std::vector<Eigen::Vector2i> TriangleMesh::GetSelfIntersectingTriangles()
         const {
+    // Only the triangles with overlapping bounding boxes are tested.
+    TriangleMeshBVH bvh(*this);
     std::vector<Eigen::Vector2i> self_intersecting_triangles;
-    for (size_t tidx0 = 0; tidx0 < triangles_.size() - 1; ++tidx0) {
-        const Eigen::Vector3i &tria_p = triangles_[tidx0];
-        const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
-        const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
-        const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = tidx0 + 1; tidx1 < triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = triangles_[tidx1];
-            // check if neighbour triangle
-            if (tria_p(0) == tria_q(0) || tria_p(0) == tria_q(1) ||
-                tria_p(0) == tria_q(2) || tria_p(1) == tria_q(0) ||
-                tria_p(1) == tria_q(1) || tria_p(1) == tria_q(2) ||
-                tria_p(2) == tria_q(0) || tria_p(2) == tria_q(1) ||
-                tria_p(2) == tria_q(2)) {
-                continue;
-            }
-
-            // check for intersection
-            const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                self_intersecting_triangles.push_back(
-                        Eigen::Vector2i(tidx0, tidx1));
-            }
-        }
-    }
+#pragma omp parallel
+    {
+        std::vector<Eigen::Vector2i> local_triangles;
+#pragma omp for schedule(dynamic, 64)
+        for (int tidx0 = 0; tidx0 < int(triangles_.size()); ++tidx0) {
+            const Eigen::Vector3i &tria_p = triangles_[tidx0];
+            const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
+            const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
+            const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
+            bvh.ForEachOverlappingTriangle(
+                    p0.cwiseMin(p1).cwiseMin(p2), p0.cwiseMax(p1).cwiseMax(p2),
+                    [&](int tidx1) {
+                        if (tidx1 <= tidx0) {
+                            return;
+                        }
+                        const Eigen::Vector3i &tria_q = triangles_[tidx1];
+                        // check if neighbour triangle
+                        for (int i = 0; i < 3; ++i) {
+                            if (tria_p(i) == tria_q(0) ||
+                                tria_p(i) == tria_q(1) ||
+                                tria_p(i) == tria_q(2)) {
+                                return;
+                            }
+                        }
+
+                        // check for intersection
+                        const Eigen::Vector3d &q0 = vertices_[tria_q(0)];
+                        const Eigen::Vector3d &q1 = vertices_[tria_q(1)];
+                        const Eigen::Vector3d &q2 = vertices_[tria_q(2)];
+                        if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0,
+                                                                 q1, q2)) {
+                            local_triangles.push_back(
+                                    Eigen::Vector2i(tidx0, tidx1));
+                        }
+                    });
+        }
+#pragma omp critical
+        {
+            self_intersecting_triangles.insert(
+                    self_intersecting_triangles.end(), local_triangles.begin(),
+                    local_triangles.end());
+        }
+    }
+    std::sort(self_intersecting_triangles.begin(),
+              self_intersecting_triangles.end(),
+              [](const Eigen::Vector2i &a, const Eigen::Vector2i &b) {
+                  return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+              });
     return self_intersecting_triangles;
 }
 
@@ -1412,22 +1832,31 @@ bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
     if (!IsBoundingBoxIntersecting(other)) {
         return false;
     }
-    for (size_t tidx0 = 0; tidx0 < triangles_.size(); ++tidx0) {
+    TriangleMeshBVH bvh(other);
+    std::atomic<bool> is_intersecting(false);
+#pragma omp parallel for schedule(dynamic, 64)
+    for (int tidx0 = 0; tidx0 < int(triangles_.size()); ++tidx0) {
+        if (is_intersecting.load(std::memory_order_relaxed)) {
+            continue;
+        }
         const Eigen::Vector3i &tria_p = triangles_[tidx0];
         const Eigen::Vector3d &p0 = vertices_[tria_p(0)];
         const Eigen::Vector3d &p1 = vertices_[tria_p(1)];
         const Eigen::Vector3d &p2 = vertices_[tria_p(2)];
-        for (size_t tidx1 = 0; tidx1 < other.triangles_.size(); ++tidx1) {
-            const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
-            const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
-            const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
-            const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
-            if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1, q2)) {
-                return true;
-            }
-        }
+        bvh.ForEachOverlappingTriangle(
+                p0.cwiseMin(p1).cwiseMin(p2), p0.cwiseMax(p1).cwiseMax(p2),
+                [&](int tidx1) {
+                    const Eigen::Vector3i &tria_q = other.triangles_[tidx1];
+                    const Eigen::Vector3d &q0 = other.vertices_[tria_q(0)];
+                    const Eigen::Vector3d &q1 = other.vertices_[tria_q(1)];
+                    const Eigen::Vector3d &q2 = other.vertices_[tria_q(2)];
+                    if (IntersectionTest::TriangleTriangle3d(p0, p1, p2, q0, q1,
+                                                             q2)) {
+                        is_intersecting.store(true, std::memory_order_relaxed);
+                    }
+                });
     }
-    return false;
+    return is_intersecting;
 }
 
 std::tuple<std::vector<int>, std::vector<size_t>, std::vector<double>>
@@ -1436,27 +1865,8 @@ TriangleMesh::ClusterConnectedTriangles() const {
     std::vector<size_t> num_triangles;
     std::vector<double> areas;
 
-    utility::LogDebug("[ClusterConnectedTriangles] Compute triangle adjacency");
-    auto edges_to_triangles = GetEdgeToTrianglesMap();
-    std::vector<std::unordered_set<int>> adjacency_list(triangles_.size());
-#pragma omp parallel for schedule(static)
-    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
-        const auto &triangle = triangles_[tidx];
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(1))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(1), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-    }
-    utility::LogDebug(
-            "[ClusterConnectedTriangles] Done computing triangle adjacency");
+    // Triangles are adjacent if they share an edge.
+    auto topology = GetTopology();
 
     int cluster_idx = 0;
     for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
@@ -1477,10 +1887,15 @@ TriangleMesh::ClusterConnectedTriangles() const {
             cluster_n_triangles++;
             cluster_area += GetTriangleArea(cluster_tidx);
 
-            for (auto tnb : adjacency_list[cluster_tidx]) {
-                if (triangle_clusters[tnb] == -1) {
-                    triangle_queue.push(tnb);
-                    triangle_clusters[tnb] = cluster_idx;
+            for (int k = 0; k < 3; ++k) {
+                int eidx = topology->triangle_edges_[3 * cluster_tidx + k];
+                for (int i = topology->edge_triangle_offsets_[eidx];
+                     i < topology->edge_triangle_offsets_[eidx + 1]; ++i) {
+                    int tnb = topology->edge_triangles_[i];
+                    if (triangle_clusters[tnb] == -1) {
+                        triangle_queue.push(tnb);
+                        triangle_clusters[tnb] = cluster_idx;
+                    }
                 }
             }
         }
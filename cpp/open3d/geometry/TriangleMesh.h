@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cstdint>
 #include <memory>
 #include <numeric>
 #include <tuple>
@@ -36,6 +37,7 @@
 
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/MeshBase.h"
+#include "open3d/geometry/TriangleMeshTopology.h"
 #include "open3d/utility/Helper.h"
 
 namespace open3d {
@@ -135,6 +137,13 @@ public:
     /// needed.
     TriangleMesh &ComputeAdjacencyList();
 
+    /// \brief Function that returns the edge topology of the mesh.
+    ///
+    /// The topology is built on first use and cached. Every call compares a
+    /// fingerprint of the triangles with the cached one, so that the topology
+    /// is rebuilt after the triangles have been modified.
+    std::shared_ptr<const TriangleMeshTopology> GetTopology() const;
+
     /// \brief Function that removes duplicated verties, i.e., vertices that
     /// have identical coordinates.
     TriangleMesh &RemoveDuplicatedVertices();
@@ -390,6 +399,20 @@ public:
             bool use_triangle_normal = false,
             int seed = -1);
 
+    /// Function to sample \p number_of_points points (blue noise) like
+    /// SamplePointsPoissonDisk, eliminating samples in parallel. The samples
+    /// are sorted into a grid, and cells in the same phase group, which are
+    /// three cells apart, eliminate their heaviest sample concurrently if no
+    /// neighboring cell has a heavier one. The parameters are the same as for
+    /// SamplePointsPoissonDisk, and the result does not depend on the number
+    /// of threads.
+    std::shared_ptr<PointCloud> SamplePointsPoissonDiskParallel(
+            size_t number_of_points,
+            double init_factor = 5,
+            const std::shared_ptr<PointCloud> pcl_init = nullptr,
+            bool use_triangle_normal = false,
+            int seed = -1);
+
     /// Function to subdivide triangle mesh using the simple midpoint algorithm.
     /// Each triangle is subdivided into four triangles per iteration and the
     /// new vertices lie on the midpoint of the triangle edges.
@@ -430,6 +453,23 @@ public:
             double maximum_error,
             double boundary_weight) const;
 
+    /// Function to simplify mesh using Quadric Error Metric Decimation in
+    /// parallel. Every round collapses an independent set of the cheapest
+    /// edges, where the triangles around the collapsed edges are disjoint,
+    /// concurrently. Edges are hence collapsed in a different order than in
+    /// SimplifyQuadricDecimation, trading a slightly higher error for speed.
+    /// \param target_number_of_triangles defines the number of triangles that
+    /// the simplified mesh should have. It is not guaranteed that this number
+    /// will be reached.
+    /// \param maximum_error defines the maximum error where a vertex is allowed
+    /// to be merged
+    /// \param boundary_weight a weight applied to edge vertices used to
+    /// preserve boundaries
+    std::shared_ptr<TriangleMesh> SimplifyQuadricDecimationParallel(
+            int target_number_of_triangles,
+            double maximum_error = std::numeric_limits<double>::infinity(),
+            double boundary_weight = 1.0) const;
+
     /// Function to select points from \p input TriangleMesh into
     /// output TriangleMesh
     /// Vertices with indices in \p indices are selected.
@@ -581,6 +621,38 @@ public:
                                 bool linear_fit = false,
                                 int n_threads = -1);
 
+    /// \brief Function that computes a triangle mesh from a large oriented
+    /// PointCloud pcd tile by tile, bounding the memory of the
+    /// reconstruction. The bounding box of pcd is split into cubic tiles, and
+    /// each tile is reconstructed with CreateFromPointCloudPoisson from its
+    /// points and the points within overlap around it. Each tile keeps the
+    /// triangles whose centroid lies inside it, and the vertices of
+    /// neighboring tiles along the tile boundaries are merged to stitch the
+    /// tiles together.
+    ///
+    /// \param pcd PointCloud with normals and optionally colors.
+    /// \param tile_size Edge length of the cubic tiles.
+    /// \param overlap Distance by which each tile is extended on every side
+    /// when reconstructing it. Has to be in [0, tile_size].
+    /// \param depth Maximum depth of the tree of each tile.
+    /// \param scale Specifies the ratio between the diameter of the cube used
+    /// for the reconstruction of a tile and the diameter of its samples'
+    /// bounding cube.
+    /// \param linear_fit If true, the reconstructor use linear interpolation
+    /// to estimate the positions of iso-vertices.
+    /// \param n_threads Number of threads used for the reconstruction of each
+    /// tile. Set to -1 to automatically determine it.
+    /// \return The estimated TriangleMesh, and per vertex densitie values that
+    /// can be used to to trim the mesh.
+    static std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+    CreateFromPointCloudPoissonTiled(const PointCloud &pcd,
+                                     double tile_size,
+                                     double overlap,
+                                     size_t depth = 8,
+                                     float scale = 1.1f,
+                                     bool linear_fit = false,
+                                     int n_threads = -1);
+
     /// Factory function to create a tetrahedron mesh (trianglemeshfactory.cpp).
     /// the mesh centroid will be at (0,0,0) and \p radius defines the
     /// distance from the center to the mesh vertices.
@@ -749,7 +821,7 @@ protected:
             const std::vector<Eigen::Vector3d> &prev_vertices,
             const std::vector<Eigen::Vector3d> &prev_vertex_normals,
             const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-            const std::vector<std::unordered_set<int>> &adjacency_list,
+            const TriangleMeshTopology &topology,
             double lambda,
             bool filter_vertex,
             bool filter_normal,
@@ -773,6 +845,17 @@ protected:
                     &edges_to_vertices,
             double min_weight = std::numeric_limits<double>::lowest()) const;
 
+    /// Topology of the triangles with the given fingerprint.
+    struct CachedTopology {
+        uint64_t fingerprint;
+        std::shared_ptr<const TriangleMeshTopology> topology;
+    };
+    /// Topology returned by GetTopology, accessed atomically.
+    mutable std::shared_ptr<const CachedTopology> topology_cache_;
+
+    /// Uses ComputeEdgeWeightsCot.
+    friend class AsRigidAsPossibleDeformation;
+
 public:
     /// List of triangles denoted by the index of points forming the triangle.
     std::vector<Eigen::Vector3i> triangles_;
@@ -0,0 +1,360 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshBVH.h"
+
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Spreads the lower 21 bits of \p x to every third bit.
+uint64_t SpreadBits(uint64_t x) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffffULL;
+    x = (x | x << 16) & 0x1f0000ff0000ffULL;
+    x = (x | x << 8) & 0x100f00f00f00f00fULL;
+    x = (x | x << 4) & 0x10c30c30c30c30c3ULL;
+    x = (x | x << 2) & 0x1249249249249249ULL;
+    return x;
+}
+
+/// Returns the index of the highest set bit of \p x > 0.
+int HighestBit(uint64_t x) {
+    int bit = 0;
+    while (x >>= 1) {
+        bit++;
+    }
+    return bit;
+}
+
+/// Returns the squared distance of \p point to the box from \p min_bound to
+/// \p max_bound.
+double SquaredDistanceToBox(const Eigen::Vector3d &point,
+                            const Eigen::Vector3d &min_bound,
+                            const Eigen::Vector3d &max_bound) {
+    return (min_bound - point)
+            .cwiseMax(point - max_bound)
+            .cwiseMax(0.0)
+            .squaredNorm();
+}
+
+/// Appends the nodes over the sorted codes begin to end - 1 in depth first
+/// order, and returns the index of the subtree root.
+int BuildNodes(const std::vector<std::pair<uint64_t, int>> &codes,
+               int begin,
+               int end,
+               int max_leaf_size,
+               std::vector<TriangleMeshBVH::Node> &nodes) {
+    int node_idx = int(nodes.size());
+    nodes.emplace_back();
+    nodes[node_idx].begin_ = begin;
+    nodes[node_idx].end_ = end;
+    if (end - begin <= max_leaf_size) {
+        return node_idx;
+    }
+
+    // Split where the highest differing bit of the codes changes, or at the
+    // median if all codes are equal.
+    uint64_t first = codes[begin].first;
+    uint64_t last = codes[end - 1].first;
+    int split = (begin + end) / 2;
+    if (first != last) {
+        int bit = HighestBit(first ^ last);
+        split = int(std::partition_point(
+                            codes.begin() + begin, codes.begin() + end,
+                            [&](const std::pair<uint64_t, int> &code) {
+                                return (code.first >> bit) == (first >> bit);
+                            }) -
+                    codes.begin());
+    }
+    BuildNodes(codes, begin, split, max_leaf_size, nodes);
+    int right_child = BuildNodes(codes, split, end, max_leaf_size, nodes);
+    nodes[node_idx].right_child_ = right_child;
+    return node_idx;
+}
+
+}  // namespace
+
+TriangleMeshBVH::TriangleMeshBVH(const std::vector<Eigen::Vector3d> &vertices,
+                                 const std::vector<Eigen::Vector3i> &triangles,
+                                 int max_leaf_size /* = 4 */) {
+    const int num_triangles = int(triangles.size());
+    if (num_triangles == 0) {
+        return;
+    }
+    max_leaf_size = std::max(max_leaf_size, 1);
+
+    std::vector<Eigen::Vector3d> centroids(num_triangles);
+    Eigen::Vector3d centroid_min = Eigen::Vector3d::Constant(
+            std::numeric_limits<double>::infinity());
+    Eigen::Vector3d centroid_max = -centroid_min;
+#pragma omp parallel
+    {
+        Eigen::Vector3d local_min = centroid_min;
+        Eigen::Vector3d local_max = centroid_max;
+#pragma omp for schedule(static)
+        for (int tidx = 0; tidx < num_triangles; ++tidx) {
+            const Eigen::Vector3i &triangle = triangles[tidx];
+            centroids[tidx] = (vertices[triangle(0)] + vertices[triangle(1)] +
+                               vertices[triangle(2)]) /
+                              3;
+            local_min = local_min.cwiseMin(centroids[tidx]);
+            local_max = local_max.cwiseMax(centroids[tidx]);
+        }
+#pragma omp critical
+        {
+            centroid_min = centroid_min.cwiseMin(local_min);
+            centroid_max = centroid_max.cwiseMax(local_max);
+        }
+    }
+
+    // Sort the triangles along the Morton curve of their centroids, quantized
+    // to 21 bits per axis.
+    const double max_cell = double((1 << 21) - 1);
+    Eigen::Vector3d scale;
+    for (int c = 0; c < 3; ++c) {
+        double extent = centroid_max(c) - centroid_min(c);
+        scale(c) = extent > 0 ? max_cell / extent : 0;
+    }
+    std::vector<std::pair<uint64_t, int>> codes(num_triangles);
+#pragma omp parallel for schedule(static)
+    for (int tidx = 0; tidx < num_triangles; ++tidx) {
+        Eigen::Vector3d cell = ((centroids[tidx] - centroid_min).array() *
+                                scale.array())
+                                       .min(max_cell)
+                                       .max(0.0);
+        uint64_t code = SpreadBits(uint64_t(cell(0))) << 2 |
+                        SpreadBits(uint64_t(cell(1))) << 1 |
+                        SpreadBits(uint64_t(cell(2)));
+        codes[tidx] = std::make_pair(code, tidx);
+    }
+    tbb::parallel_sort(codes.begin(), codes.end());
+
+    triangle_indices_.resize(num_triangles);
+    triangle_min_bounds_.resize(num_triangles);
+    triangle_max_bounds_.resize(num_triangles);
+    triangle_vertices_.resize(3 * num_triangles);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < num_triangles; ++i) {
+        int tidx = codes[i].second;
+        const Eigen::Vector3i &triangle = triangles[tidx];
+        triangle_indices_[i] = tidx;
+        for (int k = 0; k < 3; ++k) {
+            triangle_vertices_[3 * i + k] = vertices[triangle(k)];
+        }
+        const Eigen::Vector3d &p0 = triangle_vertices_[3 * i];
+        const Eigen::Vector3d &p1 = triangle_vertices_[3 * i + 1];
+        const Eigen::Vector3d &p2 = triangle_vertices_[3 * i + 2];
+        triangle_min_bounds_[i] = p0.cwiseMin(p1).cwiseMin(p2);
+        triangle_max_bounds_[i] = p0.cwiseMax(p1).cwiseMax(p2);
+    }
+
+    // Link the nodes, then bound the leaves in parallel. The children of an
+    // inner node follow it, so that the inner nodes are bounded in reverse
+    // order.
+    nodes_.reserve(2 * ((num_triangles + max_leaf_size - 1) / max_leaf_size));
+    BuildNodes(codes, 0, num_triangles, max_leaf_size, nodes_);
+    const int num_nodes = int(nodes_.size());
+#pragma omp parallel for schedule(static)
+    for (int node_idx = 0; node_idx < num_nodes; ++node_idx) {
+        Node &node = nodes_[node_idx];
+        if (!node.IsLeaf()) {
+            continue;
+        }
+        node.min_bound_ = triangle_min_bounds_[node.begin_];
+        node.max_bound_ = triangle_max_bounds_[node.begin_];
+        for (int i = node.begin_ + 1; i < node.end_; ++i) {
+            node.min_bound_ = node.min_bound_.cwiseMin(triangle_min_bounds_[i]);
+            node.max_bound_ = node.max_bound_.cwiseMax(triangle_max_bounds_[i]);
+        }
+    }
+    for (int node_idx = num_nodes - 1; node_idx >= 0; --node_idx) {
+        Node &node = nodes_[node_idx];
+        if (node.IsLeaf()) {
+            continue;
+        }
+        const Node &left = nodes_[node_idx + 1];
+        const Node &right = nodes_[node.right_child_];
+        node.min_bound_ = left.min_bound_.cwiseMin(right.min_bound_);
+        node.max_bound_ = left.max_bound_.cwiseMax(right.max_bound_);
+    }
+}
+
+TriangleMeshBVH::TriangleMeshBVH(const TriangleMesh &mesh,
+                                 int max_leaf_size /* = 4 */)
+    : TriangleMeshBVH(mesh.vertices_, mesh.triangles_, max_leaf_size) {}
+
+std::vector<int> TriangleMeshBVH::GetTrianglesIntersectingAABB(
+        const Eigen::Vector3d &box_center,
+        const Eigen::Vector3d &box_half_size) const {
+    std::vector<int> triangles;
+    ForEachOverlappingSortedTriangle(
+            box_center - box_half_size, box_center + box_half_size,
+            [&](int i) {
+                if (IntersectionTest::TriangleAABB(
+                            box_center, box_half_size,
+                            triangle_vertices_[3 * i],
+                            triangle_vertices_[3 * i + 1],
+                            triangle_vertices_[3 * i + 2])) {
+                    triangles.push_back(triangle_indices_[i]);
+                }
+            });
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+int TriangleMeshBVH::ComputeClosestPoint(const Eigen::Vector3d &point,
+                                         Eigen::Vector3d &closest_point) const {
+    if (IsEmpty()) {
+        return -1;
+    }
+    int closest_triangle = -1;
+    double min_dist2 = std::numeric_limits<double>::infinity();
+    std::vector<std::pair<double, int>> stack;
+    stack.emplace_back(SquaredDistanceToBox(point, nodes_[0].min_bound_,
+                                            nodes_[0].max_bound_),
+                       0);
+    while (!stack.empty()) {
+        double node_dist2 = stack.back().first;
+        int node_idx = stack.back().second;
+        stack.pop_back();
+        if (node_dist2 >= min_dist2) {
+            continue;
+        }
+        const Node &node = nodes_[node_idx];
+        if (node.IsLeaf()) {
+            for (int i = node.begin_; i < node.end_; ++i) {
+                Eigen::Vector3d candidate = ClosestPointOnTriangle(
+                        point, triangle_vertices_[3 * i],
+                        triangle_vertices_[3 * i + 1],
+                        triangle_vertices_[3 * i + 2]);
+                double dist2 = (candidate - point).squaredNorm();
+                if (dist2 < min_dist2 ||
+                    (dist2 == min_dist2 &&
+                     triangle_indices_[i] < closest_triangle)) {
+                    min_dist2 = dist2;
+                    closest_point = candidate;
+                    closest_triangle = triangle_indices_[i];
+                }
+            }
+            continue;
+        }
+        // Visit the nearer child first.
+        int left_idx = node_idx + 1;
+        int right_idx = node.right_child_;
+        double left_dist2 =
+                SquaredDistanceToBox(point, nodes_[left_idx].min_bound_,
+                                     nodes_[left_idx].max_bound_);
+        double right_dist2 =
+                SquaredDistanceToBox(point, nodes_[right_idx].min_bound_,
+                                     nodes_[right_idx].max_bound_);
+        if (left_dist2 <= right_dist2) {
+            stack.emplace_back(right_dist2, right_idx);
+            stack.emplace_back(left_dist2, left_idx);
+        } else {
+            stack.emplace_back(left_dist2, left_idx);
+            stack.emplace_back(right_dist2, right_idx);
+        }
+    }
+    return closest_triangle;
+}
+
+std::vector<double> TriangleMeshBVH::ComputeDistance(
+        const std::vector<Eigen::Vector3d> &points) const {
+    std::vector<double> distances(points.size(),
+                                  std::numeric_limits<double>::infinity());
+    if (IsEmpty()) {
+        return distances;
+    }
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < int(points.size()); ++i) {
+        Eigen::Vector3d closest_point;
+        ComputeClosestPoint(points[i], closest_point);
+        distances[i] = (closest_point - points[i]).norm();
+    }
+    return distances;
+}
+
+Eigen::Vector3d TriangleMeshBVH::ClosestPointOnTriangle(
+        const Eigen::Vector3d &point,
+        const Eigen::Vector3d &p0,
+        const Eigen::Vector3d &p1,
+        const Eigen::Vector3d &p2) {
+    // Voronoi region based method of Ericson, Real-Time Collision Detection,
+    // Section 5.1.5.
+    Eigen::Vector3d e01 = p1 - p0;
+    Eigen::Vector3d e02 = p2 - p0;
+    Eigen::Vector3d d0 = point - p0;
+    double a = e01.dot(d0);
+    double b = e02.dot(d0);
+    if (a <= 0 && b <= 0) {
+        return p0;
+    }
+    Eigen::Vector3d d1 = point - p1;
+    double c = e01.dot(d1);
+    double d = e02.dot(d1);
+    if (c >= 0 && d <= c) {
+        return p1;
+    }
+    double vc = a * d - c * b;
+    if (vc <= 0 && a >= 0 && c <= 0) {
+        return p0 + a / (a - c) * e01;
+    }
+    Eigen::Vector3d d2 = point - p2;
+    double e = e01.dot(d2);
+    double f = e02.dot(d2);
+    if (f >= 0 && e <= f) {
+        return p2;
+    }
+    double vb = e * b - a * f;
+    if (vb <= 0 && b >= 0 && f <= 0) {
+        return p0 + b / (b - f) * e02;
+    }
+    double va = c * f - e * d;
+    if (va <= 0 && (d - c) >= 0 && (e - f) >= 0) {
+        return p1 + (d - c) / ((d - c) + (e - f)) * (p2 - p1);
+    }
+    double denom = va + vb + vc;
+    if (denom <= 0) {
+        // Degenerate triangle, whose vertices are handled above.
+        return p0;
+    }
+    return p0 + (vb / denom) * e01 + (vc / denom) * e02;
+}
+
+}  // namespace geometry
+}  // namespace open3d
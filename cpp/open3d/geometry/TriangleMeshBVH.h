@@ -0,0 +1,182 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMesh;
+
+/// \class TriangleMeshBVH
+///
+/// \brief Bounding volume hierarchy of axis aligned bounding boxes over the
+/// triangles of a mesh.
+///
+/// The triangles are sorted in parallel along the Morton curve of their
+/// centroids, and every node splits its triangles where the highest bit of
+/// their Morton codes changes. The nodes are stored in a flat array in depth
+/// first order, so that the left child of an inner node directly follows it.
+/// The hierarchy copies the triangle vertices and stays valid when the mesh
+/// changes, but does not reflect the changes.
+class TriangleMeshBVH {
+public:
+    /// \class Node
+    ///
+    /// \brief Node of the hierarchy with the bounds of its triangles.
+    class Node {
+    public:
+        /// Returns `true` if the node has no children.
+        bool IsLeaf() const { return right_child_ < 0; }
+
+    public:
+        /// Lower bound of the triangles of the node.
+        Eigen::Vector3d min_bound_;
+        /// Upper bound of the triangles of the node.
+        Eigen::Vector3d max_bound_;
+        /// Index of the right child of an inner node, -1 for a leaf.
+        int right_child_ = -1;
+        /// The node holds the sorted triangles begin_ to end_ - 1.
+        int begin_ = 0;
+        int end_ = 0;
+    };
+
+public:
+    /// \brief Default Constructor, creating an empty hierarchy.
+    TriangleMeshBVH() {}
+    /// \brief Builds the hierarchy over the given triangles.
+    ///
+    /// \param vertices Vertices the triangles index into.
+    /// \param triangles List of triangles.
+    /// \param max_leaf_size Maximum number of triangles of a leaf.
+    TriangleMeshBVH(const std::vector<Eigen::Vector3d> &vertices,
+                    const std::vector<Eigen::Vector3i> &triangles,
+                    int max_leaf_size = 4);
+    /// \brief Builds the hierarchy over the triangles of \p mesh.
+    explicit TriangleMeshBVH(const TriangleMesh &mesh, int max_leaf_size = 4);
+
+public:
+    /// Returns `true` if the hierarchy has no triangles.
+    bool IsEmpty() const { return triangle_indices_.empty(); }
+
+    /// \brief Calls \p f with the index of every triangle whose bounding box
+    /// overlaps or touches the box from \p min_bound to \p max_bound.
+    template <typename F>
+    void ForEachOverlappingTriangle(const Eigen::Vector3d &min_bound,
+                                    const Eigen::Vector3d &max_bound,
+                                    F f) const {
+        ForEachOverlappingSortedTriangle(
+                min_bound, max_bound, [&](int i) { f(triangle_indices_[i]); });
+    }
+
+    /// \brief Returns the indices of the triangles that intersect the box with
+    /// center \p box_center and half size \p box_half_size, in ascending
+    /// order.
+    std::vector<int> GetTrianglesIntersectingAABB(
+            const Eigen::Vector3d &box_center,
+            const Eigen::Vector3d &box_half_size) const;
+
+    /// \brief Computes the point on the triangles closest to \p point.
+    ///
+    /// \param point Query point.
+    /// \param closest_point Returns the closest point.
+    /// \return The index of the triangle of the closest point, or -1 if the
+    /// hierarchy is empty.
+    int ComputeClosestPoint(const Eigen::Vector3d &point,
+                            Eigen::Vector3d &closest_point) const;
+
+    /// \brief Computes the distance of every point to the closest triangle, in
+    /// parallel. The distances are infinite if the hierarchy is empty.
+    std::vector<double> ComputeDistance(
+            const std::vector<Eigen::Vector3d> &points) const;
+
+    /// Returns the point on triangle (\p p0, \p p1, \p p2) closest to \p point.
+    static Eigen::Vector3d ClosestPointOnTriangle(const Eigen::Vector3d &point,
+                                                  const Eigen::Vector3d &p0,
+                                                  const Eigen::Vector3d &p1,
+                                                  const Eigen::Vector3d &p2);
+
+protected:
+    /// Calls \p f with the position of every overlapping triangle in the
+    /// sorted triangle arrays.
+    template <typename F>
+    void ForEachOverlappingSortedTriangle(const Eigen::Vector3d &min_bound,
+                                          const Eigen::Vector3d &max_bound,
+                                          F f) const {
+        if (IsEmpty()) {
+            return;
+        }
+        std::vector<int> stack(1, 0);
+        while (!stack.empty()) {
+            int node_idx = stack.back();
+            stack.pop_back();
+            const Node &node = nodes_[node_idx];
+            if (!BoxesOverlap(node.min_bound_, node.max_bound_, min_bound,
+                              max_bound)) {
+                continue;
+            }
+            if (!node.IsLeaf()) {
+                stack.push_back(node.right_child_);
+                stack.push_back(node_idx + 1);
+                continue;
+            }
+            for (int i = node.begin_; i < node.end_; ++i) {
+                if (BoxesOverlap(triangle_min_bounds_[i],
+                                 triangle_max_bounds_[i], min_bound,
+                                 max_bound)) {
+                    f(i);
+                }
+            }
+        }
+    }
+
+    static bool BoxesOverlap(const Eigen::Vector3d &min0,
+                             const Eigen::Vector3d &max0,
+                             const Eigen::Vector3d &min1,
+                             const Eigen::Vector3d &max1) {
+        return (min0.array() <= max1.array()).all() &&
+               (min1.array() <= max0.array()).all();
+    }
+
+public:
+    /// Nodes in depth first order, the root first.
+    std::vector<Node> nodes_;
+    /// Original indices of the sorted triangles.
+    std::vector<int> triangle_indices_;
+    /// Lower bounds of the sorted triangles.
+    std::vector<Eigen::Vector3d> triangle_min_bounds_;
+    /// Upper bounds of the sorted triangles.
+    std::vector<Eigen::Vector3d> triangle_max_bounds_;
+    /// The vertices of sorted triangle i are triangle_vertices_[3 * i] to
+    /// triangle_vertices_[3 * i + 2].
+    std::vector<Eigen::Vector3d> triangle_vertices_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
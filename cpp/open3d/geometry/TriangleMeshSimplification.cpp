@@ -24,7 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
 #include <queue>
 #include <tuple>
 
@@ -88,6 +93,35 @@ public:
     double c_;
 };
 
+/// Computes the position vbar that minimizes the error of collapsing the edge
+/// (v0, v1) with quadrics Q0 and Q1, and returns the error at vbar.
+static double ComputeEdgeCollapse(const Quadric& Q0,
+                                  const Quadric& Q1,
+                                  const Eigen::Vector3d& v0,
+                                  const Eigen::Vector3d& v1,
+                                  Eigen::Vector3d& vbar) {
+    Quadric Qbar = Q0 + Q1;
+    double cost;
+    if (Qbar.IsInvertible()) {
+        vbar = Qbar.Minimum();
+        cost = Qbar.Eval(vbar);
+    } else {
+        Eigen::Vector3d vmid = (v0 + v1) / 2;
+        double cost0 = Qbar.Eval(v0);
+        double cost1 = Qbar.Eval(v1);
+        double costmid = Qbar.Eval(vmid);
+        cost = std::min(cost0, std::min(cost1, costmid));
+        if (cost == costmid) {
+            vbar = vmid;
+        } else if (cost == cost0) {
+            vbar = v0;
+        } else {
+            vbar = v1;
+        }
+    }
+    return cost;
+}
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyVertexClustering(
         double voxel_size,
         SimplificationContraction
@@ -349,30 +383,10 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
         int max = std::max(vidx0, vidx1);
         Eigen::Vector2i edge(min, max);
         if (update || vbars.count(edge) == 0) {
-            const Quadric& Q0 = Qs[min];
-            const Quadric& Q1 = Qs[max];
-            Quadric Qbar = Q0 + Q1;
-            double cost;
             Eigen::Vector3d vbar;
-            if (Qbar.IsInvertible()) {
-                vbar = Qbar.Minimum();
-                cost = Qbar.Eval(vbar);
-            } else {
-                const Eigen::Vector3d& v0 = mesh->vertices_[vidx0];
-                const Eigen::Vector3d& v1 = mesh->vertices_[vidx1];
-                Eigen::Vector3d vmid = (v0 + v1) / 2;
-                double cost0 = Qbar.Eval(v0);
-                double cost1 = Qbar.Eval(v1);
-                double costmid = Qbar.Eval(vmid);
-                cost = std::min(cost0, std::min(cost1, costmid));
-                if (cost == costmid) {
-                    vbar = vmid;
-                } else if (cost == cost0) {
-                    vbar = v0;
-                } else {
-                    vbar = v1;
-                }
-            }
+            double cost = ComputeEdgeCollapse(Qs[min], Qs[max],
+                                              mesh->vertices_[vidx0],
+                                              mesh->vertices_[vidx1], vbar);
             vbars[edge] = vbar;
             costs[edge] = cost;
             queue.push(CostEdge(cost, min, max));
@@ -552,5 +566,462 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimation(
     return mesh;
 }
 
+/// Hashes an edge to a pseudo-random rank.
+static uint64_t HashEdge(const Eigen::Vector2i& edge) {
+    uint64_t h = (uint64_t(uint32_t(edge(0))) << 32) | uint32_t(edge(1));
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/// Lowers target to value if value is smaller.
+static void AtomicMin(std::atomic<int>& target, int value) {
+    int current = target.load(std::memory_order_relaxed);
+    while (value < current &&
+           !target.compare_exchange_weak(current, value,
+                                         std::memory_order_relaxed)) {
+    }
+}
+
+std::shared_ptr<TriangleMesh> TriangleMesh::SimplifyQuadricDecimationParallel(
+        int target_number_of_triangles,
+        double maximum_error /* = inf */,
+        double boundary_weight /* = 1.0 */) const {
+    if (HasTriangleUvs()) {
+        utility::LogWarning(
+                "[SimplifyQuadricDecimationParallel] This mesh contains "
+                "triangle uvs that are not handled in this function");
+    }
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = vertices_;
+    mesh->vertex_normals_ = vertex_normals_;
+    mesh->vertex_colors_ = vertex_colors_;
+    mesh->triangles_ = triangles_;
+    const int num_vertices = int(vertices_.size());
+    const int num_triangles = int(triangles_.size());
+
+    // Bytes instead of std::vector<bool>, as they are written concurrently.
+    std::vector<uint8_t> vertices_deleted(num_vertices, 0);
+    std::vector<uint8_t> triangles_deleted(num_triangles, 0);
+
+    // Vertex to triangle adjacency of the remaining triangles in CSR format,
+    // rebuilt after every round.
+    std::vector<int> alive_triangles(num_triangles);
+    std::iota(alive_triangles.begin(), alive_triangles.end(), 0);
+    std::vector<int> vert_to_triangles_offsets(num_vertices + 1);
+    std::vector<int> vert_to_triangles;
+    std::vector<std::atomic<int>> vertex_counters(num_vertices);
+    auto BuildVertexToTriangles = [&]() {
+#pragma omp parallel for schedule(static)
+        for (int vidx = 0; vidx < num_vertices; ++vidx) {
+            vertex_counters[vidx].store(0, std::memory_order_relaxed);
+        }
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < int(alive_triangles.size()); ++i) {
+            const Eigen::Vector3i& tria = mesh->triangles_[alive_triangles[i]];
+            for (int k = 0; k < 3; ++k) {
+                vertex_counters[tria(k)].fetch_add(1,
+                                                   std::memory_order_relaxed);
+            }
+        }
+        vert_to_triangles_offsets[0] = 0;
+        for (int vidx = 0; vidx < num_vertices; ++vidx) {
+            vert_to_triangles_offsets[vidx + 1] =
+                    vert_to_triangles_offsets[vidx] +
+                    vertex_counters[vidx].load(std::memory_order_relaxed);
+            vertex_counters[vidx].store(vert_to_triangles_offsets[vidx],
+                                        std::memory_order_relaxed);
+        }
+        vert_to_triangles.resize(vert_to_triangles_offsets[num_vertices]);
+#pragma omp parallel for schedule(static)
+        for (int i = 0; i < int(alive_triangles.size()); ++i) {
+            const int tidx = alive_triangles[i];
+            const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+            for (int k = 0; k < 3; ++k) {
+                vert_to_triangles[vertex_counters[tria(k)].fetch_add(
+                        1, std::memory_order_relaxed)] = tidx;
+            }
+        }
+    };
+    BuildVertexToTriangles();
+
+    // Compute the error metric per vertex
+    std::vector<Quadric> Qs(num_vertices);
+#pragma omp parallel for schedule(static)
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        for (int i = vert_to_triangles_offsets[vidx];
+             i < vert_to_triangles_offsets[vidx + 1]; ++i) {
+            const int tidx = vert_to_triangles[i];
+            Qs[vidx] += Quadric(GetTrianglePlane(tidx), GetTriangleArea(tidx));
+        }
+    }
+
+    // For boundary edges add perpendicular plane quadric. An edge (vidx0,
+    // vidx1) of a triangle is a boundary edge if no other triangle of vidx0
+    // contains vidx1.
+    auto IsBoundaryEdge = [&](int vidx0, int vidx1) {
+        int count = 0;
+        for (int i = vert_to_triangles_offsets[vidx0];
+             i < vert_to_triangles_offsets[vidx0 + 1]; ++i) {
+            const Eigen::Vector3i& tria =
+                    mesh->triangles_[vert_to_triangles[i]];
+            if (tria(0) == vidx1 || tria(1) == vidx1 || tria(2) == vidx1) {
+                ++count;
+            }
+        }
+        return count == 1;
+    };
+    std::vector<std::tuple<int, int, int, double>> boundary_edges;
+#pragma omp parallel
+    {
+        std::vector<std::tuple<int, int, int, double>> boundary_edges_local;
+#pragma omp for nowait schedule(static)
+        for (int tidx = 0; tidx < num_triangles; ++tidx) {
+            const Eigen::Vector3i& tria = triangles_[tidx];
+            for (int k = 0; k < 3; ++k) {
+                if (IsBoundaryEdge(tria(k), tria((k + 1) % 3))) {
+                    boundary_edges_local.emplace_back(
+                            tria(k), tria((k + 1) % 3), tria((k + 2) % 3),
+                            GetTriangleArea(tidx));
+                }
+            }
+        }
+#pragma omp critical(SimplifyQuadricDecimationParallel)
+        boundary_edges.insert(boundary_edges.end(),
+                              boundary_edges_local.begin(),
+                              boundary_edges_local.end());
+    }
+    // Sorted so that the quadrics are summed up in a deterministic order.
+    std::sort(boundary_edges.begin(), boundary_edges.end());
+    for (const auto& boundary_edge : boundary_edges) {
+        int vidx0, vidx1, vidx2;
+        double area;
+        std::tie(vidx0, vidx1, vidx2, area) = boundary_edge;
+        const auto& vert0 = mesh->vertices_[vidx0];
+        const auto& vert1 = mesh->vertices_[vidx1];
+        const auto& vert2 = mesh->vertices_[vidx2];
+        Eigen::Vector3d vert2p = (vert2 - vert0).cross(vert2 - vert1);
+        Eigen::Vector4d plane = ComputeTrianglePlane(vert0, vert1, vert2p);
+        Quadric quad(plane, area * boundary_weight);
+        Qs[vidx0] += quad;
+        Qs[vidx1] += quad;
+    }
+
+    // Returns true if collapsing vidx1 into vidx0 at vbar flips the normal of
+    // a triangle of vidx1.
+    auto IsFlipped = [&](int vidx0, int vidx1, const Eigen::Vector3d& vbar) {
+        for (int i = vert_to_triangles_offsets[vidx1];
+             i < vert_to_triangles_offsets[vidx1 + 1]; ++i) {
+            const Eigen::Vector3i& tria =
+                    mesh->triangles_[vert_to_triangles[i]];
+            if (vidx0 == tria(0) || vidx0 == tria(1) || vidx0 == tria(2)) {
+                continue;
+            }
+            Eigen::Vector3d vert0 = mesh->vertices_[tria(0)];
+            Eigen::Vector3d vert1 = mesh->vertices_[tria(1)];
+            Eigen::Vector3d vert2 = mesh->vertices_[tria(2)];
+            Eigen::Vector3d norm_before = (vert1 - vert0).cross(vert2 - vert0);
+            norm_before /= norm_before.norm();
+            if (vidx1 == tria(0)) {
+                vert0 = vbar;
+            } else if (vidx1 == tria(1)) {
+                vert1 = vbar;
+            } else {
+                vert2 = vbar;
+            }
+            Eigen::Vector3d norm_after = (vert1 - vert0).cross(vert2 - vert0);
+            norm_after /= norm_after.norm();
+            if (norm_before.dot(norm_after) < 0) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Calls f(tidx) for every remaining triangle of vidx0 or vidx1.
+    auto ForEachEdgeTriangle = [&](int vidx0, int vidx1, auto f) {
+        for (int vidx : {vidx0, vidx1}) {
+            for (int i = vert_to_triangles_offsets[vidx];
+                 i < vert_to_triangles_offsets[vidx + 1]; ++i) {
+                f(vert_to_triangles[i]);
+            }
+        }
+    };
+
+    // Collects the sorted neighbors of vidx with a larger index.
+    auto CollectNeighbors = [&](int vidx, std::vector<int>& neighbors) {
+        neighbors.clear();
+        for (int i = vert_to_triangles_offsets[vidx];
+             i < vert_to_triangles_offsets[vidx + 1]; ++i) {
+            const Eigen::Vector3i& tria =
+                    mesh->triangles_[vert_to_triangles[i]];
+            for (int k = 0; k < 3; ++k) {
+                if (tria(k) > vidx) {
+                    neighbors.push_back(tria(k));
+                }
+            }
+        }
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                        neighbors.end());
+    };
+
+    // Every round collapses a maximal independent set of the cheapest edges.
+    // An edge is collapsed if it has the lowest rank among all candidate
+    // edges that share a vertex with its triangles, so that the collapses
+    // touch disjoint triangles and run concurrently. Candidates next to a
+    // collapse wait for the next round, the others compete again.
+    bool has_vert_normal = HasVertexNormals();
+    bool has_vert_color = HasVertexColors();
+    int n_triangles = num_triangles;
+    std::vector<int> edge_offsets(num_vertices + 1);
+    std::vector<Eigen::Vector2i> edges;
+    std::vector<Eigen::Vector3d> vbars;
+    std::vector<double> costs;
+    std::vector<std::atomic<int>> claims(num_vertices);
+    std::vector<int> vertices_changed(num_vertices, 0);
+    int round = 0;
+    while (n_triangles > target_number_of_triangles) {
+        // Collect the unique edges (vidx0, vidx1) with vidx0 < vidx1.
+#pragma omp parallel
+        {
+            std::vector<int> neighbors;
+#pragma omp for schedule(static)
+            for (int vidx = 0; vidx < num_vertices; ++vidx) {
+                CollectNeighbors(vidx, neighbors);
+                edge_offsets[vidx + 1] = int(neighbors.size());
+            }
+        }
+        edge_offsets[0] = 0;
+        std::partial_sum(edge_offsets.begin(), edge_offsets.end(),
+                         edge_offsets.begin());
+        const int num_edges = edge_offsets[num_vertices];
+        edges.resize(num_edges);
+        vbars.resize(num_edges);
+        costs.resize(num_edges);
+#pragma omp parallel
+        {
+            std::vector<int> neighbors;
+#pragma omp for schedule(static)
+            for (int vidx = 0; vidx < num_vertices; ++vidx) {
+                CollectNeighbors(vidx, neighbors);
+                for (size_t j = 0; j < neighbors.size(); ++j) {
+                    edges[edge_offsets[vidx] + j] =
+                            Eigen::Vector2i(vidx, neighbors[j]);
+                }
+            }
+        }
+
+        // Compute the cost of every edge, and keep the cheapest edges that do
+        // not flip triangles, at most as many as needed to reach the target.
+        std::vector<uint8_t> admissible(num_edges, 0);
+#pragma omp parallel for schedule(static)
+        for (int eidx = 0; eidx < num_edges; ++eidx) {
+            const int vidx0 = edges[eidx](0);
+            const int vidx1 = edges[eidx](1);
+            costs[eidx] = ComputeEdgeCollapse(
+                    Qs[vidx0], Qs[vidx1], mesh->vertices_[vidx0],
+                    mesh->vertices_[vidx1], vbars[eidx]);
+            admissible[eidx] = costs[eidx] <= maximum_error &&
+                               !IsFlipped(vidx0, vidx1, vbars[eidx]);
+        }
+        std::vector<int> candidates;
+        for (int eidx = 0; eidx < num_edges; ++eidx) {
+            if (admissible[eidx]) {
+                candidates.push_back(eidx);
+            }
+        }
+        if (candidates.empty()) {
+            break;
+        }
+        auto CostLess = [&](int eidx0, int eidx1) {
+            return std::make_pair(costs[eidx0], eidx0) <
+                   std::make_pair(costs[eidx1], eidx1);
+        };
+        // A collapse removes two triangles of a manifold edge.
+        const size_t num_needed = std::min(
+                size_t(n_triangles - target_number_of_triangles + 1) / 2,
+                std::max(size_t(num_edges) / 8, size_t(1)));
+        if (candidates.size() > num_needed) {
+            std::nth_element(candidates.begin(),
+                             candidates.begin() + num_needed, candidates.end(),
+                             CostLess);
+            candidates.resize(num_needed);
+        }
+        // The cheap edges are ranked randomly, as ranking them by cost lets
+        // collapses wait for each other along cost gradients.
+        auto RankLess = [&](int eidx0, int eidx1) {
+            return std::make_pair(HashEdge(edges[eidx0]), eidx0) <
+                   std::make_pair(HashEdge(edges[eidx1]), eidx1);
+        };
+        tbb::parallel_sort(candidates.begin(), candidates.end(), RankLess);
+
+        int n_deleted = 0;
+        ++round;
+        auto IsNextToChange = [&](int eidx) {
+            bool changed = false;
+            ForEachEdgeTriangle(edges[eidx](0), edges[eidx](1), [&](int tidx) {
+                const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                for (int k = 0; k < 3; ++k) {
+                    changed |= vertices_changed[tria(k)] == round;
+                }
+            });
+            return changed;
+        };
+        while (!candidates.empty()) {
+            // Claim the vertices of the triangles around every candidate edge
+            // with its rank.
+            const int num_candidates = int(candidates.size());
+#pragma omp parallel for schedule(static)
+            for (int rank = 0; rank < num_candidates; ++rank) {
+                const Eigen::Vector2i& edge = edges[candidates[rank]];
+                ForEachEdgeTriangle(edge(0), edge(1), [&](int tidx) {
+                    const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                    for (int k = 0; k < 3; ++k) {
+                        claims[tria(k)].store(num_candidates,
+                                              std::memory_order_relaxed);
+                    }
+                });
+            }
+#pragma omp parallel for schedule(static)
+            for (int rank = 0; rank < num_candidates; ++rank) {
+                const Eigen::Vector2i& edge = edges[candidates[rank]];
+                ForEachEdgeTriangle(edge(0), edge(1), [&](int tidx) {
+                    const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                    for (int k = 0; k < 3; ++k) {
+                        AtomicMin(claims[tria(k)], rank);
+                    }
+                });
+            }
+
+            // Collapse the edges that hold all their claims, and mark the
+            // vertices around them as changed in this round.
+#pragma omp parallel for schedule(static) reduction(+ : n_deleted)
+            for (int rank = 0; rank < num_candidates; ++rank) {
+                const int eidx = candidates[rank];
+                const int vidx0 = edges[eidx](0);
+                const int vidx1 = edges[eidx](1);
+                bool independent = true;
+                ForEachEdgeTriangle(vidx0, vidx1, [&](int tidx) {
+                    const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                    for (int k = 0; k < 3; ++k) {
+                        independent &= claims[tria(k)].load(
+                                               std::memory_order_relaxed) ==
+                                       rank;
+                    }
+                });
+                if (!independent) {
+                    continue;
+                }
+                ForEachEdgeTriangle(vidx0, vidx1, [&](int tidx) {
+                    const Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                    for (int k = 0; k < 3; ++k) {
+                        vertices_changed[tria(k)] = round;
+                    }
+                });
+
+                // Connect triangles from vidx1 to vidx0, or mark deleted
+                for (int i = vert_to_triangles_offsets[vidx1];
+                     i < vert_to_triangles_offsets[vidx1 + 1]; ++i) {
+                    const int tidx = vert_to_triangles[i];
+                    Eigen::Vector3i& tria = mesh->triangles_[tidx];
+                    if (vidx0 == tria(0) || vidx0 == tria(1) ||
+                        vidx0 == tria(2)) {
+                        triangles_deleted[tidx] = 1;
+                        n_deleted++;
+                        continue;
+                    }
+                    if (vidx1 == tria(0)) {
+                        tria(0) = vidx0;
+                    } else if (vidx1 == tria(1)) {
+                        tria(1) = vidx0;
+                    } else {
+                        tria(2) = vidx0;
+                    }
+                }
+
+                // update vertex vidx0 to vbar
+                mesh->vertices_[vidx0] = vbars[eidx];
+                Qs[vidx0] += Qs[vidx1];
+                if (has_vert_normal) {
+                    mesh->vertex_normals_[vidx0] =
+                            0.5 * (mesh->vertex_normals_[vidx0] +
+                                   mesh->vertex_normals_[vidx1]);
+                }
+                if (has_vert_color) {
+                    mesh->vertex_colors_[vidx0] =
+                            0.5 * (mesh->vertex_colors_[vidx0] +
+                                   mesh->vertex_colors_[vidx1]);
+                }
+                vertices_deleted[vidx1] = 1;
+            }
+
+            // Keep the candidates away from the collapsed edges. Their
+            // triangles, costs and flip tests are still valid.
+            candidates.erase(std::remove_if(candidates.begin(),
+                                            candidates.end(), IsNextToChange),
+                             candidates.end());
+        }
+        if (n_deleted == 0) {
+            break;
+        }
+        n_triangles -= n_deleted;
+
+        alive_triangles.erase(std::remove_if(alive_triangles.begin(),
+                                             alive_triangles.end(),
+                                             [&](int tidx) {
+                                                 return triangles_deleted[tidx];
+                                             }),
+                              alive_triangles.end());
+        BuildVertexToTriangles();
+    }
+
+    // Apply changes to the triangle mesh
+    std::vector<int> vert_remapping(num_vertices, -1);
+    int next_free = 0;
+    for (int idx = 0; idx < num_vertices; ++idx) {
+        if (!vertices_deleted[idx]) {
+            vert_remapping[idx] = next_free;
+            mesh->vertices_[next_free] = mesh->vertices_[idx];
+            if (has_vert_normal) {
+                mesh->vertex_normals_[next_free] = mesh->vertex_normals_[idx];
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[next_free] = mesh->vertex_colors_[idx];
+            }
+            next_free++;
+        }
+    }
+    mesh->vertices_.resize(next_free);
+    if (has_vert_normal) {
+        mesh->vertex_normals_.resize(next_free);
+    }
+    if (has_vert_color) {
+        mesh->vertex_colors_.resize(next_free);
+    }
+
+    next_free = 0;
+    for (int idx = 0; idx < num_triangles; ++idx) {
+        if (!triangles_deleted[idx]) {
+            const Eigen::Vector3i tria = mesh->triangles_[idx];
+            mesh->triangles_[next_free](0) = vert_remapping[tria(0)];
+            mesh->triangles_[next_free](1) = vert_remapping[tria(1)];
+            mesh->triangles_[next_free](2) = vert_remapping[tria(2)];
+            next_free++;
+        }
+    }
+    mesh->triangles_.resize(next_free);
+
+    if (HasTriangleNormals()) {
+        mesh->ComputeTriangleNormals();
+    }
+
+    return mesh;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -25,7 +25,6 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
-#include <queue>
 #include <tuple>
 
 #include "open3d/geometry/TriangleMesh.h"
@@ -34,6 +33,26 @@
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Numbers a new vertex per edge, starting at \p n_old_vertices, in the order
+/// in which the triangles reference the edges. Returns the number of vertices
+/// including the new ones.
+int NumberEdgeVertices(const TriangleMeshTopology& topology,
+                       int n_old_vertices,
+                       std::vector<int>& new_verts) {
+    new_verts.assign(topology.NumEdges(), -1);
+    int n_vertices = n_old_vertices;
+    for (int eidx : topology.triangle_edges_) {
+        if (new_verts[eidx] < 0) {
+            new_verts[eidx] = n_vertices++;
+        }
+    }
+    return n_vertices;
+}
+
+}  // namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
         int number_of_iterations) const {
     if (HasTriangleUvs()) {
@@ -46,53 +65,55 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
     mesh->vertex_colors_ = vertex_colors_;
     mesh->vertex_normals_ = vertex_normals_;
     mesh->triangles_ = triangles_;
+    mesh->topology_cache_ = std::atomic_load(&topology_cache_);
 
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
 
-    // Compute and return midpoint.
-    // Also adds edge - new vertex refrence to new_verts map.
-    auto SubdivideEdge =
-            [&](std::unordered_map<Eigen::Vector2i, int,
-                                   utility::hash_eigen<Eigen::Vector2i>>&
-                        new_verts,
-                int vidx0, int vidx1) {
-                int min = std::min(vidx0, vidx1);
-                int max = std::max(vidx0, vidx1);
-                Eigen::Vector2i edge(min, max);
-                if (new_verts.count(edge) == 0) {
-                    mesh->vertices_.push_back(0.5 * (mesh->vertices_[min] +
-                                                     mesh->vertices_[max]));
-                    if (has_vert_normal) {
-                        mesh->vertex_normals_.push_back(
-                                0.5 * (mesh->vertex_normals_[min] +
-                                       mesh->vertex_normals_[max]));
-                    }
-                    if (has_vert_color) {
-                        mesh->vertex_colors_.push_back(
-                                0.5 * (mesh->vertex_colors_[min] +
-                                       mesh->vertex_colors_[max]));
-                    }
-                    int vidx01 = int(mesh->vertices_.size()) - 1;
-                    new_verts[edge] = vidx01;
-                    return vidx01;
-                } else {
-                    return new_verts[edge];
-                }
-            };
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        std::unordered_map<Eigen::Vector2i, int,
-                           utility::hash_eigen<Eigen::Vector2i>>
-                new_verts;
+        auto topology = mesh->GetTopology();
+        std::vector<int> new_verts;
+        int n_old_vertices = int(mesh->vertices_.size());
+        int n_new_vertices = NumberEdgeVertices(*topology, n_old_vertices,
+                                                new_verts);
+        mesh->vertices_.resize(n_new_vertices);
+        if (has_vert_normal) {
+            mesh->vertex_normals_.resize(n_new_vertices);
+        }
+        if (has_vert_color) {
+            mesh->vertex_colors_.resize(n_new_vertices);
+        }
+
+        // Add a midpoint per edge.
+#pragma omp parallel for schedule(static)
+        for (int eidx = 0; eidx < topology->NumEdges(); ++eidx) {
+            int min = topology->edges_[eidx](0);
+            int max = topology->edges_[eidx](1);
+            int vidx01 = new_verts[eidx];
+            mesh->vertices_[vidx01] =
+                    0.5 * (mesh->vertices_[min] + mesh->vertices_[max]);
+            if (has_vert_normal) {
+                mesh->vertex_normals_[vidx01] =
+                        0.5 * (mesh->vertex_normals_[min] +
+                               mesh->vertex_normals_[max]);
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[vidx01] =
+                        0.5 * (mesh->vertex_colors_[min] +
+                               mesh->vertex_colors_[max]);
+            }
+        }
+
         std::vector<Eigen::Vector3i> new_triangles(4 * mesh->triangles_.size());
-        for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
+#pragma omp parallel for schedule(static)
+        for (int tidx = 0; tidx < int(mesh->triangles_.size()); ++tidx) {
             const auto& triangle = mesh->triangles_[tidx];
             int vidx0 = triangle(0);
             int vidx1 = triangle(1);
             int vidx2 = triangle(2);
-            int vidx01 = SubdivideEdge(new_verts, vidx0, vidx1);
-            int vidx12 = SubdivideEdge(new_verts, vidx1, vidx2);
-            int vidx20 = SubdivideEdge(new_verts, vidx2, vidx0);
+            int vidx01 = new_verts[topology->triangle_edges_[3 * tidx + 0]];
+            int vidx12 = new_verts[topology->triangle_edges_[3 * tidx + 1]];
+            int vidx20 = new_verts[topology->triangle_edges_[3 * tidx + 2]];
             new_triangles[tidx * 4 + 0] =
                     Eigen::Vector3i(vidx0, vidx01, vidx20);
             new_triangles[tidx * 4 + 1] =
@@ -104,6 +125,7 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
         }
         mesh->triangles_ = new_triangles;
     }
+    mesh->topology_cache_.reset();
 
     if (HasTriangleNormals()) {
         mesh->ComputeTriangleNormals();
@@ -119,48 +141,40 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                 "[SubdivideLoop] This mesh contains triangle uvs that are not "
                 "handled in this function");
     }
-    typedef std::unordered_map<Eigen::Vector2i, int,
-                               utility::hash_eigen<Eigen::Vector2i>>
-            EdgeNewVertMap;
-    typedef std::unordered_map<Eigen::Vector2i, std::unordered_set<int>,
-                               utility::hash_eigen<Eigen::Vector2i>>
-            EdgeTrianglesMap;
-    typedef std::vector<std::unordered_set<int>> VertexNeighbours;
 
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
 
+    // Returns true if the vertex has more than two boundary neighbours.
     auto UpdateVertex = [&](int vidx,
                             const std::shared_ptr<TriangleMesh>& old_mesh,
                             std::shared_ptr<TriangleMesh>& new_mesh,
-                            const std::unordered_set<int>& nbs,
-                            const EdgeTrianglesMap& edge_to_triangles) {
+                            const TriangleMeshTopology& topology) {
+        const int* nbs_begin =
+                topology.neighbors_.data() + topology.neighbor_offsets_[vidx];
+        const int* nbs_end = topology.neighbors_.data() +
+                             topology.neighbor_offsets_[vidx + 1];
+        size_t n_nbs = nbs_end - nbs_begin;
+
         // check if boundary edge and get nb vertices in that case
-        std::unordered_set<int> boundary_nbs;
-        for (int nb : nbs) {
-            const Eigen::Vector2i edge = GetOrderedEdge(vidx, nb);
-            if (edge_to_triangles.at(edge).size() == 1) {
-                boundary_nbs.insert(nb);
+        std::vector<int> boundary_nbs;
+        for (const int* nb = nbs_begin; nb != nbs_end; ++nb) {
+            int eidx = topology.GetEdgeIndex(vidx, *nb);
+            if (topology.NumEdgeTriangles(eidx) == 1) {
+                boundary_nbs.push_back(*nb);
             }
         }
 
-        // in manifold meshes this should not happen
-        if (boundary_nbs.size() > 2) {
-            utility::LogWarning(
-                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
-                    "mesh is not manifold.");
-        }
-
         double beta, alpha;
         if (boundary_nbs.size() >= 2) {
             beta = 1. / 8.;
             alpha = 1. - boundary_nbs.size() * beta;
-        } else if (nbs.size() == 3) {
+        } else if (n_nbs == 3) {
             beta = 3. / 16.;
-            alpha = 1. - nbs.size() * beta;
+            alpha = 1. - n_nbs * beta;
         } else {
-            beta = 3. / (8. * nbs.size());
-            alpha = 1. - nbs.size() * beta;
+            beta = 3. / (8. * n_nbs);
+            alpha = 1. - n_nbs * beta;
         }
 
         new_mesh->vertices_[vidx] = alpha * old_mesh->vertices_[vidx];
@@ -189,137 +203,102 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
                 Update(nb);
             }
         } else {
-            for (int nb : nbs) {
-                Update(nb);
+            for (const int* nb = nbs_begin; nb != nbs_end; ++nb) {
+                Update(*nb);
             }
         }
+
+        // in manifold meshes this should not happen
+        return boundary_nbs.size() > 2;
     };
 
-    auto SubdivideEdge = [&](int vidx0, int vidx1,
+    auto SubdivideEdge = [&](int eidx, int vidx01,
                              const std::shared_ptr<TriangleMesh>& old_mesh,
                              std::shared_ptr<TriangleMesh>& new_mesh,
-                             EdgeNewVertMap& new_verts,
-                             const EdgeTrianglesMap& edge_to_triangles) {
-        Eigen::Vector2i edge = GetOrderedEdge(vidx0, vidx1);
-        if (new_verts.count(edge) == 0) {
-            Eigen::Vector3d new_vert =
-                    old_mesh->vertices_[vidx0] + old_mesh->vertices_[vidx1];
-            Eigen::Vector3d new_normal;
+                             const TriangleMeshTopology& topology) {
+        int vidx0 = topology.edges_[eidx](0);
+        int vidx1 = topology.edges_[eidx](1);
+        Eigen::Vector3d new_vert =
+                old_mesh->vertices_[vidx0] + old_mesh->vertices_[vidx1];
+        Eigen::Vector3d new_normal;
+        if (has_vert_normal) {
+            new_normal = old_mesh->vertex_normals_[vidx0] +
+                         old_mesh->vertex_normals_[vidx1];
+        }
+        Eigen::Vector3d new_color;
+        if (has_vert_color) {
+            new_color = old_mesh->vertex_colors_[vidx0] +
+                        old_mesh->vertex_colors_[vidx1];
+        }
+
+        size_t n_adjacent_trias = topology.NumEdgeTriangles(eidx);
+        if (n_adjacent_trias < 2) {
+            new_vert *= 0.5;
             if (has_vert_normal) {
-                new_normal = old_mesh->vertex_normals_[vidx0] +
-                             old_mesh->vertex_normals_[vidx1];
+                new_normal *= 0.5;
             }
-            Eigen::Vector3d new_color;
             if (has_vert_color) {
-                new_color = old_mesh->vertex_colors_[vidx0] +
-                            old_mesh->vertex_colors_[vidx1];
+                new_color *= 0.5;
             }
-
-            const auto& edge_triangles = edge_to_triangles.at(edge);
-            if (edge_triangles.size() < 2) {
-                new_vert *= 0.5;
-                if (has_vert_normal) {
-                    new_normal *= 0.5;
-                }
-                if (has_vert_color) {
-                    new_color *= 0.5;
-                }
-            } else {
-                new_vert *= 3. / 8.;
-                if (has_vert_normal) {
-                    new_normal *= 3. / 8.;
-                }
-                if (has_vert_color) {
-                    new_color *= 3. / 8.;
-                }
-                size_t n_adjacent_trias = edge_triangles.size();
-                double scale = 1. / (4. * n_adjacent_trias);
-                for (int tidx : edge_triangles) {
-                    const auto& tria = old_mesh->triangles_[tidx];
-                    int vidx2 =
-                            (tria(0) != vidx0 && tria(0) != vidx1)
+        } else {
+            new_vert *= 3. / 8.;
+            if (has_vert_normal) {
+                new_normal *= 3. / 8.;
+            }
+            if (has_vert_color) {
+                new_color *= 3. / 8.;
+            }
+            double scale = 1. / (4. * n_adjacent_trias);
+            for (int i = topology.edge_triangle_offsets_[eidx];
+                 i < topology.edge_triangle_offsets_[eidx + 1]; ++i) {
+                const auto& tria =
+                        old_mesh->triangles_[topology.edge_triangles_[i]];
+                int vidx2 = (tria(0) != vidx0 && tria(0) != vidx1)
                                     ? tria(0)
                                     : ((tria(1) != vidx0 && tria(1) != vidx1)
                                                ? tria(1)
                                                : tria(2));
-                    new_vert += scale * old_mesh->vertices_[vidx2];
-                    if (has_vert_normal) {
-                        new_normal += scale * old_mesh->vertex_normals_[vidx2];
-                    }
-                    if (has_vert_color) {
-                        new_color += scale * old_mesh->vertex_colors_[vidx2];
-                    }
+                new_vert += scale * old_mesh->vertices_[vidx2];
+                if (has_vert_normal) {
+                    new_normal += scale * old_mesh->vertex_normals_[vidx2];
+                }
+                if (has_vert_color) {
+                    new_color += scale * old_mesh->vertex_colors_[vidx2];
                 }
             }
-
-            int vidx01 = int(old_mesh->vertices_.size() + new_verts.size());
-
-            new_mesh->vertices_[vidx01] = new_vert;
-            if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx01] = new_normal;
-            }
-            if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx01] = new_color;
-            }
-
-            new_verts[edge] = vidx01;
-            return vidx01;
-        } else {
-            int vidx01 = new_verts[edge];
-            return vidx01;
         }
-    };
-
-    auto InsertTriangle = [&](int tidx, int vidx0, int vidx1, int vidx2,
-                              std::shared_ptr<TriangleMesh>& mesh,
-                              EdgeTrianglesMap& edge_to_triangles,
-                              VertexNeighbours& vertex_neighbours) {
-        mesh->triangles_[tidx] = Eigen::Vector3i(vidx0, vidx1, vidx2);
-        edge_to_triangles[GetOrderedEdge(vidx0, vidx1)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx1, vidx2)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx2, vidx0)].insert(tidx);
-        vertex_neighbours[vidx0].insert(vidx1);
-        vertex_neighbours[vidx0].insert(vidx2);
-        vertex_neighbours[vidx1].insert(vidx0);
-        vertex_neighbours[vidx1].insert(vidx2);
-        vertex_neighbours[vidx2].insert(vidx0);
-        vertex_neighbours[vidx2].insert(vidx1);
-    };
 
-    EdgeTrianglesMap edge_to_triangles;
-    VertexNeighbours vertex_neighbours(vertices_.size());
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto& tria = triangles_[tidx];
-        Eigen::Vector2i e0 = GetOrderedEdge(tria(0), tria(1));
-        edge_to_triangles[e0].insert(int(tidx));
-        Eigen::Vector2i e1 = GetOrderedEdge(tria(1), tria(2));
-        edge_to_triangles[e1].insert(int(tidx));
-        Eigen::Vector2i e2 = GetOrderedEdge(tria(2), tria(0));
-        edge_to_triangles[e2].insert(int(tidx));
-
-        if (edge_to_triangles[e0].size() > 2 ||
-            edge_to_triangles[e1].size() > 2 ||
-            edge_to_triangles[e2].size() > 2) {
-            utility::LogWarning("[SubdivideLoop] non-manifold edge.");
+        new_mesh->vertices_[vidx01] = new_vert;
+        if (has_vert_normal) {
+            new_mesh->vertex_normals_[vidx01] = new_normal;
         }
-
-        vertex_neighbours[tria(0)].insert(tria(1));
-        vertex_neighbours[tria(0)].insert(tria(2));
-        vertex_neighbours[tria(1)].insert(tria(0));
-        vertex_neighbours[tria(1)].insert(tria(2));
-        vertex_neighbours[tria(2)].insert(tria(0));
-        vertex_neighbours[tria(2)].insert(tria(1));
-    }
+        if (has_vert_color) {
+            new_mesh->vertex_colors_[vidx01] = new_color;
+        }
+    };
 
     auto old_mesh = std::make_shared<TriangleMesh>();
     old_mesh->vertices_ = vertices_;
     old_mesh->vertex_colors_ = vertex_colors_;
     old_mesh->vertex_normals_ = vertex_normals_;
     old_mesh->triangles_ = triangles_;
+    old_mesh->topology_cache_ = std::atomic_load(&topology_cache_);
 
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        size_t n_new_vertices =
-                old_mesh->vertices_.size() + edge_to_triangles.size();
+        auto topology = old_mesh->GetTopology();
+        if (iter == 0) {
+            for (int eidx = 0; eidx < topology->NumEdges(); ++eidx) {
+                if (topology->NumEdgeTriangles(eidx) > 2) {
+                    utility::LogWarning("[SubdivideLoop] non-manifold edge.");
+                    break;
+                }
+            }
+        }
+
+        std::vector<int> new_verts;
+        int n_old_vertices = int(old_mesh->vertices_.size());
+        size_t n_new_vertices = NumberEdgeVertices(*topology, n_old_vertices,
+                                                   new_verts);
         size_t n_new_triangles = 4 * old_mesh->triangles_.size();
         auto new_mesh = std::make_shared<TriangleMesh>();
         new_mesh->vertices_.resize(n_new_vertices);
@@ -331,42 +310,49 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
         }
         new_mesh->triangles_.resize(n_new_triangles);
 
-        EdgeNewVertMap new_verts;
-        EdgeTrianglesMap new_edge_to_triangles;
-        VertexNeighbours new_vertex_neighbours(n_new_vertices);
+        int n_non_manifold_vertices = 0;
+#pragma omp parallel for reduction(+ : n_non_manifold_vertices) \
+        schedule(static)
+        for (int vidx = 0; vidx < n_old_vertices; ++vidx) {
+            if (UpdateVertex(vidx, old_mesh, new_mesh, *topology)) {
+                n_non_manifold_vertices++;
+            }
+        }
+        if (n_non_manifold_vertices > 0) {
+            utility::LogWarning(
+                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
+                    "mesh is not manifold.");
+        }
 
-        for (size_t vidx = 0; vidx < old_mesh->vertices_.size(); ++vidx) {
-            UpdateVertex(int(vidx), old_mesh, new_mesh, vertex_neighbours[vidx],
-                         edge_to_triangles);
+#pragma omp parallel for schedule(static)
+        for (int eidx = 0; eidx < topology->NumEdges(); ++eidx) {
+            SubdivideEdge(eidx, new_verts[eidx], old_mesh, new_mesh,
+                          *topology);
         }
 
-        for (size_t tidx = 0; tidx < old_mesh->triangles_.size(); ++tidx) {
+#pragma omp parallel for schedule(static)
+        for (int tidx = 0; tidx < int(old_mesh->triangles_.size()); ++tidx) {
             const auto& triangle = old_mesh->triangles_[tidx];
             int vidx0 = triangle(0);
             int vidx1 = triangle(1);
             int vidx2 = triangle(2);
+            int vidx01 = new_verts[topology->triangle_edges_[3 * tidx + 0]];
+            int vidx12 = new_verts[topology->triangle_edges_[3 * tidx + 1]];
+            int vidx20 = new_verts[topology->triangle_edges_[3 * tidx + 2]];
 
-            int vidx01 = SubdivideEdge(vidx0, vidx1, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx12 = SubdivideEdge(vidx1, vidx2, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx20 = SubdivideEdge(vidx2, vidx0, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-
-            InsertTriangle(int(tidx) * 4 + 0, vidx0, vidx01, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 1, vidx01, vidx1, vidx12, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 2, vidx12, vidx2, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 3, vidx01, vidx12, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
+            new_mesh->triangles_[tidx * 4 + 0] =
+                    Eigen::Vector3i(vidx0, vidx01, vidx20);
+            new_mesh->triangles_[tidx * 4 + 1] =
+                    Eigen::Vector3i(vidx01, vidx1, vidx12);
+            new_mesh->triangles_[tidx * 4 + 2] =
+                    Eigen::Vector3i(vidx12, vidx2, vidx20);
+            new_mesh->triangles_[tidx * 4 + 3] =
+                    Eigen::Vector3i(vidx01, vidx12, vidx20);
         }
 
         old_mesh = std::move(new_mesh);
-        edge_to_triangles = std::move(new_edge_to_triangles);
-        vertex_neighbours = std::move(new_vertex_neighbours);
     }
+    old_mesh->topology_cache_.reset();
 
     if (HasTriangleNormals()) {
         old_mesh->ComputeTriangleNormals();
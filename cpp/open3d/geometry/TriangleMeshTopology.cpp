@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshTopology.h"
+
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+namespace open3d {
+namespace geometry {
+
+TriangleMeshTopology::TriangleMeshTopology(
+        const std::vector<Eigen::Vector3i> &triangles, int num_vertices) {
+    // Cover vertex indices beyond num_vertices, so that invalid triangles do
+    // not access the offsets out of bounds.
+    int max_vidx = num_vertices - 1;
+#pragma omp parallel
+    {
+        int local_max_vidx = max_vidx;
+#pragma omp for schedule(static)
+        for (int tidx = 0; tidx < int(triangles.size()); ++tidx) {
+            local_max_vidx =
+                    std::max(local_max_vidx, triangles[tidx].maxCoeff());
+        }
+#pragma omp critical
+        { max_vidx = std::max(max_vidx, local_max_vidx); }
+    }
+    num_vertices = max_vidx + 1;
+
+    // Sort the half edges by their ordered edge, and then by triangle.
+    const int num_half_edges = 3 * int(triangles.size());
+    std::vector<std::pair<uint64_t, int>> half_edges(num_half_edges);
+#pragma omp parallel for schedule(static)
+    for (int tidx = 0; tidx < int(triangles.size()); ++tidx) {
+        const Eigen::Vector3i &triangle = triangles[tidx];
+        for (int k = 0; k < 3; ++k) {
+            int vidx0 = std::min(triangle(k), triangle((k + 1) % 3));
+            int vidx1 = std::max(triangle(k), triangle((k + 1) % 3));
+            uint64_t key = (uint64_t(uint32_t(vidx0)) << 32) | uint32_t(vidx1);
+            half_edges[3 * tidx + k] = std::make_pair(key, 3 * tidx + k);
+        }
+    }
+    tbb::parallel_sort(half_edges.begin(), half_edges.end());
+
+    // Number the unique edges.
+    triangle_edges_.resize(num_half_edges);
+    edge_triangles_.resize(num_half_edges);
+    edge_triangle_offsets_.clear();
+    edges_.clear();
+    for (int i = 0; i < num_half_edges; ++i) {
+        if (i == 0 || half_edges[i].first != half_edges[i - 1].first) {
+            edge_triangle_offsets_.push_back(i);
+            edges_.emplace_back(int(half_edges[i].first >> 32),
+                                int(half_edges[i].first & 0xffffffff));
+        }
+        edge_triangles_[i] = half_edges[i].second / 3;
+        triangle_edges_[half_edges[i].second] = int(edges_.size()) - 1;
+    }
+    edge_triangle_offsets_.push_back(num_half_edges);
+
+    // The edges are sorted by their first vertex.
+    vertex_edge_offsets_.resize(num_vertices + 1);
+#pragma omp parallel for schedule(static)
+    for (int vidx = 0; vidx <= num_vertices; ++vidx) {
+        vertex_edge_offsets_[vidx] = int(
+                std::lower_bound(edges_.begin(), edges_.end(), vidx,
+                                 [](const Eigen::Vector2i &edge, int v) {
+                                     return edge(0) < v;
+                                 }) -
+                edges_.begin());
+    }
+
+    // Every vertex is first adjacent to the smaller vertices of the edges
+    // ending at it, met in ascending order when scanning the edges, and then
+    // to the larger vertices of its own edges. The edge of a degenerate
+    // triangle from a vertex to itself is counted once.
+    neighbor_offsets_.assign(num_vertices + 1, 0);
+    for (const Eigen::Vector2i &edge : edges_) {
+        if (edge(0) != edge(1)) {
+            neighbor_offsets_[edge(1) + 1]++;
+        }
+    }
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        neighbor_offsets_[vidx + 1] +=
+                neighbor_offsets_[vidx] + vertex_edge_offsets_[vidx + 1] -
+                vertex_edge_offsets_[vidx];
+    }
+    neighbors_.resize(neighbor_offsets_[num_vertices]);
+    std::vector<int> next_neighbor(neighbor_offsets_.begin(),
+                                   neighbor_offsets_.end() - 1);
+    for (const Eigen::Vector2i &edge : edges_) {
+        if (edge(0) != edge(1)) {
+            neighbors_[next_neighbor[edge(1)]++] = edge(0);
+        }
+    }
+#pragma omp parallel for schedule(static)
+    for (int vidx = 0; vidx < num_vertices; ++vidx) {
+        int nbidx = next_neighbor[vidx];
+        for (int eidx = vertex_edge_offsets_[vidx];
+             eidx < vertex_edge_offsets_[vidx + 1]; ++eidx) {
+            neighbors_[nbidx++] = edges_[eidx](1);
+        }
+    }
+}
+
+int TriangleMeshTopology::GetEdgeIndex(int vidx0, int vidx1) const {
+    if (vidx0 > vidx1) {
+        std::swap(vidx0, vidx1);
+    }
+    if (vidx0 < 0 || vidx0 + 1 >= int(vertex_edge_offsets_.size())) {
+        return -1;
+    }
+    auto begin = edges_.begin() + vertex_edge_offsets_[vidx0];
+    auto end = edges_.begin() + vertex_edge_offsets_[vidx0 + 1];
+    auto it = std::lower_bound(begin, end, vidx1,
+                               [](const Eigen::Vector2i &edge, int v) {
+                                   return edge(1) < v;
+                               });
+    if (it == end || (*it)(1) != vidx1) {
+        return -1;
+    }
+    return int(it - edges_.begin());
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,97 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \class TriangleMeshTopology
+///
+/// \brief Edge topology of a triangle mesh in compressed sparse row (CSR)
+/// format.
+///
+/// The topology is built in parallel by sorting the half edges of the
+/// triangles, and takes a few flat arrays instead of a hash map of vectors.
+/// TriangleMesh::GetTopology caches it until the triangles change.
+class TriangleMeshTopology {
+public:
+    /// \brief Default Constructor, creating the topology of an empty mesh.
+    TriangleMeshTopology() {}
+    /// \brief Builds the topology of the given triangles.
+    ///
+    /// \param triangles list of triangles.
+    /// \param num_vertices number of vertices the triangles index into.
+    TriangleMeshTopology(const std::vector<Eigen::Vector3i> &triangles,
+                         int num_vertices);
+
+public:
+    /// Returns the number of unique edges.
+    int NumEdges() const { return int(edges_.size()); }
+
+    /// Returns the number of triangles that contain edge \p eidx.
+    int NumEdgeTriangles(int eidx) const {
+        return edge_triangle_offsets_[eidx + 1] - edge_triangle_offsets_[eidx];
+    }
+
+    /// Returns the number of vertices adjacent to vertex \p vidx.
+    int NumNeighbors(int vidx) const {
+        return neighbor_offsets_[vidx + 1] - neighbor_offsets_[vidx];
+    }
+
+    /// Returns the index of the edge between \p vidx0 and \p vidx1, in either
+    /// order, or -1 if there is no such edge.
+    int GetEdgeIndex(int vidx0, int vidx1) const;
+
+public:
+    /// Unique edges (vidx0, vidx1) with vidx0 < vidx1, sorted
+    /// lexicographically.
+    std::vector<Eigen::Vector2i> edges_;
+    /// The triangles of edge e are edge_triangles_[edge_triangle_offsets_[e]]
+    /// to edge_triangles_[edge_triangle_offsets_[e + 1] - 1], in ascending
+    /// order.
+    std::vector<int> edge_triangle_offsets_;
+    /// Triangle indices of the edges, see edge_triangle_offsets_.
+    std::vector<int> edge_triangles_;
+    /// triangle_edges_[3 * t + k] is the index of the edge between vertex k and
+    /// vertex (k + 1) % 3 of triangle t.
+    std::vector<int> triangle_edges_;
+    /// The edges (v, w) of vertex v with v < w are
+    /// edges_[vertex_edge_offsets_[v]] to edges_[vertex_edge_offsets_[v + 1] -
+    /// 1].
+    std::vector<int> vertex_edge_offsets_;
+    /// The adjacent vertices of vertex v are neighbors_[neighbor_offsets_[v]]
+    /// to neighbors_[neighbor_offsets_[v + 1] - 1], in ascending order.
+    std::vector<int> neighbor_offsets_;
+    /// Adjacent vertex indices, see neighbor_offsets_.
+    std::vector<int> neighbors_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
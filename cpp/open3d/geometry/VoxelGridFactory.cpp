@@ -24,8 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <array>
 #include <numeric>
 #include <unordered_map>
+#include <utility>
 
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/PointCloud.h"
@@ -76,29 +81,54 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromPointCloudWithinBounds(
     }
     output->voxel_size_ = voxel_size;
     output->origin_ = min_bound;
-    std::unordered_map<Eigen::Vector3i, AvgColorVoxel,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
+    // Sorting the points by voxel lets every voxel average its colors
+    // independently, in increasing point order as a serial pass would.
+    const int num_points = int(input.points_.size());
+    std::vector<std::pair<std::array<int, 3>, int>> keys(num_points);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < num_points; i++) {
+        Eigen::Vector3i voxel_index = ((input.points_[i] - min_bound) /
+                                       voxel_size)
+                                              .array()
+                                              .floor()
+                                              .cast<int>();
+        keys[i] = std::make_pair(
+                std::array<int, 3>{voxel_index(0), voxel_index(1),
+                                   voxel_index(2)},
+                i);
+    }
+    tbb::parallel_sort(keys.begin(), keys.end());
+    std::vector<int> voxel_offsets;
+    for (int i = 0; i < num_points; i++) {
+        if (i == 0 || keys[i].first != keys[i - 1].first) {
+            voxel_offsets.push_back(i);
+        }
+    }
+    const int num_voxels = int(voxel_offsets.size());
+    voxel_offsets.push_back(num_points);
+
     bool has_colors = input.HasColors();
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        ref_coord = (input.points_[i] - min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        if (has_colors) {
-            voxelindex_to_accpoint[voxel_index].Add(voxel_index,
-                                                    input.colors_[i]);
-        } else {
-            voxelindex_to_accpoint[voxel_index].Add(voxel_index);
+    std::vector<Voxel> voxels(num_voxels);
+#pragma omp parallel for schedule(static)
+    for (int v = 0; v < num_voxels; v++) {
+        const std::array<int, 3> &key = keys[voxel_offsets[v]].first;
+        AvgColorVoxel accpoint;
+        for (int i = voxel_offsets[v]; i < voxel_offsets[v + 1]; i++) {
+            const Eigen::Vector3i voxel_index(key[0], key[1], key[2]);
+            if (has_colors) {
+                accpoint.Add(voxel_index, input.colors_[keys[i].second]);
+            } else {
+                accpoint.Add(voxel_index);
+            }
         }
+        const Eigen::Vector3d &color = has_colors
+                                               ? accpoint.GetAverageColor()
+                                               : Eigen::Vector3d(0, 0, 0);
+        voxels[v] = Voxel(accpoint.GetVoxelIndex(), color);
     }
-    for (auto accpoint : voxelindex_to_accpoint) {
-        const Eigen::Vector3i &grid_index = accpoint.second.GetVoxelIndex();
-        const Eigen::Vector3d &color =
-                has_colors ? accpoint.second.GetAverageColor()
-                           : Eigen::Vector3d(0, 0, 0);
-        output->AddVoxel(geometry::Voxel(grid_index, color));
+    output->voxels_.reserve(num_voxels);
+    for (const Voxel &voxel : voxels) {
+        output->AddVoxel(voxel);
     }
     utility::LogDebug(
             "Pointcloud is voxelized from {:d} points to {:d} voxels.",
@@ -138,25 +168,65 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromTriangleMeshWithinBounds(
     int num_d = int(std::round(grid_size(2) / voxel_size));
     const Eigen::Vector3d box_half_size(voxel_size / 2, voxel_size / 2,
                                         voxel_size / 2);
-    for (int widx = 0; widx < num_w; widx++) {
-        for (int hidx = 0; hidx < num_h; hidx++) {
-            for (int didx = 0; didx < num_d; didx++) {
-                const Eigen::Vector3d box_center =
-                        min_bound +
-                        Eigen::Vector3d(widx, hidx, didx) * voxel_size;
-                for (const Eigen::Vector3i &tria : input.triangles_) {
-                    const Eigen::Vector3d &v0 = input.vertices_[tria(0)];
-                    const Eigen::Vector3d &v1 = input.vertices_[tria(1)];
-                    const Eigen::Vector3d &v2 = input.vertices_[tria(2)];
-                    if (IntersectionTest::TriangleAABB(
-                                box_center, box_half_size, v0, v1, v2)) {
-                        Eigen::Vector3i grid_index(widx, hidx, didx);
-                        output->AddVoxel(geometry::Voxel(grid_index));
-                        break;
+    // Every triangle is tested against the voxels overlapping its bounding
+    // box only, and the occupied voxels are deduplicated by sorting.
+    const int num_triangles = int(input.triangles_.size());
+    std::vector<Eigen::Vector3i> grid_indices;
+#pragma omp parallel
+    {
+        std::vector<Eigen::Vector3i> local_grid_indices;
+#pragma omp for schedule(dynamic, 64)
+        for (int tidx = 0; tidx < num_triangles; tidx++) {
+            const Eigen::Vector3i &tria = input.triangles_[tidx];
+            const Eigen::Vector3d &v0 = input.vertices_[tria(0)];
+            const Eigen::Vector3d &v1 = input.vertices_[tria(1)];
+            const Eigen::Vector3d &v2 = input.vertices_[tria(2)];
+            // Voxel (widx, hidx, didx) is the box of half size voxel_size / 2
+            // around min_bound + (widx, hidx, didx) * voxel_size.
+            const Eigen::Vector3i lo =
+                    ((v0.cwiseMin(v1).cwiseMin(v2) - min_bound) / voxel_size)
+                            .array()
+                            .floor()
+                            .cast<int>()
+                            .max(0);
+            const Eigen::Vector3i hi =
+                    ((v0.cwiseMax(v1).cwiseMax(v2) - min_bound) / voxel_size)
+                            .array()
+                            .ceil()
+                            .cast<int>()
+                            .min(Eigen::Array3i(num_w - 1, num_h - 1,
+                                                num_d - 1));
+            for (int widx = lo(0); widx <= hi(0); widx++) {
+                for (int hidx = lo(1); hidx <= hi(1); hidx++) {
+                    for (int didx = lo(2); didx <= hi(2); didx++) {
+                        const Eigen::Vector3d box_center =
+                                min_bound + Eigen::Vector3d(widx, hidx, didx) *
+                                                    voxel_size;
+                        if (IntersectionTest::TriangleAABB(
+                                    box_center, box_half_size, v0, v1, v2)) {
+                            local_grid_indices.emplace_back(widx, hidx, didx);
+                        }
                     }
                 }
             }
         }
+#pragma omp critical
+        {
+            grid_indices.insert(grid_indices.end(), local_grid_indices.begin(),
+                                local_grid_indices.end());
+        }
+    }
+    tbb::parallel_sort(grid_indices.begin(), grid_indices.end(),
+                       [](const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+                           return std::lexicographical_compare(
+                                   a.data(), a.data() + 3, b.data(),
+                                   b.data() + 3);
+                       });
+    grid_indices.erase(std::unique(grid_indices.begin(), grid_indices.end()),
+                       grid_indices.end());
+    output->voxels_.reserve(grid_indices.size());
+    for (const Eigen::Vector3i &grid_index : grid_indices) {
+        output->AddVoxel(geometry::Voxel(grid_index));
     }
 
     return output;
@@ -54,6 +54,7 @@ static const std::unordered_map<
         std::function<bool(const std::string &,
                            camera::PinholeCameraTrajectory &)>>
         file_extension_to_trajectory_read_function{
+                {"bin", ReadPinholeCameraTrajectoryFromBIN},
                 {"log", ReadPinholeCameraTrajectoryFromLOG},
                 {"json", ReadPinholeCameraTrajectoryFromJSON},
                 {"txt", ReadPinholeCameraTrajectoryFromTUM},
@@ -64,6 +65,7 @@ static const std::unordered_map<
         std::function<bool(const std::string &,
                            const camera::PinholeCameraTrajectory &)>>
         file_extension_to_trajectory_write_function{
+                {"bin", WritePinholeCameraTrajectoryToBIN},
                 {"log", WritePinholeCameraTrajectoryToLOG},
                 {"json", WritePinholeCameraTrajectoryToJSON},
                 {"txt", WritePinholeCameraTrajectoryToTUM},
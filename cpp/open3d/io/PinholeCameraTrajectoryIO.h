@@ -68,5 +68,15 @@ bool WritePinholeCameraTrajectoryToTUM(
         const std::string &filename,
         const camera::PinholeCameraTrajectory &trajectory);
 
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory);
+
+/// Writes a trajectory as a header followed by fixed size records of the
+/// intrinsic and extrinsic parameters.
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory);
+
 }  // namespace io
 }  // namespace open3d
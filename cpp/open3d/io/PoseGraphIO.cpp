@@ -53,6 +53,7 @@ static const std::unordered_map<
         std::function<bool(const std::string &,
                            pipelines::registration::PoseGraph &)>>
         file_extension_to_pose_graph_read_function{
+                {"bin", ReadPoseGraphFromBIN},
                 {"json", ReadPoseGraphFromJSON},
         };
 
@@ -61,6 +62,7 @@ static const std::unordered_map<
         std::function<bool(const std::string &,
                            const pipelines::registration::PoseGraph &)>>
         file_extension_to_pose_graph_write_function{
+                {"bin", WritePoseGraphToBIN},
                 {"json", WritePoseGraphToJSON},
         };
 
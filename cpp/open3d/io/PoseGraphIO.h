@@ -51,5 +51,14 @@ bool ReadPoseGraph(const std::string &filename,
 bool WritePoseGraph(const std::string &filename,
                     const pipelines::registration::PoseGraph &pose_graph);
 
+/// Reads a PoseGraph from the binary format written by WritePoseGraphToBIN().
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          pipelines::registration::PoseGraph &pose_graph);
+
+/// Writes a PoseGraph as a header followed by the node poses and fixed size
+/// edge records, which is much faster to read than JSON.
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const pipelines::registration::PoseGraph &pose_graph);
+
 }  // namespace io
 }  // namespace open3d
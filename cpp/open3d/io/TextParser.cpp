@@ -0,0 +1,250 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/TextParser.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
+#include "open3d/core/NumpyIO.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+/// Chunks are at least this large, so that small files are parsed by a single
+/// thread.
+constexpr int64_t kMinChunkBytes = 1 << 20;
+
+/// Largest mantissa that is exactly representable by a double.
+constexpr uint64_t kMaxExactMantissa = uint64_t(1) << 53;
+
+/// Powers of ten that are exactly representable by a double.
+constexpr double kExactPowersOf10[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+inline bool IsSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' ||
+           c == '\f';
+}
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+const char *SkipSpaces(const char *ptr, const char *end) {
+    while (ptr && ptr < end && IsSpace(*ptr)) {
+        ++ptr;
+    }
+    return ptr;
+}
+
+/// Parses the decimal number at \p ptr if its value is the correctly rounded
+/// result of a single multiplication or division by an exact power of ten.
+/// Returns nullptr otherwise.
+const char *ParseExactDecimal(const char *ptr, const char *end, double &value) {
+    bool negative = false;
+    if (ptr < end && (*ptr == '+' || *ptr == '-')) {
+        negative = *ptr == '-';
+        ++ptr;
+    }
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int num_significant_digits = 0;
+    int exponent = 0;
+    for (; ptr < end && IsDigit(*ptr); ++ptr, ++num_digits) {
+        if (mantissa != 0 || *ptr != '0') {
+            if (++num_significant_digits > 19) {
+                return nullptr;
+            }
+        }
+        mantissa = mantissa * 10 + uint64_t(*ptr - '0');
+    }
+    if (ptr < end && *ptr == '.') {
+        for (++ptr; ptr < end && IsDigit(*ptr); ++ptr, ++num_digits) {
+            if (mantissa != 0 || *ptr != '0') {
+                if (++num_significant_digits > 19) {
+                    return nullptr;
+                }
+            }
+            mantissa = mantissa * 10 + uint64_t(*ptr - '0');
+            --exponent;
+        }
+    }
+    if (num_digits == 0) {
+        return nullptr;
+    }
+    if (ptr < end && (*ptr == 'e' || *ptr == 'E')) {
+        const char *exp_ptr = ptr + 1;
+        bool negative_exp = false;
+        if (exp_ptr < end && (*exp_ptr == '+' || *exp_ptr == '-')) {
+            negative_exp = *exp_ptr == '-';
+            ++exp_ptr;
+        }
+        // Without digits, the 'e' is not part of the number.
+        if (exp_ptr < end && IsDigit(*exp_ptr)) {
+            int exp_value = 0;
+            for (; exp_ptr < end && IsDigit(*exp_ptr); ++exp_ptr) {
+                if (exp_value > 1000) {
+                    return nullptr;
+                }
+                exp_value = exp_value * 10 + (*exp_ptr - '0');
+            }
+            exponent += negative_exp ? -exp_value : exp_value;
+            ptr = exp_ptr;
+        }
+    }
+    // Hexadecimal numbers, infinities and NaNs are left to strtod.
+    if (ptr < end && (std::isalpha(static_cast<unsigned char>(*ptr)) ||
+                      *ptr == '.')) {
+        return nullptr;
+    }
+    if (mantissa > kMaxExactMantissa || exponent < -22 || exponent > 22) {
+        if (mantissa != 0) {
+            return nullptr;
+        }
+        exponent = 0;
+    }
+    const double magnitude =
+            exponent < 0 ? double(mantissa) / kExactPowersOf10[-exponent]
+                         : double(mantissa) * kExactPowersOf10[exponent];
+    value = negative ? -magnitude : magnitude;
+    return ptr;
+}
+
+template <typename T>
+const char *ParseInteger(const char *ptr, const char *end, T &value) {
+    ptr = SkipSpaces(ptr, end);
+    if (!ptr) {
+        return nullptr;
+    }
+    bool negative = false;
+    if (ptr < end && (*ptr == '+' || *ptr == '-')) {
+        negative = *ptr == '-';
+        ++ptr;
+    }
+    if (ptr == end || !IsDigit(*ptr)) {
+        return nullptr;
+    }
+    T magnitude = 0;
+    for (; ptr < end && IsDigit(*ptr); ++ptr) {
+        magnitude = magnitude * 10 + T(*ptr - '0');
+    }
+    value = negative ? -magnitude : magnitude;
+    return ptr;
+}
+
+}  // namespace
+
+bool MappedTextFile::Open(const std::string &filename) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        return false;
+    }
+    size_ = file.GetFileSize();
+    file.Close();
+    if (size_ > 0) {
+        blob_ = core::MapFile(filename, 0, size_, /*copy_on_write=*/false);
+        begin_ = static_cast<const char *>(blob_->GetDataPtr());
+    } else {
+        blob_.reset();
+        begin_ = nullptr;
+    }
+    return true;
+}
+
+const char *ParseNumber(const char *ptr, const char *end, double &value) {
+    ptr = SkipSpaces(ptr, end);
+    if (!ptr || ptr == end) {
+        return nullptr;
+    }
+    const char *number_end = ParseExactDecimal(ptr, end, value);
+    if (number_end) {
+        return number_end;
+    }
+    // The mapped text is not null-terminated, strtod parses a copy of the
+    // token.
+    const char *token_end = ptr;
+    while (token_end < end && !IsSpace(*token_end)) {
+        ++token_end;
+    }
+    const std::string token(ptr, token_end);
+    char *strtod_end = nullptr;
+    value = std::strtod(token.c_str(), &strtod_end);
+    if (strtod_end == token.c_str()) {
+        return nullptr;
+    }
+    return ptr + (strtod_end - token.c_str());
+}
+
+const char *ParseNumber(const char *ptr, const char *end, int &value) {
+    return ParseInteger(ptr, end, value);
+}
+
+const char *ParseNumber(const char *ptr, const char *end, int64_t &value) {
+    return ParseInteger(ptr, end, value);
+}
+
+const char *FindLineEnd(const char *ptr, const char *end) {
+    if (ptr >= end) {
+        return end;
+    }
+    const void *line_end = std::memchr(ptr, '\n', end - ptr);
+    return line_end ? static_cast<const char *>(line_end) : end;
+}
+
+bool HasValues(const char *line, const char *line_end, int64_t num_values) {
+    int64_t count = 0;
+    bool in_value = false;
+    for (; line < line_end && count < num_values; ++line) {
+        const bool is_space = *line == ' ' || *line == '\t' || *line == '\r';
+        count += !in_value && !is_space;
+        in_value = !is_space;
+    }
+    return count >= num_values;
+}
+
+std::vector<const char *> SplitLines(const char *begin, const char *end) {
+    const int64_t size = end - begin;
+    const int64_t num_chunks = std::max<int64_t>(
+            1, std::min<int64_t>(size / kMinChunkBytes,
+                                 4 * core::kernel::GetMaxThreads()));
+    std::vector<const char *> bounds(num_chunks + 1, end);
+    bounds[0] = begin;
+    for (int64_t chunk = 1; chunk < num_chunks; ++chunk) {
+        const char *ptr = std::max(begin + size * chunk / num_chunks,
+                                   bounds[chunk - 1]);
+        const char *line_end = FindLineEnd(ptr, end);
+        bounds[chunk] = line_end == end ? end : line_end + 1;
+    }
+    return bounds;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Blob.h"
+
+namespace open3d {
+namespace io {
+
+/// Read-only text file mapped into memory, so that it can be split into
+/// chunks and parsed in parallel.
+class MappedTextFile {
+public:
+    /// Maps \p filename. Returns false if the file cannot be opened.
+    bool Open(const std::string &filename);
+
+    const char *Begin() const { return begin_; }
+    const char *End() const { return begin_ + size_; }
+    int64_t GetSize() const { return size_; }
+
+private:
+    std::shared_ptr<core::Blob> blob_;
+    const char *begin_ = nullptr;
+    int64_t size_ = 0;
+};
+
+/// Parses a number in [\p ptr, \p end) after skipping leading whitespace, as
+/// sscanf("%lf") would. Decimal numbers that are exactly representable by a
+/// single floating point operation are parsed directly, others are handed to
+/// strtod. Returns the pointer past the number or nullptr if there is none,
+/// also if \p ptr is nullptr so that calls can be chained.
+const char *ParseNumber(const char *ptr, const char *end, double &value);
+
+/// Parses a decimal integer in [\p ptr, \p end) after skipping leading
+/// whitespace, as sscanf("%d") would. Returns the pointer past the number or
+/// nullptr if there is none.
+const char *ParseNumber(const char *ptr, const char *end, int &value);
+const char *ParseNumber(const char *ptr, const char *end, int64_t &value);
+
+/// Parses \p count numbers separated by whitespace into \p values. Returns the
+/// pointer past the last number or nullptr if there are fewer numbers.
+template <typename T>
+const char *ParseNumbers(const char *ptr,
+                         const char *end,
+                         T *values,
+                         int count) {
+    for (int i = 0; i < count && ptr; ++i) {
+        ptr = ParseNumber(ptr, end, values[i]);
+    }
+    return ptr;
+}
+
+/// Returns the end of the line starting at \p ptr, i.e. the position of its
+/// '\n' or \p end.
+const char *FindLineEnd(const char *ptr, const char *end);
+
+/// Returns true if [\p line, \p line_end) holds at least \p num_values values
+/// separated by whitespace.
+bool HasValues(const char *line, const char *line_end, int64_t num_values);
+
+/// Splits [\p begin, \p end) at line boundaries into chunks for the threads.
+/// Returns the chunk boundaries, starting with \p begin and ending with \p end.
+std::vector<const char *> SplitLines(const char *begin, const char *end);
+
+/// Parses the lines in [\p begin, \p end) in parallel. \p parse_line(line,
+/// line_end, record) is called for every line, with \p line_end pointing at
+/// the line break. The records for which it returns true are returned in file
+/// order.
+template <typename Record, typename ParseLine>
+std::vector<Record> ParseLines(const char *begin,
+                               const char *end,
+                               ParseLine parse_line) {
+    const std::vector<const char *> bounds = SplitLines(begin, end);
+    const int num_chunks = static_cast<int>(bounds.size()) - 1;
+    std::vector<std::vector<Record>> chunk_records(num_chunks);
+#pragma omp parallel for schedule(dynamic)
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        const char *chunk_end = bounds[chunk + 1];
+        const char *line = bounds[chunk];
+        while (line < chunk_end) {
+            const char *line_end = FindLineEnd(line, chunk_end);
+            Record record;
+            if (parse_line(line, line_end, record)) {
+                chunk_records[chunk].push_back(record);
+            }
+            line = line_end + 1;
+        }
+    }
+
+    std::vector<size_t> offsets(num_chunks + 1, 0);
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        offsets[chunk + 1] = offsets[chunk] + chunk_records[chunk].size();
+    }
+    std::vector<Record> records(offsets.back());
+#pragma omp parallel for schedule(static)
+    for (int chunk = 0; chunk < num_chunks; ++chunk) {
+        std::copy(chunk_records[chunk].begin(), chunk_records[chunk].end(),
+                  records.begin() + offsets[chunk]);
+        std::vector<Record>().swap(chunk_records[chunk]);
+    }
+    return records;
+}
+
+}  // namespace io
+}  // namespace open3d
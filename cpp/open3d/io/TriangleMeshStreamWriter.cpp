@@ -0,0 +1,425 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/TriangleMeshStreamWriter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace io {
+
+namespace {
+
+/// Bytes reserved for the PLY header, padded with a comment.
+const size_t kPLYHeaderSize = 512;
+/// Bytes reserved for the glTF JSON chunk, padded with spaces.
+const size_t kGLBJSONSize = 2048;
+/// GLB header, JSON chunk header, JSON chunk and BIN chunk header.
+const size_t kGLBHeaderSize = 12 + 8 + kGLBJSONSize + 8;
+
+template <class T>
+void Append(std::vector<char> &buffer, const T &value) {
+    const char *bytes = reinterpret_cast<const char *>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+bool WriteBuffer(FILE *file, const std::vector<char> &buffer) {
+    return buffer.empty() ||
+           fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+}
+
+/// Appends the contents of \p src to \p dst.
+bool AppendFile(FILE *dst, FILE *src) {
+    if (fflush(src) != 0 || fseek(src, 0, SEEK_SET) != 0) {
+        return false;
+    }
+    std::vector<char> buffer(1 << 20);
+    size_t size;
+    while ((size = fread(buffer.data(), 1, buffer.size(), src)) > 0) {
+        if (fwrite(buffer.data(), 1, size, dst) != size) {
+            return false;
+        }
+    }
+    return ferror(src) == 0;
+}
+
+int64_t FileSize(FILE *file) {
+    fflush(file);
+    fseek(file, 0, SEEK_END);
+    return int64_t(ftell(file));
+}
+
+}  // namespace
+
+TriangleMeshStreamWriter::TriangleMeshStreamWriter(bool background,
+                                                   size_t capacity)
+    : background_(background), capacity_(std::max(capacity, size_t(1))) {}
+
+TriangleMeshStreamWriter::~TriangleMeshStreamWriter() {
+    if (IsOpened()) {
+        Close();
+    }
+}
+
+bool TriangleMeshStreamWriter::Open(const std::string &filename) {
+    if (IsOpened()) {
+        utility::LogWarning("TriangleMeshStreamWriter: {} is already open.",
+                            filename_);
+        return false;
+    }
+    const std::string ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    size_t header_size;
+    if (ext == "ply") {
+        format_ = Format::PLY;
+        header_size = kPLYHeaderSize;
+        temporary_filenames_ = {filename + ".triangles.tmp"};
+    } else if (ext == "glb") {
+        format_ = Format::GLB;
+        header_size = kGLBHeaderSize;
+        temporary_filenames_ = {filename + ".normals.tmp",
+                                filename + ".colors.tmp",
+                                filename + ".indices.tmp"};
+    } else {
+        utility::LogWarning(
+                "TriangleMeshStreamWriter: unsupported file extension {}.",
+                ext);
+        return false;
+    }
+
+    file_ = utility::filesystem::FOpen(filename, "wb");
+    if (!file_) {
+        utility::LogWarning("TriangleMeshStreamWriter: unable to open {}.",
+                            filename);
+        return false;
+    }
+    filename_ = filename;
+    for (const std::string &temporary_filename : temporary_filenames_) {
+        FILE *file = utility::filesystem::FOpen(temporary_filename, "w+b");
+        if (!file) {
+            utility::LogWarning("TriangleMeshStreamWriter: unable to open {}.",
+                                temporary_filename);
+            RemoveTemporaryFiles();
+            fclose(file_);
+            file_ = nullptr;
+            return false;
+        }
+        temporary_files_.push_back(file);
+    }
+    // The header is written by Close() once the counts are known.
+    const std::vector<char> reserved(header_size, 0);
+    WriteBuffer(file_, reserved);
+
+    has_attributes_ = false;
+    has_normals_ = false;
+    has_colors_ = false;
+    num_vertices_ = 0;
+    num_triangles_ = 0;
+    min_bound_.setConstant(std::numeric_limits<float>::max());
+    max_bound_.setConstant(std::numeric_limits<float>::lowest());
+    failed_ = false;
+    stop_ = false;
+    if (background_) {
+        thread_ = std::thread(&TriangleMeshStreamWriter::Run, this);
+    }
+    return true;
+}
+
+bool TriangleMeshStreamWriter::AddChunk(const geometry::TriangleMesh &mesh) {
+    if (!IsOpened()) {
+        utility::LogWarning("TriangleMeshStreamWriter: no file is open.");
+        return false;
+    }
+    if (!mesh.HasVertices()) {
+        if (mesh.HasTriangles()) {
+            utility::LogWarning(
+                    "TriangleMeshStreamWriter: chunk has triangles but no "
+                    "vertices.");
+            return false;
+        }
+        return true;
+    }
+    if (!has_attributes_) {
+        has_attributes_ = true;
+        has_normals_ = mesh.HasVertexNormals();
+        has_colors_ = mesh.HasVertexColors();
+    } else if (has_normals_ != mesh.HasVertexNormals() ||
+               has_colors_ != mesh.HasVertexColors()) {
+        utility::LogWarning(
+                "TriangleMeshStreamWriter: the vertex attributes of the "
+                "chunk differ from the first chunk.");
+        return false;
+    }
+
+    auto chunk = std::make_unique<Chunk>();
+    chunk->vertices = mesh.vertices_;
+    if (has_normals_) chunk->normals = mesh.vertex_normals_;
+    if (has_colors_) chunk->colors = mesh.vertex_colors_;
+    chunk->triangles = mesh.triangles_;
+    chunk->vertex_offset = num_vertices_;
+    num_vertices_ += int64_t(mesh.vertices_.size());
+    num_triangles_ += int64_t(mesh.triangles_.size());
+
+    if (!background_) {
+        if (!WriteChunk(*chunk)) {
+            failed_ = true;
+        }
+        return !failed_;
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this] { return queue_.size() < capacity_; });
+        if (failed_) {
+            return false;
+        }
+        queue_.push_back(std::move(chunk));
+    }
+    not_empty_.notify_one();
+    return true;
+}
+
+bool TriangleMeshStreamWriter::Close() {
+    if (!IsOpened()) {
+        return false;
+    }
+    if (thread_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        not_empty_.notify_all();
+        thread_.join();
+    }
+
+    bool success = !failed_;
+    if (num_vertices_ > std::numeric_limits<int32_t>::max()) {
+        utility::LogWarning(
+                "TriangleMeshStreamWriter: {} vertices exceed the index "
+                "range.",
+                num_vertices_);
+        success = false;
+    }
+    for (FILE *file : temporary_files_) {
+        success = success && AppendFile(file_, file);
+    }
+    success = success && fseek(file_, 0, SEEK_SET) == 0 && WriteHeader();
+    if (fclose(file_) != 0) {
+        success = false;
+    }
+    file_ = nullptr;
+    RemoveTemporaryFiles();
+    if (!success) {
+        utility::LogWarning("TriangleMeshStreamWriter: failed to write {}.",
+                            filename_);
+    }
+    return success;
+}
+
+void TriangleMeshStreamWriter::Run() {
+    while (true) {
+        std::unique_ptr<Chunk> chunk;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            not_empty_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;
+            }
+            chunk = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        not_full_.notify_one();
+        const bool success = WriteChunk(*chunk);
+        if (!success) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            failed_ = true;
+        }
+    }
+}
+
+bool TriangleMeshStreamWriter::WriteChunk(const Chunk &chunk) {
+    std::vector<char> vertices, normals, colors, indices;
+    const int64_t num_vertices = int64_t(chunk.vertices.size());
+    for (const Eigen::Vector3i &triangle : chunk.triangles) {
+        if (triangle.minCoeff() < 0 || triangle.maxCoeff() >= num_vertices) {
+            utility::LogWarning(
+                    "TriangleMeshStreamWriter: triangle index out of range.");
+            return false;
+        }
+    }
+
+    if (format_ == Format::PLY) {
+        for (int64_t i = 0; i < num_vertices; ++i) {
+            Append(vertices, chunk.vertices[i]);
+            if (has_normals_) Append(vertices, chunk.normals[i]);
+            if (has_colors_) {
+                for (int d = 0; d < 3; ++d) {
+                    const double color =
+                            std::min(std::max(chunk.colors[i](d), 0.0), 1.0);
+                    Append(vertices, uint8_t(std::round(color * 255)));
+                }
+            }
+        }
+        for (const Eigen::Vector3i &triangle : chunk.triangles) {
+            Append(indices, uint8_t(3));
+            Append(indices, Eigen::Vector3i(triangle.array() +
+                                            int(chunk.vertex_offset)));
+        }
+        return WriteBuffer(file_, vertices) &&
+               WriteBuffer(temporary_files_[0], indices);
+    }
+
+    for (int64_t i = 0; i < num_vertices; ++i) {
+        const Eigen::Vector3f vertex = chunk.vertices[i].cast<float>();
+        min_bound_ = min_bound_.cwiseMin(vertex);
+        max_bound_ = max_bound_.cwiseMax(vertex);
+        Append(vertices, vertex);
+        if (has_normals_) {
+            Append(normals, Eigen::Vector3f(chunk.normals[i].cast<float>()));
+        }
+        if (has_colors_) {
+            Append(colors, Eigen::Vector3f(chunk.colors[i].cast<float>()));
+        }
+    }
+    for (const Eigen::Vector3i &triangle : chunk.triangles) {
+        for (int d = 0; d < 3; ++d) {
+            Append(indices, uint32_t(triangle(d) + chunk.vertex_offset));
+        }
+    }
+    return WriteBuffer(file_, vertices) &&
+           WriteBuffer(temporary_files_[0], normals) &&
+           WriteBuffer(temporary_files_[1], colors) &&
+           WriteBuffer(temporary_files_[2], indices);
+}
+
+bool TriangleMeshStreamWriter::WriteHeader() {
+    if (format_ == Format::PLY) {
+        std::string header = "ply\nformat binary_little_endian 1.0\n";
+        const std::string body =
+                fmt::format("element vertex {}\n", num_vertices_) +
+                "property double x\nproperty double y\nproperty double z\n" +
+                (has_normals_ ? "property double nx\nproperty double ny\n"
+                                "property double nz\n"
+                              : "") +
+                (has_colors_ ? "property uchar red\nproperty uchar green\n"
+                               "property uchar blue\n"
+                             : "") +
+                fmt::format("element face {}\n", num_triangles_) +
+                "property list uchar int vertex_indices\nend_header\n";
+        // The comment pads the header to the reserved size.
+        const size_t padding = kPLYHeaderSize - header.size() - body.size();
+        header += "comment " + std::string(padding - 9, ' ') + "\n" + body;
+        return fwrite(header.data(), 1, header.size(), file_) == header.size();
+    }
+
+    // Buffer views of the positions, normals, colors and indices, which are
+    // stored in this order and are multiples of 4 bytes.
+    const int64_t vec3_bytes = num_vertices_ * 12;
+    const int64_t view_bytes[4] = {vec3_bytes, has_normals_ ? vec3_bytes : 0,
+                                   has_colors_ ? vec3_bytes : 0,
+                                   num_triangles_ * 12};
+    const int64_t bin_bytes =
+            view_bytes[0] + view_bytes[1] + view_bytes[2] + view_bytes[3];
+    std::string views, accessors;
+    std::string attributes = "\"POSITION\":0";
+    int64_t offset = 0;
+    int accessor = 0;
+    for (int view = 0; view < 4; ++view) {
+        if (view_bytes[view] == 0 && view != 0 && view != 3) {
+            continue;
+        }
+        const bool is_index = view == 3;
+        if (accessor > 0) {
+            views += ",";
+            accessors += ",";
+        }
+        views += fmt::format(
+                "{{\"buffer\":0,\"byteOffset\":{},\"byteLength\":{},"
+                "\"target\":{}}}",
+                offset, view_bytes[view], is_index ? 34963 : 34962);
+        accessors += fmt::format(
+                "{{\"bufferView\":{},\"componentType\":{},\"count\":{},"
+                "\"type\":\"{}\"",
+                accessor, is_index ? 5125 : 5126,
+                is_index ? num_triangles_ * 3 : num_vertices_,
+                is_index ? "SCALAR" : "VEC3");
+        if (view == 0) {
+            accessors += fmt::format(
+                    ",\"min\":[{},{},{}],\"max\":[{},{},{}]", min_bound_(0),
+                    min_bound_(1), min_bound_(2), max_bound_(0),
+                    max_bound_(1), max_bound_(2));
+        }
+        accessors += "}";
+        if (view == 1) attributes += fmt::format(",\"NORMAL\":{}", accessor);
+        if (view == 2) attributes += fmt::format(",\"COLOR_0\":{}", accessor);
+        offset += view_bytes[view];
+        ++accessor;
+    }
+    std::string json = fmt::format(
+            "{{\"asset\":{{\"version\":\"2.0\",\"generator\":\"Open3D\"}},"
+            "\"scene\":0,\"scenes\":[{{\"nodes\":[0]}}],"
+            "\"nodes\":[{{\"mesh\":0}}],"
+            "\"meshes\":[{{\"primitives\":[{{\"attributes\":{{{}}},"
+            "\"indices\":{},\"mode\":4}}]}}],"
+            "\"buffers\":[{{\"byteLength\":{}}}],"
+            "\"bufferViews\":[{}],\"accessors\":[{}]}}",
+            attributes, accessor - 1, bin_bytes, views, accessors);
+    if (json.size() > kGLBJSONSize) {
+        utility::LogWarning("TriangleMeshStreamWriter: glTF JSON too large.");
+        return false;
+    }
+    json.resize(kGLBJSONSize, ' ');
+
+    std::vector<char> header;
+    Append(header, uint32_t(0x46546C67));  // "glTF"
+    Append(header, uint32_t(2));
+    Append(header, uint32_t(kGLBHeaderSize + bin_bytes));
+    Append(header, uint32_t(kGLBJSONSize));
+    Append(header, uint32_t(0x4E4F534A));  // "JSON"
+    header.insert(header.end(), json.begin(), json.end());
+    Append(header, uint32_t(bin_bytes));
+    Append(header, uint32_t(0x004E4942));  // "BIN"
+    return FileSize(file_) == int64_t(kGLBHeaderSize) + bin_bytes &&
+           fseek(file_, 0, SEEK_SET) == 0 && WriteBuffer(file_, header);
+}
+
+void TriangleMeshStreamWriter::RemoveTemporaryFiles() {
+    for (FILE *file : temporary_files_) {
+        fclose(file);
+    }
+    for (const std::string &temporary_filename : temporary_filenames_) {
+        utility::filesystem::RemoveFile(temporary_filename);
+    }
+    temporary_files_.clear();
+    temporary_filenames_.clear();
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open3d/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace io {
+
+/// \class TriangleMeshStreamWriter
+///
+/// \brief Writes a triangle mesh chunk by chunk, e.g., the tiles of a TSDF
+/// extraction, without holding the whole mesh in memory.
+///
+/// The triangles of each chunk index the vertices of the chunk and are
+/// offset by the number of vertices written before. Binary little endian PLY
+/// (.ply) and binary glTF (.glb) files are supported. The header is reserved
+/// when the file is opened and written with the final counts by Close(),
+/// while the triangles (PLY) or the vertex attributes and indices (glTF) are
+/// staged in temporary files next to the output and appended at the end.
+///
+/// With a background thread, AddChunk() copies the chunk into a queue of at
+/// most capacity chunks and returns, so that writing overlaps with producing
+/// the next chunk.
+class TriangleMeshStreamWriter {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param background Write the chunks on a background thread.
+    /// \param capacity Maximum number of chunks waiting to be written.
+    explicit TriangleMeshStreamWriter(bool background = true,
+                                      size_t capacity = 4);
+    /// Closes the file if it is open.
+    ~TriangleMeshStreamWriter();
+
+    TriangleMeshStreamWriter(const TriangleMeshStreamWriter &) = delete;
+    TriangleMeshStreamWriter &operator=(const TriangleMeshStreamWriter &) =
+            delete;
+
+    /// Opens \p filename, whose extension selects the format.
+    bool Open(const std::string &filename);
+
+    bool IsOpened() const { return file_ != nullptr; }
+
+    /// Appends the vertices, vertex normals, vertex colors and triangles of
+    /// \p mesh. The first chunk with vertices decides which attributes are
+    /// written. Returns false if the chunk does not match or a previous
+    /// write failed.
+    bool AddChunk(const geometry::TriangleMesh &mesh);
+
+    /// Writes the pending chunks, patches the header and closes the file.
+    /// Returns false if any write failed.
+    bool Close();
+
+    /// Number of vertices added so far.
+    int64_t GetNumVertices() const { return num_vertices_; }
+    /// Number of triangles added so far.
+    int64_t GetNumTriangles() const { return num_triangles_; }
+
+private:
+    enum class Format { PLY, GLB };
+
+    struct Chunk {
+        std::vector<Eigen::Vector3d> vertices;
+        std::vector<Eigen::Vector3d> normals;
+        std::vector<Eigen::Vector3d> colors;
+        std::vector<Eigen::Vector3i> triangles;
+        /// Offset of the triangle indices.
+        int64_t vertex_offset;
+    };
+
+    void Run();
+    bool WriteChunk(const Chunk &chunk);
+    bool WriteHeader();
+    void RemoveTemporaryFiles();
+
+    bool background_;
+    size_t capacity_;
+
+    std::string filename_;
+    Format format_ = Format::PLY;
+    FILE *file_ = nullptr;
+    /// Files the triangles (PLY) or normals, colors and indices (glTF) are
+    /// staged in.
+    std::vector<std::string> temporary_filenames_;
+    std::vector<FILE *> temporary_files_;
+
+    bool has_attributes_ = false;
+    bool has_normals_ = false;
+    bool has_colors_ = false;
+    int64_t num_vertices_ = 0;
+    int64_t num_triangles_ = 0;
+    Eigen::Vector3f min_bound_;
+    Eigen::Vector3f max_bound_;
+
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+    std::deque<std::unique_ptr<Chunk>> queue_;
+    bool failed_ = false;
+    bool stop_ = false;
+    std::thread thread_;
+};
+
+}  // namespace io
+}  // namespace open3d
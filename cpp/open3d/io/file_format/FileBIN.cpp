@@ -25,9 +25,12 @@
 // ----------------------------------------------------------------------------
 
 #include <cstdio>
+#include <cstring>
 #include <memory>
 
 #include "open3d/io/FeatureIO.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/io/PoseGraphIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 
@@ -72,6 +75,116 @@ bool WriteMatrixXdToBINFile(FILE *file, const Eigen::MatrixXd &mat) {
     return true;
 }
 
+/// Header of the PoseGraph and PinholeCameraTrajectory BIN files. It is
+/// followed by the fixed size records, so that a file can be memory mapped
+/// and the records decoded in parallel.
+struct BINHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t num_records[2];
+};
+static_assert(sizeof(BINHeader) == 32, "Unexpected BINHeader size.");
+
+const char *const kPoseGraphMagic = "O3DPOSEG";
+const char *const kTrajectoryMagic = "O3DTRAJC";
+const uint32_t kBINVersion = 1;
+
+struct PoseGraphEdgeRecord {
+    int32_t source_node_id;
+    int32_t target_node_id;
+    int32_t uncertain;
+    int32_t reserved;
+    double confidence;
+    double transformation[16];
+    double information[36];
+};
+static_assert(sizeof(PoseGraphEdgeRecord) == 440,
+              "Unexpected PoseGraphEdgeRecord size.");
+
+struct PinholeCameraParametersRecord {
+    int32_t width;
+    int32_t height;
+    double intrinsic[9];
+    double extrinsic[16];
+};
+static_assert(sizeof(PinholeCameraParametersRecord) == 208,
+              "Unexpected PinholeCameraParametersRecord size.");
+
+bool WriteBINHeader(FILE *file,
+                    const char *magic,
+                    uint64_t num_records0,
+                    uint64_t num_records1 = 0) {
+    BINHeader header;
+    std::memcpy(header.magic, magic, sizeof(header.magic));
+    header.version = kBINVersion;
+    header.reserved = 0;
+    header.num_records[0] = num_records0;
+    header.num_records[1] = num_records1;
+    if (fwrite(&header, sizeof(header), 1, file) < 1) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+        return false;
+    }
+    return true;
+}
+
+/// Reads the header and checks that the file is large enough for
+/// \p record_sizes[i] * num_records[i] bytes of records.
+bool ReadBINHeader(FILE *file,
+                   const char *magic,
+                   const size_t record_sizes[2],
+                   BINHeader &header) {
+    if (fread(&header, sizeof(header), 1, file) < 1) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    if (std::memcmp(header.magic, magic, sizeof(header.magic)) != 0) {
+        utility::LogWarning("Read BIN failed: unexpected file type.");
+        return false;
+    }
+    if (header.version != kBINVersion) {
+        utility::LogWarning("Read BIN failed: unsupported version {}.",
+                            header.version);
+        return false;
+    }
+    const long begin = ftell(file);
+    if (fseek(file, 0, SEEK_END) != 0) {
+        utility::LogWarning("Read BIN failed: unexpected error.");
+        return false;
+    }
+    const uint64_t remaining = uint64_t(ftell(file) - begin);
+    fseek(file, begin, SEEK_SET);
+    if (header.num_records[0] > remaining / record_sizes[0] ||
+        header.num_records[1] > remaining / record_sizes[1] ||
+        header.num_records[0] * record_sizes[0] +
+                        header.num_records[1] * record_sizes[1] >
+                remaining) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    return true;
+}
+
+template <class T>
+bool ReadBINRecords(FILE *file, std::vector<T> &records, uint64_t num) {
+    records.resize(num);
+    if (fread(records.data(), sizeof(T), num, file) < num) {
+        utility::LogWarning("Read BIN failed: unexpected EOF.");
+        return false;
+    }
+    return true;
+}
+
+template <class T>
+bool WriteBINRecords(FILE *file, const std::vector<T> &records) {
+    if (fwrite(records.data(), sizeof(T), records.size(), file) <
+        records.size()) {
+        utility::LogWarning("Write BIN failed: unexpected error.");
+        return false;
+    }
+    return true;
+}
+
 }  // unnamed namespace
 
 namespace io {
@@ -102,5 +215,151 @@ bool WriteFeatureToBIN(const std::string &filename,
     return success;
 }
 
+bool ReadPoseGraphFromBIN(const std::string &filename,
+                          pipelines::registration::PoseGraph &pose_graph) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const size_t record_sizes[2] = {16 * sizeof(double),
+                                    sizeof(PoseGraphEdgeRecord)};
+    BINHeader header;
+    std::vector<double> poses;
+    std::vector<PoseGraphEdgeRecord> edges;
+    bool success = ReadBINHeader(fid, kPoseGraphMagic, record_sizes, header) &&
+                   ReadBINRecords(fid, poses, header.num_records[0] * 16) &&
+                   ReadBINRecords(fid, edges, header.num_records[1]);
+    fclose(fid);
+    if (!success) {
+        return false;
+    }
+
+    const int64_t num_nodes = int64_t(header.num_records[0]);
+    const int64_t num_edges = int64_t(header.num_records[1]);
+    pose_graph.nodes_.resize(num_nodes);
+    pose_graph.edges_.resize(num_edges);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_nodes; ++i) {
+        pose_graph.nodes_[i].pose_ =
+                Eigen::Map<const Eigen::Matrix4d>(poses.data() + 16 * i);
+    }
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_edges; ++i) {
+        const PoseGraphEdgeRecord &record = edges[i];
+        auto &edge = pose_graph.edges_[i];
+        edge.source_node_id_ = record.source_node_id;
+        edge.target_node_id_ = record.target_node_id;
+        edge.uncertain_ = record.uncertain != 0;
+        edge.confidence_ = record.confidence;
+        edge.transformation_ =
+                Eigen::Map<const Eigen::Matrix4d>(record.transformation);
+        edge.information_ =
+                Eigen::Map<const Eigen::Matrix6d>(record.information);
+    }
+    return true;
+}
+
+bool WritePoseGraphToBIN(const std::string &filename,
+                         const pipelines::registration::PoseGraph &pose_graph) {
+    const int64_t num_nodes = int64_t(pose_graph.nodes_.size());
+    const int64_t num_edges = int64_t(pose_graph.edges_.size());
+    std::vector<double> poses(num_nodes * 16);
+    std::vector<PoseGraphEdgeRecord> edges(num_edges);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_nodes; ++i) {
+        Eigen::Map<Eigen::Matrix4d>(poses.data() + 16 * i) =
+                pose_graph.nodes_[i].pose_;
+    }
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_edges; ++i) {
+        const auto &edge = pose_graph.edges_[i];
+        PoseGraphEdgeRecord &record = edges[i];
+        record.source_node_id = edge.source_node_id_;
+        record.target_node_id = edge.target_node_id_;
+        record.uncertain = edge.uncertain_ ? 1 : 0;
+        record.reserved = 0;
+        record.confidence = edge.confidence_;
+        Eigen::Map<Eigen::Matrix4d>(record.transformation) =
+                edge.transformation_;
+        Eigen::Map<Eigen::Matrix6d>(record.information) = edge.information_;
+    }
+
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = WriteBINHeader(fid, kPoseGraphMagic, num_nodes, num_edges) &&
+                   WriteBINRecords(fid, poses) && WriteBINRecords(fid, edges);
+    fclose(fid);
+    return success;
+}
+
+bool ReadPinholeCameraTrajectoryFromBIN(
+        const std::string &filename,
+        camera::PinholeCameraTrajectory &trajectory) {
+    FILE *fid = utility::filesystem::FOpen(filename, "rb");
+    if (fid == NULL) {
+        utility::LogWarning("Read BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const size_t record_sizes[2] = {sizeof(PinholeCameraParametersRecord), 1};
+    BINHeader header;
+    std::vector<PinholeCameraParametersRecord> records;
+    bool success = ReadBINHeader(fid, kTrajectoryMagic, record_sizes, header) &&
+                   ReadBINRecords(fid, records, header.num_records[0]);
+    fclose(fid);
+    if (!success) {
+        return false;
+    }
+
+    const int64_t num = int64_t(records.size());
+    trajectory.parameters_.resize(num);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num; ++i) {
+        const PinholeCameraParametersRecord &record = records[i];
+        auto &parameters = trajectory.parameters_[i];
+        parameters.intrinsic_.width_ = record.width;
+        parameters.intrinsic_.height_ = record.height;
+        parameters.intrinsic_.intrinsic_matrix_ =
+                Eigen::Map<const Eigen::Matrix3d>(record.intrinsic);
+        parameters.extrinsic_ =
+                Eigen::Map<const Eigen::Matrix4d>(record.extrinsic);
+    }
+    return true;
+}
+
+bool WritePinholeCameraTrajectoryToBIN(
+        const std::string &filename,
+        const camera::PinholeCameraTrajectory &trajectory) {
+    const int64_t num = int64_t(trajectory.parameters_.size());
+    std::vector<PinholeCameraParametersRecord> records(num);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num; ++i) {
+        const auto &parameters = trajectory.parameters_[i];
+        PinholeCameraParametersRecord &record = records[i];
+        record.width = parameters.intrinsic_.width_;
+        record.height = parameters.intrinsic_.height_;
+        Eigen::Map<Eigen::Matrix3d>(record.intrinsic) =
+                parameters.intrinsic_.intrinsic_matrix_;
+        Eigen::Map<Eigen::Matrix4d>(record.extrinsic) = parameters.extrinsic_;
+    }
+
+    FILE *fid = utility::filesystem::FOpen(filename, "wb");
+    if (fid == NULL) {
+        utility::LogWarning("Write BIN failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = WriteBINHeader(fid, kTrajectoryMagic, num) &&
+                   WriteBINRecords(fid, records);
+    fclose(fid);
+    return success;
+}
+
 }  // namespace io
 }  // namespace open3d
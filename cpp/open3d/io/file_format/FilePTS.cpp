@@ -24,10 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/TextParser.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
@@ -44,18 +46,15 @@ bool ReadPointCloudFromPTS(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        MappedTextFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
-        size_t num_of_pts = 0;
-        int num_of_fields = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            sscanf(line_buffer, "%zu", &num_of_pts);
-        }
+        const char *header_end = FindLineEnd(file.Begin(), file.End());
+        int64_t num_of_pts = 0;
+        ParseNumber(file.Begin(), header_end, num_of_pts);
         if (num_of_pts <= 0) {
             utility::LogWarning("Read PTS failed: unable to read header.");
             return false;
@@ -64,39 +63,58 @@ bool ReadPointCloudFromPTS(const std::string &filename,
         reporter.SetTotal(num_of_pts);
 
         pointcloud.Clear();
-        size_t idx = 0;
-        while (idx < num_of_pts && (line_buffer = file.ReadLine())) {
-            if (num_of_fields == 0) {
-                std::vector<std::string> st =
-                        utility::SplitString(line_buffer, " ");
-                num_of_fields = (int)st.size();
-                if (num_of_fields < 3) {
-                    utility::LogWarning(
-                            "Read PTS failed: insufficient data fields.");
-                    return false;
-                }
-                pointcloud.points_.resize(num_of_pts);
-                if (num_of_fields >= 7) {
-                    // X Y Z I R G B
-                    pointcloud.colors_.resize(num_of_pts);
-                }
-            }
-            double x, y, z, i;
-            int r, g, b;
-            if (num_of_fields < 7) {
-                if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                }
-            } else {
-                if (sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z,
-                           &i, &r, &g, &b) == 7) {
-                    pointcloud.points_[idx] = Eigen::Vector3d(x, y, z);
-                    pointcloud.colors_[idx] = utility::ColorToDouble(r, g, b);
-                }
-            }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+        const char *data_begin =
+                header_end == file.End() ? header_end : header_end + 1;
+        const char *first_line_end = FindLineEnd(data_begin, file.End());
+        if (data_begin == file.End()) {
+            reporter.Finish();
+            return true;
+        }
+        const size_t num_of_fields =
+                utility::SplitString(std::string(data_begin, first_line_end),
+                                     " ")
+                        .size();
+        if (num_of_fields < 3) {
+            utility::LogWarning("Read PTS failed: insufficient data fields.");
+            return false;
+        }
+
+        // X Y Z [I R G B]. Lines that fail to parse keep a zero point.
+        struct Record {
+            double values_[4] = {0, 0, 0, 0};
+            int color_[3] = {0, 0, 0};
+        };
+        const std::vector<Record> records = ParseLines<Record>(
+                data_begin, file.End(),
+                [num_of_fields](const char *line, const char *line_end,
+                                Record &record) {
+                    Record parsed;
+                    if (num_of_fields < 7) {
+                        if (ParseNumbers(line, line_end, parsed.values_, 3)) {
+                            record = parsed;
+                        }
+                    } else {
+                        line = ParseNumbers(line, line_end, parsed.values_, 4);
+                        if (ParseNumbers(line, line_end, parsed.color_, 3)) {
+                            record = parsed;
+                        }
+                    }
+                    return true;
+                });
+        const int64_t num_of_lines =
+                std::min(num_of_pts, int64_t(records.size()));
+        pointcloud.points_.resize(num_of_pts, Eigen::Vector3d::Zero());
+        if (num_of_fields >= 7) {
+            pointcloud.colors_.resize(num_of_pts, Eigen::Vector3d::Zero());
+        }
+#pragma omp parallel for schedule(static)
+        for (int64_t idx = 0; idx < num_of_lines; ++idx) {
+            const Record &record = records[idx];
+            pointcloud.points_[idx] = Eigen::Vector3d(
+                    record.values_[0], record.values_[1], record.values_[2]);
+            if (num_of_fields >= 7) {
+                pointcloud.colors_[idx] = utility::ColorToDouble(
+                        record.color_[0], record.color_[1], record.color_[2]);
             }
         }
         reporter.Finish();
@@ -28,6 +28,7 @@
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/TextParser.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -43,27 +44,23 @@ bool ReadPointCloudFromXYZ(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        MappedTextFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read XYZ failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
+        reporter.SetTotal(file.GetSize());
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
-        }
+        pointcloud.points_ = ParseLines<Eigen::Vector3d>(
+                file.Begin(), file.End(),
+                [](const char *line, const char *line_end,
+                   Eigen::Vector3d &point) {
+                    return ParseNumbers(line, line_end, point.data(), 3) !=
+                           nullptr;
+                });
         reporter.Finish();
 
         return true;
@@ -24,10 +24,12 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <array>
 #include <cstdio>
 
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/io/TextParser.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -43,28 +45,33 @@ bool ReadPointCloudFromXYZRGB(const std::string &filename,
                               geometry::PointCloud &pointcloud,
                               const ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        MappedTextFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read XYZRGB failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
+        reporter.SetTotal(file.GetSize());
 
         pointcloud.Clear();
-        int i = 0;
-        double x, y, z, r, g, b;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf %lf %lf", &x, &y, &z, &r,
-                       &g, &b) == 6) {
-                pointcloud.points_.push_back(Eigen::Vector3d(x, y, z));
-                pointcloud.colors_.push_back(Eigen::Vector3d(r, g, b));
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+        const std::vector<std::array<double, 6>> records =
+                ParseLines<std::array<double, 6>>(
+                        file.Begin(), file.End(),
+                        [](const char *line, const char *line_end,
+                           std::array<double, 6> &record) {
+                            return ParseNumbers(line, line_end, record.data(),
+                                                6) != nullptr;
+                        });
+        pointcloud.points_.resize(records.size());
+        pointcloud.colors_.resize(records.size());
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < int64_t(records.size()); ++i) {
+            const std::array<double, 6> &record = records[i];
+            pointcloud.points_[i] =
+                    Eigen::Vector3d(record[0], record[1], record[2]);
+            pointcloud.colors_[i] =
+                    Eigen::Vector3d(record[3], record[4], record[5]);
         }
         reporter.Finish();
 
@@ -0,0 +1,396 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/rpc/ArrayEncoding.h"
+
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "open3d/core/Blob.h"
+#include "open3d/io/rpc/Messages.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+namespace {
+
+const std::string kLZF = "lzf";
+const std::string kQuantize16 = "quantize16";
+const std::string kUNorm8 = "unorm8";
+const std::string kOct16 = "oct16";
+
+/// Arrays smaller than this are not compressed.
+const size_t kMinCompressBytes = 1024;
+/// Bytes compressed as one LZF chunk.
+const size_t kLZFChunkBytes = 1 << 20;
+
+bool IsFloatArray(const messages::Array& array) {
+    return array.type == messages::TypeStr<float>() ||
+           array.type == messages::TypeStr<double>();
+}
+
+int64_t NumElements(const messages::Array& array) {
+    int64_t num = 1;
+    for (int64_t n : array.shape) num *= n;
+    return num;
+}
+
+/// Calls \p f with a null pointer of the floating point type of \p array.
+template <class F>
+void DispatchFloat(const messages::Array& array, F f) {
+    if (array.type == messages::TypeStr<float>()) {
+        f(static_cast<float*>(nullptr));
+    } else {
+        f(static_cast<double*>(nullptr));
+    }
+}
+
+/// Quantizes [N, 3] positions to 16 bits relative to their bounding box.
+template <class T>
+std::vector<char> Quantize16(const messages::Array& array,
+                             std::vector<double>& params) {
+    const T* values = array.Ptr<T>();
+    const int64_t num = NumElements(array) / 3;
+    double min_bound[3], max_bound[3];
+    for (int d = 0; d < 3; ++d) {
+        min_bound[d] = std::numeric_limits<double>::infinity();
+        max_bound[d] = -std::numeric_limits<double>::infinity();
+    }
+    for (int64_t i = 0; i < num * 3; ++i) {
+        min_bound[i % 3] = std::min(min_bound[i % 3], double(values[i]));
+        max_bound[i % 3] = std::max(max_bound[i % 3], double(values[i]));
+    }
+    params.clear();
+    double scale[3];
+    for (int d = 0; d < 3; ++d) {
+        scale[d] = (max_bound[d] - min_bound[d]) / 65535.0;
+        params.push_back(min_bound[d]);
+    }
+    params.insert(params.end(), scale, scale + 3);
+
+    std::vector<char> buffer(num * 3 * sizeof(uint16_t));
+    uint16_t* quantized = reinterpret_cast<uint16_t*>(buffer.data());
+    for (int64_t i = 0; i < num * 3; ++i) {
+        const int d = int(i % 3);
+        quantized[i] = scale[d] > 0 ? uint16_t(std::lround(
+                                              (values[i] - min_bound[d]) /
+                                              scale[d]))
+                                    : 0;
+    }
+    return buffer;
+}
+
+template <class T>
+void Dequantize16(const char* data, int64_t num_values,
+                  const std::vector<double>& params, T* values) {
+    const uint16_t* quantized = reinterpret_cast<const uint16_t*>(data);
+    for (int64_t i = 0; i < num_values; ++i) {
+        const int d = int(i % 3);
+        values[i] = T(params[d] + quantized[i] * params[3 + d]);
+    }
+}
+
+template <class T>
+std::vector<char> QuantizeUNorm8(const messages::Array& array) {
+    const T* values = array.Ptr<T>();
+    std::vector<char> buffer(NumElements(array));
+    for (size_t i = 0; i < buffer.size(); ++i) {
+        const T value = std::min(std::max(values[i], T(0)), T(1));
+        buffer[i] = char(uint8_t(std::lround(value * 255)));
+    }
+    return buffer;
+}
+
+template <class T>
+void DequantizeUNorm8(const char* data, int64_t num_values, T* values) {
+    const uint8_t* quantized = reinterpret_cast<const uint8_t*>(data);
+    for (int64_t i = 0; i < num_values; ++i) {
+        values[i] = T(quantized[i] / 255.0);
+    }
+}
+
+/// Encodes [N, 3] unit vectors as 2 int16 coordinates on the octahedron.
+template <class T>
+std::vector<char> EncodeOct16(const messages::Array& array) {
+    const T* values = array.Ptr<T>();
+    const int64_t num = NumElements(array) / 3;
+    std::vector<char> buffer(num * 2 * sizeof(int16_t));
+    int16_t* encoded = reinterpret_cast<int16_t*>(buffer.data());
+    for (int64_t i = 0; i < num; ++i) {
+        const T* n = values + 3 * i;
+        const double norm1 =
+                std::abs(double(n[0])) + std::abs(n[1]) + std::abs(n[2]);
+        double x = norm1 > 0 ? n[0] / norm1 : 0;
+        double y = norm1 > 0 ? n[1] / norm1 : 0;
+        if (n[2] < 0) {
+            const double x_folded =
+                    (1 - std::abs(y)) * (x >= 0 ? 1 : -1);
+            y = (1 - std::abs(x)) * (y >= 0 ? 1 : -1);
+            x = x_folded;
+        }
+        encoded[2 * i] = int16_t(std::lround(x * 32767));
+        encoded[2 * i + 1] = int16_t(std::lround(y * 32767));
+    }
+    return buffer;
+}
+
+template <class T>
+void DecodeOct16(const char* data, int64_t num_values, T* values) {
+    const int16_t* encoded = reinterpret_cast<const int16_t*>(data);
+    for (int64_t i = 0; i < num_values / 3; ++i) {
+        double x = encoded[2 * i] / 32767.0;
+        double y = encoded[2 * i + 1] / 32767.0;
+        const double z = 1 - std::abs(x) - std::abs(y);
+        if (z < 0) {
+            const double x_unfolded =
+                    (1 - std::abs(y)) * (x >= 0 ? 1 : -1);
+            y = (1 - std::abs(x)) * (y >= 0 ? 1 : -1);
+            x = x_unfolded;
+        }
+        const double norm = std::sqrt(x * x + y * y + z * z);
+        values[3 * i] = T(x / norm);
+        values[3 * i + 1] = T(y / norm);
+        values[3 * i + 2] = T(z / norm);
+    }
+}
+
+/// Compresses \p size bytes in chunks, each stored as its raw size, its
+/// stored size and the LZF data, or the raw data if it does not compress.
+std::vector<char> CompressLZF(const char* data, size_t size) {
+    std::vector<char> buffer;
+    buffer.reserve(size + size / kLZFChunkBytes * 8 + 8);
+    for (size_t begin = 0; begin < size; begin += kLZFChunkBytes) {
+        const uint32_t raw_size =
+                uint32_t(std::min(kLZFChunkBytes, size - begin));
+        const size_t header = buffer.size();
+        buffer.resize(header + 8 + raw_size);
+        uint32_t stored_size = lzf_compress(data + begin, raw_size,
+                                            buffer.data() + header + 8,
+                                            raw_size - 1);
+        if (stored_size == 0) {
+            stored_size = raw_size;
+            std::memcpy(buffer.data() + header + 8, data + begin, raw_size);
+        }
+        std::memcpy(buffer.data() + header, &raw_size, 4);
+        std::memcpy(buffer.data() + header + 4, &stored_size, 4);
+        buffer.resize(header + 8 + stored_size);
+    }
+    return buffer;
+}
+
+std::shared_ptr<core::Blob> DecompressLZF(const char* data,
+                                          size_t size,
+                                          size_t& raw_size) {
+    raw_size = 0;
+    for (size_t offset = 0; offset < size;) {
+        uint32_t chunk_sizes[2];
+        if (offset + 8 > size) {
+            utility::LogError("DecodeArrays: truncated LZF data.");
+        }
+        std::memcpy(chunk_sizes, data + offset, 8);
+        raw_size += chunk_sizes[0];
+        offset += 8 + chunk_sizes[1];
+    }
+    auto blob = std::make_shared<core::Blob>(int64_t(raw_size),
+                                             core::Device("CPU:0"));
+    char* out = static_cast<char*>(blob->GetDataPtr());
+    for (size_t offset = 0, out_offset = 0; offset < size;) {
+        uint32_t chunk_sizes[2];
+        std::memcpy(chunk_sizes, data + offset, 8);
+        offset += 8;
+        if (offset + chunk_sizes[1] > size) {
+            utility::LogError("DecodeArrays: truncated LZF data.");
+        }
+        if (chunk_sizes[1] == chunk_sizes[0]) {
+            std::memcpy(out + out_offset, data + offset, chunk_sizes[0]);
+        } else if (lzf_decompress(data + offset, chunk_sizes[1],
+                                  out + out_offset,
+                                  chunk_sizes[0]) != chunk_sizes[0]) {
+            utility::LogError("DecodeArrays: invalid LZF data.");
+        }
+        offset += chunk_sizes[1];
+        out_offset += chunk_sizes[0];
+    }
+    return blob;
+}
+
+/// Returns the arrays of \p data with their attribute names, empty for
+/// vertices, faces and lines.
+std::vector<std::pair<std::string, messages::Array*>> GetNamedArrays(
+        messages::MeshData& data) {
+    std::vector<std::pair<std::string, messages::Array*>> arrays = {
+            {"", &data.vertices}, {"", &data.faces}, {"", &data.lines}};
+    for (auto* attributes :
+         {&data.vertex_attributes, &data.face_attributes,
+          &data.line_attributes, &data.textures}) {
+        for (auto& item : *attributes) {
+            arrays.emplace_back(item.first, &item.second);
+        }
+    }
+    return arrays;
+}
+
+}  // namespace
+
+std::vector<std::string> EncodeArrays(messages::MeshData& data,
+                                      const ArrayEncodingOptions& options,
+                                      std::vector<std::vector<char>>& buffers) {
+    std::vector<std::string> used_encodings;
+    auto Use = [&](messages::Array& array, const std::string& encoding,
+                   std::vector<char>&& buffer) {
+        buffers.push_back(std::move(buffer));
+        array.data.ptr = buffers.back().data();
+        array.data.size = uint32_t(buffers.back().size());
+        array.encodings.push_back(encoding);
+        if (std::find(used_encodings.begin(), used_encodings.end(),
+                      encoding) == used_encodings.end()) {
+            used_encodings.push_back(encoding);
+        }
+    };
+
+    for (const auto& item : GetNamedArrays(data)) {
+        messages::Array& array = *item.second;
+        // Arrays in shared memory or already encoded are left as they are.
+        if (!array.data.ptr || array.data.size == 0 ||
+            !array.encodings.empty()) {
+            continue;
+        }
+        const bool is_vec3 =
+                IsFloatArray(array) && array.CheckShape({-1, 3});
+        if (options.quantize_positions && is_vec3 && &array == &data.vertices) {
+            DispatchFloat(array, [&](auto* type) {
+                using T = std::remove_pointer_t<decltype(type)>;
+                std::vector<double> params;
+                std::vector<char> buffer = Quantize16<T>(array, params);
+                array.encoding_params = params;
+                Use(array, kQuantize16, std::move(buffer));
+            });
+        } else if (options.quantize_colors && IsFloatArray(array) &&
+                   item.first == "colors") {
+            DispatchFloat(array, [&](auto* type) {
+                using T = std::remove_pointer_t<decltype(type)>;
+                Use(array, kUNorm8, QuantizeUNorm8<T>(array));
+            });
+        } else if (options.quantize_normals && is_vec3 &&
+                   item.first == "normals") {
+            DispatchFloat(array, [&](auto* type) {
+                using T = std::remove_pointer_t<decltype(type)>;
+                Use(array, kOct16, EncodeOct16<T>(array));
+            });
+        }
+        if (options.compress && array.data.size >= kMinCompressBytes) {
+            Use(array, kLZF, CompressLZF(array.data.ptr, array.data.size));
+        }
+    }
+    return used_encodings;
+}
+
+std::vector<std::shared_ptr<core::Blob>> DecodeArrays(
+        messages::MeshData& data) {
+    std::vector<std::shared_ptr<core::Blob>> blobs;
+    for (const auto& item : GetNamedArrays(data)) {
+        messages::Array& array = *item.second;
+        if (array.encodings.empty()) {
+            continue;
+        }
+        const int64_t num_values = NumElements(array);
+        const char* ptr = array.data.ptr;
+        size_t size = array.data.size;
+        std::shared_ptr<core::Blob> blob;
+        for (auto it = array.encodings.rbegin(); it != array.encodings.rend();
+             ++it) {
+            const std::string& encoding = *it;
+            if (encoding == kLZF) {
+                blob = DecompressLZF(ptr, size, size);
+                ptr = static_cast<const char*>(blob->GetDataPtr());
+                continue;
+            }
+            size_t expected_size = 0;
+            if (!IsFloatArray(array)) {
+                utility::LogError("DecodeArrays: {} requires float arrays.",
+                                  encoding);
+            } else if (encoding == kQuantize16) {
+                expected_size = num_values * sizeof(uint16_t);
+            } else if (encoding == kUNorm8) {
+                expected_size = num_values;
+            } else if (encoding == kOct16) {
+                expected_size = num_values / 3 * 2 * sizeof(int16_t);
+            } else {
+                utility::LogError("DecodeArrays: unsupported encoding {}.",
+                                  encoding);
+            }
+            if (size != expected_size ||
+                (encoding != kUNorm8 && !array.CheckShape({-1, 3})) ||
+                (encoding == kQuantize16 &&
+                 array.encoding_params.size() != 6)) {
+                utility::LogError("DecodeArrays: invalid {} array.", encoding);
+            }
+            auto decoded = std::make_shared<core::Blob>(array.NumBytes(),
+                                                        core::Device("CPU:0"));
+            DispatchFloat(array, [&](auto* type) {
+                using T = std::remove_pointer_t<decltype(type)>;
+                T* values = static_cast<T*>(decoded->GetDataPtr());
+                if (encoding == kQuantize16) {
+                    Dequantize16(ptr, num_values, array.encoding_params,
+                                 values);
+                } else if (encoding == kUNorm8) {
+                    DequantizeUNorm8(ptr, num_values, values);
+                } else {
+                    DecodeOct16(ptr, num_values, values);
+                }
+            });
+            blob = decoded;
+            ptr = static_cast<const char*>(blob->GetDataPtr());
+            size = size_t(array.NumBytes());
+        }
+        if (size != size_t(array.NumBytes())) {
+            utility::LogError("DecodeArrays: decoded array has {} bytes but "
+                              "expected {}.",
+                              size, array.NumBytes());
+        }
+        array.data.ptr = ptr;
+        array.data.size = uint32_t(size);
+        array.encodings.clear();
+        blobs.push_back(blob);
+    }
+    return blobs;
+}
+
+bool IsSupportedArrayEncoding(const std::string& encoding) {
+    return encoding == kLZF || encoding == kQuantize16 ||
+           encoding == kUNorm8 || encoding == kOct16;
+}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
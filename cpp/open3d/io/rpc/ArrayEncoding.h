@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace open3d {
+namespace core {
+class Blob;
+}
+
+namespace io {
+namespace rpc {
+
+namespace messages {
+struct MeshData;
+}
+
+/// Encodings of the arrays of mesh data sent over a connection, which trade
+/// CPU time and precision for bandwidth. The receiver decodes the arrays
+/// before processing the message.
+struct ArrayEncodingOptions {
+    /// Compresses arrays with LZF.
+    bool compress = false;
+    /// Quantizes vertex positions to 16 bits relative to their bounding box.
+    bool quantize_positions = false;
+    /// Quantizes floating point colors in [0, 1] to 8 bits.
+    bool quantize_colors = false;
+    /// Encodes normals as 16 bit octahedral coordinates.
+    bool quantize_normals = false;
+
+    bool IsEnabled() const {
+        return compress || quantize_positions || quantize_colors ||
+               quantize_normals;
+    }
+};
+
+/// Encodes the arrays of \p data in the message with \p options. The encoded
+/// data is stored in \p buffers, which must be kept alive until \p data is
+/// packed.
+///
+/// \return The names of the encodings used, for the Request of the message.
+std::vector<std::string> EncodeArrays(messages::MeshData& data,
+                                      const ArrayEncodingOptions& options,
+                                      std::vector<std::vector<char>>& buffers);
+
+/// Decodes the arrays of \p data encoded by EncodeArrays() in place.
+///
+/// \return The decoded data, which must be kept alive while the arrays are
+/// used.
+std::vector<std::shared_ptr<core::Blob>> DecodeArrays(
+        messages::MeshData& data);
+
+/// Returns true if DecodeArrays() supports the \p encoding.
+bool IsSupportedArrayEncoding(const std::string& encoding);
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
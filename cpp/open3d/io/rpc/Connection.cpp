@@ -97,6 +97,21 @@ std::shared_ptr<zmq::message_t> Connection::Send(const void* data,
 
 std::string Connection::DefaultAddress() { return defaults.address; }
 
+void Connection::SetSharedMemoryThreshold(size_t min_bytes) {
+    const bool is_local = address_.rfind("ipc://", 0) == 0 ||
+                          address_.rfind("inproc://", 0) == 0 ||
+                          address_.rfind("tcp://127.0.0.1:", 0) == 0 ||
+                          address_.rfind("tcp://localhost:", 0) == 0;
+    if (min_bytes && !is_local) {
+        LogWarning(
+                "Connection::SetSharedMemoryThreshold: address {} is not on "
+                "this host, shared memory is disabled.",
+                address_);
+        min_bytes = 0;
+    }
+    shared_memory_threshold_ = min_bytes;
+}
+
 }  // namespace rpc
 }  // namespace io
 }  // namespace open3d
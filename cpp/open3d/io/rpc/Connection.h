@@ -62,12 +62,23 @@ public:
 
     static std::string DefaultAddress();
 
+    /// Passes arrays of mesh data with at least \p min_bytes bytes through
+    /// shared memory files, which the receiver maps instead of unpacking them
+    /// from the message. This requires a receiver on the same host, i.e. an
+    /// ipc://, inproc:// or localhost tcp:// address. 0 disables it.
+    void SetSharedMemoryThreshold(size_t min_bytes);
+
+    size_t GetSharedMemoryThreshold() const override {
+        return shared_memory_threshold_;
+    }
+
 private:
     std::shared_ptr<zmq::context_t> context_;
     std::unique_ptr<zmq::socket_t> socket_;
     const std::string address_;
     const int connect_timeout_;
     const int timeout_;
+    size_t shared_memory_threshold_ = 0;
 };
 }  // namespace rpc
 }  // namespace io
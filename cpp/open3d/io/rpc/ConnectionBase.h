@@ -28,6 +28,8 @@
 
 #include <memory>
 
+#include "open3d/io/rpc/ArrayEncoding.h"
+
 namespace zmq {
 class message_t;
 class socket_t;
@@ -47,6 +49,22 @@ public:
     virtual std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg) = 0;
     virtual std::shared_ptr<zmq::message_t> Send(const void* data,
                                                  size_t size) = 0;
+
+    /// Arrays of mesh data with at least this many bytes are passed through
+    /// shared memory files instead of the message. 0 if disabled.
+    virtual size_t GetSharedMemoryThreshold() const { return 0; }
+
+    /// Sets the encodings of the arrays of mesh data sent over this
+    /// connection. The receiver must support the encodings.
+    void SetArrayEncodingOptions(const ArrayEncodingOptions& options) {
+        encoding_options_ = options;
+    }
+    const ArrayEncodingOptions& GetArrayEncodingOptions() const {
+        return encoding_options_;
+    }
+
+private:
+    ArrayEncodingOptions encoding_options_;
 };
 }  // namespace rpc
 }  // namespace io
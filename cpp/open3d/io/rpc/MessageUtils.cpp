@@ -28,11 +28,58 @@
 
 #include <zmq.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <random>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/NumpyIO.h"
 #include "open3d/io/rpc/Messages.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 
 using namespace open3d::utility;
 
+namespace {
+
+const std::string kSharedMemoryPrefix = "open3d_rpc_";
+
+/// Returns the directory of shared memory files with a trailing slash. It is
+/// in memory on Linux.
+std::string SharedMemoryDirectory() {
+    using open3d::utility::filesystem::GetRegularizedDirectoryName;
+    if (open3d::utility::filesystem::DirectoryExists("/dev/shm")) {
+        return "/dev/shm/";
+    }
+    for (const char* name : {"TMPDIR", "TEMP", "TMP"}) {
+        const char* dir = std::getenv(name);
+        if (dir && *dir) {
+            return GetRegularizedDirectoryName(dir);
+        }
+    }
+    return "/tmp/";
+}
+
+/// Returns all arrays of \p data.
+std::vector<open3d::io::rpc::messages::Array*> GetArrays(
+        open3d::io::rpc::messages::MeshData& data) {
+    std::vector<open3d::io::rpc::messages::Array*> arrays = {
+            &data.vertices, &data.faces, &data.lines};
+    for (auto* attributes :
+         {&data.vertex_attributes, &data.face_attributes,
+          &data.line_attributes, &data.textures}) {
+        for (auto& item : *attributes) {
+            arrays.push_back(&item.second);
+        }
+    }
+    return arrays;
+}
+
+}  // namespace
+
 namespace open3d {
 namespace io {
 namespace rpc {
@@ -107,6 +154,94 @@ std::shared_ptr<zmq::message_t> CreateStatusOKMsg() {
             new zmq::message_t(sbuf.data(), sbuf.size()));
 }
 
+std::string MoveArraysToSharedMemory(messages::MeshData& data,
+                                     size_t min_bytes) {
+    std::vector<messages::Array*> arrays;
+    for (messages::Array* array : GetArrays(data)) {
+        if (min_bytes && array->data.ptr && array->NumBytes() > 0 &&
+            size_t(array->NumBytes()) >= min_bytes) {
+            arrays.push_back(array);
+        }
+    }
+    if (arrays.empty()) {
+        return "";
+    }
+
+    static std::atomic<uint64_t> counter(0);
+    static const uint64_t session = std::random_device()();
+    const std::string filename =
+            SharedMemoryDirectory() + kSharedMemoryPrefix +
+            std::to_string(session) + "_" + std::to_string(counter++);
+    FILE* file = utility::filesystem::FOpen(filename, "wb");
+    if (!file) {
+        LogWarning("MoveArraysToSharedMemory: unable to create {}", filename);
+        return "";
+    }
+    int64_t offset = 0;
+    bool success = true;
+    for (messages::Array* array : arrays) {
+        // Aligned offsets keep the mapped arrays aligned.
+        const int64_t padding = (64 - offset % 64) % 64;
+        static const char zeros[64] = {};
+        const int64_t num_bytes = array->NumBytes();
+        success = success &&
+                  fwrite(zeros, 1, padding, file) == size_t(padding) &&
+                  fwrite(array->data.ptr, 1, num_bytes, file) ==
+                          size_t(num_bytes);
+        array->file = filename;
+        array->file_offset = offset + padding;
+        array->data = msgpack::type::raw_ref();
+        offset += padding + num_bytes;
+    }
+    if (fclose(file) != 0 || !success) {
+        utility::filesystem::RemoveFile(filename);
+        LogError("MoveArraysToSharedMemory: unable to write {}", filename);
+    }
+    return filename;
+}
+
+std::vector<std::shared_ptr<core::Blob>> MapSharedMemoryArrays(
+        messages::MeshData& data) {
+    std::vector<std::shared_ptr<core::Blob>> blobs;
+    // Arrays of the same file share one mapping.
+    std::map<std::string, std::vector<messages::Array*>> file_arrays;
+    for (messages::Array* array : GetArrays(data)) {
+        if (!array->file.empty()) {
+            file_arrays[array->file].push_back(array);
+        }
+    }
+    for (const auto& item : file_arrays) {
+        // Only files created by MoveArraysToSharedMemory() are mapped.
+        const std::string& filename = item.first;
+        if (utility::filesystem::GetFileParentDirectory(filename) !=
+                    SharedMemoryDirectory() ||
+            utility::filesystem::GetFileNameWithoutDirectory(filename).rfind(
+                    kSharedMemoryPrefix, 0) != 0) {
+            LogError("MapSharedMemoryArrays: invalid file {}", filename);
+        }
+        int64_t size = 0;
+        for (const messages::Array* array : item.second) {
+            if (array->file_offset < 0) {
+                LogError("MapSharedMemoryArrays: invalid offset {}",
+                         array->file_offset);
+            }
+            size = std::max(size, array->file_offset + array->NumBytes());
+        }
+        std::shared_ptr<core::Blob> blob =
+                core::MapFile(filename, 0, size, /*copy_on_write=*/false);
+        for (messages::Array* array : item.second) {
+            const int64_t num_bytes = array->NumBytes();
+            array->data.ptr =
+                    static_cast<const char*>(blob->GetDataPtr()) +
+                    array->file_offset;
+            array->data.size = uint32_t(std::min<int64_t>(
+                    num_bytes, std::numeric_limits<uint32_t>::max()));
+        }
+        blobs.push_back(blob);
+    }
+    return blobs;
+}
+
 }  // namespace rpc
 }  // namespace io
 }  // namespace open3d
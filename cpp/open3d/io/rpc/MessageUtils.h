@@ -26,6 +26,10 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "open3d/io/rpc/ReceiverBase.h"
 
 namespace zmq {
@@ -33,12 +37,17 @@ class message_t;
 }
 
 namespace open3d {
+namespace core {
+class Blob;
+}
+
 namespace io {
 namespace rpc {
 
 namespace messages {
+struct MeshData;
 struct Status;
-}
+}  // namespace messages
 
 /// Helper function for unpacking the Status message from a reply.
 /// \param msg     The message that contains the Reply and the Status messages.
@@ -74,6 +83,24 @@ std::tuple<int32_t, std::string> GetStatusCodeAndStr(
 
 std::shared_ptr<zmq::message_t> CreateStatusOKMsg();
 
+/// Moves the data of the arrays of \p data with at least \p min_bytes bytes
+/// into a new shared memory file, which receivers on the same host map
+/// instead of unpacking the data from the message. This avoids the size limit
+/// of messages for large arrays.
+///
+/// \return The name of the file, empty if no array was moved. The sender
+/// removes the file once the reply is received.
+std::string MoveArraysToSharedMemory(messages::MeshData& data,
+                                     size_t min_bytes);
+
+/// Maps the arrays of \p data stored in shared memory files by
+/// MoveArraysToSharedMemory() and points their data to the mappings.
+///
+/// \return The mapped files, which must be kept alive while the arrays are
+/// used.
+std::vector<std::shared_ptr<core::Blob>> MapSharedMemoryArrays(
+        messages::MeshData& data);
+
 }  // namespace rpc
 }  // namespace io
 }  // namespace open3d
@@ -101,6 +101,12 @@ inline std::string TypeStr<uint64_t>() {
 /// because they use bin-type for the map keys and we must use string.
 /// This structure does not have ownership of the data.
 ///
+/// Instead of in 'data', the data can be stored in a shared memory file of a
+/// sender on the same host, see MoveArraysToSharedMemory().
+///
+/// If 'encodings' is not empty, 'data' is encoded and must be decoded with
+/// DecodeArrays() before use. 'type' and 'shape' describe the decoded array.
+///
 /// The following code can be used in python to create a compatible dict
 ///
 ///   def numpy_to_Array(arr):
@@ -135,12 +141,27 @@ struct Array {
     std::string type;
     std::vector<int64_t> shape;
     msgpack::type::raw_ref data;
+    /// If not empty, the data is stored in this file at byte file_offset.
+    std::string file;
+    int64_t file_offset = 0;
+    /// The encodings applied to the data in order, see EncodeArrays().
+    std::vector<std::string> encodings;
+    /// Parameters of the encodings, e.g., the quantization bounding box.
+    std::vector<double> encoding_params;
 
     template <class T>
     const T* Ptr() const {
         return (T*)data.ptr;
     }
 
+    /// Returns the number of bytes of the data given by the type and shape.
+    int64_t NumBytes() const {
+        if (type.size() < 3) return 0;
+        int64_t num = std::stoll(type.substr(2));
+        for (int64_t n : shape) num *= n;
+        return num;
+    }
+
     /// Checks the rank of the shape.
     /// Returns false on mismatch and appends an error description to errstr.
     bool CheckRank(const std::vector<int>& expected_ranks,
@@ -242,7 +263,8 @@ struct Array {
     }
 
     // macro for creating the serialization/deserialization code
-    MSGPACK_DEFINE_MAP(type, shape, data);
+    MSGPACK_DEFINE_MAP(
+            type, shape, data, file, file_offset, encodings, encoding_params);
 };
 
 /// struct for storing MeshData, e.g., PointClouds, TriangleMesh, ..
@@ -459,10 +481,12 @@ struct SetProperties {
 };
 
 /// struct for defining a "request" message, which describes the subsequent
-/// message by storing the msg_id.
+/// message by storing the msg_id and the array encodings the receiver must
+/// support to decode it.
 struct Request {
     std::string msg_id;
-    MSGPACK_DEFINE_MAP(msg_id);
+    std::vector<std::string> encodings;
+    MSGPACK_DEFINE_MAP(msg_id, encodings);
 };
 
 /// struct for defining a "reply" message, which describes the subsequent
@@ -489,6 +513,9 @@ struct Status {
     static Status ErrorProcessingMessage() {
         return Status(3, "error while processing message");
     }
+    static Status ErrorUnsupportedEncoding() {
+        return Status(4, "unsupported array encoding");
+    }
 
     /// return code. 0 means everything is OK.
     int32_t code;
@@ -28,6 +28,11 @@
 
 #include <zmq.hpp>
 
+#include <algorithm>
+
+#include "open3d/core/Blob.h"
+#include "open3d/io/rpc/ArrayEncoding.h"
+#include "open3d/io/rpc/MessageUtils.h"
 #include "open3d/io/rpc/Messages.h"
 #include "open3d/io/rpc/ZMQContext.h"
 
@@ -45,6 +50,21 @@ std::shared_ptr<zmq::message_t> CreateStatusMessage(
 
     return msg;
 }
+
+/// Maps the arrays of messages stored in shared memory files and decodes
+/// encoded arrays.
+template <class T>
+std::vector<std::shared_ptr<open3d::core::Blob>> MapMessageArrays(T&) {
+    return {};
+}
+
+std::vector<std::shared_ptr<open3d::core::Blob>> MapMessageArrays(
+        open3d::io::rpc::messages::SetMeshData& msg) {
+    auto blobs = open3d::io::rpc::MapSharedMemoryArrays(msg.data);
+    auto decoded = open3d::io::rpc::DecodeArrays(msg.data);
+    blobs.insert(blobs.end(), decoded.begin(), decoded.end());
+    return blobs;
+}
 }  // namespace
 
 namespace open3d {
@@ -168,6 +188,19 @@ void ReceiverBase::Mainloop() {
                     auto obj = obj_handle.get();
                     req = obj.as<messages::Request>();
 
+                    const auto unsupported_encoding = std::find_if_not(
+                            req.encodings.begin(), req.encodings.end(),
+                            IsSupportedArrayEncoding);
+                    if (unsupported_encoding != req.encodings.end()) {
+                        LogInfo("ReceiverBase::Mainloop: unsupported array "
+                                "encoding '{}'",
+                                *unsupported_encoding);
+                        auto status =
+                                messages::Status::ErrorUnsupportedEncoding();
+                        replies.push_back(CreateStatusMessage(status));
+                        break;
+                    }
+
                     if (false) {
                     }
 #define PROCESS_MESSAGE(MSGTYPE)                                        \
@@ -177,6 +210,7 @@ void ReceiverBase::Mainloop() {
         auto obj = oh.get();                                            \
         MSGTYPE msg;                                                    \
         msg = obj.as<MSGTYPE>();                                        \
+        auto mapped_files = MapMessageArrays(msg);                      \
         auto reply = ProcessMessage(req, msg, MsgpackObject(obj));      \
         if (reply) {                                                    \
             replies.push_back(reply);                                   \
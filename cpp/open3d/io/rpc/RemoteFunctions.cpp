@@ -29,10 +29,14 @@
 #include <Eigen/Geometry>
 #include <zmq.hpp>
 
+#include <cstdlib>
+
 #include "open3d/core/Dispatch.h"
+#include "open3d/io/rpc/ArrayEncoding.h"
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/MessageUtils.h"
 #include "open3d/io/rpc/Messages.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 
 using namespace open3d::utility;
@@ -41,6 +45,57 @@ namespace open3d {
 namespace io {
 namespace rpc {
 
+namespace {
+
+/// Packs the request and \p msg and sends them, returning true if the reply
+/// is OK. \p encodings are the array encodings used in \p msg.
+template <class Message>
+bool SendRequest(const Message& msg,
+                 std::shared_ptr<ConnectionBase> connection,
+                 const std::vector<std::string>& encodings = {}) {
+    msgpack::sbuffer sbuf;
+    messages::Request request{msg.MsgId(), encodings};
+    msgpack::pack(sbuf, request);
+    msgpack::pack(sbuf, msg);
+
+    // The zmq message takes over the packed buffer instead of copying it.
+    const size_t size = sbuf.size();
+    zmq::message_t send_msg(sbuf.release(), size,
+                            [](void* data, void*) { free(data); });
+    if (!connection) {
+        connection = std::shared_ptr<Connection>(new Connection());
+    }
+    auto reply = connection->Send(send_msg);
+    return ReplyIsOKStatus(*reply);
+}
+
+/// Sends \p msg, passing large arrays through shared memory if the
+/// connection supports it and encoding the remaining arrays with the array
+/// encoding options of the connection.
+bool SendMeshData(messages::SetMeshData& msg,
+                  std::shared_ptr<ConnectionBase> connection) {
+    if (!connection) {
+        connection = std::shared_ptr<Connection>(new Connection());
+    }
+    const std::string shared_memory_file = MoveArraysToSharedMemory(
+            msg.data, connection->GetSharedMemoryThreshold());
+    std::vector<std::vector<char>> encoded_buffers;
+    std::vector<std::string> encodings;
+    if (connection->GetArrayEncodingOptions().IsEnabled()) {
+        encodings = EncodeArrays(msg.data,
+                                 connection->GetArrayEncodingOptions(),
+                                 encoded_buffers);
+    }
+    const bool success = SendRequest(msg, connection, encodings);
+    // The receiver has processed the message once it replied.
+    if (!shared_memory_file.empty()) {
+        utility::filesystem::RemoveFile(shared_memory_file);
+    }
+    return success;
+}
+
+}  // namespace
+
 bool SetPointCloud(const geometry::PointCloud& pcd,
                    const std::string& path,
                    int time,
@@ -69,17 +124,7 @@ bool SetPointCloud(const geometry::PointCloud& pcd,
                 (double*)pcd.colors_.data(), {int64_t(pcd.colors_.size()), 3});
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendMeshData(msg, connection);
 }
 
 bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
@@ -147,17 +192,7 @@ bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendMeshData(msg, connection);
 }
 
 bool SetMeshData(const core::Tensor& vertices,
@@ -301,17 +336,7 @@ bool SetMeshData(const core::Tensor& vertices,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendMeshData(msg, connection);
 }
 
 bool SetLegacyCamera(const camera::PinholeCameraParameters& camera,
@@ -358,34 +383,14 @@ bool SetLegacyCamera(const camera::PinholeCameraParameters& camera,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendRequest(msg, connection);
 }
 
 bool SetTime(int time, std::shared_ptr<ConnectionBase> connection) {
     messages::SetTime msg;
     msg.time = time;
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendRequest(msg, connection);
 }
 
 bool SetActiveCamera(const std::string& path,
@@ -393,17 +398,7 @@ bool SetActiveCamera(const std::string& path,
     messages::SetActiveCamera msg;
     msg.path = path;
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendRequest(msg, connection);
 }
 
 }  // namespace rpc
@@ -49,10 +49,13 @@ namespace open3d {
 namespace io {
 
 AzureKinectRecorder::AzureKinectRecorder(
-        const AzureKinectSensorConfig& sensor_config, size_t sensor_index)
+        const AzureKinectSensorConfig& sensor_config,
+        size_t sensor_index,
+        size_t max_queued_frames)
     : RGBDRecorder(),
       sensor_(AzureKinectSensor(sensor_config)),
-      device_index_(sensor_index) {}
+      device_index_(sensor_index),
+      max_queued_frames_(std::max(max_queued_frames, size_t(1))) {}
 
 AzureKinectRecorder::~AzureKinectRecorder() { CloseRecord(); }
 
@@ -77,6 +80,10 @@ bool AzureKinectRecorder::OpenRecord(const std::string& filename) {
         utility::LogInfo("Writing to header");
 
         is_record_created_ = true;
+        statistics_ = RecordStatistics();
+        total_latency_ms_ = 0.0;
+        stop_writer_ = false;
+        writer_thread_ = std::thread(&AzureKinectRecorder::RunWriter, this);
     }
     return true;
 }
@@ -84,6 +91,15 @@ bool AzureKinectRecorder::OpenRecord(const std::string& filename) {
 bool AzureKinectRecorder::CloseRecord() {
     if (is_record_created_) {
         utility::LogInfo("Saving recording...");
+        // The writer thread writes the queued frames before it stops.
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            stop_writer_ = true;
+        }
+        queue_not_empty_.notify_one();
+        if (writer_thread_.joinable()) {
+            writer_thread_.join();
+        }
         if (K4A_FAILED(k4a_plugin::k4a_record_flush(recording_))) {
             utility::LogWarning("Unable to flush record file");
             return false;
@@ -100,10 +116,7 @@ std::shared_ptr<geometry::RGBDImage> AzureKinectRecorder::RecordFrame(
         bool write, bool enable_align_depth_to_color) {
     k4a_capture_t capture = sensor_.CaptureRawFrame();
     if (capture != nullptr && is_record_created_ && write) {
-        if (K4A_FAILED(k4a_plugin::k4a_record_write_capture(recording_,
-                                                            capture))) {
-            utility::LogError("Unable to write to capture");
-        }
+        QueueCapture(capture);
     }
 
     auto im_rgbd = AzureKinectSensor::DecompressCapture(
@@ -117,5 +130,65 @@ std::shared_ptr<geometry::RGBDImage> AzureKinectRecorder::RecordFrame(
     k4a_plugin::k4a_capture_release(capture);
     return im_rgbd;
 }
+
+RecordStatistics AzureKinectRecorder::GetRecordStatistics() const {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    RecordStatistics statistics = statistics_;
+    statistics.queue_size = queue_.size();
+    return statistics;
+}
+
+void AzureKinectRecorder::QueueCapture(k4a_capture_t capture) {
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        if (queue_.size() >= max_queued_frames_) {
+            ++statistics_.num_frames_dropped;
+            return;
+        }
+        // The writer thread releases its reference once written.
+        k4a_plugin::k4a_capture_reference(capture);
+        queue_.push_back({capture, std::chrono::steady_clock::now()});
+        ++statistics_.num_frames_queued;
+    }
+    queue_not_empty_.notify_one();
+}
+
+void AzureKinectRecorder::RunWriter() {
+    while (true) {
+        QueuedCapture queued;
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            queue_not_empty_.wait(
+                    lock, [this] { return !queue_.empty() || stop_writer_; });
+            if (queue_.empty()) {
+                return;
+            }
+            queued = queue_.front();
+            queue_.pop_front();
+        }
+
+        const bool success = K4A_SUCCEEDED(
+                k4a_plugin::k4a_record_write_capture(recording_,
+                                                     queued.capture));
+        k4a_plugin::k4a_capture_release(queued.capture);
+        const double latency_ms =
+                std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - queued.queued)
+                        .count();
+
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        if (success) {
+            ++statistics_.num_frames_written;
+            total_latency_ms_ += latency_ms;
+            statistics_.mean_latency_ms =
+                    total_latency_ms_ / statistics_.num_frames_written;
+            statistics_.max_latency_ms =
+                    std::max(statistics_.max_latency_ms, latency_ms);
+        } else {
+            utility::LogWarning("Unable to write to capture");
+            ++statistics_.num_frames_dropped;
+        }
+    }
+}
 }  // namespace io
 }  // namespace open3d
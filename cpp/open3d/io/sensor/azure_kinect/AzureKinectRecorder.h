@@ -27,14 +27,20 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include "open3d/io/sensor/RGBDRecorder.h"
 #include "open3d/io/sensor/azure_kinect/AzureKinectSensor.h"
 #include "open3d/io/sensor/azure_kinect/AzureKinectSensorConfig.h"
 
-struct _k4a_record_t;  // typedef _k4a_record_t* k4a_record_t;
+struct _k4a_record_t;   // typedef _k4a_record_t* k4a_record_t;
+struct _k4a_capture_t;  // typedef _k4a_capture_t* k4a_capture_t;
 
 namespace open3d {
 
@@ -45,13 +51,35 @@ class Image;
 
 namespace io {
 
+/// Statistics of the frames recorded by AzureKinectRecorder since
+/// OpenRecord().
+struct RecordStatistics {
+    /// Frames handed to the writer thread.
+    size_t num_frames_queued = 0;
+    /// Frames written to the mkv file.
+    size_t num_frames_written = 0;
+    /// Frames dropped because the queue was full or writing failed.
+    size_t num_frames_dropped = 0;
+    /// Frames currently waiting to be written.
+    size_t queue_size = 0;
+    /// Mean and maximum time (in ms) from queuing a frame to having it
+    /// written.
+    double mean_latency_ms = 0.0;
+    double max_latency_ms = 0.0;
+};
+
 /// \class AzureKinectRecorder
 ///
 /// AzureKinect recorder.
+///
+/// Frames are written to the mkv file by a writer thread, so that stalls of
+/// the disk do not delay the capture. Up to \p max_queued_frames frames wait
+/// for the writer, further frames are dropped.
 class AzureKinectRecorder : public RGBDRecorder {
 public:
     AzureKinectRecorder(const AzureKinectSensorConfig& sensor_config,
-                        size_t sensor_index);
+                        size_t sensor_index,
+                        size_t max_queued_frames = 30);
     ~AzureKinectRecorder() override;
 
     /// Initialize sensor.
@@ -60,7 +88,7 @@ public:
     ///
     /// \param filename Path to the mkv file.
     bool OpenRecord(const std::string& filename) override;
-    /// Close the recorded mkv file.
+    /// Write the queued frames and close the recorded mkv file.
     bool CloseRecord() override;
     /// Record a frame to mkv if flag is on and return an RGBD object.
     ///
@@ -73,12 +101,35 @@ public:
     /// Check if the mkv file is created.
     bool IsRecordCreated() { return is_record_created_; }
 
+    /// Get the statistics of the frames recorded to the current or last mkv
+    /// file.
+    RecordStatistics GetRecordStatistics() const;
+
 protected:
+    /// Queues \p capture for the writer thread, or drops it if the queue is
+    /// full.
+    void QueueCapture(_k4a_capture_t* capture);
+    void RunWriter();
+
     AzureKinectSensor sensor_;
     _k4a_record_t* recording_;
     size_t device_index_;
 
     bool is_record_created_ = false;
+
+    size_t max_queued_frames_;
+    mutable std::mutex queue_mutex_;
+    std::condition_variable queue_not_empty_;
+    struct QueuedCapture {
+        _k4a_capture_t* capture;
+        std::chrono::steady_clock::time_point queued;
+    };
+    /// Captures waiting to be written, oldest first.
+    std::deque<QueuedCapture> queue_;
+    bool stop_writer_ = false;
+    RecordStatistics statistics_;
+    double total_latency_ms_ = 0.0;
+    std::thread writer_thread_;
 };
 
 }  // namespace io
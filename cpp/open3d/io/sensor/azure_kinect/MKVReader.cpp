@@ -40,7 +40,12 @@
 namespace open3d {
 namespace io {
 
-MKVReader::MKVReader() : handle_(nullptr), transformation_(nullptr) {}
+MKVReader::MKVReader(size_t prefetch_frames)
+    : handle_(nullptr),
+      transformation_(nullptr),
+      prefetch_frames_(prefetch_frames) {}
+
+MKVReader::~MKVReader() { StopPrefetch(); }
 
 bool MKVReader::IsOpened() { return handle_ != nullptr; }
 
@@ -72,11 +77,15 @@ bool MKVReader::Open(const std::string &filename) {
 
     metadata_.ConvertFromJsonValue(GetMetadataJson());
     is_eof_ = false;
+    StartPrefetch();
 
     return true;
 }
 
-void MKVReader::Close() { k4a_plugin::k4a_playback_close(handle_); }
+void MKVReader::Close() {
+    StopPrefetch();
+    k4a_plugin::k4a_playback_close(handle_);
+}
 
 Json::Value MKVReader::GetMetadataJson() {
     static const std::unordered_map<std::string, std::pair<int, int>>
@@ -146,26 +155,47 @@ bool MKVReader::SeekTimestamp(size_t timestamp) {
         return false;
     }
 
-    if (K4A_RESULT_SUCCEEDED !=
-        k4a_plugin::k4a_playback_seek_timestamp(handle_, timestamp,
-                                                K4A_PLAYBACK_SEEK_BEGIN)) {
+    // The prefetched frames are dropped.
+    StopPrefetch();
+    const bool success =
+            K4A_RESULT_SUCCEEDED ==
+            k4a_plugin::k4a_playback_seek_timestamp(handle_, timestamp,
+                                                    K4A_PLAYBACK_SEEK_BEGIN);
+    StartPrefetch();
+    if (!success) {
         utility::LogWarning("Unable to go to timestamp {}", timestamp);
-        return false;
     }
-    return true;
+    return success;
 }
 
 std::shared_ptr<geometry::RGBDImage> MKVReader::NextFrame() {
     if (!IsOpened()) {
         utility::LogError("Null file handler. Please call Open().");
     }
+    if (!prefetch_thread_.joinable()) {
+        return DecodeNextFrame(is_eof_);
+    }
+
+    std::unique_lock<std::mutex> lock(prefetch_mutex_);
+    not_empty_.wait(lock, [this] { return !frames_.empty() || prefetch_eof_; });
+    if (frames_.empty()) {
+        is_eof_ = true;
+        return nullptr;
+    }
+    auto rgbd = std::move(frames_.front());
+    frames_.pop_front();
+    lock.unlock();
+    not_full_.notify_one();
+    return rgbd;
+}
 
+std::shared_ptr<geometry::RGBDImage> MKVReader::DecodeNextFrame(bool &eof) {
     k4a_capture_t k4a_capture;
     k4a_stream_result_t res =
             k4a_plugin::k4a_playback_get_next_capture(handle_, &k4a_capture);
     if (K4A_STREAM_RESULT_EOF == res) {
         utility::LogInfo("EOF reached");
-        is_eof_ = true;
+        eof = true;
         return nullptr;
     } else if (K4A_STREAM_RESULT_FAILED == res) {
         utility::LogInfo("Empty frame encountered, skip");
@@ -178,5 +208,54 @@ std::shared_ptr<geometry::RGBDImage> MKVReader::NextFrame() {
 
     return rgbd;
 }
+
+void MKVReader::StartPrefetch() {
+    if (prefetch_frames_ == 0) {
+        return;
+    }
+    frames_.clear();
+    prefetch_eof_ = false;
+    stop_prefetch_ = false;
+    prefetch_thread_ = std::thread(&MKVReader::RunPrefetch, this);
+}
+
+void MKVReader::StopPrefetch() {
+    if (!prefetch_thread_.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(prefetch_mutex_);
+        stop_prefetch_ = true;
+    }
+    not_full_.notify_one();
+    prefetch_thread_.join();
+    frames_.clear();
+}
+
+void MKVReader::RunPrefetch() {
+    bool eof = false;
+    while (!eof) {
+        {
+            std::unique_lock<std::mutex> lock(prefetch_mutex_);
+            not_full_.wait(lock, [this] {
+                return frames_.size() < prefetch_frames_ || stop_prefetch_;
+            });
+            if (stop_prefetch_) {
+                return;
+            }
+        }
+        // Empty captures are handed over as nullptr like without
+        // prefetching.
+        auto rgbd = DecodeNextFrame(eof);
+        {
+            std::lock_guard<std::mutex> lock(prefetch_mutex_);
+            if (!eof) {
+                frames_.push_back(std::move(rgbd));
+            }
+            prefetch_eof_ = eof;
+        }
+        not_empty_.notify_one();
+    }
+}
 }  // namespace io
 }  // namespace open3d
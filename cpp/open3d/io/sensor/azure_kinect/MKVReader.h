@@ -26,6 +26,12 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/io/sensor/azure_kinect/MKVMetadata.h"
 #include "open3d/utility/IJsonConvertible.h"
@@ -41,11 +47,20 @@ namespace io {
 /// \class MKVReader
 ///
 /// AzureKinect mkv file reader.
+///
+/// With prefetching, a background thread decodes up to \p prefetch_frames
+/// frames ahead of NextFrame(), so that decoding overlaps with processing.
 class MKVReader {
 public:
-    /// \brief Default Constructor.
-    MKVReader();
-    virtual ~MKVReader() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param prefetch_frames Number of frames decoded ahead of NextFrame()
+    /// by a background thread. 0 decodes in NextFrame().
+    explicit MKVReader(size_t prefetch_frames = 0);
+    virtual ~MKVReader();
+
+    MKVReader(const MKVReader &) = delete;
+    MKVReader &operator=(const MKVReader &) = delete;
 
     /// Check If the mkv file is opened.
     bool IsOpened();
@@ -67,11 +82,28 @@ public:
     std::shared_ptr<geometry::RGBDImage> NextFrame();
 
 private:
+    /// Decodes the next capture, nullptr if it is empty or at the end.
+    std::shared_ptr<geometry::RGBDImage> DecodeNextFrame(bool &eof);
+    void StartPrefetch();
+    void StopPrefetch();
+    void RunPrefetch();
+
     _k4a_playback_t *handle_;
     _k4a_transformation_t *transformation_;
     MKVMetadata metadata_;
     bool is_eof_ = false;
 
+    size_t prefetch_frames_;
+    std::mutex prefetch_mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+    /// Decoded frames waiting for NextFrame().
+    std::deque<std::shared_ptr<geometry::RGBDImage>> frames_;
+    /// Set by the prefetch thread once the playback has no more captures.
+    bool prefetch_eof_ = false;
+    bool stop_prefetch_ = false;
+    std::thread prefetch_thread_;
+
     Json::Value GetMetadataJson();
     std::string GetTagInMetadata(const std::string &tag_name);
 };
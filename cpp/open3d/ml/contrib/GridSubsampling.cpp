@@ -28,6 +28,28 @@ namespace open3d {
 namespace ml {
 namespace contrib {
 
+namespace {
+
+/// Returns the most frequent label in [begin, end). Ties are resolved in
+/// favor of the smallest label.
+int MostFrequentLabel(std::vector<int>::iterator begin,
+                      std::vector<int>::iterator end) {
+    std::sort(begin, end);
+    int best_label = *begin;
+    int64_t best_count = 0;
+    for (auto it = begin; it != end;) {
+        auto next = std::upper_bound(it, end, *it);
+        if (next - it > best_count) {
+            best_label = *it;
+            best_count = next - it;
+        }
+        it = next;
+    }
+    return best_label;
+}
+
+}  // namespace
+
 void grid_subsampling(std::vector<PointXYZ>& original_points,
                       std::vector<PointXYZ>& subsampled_points,
                       std::vector<float>& original_features,
@@ -40,11 +62,12 @@ void grid_subsampling(std::vector<PointXYZ>& original_points,
     // ******************
 
     // Number of points in the cloud
-    size_t N = original_points.size();
+    const int64_t N = static_cast<int64_t>(original_points.size());
+    if (N == 0) return;
 
     // Dimension of the features
-    size_t fdim = original_features.size() / N;
-    size_t ldim = original_classes.size() / N;
+    const size_t fdim = original_features.size() / N;
+    const size_t ldim = original_classes.size() / N;
 
     // Limits of the cloud
     PointXYZ minCorner = min_point(original_points);
@@ -57,83 +80,97 @@ void grid_subsampling(std::vector<PointXYZ>& original_points,
             (size_t)floor((maxCorner.x - originCorner.x) / sampleDl) + 1;
     size_t sampleNY =
             (size_t)floor((maxCorner.y - originCorner.y) / sampleDl) + 1;
-    // size_t sampleNZ = (size_t)floor((maxCorner.z - originCorner.z) /
-    // sampleDl) + 1;
 
     // Check if features and classes need to be processed
     bool use_feature = original_features.size() > 0;
     bool use_classes = original_classes.size() > 0;
 
-    // Create the sampled map
-    // **********************
-
-    // Verbose parameters
-    int i = 0;
-    int nDisp = static_cast<int>(N / 100);
-
-    // Initialize variables
-    std::unordered_map<size_t, SampledData> data;
-
-    for (auto& p : original_points) {
-        size_t iX, iY, iZ, mapIdx;
-
-        // Position of point in sample map
-        iX = (size_t)std::floor((p.x - originCorner.x) / sampleDl);
-        iY = (size_t)std::floor((p.y - originCorner.y) / sampleDl);
-        iZ = (size_t)std::floor((p.z - originCorner.z) / sampleDl);
-        mapIdx = iX + sampleNX * iY + sampleNX * sampleNY * iZ;
-
-        // If not already created, create key
-        if (data.count(mapIdx) < 1)
-            data.emplace(mapIdx, SampledData(fdim, ldim));
-
-        // Fill the sample map
-        if (use_feature && use_classes)
-            data[mapIdx].update_all(p, original_features.begin() + i * fdim,
-                                    original_classes.begin() + i * ldim);
-        else if (use_feature)
-            data[mapIdx].update_features(p,
-                                         original_features.begin() + i * fdim);
-        else if (use_classes)
-            data[mapIdx].update_classes(p, original_classes.begin() + i * ldim);
-        else
-            data[mapIdx].update_points(p);
-
-        // Display
-        i++;
-        if (verbose > 1 && i % nDisp == 0)
-            std::cout << "\rSampled Map : " << std::setw(3) << i / nDisp << "%";
+    // Sort the points by voxel
+    // ************************
+
+    std::vector<std::pair<size_t, int64_t>> keys(N);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < N; ++i) {
+        const PointXYZ& p = original_points[i];
+        size_t iX = (size_t)std::floor((p.x - originCorner.x) / sampleDl);
+        size_t iY = (size_t)std::floor((p.y - originCorner.y) / sampleDl);
+        size_t iZ = (size_t)std::floor((p.z - originCorner.z) / sampleDl);
+        keys[i] = std::make_pair(
+                iX + sampleNX * iY + sampleNX * sampleNY * iZ, i);
     }
+    std::sort(keys.begin(), keys.end());
 
-    // Divide for barycentre and transfer to a vector
-    subsampled_points.reserve(data.size());
-    if (use_feature) subsampled_features.reserve(data.size() * fdim);
-    if (use_classes) subsampled_classes.reserve(data.size() * ldim);
-    for (auto& v : data) {
-        subsampled_points.push_back(v.second.point * (1.0f / v.second.count));
-        if (use_feature) {
-            float count = (float)v.second.count;
-            transform(v.second.features.begin(), v.second.features.end(),
-                      v.second.features.begin(),
-                      [count](float f) { return f / count; });
-            subsampled_features.insert(subsampled_features.end(),
-                                       v.second.features.begin(),
-                                       v.second.features.end());
+    // The points of voxel v are keys[voxel_starts[v]:voxel_starts[v+1]]
+    std::vector<int64_t> voxel_starts;
+    for (int64_t i = 0; i < N; ++i) {
+        if (i == 0 || keys[i].first != keys[i - 1].first) {
+            voxel_starts.push_back(i);
         }
-        if (use_classes) {
-            for (int i = 0; i < static_cast<int>(ldim); i++)
-                subsampled_classes.push_back(
-                        max_element(v.second.labels[i].begin(),
-                                    v.second.labels[i].end(),
-                                    [](const std::pair<int, int>& a,
-                                       const std::pair<int, int>& b) {
-                                        return a.second < b.second;
-                                    })
-                                ->first);
+    }
+    voxel_starts.push_back(N);
+    const int64_t num_voxels = static_cast<int64_t>(voxel_starts.size()) - 1;
+
+    // Compute the barycenters
+    // ***********************
+
+    const size_t old_num_points = subsampled_points.size();
+    subsampled_points.resize(old_num_points + num_voxels);
+    if (use_feature) {
+        subsampled_features.resize(subsampled_features.size() +
+                                   num_voxels * fdim);
+    }
+    if (use_classes) {
+        subsampled_classes.resize(subsampled_classes.size() +
+                                  num_voxels * ldim);
+    }
+    PointXYZ* out_points = subsampled_points.data() + old_num_points;
+    float* out_features = subsampled_features.data() +
+                          subsampled_features.size() - num_voxels * fdim;
+    int* out_classes = subsampled_classes.data() + subsampled_classes.size() -
+                       num_voxels * ldim;
+
+#pragma omp parallel
+    {
+        std::vector<int> labels;
+#pragma omp for schedule(static)
+        for (int64_t v = 0; v < num_voxels; ++v) {
+            const int64_t begin = voxel_starts[v];
+            const int64_t end = voxel_starts[v + 1];
+            const float inv_count = 1.0f / float(end - begin);
+
+            PointXYZ point;
+            for (int64_t i = begin; i < end; ++i) {
+                point += original_points[keys[i].second];
+            }
+            out_points[v] = point * inv_count;
+
+            if (use_feature) {
+                float* feature = out_features + v * fdim;
+                std::fill(feature, feature + fdim, 0.0f);
+                for (int64_t i = begin; i < end; ++i) {
+                    const float* f =
+                            original_features.data() + keys[i].second * fdim;
+                    for (size_t c = 0; c < fdim; ++c) feature[c] += f[c];
+                }
+                for (size_t c = 0; c < fdim; ++c) feature[c] *= inv_count;
+            }
+            if (use_classes) {
+                for (size_t c = 0; c < ldim; ++c) {
+                    labels.clear();
+                    for (int64_t i = begin; i < end; ++i) {
+                        labels.push_back(
+                                original_classes[keys[i].second * ldim + c]);
+                    }
+                    out_classes[v * ldim + c] =
+                            MostFrequentLabel(labels.begin(), labels.end());
+                }
+            }
         }
     }
 
-    return;
+    if (verbose > 1) {
+        std::cout << "Sampled Map : " << num_voxels << " voxels" << std::endl;
+    }
 }
 
 void batch_grid_subsampling(std::vector<PointXYZ>& original_points,
@@ -149,11 +186,13 @@ void batch_grid_subsampling(std::vector<PointXYZ>& original_points,
     // Initialize variables
     // ******************
 
-    int b = 0;
-    int sum_b = 0;
-
     // Number of points in the cloud
     size_t N = original_points.size();
+    const int num_batches = static_cast<int>(original_batches.size());
+    if (N == 0) {
+        subsampled_batches.assign(num_batches, 0);
+        return;
+    }
 
     // Dimension of the features
     size_t fdim = original_features.size() / N;
@@ -162,82 +201,72 @@ void batch_grid_subsampling(std::vector<PointXYZ>& original_points,
     // Handle max_p = 0
     if (max_p < 1) max_p = static_cast<int>(N);
 
-    // Loop over batches
-    // *****************
+    // Subsample the batches in parallel
+    // *********************************
+
+    std::vector<int64_t> batch_starts(num_batches + 1, 0);
+    for (int b = 0; b < num_batches; b++) {
+        batch_starts[b + 1] = batch_starts[b] + original_batches[b];
+    }
+
+    std::vector<std::vector<PointXYZ>> b_s_points(num_batches);
+    std::vector<std::vector<float>> b_s_features(num_batches);
+    std::vector<std::vector<int>> b_s_classes(num_batches);
+
+#pragma omp parallel for schedule(dynamic)
+    for (int b = 0; b < num_batches; b++) {
+        const int64_t begin = batch_starts[b];
+        const int64_t end = batch_starts[b + 1];
 
-    for (b = 0; b < static_cast<int>(original_batches.size()); b++) {
         // Extract batch points features and labels
-        std::vector<PointXYZ> b_o_points = std::vector<PointXYZ>(
-                original_points.begin() + sum_b,
-                original_points.begin() + sum_b + original_batches[b]);
+        std::vector<PointXYZ> b_o_points(original_points.begin() + begin,
+                                         original_points.begin() + end);
 
         std::vector<float> b_o_features;
         if (original_features.size() > 0) {
             b_o_features = std::vector<float>(
-                    original_features.begin() + sum_b * fdim,
-                    original_features.begin() +
-                            (sum_b + original_batches[b]) * fdim);
+                    original_features.begin() + begin * fdim,
+                    original_features.begin() + end * fdim);
         }
 
         std::vector<int> b_o_classes;
         if (original_classes.size() > 0) {
-            b_o_classes =
-                    std::vector<int>(original_classes.begin() + sum_b * ldim,
-                                     original_classes.begin() + sum_b +
-                                             original_batches[b] * ldim);
+            b_o_classes = std::vector<int>(
+                    original_classes.begin() + begin * ldim,
+                    original_classes.begin() + end * ldim);
         }
 
-        // Create result containers
-        std::vector<PointXYZ> b_s_points;
-        std::vector<float> b_s_features;
-        std::vector<int> b_s_classes;
-
         // Compute subsampling on current batch
-        grid_subsampling(b_o_points, b_s_points, b_o_features, b_s_features,
-                         b_o_classes, b_s_classes, sampleDl, 0);
-
-        // Stack batches points features and labels
-        // ****************************************
+        grid_subsampling(b_o_points, b_s_points[b], b_o_features,
+                         b_s_features[b], b_o_classes, b_s_classes[b],
+                         sampleDl, 0);
 
         // If too many points remove some
-        if (static_cast<int>(b_s_points.size()) <= max_p) {
-            subsampled_points.insert(subsampled_points.end(),
-                                     b_s_points.begin(), b_s_points.end());
-
-            if (original_features.size() > 0)
-                subsampled_features.insert(subsampled_features.end(),
-                                           b_s_features.begin(),
-                                           b_s_features.end());
-
-            if (original_classes.size() > 0)
-                subsampled_classes.insert(subsampled_classes.end(),
-                                          b_s_classes.begin(),
-                                          b_s_classes.end());
-
-            subsampled_batches.push_back(static_cast<int>(b_s_points.size()));
-        } else {
-            subsampled_points.insert(subsampled_points.end(),
-                                     b_s_points.begin(),
-                                     b_s_points.begin() + max_p);
-
-            if (original_features.size() > 0)
-                subsampled_features.insert(subsampled_features.end(),
-                                           b_s_features.begin(),
-                                           b_s_features.begin() + max_p * fdim);
-
-            if (original_classes.size() > 0)
-                subsampled_classes.insert(subsampled_classes.end(),
-                                          b_s_classes.begin(),
-                                          b_s_classes.begin() + max_p * ldim);
-
-            subsampled_batches.push_back(max_p);
+        if (static_cast<int>(b_s_points[b].size()) > max_p) {
+            b_s_points[b].resize(max_p);
+            if (original_features.size() > 0) {
+                b_s_features[b].resize(max_p * fdim);
+            }
+            if (original_classes.size() > 0) {
+                b_s_classes[b].resize(max_p * ldim);
+            }
         }
-
-        // Stack new batch lengths
-        sum_b += original_batches[b];
     }
 
-    return;
+    // Stack batches points features and labels
+    // ****************************************
+
+    for (int b = 0; b < num_batches; b++) {
+        subsampled_points.insert(subsampled_points.end(),
+                                 b_s_points[b].begin(), b_s_points[b].end());
+        subsampled_features.insert(subsampled_features.end(),
+                                   b_s_features[b].begin(),
+                                   b_s_features[b].end());
+        subsampled_classes.insert(subsampled_classes.end(),
+                                  b_s_classes[b].begin(),
+                                  b_s_classes[b].end());
+        subsampled_batches.push_back(static_cast<int>(b_s_points[b].size()));
+    }
 }
 
 }  // namespace contrib
@@ -0,0 +1,190 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <thrust/device_vector.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include "open3d/ml/Helper.h"
+#include "open3d/ml/contrib/GridSubsampling.h"
+
+namespace open3d {
+namespace ml {
+namespace contrib {
+
+namespace {
+
+typedef thrust::tuple<int, int, int, int> VoxelKey;
+typedef thrust::tuple<float, float, float, int> PointSum;
+
+__global__ void ComputeVoxelKeysKernel(const float* points,
+                                       const int64_t* batch_starts,
+                                       int num_batches,
+                                       int64_t num_points,
+                                       float inv_voxel_size,
+                                       int* batch_ids,
+                                       int* voxel_x,
+                                       int* voxel_y,
+                                       int* voxel_z) {
+    const int64_t i = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (i >= num_points) return;
+
+    // the batch is the last one starting at or before i
+    int lo = 0, hi = num_batches - 1;
+    while (lo < hi) {
+        const int mid = (lo + hi + 1) / 2;
+        if (batch_starts[mid] <= i) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    batch_ids[i] = lo;
+    voxel_x[i] = int(floorf(points[3 * i + 0] * inv_voxel_size));
+    voxel_y[i] = int(floorf(points[3 * i + 1] * inv_voxel_size));
+    voxel_z[i] = int(floorf(points[3 * i + 2] * inv_voxel_size));
+}
+
+struct PointToSum {
+    const float* points;
+
+    __device__ PointSum operator()(int64_t i) const {
+        return PointSum(points[3 * i + 0], points[3 * i + 1], points[3 * i + 2],
+                        1);
+    }
+};
+
+struct AddPointSums {
+    __device__ PointSum operator()(const PointSum& a, const PointSum& b) const {
+        return PointSum(thrust::get<0>(a) + thrust::get<0>(b),
+                        thrust::get<1>(a) + thrust::get<1>(b),
+                        thrust::get<2>(a) + thrust::get<2>(b),
+                        thrust::get<3>(a) + thrust::get<3>(b));
+    }
+};
+
+}  // namespace
+
+void BatchGridSubsamplingCUDA(const float* points,
+                              int64_t num_points,
+                              const std::vector<int>& batches,
+                              float sampleDl,
+                              int max_p,
+                              std::vector<PointXYZ>& subsampled_points,
+                              std::vector<int>& subsampled_batches) {
+    const int num_batches = static_cast<int>(batches.size());
+    subsampled_batches.assign(num_batches, 0);
+    if (num_points == 0 || num_batches == 0) {
+        return;
+    }
+    if (max_p < 1) max_p = static_cast<int>(num_points);
+
+    std::vector<int64_t> batch_starts(num_batches, 0);
+    for (int b = 1; b < num_batches; ++b) {
+        batch_starts[b] = batch_starts[b - 1] + batches[b - 1];
+    }
+    thrust::device_vector<int64_t> batch_starts_device(batch_starts.begin(),
+                                                       batch_starts.end());
+
+    // Voxel keys of all points. The batch index is part of the key, so all
+    // batches are processed at once.
+    thrust::device_vector<int> batch_ids(num_points);
+    thrust::device_vector<int> voxel_x(num_points);
+    thrust::device_vector<int> voxel_y(num_points);
+    thrust::device_vector<int> voxel_z(num_points);
+    const int block_size = 256;
+    const int64_t num_blocks = (num_points + block_size - 1) / block_size;
+    ComputeVoxelKeysKernel<<<num_blocks, block_size>>>(
+            points, thrust::raw_pointer_cast(batch_starts_device.data()),
+            num_batches, num_points, 1.0f / sampleDl,
+            thrust::raw_pointer_cast(batch_ids.data()),
+            thrust::raw_pointer_cast(voxel_x.data()),
+            thrust::raw_pointer_cast(voxel_y.data()),
+            thrust::raw_pointer_cast(voxel_z.data()));
+    OPEN3D_ML_CUDA_CHECK(cudaGetLastError());
+
+    // Sort the point indices by voxel.
+    thrust::device_vector<int64_t> indices(num_points);
+    thrust::sequence(indices.begin(), indices.end());
+    auto keys_begin = thrust::make_zip_iterator(thrust::make_tuple(
+            batch_ids.begin(), voxel_x.begin(), voxel_y.begin(),
+            voxel_z.begin()));
+    thrust::sort_by_key(keys_begin, keys_begin + num_points, indices.begin());
+
+    // Sum the points of each voxel.
+    thrust::device_vector<int> voxel_batch_ids(num_points);
+    thrust::device_vector<float> sum_x(num_points);
+    thrust::device_vector<float> sum_y(num_points);
+    thrust::device_vector<float> sum_z(num_points);
+    thrust::device_vector<int> counts(num_points);
+    auto sums_begin = thrust::make_transform_iterator(indices.begin(),
+                                                      PointToSum{points});
+    auto out_keys = thrust::make_zip_iterator(thrust::make_tuple(
+            voxel_batch_ids.begin(), thrust::make_discard_iterator(),
+            thrust::make_discard_iterator(), thrust::make_discard_iterator()));
+    auto out_sums = thrust::make_zip_iterator(thrust::make_tuple(
+            sum_x.begin(), sum_y.begin(), sum_z.begin(), counts.begin()));
+    auto ends = thrust::reduce_by_key(
+            keys_begin, keys_begin + num_points, sums_begin, out_keys,
+            out_sums, thrust::equal_to<VoxelKey>(), AddPointSums());
+    const int64_t num_voxels = ends.second - out_sums;
+
+    // Copy the barycenters to the host and stack the batches.
+    std::vector<int> voxel_batch_ids_host(num_voxels);
+    std::vector<float> sum_x_host(num_voxels);
+    std::vector<float> sum_y_host(num_voxels);
+    std::vector<float> sum_z_host(num_voxels);
+    std::vector<int> counts_host(num_voxels);
+    thrust::copy(voxel_batch_ids.begin(), voxel_batch_ids.begin() + num_voxels,
+                 voxel_batch_ids_host.begin());
+    thrust::copy(sum_x.begin(), sum_x.begin() + num_voxels,
+                 sum_x_host.begin());
+    thrust::copy(sum_y.begin(), sum_y.begin() + num_voxels,
+                 sum_y_host.begin());
+    thrust::copy(sum_z.begin(), sum_z.begin() + num_voxels,
+                 sum_z_host.begin());
+    thrust::copy(counts.begin(), counts.begin() + num_voxels,
+                 counts_host.begin());
+
+    subsampled_points.reserve(subsampled_points.size() + num_voxels);
+    for (int64_t v = 0; v < num_voxels; ++v) {
+        const int b = voxel_batch_ids_host[v];
+        if (subsampled_batches[b] >= max_p) continue;
+        const float inv_count = 1.0f / float(counts_host[v]);
+        subsampled_points.push_back(PointXYZ(sum_x_host[v] * inv_count,
+                                             sum_y_host[v] * inv_count,
+                                             sum_z_host[v] * inv_count));
+        ++subsampled_batches[b];
+    }
+}
+
+}  // namespace contrib
+}  // namespace ml
+}  // namespace open3d
@@ -122,6 +122,30 @@ void batch_grid_subsampling(std::vector<PointXYZ>& original_points,
                             float sampleDl,
                             int max_p);
 
+#ifdef BUILD_CUDA_MODULE
+/// CUDA version of batch_grid_subsampling for points without features and
+/// classes. All batches are subsampled at once by sorting the points by
+/// batch and voxel.
+///
+/// \param points (num_points, 3) float32 in device memory.
+/// \param num_points The number of points.
+/// \param batches The number of points of each batch.
+/// \param sampleDl The voxel size.
+/// \param max_p The maximum number of points per batch. 0 disables the
+/// limit.
+/// \param subsampled_points The barycenters of the occupied voxels are
+/// appended to this vector.
+/// \param subsampled_batches Returns the number of subsampled points of each
+/// batch.
+void BatchGridSubsamplingCUDA(const float* points,
+                              int64_t num_points,
+                              const std::vector<int>& batches,
+                              float sampleDl,
+                              int max_p,
+                              std::vector<PointXYZ>& subsampled_points,
+                              std::vector<int>& subsampled_batches);
+#endif
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "open3d/ml/contrib/IoU.h"
 
+#include <tbb/blocked_range2d.h>
 #include <tbb/parallel_for.h>
 
 #include "open3d/ml/contrib/IoUImpl.h"
@@ -39,14 +40,20 @@ void IoUBevCPUKernel(const float *boxes_a,
                      float *iou,
                      int num_a,
                      int num_b) {
-    tbb::parallel_for(0, num_a, [&](int idx_a) {
-        tbb::parallel_for(0, num_b, [&](int idx_b) {
-            const float *box_a = boxes_a + idx_a * 5;
-            const float *box_b = boxes_b + idx_b * 5;
-            float *out = iou + idx_a * num_b + idx_b;
-            *out = IoUBev2DWithCenterAndSize(box_a, box_b);
-        });
-    });
+    tbb::parallel_for(
+            tbb::blocked_range2d<int>(0, num_a, 0, num_b),
+            [&](const tbb::blocked_range2d<int> &r) {
+                for (int idx_a = r.rows().begin(); idx_a != r.rows().end();
+                     ++idx_a) {
+                    const float *box_a = boxes_a + idx_a * 5;
+                    for (int idx_b = r.cols().begin(); idx_b != r.cols().end();
+                         ++idx_b) {
+                        const float *box_b = boxes_b + idx_b * 5;
+                        iou[int64_t(idx_a) * num_b + idx_b] =
+                                IoUBev2DWithCenterAndSize(box_a, box_b);
+                    }
+                }
+            });
 }
 
 void IoU3dCPUKernel(const float *boxes_a,
@@ -54,14 +61,20 @@ void IoU3dCPUKernel(const float *boxes_a,
                     float *iou,
                     int num_a,
                     int num_b) {
-    tbb::parallel_for(0, num_a, [&](int idx_a) {
-        tbb::parallel_for(0, num_b, [&](int idx_b) {
-            const float *box_a = boxes_a + idx_a * 7;
-            const float *box_b = boxes_b + idx_b * 7;
-            float *out = iou + idx_a * num_b + idx_b;
-            *out = IoU3DWithCenterAndSize(box_a, box_b);
-        });
-    });
+    tbb::parallel_for(
+            tbb::blocked_range2d<int>(0, num_a, 0, num_b),
+            [&](const tbb::blocked_range2d<int> &r) {
+                for (int idx_a = r.rows().begin(); idx_a != r.rows().end();
+                     ++idx_a) {
+                    const float *box_a = boxes_a + idx_a * 7;
+                    for (int idx_b = r.cols().begin(); idx_b != r.cols().end();
+                         ++idx_b) {
+                        const float *box_b = boxes_b + idx_b * 7;
+                        iou[int64_t(idx_a) * num_b + idx_b] =
+                                IoU3DWithCenterAndSize(box_a, box_b);
+                    }
+                }
+            });
 }
 
 }  // namespace contrib
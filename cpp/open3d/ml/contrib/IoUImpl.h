@@ -261,6 +261,27 @@ OPEN3D_HOST_DEVICE inline float IoUBev2DWithMinAndMax(
     }
 }
 
+/// (x_min, z_min, x_max, z_max, y_rotate)
+/// Radius of the circle around the box center that contains the rotated box.
+OPEN3D_HOST_DEVICE inline float BevCircumradius(const float *box) {
+    const float w = box[2] - box[0];
+    const float h = box[3] - box[1];
+    return 0.5f * sqrtf(w * w + h * h);
+}
+
+/// (x_min, z_min, x_max, z_max, y_rotate)
+/// Returns false if the boxes cannot overlap since their circumcircles are
+/// disjoint. This is a cheap test to skip IoUBev2DWithMinAndMax().
+OPEN3D_HOST_DEVICE inline bool BevCircumcirclesOverlap(const float *box_a,
+                                                       const float *box_b) {
+    const float dx = 0.5f * (box_a[0] + box_a[2] - box_b[0] - box_b[2]);
+    const float dy = 0.5f * (box_a[1] + box_a[3] - box_b[1] - box_b[3]);
+    // Small tolerance for the rounding errors of the exact test.
+    const float r =
+            1.001f * (BevCircumradius(box_a) + BevCircumradius(box_b)) + EPS;
+    return dx * dx + dy * dy <= r * r;
+}
+
 /// (x_center, z_center, x_size, z_size, y_rotate)
 OPEN3D_HOST_DEVICE inline float IoUBev2DWithCenterAndSize(
         const float *box_a,
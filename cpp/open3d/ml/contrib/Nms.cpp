@@ -36,7 +36,10 @@
 #include "open3d/ml/contrib/Nms.h"
 
 #include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <numeric>
 
@@ -136,10 +139,11 @@ static void AllPairsSortedIoU(const float *boxes,
             });
 }
 
-std::vector<int64_t> NmsCPUKernel(const float *boxes,
-                                  const float *scores,
-                                  int n,
-                                  double nms_overlap_thresh) {
+/// Computes the NMS with the overlap masks of all pairs of boxes.
+static std::vector<int64_t> AllPairsNms(const float *boxes,
+                                        const float *scores,
+                                        int n,
+                                        double nms_overlap_thresh) {
     std::vector<int64_t> sort_indices = SortIndexes(scores, n, true);
 
     const int num_block_cols = utility::DivUp(n, NMS_BLOCK_SIZE);
@@ -178,6 +182,130 @@ std::vector<int64_t> NmsCPUKernel(const float *boxes,
     return keep_indices;
 }
 
+/// Computes the NMS by comparing only boxes in neighboring cells of a BEV
+/// grid. Boxes in other cells cannot overlap, which makes the NMS scale with
+/// the number of nearby boxes instead of the number of all pairs.
+static std::vector<int64_t> GridNms(const float *boxes,
+                                    const float *scores,
+                                    int n,
+                                    double nms_overlap_thresh) {
+    std::vector<int64_t> sort_indices = SortIndexes(scores, n, true);
+
+    // With the cell size set to the largest circumcircle diameter, boxes
+    // with overlapping circumcircles are in the same or in adjacent cells.
+    float max_radius = 0;
+    for (int i = 0; i < n; ++i) {
+        max_radius = std::max(max_radius, BevCircumradius(boxes + i * 5));
+    }
+    const double inv_cell_size = 1.0 / std::max(2 * max_radius, EPS);
+
+    // The cells of the boxes in sorted order and the pairs (cell, i) sorted
+    // by cell for looking up the boxes of a cell.
+    struct Cell {
+        int64_t x, y;
+        bool operator<(const Cell &other) const {
+            return x < other.x || (x == other.x && y < other.y);
+        }
+        bool operator==(const Cell &other) const {
+            return x == other.x && y == other.y;
+        }
+    };
+    std::vector<Cell> cells(n);
+    std::vector<std::pair<Cell, int>> sorted_cells(n);
+    tbb::parallel_for(0, n, [&](int i) {
+        const float *box = boxes + sort_indices[i] * 5;
+        cells[i].x = int64_t(std::floor(0.5 * (box[0] + box[2]) *
+                                        inv_cell_size));
+        cells[i].y = int64_t(std::floor(0.5 * (box[1] + box[3]) *
+                                        inv_cell_size));
+        sorted_cells[i] = std::make_pair(cells[i], i);
+    });
+    tbb::parallel_sort(sorted_cells.begin(), sorted_cells.end(),
+                       [](const std::pair<Cell, int> &a,
+                          const std::pair<Cell, int> &b) {
+                           return a.first < b.first;
+                       });
+
+    // suppressed[i] lists the boxes after the i-th box in sorted order that
+    // are removed if the i-th box is kept.
+    std::vector<std::vector<int>> suppressed(n);
+    tbb::parallel_for(0, n, [&](int i) {
+        const float *box_i = boxes + sort_indices[i] * 5;
+        for (int dx = -1; dx <= 1; ++dx) {
+            for (int dy = -1; dy <= 1; ++dy) {
+                const Cell cell = {cells[i].x + dx, cells[i].y + dy};
+                auto it = std::lower_bound(
+                        sorted_cells.begin(), sorted_cells.end(), cell,
+                        [](const std::pair<Cell, int> &a, const Cell &b) {
+                            return a.first < b;
+                        });
+                for (; it != sorted_cells.end() && it->first == cell; ++it) {
+                    const int j = it->second;
+                    const float *box_j = boxes + sort_indices[j] * 5;
+                    if (j > i && BevCircumcirclesOverlap(box_i, box_j) &&
+                        IoUBev2DWithMinAndMax(box_i, box_j) >
+                                nms_overlap_thresh) {
+                        suppressed[i].push_back(j);
+                    }
+                }
+            }
+        }
+    });
+
+    std::vector<bool> removed(n, false);
+    std::vector<int64_t> keep_indices;
+    for (int i = 0; i < n; i++) {
+        if (!removed[i]) {
+            keep_indices.push_back(sort_indices[i]);
+            for (int j : suppressed[i]) {
+                removed[j] = true;
+            }
+        }
+    }
+
+    return keep_indices;
+}
+
+std::vector<int64_t> NmsCPUKernel(const float *boxes,
+                                  const float *scores,
+                                  int n,
+                                  double nms_overlap_thresh) {
+    // Boxes that do not overlap have an IoU of 0 and can only be skipped if
+    // the threshold is not negative.
+    if (nms_overlap_thresh < 0) {
+        return AllPairsNms(boxes, scores, n, nms_overlap_thresh);
+    }
+    return GridNms(boxes, scores, n, nms_overlap_thresh);
+}
+
+std::vector<int64_t> BatchedNmsCPUKernel(
+        const float *boxes,
+        const float *scores,
+        const int64_t *row_splits,
+        int num_batches,
+        double nms_overlap_thresh,
+        std::vector<int64_t> &keep_row_splits) {
+    std::vector<std::vector<int64_t>> batch_keep_indices(num_batches);
+    tbb::parallel_for(0, num_batches, [&](int b) {
+        const int64_t begin = row_splits[b];
+        batch_keep_indices[b] = NmsCPUKernel(
+                boxes + begin * 5, scores + begin,
+                int(row_splits[b + 1] - begin), nms_overlap_thresh);
+        for (int64_t &idx : batch_keep_indices[b]) {
+            idx += begin;
+        }
+    });
+
+    keep_row_splits.assign(num_batches + 1, 0);
+    std::vector<int64_t> keep_indices;
+    for (int b = 0; b < num_batches; ++b) {
+        keep_indices.insert(keep_indices.end(), batch_keep_indices[b].begin(),
+                            batch_keep_indices[b].end());
+        keep_row_splits[b + 1] = keep_indices.size();
+    }
+    return keep_indices;
+}
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
@@ -33,11 +33,14 @@
 // Written by Shaoshuai Shi
 // All Rights Reserved 2019-2020.
 
+#include <thrust/binary_search.h>
 #include <thrust/device_vector.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+
 #include "open3d/ml/Helper.h"
 #include "open3d/ml/contrib/IoUImpl.h"
 #include "open3d/ml/contrib/Nms.h"
@@ -70,17 +73,62 @@ static void SortIndices(T *values,
     }
 }
 
+/// Sorts the indices of each batch item by the score in descending order.
+/// The indices of batch item i are stored in
+/// sort_indices[row_splits[i]:row_splits[i+1]].
+static void SortIndicesBatched(const float *scores,
+                               const int64_t *row_splits,
+                               int num_batches,
+                               int64_t *sort_indices,
+                               int64_t n) {
+    thrust::device_ptr<const float> scores_dptr =
+            thrust::device_pointer_cast(scores);
+    thrust::device_vector<float> scores_copy(scores_dptr, scores_dptr + n);
+    SortIndices(thrust::raw_pointer_cast(scores_copy.data()), sort_indices, n,
+                true);
+    if (num_batches <= 1) {
+        return;
+    }
+
+    // Stable sort of the batch ids keeps the order of the scores within the
+    // batch items.
+    thrust::device_ptr<int64_t> sort_indices_dptr =
+            thrust::device_pointer_cast(sort_indices);
+    thrust::device_ptr<const int64_t> row_splits_dptr =
+            thrust::device_pointer_cast(row_splits);
+    thrust::device_vector<int64_t> batch_ids(n);
+    thrust::upper_bound(row_splits_dptr + 1,
+                        row_splits_dptr + num_batches + 1, sort_indices_dptr,
+                        sort_indices_dptr + n, batch_ids.begin());
+    thrust::stable_sort_by_key(batch_ids.begin(), batch_ids.end(),
+                               sort_indices_dptr);
+}
+
+/// Computes the overlap masks of the boxes of the batch items. blockIdx.z is
+/// the batch item relative to row_splits and mask_offsets.
 __global__ void NmsKernel(const float *boxes,
                           const int64_t *sort_indices,
                           uint64_t *mask,
-                          const int n,
-                          const double nms_overlap_thresh,
-                          const int num_block_cols) {
+                          const int64_t *row_splits,
+                          const int64_t *mask_offsets,
+                          const double nms_overlap_thresh) {
+    const int64_t begin = row_splits[blockIdx.z];
+    const int n = row_splits[blockIdx.z + 1] - begin;
+    const int num_block_cols = (n + NMS_BLOCK_SIZE - 1) / NMS_BLOCK_SIZE;
+
     // Row-wise block index.
     const int block_row_idx = blockIdx.y;
     // Column-wise block index.
     const int block_col_idx = blockIdx.x;
 
+    // The grid covers the largest batch item. The lower triangle of blocks is
+    // never read, since a box can only remove boxes with lower scores.
+    if (block_col_idx >= num_block_cols || block_col_idx < block_row_idx) {
+        return;
+    }
+    sort_indices += begin;
+    mask += mask_offsets[blockIdx.z] - mask_offsets[0];
+
     // Local block row size.
     const int row_size =
             fminf(n - block_row_idx * NMS_BLOCK_SIZE, NMS_BLOCK_SIZE);
@@ -119,19 +167,56 @@ __global__ void NmsKernel(const float *boxes,
     if (threadIdx.x < row_size) {
         // src_idx indices the global memory.
         const int src_idx = NMS_BLOCK_SIZE * block_row_idx + threadIdx.x;
+        const float *src_box = boxes + sort_indices[src_idx] * 5;
         // dst_idx indices the shared memory.
         int dst_idx = block_row_idx == block_col_idx ? threadIdx.x + 1 : 0;
 
         uint64_t t = 0;
         while (dst_idx < col_size) {
-            if (IoUBev2DWithMinAndMax(boxes + sort_indices[src_idx] * 5,
-                                      block_boxes + dst_idx * 5) >
-                nms_overlap_thresh) {
+            const float *dst_box = block_boxes + dst_idx * 5;
+            // Boxes that do not overlap have an IoU of 0. Skipping them is
+            // only valid for a non-negative threshold.
+            if ((nms_overlap_thresh < 0 ||
+                 BevCircumcirclesOverlap(src_box, dst_box)) &&
+                IoUBev2DWithMinAndMax(src_box, dst_box) > nms_overlap_thresh) {
                 t |= 1ULL << dst_idx;
             }
             dst_idx++;
         }
-        mask[src_idx * num_block_cols + block_col_idx] = t;
+        mask[int64_t(src_idx) * num_block_cols + block_col_idx] = t;
+    }
+}
+
+/// Appends the boxes selected with the overlap masks of a batch item to
+/// keep_indices.
+static void SelectBoxes(const uint64_t *mask,
+                        const int64_t *sort_indices,
+                        int n,
+                        std::vector<int64_t> &keep_indices) {
+    const int num_block_cols = utility::DivUp(n, NMS_BLOCK_SIZE);
+
+    // remv_cpu has n bits in total. If the bit is 1, the corresponding
+    // box will be removed.
+    // TODO: This part can be implemented in CUDA. We use the original author's
+    // implementation here.
+    std::vector<uint64_t> remv_cpu(num_block_cols, 0);
+    for (int i = 0; i < n; i++) {
+        int block_col_idx = i / NMS_BLOCK_SIZE;
+        int inner_block_col_idx = i % NMS_BLOCK_SIZE;  // threadIdx.x
+
+        // Querying the i-th bit in remv_cpu, counted from the right.
+        // - remv_cpu[block_col_idx]: the block bitmap containing the query
+        // - 1ULL << inner_block_col_idx: the one-hot bitmap to extract i
+        if (!(remv_cpu[block_col_idx] & (1ULL << inner_block_col_idx))) {
+            // Keep the i-th box.
+            keep_indices.push_back(sort_indices[i]);
+
+            // Any box that overlaps with the i-th box will be removed.
+            const uint64_t *p = mask + int64_t(i) * num_block_cols;
+            for (int j = block_col_idx; j < num_block_cols; j++) {
+                remv_cpu[j] |= p[j];
+            }
+        }
     }
 }
 
@@ -139,43 +224,47 @@ std::vector<int64_t> NmsCUDAKernel(const float *boxes,
                                    const float *scores,
                                    int n,
                                    double nms_overlap_thresh) {
+    const int64_t row_splits[] = {0, n};
+    std::vector<int64_t> keep_row_splits;
+    return BatchedNmsCUDAKernel(boxes, scores, row_splits, 1,
+                                nms_overlap_thresh, keep_row_splits);
+}
+
+std::vector<int64_t> BatchedNmsCUDAKernel(
+        const float *boxes,
+        const float *scores,
+        const int64_t *row_splits,
+        int num_batches,
+        double nms_overlap_thresh,
+        std::vector<int64_t> &keep_row_splits) {
+    keep_row_splits.assign(num_batches + 1, 0);
+    const int64_t n = row_splits[num_batches];
     if (n == 0) {
         return {};
     }
 
-    // Cololum-wise number of blocks.
-    const int num_block_cols = utility::DivUp(n, NMS_BLOCK_SIZE);
+    // The masks of batch item i are stored at mask_offsets[i].
+    std::vector<int64_t> mask_offsets(num_batches + 1, 0);
+    int64_t max_mask_size = 0;
+    for (int b = 0; b < num_batches; ++b) {
+        const int64_t batch_n = row_splits[b + 1] - row_splits[b];
+        const int64_t mask_size =
+                batch_n * utility::DivUp(batch_n, NMS_BLOCK_SIZE);
+        mask_offsets[b + 1] = mask_offsets[b] + mask_size;
+        max_mask_size = std::max(max_mask_size, mask_size);
+    }
+
+    thrust::device_vector<int64_t> row_splits_device(
+            row_splits, row_splits + num_batches + 1);
+    thrust::device_vector<int64_t> mask_offsets_device(mask_offsets);
 
     // Compute sort indices.
-    float *scores_copy = nullptr;
-    OPEN3D_ML_CUDA_CHECK(cudaMalloc((void **)&scores_copy, n * sizeof(float)));
-    OPEN3D_ML_CUDA_CHECK(cudaMemcpy(scores_copy, scores, n * sizeof(float),
-                                    cudaMemcpyDeviceToDevice));
     int64_t *sort_indices = nullptr;
     OPEN3D_ML_CUDA_CHECK(
             cudaMalloc((void **)&sort_indices, n * sizeof(int64_t)));
-    SortIndices(scores_copy, sort_indices, n, true);
-    OPEN3D_ML_CUDA_CHECK(cudaFree(scores_copy));
-
-    // Allocate masks on device.
-    uint64_t *mask_ptr = nullptr;
-    OPEN3D_ML_CUDA_CHECK(cudaMalloc((void **)&mask_ptr,
-                                    n * num_block_cols * sizeof(uint64_t)));
-
-    // Launch kernel.
-    dim3 blocks(utility::DivUp(n, NMS_BLOCK_SIZE),
-                utility::DivUp(n, NMS_BLOCK_SIZE));
-    dim3 threads(NMS_BLOCK_SIZE);
-    NmsKernel<<<blocks, threads>>>(boxes, sort_indices, mask_ptr, n,
-                                   nms_overlap_thresh, num_block_cols);
-
-    // Copy cuda masks to cpu.
-    std::vector<uint64_t> mask_vec(n * num_block_cols);
-    uint64_t *mask = mask_vec.data();
-    OPEN3D_ML_CUDA_CHECK(cudaMemcpy(mask_vec.data(), mask_ptr,
-                                    n * num_block_cols * sizeof(uint64_t),
-                                    cudaMemcpyDeviceToHost));
-    OPEN3D_ML_CUDA_CHECK(cudaFree(mask_ptr));
+    SortIndicesBatched(scores,
+                       thrust::raw_pointer_cast(row_splits_device.data()),
+                       num_batches, sort_indices, n);
 
     // Copy sort_indices to cpu.
     std::vector<int64_t> sort_indices_cpu(n);
@@ -183,31 +272,66 @@ std::vector<int64_t> NmsCUDAKernel(const float *boxes,
                                     n * sizeof(int64_t),
                                     cudaMemcpyDeviceToHost));
 
-    // Write to keep_indices in CPU.
-    // remv_cpu has n bits in total. If the bit is 1, the corresponding
-    // box will be removed.
-    // TODO: This part can be implemented in CUDA. We use the original author's
-    // implementation here.
-    std::vector<uint64_t> remv_cpu(num_block_cols, 0);
+    // The masks of all batch items do not necessarily fit into device memory,
+    // e.g. 16 batch items with 50k boxes need 5 GB. The batch items are
+    // processed in chunks with a bounded mask size.
+    const int64_t max_chunk_mask_size =
+            std::min(mask_offsets.back(),
+                     std::max(max_mask_size, int64_t(1) << 27));
+    uint64_t *mask_ptr = nullptr;
+    OPEN3D_ML_CUDA_CHECK(cudaMalloc((void **)&mask_ptr,
+                                    max_chunk_mask_size * sizeof(uint64_t)));
+    std::vector<uint64_t> mask_vec(max_chunk_mask_size);
+
     std::vector<int64_t> keep_indices;
-    for (int i = 0; i < n; i++) {
-        int block_col_idx = i / NMS_BLOCK_SIZE;
-        int inner_block_col_idx = i % NMS_BLOCK_SIZE;  // threadIdx.x
+    for (int chunk_begin = 0; chunk_begin < num_batches;) {
+        int chunk_end = chunk_begin;
+        int max_block_cols = 0;
+        const int max_chunk_batches = 65535;  // Grid size limit in z.
+        while (chunk_end < num_batches &&
+               chunk_end - chunk_begin < max_chunk_batches &&
+               mask_offsets[chunk_end + 1] - mask_offsets[chunk_begin] <=
+                       max_chunk_mask_size) {
+            max_block_cols = std::max(
+                    max_block_cols,
+                    utility::DivUp(row_splits[chunk_end + 1] -
+                                           row_splits[chunk_end],
+                                   NMS_BLOCK_SIZE));
+            ++chunk_end;
+        }
 
-        // Querying the i-th bit in remv_cpu, counted from the right.
-        // - remv_cpu[block_col_idx]: the block bitmap containing the query
-        // - 1ULL << inner_block_col_idx: the one-hot bitmap to extract i
-        if (!(remv_cpu[block_col_idx] & (1ULL << inner_block_col_idx))) {
-            // Keep the i-th box.
-            keep_indices.push_back(sort_indices_cpu[i]);
+        // Launch kernel.
+        const int64_t chunk_mask_size =
+                mask_offsets[chunk_end] - mask_offsets[chunk_begin];
+        if (chunk_mask_size > 0) {
+            dim3 blocks(max_block_cols, max_block_cols,
+                        chunk_end - chunk_begin);
+            dim3 threads(NMS_BLOCK_SIZE);
+            NmsKernel<<<blocks, threads>>>(
+                    boxes, sort_indices, mask_ptr,
+                    thrust::raw_pointer_cast(row_splits_device.data()) +
+                            chunk_begin,
+                    thrust::raw_pointer_cast(mask_offsets_device.data()) +
+                            chunk_begin,
+                    nms_overlap_thresh);
 
-            // Any box that overlaps with the i-th box will be removed.
-            uint64_t *p = mask + i * num_block_cols;
-            for (int j = block_col_idx; j < num_block_cols; j++) {
-                remv_cpu[j] |= p[j];
-            }
+            // Copy cuda masks to cpu.
+            OPEN3D_ML_CUDA_CHECK(cudaMemcpy(mask_vec.data(), mask_ptr,
+                                            chunk_mask_size * sizeof(uint64_t),
+                                            cudaMemcpyDeviceToHost));
         }
+
+        for (int b = chunk_begin; b < chunk_end; ++b) {
+            SelectBoxes(mask_vec.data() + mask_offsets[b] -
+                                mask_offsets[chunk_begin],
+                        sort_indices_cpu.data() + row_splits[b],
+                        row_splits[b + 1] - row_splits[b], keep_indices);
+            keep_row_splits[b + 1] = keep_indices.size();
+        }
+        chunk_begin = chunk_end;
     }
+
+    OPEN3D_ML_CUDA_CHECK(cudaFree(mask_ptr));
     OPEN3D_ML_CUDA_CHECK(cudaFree(sort_indices));
     return keep_indices;
 }
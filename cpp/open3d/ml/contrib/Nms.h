@@ -54,6 +54,29 @@ std::vector<int64_t> NmsCUDAKernel(const float *boxes,
                                    const float *scores,
                                    int n,
                                    double nms_overlap_thresh);
+
+/// Batched version of NmsCUDAKernel(). All batch items are sorted and
+/// compared in the same kernel launches. The overlap masks are computed for
+/// chunks of batch items to bound the required device memory.
+///
+/// \param boxes (n, 5) float32, the boxes of all batch items.
+/// \param scores (n,) float32.
+/// \param row_splits (num_batches+1,) int64 in host memory. The boxes of
+/// batch item i are boxes[row_splits[i]:row_splits[i+1]].
+/// \param num_batches Number of batch items.
+/// \param nms_overlap_thresh When a high-score box is selected, other remaining
+/// boxes of the same batch item with IoU > nms_overlap_thresh will be
+/// discarded.
+/// \param keep_row_splits Output (num_batches+1,) int64 row splits of the
+/// returned indices.
+/// \return Selected box indices to keep, grouped by batch item.
+std::vector<int64_t> BatchedNmsCUDAKernel(
+        const float *boxes,
+        const float *scores,
+        const int64_t *row_splits,
+        int num_batches,
+        double nms_overlap_thresh,
+        std::vector<int64_t> &keep_row_splits);
 #endif
 
 /// \param boxes (n, 5) float32.
@@ -67,6 +90,27 @@ std::vector<int64_t> NmsCPUKernel(const float *boxes,
                                   int n,
                                   double nms_overlap_thresh);
 
+/// Batched version of NmsCPUKernel(). The batch items are processed in
+/// parallel.
+///
+/// \param boxes (n, 5) float32, the boxes of all batch items.
+/// \param scores (n,) float32.
+/// \param row_splits (num_batches+1,) int64. The boxes of batch item i are
+/// boxes[row_splits[i]:row_splits[i+1]].
+/// \param num_batches Number of batch items.
+/// \param nms_overlap_thresh When a high-score box is selected, other remaining
+/// boxes of the same batch item with IoU > nms_overlap_thresh will be
+/// discarded.
+/// \param keep_row_splits Output (num_batches+1,) int64 row splits of the
+/// returned indices.
+/// \return Selected box indices to keep, grouped by batch item.
+std::vector<int64_t> BatchedNmsCPUKernel(const float *boxes,
+                                         const float *scores,
+                                         const int64_t *row_splits,
+                                         int num_batches,
+                                         double nms_overlap_thresh,
+                                         std::vector<int64_t> &keep_row_splits);
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
@@ -0,0 +1,184 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/ml/contrib/PointSampling.h"
+
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace ml {
+namespace contrib {
+
+namespace {
+
+/// Inserts two zero bits after each of the lower 10 bits of x.
+uint32_t ExpandBits(uint32_t x) {
+    x = (x * 0x00010001u) & 0xFF0000FFu;
+    x = (x * 0x00000101u) & 0x0F00F00Fu;
+    x = (x * 0x00000011u) & 0xC30C30C3u;
+    x = (x * 0x00000005u) & 0x49249249u;
+    return x;
+}
+
+/// Squared distance of point p to the box with min corner box[0:3] and max
+/// corner box[3:6].
+float BoxDistance2(const float *p, const float *box) {
+    float d2 = 0;
+    for (int i = 0; i < 3; ++i) {
+        const float d =
+                std::max(std::max(box[i] - p[i], p[i] - box[i + 3]), 0.f);
+        d2 += d * d;
+    }
+    return d2;
+}
+
+void FurthestPointSamplingBatchItem(int n,
+                                    int m,
+                                    const float *points,
+                                    int *idxs) {
+    // Sort the points along a Morton curve in the bounding box.
+    float bounds[6] = {points[0], points[1], points[2],
+                       points[0], points[1], points[2]};
+    for (int i = 1; i < n; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            bounds[j] = std::min(bounds[j], points[i * 3 + j]);
+            bounds[j + 3] = std::max(bounds[j + 3], points[i * 3 + j]);
+        }
+    }
+    float scale[3];
+    for (int j = 0; j < 3; ++j) {
+        scale[j] = 1023.f / std::max(bounds[j + 3] - bounds[j], 1e-12f);
+    }
+    std::vector<std::pair<uint32_t, int>> codes(n);
+    tbb::parallel_for(0, n, [&](int i) {
+        uint32_t code = 0;
+        for (int j = 0; j < 3; ++j) {
+            code |= ExpandBits(uint32_t((points[i * 3 + j] - bounds[j]) *
+                                        scale[j]))
+                    << (2 - j);
+        }
+        codes[i] = std::make_pair(code, i);
+    });
+    tbb::parallel_sort(codes.begin(), codes.end());
+
+    const int num_buckets = utility::DivUp(n, FPS_BUCKET_SIZE);
+    std::vector<float> sorted_points(n * 3);
+    std::vector<float> temp(n, std::numeric_limits<float>::infinity());
+    std::vector<float> bucket_bounds(num_buckets * 6);
+    std::vector<float> bucket_max(num_buckets,
+                                  std::numeric_limits<float>::infinity());
+    std::vector<int> bucket_argmax(num_buckets, 0);
+    tbb::parallel_for(0, num_buckets, [&](int bucket) {
+        const int begin = bucket * FPS_BUCKET_SIZE;
+        const int end = std::min(n, begin + FPS_BUCKET_SIZE);
+        float *box = bucket_bounds.data() + bucket * 6;
+        std::fill(box, box + 3, std::numeric_limits<float>::max());
+        std::fill(box + 3, box + 6, std::numeric_limits<float>::lowest());
+        for (int s = begin; s < end; ++s) {
+            for (int j = 0; j < 3; ++j) {
+                const float x = points[codes[s].second * 3 + j];
+                sorted_points[s * 3 + j] = x;
+                box[j] = std::min(box[j], x);
+                box[j + 3] = std::max(box[j + 3], x);
+            }
+        }
+    });
+
+    int old = 0;
+    idxs[0] = old;
+    for (int j = 1; j < m; ++j) {
+        const float *p = points + old * 3;
+        tbb::parallel_for(
+                tbb::blocked_range<int>(0, num_buckets, 16),
+                [&](const tbb::blocked_range<int> &r) {
+                    for (int bucket = r.begin(); bucket != r.end();
+                         ++bucket) {
+                        if (BoxDistance2(p, bucket_bounds.data() +
+                                                    bucket * 6) >=
+                            bucket_max[bucket]) {
+                            continue;
+                        }
+                        const int begin = bucket * FPS_BUCKET_SIZE;
+                        const int end = std::min(n, begin + FPS_BUCKET_SIZE);
+                        float best = -1;
+                        int besti = 0;
+                        for (int s = begin; s < end; ++s) {
+                            const float *q = sorted_points.data() + s * 3;
+                            const float d = (q[0] - p[0]) * (q[0] - p[0]) +
+                                            (q[1] - p[1]) * (q[1] - p[1]) +
+                                            (q[2] - p[2]) * (q[2] - p[2]);
+                            const float d2 = std::min(d, temp[s]);
+                            temp[s] = d2;
+                            const int i = codes[s].second;
+                            if (d2 > best || (d2 == best && i < besti)) {
+                                best = d2;
+                                besti = i;
+                            }
+                        }
+                        bucket_max[bucket] = best;
+                        bucket_argmax[bucket] = besti;
+                    }
+                });
+
+        // Ties are resolved by the smallest index like a sequential search.
+        float best = -1;
+        for (int bucket = 0; bucket < num_buckets; ++bucket) {
+            if (bucket_max[bucket] > best ||
+                (bucket_max[bucket] == best && bucket_argmax[bucket] < old)) {
+                best = bucket_max[bucket];
+                old = bucket_argmax[bucket];
+            }
+        }
+        idxs[j] = old;
+    }
+}
+
+}  // namespace
+
+void FurthestPointSamplingCPU(
+        int b, int n, int m, const float *dataset, int *idxs) {
+    if (m <= 0 || n <= 0) {
+        return;
+    }
+    tbb::parallel_for(0, b, [&](int batch) {
+        FurthestPointSamplingBatchItem(n, m, dataset + int64_t(batch) * n * 3,
+                                       idxs + int64_t(batch) * m);
+    });
+}
+
+}  // namespace contrib
+}  // namespace ml
+}  // namespace open3d
@@ -1,5 +1,13 @@
 #pragma once
 
+#include <cfloat>
+#include <cub/cub.cuh>
+#include <limits>
+
+#include "open3d/ml/contrib/PointSampling.h"
+#include "open3d/ml/impl/misc/MemoryAllocation.h"
+#include "open3d/utility/Helper.h"
+
 namespace open3d {
 namespace ml {
 namespace contrib {
@@ -136,6 +144,339 @@ __global__ void furthest_point_sampling_kernel(
     }
 }
 
+/// Number of threads of the blocks of the bucketed furthest point sampling.
+/// Each warp processes one bucket.
+constexpr int FPS_BLOCK_SIZE = 256;
+constexpr int FPS_BUCKETS_PER_BLOCK = FPS_BLOCK_SIZE / 32;
+
+/// Minimum number of points for using FurthestPointSamplingBucketed() instead
+/// of furthest_point_sampling_kernel, which uses one block per batch item.
+constexpr int FPS_BUCKETED_MIN_POINTS = 1 << 16;
+
+/// Keeps the larger distance and the smaller index for equal distances.
+static __device__ void FpsArgMax(float &best, int &besti, float d, int i) {
+    if (d > best || (d == best && i < besti)) {
+        best = d;
+        besti = i;
+    }
+}
+
+/// Inserts two zero bits after each of the lower 10 bits of x.
+static __device__ uint32_t FpsExpandBits(uint32_t x) {
+    x = (x * 0x00010001u) & 0xFF0000FFu;
+    x = (x * 0x00000101u) & 0x0F00F00Fu;
+    x = (x * 0x00000011u) & 0xC30C30C3u;
+    x = (x * 0x00000005u) & 0x49249249u;
+    return x;
+}
+
+/// Computes the bounding box of each batch item. One block per batch item.
+static __global__ void FpsBoundsKernel(int n,
+                                       const float *__restrict__ dataset,
+                                       float *__restrict__ bounds) {
+    __shared__ float block_bounds[6][FPS_BLOCK_SIZE];
+    const float *points = dataset + int64_t(blockIdx.x) * n * 3;
+    float box[6] = {FLT_MAX, FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX};
+    for (int i = threadIdx.x; i < n; i += blockDim.x) {
+        for (int j = 0; j < 3; ++j) {
+            box[j] = fminf(box[j], points[i * 3 + j]);
+            box[j + 3] = fmaxf(box[j + 3], points[i * 3 + j]);
+        }
+    }
+    for (int j = 0; j < 6; ++j) {
+        block_bounds[j][threadIdx.x] = box[j];
+    }
+    __syncthreads();
+    for (int stride = blockDim.x / 2; stride > 0; stride /= 2) {
+        if (threadIdx.x < stride) {
+            for (int j = 0; j < 3; ++j) {
+                block_bounds[j][threadIdx.x] =
+                        fminf(block_bounds[j][threadIdx.x],
+                              block_bounds[j][threadIdx.x + stride]);
+                block_bounds[j + 3][threadIdx.x] =
+                        fmaxf(block_bounds[j + 3][threadIdx.x],
+                              block_bounds[j + 3][threadIdx.x + stride]);
+            }
+        }
+        __syncthreads();
+    }
+    if (threadIdx.x < 6) {
+        bounds[blockIdx.x * 6 + threadIdx.x] = block_bounds[threadIdx.x][0];
+    }
+}
+
+/// Computes the sort keys with the batch index in the upper 32 bits and the
+/// Morton code within the bounding box of the batch item in the lower bits.
+static __global__ void FpsMortonKernel(int b,
+                                       int n,
+                                       const float *__restrict__ dataset,
+                                       const float *__restrict__ bounds,
+                                       uint64_t *__restrict__ keys,
+                                       int *__restrict__ order) {
+    const int64_t k = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (k >= int64_t(b) * n) {
+        return;
+    }
+    const int batch = k / n;
+    const float *box = bounds + batch * 6;
+    uint32_t code = 0;
+    for (int j = 0; j < 3; ++j) {
+        const float scale = 1023.f / fmaxf(box[j + 3] - box[j], 1e-12f);
+        code |= FpsExpandBits(uint32_t((dataset[k * 3 + j] - box[j]) * scale))
+                << (2 - j);
+    }
+    keys[k] = (uint64_t(batch) << 32) | code;
+    order[k] = k - int64_t(batch) * n;
+}
+
+/// Copies the points in Morton order and computes the bounding boxes of the
+/// buckets. Grid (buckets / FPS_BUCKETS_PER_BLOCK, b).
+static __global__ void FpsInitBucketsKernel(int n,
+                                            int m,
+                                            const float *__restrict__ dataset,
+                                            const int *__restrict__ order,
+                                            float *__restrict__ sorted_points,
+                                            float *__restrict__ temp,
+                                            float *__restrict__ bucket_bounds,
+                                            float *__restrict__ bucket_max,
+                                            unsigned int *__restrict__ counter,
+                                            int *__restrict__ idxs) {
+    const int batch = blockIdx.y;
+    const int num_buckets = (n + FPS_BUCKET_SIZE - 1) / FPS_BUCKET_SIZE;
+    const int bucket = blockIdx.x * FPS_BUCKETS_PER_BLOCK + threadIdx.x / 32;
+    const int lane = threadIdx.x % 32;
+    if (blockIdx.x == 0 && threadIdx.x == 0) {
+        counter[batch] = 0;
+        idxs[int64_t(batch) * m] = 0;
+    }
+    if (bucket >= num_buckets) {
+        return;
+    }
+
+    const int64_t offset = int64_t(batch) * n;
+    float box[6] = {FLT_MAX, FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX};
+    const int end = min(n, (bucket + 1) * FPS_BUCKET_SIZE);
+    for (int s = bucket * FPS_BUCKET_SIZE + lane; s < end; s += 32) {
+        const float *p = dataset + (offset + order[offset + s]) * 3;
+        float *q = sorted_points + (offset + s) * 3;
+        for (int j = 0; j < 3; ++j) {
+            q[j] = p[j];
+            box[j] = fminf(box[j], p[j]);
+            box[j + 3] = fmaxf(box[j + 3], p[j]);
+        }
+        temp[offset + s] = FLT_MAX;
+    }
+    for (int delta = 16; delta > 0; delta /= 2) {
+        for (int j = 0; j < 3; ++j) {
+            box[j] = fminf(box[j], __shfl_down_sync(0xffffffff, box[j], delta));
+            box[j + 3] = fmaxf(box[j + 3], __shfl_down_sync(0xffffffff,
+                                                            box[j + 3], delta));
+        }
+    }
+    if (lane == 0) {
+        const int64_t bucket_idx = int64_t(batch) * num_buckets + bucket;
+        for (int j = 0; j < 6; ++j) {
+            bucket_bounds[bucket_idx * 6 + j] = box[j];
+        }
+        bucket_max[bucket_idx] = FLT_MAX;
+    }
+}
+
+/// Updates the distances with the point sampled in iteration j - 1 and
+/// samples the point of iteration j. Grid (buckets / FPS_BUCKETS_PER_BLOCK,
+/// b). The last block of a batch item to finish reduces the buckets.
+static __global__ void FpsUpdateKernel(int n,
+                                       int m,
+                                       int j,
+                                       const float *__restrict__ dataset,
+                                       const int *__restrict__ order,
+                                       const float *__restrict__ sorted_points,
+                                       float *__restrict__ temp,
+                                       const float *__restrict__ bucket_bounds,
+                                       float *bucket_max,
+                                       int *bucket_argmax,
+                                       unsigned int *counter,
+                                       int *__restrict__ idxs) {
+    const int batch = blockIdx.y;
+    const int num_buckets = (n + FPS_BUCKET_SIZE - 1) / FPS_BUCKET_SIZE;
+    const int bucket = blockIdx.x * FPS_BUCKETS_PER_BLOCK + threadIdx.x / 32;
+    const int lane = threadIdx.x % 32;
+    const int64_t offset = int64_t(batch) * n;
+    const float *p = dataset + (offset + idxs[int64_t(batch) * m + j - 1]) * 3;
+    const float x1 = p[0], y1 = p[1], z1 = p[2];
+
+    if (bucket < num_buckets) {
+        const int64_t bucket_idx = int64_t(batch) * num_buckets + bucket;
+        const float *box = bucket_bounds + bucket_idx * 6;
+        const float dx = fmaxf(fmaxf(box[0] - x1, x1 - box[3]), 0.f);
+        const float dy = fmaxf(fmaxf(box[1] - y1, y1 - box[4]), 0.f);
+        const float dz = fmaxf(fmaxf(box[2] - z1, z1 - box[5]), 0.f);
+        // None of the distances in the bucket can decrease if the bounding
+        // box is not closer than the largest distance.
+        if (dx * dx + dy * dy + dz * dz < bucket_max[bucket_idx]) {
+            float best = -1;
+            int besti = 0;
+            const int end = min(n, (bucket + 1) * FPS_BUCKET_SIZE);
+            for (int s = bucket * FPS_BUCKET_SIZE + lane; s < end; s += 32) {
+                const float *q = sorted_points + (offset + s) * 3;
+                const float d = (q[0] - x1) * (q[0] - x1) +
+                                (q[1] - y1) * (q[1] - y1) +
+                                (q[2] - z1) * (q[2] - z1);
+                const float d2 = fminf(d, temp[offset + s]);
+                temp[offset + s] = d2;
+                if (d2 >= best) {
+                    FpsArgMax(best, besti, d2, order[offset + s]);
+                }
+            }
+            for (int delta = 16; delta > 0; delta /= 2) {
+                FpsArgMax(best, besti,
+                          __shfl_down_sync(0xffffffff, best, delta),
+                          __shfl_down_sync(0xffffffff, besti, delta));
+            }
+            if (lane == 0) {
+                bucket_max[bucket_idx] = best;
+                bucket_argmax[bucket_idx] = besti;
+                __threadfence();
+            }
+        }
+    }
+
+    __shared__ bool is_last_block;
+    __syncthreads();
+    if (threadIdx.x == 0) {
+        const unsigned int ticket = atomicAdd(counter + batch, 1);
+        is_last_block = ticket == gridDim.x - 1;
+    }
+    __syncthreads();
+    if (!is_last_block) {
+        return;
+    }
+
+    // Reduce the buckets written by all blocks of this batch item.
+    __shared__ float dists[FPS_BLOCK_SIZE];
+    __shared__ int dists_i[FPS_BLOCK_SIZE];
+    const volatile float *all_max = bucket_max + int64_t(batch) * num_buckets;
+    const volatile int *all_argmax =
+            bucket_argmax + int64_t(batch) * num_buckets;
+    float best = -1;
+    int besti = 0;
+    for (int i = threadIdx.x; i < num_buckets; i += blockDim.x) {
+        FpsArgMax(best, besti, all_max[i], all_argmax[i]);
+    }
+    dists[threadIdx.x] = best;
+    dists_i[threadIdx.x] = besti;
+    __syncthreads();
+    for (int stride = blockDim.x / 2; stride > 0; stride /= 2) {
+        if (threadIdx.x < stride) {
+            FpsArgMax(dists[threadIdx.x], dists_i[threadIdx.x],
+                      dists[threadIdx.x + stride],
+                      dists_i[threadIdx.x + stride]);
+        }
+        __syncthreads();
+    }
+    if (threadIdx.x == 0) {
+        idxs[int64_t(batch) * m + j] = dists_i[0];
+        counter[batch] = 0;
+    }
+}
+
+/// Furthest point sampling for large point sets. The points are sorted along
+/// a Morton curve and split into buckets of FPS_BUCKET_SIZE points, which
+/// are processed by one warp each. After sampling a point, a bucket is
+/// skipped if its bounding box is farther from the point than the largest
+/// distance in the bucket, since none of the distances can decrease. Unlike
+/// furthest_point_sampling_kernel, all blocks of the grid work on all batch
+/// items and there is one kernel launch per sampled point.
+///
+/// \param temp    Pointer to temporary memory. If nullptr then the required
+///        size of temporary memory will be written to \p temp_size and no
+///        work is done.
+///
+/// \param temp_size    The size of the temporary memory in bytes. This is
+///        used as an output if temp is nullptr
+///
+/// \param b    Batch size.
+///
+/// \param n    Number of points per batch item.
+///
+/// \param m    Number of points to sample per batch item.
+///
+/// \param dataset    (b, n, 3) points.
+///
+/// \param idxs    (b, m) output indices of the sampled points.
+///
+inline void FurthestPointSamplingBucketed(const cudaStream_t &stream,
+                                          void *temp,
+                                          size_t &temp_size,
+                                          int b,
+                                          int n,
+                                          int m,
+                                          const float *dataset,
+                                          int *idxs) {
+    const bool get_temp_size = !temp;
+    if (get_temp_size) {
+        temp = (char *)1;  // worst case pointer alignment
+        temp_size = std::numeric_limits<int64_t>::max();
+    }
+    impl::MemoryAllocation mem_temp(temp, temp_size, 256);
+
+    const int64_t num_points = int64_t(b) * n;
+    const int num_buckets = utility::DivUp(n, FPS_BUCKET_SIZE);
+    auto bounds = mem_temp.Alloc<float>(b * 6);
+    auto keys = mem_temp.Alloc<uint64_t>(num_points);
+    auto sorted_keys = mem_temp.Alloc<uint64_t>(num_points);
+    auto unsorted_order = mem_temp.Alloc<int>(num_points);
+    auto order = mem_temp.Alloc<int>(num_points);
+    auto sorted_points = mem_temp.Alloc<float>(num_points * 3);
+    auto dists = mem_temp.Alloc<float>(num_points);
+    auto bucket_bounds = mem_temp.Alloc<float>(int64_t(b) * num_buckets * 6);
+    auto bucket_max = mem_temp.Alloc<float>(int64_t(b) * num_buckets);
+    auto bucket_argmax = mem_temp.Alloc<int>(int64_t(b) * num_buckets);
+    auto counter = mem_temp.Alloc<unsigned int>(b);
+
+    // Only sort the bits of the batch index that are used.
+    int end_bit = 32;
+    while ((int64_t(1) << (end_bit - 32)) < b) {
+        ++end_bit;
+    }
+    std::pair<void *, size_t> sort_temp(nullptr, 0);
+    cub::DeviceRadixSort::SortPairs(sort_temp.first, sort_temp.second,
+                                    keys.first, sorted_keys.first,
+                                    unsorted_order.first, order.first,
+                                    num_points, 0, end_bit, stream);
+    sort_temp = mem_temp.Alloc(sort_temp.second);
+
+    if (get_temp_size) {
+        // return the memory peak as the required temporary memory size.
+        temp_size = mem_temp.MaxUsed();
+        return;
+    }
+    if (m <= 0) {
+        return;
+    }
+
+    FpsBoundsKernel<<<b, FPS_BLOCK_SIZE, 0, stream>>>(n, dataset,
+                                                        bounds.first);
+    FpsMortonKernel<<<utility::DivUp(num_points, FPS_BLOCK_SIZE),
+                      FPS_BLOCK_SIZE, 0, stream>>>(
+            b, n, dataset, bounds.first, keys.first, unsorted_order.first);
+    cub::DeviceRadixSort::SortPairs(sort_temp.first, sort_temp.second,
+                                    keys.first, sorted_keys.first,
+                                    unsorted_order.first, order.first,
+                                    num_points, 0, end_bit, stream);
+
+    const dim3 grid(utility::DivUp(num_buckets, FPS_BUCKETS_PER_BLOCK), b);
+    FpsInitBucketsKernel<<<grid, FPS_BLOCK_SIZE, 0, stream>>>(
+            n, m, dataset, order.first, sorted_points.first, dists.first,
+            bucket_bounds.first, bucket_max.first, counter.first, idxs);
+    for (int j = 1; j < m; ++j) {
+        FpsUpdateKernel<<<grid, FPS_BLOCK_SIZE, 0, stream>>>(
+                n, m, j, dataset, order.first, sorted_points.first,
+                dists.first, bucket_bounds.first, bucket_max.first,
+                bucket_argmax.first, counter.first, idxs);
+    }
+}
+
 }  // namespace contrib
 }  // namespace ml
 }  // namespace open3d
@@ -0,0 +1,55 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace open3d {
+namespace ml {
+namespace contrib {
+
+/// Number of consecutive points along the Morton curve that form a bucket in
+/// the bucketed furthest point sampling.
+constexpr int FPS_BUCKET_SIZE = 256;
+
+/// Furthest point sampling on the CPU. The points are sorted along a Morton
+/// curve and split into buckets of FPS_BUCKET_SIZE points. After sampling a
+/// point, a bucket is skipped if the bounding box of the bucket is farther
+/// from the point than the largest distance in the bucket, since none of the
+/// distances can decrease. The remaining buckets are updated in parallel and
+/// the batch items are processed in parallel.
+///
+/// \param b Batch size.
+/// \param n Number of points per batch item.
+/// \param m Number of points to sample per batch item.
+/// \param dataset (b, n, 3) float32 points.
+/// \param idxs (b, m) int32 output indices of the sampled points. The first
+/// sampled point of each batch item is the point with index 0.
+void FurthestPointSamplingCPU(
+        int b, int n, int m, const float *dataset, int *idxs);
+
+}  // namespace contrib
+}  // namespace ml
+}  // namespace open3d
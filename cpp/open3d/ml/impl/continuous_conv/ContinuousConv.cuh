@@ -45,6 +45,9 @@ namespace impl {
 ///
 /// All pointer arguments point to device memory unless stated otherwise.
 ///
+/// For small neighborhoods the features are computed with a fused kernel,
+/// which does not need temporary memory for the patch matrix.
+///
 /// \tparam TFeat    Type for the features and weights
 /// \tparam TOut     Type for the output features
 /// \tparam TReal    Type for point positions and extents
@@ -174,6 +177,37 @@ void CConvComputeFeaturesCUDA(const cudaStream_t& stream,
     int spatial_filter_size = 1;
     for (int i = 0; i < 3; ++i) spatial_filter_size *= filter_dims[i];
 
+    // For small neighborhoods most entries of the patch matrix are zero. The
+    // fused kernel then does less work than the GEMM and does not need the
+    // patch matrix at all. The GEMM runs at a much higher throughput, so we
+    // require at least 4x less multiplications for the fused kernel.
+    const size_t num_interp_values =
+            interpolation == InterpolationMode::NEAREST_NEIGHBOR ? 1 : 8;
+    const size_t fused_shared_mem_size =
+            sizeof(TFeat) * in_channels + sizeof(TOut) * out_channels;
+    const bool use_fused =
+            4 * neighbors_index_size * num_interp_values <=
+                    size_t(num_out) * spatial_filter_size &&
+            fused_shared_mem_size <= 48 * 1024;
+
+    if (use_fused) {
+        if (get_temp_size) {
+            // the fused kernel needs no temporary memory but we request a
+            // non-empty allocation to get a valid pointer
+            temp_size = 1;
+            max_temp_size = 1;
+            return;
+        }
+        ComputeFeaturesFused<TFeat, TOut, TReal, TIndex>(
+                stream, out_features, in_channels, out_channels, filter,
+                num_out, out_positions, inp_positions, inp_features,
+                inp_importance, neighbors_index, neighbors_importance,
+                neighbors_row_splits, extents, offsets, filter_dims,
+                interpolation, coordinate_mapping, align_corners,
+                individual_extent, isotropic_extent, normalize);
+        return;
+    }
+
     // this defines how much temporary storage we need at least.
     // we want to allocate memory for at least 32 output points.
     const size_t min_num_cols_per_run = std::min(size_t(num_out), size_t(32));
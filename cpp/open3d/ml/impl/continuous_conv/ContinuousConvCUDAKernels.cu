@@ -271,6 +271,254 @@ template void FillColumn<float, float, int32_t>(
         bool isotropic_extent,
         bool normalize);
 
+/// Kernel for ComputeFeaturesFused
+template <class TFeat,
+          class TOut,
+          class TReal,
+          class TIndex,
+          bool ALIGN_CORNERS,
+          CoordinateMapping MAPPING,
+          InterpolationMode INTERPOLATION>
+__global__ void ComputeFeaturesFusedKernel(
+        TOut* out_features,
+        int in_channels,
+        int out_channels,
+        const TFeat* const __restrict__ filter,
+        TIndex num_out,
+        const TReal* const __restrict__ out_positions,
+        const TReal* const __restrict__ inp_positions,
+        const TFeat* const __restrict__ inp_features,
+        const TFeat* const __restrict__ inp_importance,
+        const TIndex* const __restrict__ neighbors_index,
+        const TFeat* const __restrict__ neighbors_importance,
+        const int64_t* const __restrict__ neighbors_row_splits,
+        const TReal* const __restrict__ extents,
+        const TReal* const __restrict__ offsets,
+        int filter_size_x,
+        int filter_size_y,
+        int filter_size_z,
+        bool INDIVIDUAL_EXTENT,
+        bool ISOTROPIC_EXTENT,
+        bool NORMALIZE,
+        bool POINT_IMPORTANCE,
+        bool NEIGHBOR_IMPORTANCE) {
+    TIndex out_idx = blockIdx.x;
+    if (out_idx >= num_out) return;
+    const int NUM_INTERP_VALUES =
+            (INTERPOLATION == InterpolationMode::LINEAR ||
+                             INTERPOLATION == InterpolationMode::LINEAR_BORDER
+                     ? 8
+                     : 1);
+    TReal interp_weights[NUM_INTERP_VALUES];
+    TIndex interp_indices[NUM_INTERP_VALUES];
+
+    // the weighted input features of the current neighbor followed by the
+    // accumulated output features
+    extern __shared__ char shared_mem[];
+    TFeat* inp_feat = (TFeat*)shared_mem;
+    TOut* out_feat = (TOut*)(inp_feat + in_channels);
+
+    TReal offset[3] = {offsets[0], offsets[1], offsets[2]};
+
+    const int64_t neighbor_start = neighbors_row_splits[out_idx];
+    const int64_t neighbor_end = neighbors_row_splits[out_idx + 1];
+
+    TReal out_pos[3] = {out_positions[out_idx * 3 + 0],
+                        out_positions[out_idx * 3 + 1],
+                        out_positions[out_idx * 3 + 2]};
+
+    TReal inv_extents[3];
+    if (INDIVIDUAL_EXTENT) {
+        if (ISOTROPIC_EXTENT) {
+            inv_extents[0] = TReal(1) / extents[out_idx];
+            inv_extents[1] = inv_extents[0];
+            inv_extents[2] = inv_extents[0];
+        } else {
+            inv_extents[0] = TReal(1) / extents[3 * out_idx + 0];
+            inv_extents[1] = TReal(1) / extents[3 * out_idx + 1];
+            inv_extents[2] = TReal(1) / extents[3 * out_idx + 2];
+        }
+    } else {
+        if (ISOTROPIC_EXTENT) {
+            inv_extents[0] = TReal(1) / extents[0];
+            inv_extents[1] = inv_extents[0];
+            inv_extents[2] = inv_extents[0];
+        } else {
+            inv_extents[0] = TReal(1) / extents[0];
+            inv_extents[1] = TReal(1) / extents[1];
+            inv_extents[2] = TReal(1) / extents[2];
+        }
+    }
+
+    // the neighborhoods are small, every thread computes the sum on its own
+    TReal normalizer = TReal(0);
+    if (NORMALIZE) {
+        if (NEIGHBOR_IMPORTANCE) {
+            for (int64_t n_idx = neighbor_start; n_idx < neighbor_end;
+                 ++n_idx) {
+                normalizer += neighbors_importance[n_idx];
+            }
+        } else {
+            normalizer = neighbor_end - neighbor_start;
+        }
+    }
+
+    for (int oc = threadIdx.x; oc < out_channels; oc += blockDim.x) {
+        out_feat[oc] = 0;
+    }
+
+    for (int64_t n_idx = neighbor_start; n_idx < neighbor_end; ++n_idx) {
+        const TIndex inp_idx = neighbors_index[n_idx];
+
+        TReal x, y, z;
+        x = inp_positions[inp_idx * 3 + 0] - out_pos[0];
+        y = inp_positions[inp_idx * 3 + 1] - out_pos[1];
+        z = inp_positions[inp_idx * 3 + 2] - out_pos[2];
+
+        ComputeFilterCoordinates<ALIGN_CORNERS, MAPPING>(
+                x, y, z, filter_size_x, filter_size_y, filter_size_z,
+                inv_extents[0], inv_extents[1], inv_extents[2], offset[0],
+                offset[1], offset[2]);
+        Interpolate<INTERPOLATION>(interp_weights, interp_indices, x, y, z,
+                                   filter_size_x, filter_size_y, filter_size_z);
+
+        TFeat importance = 1;
+        if (POINT_IMPORTANCE) importance = inp_importance[inp_idx];
+        if (NEIGHBOR_IMPORTANCE) importance *= neighbors_importance[n_idx];
+        if (NORMALIZE && normalizer != 0) importance /= normalizer;
+
+        __syncthreads();
+        for (int ic = threadIdx.x; ic < in_channels; ic += blockDim.x) {
+            inp_feat[ic] =
+                    importance * inp_features[inp_idx * in_channels + ic];
+        }
+        __syncthreads();
+
+        // each thread owns a set of output channels
+        for (int oc = threadIdx.x; oc < out_channels; oc += blockDim.x) {
+            TOut value = 0;
+            for (int j = 0; j < NUM_INTERP_VALUES; ++j) {
+                const TFeat* filter_row =
+                        filter + int64_t(interp_indices[j]) * in_channels *
+                                         out_channels;
+                TOut partial = 0;
+                for (int ic = 0; ic < in_channels; ++ic) {
+                    partial += filter_row[ic * out_channels + oc] *
+                               inp_feat[ic];
+                }
+                value += interp_weights[j] * partial;
+            }
+            out_feat[oc] += value;
+        }
+    }  // for n
+
+    for (int oc = threadIdx.x; oc < out_channels; oc += blockDim.x) {
+        out_features[int64_t(out_idx) * out_channels + oc] = out_feat[oc];
+    }
+}
+
+template <class TFeat, class TOut, class TReal, class TIndex>
+void ComputeFeaturesFused(
+        const cudaStream_t& stream,
+        TOut* out_features,
+        int in_channels,
+        int out_channels,
+        const TFeat* const __restrict__ filter,
+        TIndex num_out,
+        const TReal* const __restrict__ out_positions,
+        const TReal* const __restrict__ inp_positions,
+        const TFeat* const __restrict__ inp_features,
+        const TFeat* const __restrict__ inp_importance,
+        const TIndex* const __restrict__ neighbors_index,
+        const TFeat* const __restrict__ neighbors_importance,
+        const int64_t* const __restrict__ neighbors_row_splits,
+        const TReal* const __restrict__ extents,
+        const TReal* const __restrict__ offsets,
+        const std::vector<int>& filter_dims,
+        InterpolationMode interpolation,
+        CoordinateMapping coordinate_mapping,
+        bool align_corners,
+        bool individual_extent,
+        bool isotropic_extent,
+        bool normalize) {
+    const int filter_size_z = filter_dims[0];
+    const int filter_size_y = filter_dims[1];
+    const int filter_size_x = filter_dims[2];
+
+    const int BLOCKSIZE = out_channels > 32 ? 64 : 32;
+    dim3 block(BLOCKSIZE, 1, 1);
+    dim3 grid(0, 1, 1);
+    grid.x = num_out;
+    const size_t shared_mem_size =
+            sizeof(TFeat) * in_channels + sizeof(TOut) * out_channels;
+
+#define FN_PARAMETERS                                                      \
+    out_features, in_channels, out_channels, filter, num_out,              \
+            out_positions, inp_positions, inp_features, inp_importance,    \
+            neighbors_index, neighbors_importance, neighbors_row_splits,   \
+            extents, offsets, filter_size_x, filter_size_y, filter_size_z, \
+            individual_extent, isotropic_extent, normalize,                \
+            inp_importance != nullptr, neighbors_importance != nullptr
+
+#define CALL_TEMPLATE(INTERPOLATION, MAPPING, ALIGN_CORNERS)                  \
+    if (INTERPOLATION == interpolation && MAPPING == coordinate_mapping &&    \
+        ALIGN_CORNERS == align_corners)                                       \
+        ComputeFeaturesFusedKernel<TFeat, TOut, TReal, TIndex, ALIGN_CORNERS, \
+                                   MAPPING, INTERPOLATION>                    \
+                <<<grid, block, shared_mem_size, stream>>>(FN_PARAMETERS);
+
+#define CALL_TEMPLATE2(INTERPOLATION, MAPPING)  \
+    CALL_TEMPLATE(INTERPOLATION, MAPPING, true) \
+    CALL_TEMPLATE(INTERPOLATION, MAPPING, false)
+
+#define CALL_TEMPLATE3(INTERPOLATION)                                     \
+    CALL_TEMPLATE2(INTERPOLATION, CoordinateMapping::BALL_TO_CUBE_RADIAL) \
+    CALL_TEMPLATE2(INTERPOLATION,                                         \
+                   CoordinateMapping::BALL_TO_CUBE_VOLUME_PRESERVING)     \
+    CALL_TEMPLATE2(INTERPOLATION, CoordinateMapping::IDENTITY)
+
+#define CALL_TEMPLATE4                               \
+    CALL_TEMPLATE3(InterpolationMode::LINEAR)        \
+    CALL_TEMPLATE3(InterpolationMode::LINEAR_BORDER) \
+    CALL_TEMPLATE3(InterpolationMode::NEAREST_NEIGHBOR)
+
+    if (grid.x) {
+        CALL_TEMPLATE4
+        /*CHECK_CUDA_ERROR*/
+    }
+
+#undef CALL_TEMPLATE
+#undef CALL_TEMPLATE2
+#undef CALL_TEMPLATE3
+#undef CALL_TEMPLATE4
+
+#undef FN_PARAMETERS
+}
+
+template void ComputeFeaturesFused<float, float, float, int32_t>(
+        const cudaStream_t& stream,
+        float* out_features,
+        int in_channels,
+        int out_channels,
+        const float* const __restrict__ filter,
+        int32_t num_out,
+        const float* const __restrict__ out_positions,
+        const float* const __restrict__ inp_positions,
+        const float* const __restrict__ inp_features,
+        const float* const __restrict__ inp_importance,
+        const int32_t* const __restrict__ neighbors_index,
+        const float* const __restrict__ neighbors_importance,
+        const int64_t* const __restrict__ neighbors_row_splits,
+        const float* const __restrict__ extents,
+        const float* const __restrict__ offsets,
+        const std::vector<int>& filter_dims,
+        InterpolationMode interpolation,
+        CoordinateMapping coordinate_mapping,
+        bool align_corners,
+        bool individual_extent,
+        bool isotropic_extent,
+        bool normalize);
+
 template <class TFeat,
           class TReal,
           class TIndex,
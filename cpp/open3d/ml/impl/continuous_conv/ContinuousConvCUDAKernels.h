@@ -138,6 +138,49 @@ void FillColumn(const cudaStream_t& stream,
                 bool isotropic_extent,
                 bool normalize);
 
+/// Computes the output features of a continuous convolution without the
+/// intermediate column matrix. Each output point is processed by a thread
+/// block, which interpolates the filter for each neighbor and accumulates
+/// the output features in shared memory. This is efficient for small
+/// neighborhoods, for which most of the column matrix would be zero.
+///
+/// \param out_features    Output array for the computed features with shape
+///        [num_out, out_channels].
+///
+/// \param in_channels    Number of input channels.
+///
+/// \param out_channels    Number of output channels.
+///
+/// \param filter    Pointer to the filter values with shape
+///        [spatial filter dims, in_channels, out_channels].
+///
+/// For the remaining parameters see FillColumn.
+///
+template <class TFeat, class TOut, class TReal, class TIndex>
+void ComputeFeaturesFused(
+        const cudaStream_t& stream,
+        TOut* out_features,
+        int in_channels,
+        int out_channels,
+        const TFeat* const __restrict__ filter,
+        TIndex num_out,
+        const TReal* const __restrict__ out_positions,
+        const TReal* const __restrict__ inp_positions,
+        const TFeat* const __restrict__ inp_features,
+        const TFeat* const __restrict__ inp_importance,
+        const TIndex* const __restrict__ neighbors_index,
+        const TFeat* const __restrict__ neighbors_importance,
+        const int64_t* const __restrict__ neighbors_row_splits,
+        const TReal* const __restrict__ extents,
+        const TReal* const __restrict__ offsets,
+        const std::vector<int>& filter_dims,
+        InterpolationMode interpolation,
+        CoordinateMapping coordinate_mapping,
+        bool align_corners,
+        bool individual_extent,
+        bool isotropic_extent,
+        bool normalize);
+
 template <class TFeat, class TReal, class TIndex>
 void FillColumnTranspose(
         const cudaStream_t& stream,
@@ -31,14 +31,13 @@
 #include <Eigen/Core>
 #include <unordered_map>
 
+#include "open3d/ml/impl/misc/VoxelReduce.h"
 #include "open3d/utility/Helper.h"
 
 namespace open3d {
 namespace ml {
 namespace impl {
 
-enum AccumulationFn { AVERAGE = 0, NEAREST_NEIGHBOR, MAX, CENTER };
-
 template <class TReal,
           class TFeat,
           AccumulationFn POS_FN,
@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace open3d {
+namespace ml {
+namespace impl {
+
+/// Functions for accumulating the positions and features of the points in a
+/// voxel.
+enum AccumulationFn { AVERAGE = 0, NEAREST_NEIGHBOR, MAX, CENTER };
+
+#ifdef __CUDACC__
+#define HOST_DEVICE __host__ __device__
+#else
+#define HOST_DEVICE
+#endif
+
+/// Reduces the positions of the points in a voxel. The points are visited in
+/// the given order, which makes the result deterministic.
+///
+/// \param out_position    The output position with NDIM elements.
+/// \param points    Array with the point positions. The shape is
+///        [num_points,NDIM].
+/// \param point_indices    The indices of the points in the voxel.
+/// \param num_voxel_points    The number of points in the voxel. Must be
+///        positive.
+/// \param voxel_center    The center of the voxel with NDIM elements.
+/// \param position_fn    One of AVERAGE, NEAREST_NEIGHBOR, CENTER.
+/// \return Returns the index of the first point nearest to the voxel center.
+template <class T, int NDIM>
+HOST_DEVICE inline int64_t ReduceVoxelPosition(
+        T* out_position,
+        const T* const points,
+        const int64_t* const point_indices,
+        int64_t num_voxel_points,
+        const T* const voxel_center,
+        AccumulationFn position_fn) {
+    T sum[NDIM];
+    for (int d = 0; d < NDIM; ++d) {
+        sum[d] = T(0);
+    }
+    int64_t nearest_idx = point_indices[0];
+    T min_sqr_dist = T(0);
+    for (int64_t i = 0; i < num_voxel_points; ++i) {
+        const int64_t idx = point_indices[i];
+        T sqr_dist = T(0);
+        for (int d = 0; d < NDIM; ++d) {
+            const T p = points[idx * NDIM + d];
+            sum[d] += p;
+            sqr_dist += (p - voxel_center[d]) * (p - voxel_center[d]);
+        }
+        if (i == 0 || sqr_dist < min_sqr_dist) {
+            min_sqr_dist = sqr_dist;
+            nearest_idx = idx;
+        }
+    }
+    for (int d = 0; d < NDIM; ++d) {
+        if (position_fn == AVERAGE) {
+            out_position[d] = sum[d] / T(num_voxel_points);
+        } else if (position_fn == NEAREST_NEIGHBOR) {
+            out_position[d] = points[nearest_idx * NDIM + d];
+        } else {
+            out_position[d] = voxel_center[d];
+        }
+    }
+    return nearest_idx;
+}
+
+/// Reduces one feature channel of the points in a voxel. The points are
+/// visited in the given order, which makes the result deterministic.
+///
+/// \param features    Array with the point features. The shape is
+///        [num_points,num_channels].
+/// \param num_channels    The number of feature channels.
+/// \param channel    The channel to reduce.
+/// \param point_indices    The indices of the points in the voxel.
+/// \param num_voxel_points    The number of points in the voxel. Must be
+///        positive.
+/// \param nearest_idx    The index of the point nearest to the voxel center
+///        as returned by ReduceVoxelPosition().
+/// \param feature_fn    One of AVERAGE, NEAREST_NEIGHBOR, MAX.
+template <class TFeat>
+HOST_DEVICE inline TFeat ReduceVoxelFeature(const TFeat* const features,
+                                            int64_t num_channels,
+                                            int64_t channel,
+                                            const int64_t* const point_indices,
+                                            int64_t num_voxel_points,
+                                            int64_t nearest_idx,
+                                            AccumulationFn feature_fn) {
+    if (feature_fn == NEAREST_NEIGHBOR) {
+        return features[nearest_idx * num_channels + channel];
+    }
+    TFeat result = features[point_indices[0] * num_channels + channel];
+    for (int64_t i = 1; i < num_voxel_points; ++i) {
+        const TFeat f = features[point_indices[i] * num_channels + channel];
+        if (feature_fn == MAX) {
+            result = f > result ? f : result;
+        } else {
+            result += f;
+        }
+    }
+    if (feature_fn == AVERAGE) {
+        result /= TFeat(num_voxel_points);
+    }
+    return result;
+}
+
+#undef HOST_DEVICE
+
+}  // namespace impl
+}  // namespace ml
+}  // namespace open3d
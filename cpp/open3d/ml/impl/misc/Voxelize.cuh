@@ -31,6 +31,7 @@
 #include <cub/cub.cuh>
 
 #include "open3d/ml/impl/misc/MemoryAllocation.h"
+#include "open3d/ml/impl/misc/VoxelReduce.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/MiniVec.h"
 
@@ -326,6 +327,58 @@ void CopyPointIndices(const cudaStream_t& stream,
     }
 }
 
+template <class T, int NDIM>
+__global__ void VoxelReducePositionsKernel(
+        T* __restrict__ out_positions,
+        int64_t* __restrict__ out_point_counts,
+        int64_t* __restrict__ nearest_indices,
+        const T* const __restrict__ points,
+        const int32_t* const __restrict__ voxel_coords,
+        const int64_t* const __restrict__ voxel_point_indices,
+        const int64_t* const __restrict__ voxel_point_row_splits,
+        const open3d::utility::MiniVec<T, NDIM> voxel_size,
+        const open3d::utility::MiniVec<T, NDIM> points_range_min,
+        const AccumulationFn position_fn,
+        const int64_t num_voxels) {
+    const int64_t i = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (i >= num_voxels) return;
+
+    T voxel_center[NDIM];
+    for (int d = 0; d < NDIM; ++d) {
+        voxel_center[d] = points_range_min[d] +
+                          (voxel_coords[i * NDIM + d] + T(0.5)) * voxel_size[d];
+    }
+    const int64_t begin = voxel_point_row_splits[i];
+    const int64_t count = voxel_point_row_splits[i + 1] - begin;
+    out_point_counts[i] = count;
+    nearest_indices[i] = ReduceVoxelPosition<T, NDIM>(
+            out_positions + i * NDIM, points, voxel_point_indices + begin,
+            count, voxel_center, position_fn);
+}
+
+template <class T>
+__global__ void VoxelReduceFeaturesKernel(
+        T* __restrict__ out_features,
+        const T* const __restrict__ features,
+        const int64_t num_channels,
+        const int64_t* const __restrict__ voxel_point_indices,
+        const int64_t* const __restrict__ voxel_point_row_splits,
+        const int64_t* const __restrict__ nearest_indices,
+        const AccumulationFn feature_fn,
+        const int64_t num_voxels) {
+    // one thread per voxel and channel for coalesced writes
+    const int64_t linear_idx = int64_t(blockDim.x) * blockIdx.x + threadIdx.x;
+    if (linear_idx >= num_voxels * num_channels) return;
+
+    const int64_t i = linear_idx / num_channels;
+    const int64_t c = linear_idx % num_channels;
+    const int64_t begin = voxel_point_row_splits[i];
+    out_features[linear_idx] = ReduceVoxelFeature(
+            features, num_channels, c, voxel_point_indices + begin,
+            voxel_point_row_splits[i + 1] - begin, nearest_indices[i],
+            feature_fn);
+}
+
 }  // namespace
 
 /// This function voxelizes a point cloud.
@@ -609,6 +662,128 @@ void VoxelizeCUDA(const cudaStream_t& stream,
                      out_voxel_row_splits + 1, num_voxels);
 }
 
+/// This function reduces the points and features of each voxel computed by
+/// VoxelizeCUDA. The points of a voxel are reduced sequentially in the order
+/// of \p voxel_point_indices, which makes the results deterministic and equal
+/// to the results of VoxelReduceCPU.
+///
+/// All pointer arguments point to device memory unless stated
+/// otherwise.
+///
+/// \tparam T    Floating-point data type for the point positions and
+///         features.
+///
+/// \tparam NDIM    The number of dimensions of the points.
+///
+/// \param stream    The cuda stream for all kernel launches.
+///
+/// \param temp    Pointer to temporary memory. If nullptr then the required
+///        size of temporary memory will be written to \p temp_size and no
+///        work is done.
+///
+/// \param temp_size    The size of the temporary memory in bytes. This is
+///        used as an output if temp is nullptr
+///
+/// \param texture_alignment    The texture alignment in bytes. This is used
+///        for allocating segments within the temporary memory.
+///
+/// \param num_voxels    The number of voxels.
+///
+/// \param points    Array with the point positions. The shape is
+///        [num_points,NDIM].
+///
+/// \param num_channels    The number of feature channels.
+///
+/// \param features    Array with the point features. The shape is
+///        [num_points,num_channels].
+///
+/// \param voxel_coords    The integer voxel coordinates. The shape is
+///        [num_voxels,NDIM].
+///
+/// \param voxel_point_indices    The point indices of all voxels.
+///
+/// \param voxel_point_row_splits    The exclusive prefix sum defining the
+///        start and end of the point indices of each voxel. The shape is
+///        [num_voxels+1].
+///
+/// \param voxel_size    The edge lenghts of the voxel. The shape is
+///        [NDIM]. This pointer points to host memory!
+///
+/// \param points_range_min    The lower bound of the voxelized domain. The
+///        shape is [NDIM]. This pointer points to host memory!
+///
+/// \param position_fn    One of AVERAGE, NEAREST_NEIGHBOR, CENTER.
+///
+/// \param feature_fn    One of AVERAGE, NEAREST_NEIGHBOR, MAX.
+///
+/// \param out_positions    The output positions. The shape is
+///        [num_voxels,NDIM].
+///
+/// \param out_features    The output features. The shape is
+///        [num_voxels,num_channels].
+///
+/// \param out_point_counts    The output number of points of each voxel. The
+///        shape is [num_voxels].
+///
+template <class T, int NDIM>
+void VoxelReduceCUDA(const cudaStream_t& stream,
+                     void* temp,
+                     size_t& temp_size,
+                     int texture_alignment,
+                     int64_t num_voxels,
+                     const T* const points,
+                     int64_t num_channels,
+                     const T* const features,
+                     const int32_t* const voxel_coords,
+                     const int64_t* const voxel_point_indices,
+                     const int64_t* const voxel_point_row_splits,
+                     const T* const voxel_size,
+                     const T* const points_range_min,
+                     AccumulationFn position_fn,
+                     AccumulationFn feature_fn,
+                     T* out_positions,
+                     T* out_features,
+                     int64_t* out_point_counts) {
+    using namespace open3d::utility;
+    typedef MiniVec<T, NDIM> Vec_t;
+
+    const bool get_temp_size = !temp;
+
+    if (get_temp_size) {
+        temp = (char*)1;  // worst case pointer alignment
+        temp_size = std::numeric_limits<int64_t>::max();
+    }
+
+    MemoryAllocation mem_temp(temp, temp_size, texture_alignment);
+
+    std::pair<int64_t*, size_t> nearest_indices =
+            mem_temp.Alloc<int64_t>(num_voxels);
+
+    if (get_temp_size) {
+        // return the memory peak as the required temporary memory size.
+        temp_size = mem_temp.MaxUsed();
+        return;
+    }
+
+    const int BLOCKSIZE = 128;
+    if (num_voxels) {
+        const int64_t grid = DivUp(num_voxels, int64_t(BLOCKSIZE));
+        VoxelReducePositionsKernel<T, NDIM><<<grid, BLOCKSIZE, 0, stream>>>(
+                out_positions, out_point_counts, nearest_indices.first, points,
+                voxel_coords, voxel_point_indices, voxel_point_row_splits,
+                Vec_t(voxel_size), Vec_t(points_range_min), position_fn,
+                num_voxels);
+    }
+    if (num_voxels * num_channels) {
+        const int64_t grid =
+                DivUp(num_voxels * num_channels, int64_t(BLOCKSIZE));
+        VoxelReduceFeaturesKernel<T><<<grid, BLOCKSIZE, 0, stream>>>(
+                out_features, features, num_channels, voxel_point_indices,
+                voxel_point_row_splits, nearest_indices.first, feature_fn,
+                num_voxels);
+    }
+}
+
 }  // namespace impl
 }  // namespace ml
 }  // namespace open3d
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "open3d/core/Atomic.h"
+#include "open3d/ml/impl/misc/VoxelReduce.h"
 #include "open3d/utility/MiniVec.h"
 #include "open3d/utility/ParallelScan.h"
 
@@ -190,6 +191,96 @@ void VoxelizeCPU(size_t num_points,
            tmp_point_indices.size() * sizeof(int64_t));
 }
 
+/// This function reduces the points and features of each voxel computed by
+/// VoxelizeCPU. The points of a voxel are reduced in the order of
+/// \p voxel_point_indices, which makes the results deterministic.
+///
+/// \tparam T    Floating-point data type for the point positions and
+///         features.
+///
+/// \tparam NDIM    The number of dimensions of the points.
+///
+/// \param num_voxels    The number of voxels.
+///
+/// \param points    Array with the point positions. The shape is
+///        [num_points,NDIM].
+///
+/// \param num_channels    The number of feature channels.
+///
+/// \param features    Array with the point features. The shape is
+///        [num_points,num_channels].
+///
+/// \param voxel_coords    The integer voxel coordinates. The shape is
+///        [num_voxels,NDIM].
+///
+/// \param voxel_point_indices    The point indices of all voxels.
+///
+/// \param voxel_point_row_splits    The exclusive prefix sum defining the
+///        start and end of the point indices of each voxel. The shape is
+///        [num_voxels+1].
+///
+/// \param voxel_size    The edge lenghts of the voxel. The shape is [NDIM]
+///
+/// \param points_range_min    The lower bound of the voxelized domain. The
+///        shape is [NDIM].
+///
+/// \param position_fn    One of AVERAGE, NEAREST_NEIGHBOR, CENTER.
+///
+/// \param feature_fn    One of AVERAGE, NEAREST_NEIGHBOR, MAX.
+///
+/// \param out_positions    The output positions. The shape is
+///        [num_voxels,NDIM].
+///
+/// \param out_features    The output features. The shape is
+///        [num_voxels,num_channels].
+///
+/// \param out_point_counts    The output number of points of each voxel. The
+///        shape is [num_voxels].
+///
+template <class T, int NDIM>
+void VoxelReduceCPU(int64_t num_voxels,
+                    const T* const points,
+                    int64_t num_channels,
+                    const T* const features,
+                    const int32_t* const voxel_coords,
+                    const int64_t* const voxel_point_indices,
+                    const int64_t* const voxel_point_row_splits,
+                    const T* const voxel_size,
+                    const T* const points_range_min,
+                    AccumulationFn position_fn,
+                    AccumulationFn feature_fn,
+                    T* out_positions,
+                    T* out_features,
+                    int64_t* out_point_counts) {
+    tbb::parallel_for(
+            tbb::blocked_range<int64_t>(0, num_voxels),
+            [&](const tbb::blocked_range<int64_t>& r) {
+                for (int64_t i = r.begin(); i != r.end(); ++i) {
+                    T voxel_center[NDIM];
+                    for (int d = 0; d < NDIM; ++d) {
+                        voxel_center[d] =
+                                points_range_min[d] +
+                                (voxel_coords[i * NDIM + d] + T(0.5)) *
+                                        voxel_size[d];
+                    }
+                    const int64_t begin = voxel_point_row_splits[i];
+                    const int64_t count = voxel_point_row_splits[i + 1] - begin;
+                    out_point_counts[i] = count;
+                    const int64_t nearest_idx = ReduceVoxelPosition<T, NDIM>(
+                            out_positions + i * NDIM, points,
+                            voxel_point_indices + begin, count, voxel_center,
+                            position_fn);
+                    for (int64_t c = 0; c < num_channels; ++c) {
+                        out_features[i * num_channels + c] =
+                                ReduceVoxelFeature(
+                                        features, num_channels, c,
+                                        voxel_point_indices + begin, count,
+                                        nearest_idx, feature_fn);
+                    }
+                }
+            });
+}
+
 }  // namespace impl
 }  // namespace ml
 }  // namespace open3d
@@ -28,11 +28,9 @@
 
 #define EIGEN_USE_GPU
 
-#include <cutlass/gemm/gemm.h>
-#include <cutlass/gemm/sgemm_traits.h>
-
 #include "open3d/ml/impl/misc/MemoryAllocation.h"
 #include "open3d/ml/impl/sparse_conv/SparseConvCUDAKernels.h"
+#include "open3d/ml/impl/sparse_conv/SparseConvGemm.cuh"
 #include "open3d/utility/Helper.h"
 
 using open3d::utility::DivUp;
@@ -99,25 +97,30 @@ namespace impl {
 ///        number of points (neighbors_importance is null) or by the sum of
 ///        the respective values in neighbors_importance.
 ///
+/// \param precision    The precision of the matrix products. Modes other
+///        than GemmPrecision::FP32 use tensor cores if available.
+///
 template <class TFeat, class TOut, class TIndex, class TKernelIndex>
-void SparseConvComputeFeaturesCUDA(const cudaStream_t& stream,
-                                   void* temp,
-                                   size_t& temp_size,
-                                   size_t& max_temp_size,
-                                   int texture_alignment,
-                                   TOut* out_features,
-                                   const std::vector<int>& filter_dims,
-                                   const TFeat* filter,
-                                   TIndex num_out,
-                                   TIndex num_inp,
-                                   const TFeat* inp_features,
-                                   const TFeat* inp_importance,
-                                   size_t neighbors_index_size,
-                                   const TIndex* neighbors_index,
-                                   const TKernelIndex* neighbors_kernel_index,
-                                   const TFeat* neighbors_importance,
-                                   const int64_t* neighbors_row_splits,
-                                   bool normalize) {
+void SparseConvComputeFeaturesCUDA(
+        const cudaStream_t& stream,
+        void* temp,
+        size_t& temp_size,
+        size_t& max_temp_size,
+        int texture_alignment,
+        TOut* out_features,
+        const std::vector<int>& filter_dims,
+        const TFeat* filter,
+        TIndex num_out,
+        TIndex num_inp,
+        const TFeat* inp_features,
+        const TFeat* inp_importance,
+        size_t neighbors_index_size,
+        const TIndex* neighbors_index,
+        const TKernelIndex* neighbors_kernel_index,
+        const TFeat* neighbors_importance,
+        const int64_t* neighbors_row_splits,
+        bool normalize,
+        GemmPrecision precision = GemmPrecision::FP32) {
     const bool get_temp_size = !temp;
 
     if (get_temp_size) {
@@ -170,16 +173,6 @@ void SparseConvComputeFeaturesCUDA(const cudaStream_t& stream,
     size_t num_cols_per_run =
             std::min(mem_columns.second / bytes_per_column, size_t(num_out));
 
-    typedef cutlass::gemm::SgemmTraits<
-            cutlass::MatrixLayout::kColumnMajor,  // layout of A matrix (filter)
-            cutlass::MatrixLayout::kColumnMajor,  // layout of B matrix
-                                                  // (columns)
-            cutlass::Shape<8, 64, 64>             // threadblock tile size
-            >
-            GemmTraits;
-
-    typedef cutlass::gemm::Gemm<GemmTraits> Gemm;
-
     // this is the pointer to the patch matrix
     TFeat* columns = (TFeat*)mem_columns.first;
 
@@ -204,36 +197,15 @@ void SparseConvComputeFeaturesCUDA(const cudaStream_t& stream,
         int m = out_channels;
         int k = num_kernel_elements * in_channels;
         int n = num_cols_this_run;
-        float alpha = 1;
         const float* const A = filter;
         int lda = m;
         const float* const B = columns;
         int ldb = k;
-        float beta = 1;
         float* C = out_features + (run_i * num_cols_per_run * out_channels);
         int ldc = m;
 
-        typename Gemm::Params params;
-        int result = params.initialize(m,      // GEMM M dimension
-                                       n,      // GEMM N dimension
-                                       k,      // GEMM K dimension
-                                       alpha,  // scalar alpha
-                                       A,      // matrix A operand
-                                       lda,
-                                       B,  // matrix B operand
-                                       ldb,
-                                       beta,  // scalar beta
-                                       C,     // source matrix C
-                                       ldc,
-                                       C,  // destination matrix C
-                                       ldc);
-
-        if (result) {
-            throw std::runtime_error(
-                    "Failed to initialize CUTLASS Gemm::Params object.");
-        }
-
-        Gemm::launch(params, stream);
+        SparseConvGemm<false>(stream, precision, m, n, k, A, lda, B, ldb, C,
+                              ldc);
     }
 }
 
@@ -27,11 +27,9 @@
 #pragma once
 #define EIGEN_USE_GPU
 
-#include <cutlass/gemm/gemm.h>
-#include <cutlass/gemm/sgemm_traits.h>
-
 #include "open3d/ml/impl/misc/MemoryAllocation.h"
 #include "open3d/ml/impl/sparse_conv/SparseConvCUDAKernels.h"
+#include "open3d/ml/impl/sparse_conv/SparseConvGemm.cuh"
 #include "open3d/utility/Helper.h"
 
 using open3d::utility::DivUp;
@@ -96,25 +94,30 @@ namespace impl {
 ///        by the number of points (neighbors_importance is null) or by the sum
 ///        of the respective values in neighbors_importance.
 ///
+/// \param precision    The precision of the matrix products. Modes other
+///        than GemmPrecision::FP32 use tensor cores if available.
+///
 template <class TFeat, class TOut, class TIndex, class TKernelIndex>
-void SparseConvBackpropFilterCUDA(const cudaStream_t& stream,
-                                  void* temp,
-                                  size_t& temp_size,
-                                  size_t& max_temp_size,
-                                  int texture_alignment,
-                                  TOut* filter_backprop,
-                                  const std::vector<int>& filter_dims,
-                                  TIndex num_out,
-                                  TIndex num_inp,
-                                  const TFeat* inp_features,
-                                  const TFeat* inp_importance,
-                                  size_t neighbors_index_size,
-                                  const TIndex* neighbors_index,
-                                  const TKernelIndex* neighbors_kernel_index,
-                                  const TFeat* neighbors_importance,
-                                  const int64_t* neighbors_row_splits,
-                                  const TFeat* out_features_gradient,
-                                  bool normalize) {
+void SparseConvBackpropFilterCUDA(
+        const cudaStream_t& stream,
+        void* temp,
+        size_t& temp_size,
+        size_t& max_temp_size,
+        int texture_alignment,
+        TOut* filter_backprop,
+        const std::vector<int>& filter_dims,
+        TIndex num_out,
+        TIndex num_inp,
+        const TFeat* inp_features,
+        const TFeat* inp_importance,
+        size_t neighbors_index_size,
+        const TIndex* neighbors_index,
+        const TKernelIndex* neighbors_kernel_index,
+        const TFeat* neighbors_importance,
+        const int64_t* neighbors_row_splits,
+        const TFeat* out_features_gradient,
+        bool normalize,
+        GemmPrecision precision = GemmPrecision::FP32) {
     const bool get_temp_size = !temp;
 
     if (get_temp_size) {
@@ -169,15 +172,6 @@ void SparseConvBackpropFilterCUDA(const cudaStream_t& stream,
     size_t num_cols_per_run =
             std::min(mem_columns.second / bytes_per_column, size_t(num_out));
 
-    typedef cutlass::gemm::SgemmTraits<
-            cutlass::MatrixLayout::kColumnMajor,  // layout of A matrix
-            cutlass::MatrixLayout::kRowMajor,     // layout of B matrix
-            cutlass::Shape<8, 64, 64>             // threadblock tile size
-            >
-            GemmTraits;
-
-    typedef cutlass::gemm::Gemm<GemmTraits> Gemm;
-
     TFeat* columns = (TFeat*)mem_columns.first;
 
     // if we cannot process all data at once we need multiple runs
@@ -194,43 +188,22 @@ void SparseConvBackpropFilterCUDA(const cudaStream_t& stream,
                 neighbors_index, neighbors_kernel_index, neighbors_importance,
                 neighbors_row_splits, num_kernel_elements, normalize);
 
-        typename Gemm::Params params;
         // C is MxN
         // B is KxN
         // A is MxK
         int m = out_channels;
         int k = num_cols_this_run;
         int n = num_kernel_elements * in_channels;
-        float alpha = 1;
         const float* const A = out_features_gradient +
                                (run_i * num_cols_per_run * out_channels);
         int lda = m;
         const float* const B = columns;
         int ldb = n;
-        float beta = 1;
         float* C = filter_backprop;
         int ldc = m;
 
-        int result = params.initialize(m,      // GEMM M dimension
-                                       n,      // GEMM N dimension
-                                       k,      // GEMM K dimension
-                                       alpha,  // scalar alpha
-                                       A,      // matrix A operand
-                                       lda,
-                                       B,  // matrix B operand
-                                       ldb,
-                                       beta,  // scalar beta
-                                       C,     // source matrix C
-                                       ldc,
-                                       C,  // destination matrix C
-                                       ldc);
-
-        if (result) {
-            throw std::runtime_error(
-                    "Failed to initialize CUTLASS Gemm::Params object.");
-        }
-
-        Gemm::launch(params, stream);
+        SparseConvGemm<true>(stream, precision, m, n, k, A, lda, B, ldb, C,
+                             ldc);
     }
 }
 
@@ -0,0 +1,375 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cuda_fp16.h>
+#include <cuda_runtime.h>
+#include <cutlass/gemm/gemm.h>
+#include <cutlass/gemm/sgemm_traits.h>
+#include <mma.h>
+#if CUDART_VERSION >= 11000
+#include <cuda_bf16.h>
+#endif
+
+#include <stdexcept>
+
+#include "open3d/utility/Helper.h"
+
+namespace open3d {
+namespace ml {
+namespace impl {
+
+/// Precision of the matrix products used by the sparse convolutions.
+///
+/// FP32 uses the SIMT SGEMM. The other modes round the operands to TF32,
+/// FP16 or BF16 and multiply them with tensor cores, always accumulating in
+/// FP32. Modes that are not supported by the device or the compiled
+/// architectures fall back to FP32.
+enum class GemmPrecision { FP32, TF32, FP16, BF16 };
+
+namespace detail {
+
+/// Size of the square output tile computed by a thread block of the tensor
+/// core GEMM. Each of the 4 warps computes a 32x32 quadrant.
+constexpr int kWmmaTile = 64;
+constexpr int kWmmaBlockSize = 128;
+
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 700
+__device__ inline void ConvertGemmOperand(float value, half& out) {
+    out = __float2half(value);
+}
+#if __CUDA_ARCH__ >= 800
+__device__ inline void ConvertGemmOperand(float value, __nv_bfloat16& out) {
+    out = __float2bfloat16(value);
+}
+__device__ inline void ConvertGemmOperand(float value, float& out) {
+    out = nvcuda::wmma::__float_to_tf32(value);
+}
+#endif
+
+/// Computes one 64x64 tile of C += A*B with A column major. The operands
+/// are rounded to TStorage while being staged in shared memory, which avoids
+/// a separate conversion pass over the patch matrix.
+template <class TElement, class TStorage, int K_STEP, bool B_ROW_MAJOR>
+__device__ void WmmaGemmBlock(int m,
+                              int n,
+                              int k,
+                              const float* __restrict__ A,
+                              int lda,
+                              const float* __restrict__ B,
+                              int ldb,
+                              float* __restrict__ C,
+                              int ldc) {
+    using namespace nvcuda;
+    __shared__ __align__(32) TStorage A_tile[K_STEP * kWmmaTile];
+    __shared__ __align__(32) TStorage B_tile[kWmmaTile * K_STEP];
+    __shared__ __align__(32) float C_tile[kWmmaTile * kWmmaTile];
+
+    const int tile_m = blockIdx.x * kWmmaTile;
+    const int tile_n = blockIdx.y * kWmmaTile;
+    const int warp = threadIdx.x / 32;
+    const int warp_m = (warp % 2) * 32;
+    const int warp_n = (warp / 2) * 32;
+
+    wmma::fragment<wmma::matrix_a, 16, 16, K_STEP, TElement, wmma::col_major>
+            a_frag[2];
+    wmma::fragment<wmma::matrix_b, 16, 16, K_STEP, TElement, wmma::col_major>
+            b_frag[2];
+    wmma::fragment<wmma::accumulator, 16, 16, K_STEP, float> acc[2][2];
+    for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < 2; ++j) {
+            wmma::fill_fragment(acc[i][j], 0.0f);
+        }
+    }
+
+    for (int k0 = 0; k0 < k; k0 += K_STEP) {
+        // both tiles are stored column major with zero padding at the borders
+        for (int idx = threadIdx.x; idx < K_STEP * kWmmaTile;
+             idx += kWmmaBlockSize) {
+            const int row = idx % kWmmaTile;
+            const int col = idx / kWmmaTile;
+            const int a_row = tile_m + row;
+            const int a_col = k0 + col;
+            float value = 0;
+            if (a_row < m && a_col < k) {
+                value = A[a_row + int64_t(a_col) * lda];
+            }
+            ConvertGemmOperand(value, A_tile[idx]);
+        }
+        for (int idx = threadIdx.x; idx < K_STEP * kWmmaTile;
+             idx += kWmmaBlockSize) {
+            int row, col;
+            if (B_ROW_MAJOR) {
+                row = idx / kWmmaTile;
+                col = idx % kWmmaTile;
+            } else {
+                row = idx % K_STEP;
+                col = idx / K_STEP;
+            }
+            const int b_row = k0 + row;
+            const int b_col = tile_n + col;
+            float value = 0;
+            if (b_row < k && b_col < n) {
+                value = B_ROW_MAJOR ? B[int64_t(b_row) * ldb + b_col]
+                                    : B[b_row + int64_t(b_col) * ldb];
+            }
+            ConvertGemmOperand(value, B_tile[row + col * K_STEP]);
+        }
+        __syncthreads();
+
+        for (int i = 0; i < 2; ++i) {
+            wmma::load_matrix_sync(a_frag[i], A_tile + warp_m + i * 16,
+                                   kWmmaTile);
+            wmma::load_matrix_sync(b_frag[i],
+                                   B_tile + (warp_n + i * 16) * K_STEP, K_STEP);
+        }
+        for (int i = 0; i < 2; ++i) {
+            for (int j = 0; j < 2; ++j) {
+                wmma::mma_sync(acc[i][j], a_frag[i], b_frag[j], acc[i][j]);
+            }
+        }
+        __syncthreads();
+    }
+
+    for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < 2; ++j) {
+            wmma::store_matrix_sync(C_tile + warp_m + i * 16 +
+                                            (warp_n + j * 16) * kWmmaTile,
+                                    acc[i][j], kWmmaTile, wmma::mem_col_major);
+        }
+    }
+    __syncthreads();
+
+    for (int idx = threadIdx.x; idx < kWmmaTile * kWmmaTile;
+         idx += kWmmaBlockSize) {
+        const int row = tile_m + idx % kWmmaTile;
+        const int col = tile_n + idx / kWmmaTile;
+        if (row < m && col < n) {
+            C[row + int64_t(col) * ldc] += C_tile[idx];
+        }
+    }
+}
+#endif
+
+/// Selects the tile function for \p PRECISION. Only the supported
+/// specializations are instantiated for each architecture, since every tile
+/// function brings its own static shared memory.
+template <GemmPrecision PRECISION, bool B_ROW_MAJOR>
+struct WmmaGemmDispatch {
+    __device__ static void Run(
+            int, int, int, const float*, int, const float*, int, float*, int) {
+    }
+};
+
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 700
+template <bool B_ROW_MAJOR>
+struct WmmaGemmDispatch<GemmPrecision::FP16, B_ROW_MAJOR> {
+    __device__ static void Run(int m,
+                               int n,
+                               int k,
+                               const float* A,
+                               int lda,
+                               const float* B,
+                               int ldb,
+                               float* C,
+                               int ldc) {
+        WmmaGemmBlock<half, half, 16, B_ROW_MAJOR>(m, n, k, A, lda, B, ldb, C,
+                                                   ldc);
+    }
+};
+#endif
+
+#if defined(__CUDA_ARCH__) && __CUDA_ARCH__ >= 800
+template <bool B_ROW_MAJOR>
+struct WmmaGemmDispatch<GemmPrecision::TF32, B_ROW_MAJOR> {
+    __device__ static void Run(int m,
+                               int n,
+                               int k,
+                               const float* A,
+                               int lda,
+                               const float* B,
+                               int ldb,
+                               float* C,
+                               int ldc) {
+        WmmaGemmBlock<nvcuda::wmma::precision::tf32, float, 8, B_ROW_MAJOR>(
+                m, n, k, A, lda, B, ldb, C, ldc);
+    }
+};
+
+template <bool B_ROW_MAJOR>
+struct WmmaGemmDispatch<GemmPrecision::BF16, B_ROW_MAJOR> {
+    __device__ static void Run(int m,
+                               int n,
+                               int k,
+                               const float* A,
+                               int lda,
+                               const float* B,
+                               int ldb,
+                               float* C,
+                               int ldc) {
+        WmmaGemmBlock<__nv_bfloat16, __nv_bfloat16, 16, B_ROW_MAJOR>(
+                m, n, k, A, lda, B, ldb, C, ldc);
+    }
+};
+#endif
+
+/// Tensor core GEMM kernel. The body is empty for architectures that do not
+/// support the requested precision, which is detected on the host with
+/// cudaFuncGetAttributes().
+template <GemmPrecision PRECISION, bool B_ROW_MAJOR>
+__global__ void WmmaGemmKernel(int m,
+                               int n,
+                               int k,
+                               const float* __restrict__ A,
+                               int lda,
+                               const float* __restrict__ B,
+                               int ldb,
+                               float* __restrict__ C,
+                               int ldc) {
+    WmmaGemmDispatch<PRECISION, B_ROW_MAJOR>::Run(m, n, k, A, lda, B, ldb, C,
+                                                  ldc);
+}
+
+/// Returns true if the kernel has been compiled for an architecture that
+/// supports \p precision on the current device.
+template <GemmPrecision PRECISION, bool B_ROW_MAJOR>
+bool IsWmmaGemmAvailable() {
+    const int min_version = PRECISION == GemmPrecision::FP16 ? 70 : 80;
+    cudaFuncAttributes attributes;
+    if (cudaFuncGetAttributes(&attributes,
+                              WmmaGemmKernel<PRECISION, B_ROW_MAJOR>) !=
+        cudaSuccess) {
+        cudaGetLastError();
+        return false;
+    }
+    return attributes.ptxVersion >= min_version;
+}
+
+template <GemmPrecision PRECISION, bool B_ROW_MAJOR>
+bool LaunchWmmaGemm(const cudaStream_t& stream,
+                    int m,
+                    int n,
+                    int k,
+                    const float* A,
+                    int lda,
+                    const float* B,
+                    int ldb,
+                    float* C,
+                    int ldc) {
+    if (!IsWmmaGemmAvailable<PRECISION, B_ROW_MAJOR>()) {
+        return false;
+    }
+    using open3d::utility::DivUp;
+    const dim3 grid(DivUp(m, kWmmaTile), DivUp(n, kWmmaTile));
+    WmmaGemmKernel<PRECISION, B_ROW_MAJOR>
+            <<<grid, kWmmaBlockSize, 0, stream>>>(m, n, k, A, lda, B, ldb, C,
+                                                  ldc);
+    return true;
+}
+
+}  // namespace detail
+
+/// Computes C += A*B for the column major matrix A with shape MxK, the
+/// matrix B with shape KxN and the column major matrix C with shape MxN.
+///
+/// \tparam B_ROW_MAJOR    If true B is stored row major, otherwise column
+///         major.
+///
+/// \param precision    The precision used for multiplying the operands.
+///        Unsupported precisions fall back to GemmPrecision::FP32.
+template <bool B_ROW_MAJOR>
+void SparseConvGemm(const cudaStream_t& stream,
+                    GemmPrecision precision,
+                    int m,
+                    int n,
+                    int k,
+                    const float* A,
+                    int lda,
+                    const float* B,
+                    int ldb,
+                    float* C,
+                    int ldc) {
+    bool launched = false;
+    switch (precision) {
+        case GemmPrecision::TF32:
+            launched = detail::LaunchWmmaGemm<GemmPrecision::TF32,
+                                              B_ROW_MAJOR>(
+                    stream, m, n, k, A, lda, B, ldb, C, ldc);
+            break;
+        case GemmPrecision::FP16:
+            launched = detail::LaunchWmmaGemm<GemmPrecision::FP16,
+                                              B_ROW_MAJOR>(
+                    stream, m, n, k, A, lda, B, ldb, C, ldc);
+            break;
+        case GemmPrecision::BF16:
+            launched = detail::LaunchWmmaGemm<GemmPrecision::BF16,
+                                              B_ROW_MAJOR>(
+                    stream, m, n, k, A, lda, B, ldb, C, ldc);
+            break;
+        default:
+            break;
+    }
+    if (launched) {
+        return;
+    }
+
+    typedef cutlass::gemm::SgemmTraits<
+            cutlass::MatrixLayout::kColumnMajor,  // layout of A matrix
+            B_ROW_MAJOR ? cutlass::MatrixLayout::kRowMajor
+                        : cutlass::MatrixLayout::kColumnMajor,  // layout of B
+            cutlass::Shape<8, 64, 64>  // threadblock tile size
+            >
+            GemmTraits;
+
+    typedef cutlass::gemm::Gemm<GemmTraits> Gemm;
+
+    typename Gemm::Params params;
+    int result = params.initialize(m,  // GEMM M dimension
+                                   n,  // GEMM N dimension
+                                   k,  // GEMM K dimension
+                                   1,  // scalar alpha
+                                   A,  // matrix A operand
+                                   lda,
+                                   B,  // matrix B operand
+                                   ldb,
+                                   1,  // scalar beta
+                                   C,  // source matrix C
+                                   ldc,
+                                   C,  // destination matrix C
+                                   ldc);
+
+    if (result) {
+        throw std::runtime_error(
+                "Failed to initialize CUTLASS Gemm::Params object.");
+    }
+
+    Gemm::launch(params, stream);
+}
+
+}  // namespace impl
+}  // namespace ml
+}  // namespace open3d
@@ -27,12 +27,10 @@
 #pragma once
 #define EIGEN_USE_GPU
 
-#include <cutlass/gemm/gemm.h>
-#include <cutlass/gemm/sgemm_traits.h>
-
 #include "open3d/ml/impl/continuous_conv/ContinuousConvCUDAKernels.h"
 #include "open3d/ml/impl/misc/MemoryAllocation.h"
 #include "open3d/ml/impl/sparse_conv/SparseConvCUDAKernels.h"
+#include "open3d/ml/impl/sparse_conv/SparseConvGemm.cuh"
 #include "open3d/utility/Helper.h"
 
 using open3d::utility::DivUp;
@@ -109,6 +107,9 @@ namespace impl {
 ///        number of points (neighbors_importance is null) or by the sum of
 ///        the respective values in neighbors_importance.
 ///
+/// \param precision    The precision of the matrix products. Modes other
+///        than GemmPrecision::FP32 use tensor cores if available.
+///
 template <class TFeat, class TOut, class TIndex, class TKernelIndex>
 void SparseConvTransposeBackpropFilterCUDA(
         const cudaStream_t& stream,
@@ -130,7 +131,8 @@ void SparseConvTransposeBackpropFilterCUDA(
         const TFeat* neighbors_importance,
         const int64_t* neighbors_row_splits,
         const TFeat* out_features_gradient,
-        bool normalize) {
+        bool normalize,
+        GemmPrecision precision = GemmPrecision::FP32) {
     const bool get_temp_size = !temp;
 
     if (get_temp_size) {
@@ -184,15 +186,6 @@ void SparseConvTransposeBackpropFilterCUDA(
             sizeof(TOut) * num_kernel_elements * in_channels * out_channels,
             stream);
 
-    typedef cutlass::gemm::SgemmTraits<
-            cutlass::MatrixLayout::kColumnMajor,  // layout of A matrix
-            cutlass::MatrixLayout::kRowMajor,     // layout of B matrix
-            cutlass::Shape<8, 64, 64>             // threadblock tile size
-            >
-            GemmTraits;
-
-    typedef cutlass::gemm::Gemm<GemmTraits> Gemm;
-
     TFeat* columns = (TFeat*)mem_columns.first;
     TFeat* gradient = ((TFeat*)mem_columns.first) +
                       num_cols_per_run * num_kernel_elements * in_channels;
@@ -224,43 +217,21 @@ void SparseConvTransposeBackpropFilterCUDA(
                 neighbors_kernel_index, neighbors_importance,
                 neighbors_row_splits, num_kernel_elements, normalize);
 
-        typename Gemm::Params params;
         // C is MxN
         // B is KxN
         // A is MxK
         int m = out_channels;
         int k = num_cols_this_run;
         int n = num_kernel_elements * in_channels;
-        float alpha = 1;
         const float* const A = gradient;
         int lda = m;
         const float* const B = columns;
         int ldb = n;
-        float beta = 1;
         float* C = filter_backprop;
         int ldc = m;
 
-        int result =
-                params.initialize(m,      // GEMM M dimension
-                                  n,      // GEMM N dimension
-                                  k,      // GEMM K dimension
-                                  alpha,  // scalar alpha
-                                  A,      // matrix A operand
-                                  lda,
-                                  B,  // matrix B operand
-                                  ldb,
-                                  beta,  // scalar beta
-                                  C,     // source matrix C
-                                  ldc,
-                                  C,  // destination matrix C (may be different
-                                  ldc);
-
-        if (result) {
-            throw std::runtime_error(
-                    "Failed to initialize CUTLASS Gemm::Params object.");
-        }
-
-        Gemm::launch(params, stream);
+        SparseConvGemm<true>(stream, precision, m, n, k, A, lda, B, ldb, C,
+                             ldc);
     }
 }
 
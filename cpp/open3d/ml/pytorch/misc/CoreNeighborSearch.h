@@ -0,0 +1,150 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/BatchedNearestNeighborSearch.h"
+#include "open3d/ml/impl/misc/NeighborSearchCommon.h"
+#include "open3d/ml/pytorch/TorchHelper.h"
+#include "torch/script.h"
+
+// Helpers for running the neighbor search ops with
+// open3d::core::nns::BatchedNearestNeighborSearch, which is the search engine
+// for CUDA tensors.
+
+/// Wraps a torch tensor as a core tensor without copying. The core tensor
+/// keeps a reference to the torch tensor.
+inline open3d::core::Tensor TorchToCoreTensor(const torch::Tensor& tensor) {
+    using namespace open3d::core;
+    torch::Tensor t = tensor.contiguous();
+    Dtype dtype;
+    if (t.dtype() == torch::kFloat32) {
+        dtype = Dtype::Float32;
+    } else if (t.dtype() == torch::kFloat64) {
+        dtype = Dtype::Float64;
+    } else if (t.dtype() == torch::kInt64) {
+        dtype = Dtype::Int64;
+    } else {
+        TORCH_CHECK(false, "Unsupported dtype " + t.toString());
+    }
+    Device device;
+    if (t.is_cuda()) {
+        device = Device(Device::DeviceType::CUDA, t.device().index());
+    }
+    SizeVector shape(t.sizes().begin(), t.sizes().end());
+    auto blob = std::make_shared<Blob>(device, t.data_ptr(), [t](void*) {});
+    return Tensor(shape, shape_util::DefaultStrides(shape), t.data_ptr(),
+                  dtype, blob);
+}
+
+/// Wraps a core tensor as a torch tensor without copying. The torch tensor
+/// keeps a reference to the core tensor.
+inline torch::Tensor CoreToTorchTensor(const open3d::core::Tensor& tensor,
+                                       const torch::Device& device) {
+    using namespace open3d::core;
+    Tensor t = tensor.Contiguous();
+    torch::Dtype dtype;
+    if (t.GetDtype() == Dtype::Float32) {
+        dtype = torch::kFloat32;
+    } else if (t.GetDtype() == Dtype::Float64) {
+        dtype = torch::kFloat64;
+    } else if (t.GetDtype() == Dtype::Int64) {
+        dtype = torch::kInt64;
+    } else {
+        TORCH_CHECK(false, "Unsupported dtype " + t.GetDtype().ToString());
+    }
+    std::vector<int64_t> sizes(t.GetShape().begin(), t.GetShape().end());
+    auto options = torch::dtype(dtype).device(device);
+    if (t.NumElements() == 0) {
+        return torch::empty(sizes, options);
+    }
+    return torch::from_blob(t.GetDataPtr(), sizes, [t](void*) {}, options);
+}
+
+/// Converts the metric of the ops to the metric of core::nns.
+inline open3d::core::nns::Metric ToCoreMetric(
+        open3d::ml::impl::Metric metric) {
+    switch (metric) {
+        case open3d::ml::impl::L1:
+            return open3d::core::nns::L1;
+        case open3d::ml::impl::Linf:
+            return open3d::core::nns::Linf;
+        default:
+            return open3d::core::nns::L2;
+    }
+}
+
+/// Converts the results of BatchedNearestNeighborSearch to the outputs of the
+/// neighbor search ops. The neighbors with the same position as their query
+/// are removed if \p ignore_query_point is true. The distances are divided by
+/// the (squared for L2) radius of the query if \p radii is defined.
+inline std::tuple<torch::Tensor, torch::Tensor, torch::Tensor>
+CoreNeighborsToTorch(const torch::Tensor& points,
+                     const torch::Tensor& queries,
+                     const open3d::core::Tensor& core_indices,
+                     const open3d::core::Tensor& core_distances,
+                     const open3d::core::Tensor& core_row_splits,
+                     open3d::ml::impl::Metric metric,
+                     bool ignore_query_point,
+                     bool return_distances,
+                     const torch::Tensor& radii = torch::Tensor()) {
+    const torch::Device device = points.device();
+    torch::Tensor indices = CoreToTorchTensor(core_indices, device);
+    torch::Tensor distances = CoreToTorchTensor(core_distances, device);
+    torch::Tensor row_splits = CoreToTorchTensor(core_row_splits, device);
+
+    if (ignore_query_point || (return_distances && radii.defined())) {
+        torch::Tensor counts =
+                row_splits.slice(0, 1) - row_splits.slice(0, 0, -1);
+        torch::Tensor query_ids = torch::repeat_interleave(counts);
+        if (ignore_query_point) {
+            torch::Tensor keep = points.index_select(0, indices)
+                                         .ne(queries.index_select(0, query_ids))
+                                         .any(1);
+            indices = indices.masked_select(keep);
+            distances = distances.masked_select(keep);
+            query_ids = query_ids.masked_select(keep);
+            counts = torch::bincount(query_ids, {}, queries.size(0));
+            row_splits = torch::cat({torch::zeros({1}, row_splits.options()),
+                                     counts.cumsum(0)});
+        }
+        if (return_distances && radii.defined()) {
+            torch::Tensor query_radii = radii.index_select(0, query_ids);
+            if (metric == open3d::ml::impl::L2) {
+                query_radii = query_radii * query_radii;
+            }
+            distances = distances / query_radii;
+        }
+    }
+    if (!return_distances) {
+        distances = torch::empty({0}, points.options());
+    }
+    return std::make_tuple(indices.to(torch::kInt32), row_splits, distances);
+}
@@ -27,6 +27,7 @@
 
 #include "open3d/ml/impl/misc/KnnSearch.h"
 #include "open3d/ml/pytorch/TorchHelper.h"
+#include "open3d/ml/pytorch/misc/CoreNeighborSearch.h"
 #include "open3d/ml/pytorch/misc/NeighborSearchAllocator.h"
 #include "torch/script.h"
 
@@ -123,6 +124,28 @@ void KnnSearchCPU(const torch::Tensor& points,
     neighbors_distance = output_allocator.NeighborsDistance();
 }
 
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> KnnSearchCUDA(
+        const torch::Tensor& points,
+        const torch::Tensor& queries,
+        const int64_t k,
+        const torch::Tensor& points_row_splits,
+        const torch::Tensor& queries_row_splits,
+        const Metric metric,
+        const bool ignore_query_point,
+        const bool return_distances) {
+    open3d::core::nns::BatchedNearestNeighborSearch nns(
+            TorchToCoreTensor(points), TorchToCoreTensor(points_row_splits),
+            ToCoreMetric(metric));
+    TORCH_CHECK(nns.BuildIndex(), "Building the search index failed");
+    open3d::core::Tensor indices, distances, row_splits;
+    std::tie(indices, distances, row_splits) =
+            nns.KnnSearch(TorchToCoreTensor(queries),
+                          TorchToCoreTensor(queries_row_splits), k);
+    return CoreNeighborsToTorch(points, queries, indices, distances,
+                                row_splits, metric, ignore_query_point,
+                                return_distances);
+}
+
 #define INSTANTIATE(T)                                                    \
     template void KnnSearchCPU<T>(                                        \
             const torch::Tensor& points, const torch::Tensor& queries,    \
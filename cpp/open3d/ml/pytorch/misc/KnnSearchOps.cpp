@@ -46,6 +46,16 @@ void KnnSearchCPU(const torch::Tensor& points,
                   torch::Tensor& neighbors_row_splits,
                   torch::Tensor& neighbors_distance);
 
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> KnnSearchCUDA(
+        const torch::Tensor& points,
+        const torch::Tensor& queries,
+        const int64_t k,
+        const torch::Tensor& points_row_splits,
+        const torch::Tensor& queries_row_splits,
+        const Metric metric,
+        const bool ignore_query_point,
+        const bool return_distances);
+
 std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> KnnSearch(
         torch::Tensor points,
         torch::Tensor queries,
@@ -112,7 +122,9 @@ std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> KnnSearch(
     }
 
     if (points.is_cuda()) {
-        TORCH_CHECK(false, "KnnSearch does not support CUDA")
+        return KnnSearchCUDA(points, queries, k, points_row_splits,
+                             queries_row_splits, metric, ignore_query_point,
+                             return_distances);
     } else {
         CALL(float, KnnSearchCPU)
         CALL(double, KnnSearchCPU)
@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------q
 
+#include <tuple>
 #include <vector>
 
 #include "open3d/ml/contrib/Nms.h"
@@ -61,8 +62,65 @@ torch::Tensor Nms(torch::Tensor boxes,
     }
 }
 
+std::tuple<torch::Tensor, torch::Tensor> BatchedNms(torch::Tensor boxes,
+                                                    torch::Tensor scores,
+                                                    torch::Tensor row_splits,
+                                                    double nms_overlap_thresh) {
+    boxes = boxes.contiguous();
+    scores = scores.contiguous();
+    CHECK_TYPE(boxes, kFloat);
+    CHECK_TYPE(scores, kFloat);
+    CHECK_TYPE(row_splits, kInt64);
+    TORCH_CHECK(row_splits.dim() == 1 && row_splits.size(0) >= 1,
+                "row_splits must be a non-empty 1D tensor");
+
+    // The row splits are needed on the host for both devices.
+    torch::Tensor row_splits_cpu = row_splits.to(torch::kCPU).contiguous();
+    const int64_t* row_splits_ptr = row_splits_cpu.data_ptr<int64_t>();
+    const int num_batches = row_splits_cpu.size(0) - 1;
+    TORCH_CHECK(row_splits_ptr[0] == 0 &&
+                        row_splits_ptr[num_batches] == boxes.size(0),
+                "row_splits must start with 0 and end with the number of "
+                "boxes");
+
+    std::vector<int64_t> keep_indices;
+    std::vector<int64_t> keep_row_splits;
+    if (boxes.is_cuda()) {
+#ifdef BUILD_CUDA_MODULE
+        keep_indices = open3d::ml::contrib::BatchedNmsCUDAKernel(
+                boxes.data_ptr<float>(), scores.data_ptr<float>(),
+                row_splits_ptr, num_batches, nms_overlap_thresh,
+                keep_row_splits);
+#else
+        TORCH_CHECK(false, "BatchedNms was not compiled with CUDA support");
+#endif
+    } else {
+        keep_indices = open3d::ml::contrib::BatchedNmsCPUKernel(
+                boxes.data_ptr<float>(), scores.data_ptr<float>(),
+                row_splits_ptr, num_batches, nms_overlap_thresh,
+                keep_row_splits);
+    }
+
+    // Copy the results since they are owned by the vectors.
+    auto to_tensor = [](std::vector<int64_t>& values, torch::Device device) {
+        return torch::from_blob(values.data(),
+                                {static_cast<int64_t>(values.size())},
+                                torch::TensorOptions().dtype(torch::kLong))
+                .clone()
+                .to(device);
+    };
+    return std::make_tuple(to_tensor(keep_indices, boxes.device()),
+                           to_tensor(keep_row_splits, row_splits.device()));
+}
+
 static auto registry = torch::RegisterOperators(
         "open3d::nms(Tensor boxes, Tensor scores, float "
         "nms_overlap_thresh) -> "
         "Tensor keep_indices",
         &Nms);
+
+static auto registry_batched = torch::RegisterOperators(
+        "open3d::batched_nms(Tensor boxes, Tensor scores, Tensor row_splits, "
+        "float nms_overlap_thresh) -> (Tensor keep_indices, Tensor "
+        "keep_row_splits)",
+        &BatchedNms);
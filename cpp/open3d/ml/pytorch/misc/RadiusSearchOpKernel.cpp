@@ -27,6 +27,7 @@
 
 #include "open3d/ml/impl/misc/RadiusSearch.h"
 #include "open3d/ml/pytorch/TorchHelper.h"
+#include "open3d/ml/pytorch/misc/CoreNeighborSearch.h"
 #include "open3d/ml/pytorch/misc/NeighborSearchAllocator.h"
 #include "torch/script.h"
 
@@ -126,6 +127,30 @@ void RadiusSearchCPU(const torch::Tensor& points,
     neighbors_distance = output_allocator.NeighborsDistance();
 }
 
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> RadiusSearchCUDA(
+        const torch::Tensor& points,
+        const torch::Tensor& queries,
+        const torch::Tensor& radii,
+        const torch::Tensor& points_row_splits,
+        const torch::Tensor& queries_row_splits,
+        const Metric metric,
+        const bool ignore_query_point,
+        const bool return_distances,
+        const bool normalize_distances) {
+    open3d::core::nns::BatchedNearestNeighborSearch nns(
+            TorchToCoreTensor(points), TorchToCoreTensor(points_row_splits),
+            ToCoreMetric(metric));
+    TORCH_CHECK(nns.BuildIndex(), "Building the search index failed");
+    open3d::core::Tensor indices, distances, row_splits;
+    std::tie(indices, distances, row_splits) = nns.RadiusSearch(
+            TorchToCoreTensor(queries), TorchToCoreTensor(queries_row_splits),
+            TorchToCoreTensor(radii), false);
+    return CoreNeighborsToTorch(
+            points, queries, indices, distances, row_splits, metric,
+            ignore_query_point, return_distances,
+            normalize_distances ? radii : torch::Tensor());
+}
+
 #define INSTANTIATE(T)                                                      \
     template void RadiusSearchCPU<T>(                                       \
             const torch::Tensor& points, const torch::Tensor& queries,      \
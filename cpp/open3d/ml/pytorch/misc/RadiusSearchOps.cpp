@@ -47,6 +47,17 @@ void RadiusSearchCPU(const torch::Tensor& points,
                      torch::Tensor& neighbors_row_splits,
                      torch::Tensor& neighbors_distance);
 
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> RadiusSearchCUDA(
+        const torch::Tensor& points,
+        const torch::Tensor& queries,
+        const torch::Tensor& radii,
+        const torch::Tensor& points_row_splits,
+        const torch::Tensor& queries_row_splits,
+        const Metric metric,
+        const bool ignore_query_point,
+        const bool return_distances,
+        const bool normalize_distances);
+
 std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> MultiRadiusSearch(
         torch::Tensor points,
         torch::Tensor queries,
@@ -115,7 +126,9 @@ std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> MultiRadiusSearch(
     }
 
     if (points.is_cuda()) {
-        TORCH_CHECK(false, "MultiRadiusSearch does not support CUDA")
+        return RadiusSearchCUDA(points, queries, radii, points_row_splits,
+                                queries_row_splits, metric, ignore_query_point,
+                                return_distances, normalize_distances);
     } else {
         CALL(float, RadiusSearchCPU)
         CALL(double, RadiusSearchCPU)
@@ -74,6 +74,58 @@ void VoxelizeCPU(const torch::Tensor& points,
     voxel_point_row_splits = output_allocator.VoxelPointRowSplits();
 }
 
+template <class T>
+void VoxelReduceCPU(const torch::Tensor& points,
+                    const torch::Tensor& features,
+                    const torch::Tensor& voxel_size,
+                    const torch::Tensor& points_range_min,
+                    const torch::Tensor& voxel_coords,
+                    const torch::Tensor& voxel_point_indices,
+                    const torch::Tensor& voxel_point_row_splits,
+                    const AccumulationFn position_fn,
+                    const AccumulationFn feature_fn,
+                    torch::Tensor& voxel_positions,
+                    torch::Tensor& voxel_features,
+                    torch::Tensor& voxel_point_counts) {
+    const int64_t num_voxels = voxel_coords.size(0);
+    const int64_t num_channels = features.size(1);
+    voxel_positions = torch::empty({num_voxels, points.size(1)},
+                                   points.options());
+    voxel_features = torch::empty({num_voxels, num_channels},
+                                  features.options());
+    voxel_point_counts = torch::empty(
+            {num_voxels}, torch::dtype(ToTorchDtype<int64_t>())
+                                  .device(points.device().type(),
+                                          points.device().index()));
+
+    switch (points.size(1)) {
+#define CASE(NDIM)                                                        \
+    case NDIM:                                                            \
+        VoxelReduceCPU<T, NDIM>(                                          \
+                num_voxels, points.data_ptr<T>(), num_channels,           \
+                features.data_ptr<T>(), voxel_coords.data_ptr<int32_t>(), \
+                voxel_point_indices.data_ptr<int64_t>(),                  \
+                voxel_point_row_splits.data_ptr<int64_t>(),               \
+                voxel_size.data_ptr<T>(), points_range_min.data_ptr<T>(), \
+                position_fn, feature_fn, voxel_positions.data_ptr<T>(),   \
+                voxel_features.data_ptr<T>(),                             \
+                voxel_point_counts.data_ptr<int64_t>());                  \
+        break;
+        CASE(1)
+        CASE(2)
+        CASE(3)
+        CASE(4)
+        CASE(5)
+        CASE(6)
+        CASE(7)
+        CASE(8)
+        default:
+            break;  // will be handled by the generic torch function
+
+#undef CASE
+    }
+}
+
 #define INSTANTIATE(T)                                                       \
     template void VoxelizeCPU<T>(                                            \
             const torch::Tensor& points, const torch::Tensor& voxel_size,    \
@@ -85,3 +137,18 @@ void VoxelizeCPU(const torch::Tensor& points,
 
 INSTANTIATE(float)
 INSTANTIATE(double)
+
+#define INSTANTIATE_REDUCE(T)                                                \
+    template void VoxelReduceCPU<T>(                                         \
+            const torch::Tensor& points, const torch::Tensor& features,      \
+            const torch::Tensor& voxel_size,                                 \
+            const torch::Tensor& points_range_min,                           \
+            const torch::Tensor& voxel_coords,                               \
+            const torch::Tensor& voxel_point_indices,                        \
+            const torch::Tensor& voxel_point_row_splits,                     \
+            const AccumulationFn position_fn,                                \
+            const AccumulationFn feature_fn, torch::Tensor& voxel_positions, \
+            torch::Tensor& voxel_features, torch::Tensor& voxel_point_counts);
+
+INSTANTIATE_REDUCE(float)
+INSTANTIATE_REDUCE(double)
@@ -26,6 +26,7 @@
 //
 #pragma once
 
+#include "open3d/ml/impl/misc/VoxelReduce.h"
 #include "open3d/ml/pytorch/TorchHelper.h"
 #include "torch/script.h"
 
@@ -40,6 +41,20 @@ void VoxelizeCPU(const torch::Tensor& points,
                  torch::Tensor& voxel_point_indices,
                  torch::Tensor& voxel_point_row_splits);
 
+template <class T>
+void VoxelReduceCPU(const torch::Tensor& points,
+                    const torch::Tensor& features,
+                    const torch::Tensor& voxel_size,
+                    const torch::Tensor& points_range_min,
+                    const torch::Tensor& voxel_coords,
+                    const torch::Tensor& voxel_point_indices,
+                    const torch::Tensor& voxel_point_row_splits,
+                    const open3d::ml::impl::AccumulationFn position_fn,
+                    const open3d::ml::impl::AccumulationFn feature_fn,
+                    torch::Tensor& voxel_positions,
+                    torch::Tensor& voxel_features,
+                    torch::Tensor& voxel_point_counts);
+
 #ifdef BUILD_CUDA_MODULE
 template <class T>
 void VoxelizeCUDA(const torch::Tensor& points,
@@ -51,6 +66,20 @@ void VoxelizeCUDA(const torch::Tensor& points,
                   torch::Tensor& voxel_coords,
                   torch::Tensor& voxel_point_indices,
                   torch::Tensor& voxel_point_row_splits);
+
+template <class T>
+void VoxelReduceCUDA(const torch::Tensor& points,
+                     const torch::Tensor& features,
+                     const torch::Tensor& voxel_size,
+                     const torch::Tensor& points_range_min,
+                     const torch::Tensor& voxel_coords,
+                     const torch::Tensor& voxel_point_indices,
+                     const torch::Tensor& voxel_point_row_splits,
+                     const open3d::ml::impl::AccumulationFn position_fn,
+                     const open3d::ml::impl::AccumulationFn feature_fn,
+                     torch::Tensor& voxel_positions,
+                     torch::Tensor& voxel_features,
+                     torch::Tensor& voxel_point_counts);
 #endif
 
 class VoxelizeOutputAllocator {
@@ -86,6 +86,7 @@ std::tuple<torch::Tensor, torch::Tensor, torch::Tensor> Voxelize(
         CALL(float, VoxelizeCPU)
         CALL(double, VoxelizeCPU)
     }
+#undef CALL
     TORCH_CHECK(false, "Voxelize does not support " + points.toString() +
                                " as input for values")
     return std::tuple<torch::Tensor, torch::Tensor, torch::Tensor>();
@@ -99,3 +100,116 @@ static auto registry = torch::RegisterOperators(
         "voxel_point_indices, "
         "Tensor voxel_point_row_splits)",
         &Voxelize);
+
+std::tuple<torch::Tensor, torch::Tensor, torch::Tensor, torch::Tensor>
+VoxelizeReduce(torch::Tensor points,
+               torch::Tensor features,
+               torch::Tensor voxel_size,
+               torch::Tensor points_range_min,
+               torch::Tensor points_range_max,
+               const int64_t max_points_per_voxel,
+               const int64_t max_voxels,
+               const std::string& position_fn_str,
+               const std::string& feature_fn_str) {
+    using open3d::ml::impl::AccumulationFn;
+    AccumulationFn position_fn = open3d::ml::impl::AVERAGE;
+    if (position_fn_str == "average") {
+        position_fn = open3d::ml::impl::AVERAGE;
+    } else if (position_fn_str == "nearest_neighbor") {
+        position_fn = open3d::ml::impl::NEAREST_NEIGHBOR;
+    } else if (position_fn_str == "center") {
+        position_fn = open3d::ml::impl::CENTER;
+    } else {
+        TORCH_CHECK(false,
+                    "position_fn must be one of ('average', "
+                    "'nearest_neighbor', 'center') but got " +
+                            position_fn_str);
+    }
+    AccumulationFn feature_fn = open3d::ml::impl::AVERAGE;
+    if (feature_fn_str == "average") {
+        feature_fn = open3d::ml::impl::AVERAGE;
+    } else if (feature_fn_str == "nearest_neighbor") {
+        feature_fn = open3d::ml::impl::NEAREST_NEIGHBOR;
+    } else if (feature_fn_str == "max") {
+        feature_fn = open3d::ml::impl::MAX;
+    } else {
+        TORCH_CHECK(false,
+                    "feature_fn must be one of ('average', "
+                    "'nearest_neighbor', 'max') but got " +
+                            feature_fn_str);
+    }
+
+    points = points.contiguous();
+    features = features.contiguous();
+    // make sure that these tensors are on the cpu
+    voxel_size = voxel_size.to(torch::kCPU).contiguous();
+    points_range_min = points_range_min.to(torch::kCPU).contiguous();
+    points_range_max = points_range_max.to(torch::kCPU).contiguous();
+
+    CHECK_SAME_DTYPE(points, features, voxel_size, points_range_min,
+                     points_range_max);
+    CHECK_SAME_DEVICE_TYPE(points, features);
+
+    // check input shapes
+    {
+        using namespace open3d::ml::op_util;
+        Dim num_points("num_points");
+        Dim ndim("ndim");
+        Dim num_channels("num_channels");
+        CHECK_SHAPE(points, num_points, ndim);
+        CHECK_SHAPE(features, num_points, num_channels);
+        CHECK_SHAPE(voxel_size, ndim);
+        CHECK_SHAPE(points_range_min, ndim);
+        CHECK_SHAPE(points_range_max, ndim);
+        TORCH_CHECK(0 < ndim.value() && ndim.value() < 9,
+                    "the number of dimensions must be in [1,..,8]");
+    }
+
+    const auto& points_dtype = points.dtype();
+
+    // output tensors
+    torch::Tensor voxel_coords, voxel_point_indices, voxel_point_row_splits;
+    torch::Tensor voxel_positions, voxel_features, voxel_point_counts;
+
+#define CALL(point_t, voxelize_fn, reduce_fn)                                 \
+    if (CompareTorchDtype<point_t>(points_dtype)) {                           \
+        voxelize_fn<point_t>(points, voxel_size, points_range_min,            \
+                             points_range_max, max_points_per_voxel,          \
+                             max_voxels, voxel_coords, voxel_point_indices,   \
+                             voxel_point_row_splits);                         \
+        reduce_fn<point_t>(points, features, voxel_size, points_range_min,    \
+                           voxel_coords, voxel_point_indices,                 \
+                           voxel_point_row_splits, position_fn, feature_fn,   \
+                           voxel_positions, voxel_features,                   \
+                           voxel_point_counts);                               \
+        return std::make_tuple(voxel_coords, voxel_positions, voxel_features, \
+                               voxel_point_counts);                           \
+    }
+
+    if (points.is_cuda()) {
+#ifdef BUILD_CUDA_MODULE
+        // pass to cuda function
+        CALL(float, VoxelizeCUDA, VoxelReduceCUDA)
+        CALL(double, VoxelizeCUDA, VoxelReduceCUDA)
+#else
+        TORCH_CHECK(false, "VoxelizeReduce was not compiled with CUDA support")
+#endif
+    } else {
+        CALL(float, VoxelizeCPU, VoxelReduceCPU)
+        CALL(double, VoxelizeCPU, VoxelReduceCPU)
+    }
+#undef CALL
+    TORCH_CHECK(false, "VoxelizeReduce does not support " +
+                               points.toString() + " as input for values")
+    return std::tuple<torch::Tensor, torch::Tensor, torch::Tensor,
+                      torch::Tensor>();
+}
+
+static auto registry_reduce = torch::RegisterOperators(
+        "open3d::voxelize_reduce(Tensor points, Tensor features, Tensor "
+        "voxel_size, Tensor points_range_min, Tensor points_range_max, int "
+        "max_points_per_voxel=9223372036854775807, "
+        "int max_voxels=9223372036854775807, str position_fn=\"average\", "
+        "str feature_fn=\"average\") -> (Tensor voxel_coords, Tensor "
+        "voxel_positions, Tensor voxel_features, Tensor voxel_point_counts)",
+        &VoxelizeReduce);
@@ -48,6 +48,25 @@ void furthest_point_sampling_launcher(
 
     auto stream = at::cuda::getCurrentCUDAStream();
 
+    if (n >= FPS_BUCKETED_MIN_POINTS) {
+        size_t temp_size = 0;
+        FurthestPointSamplingBucketed(stream, nullptr, temp_size, b, n, m,
+                                      dataset, idxs);
+        at::Tensor temp_tensor = at::empty(
+                {int64_t(temp_size)},
+                at::TensorOptions().dtype(at::kByte).device(at::kCUDA));
+        FurthestPointSamplingBucketed(stream, temp_tensor.data_ptr(), temp_size,
+                                      b, n, m, dataset, idxs);
+
+        err = cudaGetLastError();
+        if (cudaSuccess != err) {
+            fprintf(stderr, "CUDA kernel failed : %s\n",
+                    cudaGetErrorString(err));
+            exit(-1);
+        }
+        return;
+    }
+
     unsigned int n_threads = opt_n_threads(n);
 
     switch (n_threads) {
@@ -27,12 +27,11 @@
 
 #include <vector>
 
+#include "open3d/ml/contrib/PointSampling.h"
 #include "open3d/ml/pytorch/TorchHelper.h"
 #include "open3d/ml/pytorch/pointnet/SamplingKernel.h"
 #include "torch/script.h"
 
-#ifdef BUILD_CUDA_MODULE
-
 torch::Tensor furthest_point_sampling(torch::Tensor points,
                                       const int64_t sample_size) {
     int batch_size = points.size(0);
@@ -42,17 +41,30 @@ torch::Tensor furthest_point_sampling(torch::Tensor points,
     torch::Tensor out =
             torch::zeros({batch_size, sample_size},
                          torch::dtype(ToTorchDtype<int>()).device(device));
-    torch::Tensor temp =
-            torch::full({batch_size, pts_size}, 1e10,
-                        torch::dtype(ToTorchDtype<float>()).device(device));
 
-    const float *points_data = points.data_ptr<float>();
-    float *temp_data = temp.data_ptr<float>();
-    int *out_data = out.data_ptr<int>();
+    if (points.is_cuda()) {
+#ifdef BUILD_CUDA_MODULE
+        torch::Tensor temp = torch::full(
+                {batch_size, pts_size}, 1e10,
+                torch::dtype(ToTorchDtype<float>()).device(device));
 
-    furthest_point_sampling_launcher(batch_size, pts_size, sample_size,
-                                     points_data, temp_data, out_data);
+        const float *points_data = points.data_ptr<float>();
+        float *temp_data = temp.data_ptr<float>();
+        int *out_data = out.data_ptr<int>();
 
+        furthest_point_sampling_launcher(batch_size, pts_size, sample_size,
+                                         points_data, temp_data, out_data);
+#else
+        TORCH_CHECK(false,
+                    "furthest_point_sampling was not compiled with CUDA "
+                    "support");
+#endif
+    } else {
+        points = points.contiguous();
+        open3d::ml::contrib::FurthestPointSamplingCPU(
+                batch_size, pts_size, sample_size, points.data_ptr<float>(),
+                out.data_ptr<int>());
+    }
     return out;
 }
 
@@ -60,4 +72,3 @@ static auto registry_fp = torch::RegisterOperators(
         "open3d::furthest_point_sampling(Tensor points, int sample_siz)"
         " -> Tensor out",
         &furthest_point_sampling);
-#endif
@@ -81,6 +81,10 @@ void SparseConvCUDA(const torch::Tensor& filters,
 
     auto temp_tensor = CreateTempTensor(temp_size, device, &temp_ptr);
 
+    const GemmPrecision precision =
+            at::globalContext().allowTF32CuBLAS() ? GemmPrecision::TF32
+                                                  : GemmPrecision::FP32;
+
     // actually run the operation
     SparseConvComputeFeaturesCUDA<TFeat, TOut, TIndex, TKernelIndex>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
@@ -93,7 +97,7 @@ void SparseConvCUDA(const torch::Tensor& filters,
             neighbors_importance.size(0)
                     ? neighbors_importance.data_ptr<TFeat>()
                     : nullptr,
-            neighbors_row_splits.data_ptr<int64_t>(), normalize);
+            neighbors_row_splits.data_ptr<int64_t>(), normalize, precision);
 }
 #define INSTANTIATE(TFeat, TOut, TReal, TIndex)                              \
     template void SparseConvCUDA<TFeat, TOut, TReal, TIndex>(                \
@@ -89,6 +89,10 @@ void SparseConvTransposeBackpropFilterCUDA(
 
     auto temp_tensor = CreateTempTensor(temp_size, device, &temp_ptr);
 
+    const GemmPrecision precision =
+            at::globalContext().allowTF32CuBLAS() ? GemmPrecision::TF32
+                                                  : GemmPrecision::FP32;
+
     // actually run the operation
     SparseConvTransposeBackpropFilterCUDA<TFeat, TOut, TIndex, TKernelIndex>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
@@ -106,7 +110,7 @@ void SparseConvTransposeBackpropFilterCUDA(
                     ? neighbors_importance.data_ptr<TFeat>()
                     : nullptr,
             neighbors_row_splits.data_ptr<int64_t>(),
-            out_features_gradient.data_ptr<TFeat>(), normalize);
+            out_features_gradient.data_ptr<TFeat>(), normalize, precision);
 }
 #define INSTANTIATE(TFeat, TOut, TIndex, TKernelIndex)                         \
     template void                                                              \
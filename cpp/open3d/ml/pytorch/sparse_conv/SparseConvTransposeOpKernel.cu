@@ -87,6 +87,10 @@ void SparseConvTransposeCUDA(const torch::Tensor& filters,
 
     auto temp_tensor = CreateTempTensor(temp_size, device, &temp_ptr);
 
+    const GemmPrecision precision =
+            at::globalContext().allowTF32CuBLAS() ? GemmPrecision::TF32
+                                                  : GemmPrecision::FP32;
+
     // actually run the operation
     SparseConvTransposeComputeFeaturesCUDA<TFeat, TOut, TIndex, TKernelIndex>(
             stream, temp_ptr, temp_size, max_temp_size, texture_alignment,
@@ -103,7 +107,7 @@ void SparseConvTransposeCUDA(const torch::Tensor& filters,
             neighbors_importance.size(0)
                     ? neighbors_importance.data_ptr<TFeat>()
                     : nullptr,
-            neighbors_row_splits.data_ptr<int64_t>(), normalize);
+            neighbors_row_splits.data_ptr<int64_t>(), normalize, precision);
 }
 #define INSTANTIATE(TFeat, TOut, TIndex, TKernelIndex)                         \
     template void SparseConvTransposeCUDA<TFeat, TOut, TIndex, TKernelIndex>(  \
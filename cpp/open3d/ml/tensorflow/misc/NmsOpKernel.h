@@ -46,6 +46,16 @@ public:
         *ptr = (int64_t*)flat_tensor.data();
     }
 
+    void AllocKeepRowSplits(int64_t** ptr, int64_t num) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({num});
+        OP_REQUIRES_OK(context, context->allocate_output(1, shape, &tensor));
+        auto flat_tensor = tensor->flat<int64>();
+        *ptr = (int64_t*)flat_tensor.data();
+    }
+
 private:
     tensorflow::OpKernelContext* context;
 };
@@ -85,5 +95,55 @@ protected:
     float nms_overlap_thresh;
 };
 
+// Base class with common code for the batched OpKernel implementations
+class BatchedNmsOpKernel : public tensorflow::OpKernel {
+public:
+    explicit BatchedNmsOpKernel(tensorflow::OpKernelConstruction* construction)
+        : OpKernel(construction) {
+        OP_REQUIRES_OK(construction,
+                       construction->GetAttr("nms_overlap_thresh",
+                                             &nms_overlap_thresh));
+    }
+
+    void Compute(tensorflow::OpKernelContext* context) override {
+        using namespace tensorflow;
+        const Tensor& boxes = context->input(0);
+        const Tensor& scores = context->input(1);
+        const Tensor& row_splits = context->input(2);
+
+        {
+            using namespace open3d::ml::op_util;
+            Dim num_points("num_points");
+            Dim five(5, "five");
+            Dim batch_size("batch_size");
+            CHECK_SHAPE(context, boxes, num_points, five);
+            CHECK_SHAPE(context, scores, num_points);
+            CHECK_SHAPE(context, row_splits, batch_size + 1);
+        }
+        // The row splits are in host memory for all devices.
+        const int64_t* row_splits_ptr =
+                (const int64_t*)row_splits.flat<int64>().data();
+        const int num_batches = row_splits.dim_size(0) - 1;
+        OP_REQUIRES(context,
+                    row_splits_ptr[0] == 0 &&
+                            row_splits_ptr[num_batches] == boxes.dim_size(0),
+                    errors::InvalidArgument(
+                            "row_splits must start with 0 and end with the "
+                            "number of boxes"));
+
+        Kernel(context, boxes, scores, row_splits_ptr, num_batches);
+    }
+
+    // Function with the device specific code
+    virtual void Kernel(tensorflow::OpKernelContext* context,
+                        const tensorflow::Tensor& boxes,
+                        const tensorflow::Tensor& scores,
+                        const int64_t* row_splits,
+                        int num_batches) = 0;
+
+protected:
+    float nms_overlap_thresh;
+};
+
 }  // namespace nms_opkernel
 /// @endcond
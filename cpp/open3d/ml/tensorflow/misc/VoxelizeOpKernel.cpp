@@ -79,3 +79,68 @@ public:
 REG_KB(float)
 REG_KB(double)
 #undef REG_KB
+
+template <class T>
+class VoxelizeReduceOpKernelCPU : public VoxelizeReduceOpKernel {
+public:
+    explicit VoxelizeReduceOpKernelCPU(OpKernelConstruction* construction)
+        : VoxelizeReduceOpKernel(construction) {}
+
+    void Kernel(tensorflow::OpKernelContext* context,
+                const tensorflow::Tensor& points,
+                const tensorflow::Tensor& features,
+                const tensorflow::Tensor& voxel_size,
+                const tensorflow::Tensor& points_range_min,
+                const tensorflow::Tensor& points_range_max) {
+        ReduceAllocator allocator(context);
+        const int64_t num_channels = features.dim_size(1);
+        T* voxel_positions = nullptr;
+        T* voxel_features = nullptr;
+        int64_t* voxel_point_counts = nullptr;
+
+        switch (points.dim_size(1)) {
+#define CASE(NDIM)                                                            \
+    case NDIM: {                                                              \
+        VoxelizeCPU<T, NDIM>(points.dim_size(0), points.flat<T>().data(),     \
+                             voxel_size.flat<T>().data(),                     \
+                             points_range_min.flat<T>().data(),               \
+                             points_range_max.flat<T>().data(),               \
+                             max_points_per_voxel, max_voxels, allocator);    \
+        if (!context->status().ok()) return;                                  \
+        AllocReduceOutputs(context, allocator.NumVoxels(), NDIM,              \
+                           num_channels, &voxel_positions, &voxel_features,   \
+                           &voxel_point_counts);                              \
+        if (!context->status().ok()) return;                                  \
+        VoxelReduceCPU<T, NDIM>(                                              \
+                allocator.NumVoxels(), points.flat<T>().data(), num_channels, \
+                features.flat<T>().data(),                                    \
+                context->mutable_output(0)->flat<int32_t>().data(),           \
+                allocator.VoxelPointIndices(),                                \
+                allocator.VoxelPointRowSplits(), voxel_size.flat<T>().data(), \
+                points_range_min.flat<T>().data(), position_fn, feature_fn,   \
+                voxel_positions, voxel_features, voxel_point_counts);         \
+    } break;
+            CASE(1)
+            CASE(2)
+            CASE(3)
+            CASE(4)
+            CASE(5)
+            CASE(6)
+            CASE(7)
+            CASE(8)
+            default:
+                break;  // will be handled by the base class
+
+#undef CASE
+        }
+    }
+};
+
+#define REG_KB(type)                                            \
+    REGISTER_KERNEL_BUILDER(Name("Open3DVoxelizeReduce")        \
+                                    .Device(DEVICE_CPU)         \
+                                    .TypeConstraint<type>("T"), \
+                            VoxelizeReduceOpKernelCPU<type>);
+REG_KB(float)
+REG_KB(double)
+#undef REG_KB
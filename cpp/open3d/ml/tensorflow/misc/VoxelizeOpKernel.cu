@@ -109,3 +109,121 @@ private:
 REG_KB(float)
 REG_KB(double)
 #undef REG_KB
+
+template <class T>
+class VoxelizeReduceOpKernelCUDA : public VoxelizeReduceOpKernel {
+public:
+    explicit VoxelizeReduceOpKernelCUDA(OpKernelConstruction* construction)
+        : VoxelizeReduceOpKernel(construction) {
+        texture_alignment = GetCUDACurrentDeviceTextureAlignment();
+    }
+
+    void Kernel(tensorflow::OpKernelContext* context,
+                const tensorflow::Tensor& points,
+                const tensorflow::Tensor& features,
+                const tensorflow::Tensor& voxel_size,
+                const tensorflow::Tensor& points_range_min,
+                const tensorflow::Tensor& points_range_max) {
+        auto device = context->eigen_gpu_device();
+
+        ReduceAllocator allocator(context);
+        const int64_t num_channels = features.dim_size(1);
+        T* voxel_positions = nullptr;
+        T* voxel_features = nullptr;
+        int64_t* voxel_point_counts = nullptr;
+
+        switch (points.dim_size(1)) {
+#define CASE(NDIM)                                                            \
+    case NDIM: {                                                              \
+        void* temp_ptr = nullptr;                                             \
+        size_t temp_size = 0;                                                 \
+        VoxelizeCUDA<T, NDIM>(                                                \
+                device.stream(), temp_ptr, temp_size, texture_alignment,      \
+                points.dim_size(0), points.flat<T>().data(),                  \
+                voxel_size.flat<T>().data(),                                  \
+                points_range_min.flat<T>().data(),                            \
+                points_range_max.flat<T>().data(), max_points_per_voxel,      \
+                max_voxels, allocator);                                       \
+                                                                              \
+        Tensor temp_tensor;                                                   \
+        TensorShape temp_shape({ssize_t(temp_size)});                         \
+        OP_REQUIRES_OK(context,                                               \
+                       context->allocate_temp(DataTypeToEnum<uint8_t>::v(),   \
+                                              temp_shape, &temp_tensor));     \
+        temp_ptr = temp_tensor.flat<uint8_t>().data();                        \
+                                                                              \
+        VoxelizeCUDA<T, NDIM>(                                                \
+                device.stream(), temp_ptr, temp_size, texture_alignment,      \
+                points.dim_size(0), points.flat<T>().data(),                  \
+                voxel_size.flat<T>().data(),                                  \
+                points_range_min.flat<T>().data(),                            \
+                points_range_max.flat<T>().data(), max_points_per_voxel,      \
+                max_voxels, allocator);                                       \
+        if (!context->status().ok()) return;                                  \
+        AllocReduceOutputs(context, allocator.NumVoxels(), NDIM,              \
+                           num_channels, &voxel_positions, &voxel_features,   \
+                           &voxel_point_counts);                              \
+        if (!context->status().ok()) return;                                  \
+                                                                              \
+        void* reduce_temp_ptr = nullptr;                                      \
+        size_t reduce_temp_size = 0;                                          \
+        VoxelReduceCUDA<T, NDIM>(                                             \
+                device.stream(), reduce_temp_ptr, reduce_temp_size,           \
+                texture_alignment, allocator.NumVoxels(),                     \
+                points.flat<T>().data(), num_channels,                        \
+                features.flat<T>().data(),                                    \
+                context->mutable_output(0)->flat<int32_t>().data(),           \
+                allocator.VoxelPointIndices(),                                \
+                allocator.VoxelPointRowSplits(), voxel_size.flat<T>().data(), \
+                points_range_min.flat<T>().data(), position_fn, feature_fn,   \
+                voxel_positions, voxel_features, voxel_point_counts);         \
+                                                                              \
+        Tensor reduce_temp_tensor;                                            \
+        TensorShape reduce_temp_shape({ssize_t(reduce_temp_size)});           \
+        OP_REQUIRES_OK(context, context->allocate_temp(                       \
+                                        DataTypeToEnum<uint8_t>::v(),         \
+                                        reduce_temp_shape,                    \
+                                        &reduce_temp_tensor));                \
+        reduce_temp_ptr = reduce_temp_tensor.flat<uint8_t>().data();          \
+                                                                              \
+        VoxelReduceCUDA<T, NDIM>(                                             \
+                device.stream(), reduce_temp_ptr, reduce_temp_size,           \
+                texture_alignment, allocator.NumVoxels(),                     \
+                points.flat<T>().data(), num_channels,                        \
+                features.flat<T>().data(),                                    \
+                context->mutable_output(0)->flat<int32_t>().data(),           \
+                allocator.VoxelPointIndices(),                                \
+                allocator.VoxelPointRowSplits(), voxel_size.flat<T>().data(), \
+                points_range_min.flat<T>().data(), position_fn, feature_fn,   \
+                voxel_positions, voxel_features, voxel_point_counts);         \
+    } break;
+            CASE(1)
+            CASE(2)
+            CASE(3)
+            CASE(4)
+            CASE(5)
+            CASE(6)
+            CASE(7)
+            CASE(8)
+            default:
+                break;  // will be handled by the base class
+
+#undef CASE
+        }
+    }
+
+private:
+    int texture_alignment;
+};
+
+#define REG_KB(type)                                                 \
+    REGISTER_KERNEL_BUILDER(Name("Open3DVoxelizeReduce")             \
+                                    .Device(DEVICE_GPU)              \
+                                    .TypeConstraint<type>("T")       \
+                                    .HostMemory("voxel_size")        \
+                                    .HostMemory("points_range_min")  \
+                                    .HostMemory("points_range_max"), \
+                            VoxelizeReduceOpKernelCUDA<type>);
+REG_KB(float)
+REG_KB(double)
+#undef REG_KB
@@ -24,6 +24,7 @@
 
 //#include "open3d/ml/impl/misc/VoxelPooling.h"
 #include "open3d/ml/tensorflow/TensorFlowHelper.h"
+#include "open3d/ml/impl/misc/VoxelReduce.h"
 #include "tensorflow/core/framework/op.h"
 #include "tensorflow/core/framework/op_kernel.h"
 #include "tensorflow/core/lib/core/errors.h"
@@ -118,5 +119,165 @@ protected:
     tensorflow::int64 max_voxels;
 };
 
+// Allocator for the fused voxelize and reduce op. Only the voxel coordinates
+// are an output, the point indices and row splits are temporaries.
+class ReduceAllocator {
+public:
+    ReduceAllocator(tensorflow::OpKernelContext* context) : context(context) {}
+
+    void AllocVoxelCoords(int32_t** ptr, int64_t rows, int64_t cols) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        Tensor* tensor = 0;
+        TensorShape shape({rows, cols});
+        OP_REQUIRES_OK(context, context->allocate_output(0, shape, &tensor));
+        auto flat_tensor = tensor->flat<int32_t>();
+        *ptr = flat_tensor.data();
+        num_voxels = rows;
+    }
+
+    void AllocVoxelPointIndices(int64_t** ptr, int64_t num) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        TensorShape shape({num});
+        OP_REQUIRES_OK(context, context->allocate_temp(DT_INT64, shape,
+                                                       &voxel_point_indices));
+        *ptr = (int64_t*)voxel_point_indices.flat<int64>().data();
+    }
+
+    void AllocVoxelPointRowSplits(int64_t** ptr, int64_t num) {
+        using namespace tensorflow;
+        *ptr = nullptr;
+        TensorShape shape({num});
+        OP_REQUIRES_OK(context,
+                       context->allocate_temp(DT_INT64, shape,
+                                              &voxel_point_row_splits));
+        *ptr = (int64_t*)voxel_point_row_splits.flat<int64>().data();
+    }
+
+    int64_t NumVoxels() const { return num_voxels; }
+    const int64_t* VoxelPointIndices() const {
+        return (const int64_t*)voxel_point_indices.flat<tensorflow::int64>()
+                .data();
+    }
+    const int64_t* VoxelPointRowSplits() const {
+        return (const int64_t*)voxel_point_row_splits
+                .flat<tensorflow::int64>()
+                .data();
+    }
+
+private:
+    tensorflow::OpKernelContext* context;
+    tensorflow::Tensor voxel_point_indices;
+    tensorflow::Tensor voxel_point_row_splits;
+    int64_t num_voxels = 0;
+};
+
+// Base class with common code for the fused voxelize and reduce OpKernel
+// implementations
+class VoxelizeReduceOpKernel : public tensorflow::OpKernel {
+public:
+    explicit VoxelizeReduceOpKernel(
+            tensorflow::OpKernelConstruction* construction)
+        : OpKernel(construction) {
+        using namespace open3d::ml::impl;
+        OP_REQUIRES_OK(construction,
+                       construction->GetAttr("max_points_per_voxel",
+                                             &max_points_per_voxel));
+        OP_REQUIRES_OK(construction,
+                       construction->GetAttr("max_voxels", &max_voxels));
+
+        std::string pos_fn_str;
+        OP_REQUIRES_OK(construction,
+                       construction->GetAttr("position_fn", &pos_fn_str));
+
+        if (pos_fn_str == "average")
+            position_fn = AVERAGE;
+        else if (pos_fn_str == "nearest_neighbor")
+            position_fn = NEAREST_NEIGHBOR;
+        else
+            position_fn = CENTER;
+
+        std::string feat_fn_str;
+        OP_REQUIRES_OK(construction,
+                       construction->GetAttr("feature_fn", &feat_fn_str));
+
+        if (feat_fn_str == "average")
+            feature_fn = AVERAGE;
+        else if (feat_fn_str == "nearest_neighbor")
+            feature_fn = NEAREST_NEIGHBOR;
+        else
+            feature_fn = MAX;
+    }
+
+    void Compute(tensorflow::OpKernelContext* context) override {
+        using namespace tensorflow;
+        const Tensor& points = context->input(0);
+        const Tensor& features = context->input(1);
+        const Tensor& voxel_size = context->input(2);
+        const Tensor& points_range_min = context->input(3);
+        const Tensor& points_range_max = context->input(4);
+
+        {
+            using namespace open3d::ml::op_util;
+            Dim num_points("num_points");
+            Dim ndim("ndim");
+            Dim num_channels("num_channels");
+            CHECK_SHAPE(context, points, num_points, ndim);
+            CHECK_SHAPE(context, features, num_points, num_channels);
+            CHECK_SHAPE(context, voxel_size, ndim);
+            CHECK_SHAPE(context, points_range_min, ndim);
+            CHECK_SHAPE(context, points_range_max, ndim);
+            OP_REQUIRES(
+                    context, ndim.value() > 0 && ndim.value() < 9,
+                    errors::InvalidArgument(
+                            "the number of dimensions must be in [1,..,8]"));
+        }
+
+        Kernel(context, points, features, voxel_size, points_range_min,
+               points_range_max);
+    }
+
+    // Allocates the outputs that follow the voxel coordinates.
+    template <class T>
+    void AllocReduceOutputs(tensorflow::OpKernelContext* context,
+                            int64_t num_voxels,
+                            int64_t ndim,
+                            int64_t num_channels,
+                            T** voxel_positions,
+                            T** voxel_features,
+                            int64_t** voxel_point_counts) {
+        using namespace tensorflow;
+        Tensor* tensor = 0;
+        OP_REQUIRES_OK(context,
+                       context->allocate_output(
+                               1, TensorShape({num_voxels, ndim}), &tensor));
+        *voxel_positions = tensor->flat<T>().data();
+        OP_REQUIRES_OK(context,
+                       context->allocate_output(
+                               2, TensorShape({num_voxels, num_channels}),
+                               &tensor));
+        *voxel_features = tensor->flat<T>().data();
+        OP_REQUIRES_OK(context,
+                       context->allocate_output(3, TensorShape({num_voxels}),
+                                                &tensor));
+        *voxel_point_counts = (int64_t*)tensor->flat<int64>().data();
+    }
+
+    // Function with the device specific code
+    virtual void Kernel(tensorflow::OpKernelContext* context,
+                        const tensorflow::Tensor& points,
+                        const tensorflow::Tensor& features,
+                        const tensorflow::Tensor& voxel_size,
+                        const tensorflow::Tensor& points_range_min,
+                        const tensorflow::Tensor& points_range_max) = 0;
+
+protected:
+    tensorflow::int64 max_points_per_voxel;
+    tensorflow::int64 max_voxels;
+    open3d::ml::impl::AccumulationFn position_fn;
+    open3d::ml::impl::AccumulationFn feature_fn;
+};
+
 }  // namespace voxelize_opkernel
 /// @endcond
@@ -0,0 +1,168 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/ml/tensorflow/TensorFlowHelper.h"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+#include "tensorflow/core/framework/shape_inference.h"
+#include "tensorflow/core/lib/core/errors.h"
+
+using namespace tensorflow;
+
+REGISTER_OP("Open3DVoxelizeReduce")
+        .Attr("T: {float, double}")  // type for the point positions
+        .Attr("max_points_per_voxel: int = 9223372036854775807")
+        .Attr("max_voxels: int = 9223372036854775807")
+        .Attr("position_fn: {'average', 'nearest_neighbor', 'center'} = "
+              "'average'")
+        .Attr("feature_fn: {'average', 'nearest_neighbor', 'max'} = "
+              "'average'")
+        .Input("points: T")
+        .Input("features: T")
+        .Input("voxel_size: T")
+        .Input("points_range_min: T")
+        .Input("points_range_max: T")
+        .Output("voxel_coords: int32")
+        .Output("voxel_positions: T")
+        .Output("voxel_features: T")
+        .Output("voxel_point_counts: int64")
+        .SetShapeFn([](::tensorflow::shape_inference::InferenceContext* c) {
+            using namespace ::tensorflow::shape_inference;
+            using namespace open3d::ml::op_util;
+            ShapeHandle points, features, voxel_size, points_range_min,
+                    points_range_max;
+
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(0), 2, &points));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(1), 2, &features));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(2), 1, &voxel_size));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(3), 1, &points_range_min));
+            TF_RETURN_IF_ERROR(c->WithRank(c->input(4), 1, &points_range_max));
+
+            Dim num_points("num_points");
+            Dim ndim("ndim");
+            Dim num_channels("num_channels");
+            CHECK_SHAPE_HANDLE(c, points, num_points, ndim);
+            CHECK_SHAPE_HANDLE(c, features, num_points, num_channels);
+            CHECK_SHAPE_HANDLE(c, voxel_size, ndim);
+            CHECK_SHAPE_HANDLE(c, points_range_min, ndim);
+            CHECK_SHAPE_HANDLE(c, points_range_max, ndim);
+
+            DimensionHandle num_voxels = c->UnknownDim();
+            c->set_output(0, c->MakeShape({num_voxels,
+                                           c->MakeDim(ndim.value())}));
+            c->set_output(1, c->MakeShape({num_voxels,
+                                           c->MakeDim(ndim.value())}));
+            c->set_output(2, c->MakeShape({num_voxels,
+                                           c->MakeDim(num_channels.value())}));
+            c->set_output(3, c->MakeShape({num_voxels}));
+
+            return Status::OK();
+        })
+        .Doc(R"doc(
+Voxelization with per-voxel reduction of positions and features.
+
+This op combines voxelize with the reduction of the points inside each voxel.
+The voxels are returned in a deterministic order, which is the order of their
+linear index in the grid defined by points_range_min, points_range_max and
+voxel_size. The points inside a voxel are reduced in the order of their
+indices. The results are therefore the same for repeated runs and for the CPU
+and GPU implementations. This op is not differentiable.
+
+Minimal example::
+
+  import open3d.ml.tf as ml3d
+
+  points = [
+      [0.1,0.1,0.1],
+      [0.5,0.5,0.5],
+      [1.7,1.7,1.7],
+      [1.8,1.8,1.8],
+      [9.3,9.4,9.4]]
+
+  features = [[1.0], [2.0], [3.0], [5.0], [7.0]]
+
+  ml3d.ops.voxelize_reduce(points,
+                           features,
+                           voxel_size=[1.0,1.0,1.0],
+                           points_range_min=[0,0,0],
+                           points_range_max=[2,2,2],
+                           position_fn='center',
+                           feature_fn='max')
+
+  # returns the voxel coordinates  [[0, 0, 0],
+  #                                 [1, 1, 1]]
+  #
+  #         the voxel positions    [[0.5, 0.5, 0.5],
+  #                                 [1.5, 1.5, 1.5]]
+  #
+  #         the voxel features     [[2.0],
+  #                                 [5.0]]
+  #
+  #         and the point counts   [2, 2]
+
+points: The point positions with shape [N,D] with N as the number of points and
+  D as the number of dimensions, which must be 0 < D < 9.
+
+features: The point features with shape [N,C] with C as the number of
+  channels.
+
+voxel_size: The voxel size with shape [D].
+
+points_range_min: The minimum range for valid points to be voxelized. This
+  vector has shape [D] and is used as the origin for computing the
+  voxel_indices.
+
+points_range_max: The maximum range for valid points to be voxelized. This
+  vector has shape [D].
+
+max_points_per_voxel: The maximum number of points to consider for a voxel.
+
+max_voxels: The maximum number of voxels to generate.
+
+position_fn: Defines how the voxel positions will be computed.
+  The options are
+    * "average" computes the center of gravity of the points in the voxel.
+    * "nearest_neighbor" selects the point closest to the voxel center.
+    * "center" uses the voxel center for the position.
+
+feature_fn: Defines how the voxel features will be computed.
+  The options are
+    * "average" computes the average feature of the points in the voxel.
+    * "nearest_neighbor" selects the feature of the point closest to the
+      voxel center.
+    * "max" uses the channel-wise maximum of the point features.
+
+voxel_coords: The integer voxel coordinates. The shape of this tensor is [M, D]
+  with M as the number of voxels and D as the number of dimensions.
+
+voxel_positions: The reduced voxel positions with shape [M, D].
+
+voxel_features: The reduced voxel features with shape [M, C].
+
+voxel_point_counts: The number of points that have been reduced for each
+  voxel. The shape of this tensor is [M].
+
+)doc");
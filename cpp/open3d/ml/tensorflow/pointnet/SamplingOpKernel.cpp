@@ -0,0 +1,50 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "SamplingOpKernel.h"
+#include "open3d/ml/contrib/PointSampling.h"
+
+using namespace tensorflow;
+
+class FurthestPointSamplingOpKernelCPU : public FurthestPointSamplingOpKernel {
+public:
+    explicit FurthestPointSamplingOpKernelCPU(
+            OpKernelConstruction *construction)
+        : FurthestPointSamplingOpKernel(construction) {}
+
+    void Kernel(tensorflow::OpKernelContext *context,
+                int b,
+                int n,
+                int m,
+                const float *dataset,
+                float *temp,
+                int *idxs) {
+        open3d::ml::contrib::FurthestPointSamplingCPU(b, n, m, dataset, idxs);
+    }
+};
+
+REGISTER_KERNEL_BUILDER(Name("Open3DFurthestPointSampling").Device(DEVICE_CPU),
+                        FurthestPointSamplingOpKernelCPU);
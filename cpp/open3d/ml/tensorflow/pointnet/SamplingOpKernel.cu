@@ -54,13 +54,35 @@ public:
         // output:
         //      idx: (B, M)
 
-        // fill with big value
-        cudaMemset(temp, 80, b * n * sizeof(float));
-
         auto stream = context->eigen_gpu_device().stream();
 
         cudaError_t err;
 
+        if (n >= FPS_BUCKETED_MIN_POINTS) {
+            size_t temp_size = 0;
+            FurthestPointSamplingBucketed(stream, nullptr, temp_size, b, n, m,
+                                          dataset, idxs);
+            Tensor temp_tensor;
+            OP_REQUIRES_OK(context,
+                           context->allocate_temp(
+                                   DT_UINT8, TensorShape{int64_t(temp_size)},
+                                   &temp_tensor));
+            FurthestPointSamplingBucketed(
+                    stream, temp_tensor.flat<uint8_t>().data(), temp_size, b,
+                    n, m, dataset, idxs);
+
+            err = cudaGetLastError();
+            if (cudaSuccess != err) {
+                fprintf(stderr, "CUDA kernel failed : %s\n",
+                        cudaGetErrorString(err));
+                exit(-1);
+            }
+            return;
+        }
+
+        // fill with big value
+        cudaMemset(temp, 80, b * n * sizeof(float));
+
         unsigned int n_threads = opt_n_threads(n);
 
         switch (n_threads) {
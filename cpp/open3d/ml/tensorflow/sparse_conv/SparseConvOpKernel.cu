@@ -28,6 +28,7 @@
 #include "SparseConvOpKernel.h"
 #include "open3d/ml/Helper.h"
 #include "open3d/ml/impl/sparse_conv/SparseConv.cuh"
+#include "tensorflow/core/platform/tensor_float_32_utils.h"
 
 using namespace open3d::ml;
 using namespace open3d::ml::impl;
@@ -90,6 +91,10 @@ public:
                                               temp_shape, &temp_tensor));
         temp_ptr = temp_tensor.flat<uint8_t>().data();
 
+        const GemmPrecision precision =
+                tensor_float_32_execution_enabled() ? GemmPrecision::TF32
+                                                    : GemmPrecision::FP32;
+
         // actually run the operation
         SparseConvComputeFeaturesCUDA<TFeat, TOut, TIndex, TKernelIndex>(
                 device.stream(), temp_ptr, temp_size, max_temp_size,
@@ -107,7 +112,7 @@ public:
                         ? neighbors_importance.flat<TFeat>().data()
                         : nullptr,
                 (int64_t*)neighbors_row_splits.flat<int64>().data(),
-                this->normalize);
+                this->normalize, precision);
     }
 
 private:
@@ -28,6 +28,7 @@
 #include "SparseConvTransposeOpKernel.h"
 #include "open3d/ml/Helper.h"
 #include "open3d/ml/impl/sparse_conv/SparseConvTranspose.cuh"
+#include "tensorflow/core/platform/tensor_float_32_utils.h"
 
 using namespace open3d;
 using namespace open3d::ml;
@@ -100,6 +101,10 @@ public:
                                               temp_shape, &temp_tensor));
         temp_ptr = temp_tensor.flat<uint8_t>().data();
 
+        const GemmPrecision precision =
+                tensor_float_32_execution_enabled() ? GemmPrecision::TF32
+                                                    : GemmPrecision::FP32;
+
         // actually run the operation
         SparseConvTransposeComputeFeaturesCUDA<TFeat, TOut, TIndex,
                                                TKernelIndex>(
@@ -123,7 +128,7 @@ public:
                         ? neighbors_importance.flat<TFeat>().data()
                         : nullptr,
                 (int64_t*)neighbors_row_splits.flat<int64>().data(),
-                this->normalize);
+                this->normalize, precision);
     }
 
 private:
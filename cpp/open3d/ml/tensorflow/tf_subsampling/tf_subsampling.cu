@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/ml/Helper.h"
+#include "open3d/ml/contrib/GridSubsampling.h"
+#include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/op_kernel.h"
+
+using namespace tensorflow;
+using namespace open3d::ml::contrib;
+
+namespace {
+
+/// Copies the subsampled points to a new device output tensor.
+void AllocateSubsampledPoints(OpKernelContext* context,
+                              const std::vector<PointXYZ>& subsampled_points) {
+    TensorShape sub_points_shape;
+    sub_points_shape.AddDim(subsampled_points.size());
+    sub_points_shape.AddDim(3);
+
+    Tensor* sub_points_output = nullptr;
+    OP_REQUIRES_OK(context, context->allocate_output(0, sub_points_shape,
+                                                     &sub_points_output));
+    OPEN3D_ML_CUDA_CHECK(cudaMemcpy(sub_points_output->flat<float>().data(),
+                                    subsampled_points.data(),
+                                    subsampled_points.size() * sizeof(PointXYZ),
+                                    cudaMemcpyHostToDevice));
+}
+
+}  // namespace
+
+class GridSubsamplingOpCUDA : public OpKernel {
+public:
+    explicit GridSubsamplingOpCUDA(OpKernelConstruction* context)
+        : OpKernel(context) {}
+
+    void Compute(OpKernelContext* context) override {
+        const Tensor& points_tensor = context->input(0);
+        const Tensor& dl_tensor = context->input(1);
+
+        OP_REQUIRES(context,
+                    points_tensor.dims() == 2 &&
+                            points_tensor.dim_size(1) == 3,
+                    errors::InvalidArgument("points must have shape [N,3]"));
+
+        const int64_t N = points_tensor.dim_size(0);
+        const float sampleDl = dl_tensor.flat<float>().data()[0];
+
+        std::vector<PointXYZ> subsampled_points;
+        std::vector<int> subsampled_batches;
+        BatchGridSubsamplingCUDA(points_tensor.flat<float>().data(), N,
+                                 {static_cast<int>(N)}, sampleDl, 0,
+                                 subsampled_points, subsampled_batches);
+
+        AllocateSubsampledPoints(context, subsampled_points);
+    }
+};
+
+REGISTER_KERNEL_BUILDER(Name("Open3DGridSubsampling")
+                                .Device(DEVICE_GPU)
+                                .HostMemory("dl"),
+                        GridSubsamplingOpCUDA);
+
+class BatchGridSubsamplingOpCUDA : public OpKernel {
+public:
+    explicit BatchGridSubsamplingOpCUDA(OpKernelConstruction* context)
+        : OpKernel(context) {}
+
+    void Compute(OpKernelContext* context) override {
+        const Tensor& points_tensor = context->input(0);
+        const Tensor& batches_tensor = context->input(1);
+        const Tensor& dl_tensor = context->input(2);
+
+        OP_REQUIRES(context,
+                    points_tensor.dims() == 2 &&
+                            points_tensor.dim_size(1) == 3,
+                    errors::InvalidArgument("points must have shape [N,3]"));
+        OP_REQUIRES(context, batches_tensor.dims() == 1,
+                    errors::InvalidArgument("batches must be a vector"));
+
+        const int64_t N = points_tensor.dim_size(0);
+        const float sampleDl = dl_tensor.flat<float>().data()[0];
+        const int* batches_ptr = batches_tensor.flat<int>().data();
+        const std::vector<int> batches(
+                batches_ptr, batches_ptr + batches_tensor.dim_size(0));
+
+        std::vector<PointXYZ> subsampled_points;
+        std::vector<int> subsampled_batches;
+        BatchGridSubsamplingCUDA(points_tensor.flat<float>().data(), N,
+                                 batches, sampleDl, 0, subsampled_points,
+                                 subsampled_batches);
+
+        AllocateSubsampledPoints(context, subsampled_points);
+        if (!context->status().ok()) return;
+
+        TensorShape sub_batches_shape;
+        sub_batches_shape.AddDim(subsampled_batches.size());
+        Tensor* sub_batches_output = nullptr;
+        OP_REQUIRES_OK(context, context->allocate_output(1, sub_batches_shape,
+                                                         &sub_batches_output));
+        OPEN3D_ML_CUDA_CHECK(cudaMemcpy(
+                sub_batches_output->flat<int>().data(),
+                subsampled_batches.data(),
+                subsampled_batches.size() * sizeof(int),
+                cudaMemcpyHostToDevice));
+    }
+};
+
+REGISTER_KERNEL_BUILDER(Name("Open3DBatchGridSubsampling")
+                                .Device(DEVICE_GPU)
+                                .HostMemory("batches")
+                                .HostMemory("dl"),
+                        BatchGridSubsamplingOpCUDA);
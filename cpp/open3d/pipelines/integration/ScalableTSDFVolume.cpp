@@ -26,9 +26,11 @@
 
 #include "open3d/pipelines/integration/ScalableTSDFVolume.h"
 
+#include <algorithm>
 #include <unordered_set>
 
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/io/TriangleMeshIO.h"
 #include "open3d/pipelines/integration/MarchingCubesConst.h"
 #include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "open3d/utility/Logging.h"
@@ -94,28 +96,43 @@ void ScalableTSDFVolume::Integrate(
     auto pointcloud = geometry::PointCloud::CreateFromDepthImage(
             image.depth_, intrinsic, extrinsic, 1000.0, 1000.0,
             depth_sampling_stride_);
-    std::unordered_set<Eigen::Vector3i, utility::hash_eigen<Eigen::Vector3i>>
-            touched_volume_units_;
-    for (const auto &point : pointcloud->points_) {
-        auto min_bound = LocateVolumeUnit(
-                point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        auto max_bound = LocateVolumeUnit(
-                point + Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        for (auto x = min_bound(0); x <= max_bound(0); x++) {
-            for (auto y = min_bound(1); y <= max_bound(1); y++) {
-                for (auto z = min_bound(2); z <= max_bound(2); z++) {
-                    auto loc = Eigen::Vector3i(x, y, z);
-                    if (touched_volume_units_.find(loc) ==
-                        touched_volume_units_.end()) {
-                        touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
+    // The volume units touched by the points are collected per thread, and
+    // only the distinct ones are merged and opened sequentially.
+    typedef std::unordered_set<Eigen::Vector3i,
+                               utility::hash_eigen<Eigen::Vector3i>>
+            VolumeUnitSet;
+    VolumeUnitSet touched_volume_units_;
+    const Eigen::Vector3d trunc(sdf_trunc_, sdf_trunc_, sdf_trunc_);
+#pragma omp parallel
+    {
+        VolumeUnitSet touched_volume_units_private;
+#pragma omp for nowait schedule(static)
+        for (int i = 0; i < (int)pointcloud->points_.size(); i++) {
+            const Eigen::Vector3d &point = pointcloud->points_[i];
+            auto min_bound = LocateVolumeUnit(point - trunc);
+            auto max_bound = LocateVolumeUnit(point + trunc);
+            for (auto x = min_bound(0); x <= max_bound(0); x++) {
+                for (auto y = min_bound(1); y <= max_bound(1); y++) {
+                    for (auto z = min_bound(2); z <= max_bound(2); z++) {
+                        touched_volume_units_private.emplace(x, y, z);
                     }
                 }
             }
         }
+#pragma omp critical(ScalableTSDFVolumeIntegrate)
+        touched_volume_units_.insert(touched_volume_units_private.begin(),
+                                     touched_volume_units_private.end());
+    }
+    std::vector<std::shared_ptr<UniformTSDFVolume>> touched_volumes;
+    touched_volumes.reserve(touched_volume_units_.size());
+    for (const auto &loc : touched_volume_units_) {
+        touched_volumes.push_back(OpenVolumeUnit(loc));
+    }
+    // The volume units are disjoint, so they are integrated concurrently.
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < (int)touched_volumes.size(); i++) {
+        touched_volumes[i]->IntegrateWithDepthToCameraDistanceMultiplier(
+                image, intrinsic, extrinsic, *depth2cameradistance);
     }
 }
 
@@ -221,156 +238,309 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
     return pointcloud;
 }
 
-std::shared_ptr<geometry::TriangleMesh>
-ScalableTSDFVolume::ExtractTriangleMesh() {
+namespace {
+
+/// Marching cubes output of a single volume unit. The vertices are indexed
+/// within the unit and keyed by the global index of the voxel edge they lie
+/// on.
+struct VolumeUnitMesh {
+    std::vector<Eigen::Vector4i, utility::Vector4i_allocator> edge_indices_;
+    /// Whether the edge of a vertex is shared with cubes of another unit.
+    std::vector<bool> is_shared_;
+    std::vector<Eigen::Vector3d> vertices_;
+    std::vector<Eigen::Vector3d> vertex_colors_;
+    std::vector<Eigen::Vector3i> triangles_;
+    /// Index of every vertex in the merged mesh, and whether the merged
+    /// vertex is taken from this unit.
+    std::vector<int> merged_indices_;
+    std::vector<bool> is_merged_source_;
+};
+
+/// Runs marching cubes over the cubes whose first corner lies in unit. Cubes
+/// on the positive faces of the unit read the corners of the neighboring
+/// units.
+void ExtractVolumeUnitMesh(const ScalableTSDFVolume &volume,
+                           const ScalableTSDFVolume::VolumeUnit &unit,
+                           VolumeUnitMesh &unit_mesh) {
     // implementation of marching cubes, based on
     // http://paulbourke.net/geometry/polygonise/
-    auto mesh = std::make_shared<geometry::TriangleMesh>();
-    double half_voxel_length = voxel_length_ * 0.5;
-    std::unordered_map<
-            Eigen::Vector4i, int, utility::hash_eigen<Eigen::Vector4i>,
-            std::equal_to<Eigen::Vector4i>,
-            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
+    const int resolution = volume.volume_unit_resolution_;
+    const double voxel_length = volume.voxel_length_;
+    const double half_voxel_length = voxel_length * 0.5;
+    const TSDFVolumeColorType color_type = volume.color_type_;
+    const auto &volume0 = *unit.volume_;
+    const auto &index0 = unit.index_;
+    const Eigen::Vector4i unit_offset =
+            Eigen::Vector4i(index0(0), index0(1), index0(2), 0) * resolution;
+
+    // Local vertex index of every edge (x, y, z, axis) with x, y and z in
+    // [0, resolution].
+    const int edge_grid_size = resolution + 1;
+    std::vector<int> edge_to_local_index(
+            edge_grid_size * edge_grid_size * edge_grid_size * 3, -1);
     int edge_to_index[12];
-    for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        int cube_index = 0;
-                        float w[8];
-                        float f[8];
-                        Eigen::Vector3d c[8];
-                        for (int i = 0; i < 8; i++) {
-                            Eigen::Vector3i index1 = index0;
-                            Eigen::Vector3i idx1 = idx0 + shift[i];
-                            if (idx1(0) < volume_unit_resolution_ &&
-                                idx1(1) < volume_unit_resolution_ &&
-                                idx1(2) < volume_unit_resolution_) {
-                                w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .weight_;
-                                f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .tsdf_;
-                                if (color_type_ == TSDFVolumeColorType::RGB8)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>() /
-                                           255.0;
-                                else if (color_type_ ==
-                                         TSDFVolumeColorType::Gray32)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>();
-                            } else {
-                                for (int j = 0; j < 3; j++) {
-                                    if (idx1(j) >= volume_unit_resolution_) {
-                                        idx1(j) -= volume_unit_resolution_;
-                                        index1(j) += 1;
-                                    }
-                                }
-                                auto unit_itr1 = volume_units_.find(index1);
-                                if (unit_itr1 == volume_units_.end()) {
-                                    w[i] = 0.0f;
-                                    f[i] = 0.0f;
-                                } else {
-                                    const auto &volume1 =
-                                            *unit_itr1->second.volume_;
-                                    w[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .weight_;
-                                    f[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .tsdf_;
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>() /
-                                               255.0;
-                                    else if (color_type_ ==
-                                             TSDFVolumeColorType::Gray32)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>();
-                                }
-                            }
-                            if (w[i] == 0.0f) {
-                                cube_index = 0;
-                                break;
-                            } else {
-                                if (f[i] < 0.0f) {
-                                    cube_index |= (1 << i);
-                                }
+    for (int x = 0; x < resolution; x++) {
+        for (int y = 0; y < resolution; y++) {
+            for (int z = 0; z < resolution; z++) {
+                Eigen::Vector3i idx0(x, y, z);
+                int cube_index = 0;
+                float f[8];
+                Eigen::Vector3d c[8];
+                for (int i = 0; i < 8; i++) {
+                    Eigen::Vector3i index1 = index0;
+                    Eigen::Vector3i idx1 = idx0 + shift[i];
+                    const geometry::TSDFVoxel *voxel = nullptr;
+                    if (idx1(0) < resolution && idx1(1) < resolution &&
+                        idx1(2) < resolution) {
+                        voxel = &volume0.voxels_[volume0.IndexOf(idx1)];
+                    } else {
+                        for (int j = 0; j < 3; j++) {
+                            if (idx1(j) >= resolution) {
+                                idx1(j) -= resolution;
+                                index1(j) += 1;
                             }
                         }
-                        if (cube_index == 0 || cube_index == 255) {
-                            continue;
+                        auto unit_itr1 = volume.volume_units_.find(index1);
+                        if (unit_itr1 != volume.volume_units_.end()) {
+                            const auto &volume1 = *unit_itr1->second.volume_;
+                            voxel = &volume1.voxels_[volume1.IndexOf(idx1)];
                         }
-                        for (int i = 0; i < 12; i++) {
-                            if (edge_table[cube_index] & (1 << i)) {
-                                Eigen::Vector4i edge_index =
-                                        Eigen::Vector4i(index0(0), index0(1),
-                                                        index0(2), 0) *
-                                                volume_unit_resolution_ +
-                                        Eigen::Vector4i(x, y, z, 0) +
-                                        edge_shift[i];
-                                if (edgeindex_to_vertexindex.find(edge_index) ==
-                                    edgeindex_to_vertexindex.end()) {
-                                    edge_to_index[i] =
-                                            (int)mesh->vertices_.size();
-                                    edgeindex_to_vertexindex[edge_index] =
-                                            (int)mesh->vertices_.size();
-                                    Eigen::Vector3d pt(
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(0),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(1),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(2));
-                                    double f0 = std::abs(
-                                            (double)f[edge_to_vert[i][0]]);
-                                    double f1 = std::abs(
-                                            (double)f[edge_to_vert[i][1]]);
-                                    pt(edge_index(3)) +=
-                                            f0 * voxel_length_ / (f0 + f1);
-                                    mesh->vertices_.push_back(pt);
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::NoColor) {
-                                        const auto &c0 = c[edge_to_vert[i][0]];
-                                        const auto &c1 = c[edge_to_vert[i][1]];
-                                        mesh->vertex_colors_.push_back(
-                                                (f1 * c0 + f0 * c1) /
-                                                (f0 + f1));
-                                    }
-                                } else {
-                                    edge_to_index[i] = edgeindex_to_vertexindex
-                                            [edge_index];
-                                }
+                    }
+                    if (voxel == nullptr || voxel->weight_ == 0.0f) {
+                        cube_index = 0;
+                        break;
+                    }
+                    f[i] = voxel->tsdf_;
+                    if (color_type == TSDFVolumeColorType::RGB8) {
+                        c[i] = voxel->color_.cast<double>() / 255.0;
+                    } else if (color_type == TSDFVolumeColorType::Gray32) {
+                        c[i] = voxel->color_.cast<double>();
+                    }
+                    if (f[i] < 0.0f) {
+                        cube_index |= (1 << i);
+                    }
+                }
+                if (cube_index == 0 || cube_index == 255) {
+                    continue;
+                }
+                for (int i = 0; i < 12; i++) {
+                    if (!(edge_table[cube_index] & (1 << i))) {
+                        continue;
+                    }
+                    const Eigen::Vector4i local_edge =
+                            Eigen::Vector4i(x, y, z, 0) + edge_shift[i];
+                    int &local_index =
+                            edge_to_local_index[((local_edge(0) *
+                                                          edge_grid_size +
+                                                  local_edge(1)) *
+                                                         edge_grid_size +
+                                                 local_edge(2)) *
+                                                        3 +
+                                                local_edge(3)];
+                    if (local_index < 0) {
+                        local_index = (int)unit_mesh.vertices_.size();
+                        Eigen::Vector4i edge_index = unit_offset + local_edge;
+                        bool is_shared = false;
+                        for (int j = 0; j < 3; j++) {
+                            if (j != local_edge(3) &&
+                                (local_edge(j) == 0 ||
+                                 local_edge(j) == resolution)) {
+                                is_shared = true;
                             }
                         }
-                        for (int i = 0; tri_table[cube_index][i] != -1;
-                             i += 3) {
-                            mesh->triangles_.push_back(Eigen::Vector3i(
-                                    edge_to_index[tri_table[cube_index][i]],
-                                    edge_to_index[tri_table[cube_index][i + 2]],
-                                    edge_to_index[tri_table[cube_index]
-                                                           [i + 1]]));
+                        Eigen::Vector3d pt(
+                                half_voxel_length +
+                                        voxel_length * edge_index(0),
+                                half_voxel_length +
+                                        voxel_length * edge_index(1),
+                                half_voxel_length +
+                                        voxel_length * edge_index(2));
+                        double f0 = std::abs((double)f[edge_to_vert[i][0]]);
+                        double f1 = std::abs((double)f[edge_to_vert[i][1]]);
+                        pt(edge_index(3)) += f0 * voxel_length / (f0 + f1);
+                        unit_mesh.edge_indices_.push_back(edge_index);
+                        unit_mesh.is_shared_.push_back(is_shared);
+                        unit_mesh.vertices_.push_back(pt);
+                        if (color_type != TSDFVolumeColorType::NoColor) {
+                            const auto &c0 = c[edge_to_vert[i][0]];
+                            const auto &c1 = c[edge_to_vert[i][1]];
+                            unit_mesh.vertex_colors_.push_back(
+                                    (f1 * c0 + f0 * c1) / (f0 + f1));
                         }
                     }
+                    edge_to_index[i] = local_index;
+                }
+                for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                    unit_mesh.triangles_.push_back(Eigen::Vector3i(
+                            edge_to_index[tri_table[cube_index][i]],
+                            edge_to_index[tri_table[cube_index][i + 2]],
+                            edge_to_index[tri_table[cube_index][i + 1]]));
+                }
+            }
+        }
+    }
+}
+
+/// Concatenates the unit meshes in order, merging the vertices on shared
+/// edges into the first unit that produced them. The result is the same as
+/// marching all units in order with a single edge to vertex map.
+std::shared_ptr<geometry::TriangleMesh> MergeVolumeUnitMeshes(
+        std::vector<VolumeUnitMesh> &unit_meshes, bool has_color) {
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    const int num_units = (int)unit_meshes.size();
+
+    // Only the vertices on shared edges go through the hash map, the others
+    // are known to be unique.
+    std::unordered_map<
+            Eigen::Vector4i, int, utility::hash_eigen<Eigen::Vector4i>,
+            std::equal_to<Eigen::Vector4i>,
+            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
+            edgeindex_to_vertexindex;
+    std::vector<size_t> triangle_offsets(num_units + 1, 0);
+    int num_vertices = 0;
+    for (int u = 0; u < num_units; u++) {
+        auto &unit_mesh = unit_meshes[u];
+        const size_t n = unit_mesh.vertices_.size();
+        unit_mesh.merged_indices_.resize(n);
+        unit_mesh.is_merged_source_.resize(n);
+        for (size_t v = 0; v < n; v++) {
+            int merged_index = num_vertices;
+            if (unit_mesh.is_shared_[v]) {
+                merged_index = edgeindex_to_vertexindex
+                                       .emplace(unit_mesh.edge_indices_[v],
+                                                num_vertices)
+                                       .first->second;
+            }
+            unit_mesh.merged_indices_[v] = merged_index;
+            unit_mesh.is_merged_source_[v] = merged_index == num_vertices;
+            if (merged_index == num_vertices) {
+                num_vertices++;
+            }
+        }
+        triangle_offsets[u + 1] =
+                triangle_offsets[u] + unit_mesh.triangles_.size();
+    }
+
+    mesh->vertices_.resize(num_vertices);
+    if (has_color) {
+        mesh->vertex_colors_.resize(num_vertices);
+    }
+    mesh->triangles_.resize(triangle_offsets.back());
+#pragma omp parallel for schedule(dynamic)
+    for (int u = 0; u < num_units; u++) {
+        const auto &unit_mesh = unit_meshes[u];
+        for (size_t v = 0; v < unit_mesh.vertices_.size(); v++) {
+            if (unit_mesh.is_merged_source_[v]) {
+                const int merged_index = unit_mesh.merged_indices_[v];
+                mesh->vertices_[merged_index] = unit_mesh.vertices_[v];
+                if (has_color) {
+                    mesh->vertex_colors_[merged_index] =
+                            unit_mesh.vertex_colors_[v];
                 }
             }
         }
+        for (size_t t = 0; t < unit_mesh.triangles_.size(); t++) {
+            const Eigen::Vector3i &triangle = unit_mesh.triangles_[t];
+            mesh->triangles_[triangle_offsets[u] + t] =
+                    Eigen::Vector3i(unit_mesh.merged_indices_[triangle(0)],
+                                    unit_mesh.merged_indices_[triangle(1)],
+                                    unit_mesh.merged_indices_[triangle(2)]);
+        }
     }
     return mesh;
 }
 
+}  // namespace
+
+std::shared_ptr<geometry::TriangleMesh>
+ScalableTSDFVolume::ExtractTriangleMesh() {
+    std::vector<const VolumeUnit *> units;
+    units.reserve(volume_units_.size());
+    for (const auto &unit : volume_units_) {
+        if (unit.second.volume_) {
+            units.push_back(&unit.second);
+        }
+    }
+    return ExtractTriangleMeshOfVolumeUnits(units);
+}
+
+void ScalableTSDFVolume::ExtractTriangleMeshTiles(
+        int tile_num_units,
+        const std::function<void(const Eigen::Vector3i &,
+                                 const geometry::TriangleMesh &)> &callback) {
+    if (tile_num_units <= 0) {
+        utility::LogError(
+                "[ScalableTSDFVolume::ExtractTriangleMeshTiles] "
+                "tile_num_units must be positive, but got {}.",
+                tile_num_units);
+    }
+    auto floor_div = [tile_num_units](int i) {
+        return i >= 0 ? i / tile_num_units
+                      : -((-i - 1) / tile_num_units) - 1;
+    };
+    std::unordered_map<Eigen::Vector3i, std::vector<const VolumeUnit *>,
+                       utility::hash_eigen<Eigen::Vector3i>>
+            tile_to_units;
+    for (const auto &unit : volume_units_) {
+        if (unit.second.volume_) {
+            const Eigen::Vector3i &index = unit.second.index_;
+            Eigen::Vector3i tile(floor_div(index(0)), floor_div(index(1)),
+                                 floor_div(index(2)));
+            tile_to_units[tile].push_back(&unit.second);
+        }
+    }
+    std::vector<Eigen::Vector3i> tiles;
+    tiles.reserve(tile_to_units.size());
+    for (const auto &tile : tile_to_units) {
+        tiles.push_back(tile.first);
+    }
+    std::sort(tiles.begin(), tiles.end(),
+              [](const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+                  return std::lexicographical_compare(a.data(), a.data() + 3,
+                                                      b.data(), b.data() + 3);
+              });
+    for (const auto &tile : tiles) {
+        auto mesh = ExtractTriangleMeshOfVolumeUnits(tile_to_units[tile]);
+        if (!mesh->triangles_.empty()) {
+            callback(tile, *mesh);
+        }
+    }
+}
+
+std::vector<std::string> ScalableTSDFVolume::ExtractTriangleMeshTiles(
+        const std::string &file_prefix,
+        int tile_num_units /* = 8*/,
+        bool write_ascii /* = false*/) {
+    std::vector<std::string> file_names;
+    ExtractTriangleMeshTiles(
+            tile_num_units, [&](const Eigen::Vector3i &tile,
+                                const geometry::TriangleMesh &mesh) {
+                std::string file_name =
+                        fmt::format("{}_{}_{}_{}.ply", file_prefix, tile(0),
+                                    tile(1), tile(2));
+                if (!io::WriteTriangleMesh(file_name, mesh, write_ascii)) {
+                    utility::LogError(
+                            "[ScalableTSDFVolume::ExtractTriangleMeshTiles] "
+                            "Failed to write {}.",
+                            file_name);
+                }
+                file_names.push_back(file_name);
+            });
+    return file_names;
+}
+
+std::shared_ptr<geometry::TriangleMesh>
+ScalableTSDFVolume::ExtractTriangleMeshOfVolumeUnits(
+        const std::vector<const VolumeUnit *> &units) const {
+    std::vector<VolumeUnitMesh> unit_meshes(units.size());
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < (int)units.size(); i++) {
+        ExtractVolumeUnitMesh(*this, *units[i], unit_meshes[i]);
+    }
+    return MergeVolumeUnitMeshes(unit_meshes,
+                                 color_type_ != TSDFVolumeColorType::NoColor);
+}
+
 std::shared_ptr<geometry::PointCloud>
 ScalableTSDFVolume::ExtractVoxelPointCloud() {
     auto voxel = std::make_shared<geometry::PointCloud>();
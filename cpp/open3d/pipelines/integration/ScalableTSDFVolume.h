@@ -26,8 +26,11 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "open3d/pipelines/integration/TSDFVolume.h"
 #include "open3d/utility/Helper.h"
@@ -82,6 +85,22 @@ public:
                    const Eigen::Matrix4d &extrinsic) override;
     std::shared_ptr<geometry::PointCloud> ExtractPointCloud() override;
     std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMesh() override;
+    /// Extracts the triangle mesh tile by tile, where a tile consists of
+    /// tile_num_units^3 volume units, and calls callback with the index and
+    /// the mesh of every non-empty tile. Only one tile mesh is kept in memory
+    /// at a time. The vertices on the boundary between tiles are repeated in
+    /// the meshes of both tiles.
+    void ExtractTriangleMeshTiles(
+            int tile_num_units,
+            const std::function<void(const Eigen::Vector3i &tile,
+                                     const geometry::TriangleMesh &mesh)>
+                    &callback);
+    /// Writes the tile meshes of ExtractTriangleMeshTiles to
+    /// "<file_prefix>_<x>_<y>_<z>.ply" and returns the written file names.
+    std::vector<std::string> ExtractTriangleMeshTiles(
+            const std::string &file_prefix,
+            int tile_num_units = 8,
+            bool write_ascii = false);
     /// Debug function to extract the voxel data into a point cloud.
     std::shared_ptr<geometry::PointCloud> ExtractVoxelPointCloud();
 
@@ -111,6 +130,11 @@ private:
     Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
 
     double GetTSDFAt(const Eigen::Vector3d &p);
+
+    /// Runs marching cubes over units in parallel and merges the vertices on
+    /// the edges shared between units.
+    std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMeshOfVolumeUnits(
+            const std::vector<const VolumeUnit *> &units) const;
 };
 
 }  // namespace integration
@@ -27,6 +27,7 @@
 #include "open3d/pipelines/odometry/Odometry.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <memory>
 
 #include "open3d/geometry/Image.h"
@@ -39,161 +40,75 @@ namespace open3d {
 namespace pipelines {
 namespace odometry {
 
-static std::tuple<geometry::Image, geometry::Image> InitializeCorrespondenceMap(
-        int width, int height) {
-    // initialization: filling with any (u,v) to (-1,-1)
-    geometry::Image correspondence_map;
-    geometry::Image depth_buffer;
-    correspondence_map.Prepare(width, height, 2, 4);
-    depth_buffer.Prepare(width, height, 1, 4);
-    for (int v = 0; v < correspondence_map.height_; v++) {
-        for (int u = 0; u < correspondence_map.width_; u++) {
-            *correspondence_map.PointerAt<int>(u, v, 0) = -1;
-            *correspondence_map.PointerAt<int>(u, v, 1) = -1;
-            *depth_buffer.PointerAt<float>(u, v, 0) = -1.0f;
-        }
-    }
-    return std::make_tuple(correspondence_map, depth_buffer);
-}
-
-static inline void AddElementToCorrespondenceMap(
-        geometry::Image &correspondence_map,
-        geometry::Image &depth_buffer,
-        int u_s,
-        int v_s,
-        int u_t,
-        int v_t,
-        float transformed_d_t) {
-    int exist_u_t, exist_v_t;
-    double exist_d_t;
-    exist_u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-    exist_v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-    if (exist_u_t != -1 && exist_v_t != -1) {
-        exist_d_t = *depth_buffer.PointerAt<float>(u_s, v_s);
-        if (transformed_d_t <
-            exist_d_t) {  // update nearer point as correspondence
-            *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-            *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-            *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-        }
-    } else {  // register correspondence
-        *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-        *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-        *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-    }
-}
-
-static void MergeCorrespondenceMaps(geometry::Image &correspondence_map,
-                                    geometry::Image &depth_buffer,
-                                    geometry::Image &correspondence_map_part,
-                                    geometry::Image &depth_buffer_part) {
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                float transformed_d_t =
-                        *depth_buffer_part.PointerAt<float>(u_s, v_s);
-                AddElementToCorrespondenceMap(correspondence_map, depth_buffer,
-                                              u_s, v_s, u_t, v_t,
-                                              transformed_d_t);
-            }
-        }
-    }
-}
-
-static int CountCorrespondence(const geometry::Image &correspondence_map) {
-    int correspondence_count = 0;
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                correspondence_count++;
-            }
-        }
-    }
-    return correspondence_count;
-}
-
-static CorrespondenceSetPixelWise ComputeCorrespondence(
+/// Computes the correspondences of the source pixels into
+/// context.correspondence_, in the order of the source pixels. As every source
+/// pixel has at most one correspondence, the rows are matched in parallel
+/// into per-row buffers that are concatenated afterwards.
+static const CorrespondenceSetPixelWise &ComputeCorrespondence(
         const Eigen::Matrix3d intrinsic_matrix,
         const Eigen::Matrix4d &extrinsic,
         const geometry::Image &depth_s,
         const geometry::Image &depth_t,
-        const OdometryOption &option) {
+        const OdometryOption &option,
+        RGBDOdometryContext &context) {
     const Eigen::Matrix3d K = intrinsic_matrix;
     const Eigen::Matrix3d K_inv = K.inverse();
     const Eigen::Matrix3d R = extrinsic.block<3, 3>(0, 0);
     const Eigen::Matrix3d KRK_inv = K * R * K_inv;
     Eigen::Vector3d Kt = K * extrinsic.block<3, 1>(0, 3);
 
-    geometry::Image correspondence_map;
-    geometry::Image depth_buffer;
-    std::tie(correspondence_map, depth_buffer) =
-            InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-
-#pragma omp parallel
-    {
-        geometry::Image correspondence_map_private;
-        geometry::Image depth_buffer_private;
-        std::tie(correspondence_map_private, depth_buffer_private) =
-                InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-#pragma omp for nowait
-        for (int v_s = 0; v_s < depth_s.height_; v_s++) {
-            for (int u_s = 0; u_s < depth_s.width_; u_s++) {
-                double d_s = *depth_s.PointerAt<float>(u_s, v_s);
-                if (!std::isnan(d_s)) {
-                    Eigen::Vector3d uv_in_s =
-                            d_s * KRK_inv * Eigen::Vector3d(u_s, v_s, 1.0) + Kt;
-                    double transformed_d_s = uv_in_s(2);
-                    int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
-                    int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
-                    if (u_t >= 0 && u_t < depth_t.width_ && v_t >= 0 &&
-                        v_t < depth_t.height_) {
-                        double d_t = *depth_t.PointerAt<float>(u_t, v_t);
-                        if (!std::isnan(d_t) &&
-                            std::abs(transformed_d_s - d_t) <=
-                                    option.max_depth_diff_) {
-                            AddElementToCorrespondenceMap(
-                                    correspondence_map_private,
-                                    depth_buffer_private, u_s, v_s, u_t, v_t,
-                                    (float)d_s);
-                        }
+    std::vector<CorrespondenceSetPixelWise> &row_correspondences =
+            context.row_correspondences_;
+    if (int(row_correspondences.size()) < depth_s.height_) {
+        row_correspondences.resize(depth_s.height_);
+    }
+#pragma omp parallel for schedule(static)
+    for (int v_s = 0; v_s < depth_s.height_; v_s++) {
+        CorrespondenceSetPixelWise &row_correspondence =
+                row_correspondences[v_s];
+        row_correspondence.clear();
+        for (int u_s = 0; u_s < depth_s.width_; u_s++) {
+            double d_s = *depth_s.PointerAt<float>(u_s, v_s);
+            if (!std::isnan(d_s)) {
+                Eigen::Vector3d uv_in_s =
+                        d_s * KRK_inv * Eigen::Vector3d(u_s, v_s, 1.0) + Kt;
+                double transformed_d_s = uv_in_s(2);
+                int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
+                int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
+                if (u_t >= 0 && u_t < depth_t.width_ && v_t >= 0 &&
+                    v_t < depth_t.height_) {
+                    double d_t = *depth_t.PointerAt<float>(u_t, v_t);
+                    if (!std::isnan(d_t) &&
+                        std::abs(transformed_d_s - d_t) <=
+                                option.max_depth_diff_) {
+                        row_correspondence.emplace_back(u_s, v_s, u_t, v_t);
                     }
                 }
             }
         }
-#pragma omp critical(ComputeCorrespondence)
-        {
-            MergeCorrespondenceMaps(correspondence_map, depth_buffer,
-                                    correspondence_map_private,
-                                    depth_buffer_private);
-
-        }  //    omp critical
-    }      //    omp parallel
+    }
 
-    CorrespondenceSetPixelWise correspondence;
-    int correspondence_count = CountCorrespondence(correspondence_map);
+    CorrespondenceSetPixelWise &correspondence = context.correspondence_;
+    size_t correspondence_count = 0;
+    for (int v_s = 0; v_s < depth_s.height_; v_s++) {
+        correspondence_count += row_correspondences[v_s].size();
+    }
     correspondence.resize(correspondence_count);
-    int cnt = 0;
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                Eigen::Vector4i pixel_correspondence(u_s, v_s, u_t, v_t);
-                correspondence[cnt] = pixel_correspondence;
-                cnt++;
-            }
-        }
+    size_t offset = 0;
+    for (int v_s = 0; v_s < depth_s.height_; v_s++) {
+        std::copy(row_correspondences[v_s].begin(),
+                  row_correspondences[v_s].end(),
+                  correspondence.begin() + offset);
+        offset += row_correspondences[v_s].size();
     }
     return correspondence;
 }
 
-static std::shared_ptr<geometry::Image> ConvertDepthImageToXYZImage(
-        const geometry::Image &depth, const Eigen::Matrix3d &intrinsic_matrix) {
-    auto image_xyz = std::make_shared<geometry::Image>();
+/// Converts \p depth into \p image_xyz, whose buffer is reused if it is of
+/// the same size.
+static void ConvertDepthImageToXYZImage(const geometry::Image &depth,
+                                        const Eigen::Matrix3d &intrinsic_matrix,
+                                        geometry::Image &image_xyz) {
     if (depth.num_of_channels_ != 1 || depth.bytes_per_channel_ != 4) {
         utility::LogError(
                 "[ConvertDepthImageToXYZImage] Unsupported image format.");
@@ -202,20 +117,20 @@ static std::shared_ptr<geometry::Image> ConvertDepthImageToXYZImage(
     const double inv_fy = 1.0 / intrinsic_matrix(1, 1);
     const double ox = intrinsic_matrix(0, 2);
     const double oy = intrinsic_matrix(1, 2);
-    image_xyz->Prepare(depth.width_, depth.height_, 3, 4);
-
-    for (int y = 0; y < image_xyz->height_; y++) {
-        for (int x = 0; x < image_xyz->width_; x++) {
-            float *px = image_xyz->PointerAt<float>(x, y, 0);
-            float *py = image_xyz->PointerAt<float>(x, y, 1);
-            float *pz = image_xyz->PointerAt<float>(x, y, 2);
+    image_xyz.Prepare(depth.width_, depth.height_, 3, 4);
+
+#pragma omp parallel for schedule(static)
+    for (int y = 0; y < image_xyz.height_; y++) {
+        for (int x = 0; x < image_xyz.width_; x++) {
+            float *px = image_xyz.PointerAt<float>(x, y, 0);
+            float *py = image_xyz.PointerAt<float>(x, y, 1);
+            float *pz = image_xyz.PointerAt<float>(x, y, 2);
             float z = *depth.PointerAt<float>(x, y);
             *px = (float)((x - ox) * z * inv_fx);
             *py = (float)((y - oy) * z * inv_fy);
             *pz = z;
         }
     }
-    return image_xyz;
 }
 
 static std::vector<Eigen::Matrix3d> CreateCameraMatrixPyramid(
@@ -240,13 +155,15 @@ static Eigen::Matrix6d CreateInformationMatrix(
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
         const geometry::Image &depth_s,
         const geometry::Image &depth_t,
-        const OdometryOption &option) {
-    CorrespondenceSetPixelWise correspondence =
-            ComputeCorrespondence(pinhole_camera_intrinsic.intrinsic_matrix_,
-                                  extrinsic, depth_s, depth_t, option);
+        const OdometryOption &option,
+        RGBDOdometryContext &context) {
+    const CorrespondenceSetPixelWise &correspondence = ComputeCorrespondence(
+            pinhole_camera_intrinsic.intrinsic_matrix_, extrinsic, depth_s,
+            depth_t, option, context);
 
-    auto xyz_t = ConvertDepthImageToXYZImage(
-            depth_t, pinhole_camera_intrinsic.intrinsic_matrix_);
+    geometry::Image &xyz_t = context.xyz_;
+    ConvertDepthImageToXYZImage(
+            depth_t, pinhole_camera_intrinsic.intrinsic_matrix_, xyz_t);
 
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
@@ -260,9 +177,9 @@ static Eigen::Matrix6d CreateInformationMatrix(
         for (int row = 0; row < int(correspondence.size()); row++) {
             int u_t = correspondence[row](2);
             int v_t = correspondence[row](3);
-            double x = *xyz_t->PointerAt<float>(u_t, v_t, 0);
-            double y = *xyz_t->PointerAt<float>(u_t, v_t, 1);
-            double z = *xyz_t->PointerAt<float>(u_t, v_t, 2);
+            double x = *xyz_t.PointerAt<float>(u_t, v_t, 0);
+            double y = *xyz_t.PointerAt<float>(u_t, v_t, 1);
+            double z = *xyz_t.PointerAt<float>(u_t, v_t, 2);
             G_r_private.setZero();
             G_r_private(1) = z;
             G_r_private(2) = -y;
@@ -316,19 +233,20 @@ static inline std::shared_ptr<geometry::RGBDImage> PackRGBDImage(
             geometry::RGBDImage(color, depth));
 }
 
-static std::shared_ptr<geometry::Image> PreprocessDepth(
-        const geometry::Image &depth_orig, const OdometryOption &option) {
-    std::shared_ptr<geometry::Image> depth_processed =
-            std::make_shared<geometry::Image>();
-    *depth_processed = depth_orig;
-    for (int y = 0; y < depth_processed->height_; y++) {
-        for (int x = 0; x < depth_processed->width_; x++) {
-            float *p = depth_processed->PointerAt<float>(x, y);
+/// Copies \p depth_orig into \p depth_processed, whose buffer is reused if
+/// it is of the same size, with invalid depths set to NaN.
+static void PreprocessDepth(const geometry::Image &depth_orig,
+                            const OdometryOption &option,
+                            geometry::Image &depth_processed) {
+    depth_processed = depth_orig;
+#pragma omp parallel for schedule(static)
+    for (int y = 0; y < depth_processed.height_; y++) {
+        for (int x = 0; x < depth_processed.width_; x++) {
+            float *p = depth_processed.PointerAt<float>(x, y);
             if ((*p < option.min_depth_ || *p > option.max_depth_ || *p <= 0))
                 *p = std::numeric_limits<float>::quiet_NaN();
         }
     }
-    return depth_processed;
 }
 
 static inline bool CheckImagePair(const geometry::Image &image_s,
@@ -383,7 +301,8 @@ InitializeRGBDOdometry(
         const geometry::RGBDImage &target,
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
         const Eigen::Matrix4d &odo_init,
-        const OdometryOption &option) {
+        const OdometryOption &option,
+        RGBDOdometryContext &context) {
     std::shared_ptr<geometry::Image> source_color, target_color;
     if (IsColorImageRGB(source.color_) && IsColorImageRGB(target.color_)) {
         source_color = source.color_.CreateFloatImage();
@@ -397,16 +316,16 @@ InitializeRGBDOdometry(
             source_color->Filter(geometry::Image::FilterType::Gaussian3);
     auto target_gray =
             target_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto source_depth_preprocessed = PreprocessDepth(source.depth_, option);
-    auto target_depth_preprocessed = PreprocessDepth(target.depth_, option);
-    auto source_depth = source_depth_preprocessed->Filter(
+    PreprocessDepth(source.depth_, option, context.source_depth_);
+    PreprocessDepth(target.depth_, option, context.target_depth_);
+    auto source_depth = context.source_depth_.Filter(
             geometry::Image::FilterType::Gaussian3);
-    auto target_depth = target_depth_preprocessed->Filter(
+    auto target_depth = context.target_depth_.Filter(
             geometry::Image::FilterType::Gaussian3);
 
-    CorrespondenceSetPixelWise correspondence = ComputeCorrespondence(
+    const CorrespondenceSetPixelWise &correspondence = ComputeCorrespondence(
             pinhole_camera_intrinsic.intrinsic_matrix_, odo_init, *source_depth,
-            *target_depth, option);
+            *target_depth, option, context);
     NormalizeIntensity(*source_gray, *target_gray, correspondence);
 
     auto source_out = PackRGBDImage(*source_gray, *source_depth);
@@ -425,9 +344,11 @@ static std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
         const Eigen::Matrix3d intrinsic,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
-        const OdometryOption &option) {
-    CorrespondenceSetPixelWise correspondence = ComputeCorrespondence(
-            intrinsic, extrinsic_initial, source.depth_, target.depth_, option);
+        const OdometryOption &option,
+        RGBDOdometryContext &context) {
+    const CorrespondenceSetPixelWise &correspondence =
+            ComputeCorrespondence(intrinsic, extrinsic_initial, source.depth_,
+                                  target.depth_, option, context);
     int corresps_count = (int)correspondence.size();
 
     auto f_lambda =
@@ -465,7 +386,8 @@ static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
-        const OdometryOption &option) {
+        const OdometryOption &option,
+        RGBDOdometryContext &context) {
     std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
     int num_levels = (int)iter_counts.size();
 
@@ -488,8 +410,9 @@ static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
         const Eigen::Matrix3d level_camera_matrix =
                 pyramid_camera_matrix[level];
 
-        auto source_xyz_level = ConvertDepthImageToXYZImage(
-                source_pyramid[level]->depth_, level_camera_matrix);
+        geometry::Image &source_xyz_level = context.xyz_;
+        ConvertDepthImageToXYZImage(source_pyramid[level]->depth_,
+                                    level_camera_matrix, source_xyz_level);
         auto source_level = PackRGBDImage(source_pyramid[level]->color_,
                                           source_pyramid[level]->depth_);
         auto target_level = PackRGBDImage(target_pyramid[level]->color_,
@@ -504,8 +427,9 @@ static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
             bool is_success;
             std::tie(is_success, curr_odo) = DoSingleIteration(
                     iter, level, *source_level, *target_level,
-                    *source_xyz_level, *target_dx_level, *target_dy_level,
-                    level_camera_matrix, result_odo, jacobian_method, option);
+                    source_xyz_level, *target_dx_level, *target_dy_level,
+                    level_camera_matrix, result_odo, jacobian_method, option,
+                    context);
             result_odo = curr_odo * result_odo;
 
             if (!is_success) {
@@ -518,6 +442,7 @@ static std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
 }
 
 std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
+        RGBDOdometryContext &context,
         const geometry::RGBDImage &source,
         const geometry::RGBDImage &target,
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic
@@ -535,19 +460,20 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
 
     std::shared_ptr<geometry::RGBDImage> source_processed, target_processed;
     std::tie(source_processed, target_processed) = InitializeRGBDOdometry(
-            source, target, pinhole_camera_intrinsic, odo_init, option);
+            source, target, pinhole_camera_intrinsic, odo_init, option,
+            context);
 
     Eigen::Matrix4d extrinsic;
     bool is_success;
     std::tie(is_success, extrinsic) = ComputeMultiscale(
             *source_processed, *target_processed, pinhole_camera_intrinsic,
-            odo_init, jacobian_method, option);
+            odo_init, jacobian_method, option, context);
 
     if (is_success) {
         Eigen::Matrix4d trans_output = extrinsic;
         Eigen::MatrixXd info_output = CreateInformationMatrix(
                 extrinsic, pinhole_camera_intrinsic, source_processed->depth_,
-                target_processed->depth_, option);
+                target_processed->depth_, option, context);
         return std::make_tuple(true, trans_output, info_output);
     } else {
         return std::make_tuple(false, Eigen::Matrix4d::Identity(),
@@ -555,6 +481,21 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
     }
 }
 
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic
+        /*= camera::PinholeCameraIntrinsic()*/,
+        const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
+        const RGBDOdometryJacobian &jacobian_method
+        /*=RGBDOdometryJacobianFromHybridTerm*/,
+        const OdometryOption &option /*= OdometryOption()*/) {
+    RGBDOdometryContext context;
+    return ComputeRGBDOdometry(context, source, target,
+                               pinhole_camera_intrinsic, odo_init,
+                               jacobian_method, option);
+}
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
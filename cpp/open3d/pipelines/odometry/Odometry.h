@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
+#include "open3d/geometry/Image.h"
 #include "open3d/pipelines/odometry/OdometryOption.h"
 #include "open3d/pipelines/odometry/RGBDOdometryJacobian.h"
 #include "open3d/utility/Eigen.h"
@@ -46,6 +47,28 @@ class RGBDImage;
 namespace pipelines {
 namespace odometry {
 
+/// \class RGBDOdometryContext
+///
+/// \brief Buffers of ComputeRGBDOdometry() kept across calls, so that the
+/// odometry of a sequence of frames of the same size reuses them instead of
+/// reallocating them for every pair.
+class RGBDOdometryContext {
+public:
+    RGBDOdometryContext() {}
+    ~RGBDOdometryContext() {}
+
+public:
+    /// Source and target depth images with invalid depths set to NaN.
+    geometry::Image source_depth_;
+    geometry::Image target_depth_;
+    /// Back-projected depth image of the current pyramid level.
+    geometry::Image xyz_;
+    /// Correspondences found in each source row.
+    std::vector<CorrespondenceSetPixelWise> row_correspondences_;
+    /// Correspondences of the current iteration, in source pixel order.
+    CorrespondenceSetPixelWise correspondence_;
+};
+
 /// \brief Function to estimate 6D rigid motion from two RGBD image pairs.
 ///
 /// \param source Source RGBD image.
@@ -65,6 +88,23 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
                 RGBDOdometryJacobianFromHybridTerm(),
         const OdometryOption &option = OdometryOption());
 
+/// \brief Function to estimate 6D rigid motion from two RGBD image pairs,
+/// reusing the buffers of \p context from previous calls.
+///
+/// \param context Buffers reused across calls.
+/// See the overload without context for the other parameters.
+/// \return is_success, 4x4 motion matrix, 6x6 information matrix.
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
+        RGBDOdometryContext &context,
+        const geometry::RGBDImage &source,
+        const geometry::RGBDImage &target,
+        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic =
+                camera::PinholeCameraIntrinsic(),
+        const Eigen::Matrix4d &odo_init = Eigen::Matrix4d::Identity(),
+        const RGBDOdometryJacobian &jacobian_method =
+                RGBDOdometryJacobianFromHybridTerm(),
+        const OdometryOption &option = OdometryOption());
+
 }  // namespace odometry
 }  // namespace pipelines
 }  // namespace open3d
@@ -35,6 +35,43 @@ namespace open3d {
 namespace pipelines {
 namespace registration {
 
+namespace {
+
+/// Checks a batch of hypotheses with a non-virtual call to the Check() of
+/// \p Checker.
+template <typename Checker>
+void CheckHypotheses(
+        const Checker &checker,
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<CorrespondenceSet> &corres,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformations,
+        std::vector<bool> &valid) {
+    for (size_t k = 0; k < corres.size(); k++) {
+        if (valid[k]) {
+            valid[k] = checker.Checker::Check(source, target, corres[k],
+                                              transformations[k]);
+        }
+    }
+}
+
+}  // namespace
+
+void CorrespondenceChecker::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<CorrespondenceSet> &corres,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformations,
+        std::vector<bool> &valid) const {
+    for (size_t k = 0; k < corres.size(); k++) {
+        if (valid[k]) {
+            valid[k] = Check(source, target, corres[k], transformations[k]);
+        }
+    }
+}
+
 bool CorrespondenceCheckerBasedOnEdgeLength::Check(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -101,6 +138,36 @@ bool CorrespondenceCheckerBasedOnNormal::Check(
     return true;
 }
 
+void CorrespondenceCheckerBasedOnEdgeLength::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<CorrespondenceSet> &corres,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformations,
+        std::vector<bool> &valid) const {
+    CheckHypotheses(*this, source, target, corres, transformations, valid);
+}
+
+void CorrespondenceCheckerBasedOnDistance::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<CorrespondenceSet> &corres,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformations,
+        std::vector<bool> &valid) const {
+    CheckHypotheses(*this, source, target, corres, transformations, valid);
+}
+
+void CorrespondenceCheckerBasedOnNormal::CheckBatch(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<CorrespondenceSet> &corres,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &transformations,
+        std::vector<bool> &valid) const {
+    CheckHypotheses(*this, source, target, corres, transformations, valid);
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "open3d/pipelines/registration/TransformationEstimation.h"
+#include "open3d/utility/Eigen.h"
 
 namespace open3d {
 
@@ -73,6 +74,26 @@ public:
                        const CorrespondenceSet &corres,
                        const Eigen::Matrix4d &transformation) const = 0;
 
+    /// \brief Function to check a batch of hypotheses at once.
+    ///
+    /// Hypothesis k is made of \p corres[k] and \p transformations[k].
+    /// \p valid[k] is cleared if the check of hypothesis k fails, and the
+    /// hypotheses already cleared in \p valid are not checked again. The
+    /// built-in checkers override this method with a loop that does not
+    /// dispatch virtually per hypothesis.
+    /// \param source Source point cloud.
+    /// \param target Target point cloud.
+    /// \param corres Correspondence set of each hypothesis.
+    /// \param transformations Estimated transformation of each hypothesis.
+    /// \param valid Validity of each hypothesis (inplace).
+    virtual void CheckBatch(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const std::vector<CorrespondenceSet> &corres,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &transformations,
+            std::vector<bool> &valid) const;
+
 public:
     /// Some checkers do not require point clouds to be aligned, e.g., the edge
     /// length checker. Some checkers do, e.g., the distance checker.
@@ -104,6 +125,13 @@ public:
                const geometry::PointCloud &target,
                const CorrespondenceSet &corres,
                const Eigen::Matrix4d &transformation) const override;
+    void CheckBatch(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const std::vector<CorrespondenceSet> &corres,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &transformations,
+            std::vector<bool> &valid) const override;
 
 public:
     /// For the check to be true,
@@ -131,6 +159,13 @@ public:
                const geometry::PointCloud &target,
                const CorrespondenceSet &corres,
                const Eigen::Matrix4d &transformation) const override;
+    void CheckBatch(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const std::vector<CorrespondenceSet> &corres,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &transformations,
+            std::vector<bool> &valid) const override;
 
 public:
     /// Distance threashold for the check.
@@ -158,6 +193,13 @@ public:
                const geometry::PointCloud &target,
                const CorrespondenceSet &corres,
                const Eigen::Matrix4d &transformation) const override;
+    void CheckBatch(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const std::vector<CorrespondenceSet> &corres,
+            const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                    &transformations,
+            std::vector<bool> &valid) const override;
 
 public:
     /// Radian value for angle threshold.
@@ -26,10 +26,13 @@
 
 #include "open3d/pipelines/registration/FastGlobalRegistration.h"
 
+#include <algorithm>
+
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
 #include "open3d/pipelines/registration/Registration.h"
+#include "open3d/utility/Eigen.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
 
@@ -58,24 +61,45 @@ static std::vector<std::pair<int, int>> AdvancedMatching(
     int nPtj = int(point_cloud_vec[fj].points_.size());
     geometry::KDTreeFlann feature_tree_i(features_vec[fi]);
     geometry::KDTreeFlann feature_tree_j(features_vec[fj]);
-    std::vector<int> corresK;
-    std::vector<double> dis;
     std::vector<std::pair<int, int>> corres;
     std::vector<std::pair<int, int>> corres_ij;
-    std::vector<std::pair<int, int>> corres_ji;
+    std::vector<std::pair<int, int>> corres_ji(nPtj);
+    // Every point of j is matched to its nearest feature in i, and every point
+    // of i hit by such a match is matched back to its nearest feature in j.
+    // Both passes are independent nearest neighbor queries.
+#pragma omp parallel
+    {
+        std::vector<int> corresK;
+        std::vector<double> dis;
+#pragma omp for schedule(static)
+        for (int j = 0; j < nPtj; j++) {
+            feature_tree_i.SearchKNN(
+                    Eigen::VectorXd(features_vec[fj].data_.col(j)), 1,
+                    corresK, dis);
+            corres_ji[j] = std::pair<int, int>(corresK[0], j);
+        }
+    }
     std::vector<int> i_to_j(nPti, -1);
+    std::vector<int> matched_i;
     for (int j = 0; j < nPtj; j++) {
-        feature_tree_i.SearchKNN(Eigen::VectorXd(features_vec[fj].data_.col(j)),
-                                 1, corresK, dis);
-        int i = corresK[0];
+        int i = corres_ji[j].first;
         if (i_to_j[i] == -1) {
+            i_to_j[i] = 0;
+            matched_i.push_back(i);
+        }
+    }
+#pragma omp parallel
+    {
+        std::vector<int> corresK;
+        std::vector<double> dis;
+#pragma omp for schedule(static)
+        for (int k = 0; k < int(matched_i.size()); k++) {
+            int i = matched_i[k];
             feature_tree_j.SearchKNN(
-                    Eigen::VectorXd(features_vec[fi].data_.col(i)), 1, corresK,
-                    dis);
-            int ij = corresK[0];
-            i_to_j[i] = ij;
+                    Eigen::VectorXd(features_vec[fi].data_.col(i)), 1,
+                    corresK, dis);
+            i_to_j[i] = corresK[0];
         }
-        corres_ji.push_back(std::pair<int, int>(i, j));
     }
     for (int i = 0; i < nPti; i++) {
         if (i_to_j[i] != -1)
@@ -119,49 +143,63 @@ static std::vector<std::pair<int, int>> AdvancedMatching(
 
     // STEP 3) TUPLE CONSTRAINT
     utility::LogDebug("\t[tuple constraint] ");
-    int rand0, rand1, rand2, i, cnt = 0;
-    int idi0, idi1, idi2, idj0, idj1, idj2;
+    int i = 0, cnt = 0;
     double scale = option.tuple_scale_;
     int ncorr = static_cast<int>(corres_cross.size());
     int number_of_trial = ncorr * 100;
 
+    // Trials are sampled and tested in parallel blocks. The accepted tuples of
+    // a block are collected in trial order, so that the sampling stops at the
+    // same trial as a serial loop would for the same random draws.
+    const int block_size = 4096;
+    std::vector<Eigen::Vector3i> block_samples(block_size);
+    std::vector<char> block_accepted(block_size);
     std::vector<std::pair<int, int>> corres_tuple;
-    for (i = 0; i < number_of_trial; i++) {
-        rand0 = utility::UniformRandInt(0, ncorr - 1);
-        rand1 = utility::UniformRandInt(0, ncorr - 1);
-        rand2 = utility::UniformRandInt(0, ncorr - 1);
-        idi0 = corres_cross[rand0].first;
-        idj0 = corres_cross[rand0].second;
-        idi1 = corres_cross[rand1].first;
-        idj1 = corres_cross[rand1].second;
-        idi2 = corres_cross[rand2].first;
-        idj2 = corres_cross[rand2].second;
-
-        // collect 3 points from i-th fragment
-        Eigen::Vector3d pti0 = point_cloud_vec[fi].points_[idi0];
-        Eigen::Vector3d pti1 = point_cloud_vec[fi].points_[idi1];
-        Eigen::Vector3d pti2 = point_cloud_vec[fi].points_[idi2];
-        double li0 = (pti0 - pti1).norm();
-        double li1 = (pti1 - pti2).norm();
-        double li2 = (pti2 - pti0).norm();
-
-        // collect 3 points from j-th fragment
-        Eigen::Vector3d ptj0 = point_cloud_vec[fj].points_[idj0];
-        Eigen::Vector3d ptj1 = point_cloud_vec[fj].points_[idj1];
-        Eigen::Vector3d ptj2 = point_cloud_vec[fj].points_[idj2];
-        double lj0 = (ptj0 - ptj1).norm();
-        double lj1 = (ptj1 - ptj2).norm();
-        double lj2 = (ptj2 - ptj0).norm();
-
-        // check tuple constraint
-        if ((li0 * scale < lj0) && (lj0 < li0 / scale) && (li1 * scale < lj1) &&
-            (lj1 < li1 / scale) && (li2 * scale < lj2) && (lj2 < li2 / scale)) {
-            corres_tuple.push_back(std::pair<int, int>(idi0, idj0));
-            corres_tuple.push_back(std::pair<int, int>(idi1, idj1));
-            corres_tuple.push_back(std::pair<int, int>(idi2, idj2));
-            cnt++;
+    while (i < number_of_trial && cnt < option.maximum_tuple_count_) {
+        const int block_trials = std::min(block_size, number_of_trial - i);
+#pragma omp parallel for schedule(static)
+        for (int t = 0; t < block_trials; t++) {
+            Eigen::Vector3i sample(utility::UniformRandInt(0, ncorr - 1),
+                                   utility::UniformRandInt(0, ncorr - 1),
+                                   utility::UniformRandInt(0, ncorr - 1));
+            int idi0 = corres_cross[sample(0)].first;
+            int idj0 = corres_cross[sample(0)].second;
+            int idi1 = corres_cross[sample(1)].first;
+            int idj1 = corres_cross[sample(1)].second;
+            int idi2 = corres_cross[sample(2)].first;
+            int idj2 = corres_cross[sample(2)].second;
+
+            // collect 3 points from i-th fragment
+            const Eigen::Vector3d& pti0 = point_cloud_vec[fi].points_[idi0];
+            const Eigen::Vector3d& pti1 = point_cloud_vec[fi].points_[idi1];
+            const Eigen::Vector3d& pti2 = point_cloud_vec[fi].points_[idi2];
+            double li0 = (pti0 - pti1).norm();
+            double li1 = (pti1 - pti2).norm();
+            double li2 = (pti2 - pti0).norm();
+
+            // collect 3 points from j-th fragment
+            const Eigen::Vector3d& ptj0 = point_cloud_vec[fj].points_[idj0];
+            const Eigen::Vector3d& ptj1 = point_cloud_vec[fj].points_[idj1];
+            const Eigen::Vector3d& ptj2 = point_cloud_vec[fj].points_[idj2];
+            double lj0 = (ptj0 - ptj1).norm();
+            double lj1 = (ptj1 - ptj2).norm();
+            double lj2 = (ptj2 - ptj0).norm();
+
+            // check tuple constraint
+            block_samples[t] = sample;
+            block_accepted[t] = (li0 * scale < lj0) && (lj0 < li0 / scale) &&
+                                (li1 * scale < lj1) && (lj1 < li1 / scale) &&
+                                (li2 * scale < lj2) && (lj2 < li2 / scale);
+        }
+        for (int t = 0; t < block_trials; t++, i++) {
+            if (block_accepted[t]) {
+                for (int k = 0; k < 3; k++) {
+                    corres_tuple.push_back(corres_cross[block_samples[t](k)]);
+                }
+                cnt++;
+            }
+            if (cnt >= option.maximum_tuple_count_) break;
         }
-        if (cnt >= option.maximum_tuple_count_) break;
     }
     utility::LogDebug("{:d} tuples ({:d} trial, {:d} actual).", cnt,
                       number_of_trial, i);
@@ -252,54 +290,40 @@ static Eigen::Matrix4d OptimizePairwiseRegistration(
     trans.setIdentity();
 
     for (int itr = 0; itr < numIter; itr++) {
-        const int nvariable = 6;
-        Eigen::MatrixXd JTJ(nvariable, nvariable);
-        Eigen::MatrixXd JTr(nvariable, 1);
-        Eigen::MatrixXd J(nvariable, 1);
-        JTJ.setZero();
-        JTr.setZero();
-        double r = 0.0, r2 = 0.0;
-
-        for (size_t c = 0; c < corres.size(); c++) {
-            int ii = corres[c].first;
-            int jj = corres[c].second;
-            Eigen::Vector3d p, q;
-            p = point_cloud_vec[i].points_[ii];
-            q = point_cloud_copy_j.points_[jj];
-            Eigen::Vector3d rpq = p - q;
-
-            size_t c2 = c;
-            double temp = par / (rpq.dot(rpq) + par);
-            s[c2] = temp * temp;
-
-            J.setZero();
-            J(1) = -q(2);
-            J(2) = q(1);
-            J(3) = -1;
-            r = rpq(0);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-
-            J.setZero();
-            J(2) = -q(0);
-            J(0) = q(2);
-            J(4) = -1;
-            r = rpq(1);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-
-            J.setZero();
-            J(0) = -q(1);
-            J(1) = q(0);
-            J(5) = -1;
-            r = rpq(2);
-            JTJ += J * J.transpose() * s[c2];
-            JTr += J * r * s[c2];
-            r2 += r * r * s[c2];
-            r2 += (par * (1.0 - sqrt(s[c2])) * (1.0 - sqrt(s[c2])));
-        }
+        // Every correspondence contributes three rows, one per coordinate,
+        // weighted by its Geman-McClure line process.
+        auto compute_jacobian_and_residual =
+                [&](int c,
+                    std::vector<Eigen::Vector6d,
+                                Eigen::aligned_allocator<Eigen::Vector6d>>&
+                            J_r,
+                    std::vector<double>& r, std::vector<double>& w) {
+                    const Eigen::Vector3d& p =
+                            point_cloud_vec[i].points_[corres[c].first];
+                    const Eigen::Vector3d& q =
+                            point_cloud_copy_j.points_[corres[c].second];
+                    Eigen::Vector3d rpq = p - q;
+                    double temp = par / (rpq.dot(rpq) + par);
+                    s[c] = temp * temp;
+
+                    J_r.resize(3);
+                    r.resize(3);
+                    w.assign(3, s[c]);
+                    J_r[0] << 0, -q(2), q(1), -1, 0, 0;
+                    J_r[1] << q(2), 0, -q(0), 0, -1, 0;
+                    J_r[2] << -q(1), q(0), 0, 0, 0, -1;
+                    r[0] = rpq(0);
+                    r[1] = rpq(1);
+                    r[2] = rpq(2);
+                };
+
+        Eigen::Matrix6d JTJ;
+        Eigen::Vector6d JTr;
+        double r2;
+        std::tie(JTJ, JTr, r2) =
+                utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+                        compute_jacobian_and_residual, int(corres.size()),
+                        false);
         bool success;
         Eigen::VectorXd result;
         std::tie(success, result) = utility::SolveLinearSystemPSD(-JTJ, JTr);
@@ -28,7 +28,7 @@
 
 #include <Eigen/Dense>
 
-#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/NeighborCache.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/utility/Logging.h"
 
@@ -72,36 +72,41 @@ static Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
 
 static std::shared_ptr<Feature> ComputeSPFHFeature(
         const geometry::PointCloud &input,
-        const geometry::KDTreeFlann &kdtree,
+        const geometry::NeighborCache &neighbor_cache,
         const geometry::KDTreeSearchParam &search_param) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        const auto &normal = input.normals_[i];
+#pragma omp parallel
+    {
         std::vector<int> indices;
         std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
-            // only compute SPFH feature when a point has neighbors
-            double hist_incr = 100.0 / (double)(indices.size() - 1);
-            for (size_t k = 1; k < indices.size(); k++) {
-                // skip the point itself, compute histogram
-                auto pf = ComputePairFeatures(point, normal,
-                                              input.points_[indices[k]],
-                                              input.normals_[indices[k]]);
-                int h_index = (int)(floor(11 * (pf(0) + M_PI) / (2.0 * M_PI)));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index, i) += hist_incr;
-                h_index = (int)(floor(11 * (pf(1) + 1.0) * 0.5));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 11, i) += hist_incr;
-                h_index = (int)(floor(11 * (pf(2) + 1.0) * 0.5));
-                if (h_index < 0) h_index = 0;
-                if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 22, i) += hist_incr;
+#pragma omp for schedule(static)
+        for (int i = 0; i < (int)input.points_.size(); i++) {
+            const auto &point = input.points_[i];
+            const auto &normal = input.normals_[i];
+            if (neighbor_cache.Search(i, search_param, indices, distance2) >
+                1) {
+                // only compute SPFH feature when a point has neighbors
+                double hist_incr = 100.0 / (double)(indices.size() - 1);
+                for (size_t k = 1; k < indices.size(); k++) {
+                    // skip the point itself, compute histogram
+                    auto pf = ComputePairFeatures(point, normal,
+                                                  input.points_[indices[k]],
+                                                  input.normals_[indices[k]]);
+                    int h_index =
+                            (int)(floor(11 * (pf(0) + M_PI) / (2.0 * M_PI)));
+                    if (h_index < 0) h_index = 0;
+                    if (h_index >= 11) h_index = 10;
+                    feature->data_(h_index, i) += hist_incr;
+                    h_index = (int)(floor(11 * (pf(1) + 1.0) * 0.5));
+                    if (h_index < 0) h_index = 0;
+                    if (h_index >= 11) h_index = 10;
+                    feature->data_(h_index + 11, i) += hist_incr;
+                    h_index = (int)(floor(11 * (pf(2) + 1.0) * 0.5));
+                    if (h_index < 0) h_index = 0;
+                    if (h_index >= 11) h_index = 10;
+                    feature->data_(h_index + 22, i) += hist_incr;
+                }
             }
         }
     }
@@ -112,6 +117,20 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeSearchParam
                 &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
+    if (!input.HasNormals()) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Failed because input point cloud has no "
+                "normal.");
+    }
+    // The SPFH and the FPFH share the neighbors of every point.
+    geometry::NeighborCache neighbor_cache(input, search_param);
+    return ComputeFPFHFeature(input, neighbor_cache, search_param);
+}
+
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::NeighborCache &neighbor_cache,
+        const geometry::KDTreeSearchParam &search_param) {
     auto feature = std::make_shared<Feature>();
     feature->Resize(33, (int)input.points_.size());
     if (!input.HasNormals()) {
@@ -119,39 +138,52 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
                 "[ComputeFPFHFeature] Failed because input point cloud has no "
                 "normal.");
     }
-    geometry::KDTreeFlann kdtree(input);
-    auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
+    if (neighbor_cache.NumQueries() != input.points_.size()) {
+        utility::LogError(
+                "[ComputeFPFHFeature] The neighbor cache has {} queries, but "
+                "the point cloud has {} points.",
+                neighbor_cache.NumQueries(), input.points_.size());
+    }
+    if (!neighbor_cache.Covers(search_param)) {
+        utility::LogError(
+                "[ComputeFPFHFeature] The search is not covered by the "
+                "neighbor cache.");
+    }
+    auto spfh = ComputeSPFHFeature(input, neighbor_cache, search_param);
     if (spfh == nullptr) {
         utility::LogError("Internal error: SPFH feature is nullptr.");
     }
-#pragma omp parallel for schedule(static)
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
+#pragma omp parallel
+    {
         std::vector<int> indices;
         std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
-            double sum[3] = {0.0, 0.0, 0.0};
-            for (size_t k = 1; k < indices.size(); k++) {
-                // skip the point itself
-                double dist = distance2[k];
-                if (dist == 0.0) continue;
+#pragma omp for schedule(static)
+        for (int i = 0; i < (int)input.points_.size(); i++) {
+            if (neighbor_cache.Search(i, search_param, indices, distance2) >
+                1) {
+                double sum[3] = {0.0, 0.0, 0.0};
+                for (size_t k = 1; k < indices.size(); k++) {
+                    // skip the point itself
+                    double dist = distance2[k];
+                    if (dist == 0.0) continue;
+                    for (int j = 0; j < 33; j++) {
+                        double val = spfh->data_(j, indices[k]) / dist;
+                        sum[j / 11] += val;
+                        feature->data_(j, i) += val;
+                    }
+                }
+                for (int j = 0; j < 3; j++)
+                    if (sum[j] != 0.0) sum[j] = 100.0 / sum[j];
                 for (int j = 0; j < 33; j++) {
-                    double val = spfh->data_(j, indices[k]) / dist;
-                    sum[j / 11] += val;
-                    feature->data_(j, i) += val;
+                    feature->data_(j, i) *= sum[j / 11];
+                    // The commented line is the fpfh function in the paper.
+                    // But according to PCL implementation, it is skipped.
+                    // Our initial test shows that the full fpfh function in the
+                    // paper seems to be better than PCL implementation. Further
+                    // test required.
+                    feature->data_(j, i) += spfh->data_(j, i);
                 }
             }
-            for (int j = 0; j < 3; j++)
-                if (sum[j] != 0.0) sum[j] = 100.0 / sum[j];
-            for (int j = 0; j < 33; j++) {
-                feature->data_(j, i) *= sum[j / 11];
-                // The commented line is the fpfh function in the paper.
-                // But according to PCL implementation, it is skipped.
-                // Our initial test shows that the full fpfh function in the
-                // paper seems to be better than PCL implementation. Further
-                // test required.
-                feature->data_(j, i) += spfh->data_(j, i);
-            }
         }
     }
     return feature;
@@ -35,6 +35,7 @@
 namespace open3d {
 
 namespace geometry {
+class NeighborCache;
 class PointCloud;
 }
 
@@ -73,6 +74,18 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::KDTreeSearchParam &search_param =
                 geometry::KDTreeSearchParamKNN());
 
+/// Function to compute FPFH feature for a point cloud from precomputed
+/// neighbors, which can be shared with other algorithms.
+///
+/// \param input The Input point cloud.
+/// \param neighbor_cache The neighbors of every point of the point cloud.
+/// \param search_param KDTree search parameter, which has to be covered by
+/// \p neighbor_cache.
+std::shared_ptr<Feature> ComputeFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::NeighborCache &neighbor_cache,
+        const geometry::KDTreeSearchParam &search_param);
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
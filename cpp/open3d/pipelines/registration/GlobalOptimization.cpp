@@ -28,6 +28,7 @@
 
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
+#include <algorithm>
 #include <tuple>
 #include <vector>
 
@@ -205,16 +206,25 @@ static Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 /// Eq (20) and Eq (21). (There is a typo in the equation though. B should be J)
 ///
 /// This function focuses the case that every edge has two nodes (not hyper
-/// graph) so we have two Jacobian matrices from one constraint.
-static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
-        const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
+/// graph) so we have two Jacobian matrices from one constraint. H is sparse
+/// with one 6x6 block per node and per direction of each edge, so it is
+/// assembled from per edge blocks computed in parallel.
+///
+/// Nodes flagged in \p is_fixed are held constant: their rows and columns are
+/// replaced by the identity and their right term by zero, so that their
+/// increment is zero. An empty \p is_fixed optimizes all nodes.
+static std::tuple<Eigen::SparseMatrix<double>, Eigen::VectorXd>
+ComputeLinearSystem(const PoseGraph &pose_graph,
+                    const Eigen::VectorXd &zeta,
+                    const std::vector<bool> &is_fixed = {}) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
-    Eigen::MatrixXd H(n_nodes * 6, n_nodes * 6);
-    Eigen::VectorXd b(n_nodes * 6);
-    H.setZero();
-    b.setZero();
+    std::vector<Eigen::Triplet<double>> triplets(n_edges * 4 * 36 +
+                                                 n_nodes * 6);
+    std::vector<Eigen::Vector6d, Eigen::aligned_allocator<Eigen::Vector6d>>
+            b_s(n_edges), b_t(n_edges);
 
+#pragma omp parallel for schedule(static)
     for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
         const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
         Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
@@ -231,22 +241,80 @@ static std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
 
         int id_i = t.source_node_id_ * 6;
         int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
-                line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
-                line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
-                line_process_iter * JtT_Info * Jt;
-        b.block<6, 1>(id_i, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Js;
-        b.block<6, 1>(id_j, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Jt;
+        if (!is_fixed.empty()) {
+            if (is_fixed[t.source_node_id_]) {
+                JsT_Info.setZero();
+                Js.setZero();
+            }
+            if (is_fixed[t.target_node_id_]) {
+                JtT_Info.setZero();
+                Jt.setZero();
+            }
+        }
+        const Eigen::Matrix6d blocks[4] = {
+                line_process_iter * JsT_Info * Js,
+                line_process_iter * JsT_Info * Jt,
+                line_process_iter * JtT_Info * Js,
+                line_process_iter * JtT_Info * Jt};
+        const int rows[4] = {id_i, id_i, id_j, id_j};
+        const int cols[4] = {id_i, id_j, id_i, id_j};
+        int k = iter_edge * 4 * 36;
+        for (int block = 0; block < 4; block++) {
+            for (int r = 0; r < 6; r++) {
+                for (int c = 0; c < 6; c++) {
+                    triplets[k++] = Eigen::Triplet<double>(
+                            rows[block] + r, cols[block] + c,
+                            blocks[block](r, c));
+                }
+            }
+        }
+        b_s[iter_edge] = -line_process_iter * Js.transpose() * eT_Info;
+        b_t[iter_edge] = -line_process_iter * Jt.transpose() * eT_Info;
+    }
+    // Explicit zeros keep the diagonal structurally present, so that damping
+    // can be added to every node.
+    for (int i = 0; i < n_nodes * 6; i++) {
+        bool fixed = !is_fixed.empty() && is_fixed[i / 6];
+        triplets[n_edges * 4 * 36 + i] =
+                Eigen::Triplet<double>(i, i, fixed ? 1.0 : 0.0);
+    }
+
+    Eigen::SparseMatrix<double> H(n_nodes * 6, n_nodes * 6);
+    H.setFromTriplets(triplets.begin(), triplets.end());
+    Eigen::VectorXd b(n_nodes * 6);
+    b.setZero();
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        b.block<6, 1>(t.source_node_id_ * 6, 0) += b_s[iter_edge];
+        b.block<6, 1>(t.target_node_id_ * 6, 0) += b_t[iter_edge];
     }
     return std::make_tuple(std::move(H), std::move(b));
 }
 
+/// Solves H @ delta == b with a sparse LDLT factorization. Falls back to
+/// Jacobi preconditioned conjugate gradients if the factorization fails or H
+/// is rank deficient, e.g. when no pose is anchored in Gauss-Newton.
+static std::tuple<bool, Eigen::VectorXd> SolveLinearSystem(
+        const Eigen::SparseMatrix<double> &H, const Eigen::VectorXd &b) {
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> H_ldlt(H);
+    if (H_ldlt.info() == Eigen::Success &&
+        H_ldlt.vectorD().cwiseAbs().minCoeff() >
+                1e-10 * H_ldlt.vectorD().cwiseAbs().maxCoeff()) {
+        Eigen::VectorXd delta = H_ldlt.solve(b);
+        if (H_ldlt.info() == Eigen::Success) {
+            return std::make_tuple(true, std::move(delta));
+        }
+    }
+    utility::LogDebug(
+            "Sparse LDLT failed, switched to preconditioned conjugate "
+            "gradients");
+    Eigen::ConjugateGradient<Eigen::SparseMatrix<double>,
+                             Eigen::Lower | Eigen::Upper>
+            H_cg(H);
+    Eigen::VectorXd delta = H_cg.solve(b);
+    return std::make_tuple(H_cg.info() == Eigen::Success, std::move(delta));
+}
+
 static Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
     int n_nodes = (int)pose_graph.nodes_.size();
     Eigen::VectorXd output(n_nodes * 6);
@@ -388,39 +456,44 @@ static bool ValidatePoseGraphConnectivity(const PoseGraph &pose_graph,
     size_t n_nodes = pose_graph.nodes_.size();
     size_t n_edges = pose_graph.edges_.size();
 
+    // Adjacency lists keep the traversal linear in the size of the graph, as
+    // it runs on every call of the incremental optimization.
+    std::vector<std::vector<int>> adjacency(n_nodes);
+    for (size_t j = 0; j < n_edges; j++) {
+        const PoseGraphEdge &t = pose_graph.edges_[j];
+        if (ignore_uncertain_edges && t.uncertain_) {
+            continue;
+        }
+        if (t.source_node_id_ < 0 || t.source_node_id_ >= int(n_nodes) ||
+            t.target_node_id_ < 0 || t.target_node_id_ >= int(n_nodes)) {
+            continue;
+        }
+        adjacency[t.source_node_id_].push_back(t.target_node_id_);
+        adjacency[t.target_node_id_].push_back(t.source_node_id_);
+    }
+
     // Test if the connected component containing the first node is the entire
     // graph
     std::vector<int> nodes_to_explore{};
-    std::vector<int> component{};
+    std::vector<bool> visited(n_nodes, false);
+    size_t component_size = 0;
     if (n_nodes > 0) {
         nodes_to_explore.push_back(0);
-        component.push_back(0);
+        visited[0] = true;
+        component_size++;
     }
     while (!nodes_to_explore.empty()) {
         int i = nodes_to_explore.back();
         nodes_to_explore.pop_back();
-        for (size_t j = 0; j < n_edges; j++) {
-            const PoseGraphEdge &t = pose_graph.edges_[j];
-            if (ignore_uncertain_edges && t.uncertain_) {
-                continue;
-            }
-            int adjacent_node{-1};
-            if (t.source_node_id_ == i) {
-                adjacent_node = t.target_node_id_;
-            } else if (t.target_node_id_ == i) {
-                adjacent_node = t.source_node_id_;
-            }
-            if (adjacent_node != -1) {
-                auto find_result = std::find(component.begin(), component.end(),
-                                             adjacent_node);
-                if (find_result == component.end()) {
-                    nodes_to_explore.push_back(adjacent_node);
-                    component.push_back(adjacent_node);
-                }
+        for (int adjacent_node : adjacency[i]) {
+            if (!visited[adjacent_node]) {
+                visited[adjacent_node] = true;
+                nodes_to_explore.push_back(adjacent_node);
+                component_size++;
             }
         }
     }
-    return component.size() == n_nodes;
+    return component_size == n_nodes;
 }
 
 static bool ValidatePoseGraph(const PoseGraph &pose_graph) {
@@ -511,7 +584,7 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
     valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
@@ -532,10 +605,8 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         Eigen::VectorXd delta(H.cols());
         bool solver_success = false;
 
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        // Solve H @ delta == b using a sparse solver
+        std::tie(solver_success, delta) = SolveLinearSystem(H, b);
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
@@ -579,13 +650,16 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
             timer_overall.GetDuration() / 1000.0);
 }
 
-void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
+/// Levenberg-Marquardt iterations on \p pose_graph, keeping the nodes flagged
+/// in \p is_fixed constant. See ComputeLinearSystem().
+static void OptimizePoseGraphLevenbergMarquardt(
         PoseGraph &pose_graph,
         const GlobalOptimizationConvergenceCriteria &criteria,
-        const GlobalOptimizationOption &option) const {
+        const GlobalOptimizationOption &option,
+        double line_process_weight,
+        const std::vector<bool> &is_fixed) {
     int n_nodes = (int)pose_graph.nodes_.size();
     int n_edges = (int)pose_graph.edges_.size();
-    double line_process_weight = ComputeLineProcessWeight(pose_graph, option);
 
     utility::LogDebug(
             "[GlobalOptimizationLM] Optimizing PoseGraph having {:d} nodes and "
@@ -602,12 +676,13 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     int valid_edges_num =
             UpdateConfidence(pose_graph, zeta, line_process_weight, option);
 
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
+    Eigen::SparseMatrix<double> H_I(n_nodes * 6, n_nodes * 6);
+    H_I.setIdentity();
+    Eigen::SparseMatrix<double> H;
     Eigen::VectorXd b;
     Eigen::VectorXd x = UpdatePoseVector(pose_graph);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta, is_fixed);
 
     Eigen::VectorXd H_diag = H.diagonal();
     double tau = 1e-5;
@@ -629,14 +704,12 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
+            Eigen::SparseMatrix<double> H_LM = H + current_lambda * H_I;
             Eigen::VectorXd delta(H_LM.cols());
             bool solver_success = false;
 
             // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            std::tie(solver_success, delta) = SolveLinearSystem(H_LM, b);
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
@@ -667,7 +740,8 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                     x = UpdatePoseVector(pose_graph);
                     valid_edges_num = UpdateConfidence(
                             pose_graph, zeta, line_process_weight, option);
-                    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+                    std::tie(H, b) =
+                            ComputeLinearSystem(pose_graph, zeta, is_fixed);
 
                     stop = stop || CheckRightTerm(b, criteria);
                     if (stop) break;
@@ -696,6 +770,78 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                       timer_overall.GetDuration() / 1000.0);
 }
 
+void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
+        PoseGraph &pose_graph,
+        const GlobalOptimizationConvergenceCriteria &criteria,
+        const GlobalOptimizationOption &option) const {
+    OptimizePoseGraphLevenbergMarquardt(
+            pose_graph, criteria, option,
+            ComputeLineProcessWeight(pose_graph, option), {});
+}
+
+void GlobalOptimizationSlidingWindow::OptimizePoseGraph(
+        PoseGraph &pose_graph,
+        const GlobalOptimizationConvergenceCriteria &criteria,
+        const GlobalOptimizationOption &option) const {
+    int n_nodes = (int)pose_graph.nodes_.size();
+    int n_edges = (int)pose_graph.edges_.size();
+    int first_active = std::max(0, n_nodes - window_size_);
+
+    // The window holds the newest nodes, every edge incident to them, and the
+    // older end nodes of those edges, which are held constant.
+    PoseGraph window;
+    std::vector<int> window_node_ids(n_nodes, -1);
+    std::vector<int> node_ids, edge_ids;
+    std::vector<bool> is_fixed;
+    auto add_node = [&](int node_id) {
+        if (window_node_ids[node_id] < 0) {
+            window_node_ids[node_id] = int(node_ids.size());
+            node_ids.push_back(node_id);
+            is_fixed.push_back(node_id < first_active);
+            window.nodes_.push_back(pose_graph.nodes_[node_id]);
+        }
+        return window_node_ids[node_id];
+    };
+    for (int i = first_active; i < n_nodes; i++) {
+        add_node(i);
+    }
+    for (int j = 0; j < n_edges; j++) {
+        PoseGraphEdge t = pose_graph.edges_[j];
+        if (t.source_node_id_ < first_active &&
+            t.target_node_id_ < first_active) {
+            continue;
+        }
+        t.source_node_id_ = add_node(t.source_node_id_);
+        t.target_node_id_ = add_node(t.target_node_id_);
+        window.edges_.push_back(t);
+        edge_ids.push_back(j);
+    }
+    utility::LogDebug(
+            "[GlobalOptimizationSlidingWindow] Optimizing {:d} of {:d} nodes "
+            "with {:d} fixed nodes.",
+            n_nodes - first_active, n_nodes,
+            int(node_ids.size()) - (n_nodes - first_active));
+
+    // Without fixed nodes the window is the whole graph, which keeps its gauge
+    // freedom as in GlobalOptimizationLevenbergMarquardt.
+    bool has_fixed_node =
+            std::find(is_fixed.begin(), is_fixed.end(), true) != is_fixed.end();
+    OptimizePoseGraphLevenbergMarquardt(
+            window, criteria, option,
+            ComputeLineProcessWeight(pose_graph, option),
+            has_fixed_node ? is_fixed : std::vector<bool>());
+
+    for (int k = 0; k < int(node_ids.size()); k++) {
+        if (!is_fixed[k]) {
+            pose_graph.nodes_[node_ids[k]].pose_ = window.nodes_[k].pose_;
+        }
+    }
+    for (int k = 0; k < int(edge_ids.size()); k++) {
+        pose_graph.edges_[edge_ids[k]].confidence_ =
+                window.edges_[k].confidence_;
+    }
+}
+
 void GlobalOptimization(PoseGraph &pose_graph,
                         const GlobalOptimizationMethod &method
                         /* = GlobalOptimizationLevenbergMarquardt() */,
@@ -96,6 +96,35 @@ public:
             const GlobalOptimizationOption &option) const override;
 };
 
+/// \class GlobalOptimizationSlidingWindow
+///
+/// \brief Incremental global optimization for online mapping.
+///
+/// Only the newest nodes of the PoseGraph are optimized, with the
+/// Levenberg-Marquardt algorithm warm started from their current poses. Older
+/// nodes connected to them by an edge are held constant, and the remaining
+/// nodes and edges are left untouched, so the cost of an update depends on the
+/// window size instead of the size of the graph.
+class GlobalOptimizationSlidingWindow : public GlobalOptimizationMethod {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param window_size Number of the newest nodes to optimize.
+    explicit GlobalOptimizationSlidingWindow(int window_size = 20)
+        : window_size_(window_size) {}
+    ~GlobalOptimizationSlidingWindow() override {}
+
+public:
+    void OptimizePoseGraph(
+            PoseGraph &pose_graph,
+            const GlobalOptimizationConvergenceCriteria &criteria,
+            const GlobalOptimizationOption &option) const override;
+
+public:
+    /// Number of the newest nodes to optimize.
+    int window_size_;
+};
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
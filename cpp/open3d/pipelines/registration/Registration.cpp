@@ -26,6 +26,11 @@
 
 #include "open3d/pipelines/registration/Registration.h"
 
+#include <cstring>
+
+#include "open3d/core/Profiler.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/Feature.h"
@@ -86,6 +91,8 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
     return result;
 }
 
+/// Evaluates \p transformation on the correspondences \p corres, transforming
+/// only the corresponding source points instead of a copy of \p source.
 static RegistrationResult EvaluateRANSACBasedOnCorrespondence(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -96,9 +103,11 @@ static RegistrationResult EvaluateRANSACBasedOnCorrespondence(
     double error2 = 0.0;
     int good = 0;
     double max_dis2 = max_correspondence_distance * max_correspondence_distance;
+    const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
     for (const auto &c : corres) {
-        double dis2 =
-                (source.points_[c[0]] - target.points_[c[1]]).squaredNorm();
+        double dis2 = (R * source.points_[c[0]] + t - target.points_[c[1]])
+                              .squaredNorm();
         if (dis2 < max_dis2) {
             good++;
             error2 += dis2;
@@ -131,15 +140,60 @@ RegistrationResult EvaluateRegistration(
             pcd, target, kdtree, max_correspondence_distance, transformation);
 }
 
-RegistrationResult RegistrationICP(
+static Eigen::Matrix6d GetInformationMatrixWithKDTree(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
         double max_correspondence_distance,
-        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
-        const TransformationEstimation &estimation
-        /* = TransformationEstimationPointToPoint(false)*/,
-        const ICPConvergenceCriteria
-                &criteria /* = ICPConvergenceCriteria()*/) {
+        const Eigen::Matrix4d &transformation) {
+    geometry::PointCloud pcd = source;
+    if (!transformation.isIdentity()) {
+        pcd.Transform(transformation);
+    }
+    RegistrationResult result;
+    result = GetRegistrationResultAndCorrespondences(
+            pcd, target, target_kdtree, max_correspondence_distance,
+            transformation);
+
+    // write q^*
+    // see http://redwood-data.org/indoor/registration.html
+    // note: I comes first in this implementation
+    Eigen::Matrix6d GTG = Eigen::Matrix6d::Zero();
+#pragma omp parallel
+    {
+        Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Zero();
+        Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
+#pragma omp for nowait
+        for (int c = 0; c < int(result.correspondence_set_.size()); c++) {
+            int t = result.correspondence_set_[c](1);
+            double x = target.points_[t](0);
+            double y = target.points_[t](1);
+            double z = target.points_[t](2);
+            G_r_private.setZero();
+            G_r_private(1) = z;
+            G_r_private(2) = -y;
+            G_r_private(3) = 1.0;
+            GTG_private.noalias() += G_r_private * G_r_private.transpose();
+            G_r_private.setZero();
+            G_r_private(0) = -z;
+            G_r_private(2) = x;
+            G_r_private(4) = 1.0;
+            GTG_private.noalias() += G_r_private * G_r_private.transpose();
+            G_r_private.setZero();
+            G_r_private(0) = y;
+            G_r_private(1) = -x;
+            G_r_private(5) = 1.0;
+            GTG_private.noalias() += G_r_private * G_r_private.transpose();
+        }
+#pragma omp critical(GetInformationMatrixFromPointClouds)
+        { GTG += GTG_private; }
+    }
+    return GTG;
+}
+
+static void AssertICPInputs(const geometry::PointCloud &target,
+                            double max_correspondence_distance,
+                            const TransformationEstimation &estimation) {
     if (max_correspondence_distance <= 0.0) {
         utility::LogError("Invalid max_correspondence_distance.");
     }
@@ -153,10 +207,18 @@ RegistrationResult RegistrationICP(
                 "TransformationEstimationColoredICP "
                 "require pre-computed normal vectors for target PointCloud.");
     }
+}
 
+static RegistrationResult RegistrationICPWithKDTree(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &kdtree,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init,
+        const TransformationEstimation &estimation,
+        const ICPConvergenceCriteria &criteria) {
+    OPEN3D_PROFILE_SCOPE("RegistrationICP");
     Eigen::Matrix4d transformation = init;
-    geometry::KDTreeFlann kdtree;
-    kdtree.SetGeometry(target);
     geometry::PointCloud pcd = source;
     if (!init.isIdentity()) {
         pcd.Transform(init);
@@ -186,6 +248,89 @@ RegistrationResult RegistrationICP(
     return result;
 }
 
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    AssertICPInputs(target, max_correspondence_distance, estimation);
+    geometry::KDTreeFlann kdtree;
+    kdtree.SetGeometry(target);
+    return RegistrationICPWithKDTree(source, target, kdtree,
+                                     max_correspondence_distance, init,
+                                     estimation, criteria);
+}
+
+std::tuple<std::vector<RegistrationResult>,
+           std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator>>
+RegistrationICPBatch(
+        const std::vector<geometry::PointCloud> &point_clouds,
+        const std::vector<std::pair<int, int>> &pairs,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> &inits,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    const int num_clouds = int(point_clouds.size());
+    const int num_pairs = int(pairs.size());
+    if (int(inits.size()) != num_pairs) {
+        utility::LogError(
+                "Expected one initial transformation per pair, but got {} "
+                "transformations for {} pairs.",
+                inits.size(), num_pairs);
+    }
+    // Inputs are validated up front, as errors cannot leave the parallel
+    // region below.
+    std::vector<bool> is_target(num_clouds, false);
+    for (const auto &pair : pairs) {
+        if (pair.first < 0 || pair.first >= num_clouds || pair.second < 0 ||
+            pair.second >= num_clouds) {
+            utility::LogError("Invalid pair ({}, {}) for {} point clouds.",
+                              pair.first, pair.second, num_clouds);
+        }
+        if (!is_target[pair.second]) {
+            AssertICPInputs(point_clouds[pair.second],
+                            max_correspondence_distance, estimation);
+            is_target[pair.second] = true;
+        }
+    }
+
+    // Each target KD-tree is built once and shared by all its pairs.
+    std::vector<int> targets;
+    for (int i = 0; i < num_clouds; i++) {
+        if (is_target[i]) targets.push_back(i);
+    }
+    std::vector<geometry::KDTreeFlann> kdtrees(num_clouds);
+#pragma omp parallel for schedule(dynamic)
+    for (int k = 0; k < int(targets.size()); k++) {
+        kdtrees[targets[k]].SetGeometry(point_clouds[targets[k]]);
+    }
+
+    // Pairs are dynamically scheduled one per thread, and the parallel loops
+    // nested in a pair run on that thread only.
+    std::vector<RegistrationResult> results(num_pairs);
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> information(
+            num_pairs);
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < num_pairs; i++) {
+        const geometry::PointCloud &source = point_clouds[pairs[i].first];
+        const geometry::PointCloud &target = point_clouds[pairs[i].second];
+        const geometry::KDTreeFlann &kdtree = kdtrees[pairs[i].second];
+        results[i] = RegistrationICPWithKDTree(
+                source, target, kdtree, max_correspondence_distance, inits[i],
+                estimation, criteria);
+        information[i] = GetInformationMatrixWithKDTree(
+                source, target, kdtree, max_correspondence_distance,
+                results[i].transformation_);
+    }
+    return std::make_tuple(std::move(results), std::move(information));
+}
+
 RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -206,40 +351,32 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
     RegistrationResult best_result;
     int exit_itr = -1;
 
+    // Each thread estimates hypotheses in small batches, that are checked by
+    // one CheckBatch() call per checker before the surviving ones are
+    // evaluated.
+    const int batch_size = 16;
+
 #pragma omp parallel
     {
-        CorrespondenceSet ransac_corres(ransac_n);
+        std::vector<CorrespondenceSet> batch_corres;
+        std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                batch_transformations;
+        std::vector<bool> batch_valid;
         RegistrationResult best_result_local;
         int exit_itr_local = criteria.max_iteration_;
 
-#pragma omp for nowait
-        for (int itr = 0; itr < criteria.max_iteration_; itr++) {
-            if (itr < exit_itr_local) {
-                for (int j = 0; j < ransac_n; j++) {
-                    ransac_corres[j] = corres[utility::UniformRandInt(
-                            0, static_cast<int>(corres.size()) - 1)];
-                }
-
-                Eigen::Matrix4d transformation =
-                        estimation.ComputeTransformation(source, target,
-                                                         ransac_corres);
-
-                // Check transformation: inexpensive
-                bool check = true;
-                for (const auto &checker : checkers) {
-                    if (!checker.get().Check(source, target, ransac_corres,
-                                             transformation)) {
-                        check = false;
-                        break;
-                    }
-                }
-                if (!check) continue;
-
-                geometry::PointCloud pcd = source;
-                pcd.Transform(transformation);
+        auto evaluate_batch = [&]() {
+            batch_valid.assign(batch_corres.size(), true);
+            // Check transformation: inexpensive
+            for (const auto &checker : checkers) {
+                checker.get().CheckBatch(source, target, batch_corres,
+                                         batch_transformations, batch_valid);
+            }
+            for (size_t k = 0; k < batch_corres.size(); k++) {
+                if (!batch_valid[k]) continue;
                 auto result = EvaluateRANSACBasedOnCorrespondence(
-                        pcd, target, corres, max_correspondence_distance,
-                        transformation);
+                        source, target, corres, max_correspondence_distance,
+                        batch_transformations[k]);
 
                 if (result.IsBetterRANSACThan(best_result_local)) {
                     best_result_local = result;
@@ -253,8 +390,30 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
                                     ? static_cast<int>(std::ceil(exit_itr_d))
                                     : exit_itr_local;
                 }
+            }
+            batch_corres.clear();
+            batch_transformations.clear();
+        };
+
+#pragma omp for nowait
+        for (int itr = 0; itr < criteria.max_iteration_; itr++) {
+            if (itr < exit_itr_local) {
+                CorrespondenceSet ransac_corres(ransac_n);
+                for (int j = 0; j < ransac_n; j++) {
+                    ransac_corres[j] = corres[utility::UniformRandInt(
+                            0, static_cast<int>(corres.size()) - 1)];
+                }
+
+                batch_transformations.push_back(
+                        estimation.ComputeTransformation(source, target,
+                                                         ransac_corres));
+                batch_corres.push_back(std::move(ransac_corres));
+                if (int(batch_corres.size()) == batch_size) {
+                    evaluate_batch();
+                }
             }  // if < exit_itr_local
         }      // for loop
+        evaluate_batch();
 #pragma omp critical(RegistrationRANSACBasedOnCorrespondence)
         {
             if (best_result_local.IsBetterRANSACThan(best_result)) {
@@ -272,6 +431,50 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
     return best_result;
 }
 
+/// Runs RANSAC on the nearest feature correspondences \p corres_ij from
+/// source to target. If \p mutual_filter is set, only the pairs that are also
+/// in the target to source correspondences \p corres_ji are kept, unless too
+/// few remain.
+static RegistrationResult RegistrationRANSACBasedOnFeatureCorrespondences(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres_ij,
+        const CorrespondenceSet &corres_ji,
+        bool mutual_filter,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation,
+        int ransac_n,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers,
+        const RANSACConvergenceCriteria &criteria) {
+    if (mutual_filter) {
+        pipelines::registration::CorrespondenceSet corres_mutual;
+        for (const Eigen::Vector2i &corres : corres_ij) {
+            int i = corres(0);
+            int j = corres(1);
+            if (corres_ji[j](0) == i) {
+                corres_mutual.emplace_back(i, j);
+            }
+        }
+
+        // Empirically mutual correspondence set should not be too small
+        if (int(corres_mutual.size()) >= ransac_n * 3) {
+            utility::LogDebug("{:d} correspondences remain after mutual filter",
+                              corres_mutual.size());
+            return RegistrationRANSACBasedOnCorrespondence(
+                    source, target, corres_mutual, max_correspondence_distance,
+                    estimation, ransac_n, checkers, criteria);
+        }
+        utility::LogDebug(
+                "Too few correspondences after mutual filter, fall back to "
+                "original correspondences.");
+    }
+
+    return RegistrationRANSACBasedOnCorrespondence(
+            source, target, corres_ij, max_correspondence_distance, estimation,
+            ransac_n, checkers, criteria);
+}
+
 RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -308,9 +511,10 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
     }
 
     // Do reverse check if mutual_filter is enabled
+    pipelines::registration::CorrespondenceSet corres_ji;
     if (mutual_filter) {
         geometry::KDTreeFlann kdtree_source(source_feature);
-        pipelines::registration::CorrespondenceSet corres_ji(num_tgt_pts);
+        corres_ji.resize(num_tgt_pts);
 
 #pragma omp parallel for
         for (int j = 0; j < num_tgt_pts; ++j) {
@@ -322,31 +526,84 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
             int i = corres_tmp[0];
             corres_ji[j] = Eigen::Vector2i(i, j);
         }
+    }
 
-        pipelines::registration::CorrespondenceSet corres_mutual;
-        for (int i = 0; i < num_src_pts; ++i) {
-            int j = corres_ij[i](1);
-            if (corres_ji[j](0) == i) {
-                corres_mutual.emplace_back(i, j);
-            }
-        }
+    return RegistrationRANSACBasedOnFeatureCorrespondences(
+            source, target, corres_ij, corres_ji, mutual_filter,
+            max_correspondence_distance, estimation, ransac_n, checkers,
+            criteria);
+}
 
-        // Empirically mutual correspondence set should not be too small
-        if (int(corres_mutual.size()) >= ransac_n * 3) {
-            utility::LogDebug("{:d} correspondences remain after mutual filter",
-                              corres_mutual.size());
-            return RegistrationRANSACBasedOnCorrespondence(
-                    source, target, corres_mutual, max_correspondence_distance,
-                    estimation, ransac_n, checkers, criteria);
-        }
-        utility::LogDebug(
-                "Too few correspondences after mutual filter, fall back to "
-                "original correspondences.");
+/// Returns the {n, dimension} Float32 tensor of the n features.
+static core::Tensor FeatureToTensor(const Feature &feature) {
+    // Column-major {dimension, n} data is row-major {n, dimension}.
+    core::Tensor features(
+            {int64_t(feature.Num()), int64_t(feature.Dimension())},
+            core::Dtype::Float64);
+    std::memcpy(features.GetDataPtr(), feature.data_.data(),
+                feature.data_.size() * sizeof(double));
+    return features.To(core::Dtype::Float32);
+}
+
+/// Matches each query feature to its approximately nearest dataset feature.
+/// If \p query_is_source, the correspondences are (query, dataset) pairs,
+/// otherwise (dataset, query) pairs.
+static CorrespondenceSet ApproximateFeatureMatches(
+        const core::Tensor &query_features,
+        const core::Tensor &dataset_features,
+        const core::nns::ApproximateKnnParams &knn_params,
+        bool query_is_source) {
+    core::nns::NearestNeighborSearch nns(dataset_features);
+    nns.ApproximateKnnIndex(knn_params);
+    const core::Tensor indices = nns.KnnSearch(query_features, 1).first;
+    const std::vector<int64_t> nearest = indices.ToFlatVector<int64_t>();
+    CorrespondenceSet corres(nearest.size());
+    for (size_t k = 0; k < nearest.size(); ++k) {
+        // A query whose search found no neighbor is matched to the first
+        // dataset feature, which RANSAC treats as an outlier.
+        const int match = nearest[k] < 0 ? 0 : int(nearest[k]);
+        corres[k] = query_is_source ? Eigen::Vector2i(int(k), match)
+                                    : Eigen::Vector2i(match, int(k));
     }
+    return corres;
+}
 
-    return RegistrationRANSACBasedOnCorrespondence(
-            source, target, corres_ij, max_correspondence_distance, estimation,
-            ransac_n, checkers, criteria);
+RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const Feature &source_feature,
+        const Feature &target_feature,
+        bool mutual_filter,
+        double max_correspondence_distance,
+        const core::nns::ApproximateKnnParams &knn_params,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        int ransac_n /* = 3*/,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers /* = {}*/,
+        const RANSACConvergenceCriteria &criteria
+        /* = RANSACConvergenceCriteria()*/) {
+    if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
+        return RegistrationResult();
+    }
+    if (source_feature.Num() == 0 || target_feature.Num() == 0) {
+        return RegistrationResult();
+    }
+
+    const core::Tensor source_features = FeatureToTensor(source_feature);
+    const core::Tensor target_features = FeatureToTensor(target_feature);
+    const CorrespondenceSet corres_ij = ApproximateFeatureMatches(
+            source_features, target_features, knn_params, true);
+    CorrespondenceSet corres_ji;
+    if (mutual_filter) {
+        corres_ji = ApproximateFeatureMatches(
+                target_features, source_features, knn_params, false);
+    }
+
+    return RegistrationRANSACBasedOnFeatureCorrespondences(
+            source, target, corres_ij, corres_ji, mutual_filter,
+            max_correspondence_distance, estimation, ransac_n, checkers,
+            criteria);
 }
 
 Eigen::Matrix6d GetInformationMatrixFromPointClouds(
@@ -354,50 +611,10 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
         const geometry::PointCloud &target,
         double max_correspondence_distance,
         const Eigen::Matrix4d &transformation) {
-    geometry::PointCloud pcd = source;
-    if (!transformation.isIdentity()) {
-        pcd.Transform(transformation);
-    }
-    RegistrationResult result;
     geometry::KDTreeFlann target_kdtree(target);
-    result = GetRegistrationResultAndCorrespondences(
-            pcd, target, target_kdtree, max_correspondence_distance,
-            transformation);
-
-    // write q^*
-    // see http://redwood-data.org/indoor/registration.html
-    // note: I comes first in this implementation
-    Eigen::Matrix6d GTG = Eigen::Matrix6d::Zero();
-#pragma omp parallel
-    {
-        Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Zero();
-        Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
-#pragma omp for nowait
-        for (int c = 0; c < int(result.correspondence_set_.size()); c++) {
-            int t = result.correspondence_set_[c](1);
-            double x = target.points_[t](0);
-            double y = target.points_[t](1);
-            double z = target.points_[t](2);
-            G_r_private.setZero();
-            G_r_private(1) = z;
-            G_r_private(2) = -y;
-            G_r_private(3) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = -z;
-            G_r_private(2) = x;
-            G_r_private(4) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = y;
-            G_r_private(1) = -x;
-            G_r_private(5) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-        }
-#pragma omp critical(GetInformationMatrixFromPointClouds)
-        { GTG += GTG_private; }
-    }
-    return GTG;
+    return GetInformationMatrixWithKDTree(source, target, target_kdtree,
+                                          max_correspondence_distance,
+                                          transformation);
 }
 
 }  // namespace registration
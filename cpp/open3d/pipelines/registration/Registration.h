@@ -28,6 +28,7 @@
 
 #include <Eigen/Core>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "open3d/pipelines/registration/CorrespondenceChecker.h"
@@ -36,6 +37,12 @@
 
 namespace open3d {
 
+namespace core {
+namespace nns {
+struct ApproximateKnnParams;
+}
+}  // namespace core
+
 namespace geometry {
 class PointCloud;
 }
@@ -173,6 +180,32 @@ RegistrationResult RegistrationICP(
                 TransformationEstimationPointToPoint(false),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// \brief Function for ICP registration of a batch of point cloud pairs.
+///
+/// The pairs are registered in parallel, one pair per thread, and the KD-tree
+/// of each target point cloud is built once and shared by all pairs
+/// registered to it. The information matrix of each pair is computed from its
+/// final transformation, as in GetInformationMatrixFromPointClouds().
+///
+/// \param point_clouds The point clouds referenced by \p pairs.
+/// \param pairs (source, target) indices into \p point_clouds.
+/// \param inits Initial transformation estimation of each pair.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+/// \return The registration result and the information matrix of each pair.
+std::tuple<std::vector<RegistrationResult>,
+           std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator>>
+RegistrationICPBatch(
+        const std::vector<geometry::PointCloud> &point_clouds,
+        const std::vector<std::pair<int, int>> &pairs,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> &inits,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
 /// \brief Function for global RANSAC registration based on a given set of
 /// correspondences.
 ///
@@ -226,6 +259,33 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const RANSACConvergenceCriteria &criteria =
                 RANSACConvergenceCriteria());
 
+/// \brief Function for global RANSAC registration based on feature matching,
+/// finding the nearest features with an approximate index.
+///
+/// Same as the overload above, except that the features are matched with
+/// core::nns::NearestNeighborSearch::ApproximateKnnIndex(), which scales to
+/// large sets of high dimensional features at the cost of occasionally
+/// missing the exact nearest feature. The features are matched in single
+/// precision.
+///
+/// \param knn_params Type and recall/speed parameters of the approximate
+/// index.
+RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const Feature &source_feature,
+        const Feature &target_feature,
+        bool mutual_filter,
+        double max_correspondence_distance,
+        const core::nns::ApproximateKnnParams &knn_params,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        int ransac_n = 3,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers = {},
+        const RANSACConvergenceCriteria &criteria =
+                RANSACConvergenceCriteria());
+
 /// \param source The source point cloud.
 /// \param target The target point cloud.
 /// \param max_correspondence_distance Maximum correspondence points-pair
@@ -35,12 +35,33 @@
 
 namespace {
 double inline square(double x) { return x * x; }
+
+/// Weights of a batch of residuals, with a non-virtual call to the Weight()
+/// of \p Kernel that can be inlined.
+template <typename Kernel>
+void ComputeWeights(const Kernel &kernel,
+                    const std::vector<double> &residuals,
+                    std::vector<double> &weights) {
+    weights.resize(residuals.size());
+#pragma omp parallel for schedule(static) if (residuals.size() > 100000)
+    for (int i = 0; i < int(residuals.size()); i++) {
+        weights[i] = kernel.Kernel::Weight(residuals[i]);
+    }
+}
 }  // namespace
 
 namespace open3d {
 namespace pipelines {
 namespace registration {
 
+void RobustKernel::Weights(const std::vector<double> &residuals,
+                           std::vector<double> &weights) const {
+    weights.resize(residuals.size());
+    for (size_t i = 0; i < residuals.size(); i++) {
+        weights[i] = Weight(residuals[i]);
+    }
+}
+
 double L2Loss::Weight(double /*residual*/) const { return 1.0; }
 
 double L1Loss::Weight(double residual) const {
@@ -65,6 +86,36 @@ double TukeyLoss::Weight(double residual) const {
     return square(1.0 - square(std::min(1.0, e / k_)));
 }
 
+void L2Loss::Weights(const std::vector<double> &residuals,
+                     std::vector<double> &weights) const {
+    ComputeWeights(*this, residuals, weights);
+}
+
+void L1Loss::Weights(const std::vector<double> &residuals,
+                     std::vector<double> &weights) const {
+    ComputeWeights(*this, residuals, weights);
+}
+
+void HuberLoss::Weights(const std::vector<double> &residuals,
+                        std::vector<double> &weights) const {
+    ComputeWeights(*this, residuals, weights);
+}
+
+void CauchyLoss::Weights(const std::vector<double> &residuals,
+                         std::vector<double> &weights) const {
+    ComputeWeights(*this, residuals, weights);
+}
+
+void GMLoss::Weights(const std::vector<double> &residuals,
+                     std::vector<double> &weights) const {
+    ComputeWeights(*this, residuals, weights);
+}
+
+void TukeyLoss::Weights(const std::vector<double> &residuals,
+                        std::vector<double> &weights) const {
+    ComputeWeights(*this, residuals, weights);
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include <vector>
+
 namespace open3d {
 namespace pipelines {
 namespace registration {
@@ -68,6 +70,15 @@ public:
     ///
     /// \param residual Residual value obtained during the optimization step.
     virtual double Weight(double residual) const = 0;
+
+    /// Obtain the weights for a batch of residuals, as computed by Weight().
+    /// The built-in kernels override this method with a loop that does not
+    /// dispatch virtually per residual.
+    ///
+    /// \param residuals Residual values obtained during the optimization step.
+    /// \param weights Output weights, resized to the number of residuals.
+    virtual void Weights(const std::vector<double> &residuals,
+                         std::vector<double> &weights) const;
 };
 
 /// \class L2Loss
@@ -83,6 +94,8 @@ public:
     ///
     /// \param residual [ingored]
     double Weight(double residual) const override;
+    void Weights(const std::vector<double> &residuals,
+                 std::vector<double> &weights) const override;
 };
 
 /// \class L1Loss
@@ -98,6 +111,8 @@ public:
     ///
     /// \param residual Residual value obtained during the optimization step.
     double Weight(double residual) const override;
+    void Weights(const std::vector<double> &residuals,
+                 std::vector<double> &weights) const override;
 };
 
 /// \class HuberLoss
@@ -125,6 +140,8 @@ public:
     ///
     /// \param residual Residual value obtained during the optimization step.
     double Weight(double residual) const override;
+    void Weights(const std::vector<double> &residuals,
+                 std::vector<double> &weights) const override;
 
 public:
     /// Scaling paramter.
@@ -150,6 +167,8 @@ public:
     ///
     /// \param residual Residual value obtained during the optimization step.
     double Weight(double residual) const override;
+    void Weights(const std::vector<double> &residuals,
+                 std::vector<double> &weights) const override;
 
 public:
     /// Scaling paramter.
@@ -175,6 +194,8 @@ public:
     ///
     /// \param residual Residual value obtained during the optimization step.
     double Weight(double residual) const override;
+    void Weights(const std::vector<double> &residuals,
+                 std::vector<double> &weights) const override;
 
 public:
     /// Scaling paramter.
@@ -206,6 +227,8 @@ public:
     ///
     /// \param residual Residual value obtained during the optimization step.
     double Weight(double residual) const override;
+    void Weights(const std::vector<double> &residuals,
+                 std::vector<double> &weights) const override;
 
 public:
     double k_;
@@ -82,13 +82,23 @@ Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
     if (corres.empty() || !target.HasNormals())
         return Eigen::Matrix4d::Identity();
 
+    // The residuals are weighted in one batch, without a virtual call per
+    // correspondence.
+    std::vector<double> residuals(corres.size()), weights;
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < (int)corres.size(); i++) {
+        residuals[i] = (source.points_[corres[i][0]] -
+                        target.points_[corres[i][1]])
+                               .dot(target.normals_[corres[i][1]]);
+    }
+    kernel_->Weights(residuals, weights);
+
     auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d &J_r,
                                              double &r, double &w) {
         const Eigen::Vector3d &vs = source.points_[corres[i][0]];
-        const Eigen::Vector3d &vt = target.points_[corres[i][1]];
         const Eigen::Vector3d &nt = target.normals_[corres[i][1]];
-        r = (vs - vt).dot(nt);
-        w = kernel_->Weight(r);
+        r = residuals[i];
+        w = weights[i];
         J_r.block<3, 1>(0, 0) = vs.cross(nt);
         J_r.block<3, 1>(3, 0) = nt;
     };
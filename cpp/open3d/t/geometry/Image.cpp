@@ -26,6 +26,7 @@
 
 #include "open3d/t/geometry/Image.h"
 
+#include <cmath>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -483,6 +484,126 @@ Image Image::PyrDownDepth(float diff_threshold, float invalid_fill) const {
     return t::geometry::Image(dst_tensor);
 }
 
+// Checks that images is a (N, rows, cols, channels) image stack supported by
+// the batched operations and returns it as a contiguous tensor.
+static core::Tensor CheckImageBatch(const core::Tensor &images,
+                                    const std::string &op_name) {
+    static const dtype_channels_pairs supported{
+            {core::Dtype::UInt8, 1},   {core::Dtype::UInt16, 1},
+            {core::Dtype::Float32, 1}, {core::Dtype::UInt8, 3},
+            {core::Dtype::UInt16, 3},  {core::Dtype::Float32, 3},
+            {core::Dtype::UInt8, 4},   {core::Dtype::UInt16, 4},
+            {core::Dtype::Float32, 4},
+    };
+    if (images.NumDims() != 4) {
+        utility::LogError(
+                "{} expects a (N, rows, cols, channels) image stack, but got "
+                "shape {}.",
+                op_name, images.GetShape().ToString());
+    }
+    if (std::count(supported.begin(), supported.end(),
+                   std::make_pair(images.GetDtype(), images.GetShape(3))) ==
+        0) {
+        utility::LogError(
+                "{} with data type {} and {} channels is not implemented!",
+                op_name, images.GetDtype().ToString(), images.GetShape(3));
+    }
+    return images.Contiguous();
+}
+
+core::Tensor Image::RGBToGrayBatch(const core::Tensor &images) {
+    core::Tensor src = CheckImageBatch(images, "RGBToGrayBatch");
+    if (src.GetShape(3) != 3) {
+        utility::LogError(
+                "Input image channels must be 3 for RGBToGrayBatch, but got "
+                "{}.",
+                src.GetShape(3));
+    }
+    core::Tensor dst = core::Tensor::Empty(
+            {src.GetShape(0), src.GetShape(1), src.GetShape(2), 1},
+            src.GetDtype(), src.GetDevice());
+    kernel::image::RGBToGrayBatch(src, dst);
+    return dst;
+}
+
+core::Tensor Image::ResizeBatch(const core::Tensor &images,
+                                float sampling_rate,
+                                InterpType interp_type) {
+    core::Tensor src = CheckImageBatch(images, "ResizeBatch");
+    if (interp_type != InterpType::Nearest &&
+        interp_type != InterpType::Linear) {
+        utility::LogError(
+                "ResizeBatch only supports Nearest and Linear interpolation.");
+    }
+    if (sampling_rate == 1.0f) {
+        return images;
+    }
+
+    core::Tensor dst = core::Tensor::Empty(
+            {src.GetShape(0),
+             static_cast<int64_t>(src.GetShape(1) * sampling_rate),
+             static_cast<int64_t>(src.GetShape(2) * sampling_rate),
+             src.GetShape(3)},
+            src.GetDtype(), src.GetDevice());
+    if (dst.NumElements() > 0) {
+        kernel::image::ResizeBatch(src, dst,
+                                   interp_type == InterpType::Linear);
+    }
+    return dst;
+}
+
+core::Tensor Image::DilateBatch(const core::Tensor &images, int kernel_size) {
+    core::Tensor src = CheckImageBatch(images, "DilateBatch");
+    if (kernel_size < 3 || kernel_size % 2 == 0) {
+        utility::LogError("Kernel size must be an odd number >= 3, but got {}.",
+                          kernel_size);
+    }
+    core::Tensor dst = core::Tensor::EmptyLike(src);
+    kernel::image::DilateBatch(src, dst, kernel_size);
+    return dst;
+}
+
+core::Tensor Image::FilterBatch(const core::Tensor &images,
+                                const core::Tensor &kernel) {
+    core::Tensor src = CheckImageBatch(images, "FilterBatch");
+    if (kernel.NumDims() != 2) {
+        utility::LogError("Expected a 2D kernel, but got shape {}.",
+                          kernel.GetShape().ToString());
+    }
+    core::Tensor dst = core::Tensor::EmptyLike(src);
+    kernel::image::FilterBatch(src, dst, kernel);
+    return dst;
+}
+
+core::Tensor Image::FilterGaussianBatch(const core::Tensor &images,
+                                        int kernel_size,
+                                        float sigma) {
+    if (kernel_size < 3 || kernel_size % 2 == 0) {
+        utility::LogError("Kernel size must be an odd number >= 3, but got {}.",
+                          kernel_size);
+    }
+
+    // The separable weights are normalized in 1D, so that their outer product
+    // sums to one as well.
+    std::vector<float> weights(kernel_size);
+    float sum = 0;
+    for (int i = 0; i < kernel_size; ++i) {
+        float d = static_cast<float>(i - kernel_size / 2);
+        weights[i] = std::exp(-d * d / (2 * sigma * sigma));
+        sum += weights[i];
+    }
+    std::vector<float> kernel_data(kernel_size * kernel_size);
+    for (int y = 0; y < kernel_size; ++y) {
+        for (int x = 0; x < kernel_size; ++x) {
+            kernel_data[y * kernel_size + x] =
+                    weights[y] * weights[x] / (sum * sum);
+        }
+    }
+    core::Tensor kernel(kernel_data, {kernel_size, kernel_size},
+                        core::Dtype::Float32, images.GetDevice());
+    return FilterBatch(images, kernel);
+}
+
 Image Image::ClipTransform(float scale,
                            float min_value,
                            float max_value,
@@ -277,6 +277,46 @@ public:
     /// \returns Half sized downsampled Float32 depth image.
     Image PyrDownDepth(float diff_threshold, float invalid_fill = 0.f) const;
 
+    /// \brief Converts a stack of 3-channel RGB images to grayscale.
+    ///
+    /// The batched operations process a (N, rows, cols, channels) stack of
+    /// equally sized images, e.g. the synchronized frames of a multi-camera
+    /// rig, with a single kernel launch for the whole stack. They support
+    /// UInt8, UInt16 and Float32 images, with {1, 3, 4} channels unless noted
+    /// otherwise, and round and saturate integer results.
+    ///
+    /// \param images (N, rows, cols, 3) image stack.
+    /// \return (N, rows, cols, 1) image stack of the same Dtype.
+    static core::Tensor RGBToGrayBatch(const core::Tensor &images);
+
+    /// \brief Resizes a stack of images, see RGBToGrayBatch() for the layout.
+    ///
+    /// Only InterpType::Nearest and InterpType::Linear are supported.
+    static core::Tensor ResizeBatch(
+            const core::Tensor &images,
+            float sampling_rate = 0.5f,
+            InterpType interp_type = InterpType::Nearest);
+
+    /// \brief Dilates a stack of images, see RGBToGrayBatch() for the layout.
+    ///
+    /// \param kernel_size An odd number >= 3.
+    static core::Tensor DilateBatch(const core::Tensor &images,
+                                    int kernel_size = 3);
+
+    /// \brief Filters a stack of images with the given kernel, see
+    /// RGBToGrayBatch() for the layout. Borders are replicated.
+    static core::Tensor FilterBatch(const core::Tensor &images,
+                                    const core::Tensor &kernel);
+
+    /// \brief Gaussian filters a stack of images, see RGBToGrayBatch() for the
+    /// layout.
+    ///
+    /// \param kernel_size Odd numbers >= 3 are supported.
+    /// \param sigma Standard deviation of the Gaussian distribution.
+    static core::Tensor FilterGaussianBatch(const core::Tensor &images,
+                                            int kernel_size = 3,
+                                            float sigma = 1.0f);
+
     /// \brief Return new image after scaling and clipping image values.
     ///
     /// This is typically used for preprocessing a depth image. Images of shape
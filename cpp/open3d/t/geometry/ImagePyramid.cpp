@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/ImagePyramid.h"
+
+#include <cmath>
+
+#include "open3d/t/geometry/kernel/Image.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+ImagePyramid::ImagePyramid(int64_t rows,
+                           int64_t cols,
+                           int64_t num_levels,
+                           const core::Device &device) {
+    if (rows <= 0 || cols <= 0 || num_levels <= 0) {
+        utility::LogError(
+                "Invalid pyramid of {} levels for images with {} rows and {} "
+                "columns.",
+                num_levels, rows, cols);
+    }
+    if ((rows >> (num_levels - 1)) <= 0 || (cols >> (num_levels - 1)) <= 0) {
+        utility::LogError("Too many levels {} for images with {} rows and {} "
+                          "columns.",
+                          num_levels, rows, cols);
+    }
+    for (int64_t i = 0; i < num_levels; ++i) {
+        const int64_t level_rows = rows >> i;
+        const int64_t level_cols = cols >> i;
+        for (auto *levels : {&depth_, &depth_dx_, &depth_dy_, &intensity_,
+                             &intensity_dx_, &intensity_dy_}) {
+            levels->push_back(core::Tensor({level_rows, level_cols, 1},
+                                           core::Dtype::Float32, device));
+        }
+        vertex_maps_.push_back(core::Tensor({level_rows, level_cols, 3},
+                                            core::Dtype::Float32, device));
+        intrinsics_.push_back(core::Tensor::Eye(3, core::Dtype::Float64,
+                                                core::Device("CPU:0")));
+    }
+}
+
+void ImagePyramid::UpdateDepth(const Image &depth,
+                               const core::Tensor &intrinsics,
+                               float depth_scale,
+                               float depth_max,
+                               float depth_diff,
+                               bool compute_gradients) {
+    if (GetNumLevels() == 0) {
+        utility::LogError("The pyramid has no levels.");
+    }
+    const core::Tensor &depth_tensor = depth.AsTensor();
+    depth_tensor.AssertShape(depth_[0].GetShape());
+    depth_tensor.AssertDevice(depth_[0].GetDevice());
+    if (depth.GetDtype() != core::Dtype::UInt16 &&
+        depth.GetDtype() != core::Dtype::Float32) {
+        utility::LogError("Expected a UInt16 or Float32 image, but got {}",
+                          depth.GetDtype().ToString());
+    }
+    intrinsics.AssertShape({3, 3});
+
+    intrinsics_[0] = intrinsics.To(core::Device("CPU:0"), core::Dtype::Float64,
+                                   /*copy=*/true);
+    kernel::image::ClipTransformVertexMap(depth_tensor, depth_[0],
+                                          vertex_maps_[0], intrinsics_[0],
+                                          depth_scale, 0, depth_max, NAN);
+    for (int64_t i = 1; i < GetNumLevels(); ++i) {
+        intrinsics_[i] = intrinsics_[i - 1] / 2;
+        intrinsics_[i][-1][-1] = 1;
+        kernel::image::PyrDownDepthVertexMap(depth_[i - 1], depth_[i],
+                                             vertex_maps_[i], intrinsics_[i],
+                                             depth_diff, NAN);
+    }
+    if (compute_gradients) {
+        for (int64_t i = 0; i < GetNumLevels(); ++i) {
+            kernel::image::FilterSobel3x3(depth_[i], depth_dx_[i],
+                                          depth_dy_[i]);
+        }
+    }
+}
+
+void ImagePyramid::UpdateIntensity(const Image &color) {
+    if (GetNumLevels() == 0) {
+        utility::LogError("The pyramid has no levels.");
+    }
+    if (color.GetRows() != intensity_[0].GetShape(0) ||
+        color.GetCols() != intensity_[0].GetShape(1) ||
+        (color.GetChannels() != 1 && color.GetChannels() != 3)) {
+        utility::LogError(
+                "Expected a 1 or 3 channel image with shape ({}, {}), but got "
+                "({}, {}, {})",
+                intensity_[0].GetShape(0), intensity_[0].GetShape(1),
+                color.GetRows(), color.GetCols(), color.GetChannels());
+    }
+    color.AsTensor().AssertDevice(intensity_[0].GetDevice());
+
+    kernel::image::RGBToGray(color.AsTensor(), intensity_[0]);
+    for (int64_t i = 1; i < GetNumLevels(); ++i) {
+        kernel::image::PyrDownGaussian(intensity_[i - 1], intensity_[i]);
+    }
+    for (int64_t i = 0; i < GetNumLevels(); ++i) {
+        kernel::image::FilterSobel3x3(intensity_[i], intensity_dx_[i],
+                                      intensity_dy_[i]);
+    }
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
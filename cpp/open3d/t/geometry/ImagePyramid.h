@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class ImagePyramid
+///
+/// \brief Depth and intensity image pyramids with the vertex maps and image
+/// gradients of every level, as used by RGBD odometry.
+///
+/// All levels are allocated once on construction and rebuilt in place by
+/// UpdateDepth() and UpdateIntensity(), so that a pyramid can be reused for
+/// every frame of a sequence. Downsampling, gradients and vertex maps are
+/// computed by fused kernels. Level 0 has the full resolution and every
+/// further level half the rows and columns of the previous one.
+class ImagePyramid {
+public:
+    /// \brief Default Constructor.
+    ImagePyramid() {}
+
+    /// \brief Allocates the levels of a pyramid.
+    ///
+    /// \param rows Number of rows of the full resolution images.
+    /// \param cols Number of columns of the full resolution images.
+    /// \param num_levels Number of levels including the full resolution.
+    /// \param device Device of the levels.
+    ImagePyramid(int64_t rows,
+                 int64_t cols,
+                 int64_t num_levels,
+                 const core::Device &device = core::Device("CPU:0"));
+
+public:
+    /// \brief Rebuilds the depth levels and their vertex maps from a depth
+    /// image.
+    ///
+    /// The depth is converted to meters and clipped like
+    /// Image::ClipTransform() with NaN for invalid depth, and downsampled like
+    /// Image::PyrDownDepth().
+    /// \param depth UInt16 or Float32 depth image.
+    /// \param intrinsics 3x3 intrinsic matrix of the full resolution image.
+    /// \param depth_scale Scale to convert the depth to meters.
+    /// \param depth_max Maximal depth in meters.
+    /// \param depth_diff Maximal depth difference of the neighbors averaged
+    /// when downsampling.
+    /// \param compute_gradients If true, the Sobel gradients of the depth
+    /// levels are computed as well.
+    void UpdateDepth(const Image &depth,
+                     const core::Tensor &intrinsics,
+                     float depth_scale,
+                     float depth_max,
+                     float depth_diff,
+                     bool compute_gradients = false);
+
+    /// \brief Rebuilds the Float32 intensity levels and their Sobel gradients
+    /// from a 3 channel color or a 1 channel intensity image.
+    void UpdateIntensity(const Image &color);
+
+    /// Returns the number of levels.
+    int64_t GetNumLevels() const { return int64_t(depth_.size()); }
+
+    /// Returns the Float32 depth in meters of a level.
+    Image GetDepth(int64_t level) const { return Image(depth_.at(level)); }
+
+    /// Returns the vertex map of a level.
+    Image GetVertexMap(int64_t level) const {
+        return Image(vertex_maps_.at(level));
+    }
+
+    /// Returns the horizontal depth gradient of a level.
+    Image GetDepthDx(int64_t level) const { return Image(depth_dx_.at(level)); }
+
+    /// Returns the vertical depth gradient of a level.
+    Image GetDepthDy(int64_t level) const { return Image(depth_dy_.at(level)); }
+
+    /// Returns the Float32 intensity of a level.
+    Image GetIntensity(int64_t level) const {
+        return Image(intensity_.at(level));
+    }
+
+    /// Returns the horizontal intensity gradient of a level.
+    Image GetIntensityDx(int64_t level) const {
+        return Image(intensity_dx_.at(level));
+    }
+
+    /// Returns the vertical intensity gradient of a level.
+    Image GetIntensityDy(int64_t level) const {
+        return Image(intensity_dy_.at(level));
+    }
+
+    /// Returns the Float64 3x3 intrinsic matrix of a level.
+    core::Tensor GetIntrinsics(int64_t level) const {
+        return intrinsics_.at(level);
+    }
+
+private:
+    std::vector<core::Tensor> depth_;
+    std::vector<core::Tensor> vertex_maps_;
+    std::vector<core::Tensor> depth_dx_;
+    std::vector<core::Tensor> depth_dy_;
+    std::vector<core::Tensor> intensity_;
+    std::vector<core::Tensor> intensity_dx_;
+    std::vector<core::Tensor> intensity_dy_;
+    std::vector<core::Tensor> intrinsics_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
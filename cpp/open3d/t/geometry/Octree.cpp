@@ -0,0 +1,235 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Octree.h"
+
+#include <algorithm>
+#include <tuple>
+
+#include "open3d/core/kernel/Scan.h"
+#include "open3d/t/geometry/kernel/Octree.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+static const core::Device host("CPU:0");
+
+Octree::Octree(int64_t max_depth, const core::Tensor& origin, double size)
+    : max_depth_(max_depth),
+      origin_(origin.To(host, core::Dtype::Float64).Contiguous()),
+      size_(size),
+      device_(host) {
+    if (max_depth_ < 0 || max_depth_ > 21) {
+        utility::LogError("max_depth must be in [0, 21], but got {}.",
+                          max_depth_);
+    }
+    origin_.AssertShape({3});
+}
+
+Octree Octree::CreateFromPointCloud(const PointCloud& pcd,
+                                    int64_t max_depth,
+                                    double size_expand) {
+    if (size_expand > 1 || size_expand < 0) {
+        utility::LogError("size_expand shall be between 0 and 1");
+    }
+    const core::Tensor& points = pcd.GetPoints();
+    if (points.GetLength() == 0) {
+        return Octree(max_depth, core::Tensor::Zeros({3}, core::Dtype::Float64),
+                      0);
+    }
+
+    // Same bounds as the legacy Octree::ConvertFromPointCloud.
+    std::vector<double> min_bound = points.Min({0})
+                                             .To(host, core::Dtype::Float64)
+                                             .ToFlatVector<double>();
+    std::vector<double> max_bound = points.Max({0})
+                                             .To(host, core::Dtype::Float64)
+                                             .ToFlatVector<double>();
+    std::vector<double> center(3);
+    double max_half_size = 0;
+    for (int i = 0; i < 3; ++i) {
+        center[i] = (min_bound[i] + max_bound[i]) / 2;
+        max_half_size = std::max(max_half_size, center[i] - min_bound[i]);
+    }
+    std::vector<double> origin(3);
+    for (int i = 0; i < 3; ++i) {
+        origin[i] = std::min(min_bound[i], center[i] - max_half_size);
+    }
+    double size = max_half_size == 0 ? size_expand
+                                     : max_half_size * 2 * (1 + size_expand);
+
+    Octree octree(max_depth, core::Tensor(origin, {3}, core::Dtype::Float64),
+                  size);
+    octree.Build(points);
+    if (pcd.HasPointColors() && !octree.IsEmpty()) {
+        // Color of the last point of each leaf.
+        const core::Tensor& leaf_offsets = octree.GetNodeOffsets(max_depth);
+        core::Tensor last_points = octree.point_indices_.IndexGet(
+                {leaf_offsets.Slice(0, 1, leaf_offsets.GetLength()) - 1});
+        octree.leaf_colors_ = pcd.GetPointColors().IndexGet({last_points});
+    }
+    return octree;
+}
+
+void Octree::Build(const core::Tensor& points) {
+    node_codes_.clear();
+    node_offsets_.clear();
+    point_indices_ = core::Tensor();
+    leaf_colors_ = core::Tensor();
+    device_ = points.GetDevice();
+
+    core::Tensor codes, valid;
+    kernel::octree::ComputeMortonCodes(points, origin_, size_, max_depth_,
+                                       codes, valid);
+    core::Tensor valid_indices = core::kernel::Compact(valid);
+    if (valid_indices.GetLength() == 0) {
+        return;
+    }
+    core::Tensor valid_codes = codes.IndexGet({valid_indices});
+    core::Tensor order = valid_codes.ArgSort();
+    point_indices_ = valid_indices.IndexGet({order});
+
+    // Leaf nodes group the sorted point codes, parents group the codes of
+    // the children without their 3 lowest bits.
+    node_codes_.resize(max_depth_ + 1);
+    node_offsets_.resize(max_depth_ + 1);
+    core::Tensor child_codes = valid_codes.IndexGet({order});
+    for (int64_t depth = max_depth_; depth >= 0; --depth) {
+        core::Tensor unique, counts;
+        std::tie(unique, std::ignore, counts) =
+                child_codes.Unique(/*return_inverse=*/false,
+                                   /*return_counts=*/true);
+        const int64_t num_nodes = unique.GetLength();
+        core::Tensor offsets = core::Tensor::Zeros(
+                {num_nodes + 1}, core::Dtype::Int64, device_);
+        offsets.Slice(0, 1, num_nodes + 1) = counts.CumSum(0);
+        node_codes_[depth] = unique;
+        node_offsets_[depth] = offsets;
+        child_codes = unique / 8;
+    }
+}
+
+int64_t Octree::GetNumNodes(int64_t depth) const {
+    if (depth < 0 || depth >= int64_t(node_codes_.size())) {
+        return 0;
+    }
+    return node_codes_[depth].GetLength();
+}
+
+const core::Tensor& Octree::GetNodeCodes(int64_t depth) const {
+    if (depth < 0 || depth >= int64_t(node_codes_.size())) {
+        utility::LogError("depth {} out of range [0, {}).", depth,
+                          node_codes_.size());
+    }
+    return node_codes_[depth];
+}
+
+const core::Tensor& Octree::GetNodeOffsets(int64_t depth) const {
+    if (depth < 0 || depth >= int64_t(node_offsets_.size())) {
+        utility::LogError("depth {} out of range [0, {}).", depth,
+                          node_offsets_.size());
+    }
+    return node_offsets_[depth];
+}
+
+/// Host copies of the node tensors, for the conversion to the legacy octree.
+struct OctreeHostData {
+    int64_t max_depth;
+    std::vector<std::vector<int64_t>> codes;
+    std::vector<std::vector<int64_t>> offsets;
+    std::vector<int64_t> point_indices;
+    std::vector<double> leaf_colors;
+};
+
+static std::shared_ptr<open3d::geometry::OctreeNode> ToLegacyNode(
+        const OctreeHostData& data, int64_t depth, int64_t node_index) {
+    int64_t begin = node_index;
+    int64_t end = node_index + 1;
+    for (int64_t d = depth; d <= data.max_depth; ++d) {
+        begin = data.offsets[d][begin];
+        end = data.offsets[d][end];
+    }
+    std::vector<size_t> indices(data.point_indices.begin() + begin,
+                                data.point_indices.begin() + end);
+
+    if (depth == data.max_depth) {
+        auto leaf_node =
+                std::make_shared<open3d::geometry::OctreePointColorLeafNode>();
+        if (!data.leaf_colors.empty()) {
+            leaf_node->color_ =
+                    Eigen::Vector3d(data.leaf_colors.data() + 3 * node_index);
+        }
+        leaf_node->indices_ = std::move(indices);
+        return leaf_node;
+    }
+
+    // The legacy octree keeps the indices of internal nodes in insertion
+    // order.
+    std::sort(indices.begin(), indices.end());
+    auto internal_node =
+            std::make_shared<open3d::geometry::OctreeInternalPointNode>();
+    internal_node->indices_ = std::move(indices);
+    const std::vector<int64_t>& offsets = data.offsets[depth];
+    for (int64_t child = offsets[node_index]; child < offsets[node_index + 1];
+         ++child) {
+        int64_t child_index = data.codes[depth + 1][child] & 7;
+        internal_node->children_[child_index] =
+                ToLegacyNode(data, depth + 1, child);
+    }
+    return internal_node;
+}
+
+std::shared_ptr<open3d::geometry::Octree> Octree::ToLegacyOctree() const {
+    std::vector<double> origin = origin_.ToFlatVector<double>();
+    auto octree = std::make_shared<open3d::geometry::Octree>(
+            max_depth_, Eigen::Vector3d(origin[0], origin[1], origin[2]),
+            size_);
+    if (IsEmpty()) {
+        return octree;
+    }
+
+    OctreeHostData data;
+    data.max_depth = max_depth_;
+    for (int64_t depth = 0; depth <= max_depth_; ++depth) {
+        data.codes.push_back(
+                node_codes_[depth].To(host).ToFlatVector<int64_t>());
+        data.offsets.push_back(
+                node_offsets_[depth].To(host).ToFlatVector<int64_t>());
+    }
+    data.point_indices = point_indices_.To(host).ToFlatVector<int64_t>();
+    if (leaf_colors_.NumElements() > 0) {
+        data.leaf_colors = leaf_colors_.To(host, core::Dtype::Float64)
+                                   .ToFlatVector<double>();
+    }
+    octree->root_node_ = ToLegacyNode(data, 0, 0);
+    return octree;
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
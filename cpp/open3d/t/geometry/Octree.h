@@ -0,0 +1,123 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/Octree.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class Octree
+/// \brief A linear octree stored as tensors on the device of its points.
+///
+/// Every node is identified by the Int64 Morton code of its position at its
+/// depth, see kernel::octree::ComputeMortonCodes. For each depth, the nodes
+/// are stored as a sorted tensor of codes and an Int64 tensor of offsets:
+/// node i has the children [offsets[i], offsets[i + 1]) at the next depth, or
+/// for the leaf depth, the points [offsets[i], offsets[i + 1]) of
+/// GetPointIndices(). The octree is built with parallel kernels and sorting,
+/// on CPU or CUDA.
+class Octree {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_depth Depth of the leaves, at most 21.
+    /// \param origin Float64 tensor {3}, the global min bound. A point is
+    /// within bound iff origin <= point < origin + size.
+    /// \param size Outer bounding box edge size for the whole octree.
+    Octree(int64_t max_depth, const core::Tensor& origin, double size);
+
+    /// \brief Creates an octree from the points of a point cloud, with the
+    /// bounds of Octree::ConvertFromPointCloud.
+    ///
+    /// \param pcd Input point cloud. Leaf colors are taken from the last point
+    /// of each leaf if the point cloud has colors.
+    /// \param max_depth Depth of the leaves, at most 21.
+    /// \param size_expand A small expansion size such that the octree is
+    /// slightly bigger than the original point cloud bounds to accomodate all
+    /// points.
+    static Octree CreateFromPointCloud(const PointCloud& pcd,
+                                       int64_t max_depth,
+                                       double size_expand = 0.01);
+
+    /// \brief Builds the octree from points within the bounds. Points out of
+    /// bound are ignored.
+    ///
+    /// \param points Float32 or Float64 tensor {n, 3}.
+    void Build(const core::Tensor& points);
+
+    /// Returns true if the octree has no node.
+    bool IsEmpty() const { return node_codes_.empty(); }
+
+    int64_t GetMaxDepth() const { return max_depth_; }
+    const core::Tensor& GetOrigin() const { return origin_; }
+    double GetSize() const { return size_; }
+
+    /// Returns the device of the node tensors.
+    core::Device GetDevice() const { return device_; }
+
+    /// Returns the number of non-empty nodes at a depth.
+    int64_t GetNumNodes(int64_t depth) const;
+
+    /// Returns the sorted Int64 Morton codes {num_nodes} of a depth.
+    const core::Tensor& GetNodeCodes(int64_t depth) const;
+
+    /// Returns the Int64 offsets {num_nodes + 1} of a depth.
+    const core::Tensor& GetNodeOffsets(int64_t depth) const;
+
+    /// Returns the Int64 point indices, grouped by leaf node in DFS order.
+    const core::Tensor& GetPointIndices() const { return point_indices_; }
+
+    /// Returns the colors {num_leaves, 3} of the leaf nodes, or an empty
+    /// tensor if the octree was not built from colored points.
+    const core::Tensor& GetLeafColors() const { return leaf_colors_; }
+
+    /// \brief Convert to a legacy Octree of OctreeInternalPointNode and
+    /// OctreePointColorLeafNode.
+    std::shared_ptr<open3d::geometry::Octree> ToLegacyOctree() const;
+
+private:
+    int64_t max_depth_;
+    core::Tensor origin_;
+    double size_;
+    core::Device device_;
+
+    std::vector<core::Tensor> node_codes_;
+    std::vector<core::Tensor> node_offsets_;
+    core::Tensor point_indices_;
+    core::Tensor leaf_colors_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,410 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/PartitionedTSDFVoxelGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <map>
+#include <thread>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+namespace {
+
+/// Call \p func for every partition index. Partitions on different devices
+/// are processed concurrently, partitions on the same device one after
+/// another in a common thread.
+void ForEachPartition(const std::vector<core::Device> &devices,
+                      const std::function<void(int64_t)> &func) {
+    std::map<std::string, std::vector<int64_t>> device_partitions;
+    for (int64_t i = 0; i < static_cast<int64_t>(devices.size()); ++i) {
+        device_partitions[devices[i].ToString()].push_back(i);
+    }
+    if (device_partitions.size() == 1) {
+        for (int64_t i = 0; i < static_cast<int64_t>(devices.size()); ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<std::exception_ptr> exceptions(device_partitions.size());
+    size_t t = 0;
+    for (const auto &kv : device_partitions) {
+        const std::vector<int64_t> &partitions = kv.second;
+        std::exception_ptr &exception = exceptions[t++];
+        threads.emplace_back([&func, &partitions, &exception]() {
+            try {
+                for (int64_t i : partitions) {
+                    func(i);
+                }
+            } catch (...) {
+                exception = std::current_exception();
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    for (const std::exception_ptr &exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
+/// Concatenate \p tensors of elements of \p element_shape along the first
+/// dimension on \p device.
+core::Tensor ConcatenateRows(const std::vector<core::Tensor> &tensors,
+                             const core::SizeVector &element_shape,
+                             core::Dtype dtype,
+                             const core::Device &device) {
+    int64_t length = 0;
+    for (const core::Tensor &tensor : tensors) {
+        length += tensor.GetLength();
+    }
+    core::SizeVector shape = element_shape;
+    shape.insert(shape.begin(), length);
+    core::Tensor result(shape, dtype, device);
+    int64_t offset = 0;
+    for (const core::Tensor &tensor : tensors) {
+        if (tensor.GetLength() > 0) {
+            result.Slice(0, offset, offset + tensor.GetLength()) =
+                    tensor.To(device);
+            offset += tensor.GetLength();
+        }
+    }
+    return result;
+}
+
+/// Return a Bool mask of the Int32 blocks \p keys (N, 3) that may intersect
+/// the viewing frustum of a width x height camera up to \p depth_max. Each
+/// block is bounded by a sphere, whose projection is bounded by the
+/// projection of its center plus a margin.
+core::Tensor GetFrustumBlockMask(const core::Tensor &keys,
+                                 const core::Tensor &intrinsics,
+                                 const core::Tensor &extrinsics,
+                                 int width,
+                                 int height,
+                                 float depth_max,
+                                 float block_size) {
+    const core::Device device = keys.GetDevice();
+    Eigen::Matrix3d intrinsic =
+            core::eigen_converter::TensorToEigenMatrixXd(intrinsics);
+    Eigen::Matrix4d extrinsic =
+            core::eigen_converter::TensorToEigenMatrixXd(extrinsics);
+    std::vector<float> rotation_t(9);
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            rotation_t[r * 3 + c] = static_cast<float>(extrinsic(c, r));
+        }
+    }
+    core::Tensor rotation_t_tensor(rotation_t, {3, 3}, core::Dtype::Float32,
+                                   device);
+    core::Tensor translation(std::vector<float>{static_cast<float>(
+                                                        extrinsic(0, 3)),
+                                                static_cast<float>(
+                                                        extrinsic(1, 3)),
+                                                static_cast<float>(
+                                                        extrinsic(2, 3))},
+                             {1, 3}, core::Dtype::Float32, device);
+
+    // Block centers in camera coordinates.
+    const float radius = 0.5f * std::sqrt(3.0f) * block_size;
+    core::Tensor centers = (keys.To(core::Dtype::Float32) + 0.5f) * block_size;
+    core::Tensor points = centers.Matmul(rotation_t_tensor) + translation;
+    core::Tensor x = points.Slice(1, 0, 1).Reshape({-1});
+    core::Tensor y = points.Slice(1, 1, 2).Reshape({-1});
+    core::Tensor z = points.Slice(1, 2, 3).Reshape({-1});
+
+    // For z > 2 * radius, the projection of a point of the sphere deviates
+    // from the projection of the center by at most
+    // f * radius * (1 + |x| / z) / (z - radius) in u, likewise in v.
+    const float max_value = std::numeric_limits<float>::max();
+    core::Tensor z_clipped = z.Clip(2 * radius, max_value);
+    core::Tensor scale = core::Tensor::Full(z.GetShape(), radius,
+                                            core::Dtype::Float32, device) /
+                         (z_clipped - radius);
+    core::Tensor x_ratio = x / z_clipped;
+    core::Tensor y_ratio = y / z_clipped;
+    core::Tensor u = x_ratio * static_cast<float>(intrinsic(0, 0)) +
+                     static_cast<float>(intrinsic(0, 2));
+    core::Tensor v = y_ratio * static_cast<float>(intrinsic(1, 1)) +
+                     static_cast<float>(intrinsic(1, 2));
+    core::Tensor margin_u = (x_ratio.Abs() + 1.0f) * scale *
+                            static_cast<float>(intrinsic(0, 0));
+    core::Tensor margin_v = (y_ratio.Abs() + 1.0f) * scale *
+                            static_cast<float>(intrinsic(1, 1));
+    core::Tensor in_image = (u + margin_u).Ge(0.0f) &&
+                            (u - margin_u).Le(static_cast<float>(width)) &&
+                            (v + margin_v).Ge(0.0f) &&
+                            (v - margin_v).Le(static_cast<float>(height));
+
+    // Blocks around the camera center are kept.
+    core::Tensor in_depth = z.Ge(-radius) && z.Le(depth_max + radius);
+    return in_depth && (z.Le(2 * radius) || in_image);
+}
+
+}  // namespace
+
+PartitionedTSDFVoxelGrid::PartitionedTSDFVoxelGrid(
+        std::unordered_map<std::string, core::Dtype> attr_dtype_map,
+        float voxel_size,
+        float sdf_trunc,
+        int64_t block_resolution,
+        int64_t block_count_per_partition,
+        const std::vector<core::Device> &devices,
+        int64_t region_size,
+        const core::HashmapBackend &backend)
+    : attr_dtype_map_(attr_dtype_map),
+      voxel_size_(voxel_size),
+      sdf_trunc_(sdf_trunc),
+      block_resolution_(block_resolution),
+      block_count_per_partition_(block_count_per_partition),
+      region_size_(region_size),
+      backend_(backend),
+      devices_(devices) {
+    if (devices_.empty()) {
+        utility::LogError("[PartitionedTSDFVoxelGrid] No device is given.");
+    }
+    if (region_size_ < 1) {
+        utility::LogError(
+                "[PartitionedTSDFVoxelGrid] region_size must be positive, "
+                "but got {}.",
+                region_size_);
+    }
+    for (const core::Device &device : devices_) {
+        partitions_.emplace_back(attr_dtype_map_, voxel_size_, sdf_trunc_,
+                                 block_resolution_, block_count_per_partition_,
+                                 device, backend_);
+    }
+}
+
+void PartitionedTSDFVoxelGrid::Integrate(const Image &depth,
+                                         const core::Tensor &intrinsics,
+                                         const core::Tensor &extrinsics,
+                                         float depth_scale,
+                                         float depth_max) {
+    IntegrateFrames({depth}, {}, {intrinsics}, {extrinsics}, depth_scale,
+                    depth_max);
+}
+
+void PartitionedTSDFVoxelGrid::Integrate(const Image &depth,
+                                         const Image &color,
+                                         const core::Tensor &intrinsics,
+                                         const core::Tensor &extrinsics,
+                                         float depth_scale,
+                                         float depth_max) {
+    IntegrateFrames({depth}, {color}, {intrinsics}, {extrinsics}, depth_scale,
+                    depth_max);
+}
+
+void PartitionedTSDFVoxelGrid::IntegrateFrames(
+        const std::vector<Image> &depths,
+        const std::vector<Image> &colors,
+        const std::vector<core::Tensor> &intrinsics,
+        const std::vector<core::Tensor> &extrinsics,
+        float depth_scale,
+        float depth_max) {
+    const size_t n = depths.size();
+    if ((!colors.empty() && colors.size() != n) || extrinsics.size() != n ||
+        (intrinsics.size() != 1 && intrinsics.size() != n)) {
+        utility::LogError(
+                "[PartitionedTSDFVoxelGrid] Got {} depth images, {} color "
+                "images, {} intrinsics and {} extrinsics.",
+                n, colors.size(), intrinsics.size(), extrinsics.size());
+    }
+    auto get_intrinsics = [&](size_t f) -> const core::Tensor & {
+        return intrinsics.size() == 1 ? intrinsics[0] : intrinsics[f];
+    };
+
+    // The blocks of each frame are estimated by the first partition on the
+    // device of its depth image, or by the first partition.
+    std::vector<int64_t> home_partitions(n, 0);
+    for (size_t f = 0; f < n; ++f) {
+        for (int64_t i = 0; i < GetPartitionCount(); ++i) {
+            if (devices_[i] == depths[f].GetDevice()) {
+                home_partitions[f] = i;
+                break;
+            }
+        }
+    }
+    std::vector<core::Tensor> block_coords(n);
+    std::vector<core::Tensor> partition_ids(n);
+    ForEachPartition(devices_, [&](int64_t i) {
+        for (size_t f = 0; f < n; ++f) {
+            if (home_partitions[f] != i) {
+                continue;
+            }
+            block_coords[f] = partitions_[i].GetFrustumBlockCoords(
+                    depths[f].To(devices_[i]), get_intrinsics(f),
+                    extrinsics[f], depth_scale, depth_max);
+            partition_ids[f] = GetPartitionIds(block_coords[f]);
+        }
+    });
+
+    // Every partition integrates the frames in order, into its blocks.
+    ForEachPartition(devices_, [&](int64_t i) {
+        for (size_t f = 0; f < n; ++f) {
+            core::Tensor coords =
+                    block_coords[f].IndexGet({partition_ids[f].Eq(i)});
+            if (coords.GetLength() == 0) {
+                continue;
+            }
+            Image color = colors.empty() ? Image() : colors[f].To(devices_[i]);
+            partitions_[i].IntegrateBlocks(
+                    coords.To(devices_[i]), depths[f].To(devices_[i]), color,
+                    get_intrinsics(f), extrinsics[f], depth_scale, depth_max);
+        }
+    });
+}
+
+std::unordered_map<TSDFVoxelGrid::SurfaceMaskCode, core::Tensor>
+PartitionedTSDFVoxelGrid::RayCast(const core::Tensor &intrinsics,
+                                  const core::Tensor &extrinsics,
+                                  int width,
+                                  int height,
+                                  float depth_scale,
+                                  float depth_min,
+                                  float depth_max,
+                                  float weight_threshold,
+                                  int ray_cast_mask) {
+    if (ray_cast_grid_ == nullptr) {
+        ray_cast_grid_ = std::make_shared<TSDFVoxelGrid>(
+                attr_dtype_map_, voxel_size_, sdf_trunc_, block_resolution_,
+                block_count_per_partition_, devices_[0], backend_);
+    } else {
+        ray_cast_grid_->GetBlockHashmap()->Clear();
+    }
+
+    std::vector<core::Tensor> coords, values;
+    for (int64_t i = 0; i < GetPartitionCount(); ++i) {
+        core::Tensor partition_coords, partition_values;
+        std::tie(partition_coords, partition_values) = GetVisibleBlocks(
+                i, intrinsics, extrinsics, width, height, depth_max);
+        coords.push_back(partition_coords);
+        values.push_back(partition_values);
+    }
+    auto hashmap = ray_cast_grid_->GetBlockHashmap();
+    core::SizeVector value_shape = hashmap->GetValueTensor().GetShape();
+    value_shape.erase(value_shape.begin());
+    ray_cast_grid_->InsertBlocks(
+            ConcatenateRows(coords, {3}, core::Dtype::Int32, devices_[0]),
+            ConcatenateRows(values, value_shape, core::Dtype::UInt8,
+                            devices_[0]));
+
+    return ray_cast_grid_->RayCast(intrinsics, extrinsics, width, height,
+                                   depth_scale, depth_min, depth_max,
+                                   weight_threshold, ray_cast_mask);
+}
+
+TSDFVoxelGrid PartitionedTSDFVoxelGrid::Gather(const core::Device &device) {
+    std::vector<core::Tensor> coords, values;
+    for (TSDFVoxelGrid &partition : partitions_) {
+        auto hashmap = partition.GetBlockHashmap();
+        core::Tensor addrs;
+        hashmap->GetActiveIndices(addrs);
+        core::Tensor indices = addrs.To(core::Dtype::Int64);
+        coords.push_back(hashmap->GetKeyTensor().IndexGet({indices}));
+        values.push_back(hashmap->GetValueTensor().IndexGet({indices}));
+    }
+
+    TSDFVoxelGrid voxel_grid(
+            attr_dtype_map_, voxel_size_, sdf_trunc_, block_resolution_,
+            std::max(block_count_per_partition_, GetBlockCount()), device,
+            backend_);
+    core::SizeVector value_shape =
+            voxel_grid.GetBlockHashmap()->GetValueTensor().GetShape();
+    value_shape.erase(value_shape.begin());
+    voxel_grid.InsertBlocks(
+            ConcatenateRows(coords, {3}, core::Dtype::Int32, device),
+            ConcatenateRows(values, value_shape, core::Dtype::UInt8, device));
+    return voxel_grid;
+}
+
+core::Tensor PartitionedTSDFVoxelGrid::GetPartitionIds(
+        const core::Tensor &block_coords) const {
+    const int64_t count = block_coords.GetLength();
+    const core::Device device = block_coords.GetDevice();
+    const int64_t n_partitions = GetPartitionCount();
+    if (n_partitions == 1 || count == 0) {
+        return core::Tensor::Zeros({count}, core::Dtype::Int64, device);
+    }
+
+    // Shift the coordinates to be non-negative, so that integer division
+    // rounds down to the region and the hash is non-negative.
+    const int64_t offset = region_size_ << 20;
+    core::Tensor coords = block_coords.To(core::Dtype::Int64) + offset;
+    if (region_size_ > 1) {
+        coords = coords.Div(region_size_);
+    }
+    core::Tensor primes(std::vector<int64_t>{73856093, 19349669, 83492791},
+                        {1, 3}, core::Dtype::Int64, device);
+    core::Tensor hashes = coords.Mul(primes).Sum({1});
+    return hashes.Sub(hashes.Div(n_partitions).Mul(n_partitions));
+}
+
+int64_t PartitionedTSDFVoxelGrid::GetBlockCount() {
+    int64_t count = 0;
+    for (TSDFVoxelGrid &partition : partitions_) {
+        count += partition.GetBlockHashmap()->Size();
+    }
+    return count;
+}
+
+std::pair<core::Tensor, core::Tensor>
+PartitionedTSDFVoxelGrid::GetVisibleBlocks(int64_t i,
+                                           const core::Tensor &intrinsics,
+                                           const core::Tensor &extrinsics,
+                                           int width,
+                                           int height,
+                                           float depth_max) {
+    auto hashmap = partitions_[i].GetBlockHashmap();
+    core::Tensor addrs;
+    hashmap->GetActiveIndices(addrs);
+    core::Tensor indices = addrs.To(core::Dtype::Int64);
+    core::Tensor keys = hashmap->GetKeyTensor().IndexGet({indices});
+    core::Tensor mask = GetFrustumBlockMask(keys, intrinsics, extrinsics, width,
+                                            height, depth_max,
+                                            block_resolution_ * voxel_size_);
+    indices = indices.IndexGet({mask});
+    return std::make_pair(
+            keys.IndexGet({mask}).To(devices_[0]),
+            hashmap->GetValueTensor().IndexGet({indices}).To(devices_[0]));
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
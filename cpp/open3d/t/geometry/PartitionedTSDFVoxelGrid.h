@@ -0,0 +1,158 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/TSDFVoxelGrid.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// TSDF voxel grid partitioned across several devices, e.g. all the GPUs of a
+/// machine, for volumes and multi-camera rigs that exceed one device.
+///
+/// Each block is owned by exactly one partition, a TSDFVoxelGrid on one of
+/// the devices. The owner is chosen by a hash of the block coordinate, or of
+/// the coordinate of the region of region_size^3 blocks containing it, which
+/// keeps neighboring blocks together. A frame is integrated by the partitions
+/// owning the blocks in its viewing frustum, and partitions on different
+/// devices integrate concurrently. Ray casting gathers the blocks in the
+/// viewing frustum from all partitions into one grid on the first device.
+class PartitionedTSDFVoxelGrid {
+public:
+    PartitionedTSDFVoxelGrid(
+            std::unordered_map<std::string, core::Dtype> attr_dtype_map,
+            float voxel_size,
+            float sdf_trunc,
+            int64_t block_resolution,
+            int64_t block_count_per_partition,
+            const std::vector<core::Device> &devices,
+            int64_t region_size = 1,
+            const core::HashmapBackend &backend =
+                    core::HashmapBackend::Default);
+
+    /// Depth-only integration.
+    void Integrate(const Image &depth,
+                   const core::Tensor &intrinsics,
+                   const core::Tensor &extrinsics,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f);
+
+    /// RGB-D integration.
+    void Integrate(const Image &depth,
+                   const Image &color,
+                   const core::Tensor &intrinsics,
+                   const core::Tensor &extrinsics,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f);
+
+    /// Integrate the frames of several cameras, e.g. of a rig. Same as
+    /// integrating them one after another, but the blocks of each frame are
+    /// estimated on the device of its depth image and all partitions work
+    /// through the frames concurrently. \p colors is empty for depth-only
+    /// integration, \p intrinsics holds one matrix for all frames or one per
+    /// frame.
+    void IntegrateFrames(const std::vector<Image> &depths,
+                         const std::vector<Image> &colors,
+                         const std::vector<core::Tensor> &intrinsics,
+                         const std::vector<core::Tensor> &extrinsics,
+                         float depth_scale = 1000.0f,
+                         float depth_max = 3.0f);
+
+    /// Ray cast the blocks of all partitions, see TSDFVoxelGrid::RayCast().
+    /// The maps are on the first device.
+    std::unordered_map<TSDFVoxelGrid::SurfaceMaskCode, core::Tensor> RayCast(
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics,
+            int width,
+            int height,
+            float depth_scale = 1000.0f,
+            float depth_min = 0.1f,
+            float depth_max = 3.0f,
+            float weight_threshold = 3.0f,
+            int ray_cast_mask = TSDFVoxelGrid::SurfaceMaskCode::DepthMap |
+                                TSDFVoxelGrid::SurfaceMaskCode::ColorMap);
+
+    /// Copy the blocks of all partitions into one TSDFVoxelGrid on
+    /// \p device, e.g. to extract the surface or to save the volume.
+    TSDFVoxelGrid Gather(const core::Device &device);
+
+    /// Return the Int64 {n} owning partition of the Int32 blocks
+    /// \p block_coords (n, 3), on the device of \p block_coords.
+    core::Tensor GetPartitionIds(const core::Tensor &block_coords) const;
+
+    int64_t GetPartitionCount() const {
+        return static_cast<int64_t>(partitions_.size());
+    }
+    const std::vector<core::Device> &GetDevices() const { return devices_; }
+
+    /// The TSDFVoxelGrid of partition i, on devices[i].
+    TSDFVoxelGrid &GetPartition(int64_t i) { return partitions_.at(i); }
+    const TSDFVoxelGrid &GetPartition(int64_t i) const {
+        return partitions_.at(i);
+    }
+
+    /// Return the total number of blocks over all partitions.
+    int64_t GetBlockCount();
+
+protected:
+    /// Return the Int32 coordinates (N, 3) and the voxels of the blocks of
+    /// partition i that may be visible from the camera, on devices[0].
+    std::pair<core::Tensor, core::Tensor> GetVisibleBlocks(
+            int64_t i,
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics,
+            int width,
+            int height,
+            float depth_max);
+
+    std::unordered_map<std::string, core::Dtype> attr_dtype_map_;
+    float voxel_size_;
+    float sdf_trunc_;
+    int64_t block_resolution_;
+    int64_t block_count_per_partition_;
+    int64_t region_size_;
+    core::HashmapBackend backend_;
+
+    std::vector<core::Device> devices_;
+    std::vector<TSDFVoxelGrid> partitions_;
+
+    // Blocks gathered for ray casting, on devices[0]
+    std::shared_ptr<TSDFVoxelGrid> ray_cast_grid_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -27,16 +27,24 @@
 #include "open3d/t/geometry/PointCloud.h"
 
 #include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <string>
+#include <tuple>
 #include <unordered_map>
+#include <utility>
 
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/Hashmap.h"
 #include "open3d/core/linalg/Matmul.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/geometry/MinimumSpanningTree.h"
+#include "open3d/t/geometry/RaycastingScene.h"
 #include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 
 namespace open3d {
@@ -93,21 +101,63 @@ core::Tensor PointCloud::GetMaxBound() const { return GetPoints().Max({0}); }
 
 core::Tensor PointCloud::GetCenter() const { return GetPoints().Mean({0}); }
 
+std::tuple<core::Tensor, core::Tensor, core::Tensor>
+PointCloud::GetOrientedBoundingBoxes(const core::Tensor &offsets) const {
+    offsets.AssertDtype(core::Dtype::Int64);
+    if (offsets.NumDims() != 1 || offsets.GetLength() == 0) {
+        utility::LogError(
+                "[GetOrientedBoundingBoxes] offsets must have shape {k + 1}, "
+                "but got {}.",
+                offsets.GetShape());
+    }
+    const core::Tensor points = GetPoints().Contiguous();
+    const std::vector<int64_t> offsets_host = offsets.ToFlatVector<int64_t>();
+    if (offsets_host.front() < 0 ||
+        offsets_host.back() != points.GetLength() ||
+        !std::is_sorted(offsets_host.begin(), offsets_host.end())) {
+        utility::LogError(
+                "[GetOrientedBoundingBoxes] offsets must be non-decreasing "
+                "from 0 to the number of points {}.",
+                points.GetLength());
+    }
+
+    const int64_t num_boxes = offsets.GetLength() - 1;
+    const core::Dtype dtype = points.GetDtype();
+    core::Tensor centers({num_boxes, 3}, dtype, device_);
+    core::Tensor rotations({num_boxes, 3, 3}, dtype, device_);
+    core::Tensor extents({num_boxes, 3}, dtype, device_);
+    kernel::pointcloud::ComputeOrientedBoundingBoxes(
+            points, offsets.To(device_).Contiguous(), centers, rotations,
+            extents);
+    return std::make_tuple(centers, rotations, extents);
+}
+
 PointCloud PointCloud::To(const core::Device &device, bool copy) const {
     if (!copy && GetDevice() == device) {
         return *this;
     }
     PointCloud pcd(device);
+    if (point_attr_.IsPacked()) {
+        pcd.point_attr_ = point_attr_.To(device, /*copy=*/true);
+        return pcd;
+    }
     for (auto &kv : point_attr_) {
         pcd.SetPointAttr(kv.first, kv.second.To(device, /*copy=*/true));
     }
     return pcd;
 }
 
+PointCloud PointCloud::Pack() const {
+    PointCloud pcd(GetDevice());
+    pcd.point_attr_ = point_attr_.Pack();
+    return pcd;
+}
+
 PointCloud PointCloud::Clone() const { return To(GetDevice(), /*copy=*/true); }
 
 PointCloud PointCloud::Append(const PointCloud &other) const {
     PointCloud pcd(GetDevice());
+    const bool packed = point_attr_.IsPacked();
 
     int64_t length = GetPoints().GetLength();
 
@@ -140,7 +190,8 @@ PointCloud PointCloud::Append(const PointCloud &other) const {
                     core::TensorKey::Slice(length, combined_length, 1),
                     other_attr);
 
-            pcd.SetPointAttr(kv.first, combined_attr.Clone());
+            pcd.SetPointAttr(kv.first,
+                             packed ? combined_attr : combined_attr.Clone());
         } else {
             utility::LogError(
                     "The pointcloud is missing attribute {}. The pointcloud "
@@ -150,6 +201,9 @@ PointCloud PointCloud::Append(const PointCloud &other) const {
                     kv.first);
         }
     }
+    if (packed) {
+        pcd.point_attr_ = pcd.point_attr_.Pack();
+    }
     return pcd;
 }
 
@@ -249,6 +303,643 @@ PointCloud PointCloud::VoxelDownSample(
     return pcd_down;
 }
 
+PointCloud PointCloud::VoxelDownSample(
+        double voxel_size,
+        VoxelReduction reduction,
+        const core::HashmapBackend &backend) const {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    const core::Tensor &points = GetPoints();
+    const int64_t n = points.GetLength();
+    if (n == 0) {
+        return Clone();
+    }
+
+    // Dense voxel ids in [0, num_voxels) from the hashmap addresses.
+    core::Tensor voxel_keys =
+            (points / voxel_size).Floor().To(core::Dtype::Int64);
+    core::Hashmap voxel_hashmap(n, core::Dtype::Int64, core::Dtype::Int32,
+                                {3}, {1}, device_, backend);
+    core::Tensor addrs, masks;
+    voxel_hashmap.Activate(voxel_keys, addrs, masks);
+    voxel_hashmap.Find(voxel_keys, addrs, masks);
+    core::Tensor unique, voxel_ids, counts;
+    std::tie(unique, voxel_ids, counts) =
+            addrs.To(core::Dtype::Int64).Unique(/*return_inverse=*/true);
+    const int64_t num_voxels = unique.GetLength();
+
+    // The points are stably sorted by voxel, so that the first point of a
+    // voxel is its first point in point order, or its point nearest to the
+    // center if the points are sorted by distance beforehand.
+    core::Tensor order;
+    if (reduction == VoxelReduction::CenterNearest) {
+        core::Tensor centers =
+                (voxel_keys.To(points.GetDtype()) + 0.5) * voxel_size;
+        core::Tensor offsets = points - centers;
+        core::Tensor by_distance = (offsets * offsets).Sum({1}).ArgSort();
+        order = by_distance.IndexGet(
+                {voxel_ids.IndexGet({by_distance}).ArgSort()});
+    } else {
+        order = voxel_ids.ArgSort();
+    }
+    core::Tensor sorted_ids = voxel_ids.IndexGet({order});
+
+    // All the point attributes are packed as columns of one tensor.
+    std::vector<std::string> keys;
+    int64_t num_cols = 0;
+    for (auto &kv : point_attr_) {
+        if (kv.second.GetLength() == n) {
+            keys.push_back(kv.first);
+            num_cols += kv.second.NumElements() / n;
+        }
+    }
+    core::Tensor packed({n, num_cols}, core::Dtype::Float64, device_);
+    int64_t col = 0;
+    for (const std::string &key : keys) {
+        const core::Tensor &attr = GetPointAttr(key);
+        const int64_t width = attr.NumElements() / n;
+        packed.Slice(1, col, col + width) = attr.IndexGet({order})
+                                                    .Reshape({n, width})
+                                                    .To(core::Dtype::Float64);
+        col += width;
+    }
+
+    core::Tensor reduced;
+    switch (reduction) {
+        case VoxelReduction::Mean:
+            reduced = packed.SegmentMean(sorted_ids, num_voxels);
+            break;
+        case VoxelReduction::Max:
+            reduced = packed.SegmentMax(sorted_ids, num_voxels);
+            break;
+        default:
+            reduced = packed.SegmentFirst(sorted_ids, num_voxels);
+            break;
+    }
+
+    PointCloud pcd_down(device_);
+    col = 0;
+    for (const std::string &key : keys) {
+        const core::Tensor &attr = GetPointAttr(key);
+        const int64_t width = attr.NumElements() / n;
+        core::Tensor values = reduced.Slice(1, col, col + width);
+        if (reduction == VoxelReduction::Mean &&
+            attr.GetDtype().GetDtypeCode() != core::Dtype::DtypeCode::Float) {
+            values = values.Round();
+        }
+        core::SizeVector shape = attr.GetShape();
+        shape[0] = num_voxels;
+        pcd_down.SetPointAttr(
+                key,
+                values.Contiguous().To(attr.GetDtype()).Reshape(shape));
+        col += width;
+    }
+    return pcd_down;
+}
+
+PointCloud PointCloud::SelectByMask(const core::Tensor &boolean_mask,
+                                    bool invert) const {
+    const int64_t n = GetPoints().GetLength();
+    boolean_mask.AssertShape({n});
+    boolean_mask.AssertDtype(core::Dtype::Bool);
+    boolean_mask.AssertDevice(device_);
+    const core::Tensor mask =
+            invert ? boolean_mask.LogicalNot() : boolean_mask;
+
+    PointCloud pcd_select(device_);
+    for (auto &kv : point_attr_) {
+        if (kv.second.GetLength() == n) {
+            pcd_select.SetPointAttr(kv.first, kv.second.IndexGet({mask}));
+        }
+    }
+    return pcd_select;
+}
+
+/// Reduces a {n, 3} Bool tensor to the {n} mask of its all-true rows.
+static core::Tensor AllColumns(const core::Tensor &inside) {
+    return inside.Slice(1, 0, 1)
+            .LogicalAnd(inside.Slice(1, 1, 2))
+            .LogicalAnd(inside.Slice(1, 2, 3))
+            .Reshape({inside.GetLength()});
+}
+
+PointCloud PointCloud::Crop(
+        const open3d::geometry::AxisAlignedBoundingBox &aabb,
+        bool invert) const {
+    if (aabb.IsEmpty()) {
+        utility::LogError(
+                "[Crop] AxisAlignedBoundingBox either has zeros size, or has "
+                "wrong bounds.");
+    }
+    const core::Tensor &points = GetPoints();
+    const core::Dtype dtype = points.GetDtype();
+    core::Tensor min_bound = core::eigen_converter::EigenVector3dVectorToTensor(
+            {aabb.min_bound_}, dtype, device_);
+    core::Tensor max_bound = core::eigen_converter::EigenVector3dVectorToTensor(
+            {aabb.max_bound_}, dtype, device_);
+    core::Tensor mask = AllColumns(
+            points.Ge(min_bound).LogicalAnd(points.Le(max_bound)));
+    return SelectByMask(mask, invert);
+}
+
+PointCloud PointCloud::Crop(const open3d::geometry::OrientedBoundingBox &obb,
+                            bool invert) const {
+    if (obb.IsEmpty()) {
+        utility::LogError(
+                "[Crop] OrientedBoundingBox either has zeros size, or has "
+                "wrong bounds.");
+    }
+    const core::Tensor &points = GetPoints();
+    const core::Dtype dtype = points.GetDtype();
+    core::Tensor center = core::eigen_converter::EigenVector3dVectorToTensor(
+            {obb.center_}, dtype, device_);
+    core::Tensor half_extent =
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    {obb.extent_ / 2}, dtype, device_);
+    core::Tensor R = core::eigen_converter::EigenMatrixToTensor(obb.R_).To(
+            device_, dtype);
+
+    // Coordinates along the box axes, the columns of R.
+    core::Tensor local = (points - center).Matmul(R);
+    core::Tensor mask = AllColumns(local.Abs().Le(half_extent));
+    return SelectByMask(mask, invert);
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveRadiusOutliers(
+        size_t nb_points, double search_radius) const {
+    if (nb_points < 1 || search_radius <= 0) {
+        utility::LogError(
+                "[RemoveRadiusOutliers] Illegal input parameters, number of "
+                "points and radius must be positive.");
+    }
+    const core::Tensor points = GetPoints().Contiguous();
+    const int64_t n = points.GetLength();
+    if (n == 0) {
+        return std::make_tuple(PointCloud(device_),
+                               core::Tensor({0}, core::Dtype::Bool, device_));
+    }
+
+    // Only whether a point has more than nb_points neighbors matters, so the
+    // hybrid search stops at nb_points + 1 neighbors per point.
+    const int max_knn = int(std::min<int64_t>(nb_points + 1, n));
+    core::nns::NearestNeighborSearch nns(points);
+    nns.HybridIndex(search_radius);
+    core::Tensor counts;
+    std::tie(std::ignore, std::ignore, counts) =
+            nns.HybridSearch(points, search_radius, max_knn);
+    core::Tensor mask =
+            counts.Reshape({n}).Gt(static_cast<int64_t>(nb_points));
+    return std::make_tuple(SelectByMask(mask), mask);
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveStatisticalOutliers(
+        size_t nb_neighbors, double std_ratio) const {
+    if (nb_neighbors < 1 || std_ratio <= 0) {
+        utility::LogError(
+                "[RemoveStatisticalOutliers] Illegal input parameters, number "
+                "of neighbors and standard deviation ratio must be positive.");
+    }
+    const core::Tensor points = GetPoints().Contiguous();
+    const int64_t n = points.GetLength();
+    if (n == 0) {
+        return std::make_tuple(PointCloud(device_),
+                               core::Tensor({0}, core::Dtype::Bool, device_));
+    }
+
+    const int knn = int(std::min<int64_t>(nb_neighbors, n));
+    core::nns::NearestNeighborSearch nns(points);
+    nns.KnnIndex();
+    core::Tensor distances;
+    std::tie(std::ignore, distances) = nns.KnnSearch(points, knn);
+    const core::Tensor avg_distances =
+            distances.To(core::Dtype::Float64).Sqrt().Mean({1});
+
+    // As in the legacy implementation, points whose neighbors all coincide
+    // with them are removed and do not contribute to the deviation.
+    const core::Tensor valid = avg_distances.Gt(0.0);
+    const double cloud_mean = avg_distances.Mean({0}).Item<double>();
+    const core::Tensor deviations = (avg_distances - cloud_mean) *
+                                    valid.To(core::Dtype::Float64);
+    const double sq_sum = (deviations * deviations).Sum({0}).Item<double>();
+    // Bessel's correction
+    const double std_dev = n > 1 ? std::sqrt(sq_sum / (n - 1)) : 0.0;
+    const double distance_threshold = cloud_mean + std_ratio * std_dev;
+
+    core::Tensor mask = valid.LogicalAnd(avg_distances.Lt(distance_threshold));
+    return std::make_tuple(SelectByMask(mask), mask);
+}
+
+std::tuple<core::Tensor, core::Tensor> PointCloud::ComputePointCloudDistance(
+        const PointCloud &target, int64_t chunk_size) const {
+    if (chunk_size <= 0) {
+        utility::LogError(
+                "[ComputePointCloudDistance] chunk_size must be positive.");
+    }
+    if (target.GetDevice() != device_) {
+        utility::LogError(
+                "[ComputePointCloudDistance] The target is on {}, but the "
+                "point cloud is on {}.",
+                target.GetDevice().ToString(), device_.ToString());
+    }
+    const core::Tensor points = GetPoints().Contiguous();
+    const core::Dtype dtype = points.GetDtype();
+    const int64_t n = points.GetLength();
+    core::Tensor distances({n}, dtype, device_);
+    core::Tensor indices({n}, core::Dtype::Int64, device_);
+    if (!target.HasPoints()) {
+        distances.Fill(std::numeric_limits<double>::infinity());
+        indices.Fill(-1);
+        return std::make_tuple(distances, indices);
+    }
+
+    core::nns::NearestNeighborSearch nns(
+            target.GetPoints().To(dtype).Contiguous());
+    nns.KnnIndex();
+    for (int64_t begin = 0; begin < n; begin += chunk_size) {
+        const int64_t end = std::min(begin + chunk_size, n);
+        core::Tensor chunk_indices, chunk_distances;
+        std::tie(chunk_indices, chunk_distances) =
+                nns.KnnSearch(points.Slice(0, begin, end), 1);
+        indices.Slice(0, begin, end) =
+                chunk_indices.Reshape({end - begin}).To(core::Dtype::Int64);
+        distances.Slice(0, begin, end) =
+                chunk_distances.Reshape({end - begin}).Sqrt();
+    }
+    return std::make_tuple(distances, indices);
+}
+
+std::tuple<core::Tensor, core::Tensor> PointCloud::ComputeMeshDistance(
+        const TriangleMesh &mesh, int64_t chunk_size) const {
+    if (chunk_size <= 0) {
+        utility::LogError("[ComputeMeshDistance] chunk_size must be positive.");
+    }
+    if (mesh.GetDevice() != device_) {
+        utility::LogError(
+                "[ComputeMeshDistance] The mesh is on {}, but the point cloud "
+                "is on {}.",
+                mesh.GetDevice().ToString(), device_.ToString());
+    }
+    const core::Tensor points =
+            GetPoints().To(core::Dtype::Float32).Contiguous();
+    const int64_t n = points.GetLength();
+    core::Tensor distances({n}, core::Dtype::Float32, device_);
+    core::Tensor indices({n}, core::Dtype::Int64, device_);
+    if (!mesh.HasTriangles()) {
+        distances.Fill(std::numeric_limits<float>::infinity());
+        indices.Fill(-1);
+        return std::make_tuple(distances, indices);
+    }
+
+    RaycastingScene scene(device_);
+    scene.AddTriangles(mesh.GetVertices().To(core::Dtype::Float32),
+                       mesh.GetTriangles().To(core::Dtype::UInt32));
+    for (int64_t begin = 0; begin < n; begin += chunk_size) {
+        const int64_t end = std::min(begin + chunk_size, n);
+        const core::Tensor chunk = points.Slice(0, begin, end);
+        std::unordered_map<std::string, core::Tensor> closest =
+                scene.ComputeClosestPoints(chunk);
+        const core::Tensor diff = closest["points"] - chunk;
+        distances.Slice(0, begin, end) = (diff * diff).Sum({1}).Sqrt();
+        indices.Slice(0, begin, end) =
+                closest["primitive_ids"].To(core::Dtype::Int64);
+    }
+    return std::make_tuple(distances, indices);
+}
+
+std::tuple<PointCloud, core::Tensor> PointCloud::RemoveHiddenPoints(
+        int width,
+        int height,
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        int splat_radius,
+        float depth_tolerance,
+        float depth_max) const {
+    if (width <= 0 || height <= 0) {
+        utility::LogError("[RemoveHiddenPoints] Invalid image size {} x {}.",
+                          width, height);
+    }
+    if (splat_radius < 0) {
+        utility::LogError(
+                "[RemoveHiddenPoints] splat_radius must be non-negative.");
+    }
+    intrinsics.AssertShape({3, 3});
+    extrinsics.AssertShape({4, 4});
+
+    const core::Tensor points = GetPoints().Contiguous();
+    const int64_t n = points.GetLength();
+    core::Tensor pixel_indices({n}, core::Dtype::Int64, device_);
+    core::Tensor depths({n}, core::Dtype::Float32, device_);
+    core::Tensor depth = core::Tensor::Full(
+            {height, width}, std::numeric_limits<float>::infinity(),
+            core::Dtype::Float32, device_);
+    kernel::pointcloud::SplatPointDepths(points, intrinsics, extrinsics,
+                                         depth_max, pixel_indices, depths,
+                                         depth);
+
+    // Min depth pyramid up to the first level whose cells span a splat of
+    // 2 * splat_radius + 1 pixels, so that at most 2 x 2 cells cover it.
+    int64_t level = 0;
+    while ((int64_t(1) << level) < 2 * int64_t(splat_radius) + 1) {
+        const int64_t rows = depth.GetShape(0);
+        const int64_t cols = depth.GetShape(1);
+        if (rows % 2 != 0 || cols % 2 != 0) {
+            core::Tensor padded = core::Tensor::Full(
+                    {rows + rows % 2, cols + cols % 2},
+                    std::numeric_limits<float>::infinity(),
+                    core::Dtype::Float32, device_);
+            padded.Slice(0, 0, rows).Slice(1, 0, cols) = depth;
+            depth = padded;
+        }
+        depth = depth.Reshape({depth.GetShape(0) / 2, 2,
+                               depth.GetShape(1) / 2, 2})
+                        .Min({1, 3});
+        ++level;
+    }
+
+    core::Tensor visible({n}, core::Dtype::Bool, device_);
+    kernel::pointcloud::TestPointOcclusion(pixel_indices, depths, depth, level,
+                                           width, height, splat_radius,
+                                           depth_tolerance, visible);
+    return std::make_tuple(SelectByMask(visible), visible);
+}
+
+/// Searches the neighbors of every point among \p points by hybrid, knn or
+/// fixed radius search depending on which of \p max_knn and \p radius are
+/// given. The neighbors of point i are
+/// indices[offsets[i] : offsets[i] + counts[i]], all Int64.
+static void SearchNeighbors(const core::Tensor &points,
+                            const utility::optional<int> max_knn,
+                            const utility::optional<double> radius,
+                            core::Tensor &indices,
+                            core::Tensor &offsets,
+                            core::Tensor &counts) {
+    const int64_t n = points.GetLength();
+    const core::Device device = points.GetDevice();
+    core::nns::NearestNeighborSearch nns(points);
+    core::Tensor distances;
+    if (max_knn.has_value() && radius.has_value()) {
+        const int knn = max_knn.value();
+        nns.HybridIndex(radius.value());
+        std::tie(indices, distances, counts) =
+                nns.HybridSearch(points, radius.value(), knn);
+        offsets = core::Tensor::Arange(0, n * knn, knn, core::Dtype::Int64,
+                                       device);
+    } else if (max_knn.has_value()) {
+        const int knn = int(std::min<int64_t>(max_knn.value(), n));
+        nns.KnnIndex();
+        std::tie(indices, distances) = nns.KnnSearch(points, knn);
+        offsets = core::Tensor::Arange(0, n * knn, knn, core::Dtype::Int64,
+                                       device);
+        counts = core::Tensor::Full({n}, knn, core::Dtype::Int64, device);
+    } else {
+        nns.FixedRadiusIndex(radius.value());
+        std::tie(indices, distances, counts) =
+                nns.FixedRadiusSearch(points, radius.value(), false);
+        counts = counts.Reshape({n}).To(core::Dtype::Int64);
+        offsets = counts.CumSum(0, /*exclusive=*/true);
+    }
+    indices = indices.To(core::Dtype::Int64).Contiguous();
+    counts = counts.Reshape({n}).To(core::Dtype::Int64).Contiguous();
+    offsets = offsets.Contiguous();
+}
+
+void PointCloud::EstimateCovariances(const utility::optional<int> max_knn,
+                                     const utility::optional<double> radius) {
+    if (!max_knn.has_value() && !radius.has_value()) {
+        utility::LogError(
+                "[EstimateCovariances] max_knn or radius must be given.");
+    }
+    if (max_knn.has_value() && max_knn.value() <= 0) {
+        utility::LogError("[EstimateCovariances] max_knn must be positive.");
+    }
+    if (radius.has_value() && radius.value() <= 0) {
+        utility::LogError("[EstimateCovariances] radius must be positive.");
+    }
+
+    const core::Tensor points = GetPoints().Contiguous();
+    const core::Dtype dtype = points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[EstimateCovariances] Only Float32 and Float64 points are "
+                "supported, but got {}.",
+                dtype.ToString());
+    }
+    const int64_t n = points.GetLength();
+    if (n == 0) {
+        SetPointAttr("covariances", core::Tensor({0, 3, 3}, dtype, device_));
+        return;
+    }
+
+    core::Tensor indices, offsets, counts;
+    SearchNeighbors(points, max_knn, radius, indices, offsets, counts);
+
+    core::Tensor covariances({n, 3, 3}, dtype, device_);
+    kernel::pointcloud::EstimateCovariances(points, indices, offsets, counts,
+                                            covariances);
+    SetPointAttr("covariances", covariances);
+}
+
+void PointCloud::EstimateNormals(const utility::optional<int> max_knn,
+                                 const utility::optional<double> radius) {
+    if (max_knn.has_value() || radius.has_value()) {
+        EstimateCovariances(max_knn, radius);
+    } else if (!HasPointAttr("covariances")) {
+        utility::LogError(
+                "[EstimateNormals] No covariances in the PointCloud. Give "
+                "max_knn or radius, or call EstimateCovariances() first.");
+    }
+
+    const core::Tensor covariances = GetPointAttr("covariances").Contiguous();
+    const core::Dtype dtype = covariances.GetDtype();
+    const bool has_normals = HasPointNormals();
+    core::Tensor normals;
+    if (has_normals) {
+        normals = GetPointNormals().To(dtype).Contiguous();
+    } else {
+        normals = core::Tensor({covariances.GetLength(), 3}, dtype, device_);
+    }
+    kernel::pointcloud::EstimateNormalsFromCovariances(covariances, normals,
+                                                       has_normals);
+    SetPointNormals(normals);
+}
+
+void PointCloud::EstimateColorGradients(
+        const utility::optional<int> max_knn,
+        const utility::optional<double> radius) {
+    if (!max_knn.has_value() && !radius.has_value()) {
+        utility::LogError(
+                "[EstimateColorGradients] max_knn or radius must be given.");
+    }
+    if (max_knn.has_value() && max_knn.value() <= 0) {
+        utility::LogError(
+                "[EstimateColorGradients] max_knn must be positive.");
+    }
+    if (radius.has_value() && radius.value() <= 0) {
+        utility::LogError("[EstimateColorGradients] radius must be positive.");
+    }
+    if (!HasPointNormals() || !HasPointColors()) {
+        utility::LogError(
+                "[EstimateColorGradients] The PointCloud must have normals "
+                "and colors.");
+    }
+
+    const core::Tensor points = GetPoints().Contiguous();
+    const core::Dtype dtype = points.GetDtype();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[EstimateColorGradients] Only Float32 and Float64 points are "
+                "supported, but got {}.",
+                dtype.ToString());
+    }
+    const int64_t n = points.GetLength();
+    if (n == 0) {
+        SetPointAttr("color_gradients", core::Tensor({0, 3}, dtype, device_));
+        return;
+    }
+
+    core::Tensor indices, offsets, counts;
+    SearchNeighbors(points, max_knn, radius, indices, offsets, counts);
+
+    const core::Tensor normals = GetPointNormals().To(dtype).Contiguous();
+    const core::Tensor colors = GetPointColors().To(dtype).Contiguous();
+    core::Tensor color_gradients({n, 3}, dtype, device_);
+    kernel::pointcloud::EstimateColorGradients(points, normals, colors,
+                                               indices, offsets, counts,
+                                               color_gradients);
+    SetPointAttr("color_gradients", color_gradients);
+}
+
+void PointCloud::OrientNormalsToAlignWithDirection(
+        const core::Tensor &orientation_reference) {
+    if (!HasPointNormals()) {
+        utility::LogError(
+                "[OrientNormalsToAlignWithDirection] No normals in the "
+                "PointCloud. Call EstimateNormals() first.");
+    }
+    orientation_reference.AssertShape({3});
+    core::Tensor normals = GetPointNormals().Contiguous();
+    kernel::pointcloud::OrientNormalsToAlignWithDirection(
+            normals, orientation_reference);
+    SetPointNormals(normals);
+}
+
+void PointCloud::OrientNormalsTowardsCameraLocation(
+        const core::Tensor &camera_location) {
+    if (!HasPointNormals()) {
+        utility::LogError(
+                "[OrientNormalsTowardsCameraLocation] No normals in the "
+                "PointCloud. Call EstimateNormals() first.");
+    }
+    camera_location.AssertShape({3});
+    const core::Tensor points = GetPoints().Contiguous();
+    core::Tensor normals = GetPointNormals().To(points.GetDtype()).Contiguous();
+    kernel::pointcloud::OrientNormalsTowardsCameraLocation(points, normals,
+                                                           camera_location);
+    SetPointNormals(normals);
+}
+
+void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
+    if (!HasPointNormals()) {
+        utility::LogError(
+                "[OrientNormalsConsistentTangentPlane] No normals in the "
+                "PointCloud. Call EstimateNormals() first.");
+    }
+    if (k == 0) {
+        utility::LogError(
+                "[OrientNormalsConsistentTangentPlane] k must be positive.");
+    }
+    const core::Tensor points = GetPoints().Contiguous();
+    const core::Dtype dtype = points.GetDtype();
+    const int64_t n = points.GetLength();
+    if (n == 0) {
+        return;
+    }
+    const core::Tensor normals = GetPointNormals().To(dtype).Contiguous();
+
+    // Riemannian graph of the k nearest neighbors, with the normal weights
+    // computed on the device.
+    core::Tensor indices, offsets, counts;
+    SearchNeighbors(points, int(k), utility::nullopt, indices, offsets,
+                    counts);
+    const int64_t knn = indices.GetShape(1);
+    const core::Tensor neighbor_normals =
+            normals.IndexGet({indices.Reshape({-1})}).Reshape({n, knn, 3});
+    const core::Tensor weights =
+            1.0 - (neighbor_normals * normals.Reshape({n, 1, 3}))
+                          .Sum({2})
+                          .Abs();
+
+    const core::Device host("CPU:0");
+    const core::Tensor indices_host = indices.To(host);
+    const core::Tensor weights_host =
+            weights.To(host).To(core::Dtype::Float64).Contiguous();
+    const core::Tensor points_host =
+            points.To(host).To(core::Dtype::Float64).Contiguous();
+    const core::Tensor normals_host =
+            normals.To(host).To(core::Dtype::Float64).Contiguous();
+    const int64_t *indices_ptr = indices_host.GetDataPtr<int64_t>();
+    const double *weights_ptr = weights_host.GetDataPtr<double>();
+    const double *points_ptr = points_host.GetDataPtr<double>();
+    const double *normals_ptr = normals_host.GetDataPtr<double>();
+
+    // Both directions of an edge and the self loops are kept, the spanning
+    // forest skips them.
+    std::vector<open3d::geometry::WeightedEdge> graph(
+            n * knn, open3d::geometry::WeightedEdge(0, 0, 0.0));
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < n * knn; ++i) {
+        graph[i] = open3d::geometry::WeightedEdge(i / knn, indices_ptr[i],
+                                                  weights_ptr[i]);
+    }
+    std::vector<int64_t> components;
+    const std::vector<open3d::geometry::WeightedEdge> mst =
+            open3d::geometry::MinimumSpanningTree(graph, n, &components);
+
+    // Every tree is traversed from its highest point.
+    std::vector<int64_t> component_roots(n, -1);
+    for (int64_t v = 0; v < n; ++v) {
+        int64_t &root = component_roots[components[v]];
+        if (root == -1 || points_ptr[3 * v + 2] > points_ptr[3 * root + 2]) {
+            root = v;
+        }
+    }
+    std::vector<int64_t> roots;
+    for (int64_t root : component_roots) {
+        if (root != -1) {
+            roots.push_back(root);
+        }
+    }
+    std::vector<int64_t> order, level_offsets, parents;
+    open3d::geometry::BreadthFirstTraversal(mst, n, roots, order,
+                                            level_offsets, parents);
+
+    // Orient the roots towards +z and every other normal consistently with
+    // the normal of its parent, level by level.
+    auto Dot = [normals_ptr](int64_t v0, int64_t v1) {
+        return normals_ptr[3 * v0] * normals_ptr[3 * v1] +
+               normals_ptr[3 * v0 + 1] * normals_ptr[3 * v1 + 1] +
+               normals_ptr[3 * v0 + 2] * normals_ptr[3 * v1 + 2];
+    };
+    std::vector<double> signs(n, 1.0);
+    for (int64_t root : roots) {
+        signs[root] = normals_ptr[3 * root + 2] < 0 ? -1.0 : 1.0;
+    }
+    for (size_t level = 1; level + 1 < level_offsets.size(); ++level) {
+        const int64_t begin = level_offsets[level];
+        const int64_t end = level_offsets[level + 1];
+#pragma omp parallel for schedule(static) if (end - begin >= 1024)
+        for (int64_t i = begin; i < end; ++i) {
+            const int64_t v = order[i];
+            const int64_t parent = parents[v];
+            signs[v] = Dot(parent, v) < 0 ? -signs[parent] : signs[parent];
+        }
+    }
+    SetPointNormals(normals *
+                    core::Tensor(signs, {n, 1}, core::Dtype::Float64, host)
+                            .To(device_, dtype));
+}
+
 static PointCloud CreatePointCloudWithNormals(
         const Image &depth_in, /* UInt16 or Float32 */
         const Image &color_in, /* Float32 */
@@ -394,6 +1085,64 @@ PointCloud PointCloud::CreateFromRGBDImage(const RGBDImage &rgbd_image,
     }
 }
 
+PointCloud PointCloud::CreateFromDepthImageVoxelDownSample(
+        const Image &depth,
+        const core::Tensor &intrinsics,
+        double voxel_size,
+        const core::Tensor &extrinsics,
+        float depth_scale,
+        float depth_max,
+        int stride,
+        const core::HashmapBackend &backend) {
+    core::Dtype dtype = depth.AsTensor().GetDtype();
+    if (dtype != core::Dtype::UInt16 && dtype != core::Dtype::Float32) {
+        utility::LogError(
+                "Unsupported dtype for CreateFromDepthImageVoxelDownSample, "
+                "expected UInt16 or Float32, but got {}.",
+                dtype.ToString());
+    }
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+
+    core::Tensor points;
+    kernel::pointcloud::UnprojectVoxelDownSample(
+            depth.AsTensor(), utility::nullopt, points, utility::nullopt,
+            intrinsics, extrinsics, depth_scale, depth_max, stride,
+            static_cast<float>(voxel_size), backend);
+    return PointCloud(points);
+}
+
+PointCloud PointCloud::CreateFromRGBDImageVoxelDownSample(
+        const RGBDImage &rgbd_image,
+        const core::Tensor &intrinsics,
+        double voxel_size,
+        const core::Tensor &extrinsics,
+        float depth_scale,
+        float depth_max,
+        int stride,
+        const core::HashmapBackend &backend) {
+    auto dtype = rgbd_image.depth_.AsTensor().GetDtype();
+    if (dtype != core::Dtype::UInt16 && dtype != core::Dtype::Float32) {
+        utility::LogError(
+                "Unsupported dtype for CreateFromRGBDImageVoxelDownSample, "
+                "expected UInt16 or Float32, but got {}.",
+                dtype.ToString());
+    }
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+
+    Image image_colors =
+            rgbd_image.color_.To(core::Dtype::Float32, /*copy=*/false);
+    core::Tensor points, colors, image_colors_t = image_colors.AsTensor();
+    kernel::pointcloud::UnprojectVoxelDownSample(
+            rgbd_image.depth_.AsTensor(), image_colors_t, points, colors,
+            intrinsics, extrinsics, depth_scale, depth_max, stride,
+            static_cast<float>(voxel_size), backend);
+    return PointCloud({{"points", points}, {"colors", colors}});
+}
+
 geometry::Image PointCloud::ProjectToDepthImage(int width,
                                                 int height,
                                                 const core::Tensor &intrinsics,
@@ -431,6 +1180,113 @@ geometry::RGBDImage PointCloud::ProjectToRGBDImage(
     return geometry::RGBDImage(color, depth);
 }
 
+void PointCloud::ProjectToDepthImages(core::Tensor &depth,
+                                      const core::Tensor &intrinsics,
+                                      const core::Tensor &extrinsics,
+                                      float depth_scale,
+                                      float depth_max,
+                                      int splat_radius,
+                                      float depth_tolerance) const {
+    ProjectToImages(depth, utility::nullopt, intrinsics, extrinsics,
+                    depth_scale, depth_max, splat_radius, depth_tolerance);
+}
+
+void PointCloud::ProjectToRGBDImages(core::Tensor &depth,
+                                     core::Tensor &color,
+                                     const core::Tensor &intrinsics,
+                                     const core::Tensor &extrinsics,
+                                     float depth_scale,
+                                     float depth_max,
+                                     int splat_radius,
+                                     float depth_tolerance) const {
+    if (!HasPointColors()) {
+        utility::LogError(
+                "Unable to project to RGBD without the Color attribute in the "
+                "point cloud.");
+    }
+    ProjectToImages(depth, color, intrinsics, extrinsics, depth_scale,
+                    depth_max, splat_radius, depth_tolerance);
+}
+
+void PointCloud::ProjectToImages(
+        core::Tensor &depth,
+        utility::optional<std::reference_wrapper<core::Tensor>> color,
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        float depth_scale,
+        float depth_max,
+        int splat_radius,
+        float depth_tolerance) const {
+    if (depth.NumDims() != 4 || depth.GetShape(3) != 1) {
+        utility::LogError(
+                "[ProjectToImages] Expected depth of shape (v, h, w, 1), but "
+                "got {}.",
+                depth.GetShape().ToString());
+    }
+    depth.AssertDtype(core::Dtype::Float32);
+    depth.AssertDevice(device_);
+    if (!depth.IsContiguous()) {
+        utility::LogError("[ProjectToImages] depth is not contiguous.");
+    }
+    const int64_t num_views = depth.GetShape(0);
+    const int64_t height = depth.GetShape(1);
+    const int64_t width = depth.GetShape(2);
+    if (color.has_value()) {
+        core::Tensor &color_t = color.value().get();
+        color_t.AssertShape({num_views, height, width, 3});
+        color_t.AssertDtype(core::Dtype::UInt8);
+        color_t.AssertDevice(device_);
+        if (!color_t.IsContiguous()) {
+            utility::LogError("[ProjectToImages] color is not contiguous.");
+        }
+    }
+    if (intrinsics.NumDims() == 2) {
+        intrinsics.AssertShape({3, 3});
+    } else {
+        intrinsics.AssertShape({num_views, 3, 3});
+    }
+    if (extrinsics.NumDims() == 2) {
+        extrinsics.AssertShape({4, 4});
+    } else {
+        extrinsics.AssertShape({num_views, 4, 4});
+    }
+    if (splat_radius < 0 || depth_tolerance < 0) {
+        utility::LogError(
+                "[ProjectToImages] splat_radius and depth_tolerance must be "
+                "non-negative.");
+    }
+
+    const core::Tensor points = GetPoints().Contiguous();
+    depth.Fill(std::numeric_limits<float>::infinity());
+    kernel::pointcloud::SplatDepthsMultiView(points, intrinsics, extrinsics,
+                                             depth_scale, depth_max,
+                                             splat_radius, depth);
+
+    // The colors and soft depths need a second pass over the splats.
+    const bool average_depth = depth_tolerance > 0;
+    if (!color.has_value() && !average_depth) {
+        kernel::pointcloud::ResolveSplatsMultiView(utility::nullopt, false,
+                                                   depth, utility::nullopt);
+        return;
+    }
+    core::Tensor sums = core::Tensor::Zeros(
+            {num_views, height, width, color.has_value() ? 5 : 2},
+            core::Dtype::Float32, device_);
+    if (color.has_value()) {
+        const core::Tensor colors =
+                GetPointColors().To(core::Dtype::Float32).Contiguous();
+        kernel::pointcloud::AccumulateSplatsMultiView(
+                points, colors, intrinsics, extrinsics, depth_scale, depth_max,
+                splat_radius, depth_tolerance, depth, sums);
+    } else {
+        kernel::pointcloud::AccumulateSplatsMultiView(
+                points, utility::nullopt, intrinsics, extrinsics, depth_scale,
+                depth_max, splat_radius, depth_tolerance, depth, sums);
+    }
+    kernel::pointcloud::ResolveSplatsMultiView(sums, average_depth, depth,
+                                               color);
+}
+
 PointCloud PointCloud::FromLegacyPointCloud(
         const open3d::geometry::PointCloud &pcd_legacy,
         core::Dtype dtype,
@@ -453,6 +1309,32 @@ PointCloud PointCloud::FromLegacyPointCloud(
     return pcd;
 }
 
+PointCloud PointCloud::FromLegacyPointCloud(
+        open3d::geometry::PointCloud &&pcd_legacy,
+        core::Dtype dtype,
+        const core::Device &device) {
+    geometry::PointCloud pcd(device);
+    // Moving the points away changes HasColors() and HasNormals().
+    const bool has_colors = pcd_legacy.HasColors();
+    const bool has_normals = pcd_legacy.HasNormals();
+    if (pcd_legacy.HasPoints()) {
+        pcd.SetPoints(core::eigen_converter::EigenVector3dVectorToTensor(
+                std::move(pcd_legacy.points_), dtype, device));
+    } else {
+        utility::LogWarning("Creating from an empty legacy PointCloud.");
+    }
+    if (has_colors) {
+        pcd.SetPointColors(core::eigen_converter::EigenVector3dVectorToTensor(
+                std::move(pcd_legacy.colors_), dtype, device));
+    }
+    if (has_normals) {
+        pcd.SetPointNormals(core::eigen_converter::EigenVector3dVectorToTensor(
+                std::move(pcd_legacy.normals_), dtype, device));
+    }
+    pcd_legacy.Clear();
+    return pcd;
+}
+
 open3d::geometry::PointCloud PointCloud::ToLegacyPointCloud() const {
     open3d::geometry::PointCloud pcd_legacy;
     if (HasPoints()) {
@@ -26,12 +26,15 @@
 
 #pragma once
 
+#include <limits>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/Image.h"
@@ -43,6 +46,8 @@ namespace open3d {
 namespace t {
 namespace geometry {
 
+class TriangleMesh;
+
 /// \class PointCloud
 /// \brief A pointcloud contains a set of 3D points.
 ///
@@ -235,6 +240,17 @@ public:
     /// Returns copy of the point cloud on the same device.
     PointCloud Clone() const;
 
+    /// \brief Returns a point cloud with the same attributes, stored in a
+    /// single allocation, see TensorMap::Pack().
+    ///
+    /// To() and Clone() of a packed point cloud copy all the attributes at
+    /// once. They and Append() return packed point clouds.
+    PointCloud Pack() const;
+
+    /// Returns true if the point attributes are stored in a single
+    /// allocation, see TensorMap::IsPacked().
+    bool IsPacked() const { return point_attr_.IsPacked(); }
+
     /// Transfer the point cloud to CPU.
     ///
     /// If the point cloud is already on CPU, no copy will be performed.
@@ -266,6 +282,21 @@ public:
     /// Returns the center for point coordinates.
     core::Tensor GetCenter() const;
 
+    /// \brief Returns the oriented bounding boxes of clusters of points.
+    ///
+    /// The boxes are aligned with the principal axes of the points of each
+    /// cluster, like open3d::geometry::OrientedBoundingBox::
+    /// CreateFromPointSets() without the convex hull. The clusters are
+    /// processed in parallel.
+    /// \param offsets Int64 tensor of shape {k + 1} with the start of each
+    /// cluster in the points followed by the number of points.
+    /// \return Tuple of the centers {k, 3}, the rotations {k, 3, 3}, whose
+    /// columns are the axes in the order of decreasing variance, and the
+    /// extents {k, 3}, with the dtype of the points. Empty clusters get empty
+    /// boxes at the origin.
+    std::tuple<core::Tensor, core::Tensor, core::Tensor>
+    GetOrientedBoundingBoxes(const core::Tensor &offsets) const;
+
     /// Append a pointcloud and returns the resulting pointcloud.
     ///
     /// The pointcloud being appended, must have all the attributes
@@ -321,6 +352,203 @@ public:
                                const core::HashmapBackend &backend =
                                        core::HashmapBackend::Default) const;
 
+    /// Reduction of the attributes of the points falling into the same voxel.
+    enum class VoxelReduction {
+        Mean = 0,           ///< Average of the points.
+        First = 1,          ///< First point, in point order.
+        CenterNearest = 2,  ///< Point nearest to the voxel center.
+        Max = 3             ///< Element-wise maximum over the points.
+    };
+
+    /// \brief Downsamples a point cloud with a specified voxel size, reducing
+    /// all the point attributes, e.g. colors and normals, with the same
+    /// reduction.
+    ///
+    /// The attributes are packed into one Float64 tensor, so that they are
+    /// reduced in a single segmented reduction over the points sorted by
+    /// voxel. Integer attributes are rounded after averaging.
+    /// \param voxel_size Voxel size. A positive number.
+    /// \param reduction Reduction of the points of each voxel.
+    PointCloud VoxelDownSample(double voxel_size,
+                               VoxelReduction reduction,
+                               const core::HashmapBackend &backend =
+                                       core::HashmapBackend::Default) const;
+
+    /// \brief Selects points by a boolean mask, keeping all point attributes.
+    /// \param boolean_mask Bool tensor of shape {n}, on the same device.
+    /// \param invert If true, selects the points where the mask is false.
+    PointCloud SelectByMask(const core::Tensor &boolean_mask,
+                            bool invert = false) const;
+
+    /// \brief Crops the point cloud to the points inside an axis-aligned
+    /// bounding box, bounds included, without converting to a legacy
+    /// PointCloud.
+    /// \param aabb The bounding box.
+    /// \param invert If true, keeps the points outside the box instead.
+    PointCloud Crop(const open3d::geometry::AxisAlignedBoundingBox &aabb,
+                    bool invert = false) const;
+
+    /// \brief Crops the point cloud to the points inside an oriented bounding
+    /// box, bounds included, without converting to a legacy PointCloud.
+    /// \param obb The bounding box.
+    /// \param invert If true, keeps the points outside the box instead.
+    PointCloud Crop(const open3d::geometry::OrientedBoundingBox &obb,
+                    bool invert = false) const;
+
+    /// \brief Removes the points that have less than nb_points neighbors
+    /// within search_radius, the point itself included, like the legacy
+    /// PointCloud::RemoveRadiusOutliers(), on the device of the point cloud.
+    /// \param nb_points Number of neighbors within the radius.
+    /// \param search_radius Radius of the sphere.
+    /// \return Tuple of the filtered point cloud and the {n} Bool mask of the
+    /// kept points.
+    std::tuple<PointCloud, core::Tensor> RemoveRadiusOutliers(
+            size_t nb_points, double search_radius) const;
+
+    /// \brief Removes the points that are further away from their nb_neighbors
+    /// nearest neighbors than the average, like the legacy
+    /// PointCloud::RemoveStatisticalOutliers(), on the device of the point
+    /// cloud.
+    /// \param nb_neighbors Number of neighbors used to compute the average
+    /// distance of a point, the point itself included.
+    /// \param std_ratio Threshold on the average distance, in standard
+    /// deviations above the mean over the point cloud.
+    /// \return Tuple of the filtered point cloud and the {n} Bool mask of the
+    /// kept points.
+    std::tuple<PointCloud, core::Tensor> RemoveStatisticalOutliers(
+            size_t nb_neighbors, double std_ratio) const;
+
+    /// \brief Computes the distance of every point to its nearest neighbor in
+    /// \p target, like the legacy PointCloud::ComputePointCloudDistance(), on
+    /// the device of the point cloud.
+    ///
+    /// The nearest neighbors are found with a knn index over \p target, see
+    /// core::nns::NearestNeighborSearch::KnnIndex(), which is queried with
+    /// \p chunk_size points at a time to bound the memory of the search.
+    /// \param target Point cloud on the same device.
+    /// \param chunk_size Number of points queried at a time.
+    /// \return Tuple of the distances {n}, with the dtype of the points, and
+    /// the Int64 indices {n} of the nearest points in \p target. Without
+    /// target points the distances are infinite and the indices -1.
+    std::tuple<core::Tensor, core::Tensor> ComputePointCloudDistance(
+            const PointCloud &target, int64_t chunk_size = 1 << 20) const;
+
+    /// \brief Computes the distance of every point to the surface of \p mesh
+    /// on the device of the point cloud.
+    ///
+    /// The closest points are found with a RaycastingScene on the device,
+    /// i.e. with Embree on the CPU and a bounding volume hierarchy on CUDA
+    /// devices, which is queried with \p chunk_size points at a time. The
+    /// queries use Float32.
+    /// \param mesh Triangle mesh on the same device.
+    /// \param chunk_size Number of points queried at a time.
+    /// \return Tuple of the Float32 distances {n} and the Int64 indices {n}
+    /// of the closest triangles of \p mesh. Without triangles the distances
+    /// are infinite and the indices -1.
+    std::tuple<core::Tensor, core::Tensor> ComputeMeshDistance(
+            const TriangleMesh &mesh, int64_t chunk_size = 1 << 20) const;
+
+    /// \brief Removes the points that are hidden in a pinhole camera view by
+    /// screen-space occlusion on the device of the point cloud, a fast
+    /// alternative to the exact legacy PointCloud::HiddenPointRemoval() for
+    /// per-frame visibility culling.
+    ///
+    /// The points are splatted to a depth buffer of the image, keeping the
+    /// minimum depth per pixel, and a min depth pyramid is built over it. A
+    /// point is hidden if a point closer by more than \p depth_tolerance
+    /// times its depth projects within \p splat_radius pixels of it. The test
+    /// reads the 2 x 2 cells of the first pyramid level that cover the splat,
+    /// so its cost does not depend on the radius, and the occluders are
+    /// searched conservatively in up to twice the radius.
+    /// \param width Width of the image.
+    /// \param height Height of the image.
+    /// \param intrinsics Intrinsic matrix of shape {3, 3}.
+    /// \param extrinsics Extrinsic matrix of shape {4, 4}.
+    /// \param splat_radius Radius of the splats in pixels, which should cover
+    /// the gaps between the projected points of a surface.
+    /// \param depth_tolerance Relative depth below which points do not occlude
+    /// each other, which keeps the points of a surface seen at an angle.
+    /// \param depth_max Points beyond this depth are removed.
+    /// \return Tuple of the visible point cloud and the {n} Bool mask of the
+    /// visible points. Points outside the image or behind the camera are not
+    /// visible.
+    std::tuple<PointCloud, core::Tensor> RemoveHiddenPoints(
+            int width,
+            int height,
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics = core::Tensor::Eye(
+                    4, core::Dtype::Float32, core::Device("CPU:0")),
+            int splat_radius = 2,
+            float depth_tolerance = 0.01f,
+            float depth_max = std::numeric_limits<float>::infinity()) const;
+
+    /// \brief Estimates the covariance of the neighborhood of each point and
+    /// stores it in the "covariances" point attribute, of shape {n, 3, 3}.
+    ///
+    /// Neighbors are found by hybrid search if both max_knn and radius are
+    /// given, by knn search if only max_knn is given, and by fixed radius
+    /// search if only radius is given. Points with less than 3 neighbors get a
+    /// zero covariance.
+    /// \param max_knn Maximum number of neighbors.
+    /// \param radius Neighborhood radius.
+    void EstimateCovariances(
+            const utility::optional<int> max_knn = 30,
+            const utility::optional<double> radius = utility::nullopt);
+
+    /// \brief Estimates the point normals from the covariances of their
+    /// neighborhoods, on the device of the point cloud.
+    ///
+    /// The covariances are computed by EstimateCovariances() and kept in the
+    /// "covariances" attribute, so that they can be reused, e.g. by
+    /// registration. If neither max_knn nor radius is given, the existing
+    /// "covariances" attribute is used. If the point cloud has normals, the
+    /// estimated normals are oriented consistently with them.
+    /// \param max_knn Maximum number of neighbors.
+    /// \param radius Neighborhood radius.
+    void EstimateNormals(
+            const utility::optional<int> max_knn = 30,
+            const utility::optional<double> radius = utility::nullopt);
+
+    /// \brief Estimates the gradient of the point intensities, the mean of
+    /// the color channels, in the tangent plane of each point, and stores it
+    /// in the "color_gradients" point attribute, of shape {n, 3}.
+    ///
+    /// The gradients are fitted to the neighbors found like in
+    /// EstimateCovariances(), as in the legacy ColoredICP, and are used by the
+    /// tensor colored ICP. Points with less than 4 neighbors get a zero
+    /// gradient. Requires normals and colors.
+    /// \param max_knn Maximum number of neighbors.
+    /// \param radius Neighborhood radius.
+    void EstimateColorGradients(
+            const utility::optional<int> max_knn = 30,
+            const utility::optional<double> radius = utility::nullopt);
+
+    /// \brief Flips the normals to have a non-negative dot product with
+    /// orientation_reference. Zero normals are set to orientation_reference.
+    /// \param orientation_reference Direction of shape {3}.
+    void OrientNormalsToAlignWithDirection(
+            const core::Tensor &orientation_reference =
+                    core::Tensor::Init<float>({0, 0, 1}));
+
+    /// \brief Flips the normals to point towards camera_location.
+    /// \param camera_location Location of shape {3}.
+    void OrientNormalsTowardsCameraLocation(
+            const core::Tensor &camera_location =
+                    core::Tensor::Zeros({3}, core::Dtype::Float32));
+
+    /// \brief Orients the normals consistently along a minimum spanning tree
+    /// of the k nearest neighbor graph, whose edges are weighted by
+    /// 1 - |n0 . n1| as in the legacy PointCloud.
+    ///
+    /// The neighbors and the edge weights are computed on the device of the
+    /// point cloud, the spanning forest and its traversal in parallel on the
+    /// CPU. Unlike the legacy version, the graph does not contain the
+    /// Euclidean MST of the Delaunay triangulation, so each tree of the
+    /// forest is oriented separately, starting with its highest point, whose
+    /// normal is oriented towards +z.
+    /// \param k Number of nearest neighbors.
+    void OrientNormalsConsistentTangentPlane(size_t k);
+
     /// \brief Returns the device attribute of this PointCloud.
     core::Device GetDevice() const { return device_; }
 
@@ -393,12 +621,59 @@ public:
             int stride = 1,
             bool with_normals = false);
 
+    /// \brief Factory function to create a voxel downsampled pointcloud from a
+    /// depth image and a camera model.
+    ///
+    /// Equivalent to CreateFromDepthImage() followed by a voxel downsampling,
+    /// except that each voxel gets the average of its points instead of its
+    /// corner. The pixels are unprojected, truncated, transformed and
+    /// aggregated per voxel in a core::Hashmap, without creating the full
+    /// resolution point cloud.
+    ///
+    /// \param voxel_size Voxel size. A positive number.
+    /// \param backend Backend of the hashmap aggregating the voxels.
+    /// See CreateFromDepthImage() for the other parameters.
+    static PointCloud CreateFromDepthImageVoxelDownSample(
+            const Image &depth,
+            const core::Tensor &intrinsics,
+            double voxel_size,
+            const core::Tensor &extrinsics = core::Tensor::Eye(
+                    4, core::Dtype::Float32, core::Device("CPU:0")),
+            float depth_scale = 1000.0f,
+            float depth_max = 3.0f,
+            int stride = 1,
+            const core::HashmapBackend &backend =
+                    core::HashmapBackend::Default);
+
+    /// \brief Factory function to create a voxel downsampled pointcloud from
+    /// an RGB-D image and a camera model, with the averaged colors of the
+    /// voxels. See CreateFromDepthImageVoxelDownSample().
+    static PointCloud CreateFromRGBDImageVoxelDownSample(
+            const RGBDImage &rgbd_image,
+            const core::Tensor &intrinsics,
+            double voxel_size,
+            const core::Tensor &extrinsics = core::Tensor::Eye(
+                    4, core::Dtype::Float32, core::Device("CPU:0")),
+            float depth_scale = 1000.0f,
+            float depth_max = 3.0f,
+            int stride = 1,
+            const core::HashmapBackend &backend =
+                    core::HashmapBackend::Default);
+
     /// Create a PointCloud from a legacy Open3D PointCloud.
     static PointCloud FromLegacyPointCloud(
             const open3d::geometry::PointCloud &pcd_legacy,
             core::Dtype dtype = core::Dtype::Float32,
             const core::Device &device = core::Device("CPU:0"));
 
+    /// Create a PointCloud from a legacy Open3D PointCloud, taking over its
+    /// points, colors and normals. With Float64 \p dtype on a CPU \p device
+    /// the attributes alias the legacy vectors' storage without copying.
+    static PointCloud FromLegacyPointCloud(
+            open3d::geometry::PointCloud &&pcd_legacy,
+            core::Dtype dtype = core::Dtype::Float32,
+            const core::Device &device = core::Device("CPU:0"));
+
     /// Convert to a legacy Open3D PointCloud.
     open3d::geometry::PointCloud ToLegacyPointCloud() const;
 
@@ -422,7 +697,58 @@ public:
             float depth_scale = 1000.0f,
             float depth_max = 3.0f);
 
+    /// \brief Projects the point cloud to the depth images of a batch of
+    /// views in one pass, into preallocated tensors on the device of the
+    /// point cloud.
+    ///
+    /// Each point covers the pixels within \p splat_radius of the pixel it
+    /// projects to. With a zero \p depth_tolerance a pixel gets the depth of
+    /// the nearest point, like ProjectToDepthImage(). Otherwise the depths of
+    /// the points within \p depth_tolerance times the nearest depth are
+    /// averaged (soft z-buffering), which reduces the noise of the splats.
+    /// \param depth Contiguous Float32 depth images of shape
+    /// {v, height, width, 1}, which are overwritten. Empty pixels are 0.
+    /// \param intrinsics Intrinsic matrices of shape {v, 3, 3}, or {3, 3} for
+    /// all views.
+    /// \param extrinsics Extrinsic matrices of shape {v, 4, 4}, or {4, 4} for
+    /// all views.
+    /// \param depth_scale Scale of the depth values.
+    /// \param depth_max Points beyond this depth are not projected.
+    /// \param splat_radius Radius of the splats in pixels.
+    /// \param depth_tolerance Relative depth tolerance of the soft z-buffer.
+    void ProjectToDepthImages(core::Tensor &depth,
+                              const core::Tensor &intrinsics,
+                              const core::Tensor &extrinsics,
+                              float depth_scale = 1000.0f,
+                              float depth_max = 3.0f,
+                              int splat_radius = 0,
+                              float depth_tolerance = 0.0f) const;
+
+    /// \brief Projects the point cloud to the RGBD images of a batch of
+    /// views in one pass, like ProjectToDepthImages(). The color of a pixel
+    /// is the average color of the points that contribute to its depth.
+    /// \param color Contiguous UInt8 color images of shape
+    /// {v, height, width, 3}, which are overwritten. Empty pixels are black.
+    void ProjectToRGBDImages(core::Tensor &depth,
+                             core::Tensor &color,
+                             const core::Tensor &intrinsics,
+                             const core::Tensor &extrinsics,
+                             float depth_scale = 1000.0f,
+                             float depth_max = 3.0f,
+                             int splat_radius = 0,
+                             float depth_tolerance = 0.0f) const;
+
 protected:
+    void ProjectToImages(
+            core::Tensor &depth,
+            utility::optional<std::reference_wrapper<core::Tensor>> color,
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics,
+            float depth_scale,
+            float depth_max,
+            int splat_radius,
+            float depth_tolerance) const;
+
     core::Device device_ = core::Device("CPU:0");
     TensorMap point_attr_;
 };
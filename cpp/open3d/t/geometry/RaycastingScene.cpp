@@ -34,10 +34,15 @@
 #include <embree3/rtcore.h>
 #include <tutorials/common/math/closest_point.h>
 
-#include <Eigen/Core>
+#include <Eigen/Dense>
+#include <mutex>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
+#include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/geometry/kernel/RaycastingScene.h"
+#include "open3d/t/io/TensorMapIO.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
 
@@ -110,10 +115,14 @@ void CountIntersectionsFunc(const RTCFilterFunctionNArguments* args) {
         RTCHit hit = rtcGetHitFromHitN(hitN, N, ui);
 
         unsigned int ray_id = ray.id;
-        std::tuple<uint32_t, uint32_t, float> gpID(hit.geomID, hit.primID,
+        // Hits of instances are identified by the instance ID.
+        const uint32_t geom_id = hit.instID[0] != RTC_INVALID_GEOMETRY_ID
+                                         ? hit.instID[0]
+                                         : hit.geomID;
+        std::tuple<uint32_t, uint32_t, float> gpID(geom_id, hit.primID,
                                                    ray.tfar);
         auto& prev_gpIDtfar = previous_geom_prim_ID_tfar->operator[](ray_id);
-        if (std::get<0>(prev_gpIDtfar) != hit.geomID ||
+        if (std::get<0>(prev_gpIDtfar) != geom_id ||
             (std::get<1>(prev_gpIDtfar) != hit.primID &&
              std::get<2>(prev_gpIDtfar) != ray.tfar)) {
             ++(intersections[ray_id]);
@@ -124,68 +133,113 @@ void CountIntersectionsFunc(const RTCFilterFunctionNArguments* args) {
     }
 }
 
+typedef Eigen::Matrix<float, 4, 4, Eigen::DontAlign> Transform;
+
+// Information about a geometry of the scene.
+struct GeometryInfo {
+    // False if the geometry has been removed from the scene.
+    bool valid;
+    // True for instances of a triangle mesh of the scene.
+    bool instance;
+    // The vertex and index buffers of the (instanced) triangle mesh in Embree
+    // scenes.
+    const float* vertices;
+    const uint32_t* triangles;
+    int64_t num_triangles;
+    // The {n, 9} triangle vertices of the (instanced) mesh in CUDA scenes.
+    open3d::core::Tensor triangle_vertices;
+    // The instance to world transformation and the corresponding normal
+    // transformation, identities for triangle meshes.
+    Transform transform;
+    Eigen::Matrix3f normal_transform;
+};
+
+// Returns the Float32 4x4 transformation \p transform as Eigen matrix.
+Transform ToTransform(const open3d::core::Tensor& transform) {
+    transform.AssertShape({4, 4});
+    open3d::core::Tensor data =
+            transform
+                    .To(open3d::core::Device("CPU:0"),
+                        open3d::core::Dtype::Float32)
+                    .Contiguous();
+    return Eigen::Map<const Eigen::Matrix<float, 4, 4, Eigen::RowMajor>>(
+            data.GetDataPtr<float>());
+}
+
+embree::Vec3fa TransformPoint(const Transform& transform,
+                              const embree::Vec3fa& p) {
+    const Eigen::Vector3f x =
+            transform.topLeftCorner<3, 3>() * Eigen::Vector3f(p.x, p.y, p.z) +
+            transform.topRightCorner<3, 1>();
+    return embree::Vec3fa(x(0), x(1), x(2));
+}
+
 struct ClosestPointResult {
     ClosestPointResult()
         : primID(RTC_INVALID_GEOMETRY_ID),
           geomID(RTC_INVALID_GEOMETRY_ID),
-          geometry_ptrs_ptr() {}
+          geometries_ptr() {}
 
     embree::Vec3f p;
     unsigned int primID;
     unsigned int geomID;
-    std::vector<std::tuple<RTCGeometryType, const void*, const void*>>*
-            geometry_ptrs_ptr;
+    const std::vector<GeometryInfo>* geometries_ptr;
 };
 
 // Code adapted from the embree closest_point tutorial.
 bool ClosestPointFunc(RTCPointQueryFunctionArguments* args) {
     using namespace embree;
     assert(args->userPtr);
-    const unsigned int geomID = args->geomID;
     const unsigned int primID = args->primID;
+    // Primitives of instances are identified by the instance ID.
+    const bool instanced = args->context->instStackSize > 0;
+    const unsigned int geomID =
+            instanced ? args->context->instID[0] : args->geomID;
 
-    // query position in world space
+    // Query position in world space, or in instance space if the instance
+    // transformation is a similarity transformation.
     Vec3fa q(args->query->x, args->query->y, args->query->z);
 
     ClosestPointResult* result =
             static_cast<ClosestPointResult*>(args->userPtr);
-    const RTCGeometryType geom_type =
-            std::get<0>(result->geometry_ptrs_ptr->operator[](geomID));
-    const void* ptr1 =
-            std::get<1>(result->geometry_ptrs_ptr->operator[](geomID));
-    const void* ptr2 =
-            std::get<2>(result->geometry_ptrs_ptr->operator[](geomID));
-
-    if (RTC_GEOMETRY_TYPE_TRIANGLE == geom_type) {
-        const float* vertices = (const float*)ptr1;
-        const uint32_t* triangles = (const uint32_t*)ptr2;
-
-        Vec3fa v0(vertices[3 * triangles[3 * primID + 0] + 0],
-                  vertices[3 * triangles[3 * primID + 0] + 1],
-                  vertices[3 * triangles[3 * primID + 0] + 2]);
-        Vec3fa v1(vertices[3 * triangles[3 * primID + 1] + 0],
-                  vertices[3 * triangles[3 * primID + 1] + 1],
-                  vertices[3 * triangles[3 * primID + 1] + 2]);
-        Vec3fa v2(vertices[3 * triangles[3 * primID + 2] + 0],
-                  vertices[3 * triangles[3 * primID + 2] + 1],
-                  vertices[3 * triangles[3 * primID + 2] + 2]);
-
-        // Determine distance to closest point on triangle (implemented in
-        // common/math/closest_point.h).
-        const Vec3fa p = closestPointTriangle(q, v0, v1, v2);
-        float d = distance(q, p);
-
-        // Store result in userPtr and update the query radius if we found a
-        // point closer to the query position. This is optional but allows for
-        // faster traversal (due to better culling).
-        if (d < args->query->radius) {
-            args->query->radius = d;
-            result->p = p;
-            result->primID = primID;
-            result->geomID = geomID;
-            return true;  // Return true to indicate that the query radius
-                          // changed.
-        }
+    const GeometryInfo& info = result->geometries_ptr->operator[](geomID);
+    const float* vertices = info.vertices;
+    const uint32_t* triangles = info.triangles;
+
+    Vec3fa v0(vertices[3 * triangles[3 * primID + 0] + 0],
+              vertices[3 * triangles[3 * primID + 0] + 1],
+              vertices[3 * triangles[3 * primID + 0] + 2]);
+    Vec3fa v1(vertices[3 * triangles[3 * primID + 1] + 0],
+              vertices[3 * triangles[3 * primID + 1] + 1],
+              vertices[3 * triangles[3 * primID + 1] + 2]);
+    Vec3fa v2(vertices[3 * triangles[3 * primID + 2] + 0],
+              vertices[3 * triangles[3 * primID + 2] + 1],
+              vertices[3 * triangles[3 * primID + 2] + 2]);
+
+    // For other instance transformations the query stays in world space and
+    // the triangle has to be transformed.
+    const bool in_world_space = !instanced || args->similarityScale <= 0;
+    if (instanced && in_world_space) {
+        v0 = TransformPoint(info.transform, v0);
+        v1 = TransformPoint(info.transform, v1);
+        v2 = TransformPoint(info.transform, v2);
+    }
+
+    // Determine distance to closest point on triangle (implemented in
+    // common/math/closest_point.h).
+    const Vec3fa p = closestPointTriangle(q, v0, v1, v2);
+    float d = distance(q, p);
+
+    // Store result in userPtr and update the query radius if we found a
+    // point closer to the query position. This is optional but allows for
+    // faster traversal (due to better culling).
+    if (d < args->query->radius) {
+        args->query->radius = d;
+        result->p = in_world_space ? p : TransformPoint(info.transform, p);
+        result->primID = primID;
+        result->geomID = geomID;
+        return true;  // Return true to indicate that the query radius
+                      // changed.
     }
     return false;
 }
@@ -200,89 +254,289 @@ struct RaycastingScene::Impl {
     RTCDevice device_;
     RTCScene scene_;
     bool scene_committed_;  // true if the scene has been committed.
-    // Vector for storing some information about the added geometry.
-    std::vector<std::tuple<RTCGeometryType, const void*, const void*>>
-            geometry_ptrs_;
-    core::Device tensor_device_;  // cpu
+    BuildQuality build_quality_;
+    // True if the native BVH has been loaded with LoadBVH().
+    bool loaded_ = false;
+    // Serializes the lazy commit of concurrent queries, which may run from
+    // several Python threads since the bindings release the GIL.
+    std::mutex commit_mutex_;
+    // The geometries of the scene indexed by geometry ID.
+    std::vector<GeometryInfo> geometries_;
+    // Embree scenes with a single triangle mesh of the scene, which are
+    // instanced by the instances of the mesh.
+    std::unordered_map<uint32_t, RTCScene> mesh_scenes_;
+    core::Device tensor_device_;
+
+    // Native BVH of CUDA scenes. The triangles of all geometries are stored
+    // as {n, 9} vertex tensors, sorted by leaf once committed.
+    core::Tensor node_bounds_;
+    core::Tensor node_children_;
+    core::Tensor triangle_vertices_;
+    core::Tensor triangle_geometry_ids_;
+    core::Tensor triangle_primitive_ids_;
+
+    bool UseBVH() const {
+        return loaded_ ||
+               tensor_device_.GetType() == core::Device::DeviceType::CUDA;
+    }
 
-    template <bool LINE_INTERSECTION>
-    void CastRays(const float* const rays,
-                  const size_t num_rays,
-                  float* t_hit,
-                  unsigned int* geometry_ids,
-                  unsigned int* primitive_ids,
-                  float* primitive_uvs,
-                  float* primitive_normals) {
+    // Loaded scenes only have the BVH and no geometries.
+    void AssertNotLoaded() const {
+        if (loaded_) {
+            utility::LogError(
+                    "Geometries cannot be added to, moved in or removed from "
+                    "a scene loaded with LoadBVH().");
+        }
+    }
+
+    RTCBuildQuality GetRTCBuildQuality() const {
+        switch (build_quality_) {
+            case BuildQuality::Low:
+                return RTC_BUILD_QUALITY_LOW;
+            case BuildQuality::High:
+                return RTC_BUILD_QUALITY_HIGH;
+            default:
+                return RTC_BUILD_QUALITY_MEDIUM;
+        }
+    }
+
+    // Returns the geometry \p geometry_id, which must be part of the scene.
+    GeometryInfo& GetGeometry(uint32_t geometry_id) {
+        if (geometry_id >= geometries_.size() ||
+            !geometries_[geometry_id].valid) {
+            utility::LogError("Invalid geometry ID {}.", geometry_id);
+        }
+        return geometries_[geometry_id];
+    }
+
+    // Builds the scene with per geometry acceleration structures, which are
+    // kept when other geometries are moved or removed.
+    void EnableDynamicUpdates() {
+        rtcSetSceneFlags(scene_,
+                         RTC_SCENE_FLAG_ROBUST |
+                                 RTC_SCENE_FLAG_CONTEXT_FILTER_FUNCTION |
+                                 RTC_SCENE_FLAG_DYNAMIC);
+    }
+
+    // Commits the Embree scene if it changed since the last query.
+    void CommitScene() {
+        std::lock_guard<std::mutex> lock(commit_mutex_);
         if (!scene_committed_) {
             rtcCommitScene(scene_);
             scene_committed_ = true;
         }
+    }
 
-        struct RTCIntersectContext context;
-        rtcInitIntersectContext(&context);
+    // Builds the native BVH over the triangles of the valid geometries on
+    // the host and copies it to the device of the scene. Triangles of
+    // instances are transformed to world space.
+    void BuildBVH(core::Tensor& node_bounds,
+                  core::Tensor& node_children,
+                  core::Tensor& triangle_vertices,
+                  core::Tensor& triangle_geometry_ids,
+                  core::Tensor& triangle_primitive_ids) const {
+        const core::Device host("CPU:0");
+        int64_t num_triangles = 0;
+        for (const GeometryInfo& info : geometries_) {
+            if (info.valid) {
+                num_triangles += info.num_triangles;
+            }
+        }
+        core::Tensor vertices({num_triangles, 9}, core::Dtype::Float32, host);
+        core::Tensor geometry_ids({num_triangles}, core::Dtype::Int64, host);
+        core::Tensor primitive_ids({num_triangles}, core::Dtype::Int64, host);
+        int64_t offset = 0;
+        for (size_t g = 0; g < geometries_.size(); ++g) {
+            const GeometryInfo& info = geometries_[g];
+            if (!info.valid) {
+                continue;
+            }
+            const int64_t n = info.num_triangles;
+            if (info.vertices != nullptr) {
+                // Gather the vertices from the buffers of Embree scenes.
+                float* dst = vertices.GetDataPtr<float>() + offset * 9;
+#pragma omp parallel for schedule(static)
+                for (int64_t i = 0; i < n; ++i) {
+                    for (int k = 0; k < 3; ++k) {
+                        const float* v =
+                                info.vertices + 3 * info.triangles[3 * i + k];
+                        std::copy(v, v + 3, dst + 9 * i + 3 * k);
+                    }
+                }
+            } else {
+                vertices.Slice(0, offset, offset + n) =
+                        info.triangle_vertices.To(host);
+            }
+            if (info.instance) {
+                Eigen::Map<Eigen::Matrix3Xf> points(
+                        vertices.GetDataPtr<float>() + offset * 9, 3, n * 3);
+                points = (info.transform.topLeftCorner<3, 3>() * points)
+                                 .colwise() +
+                         info.transform.topRightCorner<3, 1>();
+            }
+            geometry_ids.Slice(0, offset, offset + n).Fill(int64_t(g));
+            primitive_ids.Slice(0, offset, offset + n) =
+                    core::Tensor::Arange(0, n, 1, core::Dtype::Int64, host);
+            offset += n;
+        }
 
-        std::vector<RTCRayHit> rayhits(std::min(num_rays, MAX_BATCH_SIZE));
+        core::Tensor triangle_order;
+        kernel::raycasting_scene::BuildBVH(
+                vertices, node_bounds, node_children, triangle_order,
+                build_quality_ == BuildQuality::High);
+        node_bounds = node_bounds.To(tensor_device_);
+        node_children = node_children.To(tensor_device_);
+        triangle_vertices =
+                vertices.IndexGet({triangle_order}).To(tensor_device_);
+        triangle_geometry_ids =
+                geometry_ids.IndexGet({triangle_order})
+                        .To(tensor_device_, core::Dtype::UInt32);
+        triangle_primitive_ids =
+                primitive_ids.IndexGet({triangle_order})
+                        .To(tensor_device_, core::Dtype::UInt32);
+    }
 
-        const int num_batches = utility::DivUp(num_rays, rayhits.size());
+    void CommitBVH() {
+        std::lock_guard<std::mutex> lock(commit_mutex_);
+        if (scene_committed_) {
+            return;
+        }
+        BuildBVH(node_bounds_, node_children_, triangle_vertices_,
+                 triangle_geometry_ids_, triangle_primitive_ids_);
+        scene_committed_ = true;
+    }
 
-        for (int n = 0; n < num_batches; ++n) {
-            size_t start_idx = n * rayhits.size();
-            size_t end_idx = std::min(num_rays, (n + 1) * rayhits.size());
+    // Maps the triangle indices of the BVH kernels to per triangle ids,
+    // INVALID_ID for -1.
+    core::Tensor LookUpIds(const core::Tensor& ids,
+                           const core::Tensor& triangle_indices) const {
+        core::Tensor result = core::Tensor::Full<uint32_t>(
+                triangle_indices.GetShape(), RTC_INVALID_GEOMETRY_ID,
+                core::Dtype::UInt32, tensor_device_);
+        core::Tensor valid = triangle_indices.Ge(0);
+        result.IndexSet({valid},
+                        ids.IndexGet({triangle_indices.IndexGet({valid})}));
+        return result;
+    }
 
-            for (size_t i = start_idx; i < end_idx; ++i) {
-                RTCRayHit& rh = rayhits[i - start_idx];
-                const float* r = &rays[i * 6];
-                rh.ray.org_x = r[0];
-                rh.ray.org_y = r[1];
-                rh.ray.org_z = r[2];
-                if (LINE_INTERSECTION) {
-                    rh.ray.dir_x = r[3] - r[0];
-                    rh.ray.dir_y = r[4] - r[1];
-                    rh.ray.dir_z = r[5] - r[2];
-                } else {
-                    rh.ray.dir_x = r[3];
-                    rh.ray.dir_y = r[4];
-                    rh.ray.dir_z = r[5];
-                }
-                rh.ray.tnear = 0;
-                if (LINE_INTERSECTION) {
-                    rh.ray.tfar = 1.f;
+    /// Rays with \p grid_width > 0 are rows of an image and are traced in
+    /// square tiles as coherent streams, other rays in chunks of consecutive
+    /// rays. Tiles and chunks are distributed over the threads.
+    template <bool LINE_INTERSECTION>
+    void CastRays(const float* const rays,
+                  const size_t num_rays,
+                  float* t_hit,
+                  unsigned int* geometry_ids,
+                  unsigned int* primitive_ids,
+                  float* primitive_uvs,
+                  float* primitive_normals,
+                  const int64_t grid_width = 0) {
+        CommitScene();
+
+        const int64_t tile_size = 8;
+        const int64_t chunk_size = 4096;
+        const bool coherent = grid_width > 0;
+        const int64_t grid_height = coherent ? num_rays / grid_width : 0;
+        const int64_t tiles_x = (grid_width + tile_size - 1) / tile_size;
+        const int64_t tiles_y = (grid_height + tile_size - 1) / tile_size;
+        const int64_t num_work_items =
+                coherent ? tiles_x * tiles_y
+                         : (int64_t(num_rays) + chunk_size - 1) / chunk_size;
+
+#pragma omp parallel
+        {
+            struct RTCIntersectContext context;
+            rtcInitIntersectContext(&context);
+            context.flags = coherent ? RTC_INTERSECT_CONTEXT_FLAG_COHERENT
+                                     : RTC_INTERSECT_CONTEXT_FLAG_INCOHERENT;
+
+            std::vector<size_t> ray_ids;
+            std::vector<RTCRayHit> rayhits;
+#pragma omp for schedule(dynamic)
+            for (int64_t item = 0; item < num_work_items; ++item) {
+                ray_ids.clear();
+                if (coherent) {
+                    const int64_t x0 = (item % tiles_x) * tile_size;
+                    const int64_t y0 = (item / tiles_x) * tile_size;
+                    const int64_t x1 = std::min(x0 + tile_size, grid_width);
+                    const int64_t y1 = std::min(y0 + tile_size, grid_height);
+                    for (int64_t y = y0; y < y1; ++y) {
+                        for (int64_t x = x0; x < x1; ++x) {
+                            ray_ids.push_back(y * grid_width + x);
+                        }
+                    }
                 } else {
-                    rh.ray.tfar = std::numeric_limits<float>::infinity();
+                    const size_t begin = item * chunk_size;
+                    const size_t end = std::min(num_rays, begin + chunk_size);
+                    for (size_t i = begin; i < end; ++i) {
+                        ray_ids.push_back(i);
+                    }
                 }
-                rh.ray.mask = 0;
-                rh.ray.id = i - start_idx;
-                rh.ray.flags = 0;
-                rh.hit.geomID = RTC_INVALID_GEOMETRY_ID;
-                rh.hit.instID[0] = RTC_INVALID_GEOMETRY_ID;
-            }
 
-            rtcIntersect1M(scene_, &context, &rayhits[0], end_idx - start_idx,
-                           sizeof(RTCRayHit));
+                rayhits.resize(ray_ids.size());
+                for (size_t j = 0; j < ray_ids.size(); ++j) {
+                    RTCRayHit& rh = rayhits[j];
+                    const float* r = &rays[ray_ids[j] * 6];
+                    rh.ray.org_x = r[0];
+                    rh.ray.org_y = r[1];
+                    rh.ray.org_z = r[2];
+                    if (LINE_INTERSECTION) {
+                        rh.ray.dir_x = r[3] - r[0];
+                        rh.ray.dir_y = r[4] - r[1];
+                        rh.ray.dir_z = r[5] - r[2];
+                    } else {
+                        rh.ray.dir_x = r[3];
+                        rh.ray.dir_y = r[4];
+                        rh.ray.dir_z = r[5];
+                    }
+                    rh.ray.tnear = 0;
+                    if (LINE_INTERSECTION) {
+                        rh.ray.tfar = 1.f;
+                    } else {
+                        rh.ray.tfar = std::numeric_limits<float>::infinity();
+                    }
+                    rh.ray.mask = 0;
+                    rh.ray.id = j;
+                    rh.ray.flags = 0;
+                    rh.hit.geomID = RTC_INVALID_GEOMETRY_ID;
+                    rh.hit.instID[0] = RTC_INVALID_GEOMETRY_ID;
+                }
 
-            for (size_t i = start_idx; i < end_idx; ++i) {
-                RTCRayHit rh = rayhits[i - start_idx];
-                size_t idx = rh.ray.id + start_idx;
-                t_hit[idx] = rh.ray.tfar;
-                if (rh.hit.geomID != RTC_INVALID_GEOMETRY_ID) {
-                    geometry_ids[idx] = rh.hit.geomID;
-                    primitive_ids[idx] = rh.hit.primID;
-                    primitive_uvs[idx * 2 + 0] = rh.hit.u;
-                    primitive_uvs[idx * 2 + 1] = rh.hit.v;
-                    float inv_norm = 1.f / std::sqrt(rh.hit.Ng_x * rh.hit.Ng_x +
-                                                     rh.hit.Ng_y * rh.hit.Ng_y +
-                                                     rh.hit.Ng_z * rh.hit.Ng_z);
-                    primitive_normals[idx * 3 + 0] = rh.hit.Ng_x * inv_norm;
-                    primitive_normals[idx * 3 + 1] = rh.hit.Ng_y * inv_norm;
-                    primitive_normals[idx * 3 + 2] = rh.hit.Ng_z * inv_norm;
-                } else {
-                    geometry_ids[idx] = RTC_INVALID_GEOMETRY_ID;
-                    primitive_ids[idx] = RTC_INVALID_GEOMETRY_ID;
-                    primitive_uvs[idx * 2 + 0] = 0;
-                    primitive_uvs[idx * 2 + 1] = 0;
-                    primitive_normals[idx * 3 + 0] = 0;
-                    primitive_normals[idx * 3 + 1] = 0;
-                    primitive_normals[idx * 3 + 2] = 0;
+                rtcIntersect1M(scene_, &context, rayhits.data(),
+                               rayhits.size(), sizeof(RTCRayHit));
+
+                for (const RTCRayHit& rh : rayhits) {
+                    size_t idx = ray_ids[rh.ray.id];
+                    t_hit[idx] = rh.ray.tfar;
+                    if (rh.hit.geomID != RTC_INVALID_GEOMETRY_ID) {
+                        // Hits of instances report the instance ID and the
+                        // normal in instance space.
+                        Eigen::Vector3f normal(rh.hit.Ng_x, rh.hit.Ng_y,
+                                               rh.hit.Ng_z);
+                        if (rh.hit.instID[0] != RTC_INVALID_GEOMETRY_ID) {
+                            geometry_ids[idx] = rh.hit.instID[0];
+                            normal = geometries_[rh.hit.instID[0]]
+                                             .normal_transform *
+                                     normal;
+                        } else {
+                            geometry_ids[idx] = rh.hit.geomID;
+                        }
+                        primitive_ids[idx] = rh.hit.primID;
+                        primitive_uvs[idx * 2 + 0] = rh.hit.u;
+                        primitive_uvs[idx * 2 + 1] = rh.hit.v;
+                        normal.normalize();
+                        primitive_normals[idx * 3 + 0] = normal(0);
+                        primitive_normals[idx * 3 + 1] = normal(1);
+                        primitive_normals[idx * 3 + 2] = normal(2);
+                    } else {
+                        geometry_ids[idx] = RTC_INVALID_GEOMETRY_ID;
+                        primitive_ids[idx] = RTC_INVALID_GEOMETRY_ID;
+                        primitive_uvs[idx * 2 + 0] = 0;
+                        primitive_uvs[idx * 2 + 1] = 0;
+                        primitive_normals[idx * 3 + 0] = 0;
+                        primitive_normals[idx * 3 + 1] = 0;
+                        primitive_normals[idx * 3 + 2] = 0;
+                    }
                 }
             }
         }
@@ -291,10 +545,7 @@ struct RaycastingScene::Impl {
     void CountIntersections(const float* const rays,
                             const size_t num_rays,
                             int* intersections) {
-        if (!scene_committed_) {
-            rtcCommitScene(scene_);
-            scene_committed_ = true;
-        }
+        CommitScene();
 
         memset(intersections, 0, sizeof(int) * num_rays);
 
@@ -347,12 +598,10 @@ struct RaycastingScene::Impl {
                               float* closest_points,
                               unsigned int* geometry_ids,
                               unsigned int* primitive_ids) {
-        if (!scene_committed_) {
-            rtcCommitScene(scene_);
-            scene_committed_ = true;
-        }
+        CommitScene();
 
-        for (size_t i = 0; i < num_query_points; ++i) {
+#pragma omp parallel for schedule(dynamic, 256)
+        for (int64_t i = 0; i < int64_t(num_query_points); ++i) {
             RTCPointQuery query;
             query.x = query_points[i * 3 + 0];
             query.y = query_points[i * 3 + 1];
@@ -361,7 +610,7 @@ struct RaycastingScene::Impl {
             query.time = 0.f;
 
             ClosestPointResult result;
-            result.geometry_ptrs_ptr = &geometry_ptrs_;
+            result.geometries_ptr = &geometries_;
 
             RTCPointQueryContext instStack;
             rtcInitPointQueryContext(&instStack);
@@ -377,7 +626,16 @@ struct RaycastingScene::Impl {
     }
 };
 
-RaycastingScene::RaycastingScene() : impl_(new RaycastingScene::Impl()) {
+RaycastingScene::RaycastingScene(const core::Device& device,
+                                 BuildQuality build_quality)
+    : impl_(new RaycastingScene::Impl()) {
+    if (device.GetType() != core::Device::DeviceType::CPU &&
+        device.GetType() != core::Device::DeviceType::CUDA) {
+        utility::LogError("Unsupported device {} for RaycastingScene.",
+                          device.ToString());
+    }
+    impl_->tensor_device_ = device;
+    impl_->build_quality_ = build_quality;
     impl_->device_ = rtcNewDevice(NULL);
     rtcSetDeviceErrorFunction(impl_->device_, ErrorFunction, NULL);
 
@@ -386,17 +644,22 @@ RaycastingScene::RaycastingScene() : impl_(new RaycastingScene::Impl()) {
     rtcSetSceneFlags(
             impl_->scene_,
             RTC_SCENE_FLAG_ROBUST | RTC_SCENE_FLAG_CONTEXT_FILTER_FUNCTION);
+    rtcSetSceneBuildQuality(impl_->scene_, impl_->GetRTCBuildQuality());
 
     impl_->scene_committed_ = false;
 }
 
 RaycastingScene::~RaycastingScene() {
     rtcReleaseScene(impl_->scene_);
+    for (auto& mesh_scene : impl_->mesh_scenes_) {
+        rtcReleaseScene(mesh_scene.second);
+    }
     rtcReleaseDevice(impl_->device_);
 }
 
 uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertices,
                                        const core::Tensor& triangles) {
+    impl_->AssertNotLoaded();
     vertices.AssertDevice(impl_->tensor_device_);
     vertices.AssertShapeCompatible({utility::nullopt, 3});
     vertices.AssertDtype(core::Dtype::Float32);
@@ -409,8 +672,25 @@ uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertices,
 
     // scene needs to be recommitted
     impl_->scene_committed_ = false;
+    const uint32_t geom_id = uint32_t(impl_->geometries_.size());
+    GeometryInfo info;
+    info.valid = true;
+    info.instance = false;
+    info.vertices = nullptr;
+    info.triangles = nullptr;
+    info.num_triangles = int64_t(num_triangles);
+    info.transform.setIdentity();
+    info.normal_transform.setIdentity();
+    if (impl_->UseBVH()) {
+        core::Tensor indices = triangles.To(core::Dtype::Int64).Reshape({-1});
+        info.triangle_vertices = vertices.IndexGet({indices}).Reshape(
+                {int64_t(num_triangles), 9});
+        impl_->geometries_.push_back(info);
+        return geom_id;
+    }
     RTCGeometry geom =
             rtcNewGeometry(impl_->device_, RTC_GEOMETRY_TYPE_TRIANGLE);
+    rtcSetGeometryBuildQuality(geom, impl_->GetRTCBuildQuality());
 
     // rtcSetNewGeometryBuffer will take care of alignment and padding
     float* vertex_buffer = (float*)rtcSetNewGeometryBuffer(
@@ -433,12 +713,14 @@ uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertices,
     }
     rtcCommitGeometry(geom);
 
-    uint32_t geom_id = rtcAttachGeometry(impl_->scene_, geom);
+    // IDs are assigned explicitly, since embree reuses the IDs of removed
+    // geometries.
+    rtcAttachGeometryByID(impl_->scene_, geom, geom_id);
     rtcReleaseGeometry(geom);
 
-    impl_->geometry_ptrs_.push_back(std::make_tuple(RTC_GEOMETRY_TYPE_TRIANGLE,
-                                                    (const void*)vertex_buffer,
-                                                    (const void*)index_buffer));
+    info.vertices = vertex_buffer;
+    info.triangles = index_buffer;
+    impl_->geometries_.push_back(info);
     return geom_id;
 }
 
@@ -453,6 +735,189 @@ uint32_t RaycastingScene::AddTriangles(const TriangleMesh& mesh) {
                         mesh.GetTriangles().To(core::Dtype::UInt32));
 }
 
+uint32_t RaycastingScene::AddInstance(uint32_t geometry_id,
+                                      const core::Tensor& transform) {
+    impl_->AssertNotLoaded();
+    GeometryInfo info = impl_->GetGeometry(geometry_id);
+    if (info.instance) {
+        utility::LogError("Geometry {} is an instance and cannot be instanced.",
+                          geometry_id);
+    }
+    info.instance = true;
+    info.transform = ToTransform(transform);
+    info.normal_transform =
+            info.transform.topLeftCorner<3, 3>().inverse().transpose();
+
+    impl_->scene_committed_ = false;
+    const uint32_t geom_id = uint32_t(impl_->geometries_.size());
+    if (impl_->UseBVH()) {
+        impl_->geometries_.push_back(info);
+        return geom_id;
+    }
+
+    // The mesh is shared by its instances through a scene of its own.
+    auto mesh_scene = impl_->mesh_scenes_.find(geometry_id);
+    if (mesh_scene == impl_->mesh_scenes_.end()) {
+        RTCScene scene = rtcNewScene(impl_->device_);
+        rtcSetSceneFlags(scene, RTC_SCENE_FLAG_ROBUST |
+                                        RTC_SCENE_FLAG_CONTEXT_FILTER_FUNCTION);
+        rtcSetSceneBuildQuality(scene, impl_->GetRTCBuildQuality());
+        rtcAttachGeometry(scene, rtcGetGeometry(impl_->scene_, geometry_id));
+        rtcCommitScene(scene);
+        mesh_scene = impl_->mesh_scenes_.emplace(geometry_id, scene).first;
+    }
+
+    RTCGeometry geom =
+            rtcNewGeometry(impl_->device_, RTC_GEOMETRY_TYPE_INSTANCE);
+    rtcSetGeometryInstancedScene(geom, mesh_scene->second);
+    rtcSetGeometryTransform(geom, 0, RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,
+                            info.transform.data());
+    rtcCommitGeometry(geom);
+    rtcAttachGeometryByID(impl_->scene_, geom, geom_id);
+    rtcReleaseGeometry(geom);
+    impl_->EnableDynamicUpdates();
+
+    impl_->geometries_.push_back(info);
+    return geom_id;
+}
+
+void RaycastingScene::SetTransform(uint32_t geometry_id,
+                                   const core::Tensor& transform) {
+    impl_->AssertNotLoaded();
+    GeometryInfo& info = impl_->GetGeometry(geometry_id);
+    if (!info.instance) {
+        utility::LogError(
+                "Geometry {} is not an instance. Only instances can be "
+                "transformed.",
+                geometry_id);
+    }
+    info.transform = ToTransform(transform);
+    info.normal_transform =
+            info.transform.topLeftCorner<3, 3>().inverse().transpose();
+
+    impl_->scene_committed_ = false;
+    if (impl_->UseBVH()) {
+        return;
+    }
+    RTCGeometry geom = rtcGetGeometry(impl_->scene_, geometry_id);
+    rtcSetGeometryTransform(geom, 0, RTC_FORMAT_FLOAT4X4_COLUMN_MAJOR,
+                            info.transform.data());
+    rtcCommitGeometry(geom);
+}
+
+void RaycastingScene::RemoveGeometry(uint32_t geometry_id) {
+    impl_->AssertNotLoaded();
+    GeometryInfo& info = impl_->GetGeometry(geometry_id);
+    info.valid = false;
+    info.triangle_vertices = core::Tensor();
+
+    impl_->scene_committed_ = false;
+    if (impl_->UseBVH()) {
+        return;
+    }
+    // Instances keep the scene of their mesh and the mesh alive.
+    auto mesh_scene = impl_->mesh_scenes_.find(geometry_id);
+    if (mesh_scene != impl_->mesh_scenes_.end()) {
+        rtcReleaseScene(mesh_scene->second);
+        impl_->mesh_scenes_.erase(mesh_scene);
+    }
+    rtcDetachGeometry(impl_->scene_, geometry_id);
+    impl_->EnableDynamicUpdates();
+}
+
+void RaycastingScene::SaveBVH(const std::string& file_name) {
+    TensorMap tensor_map("triangle_vertices");
+    if (impl_->UseBVH()) {
+        impl_->CommitBVH();
+        tensor_map["node_bounds"] = impl_->node_bounds_;
+        tensor_map["node_children"] = impl_->node_children_;
+        tensor_map["triangle_vertices"] = impl_->triangle_vertices_;
+        tensor_map["triangle_geometry_ids"] = impl_->triangle_geometry_ids_;
+        tensor_map["triangle_primitive_ids"] = impl_->triangle_primitive_ids_;
+    } else {
+        impl_->BuildBVH(tensor_map["node_bounds"], tensor_map["node_children"],
+                        tensor_map["triangle_vertices"],
+                        tensor_map["triangle_geometry_ids"],
+                        tensor_map["triangle_primitive_ids"]);
+    }
+    if (!t::io::WriteTensorMap(file_name, tensor_map)) {
+        utility::LogError("[RaycastingScene] Failed to save to {}.",
+                          file_name);
+    }
+}
+
+void RaycastingScene::LoadBVH(const std::string& file_name,
+                              core::Tensor::MmapMode mmap_mode) {
+    if (!impl_->geometries_.empty() || impl_->loaded_) {
+        utility::LogError(
+                "[RaycastingScene] LoadBVH() requires an empty scene.");
+    }
+    TensorMap tensor_map("triangle_vertices");
+    if (!t::io::ReadTensorMap(file_name, tensor_map, impl_->tensor_device_,
+                              mmap_mode)) {
+        utility::LogError("[RaycastingScene] Failed to load from {}.",
+                          file_name);
+    }
+    for (const std::string& key :
+         {"node_bounds", "node_children", "triangle_vertices",
+          "triangle_geometry_ids", "triangle_primitive_ids"}) {
+        if (!tensor_map.Contains(key)) {
+            utility::LogError(
+                    "[RaycastingScene] {} is not a BVH file, {} is missing.",
+                    file_name, key);
+        }
+    }
+    const core::Tensor& node_bounds = tensor_map["node_bounds"];
+    const core::Tensor& node_children = tensor_map["node_children"];
+    const core::Tensor& triangle_vertices = tensor_map["triangle_vertices"];
+    node_bounds.AssertShapeCompatible({utility::nullopt, 6});
+    node_bounds.AssertDtype(core::Dtype::Float32);
+    node_children.AssertShape({node_bounds.GetLength(), 2});
+    node_children.AssertDtype(core::Dtype::Int32);
+    triangle_vertices.AssertShapeCompatible({utility::nullopt, 9});
+    triangle_vertices.AssertDtype(core::Dtype::Float32);
+    const int64_t num_triangles = triangle_vertices.GetLength();
+    for (const std::string& key :
+         {"triangle_geometry_ids", "triangle_primitive_ids"}) {
+        tensor_map[key].AssertShape({num_triangles});
+        tensor_map[key].AssertDtype(core::Dtype::UInt32);
+    }
+
+    // The queries traverse the nodes without bounds checks. Children are
+    // stored after their parent, which also rules out cycles.
+    const int64_t num_nodes = node_children.GetLength();
+    const std::vector<int> children =
+            node_children.To(core::Device("CPU:0")).ToFlatVector<int>();
+    for (int64_t node = 0; node < num_nodes; ++node) {
+        const int64_t first = children[2 * node];
+        const int64_t second = children[2 * node + 1];
+        if (first >= 0) {
+            if (first <= node || second <= node || first >= num_nodes ||
+                second >= num_nodes) {
+                utility::LogError(
+                        "[RaycastingScene] Invalid BVH in {}, node {} has "
+                        "children ({}, {}) out of range for {} nodes.",
+                        file_name, node, first, second, num_nodes);
+            }
+        } else if (second < 0 || -1 - first + second > num_triangles) {
+            utility::LogError(
+                    "[RaycastingScene] Invalid BVH in {}, leaf {} has "
+                    "triangles [{}, {}) out of range for {} triangles.",
+                    file_name, node, -1 - first, -1 - first + second,
+                    num_triangles);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(impl_->commit_mutex_);
+    impl_->node_bounds_ = tensor_map["node_bounds"];
+    impl_->node_children_ = tensor_map["node_children"];
+    impl_->triangle_vertices_ = tensor_map["triangle_vertices"];
+    impl_->triangle_geometry_ids_ = tensor_map["triangle_geometry_ids"];
+    impl_->triangle_primitive_ids_ = tensor_map["triangle_primitive_ids"];
+    impl_->loaded_ = true;
+    impl_->scene_committed_ = true;
+}
+
 std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
         const core::Tensor& rays) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(rays, "rays", 6,
@@ -463,6 +928,30 @@ std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
     size_t num_rays = shape.NumElements();
 
     std::unordered_map<std::string, core::Tensor> result;
+    if (impl_->UseBVH()) {
+        impl_->CommitBVH();
+        core::Tensor t_hit, triangle_indices, primitive_uvs, primitive_normals;
+        kernel::raycasting_scene::CastRays(
+                impl_->node_bounds_, impl_->node_children_,
+                impl_->triangle_vertices_,
+                rays.Reshape({int64_t(num_rays), 6}), t_hit, triangle_indices,
+                primitive_uvs, primitive_normals);
+        result["t_hit"] = t_hit.Reshape(shape);
+        result["geometry_ids"] =
+                impl_->LookUpIds(impl_->triangle_geometry_ids_,
+                                 triangle_indices)
+                        .Reshape(shape);
+        result["primitive_ids"] =
+                impl_->LookUpIds(impl_->triangle_primitive_ids_,
+                                 triangle_indices)
+                        .Reshape(shape);
+        shape.push_back(2);
+        result["primitive_uvs"] = primitive_uvs.Reshape(shape);
+        shape.back() = 3;
+        result["primitive_normals"] = primitive_normals.Reshape(shape);
+        return result;
+    }
+
     result["t_hit"] = core::Tensor(shape, core::Dtype::Float32);
     result["geometry_ids"] = core::Tensor(shape, core::Dtype::UInt32);
     result["primitive_ids"] = core::Tensor(shape, core::Dtype::UInt32);
@@ -471,13 +960,18 @@ std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
     shape.back() = 3;
     result["primitive_normals"] = core::Tensor(shape, core::Dtype::Float32);
 
+    // Rays organized as images, e.g. from CreateRaysPinhole(), are coherent
+    // within tiles of the images.
+    const int64_t grid_width =
+            rays.NumDims() >= 3 ? rays.GetShape(rays.NumDims() - 2) : 0;
     auto data = rays.Contiguous();
     impl_->CastRays<false>(data.GetDataPtr<float>(), num_rays,
                            result["t_hit"].GetDataPtr<float>(),
                            result["geometry_ids"].GetDataPtr<uint32_t>(),
                            result["primitive_ids"].GetDataPtr<uint32_t>(),
                            result["primitive_uvs"].GetDataPtr<float>(),
-                           result["primitive_normals"].GetDataPtr<float>());
+                           result["primitive_normals"].GetDataPtr<float>(),
+                           grid_width);
 
     return result;
 }
@@ -490,6 +984,16 @@ core::Tensor RaycastingScene::CountIntersections(const core::Tensor& rays) {
                        // results.
     size_t num_rays = shape.NumElements();
 
+    if (impl_->UseBVH()) {
+        impl_->CommitBVH();
+        core::Tensor intersections;
+        kernel::raycasting_scene::CountIntersections(
+                impl_->node_bounds_, impl_->node_children_,
+                impl_->triangle_vertices_,
+                rays.Reshape({int64_t(num_rays), 6}), intersections);
+        return intersections.Reshape(shape);
+    }
+
     core::Tensor intersections(shape, core::Dtype::FromType<int>());
 
     auto data = rays.Contiguous();
@@ -509,6 +1013,27 @@ RaycastingScene::ComputeClosestPoints(const core::Tensor& query_points) {
     size_t num_query_points = shape.NumElements();
 
     std::unordered_map<std::string, core::Tensor> result;
+    if (impl_->UseBVH()) {
+        impl_->CommitBVH();
+        core::Tensor points, triangle_indices;
+        kernel::raycasting_scene::ComputeClosestPoints(
+                impl_->node_bounds_, impl_->node_children_,
+                impl_->triangle_vertices_,
+                query_points.Reshape({int64_t(num_query_points), 3}), points,
+                triangle_indices);
+        result["geometry_ids"] =
+                impl_->LookUpIds(impl_->triangle_geometry_ids_,
+                                 triangle_indices)
+                        .Reshape(shape);
+        result["primitive_ids"] =
+                impl_->LookUpIds(impl_->triangle_primitive_ids_,
+                                 triangle_indices)
+                        .Reshape(shape);
+        shape.push_back(3);
+        result["points"] = points.Reshape(shape);
+        return result;
+    }
+
     result["geometry_ids"] = core::Tensor(shape, core::Dtype::UInt32);
     result["primitive_ids"] = core::Tensor(shape, core::Dtype::UInt32);
     shape.push_back(3);
@@ -533,6 +1058,10 @@ core::Tensor RaycastingScene::ComputeDistance(
 
     auto data = query_points.Contiguous();
     auto closest_points = ComputeClosestPoints(data);
+    if (impl_->UseBVH()) {
+        core::Tensor diff = closest_points["points"] - data;
+        return (diff * diff).Sum({data.NumDims() - 1}).Sqrt();
+    }
 
     size_t num_query_points = shape.NumElements();
     Eigen::Map<Eigen::MatrixXf> query_points_map(data.GetDataPtr<float>(), 3,
@@ -558,7 +1087,8 @@ core::Tensor RaycastingScene::ComputeSignedDistance(
 
     auto data = query_points.Contiguous();
     auto distance = ComputeDistance(data);
-    core::Tensor rays({int64_t(num_query_points), 6}, core::Dtype::Float32);
+    core::Tensor rays({int64_t(num_query_points), 6}, core::Dtype::Float32,
+                      impl_->tensor_device_);
     rays.SetItem({core::TensorKey::Slice(0, num_query_points, 1),
                   core::TensorKey::Slice(0, 3, 1)},
                  data.Reshape({int64_t(num_query_points), 3}));
@@ -568,6 +1098,12 @@ core::Tensor RaycastingScene::ComputeSignedDistance(
             core::Tensor::Ones({1}, core::Dtype::Float32, impl_->tensor_device_)
                     .Expand({int64_t(num_query_points), 3}));
     auto intersections = CountIntersections(rays);
+    if (impl_->UseBVH()) {
+        core::Tensor odd = (intersections - (intersections / 2) * 2)
+                                   .To(core::Dtype::Float32)
+                                   .Reshape(shape);
+        return distance * (odd * -2.0f + 1.0f);
+    }
 
     Eigen::Map<Eigen::VectorXf> distance_map(distance.GetDataPtr<float>(),
                                              num_query_points);
@@ -588,7 +1124,8 @@ core::Tensor RaycastingScene::ComputeOccupancy(
                        // results.
     size_t num_query_points = shape.NumElements();
 
-    core::Tensor rays({int64_t(num_query_points), 6}, core::Dtype::Float32);
+    core::Tensor rays({int64_t(num_query_points), 6}, core::Dtype::Float32,
+                      impl_->tensor_device_);
     rays.SetItem({core::TensorKey::Slice(0, num_query_points, 1),
                   core::TensorKey::Slice(0, 3, 1)},
                  query_points.Reshape({int64_t(num_query_points), 3}));
@@ -598,6 +1135,11 @@ core::Tensor RaycastingScene::ComputeOccupancy(
             core::Tensor::Ones({1}, core::Dtype::Float32, impl_->tensor_device_)
                     .Expand({int64_t(num_query_points), 3}));
     auto intersections = CountIntersections(rays);
+    if (impl_->UseBVH()) {
+        return (intersections - (intersections / 2) * 2)
+                .To(core::Dtype::Float32)
+                .Reshape(shape);
+    }
     Eigen::Map<Eigen::VectorXi> intersections_map(
             intersections.GetDataPtr<int>(), num_query_points);
     intersections_map =
@@ -605,6 +1147,116 @@ core::Tensor RaycastingScene::ComputeOccupancy(
     return intersections.To(core::Dtype::Float32).Reshape(shape);
 }
 
+void RaycastingScene::ComputeGrid(
+        const core::Tensor& min_bound,
+        const core::Tensor& max_bound,
+        const core::SizeVector& resolution,
+        core::Tensor& output,
+        int64_t tile_size,
+        core::Tensor (RaycastingScene::*function)(const core::Tensor&)) {
+    min_bound.AssertShape({3});
+    max_bound.AssertShape({3});
+    if (resolution.size() != 3 || resolution[0] < 1 || resolution[1] < 1 ||
+        resolution[2] < 1) {
+        utility::LogError("Invalid grid resolution {}.",
+                          resolution.ToString());
+    }
+    if (tile_size < 1) {
+        utility::LogError("Invalid tile size {}.", tile_size);
+    }
+    output.AssertShape({resolution[2], resolution[1], resolution[0]});
+    output.AssertDtype(core::Dtype::Float32);
+    output.AssertDevice(impl_->tensor_device_);
+
+    const core::Device host("CPU:0");
+    core::Tensor min_bound_host =
+            min_bound.To(host, core::Dtype::Float64).Contiguous();
+    core::Tensor max_bound_host =
+            max_bound.To(host, core::Dtype::Float64).Contiguous();
+    const double* min_ptr = min_bound_host.GetDataPtr<double>();
+    const double* max_ptr = max_bound_host.GetDataPtr<double>();
+    double step[3];
+    for (int d = 0; d < 3; ++d) {
+        step[d] = resolution[d] > 1 ? (max_ptr[d] - min_ptr[d]) /
+                                              double(resolution[d] - 1)
+                                    : 0;
+    }
+
+    // Only the points of a single tile are allocated at a time. The points
+    // are ordered like the output, i.e. neighbors are queried together.
+    for (int64_t z0 = 0; z0 < resolution[2]; z0 += tile_size) {
+        const int64_t z1 = std::min(z0 + tile_size, resolution[2]);
+        for (int64_t y0 = 0; y0 < resolution[1]; y0 += tile_size) {
+            const int64_t y1 = std::min(y0 + tile_size, resolution[1]);
+            for (int64_t x0 = 0; x0 < resolution[0]; x0 += tile_size) {
+                const int64_t x1 = std::min(x0 + tile_size, resolution[0]);
+                core::Tensor points({z1 - z0, y1 - y0, x1 - x0, 3},
+                                    core::Dtype::Float32, host);
+                float* point_ptr = points.GetDataPtr<float>();
+                for (int64_t z = z0; z < z1; ++z) {
+                    for (int64_t y = y0; y < y1; ++y) {
+                        for (int64_t x = x0; x < x1; ++x) {
+                            *point_ptr++ = float(min_ptr[0] + x * step[0]);
+                            *point_ptr++ = float(min_ptr[1] + y * step[1]);
+                            *point_ptr++ = float(min_ptr[2] + z * step[2]);
+                        }
+                    }
+                }
+                output.Slice(0, z0, z1).Slice(1, y0, y1).Slice(2, x0, x1) =
+                        (this->*function)(points.To(impl_->tensor_device_));
+            }
+        }
+    }
+}
+
+core::Tensor RaycastingScene::ComputeSignedDistanceGrid(
+        const core::Tensor& min_bound,
+        const core::Tensor& max_bound,
+        const core::SizeVector& resolution,
+        int64_t tile_size) {
+    core::Tensor output;
+    if (resolution.size() == 3) {
+        output = core::Tensor({resolution[2], resolution[1], resolution[0]},
+                              core::Dtype::Float32, impl_->tensor_device_);
+    }
+    ComputeSignedDistanceGrid(min_bound, max_bound, resolution, output,
+                              tile_size);
+    return output;
+}
+
+void RaycastingScene::ComputeSignedDistanceGrid(
+        const core::Tensor& min_bound,
+        const core::Tensor& max_bound,
+        const core::SizeVector& resolution,
+        core::Tensor& output,
+        int64_t tile_size) {
+    ComputeGrid(min_bound, max_bound, resolution, output, tile_size,
+                &RaycastingScene::ComputeSignedDistance);
+}
+
+core::Tensor RaycastingScene::ComputeOccupancyGrid(
+        const core::Tensor& min_bound,
+        const core::Tensor& max_bound,
+        const core::SizeVector& resolution,
+        int64_t tile_size) {
+    core::Tensor output;
+    if (resolution.size() == 3) {
+        output = core::Tensor({resolution[2], resolution[1], resolution[0]},
+                              core::Dtype::Float32, impl_->tensor_device_);
+    }
+    ComputeOccupancyGrid(min_bound, max_bound, resolution, output, tile_size);
+    return output;
+}
+
+void RaycastingScene::ComputeOccupancyGrid(const core::Tensor& min_bound,
+                                           const core::Tensor& max_bound,
+                                           const core::SizeVector& resolution,
+                                           core::Tensor& output,
+                                           int64_t tile_size) {
+    ComputeGrid(min_bound, max_bound, resolution, output, tile_size,
+                &RaycastingScene::ComputeOccupancy);
+}
+
 core::Tensor RaycastingScene::CreateRaysPinhole(
         const core::Tensor& intrinsic_matrix,
         const core::Tensor& extrinsic_matrix,
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 
 #include "open3d/Macro.h"
 #include "open3d/core/Tensor.h"
@@ -45,11 +46,33 @@ namespace geometry {
 /// or more query points.
 /// It builds an internal acceleration structure to speed up those queries.
 ///
-/// This class supports only the CPU device.
+/// Scenes on the CPU use Embree. Scenes on a CUDA device use a native
+/// bounding volume hierarchy, which is built on the host when the scene is
+/// first queried after adding triangles. All tensors passed to a scene must
+/// be on its device and the results are returned on it.
+///
+/// Building the acceleration structure of large scenes takes long. The
+/// native hierarchy can be built once with SaveBVH() and loaded on any
+/// device with LoadBVH(), which skips the build.
 class RaycastingScene {
 public:
+    /// \brief Quality of the acceleration structure, which trades the build
+    /// time for the speed of the queries.
+    enum class BuildQuality {
+        /// Fastest build, for scenes that change often.
+        Low,
+        /// Default.
+        Medium,
+        /// Slowest build and fastest queries, for static scenes. Embree uses
+        /// spatial splits, the native hierarchy the surface area heuristic.
+        High,
+    };
+
     /// \brief Default Constructor.
-    RaycastingScene();
+    /// \param device The device of the scene, the CPU or a CUDA device.
+    /// \param build_quality Quality of the acceleration structure.
+    RaycastingScene(const core::Device &device = core::Device("CPU:0"),
+                    BuildQuality build_quality = BuildQuality::Medium);
 
     ~RaycastingScene();
 
@@ -65,6 +88,57 @@ public:
     /// \return The geometry ID of the added mesh.
     uint32_t AddTriangles(const TriangleMesh &mesh);
 
+    /// \brief Add an instance of a triangle mesh of the scene.
+    ///
+    /// Instances share the triangles and the acceleration structure of their
+    /// mesh. Moving an instance with SetTransform() only updates the top
+    /// level of the acceleration structure, which makes instances suitable
+    /// for moving objects. The instanced mesh stays part of the scene unless
+    /// it is removed with RemoveGeometry().
+    /// \param geometry_id The geometry ID of a triangle mesh of the scene.
+    /// \param transform The 4x4 transformation from the mesh to the world
+    /// coordinate system.
+    /// \return The geometry ID of the instance.
+    uint32_t AddInstance(uint32_t geometry_id, const core::Tensor &transform);
+
+    /// \brief Set the transformation of an instance.
+    /// \param geometry_id The geometry ID of an instance.
+    /// \param transform The 4x4 transformation from the mesh to the world
+    /// coordinate system.
+    void SetTransform(uint32_t geometry_id, const core::Tensor &transform);
+
+    /// \brief Remove a geometry from the scene.
+    ///
+    /// The IDs of the other geometries do not change. Instances of a removed
+    /// triangle mesh remain in the scene.
+    /// \param geometry_id The geometry ID of a mesh or an instance.
+    void RemoveGeometry(uint32_t geometry_id);
+
+    /// \brief Saves the scene as native bounding volume hierarchy to a
+    /// binary file, see t::io::WriteTensorMap.
+    ///
+    /// Embree's acceleration structure cannot be serialized, so the native
+    /// hierarchy of CUDA scenes is saved for scenes on all devices. It is
+    /// built with the build quality of the scene, and instances are stored
+    /// with their transformed triangles.
+    /// \param file_name Path to the file, typically with the extension
+    /// ".o3dt".
+    void SaveBVH(const std::string &file_name);
+
+    /// \brief Loads a hierarchy saved by SaveBVH() into this empty scene.
+    ///
+    /// The scene then uses the native hierarchy on its device, also on the
+    /// CPU, and does not build an acceleration structure. Geometries cannot
+    /// be added to, moved in or removed from loaded scenes. The geometry and
+    /// primitive IDs of the queries are those of the saved scene.
+    /// \param file_name Path to the file.
+    /// \param mmap_mode If not MmapMode::None, the hierarchy of CPU scenes
+    /// is backed by the memory-mapped file, so that processes loading the
+    /// same file share one copy in the page cache. See core::Tensor::Load.
+    void LoadBVH(const std::string &file_name,
+                 core::Tensor::MmapMode mmap_mode =
+                         core::Tensor::MmapMode::None);
+
     /// \brief Computes the first intersection of the rays with the scene.
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
     /// describing the rays.
@@ -74,6 +148,9 @@ public:
     /// with [ox,oy,oz] as the origin and [dx,dy,dz] as the direction. It is not
     /// necessary to normalize the direction but the returned hit distance uses
     /// the length of the direction vector as unit.
+    /// On the CPU, rays with shape {.., height, width, 6} are assumed to be
+    /// coherent within small image tiles, which are traced in parallel as
+    /// coherent ray streams. Other rays are traced in parallel chunks.
     /// \return The returned dictionary contains:
     ///         - \b t_hit A tensor with the distance to the first hit. The
     ///           shape is {..}. If there is no intersection the hit distance
@@ -160,6 +237,53 @@ public:
     /// are either 0 or 1. A point is occupied or inside if the value is 1.
     core::Tensor ComputeOccupancy(const core::Tensor &query_points);
 
+    /// \brief Computes the signed distance at the points of a regular grid.
+    ///
+    /// The grid points are generated and evaluated in cubic tiles, so that
+    /// the memory used for the queries is bounded by the tile size and
+    /// neighboring grid points are queried together. See
+    /// ComputeSignedDistance() for the assumptions about the meshes.
+    ///
+    /// \param min_bound The position [x, y, z] of the first grid point with
+    /// shape {3}.
+    /// \param max_bound The position [x, y, z] of the last grid point with
+    /// shape {3}.
+    /// \param resolution The number of grid points {nx, ny, nz} along each
+    /// axis.
+    /// \param tile_size The edge length in grid points of the tiles.
+    /// \return A Float32 tensor with shape {nz, ny, nx} with the signed
+    /// distances.
+    core::Tensor ComputeSignedDistanceGrid(const core::Tensor &min_bound,
+                                           const core::Tensor &max_bound,
+                                           const core::SizeVector &resolution,
+                                           int64_t tile_size = 64);
+
+    /// \brief Computes the signed distance at the points of a regular grid
+    /// and writes them to a preallocated Float32 tensor \p output with shape
+    /// {nz, ny, nx} on the device of the scene, which may be a view.
+    void ComputeSignedDistanceGrid(const core::Tensor &min_bound,
+                                   const core::Tensor &max_bound,
+                                   const core::SizeVector &resolution,
+                                   core::Tensor &output,
+                                   int64_t tile_size = 64);
+
+    /// \brief Computes the occupancy at the points of a regular grid in
+    /// tiles, see ComputeSignedDistanceGrid() and ComputeOccupancy().
+    /// \return A Float32 tensor with shape {nz, ny, nx} with the occupancy.
+    core::Tensor ComputeOccupancyGrid(const core::Tensor &min_bound,
+                                      const core::Tensor &max_bound,
+                                      const core::SizeVector &resolution,
+                                      int64_t tile_size = 64);
+
+    /// \brief Computes the occupancy at the points of a regular grid and
+    /// writes it to a preallocated Float32 tensor \p output with shape
+    /// {nz, ny, nx} on the device of the scene, which may be a view.
+    void ComputeOccupancyGrid(const core::Tensor &min_bound,
+                              const core::Tensor &max_bound,
+                              const core::SizeVector &resolution,
+                              core::Tensor &output,
+                              int64_t tile_size = 64);
+
     /// \brief Creates rays for the given camera parameters.
     ///
     /// \param intrinsic_matrix The upper triangular intrinsic matrix with
@@ -193,6 +317,16 @@ public:
     static uint32_t INVALID_ID();
 
 private:
+    /// Evaluates \p function on the grid points in tiles, writing the
+    /// results to \p output.
+    void ComputeGrid(const core::Tensor &min_bound,
+                     const core::Tensor &max_bound,
+                     const core::SizeVector &resolution,
+                     core::Tensor &output,
+                     int64_t tile_size,
+                     core::Tensor (RaycastingScene::*function)(
+                             const core::Tensor &));
+
     struct Impl;
     std::unique_ptr<Impl> impl_;
 };
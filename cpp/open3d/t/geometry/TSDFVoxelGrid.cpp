@@ -26,14 +26,75 @@
 
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
 
+#include <algorithm>
+#include <cmath>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Profiler.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/kernel/TSDFVoxelGrid.h"
+#include "open3d/t/io/TensorMapIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 
+#ifdef BUILD_CUDA_MODULE
+#include "open3d/core/CUDAState.cuh"
+#endif
+
 namespace open3d {
 namespace t {
 namespace geometry {
 
+namespace {
+
+/// Return the keys and values of the active entries of \p hashmap.
+std::pair<core::Tensor, core::Tensor> GetActiveEntries(
+        const core::Hashmap &hashmap) {
+    core::Tensor active_addrs;
+    hashmap.GetActiveIndices(active_addrs);
+    core::Tensor active_indices = active_addrs.To(core::Dtype::Int64);
+    return std::make_pair(hashmap.GetKeyTensor().IndexGet({active_indices}),
+                          hashmap.GetValueTensor().IndexGet({active_indices}));
+}
+
+/// Concatenate \p tensors along the first dimension on CPU. \p tensors must
+/// not be empty.
+core::Tensor ConcatenateRows(const std::vector<core::Tensor> &tensors) {
+    int64_t length = 0;
+    for (const core::Tensor &tensor : tensors) {
+        length += tensor.GetLength();
+    }
+    core::SizeVector shape = tensors[0].GetShape();
+    shape[0] = length;
+    core::Tensor result(shape, tensors[0].GetDtype(), core::Device("CPU:0"));
+    int64_t offset = 0;
+    for (const core::Tensor &tensor : tensors) {
+        result.Slice(0, offset, offset + tensor.GetLength()) =
+                tensor.To(core::Device("CPU:0"));
+        offset += tensor.GetLength();
+    }
+    return result;
+}
+
+/// Return maps[code] if it is a Float32 tensor of \p shape on \p device, to
+/// be overwritten, and a newly allocated one otherwise.
+core::Tensor ReuseOrAllocateMap(
+        const std::unordered_map<TSDFVoxelGrid::SurfaceMaskCode, core::Tensor>
+                &maps,
+        TSDFVoxelGrid::SurfaceMaskCode code,
+        const core::SizeVector &shape,
+        const core::Device &device) {
+    auto it = maps.find(code);
+    if (it != maps.end() && it->second.GetShape() == shape &&
+        it->second.GetDtype() == core::Dtype::Float32 &&
+        it->second.GetDevice() == device && it->second.IsContiguous()) {
+        return it->second;
+    }
+    return core::Tensor(shape, core::Dtype::Float32, device);
+}
+
+}  // namespace
+
 TSDFVoxelGrid::TSDFVoxelGrid(
         std::unordered_map<std::string, core::Dtype> attr_dtype_map,
         float voxel_size,
@@ -58,7 +119,8 @@ TSDFVoxelGrid::TSDFVoxelGrid(
     int64_t total_bytes = 0;
     if (attr_dtype_map_.count("tsdf") != 0) {
         core::Dtype dtype = attr_dtype_map_.at("tsdf");
-        if (dtype != core::Dtype::Float32) {
+        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Int16 &&
+            dtype != core::Dtype::Int8) {
             utility::LogWarning(
                     "[TSDFVoxelGrid] unexpected TSDF dtype, please "
                     "implement your own Voxel structure in "
@@ -69,7 +131,8 @@ TSDFVoxelGrid::TSDFVoxelGrid(
 
     if (attr_dtype_map_.count("weight") != 0) {
         core::Dtype dtype = attr_dtype_map_.at("weight");
-        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::UInt16) {
+        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::UInt16 &&
+            dtype != core::Dtype::UInt8) {
             utility::LogWarning(
                     "[TSDFVoxelGrid] unexpected weight dtype, please "
                     "implement your own Voxel structure in "
@@ -81,7 +144,8 @@ TSDFVoxelGrid::TSDFVoxelGrid(
 
     if (attr_dtype_map_.count("color") != 0) {
         core::Dtype dtype = attr_dtype_map_.at("color");
-        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::UInt16) {
+        if (dtype != core::Dtype::Float32 && dtype != core::Dtype::UInt16 &&
+            dtype != core::Dtype::UInt8) {
             utility::LogWarning(
                     "[TSDFVoxelGrid] unexpected color dtype, please "
                     "implement your own Voxel structure in "
@@ -123,11 +187,66 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
                               const core::Tensor &extrinsics,
                               float depth_scale,
                               float depth_max) {
+    OPEN3D_PROFILE_SCOPE("TSDFVoxelGrid::Integrate", device_);
     if (depth.IsEmpty()) {
         utility::LogError(
                 "[TSDFVoxelGrid] input depth is empty for integration.");
     }
 
+    if (IsFrustumBlockCacheValid(depth, intrinsics, extrinsics, depth_scale,
+                                 depth_max)) {
+        IntegrateActiveBlocks(frustum_cache_.block_coords,
+                              frustum_cache_.block_addrs, depth, color,
+                              intrinsics, extrinsics, depth_scale, depth_max);
+        return;
+    }
+
+    core::Tensor block_coords = GetFrustumBlockCoords(
+            depth, intrinsics, extrinsics, depth_scale, depth_max);
+    core::Tensor block_addrs = ActivateBlocks(block_coords);
+    IntegrateActiveBlocks(block_coords, block_addrs, depth, color, intrinsics,
+                          extrinsics, depth_scale, depth_max);
+
+    if (frustum_cache_.max_translation >= 0 &&
+        frustum_cache_.max_rotation >= 0) {
+        frustum_cache_.block_coords = block_coords;
+        frustum_cache_.block_addrs = block_addrs;
+        frustum_cache_.intrinsics =
+                intrinsics.To(core::Device("CPU:0"), core::Dtype::Float64);
+        frustum_cache_.extrinsics =
+                extrinsics.To(core::Device("CPU:0"), core::Dtype::Float64);
+        frustum_cache_.rows = depth.GetRows();
+        frustum_cache_.cols = depth.GetCols();
+        frustum_cache_.depth_scale = depth_scale;
+        frustum_cache_.depth_max = depth_max;
+        frustum_cache_.hashmap_size = block_hashmap_->Size();
+        frustum_cache_.hashmap_capacity = block_hashmap_->GetCapacity();
+    }
+}
+
+void TSDFVoxelGrid::IntegrateBlocks(const core::Tensor &block_coords,
+                                    const Image &depth,
+                                    const Image &color,
+                                    const core::Tensor &intrinsics,
+                                    const core::Tensor &extrinsics,
+                                    float depth_scale,
+                                    float depth_max) {
+    if (depth.IsEmpty()) {
+        utility::LogError(
+                "[TSDFVoxelGrid] input depth is empty for integration.");
+    }
+
+    core::Tensor block_addrs = ActivateBlocks(block_coords);
+    IntegrateActiveBlocks(block_coords, block_addrs, depth, color, intrinsics,
+                          extrinsics, depth_scale, depth_max);
+}
+
+core::Tensor TSDFVoxelGrid::GetFrustumBlockCoords(
+        const Image &depth,
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        float depth_scale,
+        float depth_max) {
     // Create a point cloud from a low-resolution depth input to roughly
     // estimate surfaces.
     // TODO(wei): merge CreateFromDepth and Touch in one kernel.
@@ -150,6 +269,68 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
     kernel::tsdf::Touch(point_hashmap_, pcd.GetPoints().Contiguous(),
                         block_coords, block_resolution_, voxel_size_,
                         sdf_trunc_);
+    return block_coords;
+}
+
+void TSDFVoxelGrid::SetFrustumBlockCache(float max_translation,
+                                         float max_rotation) {
+    frustum_cache_ = FrustumBlockCache();
+    frustum_cache_.max_translation = max_translation;
+    frustum_cache_.max_rotation = max_rotation;
+}
+
+void TSDFVoxelGrid::SetRayCastGraphCapture(bool enable) {
+    ray_cast_graph_ = nullptr;
+#ifdef BUILD_CUDA_MODULE
+    if (enable && device_.GetType() == core::Device::DeviceType::CUDA) {
+        ray_cast_graph_ = std::make_shared<core::CUDAGraph>(device_);
+    }
+#endif
+}
+
+bool TSDFVoxelGrid::IsFrustumBlockCacheValid(const Image &depth,
+                                             const core::Tensor &intrinsics,
+                                             const core::Tensor &extrinsics,
+                                             float depth_scale,
+                                             float depth_max) const {
+    if (frustum_cache_.max_translation < 0 ||
+        frustum_cache_.max_rotation < 0 ||
+        frustum_cache_.block_addrs.NumElements() == 0) {
+        return false;
+    }
+
+    // Addresses of the cached blocks stay valid until the hashmap changes.
+    if (frustum_cache_.hashmap_size != block_hashmap_->Size() ||
+        frustum_cache_.hashmap_capacity != block_hashmap_->GetCapacity()) {
+        return false;
+    }
+
+    if (frustum_cache_.rows != depth.GetRows() ||
+        frustum_cache_.cols != depth.GetCols() ||
+        frustum_cache_.depth_scale != depth_scale ||
+        frustum_cache_.depth_max != depth_max ||
+        !frustum_cache_.intrinsics.AllClose(intrinsics.To(
+                core::Device("CPU:0"), core::Dtype::Float64))) {
+        return false;
+    }
+
+    // Relative motion of the camera since the blocks were computed.
+    Eigen::Matrix4d cached_extrinsics =
+            core::eigen_converter::TensorToEigenMatrixXd(
+                    frustum_cache_.extrinsics);
+    Eigen::Matrix4d curr_extrinsics =
+            core::eigen_converter::TensorToEigenMatrixXd(extrinsics);
+    Eigen::Matrix4d delta = curr_extrinsics * cached_extrinsics.inverse();
+    double translation = delta.block<3, 1>(0, 3).norm();
+    double cos_rotation = (delta.block<3, 3>(0, 0).trace() - 1.0) / 2.0;
+    double rotation = std::acos(std::min(1.0, std::max(-1.0, cos_rotation)));
+    return translation <= frustum_cache_.max_translation &&
+           rotation <= frustum_cache_.max_rotation;
+}
+
+core::Tensor TSDFVoxelGrid::ActivateBlocks(const core::Tensor &block_coords) {
+    // Bring back offloaded blocks before they are allocated anew.
+    ReloadBlocksByKeys(block_coords);
 
     // Active voxel blocks in the block hashmap.
     core::Tensor addrs, masks;
@@ -173,6 +354,27 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
     // TODO(wei): set point_hashmap_[block_coords] = addrs and use the small
     // hashmap for raycasting
     block_hashmap_->Find(block_coords, addrs, masks);
+    return addrs;
+}
+
+void TSDFVoxelGrid::IntegrateActiveBlocks(const core::Tensor &block_coords,
+                                          const core::Tensor &block_addrs,
+                                          const Image &depth,
+                                          const Image &color,
+                                          const core::Tensor &intrinsics,
+                                          const core::Tensor &extrinsics,
+                                          float depth_scale,
+                                          float depth_max) {
+    OPEN3D_PROFILE_SCOPE("TSDFVoxelGrid::IntegrateActiveBlocks", device_);
+    // Mark the blocks for ExtractUpdatedSurfaceMesh.
+    if (dirty_block_hashmap_ == nullptr) {
+        dirty_block_hashmap_ = std::make_shared<core::Hashmap>(
+                block_count_, core::Dtype::Int32, core::Dtype::UInt8,
+                core::SizeVector{3}, core::SizeVector{1}, device_,
+                core::HashmapBackend::Default);
+    }
+    core::Tensor dirty_addrs, dirty_masks;
+    dirty_block_hashmap_->Activate(block_coords, dirty_addrs, dirty_masks);
 
     // TODO(wei): directly reuse it without intermediate variables.
     // Reserved for raycasting
@@ -202,7 +404,7 @@ void TSDFVoxelGrid::Integrate(const Image &depth,
     core::Tensor dst = block_hashmap_->GetValueTensor();
 
     // TODO(wei): use a fixed buffer.
-    kernel::tsdf::Integrate(depth_tensor, color_tensor, addrs,
+    kernel::tsdf::Integrate(depth_tensor, color_tensor, block_addrs,
                             block_hashmap_->GetKeyTensor(), dst, intrinsics,
                             extrinsics, block_resolution_, voxel_size_,
                             sdf_trunc_, depth_scale, depth_max);
@@ -218,41 +420,141 @@ TSDFVoxelGrid::RayCast(const core::Tensor &intrinsics,
                        float depth_max,
                        float weight_threshold,
                        int ray_cast_mask) {
+    std::unordered_map<TSDFVoxelGrid::SurfaceMaskCode, core::Tensor> results;
+    RayCast(results, intrinsics, extrinsics, width, height, depth_scale,
+            depth_min, depth_max, weight_threshold, ray_cast_mask);
+    return results;
+}
+
+void TSDFVoxelGrid::RayCast(
+        std::unordered_map<SurfaceMaskCode, core::Tensor> &results,
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        int width,
+        int height,
+        float depth_scale,
+        float depth_min,
+        float depth_max,
+        float weight_threshold,
+        int ray_cast_mask) {
+    OPEN3D_PROFILE_SCOPE("TSDFVoxelGrid::RayCast", device_);
+    extrinsics.AssertShape({4, 4});
+    // Single view maps are reused as views of a batch of one.
+    std::unordered_map<TSDFVoxelGrid::SurfaceMaskCode, core::Tensor>
+            batch_results;
+    for (const auto &result : results) {
+        if (result.second.NumDims() == 3 && result.second.IsContiguous()) {
+            core::SizeVector shape = result.second.GetShape();
+            shape.insert(shape.begin(), 1);
+            batch_results.emplace(result.first, result.second.View(shape));
+        }
+    }
+    RayCastBatch(batch_results, intrinsics, extrinsics.Reshape({1, 4, 4}),
+                 width, height, depth_scale, depth_min, depth_max,
+                 weight_threshold, ray_cast_mask);
+    results.clear();
+    for (auto &result : batch_results) {
+        results.emplace(result.first, result.second[0]);
+    }
+}
+
+std::unordered_map<TSDFVoxelGrid::SurfaceMaskCode, core::Tensor>
+TSDFVoxelGrid::RayCastBatch(const core::Tensor &intrinsics,
+                            const core::Tensor &extrinsics,
+                            int width,
+                            int height,
+                            float depth_scale,
+                            float depth_min,
+                            float depth_max,
+                            float weight_threshold,
+                            int ray_cast_mask) {
+    std::unordered_map<TSDFVoxelGrid::SurfaceMaskCode, core::Tensor> results;
+    RayCastBatch(results, intrinsics, extrinsics, width, height, depth_scale,
+                 depth_min, depth_max, weight_threshold, ray_cast_mask);
+    return results;
+}
+
+void TSDFVoxelGrid::RayCastBatch(
+        std::unordered_map<SurfaceMaskCode, core::Tensor> &results,
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        int width,
+        int height,
+        float depth_scale,
+        float depth_min,
+        float depth_max,
+        float weight_threshold,
+        int ray_cast_mask) {
+    OPEN3D_PROFILE_SCOPE("TSDFVoxelGrid::RayCastBatch", device_);
+    extrinsics.AssertShapeCompatible({utility::nullopt, 4, 4});
+    int64_t n_views = extrinsics.GetLength();
+    if (intrinsics.NumDims() == 3) {
+        intrinsics.AssertShape({n_views, 3, 3});
+    } else {
+        intrinsics.AssertShape({3, 3});
+    }
+
     // Extrinsic: world to camera -> pose: camera to world
     core::Tensor vertex_map, depth_map, color_map, normal_map;
     if (ray_cast_mask & TSDFVoxelGrid::SurfaceMaskCode::VertexMap) {
-        vertex_map =
-                core::Tensor({height, width, 3}, core::Dtype::Float32, device_);
+        vertex_map = ReuseOrAllocateMap(
+                results, TSDFVoxelGrid::SurfaceMaskCode::VertexMap,
+                {n_views, height, width, 3}, device_);
     }
     if (ray_cast_mask & TSDFVoxelGrid::SurfaceMaskCode::DepthMap) {
-        depth_map =
-                core::Tensor({height, width, 1}, core::Dtype::Float32, device_);
+        depth_map = ReuseOrAllocateMap(
+                results, TSDFVoxelGrid::SurfaceMaskCode::DepthMap,
+                {n_views, height, width, 1}, device_);
     }
     if (ray_cast_mask & TSDFVoxelGrid::SurfaceMaskCode::ColorMap) {
-        color_map =
-                core::Tensor({height, width, 3}, core::Dtype::Float32, device_);
+        color_map = ReuseOrAllocateMap(
+                results, TSDFVoxelGrid::SurfaceMaskCode::ColorMap,
+                {n_views, height, width, 3}, device_);
     }
     if (ray_cast_mask & TSDFVoxelGrid::SurfaceMaskCode::NormalMap) {
-        normal_map =
-                core::Tensor({height, width, 3}, core::Dtype::Float32, device_);
+        normal_map = ReuseOrAllocateMap(
+                results, TSDFVoxelGrid::SurfaceMaskCode::NormalMap,
+                {n_views, height, width, 3}, device_);
     }
 
+    // The ranges are estimated per view, all the rays are cast at once.
     core::Tensor range_minmax_map;
     int down_factor = 8;
-    kernel::tsdf::EstimateRange(active_block_coords_, range_minmax_map,
-                                intrinsics, extrinsics, height, width,
-                                down_factor, block_resolution_, voxel_size_,
-                                depth_min, depth_max);
+    for (int64_t i = 0; i < n_views; ++i) {
+        core::Tensor range_map;
+        kernel::tsdf::EstimateRange(
+                active_block_coords_, range_map,
+                intrinsics.NumDims() == 3 ? intrinsics[i] : intrinsics,
+                extrinsics[i], height, width, down_factor, block_resolution_,
+                voxel_size_, depth_min, depth_max);
+        if (i == 0) {
+            core::SizeVector shape = range_map.GetShape();
+            shape.insert(shape.begin(), n_views);
+            range_minmax_map = core::Tensor(shape, range_map.GetDtype(),
+                                            range_map.GetDevice());
+        }
+        range_minmax_map[i] = range_map;
+    }
+
+    // Blocks in the frustum get a coarse occupancy level for empty-space
+    // skipping.
+    core::Tensor block_indices({0}, core::Dtype::Int32, device_);
+    if (active_block_coords_.GetLength() > 0) {
+        core::Tensor block_addrs, block_masks;
+        block_hashmap_->Find(active_block_coords_, block_addrs, block_masks);
+        block_indices = block_addrs.IndexGet({block_masks});
+    }
 
     core::Tensor block_values = block_hashmap_->GetValueTensor();
     auto device_hashmap = block_hashmap_->GetDeviceHashmap();
-    kernel::tsdf::RayCast(device_hashmap, block_values, range_minmax_map,
-                          vertex_map, depth_map, color_map, normal_map,
-                          intrinsics, extrinsics, height, width,
+    kernel::tsdf::RayCast(device_hashmap, block_values, block_indices,
+                          range_minmax_map, vertex_map, depth_map, color_map,
+                          normal_map, intrinsics, extrinsics, height, width,
                           block_resolution_, voxel_size_, sdf_trunc_,
-                          depth_scale, depth_min, depth_max, weight_threshold);
+                          depth_scale, depth_min, depth_max, weight_threshold,
+                          ray_cast_graph_.get());
 
-    std::unordered_map<TSDFVoxelGrid::SurfaceMaskCode, core::Tensor> results;
+    results.clear();
     if (ray_cast_mask & TSDFVoxelGrid::SurfaceMaskCode::VertexMap) {
         results.emplace(TSDFVoxelGrid::SurfaceMaskCode::VertexMap, vertex_map);
     }
@@ -266,13 +568,12 @@ TSDFVoxelGrid::RayCast(const core::Tensor &intrinsics,
         results.emplace(TSDFVoxelGrid::SurfaceMaskCode::NormalMap, normal_map);
     }
     results.emplace(TSDFVoxelGrid::SurfaceMaskCode::RangeMap, range_minmax_map);
-
-    return results;
 }
 
 PointCloud TSDFVoxelGrid::ExtractSurfacePoints(int estimated_number,
                                                float weight_threshold,
                                                int surface_mask) {
+    OPEN3D_PROFILE_SCOPE("TSDFVoxelGrid::ExtractSurfacePoints", device_);
     // Extract active voxel blocks from the hashmap.
     if ((surface_mask & SurfaceMaskCode::VertexMap) == 0) {
         utility::LogError("VertexMap must be specified in Surface extraction.");
@@ -318,6 +619,7 @@ PointCloud TSDFVoxelGrid::ExtractSurfacePoints(int estimated_number,
 TriangleMesh TSDFVoxelGrid::ExtractSurfaceMesh(int estimate_vertices,
                                                float weight_threshold,
                                                int surface_mask) {
+    OPEN3D_PROFILE_SCOPE("TSDFVoxelGrid::ExtractSurfaceMesh", device_);
     // Extract active voxel blocks from the hashmap.
     if ((surface_mask & SurfaceMaskCode::VertexMap) == 0) {
         utility::LogError("VertexMap must be specified in Surface extraction.");
@@ -355,7 +657,8 @@ TriangleMesh TSDFVoxelGrid::ExtractSurfaceMesh(int estimate_vertices,
                     ? utility::optional<std::reference_wrapper<core::Tensor>>(
                               vertex_colors)
                     : utility::nullopt,
-            block_resolution_, voxel_size_, weight_threshold, vertex_count);
+            block_resolution_, voxel_size_, weight_threshold, vertex_count,
+            core::Tensor(), utility::nullopt);
 
     TriangleMesh mesh(vertices, triangles);
     if ((surface_mask & SurfaceMaskCode::ColorMap) &&
@@ -370,6 +673,103 @@ TriangleMesh TSDFVoxelGrid::ExtractSurfaceMesh(int estimate_vertices,
     return mesh;
 }
 
+TriangleMesh TSDFVoxelGrid::ExtractUpdatedSurfaceMesh(core::Tensor &block_keys,
+                                                      int estimate_vertices,
+                                                      float weight_threshold,
+                                                      int surface_mask) {
+    if ((surface_mask & SurfaceMaskCode::VertexMap) == 0) {
+        utility::LogError("VertexMap must be specified in Surface extraction.");
+    }
+
+    if (dirty_block_hashmap_ == nullptr || dirty_block_hashmap_->Size() == 0) {
+        block_keys = core::Tensor({0, 3}, core::Dtype::Int32, device_);
+        return TriangleMesh(device_);
+    }
+
+    core::Tensor dirty_addrs;
+    dirty_block_hashmap_->GetActiveIndices(dirty_addrs);
+    core::Tensor dirty_keys = dirty_block_hashmap_->GetKeyTensor().IndexGet(
+            {dirty_addrs.To(core::Dtype::Int64)});
+    dirty_block_hashmap_->Clear();
+
+    // Triangles and normals of a block read voxels of its 3^3 neighbors, so
+    // the neighbors of the integrated blocks are re-meshed as well.
+    block_keys = DilateActiveBlocks(dirty_keys, false);
+    int64_t num_blocks = block_keys.GetLength();
+
+    // Vertices on the edges shared with the positive neighbors belong to the
+    // neighbors, which join the workload without emitting triangles.
+    core::Tensor workload_keys = DilateActiveBlocks(block_keys, true);
+
+    // Map the workload to rows of block_keys, masking the re-meshed blocks.
+    core::Hashmap block_id_hashmap(num_blocks, core::Dtype::Int32,
+                                   core::Dtype::Int64, core::SizeVector{3},
+                                   core::SizeVector{1}, device_);
+    core::Tensor addrs, masks;
+    block_id_hashmap.Insert(
+            block_keys,
+            core::Tensor::Arange(0, num_blocks, 1, core::Dtype::Int64, device_)
+                    .View({num_blocks, 1}),
+            addrs, masks);
+    core::Tensor workload_block_ids, workload_masks;
+    block_id_hashmap.FindValues(workload_keys, workload_block_ids,
+                                workload_masks);
+
+    core::Tensor workload_addrs;
+    block_hashmap_->Find(workload_keys, workload_addrs, masks);
+    core::Tensor workload_nb_addrs, workload_nb_masks;
+    std::tie(workload_nb_addrs, workload_nb_masks) =
+            BufferRadiusNeighbors(workload_addrs);
+
+    int64_t num_workload = workload_keys.GetLength();
+    core::Tensor inverse_index_map({block_hashmap_->GetCapacity()},
+                                   core::Dtype::Int64, device_);
+    inverse_index_map.IndexSet({workload_addrs.To(core::Dtype::Int64)},
+                               core::Tensor::Arange(0, num_workload, 1,
+                                                    core::Dtype::Int64,
+                                                    device_));
+
+    core::Tensor vertices, triangles, vertex_normals, vertex_colors,
+            triangle_workload_indices;
+    int vertex_count = estimate_vertices;
+    kernel::tsdf::ExtractSurfaceMesh(
+            workload_addrs.To(core::Dtype::Int64), inverse_index_map,
+            workload_nb_addrs.To(core::Dtype::Int64), workload_nb_masks,
+            block_hashmap_->GetKeyTensor(), block_hashmap_->GetValueTensor(),
+            vertices, triangles,
+            surface_mask & SurfaceMaskCode::NormalMap
+                    ? utility::optional<std::reference_wrapper<core::Tensor>>(
+                              vertex_normals)
+                    : utility::nullopt,
+            surface_mask & SurfaceMaskCode::ColorMap
+                    ? utility::optional<std::reference_wrapper<core::Tensor>>(
+                              vertex_colors)
+                    : utility::nullopt,
+            block_resolution_, voxel_size_, weight_threshold, vertex_count,
+            workload_masks,
+            utility::optional<std::reference_wrapper<core::Tensor>>(
+                    triangle_workload_indices));
+
+    // Group the triangles by block.
+    core::Tensor triangle_block_ids =
+            workload_block_ids.View({num_workload})
+                    .IndexGet({triangle_workload_indices});
+    core::Tensor order = triangle_block_ids.ArgSort();
+
+    TriangleMesh mesh(vertices, triangles.IndexGet({order}));
+    mesh.SetTriangleAttr("block_ids", triangle_block_ids.IndexGet({order}));
+    if ((surface_mask & SurfaceMaskCode::ColorMap) &&
+        vertex_colors.GetLength() == vertices.GetLength()) {
+        mesh.SetVertexColors(vertex_colors);
+    }
+    if ((surface_mask & SurfaceMaskCode::NormalMap) &&
+        vertex_normals.GetLength() == vertices.GetLength()) {
+        mesh.SetVertexNormals(vertex_normals);
+    }
+
+    return mesh;
+}
+
 TSDFVoxelGrid TSDFVoxelGrid::To(const core::Device &device, bool copy) const {
     if (!copy && GetDevice() == device) {
         return *this;
@@ -383,6 +783,319 @@ TSDFVoxelGrid TSDFVoxelGrid::To(const core::Device &device, bool copy) const {
     return device_tsdf_voxelgrid;
 }
 
+void TSDFVoxelGrid::InsertBlocks(const core::Tensor &block_coords,
+                                 const core::Tensor &block_values) {
+    active_block_coords_ = block_coords.To(device_);
+    if (block_coords.GetLength() > 0) {
+        core::Tensor addrs, masks;
+        block_hashmap_->Insert(active_block_coords_, block_values.To(device_),
+                               addrs, masks);
+    }
+}
+
+void TSDFVoxelGrid::Save(const std::string &file_name) const {
+    std::vector<core::Tensor> keys, values;
+    if (block_hashmap_->Size() > 0) {
+        core::Tensor active_keys, active_values;
+        std::tie(active_keys, active_values) =
+                GetActiveEntries(*block_hashmap_);
+        keys.push_back(active_keys);
+        values.push_back(active_values);
+    }
+    if (GetOffloadedBlockCount() > 0) {
+        core::Tensor offloaded_keys, offloaded_values;
+        GetOffloadedBlocks(offloaded_keys, offloaded_values);
+        keys.push_back(offloaded_keys);
+        values.push_back(offloaded_values);
+    }
+
+    TensorMap tensor_map("keys");
+    if (keys.empty()) {
+        tensor_map["keys"] = block_hashmap_->GetKeyTensor().Slice(0, 0, 0);
+        tensor_map["values"] = block_hashmap_->GetValueTensor().Slice(0, 0, 0);
+    } else {
+        tensor_map["keys"] = ConcatenateRows(keys);
+        tensor_map["values"] = ConcatenateRows(values);
+    }
+    tensor_map["voxel_size"] = core::Tensor::Init<float>({voxel_size_});
+    tensor_map["sdf_trunc"] = core::Tensor::Init<float>({sdf_trunc_});
+    tensor_map["block_resolution"] =
+            core::Tensor::Init<int64_t>({block_resolution_});
+    tensor_map["block_count"] = core::Tensor::Init<int64_t>({block_count_});
+    // The voxel layout is stored as empty tensors of the attribute dtypes.
+    for (const auto &attr_dtype : attr_dtype_map_) {
+        tensor_map["dtype_" + attr_dtype.first] =
+                core::Tensor({0}, attr_dtype.second);
+    }
+
+    if (!t::io::WriteTensorMap(file_name, tensor_map)) {
+        utility::LogError("[TSDFVoxelGrid] Failed to save to {}.", file_name);
+    }
+}
+
+TSDFVoxelGrid TSDFVoxelGrid::Load(const std::string &file_name,
+                                  const core::Device &device,
+                                  const core::HashmapBackend &backend) {
+    TensorMap tensor_map("keys");
+    if (!t::io::ReadTensorMap(file_name, tensor_map, device)) {
+        utility::LogError("[TSDFVoxelGrid] Failed to load from {}.",
+                          file_name);
+    }
+    for (const char *key : {"keys", "values", "voxel_size", "sdf_trunc",
+                            "block_resolution", "block_count"}) {
+        if (!tensor_map.Contains(key)) {
+            utility::LogError(
+                    "[TSDFVoxelGrid] {} is not a TSDFVoxelGrid file, {} is "
+                    "missing.",
+                    file_name, key);
+        }
+    }
+
+    std::unordered_map<std::string, core::Dtype> attr_dtype_map;
+    const std::string dtype_prefix = "dtype_";
+    for (const auto &kv : tensor_map) {
+        if (kv.first.compare(0, dtype_prefix.size(), dtype_prefix) == 0) {
+            attr_dtype_map.emplace(kv.first.substr(dtype_prefix.size()),
+                                   kv.second.GetDtype());
+        }
+    }
+
+    const core::Device host("CPU:0");
+    const core::Tensor &keys = tensor_map["keys"];
+    const core::Tensor &values = tensor_map["values"];
+    int64_t block_count = std::max(
+            tensor_map["block_count"].To(host).Item<int64_t>(),
+            keys.GetLength());
+    TSDFVoxelGrid voxel_grid(
+            attr_dtype_map, tensor_map["voxel_size"].To(host).Item<float>(),
+            tensor_map["sdf_trunc"].To(host).Item<float>(),
+            tensor_map["block_resolution"].To(host).Item<int64_t>(),
+            block_count, device, backend);
+    if (keys.GetLength() > 0) {
+        core::Tensor addrs, masks;
+        voxel_grid.block_hashmap_->Insert(keys, values, addrs, masks);
+    }
+    return voxel_grid;
+}
+
+int64_t TSDFVoxelGrid::OffloadBlocks(const core::Tensor &extrinsics,
+                                     float radius,
+                                     const std::string &directory) {
+    if (block_hashmap_->Size() == 0) {
+        return 0;
+    }
+
+    core::Tensor active_addrs;
+    block_hashmap_->GetActiveIndices(active_addrs);
+    core::Tensor active_indices = active_addrs.To(core::Dtype::Int64);
+    core::Tensor active_keys =
+            block_hashmap_->GetKeyTensor().IndexGet({active_indices});
+    core::Tensor far_masks =
+            GetBlocksWithinRadius(active_keys, extrinsics, radius)
+                    .LogicalNot();
+    core::Tensor far_keys = active_keys.IndexGet({far_masks});
+    int64_t num_far = far_keys.GetLength();
+    if (num_far == 0) {
+        return 0;
+    }
+
+    const core::Device host("CPU:0");
+    core::Tensor far_values =
+            block_hashmap_->GetValueTensor()
+                    .IndexGet({active_indices.IndexGet({far_masks})})
+                    .To(host);
+    core::Tensor far_keys_host = far_keys.To(host);
+    core::Tensor addrs, masks;
+    block_hashmap_->Erase(far_keys, masks);
+
+    if (directory.empty()) {
+        if (host_block_hashmap_ == nullptr) {
+            core::SizeVector element_shape_value = far_values.GetShape();
+            element_shape_value.erase(element_shape_value.begin());
+            host_block_hashmap_ = std::make_shared<core::Hashmap>(
+                    num_far, core::Dtype::Int32, core::Dtype::UInt8,
+                    core::SizeVector{3}, element_shape_value, host);
+        }
+        host_block_hashmap_->Insert(far_keys_host, far_values, addrs, masks);
+    } else {
+        if (!utility::filesystem::DirectoryExists(directory)) {
+            utility::filesystem::MakeDirectoryHierarchy(directory);
+        }
+        std::string file_name =
+                fmt::format("{}/blocks_{:06d}.o3dt", directory,
+                            disk_block_files_.size());
+        TensorMap tensor_map("keys");
+        tensor_map["keys"] = far_keys_host;
+        tensor_map["values"] = far_values;
+        if (!t::io::WriteTensorMap(file_name, tensor_map)) {
+            utility::LogError("[TSDFVoxelGrid] Failed to offload blocks to {}.",
+                              file_name);
+        }
+
+        if (disk_block_index_ == nullptr) {
+            disk_block_index_ = std::make_shared<core::Hashmap>(
+                    num_far, core::Dtype::Int32, core::Dtype::Int64,
+                    core::SizeVector{3}, core::SizeVector{1}, host);
+        }
+        core::Tensor file_indices = core::Tensor::Full(
+                {num_far, 1}, static_cast<int64_t>(disk_block_files_.size()),
+                core::Dtype::Int64, host);
+        disk_block_index_->Insert(far_keys_host, file_indices, addrs, masks);
+        disk_block_files_.push_back(file_name);
+    }
+    return num_far;
+}
+
+int64_t TSDFVoxelGrid::ReloadBlocks(const core::Tensor &extrinsics,
+                                    float radius) {
+    int64_t count = 0;
+    for (const auto &store : {host_block_hashmap_, disk_block_index_}) {
+        if (store == nullptr || store->Size() == 0) {
+            continue;
+        }
+        core::Tensor keys = GetActiveEntries(*store).first;
+        count += ReloadBlocksByKeys(keys.IndexGet(
+                {GetBlocksWithinRadius(keys, extrinsics, radius)}));
+    }
+    return count;
+}
+
+int64_t TSDFVoxelGrid::GetOffloadedBlockCount() const {
+    int64_t count = 0;
+    if (host_block_hashmap_ != nullptr) {
+        count += host_block_hashmap_->Size();
+    }
+    if (disk_block_index_ != nullptr) {
+        count += disk_block_index_->Size();
+    }
+    return count;
+}
+
+int64_t TSDFVoxelGrid::ReloadBlocksByKeys(const core::Tensor &keys) {
+    if (GetOffloadedBlockCount() == 0 || keys.GetLength() == 0) {
+        return 0;
+    }
+
+    const core::Device host("CPU:0");
+    core::Tensor keys_host = keys.To(host);
+    core::Tensor addrs, masks;
+    int64_t count = 0;
+
+    if (host_block_hashmap_ != nullptr && host_block_hashmap_->Size() > 0) {
+        core::Tensor values;
+        host_block_hashmap_->FindValues(keys_host, values, masks);
+        core::Tensor found_keys = keys_host.IndexGet({masks});
+        if (found_keys.GetLength() > 0) {
+            block_hashmap_->Insert(found_keys.To(device_),
+                                   values.IndexGet({masks}).To(device_), addrs,
+                                   masks);
+            host_block_hashmap_->Erase(found_keys, masks);
+            count += found_keys.GetLength();
+        }
+    }
+
+    if (disk_block_index_ != nullptr && disk_block_index_->Size() > 0) {
+        core::Tensor file_indices;
+        disk_block_index_->FindValues(keys_host, file_indices, masks);
+        core::Tensor found_keys = keys_host.IndexGet({masks});
+        if (found_keys.GetLength() > 0) {
+            core::Tensor found_file_indices =
+                    file_indices.IndexGet({masks}).View({-1});
+            core::Tensor unique_file_indices =
+                    std::get<0>(found_file_indices.Unique());
+            for (int64_t file_index :
+                 unique_file_indices.ToFlatVector<int64_t>()) {
+                const std::string &file_name = disk_block_files_[file_index];
+                TensorMap tensor_map("keys");
+                if (!t::io::ReadTensorMap(file_name, tensor_map)) {
+                    utility::LogError(
+                            "[TSDFVoxelGrid] Failed to reload blocks from {}.",
+                            file_name);
+                }
+
+                // Look up the rows of the requested blocks in the file.
+                const core::Tensor &file_keys = tensor_map["keys"];
+                int64_t n = file_keys.GetLength();
+                core::Hashmap row_hashmap(n, core::Dtype::Int32,
+                                          core::Dtype::Int64,
+                                          core::SizeVector{3},
+                                          core::SizeVector{1}, host);
+                row_hashmap.Insert(file_keys,
+                                   core::Tensor::Arange(0, n).View({n, 1}),
+                                   addrs, masks);
+                core::Tensor reload_keys = found_keys.IndexGet(
+                        {found_file_indices.Eq(file_index)});
+                core::Tensor rows;
+                row_hashmap.FindValues(reload_keys, rows, masks);
+                block_hashmap_->Insert(
+                        reload_keys.To(device_),
+                        tensor_map["values"]
+                                .IndexGet({rows.View({-1})})
+                                .To(device_),
+                        addrs, masks);
+            }
+            disk_block_index_->Erase(found_keys, masks);
+            count += found_keys.GetLength();
+        }
+    }
+    return count;
+}
+
+void TSDFVoxelGrid::GetOffloadedBlocks(core::Tensor &keys,
+                                       core::Tensor &values) const {
+    std::vector<core::Tensor> keys_list, values_list;
+    if (host_block_hashmap_ != nullptr && host_block_hashmap_->Size() > 0) {
+        core::Tensor host_keys, host_values;
+        std::tie(host_keys, host_values) =
+                GetActiveEntries(*host_block_hashmap_);
+        keys_list.push_back(host_keys);
+        values_list.push_back(host_values);
+    }
+    for (size_t file_index = 0; file_index < disk_block_files_.size();
+         ++file_index) {
+        TensorMap tensor_map("keys");
+        if (!t::io::ReadTensorMap(disk_block_files_[file_index], tensor_map)) {
+            utility::LogError("[TSDFVoxelGrid] Failed to read blocks from {}.",
+                              disk_block_files_[file_index]);
+        }
+        // Blocks that were reloaded or offloaded again later are skipped.
+        core::Tensor file_indices, masks;
+        disk_block_index_->FindValues(tensor_map["keys"], file_indices, masks);
+        core::Tensor current_masks = masks.LogicalAnd(
+                file_indices.View({-1}).Eq(static_cast<int64_t>(file_index)));
+        keys_list.push_back(tensor_map["keys"].IndexGet({current_masks}));
+        values_list.push_back(tensor_map["values"].IndexGet({current_masks}));
+    }
+    if (keys_list.empty()) {
+        keys = core::Tensor({0, 3}, core::Dtype::Int32);
+        values = core::Tensor();
+        return;
+    }
+    keys = ConcatenateRows(keys_list);
+    values = ConcatenateRows(values_list);
+}
+
+core::Tensor TSDFVoxelGrid::GetBlocksWithinRadius(
+        const core::Tensor &keys,
+        const core::Tensor &extrinsics,
+        float radius) const {
+    // Camera center in world coordinates.
+    Eigen::Matrix4d extrinsic =
+            core::eigen_converter::TensorToEigenMatrixXd(extrinsics);
+    Eigen::Vector3d center = -extrinsic.block<3, 3>(0, 0).transpose() *
+                             extrinsic.block<3, 1>(0, 3);
+    core::Tensor center_t(std::vector<float>{static_cast<float>(center(0)),
+                                             static_cast<float>(center(1)),
+                                             static_cast<float>(center(2))},
+                          {1, 3}, core::Dtype::Float32, keys.GetDevice());
+
+    // Distances from the block centers.
+    float block_size = block_resolution_ * voxel_size_;
+    core::Tensor diff =
+            (keys.To(core::Dtype::Float32) + 0.5f) * block_size - center_t;
+    return (diff * diff).Sum({1}).Le(radius * radius);
+}
+
 std::pair<core::Tensor, core::Tensor> TSDFVoxelGrid::BufferRadiusNeighbors(
         const core::Tensor &active_addrs) {
     // Fixed radius search for spatially hashed voxel blocks.
@@ -410,6 +1123,37 @@ std::pair<core::Tensor, core::Tensor> TSDFVoxelGrid::BufferRadiusNeighbors(
     block_hashmap_->Find(keys_nb, addrs_nb, masks_nb);
     return std::make_pair(addrs_nb.View({27, n, 1}), masks_nb.View({27, n, 1}));
 }
+
+core::Tensor TSDFVoxelGrid::DilateActiveBlocks(const core::Tensor &keys,
+                                               bool positive_only) {
+    int64_t n = keys.GetLength();
+    int num_nb = positive_only ? 8 : 27;
+    core::Tensor keys_nb({num_nb, n, 3}, core::Dtype::Int32, device_);
+    for (int nb = 0; nb < num_nb; ++nb) {
+        std::vector<int> d = positive_only
+                                     ? std::vector<int>{nb % 2, (nb / 2) % 2,
+                                                        nb / 4}
+                                     : std::vector<int>{nb % 3 - 1,
+                                                        (nb % 9) / 3 - 1,
+                                                        nb / 9 - 1};
+        keys_nb[nb] = keys + core::Tensor(d, {1, 3}, core::Dtype::Int32,
+                                          device_);
+    }
+    keys_nb = keys_nb.View({num_nb * n, 3});
+
+    core::Tensor addrs_nb, masks_nb;
+    block_hashmap_->Find(keys_nb, addrs_nb, masks_nb);
+    keys_nb = keys_nb.IndexGet({masks_nb});
+
+    // Remove duplicates with a local hashmap, as in Touch.
+    int64_t num_active = keys_nb.GetLength();
+    core::Hashmap unique_hashmap(std::max<int64_t>(num_active, 1),
+                                 core::Dtype::Int32, core::Dtype::UInt8,
+                                 core::SizeVector{3}, core::SizeVector{1},
+                                 device_);
+    unique_hashmap.Activate(keys_nb, addrs_nb, masks_nb);
+    return keys_nb.IndexGet({masks_nb});
+}
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
@@ -30,6 +30,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorList.h"
@@ -41,6 +42,10 @@
 #include "open3d/t/geometry/TriangleMesh.h"
 
 namespace open3d {
+namespace core {
+class CUDAGraph;
+}  // namespace core
+
 namespace t {
 namespace geometry {
 
@@ -52,6 +57,11 @@ namespace geometry {
 /// (resolution, resolution, resolution, channel).
 /// For pure geometric TSDF voxels, channel = 2 (TSDF + weight).
 /// For colored TSDF voxels, channel = 5 (TSDF + weight + color).
+/// The voxel layout is selected by the dtypes of tsdf, weight and color:
+/// - Float32, Float32 (, Float32): full precision.
+/// - Float32, UInt16, UInt16: 16-bit weight and colors.
+/// - Int16, UInt16 (, UInt16): 16-bit quantized TSDF, weight and colors.
+/// - Int8, UInt8 (, UInt8): 8-bit quantized TSDF, weight and colors.
 /// Users may specialize their own channels that can be reinterpreted from the
 /// internal Tensor.
 class TSDFVoxelGrid {
@@ -86,6 +96,42 @@ public:
                    float depth_scale = 1000.0f,
                    float depth_max = 3.0f);
 
+    /// RGB-D integration into the precomputed blocks \p block_coords, e.g.
+    /// from GetFrustumBlockCoords(), which are allocated if needed. This skips
+    /// the estimation of the blocks in the viewing frustum.
+    void IntegrateBlocks(const core::Tensor &block_coords,
+                         const Image &depth,
+                         const Image &color,
+                         const core::Tensor &intrinsics,
+                         const core::Tensor &extrinsics,
+                         float depth_scale = 1000.0f,
+                         float depth_max = 3.0f);
+
+    /// Return the Int32 coordinates (N, 3) of the blocks Integrate() updates
+    /// for \p depth, i.e. the blocks in the viewing frustum within the
+    /// truncation distance of the observed surface.
+    core::Tensor GetFrustumBlockCoords(const Image &depth,
+                                       const core::Tensor &intrinsics,
+                                       const core::Tensor &extrinsics,
+                                       float depth_scale = 1000.0f,
+                                       float depth_max = 3.0f);
+
+    /// Let Integrate() reuse the blocks it computed for an earlier frame while
+    /// the camera stays within \p max_translation (in meter) and
+    /// \p max_rotation (in radian) of the pose of that frame, with the same
+    /// intrinsics and image size. Surfaces entering the view meanwhile are
+    /// integrated only where blocks are already allocated. Once the camera
+    /// moves further, the blocks are computed and allocated again. Negative
+    /// values disable the cache, which is the default.
+    void SetFrustumBlockCache(float max_translation, float max_rotation);
+
+    /// On CUDA devices, let RayCast() and RayCastBatch() launch the ray
+    /// marching as a CUDA graph, which saves the launch overhead of its
+    /// kernels when ray casting every frame. The graph is only instantiated
+    /// again if the launch configuration changes, e.g. with the image size.
+    /// Disabled by default. Has no effect on CPU devices.
+    void SetRayCastGraphCapture(bool enable);
+
     enum SurfaceMaskCode {
         None = 0,
         VertexMap = (1 << 0),
@@ -114,6 +160,51 @@ public:
             int ray_cast_mask = SurfaceMaskCode::DepthMap |
                                 SurfaceMaskCode::ColorMap);
 
+    /// Same as RayCast(), but writes into the maps of \p results, which are
+    /// reused across calls: a map requested by \p ray_cast_mask is only
+    /// allocated if \p results lacks it or holds one of another shape.
+    void RayCast(std::unordered_map<SurfaceMaskCode, core::Tensor> &results,
+                 const core::Tensor &intrinsics,
+                 const core::Tensor &extrinsics,
+                 int width,
+                 int height,
+                 float depth_scale = 1000.0f,
+                 float depth_min = 0.1f,
+                 float depth_max = 3.0f,
+                 float weight_threshold = 3.0f,
+                 int ray_cast_mask = SurfaceMaskCode::DepthMap |
+                                     SurfaceMaskCode::ColorMap);
+
+    /// Ray cast several views of the volume in one launch. \p extrinsics is
+    /// a (N, 4, 4) stack of poses, \p intrinsics a (3, 3) matrix shared by
+    /// all the views or a (N, 3, 3) stack. The output maps are stacked along
+    /// a leading dimension of size N, see RayCast() for the rest.
+    std::unordered_map<SurfaceMaskCode, core::Tensor> RayCastBatch(
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics,
+            int width,
+            int height,
+            float depth_scale = 1000.0f,
+            float depth_min = 0.1f,
+            float depth_max = 3.0f,
+            float weight_threshold = 3.0f,
+            int ray_cast_mask = SurfaceMaskCode::DepthMap |
+                                SurfaceMaskCode::ColorMap);
+
+    /// Same as RayCastBatch(), reusing the maps of \p results as RayCast().
+    void RayCastBatch(
+            std::unordered_map<SurfaceMaskCode, core::Tensor> &results,
+            const core::Tensor &intrinsics,
+            const core::Tensor &extrinsics,
+            int width,
+            int height,
+            float depth_scale = 1000.0f,
+            float depth_min = 0.1f,
+            float depth_max = 3.0f,
+            float weight_threshold = 3.0f,
+            int ray_cast_mask = SurfaceMaskCode::DepthMap |
+                                SurfaceMaskCode::ColorMap);
+
     /// Extract point cloud near iso-surfaces.
     /// Weight threshold is used to filter outliers. By default we use 3.0,
     /// where we assume a reliable surface point comes from the fusion of at
@@ -137,6 +228,23 @@ public:
                                SurfaceMaskCode::NormalMap |
                                SurfaceMaskCode::ColorMap);
 
+    /// Extract mesh with Marching Cubes, restricted to the blocks whose
+    /// triangles may have changed since the last call, i.e. the blocks
+    /// integrated since then and their neighbors. The blocks are identified by
+    /// their block coordinates, which are stable over integrations, so that
+    /// clients can replace the triangles of these blocks in place.
+    /// \param block_keys Output Int32 tensor (M, 3) of the coordinates of the
+    /// re-meshed blocks, including those that no longer have triangles.
+    /// The triangles of the returned mesh are sorted by block and carry a
+    /// "block_ids" triangle attribute of Int64 row indices into \p block_keys.
+    TriangleMesh ExtractUpdatedSurfaceMesh(
+            core::Tensor &block_keys,
+            int estimate_vertices = -1,
+            float weight_threshold = 3.0f,
+            int surface_mask = SurfaceMaskCode::VertexMap |
+                               SurfaceMaskCode::NormalMap |
+                               SurfaceMaskCode::ColorMap);
+
     /// Convert TSDFVoxelGrid to the target device.
     /// \param device The targeted device to convert to.
     /// \param copy If true, a new TSDFVoxelGrid is always created; if false,
@@ -160,6 +268,44 @@ public:
 
     std::shared_ptr<core::Hashmap> GetBlockHashmap() { return block_hashmap_; }
 
+    /// Insert the Int32 blocks \p block_coords (N, 3) with the voxels
+    /// \p block_values, e.g. taken from the block hashmap of another grid with
+    /// the same voxel layout. Blocks that exist already keep their voxels.
+    /// Like the blocks of the last integration, the inserted blocks bound the
+    /// ray ranges of the following RayCast() calls.
+    void InsertBlocks(const core::Tensor &block_coords,
+                      const core::Tensor &block_values);
+
+    /// Save the parameters and the blocks, including the offloaded blocks, to
+    /// a native binary file, see t::io::WriteTensorMap.
+    void Save(const std::string &file_name) const;
+
+    /// Load a TSDFVoxelGrid saved by Save() onto \p device.
+    static TSDFVoxelGrid Load(
+            const std::string &file_name,
+            const core::Device &device = core::Device("CPU:0"),
+            const core::HashmapBackend &backend =
+                    core::HashmapBackend::Default);
+
+    /// Move the blocks farther than \p radius (in meter) from the camera of
+    /// \p extrinsics out of the block hashmap, to host memory if
+    /// \p directory is empty, otherwise to a new file in \p directory, which
+    /// should not be shared with other grids. Offloaded blocks are reloaded
+    /// when Integrate() touches them or by ReloadBlocks(); until then, ray
+    /// casting and surface extraction do not see them.
+    /// \return The number of offloaded blocks.
+    int64_t OffloadBlocks(const core::Tensor &extrinsics,
+                          float radius,
+                          const std::string &directory = "");
+
+    /// Move the offloaded blocks within \p radius (in meter) of the camera of
+    /// \p extrinsics back into the block hashmap.
+    /// \return The number of reloaded blocks.
+    int64_t ReloadBlocks(const core::Tensor &extrinsics, float radius);
+
+    /// Return the number of offloaded blocks.
+    int64_t GetOffloadedBlockCount() const;
+
 protected:
     /// Return  addrs and masks for radius (3) neighbor entries.
     /// We first find all active entries in the hashmap with there coordinates.
@@ -173,6 +319,44 @@ protected:
     std::pair<core::Tensor, core::Tensor> BufferRadiusNeighbors(
             const core::Tensor &active_addrs);
 
+    /// Return the unique coordinates of the active blocks among \p keys and
+    /// their neighbors, in the 3^3 neighborhood if \p positive_only is false,
+    /// otherwise in the 2^3 neighborhood in the positive directions.
+    core::Tensor DilateActiveBlocks(const core::Tensor &keys,
+                                    bool positive_only);
+
+    /// Move the offloaded blocks among \p keys back into the block hashmap.
+    int64_t ReloadBlocksByKeys(const core::Tensor &keys);
+
+    /// Collect the keys and values of the offloaded blocks on CPU.
+    void GetOffloadedBlocks(core::Tensor &keys, core::Tensor &values) const;
+
+    /// Return a Bool mask of the blocks \p keys within \p radius of the
+    /// camera of \p extrinsics.
+    core::Tensor GetBlocksWithinRadius(const core::Tensor &keys,
+                                       const core::Tensor &extrinsics,
+                                       float radius) const;
+
+    /// Activate the blocks \p block_coords and return their addresses.
+    core::Tensor ActivateBlocks(const core::Tensor &block_coords);
+
+    /// Integrate into the active blocks \p block_coords at \p block_addrs.
+    void IntegrateActiveBlocks(const core::Tensor &block_coords,
+                               const core::Tensor &block_addrs,
+                               const Image &depth,
+                               const Image &color,
+                               const core::Tensor &intrinsics,
+                               const core::Tensor &extrinsics,
+                               float depth_scale,
+                               float depth_max);
+
+    /// Return true if the cached frustum blocks can be reused for the frame.
+    bool IsFrustumBlockCacheValid(const Image &depth,
+                                  const core::Tensor &intrinsics,
+                                  const core::Tensor &extrinsics,
+                                  float depth_scale,
+                                  float depth_max) const;
+
     float voxel_size_;
     float sdf_trunc_;
 
@@ -188,6 +372,35 @@ protected:
     std::shared_ptr<core::Hashmap> point_hashmap_;
     core::Tensor active_block_coords_;
 
+    // Blocks integrated since the last ExtractUpdatedSurfaceMesh
+    std::shared_ptr<core::Hashmap> dirty_block_hashmap_;
+
+    // Frustum blocks of an earlier frame, see SetFrustumBlockCache
+    struct FrustumBlockCache {
+        float max_translation = -1;
+        float max_rotation = -1;
+        core::Tensor block_coords;
+        core::Tensor block_addrs;
+        core::Tensor intrinsics;
+        core::Tensor extrinsics;
+        int64_t rows = 0;
+        int64_t cols = 0;
+        float depth_scale = 0;
+        float depth_max = 0;
+        int64_t hashmap_size = -1;
+        int64_t hashmap_capacity = -1;
+    };
+    FrustumBlockCache frustum_cache_;
+
+    // Graph of the ray marching kernels, see SetRayCastGraphCapture
+    std::shared_ptr<core::CUDAGraph> ray_cast_graph_;
+
+    // Blocks offloaded to host memory
+    std::shared_ptr<core::Hashmap> host_block_hashmap_;
+    // Blocks offloaded to disk: the index in disk_block_files_ of each block
+    std::shared_ptr<core::Hashmap> disk_block_index_;
+    std::vector<std::string> disk_block_files_;
+
     std::unordered_map<std::string, core::Dtype> attr_dtype_map_;
 };
 }  // namespace geometry
@@ -28,10 +28,16 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "open3d/core/Blob.h"
+#include "open3d/core/MemoryManager.h"
+#include "open3d/core/ShapeUtil.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -48,6 +54,119 @@ bool TensorMap::IsSizeSynchronized() const {
     return true;
 }
 
+/// Alignment in bytes of the tensors of a packed TensorMap.
+static constexpr int64_t kPackAlignment = 64;
+
+static int64_t AlignPackOffset(int64_t offset) {
+    return (offset + kPackAlignment - 1) / kPackAlignment * kPackAlignment;
+}
+
+TensorMap TensorMap::To(const core::Device& device, bool copy) const {
+    const std::pair<const void*, int64_t> span = GetPackedSpan();
+    if (span.first != nullptr && span.second > 0 &&
+        (copy || device != GetPrimaryDevice())) {
+        auto blob = std::make_shared<core::Blob>(span.second, device);
+        core::MemoryManager::Memcpy(blob->GetDataPtr(), device, span.first,
+                                    GetPrimaryDevice(), span.second);
+        TensorMap tensor_map(primary_key_);
+        for (const auto& kv : *this) {
+            const int64_t offset =
+                    static_cast<const char*>(kv.second.GetDataPtr()) -
+                    static_cast<const char*>(span.first);
+            tensor_map.emplace(
+                    kv.first,
+                    core::Tensor(kv.second.GetShape(), kv.second.GetStrides(),
+                                 static_cast<char*>(blob->GetDataPtr()) +
+                                         offset,
+                                 kv.second.GetDtype(), blob));
+        }
+        return tensor_map;
+    }
+
+    TensorMap tensor_map(primary_key_);
+    for (const auto& kv : *this) {
+        tensor_map.emplace(kv.first, kv.second.To(device, copy));
+    }
+    return tensor_map;
+}
+
+TensorMap TensorMap::Pack() const {
+    if (empty()) {
+        return *this;
+    }
+    // Sorting the keys makes the layout independent of the hashing order.
+    std::vector<std::string> keys;
+    for (const auto& kv : *this) {
+        keys.push_back(kv.first);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<int64_t> offsets;
+    int64_t byte_size = 0;
+    for (const std::string& key : keys) {
+        const core::Tensor& tensor = at(key);
+        byte_size = AlignPackOffset(byte_size);
+        offsets.push_back(byte_size);
+        byte_size += tensor.NumElements() * tensor.GetDtype().ByteSize();
+    }
+
+    const core::Device device = GetPrimaryDevice();
+    auto blob = std::make_shared<core::Blob>(byte_size, device);
+    TensorMap tensor_map(primary_key_);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        const core::Tensor& tensor = at(keys[i]);
+        core::Tensor packed(tensor.GetShape(),
+                            core::shape_util::DefaultStrides(tensor.GetShape()),
+                            static_cast<char*>(blob->GetDataPtr()) + offsets[i],
+                            tensor.GetDtype(), blob);
+        packed.CopyFrom(tensor);
+        tensor_map.emplace(keys[i], packed);
+    }
+    return tensor_map;
+}
+
+bool TensorMap::IsPacked() const { return GetPackedSpan().first != nullptr; }
+
+std::pair<const void*, int64_t> TensorMap::GetPackedSpan() const {
+    const std::pair<const void*, int64_t> not_packed(nullptr, 0);
+    if (empty()) {
+        return not_packed;
+    }
+    const std::shared_ptr<core::Blob> blob = at(primary_key_).GetBlob();
+    const char* begin = nullptr;
+    const char* end = nullptr;
+    int64_t packed_byte_size = 0;
+    for (const auto& kv : *this) {
+        const core::Tensor& tensor = kv.second;
+        if (blob == nullptr || tensor.GetBlob() != blob ||
+            !tensor.IsContiguous()) {
+            return not_packed;
+        }
+        const int64_t byte_size =
+                tensor.NumElements() * tensor.GetDtype().ByteSize();
+        const char* data_ptr = static_cast<const char*>(tensor.GetDataPtr());
+        begin = begin == nullptr ? data_ptr : std::min(begin, data_ptr);
+        end = end == nullptr ? data_ptr + byte_size
+                             : std::max(end, data_ptr + byte_size);
+        packed_byte_size += AlignPackOffset(byte_size);
+    }
+    // Tensors sharing the allocation of a larger tensor, e.g. slices, are not
+    // packed, since transferring the memory in between would be wasteful.
+    if (end - begin > packed_byte_size) {
+        return not_packed;
+    }
+    return std::make_pair(static_cast<const void*>(begin), end - begin);
+}
+
+std::future<TensorMap> TensorMap::ToAsync(const core::Device& device,
+                                          bool copy) const {
+    // The worker holds shallow copies of the tensors, keeping them alive.
+    TensorMap src = *this;
+    return std::async(std::launch::async, [src, device, copy]() {
+        return src.To(device, copy);
+    });
+}
+
 void TensorMap::AssertPrimaryKeyInMapOrEmpty() const {
     if (this->size() != 0 && this->count(primary_key_) == 0) {
         utility::LogError("TensorMap does not contain primary key \"{}\".",
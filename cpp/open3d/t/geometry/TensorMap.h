@@ -26,8 +26,10 @@
 
 #pragma once
 
+#include <future>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 #include "open3d/core/Tensor.h"
 
@@ -124,7 +126,34 @@ public:
     /// Same as C++20's std::unordered_map::contains().
     bool Contains(const std::string& key) const { return count(key) != 0; }
 
+    /// Returns a TensorMap with all tensors on \p device. If \p copy is
+    /// false, tensors already on \p device are shared instead of copied.
+    TensorMap To(const core::Device& device, bool copy = false) const;
+
+    /// \brief Returns a TensorMap with the same tensors, stored as contiguous
+    /// views of a single allocation on the primary tensor's device.
+    ///
+    /// To() of a packed TensorMap, including a copy on the same device,
+    /// transfers the whole allocation at once instead of one tensor at a time
+    /// and returns a packed TensorMap. Each tensor starts at a
+    /// 64-byte aligned offset. Assigning a new tensor to a key of a packed
+    /// TensorMap unpacks it, see IsPacked().
+    TensorMap Pack() const;
+
+    /// Returns true if all tensors are contiguous views of the same
+    /// allocation, laid out without gaps larger than the alignment of Pack().
+    bool IsPacked() const;
+
+    /// Same as To(device, copy), but the copies run on a worker thread and the
+    /// returned future becomes ready once all tensors have been transferred.
+    std::future<TensorMap> ToAsync(const core::Device& device,
+                                   bool copy = false) const;
+
 private:
+    /// Returns the beginning and the size in bytes of the memory spanned by
+    /// the tensors if they are packed, see IsPacked(), or nullptr otherwise.
+    std::pair<const void*, int64_t> GetPackedSpan() const;
+
     /// Asserts that the map indeed contains the primary_key. This is typically
     /// called in constructors.
     void AssertPrimaryKeyInMapOrEmpty() const;
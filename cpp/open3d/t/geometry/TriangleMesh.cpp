@@ -27,12 +27,17 @@
 #include "open3d/t/geometry/TriangleMesh.h"
 
 #include <Eigen/Core>
+#include <random>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Scan.h"
+#include "open3d/core/kernel/Segment.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
 
 namespace open3d {
 namespace t {
@@ -148,6 +153,597 @@ TriangleMesh TriangleMesh::To(const core::Device &device, bool copy) const {
     return mesh;
 }
 
+core::Tensor TriangleMesh::GetMinBound() const {
+    return GetVertices().Min({0});
+}
+
+core::Tensor TriangleMesh::GetMaxBound() const {
+    return GetVertices().Max({0});
+}
+
+core::Tensor TriangleMesh::GetCenter() const { return GetVertices().Mean({0}); }
+
+TriangleMesh &TriangleMesh::Transform(const core::Tensor &transformation) {
+    transformation.AssertShape({4, 4});
+    transformation.AssertDevice(device_);
+
+    core::Tensor &vertices = GetVertices();
+    core::Tensor R = transformation.Slice(0, 0, 3).Slice(1, 0, 3).To(
+            vertices.GetDtype());
+    core::Tensor t = transformation.Slice(0, 0, 3).Slice(1, 3, 4).To(
+            vertices.GetDtype());
+    vertices = R.Matmul(vertices.T()).Add_(t).T().Contiguous();
+
+    if (HasVertexNormals()) {
+        core::Tensor &normals = GetVertexNormals();
+        normals = R.To(normals.GetDtype()).Matmul(normals.T()).T().Contiguous();
+    }
+    if (HasTriangleNormals()) {
+        core::Tensor &normals = GetTriangleNormals();
+        normals = R.To(normals.GetDtype()).Matmul(normals.T()).T().Contiguous();
+    }
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::Translate(const core::Tensor &translation,
+                                      bool relative) {
+    translation.AssertShape({3});
+    translation.AssertDevice(device_);
+
+    core::Tensor transform = translation.To(GetVertices().GetDtype());
+    if (!relative) {
+        transform = transform - GetCenter();
+    }
+    GetVertices() += transform;
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::Scale(double scale, const core::Tensor &center) {
+    center.AssertShape({3});
+    center.AssertDevice(device_);
+
+    core::Tensor &vertices = GetVertices();
+    const core::Tensor c = center.To(vertices.GetDtype());
+    vertices.Sub_(c).Mul_(scale).Add_(c);
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::Rotate(const core::Tensor &R,
+                                   const core::Tensor &center) {
+    R.AssertShape({3, 3});
+    R.AssertDevice(device_);
+    center.AssertShape({3});
+    center.AssertDevice(device_);
+
+    core::Tensor &vertices = GetVertices();
+    const core::Tensor Rot = R.To(vertices.GetDtype());
+    const core::Tensor c = center.To(vertices.GetDtype());
+    vertices = Rot.Matmul((vertices - c).T()).T().Add_(c).Contiguous();
+
+    if (HasVertexNormals()) {
+        core::Tensor &normals = GetVertexNormals();
+        normals = Rot.To(normals.GetDtype())
+                          .Matmul(normals.T())
+                          .T()
+                          .Contiguous();
+    }
+    if (HasTriangleNormals()) {
+        core::Tensor &normals = GetTriangleNormals();
+        normals = Rot.To(normals.GetDtype())
+                          .Matmul(normals.T())
+                          .T()
+                          .Contiguous();
+    }
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::ComputeTriangleNormals() {
+    const core::Tensor vertices = GetVertices().Contiguous();
+    const core::Tensor triangles =
+            GetTriangles().To(core::Dtype::Int64).Contiguous();
+    core::Tensor normals = core::Tensor::Empty(
+            {triangles.GetLength(), 3}, vertices.GetDtype(), device_);
+    kernel::trianglemesh::ComputeTriangleNormals(vertices, triangles, normals);
+    SetTriangleNormals(normals);
+    return *this;
+}
+
+TriangleMesh &TriangleMesh::ComputeVertexNormals() {
+    const core::Tensor vertices = GetVertices().Contiguous();
+    const core::Tensor triangles =
+            GetTriangles().To(core::Dtype::Int64).Contiguous();
+    core::Tensor normals = core::Tensor::Zeros(
+            {vertices.GetLength(), 3}, vertices.GetDtype(), device_);
+    kernel::trianglemesh::ComputeVertexNormals(vertices, triangles, normals);
+    SetVertexNormals(normals);
+    return *this;
+}
+
+/// Returns the Float64 areas of the triangles of the mesh, whose indices are
+/// the Int64 tensor \p triangles.
+static core::Tensor ComputeTriangleAreas(const core::Tensor &vertices,
+                                         const core::Tensor &triangles) {
+    core::Tensor areas =
+            core::Tensor::Empty({triangles.GetLength()}, core::Dtype::Float64,
+                                vertices.GetDevice());
+    kernel::trianglemesh::ComputeTriangleAreas(vertices, triangles, areas);
+    return areas;
+}
+
+double TriangleMesh::GetSurfaceArea() const {
+    if (!HasTriangles() || GetTriangles().GetLength() == 0) {
+        return 0;
+    }
+    const core::Tensor triangles =
+            GetTriangles().To(core::Dtype::Int64).Contiguous();
+    return ComputeTriangleAreas(GetVertices().Contiguous(), triangles)
+            .Sum({0})
+            .Item<double>();
+}
+
+PointCloud TriangleMesh::SamplePointsUniformly(int64_t number_of_points,
+                                               bool use_triangle_normal,
+                                               int seed) const {
+    if (number_of_points <= 0) {
+        utility::LogError("number_of_points <= 0");
+    }
+    if (!HasTriangles() || GetTriangles().GetLength() == 0) {
+        utility::LogError("Input mesh has no triangles.");
+    }
+    const core::Tensor vertices = GetVertices().Contiguous();
+    const core::Tensor triangles =
+            GetTriangles().To(core::Dtype::Int64).Contiguous();
+    const core::Tensor triangle_cdf =
+            ComputeTriangleAreas(vertices, triangles).CumSum(0);
+    if (triangle_cdf[-1].Item<double>() <= 0) {
+        utility::LogError("Input mesh has no triangles with a positive area.");
+    }
+
+    const uint32_t seed_u =
+            seed < 0 ? std::random_device{}() : static_cast<uint32_t>(seed);
+    core::Tensor triangle_indices = core::Tensor::Empty(
+            {number_of_points}, core::Dtype::Int64, device_);
+    core::Tensor barycentric = core::Tensor::Empty(
+            {number_of_points, 3}, vertices.GetDtype(), device_);
+    kernel::trianglemesh::SampleTriangles(triangle_cdf, seed_u,
+                                          triangle_indices, barycentric);
+
+    // Interpolates a vertex attribute {N, 3} at the samples.
+    const core::Tensor corners =
+            triangles.IndexGet({triangle_indices}).Reshape({-1});
+    const core::Tensor weights = barycentric.Reshape({number_of_points, 3, 1});
+    auto interpolate = [&](const core::Tensor &attr) {
+        core::Tensor values =
+                (attr.IndexGet({corners})
+                         .Reshape({number_of_points, 3, 3})
+                         .To(weights.GetDtype()) *
+                 weights)
+                        .Sum({1});
+        if (attr.GetDtype().GetDtypeCode() != core::Dtype::DtypeCode::Float) {
+            values = values.Round();
+        }
+        return values.To(attr.GetDtype());
+    };
+
+    PointCloud pcd(interpolate(vertices));
+    if (use_triangle_normal) {
+        core::Tensor triangle_normals;
+        if (HasTriangleNormals()) {
+            triangle_normals = GetTriangleNormals();
+        } else {
+            TriangleMesh mesh(vertices, triangles);
+            triangle_normals =
+                    mesh.ComputeTriangleNormals().GetTriangleNormals();
+        }
+        pcd.SetPointNormals(triangle_normals.IndexGet({triangle_indices}));
+    } else if (HasVertexNormals()) {
+        pcd.SetPointNormals(interpolate(GetVertexNormals()));
+    }
+    if (HasVertexColors()) {
+        pcd.SetPointColors(interpolate(GetVertexColors()));
+    }
+    return pcd;
+}
+
+TriangleMesh TriangleMesh::SimplifyVertexClustering(
+        double voxel_size,
+        open3d::geometry::MeshBase::SimplificationContraction contraction,
+        const core::HashmapBackend &backend) const {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    const core::Tensor vertices = GetVertices().Contiguous();
+    const int64_t num_vertices = vertices.GetLength();
+    if (num_vertices == 0) {
+        return Clone();
+    }
+
+    // Dense cluster ids in [0, num_clusters) from the hashmap addresses, with
+    // the voxel grid of the legacy implementation.
+    const core::Tensor voxel_min_bound = GetMinBound() - voxel_size * 0.5;
+    const core::Tensor voxel_keys = ((vertices - voxel_min_bound) / voxel_size)
+                                            .Floor()
+                                            .To(core::Dtype::Int64);
+    core::Hashmap voxel_hashmap(num_vertices, core::Dtype::Int64,
+                                core::Dtype::Int32, {3}, {1}, device_, backend);
+    core::Tensor addrs, masks;
+    voxel_hashmap.Activate(voxel_keys, addrs, masks);
+    voxel_hashmap.Find(voxel_keys, addrs, masks);
+    core::Tensor unique, vertex_clusters, counts;
+    std::tie(unique, vertex_clusters, counts) =
+            addrs.To(core::Dtype::Int64).Unique(/*return_inverse=*/true);
+    const int64_t num_clusters = unique.GetLength();
+
+    const bool has_triangles = HasTriangles() && GetTriangles().GetLength() > 0;
+    const core::Tensor triangles =
+            has_triangles ? GetTriangles().To(core::Dtype::Int64).Contiguous()
+                          : core::Tensor();
+
+    // The vertex attributes are averaged over the vertices of each cluster.
+    const core::Tensor order = vertex_clusters.ArgSort();
+    const core::Tensor sorted_clusters = vertex_clusters.IndexGet({order});
+    TriangleMesh mesh(device_);
+    for (const auto &kv : vertex_attr_) {
+        const core::Tensor &attr = kv.second;
+        core::Tensor values = attr.IndexGet({order})
+                                      .To(core::Dtype::Float64)
+                                      .SegmentMean(sorted_clusters,
+                                                   num_clusters);
+        if (kv.first == "vertices" && has_triangles &&
+            contraction == open3d::geometry::MeshBase::
+                                   SimplificationContraction::Quadric) {
+            core::Tensor quadrics = core::Tensor::Zeros(
+                    {num_clusters, 9}, core::Dtype::Float64, device_);
+            kernel::trianglemesh::AccumulateClusterQuadrics(
+                    vertices, triangles, vertex_clusters, quadrics);
+            values = values.Contiguous();
+            kernel::trianglemesh::SolveClusterQuadrics(quadrics, values);
+        }
+        if (attr.GetDtype().GetDtypeCode() != core::Dtype::DtypeCode::Float) {
+            values = values.Round();
+        }
+        mesh.SetVertexAttr(kv.first, values.To(attr.GetDtype()));
+    }
+
+    if (has_triangles) {
+        core::Tensor remapped = core::Tensor::Empty(
+                {triangles.GetLength(), 3}, core::Dtype::Int64, device_);
+        core::Tensor valid = core::Tensor::Empty(
+                {triangles.GetLength()}, core::Dtype::Bool, device_);
+        kernel::trianglemesh::RemapTriangles(triangles, vertex_clusters,
+                                             remapped, valid);
+        remapped = remapped.IndexGet({valid});
+
+        // Identical triangles are merged into one.
+        if (remapped.GetLength() > 0) {
+            core::Hashmap triangle_hashmap(remapped.GetLength(),
+                                           core::Dtype::Int64,
+                                           core::Dtype::Int32, {3}, {1},
+                                           device_, backend);
+            triangle_hashmap.Activate(remapped, addrs, masks);
+            remapped = remapped.IndexGet({masks});
+        }
+        mesh.SetTriangles(remapped.To(GetTriangles().GetDtype()));
+        if (HasTriangleNormals()) {
+            mesh.ComputeTriangleNormals();
+        }
+    }
+    return mesh;
+}
+
+namespace {
+
+/// Edge adjacency of a mesh, on the device of its triangles.
+struct EdgeTopology {
+    /// Int64 {E, 2} end points v0 < v1 of the edges, sorted.
+    core::Tensor edges;
+    /// Int64 {M, 3} edge of corners c and (c + 1) % 3 of each triangle.
+    core::Tensor triangle_edges;
+    /// Int64 {E} number of triangles of each edge.
+    core::Tensor edge_triangle_counts;
+    /// Int64 CSR adjacency of the vertices, see kernel/TriangleMesh.h, with
+    /// the edge of each neighbor.
+    core::Tensor neighbor_offsets;
+    core::Tensor neighbors;
+    core::Tensor neighbor_edges;
+};
+
+/// Computes the edge topology of the Int64 \p triangles {M, 3}, M > 0, with
+/// sorts and prefix sums on their device.
+EdgeTopology ComputeEdgeTopology(const core::Tensor &triangles,
+                                 int64_t num_vertices) {
+    const core::Device device = triangles.GetDevice();
+    const int64_t num_triangles = triangles.GetLength();
+    core::Tensor keys = core::Tensor::Empty({3 * num_triangles},
+                                            core::Dtype::Int64, device);
+    kernel::trianglemesh::ComputeTriangleEdgeKeys(triangles, num_vertices,
+                                                  keys);
+    EdgeTopology topology;
+    core::Tensor edge_keys;
+    std::tie(edge_keys, topology.triangle_edges,
+             topology.edge_triangle_counts) =
+            keys.Unique(/*return_inverse=*/true, /*return_counts=*/true);
+    topology.triangle_edges = topology.triangle_edges.Reshape({-1, 3});
+    const int64_t num_edges = edge_keys.GetLength();
+    const core::Tensor v0 = edge_keys.Div(num_vertices);
+    const core::Tensor v1 = edge_keys - v0 * num_vertices;
+    topology.edges =
+            core::Tensor::Empty({num_edges, 2}, core::Dtype::Int64, device);
+    topology.edges.Slice(1, 0, 1) = v0.Reshape({num_edges, 1});
+    topology.edges.Slice(1, 1, 2) = v1.Reshape({num_edges, 1});
+
+    // Both directions of the edges, sorted by their first vertex.
+    core::Tensor directed =
+            core::Tensor::Empty({2 * num_edges}, core::Dtype::Int64, device);
+    directed.Slice(0, 0, num_edges) = edge_keys;
+    directed.Slice(0, num_edges, 2 * num_edges) = v1 * num_vertices + v0;
+    const core::Tensor order = directed.ArgSort();
+    const core::Tensor sorted = directed.IndexGet({order});
+    const core::Tensor rows = sorted.Div(num_vertices);
+    topology.neighbors = sorted - rows * num_vertices;
+    topology.neighbor_edges =
+            order - order.Ge(num_edges).To(core::Dtype::Int64) * num_edges;
+    topology.neighbor_offsets =
+            core::kernel::SegmentOffsets(rows, num_vertices);
+    return topology;
+}
+
+/// Returns the names of the vertex attributes filtered for \p scope.
+std::vector<std::string> GetFilteredAttributes(
+        const TriangleMesh &mesh,
+        open3d::geometry::MeshBase::FilterScope scope) {
+    using FilterScope = open3d::geometry::MeshBase::FilterScope;
+    std::vector<std::string> keys;
+    if (scope == FilterScope::All || scope == FilterScope::Vertex) {
+        keys.push_back("vertices");
+    }
+    if ((scope == FilterScope::All || scope == FilterScope::Normal) &&
+        mesh.HasVertexNormals()) {
+        keys.push_back("normals");
+    }
+    if ((scope == FilterScope::All || scope == FilterScope::Color) &&
+        mesh.HasVertexColors()) {
+        keys.push_back("colors");
+    }
+    return keys;
+}
+
+/// Returns the vertex attribute as a floating point tensor {N, C}.
+core::Tensor ToFloatRows(const core::Tensor &attr) {
+    core::Tensor values = attr.Reshape({attr.GetLength(), -1});
+    if (values.GetDtype() != core::Dtype::Float32 &&
+        values.GetDtype() != core::Dtype::Float64) {
+        values = values.To(core::Dtype::Float32);
+    }
+    return values.Contiguous();
+}
+
+/// Converts \p values back to the dtype and the row shape of \p attr.
+core::Tensor FromFloatRows(const core::Tensor &values,
+                           const core::Tensor &attr) {
+    core::SizeVector shape = attr.GetShape();
+    shape[0] = values.GetLength();
+    core::Tensor result = values;
+    if (attr.GetDtype().GetDtypeCode() != core::Dtype::DtypeCode::Float) {
+        result = result.Round();
+    }
+    return result.To(attr.GetDtype()).Reshape(shape);
+}
+
+/// Applies the Laplacian filter with the parameters \p lambdas in turn per
+/// iteration.
+TriangleMesh FilterSmooth(const TriangleMesh &mesh,
+                          int number_of_iterations,
+                          const std::vector<double> &lambdas,
+                          open3d::geometry::MeshBase::FilterScope scope) {
+    TriangleMesh result = mesh.Clone();
+    if (!mesh.HasVertices() || !mesh.HasTriangles() ||
+        number_of_iterations <= 0) {
+        return result;
+    }
+    const core::Tensor triangles =
+            mesh.GetTriangles().To(core::Dtype::Int64).Contiguous();
+    const int64_t num_vertices = mesh.GetVertices().GetLength();
+    const EdgeTopology topology = ComputeEdgeTopology(triangles, num_vertices);
+
+    const std::vector<std::string> keys = GetFilteredAttributes(mesh, scope);
+    std::vector<core::Tensor> values;
+    for (const std::string &key : keys) {
+        values.push_back(ToFloatRows(mesh.GetVertexAttr(key)));
+    }
+    core::Tensor vertices = mesh.GetVertices().Contiguous();
+    core::Tensor weights =
+            core::Tensor::Empty({topology.neighbors.GetLength()},
+                                core::Dtype::Float64, mesh.GetDevice());
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        for (double lambda_filter : lambdas) {
+            // The weights depend on the vertices of the previous pass.
+            kernel::trianglemesh::ComputeInverseDistanceWeights(
+                    vertices, topology.neighbor_offsets, topology.neighbors,
+                    weights);
+            for (size_t i = 0; i < keys.size(); ++i) {
+                core::Tensor filtered = core::Tensor::EmptyLike(values[i]);
+                kernel::trianglemesh::FilterSmoothLaplacian(
+                        topology.neighbor_offsets, topology.neighbors, weights,
+                        values[i], lambda_filter, filtered);
+                values[i] = filtered;
+                if (keys[i] == "vertices") {
+                    vertices = filtered;
+                }
+            }
+        }
+    }
+    for (size_t i = 0; i < keys.size(); ++i) {
+        result.SetVertexAttr(
+                keys[i], FromFloatRows(values[i], mesh.GetVertexAttr(keys[i])));
+    }
+    if (result.HasTriangleNormals()) {
+        result.ComputeTriangleNormals();
+    }
+    return result;
+}
+
+}  // namespace
+
+TriangleMesh TriangleMesh::FilterSmoothLaplacian(
+        int number_of_iterations,
+        double lambda_filter,
+        open3d::geometry::MeshBase::FilterScope scope) const {
+    return FilterSmooth(*this, number_of_iterations, {lambda_filter}, scope);
+}
+
+TriangleMesh TriangleMesh::FilterSmoothTaubin(
+        int number_of_iterations,
+        double lambda_filter,
+        double mu,
+        open3d::geometry::MeshBase::FilterScope scope) const {
+    return FilterSmooth(*this, number_of_iterations, {lambda_filter, mu},
+                        scope);
+}
+
+TriangleMesh TriangleMesh::SubdivideLoop(int number_of_iterations) const {
+    if (!HasVertices() || !HasTriangles() || number_of_iterations <= 0) {
+        return Clone();
+    }
+    core::Tensor triangles = GetTriangles().To(core::Dtype::Int64).Contiguous();
+    std::vector<std::string> keys;
+    std::vector<core::Tensor> values;
+    for (const auto &kv : vertex_attr_) {
+        keys.push_back(kv.first);
+        values.push_back(ToFloatRows(kv.second));
+    }
+    // Triangle of the input mesh of each triangle.
+    core::Tensor parents = core::Tensor::Arange(0, triangles.GetLength(), 1,
+                                                core::Dtype::Int64, device_);
+
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        const int64_t num_vertices = values[0].GetLength();
+        const int64_t num_triangles = triangles.GetLength();
+        const EdgeTopology topology =
+                ComputeEdgeTopology(triangles, num_vertices);
+        if (iter == 0 && topology.edge_triangle_counts.Gt(2).Any()) {
+            utility::LogWarning("[SubdivideLoop] non-manifold edge.");
+        }
+        const int64_t num_edges = topology.edges.GetLength();
+        for (core::Tensor &attr_values : values) {
+            core::Tensor new_values = core::Tensor::Empty(
+                    {num_vertices + num_edges, attr_values.GetShape(1)},
+                    attr_values.GetDtype(), device_);
+            kernel::trianglemesh::SubdivideLoopVertices(
+                    topology.neighbor_offsets, topology.neighbors,
+                    topology.neighbor_edges, topology.edge_triangle_counts,
+                    attr_values, new_values);
+            kernel::trianglemesh::SubdivideLoopEdges(
+                    triangles, topology.triangle_edges, topology.edges,
+                    topology.edge_triangle_counts, attr_values, new_values);
+            attr_values = new_values;
+        }
+        core::Tensor new_triangles = core::Tensor::Empty(
+                {4 * num_triangles, 3}, core::Dtype::Int64, device_);
+        kernel::trianglemesh::SubdivideTriangles(
+                triangles, topology.triangle_edges, num_vertices,
+                new_triangles);
+        triangles = new_triangles;
+        parents = parents.IndexGet(
+                {core::Tensor::Arange(0, 4 * num_triangles, 1,
+                                      core::Dtype::Int64, device_)
+                         .Div(4)});
+    }
+
+    TriangleMesh mesh(device_);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        mesh.SetVertexAttr(keys[i],
+                           FromFloatRows(values[i], GetVertexAttr(keys[i])));
+    }
+    mesh.SetTriangles(triangles.To(GetTriangles().GetDtype()));
+    for (const auto &kv : triangle_attr_) {
+        if (kv.first != "triangles") {
+            mesh.SetTriangleAttr(kv.first, kv.second.IndexGet({parents}));
+        }
+    }
+    if (HasTriangleNormals()) {
+        mesh.ComputeTriangleNormals();
+    }
+    return mesh;
+}
+
+TriangleMesh TriangleMesh::CreateIsosurface(const core::Tensor &grid,
+                                            const core::Tensor &min_bound,
+                                            const core::Tensor &max_bound,
+                                            double iso_value) {
+    if (grid.NumDims() != 3) {
+        utility::LogError("grid must have shape {{nz, ny, nx}}, but got {}.",
+                          grid.GetShape());
+    }
+    if (grid.GetDtype() != core::Dtype::Float32 &&
+        grid.GetDtype() != core::Dtype::Float64) {
+        utility::LogError("grid must be Float32 or Float64, but got {}.",
+                          grid.GetDtype().ToString());
+    }
+    min_bound.AssertShape({3});
+    max_bound.AssertShape({3});
+
+    const core::Device device = grid.GetDevice();
+    TriangleMesh mesh(core::Tensor({0, 3}, grid.GetDtype(), device),
+                      core::Tensor({0, 3}, core::Dtype::Int64, device));
+    const int64_t nz = grid.GetShape(0);
+    const int64_t ny = grid.GetShape(1);
+    const int64_t nx = grid.GetShape(2);
+    if (nz < 2 || ny < 2 || nx < 2) {
+        return mesh;
+    }
+
+    static const core::Device host("CPU:0");
+    const core::Tensor origin = min_bound.To(host, core::Dtype::Float64);
+    const core::Tensor spacing =
+            (max_bound.To(host, core::Dtype::Float64) - origin) /
+            core::Tensor::Init<double>({double(nx - 1), double(ny - 1),
+                                        double(nz - 1)});
+
+    const core::Tensor grid_c = grid.Contiguous();
+    core::Tensor point_edges =
+            core::Tensor::Empty({nz, ny, nx}, core::Dtype::UInt8, device);
+    core::Tensor cube_indices =
+            core::Tensor::Empty({nz, ny, nx}, core::Dtype::UInt8, device);
+    kernel::trianglemesh::MarchingCubesClassify(grid_c, iso_value,
+                                                point_edges, cube_indices);
+
+    // Only the points with crossed edges and the cells with triangles are
+    // kept, so that the offsets are computed over the surface only.
+    const core::Tensor active_points = core::kernel::Compact(point_edges);
+    const core::Tensor active_cells = core::kernel::Compact(cube_indices);
+    if (active_cells.GetLength() == 0) {
+        return mesh;
+    }
+    core::Tensor vertex_counts = core::Tensor::Empty(
+            {active_points.GetLength()}, core::Dtype::Int64, device);
+    core::Tensor triangle_counts = core::Tensor::Empty(
+            {active_cells.GetLength()}, core::Dtype::Int64, device);
+    kernel::trianglemesh::MarchingCubesCount(point_edges, cube_indices,
+                                             active_points, active_cells,
+                                             vertex_counts, triangle_counts);
+    const core::Tensor vertex_offsets =
+            vertex_counts.CumSum(0, /*exclusive=*/true);
+    const core::Tensor triangle_offsets =
+            triangle_counts.CumSum(0, /*exclusive=*/true);
+    const int64_t num_vertices = vertex_offsets[-1].Item<int64_t>() +
+                                 vertex_counts[-1].Item<int64_t>();
+    const int64_t num_triangles = triangle_offsets[-1].Item<int64_t>() +
+                                  triangle_counts[-1].Item<int64_t>();
+
+    core::Tensor vertices =
+            core::Tensor::Empty({num_vertices, 3}, grid.GetDtype(), device);
+    core::Tensor triangles =
+            core::Tensor::Empty({num_triangles, 3}, core::Dtype::Int64, device);
+    kernel::trianglemesh::MarchingCubesExtract(
+            grid_c, iso_value, origin, spacing, point_edges, cube_indices,
+            active_points, active_cells, vertex_offsets, triangle_offsets,
+            vertices, triangles);
+    mesh.SetVertices(vertices);
+    mesh.SetTriangles(triangles);
+    return mesh;
+}
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
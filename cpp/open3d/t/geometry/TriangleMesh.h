@@ -27,8 +27,10 @@
 #pragma once
 
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/Geometry.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/TensorMap.h"
 
 namespace open3d {
@@ -390,31 +392,159 @@ public:
     /// Returns !HasVertices(), triangles are ignored.
     bool IsEmpty() const override { return !HasVertices(); }
 
-    core::Tensor GetMinBound() const { utility::LogError("Unimplemented"); }
+    /// Returns the min bound for point coordinates.
+    core::Tensor GetMinBound() const;
 
-    core::Tensor GetMaxBound() const { utility::LogError("Unimplemented"); }
+    /// Returns the max bound for point coordinates.
+    core::Tensor GetMaxBound() const;
 
-    core::Tensor GetCenter() const { utility::LogError("Unimplemented"); }
+    /// Returns the center of the vertices, i.e. their mean.
+    core::Tensor GetCenter() const;
 
-    TriangleMesh &Transform(const core::Tensor &transformation) {
-        utility::LogError("Unimplemented");
-    }
+    /// \brief Transforms the vertices, the vertex normals and the triangle
+    /// normals (if exist) of the TriangleMesh, like PointCloud::Transform().
+    /// \param transformation Transformation [Tensor of dim {4,4}], on the
+    /// device of the TriangleMesh.
+    /// \return Transformed triangle mesh.
+    TriangleMesh &Transform(const core::Tensor &transformation);
 
+    /// \brief Translates the vertices of the TriangleMesh.
+    /// \param translation Translation tensor of dimension {3}, on the device
+    /// of the TriangleMesh.
+    /// \param relative If true (default), translates by \p translation,
+    /// otherwise moves the center to \p translation.
+    /// \return Translated triangle mesh.
     TriangleMesh &Translate(const core::Tensor &translation,
-                            bool relative = true) {
-        utility::LogError("Unimplemented");
-    }
-
-    TriangleMesh &Scale(double scale, const core::Tensor &center) {
-        utility::LogError("Unimplemented");
-    }
-
-    TriangleMesh &Rotate(const core::Tensor &R, const core::Tensor &center) {
-        utility::LogError("Unimplemented");
-    }
+                            bool relative = true);
+
+    /// \brief Scales the vertices of the TriangleMesh.
+    /// \param scale Scale factor.
+    /// \param center Center [Tensor of dim {3}] about which the TriangleMesh
+    /// is scaled, on the device of the TriangleMesh.
+    /// \return Scaled triangle mesh.
+    TriangleMesh &Scale(double scale, const core::Tensor &center);
+
+    /// \brief Rotates the vertices and the normals (if exist).
+    /// \param R Rotation [Tensor of dim {3,3}], on the device of the
+    /// TriangleMesh.
+    /// \param center Center [Tensor of dim {3}] about which the TriangleMesh
+    /// is rotated, on the device of the TriangleMesh.
+    /// \return Rotated triangle mesh.
+    TriangleMesh &Rotate(const core::Tensor &R, const core::Tensor &center);
+
+    /// Computes the unit normals of the triangles, 0 for degenerate triangles,
+    /// and stores them as the triangle attribute "normals".
+    TriangleMesh &ComputeTriangleNormals();
+
+    /// Computes the unit normals of the vertices as the area weighted average
+    /// of the normals of their triangles and stores them as the vertex
+    /// attribute "normals".
+    TriangleMesh &ComputeVertexNormals();
+
+    /// Returns the sum of the areas of the triangles.
+    double GetSurfaceArea() const;
+
+    /// \brief Samples points uniformly on the surface of the mesh, like the
+    /// legacy TriangleMesh::SamplePointsUniformly().
+    ///
+    /// The vertex colors and normals are interpolated at the samples.
+    ///
+    /// \param number_of_points Number of points to sample.
+    /// \param use_triangle_normal If true, the normals of the samples are the
+    /// normals of their triangles, which are computed if missing.
+    /// \param seed Seed of the random samples, if -1 a random seed is used.
+    /// The samples of a seed are the same on all devices.
+    PointCloud SamplePointsUniformly(int64_t number_of_points,
+                                     bool use_triangle_normal = false,
+                                     int seed = -1) const;
+
+    /// \brief Simplifies the mesh by merging the vertices falling into the
+    /// same voxel, like the legacy TriangleMesh::SimplifyVertexClustering().
+    ///
+    /// The vertex attributes are averaged per voxel. With the Quadric
+    /// contraction, the merged vertex minimizes the error quadric of the
+    /// triangles of the voxel if it is well conditioned. Degenerate and
+    /// duplicate triangles are removed, and the triangle normals are
+    /// recomputed if present.
+    ///
+    /// \param voxel_size Voxel size. A positive number.
+    /// \param contraction Position of the merged vertices.
+    /// \param backend Backend of the hashmaps grouping vertices and triangles.
+    TriangleMesh SimplifyVertexClustering(
+            double voxel_size,
+            open3d::geometry::MeshBase::SimplificationContraction contraction =
+                    open3d::geometry::MeshBase::SimplificationContraction::
+                            Average,
+            const core::HashmapBackend &backend =
+                    core::HashmapBackend::Default) const;
+
+    /// \brief Smooths the mesh like the legacy
+    /// TriangleMesh::FilterSmoothLaplacian(), moving the filtered vertex
+    /// attributes towards the inverse distance weighted mean of the
+    /// neighbors.
+    ///
+    /// The vertex adjacency is computed once in CSR form on the device of the
+    /// mesh. Triangle normals are recomputed if present.
+    ///
+    /// \param number_of_iterations Number of smoothing iterations.
+    /// \param lambda_filter Smoothing parameter.
+    /// \param scope The vertex attributes to filter, "vertices", "normals"
+    /// and "colors" for All.
+    TriangleMesh FilterSmoothLaplacian(
+            int number_of_iterations,
+            double lambda_filter = 0.5,
+            open3d::geometry::MeshBase::FilterScope scope =
+                    open3d::geometry::MeshBase::FilterScope::All) const;
+
+    /// \brief Smooths the mesh with the method of Taubin, "Curve and Surface
+    /// Smoothing Without Shrinkage", 1995, like the legacy
+    /// TriangleMesh::FilterSmoothTaubin(). Each iteration applies
+    /// FilterSmoothLaplacian() with \p lambda_filter and then with \p mu.
+    TriangleMesh FilterSmoothTaubin(
+            int number_of_iterations,
+            double lambda_filter = 0.5,
+            double mu = -0.53,
+            open3d::geometry::MeshBase::FilterScope scope =
+                    open3d::geometry::MeshBase::FilterScope::All) const;
+
+    /// \brief Subdivides the mesh with the method of Loop, "Smooth
+    /// subdivision surfaces based on triangles", 1987, like the legacy
+    /// TriangleMesh::SubdivideLoop().
+    ///
+    /// All vertex attributes are subdivided, and the triangle attributes are
+    /// copied to the 4 triangles of each split triangle. Triangle normals are
+    /// recomputed if present. The new vertex of edge e, numbered by the
+    /// sorted edges, is appended at index num_vertices + e.
+    ///
+    /// \param number_of_iterations Number of subdivisions.
+    TriangleMesh SubdivideLoop(int number_of_iterations) const;
 
     core::Device GetDevice() const { return device_; }
 
+    /// \brief Extracts the iso-surface of a dense scalar grid with marching
+    /// cubes, e.g. of the signed distances computed by
+    /// RaycastingScene::ComputeSignedDistanceGrid().
+    ///
+    /// The mesh is extracted in two passes, classifying the grid points and
+    /// cells first and writing the compacted vertices and triangles at
+    /// prefix sum offsets next, so that the output is not over-allocated.
+    /// Each crossed grid edge yields one vertex shared by its triangles. The
+    /// triangles are oriented towards the values above \p iso_value.
+    ///
+    /// \param grid Float32 or Float64 tensor {nz, ny, nx} without NaN values,
+    /// on the CPU or a CUDA device.
+    /// \param min_bound The position [x, y, z] of the first grid point with
+    /// shape {3}.
+    /// \param max_bound The position [x, y, z] of the last grid point with
+    /// shape {3}.
+    /// \param iso_value The value of the extracted surface.
+    /// \return A mesh with vertices of the dtype of \p grid and Int64
+    /// triangles, on the device of \p grid.
+    static TriangleMesh CreateIsosurface(const core::Tensor &grid,
+                                         const core::Tensor &min_bound,
+                                         const core::Tensor &max_bound,
+                                         double iso_value = 0.0);
+
     /// Create a TriangleMesh from a legacy Open3D TriangleMesh.
     /// \param mesh_legacy Legacy Open3D TriangleMesh.
     /// \param float_dtype Float32 or Float64, used to store floating point
@@ -0,0 +1,274 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+static const core::Device host("CPU:0");
+
+VoxelGrid::VoxelGrid(double voxel_size,
+                     const core::Tensor& origin,
+                     const core::Device& device,
+                     int64_t init_capacity)
+    : voxel_size_(voxel_size),
+      origin_(origin.To(host, core::Dtype::Float64).Contiguous()),
+      device_(device) {
+    if (voxel_size_ <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    origin_.AssertShape({3});
+    voxels_ = std::make_shared<core::Hashmap>(
+            std::max<int64_t>(init_capacity, 1), core::Dtype::Int32,
+            core::Dtype::Float32, core::SizeVector{3}, core::SizeVector{3},
+            device_);
+}
+
+VoxelGrid VoxelGrid::CreateFromPointCloud(const PointCloud& pcd,
+                                          double voxel_size) {
+    if (voxel_size <= 0) {
+        utility::LogError("voxel_size must be positive.");
+    }
+    const core::Device device = pcd.GetDevice();
+    const core::Tensor points = pcd.GetPoints().To(core::Dtype::Float64);
+    const int64_t n = points.GetLength();
+    if (n == 0) {
+        return VoxelGrid(voxel_size,
+                         core::Tensor::Zeros({3}, core::Dtype::Float64),
+                         device);
+    }
+
+    // Same bounds as the legacy VoxelGrid::CreateFromPointCloud.
+    core::Tensor min_bound = points.Min({0}) - voxel_size / 2;
+    VoxelGrid voxel_grid(voxel_size, min_bound, device, n);
+
+    // Linearize the voxel indices, so that the points are grouped by voxel
+    // with a sort.
+    core::Tensor indices =
+            ((points - min_bound) / voxel_size).Floor().To(core::Dtype::Int64);
+    std::vector<int64_t> extents =
+            (indices.Max({0}) + 1).To(host).ToFlatVector<int64_t>();
+    if (double(extents[0]) * double(extents[1]) * double(extents[2]) >
+        double(std::numeric_limits<int64_t>::max())) {
+        utility::LogError("voxel_size is too small.");
+    }
+    core::Tensor keys =
+            (indices.Slice(1, 0, 1) * extents[1] + indices.Slice(1, 1, 2)) *
+                    extents[2] +
+            indices.Slice(1, 2, 3);
+    keys = keys.Reshape({n});
+    core::Tensor unique, inverse, counts;
+    std::tie(unique, inverse, counts) = keys.Unique(true, true);
+    const int64_t num_voxels = unique.GetLength();
+    core::Tensor order = keys.ArgSort();
+    core::Tensor first = order.IndexGet({counts.CumSum(0, true)});
+    core::Tensor voxel_indices =
+            indices.IndexGet({first}).To(core::Dtype::Int32);
+
+    core::Tensor colors;
+    if (pcd.HasPointColors()) {
+        colors = pcd.GetPointColors()
+                         .To(core::Dtype::Float64)
+                         .IndexGet({order})
+                         .SegmentMean(inverse.IndexGet({order}), num_voxels)
+                         .To(core::Dtype::Float32);
+    } else {
+        colors = core::Tensor::Zeros({num_voxels, 3}, core::Dtype::Float32,
+                                     device);
+    }
+    voxel_grid.AddVoxels(voxel_indices, colors);
+    return voxel_grid;
+}
+
+VoxelGrid VoxelGrid::FromLegacyVoxelGrid(
+        const open3d::geometry::VoxelGrid& voxel_grid,
+        const core::Device& device) {
+    const std::vector<open3d::geometry::Voxel> voxels = voxel_grid.GetVoxels();
+    const int64_t n = int64_t(voxels.size());
+    std::vector<int> indices(3 * n);
+    std::vector<float> colors(3 * n);
+    for (int64_t i = 0; i < n; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            indices[3 * i + c] = voxels[i].grid_index_(c);
+            colors[3 * i + c] = float(voxels[i].color_(c));
+        }
+    }
+    const Eigen::Vector3d& origin = voxel_grid.origin_;
+    VoxelGrid output(voxel_grid.voxel_size_,
+                     core::Tensor(std::vector<double>{origin(0), origin(1),
+                                                      origin(2)},
+                                  {3}, core::Dtype::Float64),
+                     device, n);
+    if (n > 0) {
+        output.AddVoxels(
+                core::Tensor(indices, {n, 3}, core::Dtype::Int32, device),
+                core::Tensor(colors, {n, 3}, core::Dtype::Float32, device));
+    }
+    return output;
+}
+
+open3d::geometry::VoxelGrid VoxelGrid::ToLegacyVoxelGrid() const {
+    open3d::geometry::VoxelGrid voxel_grid;
+    voxel_grid.voxel_size_ = voxel_size_;
+    const double* origin_ptr = origin_.GetDataPtr<double>();
+    voxel_grid.origin_ =
+            Eigen::Vector3d(origin_ptr[0], origin_ptr[1], origin_ptr[2]);
+    std::vector<int> indices =
+            GetVoxelIndices().To(host).ToFlatVector<int>();
+    std::vector<float> colors = GetVoxelColors().To(host).ToFlatVector<float>();
+    const size_t n = indices.size() / 3;
+    voxel_grid.voxels_.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        voxel_grid.AddVoxel(open3d::geometry::Voxel(
+                Eigen::Vector3i(indices[3 * i], indices[3 * i + 1],
+                                indices[3 * i + 2]),
+                Eigen::Vector3d(colors[3 * i], colors[3 * i + 1],
+                                colors[3 * i + 2])));
+    }
+    return voxel_grid;
+}
+
+void VoxelGrid::AddVoxels(const core::Tensor& voxel_indices,
+                          const core::Tensor& colors) {
+    voxel_indices.AssertShapeCompatible({utility::nullopt, 3});
+    voxel_indices.AssertDtype(core::Dtype::Int32);
+    voxel_indices.AssertDevice(device_);
+    colors.AssertShape({voxel_indices.GetLength(), 3});
+    colors.AssertDevice(device_);
+    if (voxel_indices.GetLength() == 0) {
+        return;
+    }
+
+    // Activate the new voxels, then write the colors of all of them.
+    core::Tensor addrs, masks;
+    voxels_->Activate(voxel_indices.Contiguous(), addrs, masks);
+    voxels_->Find(voxel_indices.Contiguous(), addrs, masks);
+    voxels_->GetValueTensor().IndexSet(
+            {addrs.To(core::Dtype::Int64)},
+            colors.To(core::Dtype::Float32).Contiguous());
+}
+
+core::Tensor VoxelGrid::GetVoxelIndices() const {
+    core::Tensor addrs;
+    voxels_->GetActiveIndices(addrs);
+    return voxels_->GetKeyTensor().IndexGet({addrs.To(core::Dtype::Int64)});
+}
+
+core::Tensor VoxelGrid::GetVoxelColors() const {
+    core::Tensor addrs;
+    voxels_->GetActiveIndices(addrs);
+    return voxels_->GetValueTensor().IndexGet({addrs.To(core::Dtype::Int64)});
+}
+
+core::Tensor VoxelGrid::GetVoxelIndex(const core::Tensor& points) const {
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    points.AssertDevice(device_);
+    return ((points.To(core::Dtype::Float64) - origin_.To(device_)) /
+            voxel_size_)
+            .Floor()
+            .To(core::Dtype::Int32);
+}
+
+core::Tensor VoxelGrid::CheckIfIncluded(const core::Tensor& queries) const {
+    const int64_t n = queries.GetLength();
+    if (n == 0 || IsEmpty()) {
+        return core::Tensor::Zeros({n}, core::Dtype::Bool, device_);
+    }
+    core::Tensor addrs, masks;
+    voxels_->Find(GetVoxelIndex(queries).Contiguous(), addrs, masks);
+    return masks;
+}
+
+VoxelGrid& VoxelGrid::CarveDepthMap(const Image& depth_map,
+                                    const core::Tensor& intrinsics,
+                                    const core::Tensor& extrinsics,
+                                    bool keep_voxels_outside_image,
+                                    float depth_scale) {
+    if (depth_map.GetChannels() != 1) {
+        utility::LogError("[CarveDepthMap] depth_map must have 1 channel.");
+    }
+    core::Tensor depth = depth_map.AsTensor()
+                                 .Reshape({depth_map.GetRows(),
+                                           depth_map.GetCols()})
+                                 .To(core::Dtype::Float32);
+    if (depth_scale != 1.0f) {
+        depth = depth / depth_scale;
+    }
+    Carve(depth.To(device_), intrinsics, extrinsics, true,
+          keep_voxels_outside_image);
+    return *this;
+}
+
+VoxelGrid& VoxelGrid::CarveSilhouette(const Image& silhouette_mask,
+                                      const core::Tensor& intrinsics,
+                                      const core::Tensor& extrinsics,
+                                      bool keep_voxels_outside_image) {
+    if (silhouette_mask.GetChannels() != 1) {
+        utility::LogError(
+                "[CarveSilhouette] silhouette_mask must have 1 channel.");
+    }
+    core::Tensor mask = silhouette_mask.AsTensor()
+                                .Reshape({silhouette_mask.GetRows(),
+                                          silhouette_mask.GetCols()})
+                                .To(core::Dtype::Float32);
+    Carve(mask.To(device_), intrinsics, extrinsics, false,
+          keep_voxels_outside_image);
+    return *this;
+}
+
+void VoxelGrid::Carve(const core::Tensor& image,
+                      const core::Tensor& intrinsics,
+                      const core::Tensor& extrinsics,
+                      bool compare_depth,
+                      bool keep_voxels_outside_image) {
+    if (IsEmpty()) {
+        return;
+    }
+    core::Tensor voxel_indices = GetVoxelIndices();
+    core::Tensor keep;
+    kernel::voxel_grid::Carve(voxel_indices, image, intrinsics, extrinsics,
+                              origin_, voxel_size_, compare_depth,
+                              keep_voxels_outside_image, keep);
+    core::Tensor carved = voxel_indices.IndexGet({keep.LogicalNot()});
+    if (carved.GetLength() > 0) {
+        core::Tensor masks;
+        voxels_->Erase(carved.Contiguous(), masks);
+    }
+}
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,159 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+/// \class VoxelGrid
+/// \brief A sparse voxel grid stored in a hashmap on CPU or CUDA.
+///
+/// The keys of the hashmap are the Int32 grid indices {3} of the occupied
+/// voxels and the values their Float32 colors {3}. Voxel (i, j, k) covers
+/// origin + [i, i + 1) * voxel_size etc., as in the legacy VoxelGrid. All
+/// queries and carving operations are batched over tensors.
+class VoxelGrid {
+public:
+    /// \brief Parameterized Constructor of an empty voxel grid.
+    ///
+    /// \param voxel_size Edge length of the voxels.
+    /// \param origin Float64 tensor {3}, the coordinate of the corner of voxel
+    /// (0, 0, 0).
+    /// \param device Device of the hashmap.
+    /// \param init_capacity Initial capacity of the hashmap.
+    VoxelGrid(double voxel_size,
+              const core::Tensor& origin,
+              const core::Device& device = core::Device("CPU:0"),
+              int64_t init_capacity = 1000);
+
+    /// \brief Creates a voxel grid from the points of a point cloud, with the
+    /// bounds of geometry::VoxelGrid::CreateFromPointCloud. The color of a
+    /// voxel is the average color of its points, if the point cloud has
+    /// colors.
+    static VoxelGrid CreateFromPointCloud(const PointCloud& pcd,
+                                          double voxel_size);
+
+    /// Creates a voxel grid on \p device from a legacy VoxelGrid.
+    static VoxelGrid FromLegacyVoxelGrid(
+            const open3d::geometry::VoxelGrid& voxel_grid,
+            const core::Device& device = core::Device("CPU:0"));
+
+    /// Converts to a legacy VoxelGrid.
+    open3d::geometry::VoxelGrid ToLegacyVoxelGrid() const;
+
+    /// \brief Adds voxels, replacing the colors of the voxels that exist.
+    ///
+    /// \param voxel_indices Int32 tensor {n, 3} of distinct grid indices.
+    /// \param colors Float32 tensor {n, 3} of colors.
+    void AddVoxels(const core::Tensor& voxel_indices,
+                   const core::Tensor& colors);
+
+    /// Returns the number of voxels.
+    int64_t GetNumVoxels() const { return voxels_->Size(); }
+
+    /// Returns true if the voxel grid has no voxel.
+    bool IsEmpty() const { return GetNumVoxels() == 0; }
+
+    double GetVoxelSize() const { return voxel_size_; }
+    const core::Tensor& GetOrigin() const { return origin_; }
+    core::Device GetDevice() const { return device_; }
+
+    /// Returns the hashmap of the voxels.
+    std::shared_ptr<core::Hashmap> GetVoxelHashmap() const { return voxels_; }
+
+    /// Returns the Int32 grid indices {n, 3} of the voxels, in the order of
+    /// GetVoxelColors().
+    core::Tensor GetVoxelIndices() const;
+
+    /// Returns the Float32 colors {n, 3} of the voxels, in the order of
+    /// GetVoxelIndices().
+    core::Tensor GetVoxelColors() const;
+
+    /// Returns the Int32 grid indices {n, 3} of the voxels containing the
+    /// Float32 or Float64 points {n, 3}.
+    core::Tensor GetVoxelIndex(const core::Tensor& points) const;
+
+    /// Returns a Bool tensor {n}, true for the query points {n, 3} that are in
+    /// a voxel of the grid.
+    core::Tensor CheckIfIncluded(const core::Tensor& queries) const;
+
+    /// \brief Removes the voxels none of whose corners projects to a depth
+    /// that is smaller than or equal to its own depth, see
+    /// geometry::VoxelGrid::CarveDepthMap.
+    ///
+    /// \param depth_map Single channel depth image. Depths are converted to
+    /// Float32 and divided by \p depth_scale.
+    /// \param intrinsics Tensor {3, 3} of the pinhole intrinsics.
+    /// \param extrinsics Tensor {4, 4}, world to camera transformation.
+    /// \param keep_voxels_outside_image Keep voxels with a corner projecting
+    /// outside of the image.
+    /// \param depth_scale Scale of the depth values.
+    VoxelGrid& CarveDepthMap(const Image& depth_map,
+                             const core::Tensor& intrinsics,
+                             const core::Tensor& extrinsics,
+                             bool keep_voxels_outside_image,
+                             float depth_scale = 1.0f);
+
+    /// \brief Removes the voxels none of whose corners projects to a set pixel
+    /// (value > 0) of the mask, see geometry::VoxelGrid::CarveSilhouette.
+    ///
+    /// \param silhouette_mask Single channel mask image.
+    /// \param intrinsics Tensor {3, 3} of the pinhole intrinsics.
+    /// \param extrinsics Tensor {4, 4}, world to camera transformation.
+    /// \param keep_voxels_outside_image Keep voxels with a corner projecting
+    /// outside of the image.
+    VoxelGrid& CarveSilhouette(const Image& silhouette_mask,
+                               const core::Tensor& intrinsics,
+                               const core::Tensor& extrinsics,
+                               bool keep_voxels_outside_image);
+
+private:
+    /// Erases the voxels that do not survive carving with \p image.
+    void Carve(const core::Tensor& image,
+               const core::Tensor& intrinsics,
+               const core::Tensor& extrinsics,
+               bool compare_depth,
+               bool keep_voxels_outside_image);
+
+    double voxel_size_;
+    core::Tensor origin_;
+    core::Device device_;
+    std::shared_ptr<core::Hashmap> voxels_;
+};
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -110,6 +110,135 @@ void ColorizeDepth(const core::Tensor &src,
     }
 }
 
+void ClipTransformVertexMap(const core::Tensor &src,
+                            core::Tensor &dst_depth,
+                            core::Tensor &dst_vertex,
+                            const core::Tensor &intrinsics,
+                            float scale,
+                            float min_value,
+                            float max_value,
+                            float clip_fill) {
+    core::Device device = src.GetDevice();
+    static const core::Device host("CPU:0");
+
+    core::Tensor intrinsics_d =
+            intrinsics.To(host, core::Dtype::Float64).Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        ClipTransformVertexMapCPU(src, dst_depth, dst_vertex, intrinsics_d,
+                                  scale, min_value, max_value, clip_fill);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ClipTransformVertexMapCUDA, src, dst_depth, dst_vertex,
+                  intrinsics_d, scale, min_value, max_value, clip_fill);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void PyrDownDepthVertexMap(const core::Tensor &src,
+                           core::Tensor &dst_depth,
+                           core::Tensor &dst_vertex,
+                           const core::Tensor &intrinsics,
+                           float diff_threshold,
+                           float invalid_fill) {
+    core::Device device = src.GetDevice();
+    static const core::Device host("CPU:0");
+
+    core::Tensor intrinsics_d =
+            intrinsics.To(host, core::Dtype::Float64).Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        PyrDownDepthVertexMapCPU(src, dst_depth, dst_vertex, intrinsics_d,
+                                 diff_threshold, invalid_fill);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(PyrDownDepthVertexMapCUDA, src, dst_depth, dst_vertex,
+                  intrinsics_d, diff_threshold, invalid_fill);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void PyrDownGaussian(const core::Tensor &src, core::Tensor &dst) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        PyrDownGaussianCPU(src, dst);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(PyrDownGaussianCUDA, src, dst);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterSobel3x3(const core::Tensor &src,
+                    core::Tensor &dst_dx,
+                    core::Tensor &dst_dy) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        FilterSobel3x3CPU(src, dst_dx, dst_dy);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterSobel3x3CUDA, src, dst_dx, dst_dy);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void RGBToGray(const core::Tensor &src, core::Tensor &dst) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        RGBToGrayCPU(src, dst);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(RGBToGrayCUDA, src, dst);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void RGBToGrayBatch(const core::Tensor &src, core::Tensor &dst) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        RGBToGrayBatchCPU(src, dst);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(RGBToGrayBatchCUDA, src, dst);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ResizeBatch(const core::Tensor &src, core::Tensor &dst, bool linear) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        ResizeBatchCPU(src, dst, linear);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ResizeBatchCUDA, src, dst, linear);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterBatch(const core::Tensor &src,
+                 core::Tensor &dst,
+                 const core::Tensor &kernel) {
+    core::Device device = src.GetDevice();
+    core::Tensor kernel_f =
+            kernel.To(device, core::Dtype::Float32).Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        FilterBatchCPU(src, dst, kernel_f);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterBatchCUDA, src, dst, kernel_f);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void DilateBatch(const core::Tensor &src, core::Tensor &dst, int kernel_size) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        DilateBatchCPU(src, dst, kernel_size);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(DilateBatchCUDA, src, dst, kernel_size);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 }  // namespace image
 }  // namespace kernel
 }  // namespace geometry
@@ -61,6 +61,40 @@ void ColorizeDepth(const core::Tensor &src,
                    float min_value,
                    float max_value);
 
+void ClipTransformVertexMap(const core::Tensor &src,
+                            core::Tensor &dst_depth,
+                            core::Tensor &dst_vertex,
+                            const core::Tensor &intrinsics,
+                            float scale,
+                            float min_value,
+                            float max_value,
+                            float clip_fill);
+
+void PyrDownDepthVertexMap(const core::Tensor &src,
+                           core::Tensor &dst_depth,
+                           core::Tensor &dst_vertex,
+                           const core::Tensor &intrinsics,
+                           float diff_threshold,
+                           float invalid_fill);
+
+void PyrDownGaussian(const core::Tensor &src, core::Tensor &dst);
+
+void FilterSobel3x3(const core::Tensor &src,
+                    core::Tensor &dst_dx,
+                    core::Tensor &dst_dy);
+
+void RGBToGray(const core::Tensor &src, core::Tensor &dst);
+
+void RGBToGrayBatch(const core::Tensor &src, core::Tensor &dst);
+
+void ResizeBatch(const core::Tensor &src, core::Tensor &dst, bool linear);
+
+void FilterBatch(const core::Tensor &src,
+                 core::Tensor &dst,
+                 const core::Tensor &kernel);
+
+void DilateBatch(const core::Tensor &src, core::Tensor &dst, int kernel_size);
+
 void ClipTransformCPU(const core::Tensor &src,
                       core::Tensor &dst,
                       float scale,
@@ -88,6 +122,42 @@ void ColorizeDepthCPU(const core::Tensor &src,
                       float min_value,
                       float max_value);
 
+void ClipTransformVertexMapCPU(const core::Tensor &src,
+                               core::Tensor &dst_depth,
+                               core::Tensor &dst_vertex,
+                               const core::Tensor &intrinsics,
+                               float scale,
+                               float min_value,
+                               float max_value,
+                               float clip_fill);
+
+void PyrDownDepthVertexMapCPU(const core::Tensor &src,
+                              core::Tensor &dst_depth,
+                              core::Tensor &dst_vertex,
+                              const core::Tensor &intrinsics,
+                              float diff_threshold,
+                              float invalid_fill);
+
+void PyrDownGaussianCPU(const core::Tensor &src, core::Tensor &dst);
+
+void FilterSobel3x3CPU(const core::Tensor &src,
+                       core::Tensor &dst_dx,
+                       core::Tensor &dst_dy);
+
+void RGBToGrayCPU(const core::Tensor &src, core::Tensor &dst);
+
+void RGBToGrayBatchCPU(const core::Tensor &src, core::Tensor &dst);
+
+void ResizeBatchCPU(const core::Tensor &src, core::Tensor &dst, bool linear);
+
+void FilterBatchCPU(const core::Tensor &src,
+                    core::Tensor &dst,
+                    const core::Tensor &kernel);
+
+void DilateBatchCPU(const core::Tensor &src,
+                    core::Tensor &dst,
+                    int kernel_size);
+
 #ifdef BUILD_CUDA_MODULE
 void ClipTransformCUDA(const core::Tensor &src,
                        core::Tensor &dst,
@@ -116,6 +186,42 @@ void ColorizeDepthCUDA(const core::Tensor &src,
                        float min_value,
                        float max_value);
 
+void ClipTransformVertexMapCUDA(const core::Tensor &src,
+                                core::Tensor &dst_depth,
+                                core::Tensor &dst_vertex,
+                                const core::Tensor &intrinsics,
+                                float scale,
+                                float min_value,
+                                float max_value,
+                                float clip_fill);
+
+void PyrDownDepthVertexMapCUDA(const core::Tensor &src,
+                               core::Tensor &dst_depth,
+                               core::Tensor &dst_vertex,
+                               const core::Tensor &intrinsics,
+                               float diff_threshold,
+                               float invalid_fill);
+
+void PyrDownGaussianCUDA(const core::Tensor &src, core::Tensor &dst);
+
+void FilterSobel3x3CUDA(const core::Tensor &src,
+                        core::Tensor &dst_dx,
+                        core::Tensor &dst_dy);
+
+void RGBToGrayCUDA(const core::Tensor &src, core::Tensor &dst);
+
+void RGBToGrayBatchCUDA(const core::Tensor &src, core::Tensor &dst);
+
+void ResizeBatchCUDA(const core::Tensor &src, core::Tensor &dst, bool linear);
+
+void FilterBatchCUDA(const core::Tensor &src,
+                     core::Tensor &dst,
+                     const core::Tensor &kernel);
+
+void DilateBatchCUDA(const core::Tensor &src,
+                     core::Tensor &dst,
+                     int kernel_size);
+
 #endif
 }  // namespace image
 }  // namespace kernel
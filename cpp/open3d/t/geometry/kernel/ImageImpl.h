@@ -317,6 +317,514 @@ void ColorizeDepthCPU
     });
 }
 
+// Fuses ClipTransform and CreateVertexMap.
+#ifdef __CUDACC__
+void ClipTransformVertexMapCUDA
+#else
+void ClipTransformVertexMapCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst_depth,
+         core::Tensor& dst_vertex,
+         const core::Tensor& intrinsics,
+         float scale,
+         float min_value,
+         float max_value,
+         float clip_fill) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer depth_indexer(dst_depth, 2);
+    NDArrayIndexer vertex_indexer(dst_vertex, 2);
+    TransformIndexer ti(intrinsics, core::Tensor::Eye(4, core::Dtype::Float64,
+                                                      core::Device("CPU:0")));
+
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t n = rows * cols;
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            int64_t y = workload_idx / cols;
+            int64_t x = workload_idx % cols;
+
+            float in =
+                    static_cast<float>(*src_indexer.GetDataPtr<scalar_t>(x, y));
+            float out = in / scale;
+            bool clipped = out <= min_value || out >= max_value;
+            *depth_indexer.GetDataPtr<float>(x, y) = clipped ? clip_fill : out;
+
+            float* vertex = vertex_indexer.GetDataPtr<float>(x, y);
+            if (!clipped) {
+                ti.Unproject(static_cast<float>(x), static_cast<float>(y), out,
+                             vertex + 0, vertex + 1, vertex + 2);
+            } else {
+                vertex[0] = clip_fill;
+                vertex[1] = clip_fill;
+                vertex[2] = clip_fill;
+            }
+        });
+    });
+}
+
+// Fuses PyrDownDepth and CreateVertexMap on the downsampled depth.
+#ifdef __CUDACC__
+void PyrDownDepthVertexMapCUDA
+#else
+void PyrDownDepthVertexMapCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst_depth,
+         core::Tensor& dst_vertex,
+         const core::Tensor& intrinsics,
+         float depth_diff,
+         float invalid_fill) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer depth_indexer(dst_depth, 2);
+    NDArrayIndexer vertex_indexer(dst_vertex, 2);
+    TransformIndexer ti(intrinsics, core::Tensor::Eye(4, core::Dtype::Float64,
+                                                      core::Device("CPU:0")));
+
+    int rows = src_indexer.GetShape(0);
+    int cols = src_indexer.GetShape(1);
+
+    int rows_down = depth_indexer.GetShape(0);
+    int cols_down = depth_indexer.GetShape(1);
+    int n = rows_down * cols_down;
+
+    const int gkernel_size = 5;
+    const int gkernel_size_2 = gkernel_size / 2;
+    const float gweights[3] = {0.375f, 0.25f, 0.0625f};
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    using std::abs;
+    using std::max;
+    using std::min;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int y = workload_idx / cols_down;
+        int x = workload_idx % cols_down;
+
+        int y_src = 2 * y;
+        int x_src = 2 * x;
+
+        float* depth = depth_indexer.GetDataPtr<float>(x, y);
+        float* vertex = vertex_indexer.GetDataPtr<float>(x, y);
+
+        float v_center = *src_indexer.GetDataPtr<float>(x_src, y_src);
+        float v_sum = 0;
+        float w_sum = 0;
+        if (v_center != invalid_fill) {
+            int x_min = max(0, x_src - gkernel_size_2);
+            int y_min = max(0, y_src - gkernel_size_2);
+
+            int x_max = min(cols - 1, x_src + gkernel_size_2);
+            int y_max = min(rows - 1, y_src + gkernel_size_2);
+
+            for (int yk = y_min; yk <= y_max; ++yk) {
+                for (int xk = x_min; xk <= x_max; ++xk) {
+                    float v = *src_indexer.GetDataPtr<float>(xk, yk);
+                    int dy = abs(yk - y_src);
+                    int dx = abs(xk - x_src);
+
+                    if (v != invalid_fill && abs(v - v_center) < depth_diff) {
+                        float w = gweights[dx] * gweights[dy];
+                        v_sum += w * v;
+                        w_sum += w;
+                    }
+                }
+            }
+        }
+
+        if (w_sum == 0) {
+            *depth = invalid_fill;
+            vertex[0] = invalid_fill;
+            vertex[1] = invalid_fill;
+            vertex[2] = invalid_fill;
+        } else {
+            *depth = v_sum / w_sum;
+            ti.Unproject(static_cast<float>(x), static_cast<float>(y), *depth,
+                         vertex + 0, vertex + 1, vertex + 2);
+        }
+    });
+}
+
+// Fuses a 5x5 Gaussian filter with sigma 1 and replicated borders with the
+// decimation by 2 of PyrDown.
+#ifdef __CUDACC__
+void PyrDownGaussianCUDA
+#else
+void PyrDownGaussianCPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    int rows = src_indexer.GetShape(0);
+    int cols = src_indexer.GetShape(1);
+
+    int rows_down = dst_indexer.GetShape(0);
+    int cols_down = dst_indexer.GetShape(1);
+    int n = rows_down * cols_down;
+
+    const float gweights[5] = {0.05448869f, 0.24420134f, 0.40261995f,
+                               0.24420134f, 0.05448869f};
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    using std::max;
+    using std::min;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int y = workload_idx / cols_down;
+        int x = workload_idx % cols_down;
+
+        float sum = 0;
+        for (int dy = -2; dy <= 2; ++dy) {
+            int yk = min(max(2 * y + dy, 0), rows - 1);
+            for (int dx = -2; dx <= 2; ++dx) {
+                int xk = min(max(2 * x + dx, 0), cols - 1);
+                sum += gweights[dx + 2] * gweights[dy + 2] *
+                       *src_indexer.GetDataPtr<float>(xk, yk);
+            }
+        }
+        *dst_indexer.GetDataPtr<float>(x, y) = sum;
+    });
+}
+
+// Computes both derivatives of FilterSobel with kernel size 3 in one pass,
+// right minus left and bottom minus top with replicated borders.
+#ifdef __CUDACC__
+void FilterSobel3x3CUDA
+#else
+void FilterSobel3x3CPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst_dx, core::Tensor& dst_dy) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dx_indexer(dst_dx, 2);
+    NDArrayIndexer dy_indexer(dst_dy, 2);
+
+    int rows = src_indexer.GetShape(0);
+    int cols = src_indexer.GetShape(1);
+    int n = rows * cols;
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    using std::max;
+    using std::min;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int y = workload_idx / cols;
+        int x = workload_idx % cols;
+
+        int x0 = max(x - 1, 0);
+        int x1 = min(x + 1, cols - 1);
+        int y0 = max(y - 1, 0);
+        int y1 = min(y + 1, rows - 1);
+
+        float v00 = *src_indexer.GetDataPtr<float>(x0, y0);
+        float v01 = *src_indexer.GetDataPtr<float>(x, y0);
+        float v02 = *src_indexer.GetDataPtr<float>(x1, y0);
+        float v10 = *src_indexer.GetDataPtr<float>(x0, y);
+        float v12 = *src_indexer.GetDataPtr<float>(x1, y);
+        float v20 = *src_indexer.GetDataPtr<float>(x0, y1);
+        float v21 = *src_indexer.GetDataPtr<float>(x, y1);
+        float v22 = *src_indexer.GetDataPtr<float>(x1, y1);
+
+        *dx_indexer.GetDataPtr<float>(x, y) =
+                (v02 + 2 * v12 + v22) - (v00 + 2 * v10 + v20);
+        *dy_indexer.GetDataPtr<float>(x, y) =
+                (v20 + 2 * v21 + v22) - (v00 + 2 * v01 + v02);
+    });
+}
+
+// Converts a 3 channel color image to a Float32 intensity image without
+// rounding. 1 channel images are only converted to Float32.
+#ifdef __CUDACC__
+void RGBToGrayCUDA
+#else
+void RGBToGrayCPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    int64_t rows = src.GetShape(0);
+    int64_t cols = src.GetShape(1);
+    int64_t n = rows * cols;
+    bool is_color = src.GetShape(2) == 3;
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            int64_t y = workload_idx / cols;
+            int64_t x = workload_idx % cols;
+
+            const scalar_t* in = src_indexer.GetDataPtr<scalar_t>(x, y);
+            *dst_indexer.GetDataPtr<float>(x, y) =
+                    is_color ? 0.299f * static_cast<float>(in[0]) +
+                                       0.587f * static_cast<float>(in[1]) +
+                                       0.114f * static_cast<float>(in[2])
+                             : static_cast<float>(in[0]);
+        });
+    });
+}
+
+// Rounds and saturates a filtered value to the range of an integer dtype.
+template <typename scalar_t>
+inline OPEN3D_HOST_DEVICE scalar_t SaturateCast(float value) {
+    return static_cast<scalar_t>(value);
+}
+
+template <>
+inline OPEN3D_HOST_DEVICE uint8_t SaturateCast<uint8_t>(float value) {
+    value = value < 0.0f ? 0.0f : (value > 255.0f ? 255.0f : value);
+    return static_cast<uint8_t>(value + 0.5f);
+}
+
+template <>
+inline OPEN3D_HOST_DEVICE uint16_t SaturateCast<uint16_t>(float value) {
+    value = value < 0.0f ? 0.0f : (value > 65535.0f ? 65535.0f : value);
+    return static_cast<uint16_t>(value + 0.5f);
+}
+
+// The batched kernels below process a {N, rows, cols, channels} image stack
+// with a single launch over all the pixels of the stack.
+#ifdef __CUDACC__
+void RGBToGrayBatchCUDA
+#else
+void RGBToGrayBatchCPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst) {
+    NDArrayIndexer src_indexer(src, 3);
+    NDArrayIndexer dst_indexer(dst, 3);
+
+    int64_t rows = src.GetShape(1);
+    int64_t cols = src.GetShape(2);
+    int64_t n = src.GetShape(0) * rows * cols;
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            int64_t b = workload_idx / (rows * cols);
+            int64_t y = (workload_idx / cols) % rows;
+            int64_t x = workload_idx % cols;
+
+            const scalar_t* in = src_indexer.GetDataPtr<scalar_t>(x, y, b);
+            *dst_indexer.GetDataPtr<scalar_t>(x, y, b) =
+                    SaturateCast<scalar_t>(0.299f * static_cast<float>(in[0]) +
+                                           0.587f * static_cast<float>(in[1]) +
+                                           0.114f * static_cast<float>(in[2]));
+        });
+    });
+}
+
+// Nearest sampling picks source pixel floor(x / rate), linear sampling
+// interpolates between pixel centers with replicated borders.
+#ifdef __CUDACC__
+void ResizeBatchCUDA
+#else
+void ResizeBatchCPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst, bool linear) {
+    NDArrayIndexer src_indexer(src, 3);
+    NDArrayIndexer dst_indexer(dst, 3);
+
+    int64_t rows = src.GetShape(1);
+    int64_t cols = src.GetShape(2);
+    int64_t channels = src.GetShape(3);
+    int64_t rows_dst = dst.GetShape(1);
+    int64_t cols_dst = dst.GetShape(2);
+    int64_t n = dst.GetShape(0) * rows_dst * cols_dst;
+
+    float scale_y = static_cast<float>(rows) / rows_dst;
+    float scale_x = static_cast<float>(cols) / cols_dst;
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    using std::floor;
+    using std::max;
+    using std::min;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            int64_t b = workload_idx / (rows_dst * cols_dst);
+            int64_t y = (workload_idx / cols_dst) % rows_dst;
+            int64_t x = workload_idx % cols_dst;
+
+            scalar_t* out = dst_indexer.GetDataPtr<scalar_t>(x, y, b);
+            if (!linear) {
+                int64_t ys = min(static_cast<int64_t>(y * scale_y), rows - 1);
+                int64_t xs = min(static_cast<int64_t>(x * scale_x), cols - 1);
+                const scalar_t* in =
+                        src_indexer.GetDataPtr<scalar_t>(xs, ys, b);
+                for (int64_t c = 0; c < channels; ++c) {
+                    out[c] = in[c];
+                }
+                return;
+            }
+
+            float yf = max((y + 0.5f) * scale_y - 0.5f, 0.0f);
+            float xf = max((x + 0.5f) * scale_x - 0.5f, 0.0f);
+            int64_t y0 = min(static_cast<int64_t>(floor(yf)), rows - 1);
+            int64_t x0 = min(static_cast<int64_t>(floor(xf)), cols - 1);
+            int64_t y1 = min(y0 + 1, rows - 1);
+            int64_t x1 = min(x0 + 1, cols - 1);
+            float wy = yf - y0;
+            float wx = xf - x0;
+
+            const scalar_t* in00 = src_indexer.GetDataPtr<scalar_t>(x0, y0, b);
+            const scalar_t* in01 = src_indexer.GetDataPtr<scalar_t>(x1, y0, b);
+            const scalar_t* in10 = src_indexer.GetDataPtr<scalar_t>(x0, y1, b);
+            const scalar_t* in11 = src_indexer.GetDataPtr<scalar_t>(x1, y1, b);
+            for (int64_t c = 0; c < channels; ++c) {
+                float top = (1 - wx) * static_cast<float>(in00[c]) +
+                            wx * static_cast<float>(in01[c]);
+                float bottom = (1 - wx) * static_cast<float>(in10[c]) +
+                               wx * static_cast<float>(in11[c]);
+                out[c] = SaturateCast<scalar_t>((1 - wy) * top + wy * bottom);
+            }
+        });
+    });
+}
+
+// Correlates every channel with a Float32 {kernel_rows, kernel_cols} kernel
+// centered at (kernel_rows / 2, kernel_cols / 2), with replicated borders.
+#ifdef __CUDACC__
+void FilterBatchCUDA
+#else
+void FilterBatchCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         const core::Tensor& kernel) {
+    NDArrayIndexer src_indexer(src, 3);
+    NDArrayIndexer dst_indexer(dst, 3);
+    const float* kernel_ptr = kernel.GetDataPtr<float>();
+
+    int64_t rows = src.GetShape(1);
+    int64_t cols = src.GetShape(2);
+    int64_t channels = src.GetShape(3);
+    int64_t n = src.GetShape(0) * rows * cols;
+
+    int64_t kernel_rows = kernel.GetShape(0);
+    int64_t kernel_cols = kernel.GetShape(1);
+    int64_t ry = kernel_rows / 2;
+    int64_t rx = kernel_cols / 2;
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    using std::max;
+    using std::min;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            int64_t b = workload_idx / (rows * cols);
+            int64_t y = (workload_idx / cols) % rows;
+            int64_t x = workload_idx % cols;
+
+            scalar_t* out = dst_indexer.GetDataPtr<scalar_t>(x, y, b);
+            for (int64_t c = 0; c < channels; ++c) {
+                float sum = 0;
+                for (int64_t ky = 0; ky < kernel_rows; ++ky) {
+                    int64_t ys = min(max(y + ky - ry, int64_t(0)), rows - 1);
+                    for (int64_t kx = 0; kx < kernel_cols; ++kx) {
+                        int64_t xs =
+                                min(max(x + kx - rx, int64_t(0)), cols - 1);
+                        sum += kernel_ptr[ky * kernel_cols + kx] *
+                               static_cast<float>(
+                                       src_indexer.GetDataPtr<scalar_t>(
+                                               xs, ys, b)[c]);
+                    }
+                }
+                out[c] = SaturateCast<scalar_t>(sum);
+            }
+        });
+    });
+}
+
+// Takes the maximum over the square kernel_size x kernel_size neighborhood,
+// ignoring the pixels outside of the image.
+#ifdef __CUDACC__
+void DilateBatchCUDA
+#else
+void DilateBatchCPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst, int kernel_size) {
+    NDArrayIndexer src_indexer(src, 3);
+    NDArrayIndexer dst_indexer(dst, 3);
+
+    int64_t rows = src.GetShape(1);
+    int64_t cols = src.GetShape(2);
+    int64_t channels = src.GetShape(3);
+    int64_t n = src.GetShape(0) * rows * cols;
+    int64_t r = kernel_size / 2;
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    using std::max;
+    using std::min;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            int64_t b = workload_idx / (rows * cols);
+            int64_t y = (workload_idx / cols) % rows;
+            int64_t x = workload_idx % cols;
+
+            int64_t y0 = max(y - r, int64_t(0));
+            int64_t y1 = min(y + r, rows - 1);
+            int64_t x0 = max(x - r, int64_t(0));
+            int64_t x1 = min(x + r, cols - 1);
+
+            scalar_t* out = dst_indexer.GetDataPtr<scalar_t>(x, y, b);
+            for (int64_t c = 0; c < channels; ++c) {
+                scalar_t value = src_indexer.GetDataPtr<scalar_t>(x, y, b)[c];
+                for (int64_t ys = y0; ys <= y1; ++ys) {
+                    for (int64_t xs = x0; xs <= x1; ++xs) {
+                        scalar_t v =
+                                src_indexer.GetDataPtr<scalar_t>(xs, ys, b)[c];
+                        value = v > value ? v : value;
+                    }
+                }
+                out[c] = value;
+            }
+        });
+    });
+}
+
 }  // namespace image
 }  // namespace kernel
 }  // namespace geometry
@@ -0,0 +1,74 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/Octree.h"
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace octree {
+
+void ComputeMortonCodes(const core::Tensor& points,
+                        const core::Tensor& origin,
+                        double size,
+                        int64_t max_depth,
+                        core::Tensor& codes,
+                        core::Tensor& valid) {
+    points.AssertShapeCompatible({utility::nullopt, 3});
+    origin.AssertShape({3});
+    if (max_depth < 0 || max_depth > 21) {
+        utility::LogError("max_depth must be in [0, 21], but got {}.",
+                          max_depth);
+    }
+
+    core::Device device = points.GetDevice();
+    core::Device::DeviceType device_type = device.GetType();
+
+    static const core::Device host("CPU:0");
+    core::Tensor origin_d = origin.To(host, core::Dtype::Float64).Contiguous();
+    core::Tensor points_c = points.Contiguous();
+
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeMortonCodesCPU(points_c, origin_d, size, max_depth, codes,
+                              valid);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeMortonCodesCUDA, points_c, origin_d, size, max_depth,
+                  codes, valid);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace octree
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
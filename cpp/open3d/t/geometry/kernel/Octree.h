@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace octree {
+
+/// Computes the Morton code of the leaf containing each point.
+///
+/// \param points Float32 or Float64 tensor {n, 3}.
+/// \param origin Float64 CPU tensor {3}, the global min bound of the octree.
+/// \param size Outer bounding box edge size of the octree.
+/// \param max_depth Depth of the leaves, at most 21.
+/// \param codes Output Int64 tensor {n}. The bits of each level are ordered
+/// (z, y, x) from the root down, i.e. the child index of the leaf is
+/// codes & 7.
+/// \param valid Output Bool tensor {n}, true iff the point is within bound,
+/// origin <= point < origin + size. Codes of invalid points are undefined.
+void ComputeMortonCodes(const core::Tensor& points,
+                        const core::Tensor& origin,
+                        double size,
+                        int64_t max_depth,
+                        core::Tensor& codes,
+                        core::Tensor& valid);
+
+void ComputeMortonCodesCPU(const core::Tensor& points,
+                           const core::Tensor& origin,
+                           double size,
+                           int64_t max_depth,
+                           core::Tensor& codes,
+                           core::Tensor& valid);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeMortonCodesCUDA(const core::Tensor& points,
+                            const core::Tensor& origin,
+                            double size,
+                            int64_t max_depth,
+                            core::Tensor& codes,
+                            core::Tensor& valid);
+#endif
+
+}  // namespace octree
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
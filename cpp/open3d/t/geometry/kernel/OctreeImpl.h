@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/GeometryMacros.h"
+#include "open3d/t/geometry/kernel/Octree.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace octree {
+
+#if defined(__CUDACC__)
+void ComputeMortonCodesCUDA
+#else
+void ComputeMortonCodesCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& origin,
+         double size,
+         int64_t max_depth,
+         core::Tensor& codes,
+         core::Tensor& valid) {
+    const int64_t n = points.GetLength();
+    codes = core::Tensor({n}, core::Dtype::Int64, points.GetDevice());
+    valid = core::Tensor({n}, core::Dtype::Bool, points.GetDevice());
+    int64_t* codes_ptr = codes.GetDataPtr<int64_t>();
+    bool* valid_ptr = valid.GetDataPtr<bool>();
+
+    const double* origin_ptr = origin.GetDataPtr<double>();
+    const double origin_x = origin_ptr[0];
+    const double origin_y = origin_ptr[1];
+    const double origin_z = origin_ptr[2];
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const double x = points_ptr[3 * workload_idx + 0];
+            const double y = points_ptr[3 * workload_idx + 1];
+            const double z = points_ptr[3 * workload_idx + 2];
+            valid_ptr[workload_idx] =
+                    origin_x <= x && x < origin_x + size && origin_y <= y &&
+                    y < origin_y + size && origin_z <= z && z < origin_z + size;
+
+            // Descend as Octree::InsertPoint does, so that points on the
+            // boundary of two nodes land in the same leaf.
+            double node_x = origin_x, node_y = origin_y, node_z = origin_z;
+            double child_size = size;
+            int64_t code = 0;
+            for (int64_t depth = 0; depth < max_depth; ++depth) {
+                child_size /= 2.0;
+                const int64_t x_index = x < node_x + child_size ? 0 : 1;
+                const int64_t y_index = y < node_y + child_size ? 0 : 1;
+                const int64_t z_index = z < node_z + child_size ? 0 : 1;
+                code = (code << 3) | (z_index << 2) | (y_index << 1) | x_index;
+                node_x += x_index * child_size;
+                node_y += y_index * child_size;
+                node_z += z_index * child_size;
+            }
+            codes_ptr[workload_idx] = code;
+        });
+    });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
+}  // namespace octree
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -75,6 +75,90 @@ void Unproject(const core::Tensor& depth,
     }
 }
 
+void UnprojectVoxelDownSample(
+        const core::Tensor& depth,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                image_colors,
+        core::Tensor& points,
+        utility::optional<std::reference_wrapper<core::Tensor>> colors,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        float depth_scale,
+        float depth_max,
+        int64_t stride,
+        float voxel_size,
+        const core::HashmapBackend& backend) {
+    if (image_colors.has_value() != colors.has_value()) {
+        utility::LogError(
+                "[UnprojectVoxelDownSample] Both or none of image_colors and "
+                "colors must have values.");
+    }
+
+    core::Device device = depth.GetDevice();
+    core::Device::DeviceType device_type = device.GetType();
+
+    static const core::Device host("CPU:0");
+    core::Tensor intrinsics_d =
+            intrinsics.To(host, core::Dtype::Float64).Contiguous();
+    core::Tensor extrinsics_d =
+            extrinsics.To(host, core::Dtype::Float64).Contiguous();
+
+    core::Tensor pixel_indices, voxel_keys;
+    if (device_type == core::Device::DeviceType::CPU) {
+        VoxelizeDepthCPU(depth, pixel_indices, voxel_keys, intrinsics_d,
+                         extrinsics_d, depth_scale, depth_max, stride,
+                         voxel_size);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(VoxelizeDepthCUDA, depth, pixel_indices, voxel_keys,
+                  intrinsics_d, extrinsics_d, depth_scale, depth_max, stride,
+                  voxel_size);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+
+    const bool have_colors = image_colors.has_value();
+    const int64_t n = voxel_keys.GetLength();
+    if (n == 0) {
+        points = core::Tensor({0, 3}, core::Dtype::Float32, device);
+        if (have_colors) {
+            colors.value().get() =
+                    core::Tensor({0, 3}, core::Dtype::Float32, device);
+        }
+        return;
+    }
+
+    // Each voxel accumulates the sums of the coordinates, the colors and the
+    // number of its points in its hashmap value.
+    const int64_t sum_size = have_colors ? 7 : 4;
+    core::Hashmap voxel_hashmap(n, core::Dtype::Int32, core::Dtype::Float32,
+                                {3}, {sum_size}, device, backend);
+    core::Tensor addrs, masks;
+    voxel_hashmap.Activate(voxel_keys, addrs, masks);
+    voxel_hashmap.Find(voxel_keys, addrs, masks);
+    core::Tensor voxel_sums = voxel_hashmap.GetValueTensor();
+    voxel_sums.Fill(0);
+
+    if (device_type == core::Device::DeviceType::CPU) {
+        AccumulateVoxelsCPU(depth, image_colors, pixel_indices, addrs,
+                            voxel_sums, intrinsics_d, extrinsics_d,
+                            depth_scale, stride);
+    } else {
+        CUDA_CALL(AccumulateVoxelsCUDA, depth, image_colors, pixel_indices,
+                  addrs, voxel_sums, intrinsics_d, extrinsics_d, depth_scale,
+                  stride);
+    }
+
+    core::Tensor active_addrs;
+    voxel_hashmap.GetActiveIndices(active_addrs);
+    core::Tensor sums =
+            voxel_sums.IndexGet({active_addrs.To(core::Dtype::Int64)});
+    core::Tensor counts = sums.Slice(1, sum_size - 1, sum_size);
+    points = sums.Slice(1, 0, 3) / counts;
+    if (have_colors) {
+        colors.value().get() = sums.Slice(1, 3, 6) / counts;
+    }
+}
+
 void Project(
         core::Tensor& depth,
         utility::optional<std::reference_wrapper<core::Tensor>> image_colors,
@@ -104,6 +188,272 @@ void Project(
     }
 }
 
+void EstimateCovariances(const core::Tensor& points,
+                         const core::Tensor& neighbor_indices,
+                         const core::Tensor& neighbor_offsets,
+                         const core::Tensor& neighbor_counts,
+                         core::Tensor& covariances) {
+    core::Device device = points.GetDevice();
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EstimateCovariancesCPU(points, neighbor_indices, neighbor_offsets,
+                               neighbor_counts, covariances);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(EstimateCovariancesCUDA, points, neighbor_indices,
+                  neighbor_offsets, neighbor_counts, covariances);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void EstimateColorGradients(const core::Tensor& points,
+                            const core::Tensor& normals,
+                            const core::Tensor& colors,
+                            const core::Tensor& neighbor_indices,
+                            const core::Tensor& neighbor_offsets,
+                            const core::Tensor& neighbor_counts,
+                            core::Tensor& color_gradients) {
+    core::Device device = points.GetDevice();
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EstimateColorGradientsCPU(points, normals, colors, neighbor_indices,
+                                  neighbor_offsets, neighbor_counts,
+                                  color_gradients);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(EstimateColorGradientsCUDA, points, normals, colors,
+                  neighbor_indices, neighbor_offsets, neighbor_counts,
+                  color_gradients);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void EstimateNormalsFromCovariances(const core::Tensor& covariances,
+                                    core::Tensor& normals,
+                                    bool has_normals) {
+    core::Device device = covariances.GetDevice();
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EstimateNormalsFromCovariancesCPU(covariances, normals, has_normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(EstimateNormalsFromCovariancesCUDA, covariances, normals,
+                  has_normals);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void OrientNormalsToAlignWithDirection(core::Tensor& normals,
+                                       const core::Tensor& direction) {
+    static const core::Device host("CPU:0");
+    core::Tensor direction_d =
+            direction.To(host, core::Dtype::Float64).Contiguous();
+
+    core::Device device = normals.GetDevice();
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        OrientNormalsToAlignWithDirectionCPU(normals, direction_d);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(OrientNormalsToAlignWithDirectionCUDA, normals, direction_d);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void OrientNormalsTowardsCameraLocation(const core::Tensor& points,
+                                        core::Tensor& normals,
+                                        const core::Tensor& camera_location) {
+    static const core::Device host("CPU:0");
+    core::Tensor camera_location_d =
+            camera_location.To(host, core::Dtype::Float64).Contiguous();
+
+    core::Device device = points.GetDevice();
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        OrientNormalsTowardsCameraLocationCPU(points, normals,
+                                              camera_location_d);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(OrientNormalsTowardsCameraLocationCUDA, points, normals,
+                  camera_location_d);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SplatPointDepths(const core::Tensor& points,
+                      const core::Tensor& intrinsics,
+                      const core::Tensor& extrinsics,
+                      float depth_max,
+                      core::Tensor& pixel_indices,
+                      core::Tensor& depths,
+                      core::Tensor& depth_buffer) {
+    static const core::Device host("CPU:0");
+    core::Tensor intrinsics_d =
+            intrinsics.To(host, core::Dtype::Float64).Contiguous();
+    core::Tensor extrinsics_d =
+            extrinsics.To(host, core::Dtype::Float64).Contiguous();
+
+    core::Device device = points.GetDevice();
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SplatPointDepthsCPU(points, intrinsics_d, extrinsics_d, depth_max,
+                            pixel_indices, depths, depth_buffer);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(SplatPointDepthsCUDA, points, intrinsics_d, extrinsics_d,
+                  depth_max, pixel_indices, depths, depth_buffer);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void TestPointOcclusion(const core::Tensor& pixel_indices,
+                        const core::Tensor& depths,
+                        const core::Tensor& depth_level,
+                        int64_t level,
+                        int64_t width,
+                        int64_t height,
+                        int64_t splat_radius,
+                        float depth_tolerance,
+                        core::Tensor& visible) {
+    core::Device device = pixel_indices.GetDevice();
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        TestPointOcclusionCPU(pixel_indices, depths, depth_level, level, width,
+                              height, splat_radius, depth_tolerance, visible);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(TestPointOcclusionCUDA, pixel_indices, depths, depth_level,
+                  level, width, height, splat_radius, depth_tolerance,
+                  visible);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+// Packs the rows of the 3 x 4 extrinsic matrix followed by fx, fy, cx, cy of
+// each of the num_views views into a Float32 tensor of shape {num_views, 16}
+// on device, the layout read by ProjectToView().
+static core::Tensor PackViews(const core::Tensor& intrinsics,
+                              const core::Tensor& extrinsics,
+                              int64_t num_views,
+                              const core::Device& device) {
+    static const core::Device host("CPU:0");
+    const core::Tensor intrinsics_d =
+            intrinsics.To(host, core::Dtype::Float64).Contiguous();
+    const core::Tensor extrinsics_d =
+            extrinsics.To(host, core::Dtype::Float64).Contiguous();
+    const double* intrinsics_ptr = intrinsics_d.GetDataPtr<double>();
+    const double* extrinsics_ptr = extrinsics_d.GetDataPtr<double>();
+    const int64_t intrinsics_stride = intrinsics_d.NumDims() == 2 ? 0 : 9;
+    const int64_t extrinsics_stride = extrinsics_d.NumDims() == 2 ? 0 : 16;
+
+    std::vector<float> views(num_views * 16);
+    for (int64_t i = 0; i < num_views; ++i) {
+        const double* K = intrinsics_ptr + i * intrinsics_stride;
+        const double* T = extrinsics_ptr + i * extrinsics_stride;
+        float* view = views.data() + i * 16;
+        for (int j = 0; j < 12; ++j) {
+            view[j] = static_cast<float>(T[j]);
+        }
+        view[12] = static_cast<float>(K[0]);
+        view[13] = static_cast<float>(K[4]);
+        view[14] = static_cast<float>(K[2]);
+        view[15] = static_cast<float>(K[5]);
+    }
+    return core::Tensor(views, {num_views, 16}, core::Dtype::Float32, device);
+}
+
+void SplatDepthsMultiView(const core::Tensor& points,
+                          const core::Tensor& intrinsics,
+                          const core::Tensor& extrinsics,
+                          float depth_scale,
+                          float depth_max,
+                          int64_t splat_radius,
+                          core::Tensor& depth) {
+    core::Device device = points.GetDevice();
+    const core::Tensor views =
+            PackViews(intrinsics, extrinsics, depth.GetShape(0), device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SplatDepthsMultiViewCPU(points, views, depth_scale, depth_max,
+                                splat_radius, depth);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(SplatDepthsMultiViewCUDA, points, views, depth_scale,
+                  depth_max, splat_radius, depth);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void AccumulateSplatsMultiView(
+        const core::Tensor& points,
+        utility::optional<std::reference_wrapper<const core::Tensor>> colors,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        float depth_scale,
+        float depth_max,
+        int64_t splat_radius,
+        float depth_tolerance,
+        const core::Tensor& depth,
+        core::Tensor& sums) {
+    core::Device device = points.GetDevice();
+    const core::Tensor views =
+            PackViews(intrinsics, extrinsics, depth.GetShape(0), device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        AccumulateSplatsMultiViewCPU(points, colors, views, depth_scale,
+                                     depth_max, splat_radius, depth_tolerance,
+                                     depth, sums);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(AccumulateSplatsMultiViewCUDA, points, colors, views,
+                  depth_scale, depth_max, splat_radius, depth_tolerance, depth,
+                  sums);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ResolveSplatsMultiView(
+        utility::optional<std::reference_wrapper<const core::Tensor>> sums,
+        bool average_depth,
+        core::Tensor& depth,
+        utility::optional<std::reference_wrapper<core::Tensor>> image_colors) {
+    if (image_colors.has_value() && !sums.has_value()) {
+        utility::LogError(
+                "[ResolveSplatsMultiView] image_colors requires the sums of "
+                "the colors.");
+    }
+
+    core::Device device = depth.GetDevice();
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ResolveSplatsMultiViewCPU(sums, average_depth, depth, image_colors);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ResolveSplatsMultiViewCUDA, sums, average_depth, depth,
+                  image_colors);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeOrientedBoundingBoxes(const core::Tensor& points,
+                                  const core::Tensor& offsets,
+                                  core::Tensor& centers,
+                                  core::Tensor& rotations,
+                                  core::Tensor& extents) {
+    core::Device device = points.GetDevice();
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeOrientedBoundingBoxesCPU(points, offsets, centers, rotations,
+                                        extents);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeOrientedBoundingBoxesCUDA, points, offsets, centers,
+                  rotations, extents);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
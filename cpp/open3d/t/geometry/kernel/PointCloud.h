@@ -29,6 +29,7 @@
 #include <unordered_map>
 
 #include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
 
 namespace open3d {
 namespace t {
@@ -57,6 +58,200 @@ void Project(
         float depth_scale,
         float depth_max);
 
+/// Unprojects the valid pixels of depth like Unproject() and averages the
+/// points and colors falling into the same voxel of size voxel_size, without
+/// creating the full resolution point cloud. The voxels are aggregated in a
+/// core::Hashmap with the given backend.
+void UnprojectVoxelDownSample(
+        const core::Tensor& depth,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                image_colors,
+        core::Tensor& points,
+        utility::optional<std::reference_wrapper<core::Tensor>> colors,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        float depth_scale,
+        float depth_max,
+        int64_t stride,
+        float voxel_size,
+        const core::HashmapBackend& backend);
+
+/// Computes the covariance of the neighborhood of each point. The neighbors of
+/// point i are neighbor_indices[neighbor_offsets[i] + j] for
+/// 0 <= j < neighbor_counts[i]. Points with less than 3 neighbors get a zero
+/// covariance.
+///
+/// \param points Points of shape {n, 3}, Float32 or Float64.
+/// \param neighbor_indices Flat neighbor indices, Int64.
+/// \param neighbor_offsets Start of the neighbors of each point, shape {n},
+/// Int64.
+/// \param neighbor_counts Number of neighbors of each point, shape {n}, Int64.
+/// \param covariances Output covariances of shape {n, 3, 3}, same dtype as
+/// points.
+void EstimateCovariances(const core::Tensor& points,
+                         const core::Tensor& neighbor_indices,
+                         const core::Tensor& neighbor_offsets,
+                         const core::Tensor& neighbor_counts,
+                         core::Tensor& covariances);
+
+/// Estimates the gradient of the intensity (mean of the color channels) of
+/// each point in its tangent plane by least squares over its neighbors, like
+/// the legacy ColoredICP. The neighbors are given like for
+/// EstimateCovariances(). Points with less than 4 neighbors get a zero
+/// gradient.
+///
+/// \param points Points of shape {n, 3}, Float32 or Float64.
+/// \param normals Normals of shape {n, 3}, same dtype as points.
+/// \param colors Colors of shape {n, 3}, same dtype as points.
+/// \param neighbor_indices Flat neighbor indices, Int64.
+/// \param neighbor_offsets Start of the neighbors of each point, shape {n},
+/// Int64.
+/// \param neighbor_counts Number of neighbors of each point, shape {n}, Int64.
+/// \param color_gradients Output gradients of shape {n, 3}, same dtype as
+/// points.
+void EstimateColorGradients(const core::Tensor& points,
+                            const core::Tensor& normals,
+                            const core::Tensor& colors,
+                            const core::Tensor& neighbor_indices,
+                            const core::Tensor& neighbor_offsets,
+                            const core::Tensor& neighbor_counts,
+                            core::Tensor& color_gradients);
+
+/// Computes the normals as the eigenvectors of the smallest eigenvalue of the
+/// covariances. Points with a zero covariance keep their normal if
+/// has_normals, otherwise get (0, 0, 1). If has_normals, the new normals are
+/// flipped to agree with the previous ones.
+///
+/// \param covariances Covariances of shape {n, 3, 3}.
+/// \param normals Normals of shape {n, 3}, same dtype as covariances. Read as
+/// the previous normals if has_normals.
+void EstimateNormalsFromCovariances(const core::Tensor& covariances,
+                                    core::Tensor& normals,
+                                    bool has_normals);
+
+/// Flips the normals with a negative dot product with direction. Zero normals
+/// are set to direction.
+///
+/// \param direction Host Float64 tensor of shape {3}.
+void OrientNormalsToAlignWithDirection(core::Tensor& normals,
+                                       const core::Tensor& direction);
+
+/// Flips the normals pointing away from camera_location. Zero normals are set
+/// to the normalized direction to camera_location, or (0, 0, 1).
+///
+/// \param camera_location Host Float64 tensor of shape {3}.
+void OrientNormalsTowardsCameraLocation(const core::Tensor& points,
+                                        core::Tensor& normals,
+                                        const core::Tensor& camera_location);
+
+/// Projects the points to a pinhole camera and writes the minimum depth of
+/// the points projecting to each pixel to depth_buffer, which is expected to
+/// be initialized with +inf.
+///
+/// \param points Points of shape {n, 3}, Float32 or Float64.
+/// \param intrinsics Host Float64 tensor of shape {3, 3}.
+/// \param extrinsics Host Float64 tensor of shape {4, 4}.
+/// \param depth_max Points beyond this depth are not projected.
+/// \param pixel_indices Output flat pixel index y * width + x of each point,
+/// or -1 if the point is not projected. Shape {n}, Int64.
+/// \param depths Output depth of each projected point, shape {n}, Float32.
+/// \param depth_buffer Depth buffer of shape {height, width}, Float32.
+void SplatPointDepths(const core::Tensor& points,
+                      const core::Tensor& intrinsics,
+                      const core::Tensor& extrinsics,
+                      float depth_max,
+                      core::Tensor& pixel_indices,
+                      core::Tensor& depths,
+                      core::Tensor& depth_buffer);
+
+/// Marks a projected point as visible if no cell of depth_level covering the
+/// pixels within splat_radius of its pixel has a depth below
+/// depth * (1 - depth_tolerance). Points with a pixel index of -1 are not
+/// visible.
+///
+/// \param pixel_indices Pixel indices of SplatPointDepths().
+/// \param depths Depths of SplatPointDepths().
+/// \param depth_level Min depth pyramid level of the depth buffer, whose
+/// cells cover 2^level x 2^level pixels. Shape {ceil(height / 2^level),
+/// ceil(width / 2^level)}, Float32.
+/// \param visible Output visibility of shape {n}, Bool.
+void TestPointOcclusion(const core::Tensor& pixel_indices,
+                        const core::Tensor& depths,
+                        const core::Tensor& depth_level,
+                        int64_t level,
+                        int64_t width,
+                        int64_t height,
+                        int64_t splat_radius,
+                        float depth_tolerance,
+                        core::Tensor& visible);
+
+/// Splats the points to the depth images of a batch of views, keeping the
+/// minimum depth times depth_scale per pixel. A point covers the pixels within
+/// splat_radius of the pixel it projects to.
+///
+/// \param points Points of shape {n, 3}, Float32 or Float64.
+/// \param intrinsics Intrinsic matrices of shape {v, 3, 3}, or {3, 3} for
+/// all views.
+/// \param extrinsics Extrinsic matrices of shape {v, 4, 4}, or {4, 4} for
+/// all views.
+/// \param depth_max Points beyond this depth are not projected.
+/// \param depth Contiguous depth images of shape {v, h, w, 1}, Float32,
+/// initialized with +inf.
+void SplatDepthsMultiView(const core::Tensor& points,
+                          const core::Tensor& intrinsics,
+                          const core::Tensor& extrinsics,
+                          float depth_scale,
+                          float depth_max,
+                          int64_t splat_radius,
+                          core::Tensor& depth);
+
+/// Sums the scaled depth, the colors and the number of the splats of
+/// SplatDepthsMultiView() that are within depth_tolerance times the depth of
+/// the nearest splat of their pixel.
+///
+/// \param colors Colors of shape {n, 3}, Float32 in [0, 1].
+/// \param depth Depth images of SplatDepthsMultiView().
+/// \param sums Contiguous zero initialized sums of shape {v, h, w, 5} with
+/// colors, {v, h, w, 2} otherwise, Float32. Layout of a sum: depth,
+/// [r, g, b,] count.
+void AccumulateSplatsMultiView(
+        const core::Tensor& points,
+        utility::optional<std::reference_wrapper<const core::Tensor>> colors,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        float depth_scale,
+        float depth_max,
+        int64_t splat_radius,
+        float depth_tolerance,
+        const core::Tensor& depth,
+        core::Tensor& sums);
+
+/// Sets the empty pixels of the depth images of SplatDepthsMultiView() to 0,
+/// and with the sums of AccumulateSplatsMultiView(), the colors to the average
+/// color and, if average_depth, the depth to the average depth of the splats.
+///
+/// \param image_colors Contiguous colors of shape {v, h, w, 3}, UInt8.
+/// Requires sums with colors.
+void ResolveSplatsMultiView(
+        utility::optional<std::reference_wrapper<const core::Tensor>> sums,
+        bool average_depth,
+        core::Tensor& depth,
+        utility::optional<std::reference_wrapper<core::Tensor>> image_colors);
+
+/// Computes the boxes aligned with the principal axes of the clusters of
+/// points, one thread per cluster.
+///
+/// \param points Contiguous points of shape {n, 3}, Float32 or Float64.
+/// \param offsets Contiguous Int64 offsets of shape {k + 1} of the clusters.
+/// \param centers Output centers of shape {k, 3}, with the dtype of points.
+/// \param rotations Output rotations of shape {k, 3, 3}.
+/// \param extents Output extents of shape {k, 3}.
+void ComputeOrientedBoundingBoxes(const core::Tensor& points,
+                                  const core::Tensor& offsets,
+                                  core::Tensor& centers,
+                                  core::Tensor& rotations,
+                                  core::Tensor& extents);
+
 void UnprojectCPU(
         const core::Tensor& depth,
         utility::optional<std::reference_wrapper<const core::Tensor>>
@@ -79,6 +274,101 @@ void ProjectCPU(
         float depth_scale,
         float depth_max);
 
+void VoxelizeDepthCPU(const core::Tensor& depth,
+                      core::Tensor& pixel_indices,
+                      core::Tensor& voxel_keys,
+                      const core::Tensor& intrinsics,
+                      const core::Tensor& extrinsics,
+                      float depth_scale,
+                      float depth_max,
+                      int64_t stride,
+                      float voxel_size);
+
+void AccumulateVoxelsCPU(
+        const core::Tensor& depth,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                image_colors,
+        const core::Tensor& pixel_indices,
+        const core::Tensor& voxel_addrs,
+        core::Tensor& voxel_sums,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        float depth_scale,
+        int64_t stride);
+
+void EstimateCovariancesCPU(const core::Tensor& points,
+                            const core::Tensor& neighbor_indices,
+                            const core::Tensor& neighbor_offsets,
+                            const core::Tensor& neighbor_counts,
+                            core::Tensor& covariances);
+
+void EstimateColorGradientsCPU(const core::Tensor& points,
+                               const core::Tensor& normals,
+                               const core::Tensor& colors,
+                               const core::Tensor& neighbor_indices,
+                               const core::Tensor& neighbor_offsets,
+                               const core::Tensor& neighbor_counts,
+                               core::Tensor& color_gradients);
+
+void EstimateNormalsFromCovariancesCPU(const core::Tensor& covariances,
+                                       core::Tensor& normals,
+                                       bool has_normals);
+
+void OrientNormalsToAlignWithDirectionCPU(core::Tensor& normals,
+                                          const core::Tensor& direction);
+
+void OrientNormalsTowardsCameraLocationCPU(const core::Tensor& points,
+                                           core::Tensor& normals,
+                                           const core::Tensor& camera_location);
+
+void SplatPointDepthsCPU(const core::Tensor& points,
+                         const core::Tensor& intrinsics,
+                         const core::Tensor& extrinsics,
+                         float depth_max,
+                         core::Tensor& pixel_indices,
+                         core::Tensor& depths,
+                         core::Tensor& depth_buffer);
+
+void TestPointOcclusionCPU(const core::Tensor& pixel_indices,
+                           const core::Tensor& depths,
+                           const core::Tensor& depth_level,
+                           int64_t level,
+                           int64_t width,
+                           int64_t height,
+                           int64_t splat_radius,
+                           float depth_tolerance,
+                           core::Tensor& visible);
+
+void SplatDepthsMultiViewCPU(const core::Tensor& points,
+                             const core::Tensor& views,
+                             float depth_scale,
+                             float depth_max,
+                             int64_t splat_radius,
+                             core::Tensor& depth);
+
+void AccumulateSplatsMultiViewCPU(
+        const core::Tensor& points,
+        utility::optional<std::reference_wrapper<const core::Tensor>> colors,
+        const core::Tensor& views,
+        float depth_scale,
+        float depth_max,
+        int64_t splat_radius,
+        float depth_tolerance,
+        const core::Tensor& depth,
+        core::Tensor& sums);
+
+void ResolveSplatsMultiViewCPU(
+        utility::optional<std::reference_wrapper<const core::Tensor>> sums,
+        bool average_depth,
+        core::Tensor& depth,
+        utility::optional<std::reference_wrapper<core::Tensor>> image_colors);
+
+void ComputeOrientedBoundingBoxesCPU(const core::Tensor& points,
+                                     const core::Tensor& offsets,
+                                     core::Tensor& centers,
+                                     core::Tensor& rotations,
+                                     core::Tensor& extents);
+
 #ifdef BUILD_CUDA_MODULE
 void UnprojectCUDA(
         const core::Tensor& depth,
@@ -101,6 +391,102 @@ void ProjectCUDA(
         const core::Tensor& extrinsics,
         float depth_scale,
         float depth_max);
+
+void VoxelizeDepthCUDA(const core::Tensor& depth,
+                       core::Tensor& pixel_indices,
+                       core::Tensor& voxel_keys,
+                       const core::Tensor& intrinsics,
+                       const core::Tensor& extrinsics,
+                       float depth_scale,
+                       float depth_max,
+                       int64_t stride,
+                       float voxel_size);
+
+void AccumulateVoxelsCUDA(
+        const core::Tensor& depth,
+        utility::optional<std::reference_wrapper<const core::Tensor>>
+                image_colors,
+        const core::Tensor& pixel_indices,
+        const core::Tensor& voxel_addrs,
+        core::Tensor& voxel_sums,
+        const core::Tensor& intrinsics,
+        const core::Tensor& extrinsics,
+        float depth_scale,
+        int64_t stride);
+
+void EstimateCovariancesCUDA(const core::Tensor& points,
+                             const core::Tensor& neighbor_indices,
+                             const core::Tensor& neighbor_offsets,
+                             const core::Tensor& neighbor_counts,
+                             core::Tensor& covariances);
+
+void EstimateColorGradientsCUDA(const core::Tensor& points,
+                                const core::Tensor& normals,
+                                const core::Tensor& colors,
+                                const core::Tensor& neighbor_indices,
+                                const core::Tensor& neighbor_offsets,
+                                const core::Tensor& neighbor_counts,
+                                core::Tensor& color_gradients);
+
+void EstimateNormalsFromCovariancesCUDA(const core::Tensor& covariances,
+                                        core::Tensor& normals,
+                                        bool has_normals);
+
+void OrientNormalsToAlignWithDirectionCUDA(core::Tensor& normals,
+                                           const core::Tensor& direction);
+
+void OrientNormalsTowardsCameraLocationCUDA(
+        const core::Tensor& points,
+        core::Tensor& normals,
+        const core::Tensor& camera_location);
+
+void SplatPointDepthsCUDA(const core::Tensor& points,
+                          const core::Tensor& intrinsics,
+                          const core::Tensor& extrinsics,
+                          float depth_max,
+                          core::Tensor& pixel_indices,
+                          core::Tensor& depths,
+                          core::Tensor& depth_buffer);
+
+void TestPointOcclusionCUDA(const core::Tensor& pixel_indices,
+                            const core::Tensor& depths,
+                            const core::Tensor& depth_level,
+                            int64_t level,
+                            int64_t width,
+                            int64_t height,
+                            int64_t splat_radius,
+                            float depth_tolerance,
+                            core::Tensor& visible);
+
+void SplatDepthsMultiViewCUDA(const core::Tensor& points,
+                              const core::Tensor& views,
+                              float depth_scale,
+                              float depth_max,
+                              int64_t splat_radius,
+                              core::Tensor& depth);
+
+void AccumulateSplatsMultiViewCUDA(
+        const core::Tensor& points,
+        utility::optional<std::reference_wrapper<const core::Tensor>> colors,
+        const core::Tensor& views,
+        float depth_scale,
+        float depth_max,
+        int64_t splat_radius,
+        float depth_tolerance,
+        const core::Tensor& depth,
+        core::Tensor& sums);
+
+void ResolveSplatsMultiViewCUDA(
+        utility::optional<std::reference_wrapper<const core::Tensor>> sums,
+        bool average_depth,
+        core::Tensor& depth,
+        utility::optional<std::reference_wrapper<core::Tensor>> image_colors);
+
+void ComputeOrientedBoundingBoxesCUDA(const core::Tensor& points,
+                                      const core::Tensor& offsets,
+                                      core::Tensor& centers,
+                                      core::Tensor& rotations,
+                                      core::Tensor& extents);
 #endif
 
 }  // namespace pointcloud
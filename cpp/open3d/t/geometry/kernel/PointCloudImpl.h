@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include <atomic>
+#include <cmath>
+#include <cstring>
 #include <vector>
 
 #include "open3d/core/Dispatch.h"
@@ -32,6 +34,7 @@
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/Scan.h"
 #include "open3d/t/geometry/Utility.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
@@ -68,83 +71,1306 @@ void UnprojectCPU
     core::Tensor pose = t::geometry::InverseTransformation(extrinsics);
     TransformIndexer ti(intrinsics, pose, 1.0f);
 
-    // Output
     int64_t rows_strided = depth_indexer.GetShape(0) / stride;
     int64_t cols_strided = depth_indexer.GetShape(1) / stride;
+    int64_t n = rows_strided * cols_strided;
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    // Mask of the pixels with a valid depth. Compacting the mask gives each
+    // valid pixel its output index, in row-major pixel order.
+    core::Tensor valid(core::SizeVector{n}, core::Dtype::Bool,
+                       depth.GetDevice());
+    bool* valid_ptr = valid.GetDataPtr<bool>();
+    DISPATCH_DTYPE_TO_TEMPLATE(depth.GetDtype(), [&]() {
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            int64_t y = (workload_idx / cols_strided) * stride;
+            int64_t x = (workload_idx % cols_strided) * stride;
 
-    points = core::Tensor({rows_strided * cols_strided, 3},
-                          core::Dtype::Float32, depth.GetDevice());
+            float d = *depth_indexer.GetDataPtr<scalar_t>(x, y) / depth_scale;
+            valid_ptr[workload_idx] = d > 0 && d < depth_max;
+        });
+    });
+    core::Tensor valid_indices = core::kernel::Compact(valid);
+    const int64_t* valid_indices_ptr = valid_indices.GetDataPtr<int64_t>();
+    int64_t total_pts_count = valid_indices.GetLength();
+
+    // Output
+    points = core::Tensor({total_pts_count, 3}, core::Dtype::Float32,
+                          depth.GetDevice());
     NDArrayIndexer point_indexer(points, 1);
     NDArrayIndexer colors_indexer;
     if (have_colors) {
         const auto& imcol = image_colors.value().get();
         image_colors_indexer = NDArrayIndexer{imcol, 2};
-        colors.value().get() =
-                core::Tensor({rows_strided * cols_strided, 3},
-                             core::Dtype::Float32, imcol.GetDevice());
+        colors.value().get() = core::Tensor(
+                {total_pts_count, 3}, core::Dtype::Float32, imcol.GetDevice());
         colors_indexer = NDArrayIndexer(colors.value().get(), 1);
     }
 
-    // Counter
+    DISPATCH_DTYPE_TO_TEMPLATE(depth.GetDtype(), [&]() {
+        launcher::ParallelFor(total_pts_count, [=] OPEN3D_DEVICE(int64_t idx) {
+            int64_t workload_idx = valid_indices_ptr[idx];
+            int64_t y = (workload_idx / cols_strided) * stride;
+            int64_t x = (workload_idx % cols_strided) * stride;
+
+            float d = *depth_indexer.GetDataPtr<scalar_t>(x, y) / depth_scale;
+            float x_c = 0, y_c = 0, z_c = 0;
+            ti.Unproject(static_cast<float>(x), static_cast<float>(y), d, &x_c,
+                         &y_c, &z_c);
+
+            float* vertex = point_indexer.GetDataPtr<float>(idx);
+            ti.RigidTransform(x_c, y_c, z_c, vertex + 0, vertex + 1,
+                              vertex + 2);
+            if (have_colors) {
+                float* pcd_pixel = colors_indexer.GetDataPtr<float>(idx);
+                float* image_pixel =
+                        image_colors_indexer.GetDataPtr<float>(x, y);
+                *pcd_pixel = *image_pixel;
+                *(pcd_pixel + 1) = *(image_pixel + 1);
+                *(pcd_pixel + 2) = *(image_pixel + 2);
+            }
+        });
+    });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
 #if defined(__CUDACC__)
-    core::Tensor count(std::vector<int>{0}, {}, core::Dtype::Int32,
-                       depth.GetDevice());
-    int* count_ptr = count.GetDataPtr<int>();
+void VoxelizeDepthCUDA
 #else
-    std::atomic<int> count_atomic(0);
-    std::atomic<int>* count_ptr = &count_atomic;
+void VoxelizeDepthCPU
 #endif
+        (const core::Tensor& depth,
+         core::Tensor& pixel_indices,
+         core::Tensor& voxel_keys,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         float depth_scale,
+         float depth_max,
+         int64_t stride,
+         float voxel_size) {
+    NDArrayIndexer depth_indexer(depth, 2);
 
+    core::Tensor pose = t::geometry::InverseTransformation(extrinsics);
+    TransformIndexer ti(intrinsics, pose, 1.0f);
+
+    int64_t rows_strided = depth_indexer.GetShape(0) / stride;
+    int64_t cols_strided = depth_indexer.GetShape(1) / stride;
     int64_t n = rows_strided * cols_strided;
 
 #if defined(__CUDACC__)
     namespace launcher = core::kernel::cuda_launcher;
 #else
     namespace launcher = core::kernel::cpu_launcher;
+    using std::floor;
 #endif
 
+    core::Tensor valid(core::SizeVector{n}, core::Dtype::Bool,
+                       depth.GetDevice());
+    core::Tensor keys({n, 3}, core::Dtype::Int32, depth.GetDevice());
+    bool* valid_ptr = valid.GetDataPtr<bool>();
+    int* keys_ptr = keys.GetDataPtr<int>();
     DISPATCH_DTYPE_TO_TEMPLATE(depth.GetDtype(), [&]() {
         launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
             int64_t y = (workload_idx / cols_strided) * stride;
             int64_t x = (workload_idx % cols_strided) * stride;
 
             float d = *depth_indexer.GetDataPtr<scalar_t>(x, y) / depth_scale;
-            if (d > 0 && d < depth_max) {
-                int idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
+            valid_ptr[workload_idx] = d > 0 && d < depth_max;
+            if (!valid_ptr[workload_idx]) {
+                return;
+            }
+
+            float x_c = 0, y_c = 0, z_c = 0, x_g = 0, y_g = 0, z_g = 0;
+            ti.Unproject(static_cast<float>(x), static_cast<float>(y), d, &x_c,
+                         &y_c, &z_c);
+            ti.RigidTransform(x_c, y_c, z_c, &x_g, &y_g, &z_g);
+            int* key = keys_ptr + 3 * workload_idx;
+            key[0] = static_cast<int>(floor(x_g / voxel_size));
+            key[1] = static_cast<int>(floor(y_g / voxel_size));
+            key[2] = static_cast<int>(floor(z_g / voxel_size));
+        });
+    });
+    pixel_indices = core::kernel::Compact(valid);
+    voxel_keys = keys.IndexGet({pixel_indices});
+}
+
+// Atomically adds value to *address, from a ParallelFor on either device.
+OPEN3D_HOST_DEVICE inline void AtomicAddFloat(float* address, float value) {
+#if defined(__CUDA_ARCH__)
+    atomicAdd(address, value);
+#else
+#pragma omp atomic
+    *address += value;
+#endif
+}
+
+#if defined(__CUDACC__)
+void AccumulateVoxelsCUDA
+#else
+void AccumulateVoxelsCPU
+#endif
+        (const core::Tensor& depth,
+         utility::optional<std::reference_wrapper<const core::Tensor>>
+                 image_colors,
+         const core::Tensor& pixel_indices,
+         const core::Tensor& voxel_addrs,
+         core::Tensor& voxel_sums,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         float depth_scale,
+         int64_t stride) {
+    const bool have_colors = image_colors.has_value();
+    NDArrayIndexer depth_indexer(depth, 2);
+    NDArrayIndexer image_colors_indexer;
+    if (have_colors) {
+        image_colors_indexer = NDArrayIndexer(image_colors.value().get(), 2);
+    }
+
+    core::Tensor pose = t::geometry::InverseTransformation(extrinsics);
+    TransformIndexer ti(intrinsics, pose, 1.0f);
+
+    int64_t cols_strided = depth_indexer.GetShape(1) / stride;
+    int64_t n = pixel_indices.GetLength();
+    int64_t sum_size = voxel_sums.GetShape(1);
+
+    const int64_t* pixel_indices_ptr = pixel_indices.GetDataPtr<int64_t>();
+    const int* voxel_addrs_ptr = voxel_addrs.GetDataPtr<int>();
+    float* voxel_sums_ptr = voxel_sums.GetDataPtr<float>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    // The points are unprojected again instead of being stored by
+    // VoxelizeDepth, so that no full resolution point cloud is allocated.
+    DISPATCH_DTYPE_TO_TEMPLATE(depth.GetDtype(), [&]() {
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t idx) {
+            int64_t workload_idx = pixel_indices_ptr[idx];
+            int64_t y = (workload_idx / cols_strided) * stride;
+            int64_t x = (workload_idx % cols_strided) * stride;
+
+            float d = *depth_indexer.GetDataPtr<scalar_t>(x, y) / depth_scale;
+            float x_c = 0, y_c = 0, z_c = 0, x_g = 0, y_g = 0, z_g = 0;
+            ti.Unproject(static_cast<float>(x), static_cast<float>(y), d, &x_c,
+                         &y_c, &z_c);
+            ti.RigidTransform(x_c, y_c, z_c, &x_g, &y_g, &z_g);
+
+            // Layout of a voxel sum: x, y, z, [r, g, b,] count.
+            float* sum = voxel_sums_ptr + voxel_addrs_ptr[idx] * sum_size;
+            AtomicAddFloat(sum + 0, x_g);
+            AtomicAddFloat(sum + 1, y_g);
+            AtomicAddFloat(sum + 2, z_g);
+            if (have_colors) {
+                const float* color =
+                        image_colors_indexer.GetDataPtr<float>(x, y);
+                AtomicAddFloat(sum + 3, color[0]);
+                AtomicAddFloat(sum + 4, color[1]);
+                AtomicAddFloat(sum + 5, color[2]);
+            }
+            AtomicAddFloat(sum + sum_size - 1, 1.0f);
+        });
+    });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
+// Symmetric 3x3 eigen solver of geometry/EstimateNormals.cpp, on row-major
+// matrices so that it runs on both host and device.
+OPEN3D_HOST_DEVICE inline void Cross3(const double* a,
+                                      const double* b,
+                                      double* out) {
+    out[0] = a[1] * b[2] - a[2] * b[1];
+    out[1] = a[2] * b[0] - a[0] * b[2];
+    out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+OPEN3D_HOST_DEVICE inline double Dot3(const double* a, const double* b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+OPEN3D_HOST_DEVICE inline void ComputeEigenvector0(const double* A,
+                                                   double eval0,
+                                                   double* evec0) {
+    double row0[3] = {A[0] - eval0, A[1], A[2]};
+    double row1[3] = {A[1], A[4] - eval0, A[5]};
+    double row2[3] = {A[2], A[5], A[8] - eval0};
+    double r0xr1[3], r0xr2[3], r1xr2[3];
+    Cross3(row0, row1, r0xr1);
+    Cross3(row0, row2, r0xr2);
+    Cross3(row1, row2, r1xr2);
+    double d0 = Dot3(r0xr1, r0xr1);
+    double d1 = Dot3(r0xr2, r0xr2);
+    double d2 = Dot3(r1xr2, r1xr2);
 
-                float x_c = 0, y_c = 0, z_c = 0;
-                ti.Unproject(static_cast<float>(x), static_cast<float>(y), d,
-                             &x_c, &y_c, &z_c);
+    const double* r = r0xr1;
+    double dmax = d0;
+    if (d1 > dmax) {
+        dmax = d1;
+        r = r0xr2;
+    }
+    if (d2 > dmax) {
+        dmax = d2;
+        r = r1xr2;
+    }
+    double inv_length = 1 / sqrt(dmax);
+    evec0[0] = r[0] * inv_length;
+    evec0[1] = r[1] * inv_length;
+    evec0[2] = r[2] * inv_length;
+}
+
+OPEN3D_HOST_DEVICE inline void ComputeEigenvector1(const double* A,
+                                                   const double* evec0,
+                                                   double eval1,
+                                                   double* evec1) {
+    double U[3], V[3];
+    if (fabs(evec0[0]) > fabs(evec0[1])) {
+        double inv_length =
+                1 / sqrt(evec0[0] * evec0[0] + evec0[2] * evec0[2]);
+        U[0] = -evec0[2] * inv_length;
+        U[1] = 0;
+        U[2] = evec0[0] * inv_length;
+    } else {
+        double inv_length =
+                1 / sqrt(evec0[1] * evec0[1] + evec0[2] * evec0[2]);
+        U[0] = 0;
+        U[1] = evec0[2] * inv_length;
+        U[2] = -evec0[1] * inv_length;
+    }
+    Cross3(evec0, U, V);
+
+    double AU[3] = {A[0] * U[0] + A[1] * U[1] + A[2] * U[2],
+                    A[1] * U[0] + A[4] * U[1] + A[5] * U[2],
+                    A[2] * U[0] + A[5] * U[1] + A[8] * U[2]};
+    double AV[3] = {A[0] * V[0] + A[1] * V[1] + A[2] * V[2],
+                    A[1] * V[0] + A[4] * V[1] + A[5] * V[2],
+                    A[2] * V[0] + A[5] * V[1] + A[8] * V[2]};
+
+    double m00 = Dot3(U, AU) - eval1;
+    double m01 = Dot3(U, AV);
+    double m11 = Dot3(V, AV) - eval1;
+
+    double abs_m00 = fabs(m00);
+    double abs_m01 = fabs(m01);
+    double abs_m11 = fabs(m11);
+    // evec1 = a * U - b * V.
+    double a = 1, b = 0;
+    if (abs_m00 >= abs_m11) {
+        if (fmax(abs_m00, abs_m01) > 0) {
+            if (abs_m00 >= abs_m01) {
+                m01 /= m00;
+                m00 = 1 / sqrt(1 + m01 * m01);
+                m01 *= m00;
+            } else {
+                m00 /= m01;
+                m01 = 1 / sqrt(1 + m00 * m00);
+                m00 *= m01;
+            }
+            a = m01;
+            b = m00;
+        }
+    } else {
+        if (fmax(abs_m11, abs_m01) > 0) {
+            if (abs_m11 >= abs_m01) {
+                m01 /= m11;
+                m11 = 1 / sqrt(1 + m01 * m01);
+                m01 *= m11;
+            } else {
+                m11 /= m01;
+                m01 = 1 / sqrt(1 + m11 * m11);
+                m11 *= m01;
+            }
+            a = m11;
+            b = m01;
+        }
+    }
+    evec1[0] = a * U[0] - b * V[0];
+    evec1[1] = a * U[1] - b * V[1];
+    evec1[2] = a * U[2] - b * V[2];
+}
+
+/// Eigenvector of the smallest eigenvalue of the symmetric matrix A, or zero
+/// if A is zero. A is scaled in place.
+OPEN3D_HOST_DEVICE inline void FastEigen3x3(double* A, double* evec) {
+    double max_coeff = A[0];
+    for (int i = 1; i < 9; ++i) {
+        max_coeff = fmax(max_coeff, A[i]);
+    }
+    if (max_coeff == 0) {
+        evec[0] = evec[1] = evec[2] = 0;
+        return;
+    }
+    for (int i = 0; i < 9; ++i) {
+        A[i] /= max_coeff;
+    }
+
+    double norm = A[1] * A[1] + A[2] * A[2] + A[5] * A[5];
+    if (norm > 0) {
+        double q = (A[0] + A[4] + A[8]) / 3;
+
+        double b00 = A[0] - q;
+        double b11 = A[4] - q;
+        double b22 = A[8] - q;
+
+        double p = sqrt((b00 * b00 + b11 * b11 + b22 * b22 + norm * 2) / 6);
+
+        double c00 = b11 * b22 - A[5] * A[5];
+        double c01 = A[1] * b22 - A[5] * A[2];
+        double c02 = A[1] * A[5] - b11 * A[2];
+        double det = (b00 * c00 - A[1] * c01 + A[2] * c02) / (p * p * p);
+
+        double half_det = fmin(fmax(det * 0.5, -1.0), 1.0);
+
+        double angle = acos(half_det) / 3.0;
+        const double two_thirds_pi = 2.09439510239319549;
+        double beta2 = cos(angle) * 2;
+        double beta0 = cos(angle + two_thirds_pi) * 2;
+        double beta1 = -(beta0 + beta2);
+
+        double eval0 = q + p * beta0;
+        double eval1 = q + p * beta1;
+        double eval2 = q + p * beta2;
+
+        double evec_first[3], evec_second[3];
+        if (half_det >= 0) {
+            ComputeEigenvector0(A, eval2, evec_first);
+            if (eval2 < eval0 && eval2 < eval1) {
+                evec[0] = evec_first[0];
+                evec[1] = evec_first[1];
+                evec[2] = evec_first[2];
+                return;
+            }
+            ComputeEigenvector1(A, evec_first, eval1, evec_second);
+            if (eval1 < eval0 && eval1 < eval2) {
+                evec[0] = evec_second[0];
+                evec[1] = evec_second[1];
+                evec[2] = evec_second[2];
+                return;
+            }
+            Cross3(evec_second, evec_first, evec);
+        } else {
+            ComputeEigenvector0(A, eval0, evec_first);
+            if (eval0 < eval1 && eval0 < eval2) {
+                evec[0] = evec_first[0];
+                evec[1] = evec_first[1];
+                evec[2] = evec_first[2];
+                return;
+            }
+            ComputeEigenvector1(A, evec_first, eval1, evec_second);
+            if (eval1 < eval0 && eval1 < eval2) {
+                evec[0] = evec_second[0];
+                evec[1] = evec_second[1];
+                evec[2] = evec_second[2];
+                return;
+            }
+            Cross3(evec_first, evec_second, evec);
+        }
+    } else {
+        evec[0] = evec[1] = evec[2] = 0;
+        if (A[0] < A[4] && A[0] < A[8]) {
+            evec[0] = 1;
+        } else if (A[4] < A[0] && A[4] < A[8]) {
+            evec[1] = 1;
+        } else {
+            evec[2] = 1;
+        }
+    }
+}
+
+#if defined(__CUDACC__)
+void EstimateCovariancesCUDA
+#else
+void EstimateCovariancesCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& neighbor_indices,
+         const core::Tensor& neighbor_offsets,
+         const core::Tensor& neighbor_counts,
+         core::Tensor& covariances) {
+    const int64_t n = points.GetLength();
+    const int64_t* indices_ptr = neighbor_indices.GetDataPtr<int64_t>();
+    const int64_t* offsets_ptr = neighbor_offsets.GetDataPtr<int64_t>();
+    const int64_t* counts_ptr = neighbor_counts.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        scalar_t* covariances_ptr = covariances.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int64_t* neighbors = indices_ptr + offsets_ptr[workload_idx];
+            const int64_t count = counts_ptr[workload_idx];
+            scalar_t* covariance = covariances_ptr + 9 * workload_idx;
+            if (count < 3) {
+                for (int i = 0; i < 9; ++i) {
+                    covariance[i] = 0;
+                }
+                return;
+            }
+
+            // Centered second moments, accumulated in double.
+            double mean[3] = {0, 0, 0};
+            for (int64_t j = 0; j < count; ++j) {
+                const scalar_t* p = points_ptr + 3 * neighbors[j];
+                mean[0] += p[0];
+                mean[1] += p[1];
+                mean[2] += p[2];
+            }
+            mean[0] /= count;
+            mean[1] /= count;
+            mean[2] /= count;
+            double xx = 0, xy = 0, xz = 0, yy = 0, yz = 0, zz = 0;
+            for (int64_t j = 0; j < count; ++j) {
+                const scalar_t* p = points_ptr + 3 * neighbors[j];
+                double dx = p[0] - mean[0];
+                double dy = p[1] - mean[1];
+                double dz = p[2] - mean[2];
+                xx += dx * dx;
+                xy += dx * dy;
+                xz += dx * dz;
+                yy += dy * dy;
+                yz += dy * dz;
+                zz += dz * dz;
+            }
+            covariance[0] = static_cast<scalar_t>(xx / count);
+            covariance[1] = static_cast<scalar_t>(xy / count);
+            covariance[2] = static_cast<scalar_t>(xz / count);
+            covariance[3] = covariance[1];
+            covariance[4] = static_cast<scalar_t>(yy / count);
+            covariance[5] = static_cast<scalar_t>(yz / count);
+            covariance[6] = covariance[2];
+            covariance[7] = covariance[5];
+            covariance[8] = static_cast<scalar_t>(zz / count);
+        });
+    });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
+OPEN3D_HOST_DEVICE inline double Det3x3(const double M[3][3]) {
+    return M[0][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1]) -
+           M[0][1] * (M[1][0] * M[2][2] - M[1][2] * M[2][0]) +
+           M[0][2] * (M[1][0] * M[2][1] - M[1][1] * M[2][0]);
+}
+
+#if defined(__CUDACC__)
+void EstimateColorGradientsCUDA
+#else
+void EstimateColorGradientsCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& normals,
+         const core::Tensor& colors,
+         const core::Tensor& neighbor_indices,
+         const core::Tensor& neighbor_offsets,
+         const core::Tensor& neighbor_counts,
+         core::Tensor& color_gradients) {
+    const int64_t n = points.GetLength();
+    const int64_t* indices_ptr = neighbor_indices.GetDataPtr<int64_t>();
+    const int64_t* offsets_ptr = neighbor_offsets.GetDataPtr<int64_t>();
+    const int64_t* counts_ptr = neighbor_counts.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        const scalar_t* colors_ptr = colors.GetDataPtr<scalar_t>();
+        scalar_t* gradients_ptr = color_gradients.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int64_t* neighbors = indices_ptr + offsets_ptr[workload_idx];
+            const int64_t count = counts_ptr[workload_idx];
+            scalar_t* gradient = gradients_ptr + 3 * workload_idx;
+            gradient[0] = gradient[1] = gradient[2] = 0;
+            if (count < 4) {
+                return;
+            }
 
-                float* vertex = point_indexer.GetDataPtr<float>(idx);
-                ti.RigidTransform(x_c, y_c, z_c, vertex + 0, vertex + 1,
-                                  vertex + 2);
-                if (have_colors) {
-                    float* pcd_pixel = colors_indexer.GetDataPtr<float>(idx);
-                    float* image_pixel =
-                            image_colors_indexer.GetDataPtr<float>(x, y);
-                    *pcd_pixel = *image_pixel;
-                    *(pcd_pixel + 1) = *(image_pixel + 1);
-                    *(pcd_pixel + 2) = *(image_pixel + 2);
+            const scalar_t* vt = points_ptr + 3 * workload_idx;
+            const scalar_t* nt = normals_ptr + 3 * workload_idx;
+            const scalar_t* ct = colors_ptr + 3 * workload_idx;
+            const double it = (ct[0] + ct[1] + ct[2]) / 3.0;
+
+            // Normal equations of the least squares fit of the intensity
+            // differences to the neighbors projected on the tangent plane,
+            // accumulated in double.
+            double AtA[3][3] = {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}};
+            double Atb[3] = {0, 0, 0};
+            for (int64_t j = 0; j < count; ++j) {
+                const int64_t k = neighbors[j];
+                if (k == workload_idx) {
+                    continue;
+                }
+                const scalar_t* v = points_ptr + 3 * k;
+                const scalar_t* c = colors_ptr + 3 * k;
+                const double d = (v[0] - vt[0]) * nt[0] +
+                                 (v[1] - vt[1]) * nt[1] +
+                                 (v[2] - vt[2]) * nt[2];
+                const double a[3] = {v[0] - d * nt[0] - vt[0],
+                                     v[1] - d * nt[1] - vt[1],
+                                     v[2] - d * nt[2] - vt[2]};
+                const double b = (c[0] + c[1] + c[2]) / 3.0 - it;
+                for (int r = 0; r < 3; ++r) {
+                    for (int q = 0; q < 3; ++q) {
+                        AtA[r][q] += a[r] * a[q];
+                    }
+                    Atb[r] += a[r] * b;
                 }
             }
+            // Orthogonality constraint, weighted like the legacy ColoredICP.
+            const double w = double(count - 1) * double(count - 1);
+            for (int r = 0; r < 3; ++r) {
+                for (int q = 0; q < 3; ++q) {
+                    AtA[r][q] += w * nt[r] * nt[q];
+                }
+            }
+
+            // Cramer's rule.
+            const double det = Det3x3(AtA);
+            if (det == 0) {
+                return;
+            }
+            for (int r = 0; r < 3; ++r) {
+                double M[3][3];
+                for (int row = 0; row < 3; ++row) {
+                    for (int col = 0; col < 3; ++col) {
+                        M[row][col] = col == r ? Atb[row] : AtA[row][col];
+                    }
+                }
+                gradient[r] = static_cast<scalar_t>(Det3x3(M) / det);
+            }
         });
     });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
 #if defined(__CUDACC__)
-    int total_pts_count = count.Item<int>();
+void EstimateNormalsFromCovariancesCUDA
 #else
-    int total_pts_count = (*count_ptr).load();
+void EstimateNormalsFromCovariancesCPU
 #endif
+        (const core::Tensor& covariances,
+         core::Tensor& normals,
+         bool has_normals) {
+    const int64_t n = covariances.GetLength();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(covariances.GetDtype(), [&]() {
+        const scalar_t* covariances_ptr = covariances.GetDataPtr<scalar_t>();
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            double A[9];
+            for (int i = 0; i < 9; ++i) {
+                A[i] = covariances_ptr[9 * workload_idx + i];
+            }
+            double normal[3];
+            FastEigen3x3(A, normal);
+
+            scalar_t* out = normals_ptr + 3 * workload_idx;
+            if (normal[0] == 0 && normal[1] == 0 && normal[2] == 0) {
+                if (!has_normals) {
+                    out[0] = 0;
+                    out[1] = 0;
+                    out[2] = 1;
+                }
+                return;
+            }
+            double dot = normal[0] * out[0] + normal[1] * out[1] +
+                         normal[2] * out[2];
+            if (has_normals && dot < 0) {
+                normal[0] = -normal[0];
+                normal[1] = -normal[1];
+                normal[2] = -normal[2];
+            }
+            out[0] = static_cast<scalar_t>(normal[0]);
+            out[1] = static_cast<scalar_t>(normal[1]);
+            out[2] = static_cast<scalar_t>(normal[2]);
+        });
+    });
 
 #ifdef __CUDACC__
     OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
 #endif
-    points = points.Slice(0, 0, total_pts_count);
-    if (have_colors) {
-        colors.value().get() =
-                colors.value().get().Slice(0, 0, total_pts_count);
+}
+
+#if defined(__CUDACC__)
+void OrientNormalsToAlignWithDirectionCUDA
+#else
+void OrientNormalsToAlignWithDirectionCPU
+#endif
+        (core::Tensor& normals, const core::Tensor& direction) {
+    const int64_t n = normals.GetLength();
+    const double* direction_ptr = direction.GetDataPtr<double>();
+    const double dx = direction_ptr[0];
+    const double dy = direction_ptr[1];
+    const double dz = direction_ptr[2];
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(normals.GetDtype(), [&]() {
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            scalar_t* normal = normals_ptr + 3 * workload_idx;
+            if (normal[0] == 0 && normal[1] == 0 && normal[2] == 0) {
+                normal[0] = static_cast<scalar_t>(dx);
+                normal[1] = static_cast<scalar_t>(dy);
+                normal[2] = static_cast<scalar_t>(dz);
+            } else if (normal[0] * dx + normal[1] * dy + normal[2] * dz < 0) {
+                normal[0] = -normal[0];
+                normal[1] = -normal[1];
+                normal[2] = -normal[2];
+            }
+        });
+    });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
+#if defined(__CUDACC__)
+void OrientNormalsTowardsCameraLocationCUDA
+#else
+void OrientNormalsTowardsCameraLocationCPU
+#endif
+        (const core::Tensor& points,
+         core::Tensor& normals,
+         const core::Tensor& camera_location) {
+    const int64_t n = points.GetLength();
+    const double* camera_ptr = camera_location.GetDataPtr<double>();
+    const double cx = camera_ptr[0];
+    const double cy = camera_ptr[1];
+    const double cz = camera_ptr[2];
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const scalar_t* point = points_ptr + 3 * workload_idx;
+            scalar_t* normal = normals_ptr + 3 * workload_idx;
+            double rx = cx - point[0];
+            double ry = cy - point[1];
+            double rz = cz - point[2];
+            if (normal[0] == 0 && normal[1] == 0 && normal[2] == 0) {
+                double length = sqrt(rx * rx + ry * ry + rz * rz);
+                if (length == 0) {
+                    normal[2] = 1;
+                } else {
+                    normal[0] = static_cast<scalar_t>(rx / length);
+                    normal[1] = static_cast<scalar_t>(ry / length);
+                    normal[2] = static_cast<scalar_t>(rz / length);
+                }
+            } else if (normal[0] * rx + normal[1] * ry + normal[2] * rz < 0) {
+                normal[0] = -normal[0];
+                normal[1] = -normal[1];
+                normal[2] = -normal[2];
+            }
+        });
+    });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
+// Atomically sets *address to min(*address, value) for non-negative floats,
+// which are ordered like their bit patterns as signed integers.
+OPEN3D_HOST_DEVICE inline void AtomicMinNonNegativeFloat(float* address,
+                                                         float value) {
+#if defined(__CUDA_ARCH__)
+    atomicMin(reinterpret_cast<int*>(address), __float_as_int(value));
+#else
+    int bits;
+    std::memcpy(&bits, &value, sizeof(float));
+    auto* atomic_bits = reinterpret_cast<std::atomic<int>*>(address);
+    int old_bits = atomic_bits->load(std::memory_order_relaxed);
+    while (bits < old_bits &&
+           !atomic_bits->compare_exchange_weak(old_bits, bits,
+                                               std::memory_order_relaxed)) {
+    }
+#endif
+}
+
+#if defined(__CUDACC__)
+void SplatPointDepthsCUDA
+#else
+void SplatPointDepthsCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         float depth_max,
+         core::Tensor& pixel_indices,
+         core::Tensor& depths,
+         core::Tensor& depth_buffer) {
+    const int64_t n = points.GetLength();
+    TransformIndexer ti(intrinsics, extrinsics, 1.0f);
+    NDArrayIndexer depth_indexer(depth_buffer, 2);
+    const int64_t width = depth_indexer.GetShape(1);
+
+    int64_t* pixel_indices_ptr = pixel_indices.GetDataPtr<int64_t>();
+    float* depths_ptr = depths.GetDataPtr<float>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const scalar_t* point = points_ptr + 3 * workload_idx;
+            float xc, yc, zc, u, v;
+            ti.RigidTransform(static_cast<float>(point[0]),
+                              static_cast<float>(point[1]),
+                              static_cast<float>(point[2]), &xc, &yc, &zc);
+            ti.Project(xc, yc, zc, &u, &v);
+            if (zc <= 0 || zc > depth_max || !depth_indexer.InBoundary(u, v)) {
+                pixel_indices_ptr[workload_idx] = -1;
+                return;
+            }
+
+            int64_t x = static_cast<int64_t>(u);
+            int64_t y = static_cast<int64_t>(v);
+            pixel_indices_ptr[workload_idx] = y * width + x;
+            depths_ptr[workload_idx] = zc;
+            AtomicMinNonNegativeFloat(depth_indexer.GetDataPtr<float>(x, y),
+                                      zc);
+        });
+    });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
+#if defined(__CUDACC__)
+void TestPointOcclusionCUDA
+#else
+void TestPointOcclusionCPU
+#endif
+        (const core::Tensor& pixel_indices,
+         const core::Tensor& depths,
+         const core::Tensor& depth_level,
+         int64_t level,
+         int64_t width,
+         int64_t height,
+         int64_t splat_radius,
+         float depth_tolerance,
+         core::Tensor& visible) {
+    const int64_t n = pixel_indices.GetLength();
+    NDArrayIndexer level_indexer(depth_level, 2);
+
+    const int64_t* pixel_indices_ptr = pixel_indices.GetDataPtr<int64_t>();
+    const float* depths_ptr = depths.GetDataPtr<float>();
+    bool* visible_ptr = visible.GetDataPtr<bool>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const int64_t pixel_idx = pixel_indices_ptr[workload_idx];
+        if (pixel_idx < 0) {
+            visible_ptr[workload_idx] = false;
+            return;
+        }
+
+        // The cells of the level covering the splat of the point. The level
+        // is chosen such that there are at most 2 x 2 of them.
+        const int64_t x = pixel_idx % width;
+        const int64_t y = pixel_idx / width;
+        const int64_t x0 = (x > splat_radius ? x - splat_radius : 0) >> level;
+        const int64_t y0 = (y > splat_radius ? y - splat_radius : 0) >> level;
+        const int64_t x1 =
+                (x + splat_radius < width ? x + splat_radius : width - 1) >>
+                level;
+        const int64_t y1 =
+                (y + splat_radius < height ? y + splat_radius : height - 1) >>
+                level;
+
+        const float occluder_depth =
+                depths_ptr[workload_idx] * (1.0f - depth_tolerance);
+        bool is_visible = true;
+        for (int64_t yl = y0; yl <= y1; ++yl) {
+            for (int64_t xl = x0; xl <= x1; ++xl) {
+                if (*level_indexer.GetDataPtr<float>(xl, yl) <
+                    occluder_depth) {
+                    is_visible = false;
+                }
+            }
+        }
+        visible_ptr[workload_idx] = is_visible;
+    });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
+// Projects (x, y, z) to a view packed by the dispatcher of
+// SplatDepthsMultiView(): the rows of the 3 x 4 extrinsic matrix followed by
+// fx, fy, cx, cy. Returns false if the point is behind the camera or beyond
+// depth_max.
+OPEN3D_HOST_DEVICE inline bool ProjectToView(const float* view,
+                                             float x,
+                                             float y,
+                                             float z,
+                                             float depth_max,
+                                             float* u,
+                                             float* v,
+                                             float* d) {
+    const float zc = view[8] * x + view[9] * y + view[10] * z + view[11];
+    if (zc <= 0 || zc > depth_max) {
+        return false;
     }
+    const float xc = view[0] * x + view[1] * y + view[2] * z + view[3];
+    const float yc = view[4] * x + view[5] * y + view[6] * z + view[7];
+    const float inv_z = 1.0f / zc;
+    *u = view[12] * xc * inv_z + view[14];
+    *v = view[13] * yc * inv_z + view[15];
+    *d = zc;
+    return true;
 }
+
+#if defined(__CUDACC__)
+void SplatDepthsMultiViewCUDA
+#else
+void SplatDepthsMultiViewCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& views,
+         float depth_scale,
+         float depth_max,
+         int64_t splat_radius,
+         core::Tensor& depth) {
+    const int64_t n = points.GetLength();
+    const int64_t num_views = depth.GetShape(0);
+    const int64_t height = depth.GetShape(1);
+    const int64_t width = depth.GetShape(2);
+    const float* views_ptr = views.GetDataPtr<float>();
+    float* depth_ptr = depth.GetDataPtr<float>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(num_views * n, [=] OPEN3D_DEVICE(
+                                                     int64_t workload_idx) {
+            const int64_t view_idx = workload_idx / n;
+            const scalar_t* point = points_ptr + 3 * (workload_idx % n);
+            float u, v, d;
+            if (!ProjectToView(views_ptr + 16 * view_idx,
+                               static_cast<float>(point[0]),
+                               static_cast<float>(point[1]),
+                               static_cast<float>(point[2]), depth_max, &u, &v,
+                               &d)) {
+                return;
+            }
+            d *= depth_scale;
+
+            // The splat covers the pixels within splat_radius of the pixel of
+            // the projection.
+            float* view_depth_ptr = depth_ptr + view_idx * height * width;
+            const int64_t x = static_cast<int64_t>(floorf(u));
+            const int64_t y = static_cast<int64_t>(floorf(v));
+            for (int64_t dy = -splat_radius; dy <= splat_radius; ++dy) {
+                for (int64_t dx = -splat_radius; dx <= splat_radius; ++dx) {
+                    if (dx * dx + dy * dy > splat_radius * splat_radius ||
+                        x + dx < 0 || x + dx >= width || y + dy < 0 ||
+                        y + dy >= height) {
+                        continue;
+                    }
+                    AtomicMinNonNegativeFloat(
+                            view_depth_ptr + (y + dy) * width + x + dx, d);
+                }
+            }
+        });
+    });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
+#if defined(__CUDACC__)
+void AccumulateSplatsMultiViewCUDA
+#else
+void AccumulateSplatsMultiViewCPU
+#endif
+        (const core::Tensor& points,
+         utility::optional<std::reference_wrapper<const core::Tensor>> colors,
+         const core::Tensor& views,
+         float depth_scale,
+         float depth_max,
+         int64_t splat_radius,
+         float depth_tolerance,
+         const core::Tensor& depth,
+         core::Tensor& sums) {
+    const bool have_colors = colors.has_value();
+    const int64_t n = points.GetLength();
+    const int64_t num_views = depth.GetShape(0);
+    const int64_t height = depth.GetShape(1);
+    const int64_t width = depth.GetShape(2);
+    const int64_t sum_size = sums.GetShape(3);
+    const float* views_ptr = views.GetDataPtr<float>();
+    const float* depth_ptr = depth.GetDataPtr<float>();
+    const float* colors_ptr =
+            have_colors ? colors.value().get().GetDataPtr<float>() : nullptr;
+    float* sums_ptr = sums.GetDataPtr<float>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(num_views * n, [=] OPEN3D_DEVICE(
+                                                     int64_t workload_idx) {
+            const int64_t view_idx = workload_idx / n;
+            const int64_t point_idx = workload_idx % n;
+            const scalar_t* point = points_ptr + 3 * point_idx;
+            float u, v, d;
+            if (!ProjectToView(views_ptr + 16 * view_idx,
+                               static_cast<float>(point[0]),
+                               static_cast<float>(point[1]),
+                               static_cast<float>(point[2]), depth_max, &u, &v,
+                               &d)) {
+                return;
+            }
+            d *= depth_scale;
+
+            const int64_t pixel_offset = view_idx * height * width;
+            const int64_t x = static_cast<int64_t>(floorf(u));
+            const int64_t y = static_cast<int64_t>(floorf(v));
+            for (int64_t dy = -splat_radius; dy <= splat_radius; ++dy) {
+                for (int64_t dx = -splat_radius; dx <= splat_radius; ++dx) {
+                    if (dx * dx + dy * dy > splat_radius * splat_radius ||
+                        x + dx < 0 || x + dx >= width || y + dy < 0 ||
+                        y + dy >= height) {
+                        continue;
+                    }
+                    // Only the splats within the tolerance of the nearest one
+                    // contribute to the pixel.
+                    const int64_t pixel_idx =
+                            pixel_offset + (y + dy) * width + x + dx;
+                    if (d > depth_ptr[pixel_idx] * (1.0f + depth_tolerance)) {
+                        continue;
+                    }
+
+                    // Layout of a sum: depth, [r, g, b,] count.
+                    float* sum = sums_ptr + pixel_idx * sum_size;
+                    AtomicAddFloat(sum + 0, d);
+                    if (have_colors) {
+                        const float* color = colors_ptr + 3 * point_idx;
+                        AtomicAddFloat(sum + 1, color[0]);
+                        AtomicAddFloat(sum + 2, color[1]);
+                        AtomicAddFloat(sum + 3, color[2]);
+                    }
+                    AtomicAddFloat(sum + sum_size - 1, 1.0f);
+                }
+            }
+        });
+    });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
+#if defined(__CUDACC__)
+void ResolveSplatsMultiViewCUDA
+#else
+void ResolveSplatsMultiViewCPU
+#endif
+        (utility::optional<std::reference_wrapper<const core::Tensor>> sums,
+         bool average_depth,
+         core::Tensor& depth,
+         utility::optional<std::reference_wrapper<core::Tensor>>
+                 image_colors) {
+    const bool have_sums = sums.has_value();
+    const bool have_colors = image_colors.has_value();
+    const int64_t num_pixels =
+            depth.GetShape(0) * depth.GetShape(1) * depth.GetShape(2);
+    const int64_t sum_size = have_sums ? sums.value().get().GetShape(3) : 0;
+    const float* sums_ptr =
+            have_sums ? sums.value().get().GetDataPtr<float>() : nullptr;
+    float* depth_ptr = depth.GetDataPtr<float>();
+    uint8_t* image_colors_ptr =
+            have_colors ? image_colors.value().get().GetDataPtr<uint8_t>()
+                        : nullptr;
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    using std::isinf;
+#endif
+
+    launcher::ParallelFor(num_pixels, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        float* d = depth_ptr + workload_idx;
+        const float* sum =
+                have_sums ? sums_ptr + workload_idx * sum_size : nullptr;
+        float count = have_sums ? sum[sum_size - 1] : 0;
+        if (isinf(*d) || (have_sums && count == 0)) {
+            *d = 0;
+            count = 0;
+        } else if (average_depth) {
+            *d = sum[0] / count;
+        }
+        if (have_colors) {
+            uint8_t* color = image_colors_ptr + 3 * workload_idx;
+            for (int c = 0; c < 3; ++c) {
+                const float value =
+                        count > 0 ? 255.0f * sum[c + 1] / count : 0.0f;
+                color[c] = static_cast<uint8_t>(
+                        value < 0 ? 0 : (value > 255 ? 255 : value));
+            }
+        }
+    });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
+/// Eigen decomposition of the symmetric row-major matrix A with cyclic Jacobi
+/// rotations, which unlike FastEigen3x3 gives all eigenvectors accurately.
+/// The eigenvalues are sorted in decreasing order and the eigenvectors are the
+/// columns of the row-major evecs. A is overwritten.
+OPEN3D_HOST_DEVICE inline void JacobiEigen3x3(double* A,
+                                              double* evals,
+                                              double* evecs) {
+    for (int i = 0; i < 9; ++i) {
+        evecs[i] = (i % 4 == 0) ? 1 : 0;
+    }
+    for (int sweep = 0; sweep < 32; ++sweep) {
+        bool rotated = false;
+        for (int p = 0; p < 2; ++p) {
+            for (int q = p + 1; q < 3; ++q) {
+                const double a_pq = A[3 * p + q];
+                const double a_pp = A[3 * p + p];
+                const double a_qq = A[3 * q + q];
+                if (fabs(a_pq) <= 1e-15 * (fabs(a_pp) + fabs(a_qq))) {
+                    continue;
+                }
+                rotated = true;
+                const double theta = (a_qq - a_pp) / (2 * a_pq);
+                const double t = (theta >= 0 ? 1 : -1) /
+                                 (fabs(theta) + sqrt(theta * theta + 1));
+                const double c = 1 / sqrt(t * t + 1);
+                const double s = t * c;
+                for (int k = 0; k < 3; ++k) {
+                    const double a_kp = A[3 * k + p];
+                    const double a_kq = A[3 * k + q];
+                    A[3 * k + p] = c * a_kp - s * a_kq;
+                    A[3 * k + q] = s * a_kp + c * a_kq;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    const double a_pk = A[3 * p + k];
+                    const double a_qk = A[3 * q + k];
+                    A[3 * p + k] = c * a_pk - s * a_qk;
+                    A[3 * q + k] = s * a_pk + c * a_qk;
+                }
+                for (int k = 0; k < 3; ++k) {
+                    const double v_kp = evecs[3 * k + p];
+                    const double v_kq = evecs[3 * k + q];
+                    evecs[3 * k + p] = c * v_kp - s * v_kq;
+                    evecs[3 * k + q] = s * v_kp + c * v_kq;
+                }
+            }
+        }
+        if (!rotated) {
+            break;
+        }
+    }
+
+    evals[0] = A[0];
+    evals[1] = A[4];
+    evals[2] = A[8];
+    for (int i = 0; i < 2; ++i) {
+        for (int j = i + 1; j < 3; ++j) {
+            if (evals[j] > evals[i]) {
+                const double tmp = evals[i];
+                evals[i] = evals[j];
+                evals[j] = tmp;
+                for (int k = 0; k < 3; ++k) {
+                    const double v = evecs[3 * k + i];
+                    evecs[3 * k + i] = evecs[3 * k + j];
+                    evecs[3 * k + j] = v;
+                }
+            }
+        }
+    }
+}
+
+#if defined(__CUDACC__)
+void ComputeOrientedBoundingBoxesCUDA
+#else
+void ComputeOrientedBoundingBoxesCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& offsets,
+         core::Tensor& centers,
+         core::Tensor& rotations,
+         core::Tensor& extents) {
+    const int64_t n = offsets.GetLength() - 1;
+    if (n == 0) {
+        return;
+    }
+    const int64_t* offsets_ptr = offsets.GetDataPtr<int64_t>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        scalar_t* centers_ptr = centers.GetDataPtr<scalar_t>();
+        scalar_t* rotations_ptr = rotations.GetDataPtr<scalar_t>();
+        scalar_t* extents_ptr = extents.GetDataPtr<scalar_t>();
+
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int64_t begin = offsets_ptr[workload_idx];
+            const int64_t end = offsets_ptr[workload_idx + 1];
+            scalar_t* center = centers_ptr + 3 * workload_idx;
+            scalar_t* R = rotations_ptr + 9 * workload_idx;
+            scalar_t* extent = extents_ptr + 3 * workload_idx;
+            if (begin == end) {
+                for (int i = 0; i < 9; ++i) {
+                    R[i] = (i % 4 == 0) ? 1 : 0;
+                }
+                for (int i = 0; i < 3; ++i) {
+                    center[i] = 0;
+                    extent[i] = 0;
+                }
+                return;
+            }
+
+            // Mean and covariance from the cumulants, as in
+            // utility::ComputeMeanAndCovariance.
+            double cumulants[9] = {0};
+            for (int64_t idx = begin; idx < end; ++idx) {
+                const scalar_t* p = points_ptr + 3 * idx;
+                const double x = p[0], y = p[1], z = p[2];
+                cumulants[0] += x;
+                cumulants[1] += y;
+                cumulants[2] += z;
+                cumulants[3] += x * x;
+                cumulants[4] += x * y;
+                cumulants[5] += x * z;
+                cumulants[6] += y * y;
+                cumulants[7] += y * z;
+                cumulants[8] += z * z;
+            }
+            const double num_points = static_cast<double>(end - begin);
+            for (int i = 0; i < 9; ++i) {
+                cumulants[i] /= num_points;
+            }
+            const double* mean = cumulants;
+            double cov[9];
+            cov[0] = cumulants[3] - mean[0] * mean[0];
+            cov[1] = cumulants[4] - mean[0] * mean[1];
+            cov[2] = cumulants[5] - mean[0] * mean[2];
+            cov[4] = cumulants[6] - mean[1] * mean[1];
+            cov[5] = cumulants[7] - mean[1] * mean[2];
+            cov[8] = cumulants[8] - mean[2] * mean[2];
+            cov[3] = cov[1];
+            cov[6] = cov[2];
+            cov[7] = cov[5];
+
+            double evals[3], axes[9];
+            JacobiEigen3x3(cov, evals, axes);
+
+            // Bounds of the points along the axes.
+            double min_bound[3], max_bound[3];
+            for (int64_t idx = begin; idx < end; ++idx) {
+                const scalar_t* p = points_ptr + 3 * idx;
+                const double d[3] = {p[0] - mean[0], p[1] - mean[1],
+                                     p[2] - mean[2]};
+                for (int i = 0; i < 3; ++i) {
+                    const double coord = axes[i] * d[0] + axes[3 + i] * d[1] +
+                                         axes[6 + i] * d[2];
+                    if (idx == begin || coord < min_bound[i]) {
+                        min_bound[i] = coord;
+                    }
+                    if (idx == begin || coord > max_bound[i]) {
+                        max_bound[i] = coord;
+                    }
+                }
+            }
+
+            double mid[3];
+            for (int i = 0; i < 3; ++i) {
+                mid[i] = (min_bound[i] + max_bound[i]) * 0.5;
+                extent[i] = static_cast<scalar_t>(max_bound[i] - min_bound[i]);
+            }
+            for (int i = 0; i < 3; ++i) {
+                center[i] = static_cast<scalar_t>(
+                        mean[i] + axes[3 * i] * mid[0] +
+                        axes[3 * i + 1] * mid[1] + axes[3 * i + 2] * mid[2]);
+            }
+            for (int i = 0; i < 9; ++i) {
+                R[i] = static_cast<scalar_t>(axes[i]);
+            }
+        });
+    });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
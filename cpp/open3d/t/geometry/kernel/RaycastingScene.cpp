@@ -0,0 +1,348 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/RaycastingScene.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace raycasting_scene {
+
+namespace {
+
+// Maximal number of triangles in a leaf.
+const int64_t kLeafSize = 4;
+
+void AssertBVH(const core::Tensor& node_bounds,
+               const core::Tensor& node_children,
+               const core::Tensor& triangle_vertices,
+               const core::Tensor& queries,
+               int64_t query_dim) {
+    node_bounds.AssertShapeCompatible({utility::nullopt, 6});
+    node_bounds.AssertDtype(core::Dtype::Float32);
+    node_children.AssertShape({node_bounds.GetLength(), 2});
+    node_children.AssertDtype(core::Dtype::Int32);
+    triangle_vertices.AssertShapeCompatible({utility::nullopt, 9});
+    triangle_vertices.AssertDtype(core::Dtype::Float32);
+    queries.AssertShapeCompatible({utility::nullopt, query_dim});
+    queries.AssertDtype(core::Dtype::Float32);
+
+    core::Device device = queries.GetDevice();
+    node_bounds.AssertDevice(device);
+    node_children.AssertDevice(device);
+    triangle_vertices.AssertDevice(device);
+}
+
+// Number of bins per axis of the surface area heuristic.
+const int kNumSAHBins = 16;
+
+void GrowBox(float* box, const float* other) {
+    for (int d = 0; d < 3; ++d) {
+        box[d] = std::min(box[d], other[d]);
+        box[d + 3] = std::max(box[d + 3], other[d + 3]);
+    }
+}
+
+float HalfSurfaceArea(const float* box) {
+    const float dx = box[3] - box[0];
+    const float dy = box[4] - box[1];
+    const float dz = box[5] - box[2];
+    return dx * dy + dy * dz + dz * dx;
+}
+
+// Partitions the n triangles in order at the best of the planes between
+// kNumSAHBins bins of the centroids along each axis according to the surface
+// area heuristic. Returns the number of triangles of the left child, or -1 if
+// no plane separates the triangles.
+int64_t PartitionSAH(const float* vertices,
+                     const float* centroids,
+                     const float* centroid_box,
+                     int64_t* order,
+                     int64_t n) {
+    const float empty_box[6] = {std::numeric_limits<float>::max(),
+                                std::numeric_limits<float>::max(),
+                                std::numeric_limits<float>::max(),
+                                std::numeric_limits<float>::lowest(),
+                                std::numeric_limits<float>::lowest(),
+                                std::numeric_limits<float>::lowest()};
+    auto bin_of = [&](int64_t t, int axis) {
+        const float extent = centroid_box[axis + 3] - centroid_box[axis];
+        const int bin = static_cast<int>((centroids[3 * t + axis] -
+                                          centroid_box[axis]) /
+                                         extent * kNumSAHBins);
+        return std::min(bin, kNumSAHBins - 1);
+    };
+
+    float best_cost = std::numeric_limits<float>::max();
+    int best_axis = -1;
+    int best_bin = -1;
+    for (int axis = 0; axis < 3; ++axis) {
+        if (!(centroid_box[axis + 3] > centroid_box[axis])) {
+            continue;
+        }
+        float boxes[kNumSAHBins][6];
+        int64_t counts[kNumSAHBins] = {};
+        for (int b = 0; b < kNumSAHBins; ++b) {
+            std::copy(empty_box, empty_box + 6, boxes[b]);
+        }
+        for (int64_t i = 0; i < n; ++i) {
+            const int b = bin_of(order[i], axis);
+            const float* v = vertices + 9 * order[i];
+            for (int k = 0; k < 3; ++k) {
+                const float point_box[6] = {v[3 * k],     v[3 * k + 1],
+                                            v[3 * k + 2], v[3 * k],
+                                            v[3 * k + 1], v[3 * k + 2]};
+                GrowBox(boxes[b], point_box);
+            }
+            ++counts[b];
+        }
+
+        // Areas and counts of the triangles right of the planes.
+        float right_areas[kNumSAHBins];
+        int64_t right_counts[kNumSAHBins];
+        float box[6];
+        std::copy(empty_box, empty_box + 6, box);
+        int64_t count = 0;
+        for (int b = kNumSAHBins - 1; b > 0; --b) {
+            GrowBox(box, boxes[b]);
+            count += counts[b];
+            right_areas[b] = count > 0 ? HalfSurfaceArea(box) : 0;
+            right_counts[b] = count;
+        }
+        std::copy(empty_box, empty_box + 6, box);
+        count = 0;
+        for (int b = 0; b < kNumSAHBins - 1; ++b) {
+            GrowBox(box, boxes[b]);
+            count += counts[b];
+            if (count == 0 || right_counts[b + 1] == 0) {
+                continue;
+            }
+            const float cost = count * HalfSurfaceArea(box) +
+                               right_counts[b + 1] * right_areas[b + 1];
+            if (cost < best_cost) {
+                best_cost = cost;
+                best_axis = axis;
+                best_bin = b;
+            }
+        }
+    }
+    if (best_axis < 0) {
+        return -1;
+    }
+    return std::partition(order, order + n,
+                          [&](int64_t t) {
+                              return bin_of(t, best_axis) <= best_bin;
+                          }) -
+           order;
+}
+
+}  // namespace
+
+void BuildBVH(const core::Tensor& triangle_vertices,
+              core::Tensor& node_bounds,
+              core::Tensor& node_children,
+              core::Tensor& triangle_order,
+              bool sah_split) {
+    triangle_vertices.AssertShapeCompatible({utility::nullopt, 9});
+    triangle_vertices.AssertDtype(core::Dtype::Float32);
+    triangle_vertices.AssertDevice(core::Device("CPU:0"));
+    core::Tensor vertices_c = triangle_vertices.Contiguous();
+    const float* vertices_ptr = vertices_c.GetDataPtr<float>();
+    const int64_t n = vertices_c.GetLength();
+
+    std::vector<float> centroids(3 * n);
+    for (int64_t i = 0; i < n; ++i) {
+        for (int d = 0; d < 3; ++d) {
+            centroids[3 * i + d] = (vertices_ptr[9 * i + d] +
+                                    vertices_ptr[9 * i + 3 + d] +
+                                    vertices_ptr[9 * i + 6 + d]) /
+                                   3.0f;
+        }
+    }
+
+    std::vector<int64_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<float> bounds;
+    std::vector<int> children;
+    std::function<int(int64_t, int64_t)> build = [&](int64_t begin,
+                                                    int64_t end) {
+        const int node = static_cast<int>(children.size() / 2);
+        float box[6], centroid_box[6];
+        for (int d = 0; d < 3; ++d) {
+            box[d] = centroid_box[d] = std::numeric_limits<float>::max();
+            box[d + 3] = centroid_box[d + 3] =
+                    std::numeric_limits<float>::lowest();
+        }
+        for (int64_t i = begin; i < end; ++i) {
+            const float* v = vertices_ptr + 9 * order[i];
+            const float* c = centroids.data() + 3 * order[i];
+            for (int d = 0; d < 3; ++d) {
+                box[d] = std::min({box[d], v[d], v[d + 3], v[d + 6]});
+                box[d + 3] = std::max({box[d + 3], v[d], v[d + 3], v[d + 6]});
+                centroid_box[d] = std::min(centroid_box[d], c[d]);
+                centroid_box[d + 3] = std::max(centroid_box[d + 3], c[d]);
+            }
+        }
+        bounds.insert(bounds.end(), box, box + 6);
+        children.insert(children.end(), {-1 - static_cast<int>(begin),
+                                          static_cast<int>(end - begin)});
+        if (end - begin <= kLeafSize) {
+            return node;
+        }
+
+        int64_t mid = -1;
+        if (sah_split) {
+            const int64_t num_left =
+                    PartitionSAH(vertices_ptr, centroids.data(), centroid_box,
+                                 order.data() + begin, end - begin);
+            if (num_left >= 0) {
+                mid = begin + num_left;
+            }
+        }
+        if (mid < 0) {
+            int axis = 0;
+            for (int d = 1; d < 3; ++d) {
+                if (centroid_box[d + 3] - centroid_box[d] >
+                    centroid_box[axis + 3] - centroid_box[axis]) {
+                    axis = d;
+                }
+            }
+            mid = (begin + end) / 2;
+            std::nth_element(order.begin() + begin, order.begin() + mid,
+                             order.begin() + end, [&](int64_t a, int64_t b) {
+                                 return centroids[3 * a + axis] <
+                                        centroids[3 * b + axis];
+                             });
+        }
+        const int left = build(begin, mid);
+        const int right = build(mid, end);
+        children[2 * node] = left;
+        children[2 * node + 1] = right;
+        return node;
+    };
+    if (n > 0) {
+        build(0, n);
+    }
+
+    const int64_t m = static_cast<int64_t>(children.size() / 2);
+    node_bounds = core::Tensor(bounds, {m, 6}, core::Dtype::Float32);
+    node_children = core::Tensor(children, {m, 2}, core::Dtype::Int32);
+    triangle_order = core::Tensor(order, {n}, core::Dtype::Int64);
+}
+
+void CastRays(const core::Tensor& node_bounds,
+              const core::Tensor& node_children,
+              const core::Tensor& triangle_vertices,
+              const core::Tensor& rays,
+              core::Tensor& t_hit,
+              core::Tensor& triangle_indices,
+              core::Tensor& primitive_uvs,
+              core::Tensor& primitive_normals) {
+    AssertBVH(node_bounds, node_children, triangle_vertices, rays, 6);
+    core::Tensor node_bounds_c = node_bounds.Contiguous();
+    core::Tensor node_children_c = node_children.Contiguous();
+    core::Tensor triangle_vertices_c = triangle_vertices.Contiguous();
+    core::Tensor rays_c = rays.Contiguous();
+
+    core::Device::DeviceType device_type = rays.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        CastRaysCPU(node_bounds_c, node_children_c, triangle_vertices_c,
+                    rays_c, t_hit, triangle_indices, primitive_uvs,
+                    primitive_normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(CastRaysCUDA, node_bounds_c, node_children_c,
+                  triangle_vertices_c, rays_c, t_hit, triangle_indices,
+                  primitive_uvs, primitive_normals);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void CountIntersections(const core::Tensor& node_bounds,
+                        const core::Tensor& node_children,
+                        const core::Tensor& triangle_vertices,
+                        const core::Tensor& rays,
+                        core::Tensor& intersections) {
+    AssertBVH(node_bounds, node_children, triangle_vertices, rays, 6);
+    core::Tensor node_bounds_c = node_bounds.Contiguous();
+    core::Tensor node_children_c = node_children.Contiguous();
+    core::Tensor triangle_vertices_c = triangle_vertices.Contiguous();
+    core::Tensor rays_c = rays.Contiguous();
+
+    core::Device::DeviceType device_type = rays.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        CountIntersectionsCPU(node_bounds_c, node_children_c,
+                              triangle_vertices_c, rays_c, intersections);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(CountIntersectionsCUDA, node_bounds_c, node_children_c,
+                  triangle_vertices_c, rays_c, intersections);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeClosestPoints(const core::Tensor& node_bounds,
+                          const core::Tensor& node_children,
+                          const core::Tensor& triangle_vertices,
+                          const core::Tensor& query_points,
+                          core::Tensor& closest_points,
+                          core::Tensor& triangle_indices) {
+    AssertBVH(node_bounds, node_children, triangle_vertices, query_points, 3);
+    core::Tensor node_bounds_c = node_bounds.Contiguous();
+    core::Tensor node_children_c = node_children.Contiguous();
+    core::Tensor triangle_vertices_c = triangle_vertices.Contiguous();
+    core::Tensor query_points_c = query_points.Contiguous();
+
+    core::Device::DeviceType device_type = query_points.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeClosestPointsCPU(node_bounds_c, node_children_c,
+                                triangle_vertices_c, query_points_c,
+                                closest_points, triangle_indices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeClosestPointsCUDA, node_bounds_c, node_children_c,
+                  triangle_vertices_c, query_points_c, closest_points,
+                  triangle_indices);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace raycasting_scene
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace raycasting_scene {
+
+/// Builds a bounding volume hierarchy over triangles on the host, splitting
+/// the triangles recursively at the median centroid along the longest axis,
+/// or with the binned surface area heuristic if \p sah_split is true, which
+/// takes longer to build but speeds up the queries.
+///
+/// \param triangle_vertices Float32 CPU tensor {n, 9}, the three vertices of
+/// each triangle.
+/// \param node_bounds Output Float32 tensor {m, 6}, the min and max corners
+/// of the node boxes. Node 0 is the root.
+/// \param node_children Output Int32 tensor {m, 2}. Inner nodes store their
+/// two child nodes, leaves store (-1 - first, count) of their triangles in
+/// \p triangle_order.
+/// \param triangle_order Output Int64 tensor {n}, the triangles sorted by
+/// leaf.
+void BuildBVH(const core::Tensor& triangle_vertices,
+              core::Tensor& node_bounds,
+              core::Tensor& node_children,
+              core::Tensor& triangle_order,
+              bool sah_split = false);
+
+/// Computes the first intersection of rays {n, 6} with the triangles {t, 9}
+/// of a BVH from BuildBVH(), ordered as the leaves expect. Outputs the hit
+/// distances {n}, infinite for a miss, the hit triangle indices {n} (Int64,
+/// -1 for a miss), the barycentric coordinates {n, 2} and the normalized
+/// geometric normals {n, 3}.
+void CastRays(const core::Tensor& node_bounds,
+              const core::Tensor& node_children,
+              const core::Tensor& triangle_vertices,
+              const core::Tensor& rays,
+              core::Tensor& t_hit,
+              core::Tensor& triangle_indices,
+              core::Tensor& primitive_uvs,
+              core::Tensor& primitive_normals);
+
+/// Counts the intersections {n} (Int32) of rays {n, 6} with the triangles.
+/// Hits at the same distance, e.g. on an edge shared by two triangles, are
+/// counted once.
+void CountIntersections(const core::Tensor& node_bounds,
+                        const core::Tensor& node_children,
+                        const core::Tensor& triangle_vertices,
+                        const core::Tensor& rays,
+                        core::Tensor& intersections);
+
+/// Computes the closest points {n, 3} on the triangles to query points
+/// {n, 3}, and the indices {n} (Int64) of their triangles, -1 without
+/// triangles.
+void ComputeClosestPoints(const core::Tensor& node_bounds,
+                          const core::Tensor& node_children,
+                          const core::Tensor& triangle_vertices,
+                          const core::Tensor& query_points,
+                          core::Tensor& closest_points,
+                          core::Tensor& triangle_indices);
+
+void CastRaysCPU(const core::Tensor& node_bounds,
+                 const core::Tensor& node_children,
+                 const core::Tensor& triangle_vertices,
+                 const core::Tensor& rays,
+                 core::Tensor& t_hit,
+                 core::Tensor& triangle_indices,
+                 core::Tensor& primitive_uvs,
+                 core::Tensor& primitive_normals);
+
+void CountIntersectionsCPU(const core::Tensor& node_bounds,
+                           const core::Tensor& node_children,
+                           const core::Tensor& triangle_vertices,
+                           const core::Tensor& rays,
+                           core::Tensor& intersections);
+
+void ComputeClosestPointsCPU(const core::Tensor& node_bounds,
+                             const core::Tensor& node_children,
+                             const core::Tensor& triangle_vertices,
+                             const core::Tensor& query_points,
+                             core::Tensor& closest_points,
+                             core::Tensor& triangle_indices);
+
+#ifdef BUILD_CUDA_MODULE
+void CastRaysCUDA(const core::Tensor& node_bounds,
+                  const core::Tensor& node_children,
+                  const core::Tensor& triangle_vertices,
+                  const core::Tensor& rays,
+                  core::Tensor& t_hit,
+                  core::Tensor& triangle_indices,
+                  core::Tensor& primitive_uvs,
+                  core::Tensor& primitive_normals);
+
+void CountIntersectionsCUDA(const core::Tensor& node_bounds,
+                            const core::Tensor& node_children,
+                            const core::Tensor& triangle_vertices,
+                            const core::Tensor& rays,
+                            core::Tensor& intersections);
+
+void ComputeClosestPointsCUDA(const core::Tensor& node_bounds,
+                              const core::Tensor& node_children,
+                              const core::Tensor& triangle_vertices,
+                              const core::Tensor& query_points,
+                              core::Tensor& closest_points,
+                              core::Tensor& triangle_indices);
+#endif
+
+}  // namespace raycasting_scene
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,438 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <limits>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/RaycastingScene.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace raycasting_scene {
+
+// Depth of the traversal stacks, BuildBVH() trees are balanced.
+#define BVH_STACK_SIZE 64
+// Number of recent hits kept per ray to count hits at the same distance once.
+#define COUNT_HISTORY_SIZE 8
+
+/// Entry and exit distances of a ray in the node box \p b, false if the ray
+/// misses the box before \p t_max.
+OPEN3D_HOST_DEVICE inline bool IntersectBox(const float* b,
+                                            const float* o,
+                                            const float* inv_d,
+                                            float t_max) {
+    float t0 = 0, t1 = t_max;
+    for (int i = 0; i < 3; ++i) {
+        float t_near = (b[i] - o[i]) * inv_d[i];
+        float t_far = (b[i + 3] - o[i]) * inv_d[i];
+        if (t_near > t_far) {
+            float tmp = t_near;
+            t_near = t_far;
+            t_far = tmp;
+        }
+        // NaNs from origins on a slab with a zero direction are ignored.
+        t0 = t_near > t0 ? t_near : t0;
+        t1 = t_far < t1 ? t_far : t1;
+        if (t0 > t1) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Squared distance of point \p p to the node box \p b.
+OPEN3D_HOST_DEVICE inline float BoxDistance2(const float* b, const float* p) {
+    float d2 = 0;
+    for (int i = 0; i < 3; ++i) {
+        float d = b[i] - p[i];
+        d = d > p[i] - b[i + 3] ? d : p[i] - b[i + 3];
+        d = d > 0 ? d : 0;
+        d2 += d * d;
+    }
+    return d2;
+}
+
+OPEN3D_HOST_DEVICE inline void Cross(const float* a,
+                                     const float* b,
+                                     float* c) {
+    c[0] = a[1] * b[2] - a[2] * b[1];
+    c[1] = a[2] * b[0] - a[0] * b[2];
+    c[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+OPEN3D_HOST_DEVICE inline float Dot(const float* a, const float* b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+/// Moeller-Trumbore intersection of a ray with the triangle \p v. The hit
+/// point is (1 - u - w) * v0 + u * v1 + w * v2.
+OPEN3D_HOST_DEVICE inline bool IntersectTriangle(const float* v,
+                                                 const float* o,
+                                                 const float* d,
+                                                 float* t,
+                                                 float* u,
+                                                 float* w) {
+    const float e1[3] = {v[3] - v[0], v[4] - v[1], v[5] - v[2]};
+    const float e2[3] = {v[6] - v[0], v[7] - v[1], v[8] - v[2]};
+    float p[3], q[3];
+    Cross(d, e2, p);
+    const float det = Dot(e1, p);
+    if (det == 0) {
+        return false;
+    }
+    const float inv_det = 1.0f / det;
+    const float s[3] = {o[0] - v[0], o[1] - v[1], o[2] - v[2]};
+    *u = Dot(s, p) * inv_det;
+    if (*u < 0 || *u > 1) {
+        return false;
+    }
+    Cross(s, e1, q);
+    *w = Dot(d, q) * inv_det;
+    if (*w < 0 || *u + *w > 1) {
+        return false;
+    }
+    *t = Dot(e2, q) * inv_det;
+    return *t >= 0;
+}
+
+/// Closest point \p c on the triangle \p v to point \p p, following
+/// Ericson, Real-Time Collision Detection, 5.1.5.
+OPEN3D_HOST_DEVICE inline void ClosestPointTriangle(const float* p,
+                                                    const float* v,
+                                                    float* c) {
+    const float* a = v;
+    const float* b = v + 3;
+    const float* cc = v + 6;
+    const float ab[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+    const float ac[3] = {cc[0] - a[0], cc[1] - a[1], cc[2] - a[2]};
+    const float ap[3] = {p[0] - a[0], p[1] - a[1], p[2] - a[2]};
+    const float d1 = Dot(ab, ap);
+    const float d2 = Dot(ac, ap);
+    if (d1 <= 0 && d2 <= 0) {
+        c[0] = a[0], c[1] = a[1], c[2] = a[2];
+        return;
+    }
+
+    const float bp[3] = {p[0] - b[0], p[1] - b[1], p[2] - b[2]};
+    const float d3 = Dot(ab, bp);
+    const float d4 = Dot(ac, bp);
+    if (d3 >= 0 && d4 <= d3) {
+        c[0] = b[0], c[1] = b[1], c[2] = b[2];
+        return;
+    }
+
+    const float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        const float s = d1 / (d1 - d3);
+        for (int i = 0; i < 3; ++i) c[i] = a[i] + s * ab[i];
+        return;
+    }
+
+    const float cp[3] = {p[0] - cc[0], p[1] - cc[1], p[2] - cc[2]};
+    const float d5 = Dot(ab, cp);
+    const float d6 = Dot(ac, cp);
+    if (d6 >= 0 && d5 <= d6) {
+        c[0] = cc[0], c[1] = cc[1], c[2] = cc[2];
+        return;
+    }
+
+    const float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        const float s = d2 / (d2 - d6);
+        for (int i = 0; i < 3; ++i) c[i] = a[i] + s * ac[i];
+        return;
+    }
+
+    const float va = d3 * d6 - d5 * d4;
+    if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+        const float s = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        for (int i = 0; i < 3; ++i) c[i] = b[i] + s * (cc[i] - b[i]);
+        return;
+    }
+
+    const float denom = 1.0f / (va + vb + vc);
+    const float s = vb * denom;
+    const float t = vc * denom;
+    for (int i = 0; i < 3; ++i) c[i] = a[i] + s * ab[i] + t * ac[i];
+}
+
+#if defined(__CUDACC__)
+void CastRaysCUDA
+#else
+void CastRaysCPU
+#endif
+        (const core::Tensor& node_bounds,
+         const core::Tensor& node_children,
+         const core::Tensor& triangle_vertices,
+         const core::Tensor& rays,
+         core::Tensor& t_hit,
+         core::Tensor& triangle_indices,
+         core::Tensor& primitive_uvs,
+         core::Tensor& primitive_normals) {
+    const core::Device device = rays.GetDevice();
+    const int64_t n = rays.GetLength();
+    t_hit = core::Tensor({n}, core::Dtype::Float32, device);
+    triangle_indices = core::Tensor({n}, core::Dtype::Int64, device);
+    primitive_uvs = core::Tensor({n, 2}, core::Dtype::Float32, device);
+    primitive_normals = core::Tensor({n, 3}, core::Dtype::Float32, device);
+
+    const float* bounds_ptr = node_bounds.GetDataPtr<float>();
+    const int* children_ptr = node_children.GetDataPtr<int>();
+    const float* vertices_ptr = triangle_vertices.GetDataPtr<float>();
+    const float* rays_ptr = rays.GetDataPtr<float>();
+    float* t_hit_ptr = t_hit.GetDataPtr<float>();
+    int64_t* triangle_indices_ptr = triangle_indices.GetDataPtr<int64_t>();
+    float* uvs_ptr = primitive_uvs.GetDataPtr<float>();
+    float* normals_ptr = primitive_normals.GetDataPtr<float>();
+    const bool empty = node_bounds.GetLength() == 0;
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const float* o = rays_ptr + 6 * workload_idx;
+        const float* d = o + 3;
+        const float inv_d[3] = {1.0f / d[0], 1.0f / d[1], 1.0f / d[2]};
+
+        float best_t = INFINITY, best_u = 0, best_w = 0;
+        int64_t best = -1;
+        int stack[BVH_STACK_SIZE];
+        int top = 0;
+        if (!empty) stack[top++] = 0;
+        while (top > 0) {
+            const int node = stack[--top];
+            if (!IntersectBox(bounds_ptr + 6 * node, o, inv_d, best_t)) {
+                continue;
+            }
+            const int first = children_ptr[2 * node];
+            const int second = children_ptr[2 * node + 1];
+            if (first >= 0) {
+                stack[top++] = second;
+                stack[top++] = first;
+                continue;
+            }
+            for (int64_t i = -1 - first; i < -1 - first + second; ++i) {
+                float t, u, w;
+                if (IntersectTriangle(vertices_ptr + 9 * i, o, d, &t, &u,
+                                      &w) &&
+                    t < best_t) {
+                    best_t = t;
+                    best_u = u;
+                    best_w = w;
+                    best = i;
+                }
+            }
+        }
+
+        t_hit_ptr[workload_idx] = best_t;
+        triangle_indices_ptr[workload_idx] = best;
+        float* uv = uvs_ptr + 2 * workload_idx;
+        float* normal = normals_ptr + 3 * workload_idx;
+        if (best < 0) {
+            uv[0] = uv[1] = 0;
+            normal[0] = normal[1] = normal[2] = 0;
+            return;
+        }
+        uv[0] = best_u;
+        uv[1] = best_w;
+        const float* v = vertices_ptr + 9 * best;
+        const float e1[3] = {v[3] - v[0], v[4] - v[1], v[5] - v[2]};
+        const float e2[3] = {v[6] - v[0], v[7] - v[1], v[8] - v[2]};
+        Cross(e1, e2, normal);
+        const float inv_norm = 1.0f / sqrtf(Dot(normal, normal));
+        normal[0] *= inv_norm;
+        normal[1] *= inv_norm;
+        normal[2] *= inv_norm;
+    });
+}
+
+#if defined(__CUDACC__)
+void CountIntersectionsCUDA
+#else
+void CountIntersectionsCPU
+#endif
+        (const core::Tensor& node_bounds,
+         const core::Tensor& node_children,
+         const core::Tensor& triangle_vertices,
+         const core::Tensor& rays,
+         core::Tensor& intersections) {
+    const int64_t n = rays.GetLength();
+    intersections = core::Tensor({n}, core::Dtype::Int32, rays.GetDevice());
+
+    const float* bounds_ptr = node_bounds.GetDataPtr<float>();
+    const int* children_ptr = node_children.GetDataPtr<int>();
+    const float* vertices_ptr = triangle_vertices.GetDataPtr<float>();
+    const float* rays_ptr = rays.GetDataPtr<float>();
+    int* intersections_ptr = intersections.GetDataPtr<int>();
+    const bool empty = node_bounds.GetLength() == 0;
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const float* o = rays_ptr + 6 * workload_idx;
+        const float* d = o + 3;
+        const float inv_d[3] = {1.0f / d[0], 1.0f / d[1], 1.0f / d[2]};
+
+        float history[COUNT_HISTORY_SIZE];
+        int count = 0;
+        int stack[BVH_STACK_SIZE];
+        int top = 0;
+        if (!empty) stack[top++] = 0;
+        while (top > 0) {
+            const int node = stack[--top];
+            if (!IntersectBox(bounds_ptr + 6 * node, o, inv_d, INFINITY)) {
+                continue;
+            }
+            const int first = children_ptr[2 * node];
+            const int second = children_ptr[2 * node + 1];
+            if (first >= 0) {
+                stack[top++] = second;
+                stack[top++] = first;
+                continue;
+            }
+            for (int64_t i = -1 - first; i < -1 - first + second; ++i) {
+                float t, u, w;
+                if (!IntersectTriangle(vertices_ptr + 9 * i, o, d, &t, &u,
+                                       &w)) {
+                    continue;
+                }
+                // Neighboring triangles report hits on their shared edges or
+                // vertices at the same distance.
+                bool duplicate = false;
+                const int history_size = count < COUNT_HISTORY_SIZE
+                                                 ? count
+                                                 : COUNT_HISTORY_SIZE;
+                for (int k = 0; k < history_size; ++k) {
+                    if (fabsf(history[k] - t) <= 1e-6f * (1.0f + t)) {
+                        duplicate = true;
+                    }
+                }
+                if (!duplicate) {
+                    history[count % COUNT_HISTORY_SIZE] = t;
+                    ++count;
+                }
+            }
+        }
+        intersections_ptr[workload_idx] = count;
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeClosestPointsCUDA
+#else
+void ComputeClosestPointsCPU
+#endif
+        (const core::Tensor& node_bounds,
+         const core::Tensor& node_children,
+         const core::Tensor& triangle_vertices,
+         const core::Tensor& query_points,
+         core::Tensor& closest_points,
+         core::Tensor& triangle_indices) {
+    const core::Device device = query_points.GetDevice();
+    const int64_t n = query_points.GetLength();
+    closest_points = core::Tensor({n, 3}, core::Dtype::Float32, device);
+    triangle_indices = core::Tensor({n}, core::Dtype::Int64, device);
+
+    const float* bounds_ptr = node_bounds.GetDataPtr<float>();
+    const int* children_ptr = node_children.GetDataPtr<int>();
+    const float* vertices_ptr = triangle_vertices.GetDataPtr<float>();
+    const float* query_points_ptr = query_points.GetDataPtr<float>();
+    float* closest_points_ptr = closest_points.GetDataPtr<float>();
+    int64_t* triangle_indices_ptr = triangle_indices.GetDataPtr<int64_t>();
+    const bool empty = node_bounds.GetLength() == 0;
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const float* p = query_points_ptr + 3 * workload_idx;
+        float* closest = closest_points_ptr + 3 * workload_idx;
+        closest[0] = closest[1] = closest[2] = 0;
+
+        float best_d2 = INFINITY;
+        int64_t best = -1;
+        int stack[BVH_STACK_SIZE];
+        int top = 0;
+        if (!empty) stack[top++] = 0;
+        while (top > 0) {
+            const int node = stack[--top];
+            if (BoxDistance2(bounds_ptr + 6 * node, p) >= best_d2) {
+                continue;
+            }
+            const int first = children_ptr[2 * node];
+            const int second = children_ptr[2 * node + 1];
+            if (first >= 0) {
+                // Visit the nearer child first for better pruning.
+                if (BoxDistance2(bounds_ptr + 6 * first, p) <
+                    BoxDistance2(bounds_ptr + 6 * second, p)) {
+                    stack[top++] = second;
+                    stack[top++] = first;
+                } else {
+                    stack[top++] = first;
+                    stack[top++] = second;
+                }
+                continue;
+            }
+            for (int64_t i = -1 - first; i < -1 - first + second; ++i) {
+                float c[3];
+                ClosestPointTriangle(p, vertices_ptr + 9 * i, c);
+                const float diff[3] = {c[0] - p[0], c[1] - p[1], c[2] - p[2]};
+                const float d2 = Dot(diff, diff);
+                if (d2 < best_d2) {
+                    best_d2 = d2;
+                    best = i;
+                    closest[0] = c[0];
+                    closest[1] = c[1];
+                    closest[2] = c[2];
+                }
+            }
+        }
+        triangle_indices_ptr[workload_idx] = best;
+    });
+}
+
+#undef BVH_STACK_SIZE
+#undef COUNT_HISTORY_SIZE
+
+}  // namespace raycasting_scene
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -41,6 +41,18 @@
         } else if (BYTESIZE == sizeof(Voxel32f)) {           \
             using voxel_t = Voxel32f;                        \
             return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(ColoredVoxel16q)) {    \
+            using voxel_t = ColoredVoxel16q;                 \
+            return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(ColoredVoxel8q)) {     \
+            using voxel_t = ColoredVoxel8q;                  \
+            return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(Voxel16q)) {           \
+            using voxel_t = Voxel16q;                        \
+            return __VA_ARGS__();                            \
+        } else if (BYTESIZE == sizeof(Voxel8q)) {            \
+            using voxel_t = Voxel8q;                         \
+            return __VA_ARGS__();                            \
         } else {                                             \
             utility::LogError("Unsupported voxel bytesize"); \
         }                                                    \
@@ -167,6 +179,124 @@ struct ColoredVoxel32f {
     }
 };
 
+/// Voxel structure with quantized TSDF and weight.
+/// The TSDF in [-1, 1] is stored as an integer in [-kTSDFScale, kTSDFScale]
+/// and the weight saturates at kMaxWeight. The running averages are rounded
+/// to the quantization step, so the TSDF stops changing once an observation
+/// moves it by less than half a step, which limits the useful weights.
+template <typename tsdf_t, typename weight_t, int kTSDFScale, int kMaxWeight>
+struct QuantizedVoxel {
+    tsdf_t tsdf;
+    weight_t weight;
+
+    static bool HasColor() { return false; }
+    OPEN3D_HOST_DEVICE float GetTSDF() {
+        return static_cast<float>(tsdf) / kTSDFScale;
+    }
+    OPEN3D_HOST_DEVICE float GetWeight() { return static_cast<float>(weight); }
+    OPEN3D_HOST_DEVICE float GetR() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetG() { return 1.0; }
+    OPEN3D_HOST_DEVICE float GetB() { return 1.0; }
+
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        float inv_wsum = 1.0f / inc_wsum;
+        tsdf = static_cast<tsdf_t>(roundf(
+                (weight * static_cast<float>(tsdf) + dsdf * kTSDFScale) *
+                inv_wsum));
+        weight = static_cast<weight_t>(
+                inc_wsum < static_cast<float>(kMaxWeight) ? weight + 1
+                                                          : kMaxWeight);
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        printf("[QuantizedVoxel] should never reach here.\n");
+    }
+};
+
+/// Colored voxel structure with quantized TSDF, weight and colors.
+/// See QuantizedVoxel. Colors in [0, 255] are stored multiplied by
+/// kColorFactor, which extends them to the range of color_t as in
+/// ColoredVoxel16i.
+template <typename tsdf_t,
+          typename weight_t,
+          typename color_t,
+          int kTSDFScale,
+          int kMaxWeight,
+          int kColorFactor>
+struct QuantizedColoredVoxel {
+    tsdf_t tsdf;
+    weight_t weight;
+
+    color_t r;
+    color_t g;
+    color_t b;
+
+    static bool HasColor() { return true; }
+    OPEN3D_HOST_DEVICE float GetTSDF() {
+        return static_cast<float>(tsdf) / kTSDFScale;
+    }
+    OPEN3D_HOST_DEVICE float GetWeight() { return static_cast<float>(weight); }
+    OPEN3D_HOST_DEVICE float GetR() {
+        return static_cast<float>(r) / kColorFactor;
+    }
+    OPEN3D_HOST_DEVICE float GetG() {
+        return static_cast<float>(g) / kColorFactor;
+    }
+    OPEN3D_HOST_DEVICE float GetB() {
+        return static_cast<float>(b) / kColorFactor;
+    }
+
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        float inv_wsum = 1.0f / inc_wsum;
+        tsdf = static_cast<tsdf_t>(roundf(
+                (weight * static_cast<float>(tsdf) + dsdf * kTSDFScale) *
+                inv_wsum));
+        weight = static_cast<weight_t>(
+                inc_wsum < static_cast<float>(kMaxWeight) ? weight + 1
+                                                          : kMaxWeight);
+    }
+    OPEN3D_HOST_DEVICE void Integrate(float dsdf,
+                                      float dr,
+                                      float dg,
+                                      float db) {
+        float inc_wsum = static_cast<float>(weight) + 1;
+        float inv_wsum = 1.0f / inc_wsum;
+        tsdf = static_cast<tsdf_t>(roundf(
+                (weight * static_cast<float>(tsdf) + dsdf * kTSDFScale) *
+                inv_wsum));
+        r = static_cast<color_t>(
+                roundf((weight * static_cast<float>(r) + dr * kColorFactor) *
+                       inv_wsum));
+        g = static_cast<color_t>(
+                roundf((weight * static_cast<float>(g) + dg * kColorFactor) *
+                       inv_wsum));
+        b = static_cast<color_t>(
+                roundf((weight * static_cast<float>(b) + db * kColorFactor) *
+                       inv_wsum));
+        weight = static_cast<weight_t>(
+                inc_wsum < static_cast<float>(kMaxWeight) ? weight + 1
+                                                          : kMaxWeight);
+    }
+};
+
+/// 2-byte voxel structure: int8_t TSDF and uint8_t weight.
+using Voxel8q = QuantizedVoxel<int8_t, uint8_t, 127, 255>;
+
+/// 4-byte voxel structure: int16_t TSDF and uint16_t weight.
+using Voxel16q = QuantizedVoxel<int16_t, uint16_t, 32767, 65535>;
+
+/// 5-byte voxel structure: int8_t TSDF, uint8_t weight and uint8_t colors.
+using ColoredVoxel8q =
+        QuantizedColoredVoxel<int8_t, uint8_t, uint8_t, 127, 255, 1>;
+
+/// 10-byte voxel structure: int16_t TSDF, uint16_t weight and uint16_t colors.
+using ColoredVoxel16q =
+        QuantizedColoredVoxel<int16_t, uint16_t, uint16_t, 32767, 65535, 255>;
+
 // Get a voxel in a certain voxel block given the block id with its neighbors.
 template <typename voxel_t>
 inline OPEN3D_DEVICE voxel_t* DeviceGetVoxelAt(
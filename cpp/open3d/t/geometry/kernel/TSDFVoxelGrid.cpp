@@ -156,6 +156,7 @@ void EstimateRange(const core::Tensor& block_keys,
 
 void RayCast(std::shared_ptr<core::DeviceHashmap>& hashmap,
              const core::Tensor& block_values,
+             const core::Tensor& block_indices,
              const core::Tensor& range_map,
              core::Tensor& vertex_map,
              core::Tensor& depth_map,
@@ -171,7 +172,8 @@ void RayCast(std::shared_ptr<core::DeviceHashmap>& hashmap,
              float depth_scale,
              float depth_min,
              float depth_max,
-             float weight_threshold) {
+             float weight_threshold,
+             core::CUDAGraph* graph) {
     static const core::Device host("CPU:0");
     core::Tensor intrinsics_d =
             intrinsics.To(host, core::Dtype::Float64).Contiguous();
@@ -181,16 +183,18 @@ void RayCast(std::shared_ptr<core::DeviceHashmap>& hashmap,
     core::Device device = hashmap->GetDevice();
     core::Device::DeviceType device_type = device.GetType();
     if (device_type == core::Device::DeviceType::CPU) {
-        RayCastCPU(hashmap, block_values, range_map, vertex_map, depth_map,
-                   color_map, normal_map, intrinsics_d, extrinsics_d, h, w,
-                   block_resolution, voxel_size, sdf_trunc, depth_scale,
-                   depth_min, depth_max, weight_threshold);
+        RayCastCPU(hashmap, block_values, block_indices, range_map,
+                   vertex_map, depth_map, color_map, normal_map, intrinsics_d,
+                   extrinsics_d, h, w, block_resolution, voxel_size,
+                   sdf_trunc, depth_scale, depth_min, depth_max,
+                   weight_threshold, graph);
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
-        RayCastCUDA(hashmap, block_values, range_map, vertex_map, depth_map,
-                    color_map, normal_map, intrinsics_d, extrinsics_d, h, w,
-                    block_resolution, voxel_size, sdf_trunc, depth_scale,
-                    depth_min, depth_max, weight_threshold);
+        RayCastCUDA(hashmap, block_values, block_indices, range_map,
+                    vertex_map, depth_map, color_map, normal_map, intrinsics_d,
+                    extrinsics_d, h, w, block_resolution, voxel_size,
+                    sdf_trunc, depth_scale, depth_min, depth_max,
+                    weight_threshold, graph);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
 #endif
@@ -248,7 +252,10 @@ void ExtractSurfaceMesh(
         int64_t block_resolution,
         float voxel_size,
         float weight_threshold,
-        int& vertex_count) {
+        int& vertex_count,
+        const core::Tensor& block_masks,
+        utility::optional<std::reference_wrapper<core::Tensor>>
+                triangle_block_indices) {
     core::Device device = block_keys.GetDevice();
 
     core::Device::DeviceType device_type = device.GetType();
@@ -257,14 +264,16 @@ void ExtractSurfaceMesh(
                               nb_block_indices, nb_block_masks, block_keys,
                               block_values, vertices, triangles, vertex_normals,
                               vertex_colors, block_resolution, voxel_size,
-                              weight_threshold, vertex_count);
+                              weight_threshold, vertex_count, block_masks,
+                              triangle_block_indices);
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
         ExtractSurfaceMeshCUDA(block_indices, inv_block_indices,
                                nb_block_indices, nb_block_masks, block_keys,
                                block_values, vertices, triangles,
                                vertex_normals, vertex_colors, block_resolution,
-                               voxel_size, weight_threshold, vertex_count);
+                               voxel_size, weight_threshold, vertex_count,
+                               block_masks, triangle_block_indices);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
 #endif
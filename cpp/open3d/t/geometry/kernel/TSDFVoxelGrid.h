@@ -32,6 +32,10 @@
 #include "open3d/core/hashmap/Hashmap.h"
 
 namespace open3d {
+namespace core {
+class CUDAGraph;
+}  // namespace core
+
 namespace t {
 namespace geometry {
 namespace kernel {
@@ -69,8 +73,11 @@ void EstimateRange(const core::Tensor& block_keys,
                    float depth_min,
                    float depth_max);
 
+/// On CUDA, the ray marching kernels are captured into \p graph if given and
+/// launched as a CUDA graph.
 void RayCast(std::shared_ptr<core::DeviceHashmap>& hashmap,
              const core::Tensor& block_values,
+             const core::Tensor& block_indices,
              const core::Tensor& range_map,
              core::Tensor& vertex_map,
              core::Tensor& depth_map,
@@ -86,7 +93,8 @@ void RayCast(std::shared_ptr<core::DeviceHashmap>& hashmap,
              float depth_scale,
              float depth_min,
              float depth_max,
-             float weight_threshold);
+             float weight_threshold,
+             core::CUDAGraph* graph = nullptr);
 
 void ExtractSurfacePoints(
         const core::Tensor& block_indices,
@@ -102,6 +110,11 @@ void ExtractSurfacePoints(
         float weight_threshold,
         int& valid_size);
 
+/// Marching cubes on the blocks \p block_indices. If \p block_masks (Bool,
+/// one per block) is not empty, only the masked blocks emit triangles and the
+/// others only provide the vertices on their shared edges.
+/// \p triangle_block_indices, if given, receives the position in
+/// \p block_indices of the block that emitted each triangle.
 void ExtractSurfaceMesh(
         const core::Tensor& block_indices,
         const core::Tensor& inv_block_indices,
@@ -116,7 +129,10 @@ void ExtractSurfaceMesh(
         int64_t block_resolution,
         float voxel_size,
         float weight_threshold,
-        int& vertex_count);
+        int& vertex_count,
+        const core::Tensor& block_masks,
+        utility::optional<std::reference_wrapper<core::Tensor>>
+                triangle_block_indices);
 
 void TouchCPU(std::shared_ptr<core::Hashmap>& hashmap,
               const core::Tensor& points,
@@ -152,6 +168,7 @@ void EstimateRangeCPU(const core::Tensor& block_keys,
 
 void RayCastCPU(std::shared_ptr<core::DeviceHashmap>& hashmap,
                 const core::Tensor& block_values,
+                const core::Tensor& block_indices,
                 const core::Tensor& range_map,
                 core::Tensor& vertex_map,
                 core::Tensor& depth_map,
@@ -167,7 +184,8 @@ void RayCastCPU(std::shared_ptr<core::DeviceHashmap>& hashmap,
                 float depth_scale,
                 float depth_min,
                 float depth_max,
-                float weight_threshold);
+                float weight_threshold,
+                core::CUDAGraph* graph);
 
 void ExtractSurfacePointsCPU(
         const core::Tensor& block_indices,
@@ -197,7 +215,10 @@ void ExtractSurfaceMeshCPU(
         int64_t block_resolution,
         float voxel_size,
         float weight_threshold,
-        int& vertex_count);
+        int& vertex_count,
+        const core::Tensor& block_masks,
+        utility::optional<std::reference_wrapper<core::Tensor>>
+                triangle_block_indices);
 
 #ifdef BUILD_CUDA_MODULE
 void TouchCUDA(std::shared_ptr<core::Hashmap>& hashmap,
@@ -234,6 +255,7 @@ void EstimateRangeCUDA(const core::Tensor& block_keys,
 
 void RayCastCUDA(std::shared_ptr<core::DeviceHashmap>& hashmap,
                  const core::Tensor& block_values,
+                 const core::Tensor& block_indices,
                  const core::Tensor& range_map,
                  core::Tensor& vertex_map,
                  core::Tensor& depth_map,
@@ -249,7 +271,8 @@ void RayCastCUDA(std::shared_ptr<core::DeviceHashmap>& hashmap,
                  float depth_scale,
                  float depth_min,
                  float depth_max,
-                 float weight_threshold);
+                 float weight_threshold,
+                 core::CUDAGraph* graph);
 
 void ExtractSurfacePointsCUDA(
         const core::Tensor& block_indices,
@@ -279,7 +302,10 @@ void ExtractSurfaceMeshCUDA(
         int64_t block_resolution,
         float voxel_size,
         float weight_threshold,
-        int& vertex_count);
+        int& vertex_count,
+        const core::Tensor& block_masks,
+        utility::optional<std::reference_wrapper<core::Tensor>>
+                triangle_block_indices);
 #endif
 }  // namespace tsdf
 }  // namespace kernel
@@ -26,6 +26,8 @@
 
 #include <atomic>
 #include <cmath>
+#include <cstring>
+#include <vector>
 
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Dtype.h"
@@ -494,7 +496,10 @@ void ExtractSurfaceMeshCPU
          int64_t resolution,
          float voxel_size,
          float weight_threshold,
-         int& vertex_count) {
+         int& vertex_count,
+         const core::Tensor& block_masks,
+         utility::optional<std::reference_wrapper<core::Tensor>>
+                 triangle_block_indices) {
 
     int64_t resolution3 = resolution * resolution * resolution;
 
@@ -533,6 +538,9 @@ void ExtractSurfaceMeshCPU
     // Plain arrays that does not require indexers
     const int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
     const int64_t* inv_indices_ptr = inv_indices.GetDataPtr<int64_t>();
+    const bool* block_masks_ptr = block_masks.NumElements() > 0
+                                          ? block_masks.GetDataPtr<bool>()
+                                          : nullptr;
     int64_t n = n_blocks * resolution3;
 
 #if defined(__CUDACC__)
@@ -558,6 +566,12 @@ void ExtractSurfaceMeshCPU
             int64_t workload_block_idx = widx / resolution3;
             int64_t voxel_idx = widx % resolution3;
 
+            // Unmasked blocks emit no triangles, and hence own no table.
+            if (block_masks_ptr != nullptr &&
+                !block_masks_ptr[workload_block_idx]) {
+                return;
+            }
+
             // voxel_idx -> (x_voxel, y_voxel, z_voxel)
             int64_t xv, yv, zv;
             voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
@@ -827,6 +841,14 @@ void ExtractSurfaceMeshCPU
                              block_values.GetDevice());
     NDArrayIndexer triangle_indexer(triangles, 1);
 
+    int64_t* triangle_block_indices_ptr = nullptr;
+    if (triangle_block_indices.has_value()) {
+        triangle_block_indices.value().get() = core::Tensor(
+                {triangle_count}, core::Dtype::Int64, block_values.GetDevice());
+        triangle_block_indices_ptr =
+                triangle_block_indices.value().get().GetDataPtr<int64_t>();
+    }
+
 #if defined(__CUDACC__)
     count = core::Tensor(std::vector<int>{0}, {}, core::Dtype::Int32,
                          block_values.GetDevice());
@@ -854,6 +876,9 @@ void ExtractSurfaceMeshCPU
             if (tri_table[table_idx][tri] == -1) return;
 
             int tri_idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
+            if (triangle_block_indices_ptr != nullptr) {
+                triangle_block_indices_ptr[tri_idx] = workload_block_idx;
+            }
 
             for (size_t vertex = 0; vertex < 3; ++vertex) {
                 int edge = tri_table[table_idx][tri + vertex];
@@ -890,6 +915,11 @@ void ExtractSurfaceMeshCPU
 #endif
     utility::LogInfo("Total triangle count = {}", triangle_count);
     triangles = triangles.Slice(0, 0, triangle_count);
+    if (triangle_block_indices.has_value()) {
+        triangle_block_indices.value().get() =
+                triangle_block_indices.value().get().Slice(0, 0,
+                                                           triangle_count);
+    }
 }
 
 #if defined(__CUDACC__)
@@ -1112,6 +1142,7 @@ void RayCastCPU
 #endif
         (std::shared_ptr<core::DeviceHashmap>& hashmap,
          const core::Tensor& block_values,
+         const core::Tensor& block_indices,
          const core::Tensor& range_map,
          core::Tensor& vertex_map,
          core::Tensor& depth_map,
@@ -1127,7 +1158,8 @@ void RayCastCPU
          float depth_scale,
          float depth_min,
          float depth_max,
-         float weight_threshold) {
+         float weight_threshold,
+         core::CUDAGraph* graph) {
     using Key = core::Block<int, 3>;
     using Hash = core::BlockHash<int, 3>;
 
@@ -1142,11 +1174,29 @@ void RayCastCPU
 #else
     auto cpu_hashmap =
             std::dynamic_pointer_cast<core::TBBHashmap<Key, Hash>>(hashmap);
+    if (cpu_hashmap == nullptr) {
+        utility::LogError(
+                "Unsupported backend: CPU raycasting only supports TBB.");
+    }
     auto hashmap_impl = *cpu_hashmap->GetImpl();
 #endif
 
+    // Views are stacked along the first dimension of the poses, the range
+    // maps and the output maps, which is omitted for a single view.
+    int64_t n_views = extrinsics.NumDims() == 3 ? extrinsics.GetLength() : 1;
+    int64_t rows = h;
+    int64_t cols = w;
+    auto view_shape = [&](const core::Tensor& map) {
+        core::SizeVector shape = map.GetShape();
+        if (map.NumDims() == 3) {
+            shape.insert(shape.begin(), 1);
+        }
+        return shape;
+    };
+
     NDArrayIndexer voxel_block_buffer_indexer(block_values, 4);
-    NDArrayIndexer range_map_indexer(range_map, 2);
+    NDArrayIndexer range_map_indexer(range_map.View(view_shape(range_map)),
+                                     3);
 
     NDArrayIndexer vertex_map_indexer;
     NDArrayIndexer depth_map_indexer;
@@ -1163,37 +1213,111 @@ void RayCastCPU
     }
 
     if (enable_vertex) {
-        vertex_map_indexer = NDArrayIndexer(vertex_map, 2);
+        vertex_map_indexer =
+                NDArrayIndexer(vertex_map.View(view_shape(vertex_map)), 3);
     }
     if (enable_depth) {
-        depth_map_indexer = NDArrayIndexer(depth_map, 2);
+        depth_map_indexer =
+                NDArrayIndexer(depth_map.View(view_shape(depth_map)), 3);
     }
     if (enable_color) {
-        color_map_indexer = NDArrayIndexer(color_map, 2);
+        color_map_indexer =
+                NDArrayIndexer(color_map.View(view_shape(color_map)), 3);
     }
     if (enable_normal) {
-        normal_map_indexer = NDArrayIndexer(normal_map, 2);
+        normal_map_indexer =
+                NDArrayIndexer(normal_map.View(view_shape(normal_map)), 3);
     }
 
-    TransformIndexer c2w_transform_indexer(
-            intrinsics, t::geometry::InverseTransformation(extrinsics));
-    TransformIndexer w2c_transform_indexer(intrinsics, extrinsics);
-
-    int64_t rows = h;
-    int64_t cols = w;
+    // Per view camera to world and world to camera transforms, copied to the
+    // device as plain bytes.
+    std::vector<TransformIndexer> transform_indexers;
+    for (int64_t i = 0; i < n_views; ++i) {
+        core::Tensor intrinsic = intrinsics.NumDims() == 3 ? intrinsics[i]
+                                                           : intrinsics;
+        core::Tensor extrinsic = extrinsics.NumDims() == 3 ? extrinsics[i]
+                                                           : extrinsics;
+        transform_indexers.emplace_back(
+                intrinsic, t::geometry::InverseTransformation(extrinsic));
+        transform_indexers.emplace_back(intrinsic, extrinsic);
+    }
+    int64_t transform_bytes =
+            static_cast<int64_t>(sizeof(TransformIndexer)) * 2 * n_views;
+    core::Tensor transforms({transform_bytes}, core::Dtype::UInt8,
+                            core::Device("CPU:0"));
+    std::memcpy(transforms.GetDataPtr(), transform_indexers.data(),
+                transform_bytes);
+    transforms = transforms.To(block_values.GetDevice());
+    const TransformIndexer* transform_indexers_ptr =
+            static_cast<const TransformIndexer*>(transforms.GetDataPtr());
 
     float block_size = voxel_size * block_resolution;
 
+    // Coarse occupancy level: a block is marked if it holds a voxel where a
+    // ray may stop, i.e. a voxel behind the surface with enough weight. Rays
+    // cross unmarked blocks in one step. Blocks outside block_indices are
+    // conservatively marked and marched voxel by voxel.
+    core::Device device = block_values.GetDevice();
+    core::Tensor block_indices_i64 = block_indices.To(core::Dtype::Int64);
+    int64_t n_blocks = block_indices_i64.GetLength();
+    int64_t n_buffer_blocks = block_values.GetLength();
+    core::Tensor block_surface_masks({n_buffer_blocks}, core::Dtype::UInt8,
+                                     device);
+    const int64_t* block_indices_ptr =
+            block_indices_i64.GetDataPtr<int64_t>();
+    uint8_t* block_surface_masks_ptr =
+            block_surface_masks.GetDataPtr<uint8_t>();
+    int64_t resolution3 =
+            block_resolution * block_resolution * block_resolution;
+
 #if defined(__CUDACC__)
     namespace launcher = core::kernel::cuda_launcher;
 #else
     namespace launcher = core::kernel::cpu_launcher;
     using std::max;
+    using std::min;
+#endif
+
+    // The kernels below do not synchronize with the host, so that they can be
+    // captured into a CUDA graph.
+#if defined(__CUDACC__)
+    if (graph != nullptr) {
+        graph->BeginCapture();
+    }
 #endif
+    launcher::ParallelFor(n_buffer_blocks,
+                          [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                              block_surface_masks_ptr[workload_idx] = 1;
+                          });
+    launcher::ParallelFor(n_blocks, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        block_surface_masks_ptr[block_indices_ptr[workload_idx]] = 0;
+    });
 
     DISPATCH_BYTESIZE_TO_VOXEL(
             voxel_block_buffer_indexer.ElementByteSize(), [&]() {
-                launcher::ParallelFor(rows * cols, [=] OPEN3D_DEVICE(
+                launcher::ParallelFor(
+                        n_blocks * resolution3,
+                        [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                            int64_t block_idx = block_indices_ptr
+                                    [workload_idx / resolution3];
+                            int64_t voxel_idx = workload_idx % resolution3;
+                            int64_t x_v = voxel_idx % block_resolution;
+                            int64_t y_v = (voxel_idx / block_resolution) %
+                                          block_resolution;
+                            int64_t z_v = voxel_idx / (block_resolution *
+                                                       block_resolution);
+                            voxel_t* voxel_ptr =
+                                    voxel_block_buffer_indexer
+                                            .GetDataPtr<voxel_t>(
+                                                    x_v, y_v, z_v, block_idx);
+                            // Concurrent writes store the same value.
+                            if (voxel_ptr->GetWeight() >= weight_threshold &&
+                                voxel_ptr->GetTSDF() <= 0) {
+                                block_surface_masks_ptr[block_idx] = 1;
+                            }
+                        });
+
+                launcher::ParallelFor(n_views * rows * cols, [=] OPEN3D_DEVICE(
                                                            int64_t workload_idx) {
                     auto GetVoxelAtP = [&] OPEN3D_DEVICE(
                                                int x_b, int y_b, int z_b,
@@ -1269,36 +1393,45 @@ void RayCastCPU
                                 x_v, y_v, z_v, block_addr);
                     };
 
-                    int64_t y = workload_idx / cols;
+                    int64_t view = workload_idx / (rows * cols);
+                    int64_t y = (workload_idx / cols) % rows;
                     int64_t x = workload_idx % cols;
+                    const TransformIndexer& c2w_transform_indexer =
+                            transform_indexers_ptr[2 * view];
+                    const TransformIndexer& w2c_transform_indexer =
+                            transform_indexers_ptr[2 * view + 1];
 
                     float *depth_ptr = nullptr, *vertex_ptr = nullptr,
                           *normal_ptr = nullptr, *color_ptr = nullptr;
                     if (enable_depth) {
-                        depth_ptr = depth_map_indexer.GetDataPtr<float>(x, y);
+                        depth_ptr = depth_map_indexer.GetDataPtr<float>(
+                                x, y, view);
                         *depth_ptr = 0;
                     }
                     if (enable_vertex) {
-                        vertex_ptr = vertex_map_indexer.GetDataPtr<float>(x, y);
+                        vertex_ptr = vertex_map_indexer.GetDataPtr<float>(
+                                x, y, view);
                         vertex_ptr[0] = 0;
                         vertex_ptr[1] = 0;
                         vertex_ptr[2] = 0;
                     }
                     if (enable_color) {
-                        color_ptr = color_map_indexer.GetDataPtr<float>(x, y);
+                        color_ptr = color_map_indexer.GetDataPtr<float>(
+                                x, y, view);
                         color_ptr[0] = 0;
                         color_ptr[1] = 0;
                         color_ptr[2] = 0;
                     }
                     if (enable_normal) {
-                        normal_ptr = normal_map_indexer.GetDataPtr<float>(x, y);
+                        normal_ptr = normal_map_indexer.GetDataPtr<float>(
+                                x, y, view);
                         normal_ptr[0] = 0;
                         normal_ptr[1] = 0;
                         normal_ptr[2] = 0;
                     }
 
-                    const float* range =
-                            range_map_indexer.GetDataPtr<float>(x / 8, y / 8);
+                    const float* range = range_map_indexer.GetDataPtr<float>(
+                            x / 8, y / 8, view);
                     float t = range[0];
                     const float t_max = range[1];
                     if (t >= t_max) return;
@@ -1338,6 +1471,30 @@ void RayCastCPU
                         if (!voxel_ptr) {
                             t_prev = t;
                             t += block_size;
+                        } else if (!block_surface_masks_ptr[cache.block_idx]) {
+                            // Leave the block through its nearest face on
+                            // the ray; the cache holds the current block.
+                            float t_exit = t_max;
+                            const int b[3] = {cache.x, cache.y, cache.z};
+                            const float o[3] = {x_o, y_o, z_o};
+                            const float d[3] = {x_d, y_d, z_d};
+                            for (int dim = 0; dim < 3; ++dim) {
+                                if (d[dim] > 0) {
+                                    t_exit = min(t_exit,
+                                                 ((b[dim] + 1) * block_size -
+                                                  o[dim]) /
+                                                         d[dim]);
+                                } else if (d[dim] < 0) {
+                                    t_exit = min(t_exit,
+                                                 (b[dim] * block_size -
+                                                  o[dim]) /
+                                                         d[dim]);
+                                }
+                            }
+                            // The skipped space is treated as free space.
+                            tsdf = 1.0f;
+                            t_prev = max(t, t_exit);
+                            t = t_prev + 0.01f * voxel_size;
                         } else {
                             tsdf_prev = tsdf;
                             tsdf = voxel_ptr->GetTSDF();
@@ -1504,7 +1661,11 @@ void RayCastCPU
             });
 
 #if defined(__CUDACC__)
-    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    if (graph != nullptr) {
+        graph->EndCaptureAndLaunch();
+    } else {
+        OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    }
 #endif
 }
 
@@ -0,0 +1,301 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+void ComputeTriangleNormals(const core::Tensor& vertices,
+                            const core::Tensor& triangles,
+                            core::Tensor& normals) {
+    core::Device::DeviceType device_type = vertices.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeTriangleNormalsCPU(vertices, triangles, normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeTriangleNormalsCUDA, vertices, triangles, normals);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeTriangleAreas(const core::Tensor& vertices,
+                          const core::Tensor& triangles,
+                          core::Tensor& areas) {
+    core::Device::DeviceType device_type = vertices.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeTriangleAreasCPU(vertices, triangles, areas);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeTriangleAreasCUDA, vertices, triangles, areas);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeVertexNormals(const core::Tensor& vertices,
+                          const core::Tensor& triangles,
+                          core::Tensor& normals) {
+    core::Device::DeviceType device_type = vertices.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeVertexNormalsCPU(vertices, triangles, normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeVertexNormalsCUDA, vertices, triangles, normals);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SampleTriangles(const core::Tensor& triangle_cdf,
+                     uint32_t seed,
+                     core::Tensor& triangle_indices,
+                     core::Tensor& barycentric) {
+    core::Device::DeviceType device_type = triangle_cdf.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SampleTrianglesCPU(triangle_cdf, seed, triangle_indices, barycentric);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(SampleTrianglesCUDA, triangle_cdf, seed, triangle_indices,
+                  barycentric);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void AccumulateClusterQuadrics(const core::Tensor& vertices,
+                               const core::Tensor& triangles,
+                               const core::Tensor& vertex_clusters,
+                               core::Tensor& quadrics) {
+    core::Device::DeviceType device_type = vertices.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        AccumulateClusterQuadricsCPU(vertices, triangles, vertex_clusters,
+                                     quadrics);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(AccumulateClusterQuadricsCUDA, vertices, triangles,
+                  vertex_clusters, quadrics);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SolveClusterQuadrics(const core::Tensor& quadrics,
+                          core::Tensor& cluster_vertices) {
+    core::Device::DeviceType device_type = quadrics.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SolveClusterQuadricsCPU(quadrics, cluster_vertices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(SolveClusterQuadricsCUDA, quadrics, cluster_vertices);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void RemapTriangles(const core::Tensor& triangles,
+                    const core::Tensor& vertex_clusters,
+                    core::Tensor& remapped,
+                    core::Tensor& valid) {
+    core::Device::DeviceType device_type = triangles.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        RemapTrianglesCPU(triangles, vertex_clusters, remapped, valid);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(RemapTrianglesCUDA, triangles, vertex_clusters, remapped,
+                  valid);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void MarchingCubesClassify(const core::Tensor& grid,
+                           double iso_value,
+                           core::Tensor& point_edges,
+                           core::Tensor& cube_indices) {
+    core::Device::DeviceType device_type = grid.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        MarchingCubesClassifyCPU(grid, iso_value, point_edges, cube_indices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(MarchingCubesClassifyCUDA, grid, iso_value, point_edges,
+                  cube_indices);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void MarchingCubesCount(const core::Tensor& point_edges,
+                        const core::Tensor& cube_indices,
+                        const core::Tensor& active_points,
+                        const core::Tensor& active_cells,
+                        core::Tensor& vertex_counts,
+                        core::Tensor& triangle_counts) {
+    core::Device::DeviceType device_type = point_edges.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        MarchingCubesCountCPU(point_edges, cube_indices, active_points,
+                              active_cells, vertex_counts, triangle_counts);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(MarchingCubesCountCUDA, point_edges, cube_indices,
+                  active_points, active_cells, vertex_counts,
+                  triangle_counts);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void MarchingCubesExtract(const core::Tensor& grid,
+                          double iso_value,
+                          const core::Tensor& grid_origin,
+                          const core::Tensor& grid_spacing,
+                          const core::Tensor& point_edges,
+                          const core::Tensor& cube_indices,
+                          const core::Tensor& active_points,
+                          const core::Tensor& active_cells,
+                          const core::Tensor& vertex_offsets,
+                          const core::Tensor& triangle_offsets,
+                          core::Tensor& vertices,
+                          core::Tensor& triangles) {
+    core::Device::DeviceType device_type = grid.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        MarchingCubesExtractCPU(grid, iso_value, grid_origin, grid_spacing,
+                                point_edges, cube_indices, active_points,
+                                active_cells, vertex_offsets,
+                                triangle_offsets, vertices, triangles);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(MarchingCubesExtractCUDA, grid, iso_value, grid_origin,
+                  grid_spacing, point_edges, cube_indices, active_points,
+                  active_cells, vertex_offsets, triangle_offsets, vertices,
+                  triangles);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeTriangleEdgeKeys(const core::Tensor& triangles,
+                             int64_t num_vertices,
+                             core::Tensor& keys) {
+    core::Device::DeviceType device_type = triangles.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeTriangleEdgeKeysCPU(triangles, num_vertices, keys);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeTriangleEdgeKeysCUDA, triangles, num_vertices, keys);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeInverseDistanceWeights(const core::Tensor& vertices,
+                                   const core::Tensor& neighbor_offsets,
+                                   const core::Tensor& neighbors,
+                                   core::Tensor& weights) {
+    core::Device::DeviceType device_type = vertices.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeInverseDistanceWeightsCPU(vertices, neighbor_offsets, neighbors,
+                                         weights);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeInverseDistanceWeightsCUDA, vertices,
+                  neighbor_offsets, neighbors, weights);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterSmoothLaplacian(const core::Tensor& neighbor_offsets,
+                           const core::Tensor& neighbors,
+                           const core::Tensor& weights,
+                           const core::Tensor& values,
+                           double lambda_filter,
+                           core::Tensor& filtered) {
+    core::Device::DeviceType device_type = values.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FilterSmoothLaplacianCPU(neighbor_offsets, neighbors, weights, values,
+                                 lambda_filter, filtered);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterSmoothLaplacianCUDA, neighbor_offsets, neighbors,
+                  weights, values, lambda_filter, filtered);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SubdivideLoopVertices(const core::Tensor& neighbor_offsets,
+                           const core::Tensor& neighbors,
+                           const core::Tensor& neighbor_edges,
+                           const core::Tensor& edge_triangle_counts,
+                           const core::Tensor& values,
+                           core::Tensor& new_values) {
+    core::Device::DeviceType device_type = values.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SubdivideLoopVerticesCPU(neighbor_offsets, neighbors, neighbor_edges,
+                                 edge_triangle_counts, values, new_values);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(SubdivideLoopVerticesCUDA, neighbor_offsets, neighbors,
+                  neighbor_edges, edge_triangle_counts, values, new_values);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SubdivideLoopEdges(const core::Tensor& triangles,
+                        const core::Tensor& triangle_edges,
+                        const core::Tensor& edges,
+                        const core::Tensor& edge_triangle_counts,
+                        const core::Tensor& values,
+                        core::Tensor& new_values) {
+    core::Device::DeviceType device_type = values.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SubdivideLoopEdgesCPU(triangles, triangle_edges, edges,
+                              edge_triangle_counts, values, new_values);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(SubdivideLoopEdgesCUDA, triangles, triangle_edges, edges,
+                  edge_triangle_counts, values, new_values);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void SubdivideTriangles(const core::Tensor& triangles,
+                        const core::Tensor& triangle_edges,
+                        int64_t num_vertices,
+                        core::Tensor& new_triangles) {
+    core::Device::DeviceType device_type = triangles.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        SubdivideTrianglesCPU(triangles, triangle_edges, num_vertices,
+                              new_triangles);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(SubdivideTrianglesCUDA, triangles, triangle_edges,
+                  num_vertices, new_triangles);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
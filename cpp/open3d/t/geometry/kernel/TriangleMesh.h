@@ -0,0 +1,394 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+// In all the kernels, vertices is a Float32 or Float64 tensor {N, 3} and
+// triangles is a contiguous Int64 tensor {M, 3}.
+
+/// Computes the unit normals {M, 3} of the triangles, 0 for degenerate
+/// triangles.
+void ComputeTriangleNormals(const core::Tensor& vertices,
+                            const core::Tensor& triangles,
+                            core::Tensor& normals);
+
+/// Computes the Float64 areas {M} of the triangles.
+void ComputeTriangleAreas(const core::Tensor& vertices,
+                          const core::Tensor& triangles,
+                          core::Tensor& areas);
+
+/// Computes the unit normals of the vertices as the area weighted sum of the
+/// normals of their triangles, 0 for vertices without triangles.
+///
+/// \param normals Tensor {N, 3} of the dtype of vertices, initialized to 0.
+void ComputeVertexNormals(const core::Tensor& vertices,
+                          const core::Tensor& triangles,
+                          core::Tensor& normals);
+
+/// Draws num_samples triangles with probabilities proportional to their
+/// areas, given as the Float64 inclusive prefix sum triangle_cdf {M}, and a
+/// uniformly distributed point in each of them. The draws are a function of
+/// seed and the sample index only, so they do not depend on the device.
+///
+/// \param triangle_indices Output Int64 tensor {num_samples}.
+/// \param barycentric Output Float32 or Float64 tensor {num_samples, 3}.
+void SampleTriangles(const core::Tensor& triangle_cdf,
+                     uint32_t seed,
+                     core::Tensor& triangle_indices,
+                     core::Tensor& barycentric);
+
+/// Accumulates the area weighted plane quadrics of the triangles into the
+/// clusters of their vertices. A quadric is stored as the 6 upper entries of
+/// the symmetric matrix A = n n^T followed by the vector b = d n of the plane
+/// n.x + d = 0.
+///
+/// \param vertex_clusters Int64 tensor {N} of cluster ids.
+/// \param quadrics Float64 tensor {num_clusters, 9}, initialized to 0.
+void AccumulateClusterQuadrics(const core::Tensor& vertices,
+                               const core::Tensor& triangles,
+                               const core::Tensor& vertex_clusters,
+                               core::Tensor& quadrics);
+
+/// Replaces the Float64 cluster_vertices {num_clusters, 3} by the minimizers
+/// of the cluster quadrics, where these are well conditioned.
+void SolveClusterQuadrics(const core::Tensor& quadrics,
+                          core::Tensor& cluster_vertices);
+
+/// Replaces the vertices of the triangles by their cluster ids, rotated so
+/// that the smallest id comes first, and marks the triangles with three
+/// distinct clusters as valid.
+///
+/// \param remapped Output Int64 tensor {M, 3}.
+/// \param valid Output Bool tensor {M}.
+void RemapTriangles(const core::Tensor& triangles,
+                    const core::Tensor& vertex_clusters,
+                    core::Tensor& remapped,
+                    core::Tensor& valid);
+
+/// First pass of marching cubes on the Float32 or Float64 grid {nz, ny, nx}.
+/// A grid point (x, y, z) owns the edges to its +x, +y and +z neighbors.
+///
+/// \param point_edges Output UInt8 tensor {nz, ny, nx}, whose bit i is set if
+/// the edge of the point in direction i crosses iso_value.
+/// \param cube_indices Output UInt8 tensor {nz, ny, nx} with the marching
+/// cubes case of the cell with the point as min corner, 0 for the cells
+/// without triangles and for the points without cells.
+void MarchingCubesClassify(const core::Tensor& grid,
+                           double iso_value,
+                           core::Tensor& point_edges,
+                           core::Tensor& cube_indices);
+
+/// Counts the vertices {A} of the active points and the triangles {C} of the
+/// active cells, given by the sorted Int64 flat indices active_points {A} and
+/// active_cells {C}.
+void MarchingCubesCount(const core::Tensor& point_edges,
+                        const core::Tensor& cube_indices,
+                        const core::Tensor& active_points,
+                        const core::Tensor& active_cells,
+                        core::Tensor& vertex_counts,
+                        core::Tensor& triangle_counts);
+
+/// Second pass of marching cubes, writing the vertices and the triangles of
+/// the active points and cells at the Int64 exclusive prefix sums
+/// vertex_offsets and triangle_offsets of their counts. Each edge gets a
+/// single vertex, shared by the triangles of its cells.
+///
+/// \param grid_origin Float64 tensor {3}, the position of the grid point
+/// (0, 0, 0).
+/// \param grid_spacing Float64 tensor {3}, the distances of the grid points
+/// along x, y and z.
+/// \param vertices Output tensor {num_vertices, 3} of the dtype of grid.
+/// \param triangles Output Int64 tensor {num_triangles, 3}.
+void MarchingCubesExtract(const core::Tensor& grid,
+                          double iso_value,
+                          const core::Tensor& grid_origin,
+                          const core::Tensor& grid_spacing,
+                          const core::Tensor& point_edges,
+                          const core::Tensor& cube_indices,
+                          const core::Tensor& active_points,
+                          const core::Tensor& active_cells,
+                          const core::Tensor& vertex_offsets,
+                          const core::Tensor& triangle_offsets,
+                          core::Tensor& vertices,
+                          core::Tensor& triangles);
+
+/// Computes the key v0 * num_vertices + v1, v0 < v1, of the edge from corner
+/// c to corner (c + 1) % 3 of each triangle into the Int64 tensor keys {3 M}.
+void ComputeTriangleEdgeKeys(const core::Tensor& triangles,
+                             int64_t num_vertices,
+                             core::Tensor& keys);
+
+// The adjacency of the vertices is given in CSR form, the neighbors of vertex
+// i are neighbors[neighbor_offsets[i]] to neighbors[neighbor_offsets[i + 1] -
+// 1], both Int64.
+
+/// Computes the inverse distance weights of the neighbors of each vertex,
+/// normalized to sum 1, into the Float64 tensor weights of the size of
+/// neighbors.
+void ComputeInverseDistanceWeights(const core::Tensor& vertices,
+                                   const core::Tensor& neighbor_offsets,
+                                   const core::Tensor& neighbors,
+                                   core::Tensor& weights);
+
+/// Moves the Float32 or Float64 vertex attribute values {N, C} by
+/// lambda_filter towards the weighted mean of the neighbors, like the legacy
+/// TriangleMesh::FilterSmoothLaplacian(), into filtered {N, C}.
+void FilterSmoothLaplacian(const core::Tensor& neighbor_offsets,
+                           const core::Tensor& neighbors,
+                           const core::Tensor& weights,
+                           const core::Tensor& values,
+                           double lambda_filter,
+                           core::Tensor& filtered);
+
+/// Computes the Loop subdivision rows [0, N) of the Float32 or Float64 vertex
+/// attribute values {N, C} into new_values {N + E, C}.
+///
+/// \param neighbor_edges Int64 edge index of each entry of neighbors.
+/// \param edge_triangle_counts Int64 number of triangles per edge {E}.
+void SubdivideLoopVertices(const core::Tensor& neighbor_offsets,
+                           const core::Tensor& neighbors,
+                           const core::Tensor& neighbor_edges,
+                           const core::Tensor& edge_triangle_counts,
+                           const core::Tensor& values,
+                           core::Tensor& new_values);
+
+/// Computes the Loop subdivision rows [N, N + E) of the new edge vertices
+/// into new_values {N + E, C}.
+///
+/// \param triangle_edges Int64 edge index of each corner {M, 3}, see
+/// ComputeTriangleEdgeKeys().
+/// \param edges Int64 end points {E, 2} of the edges.
+void SubdivideLoopEdges(const core::Tensor& triangles,
+                        const core::Tensor& triangle_edges,
+                        const core::Tensor& edges,
+                        const core::Tensor& edge_triangle_counts,
+                        const core::Tensor& values,
+                        core::Tensor& new_values);
+
+/// Splits each triangle into 4 at the new vertices num_vertices + e of its
+/// edges e, into the Int64 tensor new_triangles {4 M, 3}.
+void SubdivideTriangles(const core::Tensor& triangles,
+                        const core::Tensor& triangle_edges,
+                        int64_t num_vertices,
+                        core::Tensor& new_triangles);
+
+void ComputeTriangleNormalsCPU(const core::Tensor& vertices,
+                               const core::Tensor& triangles,
+                               core::Tensor& normals);
+
+void ComputeTriangleAreasCPU(const core::Tensor& vertices,
+                             const core::Tensor& triangles,
+                             core::Tensor& areas);
+
+void ComputeVertexNormalsCPU(const core::Tensor& vertices,
+                             const core::Tensor& triangles,
+                             core::Tensor& normals);
+
+void SampleTrianglesCPU(const core::Tensor& triangle_cdf,
+                        uint32_t seed,
+                        core::Tensor& triangle_indices,
+                        core::Tensor& barycentric);
+
+void AccumulateClusterQuadricsCPU(const core::Tensor& vertices,
+                                  const core::Tensor& triangles,
+                                  const core::Tensor& vertex_clusters,
+                                  core::Tensor& quadrics);
+
+void SolveClusterQuadricsCPU(const core::Tensor& quadrics,
+                             core::Tensor& cluster_vertices);
+
+void RemapTrianglesCPU(const core::Tensor& triangles,
+                       const core::Tensor& vertex_clusters,
+                       core::Tensor& remapped,
+                       core::Tensor& valid);
+
+void MarchingCubesClassifyCPU(const core::Tensor& grid,
+                              double iso_value,
+                              core::Tensor& point_edges,
+                              core::Tensor& cube_indices);
+
+void MarchingCubesCountCPU(const core::Tensor& point_edges,
+                           const core::Tensor& cube_indices,
+                           const core::Tensor& active_points,
+                           const core::Tensor& active_cells,
+                           core::Tensor& vertex_counts,
+                           core::Tensor& triangle_counts);
+
+void MarchingCubesExtractCPU(const core::Tensor& grid,
+                             double iso_value,
+                             const core::Tensor& grid_origin,
+                             const core::Tensor& grid_spacing,
+                             const core::Tensor& point_edges,
+                             const core::Tensor& cube_indices,
+                             const core::Tensor& active_points,
+                             const core::Tensor& active_cells,
+                             const core::Tensor& vertex_offsets,
+                             const core::Tensor& triangle_offsets,
+                             core::Tensor& vertices,
+                             core::Tensor& triangles);
+
+void ComputeTriangleEdgeKeysCPU(const core::Tensor& triangles,
+                                int64_t num_vertices,
+                                core::Tensor& keys);
+
+void ComputeInverseDistanceWeightsCPU(const core::Tensor& vertices,
+                                      const core::Tensor& neighbor_offsets,
+                                      const core::Tensor& neighbors,
+                                      core::Tensor& weights);
+
+void FilterSmoothLaplacianCPU(const core::Tensor& neighbor_offsets,
+                              const core::Tensor& neighbors,
+                              const core::Tensor& weights,
+                              const core::Tensor& values,
+                              double lambda_filter,
+                              core::Tensor& filtered);
+
+void SubdivideLoopVerticesCPU(const core::Tensor& neighbor_offsets,
+                              const core::Tensor& neighbors,
+                              const core::Tensor& neighbor_edges,
+                              const core::Tensor& edge_triangle_counts,
+                              const core::Tensor& values,
+                              core::Tensor& new_values);
+
+void SubdivideLoopEdgesCPU(const core::Tensor& triangles,
+                           const core::Tensor& triangle_edges,
+                           const core::Tensor& edges,
+                           const core::Tensor& edge_triangle_counts,
+                           const core::Tensor& values,
+                           core::Tensor& new_values);
+
+void SubdivideTrianglesCPU(const core::Tensor& triangles,
+                           const core::Tensor& triangle_edges,
+                           int64_t num_vertices,
+                           core::Tensor& new_triangles);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeTriangleNormalsCUDA(const core::Tensor& vertices,
+                                const core::Tensor& triangles,
+                                core::Tensor& normals);
+
+void ComputeTriangleAreasCUDA(const core::Tensor& vertices,
+                              const core::Tensor& triangles,
+                              core::Tensor& areas);
+
+void ComputeVertexNormalsCUDA(const core::Tensor& vertices,
+                              const core::Tensor& triangles,
+                              core::Tensor& normals);
+
+void SampleTrianglesCUDA(const core::Tensor& triangle_cdf,
+                         uint32_t seed,
+                         core::Tensor& triangle_indices,
+                         core::Tensor& barycentric);
+
+void AccumulateClusterQuadricsCUDA(const core::Tensor& vertices,
+                                   const core::Tensor& triangles,
+                                   const core::Tensor& vertex_clusters,
+                                   core::Tensor& quadrics);
+
+void SolveClusterQuadricsCUDA(const core::Tensor& quadrics,
+                              core::Tensor& cluster_vertices);
+
+void RemapTrianglesCUDA(const core::Tensor& triangles,
+                        const core::Tensor& vertex_clusters,
+                        core::Tensor& remapped,
+                        core::Tensor& valid);
+
+void MarchingCubesClassifyCUDA(const core::Tensor& grid,
+                               double iso_value,
+                               core::Tensor& point_edges,
+                               core::Tensor& cube_indices);
+
+void MarchingCubesCountCUDA(const core::Tensor& point_edges,
+                            const core::Tensor& cube_indices,
+                            const core::Tensor& active_points,
+                            const core::Tensor& active_cells,
+                            core::Tensor& vertex_counts,
+                            core::Tensor& triangle_counts);
+
+void MarchingCubesExtractCUDA(const core::Tensor& grid,
+                              double iso_value,
+                              const core::Tensor& grid_origin,
+                              const core::Tensor& grid_spacing,
+                              const core::Tensor& point_edges,
+                              const core::Tensor& cube_indices,
+                              const core::Tensor& active_points,
+                              const core::Tensor& active_cells,
+                              const core::Tensor& vertex_offsets,
+                              const core::Tensor& triangle_offsets,
+                              core::Tensor& vertices,
+                              core::Tensor& triangles);
+
+void ComputeTriangleEdgeKeysCUDA(const core::Tensor& triangles,
+                                 int64_t num_vertices,
+                                 core::Tensor& keys);
+
+void ComputeInverseDistanceWeightsCUDA(const core::Tensor& vertices,
+                                       const core::Tensor& neighbor_offsets,
+                                       const core::Tensor& neighbors,
+                                       core::Tensor& weights);
+
+void FilterSmoothLaplacianCUDA(const core::Tensor& neighbor_offsets,
+                               const core::Tensor& neighbors,
+                               const core::Tensor& weights,
+                               const core::Tensor& values,
+                               double lambda_filter,
+                               core::Tensor& filtered);
+
+void SubdivideLoopVerticesCUDA(const core::Tensor& neighbor_offsets,
+                               const core::Tensor& neighbors,
+                               const core::Tensor& neighbor_edges,
+                               const core::Tensor& edge_triangle_counts,
+                               const core::Tensor& values,
+                               core::Tensor& new_values);
+
+void SubdivideLoopEdgesCUDA(const core::Tensor& triangles,
+                            const core::Tensor& triangle_edges,
+                            const core::Tensor& edges,
+                            const core::Tensor& edge_triangle_counts,
+                            const core::Tensor& values,
+                            core::Tensor& new_values);
+
+void SubdivideTrianglesCUDA(const core::Tensor& triangles,
+                            const core::Tensor& triangle_edges,
+                            int64_t num_vertices,
+                            core::Tensor& new_triangles);
+#endif
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
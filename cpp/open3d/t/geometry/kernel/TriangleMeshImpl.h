@@ -0,0 +1,885 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+#include <cstdint>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/GeometryMacros.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+// Computes the cross product of the edges of the triangle, whose norm is twice
+// its area.
+template <typename scalar_t, typename result_t>
+OPEN3D_HOST_DEVICE inline void TriangleAreaVector(const scalar_t* vertices_ptr,
+                                                  const int64_t* triangle,
+                                                  result_t* n) {
+    const scalar_t* v0 = vertices_ptr + 3 * triangle[0];
+    const scalar_t* v1 = vertices_ptr + 3 * triangle[1];
+    const scalar_t* v2 = vertices_ptr + 3 * triangle[2];
+    const result_t e1[3] = {result_t(v1[0] - v0[0]), result_t(v1[1] - v0[1]),
+                            result_t(v1[2] - v0[2])};
+    const result_t e2[3] = {result_t(v2[0] - v0[0]), result_t(v2[1] - v0[1]),
+                            result_t(v2[2] - v0[2])};
+    n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+    n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+    n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+}
+
+// Atomically adds value to *address, from a ParallelFor on either device.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void AtomicAdd(scalar_t* address, scalar_t value) {
+#if defined(__CUDA_ARCH__)
+    atomicAdd(address, value);
+#else
+#pragma omp atomic
+    *address += value;
+#endif
+}
+
+// PCG hash, see Jarzynski and Olano, "Hash Functions for GPU Rendering", JCGT
+// 2020.
+OPEN3D_HOST_DEVICE inline uint32_t PCGHash(uint32_t x) {
+    const uint32_t state = x * 747796405u + 2891336453u;
+    const uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) *
+                          277803737u;
+    return (word >> 22u) ^ word;
+}
+
+// Returns the k-th uniformly distributed random number in [0, 1) of sample
+// idx, with 53 random bits.
+OPEN3D_HOST_DEVICE inline double UniformRandom(uint32_t seed,
+                                               int64_t idx,
+                                               uint32_t k) {
+    const uint32_t h0 = PCGHash(
+            seed + PCGHash(k + PCGHash(uint32_t(idx) +
+                                       PCGHash(uint32_t(idx >> 32)))));
+    const uint32_t h1 = PCGHash(h0 ^ 0x9e3779b9u);
+    return (double(h0 >> 5) * 67108864.0 + double(h1 >> 6)) /
+           9007199254740992.0;
+}
+
+#if defined(__CUDACC__)
+void ComputeTriangleNormalsCUDA
+#else
+void ComputeTriangleNormalsCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& triangles,
+         core::Tensor& normals) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    using std::sqrt;
+#endif
+    const int64_t num_triangles = triangles.GetLength();
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        const scalar_t* vertices_ptr = vertices.GetDataPtr<scalar_t>();
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(
+                num_triangles, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    scalar_t* n = normals_ptr + 3 * workload_idx;
+                    TriangleAreaVector(vertices_ptr,
+                                       triangles_ptr + 3 * workload_idx, n);
+                    const scalar_t norm =
+                            sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+                    if (norm > 0) {
+                        n[0] /= norm;
+                        n[1] /= norm;
+                        n[2] /= norm;
+                    }
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeTriangleAreasCUDA
+#else
+void ComputeTriangleAreasCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& triangles,
+         core::Tensor& areas) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    using std::sqrt;
+#endif
+    const int64_t num_triangles = triangles.GetLength();
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    double* areas_ptr = areas.GetDataPtr<double>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        const scalar_t* vertices_ptr = vertices.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(
+                num_triangles, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    double n[3];
+                    TriangleAreaVector(vertices_ptr,
+                                       triangles_ptr + 3 * workload_idx, n);
+                    areas_ptr[workload_idx] =
+                            0.5 * sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeVertexNormalsCUDA
+#else
+void ComputeVertexNormalsCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& triangles,
+         core::Tensor& normals) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    using std::sqrt;
+#endif
+    const int64_t num_vertices = vertices.GetLength();
+    const int64_t num_triangles = triangles.GetLength();
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        const scalar_t* vertices_ptr = vertices.GetDataPtr<scalar_t>();
+        scalar_t* normals_ptr = normals.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(
+                num_triangles, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t* triangle = triangles_ptr + 3 * workload_idx;
+                    scalar_t n[3];
+                    TriangleAreaVector(vertices_ptr, triangle, n);
+                    for (int i = 0; i < 3; ++i) {
+                        scalar_t* vertex_normal = normals_ptr + 3 * triangle[i];
+                        AtomicAdd(vertex_normal + 0, n[0]);
+                        AtomicAdd(vertex_normal + 1, n[1]);
+                        AtomicAdd(vertex_normal + 2, n[2]);
+                    }
+                });
+        launcher::ParallelFor(
+                num_vertices, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    scalar_t* n = normals_ptr + 3 * workload_idx;
+                    const scalar_t norm =
+                            sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+                    if (norm > 0) {
+                        n[0] /= norm;
+                        n[1] /= norm;
+                        n[2] /= norm;
+                    }
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void SampleTrianglesCUDA
+#else
+void SampleTrianglesCPU
+#endif
+        (const core::Tensor& triangle_cdf,
+         uint32_t seed,
+         core::Tensor& triangle_indices,
+         core::Tensor& barycentric) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    using std::sqrt;
+#endif
+    const int64_t num_triangles = triangle_cdf.GetLength();
+    const int64_t num_samples = triangle_indices.GetLength();
+    const double* cdf_ptr = triangle_cdf.GetDataPtr<double>();
+    int64_t* triangle_indices_ptr = triangle_indices.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(barycentric.GetDtype(), [&]() {
+        scalar_t* barycentric_ptr = barycentric.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(
+                num_samples, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    // Binary search of the first triangle whose cumulative
+                    // area exceeds the drawn area, which skips the triangles
+                    // without area.
+                    const double area =
+                            UniformRandom(seed, workload_idx, 0) *
+                            cdf_ptr[num_triangles - 1];
+                    int64_t lo = 0;
+                    int64_t hi = num_triangles - 1;
+                    while (lo < hi) {
+                        const int64_t mid = (lo + hi) / 2;
+                        if (cdf_ptr[mid] > area) {
+                            hi = mid;
+                        } else {
+                            lo = mid + 1;
+                        }
+                    }
+                    triangle_indices_ptr[workload_idx] = lo;
+
+                    // Same distribution as the legacy SamplePointsUniformly().
+                    const double r1 =
+                            sqrt(UniformRandom(seed, workload_idx, 1));
+                    const double r2 = UniformRandom(seed, workload_idx, 2);
+                    scalar_t* b = barycentric_ptr + 3 * workload_idx;
+                    b[0] = scalar_t(1 - r1);
+                    b[1] = scalar_t(r1 * (1 - r2));
+                    b[2] = scalar_t(r1 * r2);
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void AccumulateClusterQuadricsCUDA
+#else
+void AccumulateClusterQuadricsCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& triangles,
+         const core::Tensor& vertex_clusters,
+         core::Tensor& quadrics) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    using std::sqrt;
+#endif
+    const int64_t num_triangles = triangles.GetLength();
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const int64_t* clusters_ptr = vertex_clusters.GetDataPtr<int64_t>();
+    double* quadrics_ptr = quadrics.GetDataPtr<double>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        const scalar_t* vertices_ptr = vertices.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(
+                num_triangles, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t* triangle = triangles_ptr + 3 * workload_idx;
+                    double n[3];
+                    TriangleAreaVector(vertices_ptr, triangle, n);
+                    const double norm =
+                            sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+                    if (norm == 0) {
+                        return;
+                    }
+                    const double area = 0.5 * norm;
+                    n[0] /= norm;
+                    n[1] /= norm;
+                    n[2] /= norm;
+                    const scalar_t* v0 = vertices_ptr + 3 * triangle[0];
+                    const double d = -(n[0] * v0[0] + n[1] * v0[1] +
+                                       n[2] * v0[2]);
+                    const double q[9] = {area * n[0] * n[0],
+                                         area * n[0] * n[1],
+                                         area * n[0] * n[2],
+                                         area * n[1] * n[1],
+                                         area * n[1] * n[2],
+                                         area * n[2] * n[2],
+                                         area * d * n[0],
+                                         area * d * n[1],
+                                         area * d * n[2]};
+                    for (int i = 0; i < 3; ++i) {
+                        double* cluster_q =
+                                quadrics_ptr + 9 * clusters_ptr[triangle[i]];
+                        for (int j = 0; j < 9; ++j) {
+                            AtomicAdd(cluster_q + j, q[j]);
+                        }
+                    }
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void SolveClusterQuadricsCUDA
+#else
+void SolveClusterQuadricsCPU
+#endif
+        (const core::Tensor& quadrics, core::Tensor& cluster_vertices) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    using std::abs;
+#endif
+    const int64_t num_clusters = quadrics.GetLength();
+    const double* quadrics_ptr = quadrics.GetDataPtr<double>();
+    double* cluster_vertices_ptr = cluster_vertices.GetDataPtr<double>();
+    launcher::ParallelFor(num_clusters, [=] OPEN3D_DEVICE(
+                                                int64_t workload_idx) {
+        const double* q = quadrics_ptr + 9 * workload_idx;
+        // Cofactors of the symmetric matrix A.
+        const double c00 = q[3] * q[5] - q[4] * q[4];
+        const double c01 = q[2] * q[4] - q[1] * q[5];
+        const double c02 = q[1] * q[4] - q[2] * q[3];
+        const double c11 = q[0] * q[5] - q[2] * q[2];
+        const double c12 = q[1] * q[2] - q[0] * q[4];
+        const double c22 = q[0] * q[3] - q[1] * q[1];
+        const double det = q[0] * c00 + q[1] * c01 + q[2] * c02;
+        // Same threshold as the legacy Quadric::IsInvertible().
+        if (abs(det) <= 1e-4) {
+            return;
+        }
+        // The minimizer solves A x = -b.
+        const double* b = q + 6;
+        double* x = cluster_vertices_ptr + 3 * workload_idx;
+        x[0] = -(c00 * b[0] + c01 * b[1] + c02 * b[2]) / det;
+        x[1] = -(c01 * b[0] + c11 * b[1] + c12 * b[2]) / det;
+        x[2] = -(c02 * b[0] + c12 * b[1] + c22 * b[2]) / det;
+    });
+}
+
+#if defined(__CUDACC__)
+void RemapTrianglesCUDA
+#else
+void RemapTrianglesCPU
+#endif
+        (const core::Tensor& triangles,
+         const core::Tensor& vertex_clusters,
+         core::Tensor& remapped,
+         core::Tensor& valid) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+    const int64_t num_triangles = triangles.GetLength();
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const int64_t* clusters_ptr = vertex_clusters.GetDataPtr<int64_t>();
+    int64_t* remapped_ptr = remapped.GetDataPtr<int64_t>();
+    bool* valid_ptr = valid.GetDataPtr<bool>();
+    launcher::ParallelFor(num_triangles, [=] OPEN3D_DEVICE(
+                                                 int64_t workload_idx) {
+        const int64_t* triangle = triangles_ptr + 3 * workload_idx;
+        const int64_t c[3] = {clusters_ptr[triangle[0]],
+                              clusters_ptr[triangle[1]],
+                              clusters_ptr[triangle[2]]};
+        valid_ptr[workload_idx] = c[0] != c[1] && c[0] != c[2] && c[1] != c[2];
+        // The rotation keeps the orientation of the triangle.
+        const int first = c[1] < c[0] && c[1] < c[2] ? 1
+                          : c[2] < c[0] && c[2] < c[1] ? 2
+                                                       : 0;
+        int64_t* r = remapped_ptr + 3 * workload_idx;
+        r[0] = c[first];
+        r[1] = c[(first + 1) % 3];
+        r[2] = c[(first + 2) % 3];
+    });
+}
+
+// Returns the number of the owned edges of a point crossing the iso value
+// that come before direction dir.
+OPEN3D_HOST_DEVICE inline int CountEdgesBefore(uint8_t edges, int dir) {
+    int count = 0;
+    for (int i = 0; i < dir; ++i) {
+        count += (edges >> i) & 1;
+    }
+    return count;
+}
+
+#if defined(__CUDACC__)
+void MarchingCubesClassifyCUDA
+#else
+void MarchingCubesClassifyCPU
+#endif
+        (const core::Tensor& grid,
+         double iso_value,
+         core::Tensor& point_edges,
+         core::Tensor& cube_indices) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+    const int64_t nz = grid.GetShape(0);
+    const int64_t ny = grid.GetShape(1);
+    const int64_t nx = grid.GetShape(2);
+    uint8_t* point_edges_ptr = point_edges.GetDataPtr<uint8_t>();
+    uint8_t* cube_indices_ptr = cube_indices.GetDataPtr<uint8_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(grid.GetDtype(), [&]() {
+        const scalar_t* grid_ptr = grid.GetDataPtr<scalar_t>();
+        const scalar_t iso = static_cast<scalar_t>(iso_value);
+        launcher::ParallelFor(nz * ny * nx, [=] OPEN3D_DEVICE(
+                                                    int64_t workload_idx) {
+            const int64_t x = workload_idx % nx;
+            const int64_t y = (workload_idx / nx) % ny;
+            const int64_t z = workload_idx / (nx * ny);
+            const bool inside = grid_ptr[workload_idx] < iso;
+
+            uint8_t edges = 0;
+            const int64_t strides[3] = {1, nx, nx * ny};
+            const bool has_neighbor[3] = {x + 1 < nx, y + 1 < ny, z + 1 < nz};
+            for (int dir = 0; dir < 3; ++dir) {
+                if (has_neighbor[dir] &&
+                    (grid_ptr[workload_idx + strides[dir]] < iso) != inside) {
+                    edges |= uint8_t(1 << dir);
+                }
+            }
+            point_edges_ptr[workload_idx] = edges;
+
+            int cube_index = 0;
+            if (has_neighbor[0] && has_neighbor[1] && has_neighbor[2]) {
+                for (int i = 0; i < 8; ++i) {
+                    const int64_t corner = workload_idx + vtx_shifts[i][0] +
+                                           vtx_shifts[i][1] * nx +
+                                           vtx_shifts[i][2] * nx * ny;
+                    cube_index |= grid_ptr[corner] < iso ? (1 << i) : 0;
+                }
+            }
+            cube_indices_ptr[workload_idx] =
+                    uint8_t(tri_count[cube_index] > 0 ? cube_index : 0);
+        });
+    });
+}
+
+#if defined(__CUDACC__)
+void MarchingCubesCountCUDA
+#else
+void MarchingCubesCountCPU
+#endif
+        (const core::Tensor& point_edges,
+         const core::Tensor& cube_indices,
+         const core::Tensor& active_points,
+         const core::Tensor& active_cells,
+         core::Tensor& vertex_counts,
+         core::Tensor& triangle_counts) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+    const uint8_t* point_edges_ptr = point_edges.GetDataPtr<uint8_t>();
+    const uint8_t* cube_indices_ptr = cube_indices.GetDataPtr<uint8_t>();
+    const int64_t* active_points_ptr = active_points.GetDataPtr<int64_t>();
+    const int64_t* active_cells_ptr = active_cells.GetDataPtr<int64_t>();
+    int64_t* vertex_counts_ptr = vertex_counts.GetDataPtr<int64_t>();
+    int64_t* triangle_counts_ptr = triangle_counts.GetDataPtr<int64_t>();
+    launcher::ParallelFor(
+            active_points.GetLength(), [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                vertex_counts_ptr[workload_idx] = CountEdgesBefore(
+                        point_edges_ptr[active_points_ptr[workload_idx]], 3);
+            });
+    launcher::ParallelFor(
+            active_cells.GetLength(), [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                triangle_counts_ptr[workload_idx] =
+                        tri_count[cube_indices_ptr
+                                          [active_cells_ptr[workload_idx]]];
+            });
+}
+
+#if defined(__CUDACC__)
+void MarchingCubesExtractCUDA
+#else
+void MarchingCubesExtractCPU
+#endif
+        (const core::Tensor& grid,
+         double iso_value,
+         const core::Tensor& grid_origin,
+         const core::Tensor& grid_spacing,
+         const core::Tensor& point_edges,
+         const core::Tensor& cube_indices,
+         const core::Tensor& active_points,
+         const core::Tensor& active_cells,
+         const core::Tensor& vertex_offsets,
+         const core::Tensor& triangle_offsets,
+         core::Tensor& vertices,
+         core::Tensor& triangles) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+    const int64_t ny = grid.GetShape(1);
+    const int64_t nx = grid.GetShape(2);
+    const double* origin = grid_origin.GetDataPtr<double>();
+    const double* spacing = grid_spacing.GetDataPtr<double>();
+    const double ox = origin[0], oy = origin[1], oz = origin[2];
+    const double sx = spacing[0], sy = spacing[1], sz = spacing[2];
+    const int64_t num_active_points = active_points.GetLength();
+    const int64_t num_active_cells = active_cells.GetLength();
+
+    const uint8_t* point_edges_ptr = point_edges.GetDataPtr<uint8_t>();
+    const uint8_t* cube_indices_ptr = cube_indices.GetDataPtr<uint8_t>();
+    const int64_t* active_points_ptr = active_points.GetDataPtr<int64_t>();
+    const int64_t* active_cells_ptr = active_cells.GetDataPtr<int64_t>();
+    const int64_t* vertex_offsets_ptr = vertex_offsets.GetDataPtr<int64_t>();
+    const int64_t* triangle_offsets_ptr =
+            triangle_offsets.GetDataPtr<int64_t>();
+    int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(grid.GetDtype(), [&]() {
+        const scalar_t* grid_ptr = grid.GetDataPtr<scalar_t>();
+        scalar_t* vertices_ptr = vertices.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(num_active_points, [=] OPEN3D_DEVICE(
+                                                         int64_t workload_idx) {
+            const int64_t point = active_points_ptr[workload_idx];
+            const uint8_t edges = point_edges_ptr[point];
+            const int64_t x = point % nx;
+            const int64_t y = (point / nx) % ny;
+            const int64_t z = point / (nx * ny);
+            const int64_t strides[3] = {1, nx, nx * ny};
+            const double v0 = grid_ptr[point];
+
+            int64_t vertex_idx = vertex_offsets_ptr[workload_idx];
+            for (int dir = 0; dir < 3; ++dir) {
+                if (!((edges >> dir) & 1)) {
+                    continue;
+                }
+                const double v1 = grid_ptr[point + strides[dir]];
+                const double t = (iso_value - v0) / (v1 - v0);
+                scalar_t* vertex = vertices_ptr + 3 * vertex_idx;
+                vertex[0] = scalar_t(ox + sx * (x + (dir == 0 ? t : 0)));
+                vertex[1] = scalar_t(oy + sy * (y + (dir == 1 ? t : 0)));
+                vertex[2] = scalar_t(oz + sz * (z + (dir == 2 ? t : 0)));
+                ++vertex_idx;
+            }
+        });
+    });
+
+    launcher::ParallelFor(num_active_cells, [=] OPEN3D_DEVICE(
+                                                        int64_t workload_idx) {
+        const int64_t cell = active_cells_ptr[workload_idx];
+        const int cube_index = cube_indices_ptr[cell];
+        int64_t* triangle =
+                triangles_ptr + 3 * triangle_offsets_ptr[workload_idx];
+        for (int i = 0; i < 16 && tri_table[cube_index][i] != -1; ++i) {
+            const int edge = tri_table[cube_index][i];
+            const int64_t owner = cell + edge_shifts[edge][0] +
+                                  edge_shifts[edge][1] * nx +
+                                  edge_shifts[edge][2] * nx * ny;
+            const int dir = edge_shifts[edge][3];
+
+            // Binary search of the owner among the sorted active points.
+            int64_t lo = 0;
+            int64_t hi = num_active_points - 1;
+            while (lo < hi) {
+                const int64_t mid = (lo + hi) / 2;
+                if (active_points_ptr[mid] < owner) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            // Same orientation as the TSDF surface extraction.
+            triangle[3 * (i / 3) + 2 - i % 3] =
+                    vertex_offsets_ptr[lo] +
+                    CountEdgesBefore(point_edges_ptr[owner], dir);
+        }
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeTriangleEdgeKeysCUDA
+#else
+void ComputeTriangleEdgeKeysCPU
+#endif
+        (const core::Tensor& triangles,
+         int64_t num_vertices,
+         core::Tensor& keys) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    int64_t* keys_ptr = keys.GetDataPtr<int64_t>();
+    launcher::ParallelFor(
+            3 * triangles.GetLength(), [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t* triangle =
+                        triangles_ptr + 3 * (workload_idx / 3);
+                const int64_t corner = workload_idx % 3;
+                const int64_t v0 = triangle[corner];
+                const int64_t v1 = triangle[(corner + 1) % 3];
+                keys_ptr[workload_idx] = v0 < v1 ? v0 * num_vertices + v1
+                                                 : v1 * num_vertices + v0;
+            });
+}
+
+#if defined(__CUDACC__)
+void ComputeInverseDistanceWeightsCUDA
+#else
+void ComputeInverseDistanceWeightsCPU
+#endif
+        (const core::Tensor& vertices,
+         const core::Tensor& neighbor_offsets,
+         const core::Tensor& neighbors,
+         core::Tensor& weights) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+    using std::sqrt;
+#endif
+    const int64_t* offsets_ptr = neighbor_offsets.GetDataPtr<int64_t>();
+    const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+    double* weights_ptr = weights.GetDataPtr<double>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(vertices.GetDtype(), [&]() {
+        const scalar_t* vertices_ptr = vertices.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(
+                vertices.GetLength(), [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const scalar_t* v = vertices_ptr + 3 * workload_idx;
+                    double total_weight = 0;
+                    for (int64_t k = offsets_ptr[workload_idx];
+                         k < offsets_ptr[workload_idx + 1]; ++k) {
+                        const scalar_t* nb =
+                                vertices_ptr + 3 * neighbors_ptr[k];
+                        const double d[3] = {double(v[0] - nb[0]),
+                                             double(v[1] - nb[1]),
+                                             double(v[2] - nb[2])};
+                        const double weight =
+                                1. / (sqrt(d[0] * d[0] + d[1] * d[1] +
+                                           d[2] * d[2]) +
+                                      1e-12);
+                        weights_ptr[k] = weight;
+                        total_weight += weight;
+                    }
+                    for (int64_t k = offsets_ptr[workload_idx];
+                         k < offsets_ptr[workload_idx + 1]; ++k) {
+                        weights_ptr[k] /= total_weight;
+                    }
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void FilterSmoothLaplacianCUDA
+#else
+void FilterSmoothLaplacianCPU
+#endif
+        (const core::Tensor& neighbor_offsets,
+         const core::Tensor& neighbors,
+         const core::Tensor& weights,
+         const core::Tensor& values,
+         double lambda_filter,
+         core::Tensor& filtered) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+    const int64_t num_channels = values.GetShape(1);
+    const int64_t* offsets_ptr = neighbor_offsets.GetDataPtr<int64_t>();
+    const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+    const double* weights_ptr = weights.GetDataPtr<double>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        scalar_t* filtered_ptr = filtered.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(
+                values.GetLength() * num_channels,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t vidx = workload_idx / num_channels;
+                    const int64_t channel = workload_idx % num_channels;
+                    const double value = values_ptr[workload_idx];
+                    if (offsets_ptr[vidx] == offsets_ptr[vidx + 1]) {
+                        // Vertices without neighbors keep their values.
+                        filtered_ptr[workload_idx] = scalar_t(value);
+                        return;
+                    }
+                    double mean = 0;
+                    for (int64_t k = offsets_ptr[vidx];
+                         k < offsets_ptr[vidx + 1]; ++k) {
+                        mean += weights_ptr[k] *
+                                values_ptr[neighbors_ptr[k] * num_channels +
+                                           channel];
+                    }
+                    filtered_ptr[workload_idx] =
+                            scalar_t(value + lambda_filter * (mean - value));
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void SubdivideLoopVerticesCUDA
+#else
+void SubdivideLoopVerticesCPU
+#endif
+        (const core::Tensor& neighbor_offsets,
+         const core::Tensor& neighbors,
+         const core::Tensor& neighbor_edges,
+         const core::Tensor& edge_triangle_counts,
+         const core::Tensor& values,
+         core::Tensor& new_values) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+    const int64_t num_channels = values.GetShape(1);
+    const int64_t* offsets_ptr = neighbor_offsets.GetDataPtr<int64_t>();
+    const int64_t* neighbors_ptr = neighbors.GetDataPtr<int64_t>();
+    const int64_t* neighbor_edges_ptr = neighbor_edges.GetDataPtr<int64_t>();
+    const int64_t* counts_ptr = edge_triangle_counts.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        scalar_t* new_values_ptr = new_values.GetDataPtr<scalar_t>();
+        launcher::ParallelFor(
+                values.GetLength() * num_channels,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t vidx = workload_idx / num_channels;
+                    const int64_t channel = workload_idx % num_channels;
+                    const int64_t begin = offsets_ptr[vidx];
+                    const int64_t end = offsets_ptr[vidx + 1];
+                    const int64_t n_nbs = end - begin;
+                    double all_sum = 0;
+                    double boundary_sum = 0;
+                    int64_t n_boundary_nbs = 0;
+                    for (int64_t k = begin; k < end; ++k) {
+                        const double nb_value =
+                                values_ptr[neighbors_ptr[k] * num_channels +
+                                           channel];
+                        all_sum += nb_value;
+                        if (counts_ptr[neighbor_edges_ptr[k]] == 1) {
+                            boundary_sum += nb_value;
+                            n_boundary_nbs++;
+                        }
+                    }
+                    // Weights of the legacy SubdivideLoop(), isolated
+                    // vertices are kept.
+                    double beta = 0;
+                    double sum = 0;
+                    int64_t n_used_nbs = 0;
+                    if (n_boundary_nbs >= 2) {
+                        beta = 1. / 8.;
+                        sum = boundary_sum;
+                        n_used_nbs = n_boundary_nbs;
+                    } else if (n_nbs == 3) {
+                        beta = 3. / 16.;
+                        sum = all_sum;
+                        n_used_nbs = n_nbs;
+                    } else if (n_nbs > 0) {
+                        beta = 3. / (8. * n_nbs);
+                        sum = all_sum;
+                        n_used_nbs = n_nbs;
+                    }
+                    const double alpha = 1. - n_used_nbs * beta;
+                    new_values_ptr[workload_idx] = scalar_t(
+                            alpha * values_ptr[workload_idx] + beta * sum);
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void SubdivideLoopEdgesCUDA
+#else
+void SubdivideLoopEdgesCPU
+#endif
+        (const core::Tensor& triangles,
+         const core::Tensor& triangle_edges,
+         const core::Tensor& edges,
+         const core::Tensor& edge_triangle_counts,
+         const core::Tensor& values,
+         core::Tensor& new_values) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+    const int64_t num_vertices = values.GetLength();
+    const int64_t num_channels = values.GetShape(1);
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const int64_t* triangle_edges_ptr = triangle_edges.GetDataPtr<int64_t>();
+    const int64_t* edges_ptr = edges.GetDataPtr<int64_t>();
+    const int64_t* counts_ptr = edge_triangle_counts.GetDataPtr<int64_t>();
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+        scalar_t* edge_values_ptr =
+                new_values.GetDataPtr<scalar_t>() + num_vertices * num_channels;
+        // Boundary edges get their midpoint, interior edges 3/8 of their end
+        // points plus 1/8 of the opposite vertices, added per triangle.
+        launcher::ParallelFor(
+                edges.GetLength() * num_channels,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t eidx = workload_idx / num_channels;
+                    const int64_t channel = workload_idx % num_channels;
+                    const double sum =
+                            double(values_ptr[edges_ptr[2 * eidx] *
+                                                      num_channels +
+                                              channel]) +
+                            values_ptr[edges_ptr[2 * eidx + 1] * num_channels +
+                                       channel];
+                    edge_values_ptr[workload_idx] = scalar_t(
+                            counts_ptr[eidx] < 2 ? 0.5 * sum : 3. / 8. * sum);
+                });
+        launcher::ParallelFor(
+                triangles.GetLength() * 3,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t eidx = triangle_edges_ptr[workload_idx];
+                    const int64_t count = counts_ptr[eidx];
+                    if (count < 2) {
+                        return;
+                    }
+                    const int64_t* triangle =
+                            triangles_ptr + 3 * (workload_idx / 3);
+                    const int64_t corner = workload_idx % 3;
+                    const int64_t opposite = triangle[(corner + 2) % 3];
+                    const scalar_t scale = scalar_t(1. / (4. * count));
+                    for (int64_t c = 0; c < num_channels; ++c) {
+                        AtomicAdd(edge_values_ptr + eidx * num_channels + c,
+                                  scale * values_ptr[opposite * num_channels +
+                                                     c]);
+                    }
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void SubdivideTrianglesCUDA
+#else
+void SubdivideTrianglesCPU
+#endif
+        (const core::Tensor& triangles,
+         const core::Tensor& triangle_edges,
+         int64_t num_vertices,
+         core::Tensor& new_triangles) {
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+    const int64_t* triangles_ptr = triangles.GetDataPtr<int64_t>();
+    const int64_t* triangle_edges_ptr = triangle_edges.GetDataPtr<int64_t>();
+    int64_t* new_triangles_ptr = new_triangles.GetDataPtr<int64_t>();
+    launcher::ParallelFor(
+            triangles.GetLength(), [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                const int64_t* triangle = triangles_ptr + 3 * workload_idx;
+                const int64_t* edges = triangle_edges_ptr + 3 * workload_idx;
+                const int64_t v01 = num_vertices + edges[0];
+                const int64_t v12 = num_vertices + edges[1];
+                const int64_t v20 = num_vertices + edges[2];
+                const int64_t sub_triangles[12] = {
+                        triangle[0], v01, v20, v01, triangle[1], v12,
+                        v12, triangle[2], v20, v01, v12, v20};
+                int64_t* out = new_triangles_ptr + 12 * workload_idx;
+                for (int i = 0; i < 12; ++i) {
+                    out[i] = sub_triangles[i];
+                }
+            });
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
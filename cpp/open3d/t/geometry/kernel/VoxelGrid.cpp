@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+void Carve(const core::Tensor& voxel_indices,
+           const core::Tensor& image,
+           const core::Tensor& intrinsics,
+           const core::Tensor& extrinsics,
+           const core::Tensor& origin,
+           double voxel_size,
+           bool compare_depth,
+           bool keep_voxels_outside_image,
+           core::Tensor& keep) {
+    voxel_indices.AssertShapeCompatible({utility::nullopt, 3});
+    voxel_indices.AssertDtype(core::Dtype::Int32);
+    image.AssertDtype(core::Dtype::Float32);
+    image.AssertDevice(voxel_indices.GetDevice());
+    if (image.NumDims() != 2) {
+        utility::LogError("image must be {h, w}, but got {}.",
+                          image.GetShape().ToString());
+    }
+    intrinsics.AssertShape({3, 3});
+    extrinsics.AssertShape({4, 4});
+    origin.AssertShape({3});
+
+    core::Device device = voxel_indices.GetDevice();
+    core::Device::DeviceType device_type = device.GetType();
+
+    static const core::Device host("CPU:0");
+    core::Tensor intrinsics_d =
+            intrinsics.To(host, core::Dtype::Float64).Contiguous();
+    core::Tensor extrinsics_d =
+            extrinsics.To(host, core::Dtype::Float64).Contiguous();
+    core::Tensor origin_d = origin.To(host, core::Dtype::Float64).Contiguous();
+    core::Tensor voxel_indices_c = voxel_indices.Contiguous();
+    core::Tensor image_c = image.Contiguous();
+
+    if (device_type == core::Device::DeviceType::CPU) {
+        CarveCPU(voxel_indices_c, image_c, intrinsics_d, extrinsics_d,
+                 origin_d, voxel_size, compare_depth,
+                 keep_voxels_outside_image, keep);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(CarveCUDA, voxel_indices_c, image_c, intrinsics_d,
+                  extrinsics_d, origin_d, voxel_size, compare_depth,
+                  keep_voxels_outside_image, keep);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+/// Computes which voxels survive carving with an image, as
+/// geometry::VoxelGrid::CarveDepthMap and CarveSilhouette do: the 8 corners
+/// of every voxel are projected into the image, whose values are bilinearly
+/// interpolated. A voxel is kept if a corner projects within the image to a
+/// positive value and, for a depth map, lies at or behind that depth, or if
+/// a corner projects outside of the image and keep_voxels_outside_image.
+///
+/// \param voxel_indices Int32 tensor {n, 3} of voxel grid indices.
+/// \param image Float32 tensor {h, w} of depths or mask values.
+/// \param intrinsics Float64 CPU tensor {3, 3}.
+/// \param extrinsics Float64 CPU tensor {4, 4}, world to camera.
+/// \param origin Float64 CPU tensor {3}, the origin of the voxel grid.
+/// \param voxel_size Edge length of the voxels.
+/// \param compare_depth If true, \p image is a depth map, otherwise a
+/// silhouette mask.
+/// \param keep_voxels_outside_image Keep voxels with a corner projecting
+/// outside of the image.
+/// \param keep Output Bool tensor {n}, true for the voxels that are kept.
+void Carve(const core::Tensor& voxel_indices,
+           const core::Tensor& image,
+           const core::Tensor& intrinsics,
+           const core::Tensor& extrinsics,
+           const core::Tensor& origin,
+           double voxel_size,
+           bool compare_depth,
+           bool keep_voxels_outside_image,
+           core::Tensor& keep);
+
+void CarveCPU(const core::Tensor& voxel_indices,
+              const core::Tensor& image,
+              const core::Tensor& intrinsics,
+              const core::Tensor& extrinsics,
+              const core::Tensor& origin,
+              double voxel_size,
+              bool compare_depth,
+              bool keep_voxels_outside_image,
+              core::Tensor& keep);
+
+#ifdef BUILD_CUDA_MODULE
+void CarveCUDA(const core::Tensor& voxel_indices,
+               const core::Tensor& image,
+               const core::Tensor& intrinsics,
+               const core::Tensor& extrinsics,
+               const core::Tensor& origin,
+               double voxel_size,
+               bool compare_depth,
+               bool keep_voxels_outside_image,
+               core::Tensor& keep);
+#endif
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
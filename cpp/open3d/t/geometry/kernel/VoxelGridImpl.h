@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/GeometryMacros.h"
+#include "open3d/t/geometry/kernel/VoxelGrid.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace voxel_grid {
+
+/// Pinhole projection of world points, copied by value into the kernels.
+struct CarveCamera {
+    double intrinsics[3][3];
+    double extrinsics[3][4];
+};
+
+#if defined(__CUDACC__)
+void CarveCUDA
+#else
+void CarveCPU
+#endif
+        (const core::Tensor& voxel_indices,
+         const core::Tensor& image,
+         const core::Tensor& intrinsics,
+         const core::Tensor& extrinsics,
+         const core::Tensor& origin,
+         double voxel_size,
+         bool compare_depth,
+         bool keep_voxels_outside_image,
+         core::Tensor& keep) {
+    const int64_t n = voxel_indices.GetLength();
+    keep = core::Tensor({n}, core::Dtype::Bool, voxel_indices.GetDevice());
+    bool* keep_ptr = keep.GetDataPtr<bool>();
+    const int* indices_ptr = voxel_indices.GetDataPtr<int>();
+    const float* image_ptr = image.GetDataPtr<float>();
+    const int64_t height = image.GetShape(0);
+    const int64_t width = image.GetShape(1);
+
+    CarveCamera camera;
+    const double* intrinsics_ptr = intrinsics.GetDataPtr<double>();
+    const double* extrinsics_ptr = extrinsics.GetDataPtr<double>();
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            camera.intrinsics[i][j] = intrinsics_ptr[3 * i + j];
+        }
+        for (int j = 0; j < 4; ++j) {
+            camera.extrinsics[i][j] = extrinsics_ptr[4 * i + j];
+        }
+    }
+    const double* origin_ptr = origin.GetDataPtr<double>();
+    const double origin_x = origin_ptr[0];
+    const double origin_y = origin_ptr[1];
+    const double origin_z = origin_ptr[2];
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const int* index = indices_ptr + 3 * workload_idx;
+        const double r = voxel_size / 2;
+        const double center[3] = {(index[0] + 0.5) * voxel_size + origin_x,
+                                  (index[1] + 0.5) * voxel_size + origin_y,
+                                  (index[2] + 0.5) * voxel_size + origin_z};
+        bool carve = true;
+        for (int corner = 0; corner < 8 && carve; ++corner) {
+            const double x[3] = {center[0] + ((corner & 4) ? r : -r),
+                                 center[1] + ((corner & 2) ? r : -r),
+                                 center[2] + ((corner & 1) ? r : -r)};
+            double x_cam[3], uvz[3];
+            for (int i = 0; i < 3; ++i) {
+                x_cam[i] = camera.extrinsics[i][0] * x[0] +
+                           camera.extrinsics[i][1] * x[1] +
+                           camera.extrinsics[i][2] * x[2] +
+                           camera.extrinsics[i][3];
+            }
+            for (int i = 0; i < 3; ++i) {
+                uvz[i] = camera.intrinsics[i][0] * x_cam[0] +
+                         camera.intrinsics[i][1] * x_cam[1] +
+                         camera.intrinsics[i][2] * x_cam[2];
+            }
+            const double z = uvz[2];
+            const double u = uvz[0] / z;
+            const double v = uvz[1] / z;
+
+            // Bilinear interpolation as in geometry::Image::FloatValueAt.
+            const bool within_boundary =
+                    u >= 0 && u <= double(width - 1) && v >= 0 &&
+                    v <= double(height - 1);
+            if (!within_boundary) {
+                if (keep_voxels_outside_image) {
+                    carve = false;
+                }
+                continue;
+            }
+            int64_t ui = int64_t(u);
+            int64_t vi = int64_t(v);
+            ui = ui > width - 2 ? width - 2 : ui;
+            vi = vi > height - 2 ? height - 2 : vi;
+            ui = ui < 0 ? 0 : ui;
+            vi = vi < 0 ? 0 : vi;
+            const double pu = u - ui;
+            const double pv = v - vi;
+            const float* p00 = image_ptr + vi * width + ui;
+            const double d = (p00[0] * (1 - pv) + p00[width] * pv) * (1 - pu) +
+                             (p00[1] * (1 - pv) + p00[width + 1] * pv) * pu;
+            if (d > 0 && (!compare_depth || z >= d)) {
+                carve = false;
+            }
+        }
+        keep_ptr[workload_idx] = !carve;
+    });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
+}  // namespace voxel_grid
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
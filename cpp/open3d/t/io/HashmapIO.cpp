@@ -0,0 +1,111 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/HashmapIO.h"
+
+#include <algorithm>
+
+#include "open3d/core/SizeVector.h"
+#include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/io/TensorMapIO.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+bool WriteHashmap(const std::string &filename,
+                  const core::Hashmap &hashmap,
+                  bool compressed) {
+    core::Tensor keys = hashmap.GetKeyTensor();
+    core::Tensor values = hashmap.GetValueTensor();
+    if (hashmap.Size() > 0) {
+        core::Tensor active_addrs;
+        hashmap.GetActiveIndices(active_addrs);
+        core::Tensor active_indices = active_addrs.To(core::Dtype::Int64);
+        keys = keys.IndexGet({active_indices});
+        values = values.IndexGet({active_indices});
+    } else {
+        keys = keys.Slice(0, 0, 0);
+        values = values.Slice(0, 0, 0);
+    }
+
+    geometry::TensorMap tensor_map("keys");
+    tensor_map["keys"] = keys;
+    tensor_map["values"] = values;
+    tensor_map["capacity"] =
+            core::Tensor::Init<int64_t>({hashmap.GetCapacity()});
+    return WriteTensorMap(filename, tensor_map, compressed);
+}
+
+std::shared_ptr<core::Hashmap> CreateHashmapFromFile(
+        const std::string &filename,
+        const core::Device &device,
+        const core::HashmapBackend &backend,
+        core::Tensor::MmapMode mmap_mode) {
+    geometry::TensorMap tensor_map("keys");
+    if (!ReadTensorMap(filename, tensor_map, device, mmap_mode)) {
+        return nullptr;
+    }
+    if (!tensor_map.Contains("keys") || !tensor_map.Contains("values") ||
+        !tensor_map.Contains("capacity")) {
+        utility::LogWarning("Read Hashmap failed: {} is not a Hashmap file.",
+                            filename);
+        return nullptr;
+    }
+
+    const core::Tensor &keys = tensor_map["keys"];
+    const core::Tensor &values = tensor_map["values"];
+    const core::Tensor &capacity = tensor_map["capacity"];
+    if (keys.NumDims() == 0 || values.NumDims() == 0 ||
+        keys.GetLength() != values.GetLength() ||
+        capacity.GetDtype() != core::Dtype::Int64 ||
+        capacity.NumElements() != 1) {
+        utility::LogWarning("Read Hashmap failed: {} is malformed.", filename);
+        return nullptr;
+    }
+
+    const int64_t size = keys.GetLength();
+    const int64_t init_capacity =
+            std::max(capacity.To(core::Device("CPU:0")).Item<int64_t>(), size);
+    core::SizeVector element_shape_key = keys.GetShape();
+    element_shape_key.erase(element_shape_key.begin());
+    core::SizeVector element_shape_value = values.GetShape();
+    element_shape_value.erase(element_shape_value.begin());
+
+    auto hashmap = std::make_shared<core::Hashmap>(
+            init_capacity, keys.GetDtype(), values.GetDtype(),
+            element_shape_key, element_shape_value, device, backend);
+    if (size > 0) {
+        core::Tensor addrs, masks;
+        hashmap->Insert(keys, values, addrs, masks);
+    }
+    return hashmap;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,70 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Writes the active entries of a Hashmap to a native binary file (see
+/// WriteTensorMap). Only the active keys and values are stored, contiguously,
+/// along with the capacity of the hashmap.
+///
+/// \param filename Path to the file, typically with the extension ".o3dt".
+/// \param hashmap The Hashmap to write.
+/// \param compressed If true, blocks are compressed with LZF.
+/// \return return true if the write function is successful, false otherwise.
+bool WriteHashmap(const std::string &filename,
+                  const core::Hashmap &hashmap,
+                  bool compressed = false);
+
+/// Factory function to create a Hashmap from a file written by
+/// WriteHashmap. The keys and values are read straight onto \p device and
+/// inserted with one parallel batch insertion.
+///
+/// \param filename Path to the file.
+/// \param device The device of the created Hashmap.
+/// \param backend The backend of the created Hashmap.
+/// \param mmap_mode If not MmapMode::None, uncompressed blocks are read from
+/// a memory mapping of the file.
+/// \return The Hashmap, or nullptr if the file cannot be read.
+std::shared_ptr<core::Hashmap> CreateHashmapFromFile(
+        const std::string &filename,
+        const core::Device &device = core::Device("CPU:0"),
+        const core::HashmapBackend &backend = core::HashmapBackend::Default,
+        core::Tensor::MmapMode mmap_mode = core::Tensor::MmapMode::None);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
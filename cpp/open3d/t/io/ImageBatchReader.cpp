@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ImageBatchReader.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+size_t GetNumThreads(int num_threads, size_t capacity, size_t num_images) {
+    if (num_threads <= 0) {
+        num_threads = int(std::max(std::thread::hardware_concurrency(), 1u));
+    }
+    return std::min({size_t(num_threads), std::max(capacity, size_t(1)),
+                     std::max(num_images, size_t(1))});
+}
+
+}  // namespace
+
+ImageBatchReader::ImageBatchReader(const std::vector<std::string> &filenames,
+                                   const core::Device &device,
+                                   int num_threads,
+                                   size_t capacity)
+    : filenames_(filenames),
+      device_(device),
+      prefetcher_(
+              [this](size_t index, geometry::Image &image) {
+                  return Load(index, image);
+              },
+              device,
+              capacity,
+              GetNumThreads(num_threads, capacity, filenames.size())) {}
+
+ImageBatchReader::~ImageBatchReader() {}
+
+bool ImageBatchReader::Pop(geometry::Image &image) {
+    return prefetcher_.Pop(image);
+}
+
+bool ImageBatchReader::Load(size_t index, geometry::Image &image) {
+    if (index >= filenames_.size()) {
+        return false;
+    }
+    try {
+        if (!ReadImage(filenames_[index], image)) {
+            image = geometry::Image();
+        } else if (device_.GetType() == core::Device::DeviceType::CUDA) {
+            // Pinned staging memory is uploaded asynchronously at full
+            // bandwidth, and is cached by the pinned memory manager.
+            image = geometry::Image(image.AsTensor().PinMemory().To(device_));
+        } else if (device_ != image.GetDevice()) {
+            image = image.To(device_);
+        }
+    } catch (const std::exception &e) {
+        utility::LogWarning("[ImageBatchReader] Failed to read {}: {}",
+                            filenames_[index], e.what());
+        image = geometry::Image();
+    }
+    return true;
+}
+
+std::vector<geometry::Image> ReadImages(
+        const std::vector<std::string> &filenames,
+        const core::Device &device,
+        int num_threads) {
+    std::vector<geometry::Image> images(filenames.size());
+    ImageBatchReader reader(filenames, device, num_threads,
+                            std::max(filenames.size(), size_t(1)));
+    for (geometry::Image &image : images) {
+        reader.Pop(image);
+    }
+    return images;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Prefetcher.h"
+#include "open3d/t/geometry/Image.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class ImageBatchReader
+///
+/// \brief Reads a sequence of image files with a pool of decoding threads
+/// ahead of the caller, so that reading and decoding image k + 1, k + 2, ...
+/// overlaps with processing image k. The images are returned in order. On
+/// CUDA devices each thread stages its images in pinned memory and uploads
+/// them on a stream of its own.
+///
+/// At most capacity images are decoded ahead of Pop(), see core::Prefetcher.
+///
+/// For RGB-D sequences, the depth and color files can be interleaved in one
+/// reader or read by two readers.
+class ImageBatchReader {
+public:
+    /// \brief Parameterized Constructor, starting the decoding threads.
+    ///
+    /// \param filenames Image files, read with ReadImage().
+    /// \param device Device of the returned images.
+    /// \param num_threads Number of decoding threads. 0 for the number of
+    /// hardware threads, at most \p capacity.
+    /// \param capacity Maximum number of images decoded ahead of Pop().
+    ImageBatchReader(const std::vector<std::string> &filenames,
+                     const core::Device &device = core::Device("CPU:0"),
+                     int num_threads = 0,
+                     size_t capacity = 8);
+
+    /// Stops and joins the decoding threads, dropping the images not popped.
+    ~ImageBatchReader();
+
+    ImageBatchReader(const ImageBatchReader &) = delete;
+    ImageBatchReader &operator=(const ImageBatchReader &) = delete;
+
+    /// Moves the next image into \p image. The image is empty if its file
+    /// cannot be read. Returns false once all images have been popped.
+    bool Pop(geometry::Image &image);
+
+    /// Number of images popped so far, i.e. the index of the next image.
+    size_t GetNumPopped() const { return prefetcher_.GetNumPopped(); }
+
+    /// Total number of images.
+    size_t GetNumImages() const { return filenames_.size(); }
+
+private:
+    /// Reads and uploads the image \p index on a decoding thread.
+    bool Load(size_t index, geometry::Image &image);
+
+    std::vector<std::string> filenames_;
+    core::Device device_;
+
+    /// Declared last, so that the decoding threads are joined first.
+    core::Prefetcher<geometry::Image> prefetcher_;
+};
+
+/// Reads \p filenames with an ImageBatchReader of \p num_threads threads.
+/// Returns the images in order, empty if a file cannot be read.
+std::vector<geometry::Image> ReadImages(
+        const std::vector<std::string> &filenames,
+        const core::Device &device = core::Device("CPU:0"),
+        int num_threads = 0);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
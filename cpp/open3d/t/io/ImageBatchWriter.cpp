@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ImageBatchWriter.h"
+
+#include <algorithm>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+ImageBatchWriter::ImageBatchWriter(int num_threads,
+                                   size_t capacity,
+                                   int quality)
+    : quality_(quality), capacity_(std::max(capacity, size_t(1))) {
+    if (num_threads <= 0) {
+        num_threads = int(std::max(std::thread::hardware_concurrency(), 1u));
+    }
+    num_threads = int(std::min(size_t(num_threads), capacity_));
+    for (int i = 0; i < num_threads; ++i) {
+        threads_.emplace_back(&ImageBatchWriter::Run, this);
+    }
+}
+
+ImageBatchWriter::~ImageBatchWriter() {
+    Flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    not_empty_.notify_all();
+    for (std::thread &thread : threads_) {
+        thread.join();
+    }
+}
+
+void ImageBatchWriter::Push(const std::string &filename,
+                            const geometry::Image &image) {
+    geometry::Image cpu_image = image.To(core::Device("CPU:0"), /*copy=*/true);
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this] { return queue_.size() < capacity_; });
+        queue_.emplace_back(filename, std::move(cpu_image));
+        ++num_pending_;
+    }
+    not_empty_.notify_one();
+}
+
+bool ImageBatchWriter::Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return num_pending_ == 0; });
+    const bool success = !failed_;
+    failed_ = false;
+    return success;
+}
+
+void ImageBatchWriter::Run() {
+    while (true) {
+        std::pair<std::string, geometry::Image> item;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            not_empty_.wait(lock, [this] { return !queue_.empty() || stop_; });
+            if (queue_.empty()) {
+                break;
+            }
+            item = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        not_full_.notify_one();
+
+        bool success;
+        try {
+            success = WriteImage(item.first, item.second, quality_);
+        } catch (const std::exception &e) {
+            utility::LogWarning("[ImageBatchWriter] Failed to write {}: {}",
+                                item.first, e.what());
+            success = false;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            failed_ = failed_ || !success;
+            --num_pending_;
+        }
+        done_.notify_all();
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
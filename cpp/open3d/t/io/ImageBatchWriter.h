@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/io/ImageIO.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class ImageBatchWriter
+///
+/// \brief Writes images with a pool of encoding threads behind the caller, so
+/// that encoding image k overlaps with producing image k + 1. A PNG or JPG
+/// stream is compressed sequentially, hence images are encoded in parallel
+/// rather than parts of one image.
+///
+/// At most capacity images wait to be written: Push() blocks while the queue
+/// is full, which bounds the memory held by the writer.
+class ImageBatchWriter {
+public:
+    /// \brief Parameterized Constructor, starting the encoding threads.
+    ///
+    /// \param num_threads Number of encoding threads. 0 for the number of
+    /// hardware threads, at most \p capacity.
+    /// \param capacity Maximum number of images waiting to be written.
+    /// \param quality Quality passed to WriteImage().
+    ImageBatchWriter(int num_threads = 0,
+                     size_t capacity = 8,
+                     int quality = kOpen3DImageIODefaultQuality);
+
+    /// Writes the pending images, then joins the encoding threads.
+    ~ImageBatchWriter();
+
+    ImageBatchWriter(const ImageBatchWriter &) = delete;
+    ImageBatchWriter &operator=(const ImageBatchWriter &) = delete;
+
+    /// Queues \p image to be written to \p filename with WriteImage(). The
+    /// image is copied to the CPU, so it can be modified once Push() returns.
+    void Push(const std::string &filename, const geometry::Image &image);
+
+    /// Waits until all pushed images are written. Returns false if any write
+    /// failed since the previous Flush().
+    bool Flush();
+
+private:
+    void Run();
+
+    int quality_;
+    size_t capacity_;
+
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+    std::condition_variable done_;
+    /// Images waiting to be written.
+    std::deque<std::pair<std::string, geometry::Image>> queue_;
+    /// Number of images queued or being written.
+    size_t num_pending_ = 0;
+    bool failed_ = false;
+    bool stop_ = false;
+
+    std::vector<std::thread> threads_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
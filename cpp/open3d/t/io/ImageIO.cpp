@@ -28,6 +28,7 @@
 
 #include <unordered_map>
 
+#include "open3d/core/Profiler.h"
 #include "open3d/io/ImageIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
@@ -43,15 +44,20 @@ static const std::unordered_map<
                 {"png", ReadImageFromPNG},
                 {"jpg", ReadImageFromJPG},
                 {"jpeg", ReadImageFromJPG},
+                {"o3dt", ReadImageFromO3DT},
         };
 
 static const std::unordered_map<
         std::string,
         std::function<bool(const std::string &, const geometry::Image &, int)>>
         file_extension_to_image_write_function{
-                {"png", WriteImageToPNG},
+                {"png",
+                 static_cast<bool (*)(const std::string &,
+                                      const geometry::Image &, int)>(
+                         WriteImageToPNG)},
                 {"jpg", WriteImageToJPG},
                 {"jpeg", WriteImageToJPG},
+                {"o3dt", WriteImageToO3DT},
         };
 
 std::shared_ptr<geometry::Image> CreateImageFromFile(
@@ -62,6 +68,7 @@ std::shared_ptr<geometry::Image> CreateImageFromFile(
 }
 
 bool ReadImage(const std::string &filename, geometry::Image &image) {
+    OPEN3D_PROFILE_SCOPE("t::io::ReadImage");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
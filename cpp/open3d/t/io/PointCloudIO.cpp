@@ -29,6 +29,7 @@
 #include <iostream>
 #include <unordered_map>
 
+#include "open3d/core/Profiler.h"
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -47,6 +48,7 @@ static const std::unordered_map<
         file_extension_to_pointcloud_read_function{
                 {"xyzi", ReadPointCloudFromXYZI},
                 {"ply", ReadPointCloudFromPLY},
+                {"pcd", ReadPointCloudFromPCD},
                 {"pts", ReadPointCloudFromPTS},
         };
 
@@ -58,6 +60,7 @@ static const std::unordered_map<
         file_extension_to_pointcloud_write_function{
                 {"xyzi", WritePointCloudToXYZI},
                 {"ply", WritePointCloudToPLY},
+                {"pcd", WritePointCloudToPCD},
                 {"pts", WritePointCloudToPTS},
         };
 
@@ -73,6 +76,7 @@ std::shared_ptr<geometry::PointCloud> CreatePointCloudFromFile(
 bool ReadPointCloud(const std::string &filename,
                     geometry::PointCloud &pointcloud,
                     const open3d::io::ReadPointCloudOption &params) {
+    OPEN3D_PROFILE_SCOPE("t::io::ReadPointCloud");
     std::string format = params.format;
     if (format == "auto") {
         format = utility::filesystem::GetFileExtensionInLowerCase(filename);
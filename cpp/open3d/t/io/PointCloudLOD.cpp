@@ -0,0 +1,929 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudLOD.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <queue>
+#include <unordered_map>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/io/IJsonConvertibleIO.h"
+#include "open3d/t/io/PointCloudStreamReader.h"
+#include "open3d/t/io/TensorMapIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+/// The points are counted in a grid of 2^kCountLevel cells along each side of
+/// the root to find the subtrees that fit into memory.
+constexpr int kCountLevel = 7;
+
+/// Nodes deeper than this are leaves, which bounds the depth for duplicated
+/// points.
+constexpr int kMaxDepth = 24;
+
+/// Returns the cube of the node \p name of the octree with the root cube
+/// \p root_min_bound and \p root_size.
+void GetNodeCube(const std::string &name,
+                 const Eigen::Vector3d &root_min_bound,
+                 double root_size,
+                 Eigen::Vector3d &min_bound,
+                 double &size) {
+    min_bound = root_min_bound;
+    size = root_size;
+    for (size_t i = 1; i < name.size(); ++i) {
+        const int child = name[i] - '0';
+        size /= 2;
+        min_bound += size * Eigen::Vector3d(child & 1, (child >> 1) & 1,
+                                            (child >> 2) & 1);
+    }
+}
+
+/// Index of the cell of \p value in \p num_cells cells of [\p min, \p min +
+/// \p size).
+inline int64_t GetCell(double value,
+                       double min,
+                       double size,
+                       int64_t num_cells) {
+    const int64_t cell = int64_t(std::floor((value - min) / size * num_cells));
+    return std::min(std::max(cell, int64_t(0)), num_cells - 1);
+}
+
+/// Source of the points of WritePointCloudLOD, read in batches.
+class PointSource {
+public:
+    virtual ~PointSource() {}
+    /// Restarts reading at the first point.
+    virtual bool Reset() = 0;
+    /// Reads the next batch of points into \p batch. Returns false at the end.
+    virtual bool Next(geometry::PointCloud &batch) = 0;
+};
+
+class FileSource : public PointSource {
+public:
+    FileSource(const std::string &filename, int64_t batch_size)
+        : filename_(filename), batch_size_(batch_size) {}
+
+    bool Reset() override { return reader_.Open(filename_); }
+
+    bool Next(geometry::PointCloud &batch) override {
+        return reader_.ReadNext(batch_size_, batch);
+    }
+
+private:
+    std::string filename_;
+    int64_t batch_size_;
+    PointCloudStreamReader reader_;
+};
+
+class MemorySource : public PointSource {
+public:
+    MemorySource(const geometry::PointCloud &pointcloud, int64_t batch_size)
+        : pointcloud_(pointcloud), batch_size_(batch_size) {}
+
+    bool Reset() override {
+        offset_ = 0;
+        return true;
+    }
+
+    bool Next(geometry::PointCloud &batch) override {
+        const int64_t num_points = pointcloud_.GetPoints().GetLength();
+        if (offset_ >= num_points) {
+            return false;
+        }
+        const int64_t end = std::min(num_points, offset_ + batch_size_);
+        batch.Clear();
+        for (const auto &it : pointcloud_.GetPointAttr()) {
+            batch.SetPointAttr(it.first, it.second.Slice(0, offset_, end));
+        }
+        offset_ = end;
+        return true;
+    }
+
+private:
+    const geometry::PointCloud &pointcloud_;
+    int64_t batch_size_;
+    int64_t offset_ = 0;
+};
+
+/// Point attribute, stored at offset_ of the records of the chunk files.
+struct LODAttribute {
+    std::string name_;
+    core::Dtype dtype_;
+    /// Shape of the attribute of one point.
+    core::SizeVector shape_;
+    int64_t row_bytes_ = 0;
+    int64_t offset_ = 0;
+};
+
+/// Returns the attributes of \p batch sorted by name, and the byte size of a
+/// record of all of them.
+std::vector<LODAttribute> GetAttributes(const geometry::PointCloud &batch,
+                                        int64_t &record_bytes) {
+    std::map<std::string, core::Tensor> sorted(batch.GetPointAttr().begin(),
+                                               batch.GetPointAttr().end());
+    std::vector<LODAttribute> attributes;
+    record_bytes = 0;
+    for (const auto &it : sorted) {
+        LODAttribute attribute;
+        attribute.name_ = it.first;
+        attribute.dtype_ = it.second.GetDtype();
+        const core::SizeVector &shape = it.second.GetShape();
+        attribute.shape_ = core::SizeVector(shape.begin() + 1, shape.end());
+        attribute.row_bytes_ =
+                attribute.shape_.NumElements() * attribute.dtype_.ByteSize();
+        attribute.offset_ = record_bytes;
+        record_bytes += attribute.row_bytes_;
+        attributes.push_back(attribute);
+    }
+    return attributes;
+}
+
+/// Returns true if \p batch has \p attributes.
+bool HasAttributes(const geometry::PointCloud &batch,
+                   const std::vector<LODAttribute> &attributes) {
+    if (batch.GetPointAttr().size() != attributes.size()) {
+        return false;
+    }
+    for (const LODAttribute &attribute : attributes) {
+        if (!batch.HasPointAttr(attribute.name_)) {
+            return false;
+        }
+        const core::Tensor &data = batch.GetPointAttr(attribute.name_);
+        const core::SizeVector &shape = data.GetShape();
+        if (data.GetDtype() != attribute.dtype_ ||
+            core::SizeVector(shape.begin() + 1, shape.end()) !=
+                    attribute.shape_) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Concatenates the attributes of \p maps along the points.
+geometry::TensorMap Concatenate(const std::vector<geometry::TensorMap> &maps) {
+    geometry::TensorMap result("points");
+    int64_t num_points = 0;
+    for (const geometry::TensorMap &map : maps) {
+        num_points += map.at("points").GetLength();
+    }
+    for (const auto &it : maps.front()) {
+        core::SizeVector shape = it.second.GetShape();
+        shape[0] = num_points;
+        core::Tensor data(shape, it.second.GetDtype());
+        int64_t offset = 0;
+        for (const geometry::TensorMap &map : maps) {
+            const core::Tensor &part = map.at(it.first);
+            data.Slice(0, offset, offset + part.GetLength()) = part;
+            offset += part.GetLength();
+        }
+        result[it.first] = data;
+    }
+    return result;
+}
+
+/// Returns the points \p indices of \p data.
+geometry::TensorMap Select(const geometry::TensorMap &data,
+                           const std::vector<int64_t> &indices) {
+    const int64_t num_points = int64_t(indices.size());
+    const core::Tensor index(indices, {num_points}, core::Dtype::Int64);
+    geometry::TensorMap result("points");
+    for (const auto &it : data) {
+        if (num_points == 0) {
+            core::SizeVector shape = it.second.GetShape();
+            shape[0] = 0;
+            result[it.first] = core::Tensor(shape, it.second.GetDtype());
+        } else {
+            result[it.first] = it.second.IndexGet({index});
+        }
+    }
+    return result;
+}
+
+/// Returns the points of \p points_ptr listed in \p indices in one point per
+/// cell of the \p grid_size^3 grid of the cube \p min_bound, \p size, the
+/// first point of each cell. The other points are returned in \p rejected.
+std::vector<int64_t> SampleGrid(const double *points_ptr,
+                                const std::vector<int64_t> &indices,
+                                const Eigen::Vector3d &min_bound,
+                                double size,
+                                int64_t grid_size,
+                                std::vector<int64_t> &rejected) {
+    const int64_t num_points = int64_t(indices.size());
+    std::vector<std::pair<int64_t, int64_t>> keys(num_points);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; ++i) {
+        const double *point = points_ptr + 3 * indices[i];
+        const int64_t x = GetCell(point[0], min_bound(0), size, grid_size);
+        const int64_t y = GetCell(point[1], min_bound(1), size, grid_size);
+        const int64_t z = GetCell(point[2], min_bound(2), size, grid_size);
+        keys[i] = std::make_pair(x + grid_size * (y + grid_size * z), i);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<int64_t> selected;
+    rejected.clear();
+    for (int64_t i = 0; i < num_points; ++i) {
+        if (i == 0 || keys[i].first != keys[i - 1].first) {
+            selected.push_back(indices[keys[i].second]);
+        } else {
+            rejected.push_back(indices[keys[i].second]);
+        }
+    }
+    std::sort(selected.begin(), selected.end());
+    std::sort(rejected.begin(), rejected.end());
+    return selected;
+}
+
+/// Builds the nodes of a PointCloudLOD.
+class LODBuilder {
+public:
+    LODBuilder(const std::string &directory,
+               const PointCloudLODOptions &options,
+               const Eigen::Vector3d &min_bound,
+               double size)
+        : directory_(directory),
+          options_(options),
+          min_bound_(min_bound),
+          size_(size) {}
+
+    /// Builds the subtree of the node \p name from all the points \p data in
+    /// its cube. The points of the node itself are kept until Finish(), so
+    /// that its ancestors can be sampled from them.
+    bool BuildChunk(const std::string &name, const geometry::TensorMap &data) {
+        const int64_t num_points = data.at("points").GetLength();
+        if (num_points == 0) {
+            return true;
+        }
+        const core::Tensor points =
+                data.at("points").To(core::Dtype::Float64).Contiguous();
+        std::vector<int64_t> indices(num_points);
+        for (int64_t i = 0; i < num_points; ++i) {
+            indices[i] = i;
+        }
+        return BuildNode(name, data, points.GetDataPtr<double>(), indices,
+                         true);
+    }
+
+    /// Builds the ancestors of the chunks bottom-up, deepest first, from the
+    /// points kept by their children, and writes the node list.
+    bool Finish(int64_t num_points) {
+        std::vector<std::string> ancestors;
+        for (const auto &it : pending_) {
+            for (size_t length = 1; length < it.first.size(); ++length) {
+                ancestors.push_back(it.first.substr(0, length));
+            }
+        }
+        std::sort(ancestors.begin(), ancestors.end(),
+                  [](const std::string &a, const std::string &b) {
+                      return a.size() > b.size() ||
+                             (a.size() == b.size() && a < b);
+                  });
+        ancestors.erase(std::unique(ancestors.begin(), ancestors.end()),
+                        ancestors.end());
+        for (const std::string &ancestor : ancestors) {
+            if (!BuildAncestor(ancestor)) {
+                return false;
+            }
+        }
+        for (const auto &it : pending_) {
+            if (!WriteNode(it.first, it.second)) {
+                return false;
+            }
+        }
+        pending_.clear();
+
+        PointCloudLOD lod;
+        lod.min_bound_ = min_bound_;
+        lod.size_ = size_;
+        lod.grid_size_ = options_.grid_size_;
+        lod.num_points_ = num_points;
+        for (const auto &it : node_points_) {
+            PointCloudLODNode node;
+            node.name_ = it.first;
+            node.num_points_ = it.second;
+            lod.nodes_.push_back(node);
+        }
+        std::sort(lod.nodes_.begin(), lod.nodes_.end(),
+                  [](const PointCloudLODNode &a, const PointCloudLODNode &b) {
+                      return a.name_.size() < b.name_.size() ||
+                             (a.name_.size() == b.name_.size() &&
+                              a.name_ < b.name_);
+                  });
+        return open3d::io::WriteIJsonConvertibleToJSON(
+                directory_ + "/lod.json", lod);
+    }
+
+private:
+    bool BuildNode(const std::string &name,
+                   const geometry::TensorMap &data,
+                   const double *points_ptr,
+                   const std::vector<int64_t> &indices,
+                   bool is_chunk) {
+        Eigen::Vector3d min_bound;
+        double size;
+        GetNodeCube(name, min_bound_, size_, min_bound, size);
+        std::vector<int64_t> selected, rejected;
+        if (int64_t(indices.size()) <= options_.max_node_points_ ||
+            int(name.size()) > kMaxDepth) {
+            selected = indices;
+        } else {
+            selected = SampleGrid(points_ptr, indices, min_bound, size,
+                                  options_.grid_size_, rejected);
+        }
+        if (is_chunk) {
+            pending_[name] = Select(data, selected);
+        } else if (!WriteNode(name, Select(data, selected))) {
+            return false;
+        }
+
+        // The other points are passed on to the children of their octant.
+        std::vector<int64_t> child_indices[8];
+        const Eigen::Vector3d center =
+                min_bound + Eigen::Vector3d::Constant(size / 2);
+        for (int64_t index : rejected) {
+            const double *point = points_ptr + 3 * index;
+            const int child = (point[0] < center(0) ? 0 : 1) +
+                              (point[1] < center(1) ? 0 : 2) +
+                              (point[2] < center(2) ? 0 : 4);
+            child_indices[child].push_back(index);
+        }
+        std::vector<int64_t>().swap(rejected);
+        for (int child = 0; child < 8; ++child) {
+            if (!child_indices[child].empty() &&
+                !BuildNode(name + char('0' + child), data, points_ptr,
+                           child_indices[child], false)) {
+                return false;
+            }
+            std::vector<int64_t>().swap(child_indices[child]);
+        }
+        return true;
+    }
+
+    /// Samples the ancestor \p name from the points kept by its children. The
+    /// children keep and write the points that are not sampled.
+    bool BuildAncestor(const std::string &name) {
+        std::vector<std::string> children;
+        std::vector<geometry::TensorMap> child_data;
+        for (int child = 0; child < 8; ++child) {
+            auto it = pending_.find(name + char('0' + child));
+            if (it != pending_.end()) {
+                children.push_back(it->first);
+                child_data.push_back(it->second);
+            }
+        }
+        const geometry::TensorMap data = Concatenate(child_data);
+        const core::Tensor points =
+                data.at("points").To(core::Dtype::Float64).Contiguous();
+        std::vector<int64_t> indices(points.GetLength());
+        for (int64_t i = 0; i < points.GetLength(); ++i) {
+            indices[i] = i;
+        }
+        Eigen::Vector3d min_bound;
+        double size;
+        GetNodeCube(name, min_bound_, size_, min_bound, size);
+        std::vector<int64_t> rejected;
+        const std::vector<int64_t> selected =
+                SampleGrid(points.GetDataPtr<double>(), indices, min_bound,
+                           size, options_.grid_size_, rejected);
+        pending_[name] = Select(data, selected);
+
+        // The rejected points are sorted, so that they are split into the
+        // ranges of the children.
+        int64_t offset = 0;
+        auto rejected_it = rejected.begin();
+        for (size_t c = 0; c < children.size(); ++c) {
+            const int64_t end = offset + child_data[c].at("points").GetLength();
+            std::vector<int64_t> child_rejected;
+            for (; rejected_it != rejected.end() && *rejected_it < end;
+                 ++rejected_it) {
+                child_rejected.push_back(*rejected_it);
+            }
+            if (!WriteNode(children[c], Select(data, child_rejected))) {
+                return false;
+            }
+            pending_.erase(children[c]);
+            offset = end;
+        }
+        return true;
+    }
+
+    bool WriteNode(const std::string &name, const geometry::TensorMap &data) {
+        const int64_t num_points = data.at("points").GetLength();
+        node_points_[name] = num_points;
+        if (num_points == 0) {
+            return true;
+        }
+        if (!WriteTensorMap(directory_ + "/" + name + ".o3dt", data,
+                            options_.compressed_)) {
+            utility::LogWarning("Write LOD failed: unable to write node {}.",
+                                name);
+            return false;
+        }
+        return true;
+    }
+
+    std::string directory_;
+    PointCloudLODOptions options_;
+    Eigen::Vector3d min_bound_;
+    double size_;
+    /// Number of points of the written nodes.
+    std::map<std::string, int64_t> node_points_;
+    /// Points of the chunk roots and ancestors that are not written yet.
+    std::map<std::string, geometry::TensorMap> pending_;
+};
+
+/// Chunk of points, i.e. a subtree that is built in memory.
+struct LODChunk {
+    std::string name_;
+    int level_ = 0;
+    int64_t x_ = 0, y_ = 0, z_ = 0;
+    int64_t num_points_ = 0;
+};
+
+/// Splits the cell \p x, \p y, \p z of \p level of the count pyramid \p counts
+/// into chunks of at most \p max_points points, or cells of the finest level.
+void SplitChunks(const std::vector<std::vector<int64_t>> &counts,
+                 int level,
+                 int64_t x,
+                 int64_t y,
+                 int64_t z,
+                 const std::string &name,
+                 int64_t max_points,
+                 std::vector<LODChunk> &chunks) {
+    const int64_t resolution = int64_t(1) << level;
+    const int64_t count = counts[level][x + resolution * (y + resolution * z)];
+    if (count == 0) {
+        return;
+    }
+    if (count <= max_points || level == kCountLevel) {
+        LODChunk chunk;
+        chunk.name_ = name;
+        chunk.level_ = level;
+        chunk.x_ = x;
+        chunk.y_ = y;
+        chunk.z_ = z;
+        chunk.num_points_ = count;
+        chunks.push_back(chunk);
+        return;
+    }
+    for (int child = 0; child < 8; ++child) {
+        SplitChunks(counts, level + 1, 2 * x + (child & 1),
+                    2 * y + ((child >> 1) & 1), 2 * z + ((child >> 2) & 1),
+                    name + char('0' + child), max_points, chunks);
+    }
+}
+
+/// Returns the index of the finest count cell of every point of \p points.
+std::vector<int64_t> GetCountCells(const core::Tensor &points,
+                                   const Eigen::Vector3d &min_bound,
+                                   double size) {
+    const int64_t resolution = int64_t(1) << kCountLevel;
+    const int64_t num_points = points.GetLength();
+    const double *points_ptr = points.GetDataPtr<double>();
+    std::vector<int64_t> cells(num_points);
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; ++i) {
+        const double *point = points_ptr + 3 * i;
+        cells[i] = GetCell(point[0], min_bound(0), size, resolution) +
+                   resolution *
+                           (GetCell(point[1], min_bound(1), size, resolution) +
+                            resolution * GetCell(point[2], min_bound(2), size,
+                                                 resolution));
+    }
+    return cells;
+}
+
+bool WriteLOD(PointSource &source,
+              const std::string &directory,
+              const PointCloudLODOptions &options) {
+    if (options.max_node_points_ <= 0 || options.grid_size_ <= 0 ||
+        options.max_chunk_points_ <= 0) {
+        utility::LogWarning("Write LOD failed: invalid options.");
+        return false;
+    }
+    if (!utility::filesystem::DirectoryExists(directory) &&
+        !utility::filesystem::MakeDirectoryHierarchy(directory)) {
+        utility::LogWarning("Write LOD failed: unable to create {}.",
+                            directory);
+        return false;
+    }
+
+    // Pass 1: bounds and attributes.
+    geometry::PointCloud batch;
+    std::vector<LODAttribute> attributes;
+    int64_t record_bytes = 0;
+    int64_t num_points = 0;
+    Eigen::Vector3d min_bound = Eigen::Vector3d::Constant(
+            std::numeric_limits<double>::infinity());
+    Eigen::Vector3d max_bound = -min_bound;
+    if (!source.Reset()) {
+        return false;
+    }
+    while (source.Next(batch)) {
+        batch = batch.CPU();
+        if (num_points == 0) {
+            attributes = GetAttributes(batch, record_bytes);
+        }
+        if (!batch.HasPointAttr("points") ||
+            !HasAttributes(batch, attributes)) {
+            utility::LogWarning(
+                    "Write LOD failed: the points must have the same "
+                    "attributes.");
+            return false;
+        }
+        const core::Tensor points =
+                batch.GetPoints().To(core::Dtype::Float64);
+        if (points.GetLength() == 0) {
+            continue;
+        }
+        const std::vector<double> batch_min =
+                points.Min({0}).ToFlatVector<double>();
+        const std::vector<double> batch_max =
+                points.Max({0}).ToFlatVector<double>();
+        for (int i = 0; i < 3; ++i) {
+            min_bound(i) = std::min(min_bound(i), batch_min[i]);
+            max_bound(i) = std::max(max_bound(i), batch_max[i]);
+        }
+        num_points += points.GetLength();
+    }
+    if (num_points == 0) {
+        utility::LogWarning("Write LOD failed: no points.");
+        return false;
+    }
+    double size = (max_bound - min_bound).maxCoeff();
+    if (!(size > 0)) {
+        size = 1;
+    }
+
+    LODBuilder builder(directory, options, min_bound, size);
+    if (num_points <= options.max_chunk_points_) {
+        // Everything fits into memory.
+        std::vector<geometry::TensorMap> batches;
+        source.Reset();
+        while (source.Next(batch)) {
+            batches.push_back(batch.CPU().GetPointAttr());
+        }
+        return builder.BuildChunk("r", Concatenate(batches)) &&
+               builder.Finish(num_points);
+    }
+
+    // Pass 2: points per cell of the count grid, summed into a pyramid.
+    std::vector<std::vector<int64_t>> counts(kCountLevel + 1);
+    for (int level = 0; level <= kCountLevel; ++level) {
+        counts[level].assign(int64_t(1) << (3 * level), 0);
+    }
+    source.Reset();
+    while (source.Next(batch)) {
+        const core::Tensor points = batch.GetPoints()
+                                            .To(core::Device("CPU:0"),
+                                                core::Dtype::Float64)
+                                            .Contiguous();
+        for (int64_t cell : GetCountCells(points, min_bound, size)) {
+            counts[kCountLevel][cell]++;
+        }
+    }
+    for (int level = kCountLevel - 1; level >= 0; --level) {
+        const int64_t resolution = int64_t(1) << level;
+        const int64_t child_resolution = 2 * resolution;
+        for (int64_t z = 0; z < child_resolution; ++z) {
+            for (int64_t y = 0; y < child_resolution; ++y) {
+                for (int64_t x = 0; x < child_resolution; ++x) {
+                    const int64_t cell =
+                            x / 2 + resolution * (y / 2 + resolution * (z / 2));
+                    const int64_t child_cell =
+                            x + child_resolution * (y + child_resolution * z);
+                    counts[level][cell] += counts[level + 1][child_cell];
+                }
+            }
+        }
+    }
+    std::vector<LODChunk> chunks;
+    SplitChunks(counts, 0, 0, 0, 0, "r", options.max_chunk_points_, chunks);
+    const int64_t resolution = int64_t(1) << kCountLevel;
+    std::vector<int32_t> cell_chunks(resolution * resolution * resolution, -1);
+    for (size_t c = 0; c < chunks.size(); ++c) {
+        const LODChunk &chunk = chunks[c];
+        const int shift = kCountLevel - chunk.level_;
+        const int64_t extent = int64_t(1) << shift;
+        for (int64_t z = chunk.z_ << shift; z < (chunk.z_ << shift) + extent;
+             ++z) {
+            for (int64_t y = chunk.y_ << shift;
+                 y < (chunk.y_ << shift) + extent; ++y) {
+                for (int64_t x = chunk.x_ << shift;
+                     x < (chunk.x_ << shift) + extent; ++x) {
+                    cell_chunks[x + resolution * (y + resolution * z)] =
+                            int32_t(c);
+                }
+            }
+        }
+    }
+    std::vector<std::vector<int64_t>>().swap(counts);
+
+    // Pass 3: the points are appended to one file of records per chunk.
+    const std::string chunk_directory = directory + "/chunks";
+    if (!utility::filesystem::DirectoryExists(chunk_directory) &&
+        !utility::filesystem::MakeDirectory(chunk_directory)) {
+        utility::LogWarning("Write LOD failed: unable to create {}.",
+                            chunk_directory);
+        return false;
+    }
+    auto chunk_file = [&chunk_directory](const LODChunk &chunk) {
+        return chunk_directory + "/" + chunk.name_ + ".bin";
+    };
+    for (const LODChunk &chunk : chunks) {
+        std::remove(chunk_file(chunk).c_str());
+    }
+    source.Reset();
+    std::vector<char> records;
+    while (source.Next(batch)) {
+        batch = batch.CPU();
+        const core::Tensor points =
+                batch.GetPoints().To(core::Dtype::Float64).Contiguous();
+        const std::vector<int64_t> cells =
+                GetCountCells(points, min_bound, size);
+        const int64_t batch_points = int64_t(cells.size());
+
+        // The points are sorted by chunk.
+        std::vector<int64_t> offsets(chunks.size() + 1, 0);
+        for (int64_t cell : cells) {
+            offsets[cell_chunks[cell] + 1]++;
+        }
+        for (size_t c = 0; c < chunks.size(); ++c) {
+            offsets[c + 1] += offsets[c];
+        }
+        std::vector<int64_t> order(batch_points);
+        std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+        for (int64_t i = 0; i < batch_points; ++i) {
+            order[positions[cell_chunks[cells[i]]]++] = i;
+        }
+
+        std::vector<core::Tensor> data;
+        for (const LODAttribute &attribute : attributes) {
+            data.push_back(batch.GetPointAttr(attribute.name_).Contiguous());
+        }
+        records.resize(batch_points * record_bytes);
+#pragma omp parallel for schedule(static)
+        for (int64_t p = 0; p < batch_points; ++p) {
+            for (size_t a = 0; a < attributes.size(); ++a) {
+                const int64_t row_bytes = attributes[a].row_bytes_;
+                std::memcpy(records.data() + p * record_bytes +
+                                    attributes[a].offset_,
+                            static_cast<const char *>(data[a].GetDataPtr()) +
+                                    order[p] * row_bytes,
+                            row_bytes);
+            }
+        }
+        for (size_t c = 0; c < chunks.size(); ++c) {
+            const int64_t count = offsets[c + 1] - offsets[c];
+            if (count == 0) {
+                continue;
+            }
+            FILE *file = utility::filesystem::FOpen(chunk_file(chunks[c]),
+                                                    "ab");
+            const bool success =
+                    file && fwrite(records.data() + offsets[c] * record_bytes,
+                                   record_bytes, count,
+                                   file) == size_t(count);
+            if (file) {
+                fclose(file);
+            }
+            if (!success) {
+                utility::LogWarning("Write LOD failed: unable to write {}.",
+                                    chunk_file(chunks[c]));
+                return false;
+            }
+        }
+    }
+    std::vector<char>().swap(records);
+
+    // Pass 4: the chunks are built one by one.
+    for (const LODChunk &chunk : chunks) {
+        const std::string filename = chunk_file(chunk);
+        utility::filesystem::CFile file;
+        std::vector<char> chunk_records(chunk.num_points_ * record_bytes);
+        if (!file.Open(filename, "rb") ||
+            file.ReadData(chunk_records.data(), record_bytes,
+                          chunk.num_points_) != size_t(chunk.num_points_)) {
+            utility::LogWarning("Write LOD failed: unable to read {}.",
+                                filename);
+            return false;
+        }
+        file.Close();
+        std::remove(filename.c_str());
+
+        geometry::TensorMap data("points");
+        for (const LODAttribute &attribute : attributes) {
+            core::SizeVector shape = attribute.shape_;
+            shape.insert(shape.begin(), chunk.num_points_);
+            core::Tensor tensor(shape, attribute.dtype_);
+            char *dst = static_cast<char *>(tensor.GetDataPtr());
+#pragma omp parallel for schedule(static)
+            for (int64_t i = 0; i < chunk.num_points_; ++i) {
+                std::memcpy(dst + i * attribute.row_bytes_,
+                            chunk_records.data() + i * record_bytes +
+                                    attribute.offset_,
+                            attribute.row_bytes_);
+            }
+            data[attribute.name_] = tensor;
+        }
+        std::vector<char>().swap(chunk_records);
+        if (!builder.BuildChunk(chunk.name_, data)) {
+            return false;
+        }
+    }
+    utility::filesystem::DeleteDirectory(chunk_directory);
+    return builder.Finish(num_points);
+}
+
+}  // namespace
+
+bool PointCloudLOD::ConvertToJsonValue(Json::Value &value) const {
+    value["version"] = 1;
+    value["num_points"] = Json::Int64(num_points_);
+    EigenVector3dToJsonArray(min_bound_, value["min_bound"]);
+    value["size"] = size_;
+    value["grid_size"] = grid_size_;
+    Json::Value nodes(Json::arrayValue);
+    for (const PointCloudLODNode &node : nodes_) {
+        Json::Value node_value;
+        node_value["name"] = node.name_;
+        node_value["num_points"] = Json::Int64(node.num_points_);
+        nodes.append(node_value);
+    }
+    value["nodes"] = nodes;
+    return true;
+}
+
+bool PointCloudLOD::ConvertFromJsonValue(const Json::Value &value) {
+    if (!value.isObject() || value.get("version", 0).asInt() != 1 ||
+        !EigenVector3dFromJsonArray(min_bound_, value["min_bound"])) {
+        utility::LogWarning("PointCloudLOD read JSON failed: bad header.");
+        return false;
+    }
+    num_points_ = value["num_points"].asInt64();
+    size_ = value["size"].asDouble();
+    grid_size_ = value["grid_size"].asInt();
+    nodes_.clear();
+    std::unordered_map<std::string, int> indices;
+    for (const Json::Value &node_value : value["nodes"]) {
+        PointCloudLODNode node;
+        node.name_ = node_value["name"].asString();
+        node.num_points_ = node_value["num_points"].asInt64();
+        node.depth_ = int(node.name_.size()) - 1;
+        const bool is_root = node.name_ == "r" && nodes_.empty();
+        const std::string parent = node.name_.substr(0, node.depth_);
+        if (node.name_.empty() ||
+            (!is_root && (node.name_.back() < '0' || node.name_.back() > '7' ||
+                          indices.count(parent) == 0 ||
+                          indices.count(node.name_) != 0))) {
+            utility::LogWarning(
+                    "PointCloudLOD read JSON failed: bad node name {}.",
+                    node.name_);
+            return false;
+        }
+        GetNodeCube(node.name_, min_bound_, size_, node.min_bound_,
+                    node.size_);
+        const int index = int(nodes_.size());
+        if (!is_root) {
+            nodes_[indices.at(parent)].children_[node.name_.back() - '0'] =
+                    index;
+        }
+        indices[node.name_] = index;
+        nodes_.push_back(node);
+    }
+    return true;
+}
+
+bool PointCloudLOD::Open(const std::string &directory) {
+    if (!open3d::io::ReadIJsonConvertibleFromJSON(directory + "/lod.json",
+                                                  *this)) {
+        return false;
+    }
+    directory_ = directory;
+    return true;
+}
+
+bool PointCloudLOD::ReadNode(int index,
+                             geometry::PointCloud &pointcloud,
+                             const core::Device &device) const {
+    if (index < 0 || index >= int(nodes_.size())) {
+        utility::LogWarning("PointCloudLOD: node index {} out of range.",
+                            index);
+        return false;
+    }
+    const PointCloudLODNode &node = nodes_[index];
+    if (node.num_points_ == 0) {
+        pointcloud = geometry::PointCloud(device);
+        return true;
+    }
+    geometry::TensorMap data("points");
+    if (!ReadTensorMap(directory_ + "/" + node.name_ + ".o3dt", data,
+                       device)) {
+        return false;
+    }
+    pointcloud = geometry::PointCloud(data);
+    return true;
+}
+
+std::vector<int> PointCloudLOD::SelectNodes(const Eigen::Vector3d &eye,
+                                            double pixels_per_radian,
+                                            double max_error,
+                                            int64_t max_points) const {
+    std::vector<int> selected;
+    if (nodes_.empty()) {
+        return selected;
+    }
+    // Projected spacing of a node, infinite if the eye is inside its bounding
+    // sphere.
+    auto projected_error = [&](int index) {
+        const PointCloudLODNode &node = nodes_[index];
+        const Eigen::Vector3d center =
+                node.min_bound_ + Eigen::Vector3d::Constant(node.size_ / 2);
+        const double distance =
+                (eye - center).norm() - node.size_ * std::sqrt(3.0) / 2;
+        if (distance <= 0) {
+            return std::numeric_limits<double>::infinity();
+        }
+        return GetNodeSpacing(index) / distance * pixels_per_radian;
+    };
+
+    std::priority_queue<std::pair<double, int>> queue;
+    queue.emplace(projected_error(0), 0);
+    int64_t num_points = 0;
+    while (!queue.empty()) {
+        const double error = queue.top().first;
+        const int index = queue.top().second;
+        queue.pop();
+        if (!selected.empty() &&
+            num_points + nodes_[index].num_points_ > max_points) {
+            break;
+        }
+        selected.push_back(index);
+        num_points += nodes_[index].num_points_;
+        if (error > max_error) {
+            for (int child : nodes_[index].children_) {
+                if (child >= 0) {
+                    queue.emplace(projected_error(child), child);
+                }
+            }
+        }
+    }
+    std::sort(selected.begin(), selected.end());
+    return selected;
+}
+
+bool WritePointCloudLOD(const std::string &filename,
+                        const std::string &directory,
+                        const PointCloudLODOptions &options) {
+    FileSource source(filename, options.read_points_);
+    return WriteLOD(source, directory, options);
+}
+
+bool WritePointCloudLOD(const geometry::PointCloud &pointcloud,
+                        const std::string &directory,
+                        const PointCloudLODOptions &options) {
+    MemorySource source(pointcloud, options.read_points_);
+    return WriteLOD(source, directory, options);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
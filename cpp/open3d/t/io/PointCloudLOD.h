@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/utility/IJsonConvertible.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Options of WritePointCloudLOD.
+struct PointCloudLODOptions {
+    /// Nodes with at most this number of points are leaves, which store all
+    /// their points.
+    int64_t max_node_points_ = 20000;
+    /// Number of cells along each side of a node. Inner nodes store one point
+    /// per cell and pass the other points on to their children.
+    int grid_size_ = 128;
+    /// Maximal number of points of the subtrees built in memory. Larger point
+    /// clouds are first distributed to subtrees on disk.
+    int64_t max_chunk_points_ = 10000000;
+    /// Number of points read from the input file at once.
+    int64_t read_points_ = 1000000;
+    /// If true, the node files are compressed with LZF.
+    bool compressed_ = false;
+};
+
+/// Node of a PointCloudLOD.
+struct PointCloudLODNode {
+    /// "r" followed by the child indices on the path from the root, e.g. "r07"
+    /// for the child 7 of the child 0 of the root. The child index of the
+    /// octant x, y, z is x + 2y + 4z as in geometry::Octree.
+    std::string name_;
+    int depth_ = 0;
+    /// Minimal corner of the cube of the node.
+    Eigen::Vector3d min_bound_ = Eigen::Vector3d::Zero();
+    /// Side length of the cube of the node.
+    double size_ = 0;
+    /// Number of points stored in the node.
+    int64_t num_points_ = 0;
+    /// Indices of the children in PointCloudLOD::nodes_, -1 if absent.
+    std::array<int, 8> children_{{-1, -1, -1, -1, -1, -1, -1, -1}};
+};
+
+/// \class PointCloudLOD
+///
+/// Multi-resolution point cloud stored as an octree of tiles in a directory,
+/// see WritePointCloudLOD. Every node stores a subsample of the points of its
+/// cube that are not stored by its ancestors, so that the union of a node and
+/// its ancestors is a level of detail of the cube. The nodes are listed in
+/// "lod.json" and stored in "<name>.o3dt" files, which can be read one by one.
+class PointCloudLOD : public utility::IJsonConvertible {
+public:
+    bool ConvertToJsonValue(Json::Value &value) const override;
+    bool ConvertFromJsonValue(const Json::Value &value) override;
+
+    /// Reads the node list of the point cloud in \p directory.
+    bool Open(const std::string &directory);
+
+    /// Reads the points of the node \p index into \p pointcloud.
+    bool ReadNode(int index,
+                  geometry::PointCloud &pointcloud,
+                  const core::Device &device = core::Device("CPU:0")) const;
+
+    /// Distance between the points of the node \p index, which is the
+    /// geometric error of the node if none of its children are shown.
+    double GetNodeSpacing(int index) const {
+        return nodes_[index].size_ / grid_size_;
+    }
+
+    /// Selects the nodes to show for a perspective camera at \p eye with
+    /// \p pixels_per_radian pixels per radian of field of view. A node is
+    /// refined by its children if its spacing is projected to more than
+    /// \p max_error pixels, the nodes with the largest projected error first,
+    /// until \p max_points points are selected. Returns the node indices in
+    /// breadth-first order, parents before children.
+    std::vector<int> SelectNodes(const Eigen::Vector3d &eye,
+                                 double pixels_per_radian,
+                                 double max_error,
+                                 int64_t max_points) const;
+
+public:
+    /// Directory of the node files.
+    std::string directory_;
+    /// Nodes in breadth-first order. The root is nodes_[0].
+    std::vector<PointCloudLODNode> nodes_;
+    /// Minimal corner of the cube of the root.
+    Eigen::Vector3d min_bound_ = Eigen::Vector3d::Zero();
+    /// Side length of the cube of the root.
+    double size_ = 0;
+    /// Number of cells along each side of a node.
+    int grid_size_ = 128;
+    /// Total number of points.
+    int64_t num_points_ = 0;
+};
+
+/// Builds a PointCloudLOD in \p directory from the point cloud file
+/// \p filename, which is read with PointCloudStreamReader, so that it needs
+/// not fit into memory. The file is read three times: to find its bounds, to
+/// count its points per region and to distribute them to subtrees of at most
+/// PointCloudLODOptions::max_chunk_points_ points, which are built one by one.
+bool WritePointCloudLOD(const std::string &filename,
+                        const std::string &directory,
+                        const PointCloudLODOptions &options = {});
+
+/// Builds a PointCloudLOD in \p directory from \p pointcloud.
+bool WritePointCloudLOD(const geometry::PointCloud &pointcloud,
+                        const std::string &directory,
+                        const PointCloudLODOptions &options = {});
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
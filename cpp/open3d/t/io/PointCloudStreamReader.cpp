@@ -0,0 +1,441 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudStreamReader.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <map>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/TextParser.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+/// Text is read from the file in blocks of this size.
+constexpr size_t kTextBlockBytes = 16 << 20;
+
+bool Seek(FILE *fp, int64_t offset) {
+#ifdef _WIN32
+    return _fseeki64(fp, offset, SEEK_SET) == 0;
+#else
+    return fseeko(fp, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
+
+/// Appends a field of \p count values of \p attr at value \p offset of the
+/// lines of a text file.
+void AddTextField(PointCloudStreamLayout &layout,
+                  const std::string &attr,
+                  int64_t count,
+                  const core::Dtype &dtype,
+                  int64_t offset) {
+    PointCloudStreamLayout::Field field;
+    field.attr_ = attr;
+    field.count_ = count;
+    field.dtype_ = dtype;
+    field.offset_ = offset;
+    layout.fields_.push_back(field);
+    layout.record_size_ = std::max(layout.record_size_, offset + count);
+}
+
+/// Returns the layout of XYZ, XYZN, XYZRGB and XYZI files, which hold one
+/// point per line and no header.
+bool GetXYZStreamLayout(const std::string &format,
+                        PointCloudStreamLayout &layout) {
+    layout = PointCloudStreamLayout();
+    AddTextField(layout, "points", 3, core::Dtype::Float64, 0);
+    if (format == "xyzn") {
+        AddTextField(layout, "normals", 3, core::Dtype::Float64, 3);
+    } else if (format == "xyzrgb") {
+        AddTextField(layout, "colors", 3, core::Dtype::Float64, 3);
+    } else if (format == "xyzi") {
+        AddTextField(layout, "intensities", 1, core::Dtype::Float64, 3);
+    } else if (format != "xyz") {
+        return false;
+    }
+    return true;
+}
+
+/// Returns the layout of a PTS file, whose first line holds the number of
+/// points and whose first point tells the fields.
+bool ReadPTSStreamLayout(const std::string &filename,
+                         PointCloudStreamLayout &layout) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        utility::LogWarning("Read PTS failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    layout = PointCloudStreamLayout();
+    try {
+        const char *line = file.ReadLine();
+        int64_t num_points = 0;
+        if (!line || !open3d::io::ParseNumber(line, line + std::strlen(line),
+                                              num_points) ||
+            num_points < 0) {
+            utility::LogWarning(
+                    "Read PTS failed: number of points must be >= 0.");
+            return false;
+        }
+        layout.data_offset_ = file.CurPos();
+        layout.num_records_ = num_points;
+        AddTextField(layout, "points", 3, core::Dtype::Float64, 0);
+        line = num_points > 0 ? file.ReadLine() : nullptr;
+        if (!line) {
+            return true;
+        }
+        const size_t num_fields = utility::SplitString(line, " \t\r\n").size();
+        if (num_fields == 7) {
+            AddTextField(layout, "intensities", 1, core::Dtype::Float64, 3);
+            AddTextField(layout, "colors", 3, core::Dtype::UInt8, 4);
+        } else if (num_fields == 6) {
+            AddTextField(layout, "colors", 3, core::Dtype::UInt8, 3);
+        } else if (num_fields == 4) {
+            AddTextField(layout, "intensities", 1, core::Dtype::Float64, 3);
+        } else if (num_fields != 3) {
+            utility::LogWarning("Read PTS failed: unknown pts format: {}",
+                                line);
+            return false;
+        }
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read PTS failed with exception: {}", e.what());
+        return false;
+    }
+    return true;
+}
+
+/// Attribute tensors of a chunk, and for every field of the layout the
+/// attribute it is stored to.
+struct ChunkData {
+    std::map<std::string, core::Tensor> attributes_;
+    std::vector<core::Tensor> field_data_;
+};
+
+ChunkData AllocateChunk(const PointCloudStreamLayout &layout,
+                        int64_t num_points) {
+    std::map<std::string, std::pair<int64_t, core::Dtype>> shapes;
+    for (const PointCloudStreamLayout::Field &field : layout.fields_) {
+        const core::Dtype dtype =
+                field.packed_color_ ? core::Dtype::UInt8 : field.dtype_;
+        auto it = shapes.emplace(field.attr_, std::make_pair(0, dtype)).first;
+        it->second.first =
+                std::max(it->second.first, field.column_ + field.count_);
+    }
+    ChunkData chunk;
+    for (const auto &it : shapes) {
+        chunk.attributes_.emplace(
+                it.first, core::Tensor::Zeros({num_points, it.second.first},
+                                              it.second.second));
+    }
+    for (const PointCloudStreamLayout::Field &field : layout.fields_) {
+        chunk.field_data_.push_back(chunk.attributes_.at(field.attr_));
+    }
+    return chunk;
+}
+
+/// Stores \p value at \p data[index] as \p dtype.
+void StoreValue(void *data,
+                const core::Dtype &dtype,
+                int64_t index,
+                double value) {
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        static_cast<scalar_t *>(data)[index] = static_cast<scalar_t>(value);
+    });
+}
+
+/// Loads the possibly unaligned value of \p dtype at \p src.
+double LoadValue(const char *src, const core::Dtype &dtype) {
+    double value = 0;
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        scalar_t scalar;
+        std::memcpy(&scalar, src, sizeof(scalar_t));
+        value = static_cast<double>(scalar);
+    });
+    return value;
+}
+
+/// Stores the BGR bytes of a packed PCD color to the UInt8 \p color.
+void UnpackColor(const uint8_t *bgr, uint8_t *color) {
+    color[0] = bgr[2];
+    color[1] = bgr[1];
+    color[2] = bgr[0];
+}
+
+/// Moves the \p chunk attributes to \p pointcloud.
+void SetChunkAttributes(ChunkData &chunk, geometry::PointCloud &pointcloud) {
+    pointcloud.Clear();
+    for (const auto &it : chunk.attributes_) {
+        pointcloud.SetPointAttr(it.first, it.second);
+    }
+}
+
+}  // namespace
+
+bool PointCloudStreamReader::Open(const std::string &filename,
+                                  const std::string &format) {
+    Close();
+    const std::string file_format =
+            format == "auto"
+                    ? utility::filesystem::GetFileExtensionInLowerCase(filename)
+                    : format;
+    bool success = false;
+    if (file_format == "ply") {
+        success = ReadPLYStreamLayout(filename, layout_);
+    } else if (file_format == "pcd") {
+        success = ReadPCDStreamLayout(filename, layout_);
+    } else if (file_format == "pts") {
+        success = ReadPTSStreamLayout(filename, layout_);
+    } else if (GetXYZStreamLayout(file_format, layout_)) {
+        success = true;
+    } else {
+        utility::LogWarning(
+                "Read point cloud stream failed: unsupported file format {}.",
+                file_format);
+    }
+    if (!success) {
+        return false;
+    }
+    if (!layout_.ascii_ && layout_.record_size_ <= 0) {
+        utility::LogWarning(
+                "Read point cloud stream failed: empty point records in {}.",
+                filename);
+        return false;
+    }
+    if (!file_.Open(filename, "rb") ||
+        !Seek(file_.GetFILE(), layout_.data_offset_)) {
+        utility::LogWarning(
+                "Read point cloud stream failed: unable to open file: {}",
+                filename);
+        file_.Close();
+        return false;
+    }
+    is_opened_ = true;
+    eof_ = layout_.num_records_ == 0;
+    file_eof_ = false;
+    num_read_ = 0;
+    buffer_.clear();
+    buffer_begin_ = 0;
+    return true;
+}
+
+void PointCloudStreamReader::Close() {
+    file_.Close();
+    is_opened_ = false;
+    eof_ = true;
+    file_eof_ = true;
+    num_read_ = 0;
+    std::vector<char>().swap(buffer_);
+    buffer_begin_ = 0;
+}
+
+bool PointCloudStreamReader::ReadNext(int64_t max_points,
+                                      geometry::PointCloud &chunk) {
+    if (!is_opened_ || eof_ || max_points <= 0) {
+        return false;
+    }
+    try {
+        if (!layout_.ascii_) {
+            return ReadNextBinary(max_points, chunk);
+        }
+        // Lines with too few values are skipped, so that a block of lines may
+        // hold no point before the end of the file.
+        while (!eof_) {
+            if (ReadNextText(max_points, chunk)) {
+                return true;
+            }
+        }
+        return false;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read point cloud stream failed: {}", e.what());
+        eof_ = true;
+        return false;
+    }
+}
+
+bool PointCloudStreamReader::ReadNextBinary(int64_t max_points,
+                                            geometry::PointCloud &chunk) {
+    const int64_t record_size = layout_.record_size_;
+    int64_t num_points = max_points;
+    if (layout_.num_records_ >= 0) {
+        num_points = std::min(num_points, layout_.num_records_ - num_read_);
+    }
+    buffer_.resize(num_points * record_size);
+    num_points = int64_t(
+            file_.ReadData(buffer_.data(), record_size, num_points));
+    num_read_ += num_points;
+    if (num_points < max_points || num_read_ == layout_.num_records_) {
+        eof_ = true;
+    }
+    if (num_points == 0) {
+        return false;
+    }
+
+    ChunkData data = AllocateChunk(layout_, num_points);
+    const char *records = buffer_.data();
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; ++i) {
+        const char *record = records + i * record_size;
+        for (size_t f = 0; f < layout_.fields_.size(); ++f) {
+            const PointCloudStreamLayout::Field &field = layout_.fields_[f];
+            core::Tensor &attr = data.field_data_[f];
+            const core::Dtype dtype = attr.GetDtype();
+            const int64_t num_columns = attr.GetShape(1);
+            char *dst = static_cast<char *>(attr.GetDataPtr()) +
+                        (i * num_columns + field.column_) * dtype.ByteSize();
+            const char *src = record + field.offset_;
+            if (field.packed_color_) {
+                UnpackColor(reinterpret_cast<const uint8_t *>(src),
+                            reinterpret_cast<uint8_t *>(dst));
+            } else if (dtype == field.dtype_) {
+                std::memcpy(dst, src, field.count_ * dtype.ByteSize());
+            } else {
+                for (int64_t c = 0; c < field.count_; ++c) {
+                    StoreValue(dst, dtype, c,
+                               LoadValue(src + c * field.dtype_.ByteSize(),
+                                         field.dtype_));
+                }
+            }
+        }
+    }
+    SetChunkAttributes(data, chunk);
+    return true;
+}
+
+bool PointCloudStreamReader::ReadNextText(int64_t max_points,
+                                          geometry::PointCloud &chunk) {
+    int64_t max_lines = max_points;
+    if (layout_.num_records_ >= 0) {
+        max_lines = std::min(max_lines, layout_.num_records_ - num_read_);
+    }
+
+    // Finds the end of the next max_lines lines, reading blocks of text until
+    // enough lines are buffered.
+    int64_t num_lines = 0;
+    size_t scan_pos = buffer_begin_;
+    while (num_lines < max_lines) {
+        const char *begin = buffer_.data() + scan_pos;
+        const char *end = buffer_.data() + buffer_.size();
+        const void *line_break =
+                begin < end ? std::memchr(begin, '\n', end - begin) : nullptr;
+        if (line_break) {
+            scan_pos = static_cast<const char *>(line_break) + 1 -
+                       buffer_.data();
+            ++num_lines;
+        } else if (!file_eof_) {
+            // Drops the parsed text and appends the next block.
+            buffer_.erase(buffer_.begin(), buffer_.begin() + buffer_begin_);
+            scan_pos -= buffer_begin_;
+            buffer_begin_ = 0;
+            const size_t size = buffer_.size();
+            buffer_.resize(size + kTextBlockBytes);
+            const size_t num_bytes =
+                    file_.ReadData(buffer_.data() + size, 1, kTextBlockBytes);
+            buffer_.resize(size + num_bytes);
+            file_eof_ = num_bytes < kTextBlockBytes;
+        } else {
+            // The last line may lack its line break.
+            if (scan_pos < buffer_.size()) {
+                scan_pos = buffer_.size();
+                ++num_lines;
+            }
+            break;
+        }
+    }
+
+    const char *text_begin = buffer_.data() + buffer_begin_;
+    const char *text_end = buffer_.data() + scan_pos;
+    buffer_begin_ = scan_pos;
+    num_read_ += num_lines;
+    if (num_read_ == layout_.num_records_ ||
+        (file_eof_ && buffer_begin_ == buffer_.size())) {
+        eof_ = true;
+    }
+
+    const int64_t num_values = layout_.record_size_;
+    const std::vector<const char *> lines = open3d::io::ParseLines<
+            const char *>(text_begin, text_end,
+                          [num_values](const char *line, const char *line_end,
+                                       const char *&record) {
+                              record = line;
+                              return open3d::io::HasValues(line, line_end,
+                                                           num_values);
+                          });
+    const int64_t num_points = int64_t(lines.size());
+    if (num_points == 0) {
+        return false;
+    }
+
+    ChunkData data = AllocateChunk(layout_, num_points);
+#pragma omp parallel
+    {
+        std::vector<double> values(num_values);
+#pragma omp for schedule(static)
+        for (int64_t i = 0; i < num_points; ++i) {
+            open3d::io::ParseNumbers(
+                    lines[i], open3d::io::FindLineEnd(lines[i], text_end),
+                    values.data(), int(num_values));
+            for (size_t f = 0; f < layout_.fields_.size(); ++f) {
+                const PointCloudStreamLayout::Field &field =
+                        layout_.fields_[f];
+                core::Tensor &attr = data.field_data_[f];
+                const int64_t index = i * attr.GetShape(1) + field.column_;
+                const double *field_values = &values[field.offset_];
+                if (field.packed_color_) {
+                    // The packed color is printed as a float or an integer.
+                    uint8_t bgra[4] = {0, 0, 0, 0};
+                    if (field.dtype_ == core::Dtype::Float32) {
+                        const float packed = float(field_values[0]);
+                        std::memcpy(bgra, &packed, 4);
+                    } else {
+                        const uint32_t packed = uint32_t(field_values[0]);
+                        std::memcpy(bgra, &packed, 4);
+                    }
+                    UnpackColor(bgra, attr.GetDataPtr<uint8_t>() + index);
+                } else {
+                    for (int64_t c = 0; c < field.count_; ++c) {
+                        StoreValue(attr.GetDataPtr(), attr.GetDtype(),
+                                   index + c, field_values[c]);
+                    }
+                }
+            }
+        }
+    }
+    SetChunkAttributes(data, chunk);
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
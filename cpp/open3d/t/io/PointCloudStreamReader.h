@@ -0,0 +1,140 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Layout of the point records of a file read by PointCloudStreamReader.
+struct PointCloudStreamLayout {
+    /// Values of a point record that are stored to a point attribute.
+    struct Field {
+        /// Name of the attribute, e.g. "points".
+        std::string attr_;
+        /// Column of the first value in the attribute.
+        int64_t column_ = 0;
+        /// Number of values.
+        int64_t count_ = 1;
+        /// Dtype of the values in binary records, and of the attribute.
+        core::Dtype dtype_ = core::Dtype::Float64;
+        /// Byte offset in a binary record or index of the first value in a
+        /// line of text.
+        int64_t offset_ = 0;
+        /// If true, the field is a BGR color packed into 4 bytes as in PCD
+        /// files, which is unpacked into 3 UInt8 columns.
+        bool packed_color_ = false;
+    };
+
+    std::vector<Field> fields_;
+    /// If true, the records are lines of text, otherwise fixed-size binary
+    /// records.
+    bool ascii_ = true;
+    /// Byte offset of the first record in the file.
+    int64_t data_offset_ = 0;
+    /// Byte size of a binary record, or number of values of a line of text.
+    /// Lines with fewer values are skipped.
+    int64_t record_size_ = 0;
+    /// Number of records, -1 if the records continue until the end of the
+    /// file.
+    int64_t num_records_ = -1;
+};
+
+/// \class PointCloudStreamReader
+///
+/// Reads a point cloud file in chunks of a bounded number of points, so that
+/// files larger than memory can be processed chunk by chunk. Supports XYZ,
+/// XYZN, XYZRGB, XYZI, PTS, ASCII and binary PCD and ASCII and binary
+/// little-endian PLY files whose vertices come first or have fixed-size
+/// records.
+class PointCloudStreamReader {
+public:
+    PointCloudStreamReader() {}
+    ~PointCloudStreamReader() { Close(); }
+    PointCloudStreamReader(const PointCloudStreamReader &) = delete;
+    PointCloudStreamReader &operator=(const PointCloudStreamReader &) = delete;
+
+    /// Opens \p filename. The \p format is deduced from the extension if
+    /// "auto". Returns false if the file cannot be opened or its format cannot
+    /// be streamed.
+    bool Open(const std::string &filename, const std::string &format = "auto");
+
+    /// Closes the file.
+    void Close();
+
+    /// Returns true if a file is opened.
+    bool IsOpened() const { return is_opened_; }
+
+    /// Returns true if all the points have been read.
+    bool IsEOF() const { return eof_; }
+
+    /// Number of points of the file if its header tells, -1 otherwise.
+    int64_t GetNumPoints() const { return layout_.num_records_; }
+
+    /// Reads the next chunk of up to \p max_points points into \p chunk.
+    /// Returns false if there are no more points or reading fails.
+    bool ReadNext(int64_t max_points, geometry::PointCloud &chunk);
+
+private:
+    /// Reads the next chunk of binary records.
+    bool ReadNextBinary(int64_t max_points, geometry::PointCloud &chunk);
+    /// Reads the next lines of text. Returns false if they hold no point.
+    bool ReadNextText(int64_t max_points, geometry::PointCloud &chunk);
+
+    utility::filesystem::CFile file_;
+    PointCloudStreamLayout layout_;
+    bool is_opened_ = false;
+    /// True if all the records have been returned.
+    bool eof_ = true;
+    /// True if all the bytes of the file have been read into buffer_.
+    bool file_eof_ = true;
+    /// Number of records read so far.
+    int64_t num_read_ = 0;
+    /// Binary records of the current chunk, or text read from the file whose
+    /// lines from buffer_begin_ on have not been parsed yet.
+    std::vector<char> buffer_;
+    size_t buffer_begin_ = 0;
+};
+
+/// Returns the layout of the vertices of a PLY file.
+bool ReadPLYStreamLayout(const std::string &filename,
+                         PointCloudStreamLayout &layout);
+
+/// Returns the layout of the points of a PCD file.
+bool ReadPCDStreamLayout(const std::string &filename,
+                         PointCloudStreamLayout &layout);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,494 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/TensorMapIO.h"
+
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "open3d/core/Blob.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/NumpyIO.h"
+#include "open3d/core/Profiler.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+// File layout, with integers in little-endian byte order:
+//   char[8] magic "O3DTMAP"
+//   uint32  format version
+//   uint32  number of tensors
+//   string  primary key
+//   For each tensor:
+//     string  name
+//     string  dtype name, e.g. "Float32"
+//     uint32  number of dimensions, followed by one int64 per dimension
+//     uint32  block compression, see BlockCompression
+//     int64   block offset from the beginning of the file
+//     int64   block size in the file
+//   One data block per tensor, aligned to BLOCK_ALIGNMENT bytes.
+// A string is stored as a uint64 length followed by its characters.
+//
+// A compressed block starts with a table of uint32 stored sizes for each
+// LZF_CHUNK_BYTES chunk of the raw data, followed by the chunks. A chunk whose
+// stored size equals its raw size is stored uncompressed.
+static const char TENSOR_MAP_MAGIC[8] = {'O', '3', 'D', 'T', 'M', 'A', 'P', 0};
+static constexpr uint32_t TENSOR_MAP_VERSION = 1;
+static constexpr int64_t BLOCK_ALIGNMENT = 64;
+static constexpr int64_t LZF_CHUNK_BYTES = 1 << 20;
+// Upper bound of header strings, to reject corrupted files early.
+static constexpr uint64_t MAX_STRING_SIZE = 1 << 20;
+
+enum class BlockCompression : uint32_t { None = 0, LZF = 1 };
+
+struct BlockInfo {
+    std::string name_;
+    core::Dtype dtype_;
+    core::SizeVector shape_;
+    BlockCompression compression_;
+    int64_t offset_;
+    int64_t stored_bytes_;
+
+    int64_t NumBytes() const {
+        return shape_.NumElements() * dtype_.ByteSize();
+    }
+};
+
+template <typename T>
+static void AppendValue(std::vector<char> &header, T value) {
+    const char *bytes = reinterpret_cast<const char *>(&value);
+    header.insert(header.end(), bytes, bytes + sizeof(T));
+}
+
+static void AppendString(std::vector<char> &header, const std::string &str) {
+    AppendValue<uint64_t>(header, str.size());
+    header.insert(header.end(), str.begin(), str.end());
+}
+
+static std::vector<char> CreateHeader(const std::string &primary_key,
+                                      const std::vector<BlockInfo> &blocks) {
+    std::vector<char> header(TENSOR_MAP_MAGIC,
+                             TENSOR_MAP_MAGIC + sizeof(TENSOR_MAP_MAGIC));
+    AppendValue<uint32_t>(header, TENSOR_MAP_VERSION);
+    AppendValue<uint32_t>(header, static_cast<uint32_t>(blocks.size()));
+    AppendString(header, primary_key);
+    for (const BlockInfo &block : blocks) {
+        AppendString(header, block.name_);
+        AppendString(header, block.dtype_.ToString());
+        AppendValue<uint32_t>(header,
+                              static_cast<uint32_t>(block.shape_.size()));
+        for (int64_t size : block.shape_) {
+            AppendValue<int64_t>(header, size);
+        }
+        AppendValue<uint32_t>(header,
+                              static_cast<uint32_t>(block.compression_));
+        AppendValue<int64_t>(header, block.offset_);
+        AppendValue<int64_t>(header, block.stored_bytes_);
+    }
+    return header;
+}
+
+/// Reads header fields sequentially from a file. Once a read fails, all
+/// following reads return zero-initialized values and IsOk() returns false.
+class HeaderReader {
+public:
+    explicit HeaderReader(FILE *fp) : fp_(fp) {}
+
+    template <typename T>
+    T Read() {
+        T value{};
+        if (ok_ && fread(&value, sizeof(T), 1, fp_) != 1) {
+            ok_ = false;
+        }
+        return value;
+    }
+
+    std::string ReadString() {
+        const uint64_t size = Read<uint64_t>();
+        if (!ok_ || size > MAX_STRING_SIZE) {
+            ok_ = false;
+            return "";
+        }
+        std::string str(size, '\0');
+        if (size > 0 && fread(&str[0], 1, size, fp_) != size) {
+            ok_ = false;
+        }
+        return str;
+    }
+
+    bool IsOk() const { return ok_; }
+
+private:
+    FILE *fp_;
+    bool ok_ = true;
+};
+
+static bool DtypeFromString(const std::string &name, core::Dtype &dtype) {
+    static const std::vector<core::Dtype> dtypes{
+            core::Dtype::Float32, core::Dtype::Float64, core::Dtype::Float16,
+            core::Dtype::BFloat16, core::Dtype::Int8,   core::Dtype::Int16,
+            core::Dtype::Int32,    core::Dtype::Int64,  core::Dtype::UInt8,
+            core::Dtype::UInt16,   core::Dtype::UInt32, core::Dtype::UInt64,
+            core::Dtype::Bool};
+    for (const core::Dtype &candidate : dtypes) {
+        if (candidate.ToString() == name) {
+            dtype = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool Seek(FILE *fp, int64_t offset) {
+#ifdef _WIN32
+    return _fseeki64(fp, offset, SEEK_SET) == 0;
+#else
+    return fseeko(fp, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
+
+static int64_t NumChunks(int64_t num_bytes) {
+    return (num_bytes + LZF_CHUNK_BYTES - 1) / LZF_CHUNK_BYTES;
+}
+
+/// Compresses \p num_bytes of \p src chunk by chunk in parallel, and returns
+/// the compressed block.
+static std::vector<char> CompressBlock(const char *src, int64_t num_bytes) {
+    const int64_t num_chunks = NumChunks(num_bytes);
+    std::vector<std::vector<char>> chunks(num_chunks);
+    std::vector<uint32_t> stored_sizes(num_chunks);
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t i = 0; i < num_chunks; ++i) {
+        const char *chunk_src = src + i * LZF_CHUNK_BYTES;
+        const unsigned int chunk_bytes = static_cast<unsigned int>(
+                std::min(LZF_CHUNK_BYTES, num_bytes - i * LZF_CHUNK_BYTES));
+        std::vector<char> &chunk = chunks[i];
+        chunk.resize(chunk_bytes);
+        // Keep the compressed chunk only if it is smaller than the input.
+        unsigned int stored_bytes = lzf_compress(chunk_src, chunk_bytes,
+                                                 chunk.data(), chunk_bytes - 1);
+        if (stored_bytes == 0) {
+            std::memcpy(chunk.data(), chunk_src, chunk_bytes);
+            stored_bytes = chunk_bytes;
+        }
+        chunk.resize(stored_bytes);
+        stored_sizes[i] = stored_bytes;
+    }
+
+    const char *table = reinterpret_cast<const char *>(stored_sizes.data());
+    std::vector<char> block(table, table + num_chunks * sizeof(uint32_t));
+    for (const std::vector<char> &chunk : chunks) {
+        block.insert(block.end(), chunk.begin(), chunk.end());
+    }
+    return block;
+}
+
+/// Decompresses a block of \p stored_bytes into \p num_bytes of \p dst.
+/// Returns false if the block is corrupted.
+static bool DecompressBlock(const char *block,
+                            int64_t stored_bytes,
+                            char *dst,
+                            int64_t num_bytes) {
+    const int64_t num_chunks = NumChunks(num_bytes);
+    const int64_t table_bytes = num_chunks * sizeof(uint32_t);
+    if (stored_bytes < table_bytes) {
+        return false;
+    }
+    std::vector<uint32_t> stored_sizes(num_chunks);
+    std::memcpy(stored_sizes.data(), block, table_bytes);
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, table_bytes);
+    for (int64_t i = 0; i < num_chunks; ++i) {
+        chunk_offsets[i + 1] = chunk_offsets[i] + stored_sizes[i];
+    }
+    if (chunk_offsets.back() != stored_bytes) {
+        return false;
+    }
+
+    bool success = true;
+#pragma omp parallel for schedule(dynamic) reduction(&& : success)
+    for (int64_t i = 0; i < num_chunks; ++i) {
+        char *chunk_dst = dst + i * LZF_CHUNK_BYTES;
+        const unsigned int chunk_bytes = static_cast<unsigned int>(
+                std::min(LZF_CHUNK_BYTES, num_bytes - i * LZF_CHUNK_BYTES));
+        const char *chunk_src = block + chunk_offsets[i];
+        if (stored_sizes[i] == chunk_bytes) {
+            std::memcpy(chunk_dst, chunk_src, chunk_bytes);
+        } else {
+            success = lzf_decompress(chunk_src, stored_sizes[i], chunk_dst,
+                                     chunk_bytes) == chunk_bytes;
+        }
+    }
+    return success;
+}
+
+bool WriteTensorMap(const std::string &filename,
+                    const geometry::TensorMap &tensor_map,
+                    bool compressed) {
+    std::vector<BlockInfo> blocks;
+    std::vector<core::Tensor> host_tensors;
+    for (const auto &kv : tensor_map) {
+        const core::Tensor &tensor = kv.second;
+        if (tensor.GetDtype().IsObject()) {
+            utility::LogWarning(
+                    "Write TensorMap failed: tensor {} has unsupported dtype "
+                    "{}.",
+                    kv.first, tensor.GetDtype().ToString());
+            return false;
+        }
+        blocks.push_back({kv.first, tensor.GetDtype(), tensor.GetShape(),
+                          compressed ? BlockCompression::LZF
+                                     : BlockCompression::None,
+                          0, 0});
+        host_tensors.push_back(
+                tensor.Contiguous().To(core::Device("CPU:0")));
+    }
+
+    FILE *fp = fopen(filename.c_str(), "wb");
+    if (!fp) {
+        utility::LogWarning("Write TensorMap failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    const std::string primary_key = tensor_map.GetPrimaryKey();
+    // Block offsets are not known yet. The header has the same size once they
+    // are filled in, so it is written again at the end.
+    int64_t offset = CreateHeader(primary_key, blocks).size();
+    bool success = Seek(fp, offset);
+    const std::vector<char> padding(BLOCK_ALIGNMENT, 0);
+    for (size_t i = 0; i < blocks.size() && success; ++i) {
+        BlockInfo &block = blocks[i];
+        const int64_t padding_bytes =
+                (BLOCK_ALIGNMENT - offset % BLOCK_ALIGNMENT) % BLOCK_ALIGNMENT;
+        if (padding_bytes > 0) {
+            success = fwrite(padding.data(), 1, padding_bytes, fp) ==
+                      static_cast<size_t>(padding_bytes);
+        }
+        offset += padding_bytes;
+        block.offset_ = offset;
+
+        const char *data =
+                static_cast<const char *>(host_tensors[i].GetDataPtr());
+        if (block.compression_ == BlockCompression::LZF) {
+            std::vector<char> compressed_block =
+                    CompressBlock(data, block.NumBytes());
+            block.stored_bytes_ = compressed_block.size();
+            success = success &&
+                      fwrite(compressed_block.data(), 1,
+                             compressed_block.size(),
+                             fp) == compressed_block.size();
+        } else {
+            block.stored_bytes_ = block.NumBytes();
+            success = success && (block.stored_bytes_ == 0 ||
+                                  fwrite(data, 1, block.stored_bytes_, fp) ==
+                                          static_cast<size_t>(
+                                                  block.stored_bytes_));
+        }
+        offset += block.stored_bytes_;
+    }
+
+    const std::vector<char> header = CreateHeader(primary_key, blocks);
+    success = success && Seek(fp, 0) &&
+              fwrite(header.data(), 1, header.size(), fp) == header.size();
+    success = fclose(fp) == 0 && success;
+    if (!success) {
+        utility::LogWarning("Write TensorMap failed: unable to write file: {}",
+                            filename);
+    }
+    return success;
+}
+
+bool ReadTensorMap(const std::string &filename,
+                   geometry::TensorMap &tensor_map,
+                   const core::Device &device,
+                   core::Tensor::MmapMode mmap_mode) {
+    OPEN3D_PROFILE_SCOPE("t::io::ReadTensorMap");
+    FILE *fp = fopen(filename.c_str(), "rb");
+    if (!fp) {
+        utility::LogWarning("Read TensorMap failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+
+    HeaderReader reader(fp);
+    char magic[sizeof(TENSOR_MAP_MAGIC)];
+    for (char &c : magic) {
+        c = reader.Read<char>();
+    }
+    const uint32_t version = reader.Read<uint32_t>();
+    if (!reader.IsOk() ||
+        std::memcmp(magic, TENSOR_MAP_MAGIC, sizeof(magic)) != 0 ||
+        version != TENSOR_MAP_VERSION) {
+        utility::LogWarning(
+                "Read TensorMap failed: {} is not a TensorMap file of "
+                "version {}.",
+                filename, TENSOR_MAP_VERSION);
+        fclose(fp);
+        return false;
+    }
+    const uint32_t num_blocks = reader.Read<uint32_t>();
+    const std::string primary_key = reader.ReadString();
+    std::vector<BlockInfo> blocks;
+    for (uint32_t i = 0; i < num_blocks && reader.IsOk(); ++i) {
+        BlockInfo block;
+        block.name_ = reader.ReadString();
+        const std::string dtype_name = reader.ReadString();
+        const uint32_t num_dims = reader.Read<uint32_t>();
+        for (uint32_t d = 0; d < num_dims && reader.IsOk(); ++d) {
+            block.shape_.push_back(reader.Read<int64_t>());
+        }
+        const uint32_t compression = reader.Read<uint32_t>();
+        block.compression_ = static_cast<BlockCompression>(compression);
+        block.offset_ = reader.Read<int64_t>();
+        block.stored_bytes_ = reader.Read<int64_t>();
+        if (reader.IsOk() &&
+            (!DtypeFromString(dtype_name, block.dtype_) ||
+             compression > static_cast<uint32_t>(BlockCompression::LZF) ||
+             std::any_of(block.shape_.begin(), block.shape_.end(),
+                         [](int64_t size) { return size < 0; }) ||
+             (block.compression_ == BlockCompression::None &&
+              block.stored_bytes_ != block.NumBytes()))) {
+            utility::LogWarning(
+                    "Read TensorMap failed: invalid header of tensor {}.",
+                    block.name_);
+            fclose(fp);
+            return false;
+        }
+        blocks.push_back(block);
+    }
+    if (!reader.IsOk()) {
+        utility::LogWarning("Read TensorMap failed: {} is truncated.",
+                            filename);
+        fclose(fp);
+        return false;
+    }
+
+    // Uncompressed blocks share one mapping of the file.
+    std::shared_ptr<core::Blob> file_blob;
+    if (mmap_mode != core::Tensor::MmapMode::None) {
+        int64_t map_bytes = 0;
+        for (const BlockInfo &block : blocks) {
+            if (block.compression_ == BlockCompression::None) {
+                map_bytes = std::max(map_bytes,
+                                     block.offset_ + block.stored_bytes_);
+            }
+        }
+        if (map_bytes > 0) {
+            file_blob = core::MapFile(
+                    filename, 0, map_bytes,
+                    mmap_mode == core::Tensor::MmapMode::CopyOnWrite);
+        }
+    }
+
+    geometry::TensorMap result(primary_key);
+    bool success = true;
+    for (const BlockInfo &block : blocks) {
+        core::Tensor tensor;
+        if (block.compression_ == BlockCompression::None && file_blob &&
+            block.stored_bytes_ > 0) {
+            char *file_ptr = static_cast<char *>(file_blob->GetDataPtr());
+            char *data_ptr = file_ptr + block.offset_;
+            core::SizeVector strides =
+                    core::shape_util::DefaultStrides(block.shape_);
+            tensor = core::Tensor(block.shape_, strides, data_ptr,
+                                  block.dtype_, file_blob);
+        } else {
+            tensor = core::Tensor::Empty(block.shape_, block.dtype_);
+            char *data_ptr = static_cast<char *>(tensor.GetDataPtr());
+            if (block.compression_ == BlockCompression::LZF) {
+                std::vector<char> compressed_block(block.stored_bytes_);
+                success = Seek(fp, block.offset_) &&
+                          fread(compressed_block.data(), 1,
+                                compressed_block.size(),
+                                fp) == compressed_block.size() &&
+                          DecompressBlock(compressed_block.data(),
+                                          block.stored_bytes_, data_ptr,
+                                          block.NumBytes());
+            } else if (block.stored_bytes_ > 0) {
+                success = Seek(fp, block.offset_) &&
+                          fread(data_ptr, 1, block.stored_bytes_, fp) ==
+                                  static_cast<size_t>(block.stored_bytes_);
+            }
+        }
+        if (!success) {
+            utility::LogWarning(
+                    "Read TensorMap failed: unable to read tensor {} from {}.",
+                    block.name_, filename);
+            fclose(fp);
+            return false;
+        }
+        result[block.name_] = tensor.To(device);
+    }
+    fclose(fp);
+
+    if (!result.empty() && !result.Contains(primary_key)) {
+        utility::LogWarning(
+                "Read TensorMap failed: primary key {} is not in the file.",
+                primary_key);
+        return false;
+    }
+    tensor_map = result;
+    return true;
+}
+
+bool WriteTensor(const std::string &filename,
+                 const core::Tensor &tensor,
+                 bool compressed) {
+    return WriteTensorMap(filename,
+                          geometry::TensorMap("tensor", {{"tensor", tensor}}),
+                          compressed);
+}
+
+bool ReadTensor(const std::string &filename,
+                core::Tensor &tensor,
+                const core::Device &device,
+                core::Tensor::MmapMode mmap_mode) {
+    geometry::TensorMap tensor_map("tensor");
+    if (!ReadTensorMap(filename, tensor_map, device, mmap_mode)) {
+        return false;
+    }
+    if (tensor_map.size() != 1) {
+        utility::LogWarning(
+                "Read Tensor failed: {} contains {} tensors instead of 1.",
+                filename, tensor_map.size());
+        return false;
+    }
+    tensor = tensor_map.begin()->second;
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/TensorMap.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// Writes a TensorMap to a native binary file. The file consists of a header
+/// with the primary key and the name, dtype and shape of each tensor,
+/// followed by one 64-byte aligned raw data block per tensor. Tensors on any
+/// device are supported.
+///
+/// \param filename Path to the file, typically with the extension ".o3dt".
+/// \param tensor_map The TensorMap to write.
+/// \param compressed If true, each block is compressed with LZF in fixed-size
+/// chunks. Compressed blocks cannot be memory-mapped when reading.
+/// \return return true if the write function is successful, false otherwise.
+bool WriteTensorMap(const std::string &filename,
+                    const geometry::TensorMap &tensor_map,
+                    bool compressed = false);
+
+/// Reads a TensorMap written by WriteTensorMap.
+///
+/// \param filename Path to the file.
+/// \param tensor_map The TensorMap to read into. Its contents and primary key
+/// are replaced.
+/// \param device The device to place the tensors on. Dtypes and shapes are
+/// restored as written.
+/// \param mmap_mode If not MmapMode::None, uncompressed blocks are backed by
+/// the memory-mapped file instead of being read, see core::Tensor::Load. This
+/// only avoids copies when \p device is CPU:0.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadTensorMap(
+        const std::string &filename,
+        geometry::TensorMap &tensor_map,
+        const core::Device &device = core::Device("CPU:0"),
+        core::Tensor::MmapMode mmap_mode = core::Tensor::MmapMode::None);
+
+/// Writes a single Tensor in the format of WriteTensorMap.
+bool WriteTensor(const std::string &filename,
+                 const core::Tensor &tensor,
+                 bool compressed = false);
+
+/// Reads a single Tensor written by WriteTensor.
+bool ReadTensor(
+        const std::string &filename,
+        core::Tensor &tensor,
+        const core::Device &device = core::Device("CPU:0"),
+        core::Tensor::MmapMode mmap_mode = core::Tensor::MmapMode::None);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include <unordered_map>
 
+#include "open3d/core/Profiler.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 
@@ -40,7 +41,10 @@ static const std::unordered_map<
         std::function<bool(const std::string &,
                            geometry::TriangleMesh &,
                            const open3d::io::ReadTriangleMeshOptions &)>>
-        file_extension_to_trianglemesh_read_function{};
+        file_extension_to_trianglemesh_read_function{
+                {"glb", ReadTriangleMeshFromGLTF},
+                {"gltf", ReadTriangleMeshFromGLTF},
+        };
 
 static const std::unordered_map<
         std::string,
@@ -52,7 +56,10 @@ static const std::unordered_map<
                            const bool,
                            const bool,
                            const bool)>>
-        file_extension_to_trianglemesh_write_function{};
+        file_extension_to_trianglemesh_write_function{
+                {"glb", WriteTriangleMeshToGLTF},
+                {"gltf", WriteTriangleMeshToGLTF},
+        };
 
 std::shared_ptr<geometry::TriangleMesh> CreateMeshFromFile(
         const std::string &filename, bool print_progress) {
@@ -79,6 +86,7 @@ std::shared_ptr<geometry::TriangleMesh> CreateMeshFromFile(
 bool ReadTriangleMesh(const std::string &filename,
                       geometry::TriangleMesh &mesh,
                       open3d::io::ReadTriangleMeshOptions params) {
+    OPEN3D_PROFILE_SCOPE("t::io::ReadTriangleMesh");
     std::string filename_ext =
             utility::filesystem::GetFileExtensionInLowerCase(filename);
     if (filename_ext.empty()) {
@@ -63,6 +63,25 @@ bool WriteTriangleMesh(const std::string &filename,
                        bool write_triangle_uvs = true,
                        bool print_progress = false);
 
+/// Reads the meshes of a glTF or GLB file into one TriangleMesh. The
+/// accessors are mapped into tensors without per-element conversion and the
+/// primitives are decoded in parallel. Node transformations are applied.
+bool ReadTriangleMeshFromGLTF(
+        const std::string &filename,
+        geometry::TriangleMesh &mesh,
+        const open3d::io::ReadTriangleMeshOptions &params);
+
+/// Writes the vertices, normals and colors as one interleaved float buffer
+/// view followed by 32 bit indices. A .glb extension writes a binary file.
+bool WriteTriangleMeshToGLTF(const std::string &filename,
+                             const geometry::TriangleMesh &mesh,
+                             const bool write_ascii,
+                             const bool compressed,
+                             const bool write_vertex_normals,
+                             const bool write_vertex_colors,
+                             const bool write_triangle_uvs,
+                             const bool print_progress);
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
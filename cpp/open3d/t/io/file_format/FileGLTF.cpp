@@ -0,0 +1,484 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// The implementation of tinygltf is compiled in io/file_format/FileGLTF.cpp.
+#undef TINYGLTF_IMPLEMENTATION
+#undef STB_IMAGE_IMPLEMENTATION
+#undef STB_IMAGE_WRITE_IMPLEMENTATION
+#include <tiny_gltf.h>
+
+#include <Eigen/Geometry>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+namespace {
+
+/// Tensors of one glTF primitive, transformed by its node.
+struct GLTFPrimitive {
+    core::Tensor vertices;
+    core::Tensor normals;
+    core::Tensor colors;
+    core::Tensor triangles;
+};
+
+core::Dtype ComponentTypeToDtype(int component_type) {
+    switch (component_type) {
+        case TINYGLTF_COMPONENT_TYPE_BYTE:
+            return core::Dtype::Int8;
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+            return core::Dtype::UInt8;
+        case TINYGLTF_COMPONENT_TYPE_SHORT:
+            return core::Dtype::Int16;
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+            return core::Dtype::UInt16;
+        case TINYGLTF_COMPONENT_TYPE_INT:
+            return core::Dtype::Int32;
+        case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT:
+            return core::Dtype::UInt32;
+        case TINYGLTF_COMPONENT_TYPE_FLOAT:
+            return core::Dtype::Float32;
+        default:
+            utility::LogError("Unsupported glTF component type {}.",
+                              component_type);
+    }
+    return core::Dtype::Undefined;
+}
+
+/// Returns a [count, num_components] tensor viewing the data of the accessor
+/// in the buffer of \p model, which the tensor keeps alive. Interleaved
+/// buffer views are mapped with strides, so no data is copied.
+core::Tensor AccessorToTensor(const std::shared_ptr<tinygltf::Model> &model,
+                              int accessor_id) {
+    if (accessor_id < 0 || accessor_id >= int(model->accessors.size())) {
+        utility::LogError("Invalid glTF accessor {}.", accessor_id);
+    }
+    const tinygltf::Accessor &accessor = model->accessors[accessor_id];
+    if (accessor.sparse.isSparse || accessor.bufferView < 0) {
+        utility::LogError("Sparse glTF accessors are not supported.");
+    }
+    const tinygltf::BufferView &view = model->bufferViews[accessor.bufferView];
+    tinygltf::Buffer &buffer = model->buffers[view.buffer];
+
+    const core::Dtype dtype = ComponentTypeToDtype(accessor.componentType);
+    const int64_t element_size = dtype.ByteSize();
+    const int64_t num_components =
+            tinygltf::GetNumComponentsInType(accessor.type);
+    const int64_t byte_stride = accessor.ByteStride(view);
+    const int64_t count = int64_t(accessor.count);
+    const size_t begin = view.byteOffset + accessor.byteOffset;
+    if (num_components <= 0 || byte_stride <= 0 ||
+        byte_stride % element_size != 0 ||
+        (count > 0 &&
+         begin + (count - 1) * byte_stride + num_components * element_size >
+                 buffer.data.size())) {
+        utility::LogError("Invalid glTF accessor {}.", accessor_id);
+    }
+
+    void *data_ptr = buffer.data.data() + begin;
+    auto blob = std::make_shared<core::Blob>(core::Device("CPU:0"), data_ptr,
+                                             [model](void *) {});
+    return core::Tensor({count, num_components},
+                        {byte_stride / element_size, 1}, data_ptr, dtype,
+                        blob);
+}
+
+/// Returns the transformation of \p node relative to its parent.
+Eigen::Matrix4d GetNodeTransform(const tinygltf::Node &node) {
+    if (node.matrix.size() == 16) {
+        return Eigen::Map<const Eigen::Matrix4d>(node.matrix.data());
+    }
+    // The scale is applied first, then the rotation and the translation.
+    Eigen::Matrix4d transform = Eigen::Matrix4d::Identity();
+    if (node.scale.size() == 3) {
+        transform.topLeftCorner<3, 3>() =
+                Eigen::Vector3d(node.scale[0], node.scale[1], node.scale[2])
+                        .asDiagonal();
+    }
+    if (node.rotation.size() == 4) {
+        // glTF orders a quaternion as qx, qy, qz, qw.
+        transform.topLeftCorner<3, 3>() =
+                Eigen::Quaterniond(node.rotation[3], node.rotation[0],
+                                   node.rotation[1], node.rotation[2])
+                        .toRotationMatrix() *
+                transform.topLeftCorner<3, 3>();
+    }
+    if (node.translation.size() == 3) {
+        transform.block<3, 1>(0, 3) = Eigen::Vector3d(
+                node.translation[0], node.translation[1], node.translation[2]);
+    }
+    return transform;
+}
+
+/// Converts integer colors to floats in [0, 1] and drops the alpha channel.
+core::Tensor ColorsToFloat(const core::Tensor &colors) {
+    core::Tensor rgb = colors.Slice(1, 0, 3);
+    if (rgb.GetDtype() == core::Dtype::UInt8) {
+        return rgb.To(core::Dtype::Float32).Div_(255.0);
+    } else if (rgb.GetDtype() == core::Dtype::UInt16) {
+        return rgb.To(core::Dtype::Float32).Div_(65535.0);
+    }
+    return rgb.To(core::Dtype::Float32);
+}
+
+GLTFPrimitive ReadPrimitive(const std::shared_ptr<tinygltf::Model> &model,
+                            const tinygltf::Primitive &primitive,
+                            const Eigen::Matrix4d &transform) {
+    GLTFPrimitive result;
+    for (const auto &attribute : primitive.attributes) {
+        if (attribute.first == "POSITION") {
+            result.vertices = AccessorToTensor(model, attribute.second);
+        } else if (attribute.first == "NORMAL") {
+            result.normals = AccessorToTensor(model, attribute.second);
+        } else if (attribute.first == "COLOR_0") {
+            result.colors =
+                    ColorsToFloat(AccessorToTensor(model, attribute.second));
+        }
+    }
+    if (result.vertices.NumElements() == 0 ||
+        result.vertices.GetShape(1) != 3 ||
+        result.vertices.GetDtype() != core::Dtype::Float32) {
+        utility::LogError("glTF primitive without float positions.");
+    }
+    const int64_t num_vertices = result.vertices.GetLength();
+
+    core::Tensor indices;
+    if (primitive.indices >= 0) {
+        indices = AccessorToTensor(model, primitive.indices)
+                          .Reshape({-1})
+                          .To(core::Dtype::Int64);
+    } else {
+        indices = core::Tensor::Arange(0, num_vertices, 1, core::Dtype::Int64);
+    }
+    const int64_t num_indices = indices.GetLength();
+    const int mode = primitive.mode < 0 ? TINYGLTF_MODE_TRIANGLES
+                                        : primitive.mode;
+    if (mode == TINYGLTF_MODE_TRIANGLES) {
+        result.triangles = indices.Slice(0, 0, num_indices / 3 * 3)
+                                   .Reshape({num_indices / 3, 3});
+    } else if (mode == TINYGLTF_MODE_TRIANGLE_STRIP ||
+               mode == TINYGLTF_MODE_TRIANGLE_FAN) {
+        const int64_t num_triangles = std::max(num_indices - 2, int64_t(0));
+        result.triangles = core::Tensor({num_triangles, 3}, core::Dtype::Int64);
+        const int64_t *src = indices.Contiguous().GetDataPtr<int64_t>();
+        int64_t *dst = result.triangles.GetDataPtr<int64_t>();
+        for (int64_t i = 0; i < num_triangles; ++i) {
+            dst[3 * i] = mode == TINYGLTF_MODE_TRIANGLE_FAN ? src[0] : src[i];
+            dst[3 * i + 1] = src[i + 1];
+            dst[3 * i + 2] = src[i + 2];
+        }
+    } else {
+        result.triangles = core::Tensor({0, 3}, core::Dtype::Int64);
+    }
+
+    if (!transform.isIdentity()) {
+        const core::Tensor rotation =
+                core::eigen_converter::EigenMatrixToTensor(
+                        Eigen::Matrix3f(
+                                transform.topLeftCorner<3, 3>().cast<float>()))
+                        .T();
+        const core::Tensor translation =
+                core::eigen_converter::EigenMatrixToTensor(
+                        Eigen::RowVector3f(transform.block<3, 1>(0, 3)
+                                                   .transpose()
+                                                   .cast<float>()));
+        result.vertices = result.vertices.Matmul(rotation).Add_(translation);
+        if (result.normals.NumElements() > 0) {
+            result.normals =
+                    result.normals.To(core::Dtype::Float32).Matmul(rotation);
+        }
+    }
+    return result;
+}
+
+/// Concatenates \p parts along the first dimension, offsetting each part by
+/// \p offsets if given.
+core::Tensor ConcatenateParts(const std::vector<core::Tensor> &parts,
+                              const std::vector<int64_t> &offsets = {}) {
+    if (parts.size() == 1 && offsets.empty()) {
+        return parts[0].Contiguous();
+    }
+    int64_t length = 0;
+    for (const core::Tensor &part : parts) {
+        length += part.GetLength();
+    }
+    core::Tensor result({length, parts[0].GetShape(1)}, parts[0].GetDtype());
+    int64_t begin = 0;
+    for (size_t i = 0; i < parts.size(); ++i) {
+        const int64_t end = begin + parts[i].GetLength();
+        core::Tensor slice = result.Slice(0, begin, end);
+        slice.CopyFrom(parts[i]);
+        if (!offsets.empty() && offsets[i] != 0) {
+            slice.Add_(offsets[i]);
+        }
+        begin = end;
+    }
+    return result;
+}
+
+}  // namespace
+
+bool ReadTriangleMeshFromGLTF(const std::string &filename,
+                              geometry::TriangleMesh &mesh,
+                              const open3d::io::ReadTriangleMeshOptions &) {
+    auto model = std::make_shared<tinygltf::Model>();
+    tinygltf::TinyGLTF loader;
+    // Images are not decoded, since tensor meshes do not have textures.
+    loader.SetImageLoader(
+            [](tinygltf::Image *, const int, std::string *, std::string *, int,
+               int, const unsigned char *, int, void *) { return true; },
+            nullptr);
+    std::string warn;
+    std::string err;
+    const std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    bool ret;
+    if (filename_ext == "glb") {
+        ret = loader.LoadBinaryFromFile(model.get(), &err, &warn, filename);
+    } else {
+        ret = loader.LoadASCIIFromFile(model.get(), &err, &warn, filename);
+    }
+    if (!ret) {
+        utility::LogWarning("Read GLTF failed: unable to open file {}: {}",
+                            filename, err);
+        return false;
+    }
+
+    // The primitives of all nodes with a mesh are decoded in parallel.
+    std::vector<std::pair<const tinygltf::Primitive *, Eigen::Matrix4d>>
+            primitives;
+    for (const tinygltf::Node &node : model->nodes) {
+        if (node.mesh < 0 || node.mesh >= int(model->meshes.size())) {
+            continue;
+        }
+        const Eigen::Matrix4d transform = GetNodeTransform(node);
+        for (const tinygltf::Primitive &primitive :
+             model->meshes[node.mesh].primitives) {
+            primitives.emplace_back(&primitive, transform);
+        }
+    }
+    const int num_primitives = int(primitives.size());
+    std::vector<GLTFPrimitive> results(num_primitives);
+    std::vector<std::string> errors(num_primitives);
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < num_primitives; ++i) {
+        try {
+            results[i] = ReadPrimitive(model, *primitives[i].first,
+                                       primitives[i].second);
+        } catch (const std::exception &e) {
+            errors[i] = e.what();
+        }
+    }
+    for (const std::string &error : errors) {
+        if (!error.empty()) {
+            utility::LogWarning("Read GLTF failed: {}", error);
+            return false;
+        }
+    }
+
+    mesh.Clear();
+    if (results.empty()) {
+        return true;
+    }
+    std::vector<core::Tensor> vertices, normals, colors, triangles;
+    std::vector<int64_t> offsets;
+    int64_t num_vertices = 0;
+    for (const GLTFPrimitive &result : results) {
+        vertices.push_back(result.vertices);
+        normals.push_back(result.normals);
+        colors.push_back(result.colors);
+        triangles.push_back(result.triangles);
+        offsets.push_back(num_vertices);
+        num_vertices += result.vertices.GetLength();
+    }
+    auto all_have = [](const std::vector<core::Tensor> &parts) {
+        return std::all_of(parts.begin(), parts.end(),
+                           [](const core::Tensor &part) {
+                               return part.NumElements() > 0;
+                           });
+    };
+    mesh.SetVertices(ConcatenateParts(vertices));
+    mesh.SetTriangles(ConcatenateParts(triangles, offsets));
+    if (all_have(normals)) {
+        for (core::Tensor &part : normals) {
+            part = part.To(core::Dtype::Float32);
+        }
+        mesh.SetVertexNormals(ConcatenateParts(normals));
+    }
+    if (all_have(colors)) {
+        mesh.SetVertexColors(ConcatenateParts(colors));
+    }
+    return true;
+}
+
+bool WriteTriangleMeshToGLTF(const std::string &filename,
+                             const geometry::TriangleMesh &mesh,
+                             const bool write_ascii,
+                             const bool /*compressed*/,
+                             const bool write_vertex_normals,
+                             const bool write_vertex_colors,
+                             const bool /*write_triangle_uvs*/,
+                             const bool /*print_progress*/) {
+    if (!mesh.HasVertices()) {
+        utility::LogWarning("Write GLTF failed: mesh has no vertices.");
+        return false;
+    }
+    const core::Device cpu("CPU:0");
+    const core::Tensor vertices =
+            mesh.GetVertices().To(cpu, core::Dtype::Float32).Contiguous();
+    const int64_t num_vertices = vertices.GetLength();
+    std::vector<core::Tensor> attributes = {vertices};
+    std::vector<std::string> names = {"POSITION"};
+    if (write_vertex_normals && mesh.HasVertexNormals()) {
+        attributes.push_back(mesh.GetVertexNormals()
+                                     .To(cpu, core::Dtype::Float32)
+                                     .Contiguous());
+        names.push_back("NORMAL");
+    }
+    if (write_vertex_colors && mesh.HasVertexColors()) {
+        attributes.push_back(mesh.GetVertexColors()
+                                     .To(cpu, core::Dtype::Float32)
+                                     .Contiguous());
+        names.push_back("COLOR_0");
+    }
+    const core::Tensor triangles =
+            mesh.HasTriangles() ? mesh.GetTriangles()
+                                          .To(cpu, core::Dtype::UInt32)
+                                          .Contiguous()
+                                : core::Tensor({0, 3}, core::Dtype::UInt32);
+    const int64_t num_indices = triangles.NumElements();
+
+    // The vertex attributes are interleaved in one buffer view, followed by
+    // the indices.
+    const int64_t num_attributes = int64_t(attributes.size());
+    const int64_t vertex_stride = num_attributes * 3 * sizeof(float);
+    const int64_t vertex_bytes = num_vertices * vertex_stride;
+    const int64_t index_bytes = num_indices * sizeof(uint32_t);
+
+    tinygltf::Model model;
+    model.asset.generator = "Open3D";
+    model.asset.version = "2.0";
+    model.defaultScene = 0;
+    tinygltf::Buffer buffer;
+    buffer.data.resize(vertex_bytes + index_bytes);
+    for (int64_t a = 0; a < num_attributes; ++a) {
+        const float *src = attributes[a].GetDataPtr<float>();
+        unsigned char *dst = buffer.data.data() + a * 3 * sizeof(float);
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_vertices; ++i) {
+            std::memcpy(dst + i * vertex_stride, src + 3 * i,
+                        3 * sizeof(float));
+        }
+    }
+    if (index_bytes > 0) {
+        std::memcpy(buffer.data.data() + vertex_bytes,
+                    triangles.GetDataPtr<uint32_t>(), index_bytes);
+    }
+    model.buffers.push_back(std::move(buffer));
+
+    tinygltf::BufferView vertex_view;
+    vertex_view.buffer = 0;
+    vertex_view.byteOffset = 0;
+    vertex_view.byteLength = vertex_bytes;
+    vertex_view.byteStride = vertex_stride;
+    vertex_view.target = TINYGLTF_TARGET_ARRAY_BUFFER;
+    model.bufferViews.push_back(vertex_view);
+
+    tinygltf::Primitive primitive;
+    primitive.mode = TINYGLTF_MODE_TRIANGLES;
+    for (int64_t a = 0; a < num_attributes; ++a) {
+        tinygltf::Accessor accessor;
+        accessor.bufferView = 0;
+        accessor.byteOffset = a * 3 * sizeof(float);
+        accessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
+        accessor.count = num_vertices;
+        accessor.type = TINYGLTF_TYPE_VEC3;
+        if (a == 0) {
+            const core::Tensor min_bound = vertices.Min({0});
+            const core::Tensor max_bound = vertices.Max({0});
+            for (int d = 0; d < 3; ++d) {
+                accessor.minValues.push_back(min_bound[d].Item<float>());
+                accessor.maxValues.push_back(max_bound[d].Item<float>());
+            }
+        }
+        primitive.attributes[names[a]] = int(model.accessors.size());
+        model.accessors.push_back(accessor);
+    }
+    if (num_indices > 0) {
+        tinygltf::BufferView index_view;
+        index_view.buffer = 0;
+        index_view.byteOffset = vertex_bytes;
+        index_view.byteLength = index_bytes;
+        index_view.target = TINYGLTF_TARGET_ELEMENT_ARRAY_BUFFER;
+        model.bufferViews.push_back(index_view);
+
+        tinygltf::Accessor accessor;
+        accessor.bufferView = 1;
+        accessor.componentType = TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT;
+        accessor.count = num_indices;
+        accessor.type = TINYGLTF_TYPE_SCALAR;
+        primitive.indices = int(model.accessors.size());
+        model.accessors.push_back(accessor);
+    }
+
+    tinygltf::Mesh gltf_mesh;
+    gltf_mesh.primitives.push_back(primitive);
+    model.meshes.push_back(gltf_mesh);
+    tinygltf::Node node;
+    node.mesh = 0;
+    model.nodes.push_back(node);
+    tinygltf::Scene scene;
+    scene.nodes.push_back(0);
+    model.scenes.push_back(scene);
+
+    const bool write_binary =
+            utility::filesystem::GetFileExtensionInLowerCase(filename) ==
+            "glb";
+    tinygltf::TinyGLTF writer;
+    if (!writer.WriteGltfSceneToFile(&model, filename, false, true,
+                                     write_ascii, write_binary)) {
+        utility::LogWarning("Write GLTF failed: unable to write file {}.",
+                            filename);
+        return false;
+    }
+    return true;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
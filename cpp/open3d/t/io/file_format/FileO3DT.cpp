@@ -0,0 +1,64 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/t/io/TensorMapIO.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+bool ReadImageFromO3DT(const std::string &filename, geometry::Image &image) {
+    core::Tensor tensor;
+    if (!ReadTensor(filename, tensor)) {
+        return false;
+    }
+    if (tensor.NumDims() != 3) {
+        utility::LogWarning(
+                "Read O3DT failed: image tensor must be 3D (rows, cols, "
+                "channels), but got shape {}.",
+                tensor.GetShape().ToString());
+        return false;
+    }
+    image = geometry::Image(tensor);
+    return true;
+}
+
+bool WriteImageToO3DT(const std::string &filename,
+                      const geometry::Image &image,
+                      int quality /* = kOpen3DImageIODefaultQuality*/) {
+    (void)quality;
+    if (image.IsEmpty()) {
+        utility::LogWarning("Write O3DT failed: image has no data.");
+        return false;
+    }
+    return WriteTensor(filename, image.AsTensor(), /*compressed=*/true);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
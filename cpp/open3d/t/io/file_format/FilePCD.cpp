@@ -0,0 +1,929 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <liblzf/lzf.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/NumpyIO.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/kernel/ParallelUtil.h"
+#include "open3d/io/FileFormatIO.h"
+#include "open3d/io/TextParser.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudStreamReader.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Helper.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/ProgressReporters.h"
+
+// References for PCD file IO
+// http://pointclouds.org/documentation/tutorials/pcd_file_format.html
+// https://github.com/PointCloudLibrary/pcl/blob/master/io/src/pcd_io.cpp
+
+namespace open3d {
+namespace t {
+namespace io {
+
+// Defined in FilePTS.cpp.
+core::Tensor ConvertColorTensorToUint8(const core::Tensor &color_in);
+
+namespace {
+
+enum class PCDDataType { ASCII, Binary, BinaryCompressed };
+
+struct PCDField {
+    std::string name_;
+    int size_ = 4;
+    char type_ = 'F';
+    int count_ = 1;
+    /// Byte offset of the field in a binary point record.
+    int64_t offset_ = 0;
+    /// Index of the first value of the field in an ASCII line.
+    int64_t value_offset_ = 0;
+};
+
+struct PCDHeader {
+    std::vector<PCDField> fields_;
+    int64_t num_points_ = -1;
+    PCDDataType data_type_ = PCDDataType::ASCII;
+    /// Byte size of a binary point record.
+    int64_t point_size_ = 0;
+    /// Number of values in an ASCII line.
+    int64_t num_values_ = 0;
+    /// Byte offset of the point data in the file.
+    int64_t data_offset_ = 0;
+};
+
+/// Dtype of a field with PCD \p type 'I', 'U' or 'F' and byte \p size.
+core::Dtype GetPCDFieldDtype(char type, int size) {
+    if (type == 'I') {
+        switch (size) {
+            case 1:
+                return core::Dtype::Int8;
+            case 2:
+                return core::Dtype::Int16;
+            case 4:
+                return core::Dtype::Int32;
+            case 8:
+                return core::Dtype::Int64;
+        }
+    } else if (type == 'U') {
+        switch (size) {
+            case 1:
+                return core::Dtype::UInt8;
+            case 2:
+                return core::Dtype::UInt16;
+            case 4:
+                return core::Dtype::UInt32;
+            case 8:
+                return core::Dtype::UInt64;
+        }
+    } else if (type == 'F') {
+        switch (size) {
+            case 4:
+                return core::Dtype::Float32;
+            case 8:
+                return core::Dtype::Float64;
+        }
+    }
+    return core::Dtype::Undefined;
+}
+
+/// PCD type of \p dtype. Returns false if \p dtype cannot be stored.
+bool GetPCDFieldType(const core::Dtype &dtype, char &type) {
+    if (dtype == core::Dtype::Float32 || dtype == core::Dtype::Float64) {
+        type = 'F';
+    } else if (dtype == core::Dtype::Int8 || dtype == core::Dtype::Int16 ||
+               dtype == core::Dtype::Int32 || dtype == core::Dtype::Int64) {
+        type = 'I';
+    } else if (dtype == core::Dtype::UInt8 || dtype == core::Dtype::UInt16 ||
+               dtype == core::Dtype::UInt32 || dtype == core::Dtype::UInt64 ||
+               dtype == core::Dtype::Bool) {
+        type = 'U';
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool IsColorField(const std::string &name) {
+    return name == "rgb" || name == "rgba";
+}
+
+bool ReadPCDHeader(const std::string &filename, PCDHeader &header) {
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        utility::LogWarning("Read PCD failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    int64_t width = 0, height = 1;
+    bool has_data = false;
+    const char *line;
+    while ((line = file.ReadLine())) {
+        std::vector<std::string> st = utility::SplitString(line, "\t\r\n ");
+        if (st.empty() || st[0][0] == '#') {
+            continue;
+        }
+        const std::string &line_type = st[0];
+        const size_t num_tokens = st.size() - 1;
+        if (line_type == "FIELDS" || line_type == "COLUMNS") {
+            header.fields_.resize(num_tokens);
+            for (size_t i = 0; i < num_tokens; ++i) {
+                header.fields_[i].name_ = st[i + 1];
+            }
+        } else if (line_type == "SIZE" || line_type == "TYPE" ||
+                   line_type == "COUNT") {
+            if (num_tokens != header.fields_.size()) {
+                utility::LogWarning("Read PCD failed: bad {} line.", line_type);
+                return false;
+            }
+            for (size_t i = 0; i < num_tokens; ++i) {
+                PCDField &field = header.fields_[i];
+                if (line_type == "SIZE") {
+                    field.size_ = std::stoi(st[i + 1]);
+                } else if (line_type == "TYPE") {
+                    field.type_ = st[i + 1][0];
+                } else {
+                    field.count_ = std::stoi(st[i + 1]);
+                }
+            }
+        } else if (line_type == "WIDTH" && num_tokens >= 1) {
+            width = std::stoll(st[1]);
+        } else if (line_type == "HEIGHT" && num_tokens >= 1) {
+            height = std::stoll(st[1]);
+        } else if (line_type == "POINTS" && num_tokens >= 1) {
+            header.num_points_ = std::stoll(st[1]);
+        } else if (line_type == "DATA") {
+            header.data_type_ = PCDDataType::ASCII;
+            if (num_tokens >= 1) {
+                if (st[1].substr(0, 17) == "binary_compressed") {
+                    header.data_type_ = PCDDataType::BinaryCompressed;
+                } else if (st[1].substr(0, 6) == "binary") {
+                    header.data_type_ = PCDDataType::Binary;
+                }
+            }
+            header.data_offset_ = file.CurPos();
+            has_data = true;
+            break;
+        }
+    }
+    if (!has_data || header.fields_.empty()) {
+        utility::LogWarning("Read PCD failed: incomplete header.");
+        return false;
+    }
+    if (header.num_points_ < 0) {
+        header.num_points_ = width * height;
+    }
+    for (PCDField &field : header.fields_) {
+        if (GetPCDFieldDtype(field.type_, field.size_) ==
+                    core::Dtype::Undefined ||
+            field.count_ <= 0) {
+            utility::LogWarning(
+                    "Read PCD failed: unsupported field {} of type {}{} and "
+                    "count {}.",
+                    field.name_, field.type_, field.size_, field.count_);
+            return false;
+        }
+        field.offset_ = header.point_size_;
+        field.value_offset_ = header.num_values_;
+        header.point_size_ += int64_t(field.size_) * field.count_;
+        header.num_values_ += field.count_;
+    }
+    return true;
+}
+
+/// Returns the {num_points, count} data of \p field, whose rows start at \p
+/// data and are \p stride bytes apart in \p blob. Aligned data is returned as
+/// a view of the blob, other data is copied.
+core::Tensor GetFieldData(const std::shared_ptr<core::Blob> &blob,
+                          const char *data,
+                          int64_t stride,
+                          int64_t num_points,
+                          const PCDField &field) {
+    const core::Dtype dtype = GetPCDFieldDtype(field.type_, field.size_);
+    const int64_t size = field.size_;
+    if (stride % size == 0 && reinterpret_cast<uintptr_t>(data) % size == 0) {
+        return core::Tensor({num_points, field.count_}, {stride / size, 1},
+                            const_cast<char *>(data), dtype, blob);
+    }
+    core::Tensor copy({num_points, field.count_}, dtype);
+    const int64_t row_bytes = size * field.count_;
+    char *dst = static_cast<char *>(copy.GetDataPtr());
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; ++i) {
+        std::memcpy(dst + i * row_bytes, data + i * stride, row_bytes);
+    }
+    return copy;
+}
+
+/// Unpacks the BGR bytes of the packed rgb(a) values at \p data, \p stride
+/// bytes apart, into {num_points, 3} UInt8 colors.
+core::Tensor UnpackColors(const char *data,
+                          int64_t stride,
+                          int64_t num_points) {
+    core::Tensor colors({num_points, 3}, core::Dtype::UInt8);
+    uint8_t *colors_ptr = colors.GetDataPtr<uint8_t>();
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < num_points; ++i) {
+        const uint8_t *bgr =
+                reinterpret_cast<const uint8_t *>(data + i * stride);
+        colors_ptr[3 * i + 0] = bgr[2];
+        colors_ptr[3 * i + 1] = bgr[1];
+        colors_ptr[3 * i + 2] = bgr[0];
+    }
+    return colors;
+}
+
+/// Concatenates the {num_points, 1} columns \p a, \p b and \p c. Columns that
+/// are interleaved in the same buffer are gathered by a single strided copy,
+/// or not copied at all if the buffer holds nothing else.
+core::Tensor GroupColumns(const core::Tensor &a,
+                          const core::Tensor &b,
+                          const core::Tensor &c) {
+    const char *a_ptr = static_cast<const char *>(a.GetDataPtr());
+    const char *b_ptr = static_cast<const char *>(b.GetDataPtr());
+    const char *c_ptr = static_cast<const char *>(c.GetDataPtr());
+    const int64_t byte_size = a.GetDtype().ByteSize();
+    if (a.GetDtype() == b.GetDtype() && a.GetDtype() == c.GetDtype() &&
+        a.GetBlob() == b.GetBlob() && a.GetBlob() == c.GetBlob() &&
+        a.GetStride(0) == b.GetStride(0) && a.GetStride(0) == c.GetStride(0) &&
+        b_ptr == a_ptr + byte_size && c_ptr == b_ptr + byte_size) {
+        return a.AsStrided({a.GetLength(), 3}, {a.GetStride(0), 1})
+                .Contiguous();
+    }
+    core::Tensor combined =
+            core::Tensor::Empty({a.GetLength(), 3}, a.GetDtype());
+    combined.Slice(1, 0, 1) = a;
+    combined.Slice(1, 1, 2) = b.To(a.GetDtype());
+    combined.Slice(1, 2, 3) = c.To(a.GetDtype());
+    return combined;
+}
+
+/// Sets the fields to \p pointcloud. x, y, z and normal_x, normal_y, normal_z
+/// are grouped into points and normals, the other fields are set by name.
+void SetPCDAttributes(std::map<std::string, core::Tensor> &attributes,
+                      geometry::PointCloud &pointcloud) {
+    const std::vector<std::pair<std::string, std::vector<std::string>>>
+            groups = {{"points", {"x", "y", "z"}},
+                      {"normals", {"normal_x", "normal_y", "normal_z"}}};
+    for (const auto &group : groups) {
+        const std::vector<std::string> &names = group.second;
+        if (attributes.count(names[0]) && attributes.count(names[1]) &&
+            attributes.count(names[2])) {
+            pointcloud.SetPointAttr(
+                    group.first, GroupColumns(attributes.at(names[0]),
+                                              attributes.at(names[1]),
+                                              attributes.at(names[2])));
+            for (const std::string &name : names) {
+                attributes.erase(name);
+            }
+        }
+    }
+    for (const auto &it : attributes) {
+        pointcloud.SetPointAttr(it.first, it.second.Contiguous());
+    }
+}
+
+/// Reads binary point records, one record of all fields per point.
+void ReadPCDBinary(const std::string &filename,
+                   const PCDHeader &header,
+                   std::map<std::string, core::Tensor> &attributes) {
+    const int64_t num_points = header.num_points_;
+    std::shared_ptr<core::Blob> blob =
+            core::MapFile(filename, header.data_offset_,
+                          num_points * header.point_size_,
+                          /*copy_on_write=*/true);
+    const char *block = static_cast<const char *>(blob->GetDataPtr());
+    for (const PCDField &field : header.fields_) {
+        const char *data = block + field.offset_;
+        if (IsColorField(field.name_) && field.size_ == 4) {
+            attributes["colors"] =
+                    UnpackColors(data, header.point_size_, num_points);
+        } else if (field.name_ != "_") {
+            attributes[field.name_] = GetFieldData(
+                    blob, data, header.point_size_, num_points, field);
+        }
+    }
+}
+
+/// Reads LZF compressed binary data, which stores the fields one after the
+/// other.
+bool ReadPCDBinaryCompressed(const std::string &filename,
+                             const PCDHeader &header,
+                             std::map<std::string, core::Tensor> &attributes) {
+    const int64_t num_points = header.num_points_;
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        return false;
+    }
+    uint32_t sizes[2];
+    if (fseek(file.GetFILE(), long(header.data_offset_), SEEK_SET) != 0 ||
+        file.ReadData(sizes, 2) != 2) {
+        utility::LogWarning("Read PCD failed: unable to read data sizes.");
+        return false;
+    }
+    const uint32_t compressed_size = sizes[0];
+    const uint32_t uncompressed_size = sizes[1];
+    if (int64_t(uncompressed_size) != num_points * header.point_size_) {
+        utility::LogWarning(
+                "Read PCD failed: {} bytes of data for {} points of {} "
+                "bytes.",
+                uncompressed_size, num_points, header.point_size_);
+        return false;
+    }
+    std::vector<char> compressed(compressed_size);
+    if (file.ReadData(compressed.data(), compressed_size) != compressed_size) {
+        utility::LogWarning("Read PCD failed: data is truncated.");
+        return false;
+    }
+    file.Close();
+
+    // The fields are views of the decompressed buffer.
+    core::Tensor buffer({int64_t(uncompressed_size)}, core::Dtype::UInt8);
+    if (lzf_decompress(compressed.data(), compressed_size,
+                       buffer.GetDataPtr(),
+                       uncompressed_size) != uncompressed_size) {
+        utility::LogWarning("Read PCD failed: decompression failed.");
+        return false;
+    }
+    const char *block = static_cast<const char *>(buffer.GetDataPtr());
+    for (const PCDField &field : header.fields_) {
+        const char *data = block + field.offset_ * num_points;
+        const int64_t stride = int64_t(field.size_) * field.count_;
+        if (IsColorField(field.name_) && field.size_ == 4) {
+            attributes["colors"] = UnpackColors(data, stride, num_points);
+        } else if (field.name_ != "_") {
+            attributes[field.name_] = GetFieldData(buffer.GetBlob(), data,
+                                                   stride, num_points, field);
+        }
+    }
+    return true;
+}
+
+/// Stores \p value at \p data[index] as \p dtype.
+void StoreValue(void *data,
+                const core::Dtype &dtype,
+                int64_t index,
+                double value) {
+    DISPATCH_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        static_cast<scalar_t *>(data)[index] = static_cast<scalar_t>(value);
+    });
+}
+
+/// Reads ASCII data, one line of values per point. Lines with too few values
+/// are skipped.
+void ReadPCDASCII(const std::string &filename,
+                  const PCDHeader &header,
+                  std::map<std::string, core::Tensor> &attributes) {
+    open3d::io::MappedTextFile file;
+    file.Open(filename);
+    const int64_t num_values = header.num_values_;
+    const char *data_begin =
+            std::min(file.Begin() + header.data_offset_, file.End());
+    const std::vector<const char *> lines = open3d::io::ParseLines<
+            const char *>(data_begin, file.End(),
+                          [num_values](const char *line, const char *line_end,
+                                       const char *&record) {
+                              record = line;
+                              return open3d::io::HasValues(line, line_end,
+                                                           num_values);
+                          });
+    const int64_t num_points =
+            std::min(header.num_points_, int64_t(lines.size()));
+
+    std::vector<core::Tensor> field_data;
+    for (const PCDField &field : header.fields_) {
+        field_data.push_back(
+                IsColorField(field.name_)
+                        ? core::Tensor::Zeros({num_points, 3},
+                                              core::Dtype::UInt8)
+                        : core::Tensor::Zeros(
+                                  {num_points, field.count_},
+                                  GetPCDFieldDtype(field.type_, field.size_)));
+    }
+#pragma omp parallel
+    {
+        std::vector<double> values(num_values);
+#pragma omp for schedule(static)
+        for (int64_t i = 0; i < num_points; ++i) {
+            open3d::io::ParseNumbers(lines[i],
+                                     open3d::io::FindLineEnd(lines[i],
+                                                             file.End()),
+                                     values.data(), int(num_values));
+            for (size_t f = 0; f < header.fields_.size(); ++f) {
+                const PCDField &field = header.fields_[f];
+                const double *field_values = &values[field.value_offset_];
+                core::Tensor &data = field_data[f];
+                if (IsColorField(field.name_)) {
+                    // The packed color is printed as a float or an integer.
+                    uint8_t bgra[4] = {0, 0, 0, 0};
+                    if (field.type_ == 'F') {
+                        const float packed = float(field_values[0]);
+                        std::memcpy(bgra, &packed, 4);
+                    } else {
+                        const uint32_t packed = uint32_t(field_values[0]);
+                        std::memcpy(bgra, &packed, 4);
+                    }
+                    uint8_t *color = data.GetDataPtr<uint8_t>() + 3 * i;
+                    color[0] = bgra[2];
+                    color[1] = bgra[1];
+                    color[2] = bgra[0];
+                } else {
+                    for (int c = 0; c < field.count_; ++c) {
+                        StoreValue(data.GetDataPtr(), data.GetDtype(),
+                                   i * field.count_ + c, field_values[c]);
+                    }
+                }
+            }
+        }
+    }
+    for (size_t f = 0; f < header.fields_.size(); ++f) {
+        const std::string &name = header.fields_[f].name_;
+        if (name != "_") {
+            attributes[IsColorField(name) ? "colors" : name] = field_data[f];
+        }
+    }
+}
+
+/// A field to write with its {num_points, count} contiguous CPU data.
+struct PCDWriteField {
+    PCDField field_;
+    core::Tensor data_;
+};
+
+void GetPCDWriteFields(const geometry::PointCloud &pointcloud,
+                       std::vector<PCDWriteField> &write_fields) {
+    const int64_t num_points = pointcloud.GetPoints().GetLength();
+    auto add_field = [&write_fields, num_points](const std::string &name,
+                                                 const core::Tensor &data) {
+        PCDWriteField write_field;
+        write_field.field_.name_ = name;
+        if (!GetPCDFieldType(data.GetDtype(), write_field.field_.type_)) {
+            utility::LogWarning(
+                    "Write PCD: skipping {}, unsupported dtype {}.", name,
+                    data.GetDtype().ToString());
+            return;
+        }
+        write_field.field_.size_ = int(data.GetDtype().ByteSize());
+        write_field.field_.count_ =
+                int(data.NumElements() / std::max<int64_t>(num_points, 1));
+        write_field.data_ = data.Contiguous();
+        write_fields.push_back(write_field);
+    };
+
+    const std::vector<std::pair<std::string, std::vector<std::string>>>
+            groups = {{"points", {"x", "y", "z"}},
+                      {"normals", {"normal_x", "normal_y", "normal_z"}}};
+    for (const auto &group : groups) {
+        if (!pointcloud.HasPointAttr(group.first)) {
+            continue;
+        }
+        const core::Tensor &data = pointcloud.GetPointAttr(group.first);
+        for (int64_t c = 0; c < 3; ++c) {
+            add_field(group.second[c], data.Slice(1, c, c + 1));
+        }
+    }
+    if (pointcloud.HasPointColors()) {
+        // Colors are packed as BGR0 bytes and stored as a float.
+        core::Tensor colors =
+                ConvertColorTensorToUint8(pointcloud.GetPointColors());
+        core::Tensor packed = core::Tensor::Zeros({num_points, 4},
+                                                  core::Dtype::UInt8);
+        packed.Slice(1, 0, 1) = colors.Slice(1, 2, 3);
+        packed.Slice(1, 1, 2) = colors.Slice(1, 1, 2);
+        packed.Slice(1, 2, 3) = colors.Slice(1, 0, 1);
+        PCDWriteField write_field;
+        write_field.field_.name_ = "rgb";
+        write_field.field_.type_ = 'F';
+        write_field.field_.size_ = 4;
+        write_field.field_.count_ = 1;
+        write_field.data_ = packed;
+        write_fields.push_back(write_field);
+    }
+    std::vector<std::string> names;
+    for (const auto &it : pointcloud.GetPointAttr()) {
+        if (it.first != "points" && it.first != "normals" &&
+            it.first != "colors") {
+            names.push_back(it.first);
+        }
+    }
+    std::sort(names.begin(), names.end());
+    for (const std::string &name : names) {
+        add_field(name, pointcloud.GetPointAttr(name));
+    }
+
+    int64_t offset = 0, value_offset = 0;
+    for (PCDWriteField &write_field : write_fields) {
+        PCDField &field = write_field.field_;
+        field.offset_ = offset;
+        field.value_offset_ = value_offset;
+        offset += int64_t(field.size_) * field.count_;
+        value_offset += field.count_;
+    }
+}
+
+void WritePCDHeader(FILE *file,
+                    const std::vector<PCDWriteField> &write_fields,
+                    int64_t num_points,
+                    PCDDataType data_type) {
+    fprintf(file, "# .PCD v0.7 - Point Cloud Data file format\n");
+    fprintf(file, "VERSION 0.7\n");
+    fprintf(file, "FIELDS");
+    for (const PCDWriteField &write_field : write_fields) {
+        fprintf(file, " %s", write_field.field_.name_.c_str());
+    }
+    fprintf(file, "\nSIZE");
+    for (const PCDWriteField &write_field : write_fields) {
+        fprintf(file, " %d", write_field.field_.size_);
+    }
+    fprintf(file, "\nTYPE");
+    for (const PCDWriteField &write_field : write_fields) {
+        fprintf(file, " %c", write_field.field_.type_);
+    }
+    fprintf(file, "\nCOUNT");
+    for (const PCDWriteField &write_field : write_fields) {
+        fprintf(file, " %d", write_field.field_.count_);
+    }
+    fprintf(file, "\nWIDTH %lld\n", static_cast<long long>(num_points));
+    fprintf(file, "HEIGHT 1\n");
+    fprintf(file, "VIEWPOINT 0 0 0 1 0 0 0\n");
+    fprintf(file, "POINTS %lld\n", static_cast<long long>(num_points));
+    switch (data_type) {
+        case PCDDataType::Binary:
+            fprintf(file, "DATA binary\n");
+            break;
+        case PCDDataType::BinaryCompressed:
+            fprintf(file, "DATA binary_compressed\n");
+            break;
+        case PCDDataType::ASCII:
+        default:
+            fprintf(file, "DATA ascii\n");
+            break;
+    }
+}
+
+/// Appends the value at \p data[index] of \p field to \p line.
+void FormatValue(const PCDField &field,
+                 const core::Dtype &dtype,
+                 const void *data,
+                 int64_t index,
+                 std::string &line) {
+    char buffer[32];
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(dtype, [&]() {
+        const scalar_t value = static_cast<const scalar_t *>(data)[index];
+        if (field.type_ == 'F') {
+            // Enough digits to restore the value exactly.
+            const char *format = field.size_ == 4 ? "%.10g" : "%.17g";
+            snprintf(buffer, sizeof(buffer), format, double(value));
+        } else if (field.type_ == 'I') {
+            snprintf(buffer, sizeof(buffer), "%lld",
+                     static_cast<long long>(value));
+        } else {
+            snprintf(buffer, sizeof(buffer), "%llu",
+                     static_cast<unsigned long long>(value));
+        }
+    });
+    line += buffer;
+}
+
+/// Writes the points as lines of text, formatted in parallel blocks.
+bool WritePCDASCII(FILE *file,
+                   const std::vector<PCDWriteField> &write_fields,
+                   int64_t num_points) {
+    const int64_t block_size = 1 << 14;
+    const int64_t num_blocks = (num_points + block_size - 1) / block_size;
+    const int64_t batch_size = 4 * core::kernel::GetMaxThreads();
+    std::vector<std::string> texts(batch_size);
+    for (int64_t batch = 0; batch < num_blocks; batch += batch_size) {
+        const int64_t batch_end = std::min(num_blocks, batch + batch_size);
+#pragma omp parallel for schedule(dynamic)
+        for (int64_t block = batch; block < batch_end; ++block) {
+            std::string &text = texts[block - batch];
+            text.clear();
+            const int64_t end = std::min(num_points, (block + 1) * block_size);
+            for (int64_t i = block * block_size; i < end; ++i) {
+                for (size_t f = 0; f < write_fields.size(); ++f) {
+                    const PCDField &field = write_fields[f].field_;
+                    const core::Tensor &data = write_fields[f].data_;
+                    if (f > 0) {
+                        text += ' ';
+                    }
+                    if (IsColorField(field.name_)) {
+                        float packed;
+                        std::memcpy(&packed,
+                                    data.GetDataPtr<uint8_t>() + 4 * i, 4);
+                        FormatValue(field, core::Dtype::Float32, &packed, 0,
+                                    text);
+                        continue;
+                    }
+                    for (int c = 0; c < field.count_; ++c) {
+                        if (c > 0) {
+                            text += ' ';
+                        }
+                        FormatValue(field, data.GetDtype(), data.GetDataPtr(),
+                                    i * field.count_ + c, text);
+                    }
+                }
+                text += '\n';
+            }
+        }
+        for (int64_t block = batch; block < batch_end; ++block) {
+            const std::string &text = texts[block - batch];
+            if (fwrite(text.data(), 1, text.size(), file) != text.size()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/// Compresses \p size bytes at \p data with LZF in parallel chunks. Back
+/// references never reach before the start of their chunk, so the
+/// concatenated chunks form a single LZF stream that lzf_decompress() and
+/// other PCD readers decompress as a whole.
+std::vector<char> CompressLZF(const char *data, int64_t size) {
+    const int64_t chunk_size = 1 << 22;
+    const int64_t num_chunks = (size + chunk_size - 1) / chunk_size;
+    std::vector<std::vector<char>> chunks(num_chunks);
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+        const char *in = data + chunk * chunk_size;
+        const int64_t in_size = std::min(chunk_size, size - chunk * chunk_size);
+        // Literal runs of up to 32 bytes cost one control byte.
+        std::vector<char> &out = chunks[chunk];
+        out.resize(in_size + (in_size + 31) / 32);
+        unsigned int out_size =
+                lzf_compress(in, (unsigned int)in_size, out.data(),
+                             (unsigned int)out.size());
+        if (out_size == 0) {
+            // Incompressible data is stored as literal runs.
+            out_size = 0;
+            for (int64_t i = 0; i < in_size; i += 32) {
+                const int64_t run = std::min<int64_t>(32, in_size - i);
+                out[out_size++] = char(run - 1);
+                std::memcpy(out.data() + out_size, in + i, run);
+                out_size += (unsigned int)run;
+            }
+        }
+        out.resize(out_size);
+    }
+
+    std::vector<int64_t> offsets(num_chunks + 1, 0);
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+        offsets[chunk + 1] = offsets[chunk] + int64_t(chunks[chunk].size());
+    }
+    std::vector<char> compressed(offsets.back());
+#pragma omp parallel for schedule(static)
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+        std::copy(chunks[chunk].begin(), chunks[chunk].end(),
+                  compressed.begin() + offsets[chunk]);
+    }
+    return compressed;
+}
+
+}  // namespace
+
+bool ReadPCDStreamLayout(const std::string &filename,
+                         PointCloudStreamLayout &layout) {
+    PCDHeader header;
+    if (!ReadPCDHeader(filename, header)) {
+        return false;
+    }
+    if (header.data_type_ == PCDDataType::BinaryCompressed) {
+        // The compressed fields are stored one after the other, so that no
+        // point can be decoded before the whole data is decompressed.
+        utility::LogWarning(
+                "Read PCD failed: binary_compressed data cannot be streamed.");
+        return false;
+    }
+    // Fields grouped into an attribute as in SetPCDAttributes.
+    const std::map<std::string, std::pair<std::string, int64_t>> columns = {
+            {"x", {"points", 0}},        {"y", {"points", 1}},
+            {"z", {"points", 2}},        {"normal_x", {"normals", 0}},
+            {"normal_y", {"normals", 1}}, {"normal_z", {"normals", 2}}};
+    std::map<std::string, int> group_sizes;
+    for (const PCDField &field : header.fields_) {
+        if (columns.count(field.name_) && field.count_ == 1) {
+            group_sizes[columns.at(field.name_).first]++;
+        }
+    }
+
+    layout = PointCloudStreamLayout();
+    for (const PCDField &field : header.fields_) {
+        if (field.name_ == "_") {
+            continue;
+        }
+        PointCloudStreamLayout::Field stream_field;
+        stream_field.dtype_ = GetPCDFieldDtype(field.type_, field.size_);
+        stream_field.count_ = field.count_;
+        stream_field.offset_ =
+                header.data_type_ == PCDDataType::ASCII ? field.value_offset_
+                                                        : field.offset_;
+        auto it = columns.find(field.name_);
+        if (IsColorField(field.name_) && field.size_ == 4) {
+            stream_field.attr_ = "colors";
+            stream_field.count_ = 3;
+            stream_field.packed_color_ = true;
+        } else if (it != columns.end() && field.count_ == 1 &&
+                   group_sizes.at(it->second.first) == 3) {
+            stream_field.attr_ = it->second.first;
+            stream_field.column_ = it->second.second;
+        } else {
+            stream_field.attr_ = field.name_;
+        }
+        layout.fields_.push_back(stream_field);
+    }
+    layout.ascii_ = header.data_type_ == PCDDataType::ASCII;
+    layout.data_offset_ = header.data_offset_;
+    layout.record_size_ = layout.ascii_ ? header.num_values_
+                                        : header.point_size_;
+    layout.num_records_ = header.num_points_;
+    return true;
+}
+
+bool ReadPointCloudFromPCD(const std::string &filename,
+                           geometry::PointCloud &pointcloud,
+                           const open3d::io::ReadPointCloudOption &params) {
+    try {
+        pointcloud.Clear();
+        PCDHeader header;
+        if (!ReadPCDHeader(filename, header)) {
+            return false;
+        }
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(header.num_points_);
+        if (header.num_points_ == 0) {
+            pointcloud.SetPoints(core::Tensor({0, 3}, core::Dtype::Float32));
+            reporter.Finish();
+            return true;
+        }
+        int64_t file_size = 0;
+        {
+            utility::filesystem::CFile file;
+            if (file.Open(filename, "rb")) {
+                file_size = file.GetFileSize();
+            }
+        }
+        std::map<std::string, core::Tensor> attributes;
+        if (header.data_type_ == PCDDataType::ASCII) {
+            ReadPCDASCII(filename, header, attributes);
+        } else if (header.data_type_ == PCDDataType::Binary) {
+            if (header.data_offset_ +
+                        header.num_points_ * header.point_size_ >
+                file_size) {
+                utility::LogWarning("Read PCD failed: data is truncated.");
+                return false;
+            }
+            ReadPCDBinary(filename, header, attributes);
+        } else if (!ReadPCDBinaryCompressed(filename, header, attributes)) {
+            return false;
+        }
+        SetPCDAttributes(attributes, pointcloud);
+        if (!pointcloud.HasPoints()) {
+            utility::LogWarning("Read PCD failed: no x, y and z fields.");
+            pointcloud.Clear();
+            return false;
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Read PCD failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+bool WritePointCloudToPCD(const std::string &filename,
+                          const geometry::PointCloud &pointcloud,
+                          const open3d::io::WritePointCloudOption &params) {
+    if (pointcloud.IsEmpty()) {
+        utility::LogWarning("Write PCD failed: point cloud has 0 points.");
+        return false;
+    }
+    const int64_t num_points = pointcloud.GetPoints().GetLength();
+    for (const auto &it : pointcloud.GetPointAttr()) {
+        if (it.second.GetLength() != num_points) {
+            utility::LogWarning(
+                    "Write PCD failed: Points ({}) and {} ({}) have "
+                    "different lengths.",
+                    num_points, it.first, it.second.GetLength());
+            return false;
+        }
+    }
+
+    try {
+        std::vector<PCDWriteField> write_fields;
+        GetPCDWriteFields(pointcloud, write_fields);
+        const PCDField &last_field = write_fields.back().field_;
+        const int64_t point_size =
+                last_field.offset_ +
+                int64_t(last_field.size_) * last_field.count_;
+        const PCDDataType data_type =
+                bool(params.write_ascii)
+                        ? PCDDataType::ASCII
+                        : (bool(params.compressed)
+                                   ? PCDDataType::BinaryCompressed
+                                   : PCDDataType::Binary);
+
+        utility::filesystem::CFile file;
+        if (!file.Open(filename, "wb")) {
+            utility::LogWarning("Write PCD failed: unable to open file: {}",
+                                filename);
+            return false;
+        }
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(num_points);
+        WritePCDHeader(file.GetFILE(), write_fields, num_points, data_type);
+
+        bool success = true;
+        if (data_type == PCDDataType::ASCII) {
+            success = WritePCDASCII(file.GetFILE(), write_fields, num_points);
+        } else {
+            // Binary data stores one record per point, compressed data one
+            // field after the other.
+            const bool interleaved = data_type == PCDDataType::Binary;
+            std::vector<char> buffer(num_points * point_size);
+            for (const PCDWriteField &write_field : write_fields) {
+                const PCDField &field = write_field.field_;
+                const int64_t row_bytes = int64_t(field.size_) * field.count_;
+                const char *src = static_cast<const char *>(
+                        write_field.data_.GetDataPtr());
+                char *dst = buffer.data() +
+                            (interleaved ? field.offset_
+                                         : field.offset_ * num_points);
+                const int64_t stride = interleaved ? point_size : row_bytes;
+#pragma omp parallel for schedule(static)
+                for (int64_t i = 0; i < num_points; ++i) {
+                    std::memcpy(dst + i * stride, src + i * row_bytes,
+                                row_bytes);
+                }
+            }
+            if (interleaved) {
+                success = fwrite(buffer.data(), 1, buffer.size(),
+                                 file.GetFILE()) == buffer.size();
+            } else {
+                if (buffer.size() > std::numeric_limits<uint32_t>::max()) {
+                    utility::LogWarning(
+                            "Write PCD failed: {} bytes exceed the size limit "
+                            "of compressed data.",
+                            buffer.size());
+                    return false;
+                }
+                const std::vector<char> compressed =
+                        CompressLZF(buffer.data(), int64_t(buffer.size()));
+                const uint32_t sizes[2] = {uint32_t(compressed.size()),
+                                           uint32_t(buffer.size())};
+                success = fwrite(sizes, sizeof(uint32_t), 2, file.GetFILE()) ==
+                                  2 &&
+                          fwrite(compressed.data(), 1, compressed.size(),
+                                 file.GetFILE()) == compressed.size();
+            }
+        }
+        if (!success) {
+            utility::LogWarning("Write PCD failed: unable to write file: {}",
+                                filename);
+            return false;
+        }
+        reporter.Finish();
+        return true;
+    } catch (const std::exception &e) {
+        utility::LogWarning("Write PCD failed with exception: {}", e.what());
+        return false;
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
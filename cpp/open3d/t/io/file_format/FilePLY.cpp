@@ -26,11 +26,18 @@
 
 #include <rply.h>
 
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <unordered_map>
+
 #include "open3d/core/Dtype.h"
+#include "open3d/core/NumpyIO.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/PointCloudStreamReader.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/ProgressReporters.h"
@@ -92,6 +99,19 @@ static core::Tensor ConcatColumns(const core::Tensor &a,
                 "Read PLY failed: datatype mismatch in base attributes.");
     }
 
+    // Interleaved columns of the same buffer, e.g. x, y and z of a mapped
+    // vertex block, are gathered by a single strided copy.
+    const char *a_ptr = static_cast<const char *>(a.GetDataPtr());
+    const char *b_ptr = static_cast<const char *>(b.GetDataPtr());
+    const char *c_ptr = static_cast<const char *>(c.GetDataPtr());
+    const int64_t byte_size = a.GetDtype().ByteSize();
+    if (a.GetBlob() == b.GetBlob() && a.GetBlob() == c.GetBlob() &&
+        a.GetStride(0) == b.GetStride(0) && a.GetStride(0) == c.GetStride(0) &&
+        b_ptr == a_ptr + byte_size && c_ptr == b_ptr + byte_size) {
+        return a.AsStrided({a.GetLength(), 3}, {a.GetStride(0), 1})
+                .Contiguous();
+    }
+
     core::Tensor combined =
             core::Tensor::Empty({a.GetLength(), 3}, a.GetDtype());
     combined.IndexExtract(1, 0) = a;
@@ -171,9 +191,261 @@ static core::Dtype GetDtype(e_ply_type type) {
     }
 }
 
+/// Layout of the vertex element of a binary little-endian or ASCII PLY file.
+struct PLYVertexLayout {
+    struct Property {
+        std::string name_;
+        e_ply_type type_;
+        /// Byte offset in a binary vertex, or value index in an ASCII line.
+        int64_t offset_;
+    };
+    std::vector<Property> properties_;
+    int64_t num_vertices_ = 0;
+    /// Byte offset of the first vertex in the file.
+    int64_t data_offset_ = 0;
+    /// Byte size of one binary vertex, or number of values of an ASCII line.
+    int64_t stride_ = 0;
+    bool ascii_ = false;
+};
+
+static bool GetPlyScalarType(const std::string &name,
+                             e_ply_type &type,
+                             int64_t &byte_size) {
+    static const std::unordered_map<std::string,
+                                    std::pair<e_ply_type, int64_t>>
+            types = {{"int8", {PLY_INT8, 1}},     {"uint8", {PLY_UINT8, 1}},
+                     {"int16", {PLY_INT16, 2}},   {"uint16", {PLY_UINT16, 2}},
+                     {"int32", {PLY_INT32, 4}},   {"uint32", {PLY_UIN32, 4}},
+                     {"float32", {PLY_FLOAT32, 4}},
+                     {"float64", {PLY_FLOAT64, 8}},
+                     {"char", {PLY_CHAR, 1}},     {"uchar", {PLY_UCHAR, 1}},
+                     {"short", {PLY_SHORT, 2}},   {"ushort", {PLY_USHORT, 2}},
+                     {"int", {PLY_INT, 4}},       {"uint", {PLY_UINT, 4}},
+                     {"float", {PLY_FLOAT, 4}},   {"double", {PLY_DOUBLE, 8}}};
+    auto it = types.find(name);
+    if (it == types.end()) {
+        return false;
+    }
+    type = it->second.first;
+    byte_size = it->second.second;
+    return true;
+}
+
+/// Parses the header of \p filename. Returns true if the vertices are stored
+/// as a fixed-size binary little-endian block at a known offset, in which case
+/// they can be mapped directly instead of being read through rply. If \p
+/// allow_ascii, also returns true for ASCII files whose vertices come first,
+/// one line per vertex.
+static bool ReadPLYVertexLayout(const std::string &filename,
+                                PLYVertexLayout &layout,
+                                bool allow_ascii = false) {
+    const uint16_t endian_probe = 1;
+    const bool little_endian_host =
+            *reinterpret_cast<const uint8_t *>(&endian_probe) == 1;
+    struct Element {
+        std::string name_;
+        int64_t count_ = 0;
+        int64_t stride_ = 0;
+        bool fixed_size_ = true;
+        std::vector<PLYVertexLayout::Property> properties_;
+    };
+    std::vector<Element> elements;
+    int64_t header_size = -1;
+    int64_t file_size = 0;
+    bool binary_little_endian = false;
+    bool ascii = false;
+
+    utility::filesystem::CFile file;
+    if (!file.Open(filename, "rb")) {
+        return false;
+    }
+    try {
+        const char *line = file.ReadLine();
+        if (!line || std::strncmp(line, "ply", 3) != 0) {
+            return false;
+        }
+        while ((line = file.ReadLine())) {
+            std::istringstream tokens(line);
+            std::string keyword;
+            tokens >> keyword;
+            if (keyword == "format") {
+                std::string format;
+                tokens >> format;
+                binary_little_endian = format == "binary_little_endian";
+                ascii = format == "ascii";
+            } else if (keyword == "element") {
+                Element element;
+                tokens >> element.name_ >> element.count_;
+                if (tokens.fail() || element.count_ < 0) {
+                    return false;
+                }
+                elements.push_back(element);
+            } else if (keyword == "property") {
+                if (elements.empty()) {
+                    return false;
+                }
+                Element &element = elements.back();
+                std::string type_name, name;
+                tokens >> type_name >> name;
+                e_ply_type type;
+                int64_t byte_size;
+                if (type_name == "list") {
+                    element.fixed_size_ = false;
+                } else if (GetPlyScalarType(type_name, type, byte_size)) {
+                    element.properties_.push_back(
+                            {name, type,
+                             ascii ? int64_t(element.properties_.size())
+                                   : element.stride_});
+                    element.stride_ += ascii ? 1 : byte_size;
+                } else {
+                    return false;
+                }
+            } else if (keyword == "end_header") {
+                header_size = file.CurPos();
+                break;
+            } else if (keyword != "comment" && keyword != "obj_info") {
+                return false;
+            }
+        }
+        file_size = file.GetFileSize();
+    } catch (const std::exception &) {
+        return false;
+    }
+    if (header_size < 0 ||
+        !((binary_little_endian && little_endian_host) ||
+          (ascii && allow_ascii))) {
+        return false;
+    }
+
+    int64_t offset = header_size;
+    for (const Element &element : elements) {
+        if (element.name_ == "vertex") {
+            if (!element.fixed_size_ || element.count_ == 0 ||
+                (!ascii &&
+                 offset + element.count_ * element.stride_ > file_size)) {
+                return false;
+            }
+            layout.properties_ = element.properties_;
+            layout.num_vertices_ = element.count_;
+            layout.data_offset_ = offset;
+            layout.stride_ = element.stride_;
+            layout.ascii_ = ascii;
+            return true;
+        }
+        // The vertices can only be located behind fixed-size elements, and
+        // must come first in ASCII files.
+        if (!element.fixed_size_ || ascii) {
+            return false;
+        }
+        offset += element.count_ * element.stride_;
+    }
+    return false;
+}
+
+/// Maps the vertex block described by \p layout copy-on-write and returns its
+/// properties as 1D strided views of the mapping. Properties whose view would
+/// be misaligned are copied.
+static std::unordered_map<std::string, core::Tensor> MapPLYVertexAttributes(
+        const std::string &filename, const PLYVertexLayout &layout) {
+    const int64_t num_vertices = layout.num_vertices_;
+    const int64_t stride = layout.stride_;
+    std::shared_ptr<core::Blob> blob =
+            core::MapFile(filename, layout.data_offset_, num_vertices * stride,
+                          /*copy_on_write=*/true);
+    const char *block = static_cast<const char *>(blob->GetDataPtr());
+
+    std::unordered_map<std::string, core::Tensor> attributes;
+    for (const PLYVertexLayout::Property &property : layout.properties_) {
+        const core::Dtype dtype = GetDtype(property.type_);
+        if (dtype == core::Dtype::Undefined) {
+            utility::LogWarning(
+                    "Read PLY warning: skipping property \"{}\", unsupported "
+                    "datatype \"{}\".",
+                    property.name_, GetDtypeString(property.type_));
+            continue;
+        }
+        const int64_t byte_size = dtype.ByteSize();
+        const char *src = block + property.offset_;
+        core::Tensor data;
+        if (stride % byte_size == 0 &&
+            reinterpret_cast<uintptr_t>(src) % byte_size == 0) {
+            data = core::Tensor({num_vertices}, {stride / byte_size},
+                                const_cast<char *>(src), dtype, blob);
+        } else {
+            data = core::Tensor({num_vertices}, dtype);
+            char *dst = static_cast<char *>(data.GetDataPtr());
+#pragma omp parallel for schedule(static)
+            for (int64_t i = 0; i < num_vertices; ++i) {
+                std::memcpy(dst + i * byte_size, src + i * stride, byte_size);
+            }
+        }
+        attributes.emplace(property.name_, data);
+    }
+    return attributes;
+}
+
+/// Sets the 1D vertex \p attributes of a PLY file to \p pointcloud. x, y, z,
+/// nx, ny, nz and red, green, blue are grouped into points, normals and
+/// colors.
+static void SetPLYVertexAttributes(
+        std::unordered_map<std::string, core::Tensor> &attributes,
+        int64_t num_vertices,
+        geometry::PointCloud &pointcloud) {
+    pointcloud.Clear();
+
+    // Add base attributes.
+    if (attributes.count("x") != 0 && attributes.count("y") != 0 &&
+        attributes.count("z") != 0) {
+        core::Tensor points = ConcatColumns(
+                attributes.at("x"), attributes.at("y"), attributes.at("z"));
+        attributes.erase("x");
+        attributes.erase("y");
+        attributes.erase("z");
+        pointcloud.SetPoints(points);
+    }
+    if (attributes.count("nx") != 0 && attributes.count("ny") != 0 &&
+        attributes.count("nz") != 0) {
+        core::Tensor normals = ConcatColumns(
+                attributes.at("nx"), attributes.at("ny"), attributes.at("nz"));
+        attributes.erase("nx");
+        attributes.erase("ny");
+        attributes.erase("nz");
+        pointcloud.SetPointNormals(normals);
+    }
+    if (attributes.count("red") != 0 && attributes.count("green") != 0 &&
+        attributes.count("blue") != 0) {
+        core::Tensor colors =
+                ConcatColumns(attributes.at("red"), attributes.at("green"),
+                              attributes.at("blue"));
+        attributes.erase("red");
+        attributes.erase("green");
+        attributes.erase("blue");
+        pointcloud.SetPointColors(colors);
+    }
+
+    // Add rest of the attributes.
+    for (auto const &it : attributes) {
+        pointcloud.SetPointAttr(
+                it.first, it.second.Reshape({num_vertices, 1}).Contiguous());
+    }
+}
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const open3d::io::ReadPointCloudOption &params) {
+    // Binary little-endian vertex blocks are mapped instead of being decoded
+    // one property at a time.
+    PLYVertexLayout layout;
+    if (ReadPLYVertexLayout(filename, layout)) {
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(layout.num_vertices_);
+        std::unordered_map<std::string, core::Tensor> attributes =
+                MapPLYVertexAttributes(filename, layout);
+        SetPLYVertexAttributes(attributes, layout.num_vertices_, pointcloud);
+        reporter.Finish();
+        return true;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}.",
@@ -256,51 +528,11 @@ bool ReadPointCloudFromPLY(const std::string &filename,
         return false;
     }
 
-    pointcloud.Clear();
-
-    // Add base attributes.
-    if (state.name_to_attr_state_.count("x") != 0 &&
-        state.name_to_attr_state_.count("y") != 0 &&
-        state.name_to_attr_state_.count("z") != 0) {
-        core::Tensor points =
-                ConcatColumns(state.name_to_attr_state_.at("x")->data_,
-                              state.name_to_attr_state_.at("y")->data_,
-                              state.name_to_attr_state_.at("z")->data_);
-        state.name_to_attr_state_.erase("x");
-        state.name_to_attr_state_.erase("y");
-        state.name_to_attr_state_.erase("z");
-        pointcloud.SetPoints(points);
-    }
-    if (state.name_to_attr_state_.count("nx") != 0 &&
-        state.name_to_attr_state_.count("ny") != 0 &&
-        state.name_to_attr_state_.count("nz") != 0) {
-        core::Tensor normals =
-                ConcatColumns(state.name_to_attr_state_.at("nx")->data_,
-                              state.name_to_attr_state_.at("ny")->data_,
-                              state.name_to_attr_state_.at("nz")->data_);
-        state.name_to_attr_state_.erase("nx");
-        state.name_to_attr_state_.erase("ny");
-        state.name_to_attr_state_.erase("nz");
-        pointcloud.SetPointNormals(normals);
-    }
-    if (state.name_to_attr_state_.count("red") != 0 &&
-        state.name_to_attr_state_.count("green") != 0 &&
-        state.name_to_attr_state_.count("blue") != 0) {
-        core::Tensor colors =
-                ConcatColumns(state.name_to_attr_state_.at("red")->data_,
-                              state.name_to_attr_state_.at("green")->data_,
-                              state.name_to_attr_state_.at("blue")->data_);
-        state.name_to_attr_state_.erase("red");
-        state.name_to_attr_state_.erase("green");
-        state.name_to_attr_state_.erase("blue");
-        pointcloud.SetPointColors(colors);
-    }
-
-    // Add rest of the attributes.
+    std::unordered_map<std::string, core::Tensor> attributes;
     for (auto const &it : state.name_to_attr_state_) {
-        pointcloud.SetPointAttr(it.second->name_,
-                                it.second->data_.Reshape({element_size, 1}));
+        attributes.emplace(it.first, it.second->data_);
     }
+    SetPLYVertexAttributes(attributes, element_size, pointcloud);
     ply_close(ply_file);
     reporter.Finish();
 
@@ -467,6 +699,60 @@ bool WritePointCloudToPLY(const std::string &filename,
     return true;
 }
 
+bool ReadPLYStreamLayout(const std::string &filename,
+                         PointCloudStreamLayout &layout) {
+    PLYVertexLayout vertex_layout;
+    if (!ReadPLYVertexLayout(filename, vertex_layout, /*allow_ascii=*/true)) {
+        utility::LogWarning(
+                "Read PLY failed: {} has no ASCII or binary little-endian "
+                "vertices that can be streamed.",
+                filename);
+        return false;
+    }
+    // Properties grouped into an attribute as in SetPLYVertexAttributes.
+    const std::unordered_map<std::string, std::pair<std::string, int64_t>>
+            columns = {{"x", {"points", 0}},      {"y", {"points", 1}},
+                       {"z", {"points", 2}},      {"nx", {"normals", 0}},
+                       {"ny", {"normals", 1}},    {"nz", {"normals", 2}},
+                       {"red", {"colors", 0}},    {"green", {"colors", 1}},
+                       {"blue", {"colors", 2}}};
+    std::unordered_map<std::string, int> group_sizes;
+    for (const PLYVertexLayout::Property &property :
+         vertex_layout.properties_) {
+        if (columns.count(property.name_)) {
+            group_sizes[columns.at(property.name_).first]++;
+        }
+    }
+
+    layout = PointCloudStreamLayout();
+    for (const PLYVertexLayout::Property &property :
+         vertex_layout.properties_) {
+        PointCloudStreamLayout::Field field;
+        field.dtype_ = GetDtype(property.type_);
+        if (field.dtype_ == core::Dtype::Undefined) {
+            utility::LogWarning(
+                    "Read PLY warning: skipping property \"{}\", unsupported "
+                    "datatype \"{}\".",
+                    property.name_, GetDtypeString(property.type_));
+            continue;
+        }
+        auto it = columns.find(property.name_);
+        if (it != columns.end() && group_sizes.at(it->second.first) == 3) {
+            field.attr_ = it->second.first;
+            field.column_ = it->second.second;
+        } else {
+            field.attr_ = property.name_;
+        }
+        field.offset_ = property.offset_;
+        layout.fields_.push_back(field);
+    }
+    layout.ascii_ = vertex_layout.ascii_;
+    layout.data_offset_ = vertex_layout.data_offset_;
+    layout.record_size_ = vertex_layout.stride_;
+    layout.num_records_ = vertex_layout.num_vertices_;
+    return true;
+}
+
 }  // namespace io
 }  // namespace t
 }  // namespace open3d
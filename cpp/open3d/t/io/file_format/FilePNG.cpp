@@ -25,35 +25,22 @@
 // ----------------------------------------------------------------------------
 
 #include <png.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <csetjmp>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
 
 #include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
 namespace t {
 namespace io {
 
-static void SetPNGImageFromImage(const geometry::Image &image,
-                                 int quality,
-                                 png_image &pngimage) {
-    pngimage.width = image.GetCols();
-    pngimage.height = image.GetRows();
-    pngimage.format = pngimage.flags = 0;
-
-    if (image.GetDtype() == core::Dtype::UInt16) {
-        pngimage.format |= PNG_FORMAT_FLAG_LINEAR;
-    }
-    if (image.GetChannels() >= 3) {
-        pngimage.format |= PNG_FORMAT_FLAG_COLOR;
-    }
-    if (image.GetChannels() == 4) {
-        pngimage.format |= PNG_FORMAT_FLAG_ALPHA;
-    }
-    if (quality <= 2) {
-        pngimage.flags |= PNG_IMAGE_FLAG_FAST;
-    }
-}
-
 bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
     png_image pngimage;
     memset(&pngimage, 0, sizeof(pngimage));
@@ -88,18 +75,20 @@ bool ReadImageFromPNG(const std::string &filename, geometry::Image &image) {
     return true;
 }
 
+PNGWriteOptions PNGWriteOptions::FromQuality(int quality) {
+    PNGWriteOptions options;
+    if (quality <= 2) {
+        options.compression_level_ = std::max(quality, 1);
+        options.filter_ = PNGFilter::Sub;
+    } else {
+        options.compression_level_ = quality;
+    }
+    return options;
+}
+
 bool WriteImageToPNG(const std::string &filename,
                      const geometry::Image &image,
                      int quality) {
-    if (image.IsEmpty()) {
-        utility::LogWarning("Write PNG failed: image has no data.");
-        return false;
-    }
-    if (image.GetDtype() != core::Dtype::UInt8 &&
-        image.GetDtype() != core::Dtype::UInt16) {
-        utility::LogWarning("Write PNG failed: unsupported image data.");
-        return false;
-    }
     if (quality == kOpen3DImageIODefaultQuality)  // Set default quality
     {
         quality = 6;
@@ -110,12 +99,114 @@ bool WriteImageToPNG(const std::string &filename,
                 quality);
         return false;
     }
-    png_image pngimage;
-    memset(&pngimage, 0, sizeof(pngimage));
-    pngimage.version = PNG_IMAGE_VERSION;
-    SetPNGImageFromImage(image, quality, pngimage);
-    if (png_image_write_to_file(&pngimage, filename.c_str(), 0,
-                                image.GetDataPtr(), 0, NULL) == 0) {
+    return WriteImageToPNG(filename, image,
+                           PNGWriteOptions::FromQuality(quality));
+}
+
+bool WriteImageToPNG(const std::string &filename,
+                     const geometry::Image &image,
+                     const PNGWriteOptions &options) {
+    if (image.IsEmpty()) {
+        utility::LogWarning("Write PNG failed: image has no data.");
+        return false;
+    }
+    if ((image.GetDtype() != core::Dtype::UInt8 &&
+         image.GetDtype() != core::Dtype::UInt16) ||
+        image.GetChannels() < 1 || image.GetChannels() > 4) {
+        utility::LogWarning("Write PNG failed: unsupported image data.");
+        return false;
+    }
+    if (options.compression_level_ < 0 || options.compression_level_ > 9) {
+        utility::LogWarning(
+                "Write PNG failed: compression level ({}) must be in the "
+                "range [0,9]",
+                options.compression_level_);
+        return false;
+    }
+    const geometry::Image cpu_image = image.CPU();
+    const core::Tensor data = cpu_image.AsTensor().Contiguous();
+
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (!file) {
+        utility::LogWarning("Write PNG failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr,
+                                              nullptr, nullptr);
+    png_infop info = png ? png_create_info_struct(png) : nullptr;
+    if (!info) {
+        png_destroy_write_struct(&png, nullptr);
+        fclose(file);
+        utility::LogWarning("Write PNG failed: unable to create PNG writer.");
+        return false;
+    }
+    std::vector<png_bytep> rows(image.GetRows());
+    // libpng reports errors by a long jump to here.
+    if (setjmp(png_jmpbuf(png))) {
+        png_destroy_write_struct(&png, &info);
+        fclose(file);
+        utility::LogWarning("Write PNG failed: unable to write file: {}",
+                            filename);
+        return false;
+    }
+    png_init_io(png, file);
+
+    static const int color_types[] = {PNG_COLOR_TYPE_GRAY,
+                                      PNG_COLOR_TYPE_GRAY_ALPHA,
+                                      PNG_COLOR_TYPE_RGB,
+                                      PNG_COLOR_TYPE_RGB_ALPHA};
+    const bool is_16bit = image.GetDtype() == core::Dtype::UInt16;
+    png_set_IHDR(png, info, png_uint_32(image.GetCols()),
+                 png_uint_32(image.GetRows()), is_16bit ? 16 : 8,
+                 color_types[image.GetChannels() - 1], PNG_INTERLACE_NONE,
+                 PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+    // The color space chunks that png_image_write_to_file writes, so that
+    // ReadImageFromPNG reads the values unchanged.
+    if (is_16bit) {
+        png_set_gAMA_fixed(png, info, PNG_GAMMA_LINEAR);
+        png_set_cHRM_fixed(png, info, 31270, 32900, 64000, 33000, 30000, 60000,
+                           15000, 6000);
+    } else {
+        png_set_sRGB(png, info, PNG_sRGB_INTENT_PERCEPTUAL);
+    }
+
+    static const std::unordered_map<int, int> filters = {
+            {int(PNGFilter::None), PNG_FILTER_NONE},
+            {int(PNGFilter::Sub), PNG_FILTER_SUB},
+            {int(PNGFilter::Up), PNG_FILTER_UP},
+            {int(PNGFilter::Average), PNG_FILTER_AVG},
+            {int(PNGFilter::Paeth), PNG_FILTER_PAETH},
+            {int(PNGFilter::Adaptive), PNG_ALL_FILTERS}};
+    static const std::unordered_map<int, int> strategies = {
+            {int(PNGStrategy::Default), Z_DEFAULT_STRATEGY},
+            {int(PNGStrategy::Filtered), Z_FILTERED},
+            {int(PNGStrategy::HuffmanOnly), Z_HUFFMAN_ONLY},
+            {int(PNGStrategy::RLE), Z_RLE}};
+    png_set_filter(png, PNG_FILTER_TYPE_BASE,
+                   filters.at(int(options.filter_)));
+    png_set_compression_level(png, options.compression_level_);
+    png_set_compression_strategy(png, strategies.at(int(options.strategy_)));
+
+    png_write_info(png, info);
+    if (is_16bit) {
+        // PNG samples are big-endian.
+        const uint16_t endian_probe = 1;
+        if (*reinterpret_cast<const uint8_t *>(&endian_probe) == 1) {
+            png_set_swap(png);
+        }
+    }
+    const int64_t row_bytes = image.GetCols() * image.GetChannels() *
+                              image.GetDtype().ByteSize();
+    for (int64_t i = 0; i < image.GetRows(); ++i) {
+        rows[i] = const_cast<png_bytep>(
+                static_cast<const png_byte *>(data.GetDataPtr()) +
+                i * row_bytes);
+    }
+    png_write_image(png, rows.data());
+    png_write_end(png, nullptr);
+    png_destroy_write_struct(&png, &info);
+    if (fclose(file) != 0) {
         utility::LogWarning("Write PNG failed: unable to write file: {}",
                             filename);
         return false;
@@ -24,9 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
 #include <cstdio>
 
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/TextParser.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
@@ -45,24 +47,17 @@ bool ReadPointCloudFromPTS(const std::string &filename,
         pointcloud.Clear();
 
         // Get num_points.
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "rb")) {
+        open3d::io::MappedTextFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read PTS failed: unable to open file: {}",
                                 filename);
             return false;
         }
 
+        const char *header_end =
+                open3d::io::FindLineEnd(file.Begin(), file.End());
         int64_t num_points = 0;
-        const char *line_buffer;
-        if ((line_buffer = file.ReadLine())) {
-            const char *format;
-            if (std::is_same<int64_t, long>::value) {
-                format = "%ld";
-            } else {
-                format = "%lld";
-            }
-            sscanf(line_buffer, format, &num_points);
-        }
+        open3d::io::ParseNumber(file.Begin(), header_end, num_points);
         if (num_points < 0) {
             utility::LogWarning(
                     "Read PTS failed: number of points must be >= 0.");
@@ -74,15 +69,19 @@ bool ReadPointCloudFromPTS(const std::string &filename,
         utility::CountingProgressReporter reporter(params.update_progress);
         reporter.SetTotal(num_points);
 
-        // Store data start position.
-        int64_t start_pos = ftell(file.GetFILE());
+        // Data start position.
+        const char *data_begin =
+                header_end == file.End() ? header_end : header_end + 1;
 
         double *points_ptr = nullptr;
         double *intensities_ptr = nullptr;
         uint8_t *colors_ptr = nullptr;
         size_t num_fields = 0;
 
-        if ((line_buffer = file.ReadLine())) {
+        if (data_begin < file.End()) {
+            const char *line_end =
+                    open3d::io::FindLineEnd(data_begin, file.End());
+            const std::string line_buffer(data_begin, line_end);
             num_fields = utility::SplitString(line_buffer, " ").size();
 
             // X Y Z I R G B.
@@ -131,59 +130,63 @@ bool ReadPointCloudFromPTS(const std::string &filename,
             }
         }
 
-        // Go to data start position.
-        fseek(file.GetFILE(), start_pos, 0);
+        // The lines are parsed in parallel, X Y Z followed by the intensity
+        // and/or the color.
+        struct Record {
+            const char *line_ = nullptr;
+            double values_[4];
+            int color_[3];
+            bool valid_ = false;
+        };
+        const bool has_intensity = num_fields == 4 || num_fields == 7;
+        const bool has_color = num_fields == 6 || num_fields == 7;
+        const std::vector<Record> records = open3d::io::ParseLines<Record>(
+                data_begin, file.End(),
+                [has_intensity, has_color](const char *line,
+                                           const char *line_end,
+                                           Record &record) {
+                    record.line_ = line;
+                    const char *ptr = open3d::io::ParseNumbers(
+                            line, line_end, record.values_,
+                            has_intensity ? 4 : 3);
+                    if (has_color) {
+                        ptr = open3d::io::ParseNumbers(ptr, line_end,
+                                                       record.color_, 3);
+                    }
+                    record.valid_ = ptr != nullptr;
+                    return true;
+                });
 
-        int64_t idx = 0;
-        while (idx < num_points && (line_buffer = file.ReadLine())) {
-            double x, y, z, i;
-            int r, g, b;
-            // X Y Z I R G B.
-            if (num_fields == 7 &&
-                (sscanf(line_buffer, "%lf %lf %lf %lf %d %d %d", &x, &y, &z, &i,
-                        &r, &g, &b) == 7)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
+        const int64_t num_lines =
+                std::min(num_points, static_cast<int64_t>(records.size()));
+        int64_t first_invalid = num_lines;
+#pragma omp parallel for schedule(static) reduction(min : first_invalid)
+        for (int64_t idx = 0; idx < num_lines; ++idx) {
+            const Record &record = records[idx];
+            if (!record.valid_) {
+                first_invalid = std::min(first_invalid, idx);
+                continue;
             }
-            // X Y Z R G B.
-            else if (num_fields == 6 &&
-                     (sscanf(line_buffer, "%lf %lf %lf %d %d %d", &x, &y, &z,
-                             &r, &g, &b) == 6)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                colors_ptr[3 * idx + 0] = r;
-                colors_ptr[3 * idx + 1] = g;
-                colors_ptr[3 * idx + 2] = b;
+            points_ptr[3 * idx + 0] = record.values_[0];
+            points_ptr[3 * idx + 1] = record.values_[1];
+            points_ptr[3 * idx + 2] = record.values_[2];
+            if (has_intensity) {
+                intensities_ptr[idx] = record.values_[3];
             }
-            // X Y Z I.
-            else if (num_fields == 4 && (sscanf(line_buffer, "%lf %lf %lf %lf",
-                                                &x, &y, &z, &i) == 4)) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-                intensities_ptr[idx] = i;
-            }
-            // X Y Z.
-            else if (num_fields == 3 &&
-                     sscanf(line_buffer, "%lf %lf %lf", &x, &y, &z) == 3) {
-                points_ptr[3 * idx + 0] = x;
-                points_ptr[3 * idx + 1] = y;
-                points_ptr[3 * idx + 2] = z;
-            } else {
-                utility::LogWarning("Read PTS failed at line: {}", line_buffer);
-                return false;
-            }
-            idx++;
-            if (idx % 1000 == 0) {
-                reporter.Update(idx);
+            if (has_color) {
+                colors_ptr[3 * idx + 0] = record.color_[0];
+                colors_ptr[3 * idx + 1] = record.color_[1];
+                colors_ptr[3 * idx + 2] = record.color_[2];
             }
         }
+        if (first_invalid < num_lines) {
+            const char *line = records[first_invalid].line_;
+            utility::LogWarning(
+                    "Read PTS failed at line: {}",
+                    std::string(line, open3d::io::FindLineEnd(line,
+                                                              file.End())));
+            return false;
+        }
 
         reporter.Finish();
         return true;
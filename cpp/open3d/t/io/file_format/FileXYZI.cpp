@@ -24,11 +24,13 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <array>
 #include <cstdio>
 
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/TextParser.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Logging.h"
@@ -46,35 +48,36 @@ bool ReadPointCloudFromXYZI(const std::string &filename,
                             geometry::PointCloud &pointcloud,
                             const open3d::io::ReadPointCloudOption &params) {
     try {
-        utility::filesystem::CFile file;
-        if (!file.Open(filename, "r")) {
+        open3d::io::MappedTextFile file;
+        if (!file.Open(filename)) {
             utility::LogWarning("Read XYZI failed: unable to open file: {}",
                                 filename);
             return false;
         }
         utility::CountingProgressReporter reporter(params.update_progress);
-        reporter.SetTotal(file.GetFileSize());
-        int64_t num_points = file.GetNumLines();
+        reporter.SetTotal(file.GetSize());
 
         pointcloud.Clear();
+        const std::vector<std::array<double, 4>> records =
+                open3d::io::ParseLines<std::array<double, 4>>(
+                        file.Begin(), file.End(),
+                        [](const char *line, const char *line_end,
+                           std::array<double, 4> &record) {
+                            return open3d::io::ParseNumbers(line, line_end,
+                                                            record.data(),
+                                                            4) != nullptr;
+                        });
+        const int64_t num_points = static_cast<int64_t>(records.size());
         core::Tensor points({num_points, 3}, core::Dtype::Float64);
         core::Tensor intensities({num_points, 1}, core::Dtype::Float64);
         double *points_ptr = points.GetDataPtr<double>();
         double *intensities_ptr = intensities.GetDataPtr<double>();
-
-        int i = 0;
-        double x, y, z, I;
-        const char *line_buffer;
-        while ((line_buffer = file.ReadLine())) {
-            if (sscanf(line_buffer, "%lf %lf %lf %lf", &x, &y, &z, &I) == 4) {
-                points_ptr[3 * i + 0] = x;
-                points_ptr[3 * i + 1] = y;
-                points_ptr[3 * i + 2] = z;
-                intensities_ptr[i] = I;
-            }
-            if (++i % 1000 == 0) {
-                reporter.Update(file.CurPos());
-            }
+#pragma omp parallel for schedule(static)
+        for (int64_t i = 0; i < num_points; ++i) {
+            points_ptr[3 * i + 0] = records[i][0];
+            points_ptr[3 * i + 1] = records[i][1];
+            points_ptr[3 * i + 2] = records[i][2];
+            intensities_ptr[i] = records[i][3];
         }
         pointcloud.SetPoints(points);
         pointcloud.SetPointAttr("intensities", intensities);
@@ -0,0 +1,325 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/MultiSensorCapture.h"
+
+#include <algorithm>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+// If the constants are odr-used, a definition is required.
+const size_t MultiSensorCapture::DEFAULT_BUFFER_SIZE;
+const uint64_t MultiSensorCapture::DEFAULT_MAX_TIME_DIFFERENCE;
+
+MultiSensorCapture::MultiSensorCapture(
+        const std::vector<std::shared_ptr<RGBDSensor>> &sensors,
+        size_t buffer_size,
+        uint64_t max_time_difference,
+        bool use_pinned_memory)
+    : sensors_(sensors),
+      // One slot is held by the consumer, one is captured into.
+      buffer_size_(std::max(buffer_size, size_t(2))),
+      max_time_difference_(max_time_difference),
+      use_pinned_memory_(use_pinned_memory),
+      buffers_(sensors.size()) {
+    if (sensors_.empty()) {
+        utility::LogError("[MultiSensorCapture] No sensors.");
+    }
+    for (const auto &sensor : sensors_) {
+        if (!sensor) {
+            utility::LogError("[MultiSensorCapture] sensors must not be null.");
+        }
+    }
+    if (use_pinned_memory_ && !core::cuda::IsAvailable()) {
+        utility::LogWarning(
+                "[MultiSensorCapture] Pinned memory requires CUDA, using "
+                "pageable memory.");
+        use_pinned_memory_ = false;
+    }
+    for (SensorBuffer &buffer : buffers_) {
+        buffer.slots.resize(buffer_size_);
+    }
+}
+
+MultiSensorCapture::~MultiSensorCapture() { StopCapture(); }
+
+void MultiSensorCapture::SetFrameSetCallback(
+        const FrameSetCallback &callback) {
+    if (is_capturing_) {
+        utility::LogError(
+                "[MultiSensorCapture] Set the callback before StartCapture().");
+    }
+    callback_ = callback;
+}
+
+bool MultiSensorCapture::StartCapture(bool start_record,
+                                      bool align_depth_to_color) {
+    if (is_capturing_) {
+        utility::LogWarning("Capture already in progress.");
+        return true;
+    }
+    for (size_t i = 0; i < sensors_.size(); ++i) {
+        if (!sensors_[i]->StartCapture(start_record)) {
+            utility::LogWarning(
+                    "[MultiSensorCapture] Failed to start sensor {}.", i);
+            for (size_t j = 0; j < i; ++j) {
+                sensors_[j]->StopCapture();
+            }
+            return false;
+        }
+    }
+
+    align_depth_to_color_ = align_depth_to_color;
+    num_dropped_ = 0;
+    stop_ = false;
+    // The slots keep their memory from previous captures.
+    for (SensorBuffer &buffer : buffers_) {
+        buffer.free.clear();
+        buffer.ready.clear();
+        buffer.has_held = false;
+        for (size_t slot = 0; slot < buffer_size_; ++slot) {
+            buffer.free.push_back(slot);
+        }
+    }
+    is_capturing_ = true;
+    for (size_t i = 0; i < sensors_.size(); ++i) {
+        buffers_[i].thread =
+                std::thread(&MultiSensorCapture::RunCapture, this, i);
+    }
+    if (callback_) {
+        delivery_thread_ = std::thread(&MultiSensorCapture::RunDelivery, this);
+    }
+    return true;
+}
+
+void MultiSensorCapture::StopCapture() {
+    if (!is_capturing_) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    frame_captured_.notify_all();
+    for (SensorBuffer &buffer : buffers_) {
+        buffer.thread.join();
+    }
+    if (delivery_thread_.joinable()) {
+        delivery_thread_.join();
+    }
+    for (const auto &sensor : sensors_) {
+        sensor->StopCapture();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ReleaseFrameSet();
+    }
+    is_capturing_ = false;
+}
+
+bool MultiSensorCapture::NextFrameSet(std::vector<geometry::RGBDImage> &frames,
+                                      std::vector<uint64_t> &timestamps,
+                                      bool wait) {
+    if (callback_) {
+        utility::LogError(
+                "[MultiSensorCapture] Frame sets are delivered to the "
+                "callback.");
+    }
+    if (!is_capturing_) {
+        utility::LogWarning("Please StartCapture() first.");
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    ReleaseFrameSet();
+    bool matched = MatchFrameSet();
+    if (!matched && wait) {
+        frame_captured_.wait(lock, [this, &matched] {
+            matched = MatchFrameSet();
+            return matched || stop_;
+        });
+    }
+    if (!matched) {
+        return false;
+    }
+    GetFrameSet(frames, timestamps);
+    return true;
+}
+
+size_t MultiSensorCapture::GetNumDroppedFrames() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_dropped_;
+}
+
+void MultiSensorCapture::RunCapture(size_t sensor_idx) {
+    RGBDSensor &sensor = *sensors_[sensor_idx];
+    SensorBuffer &buffer = buffers_[sensor_idx];
+    while (true) {
+        size_t slot;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stop_) {
+                return;
+            }
+            if (!buffer.free.empty()) {
+                slot = buffer.free.front();
+                buffer.free.pop_front();
+            } else {
+                // The consumer is behind, overwrite the oldest frame.
+                slot = buffer.ready.front();
+                buffer.ready.pop_front();
+                ++num_dropped_;
+            }
+        }
+
+        Slot &s = buffer.slots[slot];
+        bool success = false;
+        try {
+            success = sensor.CaptureFrameInto(s.frame, /*wait=*/true,
+                                              align_depth_to_color_);
+            if (success) {
+                s.timestamp = sensor.GetTimestamp();
+                // Only the first frames of a slot are moved to pinned
+                // memory, the following frames are captured into it.
+                core::Tensor color = s.frame.color_.AsTensor();
+                core::Tensor depth = s.frame.depth_.AsTensor();
+                if (use_pinned_memory_ && !color.IsPinned()) {
+                    s.frame.color_ = geometry::Image(color.PinMemory());
+                }
+                if (use_pinned_memory_ && !depth.IsPinned()) {
+                    s.frame.depth_ = geometry::Image(depth.PinMemory());
+                }
+            }
+        } catch (const std::exception &e) {
+            utility::LogWarning(
+                    "[MultiSensorCapture] Failed to capture from sensor {}: "
+                    "{}",
+                    sensor_idx, e.what());
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (success) {
+                buffer.ready.push_back(slot);
+            } else {
+                buffer.free.push_back(slot);
+            }
+        }
+        if (success) {
+            frame_captured_.notify_all();
+        }
+    }
+}
+
+void MultiSensorCapture::RunDelivery() {
+    std::vector<geometry::RGBDImage> frames;
+    std::vector<uint64_t> timestamps;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            ReleaseFrameSet();
+            bool matched = false;
+            frame_captured_.wait(lock, [this, &matched] {
+                matched = MatchFrameSet();
+                return matched || stop_;
+            });
+            if (!matched) {
+                return;
+            }
+            GetFrameSet(frames, timestamps);
+        }
+        // The capture threads continue meanwhile, they do not write to the
+        // held slots.
+        try {
+            callback_(frames, timestamps);
+        } catch (const std::exception &e) {
+            utility::LogWarning("[MultiSensorCapture] Callback failed: {}",
+                                e.what());
+        }
+    }
+}
+
+bool MultiSensorCapture::MatchFrameSet() {
+    while (true) {
+        uint64_t max_timestamp = 0;
+        for (const SensorBuffer &buffer : buffers_) {
+            if (buffer.ready.empty()) {
+                return false;
+            }
+            const Slot &oldest = buffer.slots[buffer.ready.front()];
+            max_timestamp = std::max(max_timestamp, oldest.timestamp);
+        }
+        // Drop the frames that are too old to be matched with the newest
+        // oldest frame. They can not be in any later frame set either.
+        bool matched = true;
+        for (SensorBuffer &buffer : buffers_) {
+            const size_t slot = buffer.ready.front();
+            if (buffer.slots[slot].timestamp + max_time_difference_ <
+                max_timestamp) {
+                buffer.ready.pop_front();
+                buffer.free.push_back(slot);
+                ++num_dropped_;
+                matched = false;
+            }
+        }
+        if (matched) {
+            for (SensorBuffer &buffer : buffers_) {
+                buffer.held = buffer.ready.front();
+                buffer.has_held = true;
+                buffer.ready.pop_front();
+            }
+            return true;
+        }
+    }
+}
+
+void MultiSensorCapture::ReleaseFrameSet() {
+    for (SensorBuffer &buffer : buffers_) {
+        if (buffer.has_held) {
+            buffer.free.push_back(buffer.held);
+            buffer.has_held = false;
+        }
+    }
+}
+
+void MultiSensorCapture::GetFrameSet(std::vector<geometry::RGBDImage> &frames,
+                                     std::vector<uint64_t> &timestamps) const {
+    frames.resize(buffers_.size());
+    timestamps.resize(buffers_.size());
+    for (size_t i = 0; i < buffers_.size(); ++i) {
+        const Slot &slot = buffers_[i].slots[buffers_[i].held];
+        frames[i] = slot.frame;
+        timestamps[i] = slot.timestamp;
+    }
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,181 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/io/sensor/RGBDSensor.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class MultiSensorCapture
+///
+/// \brief Captures from several RGBD sensors at once and groups their frames
+/// into synchronized frame sets.
+///
+/// Every sensor is read by a thread of its own into a ring buffer of frames
+/// whose memory is allocated once and reused afterwards, so that capturing
+/// from many cameras at full rate does not allocate memory per frame. A frame
+/// set holds the oldest frame of every sensor such that all timestamps are
+/// at most \p max_time_difference apart. Older frames that have no match are
+/// dropped, as well as the oldest frames of a sensor whose ring buffer is full
+/// because the frame sets are not consumed fast enough.
+///
+/// Frame sets are delivered either by NextFrameSet() or by a callback on a
+/// delivery thread, see SetFrameSetCallback(). For hardware synchronized
+/// capture, configure one camera as master and the others as slaves before
+/// starting, e.g. with the "inter_cam_sync_mode" option of
+/// RealSenseSensorConfig. The timestamps of all sensors must have the same
+/// time base, such as the global time of RealSense cameras.
+class MultiSensorCapture {
+public:
+    /// Called with the frames and the timestamps (in us) of a frame set, in
+    /// the order of the sensors. The images use the memory of the ring
+    /// buffers and are only valid during the call, Clone() them to keep them.
+    using FrameSetCallback =
+            std::function<void(const std::vector<geometry::RGBDImage> &,
+                                const std::vector<uint64_t> &)>;
+
+    static const size_t DEFAULT_BUFFER_SIZE = 4;
+    static const uint64_t DEFAULT_MAX_TIME_DIFFERENCE = 5000;
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param sensors Initialized sensors, see RGBDSensor::InitSensor(). They
+    /// must not be used directly while capturing.
+    /// \param buffer_size Number of frames in the ring buffer of each sensor,
+    /// at least 2.
+    /// \param max_time_difference Maximum difference (in us) of the
+    /// timestamps of the frames of a frame set.
+    /// \param use_pinned_memory Keep the frames in page-locked memory, which
+    /// is copied to CUDA devices asynchronously and at full bandwidth.
+    /// Requires CUDA.
+    MultiSensorCapture(
+            const std::vector<std::shared_ptr<RGBDSensor>> &sensors,
+            size_t buffer_size = DEFAULT_BUFFER_SIZE,
+            uint64_t max_time_difference = DEFAULT_MAX_TIME_DIFFERENCE,
+            bool use_pinned_memory = false);
+
+    MultiSensorCapture(const MultiSensorCapture &) = delete;
+    MultiSensorCapture &operator=(const MultiSensorCapture &) = delete;
+    ~MultiSensorCapture();
+
+    /// Deliver the frame sets to \p callback on a delivery thread instead of
+    /// NextFrameSet(). The capture threads continue while the callback runs.
+    /// Must be set before StartCapture(), an empty function unsets it.
+    void SetFrameSetCallback(const FrameSetCallback &callback);
+
+    /// Start capturing from all sensors.
+    /// \param start_record Start recording of the sensors to their files.
+    /// \param align_depth_to_color Align the depth images to the color images.
+    /// \return false if a sensor failed to start. The started sensors are
+    /// stopped then.
+    bool StartCapture(bool start_record = false,
+                      bool align_depth_to_color = true);
+
+    /// Stop capturing and delivering frame sets.
+    void StopCapture();
+
+    bool IsCapturing() const { return is_capturing_; }
+
+    /// Get the next frame set.
+    ///
+    /// The images use the memory of the ring buffers and stay valid until the
+    /// next call of NextFrameSet() or StopCapture(), Clone() them to keep
+    /// them longer.
+    /// \param frames Frames of the sensors, in the order of the sensors.
+    /// \param timestamps Timestamps (in us) of the frames.
+    /// \param wait If true wait for the next frame set, else return false
+    /// immediately if it is not yet complete.
+    /// \return false if there is no frame set, e.g. the capture was stopped.
+    bool NextFrameSet(std::vector<geometry::RGBDImage> &frames,
+                      std::vector<uint64_t> &timestamps,
+                      bool wait = true);
+
+    size_t GetNumSensors() const { return sensors_.size(); }
+
+    /// Number of frames dropped since StartCapture(), because they had no
+    /// match in the other sensors or the ring buffer was full.
+    size_t GetNumDroppedFrames() const;
+
+private:
+    struct Slot {
+        geometry::RGBDImage frame;
+        uint64_t timestamp = 0;
+    };
+    struct SensorBuffer {
+        std::vector<Slot> slots;
+        /// Indices of the slots that can be captured into.
+        std::deque<size_t> free;
+        /// Indices of the captured slots, oldest first.
+        std::deque<size_t> ready;
+        /// Slot of the current frame set, if any.
+        bool has_held = false;
+        size_t held = 0;
+        std::thread thread;
+    };
+
+    void RunCapture(size_t sensor_idx);
+    void RunDelivery();
+
+    /// Moves the oldest matching frames of all sensors to the held slots.
+    /// Requires mutex_.
+    bool MatchFrameSet();
+    /// Returns the held slots to the free slots. Requires mutex_.
+    void ReleaseFrameSet();
+    /// Copies the held frames. Requires mutex_.
+    void GetFrameSet(std::vector<geometry::RGBDImage> &frames,
+                     std::vector<uint64_t> &timestamps) const;
+
+    std::vector<std::shared_ptr<RGBDSensor>> sensors_;
+    size_t buffer_size_;
+    uint64_t max_time_difference_;
+    bool use_pinned_memory_;
+    bool align_depth_to_color_ = true;
+    FrameSetCallback callback_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable frame_captured_;
+    std::vector<SensorBuffer> buffers_;
+    size_t num_dropped_ = 0;
+    bool stop_ = false;
+    bool is_capturing_ = false;
+    std::thread delivery_thread_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
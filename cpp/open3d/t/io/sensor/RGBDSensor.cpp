@@ -0,0 +1,73 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/RGBDSensor.h"
+
+#include <cstring>
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+bool RGBDSensor::CaptureFrameInto(geometry::RGBDImage &frame,
+                                  bool wait,
+                                  bool align_depth_to_color) {
+    const geometry::RGBDImage captured =
+            CaptureFrame(wait, align_depth_to_color);
+    if (captured.IsEmpty()) {
+        return false;
+    }
+    const core::Tensor color =
+            captured.color_.AsTensor().To(core::Device("CPU:0")).Contiguous();
+    const core::Tensor depth =
+            captured.depth_.AsTensor().To(core::Device("CPU:0")).Contiguous();
+    CopyToImage(color.GetDataPtr(), color.GetShape(), color.GetDtype(),
+                frame.color_);
+    CopyToImage(depth.GetDataPtr(), depth.GetShape(), depth.GetDtype(),
+                frame.depth_);
+    return true;
+}
+
+void RGBDSensor::CopyToImage(const void *data,
+                             const core::SizeVector &shape,
+                             core::Dtype dtype,
+                             geometry::Image &image) {
+    core::Tensor tensor = image.AsTensor();
+    if (tensor.GetShape() != shape || tensor.GetDtype() != dtype ||
+        tensor.GetDevice().GetType() != core::Device::DeviceType::CPU ||
+        !tensor.IsContiguous()) {
+        tensor = core::Tensor::Empty(shape, dtype);
+        image = geometry::Image(tensor);
+    }
+    std::memcpy(tensor.GetDataPtr(), data,
+                shape.NumElements() * dtype.ByteSize());
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -28,6 +28,8 @@
 
 #include <string>
 
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
 #include "open3d/io/sensor/RGBDSensorConfig.h"
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/io/sensor/RGBDVideoMetadata.h"
@@ -84,6 +86,22 @@ public:
     virtual geometry::RGBDImage CaptureFrame(
             bool wait = true, bool align_depth_to_color = true) = 0;
 
+    /// Acquire the next synchronized RGBD frameset into \p frame.
+    ///
+    /// The memory of the color and depth images of \p frame is reused if they
+    /// are contiguous CPU images with the size and data type of the stream,
+    /// such as the images of a previous call, else they are reallocated. This
+    /// avoids allocating new images for every frame as in CaptureFrame().
+    /// \param frame The frame to capture into.
+    /// \param wait If true wait for the next frame set, else return false
+    /// immediately if it is not yet available.
+    /// \param align_depth_to_color Enable aligning WFOV depth image to
+    /// the color image in visualizer.
+    /// \return true if a frame was captured, else \p frame is unchanged.
+    virtual bool CaptureFrameInto(geometry::RGBDImage &frame,
+                                  bool wait = true,
+                                  bool align_depth_to_color = true);
+
     /// Get current timestamp (in us).
     virtual uint64_t GetTimestamp() const = 0;
 
@@ -107,6 +125,15 @@ public:
                 GetFilename().empty() ? ""
                                       : "\nRecording to file " + GetFilename());
     }
+
+protected:
+    /// Copies the contiguous host image \p data of \p shape {rows, cols,
+    /// channels} and \p dtype into \p image, reusing the memory of \p image
+    /// if possible.
+    static void CopyToImage(const void *data,
+                            const core::SizeVector &shape,
+                            core::Dtype dtype,
+                            geometry::Image &image);
 };
 
 }  // namespace io
@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/RGBDVideoPrefetcher.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+// If DEFAULT_BUFFER_SIZE is odr-used, a definition is required.
+const size_t RGBDVideoPrefetcher::DEFAULT_BUFFER_SIZE;
+
+RGBDVideoPrefetcher::RGBDVideoPrefetcher(
+        std::unique_ptr<RGBDVideoReader> reader,
+        size_t buffer_size,
+        const core::Device &device)
+    : reader_(std::move(reader)),
+      buffer_size_(std::max(buffer_size, size_t(1))),
+      device_(device) {
+    if (!reader_) {
+        utility::LogError("[RGBDVideoPrefetcher] reader must not be null.");
+    }
+    if (reader_->IsOpened()) {
+        Start();
+    }
+}
+
+RGBDVideoPrefetcher::~RGBDVideoPrefetcher() { Stop(); }
+
+std::unique_ptr<RGBDVideoPrefetcher> RGBDVideoPrefetcher::Create(
+        const std::string &filename,
+        size_t buffer_size,
+        const core::Device &device) {
+    return std::make_unique<RGBDVideoPrefetcher>(
+            RGBDVideoReader::Create(filename), buffer_size, device);
+}
+
+bool RGBDVideoPrefetcher::IsEOF() const {
+    return prefetcher_ && prefetcher_->IsEnd();
+}
+
+bool RGBDVideoPrefetcher::Open(const std::string &filename) {
+    Stop();
+    if (!reader_->Open(filename)) {
+        return false;
+    }
+    timestamp_ = 0;
+    Start();
+    return true;
+}
+
+void RGBDVideoPrefetcher::Close() {
+    Stop();
+    reader_->Close();
+}
+
+bool RGBDVideoPrefetcher::SeekTimestamp(uint64_t timestamp) {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return false;
+    }
+    Stop();
+    const bool success = reader_->SeekTimestamp(timestamp);
+    Start();
+    return success;
+}
+
+uint64_t RGBDVideoPrefetcher::GetTimestamp() const {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return UINT64_MAX;
+    }
+    return timestamp_;
+}
+
+t::geometry::RGBDImage RGBDVideoPrefetcher::NextFrame() {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    TimedFrame frame;
+    if (!prefetcher_ || !prefetcher_->Pop(frame)) {
+        return t::geometry::RGBDImage();
+    }
+    timestamp_ = frame.second;
+    return std::move(frame.first);
+}
+
+void RGBDVideoPrefetcher::Start() {
+    stop_ = false;
+    prefetcher_ = std::make_unique<core::Prefetcher<TimedFrame>>(
+            [this](size_t, TimedFrame &frame) { return Decode(frame); },
+            device_, buffer_size_);
+}
+
+void RGBDVideoPrefetcher::Stop() {
+    if (!prefetcher_) {
+        return;
+    }
+    // Stops Decode() if it waits for a frame, then joins the thread.
+    stop_ = true;
+    prefetcher_.reset();
+}
+
+bool RGBDVideoPrefetcher::Decode(TimedFrame &frame) {
+    const double fps = reader_->GetMetadata().fps_;
+    const std::chrono::duration<double> frame_period(
+            fps > 0 ? std::min(1.0 / fps, 0.1) : 0.01);
+    try {
+        while (!stop_ && !reader_->IsEOF()) {
+            frame.first = reader_->NextFrame();
+            if (!frame.first.IsEmpty()) {
+                frame.second = reader_->GetTimestamp();
+                if (frame.first.depth_.GetDevice() != device_) {
+                    frame.first = frame.first.To(device_);
+                }
+                return true;
+            }
+            // The reader has no frame ready before the end of the video.
+            // Wait for a frame period instead of polling it.
+            std::this_thread::sleep_for(frame_period);
+        }
+    } catch (const std::exception &e) {
+        utility::LogWarning("[RGBDVideoPrefetcher] Failed to decode: {}",
+                            e.what());
+    }
+    return false;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
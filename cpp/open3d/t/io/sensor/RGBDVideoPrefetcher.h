@@ -0,0 +1,136 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Prefetcher.h"
+#include "open3d/t/io/sensor/RGBDVideoReader.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class RGBDVideoPrefetcher
+///
+/// \brief Decodes the frames of another RGBDVideoReader on a background
+/// thread with a core::Prefetcher, so that decoding frame k + 1 overlaps with
+/// processing frame k and playback runs at the speed of the slower of the
+/// two rather than their sum. On CUDA devices the frames are uploaded on a
+/// stream of the decoding thread before they are returned.
+///
+/// Seeking, opening and closing stop the decoding thread, drop the buffered
+/// frames and restart it.
+class RGBDVideoPrefetcher : public RGBDVideoReader {
+public:
+    static const size_t DEFAULT_BUFFER_SIZE = 8;
+
+    /// \brief Parameterized Constructor. Prefetching starts right away if
+    /// \p reader is opened.
+    ///
+    /// \param reader The reader decoding the frames. It must not be used
+    /// directly while owned by the prefetcher.
+    /// \param buffer_size Maximum number of frames decoded ahead of
+    /// NextFrame().
+    /// \param device Device of the returned frames.
+    RGBDVideoPrefetcher(std::unique_ptr<RGBDVideoReader> reader,
+                        size_t buffer_size = DEFAULT_BUFFER_SIZE,
+                        const core::Device &device = core::Device("CPU:0"));
+
+    RGBDVideoPrefetcher(const RGBDVideoPrefetcher &) = delete;
+    RGBDVideoPrefetcher &operator=(const RGBDVideoPrefetcher &) = delete;
+    virtual ~RGBDVideoPrefetcher();
+
+    /// Creates the reader of \p filename with RGBDVideoReader::Create() and
+    /// prefetches its frames.
+    static std::unique_ptr<RGBDVideoPrefetcher> Create(
+            const std::string &filename,
+            size_t buffer_size = DEFAULT_BUFFER_SIZE,
+            const core::Device &device = core::Device("CPU:0"));
+
+    virtual bool IsOpened() const override { return reader_->IsOpened(); }
+
+    /// Check if all frames have been returned by NextFrame().
+    virtual bool IsEOF() const override;
+
+    virtual bool Open(const std::string &filename) override;
+
+    virtual void Close() override;
+
+    virtual const RGBDVideoMetadata &GetMetadata() const override {
+        return reader_->GetMetadata();
+    }
+
+    virtual RGBDVideoMetadata &GetMetadata() override {
+        return reader_->GetMetadata();
+    }
+
+    /// Seek to the timestamp (in us), dropping the prefetched frames.
+    virtual bool SeekTimestamp(uint64_t timestamp) override;
+
+    /// Timestamp (in us) of the last frame returned by NextFrame().
+    virtual uint64_t GetTimestamp() const override;
+
+    /// Returns the next prefetched frame on the device of the prefetcher,
+    /// waiting for it to be decoded if necessary. Returns an empty frame at
+    /// the end of the video.
+    virtual t::geometry::RGBDImage NextFrame() override;
+
+    virtual std::string GetFilename() const override {
+        return reader_->GetFilename();
+    }
+
+    using RGBDVideoReader::SaveFrames;
+    using RGBDVideoReader::ToString;
+
+private:
+    /// A decoded frame with its timestamp.
+    using TimedFrame = std::pair<t::geometry::RGBDImage, uint64_t>;
+
+    void Start();
+    void Stop();
+    /// Decodes the next frame on the decoding thread. Returns false at the
+    /// end of the video or when stopping.
+    bool Decode(TimedFrame &frame);
+
+    std::unique_ptr<RGBDVideoReader> reader_;
+    size_t buffer_size_;
+    core::Device device_;
+
+    /// Decoded frames with their timestamps, null while stopped.
+    std::unique_ptr<core::Prefetcher<TimedFrame>> prefetcher_;
+    std::atomic<bool> stop_{false};
+    uint64_t timestamp_ = 0;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
@@ -29,7 +29,7 @@
 #include <string>
 
 #include "open3d/io/IJsonConvertibleIO.h"
-#include "open3d/io/ImageIO.h"
+#include "open3d/t/io/ImageBatchWriter.h"
 #include "open3d/t/io/sensor/realsense/RSBagReader.h"
 #include "open3d/utility/FileSystem.h"
 
@@ -68,27 +68,20 @@ void RGBDVideoReader::SaveFrames(const std::string &frame_path,
             fmt::format("{}/intrinsic.json", frame_path), GetMetadata());
     SeekTimestamp(start_time);
     int idx = 0;
-    open3d::geometry::Image im_color, im_depth;
+    // Frames are decoded on this thread while the writer encodes the
+    // previous ones.
+    ImageBatchWriter writer;
     for (auto tim_rgbd = NextFrame(); !IsEOF() && GetTimestamp() < end_time;
-         ++idx, tim_rgbd = NextFrame())
-#pragma omp parallel sections
-    {
-#pragma omp section
-        {
-            im_color = tim_rgbd.color_.ToLegacyImage();
-            auto color_file =
-                    fmt::format("{0}/color/{1:05d}.jpg", frame_path, idx);
-            open3d::io::WriteImage(color_file, im_color);
-            utility::LogDebug("Written color image to {}", color_file);
-        }
-#pragma omp section
-        {
-            im_depth = tim_rgbd.depth_.ToLegacyImage();
-            auto depth_file =
-                    fmt::format("{0}/depth/{1:05d}.png", frame_path, idx);
-            open3d::io::WriteImage(depth_file, im_depth);
-            utility::LogDebug("Written depth image to {}", depth_file);
-        }
+         ++idx, tim_rgbd = NextFrame()) {
+        auto color_file = fmt::format("{0}/color/{1:05d}.jpg", frame_path, idx);
+        writer.Push(color_file, tim_rgbd.color_);
+        auto depth_file = fmt::format("{0}/depth/{1:05d}.png", frame_path, idx);
+        writer.Push(depth_file, tim_rgbd.depth_);
+        utility::LogDebug("Queued color and depth images {} and {}",
+                          color_file, depth_file);
+    }
+    if (!writer.Flush()) {
+        utility::LogWarning("Failed to write some images to {}", frame_path);
     }
     utility::LogInfo("Written {} depth and color images to {}/{{depth,color}}/",
                      idx, frame_path);
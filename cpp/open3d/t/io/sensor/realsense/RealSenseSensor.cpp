@@ -201,6 +201,18 @@ bool RealSenseSensor::InitSensor(const RealSenseSensorConfig& sensor_config,
             dev.set_option(RS2_OPTION_VISUAL_PRESET,
                            static_cast<float>(option));
     }
+    // Hardware synchronization of multiple cameras: 0 = default (no sync),
+    // 1 = master, 2 = slave.
+    it = sensor_config.config_.find("inter_cam_sync_mode");
+    if (it != sensor_config.config_.cend() && !it->second.empty()) {
+        if (!dev.supports(RS2_OPTION_INTER_CAM_SYNC_MODE)) {
+            utility::LogWarning(
+                    "Camera does not support inter_cam_sync_mode, ignored.");
+        } else {
+            dev.set_option(RS2_OPTION_INTER_CAM_SYNC_MODE,
+                           std::stof(it->second));
+        }
+    }
     metadata_.ConvertFromJsonValue(
             RealSenseSensorConfig::GetMetadataJson(profile));
     RealSenseSensorConfig::GetPixelDtypes(profile, metadata_);
@@ -273,34 +285,45 @@ void RealSenseSensor::ResumeRecord() {
 
 geometry::RGBDImage RealSenseSensor::CaptureFrame(bool wait,
                                                   bool align_depth_to_color) {
+    // Capture into new images, the previously returned frames may still be
+    // in use.
+    geometry::RGBDImage frame;
+    if (!CaptureFrameInto(frame, wait, align_depth_to_color)) {
+        return geometry::RGBDImage();
+    }
+    current_frame_ = frame;
+    return frame;
+}
+
+bool RealSenseSensor::CaptureFrameInto(geometry::RGBDImage& frame,
+                                       bool wait,
+                                       bool align_depth_to_color) {
     if (!is_capturing_) {
         utility::LogError("Please StartCapture() first.");
-        return geometry::RGBDImage();
+        return false;
     }
     try {
         rs2::frameset frames;
         if (!((wait && pipe_->try_wait_for_frames(&frames)) ||
               (!wait && pipe_->poll_for_frames(&frames))))
-            return geometry::RGBDImage();
+            return false;
         if (align_depth_to_color) frames = align_to_color_->process(frames);
         timestamp_ = uint64_t(frames.get_timestamp() * MILLISEC_TO_MICROSEC);
         // Copy frame data to Tensors
         const auto& color_frame = frames.get_color_frame();
-        current_frame_.color_ = core::Tensor(
-                static_cast<const uint8_t*>(color_frame.get_data()),
-                {color_frame.get_height(), color_frame.get_width(),
-                 metadata_.color_channels_},
-                metadata_.color_dt_);
+        CopyToImage(color_frame.get_data(),
+                    {color_frame.get_height(), color_frame.get_width(),
+                     metadata_.color_channels_},
+                    metadata_.color_dt_, frame.color_);
         const auto& depth_frame = frames.get_depth_frame();
-        current_frame_.depth_ = core::Tensor(
-                static_cast<const uint16_t*>(depth_frame.get_data()),
-                {depth_frame.get_height(), depth_frame.get_width()},
-                metadata_.depth_dt_);
-        return current_frame_;
+        CopyToImage(depth_frame.get_data(),
+                    {depth_frame.get_height(), depth_frame.get_width(), 1},
+                    metadata_.depth_dt_, frame.depth_);
+        return true;
     } catch (const rs2::error& e) {
         utility::LogError("CaptureFrame() failed: {}: {}",
                           rs2_exception_type_to_string(e.get_type()), e.what());
-        return geometry::RGBDImage();
+        return false;
     }
 }
 
@@ -111,6 +111,19 @@ public:
     virtual geometry::RGBDImage CaptureFrame(
             bool wait = true, bool align_depth_to_color = true) override;
 
+    /// Acquire the next synchronized RGBD frameset into \p frame, copying the
+    /// frame data directly into the images of \p frame if they have the size
+    /// and data type of the streams.
+    ///
+    /// \param frame The frame to capture into.
+    /// \param wait If true wait for the next frame set, else return false
+    /// immediately if it is not yet available.
+    /// \param align_depth_to_color Enable aligning WFOV depth image to
+    /// the color image in visualizer.
+    virtual bool CaptureFrameInto(geometry::RGBDImage &frame,
+                                  bool wait = true,
+                                  bool align_depth_to_color = true) override;
+
     /// Get current timestamp (in us)
     ///
     /// See
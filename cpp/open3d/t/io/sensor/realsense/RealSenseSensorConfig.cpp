@@ -161,7 +161,8 @@ static std::unordered_map<std::string, std::string> standard_config{
         {"depth_format", "RS2_FORMAT_ANY"},
         {"depth_resolution", "0,0"},
         {"fps", "0"},
-        {"visual_preset", "VISUAL_PRESET_DEFAULT"}};
+        {"visual_preset", "VISUAL_PRESET_DEFAULT"},
+        {"inter_cam_sync_mode", ""}};
 
 RealSenseSensorConfig::RealSenseSensorConfig() { config_ = standard_config; }
 
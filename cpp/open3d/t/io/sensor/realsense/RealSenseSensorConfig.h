@@ -75,7 +75,11 @@ namespace io {
 ///  // Controls depth computation on the device. Supported values are
 ///  // specific to device family (SR300, RS400, L500). Leave empty to pick
 ///  // the default.
-///     {"visual_preset": ""}
+///     {"visual_preset": ""},
+///  // Hardware synchronization of multiple cameras connected with a sync
+///  // cable: "1" for the master and "2" for the slaves (RS400). Leave empty
+///  // to keep the camera default.
+///     {"inter_cam_sync_mode": ""}
 ///  }
 ///  ~~~
 class RealSenseSensorConfig : public RGBDSensorConfig {
@@ -0,0 +1,263 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/color_map/RigidOptimizer.h"
+
+#include <cstring>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/pipelines/color_map/ColorMapUtils.h"
+#include "open3d/t/pipelines/kernel/ColorMap.h"
+#include "open3d/utility/Eigen.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace color_map {
+
+namespace legacy_color_map = open3d::pipelines::color_map;
+
+/// Stacks the single channel images of the same size into a {C, H, W} tensor
+/// of dtype, the dtype of the image pixels.
+static core::Tensor StackImages(
+        const std::vector<open3d::geometry::Image>& images,
+        core::Dtype dtype,
+        const core::Device& device) {
+    const int64_t rows = images.empty() ? 0 : images[0].height_;
+    const int64_t cols = images.empty() ? 0 : images[0].width_;
+    core::Tensor stack({int64_t(images.size()), rows, cols}, dtype,
+                       core::Device("CPU:0"));
+    const size_t bytes = rows * cols * dtype.ByteSize();
+    for (size_t i = 0; i < images.size(); ++i) {
+        if (images[i].height_ != rows || images[i].width_ != cols ||
+            images[i].num_of_channels_ != 1 ||
+            images[i].bytes_per_channel_ != int(dtype.ByteSize())) {
+            utility::LogError(
+                    "Images should be single channel of the same size.");
+        }
+        std::memcpy(static_cast<uint8_t*>(stack.GetDataPtr()) + i * bytes,
+                    images[i].data_.data(), bytes);
+    }
+    return stack.To(device);
+}
+
+/// Returns the {C, 3, 3} intrinsics and {C, 4, 4} extrinsics of the cameras.
+static std::pair<core::Tensor, core::Tensor> GetCameras(
+        const camera::PinholeCameraTrajectory& camera_trajectory,
+        const core::Device& device) {
+    std::vector<float> intrinsics, extrinsics;
+    for (const auto& parameters : camera_trajectory.parameters_) {
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                intrinsics.push_back(
+                        float(parameters.intrinsic_.intrinsic_matrix_(i, j)));
+            }
+        }
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                extrinsics.push_back(float(parameters.extrinsic_(i, j)));
+            }
+        }
+    }
+    const int64_t n_cameras = camera_trajectory.parameters_.size();
+    return std::make_pair(
+            core::Tensor(intrinsics, {n_cameras, 3, 3}, core::Dtype::Float32,
+                         device),
+            core::Tensor(extrinsics, {n_cameras, 4, 4}, core::Dtype::Float32,
+                         device));
+}
+
+/// Averages the intensities of the vertices over the images seeing them.
+static core::Tensor ComputeProxyIntensity(const core::Tensor& vertices,
+                                          const core::Tensor& indices,
+                                          const std::vector<int64_t>& offsets,
+                                          const core::Tensor& images_gray,
+                                          const core::Tensor& intrinsics,
+                                          const core::Tensor& extrinsics,
+                                          int image_margin) {
+    const core::Device device = vertices.GetDevice();
+    core::Tensor intensity_sums = core::Tensor::Zeros(
+            {vertices.GetLength()}, core::Dtype::Float32, device);
+    core::Tensor counts = core::Tensor::Zeros({vertices.GetLength()},
+                                              core::Dtype::Float32, device);
+    for (int64_t c = 0; c + 1 < int64_t(offsets.size()); ++c) {
+        kernel::AccumulateVertexIntensity(
+                vertices, indices.Slice(0, offsets[c], offsets[c + 1]),
+                images_gray[c], intrinsics[c], extrinsics[c], image_margin,
+                intensity_sums, counts);
+    }
+    // The invisible vertices are divided by 1, keeping their 0 intensity.
+    return intensity_sums / (counts + counts.Eq(0).To(core::Dtype::Float32));
+}
+
+open3d::geometry::TriangleMesh RunRigidOptimizer(
+        const open3d::geometry::TriangleMesh& mesh,
+        const std::vector<open3d::geometry::RGBDImage>& images_rgbd,
+        const camera::PinholeCameraTrajectory& camera_trajectory,
+        const legacy_color_map::RigidOptimizerOption& option,
+        const core::Device& device) {
+    if (!option.debug_output_dir_.empty()) {
+        utility::LogWarning("debug_output_dir_ is ignored.");
+    }
+    open3d::geometry::TriangleMesh opt_mesh = mesh;
+    camera::PinholeCameraTrajectory opt_camera_trajectory = camera_trajectory;
+    const int64_t n_cameras = opt_camera_trajectory.parameters_.size();
+    if (int64_t(images_rgbd.size()) != n_cameras) {
+        utility::LogError("Expected {} RGB-D images, but got {}.", n_cameras,
+                          images_rgbd.size());
+    }
+
+    std::vector<open3d::geometry::Image> images_gray, images_dx, images_dy,
+            images_color, images_depth;
+    std::tie(images_gray, images_dx, images_dy, images_color, images_depth) =
+            legacy_color_map::CreateUtilImagesFromRGBD(images_rgbd);
+    std::vector<open3d::geometry::Image> images_mask =
+            legacy_color_map::CreateDepthBoundaryMasks(
+                    images_depth,
+                    option.depth_threshold_for_discontinuity_check_,
+                    option.half_dilation_kernel_size_for_discontinuity_map_);
+
+    const core::Tensor vertices = core::eigen_converter::
+            EigenVector3dVectorToTensor(opt_mesh.vertices_,
+                                        core::Dtype::Float32, device);
+    const int64_t n_vertices = vertices.GetLength();
+    const core::Tensor gray = StackImages(images_gray, core::Dtype::Float32,
+                                          device);
+    const core::Tensor dx = StackImages(images_dx, core::Dtype::Float32,
+                                        device);
+    const core::Tensor dy = StackImages(images_dy, core::Dtype::Float32,
+                                        device);
+    core::Tensor intrinsics, extrinsics;
+    std::tie(intrinsics, extrinsics) =
+            GetCameras(opt_camera_trajectory, device);
+
+    // The indices of the vertices visible in camera c are
+    // indices[offsets[c]:offsets[c + 1]]. The depth images are only used
+    // here, so they are uploaded one at a time.
+    utility::LogDebug("[ColorMapOptimization] ComputeVertexVisibility");
+    std::vector<core::Tensor> visible_indices;
+    std::vector<int64_t> offsets(1, 0);
+    core::Tensor visible =
+            core::Tensor::Empty({n_vertices}, core::Dtype::Bool, device);
+    for (int64_t c = 0; c < n_cameras; ++c) {
+        kernel::ComputeVertexVisibility(
+                vertices, StackImages({images_depth[c]}, core::Dtype::Float32,
+                                      device)[0],
+                StackImages({images_mask[c]}, core::Dtype::UInt8, device)[0],
+                intrinsics[c], extrinsics[c],
+                float(option.maximum_allowable_depth_),
+                float(option.depth_threshold_for_visibility_check_), visible);
+        visible_indices.push_back(visible.NonZero().Reshape({-1}));
+        offsets.push_back(offsets.back() + visible_indices.back().GetLength());
+        utility::LogDebug(
+                "[cam {:d}]: {:d}/{:d} ({:.5f}%) vertices are visible", c,
+                visible_indices.back().GetLength(), n_vertices,
+                double(visible_indices.back().GetLength()) / n_vertices * 100);
+    }
+    core::Tensor indices =
+            core::Tensor::Empty({offsets.back()}, core::Dtype::Int64, device);
+    for (int64_t c = 0; c < n_cameras; ++c) {
+        indices.Slice(0, offsets[c], offsets[c + 1]).AsRvalue() =
+                visible_indices[c];
+    }
+    visible_indices.clear();
+    const core::Tensor offsets_tensor(offsets, {n_cameras + 1},
+                                      core::Dtype::Int64, device);
+
+    utility::LogDebug("[ColorMapOptimization] Rigid Optimization");
+    core::Tensor proxy_intensity =
+            ComputeProxyIntensity(vertices, indices, offsets, gray, intrinsics,
+                                  extrinsics, option.image_boundary_margin_);
+    for (int itr = 0; itr < option.maximum_iteration_; itr++) {
+        utility::LogDebug("[Iteration {:04d}] ", itr + 1);
+        core::Tensor linear_systems = core::Tensor::Zeros(
+                {n_cameras, 29}, core::Dtype::Float32, device);
+        kernel::ComputeColorMapRigidLinearSystems(
+                vertices, indices, offsets_tensor, proxy_intensity, gray, dx,
+                dy, intrinsics, extrinsics, option.image_boundary_margin_,
+                linear_systems);
+
+        // The 6x6 systems are solved on the host, as in the legacy optimizer.
+        core::Tensor linear_systems_host =
+                linear_systems.To(core::Device("CPU:0"), core::Dtype::Float64);
+        const double* A_ptr = linear_systems_host.GetDataPtr<double>();
+        double residual = 0.0;
+        for (int64_t c = 0; c < n_cameras; ++c) {
+            const double* A = A_ptr + 29 * c;
+            Eigen::Matrix6d JTJ;
+            Eigen::Vector6d JTr;
+            for (int j = 0, i = 0; j < 6; j++) {
+                for (int k = 0; k <= j; k++, i++) {
+                    JTJ(j, k) = JTJ(k, j) = A[i];
+                }
+                JTr(j) = A[21 + j];
+            }
+            residual += A[27];
+
+            bool is_success;
+            Eigen::Matrix4d delta;
+            std::tie(is_success, delta) =
+                    utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ,
+                                                                         JTr);
+            auto& pose = opt_camera_trajectory.parameters_[c].extrinsic_;
+            pose = delta * pose;
+        }
+        if (offsets.back() > 0) {
+            utility::LogDebug("Residual error : {:.6f} (avg : {:.6f})",
+                              residual, residual / offsets.back());
+        } else {
+            utility::LogDebug("Residual error : {:.6f}", residual);
+        }
+
+        extrinsics = GetCameras(opt_camera_trajectory, device).second;
+        proxy_intensity = ComputeProxyIntensity(
+                vertices, indices, offsets, gray, intrinsics, extrinsics,
+                option.image_boundary_margin_);
+    }
+
+    // The colors are averaged once, as in the legacy optimizer.
+    utility::LogDebug("[ColorMapOptimization] Set Mesh Color");
+    core::Tensor indices_host = indices.To(core::Device("CPU:0"));
+    const int64_t* indices_ptr = indices_host.GetDataPtr<int64_t>();
+    std::vector<std::vector<int>> visibility_vertex_to_image(n_vertices);
+    for (int64_t c = 0; c < n_cameras; ++c) {
+        for (int64_t i = offsets[c]; i < offsets[c + 1]; ++i) {
+            visibility_vertex_to_image[indices_ptr[i]].push_back(int(c));
+        }
+    }
+    legacy_color_map::SetGeometryColorAverage(
+            opt_mesh, images_color, utility::nullopt, opt_camera_trajectory,
+            visibility_vertex_to_image, option.image_boundary_margin_,
+            option.invisible_vertex_color_knn_);
+    return opt_mesh;
+}
+
+}  // namespace color_map
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
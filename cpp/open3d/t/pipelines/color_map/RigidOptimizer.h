@@ -0,0 +1,66 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+
+#include "open3d/camera/PinholeCameraTrajectory.h"
+#include "open3d/core/Device.h"
+#include "open3d/geometry/RGBDImage.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/pipelines/color_map/RigidOptimizer.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace color_map {
+
+/// \brief Rigid color map optimization on \p device, with the results of
+/// pipelines::color_map::RunRigidOptimizer().
+///
+/// The visibility, the proxy intensities and the linear systems of all the
+/// cameras are computed by tensor kernels, the systems of all the cameras in
+/// one pass per iteration. The RGB-D images must all be of the same size.
+/// option.debug_output_dir_ is not supported.
+///
+/// \param mesh Mesh to color.
+/// \param images_rgbd RGB-D images, one per camera.
+/// \param camera_trajectory Initial cameras of the images.
+/// \param option Options of the legacy rigid optimizer.
+/// \param device Device of the optimization.
+/// \return The mesh with the optimized vertex colors.
+open3d::geometry::TriangleMesh RunRigidOptimizer(
+        const open3d::geometry::TriangleMesh& mesh,
+        const std::vector<open3d::geometry::RGBDImage>& images_rgbd,
+        const camera::PinholeCameraTrajectory& camera_trajectory,
+        const open3d::pipelines::color_map::RigidOptimizerOption& option,
+        const core::Device& device = core::Device("CPU:0"));
+
+}  // namespace color_map
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,195 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/ColorMap.h"
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+static void AssertContiguous(const core::Tensor &tensor,
+                             const core::Dtype &dtype,
+                             const core::Device &device) {
+    tensor.AssertDtype(dtype);
+    tensor.AssertDevice(device);
+    if (!tensor.IsContiguous()) {
+        utility::LogError("Color map tensors should be contiguous.");
+    }
+}
+
+static void AssertCamera(const core::Tensor &vertices,
+                         const core::Tensor &intrinsic,
+                         const core::Tensor &extrinsic) {
+    core::Device device = vertices.GetDevice();
+    AssertContiguous(vertices, core::Dtype::Float32, device);
+    vertices.AssertShape({vertices.GetLength(), 3});
+    AssertContiguous(intrinsic, core::Dtype::Float32, device);
+    intrinsic.AssertShape({3, 3});
+    AssertContiguous(extrinsic, core::Dtype::Float32, device);
+    extrinsic.AssertShape({4, 4});
+}
+
+void ComputeVertexVisibility(const core::Tensor &vertices,
+                             const core::Tensor &depth,
+                             const core::Tensor &mask,
+                             const core::Tensor &intrinsic,
+                             const core::Tensor &extrinsic,
+                             float depth_max,
+                             float depth_threshold,
+                             core::Tensor &visible) {
+    AssertCamera(vertices, intrinsic, extrinsic);
+    core::Device device = vertices.GetDevice();
+    AssertContiguous(depth, core::Dtype::Float32, device);
+    if (depth.NumDims() != 2) {
+        utility::LogError("Depth should be a {H, W} image, but got {}.",
+                          depth.GetShape().ToString());
+    }
+    AssertContiguous(mask, core::Dtype::UInt8, device);
+    mask.AssertShape(depth.GetShape());
+    AssertContiguous(visible, core::Dtype::Bool, device);
+    visible.AssertShape({vertices.GetLength()});
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeVertexVisibilityCPU(vertices, depth, mask, intrinsic, extrinsic,
+                                   depth_max, depth_threshold, visible);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeVertexVisibilityCUDA(vertices, depth, mask, intrinsic, extrinsic,
+                                    depth_max, depth_threshold, visible);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void AccumulateVertexIntensity(const core::Tensor &vertices,
+                               const core::Tensor &indices,
+                               const core::Tensor &image,
+                               const core::Tensor &intrinsic,
+                               const core::Tensor &extrinsic,
+                               int image_margin,
+                               core::Tensor &intensity_sums,
+                               core::Tensor &counts) {
+    AssertCamera(vertices, intrinsic, extrinsic);
+    core::Device device = vertices.GetDevice();
+    AssertContiguous(indices, core::Dtype::Int64, device);
+    indices.AssertShape({indices.GetLength()});
+    AssertContiguous(image, core::Dtype::Float32, device);
+    if (image.NumDims() != 2) {
+        utility::LogError("Image should be a {H, W} image, but got {}.",
+                          image.GetShape().ToString());
+    }
+    AssertContiguous(intensity_sums, core::Dtype::Float32, device);
+    intensity_sums.AssertShape({vertices.GetLength()});
+    AssertContiguous(counts, core::Dtype::Float32, device);
+    counts.AssertShape({vertices.GetLength()});
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        AccumulateVertexIntensityCPU(vertices, indices, image, intrinsic,
+                                     extrinsic, image_margin, intensity_sums,
+                                     counts);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        AccumulateVertexIntensityCUDA(vertices, indices, image, intrinsic,
+                                      extrinsic, image_margin, intensity_sums,
+                                      counts);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeColorMapRigidLinearSystems(const core::Tensor &vertices,
+                                       const core::Tensor &indices,
+                                       const core::Tensor &offsets,
+                                       const core::Tensor &proxy_intensity,
+                                       const core::Tensor &images,
+                                       const core::Tensor &images_dx,
+                                       const core::Tensor &images_dy,
+                                       const core::Tensor &intrinsics,
+                                       const core::Tensor &extrinsics,
+                                       int image_margin,
+                                       core::Tensor &linear_systems) {
+    core::Device device = vertices.GetDevice();
+    AssertContiguous(vertices, core::Dtype::Float32, device);
+    vertices.AssertShape({vertices.GetLength(), 3});
+    AssertContiguous(indices, core::Dtype::Int64, device);
+    indices.AssertShape({indices.GetLength()});
+    AssertContiguous(proxy_intensity, core::Dtype::Float32, device);
+    proxy_intensity.AssertShape({vertices.GetLength()});
+
+    AssertContiguous(images, core::Dtype::Float32, device);
+    if (images.NumDims() != 3) {
+        utility::LogError("Images should be a {C, H, W} stack, but got {}.",
+                          images.GetShape().ToString());
+    }
+    const int64_t n_cameras = images.GetLength();
+    AssertContiguous(images_dx, core::Dtype::Float32, device);
+    images_dx.AssertShape(images.GetShape());
+    AssertContiguous(images_dy, core::Dtype::Float32, device);
+    images_dy.AssertShape(images.GetShape());
+    AssertContiguous(offsets, core::Dtype::Int64, device);
+    offsets.AssertShape({n_cameras + 1});
+    AssertContiguous(intrinsics, core::Dtype::Float32, device);
+    intrinsics.AssertShape({n_cameras, 3, 3});
+    AssertContiguous(extrinsics, core::Dtype::Float32, device);
+    extrinsics.AssertShape({n_cameras, 4, 4});
+    AssertContiguous(linear_systems, core::Dtype::Float32, device);
+    linear_systems.AssertShape({n_cameras, 29});
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeColorMapRigidLinearSystemsCPU(
+                vertices, indices, offsets, proxy_intensity, images, images_dx,
+                images_dy, intrinsics, extrinsics, image_margin,
+                linear_systems);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeColorMapRigidLinearSystemsCUDA(
+                vertices, indices, offsets, proxy_intensity, images, images_dx,
+                images_dy, intrinsics, extrinsics, image_margin,
+                linear_systems);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,151 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// Kernels of the color map optimization. The mesh vertices are {N, 3}
+/// Float32, the images {H, W} Float32 and the cameras are given by {3, 3}
+/// intrinsic and {4, 4} world to camera extrinsic Float32 matrices, or
+/// stacks of them, all on the same device.
+
+/// Marks in visible, a {N} Bool tensor, the vertices projecting into depth
+/// with a depth within depth_threshold of the sensor depth, at most depth_max
+/// and outside of the depth boundary mask, a {H, W} UInt8 image where the
+/// boundaries are 255.
+void ComputeVertexVisibility(const core::Tensor &vertices,
+                             const core::Tensor &depth,
+                             const core::Tensor &mask,
+                             const core::Tensor &intrinsic,
+                             const core::Tensor &extrinsic,
+                             float depth_max,
+                             float depth_threshold,
+                             core::Tensor &visible);
+
+/// Adds the intensity of the nearest pixel of image to intensity_sums and 1
+/// to counts, both {N} Float32, for each of the vertex indices, a {M} Int64
+/// tensor of distinct indices, projecting into image within image_margin.
+void AccumulateVertexIntensity(const core::Tensor &vertices,
+                               const core::Tensor &indices,
+                               const core::Tensor &image,
+                               const core::Tensor &intrinsic,
+                               const core::Tensor &extrinsic,
+                               int image_margin,
+                               core::Tensor &intensity_sums,
+                               core::Tensor &counts);
+
+/// Computes the rigid color map linear systems of C cameras at once. The
+/// vertices seen by camera c are indices[offsets[c]:offsets[c + 1]], with
+/// indices {M} and offsets {C + 1} Int64. The residuals are the differences
+/// between the bilinearly interpolated intensities of images, a {C, H, W}
+/// stack with gradients images_dx and images_dy, and proxy_intensity {N}.
+/// linear_systems, {C, 29} Float32, gets the lower triangle of JtJ (21), Jtr
+/// (6), the squared residual (1) and the number of residuals (1) per camera.
+void ComputeColorMapRigidLinearSystems(const core::Tensor &vertices,
+                                       const core::Tensor &indices,
+                                       const core::Tensor &offsets,
+                                       const core::Tensor &proxy_intensity,
+                                       const core::Tensor &images,
+                                       const core::Tensor &images_dx,
+                                       const core::Tensor &images_dy,
+                                       const core::Tensor &intrinsics,
+                                       const core::Tensor &extrinsics,
+                                       int image_margin,
+                                       core::Tensor &linear_systems);
+
+void ComputeVertexVisibilityCPU(const core::Tensor &vertices,
+                                const core::Tensor &depth,
+                                const core::Tensor &mask,
+                                const core::Tensor &intrinsic,
+                                const core::Tensor &extrinsic,
+                                float depth_max,
+                                float depth_threshold,
+                                core::Tensor &visible);
+
+void AccumulateVertexIntensityCPU(const core::Tensor &vertices,
+                                  const core::Tensor &indices,
+                                  const core::Tensor &image,
+                                  const core::Tensor &intrinsic,
+                                  const core::Tensor &extrinsic,
+                                  int image_margin,
+                                  core::Tensor &intensity_sums,
+                                  core::Tensor &counts);
+
+void ComputeColorMapRigidLinearSystemsCPU(const core::Tensor &vertices,
+                                          const core::Tensor &indices,
+                                          const core::Tensor &offsets,
+                                          const core::Tensor &proxy_intensity,
+                                          const core::Tensor &images,
+                                          const core::Tensor &images_dx,
+                                          const core::Tensor &images_dy,
+                                          const core::Tensor &intrinsics,
+                                          const core::Tensor &extrinsics,
+                                          int image_margin,
+                                          core::Tensor &linear_systems);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeVertexVisibilityCUDA(const core::Tensor &vertices,
+                                 const core::Tensor &depth,
+                                 const core::Tensor &mask,
+                                 const core::Tensor &intrinsic,
+                                 const core::Tensor &extrinsic,
+                                 float depth_max,
+                                 float depth_threshold,
+                                 core::Tensor &visible);
+
+void AccumulateVertexIntensityCUDA(const core::Tensor &vertices,
+                                   const core::Tensor &indices,
+                                   const core::Tensor &image,
+                                   const core::Tensor &intrinsic,
+                                   const core::Tensor &extrinsic,
+                                   int image_margin,
+                                   core::Tensor &intensity_sums,
+                                   core::Tensor &counts);
+
+void ComputeColorMapRigidLinearSystemsCUDA(
+        const core::Tensor &vertices,
+        const core::Tensor &indices,
+        const core::Tensor &offsets,
+        const core::Tensor &proxy_intensity,
+        const core::Tensor &images,
+        const core::Tensor &images_dx,
+        const core::Tensor &images_dy,
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        int image_margin,
+        core::Tensor &linear_systems);
+#endif
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
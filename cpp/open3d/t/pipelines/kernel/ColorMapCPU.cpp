@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/t/pipelines/kernel/ColorMapImpl.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+void ComputeColorMapRigidLinearSystemsCPU(const core::Tensor &vertices,
+                                          const core::Tensor &indices,
+                                          const core::Tensor &offsets,
+                                          const core::Tensor &proxy_intensity,
+                                          const core::Tensor &images,
+                                          const core::Tensor &images_dx,
+                                          const core::Tensor &images_dy,
+                                          const core::Tensor &intrinsics,
+                                          const core::Tensor &extrinsics,
+                                          int image_margin,
+                                          core::Tensor &linear_systems) {
+    const int64_t n_cameras = images.GetLength();
+    const int64_t rows = images.GetShape(1);
+    const int64_t cols = images.GetShape(2);
+
+    const float *vertices_ptr = vertices.GetDataPtr<float>();
+    const int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+    const int64_t *offsets_ptr = offsets.GetDataPtr<int64_t>();
+    const float *proxy_intensity_ptr = proxy_intensity.GetDataPtr<float>();
+    const float *images_ptr = images.GetDataPtr<float>();
+    const float *images_dx_ptr = images_dx.GetDataPtr<float>();
+    const float *images_dy_ptr = images_dy.GetDataPtr<float>();
+    const float *intrinsics_ptr = intrinsics.GetDataPtr<float>();
+    const float *extrinsics_ptr = extrinsics.GetDataPtr<float>();
+    float *linear_systems_ptr = linear_systems.GetDataPtr<float>();
+
+    // The cameras are reduced in parallel, each in double precision.
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t c = 0; c < n_cameras; ++c) {
+        const int64_t image_offset = c * rows * cols;
+        double A[29] = {0};
+        for (int64_t i = offsets_ptr[c]; i < offsets_ptr[c + 1]; ++i) {
+            float J[6], r;
+            if (!GetColorMapRigidJacobian(
+                        indices_ptr[i], vertices_ptr, proxy_intensity_ptr,
+                        images_ptr + image_offset,
+                        images_dx_ptr + image_offset,
+                        images_dy_ptr + image_offset, rows, cols,
+                        intrinsics_ptr + 9 * c, extrinsics_ptr + 16 * c,
+                        image_margin, J, r)) {
+                continue;
+            }
+            int offset = 0;
+            for (int j = 0; j < 6; ++j) {
+                for (int k = 0; k <= j; ++k) {
+                    A[offset++] += J[j] * J[k];
+                }
+            }
+            for (int j = 0; j < 6; ++j) {
+                A[offset++] += J[j] * r;
+            }
+            A[27] += r * r;
+            A[28] += 1;
+        }
+        for (int j = 0; j < 29; ++j) {
+            linear_systems_ptr[29 * c + j] = float(A[j]);
+        }
+    }
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cuda.h>
+
+#include <algorithm>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/t/pipelines/kernel/ColorMapImpl.h"
+#include "open3d/t/pipelines/kernel/Reduction6x6Impl.cuh"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// Each block row (blockIdx.y) reduces the linear system of a camera, whose
+/// residuals are strided over the threads of the row.
+__global__ void ComputeColorMapRigidLinearSystemsCUDAKernel(
+        const float *vertices_ptr,
+        const int64_t *indices_ptr,
+        const int64_t *offsets_ptr,
+        const float *proxy_intensity_ptr,
+        const float *images_ptr,
+        const float *images_dx_ptr,
+        const float *images_dy_ptr,
+        const float *intrinsics_ptr,
+        const float *extrinsics_ptr,
+        int64_t rows,
+        int64_t cols,
+        int image_margin,
+        float *linear_systems_ptr) {
+    const int kBlockSize = 256;
+    const int tid = threadIdx.x;
+    const int64_t c = blockIdx.y;
+    const int64_t image_offset = c * rows * cols;
+
+    float reduction[21 + 6 + 2] = {0};
+    for (int64_t i = offsets_ptr[c] + blockIdx.x * blockDim.x + threadIdx.x;
+         i < offsets_ptr[c + 1]; i += int64_t(gridDim.x) * blockDim.x) {
+        float J[6], r;
+        if (!GetColorMapRigidJacobian(
+                    indices_ptr[i], vertices_ptr, proxy_intensity_ptr,
+                    images_ptr + image_offset, images_dx_ptr + image_offset,
+                    images_dy_ptr + image_offset, rows, cols,
+                    intrinsics_ptr + 9 * c, extrinsics_ptr + 16 * c,
+                    image_margin, J, r)) {
+            continue;
+        }
+        int offset = 0;
+        for (int j = 0; j < 6; ++j) {
+            for (int k = 0; k <= j; ++k) {
+                reduction[offset++] += J[j] * J[k];
+            }
+        }
+        for (int j = 0; j < 6; ++j) {
+            reduction[offset++] += J[j] * r;
+        }
+        reduction[27] += r * r;
+        reduction[28] += 1;
+    }
+
+    WarpReduceSum6x6LinearSystem<float, kBlockSize>(
+            tid, true, reduction, linear_systems_ptr + 29 * c);
+}
+
+void ComputeColorMapRigidLinearSystemsCUDA(
+        const core::Tensor &vertices,
+        const core::Tensor &indices,
+        const core::Tensor &offsets,
+        const core::Tensor &proxy_intensity,
+        const core::Tensor &images,
+        const core::Tensor &images_dx,
+        const core::Tensor &images_dy,
+        const core::Tensor &intrinsics,
+        const core::Tensor &extrinsics,
+        int image_margin,
+        core::Tensor &linear_systems) {
+    const int64_t n_cameras = images.GetLength();
+    if (n_cameras == 0) {
+        return;
+    }
+
+    // Enough blocks per camera for the camera seeing the most vertices.
+    core::Tensor counts = offsets.Slice(0, 1, n_cameras + 1) -
+                          offsets.Slice(0, 0, n_cameras);
+    const int64_t max_count = counts.Max({0}).Item<int64_t>();
+    const int kBlockSize = 256;
+    const int64_t kMaxBlocksPerCamera = 64;
+    const int64_t blocks_per_camera = std::max<int64_t>(
+            1, std::min((max_count + kBlockSize - 1) / kBlockSize,
+                        kMaxBlocksPerCamera));
+
+    const dim3 blocks(blocks_per_camera, n_cameras);
+    ComputeColorMapRigidLinearSystemsCUDAKernel<<<blocks, kBlockSize>>>(
+            vertices.GetDataPtr<float>(), indices.GetDataPtr<int64_t>(),
+            offsets.GetDataPtr<int64_t>(), proxy_intensity.GetDataPtr<float>(),
+            images.GetDataPtr<float>(), images_dx.GetDataPtr<float>(),
+            images_dy.GetDataPtr<float>(), intrinsics.GetDataPtr<float>(),
+            extrinsics.GetDataPtr<float>(), images.GetShape(1),
+            images.GetShape(2), image_margin,
+            linear_systems.GetDataPtr<float>());
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,219 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/ColorMap.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// Transforms the vertex x by the row-major extrinsic T into g, and projects
+/// it by the row-major intrinsic K to (u, v).
+OPEN3D_HOST_DEVICE inline void TransformAndProject(const float *x,
+                                                   const float *K,
+                                                   const float *T,
+                                                   float *g,
+                                                   float &u,
+                                                   float &v) {
+    for (int i = 0; i < 3; ++i) {
+        g[i] = T[i * 4 + 0] * x[0] + T[i * 4 + 1] * x[1] +
+               T[i * 4 + 2] * x[2] + T[i * 4 + 3];
+    }
+    u = K[0] * g[0] / g[2] + K[2];
+    v = K[4] * g[1] / g[2] + K[5];
+}
+
+/// Whether (u, v) is in the rows x cols image, at least margin away from its
+/// borders. Matches geometry::Image::TestImageBoundary().
+OPEN3D_HOST_DEVICE inline bool IsInImage(
+        float u, float v, int64_t rows, int64_t cols, float margin) {
+    return u >= margin && u < cols - margin && v >= margin &&
+           v < rows - margin;
+}
+
+/// Bilinear interpolation of the rows x cols image at (u, v), 0 outside of
+/// the image. Matches geometry::Image::FloatValueAt().
+OPEN3D_HOST_DEVICE inline float InterpolateImage(
+        const float *image, int64_t rows, int64_t cols, float u, float v) {
+    if (u < 0 || u > cols - 1 || v < 0 || v > rows - 1) {
+        return 0;
+    }
+    int64_t ui = int64_t(u) > cols - 2 ? cols - 2 : int64_t(u);
+    int64_t vi = int64_t(v) > rows - 2 ? rows - 2 : int64_t(v);
+    ui = ui < 0 ? 0 : ui;
+    vi = vi < 0 ? 0 : vi;
+    float pu = u - ui;
+    float pv = v - vi;
+    const float *p = image + vi * cols + ui;
+    return (p[0] * (1 - pv) + p[cols] * pv) * (1 - pu) +
+           (p[1] * (1 - pv) + p[cols + 1] * pv) * pu;
+}
+
+/// Jacobian of the intensity residual of vertex vid in the image of a camera
+/// w.r.t. the camera pose (rotation first), as in the legacy
+/// RunRigidOptimizer().
+OPEN3D_HOST_DEVICE inline bool GetColorMapRigidJacobian(
+        int64_t vid,
+        const float *vertices_ptr,
+        const float *proxy_intensity_ptr,
+        const float *image_ptr,
+        const float *image_dx_ptr,
+        const float *image_dy_ptr,
+        int64_t rows,
+        int64_t cols,
+        const float *K,
+        const float *T,
+        int image_margin,
+        float *J,
+        float &r) {
+    float g[3], u, v;
+    TransformAndProject(vertices_ptr + 3 * vid, K, T, g, u, v);
+    if (!IsInImage(u, v, rows, cols, image_margin)) {
+        return false;
+    }
+    float gray = InterpolateImage(image_ptr, rows, cols, u, v);
+    float dIdx = InterpolateImage(image_dx_ptr, rows, cols, u, v);
+    float dIdy = InterpolateImage(image_dy_ptr, rows, cols, u, v);
+
+    float invz = 1.0f / g[2];
+    float v0 = dIdx * K[0] * invz;
+    float v1 = dIdy * K[4] * invz;
+    float v2 = -(v0 * g[0] + v1 * g[1]) * invz;
+    J[0] = -g[2] * v1 + g[1] * v2;
+    J[1] = g[2] * v0 - g[0] * v2;
+    J[2] = -g[1] * v0 + g[0] * v1;
+    J[3] = v0;
+    J[4] = v1;
+    J[5] = v2;
+    r = gray - proxy_intensity_ptr[vid];
+    return true;
+}
+
+#if defined(__CUDACC__)
+void ComputeVertexVisibilityCUDA
+#else
+void ComputeVertexVisibilityCPU
+#endif
+        (const core::Tensor &vertices,
+         const core::Tensor &depth,
+         const core::Tensor &mask,
+         const core::Tensor &intrinsic,
+         const core::Tensor &extrinsic,
+         float depth_max,
+         float depth_threshold,
+         core::Tensor &visible) {
+    const int64_t n = vertices.GetLength();
+    const int64_t rows = depth.GetShape(0);
+    const int64_t cols = depth.GetShape(1);
+
+    const float *vertices_ptr = vertices.GetDataPtr<float>();
+    const float *depth_ptr = depth.GetDataPtr<float>();
+    const uint8_t *mask_ptr = mask.GetDataPtr<uint8_t>();
+    const float *K = intrinsic.GetDataPtr<float>();
+    const float *T = extrinsic.GetDataPtr<float>();
+    bool *visible_ptr = visible.GetDataPtr<bool>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        visible_ptr[workload_idx] = false;
+        float g[3], u, v;
+        TransformAndProject(vertices_ptr + 3 * workload_idx, K, T, g, u, v);
+        if (!(g[2] > 0)) {
+            return;
+        }
+        int64_t u_d = int64_t(roundf(u));
+        int64_t v_d = int64_t(roundf(v));
+        if (!IsInImage(u_d, v_d, rows, cols, 0)) {
+            return;
+        }
+        // Skip the background, the depth boundaries, where the colors differ
+        // between the views, and the occluded vertices.
+        float d_sensor = depth_ptr[v_d * cols + u_d];
+        if (d_sensor > depth_max || mask_ptr[v_d * cols + u_d] == 255 ||
+            fabsf(g[2] - d_sensor) >= depth_threshold) {
+            return;
+        }
+        visible_ptr[workload_idx] = true;
+    });
+}
+
+#if defined(__CUDACC__)
+void AccumulateVertexIntensityCUDA
+#else
+void AccumulateVertexIntensityCPU
+#endif
+        (const core::Tensor &vertices,
+         const core::Tensor &indices,
+         const core::Tensor &image,
+         const core::Tensor &intrinsic,
+         const core::Tensor &extrinsic,
+         int image_margin,
+         core::Tensor &intensity_sums,
+         core::Tensor &counts) {
+    const int64_t n = indices.GetLength();
+    const int64_t rows = image.GetShape(0);
+    const int64_t cols = image.GetShape(1);
+
+    const float *vertices_ptr = vertices.GetDataPtr<float>();
+    const int64_t *indices_ptr = indices.GetDataPtr<int64_t>();
+    const float *image_ptr = image.GetDataPtr<float>();
+    const float *K = intrinsic.GetDataPtr<float>();
+    const float *T = extrinsic.GetDataPtr<float>();
+    float *intensity_sums_ptr = intensity_sums.GetDataPtr<float>();
+    float *counts_ptr = counts.GetDataPtr<float>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    // The indices are distinct, so the vertices are updated without atomics.
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int64_t vid = indices_ptr[workload_idx];
+        float g[3], u, v;
+        TransformAndProject(vertices_ptr + 3 * vid, K, T, g, u, v);
+        if (!IsInImage(u, v, rows, cols, image_margin)) {
+            return;
+        }
+        intensity_sums_ptr[vid] += image_ptr[int64_t(v) * cols + int64_t(u)];
+        counts_ptr[vid] += 1;
+    });
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -26,13 +26,179 @@
 
 #include "open3d/t/pipelines/kernel/ComputeTransform.h"
 
+#include <cmath>
+
 #include "open3d/t/pipelines/kernel/ComputeTransformImpl.h"
+#include "open3d/t/pipelines/kernel/TransformationConverter.h"
 
 namespace open3d {
 namespace t {
 namespace pipelines {
 namespace kernel {
 
+/// Accumulates the {29} linear system of generalized ICP, see
+/// ComputeLinearSystemGeneralizedICPCPU(). Without \p correspondences_first,
+/// \p correspondences_second holds the target index of every source point.
+static core::Tensor ComputeLinearSystemGeneralizedICP(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &source_normals,
+        const core::Tensor &target_normals,
+        const core::Tensor &correspondences_first,
+        const core::Tensor &correspondences_second,
+        double epsilon) {
+    // Get dtype and device.
+    core::Dtype dtype = core::Dtype::Float32;
+    core::Device device = source_points.GetDevice();
+
+    // Checks.
+    source_points.AssertDtype(dtype);
+    target_points.AssertDtype(dtype);
+    source_normals.AssertDtype(dtype);
+    target_normals.AssertDtype(dtype);
+    target_points.AssertDevice(device);
+    source_normals.AssertDevice(device);
+    target_normals.AssertDevice(device);
+    correspondences_second.AssertDtype(core::Dtype::Int64);
+    correspondences_second.AssertDevice(device);
+    if (epsilon <= 0.0 || epsilon > 1.0) {
+        utility::LogError("epsilon must be in (0, 1], but got {}.", epsilon);
+    }
+
+    core::Tensor source_points_contiguous = source_points.Contiguous();
+    core::Tensor target_points_contiguous = target_points.Contiguous();
+    core::Tensor source_normals_contiguous = source_normals.Contiguous();
+    core::Tensor target_normals_contiguous = target_normals.Contiguous();
+    core::Tensor corres_first_contiguous;
+    core::Tensor corres_second_contiguous = correspondences_second.Contiguous();
+
+    const float *source_points_ptr =
+            source_points_contiguous.GetDataPtr<float>();
+    const float *target_points_ptr =
+            target_points_contiguous.GetDataPtr<float>();
+    const float *source_normals_ptr =
+            source_normals_contiguous.GetDataPtr<float>();
+    const float *target_normals_ptr =
+            target_normals_contiguous.GetDataPtr<float>();
+    const int64_t *corres_first = nullptr;
+    if (correspondences_first.NumElements() > 0) {
+        corres_first_contiguous = correspondences_first.Contiguous();
+        corres_first = corres_first_contiguous.GetDataPtr<int64_t>();
+    }
+    const int64_t *corres_second =
+            corres_second_contiguous.GetDataPtr<int64_t>();
+    int n = static_cast<int>(correspondences_second.NumElements());
+
+    core::Tensor linear_system;
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeLinearSystemGeneralizedICPCPU(
+                source_points_ptr, target_points_ptr, source_normals_ptr,
+                target_normals_ptr, corres_first, corres_second, n,
+                static_cast<float>(epsilon), linear_system, device);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeLinearSystemGeneralizedICPCUDA, source_points_ptr,
+                  target_points_ptr, source_normals_ptr, target_normals_ptr,
+                  corres_first, corres_second, n, static_cast<float>(epsilon),
+                  linear_system, device);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+    return linear_system;
+}
+
+/// Accumulates the {29} linear system of colored ICP, see
+/// ComputeLinearSystemColoredICPCPU(). Without \p correspondences_first,
+/// \p correspondences_second holds the target index of every source point.
+static core::Tensor ComputeLinearSystemColoredICP(
+        const core::Tensor &source_points,
+        const core::Tensor &source_colors,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_colors,
+        const core::Tensor &target_color_gradients,
+        const core::Tensor &correspondences_first,
+        const core::Tensor &correspondences_second,
+        double lambda_geometric) {
+    // Get dtype and device.
+    core::Dtype dtype = core::Dtype::Float32;
+    core::Device device = source_points.GetDevice();
+
+    // Checks.
+    source_points.AssertDtype(dtype);
+    source_colors.AssertDtype(dtype);
+    target_points.AssertDtype(dtype);
+    target_normals.AssertDtype(dtype);
+    target_colors.AssertDtype(dtype);
+    target_color_gradients.AssertDtype(dtype);
+    source_colors.AssertDevice(device);
+    target_points.AssertDevice(device);
+    target_normals.AssertDevice(device);
+    target_colors.AssertDevice(device);
+    target_color_gradients.AssertDevice(device);
+    correspondences_second.AssertDtype(core::Dtype::Int64);
+    correspondences_second.AssertDevice(device);
+    if (lambda_geometric < 0.0 || lambda_geometric > 1.0) {
+        utility::LogError("lambda_geometric must be in [0, 1], but got {}.",
+                          lambda_geometric);
+    }
+    const float sqrt_lambda_geometric =
+            static_cast<float>(std::sqrt(lambda_geometric));
+    const float sqrt_lambda_photometric =
+            static_cast<float>(std::sqrt(1.0 - lambda_geometric));
+
+    core::Tensor source_points_contiguous = source_points.Contiguous();
+    core::Tensor source_colors_contiguous = source_colors.Contiguous();
+    core::Tensor target_points_contiguous = target_points.Contiguous();
+    core::Tensor target_normals_contiguous = target_normals.Contiguous();
+    core::Tensor target_colors_contiguous = target_colors.Contiguous();
+    core::Tensor target_color_gradients_contiguous =
+            target_color_gradients.Contiguous();
+    core::Tensor corres_first_contiguous;
+    core::Tensor corres_second_contiguous = correspondences_second.Contiguous();
+
+    const float *source_points_ptr =
+            source_points_contiguous.GetDataPtr<float>();
+    const float *source_colors_ptr =
+            source_colors_contiguous.GetDataPtr<float>();
+    const float *target_points_ptr =
+            target_points_contiguous.GetDataPtr<float>();
+    const float *target_normals_ptr =
+            target_normals_contiguous.GetDataPtr<float>();
+    const float *target_colors_ptr =
+            target_colors_contiguous.GetDataPtr<float>();
+    const float *target_color_gradients_ptr =
+            target_color_gradients_contiguous.GetDataPtr<float>();
+    const int64_t *corres_first = nullptr;
+    if (correspondences_first.NumElements() > 0) {
+        corres_first_contiguous = correspondences_first.Contiguous();
+        corres_first = corres_first_contiguous.GetDataPtr<int64_t>();
+    }
+    const int64_t *corres_second =
+            corres_second_contiguous.GetDataPtr<int64_t>();
+    int n = static_cast<int>(correspondences_second.NumElements());
+
+    core::Tensor linear_system;
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeLinearSystemColoredICPCPU(
+                source_points_ptr, source_colors_ptr, target_points_ptr,
+                target_normals_ptr, target_colors_ptr,
+                target_color_gradients_ptr, corres_first, corres_second, n,
+                sqrt_lambda_geometric, sqrt_lambda_photometric, linear_system,
+                device);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeLinearSystemColoredICPCUDA, source_points_ptr,
+                  source_colors_ptr, target_points_ptr, target_normals_ptr,
+                  target_colors_ptr, target_color_gradients_ptr, corres_first,
+                  corres_second, n, sqrt_lambda_geometric,
+                  sqrt_lambda_photometric, linear_system, device);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+    return linear_system;
+}
+
 core::Tensor ComputePosePointToPlane(
         const core::Tensor &source_points,
         const core::Tensor &target_points,
@@ -86,6 +252,196 @@ core::Tensor ComputePosePointToPlane(
     return pose;
 }
 
+core::Tensor ComputePosePointToPlane(const core::Tensor &source_points,
+                                     const core::Tensor &target_points,
+                                     const core::Tensor &target_normals,
+                                     const core::Tensor &target_indices) {
+    // Get dtype and device.
+    core::Dtype dtype = core::Dtype::Float32;
+    core::Device device = source_points.GetDevice();
+
+    // Checks.
+    source_points.AssertDtype(dtype);
+    target_points.AssertDtype(dtype);
+    target_normals.AssertDtype(dtype);
+    target_points.AssertDevice(device);
+    target_normals.AssertDevice(device);
+    target_indices.AssertDtype(core::Dtype::Int64);
+    target_indices.AssertDevice(device);
+    if (target_indices.NumElements() != source_points.GetLength()) {
+        utility::LogError(
+                "Expected a target index for each of the {} source points, "
+                "but got {}.",
+                source_points.GetLength(), target_indices.NumElements());
+    }
+
+    // Pose {6,} tensor [ouput].
+    core::Tensor pose = core::Tensor::Empty({6}, core::Dtype::Float64, device);
+    int n = static_cast<int>(source_points.GetLength());
+
+    core::Tensor source_points_contiguous = source_points.Contiguous();
+    core::Tensor target_points_contiguous = target_points.Contiguous();
+    core::Tensor target_normals_contiguous = target_normals.Contiguous();
+    core::Tensor target_indices_contiguous = target_indices.Contiguous();
+
+    const float *source_points_ptr =
+            source_points_contiguous.GetDataPtr<float>();
+    const float *target_points_ptr =
+            target_points_contiguous.GetDataPtr<float>();
+    const float *target_normals_ptr =
+            target_normals_contiguous.GetDataPtr<float>();
+    const int64_t *target_indices_ptr =
+            target_indices_contiguous.GetDataPtr<int64_t>();
+
+    // The source point of each correspondence is its workload index.
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputePosePointToPlaneCPU(source_points_ptr, target_points_ptr,
+                                   target_normals_ptr, nullptr,
+                                   target_indices_ptr, n, pose, dtype, device);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputePosePointToPlaneCUDA, source_points_ptr,
+                  target_points_ptr, target_normals_ptr, nullptr,
+                  target_indices_ptr, n, pose, dtype, device);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+    return pose;
+}
+
+core::Tensor ComputePoseGeneralizedICP(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &source_normals,
+        const core::Tensor &target_normals,
+        const pipelines::registration::CorrespondenceSet &corres,
+        double epsilon) {
+    core::Tensor linear_system = ComputeLinearSystemGeneralizedICP(
+            source_points, target_points, source_normals, target_normals,
+            corres.first, corres.second, epsilon);
+
+    core::Tensor pose = core::Tensor::Empty({6}, core::Dtype::Float64,
+                                            source_points.GetDevice());
+    float residual;
+    int inlier_count;
+    DecodeAndSolve6x6(linear_system, pose, residual, inlier_count);
+    return pose;
+}
+
+core::Tensor ComputePoseGeneralizedICP(const core::Tensor &source_points,
+                                       const core::Tensor &target_points,
+                                       const core::Tensor &source_normals,
+                                       const core::Tensor &target_normals,
+                                       const core::Tensor &target_indices,
+                                       double epsilon) {
+    if (target_indices.NumElements() != source_points.GetLength()) {
+        utility::LogError(
+                "Expected a target index for each of the {} source points, "
+                "but got {}.",
+                source_points.GetLength(), target_indices.NumElements());
+    }
+    core::Tensor linear_system = ComputeLinearSystemGeneralizedICP(
+            source_points, target_points, source_normals, target_normals,
+            core::Tensor(), target_indices, epsilon);
+
+    core::Tensor pose = core::Tensor::Empty({6}, core::Dtype::Float64,
+                                            source_points.GetDevice());
+    float residual;
+    int inlier_count;
+    DecodeAndSolve6x6(linear_system, pose, residual, inlier_count);
+    return pose;
+}
+
+double ComputeRMSEGeneralizedICP(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &source_normals,
+        const core::Tensor &target_normals,
+        const pipelines::registration::CorrespondenceSet &corres,
+        double epsilon) {
+    core::Tensor linear_system =
+            ComputeLinearSystemGeneralizedICP(
+                    source_points, target_points, source_normals,
+                    target_normals, corres.first, corres.second, epsilon)
+                    .To(core::Device("CPU:0"), core::Dtype::Float64);
+    const double *linear_system_ptr = linear_system.GetDataPtr<double>();
+    if (linear_system_ptr[28] == 0) {
+        return 0.0;
+    }
+    return std::sqrt(linear_system_ptr[27] / linear_system_ptr[28]);
+}
+
+core::Tensor ComputePoseColoredICP(
+        const core::Tensor &source_points,
+        const core::Tensor &source_colors,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_colors,
+        const core::Tensor &target_color_gradients,
+        const pipelines::registration::CorrespondenceSet &corres,
+        double lambda_geometric) {
+    core::Tensor linear_system = ComputeLinearSystemColoredICP(
+            source_points, source_colors, target_points, target_normals,
+            target_colors, target_color_gradients, corres.first,
+            corres.second, lambda_geometric);
+
+    core::Tensor pose = core::Tensor::Empty({6}, core::Dtype::Float64,
+                                            source_points.GetDevice());
+    float residual;
+    int inlier_count;
+    DecodeAndSolve6x6(linear_system, pose, residual, inlier_count);
+    return pose;
+}
+
+core::Tensor ComputePoseColoredICP(const core::Tensor &source_points,
+                                   const core::Tensor &source_colors,
+                                   const core::Tensor &target_points,
+                                   const core::Tensor &target_normals,
+                                   const core::Tensor &target_colors,
+                                   const core::Tensor &target_color_gradients,
+                                   const core::Tensor &target_indices,
+                                   double lambda_geometric) {
+    if (target_indices.NumElements() != source_points.GetLength()) {
+        utility::LogError(
+                "Expected a target index for each of the {} source points, "
+                "but got {}.",
+                source_points.GetLength(), target_indices.NumElements());
+    }
+    core::Tensor linear_system = ComputeLinearSystemColoredICP(
+            source_points, source_colors, target_points, target_normals,
+            target_colors, target_color_gradients, core::Tensor(),
+            target_indices, lambda_geometric);
+
+    core::Tensor pose = core::Tensor::Empty({6}, core::Dtype::Float64,
+                                            source_points.GetDevice());
+    float residual;
+    int inlier_count;
+    DecodeAndSolve6x6(linear_system, pose, residual, inlier_count);
+    return pose;
+}
+
+double ComputeRMSEColoredICP(
+        const core::Tensor &source_points,
+        const core::Tensor &source_colors,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_colors,
+        const core::Tensor &target_color_gradients,
+        const pipelines::registration::CorrespondenceSet &corres,
+        double lambda_geometric) {
+    core::Tensor linear_system =
+            ComputeLinearSystemColoredICP(
+                    source_points, source_colors, target_points,
+                    target_normals, target_colors, target_color_gradients,
+                    corres.first, corres.second, lambda_geometric)
+                    .To(core::Device("CPU:0"), core::Dtype::Float64);
+    const double *linear_system_ptr = linear_system.GetDataPtr<double>();
+    if (linear_system_ptr[28] == 0) {
+        return 0.0;
+    }
+    return std::sqrt(linear_system_ptr[27] / linear_system_ptr[28]);
+}
+
 std::tuple<core::Tensor, core::Tensor> ComputeRtPointToPoint(
         const core::Tensor &source_points,
         const core::Tensor &target_points,
@@ -48,6 +48,115 @@ core::Tensor ComputePosePointToPlane(
         const core::Tensor &target_normals,
         const pipelines::registration::CorrespondenceSet &correspondences);
 
+/// \brief Computes pose for point to plane registration method from the
+/// nearest neighbor search result of every source point, without gathering
+/// the valid correspondences first.
+/// \param source_points source points.
+/// \param target_points target points.
+/// \param target_normals target normals.
+/// \param target_indices Index of the target point corresponding to each
+/// source point, or -1 if it has none. A shape {N} tensor of dtype Int64.
+/// \return Pose [alpha beta gamma, tx, ty, tz], a shape {6} tensor of dtype
+/// Float32, where alpha, beta, gamma are the Euler angles in the ZYX order.
+core::Tensor ComputePosePointToPlane(const core::Tensor &source_points,
+                                     const core::Tensor &target_points,
+                                     const core::Tensor &target_normals,
+                                     const core::Tensor &target_indices);
+
+/// \brief Computes pose for generalized ICP registration method, minimizing
+/// the Mahalanobis distances of the correspondences under the plane
+/// regularized covariances I - (1 - epsilon) n n^T of the source and target
+/// points with normals n.
+/// \param source_points source points.
+/// \param target_points target points.
+/// \param source_normals source normals.
+/// \param target_normals target normals.
+/// \param correspondences CorrespondenceSet. [refer to definition in
+/// `/cpp/open3d/t/pipelines/registration/TransformationEstimation.h`].
+/// \param epsilon Covariance of a point along its normal, relative to the
+/// tangent directions.
+/// \return Pose [alpha beta gamma, tx, ty, tz], a shape {6} tensor of dtype
+/// Float64, where alpha, beta, gamma are the Euler angles in the ZYX order.
+core::Tensor ComputePoseGeneralizedICP(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &source_normals,
+        const core::Tensor &target_normals,
+        const pipelines::registration::CorrespondenceSet &correspondences,
+        double epsilon);
+
+/// \brief Computes pose for generalized ICP registration method from the
+/// target index of every source point, -1 if it has none, like
+/// ComputePosePointToPlane().
+core::Tensor ComputePoseGeneralizedICP(const core::Tensor &source_points,
+                                       const core::Tensor &target_points,
+                                       const core::Tensor &source_normals,
+                                       const core::Tensor &target_normals,
+                                       const core::Tensor &target_indices,
+                                       double epsilon);
+
+/// \brief Computes the RMSE of the Mahalanobis distances of the
+/// correspondences minimized by ComputePoseGeneralizedICP().
+double ComputeRMSEGeneralizedICP(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &source_normals,
+        const core::Tensor &target_normals,
+        const pipelines::registration::CorrespondenceSet &correspondences,
+        double epsilon);
+
+/// \brief Computes pose for colored ICP registration method, minimizing the
+/// weighted sum of the point to plane distances and of the differences
+/// between the source intensities and the target intensities extrapolated
+/// along their gradients, like the legacy ColoredICP. The intensity of a
+/// point is the mean of its color channels.
+/// \param source_points source points.
+/// \param source_colors source colors.
+/// \param target_points target points.
+/// \param target_normals target normals.
+/// \param target_colors target colors.
+/// \param target_color_gradients Gradients of the target intensities, see
+/// t::geometry::PointCloud::EstimateColorGradients().
+/// \param correspondences CorrespondenceSet. [refer to definition in
+/// `/cpp/open3d/t/pipelines/registration/TransformationEstimation.h`].
+/// \param lambda_geometric Weight of the geometric term in [0, 1], the
+/// photometric term is weighted by 1 - lambda_geometric.
+/// \return Pose [alpha beta gamma, tx, ty, tz], a shape {6} tensor of dtype
+/// Float64, where alpha, beta, gamma are the Euler angles in the ZYX order.
+core::Tensor ComputePoseColoredICP(
+        const core::Tensor &source_points,
+        const core::Tensor &source_colors,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_colors,
+        const core::Tensor &target_color_gradients,
+        const pipelines::registration::CorrespondenceSet &correspondences,
+        double lambda_geometric);
+
+/// \brief Computes pose for colored ICP registration method from the target
+/// index of every source point, -1 if it has none, like
+/// ComputePosePointToPlane().
+core::Tensor ComputePoseColoredICP(const core::Tensor &source_points,
+                                   const core::Tensor &source_colors,
+                                   const core::Tensor &target_points,
+                                   const core::Tensor &target_normals,
+                                   const core::Tensor &target_colors,
+                                   const core::Tensor &target_color_gradients,
+                                   const core::Tensor &target_indices,
+                                   double lambda_geometric);
+
+/// \brief Computes the RMSE of the weighted residuals of the correspondences
+/// minimized by ComputePoseColoredICP().
+double ComputeRMSEColoredICP(
+        const core::Tensor &source_points,
+        const core::Tensor &source_colors,
+        const core::Tensor &target_points,
+        const core::Tensor &target_normals,
+        const core::Tensor &target_colors,
+        const core::Tensor &target_color_gradients,
+        const pipelines::registration::CorrespondenceSet &correspondences,
+        double lambda_geometric);
+
 /// \brief Computes (R) Rotation {3,3} and (t) translation {3,}
 /// for point to point registration method.
 /// \param source_points source points indexed according to correspondences.
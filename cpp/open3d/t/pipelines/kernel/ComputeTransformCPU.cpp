@@ -115,6 +115,144 @@ void ComputePosePointToPlaneCPU(const float *source_points_ptr,
     DecodeAndSolve6x6(A_reduction_tensor, pose, residual, inlier_count);
 }
 
+void ComputeLinearSystemGeneralizedICPCPU(const float *source_points_ptr,
+                                          const float *target_points_ptr,
+                                          const float *source_normals_ptr,
+                                          const float *target_normals_ptr,
+                                          const int64_t *correspondences_first,
+                                          const int64_t *correspondences_second,
+                                          const int n,
+                                          const float epsilon,
+                                          core::Tensor &linear_system,
+                                          const core::Device &device) {
+    // Same layout as ComputePosePointToPlaneCPU, with three whitened rows per
+    // correspondence.
+    std::vector<float> A_1x29(29, 0.0);
+
+#ifdef _WIN32
+    std::vector<float> zeros_29(29, 0.0);
+    A_1x29 = tbb::parallel_reduce(
+            tbb::blocked_range<int>(0, n), zeros_29,
+            [&](tbb::blocked_range<int> r, std::vector<float> A_reduction) {
+                for (int workload_idx = r.begin(); workload_idx < r.end();
+                     workload_idx++) {
+#else
+    float *A_reduction = A_1x29.data();
+#pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static)
+    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
+#endif
+                    float J[18] = {0};
+                    float r[3] = {0};
+
+                    bool valid = GetJacobianGeneralizedICP(
+                            workload_idx, source_points_ptr, target_points_ptr,
+                            source_normals_ptr, target_normals_ptr,
+                            correspondences_first, correspondences_second,
+                            epsilon, J, r);
+
+                    if (valid) {
+                        for (int row = 0; row < 3; row++) {
+                            const float *J_row = J + 6 * row;
+                            for (int i = 0, j = 0; j < 6; j++) {
+                                for (int k = 0; k <= j; k++) {
+                                    A_reduction[i] += J_row[j] * J_row[k];
+                                    i++;
+                                }
+                                A_reduction[21 + j] += J_row[j] * r[row];
+                            }
+                            A_reduction[27] += r[row] * r[row];
+                        }
+                        A_reduction[28] += 1;
+                    }
+                }
+#ifdef _WIN32
+                return A_reduction;
+            },
+            // TBB: Defining reduction operation.
+            [&](std::vector<float> a, std::vector<float> b) {
+                std::vector<float> result(29);
+                for (int j = 0; j < 29; j++) {
+                    result[j] = a[j] + b[j];
+                }
+                return result;
+            });
+#endif
+
+    linear_system = core::Tensor(A_1x29, {29}, core::Dtype::Float32, device);
+}
+
+void ComputeLinearSystemColoredICPCPU(
+        const float *source_points_ptr,
+        const float *source_colors_ptr,
+        const float *target_points_ptr,
+        const float *target_normals_ptr,
+        const float *target_colors_ptr,
+        const float *target_color_gradients_ptr,
+        const int64_t *correspondences_first,
+        const int64_t *correspondences_second,
+        const int n,
+        const float sqrt_lambda_geometric,
+        const float sqrt_lambda_photometric,
+        core::Tensor &linear_system,
+        const core::Device &device) {
+    // Same layout as ComputePosePointToPlaneCPU, with a geometric and a
+    // photometric row per correspondence.
+    std::vector<float> A_1x29(29, 0.0);
+
+#ifdef _WIN32
+    std::vector<float> zeros_29(29, 0.0);
+    A_1x29 = tbb::parallel_reduce(
+            tbb::blocked_range<int>(0, n), zeros_29,
+            [&](tbb::blocked_range<int> r, std::vector<float> A_reduction) {
+                for (int workload_idx = r.begin(); workload_idx < r.end();
+                     workload_idx++) {
+#else
+    float *A_reduction = A_1x29.data();
+#pragma omp parallel for reduction(+ : A_reduction[:29]) schedule(static)
+    for (int workload_idx = 0; workload_idx < n; workload_idx++) {
+#endif
+                    float J[12] = {0};
+                    float r[2] = {0};
+
+                    bool valid = GetJacobianColoredICP(
+                            workload_idx, source_points_ptr, source_colors_ptr,
+                            target_points_ptr, target_normals_ptr,
+                            target_colors_ptr, target_color_gradients_ptr,
+                            correspondences_first, correspondences_second,
+                            sqrt_lambda_geometric, sqrt_lambda_photometric, J,
+                            r);
+
+                    if (valid) {
+                        for (int row = 0; row < 2; row++) {
+                            const float *J_row = J + 6 * row;
+                            for (int i = 0, j = 0; j < 6; j++) {
+                                for (int k = 0; k <= j; k++) {
+                                    A_reduction[i] += J_row[j] * J_row[k];
+                                    i++;
+                                }
+                                A_reduction[21 + j] += J_row[j] * r[row];
+                            }
+                            A_reduction[27] += r[row] * r[row];
+                        }
+                        A_reduction[28] += 1;
+                    }
+                }
+#ifdef _WIN32
+                return A_reduction;
+            },
+            // TBB: Defining reduction operation.
+            [&](std::vector<float> a, std::vector<float> b) {
+                std::vector<float> result(29);
+                for (int j = 0; j < 29; j++) {
+                    result[j] = a[j] + b[j];
+                }
+                return result;
+            });
+#endif
+
+    linear_system = core::Tensor(A_1x29, {29}, core::Dtype::Float32, device);
+}
+
 void ComputeRtPointToPointCPU(const float *source_points_ptr,
                               const float *target_points_ptr,
                               const int64_t *correspondences_first,
@@ -60,12 +60,13 @@ __global__ void ComputePosePointToPlaneCUDAKernel(
 
     const int workload_idx = threadIdx.x + blockIdx.x * blockDim.x;
 
-    if (workload_idx >= n) return;
-
     float J[6] = {0}, reduction[21 + 6 + 2];
     float r = 0;
 
-    bool valid = GetJacobianPointToPlane(workload_idx, source_points_ptr,
+    // Threads past the end take part in the block reduction without a
+    // contribution.
+    bool valid = workload_idx < n &&
+                 GetJacobianPointToPlane(workload_idx, source_points_ptr,
                                          target_points_ptr, target_normals_ptr,
                                          correspondences_first,
                                          correspondences_second, J, r);
@@ -116,6 +117,174 @@ void ComputePosePointToPlaneCUDA(const float *source_points_ptr,
     DecodeAndSolve6x6(global_sum, pose, residual, inlier_count);
 }
 
+__global__ void ComputeLinearSystemGeneralizedICPCUDAKernel(
+        const float *source_points_ptr,
+        const float *target_points_ptr,
+        const float *source_normals_ptr,
+        const float *target_normals_ptr,
+        const int64_t *correspondences_first,
+        const int64_t *correspondences_second,
+        const int n,
+        const float epsilon,
+        float *global_sum) {
+    __shared__ float local_sum0[kThread1DUnit];
+    __shared__ float local_sum1[kThread1DUnit];
+    __shared__ float local_sum2[kThread1DUnit];
+
+    const int tid = threadIdx.x;
+
+    local_sum0[tid] = 0;
+    local_sum1[tid] = 0;
+    local_sum2[tid] = 0;
+
+    const int workload_idx = threadIdx.x + blockIdx.x * blockDim.x;
+
+    float J[18] = {0}, r[3] = {0}, reduction[21 + 6 + 2] = {0};
+
+    bool valid = workload_idx < n &&
+                 GetJacobianGeneralizedICP(
+                         workload_idx, source_points_ptr, target_points_ptr,
+                         source_normals_ptr, target_normals_ptr,
+                         correspondences_first, correspondences_second,
+                         epsilon, J, r);
+
+    // Dump the three rows of J, r into JtJ and Jtr.
+    for (int row = 0; row < 3; ++row) {
+        const float *J_row = J + 6 * row;
+        int offset = 0;
+        for (int i = 0; i < 6; ++i) {
+            for (int j = 0; j <= i; ++j) {
+                reduction[offset++] += J_row[i] * J_row[j];
+            }
+        }
+        for (int i = 0; i < 6; ++i) {
+            reduction[offset++] += J_row[i] * r[row];
+        }
+        reduction[offset] += r[row] * r[row];
+    }
+    reduction[28] = valid;
+
+    ReduceSum6x6LinearSystem<float, kThread1DUnit>(tid, valid, reduction,
+                                                   local_sum0, local_sum1,
+                                                   local_sum2, global_sum);
+}
+
+void ComputeLinearSystemGeneralizedICPCUDA(
+        const float *source_points_ptr,
+        const float *target_points_ptr,
+        const float *source_normals_ptr,
+        const float *target_normals_ptr,
+        const int64_t *correspondences_first,
+        const int64_t *correspondences_second,
+        const int n,
+        const float epsilon,
+        core::Tensor &linear_system,
+        const core::Device &device) {
+    linear_system = core::Tensor::Zeros({29}, core::Dtype::Float32, device);
+    if (n == 0) {
+        return;
+    }
+    float *global_sum_ptr = linear_system.GetDataPtr<float>();
+
+    const dim3 blocks((n + kThread1DUnit - 1) / kThread1DUnit);
+    const dim3 threads(kThread1DUnit);
+
+    ComputeLinearSystemGeneralizedICPCUDAKernel<<<blocks, threads>>>(
+            source_points_ptr, target_points_ptr, source_normals_ptr,
+            target_normals_ptr, correspondences_first, correspondences_second,
+            n, epsilon, global_sum_ptr);
+
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+}
+
+__global__ void ComputeLinearSystemColoredICPCUDAKernel(
+        const float *source_points_ptr,
+        const float *source_colors_ptr,
+        const float *target_points_ptr,
+        const float *target_normals_ptr,
+        const float *target_colors_ptr,
+        const float *target_color_gradients_ptr,
+        const int64_t *correspondences_first,
+        const int64_t *correspondences_second,
+        const int n,
+        const float sqrt_lambda_geometric,
+        const float sqrt_lambda_photometric,
+        float *global_sum) {
+    __shared__ float local_sum0[kThread1DUnit];
+    __shared__ float local_sum1[kThread1DUnit];
+    __shared__ float local_sum2[kThread1DUnit];
+
+    const int tid = threadIdx.x;
+
+    local_sum0[tid] = 0;
+    local_sum1[tid] = 0;
+    local_sum2[tid] = 0;
+
+    const int workload_idx = threadIdx.x + blockIdx.x * blockDim.x;
+
+    float J[12] = {0}, r[2] = {0}, reduction[21 + 6 + 2] = {0};
+
+    bool valid = workload_idx < n &&
+                 GetJacobianColoredICP(
+                         workload_idx, source_points_ptr, source_colors_ptr,
+                         target_points_ptr, target_normals_ptr,
+                         target_colors_ptr, target_color_gradients_ptr,
+                         correspondences_first, correspondences_second,
+                         sqrt_lambda_geometric, sqrt_lambda_photometric, J, r);
+
+    // Dump the geometric and photometric rows of J, r into JtJ and Jtr.
+    for (int row = 0; row < 2; ++row) {
+        const float *J_row = J + 6 * row;
+        int offset = 0;
+        for (int i = 0; i < 6; ++i) {
+            for (int j = 0; j <= i; ++j) {
+                reduction[offset++] += J_row[i] * J_row[j];
+            }
+        }
+        for (int i = 0; i < 6; ++i) {
+            reduction[offset++] += J_row[i] * r[row];
+        }
+        reduction[offset] += r[row] * r[row];
+    }
+    reduction[28] = valid;
+
+    ReduceSum6x6LinearSystem<float, kThread1DUnit>(tid, valid, reduction,
+                                                   local_sum0, local_sum1,
+                                                   local_sum2, global_sum);
+}
+
+void ComputeLinearSystemColoredICPCUDA(
+        const float *source_points_ptr,
+        const float *source_colors_ptr,
+        const float *target_points_ptr,
+        const float *target_normals_ptr,
+        const float *target_colors_ptr,
+        const float *target_color_gradients_ptr,
+        const int64_t *correspondences_first,
+        const int64_t *correspondences_second,
+        const int n,
+        const float sqrt_lambda_geometric,
+        const float sqrt_lambda_photometric,
+        core::Tensor &linear_system,
+        const core::Device &device) {
+    linear_system = core::Tensor::Zeros({29}, core::Dtype::Float32, device);
+    if (n == 0) {
+        return;
+    }
+    float *global_sum_ptr = linear_system.GetDataPtr<float>();
+
+    const dim3 blocks((n + kThread1DUnit - 1) / kThread1DUnit);
+    const dim3 threads(kThread1DUnit);
+
+    ComputeLinearSystemColoredICPCUDAKernel<<<blocks, threads>>>(
+            source_points_ptr, source_colors_ptr, target_points_ptr,
+            target_normals_ptr, target_colors_ptr, target_color_gradients_ptr,
+            correspondences_first, correspondences_second, n,
+            sqrt_lambda_geometric, sqrt_lambda_photometric, global_sum_ptr);
+
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+}
+
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
@@ -28,6 +28,8 @@
 
 #pragma once
 
+#include <cmath>
+
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Tensor.h"
 
@@ -58,6 +60,63 @@ void ComputePosePointToPlaneCUDA(const float *source_points_ptr,
                                  const core::Device &device);
 #endif
 
+void ComputeLinearSystemGeneralizedICPCPU(const float *source_points_ptr,
+                                          const float *target_points_ptr,
+                                          const float *source_normals_ptr,
+                                          const float *target_normals_ptr,
+                                          const int64_t *correspondences_first,
+                                          const int64_t *correspondences_second,
+                                          const int n,
+                                          const float epsilon,
+                                          core::Tensor &linear_system,
+                                          const core::Device &device);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeLinearSystemGeneralizedICPCUDA(
+        const float *source_points_ptr,
+        const float *target_points_ptr,
+        const float *source_normals_ptr,
+        const float *target_normals_ptr,
+        const int64_t *correspondences_first,
+        const int64_t *correspondences_second,
+        const int n,
+        const float epsilon,
+        core::Tensor &linear_system,
+        const core::Device &device);
+#endif
+
+void ComputeLinearSystemColoredICPCPU(
+        const float *source_points_ptr,
+        const float *source_colors_ptr,
+        const float *target_points_ptr,
+        const float *target_normals_ptr,
+        const float *target_colors_ptr,
+        const float *target_color_gradients_ptr,
+        const int64_t *correspondences_first,
+        const int64_t *correspondences_second,
+        const int n,
+        const float sqrt_lambda_geometric,
+        const float sqrt_lambda_photometric,
+        core::Tensor &linear_system,
+        const core::Device &device);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeLinearSystemColoredICPCUDA(
+        const float *source_points_ptr,
+        const float *source_colors_ptr,
+        const float *target_points_ptr,
+        const float *target_normals_ptr,
+        const float *target_colors_ptr,
+        const float *target_color_gradients_ptr,
+        const int64_t *correspondences_first,
+        const int64_t *correspondences_second,
+        const int n,
+        const float sqrt_lambda_geometric,
+        const float sqrt_lambda_photometric,
+        core::Tensor &linear_system,
+        const core::Device &device);
+#endif
+
 void ComputeRtPointToPointCPU(const float *source_points_ptr,
                               const float *target_points_ptr,
                               const int64_t *correspondences_first,
@@ -68,6 +127,10 @@ void ComputeRtPointToPointCPU(const float *source_points_ptr,
                               const core::Dtype dtype,
                               const core::Device device);
 
+/// Computes the Jacobian and the residual of correspondence \p workload_idx,
+/// source point correspondence_first[workload_idx] (or workload_idx if
+/// correspondence_first is null) and target point
+/// correspondence_second[workload_idx]. Returns false if the latter is -1.
 OPEN3D_HOST_DEVICE inline bool GetJacobianPointToPlane(
         int64_t workload_idx,
         const float *source_points_ptr,
@@ -77,14 +140,16 @@ OPEN3D_HOST_DEVICE inline bool GetJacobianPointToPlane(
         const int64_t *correspondence_second,
         float *J_ij,
         float &r) {
-    // TODO (@rishabh): Pass correspondence without eliminating -1
-    // in registration::GetRegistationResultAndCorrespondences,
-    // and directly check if valid (index != -1) here.
-    // In that case, only use correspondence_second as index for
-    // target, and workload_idx as index for source pointcloud.
-
-    const int64_t source_idx = 3 * correspondence_first[workload_idx];
-    const int64_t target_idx = 3 * correspondence_second[workload_idx];
+    // Without correspondence_first, the correspondences are given for every
+    // source point, and -1 marks the points without correspondence.
+    const int64_t target_index = correspondence_second[workload_idx];
+    if (target_index == -1) {
+        return false;
+    }
+    const int64_t source_idx =
+            3 * (correspondence_first ? correspondence_first[workload_idx]
+                                      : workload_idx);
+    const int64_t target_idx = 3 * target_index;
 
     const float &sx = source_points_ptr[source_idx + 0];
     const float &sy = source_points_ptr[source_idx + 1];
@@ -107,6 +172,151 @@ OPEN3D_HOST_DEVICE inline bool GetJacobianPointToPlane(
     return true;
 }
 
+/// Computes the three rows of the Jacobian J_ij {3, 6} (row major) and of the
+/// residual r {3} of correspondence \p workload_idx for generalized ICP, like
+/// GetJacobianPointToPlane(). The covariance of a point with normal n is
+/// regularized to the plane covariance I - (1 - epsilon) n n^T, and the rows
+/// are whitened by the Cholesky factor L of the sum C = L L^T of the source
+/// and target covariances, so that J^T J and J^T r are the terms of the
+/// Mahalanobis distance r^T C^-1 r.
+OPEN3D_HOST_DEVICE inline bool GetJacobianGeneralizedICP(
+        int64_t workload_idx,
+        const float *source_points_ptr,
+        const float *target_points_ptr,
+        const float *source_normals_ptr,
+        const float *target_normals_ptr,
+        const int64_t *correspondence_first,
+        const int64_t *correspondence_second,
+        const float epsilon,
+        float *J_ij,
+        float *r) {
+    const int64_t target_index = correspondence_second[workload_idx];
+    if (target_index == -1) {
+        return false;
+    }
+    const int64_t source_idx =
+            3 * (correspondence_first ? correspondence_first[workload_idx]
+                                      : workload_idx);
+    const int64_t target_idx = 3 * target_index;
+
+    const float *s = source_points_ptr + source_idx;
+    const float *t = target_points_ptr + target_idx;
+    const float *ns = source_normals_ptr + source_idx;
+    const float *nt = target_normals_ptr + target_idx;
+
+    // Sum of the regularized covariances.
+    const float w = 1 - epsilon;
+    float C[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            C[i][j] = (i == j ? 2.0f : 0.0f) -
+                      w * (ns[i] * ns[j] + nt[i] * nt[j]);
+        }
+    }
+
+    // Cholesky factorization C = L L^T.
+    const float L00 = sqrt(C[0][0]);
+    const float L10 = C[1][0] / L00;
+    const float L20 = C[2][0] / L00;
+    const float L11 = sqrt(C[1][1] - L10 * L10);
+    const float L21 = (C[2][1] - L20 * L10) / L11;
+    const float L22 = sqrt(C[2][2] - L20 * L20 - L21 * L21);
+
+    // Unwhitened residual s - t and Jacobian [-[s]x | I] of the update.
+    float J[3][7] = {{0, s[2], -s[1], 1, 0, 0, s[0] - t[0]},
+                     {-s[2], 0, s[0], 0, 1, 0, s[1] - t[1]},
+                     {s[1], -s[0], 0, 0, 0, 1, s[2] - t[2]}};
+
+    // Whitening by forward substitution of L, column by column.
+    for (int k = 0; k < 7; ++k) {
+        const float y0 = J[0][k] / L00;
+        const float y1 = (J[1][k] - L10 * y0) / L11;
+        const float y2 = (J[2][k] - L20 * y0 - L21 * y1) / L22;
+        if (k < 6) {
+            J_ij[k] = y0;
+            J_ij[6 + k] = y1;
+            J_ij[12 + k] = y2;
+        } else {
+            r[0] = y0;
+            r[1] = y1;
+            r[2] = y2;
+        }
+    }
+    return true;
+}
+
+/// Computes the two rows of the Jacobian J_ij {2, 6} (row major) and of the
+/// residual r {2} of correspondence \p workload_idx for colored ICP, like
+/// GetJacobianPointToPlane(). The first row is the point to plane term, the
+/// second one the difference between the source intensity and the target
+/// intensity extrapolated by its gradient to the projection of the source
+/// point on the target tangent plane, as in the legacy ColoredICP. The rows
+/// are weighted by the square roots of the term weights.
+OPEN3D_HOST_DEVICE inline bool GetJacobianColoredICP(
+        int64_t workload_idx,
+        const float *source_points_ptr,
+        const float *source_colors_ptr,
+        const float *target_points_ptr,
+        const float *target_normals_ptr,
+        const float *target_colors_ptr,
+        const float *target_color_gradients_ptr,
+        const int64_t *correspondence_first,
+        const int64_t *correspondence_second,
+        const float sqrt_lambda_geometric,
+        const float sqrt_lambda_photometric,
+        float *J_ij,
+        float *r) {
+    const int64_t target_index = correspondence_second[workload_idx];
+    if (target_index == -1) {
+        return false;
+    }
+    const int64_t source_idx =
+            3 * (correspondence_first ? correspondence_first[workload_idx]
+                                      : workload_idx);
+    const int64_t target_idx = 3 * target_index;
+
+    const float *vs = source_points_ptr + source_idx;
+    const float *cs = source_colors_ptr + source_idx;
+    const float *vt = target_points_ptr + target_idx;
+    const float *nt = target_normals_ptr + target_idx;
+    const float *ct = target_colors_ptr + target_idx;
+    const float *dit = target_color_gradients_ptr + target_idx;
+
+    const float is = (cs[0] + cs[1] + cs[2]) / 3.0f;
+    const float it = (ct[0] + ct[1] + ct[2]) / 3.0f;
+
+    // Geometric term.
+    const float d = (vs[0] - vt[0]) * nt[0] + (vs[1] - vt[1]) * nt[1] +
+                    (vs[2] - vt[2]) * nt[2];
+    J_ij[0] = sqrt_lambda_geometric * (nt[2] * vs[1] - nt[1] * vs[2]);
+    J_ij[1] = sqrt_lambda_geometric * (nt[0] * vs[2] - nt[2] * vs[0]);
+    J_ij[2] = sqrt_lambda_geometric * (nt[1] * vs[0] - nt[0] * vs[1]);
+    J_ij[3] = sqrt_lambda_geometric * nt[0];
+    J_ij[4] = sqrt_lambda_geometric * nt[1];
+    J_ij[5] = sqrt_lambda_geometric * nt[2];
+    r[0] = sqrt_lambda_geometric * d;
+
+    // Photometric term, with the gradient restricted to the tangent plane:
+    // ditM = -(I - nt nt^T) dit.
+    const float vs_proj[3] = {vs[0] - d * nt[0], vs[1] - d * nt[1],
+                              vs[2] - d * nt[2]};
+    const float is0_proj = dit[0] * (vs_proj[0] - vt[0]) +
+                           dit[1] * (vs_proj[1] - vt[1]) +
+                           dit[2] * (vs_proj[2] - vt[2]) + it;
+    const float dit_n = dit[0] * nt[0] + dit[1] * nt[1] + dit[2] * nt[2];
+    const float ditM[3] = {dit_n * nt[0] - dit[0], dit_n * nt[1] - dit[1],
+                           dit_n * nt[2] - dit[2]};
+    J_ij[6] = sqrt_lambda_photometric * (ditM[2] * vs[1] - ditM[1] * vs[2]);
+    J_ij[7] = sqrt_lambda_photometric * (ditM[0] * vs[2] - ditM[2] * vs[0]);
+    J_ij[8] = sqrt_lambda_photometric * (ditM[1] * vs[0] - ditM[0] * vs[1]);
+    J_ij[9] = sqrt_lambda_photometric * ditM[0];
+    J_ij[10] = sqrt_lambda_photometric * ditM[1];
+    J_ij[11] = sqrt_lambda_photometric * ditM[2];
+    r[1] = sqrt_lambda_photometric * (is - is0_proj);
+
+    return true;
+}
+
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
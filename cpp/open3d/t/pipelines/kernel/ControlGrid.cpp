@@ -0,0 +1,147 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/ControlGrid.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+void ParameterizeControlGrid(std::shared_ptr<core::DeviceHashmap> &hashmap,
+                             const core::Tensor &points,
+                             const core::Tensor &normals,
+                             core::Tensor &nb_indices,
+                             core::Tensor &nb_point_ratios,
+                             core::Tensor &nb_normal_ratios,
+                             core::Tensor &mask,
+                             float grid_size) {
+    points.AssertDtype(core::Dtype::Float32);
+    if (normals.NumElements() > 0) {
+        normals.AssertDtype(core::Dtype::Float32);
+        normals.AssertShape(points.GetShape());
+    }
+
+    core::Device device = points.GetDevice();
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ParameterizeControlGridCPU(hashmap, points, normals, nb_indices,
+                                   nb_point_ratios, nb_normal_ratios, mask,
+                                   grid_size);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ParameterizeControlGridCUDA(hashmap, points, normals, nb_indices,
+                                    nb_point_ratios, nb_normal_ratios, mask,
+                                    grid_size);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void InterpolateControlGrid(const core::Tensor &grid_positions,
+                            const core::Tensor &nb_indices,
+                            const core::Tensor &nb_point_ratios,
+                            const core::Tensor &nb_normal_ratios,
+                            core::Tensor &deformed_points,
+                            core::Tensor &deformed_normals) {
+    grid_positions.AssertDtype(core::Dtype::Float32);
+    nb_indices.AssertDtype(core::Dtype::Int32);
+    nb_point_ratios.AssertDtype(core::Dtype::Float32);
+    nb_point_ratios.AssertShape(nb_indices.GetShape());
+    if (nb_normal_ratios.NumElements() > 0) {
+        nb_normal_ratios.AssertDtype(core::Dtype::Float32);
+        nb_normal_ratios.AssertShape(nb_indices.GetShape());
+    }
+
+    core::Device device = grid_positions.GetDevice();
+    if (nb_indices.GetDevice() != device) {
+        utility::LogError(
+                "Neighbor indices should have the same device as the grid.");
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        InterpolateControlGridCPU(grid_positions, nb_indices, nb_point_ratios,
+                                  nb_normal_ratios, deformed_points,
+                                  deformed_normals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        InterpolateControlGridCUDA(grid_positions, nb_indices, nb_point_ratios,
+                                   nb_normal_ratios, deformed_points,
+                                   deformed_normals);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void DeformControlGrid(std::shared_ptr<core::DeviceHashmap> &hashmap,
+                       const core::Tensor &grid_positions,
+                       const core::Tensor &points,
+                       const core::Tensor &normals,
+                       core::Tensor &deformed_points,
+                       core::Tensor &deformed_normals,
+                       core::Tensor &mask,
+                       float grid_size) {
+    grid_positions.AssertDtype(core::Dtype::Float32);
+    points.AssertDtype(core::Dtype::Float32);
+    if (normals.NumElements() > 0) {
+        normals.AssertDtype(core::Dtype::Float32);
+        normals.AssertShape(points.GetShape());
+    }
+
+    core::Device device = points.GetDevice();
+    if (grid_positions.GetDevice() != device) {
+        utility::LogError("Points should have the same device as the grid.");
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        DeformControlGridCPU(hashmap, grid_positions, points, normals,
+                             deformed_points, deformed_normals, mask,
+                             grid_size);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        DeformControlGridCUDA(hashmap, grid_positions, points, normals,
+                              deformed_points, deformed_normals, mask,
+                              grid_size);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/DeviceHashmap.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// Kernels of the SLAC control grid. The grid is a hashmap from Int32 {3}
+/// grid coordinates to the Float32 {3} positions in grid_positions, the value
+/// tensor of the hashmap. A point p lies in the cell of the 8 grid points
+/// floor(p / grid_size) + {0, 1}^3, ordered by the bits (x << 2 | y << 1 | z).
+/// Points whose 8 neighbors are not all in the grid are invalid.
+
+/// Looks up the 8 neighbors of each of the {N, 3} points and writes their
+/// {N, 8} Int32 indices in grid_positions, the trilinear interpolation ratios
+/// of the points and, if normals is not empty, of the normals. mask is {N}
+/// Bool and false for invalid points.
+void ParameterizeControlGrid(std::shared_ptr<core::DeviceHashmap> &hashmap,
+                             const core::Tensor &points,
+                             const core::Tensor &normals,
+                             core::Tensor &nb_indices,
+                             core::Tensor &nb_point_ratios,
+                             core::Tensor &nb_normal_ratios,
+                             core::Tensor &mask,
+                             float grid_size);
+
+/// Interpolates the deformed points and, if nb_normal_ratios is not empty,
+/// the normalized deformed normals from the parameterization computed by
+/// ParameterizeControlGrid.
+void InterpolateControlGrid(const core::Tensor &grid_positions,
+                            const core::Tensor &nb_indices,
+                            const core::Tensor &nb_point_ratios,
+                            const core::Tensor &nb_normal_ratios,
+                            core::Tensor &deformed_points,
+                            core::Tensor &deformed_normals);
+
+/// Fuses ParameterizeControlGrid and InterpolateControlGrid: deforms the
+/// {N, 3} points and, if normals is not empty, the normals in one pass
+/// without storing the parameterization. Invalid points are left unchanged
+/// and false in the {N} Bool mask.
+void DeformControlGrid(std::shared_ptr<core::DeviceHashmap> &hashmap,
+                       const core::Tensor &grid_positions,
+                       const core::Tensor &points,
+                       const core::Tensor &normals,
+                       core::Tensor &deformed_points,
+                       core::Tensor &deformed_normals,
+                       core::Tensor &mask,
+                       float grid_size);
+
+void ParameterizeControlGridCPU(std::shared_ptr<core::DeviceHashmap> &hashmap,
+                                const core::Tensor &points,
+                                const core::Tensor &normals,
+                                core::Tensor &nb_indices,
+                                core::Tensor &nb_point_ratios,
+                                core::Tensor &nb_normal_ratios,
+                                core::Tensor &mask,
+                                float grid_size);
+
+void InterpolateControlGridCPU(const core::Tensor &grid_positions,
+                               const core::Tensor &nb_indices,
+                               const core::Tensor &nb_point_ratios,
+                               const core::Tensor &nb_normal_ratios,
+                               core::Tensor &deformed_points,
+                               core::Tensor &deformed_normals);
+
+void DeformControlGridCPU(std::shared_ptr<core::DeviceHashmap> &hashmap,
+                          const core::Tensor &grid_positions,
+                          const core::Tensor &points,
+                          const core::Tensor &normals,
+                          core::Tensor &deformed_points,
+                          core::Tensor &deformed_normals,
+                          core::Tensor &mask,
+                          float grid_size);
+
+#ifdef BUILD_CUDA_MODULE
+void ParameterizeControlGridCUDA(std::shared_ptr<core::DeviceHashmap> &hashmap,
+                                 const core::Tensor &points,
+                                 const core::Tensor &normals,
+                                 core::Tensor &nb_indices,
+                                 core::Tensor &nb_point_ratios,
+                                 core::Tensor &nb_normal_ratios,
+                                 core::Tensor &mask,
+                                 float grid_size);
+
+void InterpolateControlGridCUDA(const core::Tensor &grid_positions,
+                                const core::Tensor &nb_indices,
+                                const core::Tensor &nb_point_ratios,
+                                const core::Tensor &nb_normal_ratios,
+                                core::Tensor &deformed_points,
+                                core::Tensor &deformed_normals);
+
+void DeformControlGridCUDA(std::shared_ptr<core::DeviceHashmap> &hashmap,
+                           const core::Tensor &grid_positions,
+                           const core::Tensor &points,
+                           const core::Tensor &normals,
+                           core::Tensor &deformed_points,
+                           core::Tensor &deformed_normals,
+                           core::Tensor &mask,
+                           float grid_size);
+#endif
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
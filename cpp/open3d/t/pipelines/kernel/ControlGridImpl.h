@@ -0,0 +1,359 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Dispatch.h"
+#include "open3d/t/geometry/kernel/GeometryMacros.h"
+#include "open3d/t/pipelines/kernel/ControlGrid.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+using GridKey = core::Block<int, 3>;
+using GridHash = core::BlockHash<int, 3>;
+
+#if defined(__CUDACC__)
+using GridHashmapImpl = stdgpu::unordered_map<GridKey, core::addr_t, GridHash>;
+#else
+using GridHashmapImpl =
+        tbb::concurrent_unordered_map<GridKey, core::addr_t, GridHash>*;
+#endif
+
+// The hashmap of the grid, to be found in the kernels.
+static GridHashmapImpl GetGridHashmapImpl(
+        std::shared_ptr<core::DeviceHashmap>& hashmap) {
+#if defined(BUILD_CUDA_MODULE) && defined(__CUDACC__)
+    auto cuda_hashmap = std::dynamic_pointer_cast<
+            core::StdGPUHashmap<GridKey, GridHash>>(hashmap);
+    if (cuda_hashmap == nullptr) {
+        utility::LogError(
+                "Unsupported backend: CUDA control grid only supports "
+                "STDGPU.");
+    }
+    return cuda_hashmap->GetImpl();
+#else
+    auto cpu_hashmap = std::dynamic_pointer_cast<
+            core::TBBHashmap<GridKey, GridHash>>(hashmap);
+    if (cpu_hashmap == nullptr) {
+        utility::LogError(
+                "Unsupported backend: CPU control grid only supports TBB.");
+    }
+    return cpu_hashmap->GetImpl().get();
+#endif
+}
+
+// Returns the index of the grid point (x, y, z), or -1 if it is not in the
+// grid.
+inline OPEN3D_DEVICE int FindGridPoint(const GridHashmapImpl& hashmap_impl,
+                                       int x,
+                                       int y,
+                                       int z) {
+    GridKey key;
+    key.Set(0, x);
+    key.Set(1, y);
+    key.Set(2, z);
+#if defined(__CUDACC__)
+    auto iter = hashmap_impl.find(key);
+    return iter == hashmap_impl.end() ? -1 : static_cast<int>(iter->second);
+#else
+    auto iter = hashmap_impl->find(key);
+    return iter == hashmap_impl->end() ? -1 : static_cast<int>(iter->second);
+#endif
+}
+
+// Finds the 8 neighbors of point p and computes the interpolation ratios of
+// the point and, if n is not null, of the normal n. Returns false if a
+// neighbor is not in the grid.
+inline OPEN3D_DEVICE bool ParameterizePoint(const GridHashmapImpl& hashmap_impl,
+                                            const float* p,
+                                            const float* n,
+                                            float grid_size,
+                                            int* nb_indices,
+                                            float* nb_point_ratios,
+                                            float* nb_normal_ratios) {
+    float x = p[0] / grid_size;
+    float y = p[1] / grid_size;
+    float z = p[2] / grid_size;
+    float x_floor = floorf(x);
+    float y_floor = floorf(y);
+    float z_floor = floorf(z);
+
+    // Ratios of the lower and upper neighbors along each axis.
+    float rx[2] = {1.f - (x - x_floor), x - x_floor};
+    float ry[2] = {1.f - (y - y_floor), y - y_floor};
+    float rz[2] = {1.f - (z - z_floor), z - z_floor};
+
+    int xi = static_cast<int>(x_floor);
+    int yi = static_cast<int>(y_floor);
+    int zi = static_cast<int>(z_floor);
+    for (int nb = 0; nb < 8; ++nb) {
+        int x_sel = (nb & 4) >> 2;
+        int y_sel = (nb & 2) >> 1;
+        int z_sel = (nb & 1);
+
+        int index = FindGridPoint(hashmap_impl, xi + x_sel, yi + y_sel,
+                                  zi + z_sel);
+        if (index < 0) {
+            return false;
+        }
+        nb_indices[nb] = index;
+        nb_point_ratios[nb] = rx[x_sel] * ry[y_sel] * rz[z_sel];
+        if (n != nullptr) {
+            float x_sign = x_sel * 2.f - 1.f;
+            float y_sign = y_sel * 2.f - 1.f;
+            float z_sign = z_sel * 2.f - 1.f;
+            nb_normal_ratios[nb] = x_sign * n[0] * ry[y_sel] * rz[z_sel] +
+                                   y_sign * n[1] * rx[x_sel] * rz[z_sel] +
+                                   z_sign * n[2] * rx[x_sel] * ry[y_sel];
+        }
+    }
+    return true;
+}
+
+// Interpolates the deformed point and, if nb_normal_ratios is not null, the
+// normalized deformed normal from the positions of the 8 neighbors.
+inline OPEN3D_DEVICE void InterpolatePoint(const float* grid_positions_ptr,
+                                           const int* nb_indices,
+                                           const float* nb_point_ratios,
+                                           const float* nb_normal_ratios,
+                                           float* p_deformed,
+                                           float* n_deformed) {
+    float p[3] = {0, 0, 0};
+    float n[3] = {0, 0, 0};
+    for (int nb = 0; nb < 8; ++nb) {
+        const float* g = grid_positions_ptr + 3 * nb_indices[nb];
+        for (int k = 0; k < 3; ++k) {
+            p[k] += nb_point_ratios[nb] * g[k];
+            if (nb_normal_ratios != nullptr) {
+                n[k] += nb_normal_ratios[nb] * g[k];
+            }
+        }
+    }
+    for (int k = 0; k < 3; ++k) {
+        p_deformed[k] = p[k];
+    }
+    if (nb_normal_ratios != nullptr) {
+        float len = sqrtf(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        float inv_len = len > 0 ? 1.f / len : 0.f;
+        for (int k = 0; k < 3; ++k) {
+            n_deformed[k] = n[k] * inv_len;
+        }
+    }
+}
+
+#if defined(__CUDACC__)
+void ParameterizeControlGridCUDA
+#else
+void ParameterizeControlGridCPU
+#endif
+        (std::shared_ptr<core::DeviceHashmap>& hashmap,
+         const core::Tensor& points,
+         const core::Tensor& normals,
+         core::Tensor& nb_indices,
+         core::Tensor& nb_point_ratios,
+         core::Tensor& nb_normal_ratios,
+         core::Tensor& mask,
+         float grid_size) {
+    GridHashmapImpl hashmap_impl = GetGridHashmapImpl(hashmap);
+
+    core::Device device = points.GetDevice();
+    int64_t n = points.GetLength();
+    bool has_normals = normals.NumElements() > 0;
+
+    core::Tensor points_contiguous = points.Contiguous();
+    core::Tensor normals_contiguous = normals.Contiguous();
+    nb_indices = core::Tensor::Zeros({n, 8}, core::Dtype::Int32, device);
+    nb_point_ratios = core::Tensor::Zeros({n, 8}, core::Dtype::Float32, device);
+    nb_normal_ratios =
+            has_normals ? core::Tensor::Zeros({n, 8}, core::Dtype::Float32,
+                                              device)
+                        : core::Tensor({0, 8}, core::Dtype::Float32, device);
+    mask = core::Tensor({n}, core::Dtype::Bool, device);
+
+    const float* points_ptr = points_contiguous.GetDataPtr<float>();
+    const float* normals_ptr =
+            has_normals ? normals_contiguous.GetDataPtr<float>() : nullptr;
+    int* nb_indices_ptr = nb_indices.GetDataPtr<int>();
+    float* nb_point_ratios_ptr = nb_point_ratios.GetDataPtr<float>();
+    float* nb_normal_ratios_ptr =
+            has_normals ? nb_normal_ratios.GetDataPtr<float>() : nullptr;
+    bool* mask_ptr = mask.GetDataPtr<bool>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        mask_ptr[workload_idx] = ParameterizePoint(
+                hashmap_impl, points_ptr + 3 * workload_idx,
+                has_normals ? normals_ptr + 3 * workload_idx : nullptr,
+                grid_size, nb_indices_ptr + 8 * workload_idx,
+                nb_point_ratios_ptr + 8 * workload_idx,
+                has_normals ? nb_normal_ratios_ptr + 8 * workload_idx
+                            : nullptr);
+    });
+}
+
+#if defined(__CUDACC__)
+void InterpolateControlGridCUDA
+#else
+void InterpolateControlGridCPU
+#endif
+        (const core::Tensor& grid_positions,
+         const core::Tensor& nb_indices,
+         const core::Tensor& nb_point_ratios,
+         const core::Tensor& nb_normal_ratios,
+         core::Tensor& deformed_points,
+         core::Tensor& deformed_normals) {
+    core::Device device = grid_positions.GetDevice();
+    int64_t n = nb_indices.GetLength();
+    bool has_normals = nb_normal_ratios.NumElements() > 0;
+
+    core::Tensor grid_positions_contiguous = grid_positions.Contiguous();
+    core::Tensor nb_indices_contiguous = nb_indices.Contiguous();
+    core::Tensor nb_point_ratios_contiguous = nb_point_ratios.Contiguous();
+    core::Tensor nb_normal_ratios_contiguous = nb_normal_ratios.Contiguous();
+    deformed_points = core::Tensor({n, 3}, core::Dtype::Float32, device);
+    deformed_normals = has_normals ? core::Tensor({n, 3}, core::Dtype::Float32,
+                                                  device)
+                                   : core::Tensor();
+
+    const float* grid_positions_ptr =
+            grid_positions_contiguous.GetDataPtr<float>();
+    const int* nb_indices_ptr = nb_indices_contiguous.GetDataPtr<int>();
+    const float* nb_point_ratios_ptr =
+            nb_point_ratios_contiguous.GetDataPtr<float>();
+    const float* nb_normal_ratios_ptr =
+            has_normals ? nb_normal_ratios_contiguous.GetDataPtr<float>()
+                        : nullptr;
+    float* deformed_points_ptr = deformed_points.GetDataPtr<float>();
+    float* deformed_normals_ptr =
+            has_normals ? deformed_normals.GetDataPtr<float>() : nullptr;
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        InterpolatePoint(
+                grid_positions_ptr, nb_indices_ptr + 8 * workload_idx,
+                nb_point_ratios_ptr + 8 * workload_idx,
+                has_normals ? nb_normal_ratios_ptr + 8 * workload_idx
+                            : nullptr,
+                deformed_points_ptr + 3 * workload_idx,
+                has_normals ? deformed_normals_ptr + 3 * workload_idx
+                            : nullptr);
+    });
+}
+
+#if defined(__CUDACC__)
+void DeformControlGridCUDA
+#else
+void DeformControlGridCPU
+#endif
+        (std::shared_ptr<core::DeviceHashmap>& hashmap,
+         const core::Tensor& grid_positions,
+         const core::Tensor& points,
+         const core::Tensor& normals,
+         core::Tensor& deformed_points,
+         core::Tensor& deformed_normals,
+         core::Tensor& mask,
+         float grid_size) {
+    GridHashmapImpl hashmap_impl = GetGridHashmapImpl(hashmap);
+
+    core::Device device = points.GetDevice();
+    int64_t n = points.GetLength();
+    bool has_normals = normals.NumElements() > 0;
+
+    core::Tensor grid_positions_contiguous = grid_positions.Contiguous();
+    core::Tensor points_contiguous = points.Contiguous();
+    core::Tensor normals_contiguous = normals.Contiguous();
+    deformed_points = core::Tensor({n, 3}, core::Dtype::Float32, device);
+    deformed_normals = has_normals ? core::Tensor({n, 3}, core::Dtype::Float32,
+                                                  device)
+                                   : core::Tensor();
+    mask = core::Tensor({n}, core::Dtype::Bool, device);
+
+    const float* grid_positions_ptr =
+            grid_positions_contiguous.GetDataPtr<float>();
+    const float* points_ptr = points_contiguous.GetDataPtr<float>();
+    const float* normals_ptr =
+            has_normals ? normals_contiguous.GetDataPtr<float>() : nullptr;
+    float* deformed_points_ptr = deformed_points.GetDataPtr<float>();
+    float* deformed_normals_ptr =
+            has_normals ? deformed_normals.GetDataPtr<float>() : nullptr;
+    bool* mask_ptr = mask.GetDataPtr<bool>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const float* p = points_ptr + 3 * workload_idx;
+        const float* nm = has_normals ? normals_ptr + 3 * workload_idx
+                                      : nullptr;
+        float* p_deformed = deformed_points_ptr + 3 * workload_idx;
+        float* n_deformed = has_normals
+                                    ? deformed_normals_ptr + 3 * workload_idx
+                                    : nullptr;
+
+        int nb_indices[8];
+        float nb_point_ratios[8];
+        float nb_normal_ratios[8];
+        bool valid = ParameterizePoint(hashmap_impl, p, nm, grid_size,
+                                       nb_indices, nb_point_ratios,
+                                       nb_normal_ratios);
+        mask_ptr[workload_idx] = valid;
+        if (valid) {
+            InterpolatePoint(grid_positions_ptr, nb_indices, nb_point_ratios,
+                             has_normals ? nb_normal_ratios : nullptr,
+                             p_deformed, n_deformed);
+        } else {
+            for (int k = 0; k < 3; ++k) {
+                p_deformed[k] = p[k];
+                if (has_normals) {
+                    n_deformed[k] = nm[k];
+                }
+            }
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,64 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace feature {
+
+void ComputeFPFHFeature(const core::Tensor &points,
+                        const core::Tensor &normals,
+                        const core::Tensor &neighbor_indices,
+                        const core::Tensor &neighbor_distance2,
+                        const core::Tensor &neighbor_offsets,
+                        const core::Tensor &neighbor_counts,
+                        core::Tensor &fpfhs) {
+    core::Device device = points.GetDevice();
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeFPFHFeatureCPU(points, normals, neighbor_indices,
+                              neighbor_distance2, neighbor_offsets,
+                              neighbor_counts, fpfhs);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeFPFHFeatureCUDA, points, normals, neighbor_indices,
+                  neighbor_distance2, neighbor_offsets, neighbor_counts,
+                  fpfhs);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace feature
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
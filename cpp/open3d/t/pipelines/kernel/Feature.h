@@ -0,0 +1,80 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace feature {
+
+/// Computes the FPFH feature of each point. The neighbors of point i are
+/// neighbor_indices[neighbor_offsets[i] + j] for 0 <= j < neighbor_counts[i],
+/// sorted by increasing distance, so that the first one is the point itself.
+///
+/// \param points Points of shape {n, 3}, Float32 or Float64.
+/// \param normals Normals of shape {n, 3}, same dtype as points.
+/// \param neighbor_indices Flat neighbor indices, Int64.
+/// \param neighbor_distance2 Squared distances of the neighbors, same shape as
+/// neighbor_indices and same dtype as points.
+/// \param neighbor_offsets Start of the neighbors of each point, shape {n},
+/// Int64.
+/// \param neighbor_counts Number of neighbors of each point, shape {n}, Int64.
+/// \param fpfhs Output features of shape {n, 33}, same dtype as points.
+void ComputeFPFHFeature(const core::Tensor &points,
+                        const core::Tensor &normals,
+                        const core::Tensor &neighbor_indices,
+                        const core::Tensor &neighbor_distance2,
+                        const core::Tensor &neighbor_offsets,
+                        const core::Tensor &neighbor_counts,
+                        core::Tensor &fpfhs);
+
+void ComputeFPFHFeatureCPU(const core::Tensor &points,
+                           const core::Tensor &normals,
+                           const core::Tensor &neighbor_indices,
+                           const core::Tensor &neighbor_distance2,
+                           const core::Tensor &neighbor_offsets,
+                           const core::Tensor &neighbor_counts,
+                           core::Tensor &fpfhs);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeFPFHFeatureCUDA(const core::Tensor &points,
+                            const core::Tensor &normals,
+                            const core::Tensor &neighbor_indices,
+                            const core::Tensor &neighbor_distance2,
+                            const core::Tensor &neighbor_offsets,
+                            const core::Tensor &neighbor_counts,
+                            core::Tensor &fpfhs);
+#endif
+
+}  // namespace feature
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,220 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+// Private header. Do not include in Open3d.h.
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/Feature.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+namespace feature {
+
+/// Computes the pair feature (phi, alpha, theta, distance) of two oriented
+/// points, as registration::ComputePairFeatures() does for the legacy point
+/// cloud. Degenerate pairs get a zero feature.
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline void ComputePairFeature(const scalar_t *p1,
+                                                  const scalar_t *n1,
+                                                  const scalar_t *p2,
+                                                  const scalar_t *n2,
+                                                  double *feature) {
+    feature[0] = feature[1] = feature[2] = feature[3] = 0;
+    double dp[3] = {double(p2[0]) - p1[0], double(p2[1]) - p1[1],
+                    double(p2[2]) - p1[2]};
+    const double distance = sqrt(dp[0] * dp[0] + dp[1] * dp[1] + dp[2] * dp[2]);
+    if (distance == 0) {
+        return;
+    }
+    double u[3] = {n1[0], n1[1], n1[2]};
+    double nt[3] = {n2[0], n2[1], n2[2]};
+    const double angle1 = (u[0] * dp[0] + u[1] * dp[1] + u[2] * dp[2]) /
+                          distance;
+    const double angle2 = (nt[0] * dp[0] + nt[1] * dp[1] + nt[2] * dp[2]) /
+                          distance;
+    double theta;
+    if (acos(fabs(angle1)) > acos(fabs(angle2))) {
+        for (int k = 0; k < 3; ++k) {
+            const double tmp = u[k];
+            u[k] = nt[k];
+            nt[k] = tmp;
+            dp[k] = -dp[k];
+        }
+        theta = -angle2;
+    } else {
+        theta = angle1;
+    }
+    double v[3] = {dp[1] * u[2] - dp[2] * u[1], dp[2] * u[0] - dp[0] * u[2],
+                   dp[0] * u[1] - dp[1] * u[0]};
+    const double v_norm = sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+    if (v_norm == 0) {
+        return;
+    }
+    v[0] /= v_norm;
+    v[1] /= v_norm;
+    v[2] /= v_norm;
+    const double w[3] = {u[1] * v[2] - u[2] * v[1], u[2] * v[0] - u[0] * v[2],
+                         u[0] * v[1] - u[1] * v[0]};
+    feature[0] = atan2(w[0] * nt[0] + w[1] * nt[1] + w[2] * nt[2],
+                       u[0] * nt[0] + u[1] * nt[1] + u[2] * nt[2]);
+    feature[1] = v[0] * nt[0] + v[1] * nt[1] + v[2] * nt[2];
+    feature[2] = theta;
+    feature[3] = distance;
+}
+
+/// Returns the bin of \p value in 11 equal bins over [min_value, max_value].
+OPEN3D_HOST_DEVICE inline int ComputeHistogramBin(double value,
+                                                  double min_value,
+                                                  double max_value) {
+    int bin = int(floor(11 * (value - min_value) / (max_value - min_value)));
+    return bin < 0 ? 0 : (bin >= 11 ? 10 : bin);
+}
+
+#if defined(__CUDACC__)
+void ComputeFPFHFeatureCUDA
+#else
+void ComputeFPFHFeatureCPU
+#endif
+        (const core::Tensor &points,
+         const core::Tensor &normals,
+         const core::Tensor &neighbor_indices,
+         const core::Tensor &neighbor_distance2,
+         const core::Tensor &neighbor_offsets,
+         const core::Tensor &neighbor_counts,
+         core::Tensor &fpfhs) {
+    const int64_t n = points.GetLength();
+    const int64_t *indices_ptr = neighbor_indices.GetDataPtr<int64_t>();
+    const int64_t *offsets_ptr = neighbor_offsets.GetDataPtr<int64_t>();
+    const int64_t *counts_ptr = neighbor_counts.GetDataPtr<int64_t>();
+    core::Tensor spfhs({n, 33}, points.GetDtype(), points.GetDevice());
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t *points_ptr = points.GetDataPtr<scalar_t>();
+        const scalar_t *normals_ptr = normals.GetDataPtr<scalar_t>();
+        const scalar_t *distance2_ptr =
+                neighbor_distance2.GetDataPtr<scalar_t>();
+        scalar_t *spfhs_ptr = spfhs.GetDataPtr<scalar_t>();
+        scalar_t *fpfhs_ptr = fpfhs.GetDataPtr<scalar_t>();
+
+        // Simplified point feature histograms. The first neighbor is the
+        // point itself and is skipped.
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int64_t *neighbors = indices_ptr + offsets_ptr[workload_idx];
+            const int64_t count = counts_ptr[workload_idx];
+            double histogram[33];
+            for (int j = 0; j < 33; ++j) {
+                histogram[j] = 0;
+            }
+            if (count > 1) {
+                const double pi = 3.14159265358979323846;
+                const double hist_incr = 100.0 / double(count - 1);
+                const scalar_t *p = points_ptr + 3 * workload_idx;
+                const scalar_t *normal = normals_ptr + 3 * workload_idx;
+                double feature[4];
+                for (int64_t k = 1; k < count; ++k) {
+                    const int64_t idx = neighbors[k];
+                    ComputePairFeature(p, normal, points_ptr + 3 * idx,
+                                       normals_ptr + 3 * idx, feature);
+                    histogram[ComputeHistogramBin(feature[0], -pi, pi)] +=
+                            hist_incr;
+                    histogram[11 + ComputeHistogramBin(feature[1], -1, 1)] +=
+                            hist_incr;
+                    histogram[22 + ComputeHistogramBin(feature[2], -1, 1)] +=
+                            hist_incr;
+                }
+            }
+            scalar_t *spfh = spfhs_ptr + 33 * workload_idx;
+            for (int j = 0; j < 33; ++j) {
+                spfh[j] = static_cast<scalar_t>(histogram[j]);
+            }
+        });
+
+        // Each FPFH adds the SPFH of the neighbors, weighted by the inverse
+        // squared distance and normalized per sub-histogram, to the SPFH of
+        // the point.
+        launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+            const int64_t offset = offsets_ptr[workload_idx];
+            const int64_t count = counts_ptr[workload_idx];
+            const scalar_t *spfh = spfhs_ptr + 33 * workload_idx;
+            scalar_t *fpfh = fpfhs_ptr + 33 * workload_idx;
+            if (count <= 1) {
+                for (int j = 0; j < 33; ++j) {
+                    fpfh[j] = 0;
+                }
+                return;
+            }
+            double histogram[33];
+            for (int j = 0; j < 33; ++j) {
+                histogram[j] = 0;
+            }
+            double sum[3] = {0, 0, 0};
+            for (int64_t k = 1; k < count; ++k) {
+                const double dist = distance2_ptr[offset + k];
+                if (dist == 0) {
+                    continue;
+                }
+                const scalar_t *neighbor_spfh =
+                        spfhs_ptr + 33 * indices_ptr[offset + k];
+                for (int j = 0; j < 33; ++j) {
+                    const double val = neighbor_spfh[j] / dist;
+                    sum[j / 11] += val;
+                    histogram[j] += val;
+                }
+            }
+            for (int j = 0; j < 3; ++j) {
+                if (sum[j] != 0) {
+                    sum[j] = 100.0 / sum[j];
+                }
+            }
+            for (int j = 0; j < 33; ++j) {
+                fpfh[j] = static_cast<scalar_t>(histogram[j] * sum[j / 11] +
+                                                spfh[j]);
+            }
+        });
+    });
+
+#ifdef __CUDACC__
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+#endif
+}
+
+}  // namespace feature
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
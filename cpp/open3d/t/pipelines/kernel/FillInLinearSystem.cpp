@@ -82,34 +82,41 @@ void FillInRigidAlignmentTerm(core::Tensor &AtA,
     }
 }
 
-void FillInSLACAlignmentTerm(core::Tensor &AtA,
-                             core::Tensor &Atb,
-                             core::Tensor &residual,
-                             const core::Tensor &Ti_ps,
-                             const core::Tensor &Tj_qs,
-                             const core::Tensor &normal_ps,
-                             const core::Tensor &Ri_normal_ps,
-                             const core::Tensor &RjT_Ri_normal_ps,
-                             const core::Tensor &cgrid_idx_ps,
-                             const core::Tensor &cgrid_idx_qs,
-                             const core::Tensor &cgrid_ratio_qs,
-                             const core::Tensor &cgrid_ratio_ps,
-                             int i,
-                             int j,
-                             int n,
-                             float threshold) {
-    AtA.AssertDtype(core::Dtype::Float32);
-    Atb.AssertDtype(core::Dtype::Float32);
-    residual.AssertDtype(core::Dtype::Float32);
+void FillInSLACAlignmentJacobian(core::Tensor &jacobians,
+                                 core::Tensor &jacobian_indices,
+                                 core::Tensor &residuals,
+                                 const core::Tensor &Ti_ps,
+                                 const core::Tensor &Tj_qs,
+                                 const core::Tensor &normal_ps,
+                                 const core::Tensor &Ri_normal_ps,
+                                 const core::Tensor &RjT_Ri_normal_ps,
+                                 const core::Tensor &cgrid_idx_ps,
+                                 const core::Tensor &cgrid_idx_qs,
+                                 const core::Tensor &cgrid_ratio_qs,
+                                 const core::Tensor &cgrid_ratio_ps,
+                                 int i,
+                                 int j,
+                                 int n,
+                                 float threshold) {
+    int64_t n_rows = Ti_ps.GetLength();
+    jacobians.AssertShape({n_rows, 60});
+    jacobians.AssertDtype(core::Dtype::Float32);
+    jacobian_indices.AssertShape({n_rows, 60});
+    jacobian_indices.AssertDtype(core::Dtype::Int32);
+    residuals.AssertShape({n_rows});
+    residuals.AssertDtype(core::Dtype::Float32);
     Ti_ps.AssertDtype(core::Dtype::Float32);
     Tj_qs.AssertDtype(core::Dtype::Float32);
     normal_ps.AssertDtype(core::Dtype::Float32);
     Ri_normal_ps.AssertDtype(core::Dtype::Float32);
     RjT_Ri_normal_ps.AssertDtype(core::Dtype::Float32);
 
-    core::Device device = AtA.GetDevice();
-    if (Atb.GetDevice() != device) {
-        utility::LogError("AtA should have the same device as Atb.");
+    core::Device device = jacobians.GetDevice();
+    if (jacobian_indices.GetDevice() != device ||
+        residuals.GetDevice() != device) {
+        utility::LogError(
+                "Jacobians, indices and residuals should have the same "
+                "device.");
     }
     if (Ti_ps.GetDevice() != device) {
         utility::LogError(
@@ -126,18 +133,69 @@ void FillInSLACAlignmentTerm(core::Tensor &AtA,
 
     core::Device::DeviceType device_type = device.GetType();
     if (device_type == core::Device::DeviceType::CPU) {
-        FillInSLACAlignmentTermCPU(AtA, Atb, residual, Ti_ps, Tj_qs, normal_ps,
-                                   Ri_normal_ps, RjT_Ri_normal_ps, cgrid_idx_ps,
-                                   cgrid_idx_qs, cgrid_ratio_ps, cgrid_ratio_qs,
-                                   i, j, n, threshold);
+        FillInSLACAlignmentJacobianCPU(
+                jacobians, jacobian_indices, residuals, Ti_ps, Tj_qs,
+                normal_ps, Ri_normal_ps, RjT_Ri_normal_ps, cgrid_idx_ps,
+                cgrid_idx_qs, cgrid_ratio_ps, cgrid_ratio_qs, i, j, n,
+                threshold);
 
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
-        FillInSLACAlignmentTermCUDA(AtA, Atb, residual, Ti_ps, Tj_qs, normal_ps,
-                                    Ri_normal_ps, RjT_Ri_normal_ps,
-                                    cgrid_idx_ps, cgrid_idx_qs, cgrid_ratio_ps,
-                                    cgrid_ratio_qs, i, j, n, threshold);
+        FillInSLACAlignmentJacobianCUDA(
+                jacobians, jacobian_indices, residuals, Ti_ps, Tj_qs,
+                normal_ps, Ri_normal_ps, RjT_Ri_normal_ps, cgrid_idx_ps,
+                cgrid_idx_qs, cgrid_ratio_ps, cgrid_ratio_qs, i, j, n,
+                threshold);
+
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
 
+void FillInSLACRegularizerJacobian(core::Tensor &jacobians,
+                                   core::Tensor &jacobian_indices,
+                                   core::Tensor &residuals,
+                                   const core::Tensor &grid_idx,
+                                   const core::Tensor &grid_nbs_idx,
+                                   const core::Tensor &grid_nbs_mask,
+                                   const core::Tensor &positions_init,
+                                   const core::Tensor &positions_curr,
+                                   float weight,
+                                   int n,
+                                   int anchor_idx) {
+    // 6 neighbors x 3 axes per grid point.
+    int64_t n_rows = grid_idx.GetLength() * 18;
+    jacobians.AssertShape({n_rows, 2});
+    jacobians.AssertDtype(core::Dtype::Float32);
+    jacobian_indices.AssertShape({n_rows, 2});
+    jacobian_indices.AssertDtype(core::Dtype::Int32);
+    residuals.AssertShape({n_rows});
+    residuals.AssertDtype(core::Dtype::Float32);
+
+    core::Device device = jacobians.GetDevice();
+    if (jacobian_indices.GetDevice() != device ||
+        residuals.GetDevice() != device) {
+        utility::LogError(
+                "Jacobians, indices and residuals should have the same "
+                "device.");
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FillInSLACRegularizerJacobianCPU(
+                jacobians, jacobian_indices, residuals, grid_idx, grid_nbs_idx,
+                grid_nbs_mask, positions_init, positions_curr, weight, n,
+                anchor_idx);
+
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        FillInSLACRegularizerJacobianCUDA(
+                jacobians, jacobian_indices, residuals, grid_idx, grid_nbs_idx,
+                grid_nbs_mask, positions_init, positions_curr, weight, n,
+                anchor_idx);
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
 #endif
@@ -146,37 +204,63 @@ void FillInSLACAlignmentTerm(core::Tensor &AtA,
     }
 }
 
-void FillInSLACRegularizerTerm(core::Tensor &AtA,
-                               core::Tensor &Atb,
-                               core::Tensor &residual,
-                               const core::Tensor &grid_idx,
-                               const core::Tensor &grid_nbs_idx,
-                               const core::Tensor &grid_nbs_mask,
-                               const core::Tensor &positions_init,
-                               const core::Tensor &positions_curr,
-                               float weight,
-                               int n,
-                               int anchor_idx) {
+void FillInPoseGraphTerm(core::Tensor &AtA,
+                         core::Tensor &Atb,
+                         core::Tensor &edge_residuals,
+                         const core::Tensor &poses,
+                         const core::Tensor &edge_indices,
+                         const core::Tensor &edge_transformations,
+                         const core::Tensor &edge_information,
+                         const core::Tensor &edge_confidence) {
     AtA.AssertDtype(core::Dtype::Float32);
     Atb.AssertDtype(core::Dtype::Float32);
-    residual.AssertDtype(core::Dtype::Float32);
+    edge_residuals.AssertDtype(core::Dtype::Float32);
+    poses.AssertDtype(core::Dtype::Float32);
+    edge_indices.AssertDtype(core::Dtype::Int64);
+    edge_transformations.AssertDtype(core::Dtype::Float32);
+    edge_information.AssertDtype(core::Dtype::Float32);
+    edge_confidence.AssertDtype(core::Dtype::Float32);
+
+    int64_t n_edges = edge_indices.GetLength();
+    poses.AssertShape({poses.GetLength(), 4, 4});
+    edge_indices.AssertShape({n_edges, 2});
+    edge_transformations.AssertShape({n_edges, 4, 4});
+    edge_information.AssertShape({n_edges, 6, 6});
+    edge_confidence.AssertShape({n_edges});
+    edge_residuals.AssertShape({n_edges});
+    if (Atb.GetLength() != 6 * poses.GetLength()) {
+        utility::LogError(
+                "Unable to setup linear system: expected {} variables for {} "
+                "poses, but got {}.",
+                6 * poses.GetLength(), poses.GetLength(), Atb.GetLength());
+    }
 
     core::Device device = AtA.GetDevice();
     if (Atb.GetDevice() != device) {
         utility::LogError("AtA should have the same device as Atb.");
     }
+    for (const core::Tensor &tensor :
+         {edge_residuals, poses, edge_indices, edge_transformations,
+          edge_information, edge_confidence}) {
+        if (tensor.GetDevice() != device) {
+            utility::LogError(
+                    "Pose graph should have the same device as the linear "
+                    "system.");
+        }
+    }
 
     core::Device::DeviceType device_type = device.GetType();
     if (device_type == core::Device::DeviceType::CPU) {
-        FillInSLACRegularizerTermCPU(AtA, Atb, residual, grid_idx, grid_nbs_idx,
-                                     grid_nbs_mask, positions_init,
-                                     positions_curr, weight, n, anchor_idx);
+        FillInPoseGraphTermCPU(AtA, Atb, edge_residuals, poses, edge_indices,
+                               edge_transformations, edge_information,
+                               edge_confidence);
 
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
-        FillInSLACRegularizerTermCUDA(
-                AtA, Atb, residual, grid_idx, grid_nbs_idx, grid_nbs_mask,
-                positions_init, positions_curr, weight, n, anchor_idx);
+        FillInPoseGraphTermCUDA(AtA, Atb, edge_residuals, poses, edge_indices,
+                                edge_transformations, edge_information,
+                                edge_confidence);
+
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
 #endif
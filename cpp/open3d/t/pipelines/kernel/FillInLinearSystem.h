@@ -41,34 +41,51 @@ void FillInRigidAlignmentTerm(core::Tensor &AtA,
                               int j,
                               float threshold);
 
-void FillInSLACAlignmentTerm(core::Tensor &AtA,
-                             core::Tensor &Atb,
-                             core::Tensor &residual,
-                             const core::Tensor &Ti_qs,
-                             const core::Tensor &Tj_qs,
-                             const core::Tensor &normal_ps,
-                             const core::Tensor &Ri_normal_ps,
-                             const core::Tensor &RjT_Ri_normal_ps,
-                             const core::Tensor &cgrid_idx_ps,
-                             const core::Tensor &cgrid_idx_qs,
-                             const core::Tensor &cgrid_ratio_qs,
-                             const core::Tensor &cgrid_ratio_ps,
-                             int i,
-                             int j,
-                             int n,
-                             float threshold);
+/// Writes one row of 60 Jacobian entries, their column indices and the
+/// residual per correspondence, for the sparse SLAC solver. Rows of the
+/// correspondences beyond the threshold are zero.
+void FillInSLACAlignmentJacobian(core::Tensor &jacobians,
+                                 core::Tensor &jacobian_indices,
+                                 core::Tensor &residuals,
+                                 const core::Tensor &Ti_qs,
+                                 const core::Tensor &Tj_qs,
+                                 const core::Tensor &normal_ps,
+                                 const core::Tensor &Ri_normal_ps,
+                                 const core::Tensor &RjT_Ri_normal_ps,
+                                 const core::Tensor &cgrid_idx_ps,
+                                 const core::Tensor &cgrid_idx_qs,
+                                 const core::Tensor &cgrid_ratio_qs,
+                                 const core::Tensor &cgrid_ratio_ps,
+                                 int i,
+                                 int j,
+                                 int n,
+                                 float threshold);
 
-void FillInSLACRegularizerTerm(core::Tensor &AtA,
-                               core::Tensor &Atb,
-                               core::Tensor &residual,
-                               const core::Tensor &grid_idx,
-                               const core::Tensor &grid_nbs_idx,
-                               const core::Tensor &grid_nbs_mask,
-                               const core::Tensor &positions_init,
-                               const core::Tensor &positions_curr,
-                               float weight,
-                               int n,
-                               int anchor_idx);
+/// Writes 6 neighbors x 3 axes rows of 2 Jacobian entries per grid point,
+/// scaled by the square root of the weight.
+void FillInSLACRegularizerJacobian(core::Tensor &jacobians,
+                                   core::Tensor &jacobian_indices,
+                                   core::Tensor &residuals,
+                                   const core::Tensor &grid_idx,
+                                   const core::Tensor &grid_nbs_idx,
+                                   const core::Tensor &grid_nbs_mask,
+                                   const core::Tensor &positions_init,
+                                   const core::Tensor &positions_curr,
+                                   float weight,
+                                   int n,
+                                   int anchor_idx);
+
+/// Fills in the 6 x 6 blocks of the edges (s, t) of a pose graph, whose poses
+/// are {N, 4, 4}, and writes e^T @ information @ e of each edge to
+/// edge_residuals. The increment solves AtA @ delta = -Atb.
+void FillInPoseGraphTerm(core::Tensor &AtA,
+                         core::Tensor &Atb,
+                         core::Tensor &edge_residuals,
+                         const core::Tensor &poses,
+                         const core::Tensor &edge_indices,
+                         const core::Tensor &edge_transformations,
+                         const core::Tensor &edge_information,
+                         const core::Tensor &edge_confidence);
 
 void FillInRigidAlignmentTermCPU(core::Tensor &AtA,
                                  core::Tensor &Atb,
@@ -80,34 +97,43 @@ void FillInRigidAlignmentTermCPU(core::Tensor &AtA,
                                  int j,
                                  float threshold);
 
-void FillInSLACAlignmentTermCPU(core::Tensor &AtA,
-                                core::Tensor &Atb,
-                                core::Tensor &residual,
-                                const core::Tensor &Ti_qs,
-                                const core::Tensor &Tj_qs,
-                                const core::Tensor &normal_ps,
-                                const core::Tensor &Ri_normal_ps,
-                                const core::Tensor &RjT_Ri_normal_ps,
-                                const core::Tensor &cgrid_idx_ps,
-                                const core::Tensor &cgrid_idx_qs,
-                                const core::Tensor &cgrid_ratio_qs,
-                                const core::Tensor &cgrid_ratio_ps,
-                                int i,
-                                int j,
-                                int n,
-                                float threshold);
+void FillInSLACAlignmentJacobianCPU(core::Tensor &jacobians,
+                                    core::Tensor &jacobian_indices,
+                                    core::Tensor &residuals,
+                                    const core::Tensor &Ti_qs,
+                                    const core::Tensor &Tj_qs,
+                                    const core::Tensor &normal_ps,
+                                    const core::Tensor &Ri_normal_ps,
+                                    const core::Tensor &RjT_Ri_normal_ps,
+                                    const core::Tensor &cgrid_idx_ps,
+                                    const core::Tensor &cgrid_idx_qs,
+                                    const core::Tensor &cgrid_ratio_qs,
+                                    const core::Tensor &cgrid_ratio_ps,
+                                    int i,
+                                    int j,
+                                    int n,
+                                    float threshold);
 
-void FillInSLACRegularizerTermCPU(core::Tensor &AtA,
-                                  core::Tensor &Atb,
-                                  core::Tensor &residual,
-                                  const core::Tensor &grid_idx,
-                                  const core::Tensor &grid_nbs_idx,
-                                  const core::Tensor &grid_nbs_mask,
-                                  const core::Tensor &positions_init,
-                                  const core::Tensor &positions_curr,
-                                  float weight,
-                                  int n,
-                                  int anchor_idx);
+void FillInSLACRegularizerJacobianCPU(core::Tensor &jacobians,
+                                      core::Tensor &jacobian_indices,
+                                      core::Tensor &residuals,
+                                      const core::Tensor &grid_idx,
+                                      const core::Tensor &grid_nbs_idx,
+                                      const core::Tensor &grid_nbs_mask,
+                                      const core::Tensor &positions_init,
+                                      const core::Tensor &positions_curr,
+                                      float weight,
+                                      int n,
+                                      int anchor_idx);
+
+void FillInPoseGraphTermCPU(core::Tensor &AtA,
+                            core::Tensor &Atb,
+                            core::Tensor &edge_residuals,
+                            const core::Tensor &poses,
+                            const core::Tensor &edge_indices,
+                            const core::Tensor &edge_transformations,
+                            const core::Tensor &edge_information,
+                            const core::Tensor &edge_confidence);
 
 #ifdef BUILD_CUDA_MODULE
 void FillInRigidAlignmentTermCUDA(core::Tensor &AtA,
@@ -120,34 +146,43 @@ void FillInRigidAlignmentTermCUDA(core::Tensor &AtA,
                                   int j,
                                   float threshold);
 
-void FillInSLACAlignmentTermCUDA(core::Tensor &AtA,
-                                 core::Tensor &Atb,
-                                 core::Tensor &residual,
-                                 const core::Tensor &Ti_qs,
-                                 const core::Tensor &Tj_qs,
-                                 const core::Tensor &normal_ps,
-                                 const core::Tensor &Ri_normal_ps,
-                                 const core::Tensor &RjT_Ri_normal_ps,
-                                 const core::Tensor &cgrid_idx_ps,
-                                 const core::Tensor &cgrid_idx_qs,
-                                 const core::Tensor &cgrid_ratio_qs,
-                                 const core::Tensor &cgrid_ratio_ps,
-                                 int i,
-                                 int j,
-                                 int n,
-                                 float threshold);
+void FillInSLACAlignmentJacobianCUDA(core::Tensor &jacobians,
+                                     core::Tensor &jacobian_indices,
+                                     core::Tensor &residuals,
+                                     const core::Tensor &Ti_qs,
+                                     const core::Tensor &Tj_qs,
+                                     const core::Tensor &normal_ps,
+                                     const core::Tensor &Ri_normal_ps,
+                                     const core::Tensor &RjT_Ri_normal_ps,
+                                     const core::Tensor &cgrid_idx_ps,
+                                     const core::Tensor &cgrid_idx_qs,
+                                     const core::Tensor &cgrid_ratio_qs,
+                                     const core::Tensor &cgrid_ratio_ps,
+                                     int i,
+                                     int j,
+                                     int n,
+                                     float threshold);
 
-void FillInSLACRegularizerTermCUDA(core::Tensor &AtA,
-                                   core::Tensor &Atb,
-                                   core::Tensor &residual,
-                                   const core::Tensor &grid_idx,
-                                   const core::Tensor &grid_nbs_idx,
-                                   const core::Tensor &grid_nbs_mask,
-                                   const core::Tensor &positions_init,
-                                   const core::Tensor &positions_curr,
-                                   float weight,
-                                   int n,
-                                   int anchor_idx);
+void FillInSLACRegularizerJacobianCUDA(core::Tensor &jacobians,
+                                       core::Tensor &jacobian_indices,
+                                       core::Tensor &residuals,
+                                       const core::Tensor &grid_idx,
+                                       const core::Tensor &grid_nbs_idx,
+                                       const core::Tensor &grid_nbs_mask,
+                                       const core::Tensor &positions_init,
+                                       const core::Tensor &positions_curr,
+                                       float weight,
+                                       int n,
+                                       int anchor_idx);
+
+void FillInPoseGraphTermCUDA(core::Tensor &AtA,
+                             core::Tensor &Atb,
+                             core::Tensor &edge_residuals,
+                             const core::Tensor &poses,
+                             const core::Tensor &edge_indices,
+                             const core::Tensor &edge_transformations,
+                             const core::Tensor &edge_information,
+                             const core::Tensor &edge_confidence);
 
 #endif
 
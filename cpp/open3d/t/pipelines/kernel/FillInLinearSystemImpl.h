@@ -154,13 +154,13 @@ void FillInRigidAlignmentTermCPU
 }
 
 #if defined(__CUDACC__)
-void FillInSLACAlignmentTermCUDA
+void FillInSLACAlignmentJacobianCUDA
 #else
-void FillInSLACAlignmentTermCPU
+void FillInSLACAlignmentJacobianCPU
 #endif
-        (core::Tensor &AtA,
-         core::Tensor &Atb,
-         core::Tensor &residual,
+        (core::Tensor &jacobians,
+         core::Tensor &jacobian_indices,
+         core::Tensor &residuals,
          const core::Tensor &Ti_Cps,
          const core::Tensor &Tj_Cqs,
          const core::Tensor &Cnormal_ps,
@@ -183,10 +183,9 @@ void FillInSLACAlignmentTermCPU
                 "Unable to setup linear system: input length mismatch.");
     }
 
-    int n_vars = Atb.GetLength();
-    float *AtA_ptr = static_cast<float *>(AtA.GetDataPtr());
-    float *Atb_ptr = static_cast<float *>(Atb.GetDataPtr());
-    float *residual_ptr = static_cast<float *>(residual.GetDataPtr());
+    float *J_ptr = static_cast<float *>(jacobians.GetDataPtr());
+    int *J_idx_ptr = static_cast<int *>(jacobian_indices.GetDataPtr());
+    float *r_ptr = static_cast<float *>(residuals.GetDataPtr());
 
     // Geometric properties
     const float *Ti_Cps_ptr = static_cast<const float *>(Ti_Cps.GetDataPtr());
@@ -226,14 +225,13 @@ void FillInSLACAlignmentTermCPU
         const float *cgrid_ratio_p = cgrid_ratio_ps_ptr + 8 * workload_idx;
         const float *cgrid_ratio_q = cgrid_ratio_qs_ptr + 8 * workload_idx;
 
-        float r = (Ti_Cp[0] - Tj_Cq[0]) * Ri_Cnormal_p[0] +
-                  (Ti_Cp[1] - Tj_Cq[1]) * Ri_Cnormal_p[1] +
-                  (Ti_Cp[2] - Tj_Cq[2]) * Ri_Cnormal_p[2];
-        if (abs(r) > threshold) return;
+        float r_p = (Ti_Cp[0] - Tj_Cq[0]) * Ri_Cnormal_p[0] +
+                    (Ti_Cp[1] - Tj_Cq[1]) * Ri_Cnormal_p[1] +
+                    (Ti_Cp[2] - Tj_Cq[2]) * Ri_Cnormal_p[2];
 
-        // Now we fill in a 60 x 60 sub-matrix: 2 x (6 + 8 x 3)
-        float J[60];
-        int idx[60];
+        // Now we fill in a 60-entry row: 2 x (6 + 8 x 3)
+        float *J = J_ptr + 60 * workload_idx;
+        int *idx = J_idx_ptr + 60 * workload_idx;
 
         // Jacobian w.r.t. Ti: 0-6
         J[0] = -Tj_Cq[2] * Ri_Cnormal_p[1] + Tj_Cq[1] * Ri_Cnormal_p[2];
@@ -273,42 +271,25 @@ void FillInSLACAlignmentTermCPU
             idx[36 + k * 3 + 2] = 6 * n_frags + cgrid_idx_q[k] * 3 + 2;
         }
 
-        // Not optimized; Switch to reduction if necessary.
-#if defined(__CUDACC__)
-        for (int ki = 0; ki < 60; ++ki) {
-            for (int kj = 0; kj < 60; ++kj) {
-                float AtA_ij = J[ki] * J[kj];
-                int ij = idx[ki] * n_vars + idx[kj];
-                atomicAdd(AtA_ptr + ij, AtA_ij);
-            }
-            float Atb_i = J[ki] * r;
-            atomicAdd(Atb_ptr + idx[ki], Atb_i);
-        }
-        atomicAdd(residual_ptr, r * r);
-#else
-#pragma omp critical(FillInSLACAlignmentTermCPU)
-        {
-            for (int ki = 0; ki < 60; ++ki) {
-                for (int kj = 0; kj < 60; ++kj) {
-                    AtA_ptr[idx[ki] * n_vars + idx[kj]]
-                      += J[ki] * J[kj];
-                 }
-                 Atb_ptr[idx[ki]] += J[ki] * r;
+        // Outliers keep their column indices but do not contribute.
+        if (abs(r_p) > threshold) {
+            for (int k = 0; k < 60; ++k) {
+                J[k] = 0;
             }
-            *residual_ptr += r * r;
+            r_p = 0;
         }
-#endif
+        r_ptr[workload_idx] = r_p;
     });
 }
 
 #if defined(__CUDACC__)
-void FillInSLACRegularizerTermCUDA
+void FillInSLACRegularizerJacobianCUDA
 #else
-void FillInSLACRegularizerTermCPU
+void FillInSLACRegularizerJacobianCPU
 #endif
-        (core::Tensor &AtA,
-         core::Tensor &Atb,
-         core::Tensor &residual,
+        (core::Tensor &jacobians,
+         core::Tensor &jacobian_indices,
+         core::Tensor &residuals,
          const core::Tensor &grid_idx,
          const core::Tensor &grid_nbs_idx,
          const core::Tensor &grid_nbs_mask,
@@ -319,11 +300,11 @@ void FillInSLACRegularizerTermCPU
          int anchor_idx) {
 
     int64_t n = grid_idx.GetLength();
-    int64_t n_vars = Atb.GetLength();
+    float sqrt_weight = sqrt(weight);
 
-    float *AtA_ptr = static_cast<float *>(AtA.GetDataPtr());
-    float *Atb_ptr = static_cast<float *>(Atb.GetDataPtr());
-    float *residual_ptr = static_cast<float *>(residual.GetDataPtr());
+    float *J_ptr = static_cast<float *>(jacobians.GetDataPtr());
+    int *J_idx_ptr = static_cast<int *>(jacobian_indices.GetDataPtr());
+    float *r_ptr = static_cast<float *>(residuals.GetDataPtr());
 
     const int *grid_idx_ptr = static_cast<const int *>(grid_idx.GetDataPtr());
     const int *grid_nbs_idx_ptr =
@@ -349,6 +330,18 @@ void FillInSLACRegularizerTermCPU
         const int *idx_nbs = grid_nbs_idx_ptr + 6 * workload_idx;
         const bool *mask_nbs = grid_nbs_mask_ptr + 6 * workload_idx;
 
+        // 6 neighbors x 3 axes rows of 2 entries each. Rows of missing
+        // neighbors stay zero.
+        float *J = J_ptr + 36 * workload_idx;
+        int *idx = J_idx_ptr + 36 * workload_idx;
+        float *r_local = r_ptr + 18 * workload_idx;
+        int offset_idx_i = 3 * idx_i + 6 * n_frags;
+        for (int row = 0; row < 18; ++row) {
+            J[2 * row + 0] = J[2 * row + 1] = 0;
+            idx[2 * row + 0] = idx[2 * row + 1] = offset_idx_i + row % 3;
+            r_local[row] = 0;
+        }
+
         // Build a 3x3 linear system to compute the local R
         float cov[3][3] = {{0}};
         float U[3][3], V[3][3], S[3];
@@ -440,64 +433,212 @@ void FillInSLACRegularizerTermCPU
                 local_r[1] = diff_ik_curr[1] - R_diff_ik_curr[1];
                 local_r[2] = diff_ik_curr[2] - R_diff_ik_curr[2];
 
-                int offset_idx_i = 3 * idx_i + 6 * n_frags;
                 int offset_idx_k = 3 * idx_k + 6 * n_frags;
+                for (int axis = 0; axis < 3; ++axis) {
+                    int row = 3 * k + axis;
+                    J[2 * row + 0] = sqrt_weight;
+                    J[2 * row + 1] = -sqrt_weight;
+                    idx[2 * row + 1] = offset_idx_k + axis;
+                    r_local[row] = sqrt_weight * local_r[axis];
+                }
+            }
+        }
+    });
+}
+
+/// C = A @ B for row-major 4 x 4 matrices.
+OPEN3D_HOST_DEVICE inline void PoseGraphMatmul4x4(const float *A,
+                                                  const float *B,
+                                                  float *C) {
+    for (int r = 0; r < 4; ++r) {
+        for (int c = 0; c < 4; ++c) {
+            C[r * 4 + c] = A[r * 4 + 0] * B[0 * 4 + c] +
+                           A[r * 4 + 1] * B[1 * 4 + c] +
+                           A[r * 4 + 2] * B[2 * 4 + c] +
+                           A[r * 4 + 3] * B[3 * 4 + c];
+        }
+    }
+}
+
+/// Inverse of a row-major 4 x 4 rigid transformation.
+OPEN3D_HOST_DEVICE inline void PoseGraphInverseRigid(const float *T,
+                                                     float *T_inv) {
+    for (int r = 0; r < 3; ++r) {
+        for (int c = 0; c < 3; ++c) {
+            T_inv[r * 4 + c] = T[c * 4 + r];
+        }
+        T_inv[r * 4 + 3] = -(T[0 * 4 + r] * T[0 * 4 + 3] +
+                             T[1 * 4 + r] * T[1 * 4 + 3] +
+                             T[2 * 4 + r] * T[2 * 4 + 3]);
+    }
+    T_inv[12] = T_inv[13] = T_inv[14] = 0;
+    T_inv[15] = 1;
+}
+
+/// Linearized [alpha beta gamma a b c] of a near identity transformation, as
+/// GetLinearized6DVector() of the legacy global optimization.
+OPEN3D_HOST_DEVICE inline void PoseGraphLinearize(const float *T, float *v) {
+    v[0] = (-T[1 * 4 + 2] + T[2 * 4 + 1]) * 0.5f;
+    v[1] = (-T[2 * 4 + 0] + T[0 * 4 + 2]) * 0.5f;
+    v[2] = (-T[0 * 4 + 1] + T[1 * 4 + 0]) * 0.5f;
+    v[3] = T[0 * 4 + 3];
+    v[4] = T[1 * 4 + 3];
+    v[5] = T[2 * 4 + 3];
+}
 
 #if defined(__CUDACC__)
-                // Update residual
-                atomicAdd(residual_ptr, weight * (local_r[0] * local_r[0] +
-                                                  local_r[1] * local_r[1] +
-                                                  local_r[2] * local_r[2]));
+void FillInPoseGraphTermCUDA
+#else
+void FillInPoseGraphTermCPU
+#endif
+        (core::Tensor &AtA,
+         core::Tensor &Atb,
+         core::Tensor &edge_residuals,
+         const core::Tensor &poses,
+         const core::Tensor &edge_indices,
+         const core::Tensor &edge_transformations,
+         const core::Tensor &edge_information,
+         const core::Tensor &edge_confidence) {
+    int64_t n = edge_indices.GetLength();
+    int64_t n_vars = Atb.GetLength();
 
-                for (int axis = 0; axis < 3; ++axis) {
-                    // Update AtA: 2x2
-                    atomicAdd(&AtA_ptr[(offset_idx_i + axis) * n_vars +
-                                       offset_idx_i + axis],
-                              weight);
-                    atomicAdd(&AtA_ptr[(offset_idx_k + axis) * n_vars +
-                                       offset_idx_k + axis],
-                              weight);
-                    atomicAdd(&AtA_ptr[(offset_idx_i + axis) * n_vars +
-                                       offset_idx_k + axis],
-                              -weight);
-                    atomicAdd(&AtA_ptr[(offset_idx_k + axis) * n_vars +
-                                       offset_idx_i + axis],
-                              -weight);
-
-                    // Update Atb: 2x1
-                    atomicAdd(&Atb_ptr[offset_idx_i + axis],
-                              +weight * local_r[axis]);
-                    atomicAdd(&Atb_ptr[offset_idx_k + axis],
-                              -weight * local_r[axis]);
+    float *AtA_ptr = static_cast<float *>(AtA.GetDataPtr());
+    float *Atb_ptr = static_cast<float *>(Atb.GetDataPtr());
+    float *edge_residuals_ptr =
+            static_cast<float *>(edge_residuals.GetDataPtr());
+
+    const float *poses_ptr = static_cast<const float *>(poses.GetDataPtr());
+    const int64_t *edge_indices_ptr =
+            static_cast<const int64_t *>(edge_indices.GetDataPtr());
+    const float *edge_transformations_ptr =
+            static_cast<const float *>(edge_transformations.GetDataPtr());
+    const float *edge_information_ptr =
+            static_cast<const float *>(edge_information.GetDataPtr());
+    const float *edge_confidence_ptr =
+            static_cast<const float *>(edge_confidence.GetDataPtr());
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        int64_t s = edge_indices_ptr[2 * workload_idx + 0];
+        int64_t t = edge_indices_ptr[2 * workload_idx + 1];
+        const float *Ts = poses_ptr + 16 * s;
+        const float *Tt = poses_ptr + 16 * t;
+        const float *X = edge_transformations_ptr + 16 * workload_idx;
+        const float *info = edge_information_ptr + 36 * workload_idx;
+        float confidence = edge_confidence_ptr[workload_idx];
+
+        // e = lin(X^-1 @ Tt^-1 @ Ts)
+        float X_inv[16], Tt_inv[16], A[16], A_Ts[16];
+        PoseGraphInverseRigid(X, X_inv);
+        PoseGraphInverseRigid(Tt, Tt_inv);
+        PoseGraphMatmul4x4(X_inv, Tt_inv, A);
+        PoseGraphMatmul4x4(A, Ts, A_Ts);
+        float e[6];
+        PoseGraphLinearize(A_Ts, e);
+
+        // Column k of Js is lin(A @ G_k @ Ts) with the generators G_k of the
+        // linearized SE(3), and Jt = -Js.
+        float Js[6][6];
+        for (int k = 0; k < 6; ++k) {
+            float G[16] = {0};
+            switch (k) {
+                case 0:
+                    G[1 * 4 + 2] = -1;
+                    G[2 * 4 + 1] = 1;
+                    break;
+                case 1:
+                    G[0 * 4 + 2] = 1;
+                    G[2 * 4 + 0] = -1;
+                    break;
+                case 2:
+                    G[0 * 4 + 1] = -1;
+                    G[1 * 4 + 0] = 1;
+                    break;
+                default:
+                    G[(k - 3) * 4 + 3] = 1;
+                    break;
+            }
+            float G_Ts[16], A_G_Ts[16], column[6];
+            PoseGraphMatmul4x4(G, Ts, G_Ts);
+            PoseGraphMatmul4x4(A, G_Ts, A_G_Ts);
+            PoseGraphLinearize(A_G_Ts, column);
+            for (int r = 0; r < 6; ++r) {
+                Js[r][k] = column[r];
+            }
+        }
+
+        // JsT_info = Js^T @ info, H = c * JsT_info @ Js, b = c * JsT_info @ e
+        float JsT_info[6][6];
+        for (int r = 0; r < 6; ++r) {
+            for (int c = 0; c < 6; ++c) {
+                float sum = 0;
+                for (int k = 0; k < 6; ++k) {
+                    sum += Js[k][r] * info[k * 6 + c];
+                }
+                JsT_info[r][c] = sum;
+            }
+        }
+        float H[6][6], b[6];
+        for (int r = 0; r < 6; ++r) {
+            for (int c = 0; c < 6; ++c) {
+                float sum = 0;
+                for (int k = 0; k < 6; ++k) {
+                    sum += JsT_info[r][k] * Js[k][c];
                 }
+                H[r][c] = confidence * sum;
+            }
+            float sum = 0;
+            for (int k = 0; k < 6; ++k) {
+                sum += JsT_info[r][k] * e[k];
+            }
+            b[r] = confidence * sum;
+        }
+
+        float r2 = 0;
+        for (int r = 0; r < 6; ++r) {
+            for (int c = 0; c < 6; ++c) {
+                r2 += e[r] * info[r * 6 + c] * e[c];
+            }
+        }
+        edge_residuals_ptr[workload_idx] = r2;
+
+        int64_t offset_s = 6 * s;
+        int64_t offset_t = 6 * t;
+#if defined(__CUDACC__)
+        for (int r = 0; r < 6; ++r) {
+            for (int c = 0; c < 6; ++c) {
+                atomicAdd(&AtA_ptr[(offset_s + r) * n_vars + offset_s + c],
+                          H[r][c]);
+                atomicAdd(&AtA_ptr[(offset_s + r) * n_vars + offset_t + c],
+                          -H[r][c]);
+                atomicAdd(&AtA_ptr[(offset_t + r) * n_vars + offset_s + c],
+                          -H[r][c]);
+                atomicAdd(&AtA_ptr[(offset_t + r) * n_vars + offset_t + c],
+                          H[r][c]);
+            }
+            atomicAdd(&Atb_ptr[offset_s + r], b[r]);
+            atomicAdd(&Atb_ptr[offset_t + r], -b[r]);
+        }
 #else
-#pragma omp critical(FillInSLACRegularizerTermCPU)
-                {
-                    // Update residual
-                    *residual_ptr += weight * (local_r[0] * local_r[0] +
-                                               local_r[1] * local_r[1] +
-                                               local_r[2] * local_r[2]);
-
-                    for (int axis = 0; axis < 3; ++axis) {
-                        // Update AtA: 2x2
-                        AtA_ptr[(offset_idx_i + axis) * n_vars +
-                                 offset_idx_i + axis] += weight;
-                        AtA_ptr[(offset_idx_k + axis) * n_vars +
-                                 offset_idx_k + axis] += weight;
-
-                        AtA_ptr[(offset_idx_i + axis) * n_vars +
-                                 offset_idx_k + axis] -= weight;
-                        AtA_ptr[(offset_idx_k + axis) * n_vars +
-                                 offset_idx_i + axis] -= weight;
-
-                        // Update Atb: 2x1
-                        Atb_ptr[offset_idx_i + axis] += weight * local_r[axis];
-                        Atb_ptr[offset_idx_k + axis] -= weight * local_r[axis];
-                    }
+#pragma omp critical(FillInPoseGraphTermCPU)
+        {
+            for (int r = 0; r < 6; ++r) {
+                for (int c = 0; c < 6; ++c) {
+                    AtA_ptr[(offset_s + r) * n_vars + offset_s + c] += H[r][c];
+                    AtA_ptr[(offset_s + r) * n_vars + offset_t + c] -= H[r][c];
+                    AtA_ptr[(offset_t + r) * n_vars + offset_s + c] -= H[r][c];
+                    AtA_ptr[(offset_t + r) * n_vars + offset_t + c] += H[r][c];
                 }
-#endif
+                Atb_ptr[offset_s + r] += b[r];
+                Atb_ptr[offset_t + r] -= b[r];
             }
         }
+#endif
     });
 }
 }  // namespace kernel
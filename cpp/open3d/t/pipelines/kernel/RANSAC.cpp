@@ -0,0 +1,90 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/RANSAC.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+void EstimateAndScoreRANSACHypotheses(const core::Tensor &source_points,
+                                      const core::Tensor &target_points,
+                                      int64_t num_hypotheses,
+                                      int ransac_n,
+                                      uint64_t seed,
+                                      double max_correspondence_distance,
+                                      core::Tensor &transformations,
+                                      core::Tensor &inlier_counts,
+                                      core::Tensor &inlier_residuals) {
+    core::Dtype dtype = core::Dtype::Float32;
+    core::Device device = source_points.GetDevice();
+
+    source_points.AssertDtype(dtype);
+    target_points.AssertDtype(dtype);
+    target_points.AssertDevice(device);
+    source_points.AssertShapeCompatible({utility::nullopt, 3});
+    target_points.AssertShape(source_points.GetShape());
+    if (ransac_n < 3 || source_points.GetLength() < ransac_n) {
+        utility::LogError(
+                "ransac_n must be at least 3 and at most the number of "
+                "correspondences {}, but got {}.",
+                source_points.GetLength(), ransac_n);
+    }
+
+    const core::Tensor source_points_contiguous = source_points.Contiguous();
+    const core::Tensor target_points_contiguous = target_points.Contiguous();
+    transformations =
+            core::Tensor::Empty({num_hypotheses, 3, 4}, dtype, device);
+    inlier_counts =
+            core::Tensor::Empty({num_hypotheses}, core::Dtype::Int64, device);
+    inlier_residuals = core::Tensor::Empty({num_hypotheses}, dtype, device);
+    if (num_hypotheses == 0) {
+        return;
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EstimateAndScoreRANSACHypothesesCPU(
+                source_points_contiguous, target_points_contiguous,
+                num_hypotheses, ransac_n, seed,
+                static_cast<float>(max_correspondence_distance),
+                transformations, inlier_counts, inlier_residuals);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(EstimateAndScoreRANSACHypothesesCUDA,
+                  source_points_contiguous, target_points_contiguous,
+                  num_hypotheses, ransac_n, seed,
+                  static_cast<float>(max_correspondence_distance),
+                  transformations, inlier_counts, inlier_residuals);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
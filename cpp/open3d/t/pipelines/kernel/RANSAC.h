@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// \brief Estimates a batch of RANSAC hypotheses and scores them all against
+/// the correspondence set.
+///
+/// Hypothesis h is the rigid transformation estimated by the Kabsch algorithm
+/// from ransac_n correspondences drawn at random from a generator seeded by
+/// \p seed and h, and is scored by its number of inlier correspondences,
+/// whose transformed source point is closer than
+/// \p max_correspondence_distance to its target point.
+///
+/// \param source_points Source point of each correspondence, of shape {C, 3}
+/// and dtype Float32.
+/// \param target_points Target point of each correspondence, of shape {C, 3}
+/// and dtype Float32.
+/// \param num_hypotheses Number of hypotheses B of the batch.
+/// \param ransac_n Number of correspondences of a sample, at least 3.
+/// \param seed Seed of the batch.
+/// \param max_correspondence_distance Inlier threshold.
+/// \param transformations Output {B, 3, 4} Float32 tensor of the rotations
+/// and translations of the hypotheses.
+/// \param inlier_counts Output {B} Int64 tensor of the numbers of inliers.
+/// \param inlier_residuals Output {B} Float32 tensor of the sums of the
+/// squared distances of the inliers.
+void EstimateAndScoreRANSACHypotheses(const core::Tensor &source_points,
+                                      const core::Tensor &target_points,
+                                      int64_t num_hypotheses,
+                                      int ransac_n,
+                                      uint64_t seed,
+                                      double max_correspondence_distance,
+                                      core::Tensor &transformations,
+                                      core::Tensor &inlier_counts,
+                                      core::Tensor &inlier_residuals);
+
+void EstimateAndScoreRANSACHypothesesCPU(const core::Tensor &source_points,
+                                         const core::Tensor &target_points,
+                                         int64_t num_hypotheses,
+                                         int ransac_n,
+                                         uint64_t seed,
+                                         float max_correspondence_distance,
+                                         core::Tensor &transformations,
+                                         core::Tensor &inlier_counts,
+                                         core::Tensor &inlier_residuals);
+
+#ifdef BUILD_CUDA_MODULE
+void EstimateAndScoreRANSACHypothesesCUDA(const core::Tensor &source_points,
+                                          const core::Tensor &target_points,
+                                          int64_t num_hypotheses,
+                                          int ransac_n,
+                                          uint64_t seed,
+                                          float max_correspondence_distance,
+                                          core::Tensor &transformations,
+                                          core::Tensor &inlier_counts,
+                                          core::Tensor &inlier_residuals);
+#endif
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/kernel/CPULauncher.h"
+#include "open3d/t/pipelines/kernel/RANSAC.h"
+#include "open3d/t/pipelines/kernel/RANSACImpl.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+void EstimateAndScoreRANSACHypothesesCPU(const core::Tensor &source_points,
+                                         const core::Tensor &target_points,
+                                         int64_t num_hypotheses,
+                                         int ransac_n,
+                                         uint64_t seed,
+                                         float max_correspondence_distance,
+                                         core::Tensor &transformations,
+                                         core::Tensor &inlier_counts,
+                                         core::Tensor &inlier_residuals) {
+    const int64_t num_correspondences = source_points.GetLength();
+    const float max_distance2 =
+            max_correspondence_distance * max_correspondence_distance;
+
+    const float *source_points_ptr = source_points.GetDataPtr<float>();
+    const float *target_points_ptr = target_points.GetDataPtr<float>();
+    float *transformations_ptr = transformations.GetDataPtr<float>();
+    int64_t *inlier_counts_ptr = inlier_counts.GetDataPtr<int64_t>();
+    float *inlier_residuals_ptr = inlier_residuals.GetDataPtr<float>();
+
+    // Each thread estimates and scores whole hypotheses, so that the scores
+    // need no reduction across threads.
+    core::kernel::cpu_launcher::ParallelFor(
+            num_hypotheses, [&](int64_t hypothesis_idx) {
+                float *T_3x4 = transformations_ptr + 12 * hypothesis_idx;
+                EstimateRANSACHypothesis(hypothesis_idx, source_points_ptr,
+                                         target_points_ptr,
+                                         num_correspondences, ransac_n, seed,
+                                         T_3x4);
+
+                int64_t count = 0;
+                double residual = 0;
+                for (int64_t c = 0; c < num_correspondences; ++c) {
+                    float distance2;
+                    if (IsRANSACInlier(T_3x4, source_points_ptr + 3 * c,
+                                       target_points_ptr + 3 * c,
+                                       max_distance2, distance2)) {
+                        ++count;
+                        residual += distance2;
+                    }
+                }
+                inlier_counts_ptr[hypothesis_idx] = count;
+                inlier_residuals_ptr[hypothesis_idx] =
+                        static_cast<float>(residual);
+            });
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cuda.h>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/kernel/CUDALauncher.cuh"
+#include "open3d/t/pipelines/kernel/RANSAC.h"
+#include "open3d/t/pipelines/kernel/RANSACImpl.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+const int kThread1DUnit = 256;
+
+/// Scores hypothesis blockIdx.x, with the correspondences strided over the
+/// threads of the block and a shared memory reduction of their scores.
+__global__ void ScoreRANSACHypothesesCUDAKernel(
+        const float *source_points_ptr,
+        const float *target_points_ptr,
+        const int64_t num_correspondences,
+        const float *transformations_ptr,
+        const float max_distance2,
+        int64_t *inlier_counts_ptr,
+        float *inlier_residuals_ptr) {
+    __shared__ int64_t local_count[kThread1DUnit];
+    __shared__ float local_residual[kThread1DUnit];
+
+    const int tid = threadIdx.x;
+    const int64_t hypothesis_idx = blockIdx.x;
+    const float *T_3x4 = transformations_ptr + 12 * hypothesis_idx;
+
+    int64_t count = 0;
+    float residual = 0;
+    for (int64_t c = tid; c < num_correspondences; c += kThread1DUnit) {
+        float distance2;
+        if (IsRANSACInlier(T_3x4, source_points_ptr + 3 * c,
+                           target_points_ptr + 3 * c, max_distance2,
+                           distance2)) {
+            ++count;
+            residual += distance2;
+        }
+    }
+    local_count[tid] = count;
+    local_residual[tid] = residual;
+    __syncthreads();
+
+    for (int stride = kThread1DUnit / 2; stride > 0; stride >>= 1) {
+        if (tid < stride) {
+            local_count[tid] += local_count[tid + stride];
+            local_residual[tid] += local_residual[tid + stride];
+        }
+        __syncthreads();
+    }
+    if (tid == 0) {
+        inlier_counts_ptr[hypothesis_idx] = local_count[0];
+        inlier_residuals_ptr[hypothesis_idx] = local_residual[0];
+    }
+}
+
+void EstimateAndScoreRANSACHypothesesCUDA(const core::Tensor &source_points,
+                                          const core::Tensor &target_points,
+                                          int64_t num_hypotheses,
+                                          int ransac_n,
+                                          uint64_t seed,
+                                          float max_correspondence_distance,
+                                          core::Tensor &transformations,
+                                          core::Tensor &inlier_counts,
+                                          core::Tensor &inlier_residuals) {
+    const int64_t num_correspondences = source_points.GetLength();
+    const float max_distance2 =
+            max_correspondence_distance * max_correspondence_distance;
+
+    const float *source_points_ptr = source_points.GetDataPtr<float>();
+    const float *target_points_ptr = target_points.GetDataPtr<float>();
+    float *transformations_ptr = transformations.GetDataPtr<float>();
+    int64_t *inlier_counts_ptr = inlier_counts.GetDataPtr<int64_t>();
+    float *inlier_residuals_ptr = inlier_residuals.GetDataPtr<float>();
+
+    core::kernel::cuda_launcher::ParallelFor(
+            num_hypotheses, [=] OPEN3D_DEVICE(int64_t hypothesis_idx) {
+                EstimateRANSACHypothesis(
+                        hypothesis_idx, source_points_ptr, target_points_ptr,
+                        num_correspondences, ransac_n, seed,
+                        transformations_ptr + 12 * hypothesis_idx);
+            });
+
+    // One block per hypothesis scores the whole batch in a single launch.
+    ScoreRANSACHypothesesCUDAKernel<<<num_hypotheses, kThread1DUnit>>>(
+            source_points_ptr, target_points_ptr, num_correspondences,
+            transformations_ptr, max_distance2, inlier_counts_ptr,
+            inlier_residuals_ptr);
+
+    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,153 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/linalg/kernel/Matrix.h"
+#include "open3d/core/linalg/kernel/SVD3x3.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// Returns the next number of the SplitMix64 generator of \p state, whose
+/// streams started at different states do not overlap as long as they are
+/// shorter than the difference of the states in increments.
+OPEN3D_HOST_DEVICE inline uint64_t SplitMix64(uint64_t &state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/// Estimates hypothesis \p hypothesis_idx of a RANSAC batch by the Kabsch
+/// algorithm from \p ransac_n correspondences drawn at random, and writes
+/// the rotation and translation to the row-major {3, 4} \p T_3x4.
+OPEN3D_DEVICE inline void EstimateRANSACHypothesis(
+        int64_t hypothesis_idx,
+        const float *source_points_ptr,
+        const float *target_points_ptr,
+        int64_t num_correspondences,
+        int ransac_n,
+        uint64_t seed,
+        float *T_3x4) {
+    // Each hypothesis draws from its own part of the stream of the batch.
+    uint64_t state = seed + uint64_t(hypothesis_idx) * uint64_t(ransac_n) *
+                                    0x9E3779B97F4A7C15ULL;
+
+    // Sums of the points and of their products, relative to the first sample
+    // for precision.
+    const float *s0 = nullptr;
+    const float *t0 = nullptr;
+    double sum_s[3] = {0, 0, 0}, sum_t[3] = {0, 0, 0};
+    double H[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    for (int j = 0; j < ransac_n; ++j) {
+        const int64_t c = int64_t(SplitMix64(state) %
+                                  uint64_t(num_correspondences));
+        const float *s = source_points_ptr + 3 * c;
+        const float *t = target_points_ptr + 3 * c;
+        if (j == 0) {
+            s0 = s;
+            t0 = t;
+        }
+        const double ds[3] = {s[0] - s0[0], s[1] - s0[1], s[2] - s0[2]};
+        const double dt[3] = {t[0] - t0[0], t[1] - t0[1], t[2] - t0[2]};
+        for (int i = 0; i < 3; ++i) {
+            sum_s[i] += ds[i];
+            sum_t[i] += dt[i];
+            for (int k = 0; k < 3; ++k) {
+                H[3 * i + k] += ds[i] * dt[k];
+            }
+        }
+    }
+
+    // Cross-covariance H = U S V^T of the centered samples, R = V U^T. The
+    // decomposition is done in single precision like in the SLAC kernels.
+    const double inv_n = 1.0 / ransac_n;
+    float H_centered[9];
+    for (int i = 0; i < 3; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            H_centered[3 * i + k] = static_cast<float>(
+                    H[3 * i + k] - sum_s[i] * sum_t[k] * inv_n);
+        }
+    }
+    float U[9], S[3], V[9];
+    core::linalg::kernel::svd3x3(H_centered, U, S, V);
+    float R[9];
+    for (int i = 0; i < 3; ++i) {
+        for (int k = 0; k < 3; ++k) {
+            R[3 * i + k] = V[3 * i + 0] * U[3 * k + 0] +
+                           V[3 * i + 1] * U[3 * k + 1] +
+                           V[3 * i + 2] * U[3 * k + 2];
+        }
+    }
+    // Reflections are turned into rotations by flipping the direction of the
+    // smallest singular value.
+    if (core::linalg::kernel::det3x3(R) < 0) {
+        for (int i = 0; i < 3; ++i) {
+            for (int k = 0; k < 3; ++k) {
+                R[3 * i + k] -= 2 * V[3 * i + 2] * U[3 * k + 2];
+            }
+        }
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        const double t_i = t0[i] + sum_t[i] * inv_n -
+                           R[3 * i + 0] * (s0[0] + sum_s[0] * inv_n) -
+                           R[3 * i + 1] * (s0[1] + sum_s[1] * inv_n) -
+                           R[3 * i + 2] * (s0[2] + sum_s[2] * inv_n);
+        T_3x4[4 * i + 0] = R[3 * i + 0];
+        T_3x4[4 * i + 1] = R[3 * i + 1];
+        T_3x4[4 * i + 2] = R[3 * i + 2];
+        T_3x4[4 * i + 3] = static_cast<float>(t_i);
+    }
+}
+
+/// Returns true if the source point \p s transformed by \p T_3x4 is closer
+/// than the square root of \p max_distance2 to the target point \p t, with
+/// their squared distance in \p distance2.
+OPEN3D_HOST_DEVICE inline bool IsRANSACInlier(const float *T_3x4,
+                                              const float *s,
+                                              const float *t,
+                                              float max_distance2,
+                                              float &distance2) {
+    distance2 = 0;
+    for (int i = 0; i < 3; ++i) {
+        const float d = T_3x4[4 * i + 0] * s[0] + T_3x4[4 * i + 1] * s[1] +
+                        T_3x4[4 * i + 2] * s[2] + T_3x4[4 * i + 3] - t[i];
+        distance2 += d * d;
+    }
+    return distance2 < max_distance2;
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
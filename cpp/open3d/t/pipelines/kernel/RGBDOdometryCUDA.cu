@@ -54,25 +54,18 @@ __global__ void ComputeOdometryResultPointToPlaneCUDAKernel(
         const float depth_outlier_trunc,
         const float depth_huber_delta) {
     const int kBlockSize = 256;
-    __shared__ float local_sum0[kBlockSize];
-    __shared__ float local_sum1[kBlockSize];
-    __shared__ float local_sum2[kBlockSize];
-
     const int x = threadIdx.x + blockIdx.x * blockDim.x;
     const int y = threadIdx.y + blockIdx.y * blockDim.y;
     const int tid = threadIdx.x + threadIdx.y * blockDim.x;
 
-    local_sum0[tid] = 0;
-    local_sum1[tid] = 0;
-    local_sum2[tid] = 0;
-
-    if (y >= rows || x >= cols) return;
-
+    // Out of bound threads take part in the block reduction as invalid.
     float J[6] = {0}, reduction[21 + 6 + 2];
     float r = 0;
-    bool valid = GetJacobianPointToPlane(
-            x, y, depth_outlier_trunc, source_vertex_indexer,
-            target_vertex_indexer, target_normal_indexer, ti, J, r);
+    bool valid = y < rows && x < cols &&
+                 GetJacobianPointToPlane(x, y, depth_outlier_trunc,
+                                         source_vertex_indexer,
+                                         target_vertex_indexer,
+                                         target_normal_indexer, ti, J, r);
 
     float d_huber = HuberDeriv(r, depth_huber_delta);
     float r_huber = HuberLoss(r, depth_huber_delta);
@@ -90,37 +83,8 @@ __global__ void ComputeOdometryResultPointToPlaneCUDAKernel(
     reduction[offset++] = r_huber;
     reduction[offset++] = valid;
 
-    // Sum reduction: JtJ(21) and Jtr(6)
-    for (size_t i = 0; i < 27; i += 3) {
-        local_sum0[tid] = valid ? reduction[i + 0] : 0;
-        local_sum1[tid] = valid ? reduction[i + 1] : 0;
-        local_sum2[tid] = valid ? reduction[i + 2] : 0;
-        __syncthreads();
-
-        BlockReduceSum<float, kBlockSize>(tid, local_sum0, local_sum1,
-                                          local_sum2);
-
-        if (tid == 0) {
-            atomicAdd(&global_sum[i + 0], local_sum0[0]);
-            atomicAdd(&global_sum[i + 1], local_sum1[0]);
-            atomicAdd(&global_sum[i + 2], local_sum2[0]);
-        }
-        __syncthreads();
-    }
-
-    // Sum reduction: residual(1) and inlier(1)
-    {
-        local_sum0[tid] = valid ? reduction[27] : 0;
-        local_sum1[tid] = valid ? reduction[28] : 0;
-        __syncthreads();
-
-        BlockReduceSum<float, kBlockSize>(tid, local_sum0, local_sum1);
-        if (tid == 0) {
-            atomicAdd(&global_sum[27], local_sum0[0]);
-            atomicAdd(&global_sum[28], local_sum1[0]);
-        }
-        __syncthreads();
-    }
+    WarpReduceSum6x6LinearSystem<float, kBlockSize>(tid, valid, reduction,
+                                                    global_sum);
 }
 
 void ComputeOdometryResultPointToPlaneCUDA(
@@ -158,7 +122,9 @@ void ComputeOdometryResultPointToPlaneCUDA(
             source_vertex_indexer, target_vertex_indexer, target_normal_indexer,
             ti, global_sum_ptr, rows, cols, depth_outlier_trunc,
             depth_huber_delta);
-    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    // DecodeAndSolve6x6() copies the sums to the host, which waits for the
+    // kernel.
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
     DecodeAndSolve6x6(global_sum, delta, inlier_residual, inlier_count);
 }
 
@@ -177,27 +143,20 @@ __global__ void ComputeOdometryResultIntensityCUDAKernel(
         const float depth_outlier_trunc,
         const float intensity_huber_delta) {
     const int kBlockSize = 256;
-    __shared__ float local_sum0[kBlockSize];
-    __shared__ float local_sum1[kBlockSize];
-    __shared__ float local_sum2[kBlockSize];
-
     const int x = threadIdx.x + blockIdx.x * blockDim.x;
     const int y = threadIdx.y + blockIdx.y * blockDim.y;
     const int tid = threadIdx.x + threadIdx.y * blockDim.x;
 
-    local_sum0[tid] = 0;
-    local_sum1[tid] = 0;
-    local_sum2[tid] = 0;
-
-    if (y >= rows || x >= cols) return;
-
+    // Out of bound threads take part in the block reduction as invalid.
     float J[6] = {0}, reduction[21 + 6 + 2];
     float r = 0;
-    bool valid = GetJacobianIntensity(
-            x, y, depth_outlier_trunc, source_depth_indexer,
-            target_depth_indexer, source_intensity_indexer,
-            target_intensity_indexer, target_intensity_dx_indexer,
-            target_intensity_dy_indexer, source_vertex_indexer, ti, J, r);
+    bool valid = y < rows && x < cols &&
+                 GetJacobianIntensity(
+                         x, y, depth_outlier_trunc, source_depth_indexer,
+                         target_depth_indexer, source_intensity_indexer,
+                         target_intensity_indexer, target_intensity_dx_indexer,
+                         target_intensity_dy_indexer, source_vertex_indexer, ti,
+                         J, r);
 
     float d_huber = HuberDeriv(r, intensity_huber_delta);
     float r_huber = HuberLoss(r, intensity_huber_delta);
@@ -210,14 +169,13 @@ __global__ void ComputeOdometryResultIntensityCUDAKernel(
         }
     }
     for (int i = 0; i < 6; ++i) {
-        reduction[offset++] = J[i] * HuberDeriv(r, intensity_huber_delta);
+        reduction[offset++] = J[i] * d_huber;
     }
-    reduction[offset++] = HuberLoss(r, intensity_huber_delta);
+    reduction[offset++] = r_huber;
     reduction[offset++] = valid;
 
-    ReduceSum6x6LinearSystem<float, kBlockSize>(tid, valid, reduction,
-                                                local_sum0, local_sum1,
-                                                local_sum2, global_sum);
+    WarpReduceSum6x6LinearSystem<float, kBlockSize>(tid, valid, reduction,
+                                                    global_sum);
 }
 
 void ComputeOdometryResultIntensityCUDA(
@@ -267,7 +225,7 @@ void ComputeOdometryResultIntensityCUDA(
             target_intensity_dx_indexer, target_intensity_dy_indexer,
             source_vertex_indexer, ti, global_sum_ptr, rows, cols,
             depth_outlier_trunc, intensity_huber_delta);
-    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
     DecodeAndSolve6x6(global_sum, delta, inlier_residual, inlier_count);
 }
 
@@ -289,29 +247,21 @@ __global__ void ComputeOdometryResultHybridCUDAKernel(
         const float depth_huber_delta,
         const float intensity_huber_delta) {
     const int kBlockSize = 256;
-    __shared__ float local_sum0[kBlockSize];
-    __shared__ float local_sum1[kBlockSize];
-    __shared__ float local_sum2[kBlockSize];
-
     const int x = threadIdx.x + blockIdx.x * blockDim.x;
     const int y = threadIdx.y + blockIdx.y * blockDim.y;
     const int tid = threadIdx.x + threadIdx.y * blockDim.x;
 
-    local_sum0[tid] = 0;
-    local_sum1[tid] = 0;
-    local_sum2[tid] = 0;
-
-    if (y >= rows || x >= cols) return;
-
+    // Out of bound threads take part in the block reduction as invalid.
     float J_I[6] = {0}, J_D[6] = {0}, reduction[21 + 6 + 2];
     float r_I = 0, r_D = 0;
-    bool valid = GetJacobianHybrid(
-            x, y, depth_outlier_trunc, source_depth_indexer,
-            target_depth_indexer, source_intensity_indexer,
-            target_intensity_indexer, target_depth_dx_indexer,
-            target_depth_dy_indexer, target_intensity_dx_indexer,
-            target_intensity_dy_indexer, source_vertex_indexer, ti, J_I, J_D,
-            r_I, r_D);
+    bool valid = y < rows && x < cols &&
+                 GetJacobianHybrid(
+                         x, y, depth_outlier_trunc, source_depth_indexer,
+                         target_depth_indexer, source_intensity_indexer,
+                         target_intensity_indexer, target_depth_dx_indexer,
+                         target_depth_dy_indexer, target_intensity_dx_indexer,
+                         target_intensity_dy_indexer, source_vertex_indexer, ti,
+                         J_I, J_D, r_I, r_D);
 
     float d_huber_D = HuberDeriv(r_D, depth_huber_delta);
     float d_huber_I = HuberDeriv(r_I, intensity_huber_delta);
@@ -332,9 +282,8 @@ __global__ void ComputeOdometryResultHybridCUDAKernel(
     reduction[offset++] = r_huber_D + r_huber_I;
     reduction[offset++] = valid;
 
-    ReduceSum6x6LinearSystem<float, kBlockSize>(tid, valid, reduction,
-                                                local_sum0, local_sum1,
-                                                local_sum2, global_sum);
+    WarpReduceSum6x6LinearSystem<float, kBlockSize>(tid, valid, reduction,
+                                                    global_sum);
 }
 
 void ComputeOdometryResultHybridCUDA(const core::Tensor& source_depth,
@@ -389,7 +338,7 @@ void ComputeOdometryResultHybridCUDA(const core::Tensor& source_depth,
             target_intensity_dx_indexer, target_intensity_dy_indexer,
             source_vertex_indexer, ti, global_sum_ptr, rows, cols,
             depth_outlier_trunc, depth_huber_delta, intensity_huber_delta);
-    OPEN3D_CUDA_CHECK(cudaDeviceSynchronize());
+    OPEN3D_CUDA_CHECK(cudaGetLastError());
     DecodeAndSolve6x6(global_sum, delta, inlier_residual, inlier_count);
 }
 
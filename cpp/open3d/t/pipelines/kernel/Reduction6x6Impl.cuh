@@ -186,6 +186,45 @@ __device__ inline void ReduceSum6x6LinearSystem(const int tid,
         __syncthreads();
     }
 }
+
+/// Sums the 6x6 linear system (JtJ(21), Jtr(6), residual(1), inlier(1)) of
+/// the threads of a block into global_sum. Each warp is reduced with
+/// shuffles and the warp sums through shared memory, with a single barrier
+/// and one atomic per value for the block. All threads of the block must
+/// call it, including the out of bound ones with valid = false.
+template <typename scalar_t, size_t BLOCK_SIZE>
+__device__ inline void WarpReduceSum6x6LinearSystem(const int tid,
+                                                    bool valid,
+                                                    const scalar_t* reduction,
+                                                    scalar_t* global_sum) {
+    static_assert(BLOCK_SIZE % 32 == 0,
+                  "BLOCK_SIZE must be a multiple of the warp size.");
+    const int kWarps = BLOCK_SIZE / 32;
+    const int kValues = 21 + 6 + 2;
+    __shared__ scalar_t warp_sums[kWarps][kValues];
+
+    const int lane = tid % 32;
+    const int warp = tid / 32;
+    for (int i = 0; i < kValues; ++i) {
+        scalar_t value = valid ? reduction[i] : 0;
+        for (int offset = 16; offset > 0; offset /= 2) {
+            value += __shfl_down_sync(0xffffffff, value, offset);
+        }
+        if (lane == 0) {
+            warp_sums[warp][i] = value;
+        }
+    }
+    __syncthreads();
+
+    if (tid < kValues) {
+        scalar_t sum = 0;
+        for (int w = 0; w < kWarps; ++w) {
+            sum += warp_sums[w][tid];
+        }
+        atomicAdd(&global_sum[tid], sum);
+    }
+}
+
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
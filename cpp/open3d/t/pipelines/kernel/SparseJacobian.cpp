@@ -0,0 +1,154 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/SparseJacobian.h"
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+static void AssertJacobian(const core::Tensor &jacobians,
+                           const core::Tensor &jacobian_indices) {
+    jacobians.AssertDtype(core::Dtype::Float32);
+    jacobian_indices.AssertDtype(core::Dtype::Int32);
+    if (jacobians.NumDims() != 2) {
+        utility::LogError("Jacobians should be a {R, K} tensor, but got {}.",
+                          jacobians.GetShape().ToString());
+    }
+    jacobian_indices.AssertShape(jacobians.GetShape());
+    jacobian_indices.AssertDevice(jacobians.GetDevice());
+    if (!jacobians.IsContiguous() || !jacobian_indices.IsContiguous()) {
+        utility::LogError("Jacobians and indices should be contiguous.");
+    }
+}
+
+static void AssertVector(const core::Tensor &vector,
+                         const core::Device &device) {
+    vector.AssertDtype(core::Dtype::Float32);
+    vector.AssertDevice(device);
+    if (!vector.IsContiguous()) {
+        utility::LogError("Vectors should be contiguous.");
+    }
+}
+
+void ComputeJtJx(const core::Tensor &jacobians,
+                 const core::Tensor &jacobian_indices,
+                 const core::Tensor &x,
+                 core::Tensor &y) {
+    AssertJacobian(jacobians, jacobian_indices);
+    core::Device device = jacobians.GetDevice();
+    AssertVector(x, device);
+    AssertVector(y, device);
+    if (x.NumElements() != y.NumElements()) {
+        utility::LogError("x and y should have the same length.");
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeJtJxCPU(jacobians, jacobian_indices, x, y);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeJtJxCUDA(jacobians, jacobian_indices, x, y);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeJtr(const core::Tensor &jacobians,
+                const core::Tensor &jacobian_indices,
+                const core::Tensor &residuals,
+                core::Tensor &Jtr) {
+    AssertJacobian(jacobians, jacobian_indices);
+    core::Device device = jacobians.GetDevice();
+    AssertVector(residuals, device);
+    AssertVector(Jtr, device);
+    residuals.AssertShape({jacobians.GetLength()});
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeJtrCPU(jacobians, jacobian_indices, residuals, Jtr);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeJtrCUDA(jacobians, jacobian_indices, residuals, Jtr);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ComputeJtJBlockDiagonal(const core::Tensor &jacobians,
+                             const core::Tensor &jacobian_indices,
+                             core::Tensor &blocks) {
+    AssertJacobian(jacobians, jacobian_indices);
+    core::Device device = jacobians.GetDevice();
+    AssertVector(blocks, device);
+    blocks.AssertShape({blocks.GetLength(), 3, 3});
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeJtJBlockDiagonalCPU(jacobians, jacobian_indices, blocks);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        ComputeJtJBlockDiagonalCUDA(jacobians, jacobian_indices, blocks);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void InvertBlockDiagonal(core::Tensor &blocks) {
+    core::Device device = blocks.GetDevice();
+    AssertVector(blocks, device);
+    blocks.AssertShape({blocks.GetLength(), 3, 3});
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        InvertBlockDiagonalCPU(blocks);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        InvertBlockDiagonalCUDA(blocks);
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+/// Products with the normal equations J^T @ J of a sparse Jacobian, stored as
+/// R rows of K entries: jacobians is {R, K} Float32 and jacobian_indices is
+/// {R, K} Int32, holding the column (variable) index of each entry. Vectors
+/// are {n_vars} or {n_vars, 1} Float32 on the same device. The variables are
+/// grouped in 3 x 3 blocks, so n_vars must be a multiple of 3.
+
+/// y += J^T @ (J @ x).
+void ComputeJtJx(const core::Tensor &jacobians,
+                 const core::Tensor &jacobian_indices,
+                 const core::Tensor &x,
+                 core::Tensor &y);
+
+/// Jtr += J^T @ residuals, where residuals is {R} Float32.
+void ComputeJtr(const core::Tensor &jacobians,
+                const core::Tensor &jacobian_indices,
+                const core::Tensor &residuals,
+                core::Tensor &Jtr);
+
+/// Accumulates the 3 x 3 diagonal blocks of J^T @ J into blocks, a
+/// {n_vars / 3, 3, 3} Float32 tensor.
+void ComputeJtJBlockDiagonal(const core::Tensor &jacobians,
+                             const core::Tensor &jacobian_indices,
+                             core::Tensor &blocks);
+
+/// Inverts the {B, 3, 3} Float32 blocks in place. Singular blocks are
+/// replaced by the inverse of their diagonal, or the identity where it is
+/// zero.
+void InvertBlockDiagonal(core::Tensor &blocks);
+
+void ComputeJtJxCPU(const core::Tensor &jacobians,
+                    const core::Tensor &jacobian_indices,
+                    const core::Tensor &x,
+                    core::Tensor &y);
+
+void ComputeJtrCPU(const core::Tensor &jacobians,
+                   const core::Tensor &jacobian_indices,
+                   const core::Tensor &residuals,
+                   core::Tensor &Jtr);
+
+void ComputeJtJBlockDiagonalCPU(const core::Tensor &jacobians,
+                                const core::Tensor &jacobian_indices,
+                                core::Tensor &blocks);
+
+void InvertBlockDiagonalCPU(core::Tensor &blocks);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeJtJxCUDA(const core::Tensor &jacobians,
+                     const core::Tensor &jacobian_indices,
+                     const core::Tensor &x,
+                     core::Tensor &y);
+
+void ComputeJtrCUDA(const core::Tensor &jacobians,
+                    const core::Tensor &jacobian_indices,
+                    const core::Tensor &residuals,
+                    core::Tensor &Jtr);
+
+void ComputeJtJBlockDiagonalCUDA(const core::Tensor &jacobians,
+                                 const core::Tensor &jacobian_indices,
+                                 core::Tensor &blocks);
+
+void InvertBlockDiagonalCUDA(core::Tensor &blocks);
+#endif
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,194 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/linalg/kernel/Matrix.h"
+#include "open3d/t/pipelines/kernel/SparseJacobian.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+// Atomically adds value to *address, from a ParallelFor on either device.
+OPEN3D_HOST_DEVICE inline void AtomicAddFloat(float *address, float value) {
+#if defined(__CUDA_ARCH__)
+    atomicAdd(address, value);
+#else
+#pragma omp atomic
+    *address += value;
+#endif
+}
+
+#if defined(__CUDACC__)
+void ComputeJtJxCUDA
+#else
+void ComputeJtJxCPU
+#endif
+        (const core::Tensor &jacobians,
+         const core::Tensor &jacobian_indices,
+         const core::Tensor &x,
+         core::Tensor &y) {
+    int64_t n = jacobians.GetLength();
+    int64_t K = jacobians.GetShape(1);
+
+    const float *J_ptr = jacobians.GetDataPtr<float>();
+    const int *idx_ptr = jacobian_indices.GetDataPtr<int>();
+    const float *x_ptr = x.GetDataPtr<float>();
+    float *y_ptr = y.GetDataPtr<float>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const float *J = J_ptr + K * workload_idx;
+        const int *idx = idx_ptr + K * workload_idx;
+
+        float Jx = 0;
+        for (int64_t k = 0; k < K; ++k) {
+            Jx += J[k] * x_ptr[idx[k]];
+        }
+        if (Jx == 0) return;
+        for (int64_t k = 0; k < K; ++k) {
+            if (J[k] != 0) {
+                AtomicAddFloat(&y_ptr[idx[k]], J[k] * Jx);
+            }
+        }
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeJtrCUDA
+#else
+void ComputeJtrCPU
+#endif
+        (const core::Tensor &jacobians,
+         const core::Tensor &jacobian_indices,
+         const core::Tensor &residuals,
+         core::Tensor &Jtr) {
+    int64_t n = jacobians.GetLength();
+    int64_t K = jacobians.GetShape(1);
+
+    const float *J_ptr = jacobians.GetDataPtr<float>();
+    const int *idx_ptr = jacobian_indices.GetDataPtr<int>();
+    const float *r_ptr = residuals.GetDataPtr<float>();
+    float *Jtr_ptr = Jtr.GetDataPtr<float>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const float *J = J_ptr + K * workload_idx;
+        const int *idx = idx_ptr + K * workload_idx;
+        float r = r_ptr[workload_idx];
+        if (r == 0) return;
+        for (int64_t k = 0; k < K; ++k) {
+            if (J[k] != 0) {
+                AtomicAddFloat(&Jtr_ptr[idx[k]], J[k] * r);
+            }
+        }
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeJtJBlockDiagonalCUDA
+#else
+void ComputeJtJBlockDiagonalCPU
+#endif
+        (const core::Tensor &jacobians,
+         const core::Tensor &jacobian_indices,
+         core::Tensor &blocks) {
+    int64_t n = jacobians.GetLength();
+    int64_t K = jacobians.GetShape(1);
+
+    const float *J_ptr = jacobians.GetDataPtr<float>();
+    const int *idx_ptr = jacobian_indices.GetDataPtr<int>();
+    float *blocks_ptr = blocks.GetDataPtr<float>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        const float *J = J_ptr + K * workload_idx;
+        const int *idx = idx_ptr + K * workload_idx;
+        for (int64_t k1 = 0; k1 < K; ++k1) {
+            if (J[k1] == 0) continue;
+            int block = idx[k1] / 3;
+            int row = idx[k1] % 3;
+            for (int64_t k2 = 0; k2 < K; ++k2) {
+                if (J[k2] == 0 || idx[k2] / 3 != block) continue;
+                AtomicAddFloat(&blocks_ptr[block * 9 + row * 3 + idx[k2] % 3],
+                               J[k1] * J[k2]);
+            }
+        }
+    });
+}
+
+#if defined(__CUDACC__)
+void InvertBlockDiagonalCUDA
+#else
+void InvertBlockDiagonalCPU
+#endif
+        (core::Tensor &blocks) {
+    int64_t n = blocks.GetLength();
+    float *blocks_ptr = blocks.GetDataPtr<float>();
+
+#if defined(__CUDACC__)
+    namespace launcher = core::kernel::cuda_launcher;
+#else
+    namespace launcher = core::kernel::cpu_launcher;
+#endif
+
+    launcher::ParallelFor(n, [=] OPEN3D_DEVICE(int64_t workload_idx) {
+        float *block = blocks_ptr + 9 * workload_idx;
+        float block_inv[9];
+        if (!core::linalg::kernel::inverse3x3(block, block_inv)) {
+            for (int k = 0; k < 9; ++k) {
+                block_inv[k] = 0;
+            }
+            for (int k = 0; k < 3; ++k) {
+                float d = block[k * 4];
+                block_inv[k * 4] = d > 0 ? 1 / d : 1;
+            }
+        }
+        for (int k = 0; k < 9; ++k) {
+            block[k] = block_inv[k];
+        }
+    });
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -26,6 +26,7 @@
 
 #include "open3d/t/pipelines/odometry/RGBDOdometry.h"
 
+#include "open3d/t/geometry/ImagePyramid.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/geometry/kernel/Image.h"
@@ -40,6 +41,7 @@ namespace odometry {
 
 using core::Tensor;
 using t::geometry::Image;
+using t::geometry::ImagePyramid;
 using t::geometry::RGBDImage;
 
 OdometryResult RGBDOdometryMultiScalePointToPlane(
@@ -53,22 +55,16 @@ OdometryResult RGBDOdometryMultiScalePointToPlane(
         const OdometryLossParams& params);
 
 OdometryResult RGBDOdometryMultiScaleIntensity(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsic,
+        const ImagePyramid& source,
+        const ImagePyramid& target,
         const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const OdometryLossParams& params);
 
 OdometryResult RGBDOdometryMultiScaleHybrid(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
+        const ImagePyramid& source,
+        const ImagePyramid& target,
         const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const OdometryLossParams& params);
 
@@ -96,6 +92,24 @@ OdometryResult RGBDOdometryMultiScale(
     Tensor trans_d =
             init_source_to_target.To(host, core::Dtype::Float64).Clone();
 
+    if (method == Method::Intensity || method == Method::Hybrid) {
+        const int64_t n_levels = int64_t(criteria.size());
+        ImagePyramid source_pyramid(source.depth_.GetRows(),
+                                    source.depth_.GetCols(), n_levels, device);
+        ImagePyramid target_pyramid(target.depth_.GetRows(),
+                                    target.depth_.GetCols(), n_levels, device);
+        const float depth_diff = params.depth_outlier_trunc_ * 2;
+        source_pyramid.UpdateDepth(source.depth_, intrinsics_d, depth_scale,
+                                   depth_max, depth_diff);
+        target_pyramid.UpdateDepth(target.depth_, intrinsics_d, depth_scale,
+                                   depth_max, depth_diff,
+                                   method == Method::Hybrid);
+        source_pyramid.UpdateIntensity(source.color_);
+        target_pyramid.UpdateIntensity(target.color_);
+        return RGBDOdometryMultiScale(source_pyramid, target_pyramid, trans_d,
+                                      criteria, method, params);
+    }
+
     Image source_depth = source.depth_;
     Image target_depth = target.depth_;
 
@@ -111,14 +125,6 @@ OdometryResult RGBDOdometryMultiScale(
         return RGBDOdometryMultiScalePointToPlane(
                 source_processed, target_processed, intrinsics_d, trans_d,
                 depth_scale, depth_max, criteria, params);
-    } else if (method == Method::Intensity) {
-        return RGBDOdometryMultiScaleIntensity(
-                source_processed, target_processed, intrinsics_d, trans_d,
-                depth_scale, depth_max, criteria, params);
-    } else if (method == Method::Hybrid) {
-        return RGBDOdometryMultiScaleHybrid(source_processed, target_processed,
-                                            intrinsics_d, trans_d, depth_scale,
-                                            depth_max, criteria, params);
     } else {
         utility::LogError("Odometry method not implemented.");
     }
@@ -126,6 +132,39 @@ OdometryResult RGBDOdometryMultiScale(
     return OdometryResult(trans_d);
 }
 
+OdometryResult RGBDOdometryMultiScale(
+        const ImagePyramid& source,
+        const ImagePyramid& target,
+        const Tensor& init_source_to_target,
+        const std::vector<OdometryConvergenceCriteria>& criteria,
+        const Method method,
+        const OdometryLossParams& params) {
+    const int64_t n_levels = int64_t(criteria.size());
+    if (source.GetNumLevels() < n_levels || target.GetNumLevels() < n_levels) {
+        utility::LogError(
+                "Expected pyramids with at least {} levels, but got {} and "
+                "{}.",
+                n_levels, source.GetNumLevels(), target.GetNumLevels());
+    }
+
+    core::Device host("CPU:0");
+    Tensor trans_d =
+            init_source_to_target.To(host, core::Dtype::Float64).Clone();
+    if (method == Method::Intensity) {
+        return RGBDOdometryMultiScaleIntensity(source, target, trans_d,
+                                               criteria, params);
+    } else if (method == Method::Hybrid) {
+        return RGBDOdometryMultiScaleHybrid(source, target, trans_d, criteria,
+                                            params);
+    } else {
+        utility::LogError(
+                "Odometry method not implemented for image pyramids. "
+                "PointToPlane requires normal maps of the filtered depth.");
+    }
+
+    return OdometryResult(trans_d);
+}
+
 OdometryResult RGBDOdometryMultiScalePointToPlane(
         const RGBDImage& source,
         const RGBDImage& target,
@@ -208,81 +247,27 @@ OdometryResult RGBDOdometryMultiScalePointToPlane(
 }
 
 OdometryResult RGBDOdometryMultiScaleIntensity(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
+        const ImagePyramid& source,
+        const ImagePyramid& target,
         const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const OdometryLossParams& params) {
+    // The criteria are ordered from coarse to fine, the pyramid levels from
+    // fine to coarse.
     int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_intensity(n_levels);
-    std::vector<Tensor> target_intensity(n_levels);
-
-    std::vector<Tensor> source_depth(n_levels);
-    std::vector<Tensor> target_depth(n_levels);
-    std::vector<Tensor> target_intensity_dx(n_levels);
-    std::vector<Tensor> target_intensity_dy(n_levels);
-
-    std::vector<Tensor> source_vertex_maps(n_levels);
-
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr = source.depth_;
-    Image target_depth_curr = target.depth_;
-
-    Image source_intensity_curr =
-            source.color_.RGBToGray().To(core::Dtype::Float32);
-    Image target_intensity_curr =
-            target.color_.RGBToGray().To(core::Dtype::Float32);
-
-    Tensor intrinsics_pyr = intrinsics;
-
-    // Create image pyramid
-    for (int64_t i = 0; i < n_levels; ++i) {
-        source_depth[n_levels - 1 - i] = source_depth_curr.AsTensor().Clone();
-        target_depth[n_levels - 1 - i] = target_depth_curr.AsTensor().Clone();
-
-        source_intensity[n_levels - 1 - i] =
-                source_intensity_curr.AsTensor().Clone();
-        target_intensity[n_levels - 1 - i] =
-                target_intensity_curr.AsTensor().Clone();
-
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-
-        auto target_intensity_grad = target_intensity_curr.FilterSobel();
-        target_intensity_dx[n_levels - 1 - i] =
-                target_intensity_grad.first.AsTensor();
-        target_intensity_dy[n_levels - 1 - i] =
-                target_intensity_grad.second.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
-
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            source_intensity_curr = source_intensity_curr.PyrDown();
-            target_intensity_curr = target_intensity_curr.PyrDown();
-
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
-        }
-    }
-
-    // Odometry
     OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
     for (int64_t i = 0; i < n_levels; ++i) {
+        const int64_t level = n_levels - 1 - i;
         for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
             auto delta_result = ComputeOdometryResultIntensity(
-                    source_depth[i], target_depth[i], source_intensity[i],
-                    target_intensity[i], target_intensity_dx[i],
-                    target_intensity_dy[i], source_vertex_maps[i],
-                    intrinsic_matrices[i], result.transformation_,
+                    source.GetDepth(level).AsTensor(),
+                    target.GetDepth(level).AsTensor(),
+                    source.GetIntensity(level).AsTensor(),
+                    target.GetIntensity(level).AsTensor(),
+                    target.GetIntensityDx(level).AsTensor(),
+                    target.GetIntensityDy(level).AsTensor(),
+                    source.GetVertexMap(level).AsTensor(),
+                    source.GetIntrinsics(level), result.transformation_,
                     params.depth_outlier_trunc_, params.intensity_huber_delta_);
             result.transformation_ =
                     delta_result.transformation_.Matmul(result.transformation_);
@@ -308,88 +293,31 @@ OdometryResult RGBDOdometryMultiScaleIntensity(
 }
 
 OdometryResult RGBDOdometryMultiScaleHybrid(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
+        const ImagePyramid& source,
+        const ImagePyramid& target,
         const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
         const OdometryLossParams& params) {
+    // The criteria are ordered from coarse to fine, the pyramid levels from
+    // fine to coarse.
     int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_intensity(n_levels);
-    std::vector<Tensor> target_intensity(n_levels);
-
-    std::vector<Tensor> source_depth(n_levels);
-    std::vector<Tensor> target_depth(n_levels);
-    std::vector<Tensor> target_intensity_dx(n_levels);
-    std::vector<Tensor> target_intensity_dy(n_levels);
-
-    std::vector<Tensor> target_depth_dx(n_levels);
-    std::vector<Tensor> target_depth_dy(n_levels);
-
-    std::vector<Tensor> source_vertex_maps(n_levels);
-
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr(source.depth_);
-    Image target_depth_curr(target.depth_);
-
-    Image source_intensity_curr =
-            source.color_.RGBToGray().To(core::Dtype::Float32);
-    Image target_intensity_curr =
-            target.color_.RGBToGray().To(core::Dtype::Float32);
-
-    Tensor intrinsics_pyr = intrinsics;
-    // Create image pyramid
-    for (int64_t i = 0; i < n_levels; ++i) {
-        source_depth[n_levels - 1 - i] = source_depth_curr.AsTensor().Clone();
-        target_depth[n_levels - 1 - i] = target_depth_curr.AsTensor().Clone();
-
-        source_intensity[n_levels - 1 - i] =
-                source_intensity_curr.AsTensor().Clone();
-        target_intensity[n_levels - 1 - i] =
-                target_intensity_curr.AsTensor().Clone();
-
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-
-        auto target_intensity_grad = target_intensity_curr.FilterSobel();
-        target_intensity_dx[n_levels - 1 - i] =
-                target_intensity_grad.first.AsTensor();
-        target_intensity_dy[n_levels - 1 - i] =
-                target_intensity_grad.second.AsTensor();
-
-        auto target_depth_grad = target_depth_curr.FilterSobel();
-        target_depth_dx[n_levels - 1 - i] = target_depth_grad.first.AsTensor();
-        target_depth_dy[n_levels - 1 - i] = target_depth_grad.second.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            source_intensity_curr = source_intensity_curr.PyrDown();
-            target_intensity_curr = target_intensity_curr.PyrDown();
-
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
-        }
-    }
-
-    // Odometry
     OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
     for (int64_t i = 0; i < n_levels; ++i) {
+        const int64_t level = n_levels - 1 - i;
         for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
             auto delta_result = ComputeOdometryResultHybrid(
-                    source_depth[i], target_depth[i], source_intensity[i],
-                    target_intensity[i], target_depth_dx[i], target_depth_dy[i],
-                    target_intensity_dx[i], target_intensity_dy[i],
-                    source_vertex_maps[i], intrinsic_matrices[i],
-                    result.transformation_, params.depth_outlier_trunc_,
-                    params.depth_huber_delta_, params.intensity_huber_delta_);
+                    source.GetDepth(level).AsTensor(),
+                    target.GetDepth(level).AsTensor(),
+                    source.GetIntensity(level).AsTensor(),
+                    target.GetIntensity(level).AsTensor(),
+                    target.GetDepthDx(level).AsTensor(),
+                    target.GetDepthDy(level).AsTensor(),
+                    target.GetIntensityDx(level).AsTensor(),
+                    target.GetIntensityDy(level).AsTensor(),
+                    source.GetVertexMap(level).AsTensor(),
+                    source.GetIntrinsics(level), result.transformation_,
+                    params.depth_outlier_trunc_, params.depth_huber_delta_,
+                    params.intensity_huber_delta_);
             result.transformation_ =
                     delta_result.transformation_.Matmul(result.transformation_);
             utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
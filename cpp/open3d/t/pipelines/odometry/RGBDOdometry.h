@@ -32,6 +32,7 @@
 
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/ImagePyramid.h"
 #include "open3d/t/geometry/RGBDImage.h"
 
 namespace open3d {
@@ -174,6 +175,31 @@ OdometryResult RGBDOdometryMultiScale(
         const Method method = Method::Hybrid,
         const OdometryLossParams& params = OdometryLossParams());
 
+/// \brief Perform hierarchical odometry on image pyramids, which are usually
+/// reused across the frames of a sequence, see t::geometry::ImagePyramid.
+/// The pyramids need the depth and intensity levels, and the target the depth
+/// gradients for Method::Hybrid. Method::PointToPlane is not supported.
+/// \param source Source image pyramid.
+/// \param target Target image pyramid.
+/// \param init_source_to_target (4, 4) initial transformation matrix from
+/// source to target of Dtype::Float64 on CPU.
+/// \param criteria_list Criteria used to define and terminate iterations, from
+/// coarse to fine. The pyramids need at least as many levels.
+/// \param method Method used to apply RGBD odometry.
+/// \param params Parameters used in loss function, including outlier rejection
+/// threshold and Huber norm parameters.
+/// \return odometry result, with (4, 4) optimized transformation matrix from
+/// source to target, inlier ratio, and fitness.
+OdometryResult RGBDOdometryMultiScale(
+        const t::geometry::ImagePyramid& source,
+        const t::geometry::ImagePyramid& target,
+        const core::Tensor& init_source_to_target = core::Tensor::Eye(
+                4, core::Dtype::Float64, core::Device("CPU:0")),
+        const std::vector<OdometryConvergenceCriteria>& criteria_list = {10, 5,
+                                                                         3},
+        const Method method = Method::Hybrid,
+        const OdometryLossParams& params = OdometryLossParams());
+
 /// \brief Estimates the 4x4 rigid transformation T from source to target, with
 /// inlier rmse and fitness.
 /// Performs one iteration of RGBD odometry using loss function
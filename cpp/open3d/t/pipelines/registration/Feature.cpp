@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include <algorithm>
+#include <tuple>
+
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/Feature.h"
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+core::Tensor ComputeFPFHFeature(const geometry::PointCloud &input,
+                                const utility::optional<int> max_nn,
+                                const utility::optional<double> radius) {
+    if (!max_nn.has_value() && !radius.has_value()) {
+        utility::LogError(
+                "[ComputeFPFHFeature] max_nn or radius must be given.");
+    }
+    if (max_nn.has_value() && max_nn.value() <= 0) {
+        utility::LogError("[ComputeFPFHFeature] max_nn must be positive.");
+    }
+    if (radius.has_value() && radius.value() <= 0) {
+        utility::LogError("[ComputeFPFHFeature] radius must be positive.");
+    }
+    if (!input.HasPointNormals()) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Failed because input point cloud has no "
+                "normal.");
+    }
+
+    const core::Tensor points = input.GetPoints().Contiguous();
+    const core::Dtype dtype = points.GetDtype();
+    const core::Device device = points.GetDevice();
+    if (dtype != core::Dtype::Float32 && dtype != core::Dtype::Float64) {
+        utility::LogError(
+                "[ComputeFPFHFeature] Only Float32 and Float64 points are "
+                "supported, but got {}.",
+                dtype.ToString());
+    }
+    const core::Tensor normals =
+            input.GetPointNormals().To(dtype).Contiguous();
+    const int64_t n = points.GetLength();
+    if (n == 0) {
+        return core::Tensor({0, 33}, dtype, device);
+    }
+
+    // Neighbors of point i: indices[offsets[i] : offsets[i] + counts[i]],
+    // sorted by distance, which the SPFH and the FPFH passes share.
+    core::nns::NearestNeighborSearch nns(points);
+    core::Tensor indices, distance2, counts, offsets;
+    if (max_nn.has_value() && radius.has_value()) {
+        const int knn = max_nn.value();
+        nns.HybridIndex(radius.value());
+        std::tie(indices, distance2, counts) =
+                nns.HybridSearch(points, radius.value(), knn);
+        offsets = core::Tensor::Arange(0, n * knn, knn, core::Dtype::Int64,
+                                       device);
+    } else if (max_nn.has_value()) {
+        const int knn = int(std::min<int64_t>(max_nn.value(), n));
+        nns.KnnIndex();
+        std::tie(indices, distance2) = nns.KnnSearch(points, knn);
+        offsets = core::Tensor::Arange(0, n * knn, knn, core::Dtype::Int64,
+                                       device);
+        counts = core::Tensor::Full({n}, knn, core::Dtype::Int64, device);
+    } else {
+        nns.FixedRadiusIndex(radius.value());
+        std::tie(indices, distance2, counts) =
+                nns.FixedRadiusSearch(points, radius.value(), true);
+        counts = counts.Reshape({n}).To(core::Dtype::Int64);
+        offsets = counts.CumSum(0, /*exclusive=*/true);
+    }
+    indices = indices.To(core::Dtype::Int64).Contiguous();
+    distance2 = distance2.To(dtype).Contiguous();
+    counts = counts.Reshape({n}).To(core::Dtype::Int64).Contiguous();
+    offsets = offsets.Contiguous();
+
+    core::Tensor fpfhs({n, 33}, dtype, device);
+    kernel::feature::ComputeFPFHFeature(points, normals, indices, distance2,
+                                        offsets, counts, fpfhs);
+    return fpfhs;
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,348 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/GlobalOptimization.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "open3d/t/pipelines/kernel/FillInLinearSystem.h"
+#include "open3d/t/pipelines/kernel/TransformationConverter.h"
+#include "open3d/utility/Eigen.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+using open3d::pipelines::registration::GlobalOptimizationConvergenceCriteria;
+using open3d::pipelines::registration::GlobalOptimizationOption;
+
+/// Fills in AtA and Atb of the pose graph with node poses \p poses and edge
+/// confidence \p confidence, and returns e^T @ information @ e of each edge.
+/// The linear system is in Float32 on the device of the pose graph.
+static core::Tensor ComputeLinearSystem(const PoseGraph &pose_graph,
+                                        const core::Tensor &poses,
+                                        const core::Tensor &confidence,
+                                        core::Tensor &AtA,
+                                        core::Tensor &Atb) {
+    core::Device device = pose_graph.GetDevice();
+    int64_t n_vars = pose_graph.GetNodeCount() * 6;
+    AtA = core::Tensor::Zeros({n_vars, n_vars}, core::Dtype::Float32, device);
+    Atb = core::Tensor::Zeros({n_vars, 1}, core::Dtype::Float32, device);
+    core::Tensor edge_residuals = core::Tensor::Zeros(
+            {pose_graph.GetEdgeCount()}, core::Dtype::Float32, device);
+    kernel::FillInPoseGraphTerm(
+            AtA, Atb, edge_residuals, poses.To(core::Dtype::Float32),
+            pose_graph.edge_indices_,
+            pose_graph.edge_transformations_.To(core::Dtype::Float32),
+            pose_graph.edge_information_.To(core::Dtype::Float32),
+            confidence.To(core::Dtype::Float32));
+    return edge_residuals.To(core::Dtype::Float64);
+}
+
+/// Function to compute residual defined in [Choi et al 2015] See Eq (9).
+static double ComputeResidual(const core::Tensor &edge_residuals,
+                              const core::Tensor &confidence,
+                              double line_process_weight) {
+    core::Tensor line_process = confidence.Sqrt() - 1;
+    return (confidence * edge_residuals +
+            line_process * line_process * line_process_weight)
+            .Sum({0})
+            .Item<double>();
+}
+
+/// Updates the confidence of the uncertain edges with the line process of
+/// [Choi et al 2015].
+static void UpdateConfidence(PoseGraph &pose_graph,
+                             const core::Tensor &edge_residuals,
+                             double line_process_weight) {
+    core::Tensor temp =
+            core::Tensor::Full(edge_residuals.GetShape(), line_process_weight,
+                               core::Dtype::Float64, pose_graph.GetDevice())
+                    .Div(edge_residuals + line_process_weight);
+    core::Tensor uncertain =
+            pose_graph.edge_uncertain_.To(core::Dtype::Float64);
+    pose_graph.edge_confidence_ = temp * temp * uncertain +
+                                  pose_graph.edge_confidence_ * (1 - uncertain);
+}
+
+/// Returns the poses updated with the increments \p delta, as T <-
+/// PoseToTransformation(delta) @ T.
+static core::Tensor UpdatePoses(const core::Tensor &poses,
+                                const core::Tensor &delta) {
+    core::Tensor delta_poses = delta.View({-1, 6}).To(core::Dtype::Float64);
+    core::Tensor poses_updated = poses.Clone();
+    for (int64_t i = 0; i < poses.GetLength(); ++i) {
+        poses_updated[i] =
+                kernel::PoseToTransformation(delta_poses[i]).Matmul(poses[i]);
+    }
+    return poses_updated;
+}
+
+/// Norm of the [alpha beta gamma a b c] vectors of all poses.
+static double ComputePoseVectorNorm(const core::Tensor &poses) {
+    core::Tensor poses_host = poses.To(core::Device("CPU:0")).Contiguous();
+    const double *poses_ptr = poses_host.GetDataPtr<double>();
+    double norm2 = 0.0;
+    for (int64_t i = 0; i < poses_host.GetLength(); ++i) {
+        Eigen::Map<const Eigen::Matrix<double, 4, 4, Eigen::RowMajor>> pose(
+                poses_ptr + i * 16);
+        norm2 += utility::TransformMatrix4dToVector6d(pose).squaredNorm();
+    }
+    return std::sqrt(norm2);
+}
+
+static double ComputeLineProcessWeight(const PoseGraph &pose_graph,
+                                       const GlobalOptimizationOption &option) {
+    if (pose_graph.GetEdgeCount() == 0) {
+        return 0.0;
+    }
+    // see Section 5 in [Choi et al 2015]
+    double average_number_of_correspondences =
+            pose_graph.edge_information_
+                    .GetItem({core::TensorKey::Slice(core::None, core::None,
+                                                     core::None),
+                              core::TensorKey::Index(5),
+                              core::TensorKey::Index(5)})
+                    .Mean({0})
+                    .Item<double>();
+    return option.preference_loop_closure_ *
+           pow(option.max_correspondence_distance_, 2) *
+           average_number_of_correspondences;
+}
+
+static void OptimizePoseGraphLevenbergMarquardt(
+        PoseGraph &pose_graph,
+        const GlobalOptimizationConvergenceCriteria &criteria,
+        const GlobalOptimizationOption &option) {
+    int64_t n_nodes = pose_graph.GetNodeCount();
+    int64_t n_edges = pose_graph.GetEdgeCount();
+    if (n_nodes == 0 || n_edges == 0) {
+        return;
+    }
+    double line_process_weight = ComputeLineProcessWeight(pose_graph, option);
+
+    utility::LogDebug(
+            "[GlobalOptimization] Optimizing PoseGraph having {:d} nodes and "
+            "{:d} edges on {}.",
+            n_nodes, n_edges, pose_graph.GetDevice().ToString());
+    utility::LogDebug("Line process weight : {:f}", line_process_weight);
+
+    core::Tensor AtA, Atb;
+    core::Tensor edge_residuals =
+            ComputeLinearSystem(pose_graph, pose_graph.poses_,
+                                pose_graph.edge_confidence_, AtA, Atb);
+    double current_residual = ComputeResidual(
+            edge_residuals, pose_graph.edge_confidence_, line_process_weight);
+    double new_residual = current_residual;
+    UpdateConfidence(pose_graph, edge_residuals, line_process_weight);
+    ComputeLinearSystem(pose_graph, pose_graph.poses_,
+                        pose_graph.edge_confidence_, AtA, Atb);
+    double x_norm = ComputePoseVectorNorm(pose_graph.poses_);
+
+    core::Tensor H_I = core::Tensor::Eye(n_nodes * 6, core::Dtype::Float32,
+                                         pose_graph.GetDevice());
+    double tau = 1e-5;
+    double current_lambda =
+            tau * AtA.Mul(H_I).Max({0, 1}).To(core::Dtype::Float64)
+                          .Item<double>();
+    double ni = 2.0;
+    double rho = 0.0;
+
+    utility::LogDebug("[Initial     ] residual : {:e}, lambda : {:e}",
+                      current_residual, current_lambda);
+
+    // The right term of the legacy optimization is -Atb.
+    auto check_right_term = [&]() {
+        if (-Atb.Min({0, 1}).To(core::Dtype::Float64).Item<double>() <
+            criteria.min_right_term_) {
+            utility::LogDebug("Maximum coefficient of right term < {:e}",
+                              criteria.min_right_term_);
+            return true;
+        }
+        return false;
+    };
+
+    bool stop = check_right_term();
+    if (stop) return;
+
+    utility::Timer timer_overall;
+    timer_overall.Start();
+    for (int iter = 0; !stop; iter++) {
+        utility::Timer timer_iter;
+        timer_iter.Start();
+        int lm_count = 0;
+        do {
+            core::Tensor delta = (AtA + H_I * current_lambda).Solve(Atb.Neg());
+            core::Tensor delta64 = delta.To(core::Dtype::Float64);
+            double delta_norm =
+                    std::sqrt((delta64 * delta64).Sum({0, 1}).Item<double>());
+
+            if (delta_norm < criteria.min_relative_increment_ *
+                                     (x_norm +
+                                      criteria.min_relative_increment_)) {
+                utility::LogDebug("Delta.norm() < {:e} * (x.norm() + {:e})",
+                                  criteria.min_relative_increment_,
+                                  criteria.min_relative_increment_);
+                stop = true;
+            }
+            if (!stop) {
+                core::Tensor poses_new =
+                        UpdatePoses(pose_graph.poses_, delta);
+                core::Tensor AtA_new, Atb_new;
+                core::Tensor edge_residuals_new = ComputeLinearSystem(
+                        pose_graph, poses_new, pose_graph.edge_confidence_,
+                        AtA_new, Atb_new);
+                new_residual = ComputeResidual(edge_residuals_new,
+                                               pose_graph.edge_confidence_,
+                                               line_process_weight);
+                double denominator =
+                        (delta64 * (delta64 * current_lambda -
+                                    Atb.To(core::Dtype::Float64)))
+                                .Sum({0, 1})
+                                .Item<double>();
+                rho = (current_residual - new_residual) / (denominator + 1e-3);
+                if (rho > 0) {
+                    if (current_residual - new_residual <
+                        criteria.min_relative_residual_increment_ *
+                                current_residual) {
+                        utility::LogDebug(
+                                "Current_residual - new_residual < {:e} * "
+                                "current_residual",
+                                criteria.min_relative_residual_increment_);
+                        stop = true;
+                        break;
+                    }
+                    double alpha = 1. - pow((2 * rho - 1), 3);
+                    alpha = (std::min)(alpha, criteria.upper_scale_factor_);
+                    double scaleFactor =
+                            (std::max)(criteria.lower_scale_factor_, alpha);
+                    current_lambda *= scaleFactor;
+                    ni = 2;
+                    current_residual = new_residual;
+
+                    pose_graph.poses_ = poses_new;
+                    x_norm = ComputePoseVectorNorm(pose_graph.poses_);
+                    UpdateConfidence(pose_graph, edge_residuals_new,
+                                     line_process_weight);
+                    ComputeLinearSystem(pose_graph, pose_graph.poses_,
+                                        pose_graph.edge_confidence_, AtA,
+                                        Atb);
+
+                    stop = check_right_term();
+                    if (stop) break;
+                } else {
+                    current_lambda *= ni;
+                    ni *= 2;
+                }
+            }
+            lm_count++;
+            if (lm_count >= criteria.max_iteration_lm_) {
+                utility::LogDebug(
+                        "Reached maximum number of iterations ({:d})",
+                        criteria.max_iteration_lm_);
+                stop = true;
+            }
+        } while (!((rho > 0) || stop));
+        timer_iter.Stop();
+        if (!stop) {
+            utility::LogDebug(
+                    "[Iteration {:02d}] residual : {:e}, time : {:.3f} sec.",
+                    iter, current_residual, timer_iter.GetDuration() / 1000.0);
+        }
+        if (current_residual < criteria.min_residual_) {
+            utility::LogDebug("Current_residual < {:e}",
+                              criteria.min_residual_);
+            stop = true;
+        }
+        if (iter >= criteria.max_iteration_) {
+            utility::LogDebug("Reached maximum number of iterations ({:d})",
+                              criteria.max_iteration_);
+            stop = true;
+        }
+    }
+    timer_overall.Stop();
+    utility::LogDebug("[GlobalOptimization] total time : {:.3f} sec.",
+                      timer_overall.GetDuration() / 1000.0);
+}
+
+/// Removes the uncertain edges whose confidence is below the pruning
+/// threshold.
+static void PruneInvalidEdges(PoseGraph &pose_graph,
+                              const GlobalOptimizationOption &option) {
+    core::Tensor valid = pose_graph.edge_uncertain_.LogicalNot().LogicalOr(
+            pose_graph.edge_confidence_.Gt(option.edge_prune_threshold_));
+    pose_graph = PoseGraph(pose_graph.poses_,
+                           pose_graph.edge_indices_.IndexGet({valid}),
+                           pose_graph.edge_transformations_.IndexGet({valid}),
+                           pose_graph.edge_information_.IndexGet({valid}),
+                           pose_graph.edge_confidence_.IndexGet({valid}),
+                           pose_graph.edge_uncertain_.IndexGet({valid}));
+}
+
+/// Moves the optimized poses rigidly so that the reference node keeps its
+/// original pose.
+static void CompensateReferencePoseGraphNode(PoseGraph &pose_graph_new,
+                                             const PoseGraph &pose_graph_orig,
+                                             int reference_node) {
+    int64_t n_nodes = pose_graph_new.GetNodeCount();
+    if (reference_node < 0 || reference_node >= n_nodes) {
+        return;
+    }
+    core::Tensor compensation =
+            pose_graph_orig.poses_[reference_node].Matmul(
+                    pose_graph_new.poses_[reference_node].Inverse());
+    // compensation @ [T_0 T_1 ...], with the poses stacked horizontally.
+    core::Tensor poses_stacked =
+            pose_graph_new.poses_.Transpose(0, 1).Reshape({4, n_nodes * 4});
+    pose_graph_new.poses_ = compensation.Matmul(poses_stacked)
+                                    .Reshape({4, n_nodes, 4})
+                                    .Transpose(0, 1)
+                                    .Contiguous();
+}
+
+void GlobalOptimization(PoseGraph &pose_graph,
+                        const GlobalOptimizationConvergenceCriteria &criteria
+                        /* = GlobalOptimizationConvergenceCriteria() */,
+                        const GlobalOptimizationOption &option
+                        /* = GlobalOptimizationOption() */) {
+    PoseGraph pose_graph_pre = pose_graph;
+    OptimizePoseGraphLevenbergMarquardt(pose_graph_pre, criteria, option);
+    PruneInvalidEdges(pose_graph_pre, option);
+    OptimizePoseGraphLevenbergMarquardt(pose_graph_pre, criteria, option);
+    PruneInvalidEdges(pose_graph_pre, option);
+    CompensateReferencePoseGraphNode(pose_graph_pre, pose_graph,
+                                     option.reference_node_);
+    pose_graph = pose_graph_pre;
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,62 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/pipelines/registration/GlobalOptimizationConvergenceCriteria.h"
+#include "open3d/t/pipelines/registration/PoseGraph.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+/// \brief Function to optimize a tensor PoseGraph on its device.
+///
+/// Levenberg-Marquardt optimization with the line process of [Choi et al
+/// 2015], as open3d::pipelines::registration::GlobalOptimization() with
+/// GlobalOptimizationLevenbergMarquardt: the pose graph is optimized, its
+/// uncertain edges of low confidence are pruned, and it is optimized again.
+/// The linear system is filled in on the device of the pose graph by the
+/// kernel::FillInPoseGraphTerm() kernel, and solved there.
+///
+/// \param pose_graph The pose graph to be optimized (in-place).
+/// \param criteria Convergence criteria.
+/// \param option Global optimization options.
+void GlobalOptimization(
+        PoseGraph &pose_graph,
+        const open3d::pipelines::registration::
+                GlobalOptimizationConvergenceCriteria &criteria =
+                        open3d::pipelines::registration::
+                                GlobalOptimizationConvergenceCriteria(),
+        const open3d::pipelines::registration::GlobalOptimizationOption
+                &option = open3d::pipelines::registration::
+                        GlobalOptimizationOption());
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
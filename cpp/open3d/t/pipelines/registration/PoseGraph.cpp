@@ -0,0 +1,208 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/PoseGraph.h"
+
+#include <vector>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+PoseGraph::PoseGraph(const core::Device &device)
+    : poses_(core::Tensor::Empty({0, 4, 4}, core::Dtype::Float64, device)),
+      edge_indices_(core::Tensor::Empty({0, 2}, core::Dtype::Int64, device)),
+      edge_transformations_(
+              core::Tensor::Empty({0, 4, 4}, core::Dtype::Float64, device)),
+      edge_information_(
+              core::Tensor::Empty({0, 6, 6}, core::Dtype::Float64, device)),
+      edge_confidence_(
+              core::Tensor::Empty({0}, core::Dtype::Float64, device)),
+      edge_uncertain_(core::Tensor::Empty({0}, core::Dtype::Bool, device)) {}
+
+PoseGraph::PoseGraph(const core::Tensor &poses,
+                     const core::Tensor &edge_indices,
+                     const core::Tensor &edge_transformations,
+                     const core::Tensor &edge_information,
+                     const core::Tensor &edge_confidence,
+                     const core::Tensor &edge_uncertain)
+    : poses_(poses.Contiguous()),
+      edge_indices_(edge_indices.Contiguous()),
+      edge_transformations_(edge_transformations.Contiguous()),
+      edge_information_(edge_information.Contiguous()),
+      edge_confidence_(edge_confidence.Contiguous()),
+      edge_uncertain_(edge_uncertain.Contiguous()) {
+    int64_t n_edges = edge_indices_.GetLength();
+    poses_.AssertShape({poses_.GetLength(), 4, 4});
+    poses_.AssertDtype(core::Dtype::Float64);
+    edge_indices_.AssertShape({n_edges, 2});
+    edge_indices_.AssertDtype(core::Dtype::Int64);
+    edge_transformations_.AssertShape({n_edges, 4, 4});
+    edge_transformations_.AssertDtype(core::Dtype::Float64);
+    edge_information_.AssertShape({n_edges, 6, 6});
+    edge_information_.AssertDtype(core::Dtype::Float64);
+    edge_confidence_.AssertShape({n_edges});
+    edge_confidence_.AssertDtype(core::Dtype::Float64);
+    edge_uncertain_.AssertShape({n_edges});
+    edge_uncertain_.AssertDtype(core::Dtype::Bool);
+
+    core::Device device = poses_.GetDevice();
+    for (const core::Tensor &tensor :
+         {edge_indices_, edge_transformations_, edge_information_,
+          edge_confidence_, edge_uncertain_}) {
+        if (tensor.GetDevice() != device) {
+            utility::LogError(
+                    "Edges should have the same device as the poses.");
+        }
+    }
+}
+
+PoseGraph PoseGraph::To(const core::Device &device) const {
+    return PoseGraph(poses_.To(device), edge_indices_.To(device),
+                     edge_transformations_.To(device),
+                     edge_information_.To(device), edge_confidence_.To(device),
+                     edge_uncertain_.To(device));
+}
+
+PoseGraph PoseGraph::FromLegacy(
+        const open3d::pipelines::registration::PoseGraph &pose_graph,
+        const core::Device &device) {
+    int64_t n_nodes = int64_t(pose_graph.nodes_.size());
+    int64_t n_edges = int64_t(pose_graph.edges_.size());
+
+    // Legacy matrices are column major, the tensors are row major.
+    std::vector<double> poses(n_nodes * 16);
+    for (int64_t i = 0; i < n_nodes; ++i) {
+        const Eigen::Matrix4d &pose = pose_graph.nodes_[i].pose_;
+        for (int r = 0; r < 4; ++r) {
+            for (int c = 0; c < 4; ++c) {
+                poses[i * 16 + r * 4 + c] = pose(r, c);
+            }
+        }
+    }
+
+    std::vector<int64_t> edge_indices(n_edges * 2);
+    std::vector<double> edge_transformations(n_edges * 16);
+    std::vector<double> edge_information(n_edges * 36);
+    std::vector<double> edge_confidence(n_edges);
+    core::Tensor edge_uncertain =
+            core::Tensor::Empty({n_edges}, core::Dtype::Bool,
+                                core::Device("CPU:0"));
+    bool *edge_uncertain_ptr = edge_uncertain.GetDataPtr<bool>();
+    for (int64_t i = 0; i < n_edges; ++i) {
+        const auto &edge = pose_graph.edges_[i];
+        if (edge.source_node_id_ < 0 || edge.source_node_id_ >= n_nodes ||
+            edge.target_node_id_ < 0 || edge.target_node_id_ >= n_nodes) {
+            utility::LogError("Edge {} refers to a node out of range.", i);
+        }
+        edge_indices[i * 2 + 0] = edge.source_node_id_;
+        edge_indices[i * 2 + 1] = edge.target_node_id_;
+        for (int r = 0; r < 4; ++r) {
+            for (int c = 0; c < 4; ++c) {
+                edge_transformations[i * 16 + r * 4 + c] =
+                        edge.transformation_(r, c);
+            }
+        }
+        for (int r = 0; r < 6; ++r) {
+            for (int c = 0; c < 6; ++c) {
+                edge_information[i * 36 + r * 6 + c] = edge.information_(r, c);
+            }
+        }
+        edge_confidence[i] = edge.confidence_;
+        edge_uncertain_ptr[i] = edge.uncertain_;
+    }
+
+    return PoseGraph(
+            core::Tensor(poses, {n_nodes, 4, 4}, core::Dtype::Float64, device),
+            core::Tensor(edge_indices, {n_edges, 2}, core::Dtype::Int64,
+                         device),
+            core::Tensor(edge_transformations, {n_edges, 4, 4},
+                         core::Dtype::Float64, device),
+            core::Tensor(edge_information, {n_edges, 6, 6},
+                         core::Dtype::Float64, device),
+            core::Tensor(edge_confidence, {n_edges}, core::Dtype::Float64,
+                         device),
+            edge_uncertain.To(device));
+}
+
+open3d::pipelines::registration::PoseGraph PoseGraph::ToLegacy() const {
+    core::Device host("CPU:0");
+    core::Tensor poses = poses_.To(host).Contiguous();
+    core::Tensor edge_indices = edge_indices_.To(host).Contiguous();
+    core::Tensor edge_transformations =
+            edge_transformations_.To(host).Contiguous();
+    core::Tensor edge_information = edge_information_.To(host).Contiguous();
+    core::Tensor edge_confidence = edge_confidence_.To(host).Contiguous();
+    core::Tensor edge_uncertain = edge_uncertain_.To(host).Contiguous();
+
+    const double *poses_ptr = poses.GetDataPtr<double>();
+    const int64_t *edge_indices_ptr = edge_indices.GetDataPtr<int64_t>();
+    const double *edge_transformations_ptr =
+            edge_transformations.GetDataPtr<double>();
+    const double *edge_information_ptr = edge_information.GetDataPtr<double>();
+    const double *edge_confidence_ptr = edge_confidence.GetDataPtr<double>();
+    const bool *edge_uncertain_ptr = edge_uncertain.GetDataPtr<bool>();
+
+    open3d::pipelines::registration::PoseGraph pose_graph;
+    for (int64_t i = 0; i < GetNodeCount(); ++i) {
+        Eigen::Matrix4d pose;
+        for (int r = 0; r < 4; ++r) {
+            for (int c = 0; c < 4; ++c) {
+                pose(r, c) = poses_ptr[i * 16 + r * 4 + c];
+            }
+        }
+        pose_graph.nodes_.push_back(
+                open3d::pipelines::registration::PoseGraphNode(pose));
+    }
+    for (int64_t i = 0; i < GetEdgeCount(); ++i) {
+        Eigen::Matrix4d transformation;
+        for (int r = 0; r < 4; ++r) {
+            for (int c = 0; c < 4; ++c) {
+                transformation(r, c) =
+                        edge_transformations_ptr[i * 16 + r * 4 + c];
+            }
+        }
+        Eigen::Matrix6d information;
+        for (int r = 0; r < 6; ++r) {
+            for (int c = 0; c < 6; ++c) {
+                information(r, c) = edge_information_ptr[i * 36 + r * 6 + c];
+            }
+        }
+        pose_graph.edges_.emplace_back(
+                int(edge_indices_ptr[i * 2 + 0]),
+                int(edge_indices_ptr[i * 2 + 1]), transformation, information,
+                edge_uncertain_ptr[i], edge_confidence_ptr[i]);
+    }
+    return pose_graph;
+}
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
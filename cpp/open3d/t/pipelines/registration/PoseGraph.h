@@ -0,0 +1,106 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace registration {
+
+/// \class PoseGraph
+///
+/// \brief Tensor pose graph, holding the nodes and edges of the legacy
+/// open3d::pipelines::registration::PoseGraph as batched tensors on a
+/// device, so that it can be optimized without leaving the device.
+class PoseGraph {
+public:
+    /// \brief Constructs an empty pose graph on \p device.
+    PoseGraph(const core::Device &device = core::Device("CPU:0"));
+
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param poses Node poses, a Float64 tensor of shape {N, 4, 4}.
+    /// \param edge_indices Source and target node of the edges, an Int64
+    /// tensor of shape {E, 2}.
+    /// \param edge_transformations Transformation of the edges, a Float64
+    /// tensor of shape {E, 4, 4}.
+    /// \param edge_information Information matrix of the edges, a Float64
+    /// tensor of shape {E, 6, 6}.
+    /// \param edge_confidence Confidence of the edges, a Float64 tensor of
+    /// shape {E}.
+    /// \param edge_uncertain Whether the edges are uncertain, a Bool tensor of
+    /// shape {E}.
+    PoseGraph(const core::Tensor &poses,
+              const core::Tensor &edge_indices,
+              const core::Tensor &edge_transformations,
+              const core::Tensor &edge_information,
+              const core::Tensor &edge_confidence,
+              const core::Tensor &edge_uncertain);
+
+public:
+    /// Returns the device of the pose graph.
+    core::Device GetDevice() const { return poses_.GetDevice(); }
+
+    /// Returns the number of nodes.
+    int64_t GetNodeCount() const { return poses_.GetLength(); }
+
+    /// Returns the number of edges.
+    int64_t GetEdgeCount() const { return edge_indices_.GetLength(); }
+
+    /// Returns a copy of the pose graph on \p device.
+    PoseGraph To(const core::Device &device) const;
+
+    /// Creates a tensor pose graph on \p device from a legacy pose graph.
+    static PoseGraph FromLegacy(
+            const open3d::pipelines::registration::PoseGraph &pose_graph,
+            const core::Device &device = core::Device("CPU:0"));
+
+    /// Converts to a legacy pose graph.
+    open3d::pipelines::registration::PoseGraph ToLegacy() const;
+
+public:
+    /// Node poses, {N, 4, 4} Float64.
+    core::Tensor poses_;
+    /// Source and target node of the edges, {E, 2} Int64.
+    core::Tensor edge_indices_;
+    /// Transformation of the edges, {E, 4, 4} Float64.
+    core::Tensor edge_transformations_;
+    /// Information matrix of the edges, {E, 6, 6} Float64.
+    core::Tensor edge_information_;
+    /// Confidence of the edges, {E} Float64. See the legacy PoseGraphEdge.
+    core::Tensor edge_confidence_;
+    /// Whether the edges are uncertain, i.e. loop closures, {E} Bool.
+    core::Tensor edge_uncertain_;
+};
+
+}  // namespace registration
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
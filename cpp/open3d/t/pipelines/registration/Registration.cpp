@@ -26,9 +26,16 @@
 
 #include "open3d/t/pipelines/registration/Registration.h"
 
+#include <Eigen/Core>
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Profiler.h"
 #include "open3d/core/Tensor.h"
-#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/kernel/RANSAC.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
 
@@ -37,13 +44,38 @@ namespace t {
 namespace pipelines {
 namespace registration {
 
+/// Returns the correspondences (i, target_indices[i]) of the source points i
+/// with a target index other than -1.
+static CorrespondenceSet CompactCorrespondences(
+        const core::Tensor &target_indices) {
+    core::Tensor valid = target_indices.Ne(-1).Reshape({-1});
+    // correpondence_set : (i, corres[i]).
+    // source[i] and target[corres[i]] is a correspondence.
+    CorrespondenceSet correspondences;
+    correspondences.first =
+            core::Tensor::Arange(0, target_indices.GetShape()[0], 1,
+                                 core::Dtype::Int64, target_indices.GetDevice())
+                    .IndexGet({valid});
+    // Only take valid indices.
+    correspondences.second =
+            target_indices.Reshape({-1}).IndexGet({valid}).Reshape({-1});
+    return correspondences;
+}
+
+/// Searches the correspondences of \p source in \p target_nns, whose hybrid
+/// index has to be built for \p max_correspondence_distance. If
+/// \p target_indices is given, the {N} target index of every source point, -1
+/// if it has none, is written to it and the correspondence set of the result
+/// is left empty.
 static RegistrationResult GetRegistrationResultAndCorrespondences(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         open3d::core::nns::NearestNeighborSearch &target_nns,
         double max_correspondence_distance,
-        const core::Tensor &transformation) {
+        const core::Tensor &transformation,
+        core::Tensor *target_indices = nullptr) {
     core::Device device = source.GetDevice();
+    OPEN3D_PROFILE_SCOPE("RegistrationICP::Correspondences", device);
     core::Dtype dtype = core::Dtype::Float32;
     source.GetPoints().AssertDtype(dtype);
     target.GetPoints().AssertDtype(dtype);
@@ -62,33 +94,21 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
         return result;
     }
 
-    bool check = target_nns.HybridIndex(max_correspondence_distance);
-    if (!check) {
-        utility::LogError(
-                "[Tensor: EvaluateRegistration: "
-                "GetRegistrationResultAndCorrespondences: "
-                "NearestNeighborSearch::HybridSearch] "
-                "Index is not set.");
-    }
-
-    core::Tensor distances, counts;
-    std::tie(result.correspondence_set_.second, distances, counts) =
-            target_nns.HybridSearch(source.GetPoints(),
-                                    max_correspondence_distance, 1);
-
-    core::Tensor valid = result.correspondence_set_.second.Ne(-1).Reshape({-1});
-    // correpondence_set : (i, corres[i]).
-    // source[i] and target[corres[i]] is a correspondence.
-    result.correspondence_set_.first =
-            core::Tensor::Arange(0, source.GetPoints().GetShape()[0], 1,
-                                 core::Dtype::Int64, device)
-                    .IndexGet({valid});
-    // Only take valid indices.
-    result.correspondence_set_.second =
-            result.correspondence_set_.second.IndexGet({valid}).Reshape({-1});
+    core::Tensor indices, distances, counts;
+    std::tie(indices, distances, counts) = target_nns.HybridSearch(
+            source.GetPoints(), max_correspondence_distance, 1);
+    indices = indices.Reshape({-1});
 
     // Number of good correspondences (C).
-    int num_correspondences = result.correspondence_set_.first.GetLength();
+    int num_correspondences;
+    if (target_indices) {
+        *target_indices = indices;
+        num_correspondences = static_cast<int>(
+                indices.Ne(-1).To(core::Dtype::Int64).Sum({0}).Item<int64_t>());
+    } else {
+        result.correspondence_set_ = CompactCorrespondences(indices);
+        num_correspondences = result.correspondence_set_.first.GetLength();
+    }
 
     // Reduction sum of "distances" for error.
     double squared_error =
@@ -101,6 +121,43 @@ static RegistrationResult GetRegistrationResultAndCorrespondences(
     return result;
 }
 
+/// Re-evaluates the correspondences \p correspondences of a previous search at
+/// the current pose of \p source, dropping the pairs that are now farther
+/// apart than \p max_correspondence_distance.
+static RegistrationResult GetRegistrationResultFromCorrespondences(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const core::Tensor &transformation,
+        const CorrespondenceSet &correspondences) {
+    core::Tensor transformation_host =
+            transformation.To(core::Device("CPU:0"), core::Dtype::Float64);
+    RegistrationResult result(transformation_host);
+
+    core::Tensor diff =
+            source.GetPoints().IndexGet({correspondences.first}) -
+            target.GetPoints().IndexGet({correspondences.second});
+    core::Tensor distances = (diff * diff).Sum({1});
+    core::Tensor valid = distances.Le(static_cast<float>(
+            max_correspondence_distance * max_correspondence_distance));
+    result.correspondence_set_.first =
+            correspondences.first.IndexGet({valid});
+    result.correspondence_set_.second =
+            correspondences.second.IndexGet({valid});
+
+    int num_correspondences = result.correspondence_set_.first.GetLength();
+    if (num_correspondences == 0) {
+        return result;
+    }
+    double squared_error = static_cast<double>(
+            distances.IndexGet({valid}).Sum({0}).Item<float>());
+    result.fitness_ = static_cast<double>(num_correspondences) /
+                      static_cast<double>(source.GetPoints().GetLength());
+    result.inlier_rmse_ =
+            std::sqrt(squared_error / static_cast<double>(num_correspondences));
+    return result;
+}
+
 RegistrationResult EvaluateRegistration(const geometry::PointCloud &source,
                                         const geometry::PointCloud &target,
                                         double max_correspondence_distance,
@@ -120,12 +177,88 @@ RegistrationResult EvaluateRegistration(const geometry::PointCloud &source,
     source_transformed.Transform(transformation.To(device, dtype));
 
     open3d::core::nns::NearestNeighborSearch target_nns(target.GetPoints());
+    if (max_correspondence_distance > 0.0 &&
+        !target_nns.HybridIndex(max_correspondence_distance)) {
+        utility::LogError(
+                "[Tensor: EvaluateRegistration: "
+                "NearestNeighborSearch::HybridIndex] "
+                "Index is not set.");
+    }
 
     return GetRegistrationResultAndCorrespondences(
             source_transformed, target, target_nns, max_correspondence_distance,
             transformation);
 }
 
+ICPTarget::ICPTarget(const geometry::PointCloud &target,
+                     double max_correspondence_distance)
+    : ICPTarget(target, {-1}, {max_correspondence_distance}) {}
+
+ICPTarget::ICPTarget(const geometry::PointCloud &target,
+                     const std::vector<double> &voxel_sizes,
+                     const std::vector<double> &max_correspondence_distances)
+    : voxel_sizes_(voxel_sizes),
+      max_correspondence_distances_(max_correspondence_distances) {
+    OPEN3D_PROFILE_SCOPE("ICPTarget", target.GetDevice());
+    target.GetPoints().AssertDtype(core::Dtype::Float32,
+                                   " ICPTarget: Only Float32 Point cloud "
+                                   "are supported currently.");
+
+    const int64_t num_scales = int64_t(voxel_sizes.size());
+    if (num_scales == 0 ||
+        voxel_sizes.size() != max_correspondence_distances.size()) {
+        utility::LogError(
+                " [ICPTarget]: Size of voxel_size and "
+                "max_correspondence_distances vectors must be same and "
+                "non-zero.");
+    }
+
+    if (max_correspondence_distances[0] <= 0.0) {
+        utility::LogError(
+                " Max correspondence distance must be greater than 0, but"
+                " got {} in scale: {}.",
+                max_correspondence_distances[0], 0);
+    }
+
+    for (int64_t i = 1; i < num_scales; i++) {
+        if (voxel_sizes[i] >= voxel_sizes[i - 1]) {
+            utility::LogError(
+                    " [MultiScaleICP] Voxel sizes must be in strictly "
+                    "decreasing order.");
+        }
+        if (max_correspondence_distances[i] <= 0.0) {
+            utility::LogError(
+                    " Max correspondence distance must be greater than 0, but"
+                    " got {} in scale: {}.",
+                    max_correspondence_distances[i], i);
+        }
+    }
+
+    target_down_pyramid_.resize(num_scales);
+    if (voxel_sizes[num_scales - 1] == -1) {
+        target_down_pyramid_[num_scales - 1] = target;
+    } else {
+        target_down_pyramid_[num_scales - 1] =
+                target.Clone().VoxelDownSample(voxel_sizes[num_scales - 1]);
+    }
+    for (int64_t k = num_scales - 2; k >= 0; k--) {
+        target_down_pyramid_[k] =
+                target_down_pyramid_[k + 1].VoxelDownSample(voxel_sizes[k]);
+    }
+
+    target_nns_.resize(num_scales);
+    for (int64_t i = 0; i < num_scales; i++) {
+        target_nns_[i] = std::make_shared<core::nns::NearestNeighborSearch>(
+                target_down_pyramid_[i].GetPoints());
+        if (!target_nns_[i]->HybridIndex(max_correspondence_distances[i])) {
+            utility::LogError(
+                    "[Tensor: ICPTarget: "
+                    "NearestNeighborSearch::HybridIndex] "
+                    "Index is not set.");
+        }
+    }
+}
+
 RegistrationResult RegistrationICP(const geometry::PointCloud &source,
                                    const geometry::PointCloud &target,
                                    double max_correspondence_distance,
@@ -137,6 +270,15 @@ RegistrationResult RegistrationICP(const geometry::PointCloud &source,
                                      init_source_to_target, estimation);
 }
 
+RegistrationResult RegistrationICP(const geometry::PointCloud &source,
+                                   const ICPTarget &target,
+                                   const core::Tensor &init_source_to_target,
+                                   const TransformationEstimation &estimation,
+                                   const ICPConvergenceCriteria &criteria) {
+    return RegistrationMultiScaleICP(source, target, {criteria},
+                                     init_source_to_target, estimation);
+}
+
 RegistrationResult RegistrationMultiScaleICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -145,15 +287,31 @@ RegistrationResult RegistrationMultiScaleICP(
         const std::vector<double> &max_correspondence_distances,
         const core::Tensor &init_source_to_target,
         const TransformationEstimation &estimation) {
+    if (!(criterias.size() == voxel_sizes.size() &&
+          criterias.size() == max_correspondence_distances.size())) {
+        utility::LogError(
+                " [RegistrationMultiScaleICP]: Size of criterias, voxel_size,"
+                " max_correspondence_distances vectors must be same.");
+    }
+    return RegistrationMultiScaleICP(
+            source,
+            ICPTarget(target, voxel_sizes, max_correspondence_distances),
+            criterias, init_source_to_target, estimation);
+}
+
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const ICPTarget &target,
+        const std::vector<ICPConvergenceCriteria> &criterias,
+        const core::Tensor &init_source_to_target,
+        const TransformationEstimation &estimation) {
     core::Device device = source.GetDevice();
     core::Dtype dtype = core::Dtype::Float32;
+    OPEN3D_PROFILE_SCOPE("RegistrationMultiScaleICP", device);
 
     source.GetPoints().AssertDtype(dtype,
                                    " RegistrationICP: Only Float32 Point cloud "
                                    "are supported currently.");
-    target.GetPoints().AssertDtype(dtype,
-                                   " RegistrationICP: Only Float32 Point cloud "
-                                   "are supported currently.");
 
     if (target.GetDevice() != device) {
         utility::LogError(
@@ -162,43 +320,39 @@ RegistrationResult RegistrationMultiScaleICP(
     }
 
     int64_t num_iterations = int64_t(criterias.size());
-    if (!(criterias.size() == voxel_sizes.size() &&
-          criterias.size() == max_correspondence_distances.size())) {
+    if (num_iterations != target.NumScales()) {
         utility::LogError(
-                " [RegistrationMultiScaleICP]: Size of criterias, voxel_size,"
-                " max_correspondence_distances vectors must be same.");
+                " [RegistrationMultiScaleICP]: Size of criterias {} must be "
+                "the number of scales of the target {}.",
+                num_iterations, target.NumScales());
     }
 
     if ((estimation.GetTransformationEstimationType() ==
                  TransformationEstimationType::PointToPlane ||
          estimation.GetTransformationEstimationType() ==
                  TransformationEstimationType::ColoredICP) &&
-        (!target.HasPointNormals())) {
+        (!target.target_down_pyramid_.back().HasPointNormals())) {
         utility::LogError(
                 "TransformationEstimationPointToPlane and "
                 "TransformationEstimationColoredICP "
                 "require pre-computed normal vectors for target PointCloud.");
     }
-
-    if (max_correspondence_distances[0] <= 0.0) {
+    if (estimation.GetTransformationEstimationType() ==
+                TransformationEstimationType::ColoredICP &&
+        (!source.HasPointColors() ||
+         !target.target_down_pyramid_.back().HasPointColors())) {
         utility::LogError(
-                " Max correspondence distance must be greater than 0, but"
-                " got {} in scale: {}.",
-                max_correspondence_distances[0], 0);
+                "TransformationEstimationColoredICP requires colors for "
+                "source and target PointClouds.");
     }
-
-    for (int64_t i = 1; i < num_iterations; i++) {
-        if (voxel_sizes[i] >= voxel_sizes[i - 1]) {
-            utility::LogError(
-                    " [MultiScaleICP] Voxel sizes must be in strictly "
-                    "decreasing order.");
-        }
-        if (max_correspondence_distances[i] <= 0.0) {
-            utility::LogError(
-                    " Max correspondence distance must be greater than 0, but"
-                    " got {} in scale: {}.",
-                    max_correspondence_distances[i], i);
-        }
+    if (estimation.GetTransformationEstimationType() ==
+                TransformationEstimationType::GeneralizedICP &&
+        (!source.HasPointNormals() ||
+         !target.target_down_pyramid_.back().HasPointNormals())) {
+        utility::LogError(
+                "TransformationEstimationForGeneralizedICP requires "
+                "pre-computed normal vectors for source and target "
+                "PointClouds.");
     }
 
     init_source_to_target.AssertShape({4, 4});
@@ -206,24 +360,33 @@ RegistrationResult RegistrationMultiScaleICP(
     core::Tensor transformation = init_source_to_target.To(
             core::Device("CPU:0"), core::Dtype::Float64);
 
-    std::vector<t::geometry::PointCloud> source_down_pyramid(num_iterations);
-    std::vector<t::geometry::PointCloud> target_down_pyramid(num_iterations);
+    const std::vector<double> &voxel_sizes = target.voxel_sizes_;
+    const std::vector<double> &max_correspondence_distances =
+            target.max_correspondence_distances_;
+    std::vector<t::geometry::PointCloud> target_down_pyramid =
+            target.target_down_pyramid_;
+    if (estimation.GetTransformationEstimationType() ==
+        TransformationEstimationType::ColoredICP) {
+        // The color gradients are estimated like the legacy ColoredICP, on
+        // shallow copies of the levels that do not have them yet.
+        for (int64_t i = 0; i < num_iterations; i++) {
+            if (!target_down_pyramid[i].HasPointAttr("color_gradients")) {
+                target_down_pyramid[i].EstimateColorGradients(
+                        30, max_correspondence_distances[i] * 2.0);
+            }
+        }
+    }
 
+    std::vector<t::geometry::PointCloud> source_down_pyramid(num_iterations);
     if (voxel_sizes[num_iterations - 1] == -1) {
         source_down_pyramid[num_iterations - 1] = source.Clone();
-        target_down_pyramid[num_iterations - 1] = target;
     } else {
         source_down_pyramid[num_iterations - 1] =
                 source.Clone().VoxelDownSample(voxel_sizes[num_iterations - 1]);
-        target_down_pyramid[num_iterations - 1] =
-                target.Clone().VoxelDownSample(voxel_sizes[num_iterations - 1]);
     }
-
     for (int k = num_iterations - 2; k >= 0; k--) {
         source_down_pyramid[k] =
                 source_down_pyramid[k + 1].VoxelDownSample(voxel_sizes[k]);
-        target_down_pyramid[k] =
-                target_down_pyramid[k + 1].VoxelDownSample(voxel_sizes[k]);
     }
 
     RegistrationResult result(transformation);
@@ -231,14 +394,58 @@ RegistrationResult RegistrationMultiScaleICP(
     for (int64_t i = 0; i < num_iterations; i++) {
         source_down_pyramid[i].Transform(transformation.To(device, dtype));
 
-        core::nns::NearestNeighborSearch target_nns(
-                target_down_pyramid[i].GetPoints());
+        core::nns::NearestNeighborSearch &target_nns = *target.target_nns_[i];
+
+        const double reuse_distance =
+                criterias[i].correspondence_reuse_distance_;
+
+        // Without correspondence reuse, point to plane, colored and
+        // generalized ICP accumulate their linear system directly from the
+        // search result of every source point, which is only compacted into a
+        // correspondence set at the end.
+        const bool use_target_indices =
+                (estimation.GetTransformationEstimationType() ==
+                         TransformationEstimationType::PointToPlane ||
+                 estimation.GetTransformationEstimationType() ==
+                         TransformationEstimationType::ColoredICP ||
+                 estimation.GetTransformationEstimationType() ==
+                         TransformationEstimationType::GeneralizedICP) &&
+                reuse_distance <= 0.0;
+        core::Tensor target_indices;
 
         result = GetRegistrationResultAndCorrespondences(
                 source_down_pyramid[i], target_down_pyramid[i], target_nns,
-                max_correspondence_distances[i], transformation);
+                max_correspondence_distances[i], transformation,
+                use_target_indices ? &target_indices : nullptr);
+
+        // To reuse correspondences, the displacement of the source points is
+        // bounded with a bounding sphere that moves along with the source.
+        CorrespondenceSet searched_correspondences =
+                result.correspondence_set_;
+        Eigen::Vector3d source_center = Eigen::Vector3d::Zero();
+        double source_radius = 0.0;
+        double displacement = 0.0;
+        if (reuse_distance > 0.0) {
+            core::Tensor min_bound = source_down_pyramid[i]
+                                             .GetMinBound()
+                                             .To(core::Device("CPU:0"),
+                                                 core::Dtype::Float64)
+                                             .Reshape({3, 1});
+            core::Tensor max_bound = source_down_pyramid[i]
+                                             .GetMaxBound()
+                                             .To(core::Device("CPU:0"),
+                                                 core::Dtype::Float64)
+                                             .Reshape({3, 1});
+            Eigen::Vector3d min_bound_eigen =
+                    core::eigen_converter::TensorToEigenMatrixXd(min_bound);
+            Eigen::Vector3d max_bound_eigen =
+                    core::eigen_converter::TensorToEigenMatrixXd(max_bound);
+            source_center = 0.5 * (min_bound_eigen + max_bound_eigen);
+            source_radius = 0.5 * (max_bound_eigen - min_bound_eigen).norm();
+        }
 
         for (int j = 0; j < criterias[i].max_iteration_; j++) {
+            OPEN3D_PROFILE_SCOPE("RegistrationICP::Iteration", device);
             utility::LogDebug(
                     " ICP Scale #{:d} Iteration #{:d}: Fitness {:.4f}, RMSE "
                     "{:.4f}",
@@ -246,9 +453,16 @@ RegistrationResult RegistrationMultiScaleICP(
 
             // ComputeTransformation returns transformation matrix of
             // dtype Float64.
-            core::Tensor update = estimation.ComputeTransformation(
-                    source_down_pyramid[i], target_down_pyramid[i],
-                    result.correspondence_set_);
+            core::Tensor update;
+            if (use_target_indices) {
+                update = estimation.ComputeTransformationFromIndices(
+                        source_down_pyramid[i], target_down_pyramid[i],
+                        target_indices);
+            } else {
+                update = estimation.ComputeTransformation(
+                        source_down_pyramid[i], target_down_pyramid[i],
+                        result.correspondence_set_);
+            }
 
             // Multiply the transform to the cumulative transformation (update).
             transformation = update.Matmul(transformation);
@@ -258,9 +472,35 @@ RegistrationResult RegistrationMultiScaleICP(
             double prev_fitness_ = result.fitness_;
             double prev_inliner_rmse_ = result.inlier_rmse_;
 
-            result = GetRegistrationResultAndCorrespondences(
-                    source_down_pyramid[i], target_down_pyramid[i], target_nns,
-                    max_correspondence_distances[i], transformation);
+            if (reuse_distance > 0.0) {
+                // The Frobenius norm of R - I bounds its spectral norm.
+                Eigen::Matrix4d update_eigen =
+                        core::eigen_converter::TensorToEigenMatrixXd(update);
+                Eigen::Matrix3d rotation = update_eigen.block<3, 3>(0, 0);
+                Eigen::Vector3d translation = update_eigen.block<3, 1>(0, 3);
+                Eigen::Vector3d moved_center =
+                        rotation * source_center + translation;
+                displacement +=
+                        (rotation - Eigen::Matrix3d::Identity()).norm() *
+                                source_radius +
+                        (moved_center - source_center).norm();
+                source_center = moved_center;
+            }
+
+            if (reuse_distance > 0.0 && displacement < reuse_distance) {
+                result = GetRegistrationResultFromCorrespondences(
+                        source_down_pyramid[i], target_down_pyramid[i],
+                        max_correspondence_distances[i], transformation,
+                        searched_correspondences);
+            } else {
+                result = GetRegistrationResultAndCorrespondences(
+                        source_down_pyramid[i], target_down_pyramid[i],
+                        target_nns, max_correspondence_distances[i],
+                        transformation,
+                        use_target_indices ? &target_indices : nullptr);
+                searched_correspondences = result.correspondence_set_;
+                displacement = 0.0;
+            }
 
             // ICPConvergenceCriteria, to terminate iteration.
             if (j != 0 &&
@@ -271,7 +511,144 @@ RegistrationResult RegistrationMultiScaleICP(
                 break;
             }
         }
+
+        if (use_target_indices) {
+            result.correspondence_set_ =
+                    CompactCorrespondences(target_indices);
+        }
+    }
+    return result;
+}
+
+RegistrationResult RegistrationRANSACBasedOnCorrespondence(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &correspondences,
+        double max_correspondence_distance,
+        int ransac_n,
+        const RANSACConvergenceCriteria &criteria) {
+    core::Device device = source.GetDevice();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    source.GetPoints().AssertDtype(dtype,
+                                   " RegistrationRANSAC: Only Float32 Point "
+                                   "cloud are supported currently.");
+    target.GetPoints().AssertDtype(dtype,
+                                   " RegistrationRANSAC: Only Float32 Point "
+                                   "cloud are supported currently.");
+    if (target.GetDevice() != device) {
+        utility::LogError(
+                "Target Pointcloud device {} != Source Pointcloud's device {}.",
+                target.GetDevice().ToString(), device.ToString());
+    }
+    if (criteria.batch_size_ <= 0) {
+        utility::LogError("RANSAC batch_size must be positive, but got {}.",
+                          criteria.batch_size_);
+    }
+
+    const int64_t num_correspondences = correspondences.first.NumElements();
+    if (ransac_n < 3 || num_correspondences < ransac_n ||
+        max_correspondence_distance <= 0.0) {
+        return RegistrationResult();
+    }
+
+    const core::Tensor corres_first =
+            correspondences.first.Reshape({-1}).To(device, core::Dtype::Int64);
+    const core::Tensor corres_second =
+            correspondences.second.Reshape({-1}).To(device,
+                                                    core::Dtype::Int64);
+    const core::Tensor source_points =
+            source.GetPoints().IndexGet({corres_first});
+    const core::Tensor target_points =
+            target.GetPoints().IndexGet({corres_second});
+
+    core::Tensor best_transformation;
+    int64_t best_count = 0;
+    double best_residual = 0.0;
+    int64_t exit_itr = criteria.max_iteration_;
+    int64_t itr = 0;
+    while (itr < exit_itr) {
+        const int64_t num_hypotheses =
+                std::min<int64_t>(criteria.batch_size_, exit_itr - itr);
+        const uint64_t seed =
+                (uint64_t(utility::UniformRandInt(0, INT_MAX)) << 32) ^
+                uint64_t(utility::UniformRandInt(0, INT_MAX));
+
+        core::Tensor transformations, inlier_counts, inlier_residuals;
+        kernel::EstimateAndScoreRANSACHypotheses(
+                source_points, target_points, num_hypotheses, ransac_n, seed,
+                max_correspondence_distance, transformations, inlier_counts,
+                inlier_residuals);
+        itr += num_hypotheses;
+
+        // Only the scores of the batch are copied to pick its best hypothesis.
+        const core::Tensor inlier_counts_cpu =
+                inlier_counts.To(core::Device("CPU:0"));
+        const core::Tensor inlier_residuals_cpu = inlier_residuals.To(
+                core::Device("CPU:0"), core::Dtype::Float64);
+        const int64_t *inlier_counts_ptr =
+                inlier_counts_cpu.GetDataPtr<int64_t>();
+        const double *inlier_residuals_ptr =
+                inlier_residuals_cpu.GetDataPtr<double>();
+        int64_t best_idx = -1;
+        for (int64_t h = 0; h < num_hypotheses; ++h) {
+            // Same order as RegistrationResult::IsBetterRANSACThan().
+            if (inlier_counts_ptr[h] > best_count ||
+                (inlier_counts_ptr[h] == best_count && best_count > 0 &&
+                 inlier_residuals_ptr[h] < best_residual)) {
+                best_idx = h;
+                best_count = inlier_counts_ptr[h];
+                best_residual = inlier_residuals_ptr[h];
+            }
+        }
+        if (best_idx == -1) {
+            continue;
+        }
+        best_transformation = transformations[best_idx].Clone();
+
+        // Update exit condition if necessary.
+        const double fitness = double(best_count) / num_correspondences;
+        const double exit_itr_d = std::log(1.0 - criteria.confidence_) /
+                                  std::log(1.0 - std::pow(fitness, ransac_n));
+        if (exit_itr_d < double(exit_itr)) {
+            exit_itr = static_cast<int64_t>(std::ceil(exit_itr_d));
+        }
+    }
+    if (best_count == 0) {
+        return RegistrationResult();
+    }
+
+    RegistrationResult result(core::Tensor::Eye(4, core::Dtype::Float64,
+                                                 core::Device("CPU:0")));
+    result.transformation_.SetItem(
+            core::TensorKey::Slice(0, 3, 1),
+            best_transformation.To(core::Device("CPU:0"),
+                                   core::Dtype::Float64));
+
+    // The inliers of the best hypothesis are evaluated once more to return
+    // them as the correspondence set.
+    const core::Tensor R = best_transformation.Slice(1, 0, 3);
+    const core::Tensor t = best_transformation.Slice(1, 3, 4).Reshape({1, 3});
+    const core::Tensor diff =
+            source_points.Matmul(R.T()).Add(t).Sub(target_points);
+    const core::Tensor distance2 = (diff * diff).Sum({1});
+    const core::Tensor inliers = distance2.Lt(max_correspondence_distance *
+                                              max_correspondence_distance);
+    result.correspondence_set_.first = corres_first.IndexGet({inliers});
+    result.correspondence_set_.second = corres_second.IndexGet({inliers});
+    const int64_t num_inliers = result.correspondence_set_.first.GetLength();
+    if (num_inliers > 0) {
+        const double squared_error = distance2.IndexGet({inliers})
+                                             .Sum({0})
+                                             .To(core::Dtype::Float64)
+                                             .Item<double>();
+        result.fitness_ = double(num_inliers) / num_correspondences;
+        result.inlier_rmse_ = std::sqrt(squared_error / num_inliers);
     }
+    utility::LogDebug(
+            "RANSAC exits after {:d} hypotheses: inlier ratio {:e}, "
+            "RMSE {:e}",
+            itr, result.fitness_, result.inlier_rmse_);
     return result;
 }
 
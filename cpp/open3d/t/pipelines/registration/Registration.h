@@ -26,19 +26,18 @@
 
 #pragma once
 
+#include <memory>
 #include <tuple>
 #include <vector>
 
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 
 namespace open3d {
 namespace t {
 
-namespace geometry {
-class PointCloud;
-}
-
 namespace pipelines {
 namespace registration {
 class Feature;
@@ -58,12 +57,17 @@ public:
     /// \param relative_rmse If relative change (difference) of inliner RMSE
     /// score is lower than relative_rmse, the iteration stops.
     /// \param max_iteration Maximum iteration before iteration stops.
+    /// \param correspondence_reuse_distance If positive, the correspondences
+    /// of the last nearest neighbor search are reused as long as the source
+    /// points have moved less than this distance since that search.
     ICPConvergenceCriteria(double relative_fitness = 1e-6,
                            double relative_rmse = 1e-6,
-                           int max_iteration = 30)
+                           int max_iteration = 30,
+                           double correspondence_reuse_distance = 0.0)
         : relative_fitness_(relative_fitness),
           relative_rmse_(relative_rmse),
-          max_iteration_(max_iteration) {}
+          max_iteration_(max_iteration),
+          correspondence_reuse_distance_(correspondence_reuse_distance) {}
     ~ICPConvergenceCriteria() {}
 
 public:
@@ -75,6 +79,45 @@ public:
     double relative_rmse_;
     /// Maximum iteration before iteration stops.
     int max_iteration_;
+    /// If positive, the nearest neighbor search is skipped and the previous
+    /// correspondences are re-evaluated as long as an upper bound of the
+    /// displacement of the source points since the last search is lower than
+    /// `correspondence_reuse_distance`. Zero disables the reuse.
+    double correspondence_reuse_distance_;
+};
+
+/// \class RANSACConvergenceCriteria
+///
+/// \brief Class that defines the convergence criteria of RANSAC.
+///
+/// RANSAC estimates and scores batches of hypotheses on the device of the
+/// correspondences, and stops after max_iteration_ hypotheses, or as soon as
+/// the best hypothesis has been found with the desired confidence.
+class RANSACConvergenceCriteria {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param max_iteration Maximum number of hypotheses.
+    /// \param confidence Desired probability of success. Used for estimating
+    /// early termination by k = log(1 - confidence)/log(1 -
+    /// inlier_ratio^{ransac_n}).
+    /// \param batch_size Number of hypotheses estimated and scored together.
+    RANSACConvergenceCriteria(int max_iteration = 100000,
+                              double confidence = 0.999,
+                              int batch_size = 1000)
+        : max_iteration_(max_iteration),
+          confidence_(confidence),
+          batch_size_(batch_size) {}
+    ~RANSACConvergenceCriteria() {}
+
+public:
+    /// Maximum number of hypotheses.
+    int max_iteration_;
+    /// Desired probability of success.
+    double confidence_;
+    /// Number of hypotheses estimated and scored together. Early termination
+    /// is checked between batches.
+    int batch_size_;
 };
 
 /// \class RegistrationResult
@@ -107,9 +150,61 @@ public:
     double inlier_rmse_;
     /// For ICP: the overlapping area (# of inlier correspondences / # of points
     /// in target). Higher is better.
+    /// For RANSAC: inlier ratio (# of inlier correspondences / # of
+    /// all correspondences)
     double fitness_;
 };
 
+/// \class ICPTarget
+///
+/// \brief Target of ICP prepared once for repeated registrations, e.g. of
+/// successive frames against a fixed map.
+///
+/// Holds the downsampled target of each scale with its nearest neighbor
+/// index, built for the maximum correspondence distance of the scale, so that
+/// RegistrationICP() and RegistrationMultiScaleICP() do not downsample the
+/// target and build its indices in every call.
+class ICPTarget {
+public:
+    /// \brief Parameterized Constructor for single scale ICP on the full
+    /// resolution target.
+    ///
+    /// \param target The target point cloud.
+    /// \param max_correspondence_distance Maximum correspondence points-pair
+    /// distance.
+    ICPTarget(const geometry::PointCloud &target,
+              double max_correspondence_distance);
+    /// \brief Parameterized Constructor for multi-scale ICP.
+    ///
+    /// \param target The target point cloud.
+    /// \param voxel_sizes Voxel sizes of the scales in strictly decreasing
+    /// order, where only the last one can be -1 for the full resolution.
+    /// \param max_correspondence_distances Maximum correspondence points-pair
+    /// distances of the scales.
+    ICPTarget(const geometry::PointCloud &target,
+              const std::vector<double> &voxel_sizes,
+              const std::vector<double> &max_correspondence_distances);
+
+public:
+    /// Returns the number of scales.
+    int64_t NumScales() const { return int64_t(voxel_sizes_.size()); }
+
+    /// Returns the device of the target.
+    core::Device GetDevice() const {
+        return target_down_pyramid_.back().GetDevice();
+    }
+
+public:
+    /// Voxel sizes of the scales, from coarse to fine.
+    std::vector<double> voxel_sizes_;
+    /// Maximum correspondence distances of the scales.
+    std::vector<double> max_correspondence_distances_;
+    /// Downsampled target of each scale.
+    std::vector<geometry::PointCloud> target_down_pyramid_;
+    /// Nearest neighbor search of each scale, with its hybrid index built.
+    std::vector<std::shared_ptr<core::nns::NearestNeighborSearch>> target_nns_;
+};
+
 /// \brief Function for evaluating registration between point clouds.
 ///
 /// \param source The source point cloud.
@@ -145,6 +240,23 @@ RegistrationResult RegistrationICP(
                 TransformationEstimationPointToPoint(),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// \brief Functions for ICP registration against a prepared target.
+///
+/// \param source The source point cloud.
+/// \param target The prepared single scale target.
+/// \param init_source_to_target Initial transformation estimation of type
+/// Float64 on CPU.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const ICPTarget &target,
+        const core::Tensor &init_source_to_target = core::Tensor::Eye(
+                4, core::Dtype::Float64, core::Device("CPU:0")),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
 /// \brief Functions for Multi-Scale ICP registration.
 /// It will run ICP on different voxel level, from coarse to dense.
 /// The vector of ICPConvergenceCriteria(relative fitness, relative rmse,
@@ -177,6 +289,51 @@ RegistrationResult RegistrationMultiScaleICP(
         const TransformationEstimation &estimation =
                 TransformationEstimationPointToPoint());
 
+/// \brief Functions for Multi-Scale ICP registration against a prepared
+/// target, whose voxel sizes and maximum correspondence distances are used.
+///
+/// \param source The source point cloud.
+/// \param target The prepared target.
+/// \param criteria_list Vector of ICPConvergenceCriteria objects for each
+/// scale of the target.
+/// \param init_source_to_target Initial transformation estimation of type
+/// Float64 on CPU.
+/// \param estimation Estimation method.
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const ICPTarget &target,
+        const std::vector<ICPConvergenceCriteria> &criteria_list,
+        const core::Tensor &init_source_to_target = core::Tensor::Eye(
+                4, core::Dtype::Float64, core::Device("CPU:0")),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint());
+
+/// \brief Function for global RANSAC registration based on a set of
+/// correspondences, on the device of the point clouds.
+///
+/// Batches of hypotheses are sampled and estimated by the Kabsch algorithm,
+/// and scored against all the correspondences together, see
+/// RANSACConvergenceCriteria.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param correspondences Correspondence indices between source and target
+/// point clouds, e.g. from matched features.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance of the inliers.
+/// \param ransac_n Fit ransac with `ransac_n` correspondences.
+/// \param criteria Convergence criteria.
+/// \return The best hypothesis, as a transformation of dtype Float64 on CPU,
+/// with its inlier correspondences.
+RegistrationResult RegistrationRANSACBasedOnCorrespondence(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &correspondences,
+        double max_correspondence_distance,
+        int ransac_n = 3,
+        const RANSACConvergenceCriteria &criteria =
+                RANSACConvergenceCriteria());
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
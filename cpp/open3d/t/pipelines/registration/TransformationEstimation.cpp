@@ -34,6 +34,56 @@ namespace t {
 namespace pipelines {
 namespace registration {
 
+/// Checks that source and target are Float32 point clouds on the same device,
+/// with normals if \p normals.
+static void AssertPointClouds(const geometry::PointCloud &source,
+                              const geometry::PointCloud &target,
+                              bool normals) {
+    core::Device device = source.GetDevice();
+    core::Dtype dtype = core::Dtype::Float32;
+    source.GetPoints().AssertDtype(dtype);
+    target.GetPoints().AssertDtype(dtype);
+    if (target.GetDevice() != device) {
+        utility::LogError(
+                "Target Pointcloud device {} != Source Pointcloud's device {}.",
+                target.GetDevice().ToString(), device.ToString());
+    }
+    if (normals && (!source.HasPointNormals() || !target.HasPointNormals())) {
+        utility::LogError(
+                "TransformationEstimationForGeneralizedICP requires normals "
+                "for the source and target PointClouds.");
+    }
+}
+
+/// Checks the point clouds like AssertPointClouds(), and that the source has
+/// colors and the target normals, colors and color gradients.
+static void AssertColoredPointClouds(const geometry::PointCloud &source,
+                                     const geometry::PointCloud &target) {
+    AssertPointClouds(source, target, false);
+    if (!source.HasPointColors() || !target.HasPointColors() ||
+        !target.HasPointNormals() || !target.HasPointAttr("color_gradients")) {
+        utility::LogError(
+                "TransformationEstimationForColoredICP requires colors for "
+                "the source and target PointClouds, and normals and "
+                "\"color_gradients\" for the target PointCloud.");
+    }
+}
+
+core::Tensor TransformationEstimation::ComputeTransformationFromIndices(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &target_indices) const {
+    core::Tensor valid = target_indices.Ne(-1).Reshape({-1});
+    CorrespondenceSet correspondences;
+    correspondences.first =
+            core::Tensor::Arange(0, target_indices.GetShape()[0], 1,
+                                 core::Dtype::Int64, target_indices.GetDevice())
+                    .IndexGet({valid});
+    correspondences.second =
+            target_indices.Reshape({-1}).IndexGet({valid}).Reshape({-1});
+    return ComputeTransformation(source, target, correspondences);
+}
+
 double TransformationEstimationPointToPoint::ComputeRMSE(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -139,6 +189,103 @@ core::Tensor TransformationEstimationPointToPlane::ComputeTransformation(
     return pipelines::kernel::PoseToTransformation(pose);
 }
 
+core::Tensor
+TransformationEstimationPointToPlane::ComputeTransformationFromIndices(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &target_indices) const {
+    AssertPointClouds(source, target, false);
+
+    core::Tensor pose = pipelines::kernel::ComputePosePointToPlane(
+            source.GetPoints(), target.GetPoints(), target.GetPointNormals(),
+            target_indices.Reshape({-1}));
+    return pipelines::kernel::PoseToTransformation(pose);
+}
+
+double TransformationEstimationForGeneralizedICP::ComputeRMSE(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &correspondences) const {
+    AssertPointClouds(source, target, true);
+
+    return pipelines::kernel::ComputeRMSEGeneralizedICP(
+            source.GetPoints(), target.GetPoints(), source.GetPointNormals(),
+            target.GetPointNormals(), correspondences, epsilon_);
+}
+
+core::Tensor TransformationEstimationForGeneralizedICP::ComputeTransformation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &correspondences) const {
+    AssertPointClouds(source, target, true);
+
+    core::Tensor pose = pipelines::kernel::ComputePoseGeneralizedICP(
+            source.GetPoints(), target.GetPoints(), source.GetPointNormals(),
+            target.GetPointNormals(), correspondences, epsilon_);
+    return pipelines::kernel::PoseToTransformation(pose);
+}
+
+core::Tensor
+TransformationEstimationForGeneralizedICP::ComputeTransformationFromIndices(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::Tensor &target_indices) const {
+    AssertPointClouds(source, target, true);
+
+    core::Tensor pose = pipelines::kernel::ComputePoseGeneralizedICP(
+            source.GetPoints(), target.GetPoints(), source.GetPointNormals(),
+            target.GetPointNormals(), target_indices.Reshape({-1}), epsilon_);
+    return pipelines::kernel::PoseToTransformation(pose);
+}
+
+double TransformationEstimationForColoredICP::ComputeRMSE(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &correspondences) const {
+    AssertColoredPointClouds(source, target);
+
+    core::Dtype dtype = core::Dtype::Float32;
+    return pipelines::kernel::ComputeRMSEColoredICP(
+            source.GetPoints(), source.GetPointColors().To(dtype),
+            target.GetPoints(), target.GetPointNormals(),
+            target.GetPointColors().To(dtype),
+            target.GetPointAttr("color_gradients").To(dtype), correspondences,
+            lambda_geometric_);
+}
+
+core::Tensor TransformationEstimationForColoredICP::ComputeTransformation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &correspondences) const {
+    AssertColoredPointClouds(source, target);
+
+    core::Dtype dtype = core::Dtype::Float32;
+    core::Tensor pose = pipelines::kernel::ComputePoseColoredICP(
+            source.GetPoints(), source.GetPointColors().To(dtype),
+            target.GetPoints(), target.GetPointNormals(),
+            target.GetPointColors().To(dtype),
+            target.GetPointAttr("color_gradients").To(dtype), correspondences,
+            lambda_geometric_);
+    return pipelines::kernel::PoseToTransformation(pose);
+}
+
+core::Tensor TransformationEstimationForColoredICP::
+        ComputeTransformationFromIndices(
+                const geometry::PointCloud &source,
+                const geometry::PointCloud &target,
+                const core::Tensor &target_indices) const {
+    AssertColoredPointClouds(source, target);
+
+    core::Dtype dtype = core::Dtype::Float32;
+    core::Tensor pose = pipelines::kernel::ComputePoseColoredICP(
+            source.GetPoints(), source.GetPointColors().To(dtype),
+            target.GetPoints(), target.GetPointNormals(),
+            target.GetPointColors().To(dtype),
+            target.GetPointAttr("color_gradients").To(dtype),
+            target_indices.Reshape({-1}), lambda_geometric_);
+    return pipelines::kernel::PoseToTransformation(pose);
+}
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
@@ -59,6 +59,7 @@ enum class TransformationEstimationType {
     PointToPoint = 1,
     PointToPlane = 2,
     ColoredICP = 3,
+    GeneralizedICP = 4,
 };
 
 /// \class TransformationEstimation
@@ -100,6 +101,20 @@ public:
             const geometry::PointCloud &source,
             const geometry::PointCloud &target,
             const CorrespondenceSet &correspondences) const = 0;
+    /// Compute transformation from source to target point cloud given the
+    /// nearest neighbor search result of every source point. By default, the
+    /// correspondences are compacted and passed to ComputeTransformation().
+    ///
+    /// \param source Source point cloud of type Float32.
+    /// \param target Target point cloud of type Float32.
+    /// \param target_indices Index of the target point corresponding to each
+    /// source point, or -1 if it has none. A shape {N} tensor of dtype Int64.
+    /// \return transformation between source to target, a tensor of shape
+    /// {4, 4}, type Float64 on CPU device.
+    virtual core::Tensor ComputeTransformationFromIndices(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const core::Tensor &target_indices) const;
 };
 
 /// \class TransformationEstimationPointToPoint
@@ -190,11 +205,164 @@ public:
             const geometry::PointCloud &target,
             const CorrespondenceSet &correspondences) const override;
 
+    /// \brief Estimates the transformation matrix for PointToPlane method
+    /// from the target index of every source point, accumulating the linear
+    /// system without compacting the correspondences.
+    core::Tensor ComputeTransformationFromIndices(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const core::Tensor &target_indices) const override;
+
 private:
     const TransformationEstimationType type_ =
             TransformationEstimationType::PointToPlane;
 };
 
+/// \class TransformationEstimationForGeneralizedICP
+///
+/// Class to estimate a transformation of shape {4, 4} and dtype Float64 for
+/// generalized ICP (plane to plane), which minimizes the Mahalanobis distances
+/// of the correspondences under the covariances of the source and target
+/// points. The covariance of a point with normal n is regularized to the
+/// plane covariance I - (1 - epsilon) n n^T, so that the normals, e.g.
+/// estimated from the cached covariances by PointCloud::EstimateNormals(),
+/// are all that is needed.
+class TransformationEstimationForGeneralizedICP
+    : public TransformationEstimation {
+public:
+    /// \brief Parameterized constructor.
+    ///
+    /// \param epsilon Covariance of a point along its normal, relative to the
+    /// tangent directions, in (0, 1].
+    explicit TransformationEstimationForGeneralizedICP(double epsilon = 1e-3)
+        : epsilon_(epsilon) {}
+    ~TransformationEstimationForGeneralizedICP() override {}
+
+public:
+    TransformationEstimationType GetTransformationEstimationType()
+            const override {
+        return type_;
+    };
+    /// \brief Computes RMSE (double) of the Mahalanobis distances of the
+    /// correspondences, between two pointclouds of type Float32.
+    ///
+    /// \param source Source pointcloud of dtype Float32. It must contain
+    /// normals.
+    /// \param source Target pointcloud of dtype Float32. It must contain
+    /// normals.
+    /// \param correspondences CorrespondenceSet: a pair of Int64 {C,}
+    /// shape tensor.
+    double ComputeRMSE(const geometry::PointCloud &source,
+                       const geometry::PointCloud &target,
+                       const CorrespondenceSet &correspondences) const override;
+
+    /// \brief Estimates the transformation matrix for generalized ICP, a
+    /// tensor of shape {4, 4}, and dtype Float64 on CPU device.
+    ///
+    /// \param source Source pointcloud of dtype Float32. It must contain
+    /// normals.
+    /// \param source Target pointcloud of dtype Float32. It must contain
+    /// normals.
+    /// \param correspondences CorrespondenceSet: a pair of Int64 {C,}
+    /// shape tensor.
+    /// \return transformation between source to target, a tensor
+    /// of shape {4, 4}, type Float64 on CPU device.
+    core::Tensor ComputeTransformation(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const CorrespondenceSet &correspondences) const override;
+
+    /// \brief Estimates the transformation matrix for generalized ICP from
+    /// the target index of every source point, accumulating the linear system
+    /// without compacting the correspondences.
+    core::Tensor ComputeTransformationFromIndices(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const core::Tensor &target_indices) const override;
+
+public:
+    /// Covariance of a point along its normal, relative to the tangent
+    /// directions.
+    double epsilon_;
+
+private:
+    const TransformationEstimationType type_ =
+            TransformationEstimationType::GeneralizedICP;
+};
+
+/// \class TransformationEstimationForColoredICP
+///
+/// Class to estimate a transformation of shape {4, 4} and dtype Float64 for
+/// colored ICP, which minimizes a weighted sum of the point to plane distances
+/// and of the intensity differences of the correspondences, like the legacy
+/// TransformationEstimationForColoredICP. The intensity of a point is the mean
+/// of its colors, expected in [0, 1]. The target needs normals and the
+/// gradients of its intensities in the "color_gradients" point attribute,
+/// see geometry::PointCloud::EstimateColorGradients().
+class TransformationEstimationForColoredICP : public TransformationEstimation {
+public:
+    /// \brief Parameterized constructor.
+    ///
+    /// \param lambda_geometric Weight of the geometric term in [0, 1], the
+    /// photometric term is weighted by 1 - lambda_geometric.
+    explicit TransformationEstimationForColoredICP(
+            double lambda_geometric = 0.968)
+        : lambda_geometric_(lambda_geometric) {}
+    ~TransformationEstimationForColoredICP() override {}
+
+public:
+    TransformationEstimationType GetTransformationEstimationType()
+            const override {
+        return type_;
+    };
+    /// \brief Computes RMSE (double) of the weighted geometric and
+    /// photometric residuals of the correspondences, between two pointclouds
+    /// of type Float32.
+    ///
+    /// \param source Source pointcloud of dtype Float32. It must contain
+    /// colors.
+    /// \param source Target pointcloud of dtype Float32. It must contain
+    /// normals, colors and color gradients.
+    /// \param correspondences CorrespondenceSet: a pair of Int64 {C,}
+    /// shape tensor.
+    double ComputeRMSE(const geometry::PointCloud &source,
+                       const geometry::PointCloud &target,
+                       const CorrespondenceSet &correspondences) const override;
+
+    /// \brief Estimates the transformation matrix for colored ICP, a tensor
+    /// of shape {4, 4}, and dtype Float64 on CPU device.
+    ///
+    /// \param source Source pointcloud of dtype Float32. It must contain
+    /// colors.
+    /// \param source Target pointcloud of dtype Float32. It must contain
+    /// normals, colors and color gradients.
+    /// \param correspondences CorrespondenceSet: a pair of Int64 {C,}
+    /// shape tensor.
+    /// \return transformation between source to target, a tensor
+    /// of shape {4, 4}, type Float64 on CPU device.
+    core::Tensor ComputeTransformation(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const CorrespondenceSet &correspondences) const override;
+
+    /// \brief Estimates the transformation matrix for colored ICP from the
+    /// target index of every source point, accumulating the linear system
+    /// without compacting the correspondences.
+    core::Tensor ComputeTransformationFromIndices(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const core::Tensor &target_indices) const override;
+
+public:
+    /// Weight of the geometric term, the photometric term is weighted by
+    /// 1 - lambda_geometric_.
+    double lambda_geometric_;
+
+private:
+    const TransformationEstimationType type_ =
+            TransformationEstimationType::ColoredICP;
+};
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
@@ -27,6 +27,7 @@
 #include "open3d/t/pipelines/slac/ControlGrid.h"
 
 #include "open3d/core/EigenConverter.h"
+#include "open3d/t/pipelines/kernel/ControlGrid.h"
 
 namespace open3d {
 namespace t {
@@ -167,139 +168,83 @@ ControlGrid::GetNeighborGridMap() {
 
 geometry::PointCloud ControlGrid::Parameterize(
         const geometry::PointCloud& pcd) {
-    core::Tensor pts = pcd.GetPoints();
-    core::Tensor nms;
+    core::Tensor normals;
     if (pcd.HasPointNormals()) {
-        nms = pcd.GetPointNormals().T().Contiguous();
-    }
-    int64_t n = pts.GetLength();
-
-    core::Tensor pts_quantized = pts / grid_size_;
-    core::Tensor pts_quantized_floor = pts_quantized.Floor();
-
-    // (N x 3) -> [0, 1] for trilinear interpolation
-    core::Tensor residual = pts_quantized - pts_quantized_floor;
-    std::vector<std::vector<core::Tensor>> residuals(3);
-    for (int axis = 0; axis < 3; ++axis) {
-        core::Tensor residual_axis = residual.GetItem(
-                {core::TensorKey::Slice(core::None, core::None, core::None),
-                 core::TensorKey::Index(axis)});
-
-        residuals[axis].emplace_back(1.f - residual_axis);
-        residuals[axis].emplace_back(residual_axis);
+        normals = pcd.GetPointNormals();
     }
 
-    core::Tensor keys = pts_quantized_floor.To(core::Dtype::Int32);
-    core::Tensor keys_nb({8, n, 3}, core::Dtype::Int32, device_);
-    core::Tensor point_ratios_nb({8, n}, core::Dtype::Float32, device_);
-    core::Tensor normal_ratios_nb({8, n}, core::Dtype::Float32, device_);
-    for (int nb = 0; nb < 8; ++nb) {
-        int x_sel = (nb & 4) >> 2;
-        int y_sel = (nb & 2) >> 1;
-        int z_sel = (nb & 1);
-
-        float x_sign = x_sel * 2.0 - 1.0;
-        float y_sign = y_sel * 2.0 - 1.0;
-        float z_sign = z_sel * 2.0 - 1.0;
-
-        core::Tensor dt = core::Tensor(std::vector<int>{x_sel, y_sel, z_sel},
-                                       {1, 3}, core::Dtype::Int32, device_);
-        keys_nb[nb] = keys + dt;
-        point_ratios_nb[nb] =
-                residuals[0][x_sel] * residuals[1][y_sel] * residuals[2][z_sel];
-        if (pcd.HasPointNormals()) {
-            normal_ratios_nb[nb] =
-                    x_sign * nms[0] * residuals[1][y_sel] *
-                            residuals[2][z_sel] +
-                    y_sign * nms[1] * residuals[0][x_sel] *
-                            residuals[2][z_sel] +
-                    z_sign * nms[2] * residuals[0][x_sel] * residuals[1][y_sel];
-        }
-    }
-
-    keys_nb = keys_nb.View({8 * n, 3});
-
-    core::Tensor addrs_nb, masks_nb;
-    ctr_hashmap_->Find(keys_nb, addrs_nb, masks_nb);
-
-    // (n, 8)
-    addrs_nb = addrs_nb.View({8, n}).T().Contiguous();
-    // (n, 8)
-    point_ratios_nb = point_ratios_nb.T().Contiguous();
-
-    /// TODO(wei): allow entries with less than 8 neighbors, probably in a
-    /// kernel. Now we simply discard them and only accepts points with all
-    /// 8 neighbors in the control grid map.
-    core::Tensor valid_mask =
-            masks_nb.View({8, n}).To(core::Dtype::Int64).Sum({0}).Eq(8);
+    // Points without all 8 neighbors in the control grid map are discarded.
+    core::Tensor nb_indices, nb_point_ratios, nb_normal_ratios, valid_mask;
+    std::shared_ptr<core::DeviceHashmap> hashmap =
+            ctr_hashmap_->GetDeviceHashmap();
+    kernel::ParameterizeControlGrid(hashmap, pcd.GetPoints(), normals,
+                                    nb_indices, nb_point_ratios,
+                                    nb_normal_ratios, valid_mask, grid_size_);
 
     geometry::PointCloud pcd_with_params = pcd;
     pcd_with_params.SetPoints(pcd.GetPoints().IndexGet({valid_mask}));
     pcd_with_params.SetPointAttr(kGrid8NbIndices,
-                                 addrs_nb.IndexGet({valid_mask}));
+                                 nb_indices.IndexGet({valid_mask}));
     pcd_with_params.SetPointAttr(kGrid8NbVertexInterpRatios,
-                                 point_ratios_nb.IndexGet({valid_mask}));
+                                 nb_point_ratios.IndexGet({valid_mask}));
 
     if (pcd.HasPointColors()) {
         pcd_with_params.SetPointColors(
                 pcd.GetPointColors().IndexGet({valid_mask}));
     }
     if (pcd.HasPointNormals()) {
-        pcd_with_params.SetPointNormals(
-                pcd.GetPointNormals().IndexGet({valid_mask}));
-        normal_ratios_nb = normal_ratios_nb.T().Contiguous();
+        pcd_with_params.SetPointNormals(normals.IndexGet({valid_mask}));
         pcd_with_params.SetPointAttr(kGrid8NbNormalInterpRatios,
-                                     normal_ratios_nb.IndexGet({valid_mask}));
+                                     nb_normal_ratios.IndexGet({valid_mask}));
     }
 
     return pcd_with_params;
 }
 
 geometry::PointCloud ControlGrid::Deform(const geometry::PointCloud& pcd) {
-    if (!pcd.HasPointAttr(kGrid8NbIndices) ||
-        !pcd.HasPointAttr(kGrid8NbVertexInterpRatios)) {
-        utility::LogError(
-                "Please use ControlGrid.Parameterize to obtain attributes "
-                "regarding neighbor grids before calling Deform");
-    }
-
-    // N x 3
-    core::Tensor grid_positions = ctr_hashmap_->GetValueTensor();
-
-    // N x 8, we have ensured that every neighbor is valid through
-    // grid.Parameterize
-    core::Tensor nb_grid_indices =
-            pcd.GetPointAttr(kGrid8NbIndices).To(core::Dtype::Int64);
-    core::Tensor nb_grid_positions =
-            grid_positions.IndexGet({nb_grid_indices.View({-1})})
-                    .View({-1, 8, 3});
-
-    // (N, 8, 3) x (N, 8, 1) => Reduce on dim 1 => (N, 3) position
-    // interpolation.
-    core::Tensor nb_grid_point_interp =
-            pcd.GetPointAttr(kGrid8NbVertexInterpRatios);
-    core::Tensor interp_positions =
-            (nb_grid_positions * nb_grid_point_interp.View({-1, 8, 1}))
-                    .Sum({1});
+    core::Tensor deformed_points, deformed_normals;
+    if (pcd.HasPointAttr(kGrid8NbIndices) &&
+        pcd.HasPointAttr(kGrid8NbVertexInterpRatios)) {
+        // Every neighbor is valid, as ensured by Parameterize.
+        core::Tensor nb_normal_ratios;
+        if (pcd.HasPointNormals()) {
+            nb_normal_ratios = pcd.GetPointAttr(kGrid8NbNormalInterpRatios);
+        }
+        kernel::InterpolateControlGrid(
+                ctr_hashmap_->GetValueTensor(),
+                pcd.GetPointAttr(kGrid8NbIndices),
+                pcd.GetPointAttr(kGrid8NbVertexInterpRatios), nb_normal_ratios,
+                deformed_points, deformed_normals);
 
-    geometry::PointCloud interp_pcd(interp_positions);
+        geometry::PointCloud interp_pcd(deformed_points);
+        if (pcd.HasPointNormals()) {
+            interp_pcd.SetPointNormals(deformed_normals);
+        }
+        if (pcd.HasPointColors()) {
+            interp_pcd.SetPointColors(pcd.GetPointColors());
+        }
+        return interp_pcd;
+    }
 
+    // Look up the neighbors and interpolate in one pass, discarding the
+    // points without all 8 neighbors like Parameterize.
+    core::Tensor normals;
     if (pcd.HasPointNormals()) {
-        // (N, 8, 3) x (N, 8, 1) => Reduce on dim 1 => (N, 3) normal
-        // interpolation.
-        core::Tensor nb_grid_normal_interp =
-                pcd.GetPointAttr(kGrid8NbNormalInterpRatios);
-        core::Tensor interp_normals =
-                (nb_grid_positions * nb_grid_normal_interp.View({-1, 8, 1}))
-                        .Sum({1});
-        core::Tensor interp_normals_len =
-                (interp_normals * interp_normals).Sum({1}).Sqrt();
-        interp_normals = interp_normals / interp_normals_len.View({-1, 1});
-        interp_pcd.SetPointNormals(interp_normals);
+        normals = pcd.GetPointNormals();
+    }
+    core::Tensor valid_mask;
+    std::shared_ptr<core::DeviceHashmap> hashmap =
+            ctr_hashmap_->GetDeviceHashmap();
+    kernel::DeformControlGrid(hashmap, ctr_hashmap_->GetValueTensor(),
+                              pcd.GetPoints(), normals, deformed_points,
+                              deformed_normals, valid_mask, grid_size_);
+
+    geometry::PointCloud interp_pcd(deformed_points.IndexGet({valid_mask}));
+    if (pcd.HasPointNormals()) {
+        interp_pcd.SetPointNormals(deformed_normals.IndexGet({valid_mask}));
     }
-
     if (pcd.HasPointColors()) {
-        interp_pcd.SetPointColors(pcd.GetPointColors());
+        interp_pcd.SetPointColors(pcd.GetPointColors().IndexGet({valid_mask}));
     }
     return interp_pcd;
 }
@@ -312,8 +257,7 @@ geometry::Image ControlGrid::Deform(const geometry::Image& depth,
     geometry::PointCloud pcd = geometry::PointCloud::CreateFromDepthImage(
             depth, intrinsics, extrinsics, depth_scale, depth_max);
 
-    geometry::PointCloud pcd_param = Parameterize(pcd);
-    geometry::PointCloud pcd_deformed = Deform(pcd_param);
+    geometry::PointCloud pcd_deformed = Deform(pcd);
 
     return pcd_deformed.ProjectToDepthImage(depth.GetCols(), depth.GetRows(),
                                             intrinsics, extrinsics, depth_scale,
@@ -328,8 +272,7 @@ geometry::RGBDImage ControlGrid::Deform(const geometry::RGBDImage& rgbd,
     geometry::PointCloud pcd = geometry::PointCloud::CreateFromRGBDImage(
             rgbd, intrinsics, extrinsics, depth_scale, depth_max);
 
-    geometry::PointCloud pcd_param = Parameterize(pcd);
-    geometry::PointCloud pcd_deformed = Deform(pcd_param);
+    geometry::PointCloud pcd_deformed = Deform(pcd);
 
     int cols = rgbd.depth_.GetCols();
     int rows = rgbd.color_.GetRows();
@@ -88,15 +88,20 @@ public:
     std::tuple<core::Tensor, core::Tensor, core::Tensor> GetNeighborGridMap();
 
     /// Parameterize an input point cloud by embedding each point in the grid
-    /// with 8 corners via indexing and interpolation.
+    /// with 8 corners via indexing and interpolation. The neighbors are looked
+    /// up and the ratios computed in a single kernel. Points without all 8
+    /// neighbors in the grid are discarded.
     /// \return A PointCloud with parameterization attributes:
     /// - neighbors: Index of 8 neighbor control grid points of shape (8, ) in
-    /// Int64.
+    /// Int32.
     /// - ratios: Interpolation ratios of 8 neighbor control grid
     /// points of shape (8, ) in Float32.
     geometry::PointCloud Parameterize(const geometry::PointCloud& pcd);
 
-    /// Non-rigidly deform a point cloud using the control grid.
+    /// Non-rigidly deform a point cloud using the control grid. If the point
+    /// cloud is not parameterized, the neighbors are looked up and the points
+    /// and normals interpolated in a single kernel, discarding the points
+    /// without all 8 neighbors in the grid.
     geometry::PointCloud Deform(const geometry::PointCloud& pcd);
 
     /// Non-rigidly deform a depth image by
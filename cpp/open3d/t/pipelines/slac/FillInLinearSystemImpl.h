@@ -30,6 +30,8 @@
 
 #include "open3d/core/EigenConverter.h"
 #include "open3d/t/pipelines/kernel/FillInLinearSystem.h"
+#include "open3d/t/pipelines/kernel/SparseJacobian.h"
+#include "open3d/t/pipelines/slac/FragmentLoader.h"
 #include "open3d/t/pipelines/slac/SLACOptimizer.h"
 #include "open3d/utility/FileSystem.h"
 
@@ -41,15 +43,43 @@ namespace slac {
 using namespace open3d::core::eigen_converter;
 using core::Tensor;
 using t::geometry::PointCloud;
+using PoseGraphEdge = open3d::pipelines::registration::PoseGraphEdge;
+
+/// Sparse Jacobian rows of a term of the SLAC objective, as consumed by
+/// kernel::ComputeJtJx() and kernel::ComputeJtr().
+struct JacobianTerm {
+    /// {R, K} Float32 Jacobian entries.
+    Tensor jacobians_;
+    /// {R, K} Int32 variable index of each entry.
+    Tensor jacobian_indices_;
+    /// {R} Float32 residuals.
+    Tensor residuals_;
+};
+
+// Returns the pose graph edges with saved correspondences. The fragment files
+// of their source and target nodes are appended to edge_fnames in the order of
+// the edges, to be read by a FragmentLoader.
+static std::vector<const PoseGraphEdge*> GetEdgesWithCorrespondences(
+        const std::vector<std::string>& fnames,
+        const PoseGraph& pose_graph,
+        const SLACOptimizerParams& params,
+        std::vector<std::string>& edge_fnames) {
+    std::vector<const PoseGraphEdge*> edges;
+    for (auto& edge : pose_graph.edges_) {
+        int i = edge.source_node_id_;
+        int j = edge.target_node_id_;
 
-// Reads pointcloud from filename, and loads on the device as
-// Tensor PointCloud of Float32 dtype.
-static PointCloud CreateTPCDFromFile(
-        const std::string& fname,
-        const core::Device& device = core::Device("CPU:0")) {
-    std::shared_ptr<open3d::geometry::PointCloud> pcd =
-            open3d::io::CreatePointCloudFromFile(fname);
-    return PointCloud::FromLegacyPointCloud(*pcd, core::Dtype::Float32, device);
+        std::string corres_fname = fmt::format("{}/{:03d}_{:03d}.npy",
+                                               params.GetSubfolderName(), i, j);
+        if (!utility::filesystem::FileExists(corres_fname)) {
+            utility::LogWarning("Correspondence {} {} skipped!", i, j);
+            continue;
+        }
+        edges.push_back(&edge);
+        edge_fnames.push_back(fnames[i]);
+        edge_fnames.push_back(fnames[j]);
+    }
+    return edges;
 }
 
 static void FillInRigidAlignmentTerm(Tensor& AtA,
@@ -79,20 +109,21 @@ void FillInRigidAlignmentTerm(Tensor& AtA,
                               const SLACDebugOption& debug_option) {
     core::Device device(params.device_);
 
-    // Enumerate pose graph edges
-    for (auto& edge : pose_graph.edges_) {
-        int i = edge.source_node_id_;
-        int j = edge.target_node_id_;
+    // Enumerate pose graph edges, while their fragments are prefetched.
+    std::vector<std::string> edge_fnames;
+    auto edges = GetEdgesWithCorrespondences(fnames, pose_graph, params,
+                                             edge_fnames);
+    FragmentLoader loader(edge_fnames, device);
+    for (auto edge : edges) {
+        int i = edge->source_node_id_;
+        int j = edge->target_node_id_;
 
         std::string corres_fname = fmt::format("{}/{:03d}_{:03d}.npy",
                                                params.GetSubfolderName(), i, j);
-        if (!utility::filesystem::FileExists(corres_fname)) {
-            utility::LogWarning("Correspondence {} {} skipped!", i, j);
-            continue;
-        }
         Tensor corres_ij = Tensor::Load(corres_fname).To(device);
-        PointCloud tpcd_i = CreateTPCDFromFile(fnames[i], device);
-        PointCloud tpcd_j = CreateTPCDFromFile(fnames[j], device);
+        PointCloud tpcd_i, tpcd_j;
+        loader.Pop(tpcd_i);
+        loader.Pop(tpcd_j);
 
         PointCloud tpcd_i_indexed(
                 tpcd_i.GetPoints().IndexGet({corres_ij.T()[0]}));
@@ -117,8 +148,7 @@ void FillInRigidAlignmentTerm(Tensor& AtA,
     }
 }
 
-static void FillInSLACAlignmentTerm(Tensor& AtA,
-                                    Tensor& Atb,
+static void FillInSLACAlignmentTerm(std::vector<JacobianTerm>& terms,
                                     Tensor& residual,
                                     ControlGrid& ctr_grid,
                                     const PointCloud& tpcd_param_i,
@@ -161,14 +191,23 @@ static void FillInSLACAlignmentTerm(Tensor& AtA,
     Tensor RjT_Ri_Cnormal_ps =
             (Rj.T().Matmul(Ri_Cnormal_ps.T())).T().Contiguous();
 
-    kernel::FillInSLACAlignmentTerm(
-            AtA, Atb, residual, Ti_Cps, Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps,
-            RjT_Ri_Cnormal_ps, cgrid_index_ps, cgrid_index_qs, cgrid_ratio_ps,
-            cgrid_ratio_qs, i, j, n_fragments, threshold);
+    int64_t n = Ti_Cps.GetLength();
+    core::Device device = Ti_Cps.GetDevice();
+    JacobianTerm term;
+    term.jacobians_ = Tensor::Empty({n, 60}, core::Dtype::Float32, device);
+    term.jacobian_indices_ =
+            Tensor::Empty({n, 60}, core::Dtype::Int32, device);
+    term.residuals_ = Tensor::Empty({n}, core::Dtype::Float32, device);
+    kernel::FillInSLACAlignmentJacobian(
+            term.jacobians_, term.jacobian_indices_, term.residuals_, Ti_Cps,
+            Tj_Cqs, Cnormal_ps, Ri_Cnormal_ps, RjT_Ri_Cnormal_ps,
+            cgrid_index_ps, cgrid_index_qs, cgrid_ratio_ps, cgrid_ratio_qs, i,
+            j, n_fragments, threshold);
+    residual += (term.residuals_ * term.residuals_).Sum({0});
+    terms.push_back(term);
 }
 
-void FillInSLACAlignmentTerm(Tensor& AtA,
-                             Tensor& Atb,
+void FillInSLACAlignmentTerm(std::vector<JacobianTerm>& terms,
                              Tensor& residual,
                              ControlGrid& ctr_grid,
                              const std::vector<std::string>& fnames,
@@ -178,21 +217,22 @@ void FillInSLACAlignmentTerm(Tensor& AtA,
     core::Device device(params.device_);
     int n_frags = pose_graph.nodes_.size();
 
-    // Enumerate pose graph edges.
-    for (auto& edge : pose_graph.edges_) {
-        int i = edge.source_node_id_;
-        int j = edge.target_node_id_;
+    // Enumerate pose graph edges, while their fragments are prefetched.
+    std::vector<std::string> edge_fnames;
+    auto edges = GetEdgesWithCorrespondences(fnames, pose_graph, params,
+                                             edge_fnames);
+    FragmentLoader loader(edge_fnames, device);
+    for (auto edge : edges) {
+        int i = edge->source_node_id_;
+        int j = edge->target_node_id_;
 
         std::string corres_fname = fmt::format("{}/{:03d}_{:03d}.npy",
                                                params.GetSubfolderName(), i, j);
-        if (!utility::filesystem::FileExists(corres_fname)) {
-            utility::LogWarning("Correspondence {} {} skipped!", i, j);
-            continue;
-        }
         Tensor corres_ij = Tensor::Load(corres_fname).To(device);
 
-        PointCloud tpcd_i = CreateTPCDFromFile(fnames[i], device);
-        PointCloud tpcd_j = CreateTPCDFromFile(fnames[j], device);
+        PointCloud tpcd_i, tpcd_j;
+        loader.Pop(tpcd_i);
+        loader.Pop(tpcd_j);
 
         PointCloud tpcd_i_indexed(
                 tpcd_i.GetPoints().IndexGet({corres_ij.T()[0]}));
@@ -213,11 +253,11 @@ void FillInSLACAlignmentTerm(Tensor& AtA,
                           .To(device, core::Dtype::Float32);
         auto Tj = EigenMatrixToTensor(pose_graph.nodes_[j].pose_)
                           .To(device, core::Dtype::Float32);
-        auto Tij = EigenMatrixToTensor(edge.transformation_)
+        auto Tij = EigenMatrixToTensor(edge->transformation_)
                            .To(device, core::Dtype::Float32);
 
         // Fill In.
-        FillInSLACAlignmentTerm(AtA, Atb, residual, ctr_grid, tpcd_param_i,
+        FillInSLACAlignmentTerm(terms, residual, ctr_grid, tpcd_param_i,
                                 tpcd_param_j, Ti, Tj, i, j, n_frags,
                                 params.distance_threshold_);
 
@@ -230,8 +270,7 @@ void FillInSLACAlignmentTerm(Tensor& AtA,
     }
 }
 
-void FillInSLACRegularizerTerm(Tensor& AtA,
-                               Tensor& Atb,
+void FillInSLACRegularizerTerm(std::vector<JacobianTerm>& terms,
                                Tensor& residual,
                                ControlGrid& ctr_grid,
                                int n_frags,
@@ -242,11 +281,20 @@ void FillInSLACRegularizerTerm(Tensor& AtA,
 
     Tensor positions_init = ctr_grid.GetInitPositions();
     Tensor positions_curr = ctr_grid.GetCurrPositions();
-    kernel::FillInSLACRegularizerTerm(AtA, Atb, residual, active_addrs,
-                                      nb_addrs, nb_masks, positions_init,
-                                      positions_curr,
-                                      n_frags * params.regularizer_weight_,
-                                      n_frags, ctr_grid.GetAnchorIdx());
+    // 6 neighbors x 3 axes per grid point.
+    int64_t n = active_addrs.GetLength() * 18;
+    core::Device device = positions_curr.GetDevice();
+    JacobianTerm term;
+    term.jacobians_ = Tensor::Empty({n, 2}, core::Dtype::Float32, device);
+    term.jacobian_indices_ = Tensor::Empty({n, 2}, core::Dtype::Int32, device);
+    term.residuals_ = Tensor::Empty({n}, core::Dtype::Float32, device);
+    kernel::FillInSLACRegularizerJacobian(
+            term.jacobians_, term.jacobian_indices_, term.residuals_,
+            active_addrs, nb_addrs, nb_masks, positions_init, positions_curr,
+            n_frags * params.regularizer_weight_, n_frags,
+            ctr_grid.GetAnchorIdx());
+    residual += (term.residuals_ * term.residuals_).Sum({0});
+    terms.push_back(term);
     if (debug_option.debug_) {
         VisualizeGridDeformation(ctr_grid);
     }
@@ -0,0 +1,75 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slac/FragmentLoader.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "open3d/io/PointCloudIO.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slac {
+
+FragmentLoader::FragmentLoader(const std::vector<std::string>& fnames,
+                               const core::Device& device,
+                               size_t capacity,
+                               size_t num_threads)
+    : fnames_(fnames),
+      device_(device),
+      prefetcher_(
+              [this](size_t index, t::geometry::PointCloud& pcd) {
+                  return Load(index, pcd);
+              },
+              device,
+              capacity,
+              std::min(num_threads, std::max(fnames.size(), size_t(1)))) {}
+
+FragmentLoader::~FragmentLoader() {}
+
+bool FragmentLoader::Pop(t::geometry::PointCloud& pcd) {
+    return prefetcher_.Pop(pcd);
+}
+
+bool FragmentLoader::Load(size_t index, t::geometry::PointCloud& pcd) {
+    if (index >= fnames_.size()) {
+        return false;
+    }
+    // A missing or empty file gives an empty fragment, with warnings from
+    // the readers.
+    std::shared_ptr<open3d::geometry::PointCloud> pcd_legacy =
+            io::CreatePointCloudFromFile(fnames_[index]);
+    pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            *pcd_legacy, core::Dtype::Float32, device_);
+    return true;
+}
+
+}  // namespace slac
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
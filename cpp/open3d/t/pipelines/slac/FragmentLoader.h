@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Prefetcher.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace slac {
+
+/// \class FragmentLoader
+///
+/// \brief Reads fragment point clouds from files with a pool of background
+/// threads, ahead of the caller. The fragments are converted to Float32
+/// tensor point clouds and uploaded to the device by the loader threads, so
+/// that reading fragment k + 1 overlaps with processing fragment k. On CUDA
+/// devices each loader thread uploads on a stream of its own.
+///
+/// The fragments are popped in the order of the file names, which may
+/// contain duplicates. At most capacity fragments are loaded or being loaded
+/// ahead of Pop(), see core::Prefetcher.
+class FragmentLoader {
+public:
+    /// \brief Parameterized Constructor, starting the loader threads.
+    ///
+    /// \param fnames Files of the fragments, in the order of Pop().
+    /// \param device Device of the loaded fragments.
+    /// \param capacity Maximum number of fragments loaded ahead of Pop().
+    /// \param num_threads Number of loader threads.
+    FragmentLoader(const std::vector<std::string>& fnames,
+                   const core::Device& device,
+                   size_t capacity = 4,
+                   size_t num_threads = 2);
+
+    /// Stops and joins the loader threads, dropping the fragments not popped.
+    ~FragmentLoader();
+
+    FragmentLoader(const FragmentLoader&) = delete;
+    FragmentLoader& operator=(const FragmentLoader&) = delete;
+
+    /// Moves the next fragment into \p pcd. Returns false once all fragments
+    /// have been popped. Like reading the file directly, a missing or empty
+    /// fragment is returned as an empty point cloud with a warning. Other
+    /// errors of the fragment are rethrown.
+    bool Pop(t::geometry::PointCloud& pcd);
+
+private:
+    /// Reads and uploads the fragment \p index on a loader thread.
+    bool Load(size_t index, t::geometry::PointCloud& pcd);
+
+    std::vector<std::string> fnames_;
+    core::Device device_;
+
+    /// Declared last, so that the loader threads are joined first.
+    core::Prefetcher<t::geometry::PointCloud> prefetcher_;
+};
+
+}  // namespace slac
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
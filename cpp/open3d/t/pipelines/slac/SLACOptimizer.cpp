@@ -26,6 +26,12 @@
 
 #include "open3d/t/pipelines/slac/SLACOptimizer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <thread>
+
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/io/PointCloudIO.h"
@@ -38,6 +44,9 @@ namespace pipelines {
 namespace slac {
 using t::geometry::PointCloud;
 
+// Number of threads preprocessing fragments in parallel.
+static constexpr int kNumPreprocessThreads = 4;
+
 // Write point clouds to disk after preprocessing (remove outliers,
 // estimate normals, etc).
 static std::vector<std::string> PreprocessPointClouds(
@@ -49,33 +58,65 @@ static std::vector<std::string> PreprocessPointClouds(
     }
 
     std::vector<std::string> fnames_processed;
-
-    for (auto& fname : fnames) {
+    std::vector<size_t> indices_to_process;
+    for (size_t k = 0; k < fnames.size(); ++k) {
         std::string fname_processed = fmt::format(
                 "{}/{}", subdir_name,
-                utility::filesystem::GetFileNameWithoutDirectory(fname));
+                utility::filesystem::GetFileNameWithoutDirectory(fnames[k]));
         fnames_processed.emplace_back(fname_processed);
-        if (utility::filesystem::FileExists(fname_processed)) continue;
-
-        auto pcd = io::CreatePointCloudFromFile(fname);
-        if (pcd == nullptr) {
-            utility::LogError("Internal error: pcd is nullptr.");
+        if (!utility::filesystem::FileExists(fname_processed)) {
+            indices_to_process.push_back(k);
         }
+    }
 
-        // Pre-processing input pointcloud.
-        if (params.voxel_size_ > 0) {
-            pcd = pcd->VoxelDownSample(params.voxel_size_);
-            pcd->RemoveStatisticalOutliers(20, 2.0);
-            pcd->EstimateNormals();
-        } else {
-            pcd->RemoveStatisticalOutliers(20, 2.0);
-            if (!pcd->HasNormals()) {
-                pcd->EstimateNormals();
+    // Fragments are read, processed and written independently. Reading
+    // dominates for large fragments, so a few threads process them in
+    // parallel.
+    std::atomic<size_t> next(0);
+    std::vector<std::exception_ptr> errors(indices_to_process.size());
+    auto process = [&]() {
+        for (size_t n = next++; n < indices_to_process.size(); n = next++) {
+            try {
+                size_t k = indices_to_process[n];
+                auto pcd = io::CreatePointCloudFromFile(fnames[k]);
+                if (pcd == nullptr) {
+                    utility::LogError("Internal error: pcd is nullptr.");
+                }
+
+                // Pre-processing input pointcloud.
+                if (params.voxel_size_ > 0) {
+                    pcd = pcd->VoxelDownSample(params.voxel_size_);
+                    pcd->RemoveStatisticalOutliers(20, 2.0);
+                    pcd->EstimateNormals();
+                } else {
+                    pcd->RemoveStatisticalOutliers(20, 2.0);
+                    if (!pcd->HasNormals()) {
+                        pcd->EstimateNormals();
+                    }
+                }
+
+                io::WritePointCloud(fnames_processed[k], *pcd);
+                utility::LogInfo("Saving processed point cloud {}",
+                                 fnames_processed[k]);
+            } catch (...) {
+                errors[n] = std::current_exception();
             }
         }
-
-        io::WritePointCloud(fname_processed, *pcd);
-        utility::LogInfo("Saving processed point cloud {}", fname_processed);
+    };
+    size_t num_threads = std::min(indices_to_process.size(),
+                                  size_t(kNumPreprocessThreads));
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < num_threads; ++t) {
+        threads.emplace_back(process);
+    }
+    process();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
     }
 
     return fnames_processed;
@@ -229,21 +270,36 @@ void SaveCorrespondencesForPointClouds(
         const PoseGraph& pose_graph,
         const SLACOptimizerParams& params,
         const SLACDebugOption& debug_option) {
-    // Enumerate pose graph edges.
+    // Enumerate pose graph edges without saved correspondences, while their
+    // fragments are prefetched.
+    std::vector<const PoseGraphEdge*> edges;
+    std::vector<std::string> edge_fnames;
     for (auto& edge : pose_graph.edges_) {
         int i = edge.source_node_id_;
         int j = edge.target_node_id_;
 
+        std::string correspondences_fname = fmt::format(
+                "{}/{:03d}_{:03d}.npy", params.GetSubfolderName(), i, j);
+        if (utility::filesystem::FileExists(correspondences_fname)) continue;
+
+        edges.push_back(&edge);
+        edge_fnames.push_back(fnames_processed[i]);
+        edge_fnames.push_back(fnames_processed[j]);
+    }
+
+    FragmentLoader loader(edge_fnames, params.device_);
+    for (auto edge : edges) {
+        int i = edge->source_node_id_;
+        int j = edge->target_node_id_;
+
         utility::LogInfo("Processing {:02d} -> {:02d}", i, j);
 
         std::string correspondences_fname = fmt::format(
                 "{}/{:03d}_{:03d}.npy", params.GetSubfolderName(), i, j);
-        if (utility::filesystem::FileExists(correspondences_fname)) continue;
 
-        PointCloud tpcd_i =
-                CreateTPCDFromFile(fnames_processed[i], params.device_);
-        PointCloud tpcd_j =
-                CreateTPCDFromFile(fnames_processed[j], params.device_);
+        PointCloud tpcd_i, tpcd_j;
+        loader.Pop(tpcd_i);
+        loader.Pop(tpcd_j);
 
         // pose of i in model frame.
         core::Tensor T_i = core::eigen_converter::EigenMatrixToTensor(
@@ -253,7 +309,7 @@ void SaveCorrespondencesForPointClouds(
                 pose_graph.nodes_[j].pose_);
         // transformation of i to j.
         core::Tensor T_ij = core::eigen_converter::EigenMatrixToTensor(
-                edge.transformation_);
+                edge->transformation_);
 
         // Get correspondences.
         core::Tensor correspondence_set = GetCorrespondenceSetForPointCloudPair(
@@ -272,10 +328,12 @@ void SaveCorrespondencesForPointClouds(
 static void InitializeControlGrid(ControlGrid& ctr_grid,
                                   const std::vector<std::string>& fnames) {
     core::Device device(ctr_grid.GetDevice());
+    FragmentLoader loader(fnames, device);
     for (auto& fname : fnames) {
         utility::LogInfo("Initializing grid for {}", fname);
 
-        auto tpcd = CreateTPCDFromFile(fname, device);
+        PointCloud tpcd;
+        loader.Pop(tpcd);
         ctr_grid.Touch(tpcd);
     }
     utility::LogInfo("Initialization finished.");
@@ -313,6 +371,79 @@ static void UpdateControlGrid(ControlGrid& ctr_grid, core::Tensor& delta) {
     ctr_grid.GetCurrPositions().Slice(0, 0, ctr_grid.Size()) += delta_cgrids;
 }
 
+// Solves the normal equations (J^T J) delta = -J^T r of the stacked Jacobian
+// \p terms with preconditioned conjugate gradient. J^T J is never formed;
+// products are computed from the Jacobian rows, and the 3x3 diagonal blocks
+// of J^T J serve as a block-Jacobi preconditioner.
+static core::Tensor SolveJacobianTermsPCG(
+        const std::vector<JacobianTerm>& terms,
+        int64_t num_params,
+        const core::Device& device,
+        int max_iterations = 1000,
+        float relative_tolerance = 1e-5) {
+    core::Tensor Jtr =
+            core::Tensor::Zeros({num_params}, core::Dtype::Float32, device);
+    core::Tensor blocks = core::Tensor::Zeros({num_params / 3, 3, 3},
+                                              core::Dtype::Float32, device);
+    for (const JacobianTerm& term : terms) {
+        kernel::ComputeJtr(term.jacobians_, term.jacobian_indices_,
+                           term.residuals_, Jtr);
+        kernel::ComputeJtJBlockDiagonal(term.jacobians_,
+                                        term.jacobian_indices_, blocks);
+    }
+    kernel::InvertBlockDiagonal(blocks);
+
+    auto precondition = [&](const core::Tensor& v) {
+        return (blocks * v.View({-1, 1, 3})).Sum({2}).View({num_params});
+    };
+    auto apply_JtJ = [&](const core::Tensor& v) {
+        core::Tensor JtJv = core::Tensor::Zeros({num_params},
+                                                core::Dtype::Float32, device);
+        for (const JacobianTerm& term : terms) {
+            kernel::ComputeJtJx(term.jacobians_, term.jacobian_indices_, v,
+                                JtJv);
+        }
+        return JtJv;
+    };
+    auto dot = [](const core::Tensor& a, const core::Tensor& b) {
+        return (a * b).Sum({0}).Item<float>();
+    };
+
+    core::Tensor x =
+            core::Tensor::Zeros({num_params}, core::Dtype::Float32, device);
+    core::Tensor r = Jtr.Neg();
+    float b_norm = std::sqrt(dot(r, r));
+    if (b_norm == 0) {
+        return x;
+    }
+    core::Tensor z = precondition(r);
+    core::Tensor p = z.Clone();
+    float rz = dot(r, z);
+
+    int itr = 0;
+    for (; itr < max_iterations; ++itr) {
+        core::Tensor Ap = apply_JtJ(p);
+        float pAp = dot(p, Ap);
+        if (pAp <= 0) {
+            break;
+        }
+        float alpha = rz / pAp;
+        x += p * alpha;
+        r -= Ap * alpha;
+        if (std::sqrt(dot(r, r)) < relative_tolerance * b_norm) {
+            ++itr;
+            break;
+        }
+        z = precondition(r);
+        float rz_new = dot(r, z);
+        p = z + p * (rz_new / rz);
+        rz = rz_new;
+    }
+    utility::LogDebug("PCG stopped after {} iterations, relative residual {}",
+                      itr, std::sqrt(dot(r, r)) / b_norm);
+    return x;
+}
+
 std::pair<PoseGraph, ControlGrid> RunSLACOptimizerForFragments(
         const std::vector<std::string>& fnames,
         const PoseGraph& pose_graph,
@@ -342,37 +473,40 @@ std::pair<PoseGraph, ControlGrid> RunSLACOptimizerForFragments(
     // Fill-in
     // fragments x 6 (se3) + control_grids x 3 (R^3)
     int64_t num_params = fnames_down.size() * 6 + ctr_grid.Size() * 3;
-    utility::LogInfo("Initializing the {}^2 Hessian matrix", num_params);
+    utility::LogInfo("Solving for {} parameters with sparse PCG", num_params);
 
     PoseGraph pose_graph_update(pose_graph);
     for (int itr = 0; itr < params.max_iterations_; ++itr) {
         utility::LogInfo("Iteration {}", itr);
-        core::Tensor AtA = core::Tensor::Zeros({num_params, num_params},
-                                               core::Dtype::Float32, device);
-        core::Tensor Atb = core::Tensor::Zeros({num_params, 1},
-                                               core::Dtype::Float32, device);
-
-        core::Tensor indices_eye0 =
-                core::Tensor::Arange(0, 6, 1, core::Dtype::Int64, device);
-        AtA.IndexSet({indices_eye0, indices_eye0},
-                     core::Tensor::Ones({}, core::Dtype::Float32, device));
+        std::vector<JacobianTerm> terms;
+
+        // Anchor the first fragment with a unit prior on its 6 parameters.
+        JacobianTerm anchor;
+        anchor.jacobians_ =
+                core::Tensor::Ones({6, 1}, core::Dtype::Float32, device);
+        anchor.jacobian_indices_ =
+                core::Tensor::Arange(0, 6, 1, core::Dtype::Int32, device)
+                        .View({6, 1});
+        anchor.residuals_ =
+                core::Tensor::Zeros({6}, core::Dtype::Float32, device);
+        terms.push_back(anchor);
 
         core::Tensor residual_data =
                 core::Tensor::Zeros({1}, core::Dtype::Float32, device);
-        FillInSLACAlignmentTerm(AtA, Atb, residual_data, ctr_grid, fnames_down,
+        FillInSLACAlignmentTerm(terms, residual_data, ctr_grid, fnames_down,
                                 pose_graph_update, params, debug_option);
 
         utility::LogInfo("Alignment loss = {}", residual_data[0].Item<float>());
 
         core::Tensor residual_reg =
                 core::Tensor::Zeros({1}, core::Dtype::Float32, device);
-        FillInSLACRegularizerTerm(AtA, Atb, residual_reg, ctr_grid,
+        FillInSLACRegularizerTerm(terms, residual_reg, ctr_grid,
                                   pose_graph_update.nodes_.size(), params,
                                   debug_option);
         utility::LogInfo("Regularizer loss = {}",
                          residual_reg[0].Item<float>());
 
-        core::Tensor delta = AtA.Solve(Atb.Neg());
+        core::Tensor delta = SolveJacobianTermsPCG(terms, num_params, device);
 
         core::Tensor delta_poses =
                 delta.Slice(0, 0, 6 * pose_graph_update.nodes_.size());
@@ -57,8 +57,22 @@ public:
     }
     core::Tensor GetIntrinsics() const { return intrinsics_; }
 
+    /// Sets the data \p name. If the frame already holds a buffer of the same
+    /// shape and dtype, \p data is copied into it, so that the buffers of a
+    /// frame reused over a sequence are only allocated once.
     void SetData(const std::string& name, const core::Tensor& data) {
-        data_[name] = data.To(device_);
+        auto it = data_.find(name);
+        if (it != data_.end() && it->second.GetShape() == data.GetShape() &&
+            it->second.GetDtype() == data.GetDtype()) {
+            if (it->second.GetDataPtr() != data.GetDataPtr()) {
+                it->second.CopyFrom(data);
+            }
+            return;
+        }
+        data_[name] = data.To(device_, /*copy=*/true);
+    }
+    bool HasData(const std::string& name) const {
+        return data_.count(name) != 0;
     }
     core::Tensor GetData(const std::string& name) const {
         if (data_.count(name) == 0) {
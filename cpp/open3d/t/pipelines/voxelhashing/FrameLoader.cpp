@@ -0,0 +1,84 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/voxelhashing/FrameLoader.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace voxelhashing {
+
+FrameLoader::FrameLoader(const ReadFunction& read,
+                         int height,
+                         int width,
+                         const core::Tensor& intrinsics,
+                         const core::Device& device,
+                         size_t capacity)
+    : read_(read),
+      height_(height),
+      width_(width),
+      intrinsics_(intrinsics),
+      device_(device),
+      prefetcher_(
+              [this](size_t, std::unique_ptr<Frame>& frame) {
+                  return Load(frame);
+              },
+              device,
+              capacity) {}
+
+FrameLoader::~FrameLoader() {}
+
+bool FrameLoader::Pop(Frame& frame) {
+    std::unique_ptr<Frame> loaded;
+    if (!prefetcher_.Pop(loaded)) {
+        return false;
+    }
+    frame = std::move(*loaded);
+    return true;
+}
+
+bool FrameLoader::Load(std::unique_ptr<Frame>& frame) {
+    t::geometry::Image depth, color;
+    try {
+        if (!read_(depth, color)) {
+            return false;
+        }
+    } catch (const std::exception& e) {
+        utility::LogWarning("[FrameLoader] Failed to read a frame: {}",
+                            e.what());
+        return false;
+    }
+
+    frame = std::make_unique<Frame>(height_, width_, intrinsics_, device_);
+    frame->SetDataFromImage("depth", depth);
+    frame->SetDataFromImage("color", color);
+    return true;
+}
+
+}  // namespace voxelhashing
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,100 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "open3d/core/Prefetcher.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/pipelines/voxelhashing/Frame.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace voxelhashing {
+
+/// \class FrameLoader
+///
+/// \brief Loads input frames in a background thread ahead of the
+/// reconstruction, so that reading and uploading frame k + 1 overlaps with
+/// tracking and integrating frame k in the caller's thread. On CUDA devices
+/// the frames are uploaded on a dedicated stream.
+///
+/// At most capacity frames are loaded ahead of Pop(), see core::Prefetcher.
+class FrameLoader {
+public:
+    /// Reads the next depth and color images on the host. Returns false at
+    /// the end of the sequence.
+    using ReadFunction = std::function<bool(t::geometry::Image& depth,
+                                            t::geometry::Image& color)>;
+
+    /// \brief Parameterized Constructor, starting the loader thread.
+    ///
+    /// \param read Function reading the frames in order, called from the
+    /// loader thread.
+    /// \param height Height of the frames.
+    /// \param width Width of the frames.
+    /// \param intrinsics Intrinsic matrix of the frames.
+    /// \param device Device of the frames.
+    /// \param capacity Maximum number of frames loaded ahead of Pop().
+    FrameLoader(const ReadFunction& read,
+                int height,
+                int width,
+                const core::Tensor& intrinsics,
+                const core::Device& device,
+                size_t capacity = 2);
+
+    /// Stops and joins the loader thread, dropping the frames not popped.
+    ~FrameLoader();
+
+    FrameLoader(const FrameLoader&) = delete;
+    FrameLoader& operator=(const FrameLoader&) = delete;
+
+    /// Moves the next frame, with "depth" and "color" data on the device,
+    /// into \p frame. Returns false once all frames have been popped.
+    bool Pop(Frame& frame);
+
+private:
+    /// Reads and uploads the next frame on the loader thread.
+    bool Load(std::unique_ptr<Frame>& frame);
+
+    ReadFunction read_;
+    int height_;
+    int width_;
+    core::Tensor intrinsics_;
+    core::Device device_;
+
+    /// Declared last, so that the loader thread is joined first.
+    core::Prefetcher<std::unique_ptr<Frame>> prefetcher_;
+};
+
+}  // namespace voxelhashing
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,273 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/voxelhashing/LoopClosure.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "open3d/core/EigenConverter.h"
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+#include "open3d/pipelines/registration/Registration.h"
+#include "open3d/t/pipelines/registration/Registration.h"
+#include "open3d/t/pipelines/registration/TransformationEstimation.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace voxelhashing {
+
+namespace legacy_registration = open3d::pipelines::registration;
+
+LoopClosure::LoopClosure(const LoopClosureOption& option) : option_(option) {
+    worker_thread_ = std::thread(&LoopClosure::Run, this);
+}
+
+LoopClosure::~LoopClosure() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    pending_or_stop_.notify_all();
+    worker_thread_.join();
+}
+
+int LoopClosure::AddKeyframe(const Frame& frame,
+                             const core::Tensor& T_frame_to_world) {
+    T_frame_to_world.AssertShape({4, 4});
+    // The data is copied, as the frame buffers are reused by the caller.
+    Frame keyframe(frame.GetHeight(), frame.GetWidth(), frame.GetIntrinsics(),
+                   frame.GetData("depth").GetDevice());
+    keyframe.SetData("depth", frame.GetData("depth"));
+    keyframe.SetData("color", frame.GetData("color"));
+
+    int index;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        index = int(keyframes_.size());
+        keyframes_.push_back(Keyframe{
+                keyframe,
+                T_frame_to_world.To(core::Device("CPU:0"), core::Dtype::Float64,
+                                    /*copy=*/true),
+                geometry::PointCloud()});
+        pending_.push_back(index);
+    }
+    pending_or_stop_.notify_one();
+    return index;
+}
+
+void LoopClosure::WaitForPendingKeyframes() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] { return pending_.empty() && !processing_; });
+}
+
+int LoopClosure::GetKeyframeCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return int(keyframes_.size());
+}
+
+int LoopClosure::GetLoopClosureCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return loop_closure_count_;
+}
+
+std::vector<Frame> LoopClosure::GetKeyframes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<Frame> frames;
+    for (const Keyframe& keyframe : keyframes_) {
+        frames.push_back(keyframe.frame_);
+    }
+    return frames;
+}
+
+std::vector<core::Tensor> LoopClosure::GetKeyframePoses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<core::Tensor> poses;
+    for (const Keyframe& keyframe : keyframes_) {
+        poses.push_back(keyframe.pose_);
+    }
+    return poses;
+}
+
+std::vector<core::Tensor> LoopClosure::OptimizePoses() {
+    WaitForPendingKeyframes();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    legacy_registration::PoseGraph pose_graph;
+    for (const Keyframe& keyframe : keyframes_) {
+        pose_graph.nodes_.emplace_back(
+                core::eigen_converter::TensorToEigenMatrixXd(keyframe.pose_));
+    }
+    pose_graph.edges_ = edges_;
+    legacy_registration::GlobalOptimization(
+            pose_graph,
+            legacy_registration::GlobalOptimizationLevenbergMarquardt(),
+            legacy_registration::GlobalOptimizationConvergenceCriteria(),
+            legacy_registration::GlobalOptimizationOption(
+                    option_.max_correspondence_distance, 0.25, 1.0, 0));
+
+    std::vector<core::Tensor> poses;
+    for (size_t i = 0; i < keyframes_.size(); ++i) {
+        Eigen::Matrix4d pose = pose_graph.nodes_[i].pose_;
+        keyframes_[i].pose_ = core::eigen_converter::EigenMatrixToTensor(pose);
+        poses.push_back(keyframes_[i].pose_);
+    }
+    edges_ = pose_graph.edges_;
+    return poses;
+}
+
+void LoopClosure::Run() {
+    while (true) {
+        int index;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            pending_or_stop_.wait(
+                    lock, [this] { return !pending_.empty() || stop_; });
+            if (stop_) {
+                break;
+            }
+            index = pending_.front();
+            pending_.pop_front();
+            processing_ = true;
+        }
+        try {
+            ProcessKeyframe(index);
+        } catch (const std::exception& e) {
+            utility::LogWarning(
+                    "[LoopClosure] Failed to process keyframe {}: {}", index,
+                    e.what());
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            processing_ = false;
+        }
+        idle_.notify_all();
+    }
+}
+
+void LoopClosure::ProcessKeyframe(int index) {
+    // The point clouds of the previous keyframes, which are all processed.
+    std::vector<std::pair<int, Keyframe>> previous;
+    const Keyframe keyframe = [&]() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (int i = 0; i < index; ++i) {
+            previous.emplace_back(i, keyframes_[i]);
+        }
+        return keyframes_[index];
+    }();
+
+    const core::Device& device = keyframe.frame_.GetData("depth").GetDevice();
+    geometry::PointCloud point_cloud =
+            geometry::PointCloud::CreateFromDepthImageVoxelDownSample(
+                    keyframe.frame_.GetDataAsImage("depth"),
+                    keyframe.frame_.GetIntrinsics(), option_.voxel_size,
+                    core::Tensor::Eye(4, core::Dtype::Float32, device),
+                    option_.depth_scale, option_.depth_max);
+    point_cloud.EstimateNormals(30, option_.voxel_size * 2);
+    const open3d::geometry::PointCloud legacy_point_cloud =
+            point_cloud.ToLegacyPointCloud();
+    const Eigen::Matrix4d pose =
+            core::eigen_converter::TensorToEigenMatrixXd(keyframe.pose_);
+
+    std::vector<legacy_registration::PoseGraphEdge> edges;
+    // Odometry from the previous keyframe, as tracked.
+    if (index > 0) {
+        const Keyframe& last = previous.back().second;
+        Eigen::Matrix4d T_last_to_current =
+                pose.inverse() *
+                core::eigen_converter::TensorToEigenMatrixXd(last.pose_);
+        Eigen::Matrix6d information =
+                legacy_registration::GetInformationMatrixFromPointClouds(
+                        last.point_cloud_.ToLegacyPointCloud(),
+                        legacy_point_cloud,
+                        option_.max_correspondence_distance,
+                        T_last_to_current);
+        edges.emplace_back(index - 1, index, T_last_to_current, information,
+                           false);
+    }
+
+    // Loop closure candidates, the closest older keyframes.
+    std::vector<std::pair<double, int>> candidates;
+    for (int i = 0; i < index - option_.min_keyframe_gap; ++i) {
+        Eigen::Matrix4d candidate_pose =
+                core::eigen_converter::TensorToEigenMatrixXd(
+                        previous[i].second.pose_);
+        double distance = (candidate_pose.block<3, 1>(0, 3) -
+                           pose.block<3, 1>(0, 3))
+                                  .norm();
+        if (distance < option_.search_radius) {
+            candidates.emplace_back(distance, i);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+    if (int(candidates.size()) > option_.max_candidates) {
+        candidates.resize(option_.max_candidates);
+    }
+
+    for (const auto& candidate : candidates) {
+        const Keyframe& target = previous[candidate.second].second;
+        Eigen::Matrix4d init =
+                core::eigen_converter::TensorToEigenMatrixXd(target.pose_)
+                        .inverse() *
+                pose;
+        auto result = t::pipelines::registration::RegistrationICP(
+                point_cloud, target.point_cloud_,
+                option_.max_correspondence_distance,
+                core::eigen_converter::EigenMatrixToTensor(init),
+                t::pipelines::registration::
+                        TransformationEstimationPointToPlane(),
+                t::pipelines::registration::ICPConvergenceCriteria(
+                        1e-6, 1e-6, option_.max_iterations));
+        if (result.fitness_ < option_.min_fitness) {
+            continue;
+        }
+        Eigen::Matrix4d transformation =
+                core::eigen_converter::TensorToEigenMatrixXd(
+                        result.transformation_.To(core::Device("CPU:0"),
+                                                  core::Dtype::Float64));
+        Eigen::Matrix6d information =
+                legacy_registration::GetInformationMatrixFromPointClouds(
+                        legacy_point_cloud,
+                        target.point_cloud_.ToLegacyPointCloud(),
+                        option_.max_correspondence_distance, transformation);
+        edges.emplace_back(index, candidate.second, transformation,
+                           information, true);
+        utility::LogDebug(
+                "[LoopClosure] Keyframe {} closes a loop with keyframe {}, "
+                "fitness {:.3f}.",
+                index, candidate.second, result.fitness_);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    keyframes_[index].point_cloud_ = point_cloud;
+    loop_closure_count_ += int(edges.size()) - (index > 0 ? 1 : 0);
+    edges_.insert(edges_.end(), edges.begin(), edges.end());
+}
+
+}  // namespace voxelhashing
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
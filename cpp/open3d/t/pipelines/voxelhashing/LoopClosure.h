@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/voxelhashing/Frame.h"
+#include "open3d/t/pipelines/voxelhashing/Option.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace voxelhashing {
+
+/// \class LoopClosure
+///
+/// \brief Keyframe database of the voxel hashing pipeline, detecting revisits
+/// to correct the drift of frame-to-model tracking.
+///
+/// Keyframes are added with their tracked pose. A background thread compares
+/// each new keyframe with the older keyframes whose camera centers are within
+/// the search radius, and verifies the closest candidates with point to plane
+/// tensor ICP. OptimizePoses() optimizes the pose graph of the keyframes,
+/// with the odometry between consecutive keyframes and the verified loop
+/// closures, and Model::Reintegrate() rebuilds the volume from the keyframes
+/// at the optimized poses.
+class LoopClosure {
+public:
+    LoopClosure(const LoopClosureOption& option = LoopClosureOption());
+
+    /// Stops and joins the background thread, dropping the keyframes not
+    /// processed yet.
+    ~LoopClosure();
+
+    LoopClosure(const LoopClosure&) = delete;
+    LoopClosure& operator=(const LoopClosure&) = delete;
+
+    /// Adds a copy of \p frame, with its "depth" and "color" data, as a
+    /// keyframe at \p T_frame_to_world, a (4, 4) Float64 tensor. Returns the
+    /// index of the keyframe.
+    int AddKeyframe(const Frame& frame, const core::Tensor& T_frame_to_world);
+
+    /// Blocks until the background thread has processed all the keyframes.
+    void WaitForPendingKeyframes();
+
+    /// Returns the number of keyframes.
+    int GetKeyframeCount() const;
+
+    /// Returns the number of verified loop closures.
+    int GetLoopClosureCount() const;
+
+    /// Returns the keyframes.
+    std::vector<Frame> GetKeyframes() const;
+
+    /// Returns the poses of the keyframes, (4, 4) Float64 tensors on CPU.
+    std::vector<core::Tensor> GetKeyframePoses() const;
+
+    /// Optimizes the pose graph of the keyframes after processing all of
+    /// them, and updates and returns the poses of the keyframes. The first
+    /// keyframe is fixed, and wrong loop closures are pruned.
+    std::vector<core::Tensor> OptimizePoses();
+
+private:
+    struct Keyframe {
+        Frame frame_;
+        core::Tensor pose_;
+        geometry::PointCloud point_cloud_;
+    };
+
+    void Run();
+    void ProcessKeyframe(int index);
+
+    LoopClosureOption option_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable pending_or_stop_;
+    std::condition_variable idle_;
+    std::vector<Keyframe> keyframes_;
+    std::deque<int> pending_;
+    bool processing_ = false;
+    bool stop_ = false;
+    std::vector<open3d::pipelines::registration::PoseGraphEdge> edges_;
+    int loop_closure_count_ = 0;
+
+    std::thread worker_thread_;
+};
+
+}  // namespace voxelhashing
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -53,7 +53,11 @@ Model::Model(float voxel_size,
                   block_resolution,
                   est_block_count,
                   device),
-      T_frame_to_world_(T_init.To(core::Device("CPU:0"))) {}
+      T_frame_to_world_(T_init.To(core::Device("CPU:0"))),
+      voxel_size_(voxel_size),
+      sdf_trunc_(sdf_trunc),
+      block_resolution_(block_resolution),
+      block_count_(est_block_count) {}
 
 void Model::SynthesizeModelFrame(Frame& raycast_frame,
                                  float depth_scale,
@@ -66,8 +70,16 @@ void Model::SynthesizeModelFrame(Frame& raycast_frame,
     if (enable_color) {
         flag |= MaskCode::ColorMap;
     }
-    auto result = voxel_grid_.RayCast(
-            raycast_frame.GetIntrinsics(),
+    // Ray cast into the buffers of the frame from previous calls.
+    std::unordered_map<MaskCode, core::Tensor> result;
+    if (raycast_frame.HasData("depth")) {
+        result.emplace(MaskCode::DepthMap, raycast_frame.GetData("depth"));
+    }
+    if (enable_color && raycast_frame.HasData("color")) {
+        result.emplace(MaskCode::ColorMap, raycast_frame.GetData("color"));
+    }
+    voxel_grid_.RayCast(
+            result, raycast_frame.GetIntrinsics(),
             t::geometry::InverseTransformation(GetCurrentFramePose()),
             raycast_frame.GetWidth(), raycast_frame.GetHeight(), depth_scale,
             depth_min, depth_max, std::min(frame_id_ * 1.0f, 3.0f), flag);
@@ -107,6 +119,29 @@ void Model::Integrate(const Frame& input_frame,
             depth_scale, depth_max);
 }
 
+void Model::Reintegrate(const std::vector<Frame>& frames,
+                        const std::vector<core::Tensor>& poses,
+                        float depth_scale,
+                        float depth_max) {
+    if (frames.size() != poses.size()) {
+        utility::LogError("Expected {} poses for {} frames, but got {}.",
+                          frames.size(), frames.size(), poses.size());
+    }
+    voxel_grid_ = t::geometry::TSDFVoxelGrid({{"tsdf", core::Dtype::Float32},
+                                              {"weight", core::Dtype::UInt16},
+                                              {"color", core::Dtype::UInt16}},
+                                             voxel_size_, sdf_trunc_,
+                                             block_resolution_, block_count_,
+                                             voxel_grid_.GetDevice());
+    for (size_t i = 0; i < frames.size(); ++i) {
+        voxel_grid_.Integrate(frames[i].GetDataAsImage("depth"),
+                              frames[i].GetDataAsImage("color"),
+                              frames[i].GetIntrinsics(),
+                              t::geometry::InverseTransformation(poses[i]),
+                              depth_scale, depth_max);
+    }
+}
+
 t::geometry::PointCloud Model::ExtractPointCloud(int estimated_number,
                                                  float weight_threshold) {
     return voxel_grid_.ExtractSurfacePoints(estimated_number, weight_threshold);
@@ -98,6 +98,18 @@ public:
                    float depth_scale,
                    float depth_max);
 
+    /// Reset the voxel grid and integrate the frames again at the given poses,
+    /// e.g. the keyframe poses optimized by LoopClosure.
+    /// \param frames Input RGBD frames.
+    /// \param poses Poses (T_frame_to_world) of the frames, (4, 4) Tensors.
+    /// \param depth_scale Scale factor to convert raw data into meter metric.
+    /// \param depth_max Depth truncation to discard points far away from the
+    /// camera.
+    void Reintegrate(const std::vector<Frame>& frames,
+                     const std::vector<core::Tensor>& poses,
+                     float depth_scale,
+                     float depth_max);
+
     /// Extract surface point cloud for visualization / model saving.
     /// \param estimated_number Estimation of the point cloud size, helpful for
     /// real-time visualization.
@@ -128,6 +140,13 @@ public:
     core::Tensor T_frame_to_world_;
 
     int frame_id_ = -1;
+
+private:
+    /// Voxel grid parameters, to reset the voxel grid on reintegration.
+    float voxel_size_ = 0;
+    float sdf_trunc_ = 0;
+    int block_resolution_ = 0;
+    int block_count_ = 0;
 };
 }  // namespace voxelhashing
 }  // namespace pipelines
@@ -51,6 +51,31 @@ struct Option {
     float depth_diff = 0.07f;
 };
 
+/// Options of LoopClosure.
+struct LoopClosureOption {
+    LoopClosureOption() {}
+
+    /// Voxel size of the keyframe point clouds used for verification.
+    double voxel_size = 0.02;
+    /// Maximum distance between the camera centers of a keyframe and a loop
+    /// closure candidate.
+    double search_radius = 1.0;
+    /// Number of most recent keyframes that are not loop closure candidates.
+    int min_keyframe_gap = 5;
+    /// Maximum number of candidates verified per keyframe, the closest ones.
+    int max_candidates = 3;
+
+    /// ICP options of the verification.
+    double max_correspondence_distance = 0.05;
+    int max_iterations = 30;
+    /// Minimum ICP fitness of an accepted loop closure.
+    double min_fitness = 0.3;
+
+    /// Depth conversion of the keyframes.
+    float depth_scale = 1000.0f;
+    float depth_max = 3.0f;
+};
+
 }  // namespace voxelhashing
 }  // namespace pipelines
 }  // namespace t
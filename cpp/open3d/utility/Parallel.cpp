@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Parallel.h"
+
+#include <tbb/global_control.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+/// The limit set by SetNumThreads(), or 0 for GetDefaultNumThreads().
+std::atomic<int> g_num_threads(0);
+
+/// The limit of the innermost ScopedNumThreads of this thread, or 0.
+thread_local int t_scoped_num_threads = 0;
+
+/// The arena of the innermost ScopedNumThreads of this thread.
+thread_local std::shared_ptr<tbb::task_arena> t_scoped_arena;
+
+std::mutex g_control_mutex;
+std::unique_ptr<tbb::global_control> g_tbb_control;
+
+}  // namespace
+
+int GetDefaultNumThreads() {
+    static const int default_num_threads = []() {
+        if (const char* env = std::getenv("OMP_NUM_THREADS")) {
+            try {
+                const int num_threads = std::stoi(env);
+                if (num_threads > 0) {
+                    return num_threads;
+                }
+            } catch (const std::exception&) {
+            }
+        }
+        return std::max(1, int(std::thread::hardware_concurrency()));
+    }();
+    return default_num_threads;
+}
+
+int GetNumThreads() {
+    if (t_scoped_num_threads > 0) {
+        return t_scoped_num_threads;
+    }
+    const int num_threads = g_num_threads.load(std::memory_order_relaxed);
+    return num_threads > 0 ? num_threads : GetDefaultNumThreads();
+}
+
+void SetNumThreads(int num_threads) {
+    std::lock_guard<std::mutex> lock(g_control_mutex);
+    g_num_threads.store(std::max(num_threads, 0), std::memory_order_relaxed);
+    const int effective =
+            num_threads > 0 ? num_threads : GetDefaultNumThreads();
+#ifdef _OPENMP
+    omp_set_num_threads(effective);
+#endif
+    // Replace the old control first, since TBB uses the minimum of all active
+    // controls.
+    g_tbb_control.reset();
+    if (num_threads > 0) {
+        g_tbb_control.reset(new tbb::global_control(
+                tbb::global_control::max_allowed_parallelism, effective));
+    }
+}
+
+ScopedNumThreads::ScopedNumThreads(int num_threads)
+    : prev_num_threads_(t_scoped_num_threads),
+      prev_omp_num_threads_(0),
+      prev_arena_(t_scoped_arena) {
+    if (num_threads <= 0) {
+        LogError("Number of threads must be > 0, but got {}.", num_threads);
+    }
+    t_scoped_num_threads = num_threads;
+    t_scoped_arena = std::make_shared<tbb::task_arena>(num_threads);
+#ifdef _OPENMP
+    prev_omp_num_threads_ = omp_get_max_threads();
+    omp_set_num_threads(num_threads);
+#endif
+}
+
+ScopedNumThreads::~ScopedNumThreads() {
+    t_scoped_num_threads = prev_num_threads_;
+    t_scoped_arena = prev_arena_;
+#ifdef _OPENMP
+    omp_set_num_threads(prev_omp_num_threads_);
+#endif
+}
+
+std::shared_ptr<tbb::task_arena> GetScopedTaskArena() {
+    return t_scoped_arena;
+}
+
+}  // namespace utility
+}  // namespace open3d
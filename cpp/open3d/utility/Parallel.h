@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+
+#include <cstdint>
+#include <memory>
+
+namespace open3d {
+namespace utility {
+
+/// Returns the default number of threads, which is the value of the
+/// OMP_NUM_THREADS environment variable if set or else the number of logical
+/// cores.
+int GetDefaultNumThreads();
+
+/// Returns the maximum number of threads used by the parallel CPU code that
+/// is started from the calling thread.
+int GetNumThreads();
+
+/// \brief Sets the maximum number of threads used by the parallel CPU code.
+///
+/// The limit is shared by OpenMP parallel regions and TBB algorithms, so that
+/// both do not start a thread per core each. The core CPU launchers apply the
+/// limit on every thread. Other OpenMP loops apply it on the calling thread;
+/// use ScopedNumThreads on threads that did not call this function.
+///
+/// \param num_threads The maximum number of threads. Values <= 0 restore
+/// GetDefaultNumThreads().
+void SetNumThreads(int num_threads);
+
+/// \brief Limits the number of threads of the calling thread for the lifetime
+/// of this object.
+///
+/// This is meant for per-call limits, e.g. for a request handler of a service
+/// that shares the cores with other handlers. Scopes can be nested.
+class ScopedNumThreads {
+public:
+    explicit ScopedNumThreads(int num_threads);
+    ~ScopedNumThreads();
+
+    ScopedNumThreads(const ScopedNumThreads&) = delete;
+    ScopedNumThreads& operator=(const ScopedNumThreads&) = delete;
+
+private:
+    int prev_num_threads_;
+    int prev_omp_num_threads_;
+    std::shared_ptr<tbb::task_arena> prev_arena_;
+};
+
+/// Returns the TBB task arena with GetNumThreads() threads if the calling
+/// thread is in a ScopedNumThreads, and nullptr otherwise.
+std::shared_ptr<tbb::task_arena> GetScopedTaskArena();
+
+/// \brief Runs `func(i)` for i in [begin, end) on the work-stealing TBB
+/// scheduler within the thread limit of the calling thread.
+///
+/// Unlike the OpenMP loops, which split the range statically, this balances
+/// irregular workloads, e.g. per-point neighbor searches.
+///
+/// \param begin The first index.
+/// \param end The index after the last index.
+/// \param func The function with signature `void func(int64_t)`.
+/// \param grain_size The minimum number of indices per task.
+template <typename func_t>
+void ParallelFor(int64_t begin,
+                 int64_t end,
+                 const func_t& func,
+                 int64_t grain_size = 1) {
+    if (begin >= end) {
+        return;
+    }
+    auto loop = [&]() {
+        tbb::parallel_for(tbb::blocked_range<int64_t>(begin, end, grain_size),
+                          [&](const tbb::blocked_range<int64_t>& range) {
+                              for (int64_t i = range.begin(); i < range.end();
+                                   ++i) {
+                                  func(i);
+                              }
+                          });
+    };
+    if (auto arena = GetScopedTaskArena()) {
+        arena->execute(loop);
+    } else {
+        loop();
+    }
+}
+
+}  // namespace utility
+}  // namespace open3d
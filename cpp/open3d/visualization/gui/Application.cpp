@@ -52,6 +52,7 @@
 #include "open3d/visualization/gui/Theme.h"
 #include "open3d/visualization/gui/Util.h"
 #include "open3d/visualization/gui/Window.h"
+#include "open3d/visualization/rendering/Camera.h"
 #include "open3d/visualization/rendering/Renderer.h"
 #include "open3d/visualization/rendering/Scene.h"
 #include "open3d/visualization/rendering/View.h"
@@ -725,6 +726,50 @@ std::shared_ptr<geometry::Image> Application::RenderToDepthImage(
     return img;
 }
 
+std::vector<Application::RenderedImages> Application::RenderToImages(
+        rendering::Renderer &renderer,
+        rendering::View *view,
+        rendering::Scene *scene,
+        int width,
+        int height,
+        const std::vector<Eigen::Matrix4d> &extrinsics,
+        bool depth,
+        int max_frames_in_flight) {
+    std::vector<RenderedImages> images(extrinsics.size());
+    view->SetViewport(0, 0, width, height);
+
+    // Each request copies the view and its camera when it is queued, so the
+    // camera can be moved to the next pose right away.
+    auto *camera = view->GetCamera();
+    const auto model_matrix = camera->GetModelMatrix();
+    const size_t batch_size = size_t(std::max(1, max_frames_in_flight));
+    for (size_t begin = 0; begin < extrinsics.size(); begin += batch_size) {
+        const size_t end = std::min(extrinsics.size(), begin + batch_size);
+        for (size_t i = begin; i < end; ++i) {
+            auto &out = images[i];
+            camera->FromExtrinsics(extrinsics[i]);
+            renderer.RenderToImage(
+                    view, scene,
+                    [&out](std::shared_ptr<geometry::Image> img) {
+                        out.color = img;
+                    });
+            if (depth) {
+                renderer.RenderToDepthImage(
+                        view, scene,
+                        [&out](std::shared_ptr<geometry::Image> img) {
+                            out.depth = img;
+                        });
+            }
+        }
+        // Renders all the queued requests and waits for their readbacks.
+        renderer.BeginFrame();
+        renderer.EndFrame();
+    }
+
+    camera->SetModelMatrix(model_matrix);
+    return images;
+}
+
 }  // namespace gui
 }  // namespace visualization
 }  // namespace open3d
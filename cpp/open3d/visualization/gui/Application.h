@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <Eigen/Core>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -199,6 +200,30 @@ public:
             int width,
             int height);
 
+    /// Images rendered for one camera pose by RenderToImages(). Images that
+    /// were not requested are null.
+    struct RenderedImages {
+        std::shared_ptr<geometry::Image> color;
+        std::shared_ptr<geometry::Image> depth;
+    };
+
+    /// Renders the scene once for each camera pose in \p extrinsics, keeping
+    /// the projection of the view's camera. Up to \p max_frames_in_flight
+    /// poses are queued and then rendered and read back together with one
+    /// engine flush, which is much faster than calling RenderToImage() once
+    /// per pose. If \p depth is true, the depth images are rendered in the
+    /// same frames as the color images. Like RenderToImage(), this MUST NOT
+    /// be called while in Run().
+    std::vector<RenderedImages> RenderToImages(
+            rendering::Renderer &renderer,
+            rendering::View *view,
+            rendering::Scene *scene,
+            int width,
+            int height,
+            const std::vector<Eigen::Matrix4d> &extrinsics,
+            bool depth = false,
+            int max_frames_in_flight = 8);
+
 private:
     Application();
 
@@ -115,6 +115,7 @@ struct BitmapTextInputEvent : public BitmapEvent {
 
 struct BitmapWindowSystem::Impl {
     BitmapWindowSystem::OnDrawCallback on_draw_;
+    BitmapWindowSystem::WantsFramesCallback wants_frames_;
     std::queue<std::shared_ptr<BitmapEvent>> event_queue_;
 };
 
@@ -134,12 +135,19 @@ BitmapWindowSystem::~BitmapWindowSystem() {}
 
 void BitmapWindowSystem::Initialize() {}
 
-void BitmapWindowSystem::Uninitialize() { impl_->on_draw_ = nullptr; }
+void BitmapWindowSystem::Uninitialize() {
+    impl_->on_draw_ = nullptr;
+    impl_->wants_frames_ = nullptr;
+}
 
 void BitmapWindowSystem::SetOnWindowDraw(OnDrawCallback callback) {
     impl_->on_draw_ = callback;
 }
 
+void BitmapWindowSystem::SetOnWindowWantsFrames(WantsFramesCallback callback) {
+    impl_->wants_frames_ = callback;
+}
+
 void BitmapWindowSystem::WaitEventsTimeout(double timeout_secs) {
     auto t0 = std::chrono::steady_clock::now();
     std::chrono::duration<double> duration;
@@ -199,6 +207,9 @@ void BitmapWindowSystem::DestroyWindow(OSWindow w) {
 
 void BitmapWindowSystem::PostRedrawEvent(OSWindow w) {
     auto hw = (BitmapWindow *)w;
+    if (impl_->wants_frames_ && !impl_->wants_frames_(hw->o3d_window)) {
+        return;
+    }
     impl_->event_queue_.push(std::make_shared<BitmapDrawEvent>(hw));
 }
 
@@ -61,6 +61,12 @@ public:
             std::function<void(Window*, std::shared_ptr<core::Tensor>)>;
     void SetOnWindowDraw(OnDrawCallback callback);
 
+    /// Returns whether anything consumes the frames of a window. If set,
+    /// redraws of windows for which it returns false are dropped, so windows
+    /// are only rendered on demand.
+    using WantsFramesCallback = std::function<bool(Window*)>;
+    void SetOnWindowWantsFrames(WantsFramesCallback callback);
+
     void WaitEventsTimeout(double timeout_secs) override;
 
     OSWindow CreateOSWindow(Window* o3d_window,
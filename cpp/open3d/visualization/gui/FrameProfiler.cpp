@@ -0,0 +1,121 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/gui/FrameProfiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace visualization {
+namespace gui {
+
+namespace {
+
+void WriteEvent(std::ofstream& out,
+                const char* name,
+                double begin,
+                double end,
+                bool first) {
+    const int64_t ts = std::llround(1e6 * begin);
+    const int64_t dur = std::max<int64_t>(std::llround(1e6 * end) - ts, 0);
+    out << (first ? "\n" : ",\n")
+        << fmt::format("{{\"name\": \"{}\", \"ph\": \"X\", \"pid\": 0, "
+                       "\"tid\": 0, \"ts\": {}, \"dur\": {}}}",
+                       name, ts, dur);
+}
+
+}  // namespace
+
+FrameProfiler::FrameProfiler(size_t max_frames)
+    : max_frames_(std::max(max_frames, size_t(1))) {}
+
+void FrameProfiler::AddFrame(const Frame& frame) {
+    if (!enabled_) {
+        return;
+    }
+    if (frames_.size() >= max_frames_) {
+        frames_.pop_front();
+    }
+    frames_.push_back(frame);
+}
+
+FrameProfiler::Frame FrameProfiler::GetAverage(size_t num_frames) const {
+    Frame average;
+    num_frames = std::min(num_frames, frames_.size());
+    if (num_frames == 0) {
+        return average;
+    }
+    double ui = 0.0, scene = 0.0, present = 0.0;
+    for (auto it = frames_.end() - num_frames; it != frames_.end(); ++it) {
+        ui += it->ui_end - it->start;
+        scene += it->scene_end - it->ui_end;
+        present += it->end - it->scene_end;
+    }
+    average.start = frames_[frames_.size() - num_frames].start;
+    average.ui_end = average.start + ui / double(num_frames);
+    average.scene_end = average.ui_end + scene / double(num_frames);
+    average.end = average.scene_end + present / double(num_frames);
+    return average;
+}
+
+double FrameProfiler::GetFramesPerSecond() const {
+    if (frames_.size() < 2) {
+        return 0.0;
+    }
+    const double duration = frames_.back().start - frames_.front().start;
+    if (duration <= 0.0) {
+        return 0.0;
+    }
+    return double(frames_.size() - 1) / duration;
+}
+
+bool FrameProfiler::WriteTrace(const std::string& path) const {
+    std::ofstream out(path);
+    if (!out) {
+        utility::LogWarning("Cannot open {} to write the frame trace.", path);
+        return false;
+    }
+    out << "{\"traceEvents\": [";
+    bool first = true;
+    for (auto& frame : frames_) {
+        WriteEvent(out, "Frame", frame.start, frame.end, first);
+        WriteEvent(out, "UI", frame.start, frame.ui_end, false);
+        WriteEvent(out, "Scene", frame.ui_end, frame.scene_end, false);
+        WriteEvent(out, "Present", frame.scene_end, frame.end, false);
+        first = false;
+    }
+    out << "\n]}\n";
+    return bool(out);
+}
+
+}  // namespace gui
+}  // namespace visualization
+}  // namespace open3d
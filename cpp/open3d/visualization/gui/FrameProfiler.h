@@ -0,0 +1,89 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <deque>
+#include <string>
+
+namespace open3d {
+namespace visualization {
+namespace gui {
+
+/// \brief Records where the time of each frame of a Window goes.
+///
+/// A frame is split into the consecutive sections UI (drawing the widgets and
+/// generating the ImGui commands), scene (Renderer::BeginFrame() and Draw(),
+/// which renders the 3D scenes), and present (Renderer::EndFrame(), which
+/// submits the frame and waits for the swap chain). Only the last
+/// \p max_frames frames are kept.
+class FrameProfiler {
+public:
+    /// Timings of one frame, in seconds since the start of the application.
+    struct Frame {
+        double start = 0.0;
+        double ui_end = 0.0;
+        double scene_end = 0.0;
+        double end = 0.0;
+
+        double GetUIMs() const { return 1000.0 * (ui_end - start); }
+        double GetSceneMs() const { return 1000.0 * (scene_end - ui_end); }
+        double GetPresentMs() const { return 1000.0 * (end - scene_end); }
+        double GetTotalMs() const { return 1000.0 * (end - start); }
+    };
+
+    explicit FrameProfiler(size_t max_frames = 600);
+
+    /// Frames are only recorded while the profiler is enabled.
+    void SetEnabled(bool enabled) { enabled_ = enabled; }
+    bool IsEnabled() const { return enabled_; }
+
+    void AddFrame(const Frame& frame);
+    const std::deque<Frame>& GetFrames() const { return frames_; }
+    void Clear() { frames_.clear(); }
+
+    /// Returns the average timings of the last \p num_frames frames, with
+    /// the start of the oldest and the end of the newest of them.
+    Frame GetAverage(size_t num_frames) const;
+
+    /// Returns the frame rate over the recorded frames, counting the time
+    /// between frames.
+    double GetFramesPerSecond() const;
+
+    /// Writes the recorded frames as a trace in the Chrome trace event
+    /// format, which can be opened in chrome://tracing or Perfetto. Returns
+    /// false if the file could not be written.
+    bool WriteTrace(const std::string& path) const;
+
+private:
+    size_t max_frames_;
+    bool enabled_ = false;
+    std::deque<Frame> frames_;
+};
+
+}  // namespace gui
+}  // namespace visualization
+}  // namespace open3d
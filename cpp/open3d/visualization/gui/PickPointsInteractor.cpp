@@ -57,7 +57,7 @@ static const Eigen::Vector4f kBackgroundColor = {1.0f, 1.0f, 1.0f, 1.0f};
 static const std::string kSelectablePointsName = "__selectable_points";
 // The maximum pickable point is one less than FFFFFF, because that would
 // be white, which is the color of the background.
-// static const unsigned int kNoIndex = 0x00ffffff;  // unused, but real
+static const unsigned int kNoIndex = 0x00ffffff;
 static const unsigned int kMeshIndex = 0x00fffffe;
 static const unsigned int kMaxPickableIndex = 0x00fffffd;
 
@@ -75,6 +75,9 @@ Eigen::Vector3d SetColorForIndex(uint32_t idx) {
 }
 
 uint32_t GetIndexForColor(geometry::Image *image, int x, int y) {
+    if (!image->TestImageBoundary(x, y)) {
+        return kNoIndex;
+    }
     uint8_t *rgb = image->PointerAt<uint8_t>(x, y, 0);
     const unsigned int red = (static_cast<unsigned int>(rgb[0]) << 16);
     const unsigned int green = (static_cast<unsigned int>(rgb[1]) << 8);
@@ -315,16 +318,48 @@ void PickPointsInteractor::Key(const KeyEvent &e) {
 }
 
 void PickPointsInteractor::DoPick() {
+    // Only the pixels around the pending picks need to be read back, which
+    // is much cheaper than the whole view for large windows.
+    const int view_width = int(matrix_logic_.GetViewWidth());
+    const int view_height = int(matrix_logic_.GetViewHeight());
+    int x0 = view_width, y0 = view_height, x1 = 0, y1 = 0;
+    const int radius = 5 * point_size_;
+    for (auto pending = pending_; !pending.empty(); pending.pop()) {
+        const auto &polygon = pending.front().polygon;
+        const int margin = (polygon.size() == 1 ? radius : 0);
+        for (auto &p : polygon) {
+            x0 = std::min(x0, p.x - margin);
+            y0 = std::min(y0, p.y - margin);
+            x1 = std::max(x1, p.x + margin + 1);
+            y1 = std::max(y1, p.y + margin + 1);
+        }
+    }
+    x0 = std::max(x0, 0);
+    y0 = std::max(y0, 0);
+    x1 = std::min(x1, view_width);
+    y1 = std::min(y1, view_height);
+    if (x0 >= x1 || y0 >= y1) {
+        x0 = y0 = 0;
+        x1 = view_width;
+        y1 = view_height;
+    }
+
+    if (!dirty_ && pick_image_ && (x0 < pick_x_ || y0 < pick_y_ ||
+                                   x1 > pick_x_ + pick_image_->width_ ||
+                                   y1 > pick_y_ + pick_image_->height_)) {
+        SetNeedsRedraw();
+    }
     if (dirty_) {
         SetNeedsRedraw();
         auto *view = picking_scene_->GetView();
         view->SetViewport(0, 0,  // in case scene widget changed size
-                          matrix_logic_.GetViewWidth(),
-                          matrix_logic_.GetViewHeight());
+                          view_width, view_height);
         view->GetCamera()->CopyFrom(camera_);
         picking_scene_->GetRenderer().RenderToImage(
-                view, picking_scene_->GetScene(),
-                [this](std::shared_ptr<geometry::Image> img) {
+                view, picking_scene_->GetScene(), x0, y0, x1 - x0, y1 - y0,
+                [this, x0, y0](std::shared_ptr<geometry::Image> img) {
+                    this->pick_x_ = x0;
+                    this->pick_y_ = y0;
 #if WANT_DEBUG_IMAGE
                     std::cout << "[debug] Writing pick image to "
                               << "/tmp/debug.png" << std::endl;
@@ -381,7 +416,8 @@ void PickPointsInteractor::OnPickImageDone(
                 float score = 0;
             };
             std::unordered_map<unsigned int, Score> candidates;
-            auto clicked_idx = GetIndexForColor(img, x0, y0);
+            auto clicked_idx =
+                    GetIndexForColor(img, x0 - pick_x_, y0 - pick_y_);
             int radius;
             // HACK: the color for kMeshIndex doesn't come back quite right.
             //       We shouldn't need to check if the index is out of range,
@@ -398,7 +434,8 @@ void PickPointsInteractor::OnPickImageDone(
             }
             for (int y = y0 - radius; y < y0 + radius; ++y) {
                 for (int x = x0 - radius; x < x0 + radius; ++x) {
-                    unsigned int idx = GetIndexForColor(img, x, y);
+                    unsigned int idx =
+                            GetIndexForColor(img, x - pick_x_, y - pick_y_);
                     if (IsValidIndex(idx) && idx < points_.size()) {
                         float dist = std::sqrt(float((x - x0) * (x - x0) +
                                                      (y - y0) * (y - y0)));
@@ -554,7 +591,8 @@ void PickPointsInteractor::OnPickImageDone(
                     int startX = sortedX[i];
                     int endX = sortedX[i + 1];
                     for (int x = startX; x <= endX; ++x) {
-                        unsigned int idx = GetIndexForColor(img, x, y);
+                        unsigned int idx = GetIndexForColor(
+                                img, x - pick_x_, y - pick_y_);
                         if (IsValidIndex(idx) && idx < points_.size()) {
                             raw_indices.insert(idx);
                         }
@@ -118,6 +118,10 @@ private:
     // to define this (internal) class in the header file.
     SelectionIndexLookup* lookup_ = nullptr;
     std::shared_ptr<geometry::Image> pick_image_;
+    // Position of pick_image_ in the view, which only covers the region
+    // around the picks that it was rendered for.
+    int pick_x_ = 0;
+    int pick_y_ = 0;
     bool dirty_ = true;
     struct PickInfo {
         std::vector<gui::Point> polygon;  // or point, if only one item
@@ -250,6 +250,8 @@ struct Window::Impl {
     bool needs_redraw_ = true;  // set by PostRedraw to defer if already drawing
     bool is_resizing_ = false;
     bool is_drawing_ = false;
+    FrameProfiler frame_profiler_;
+    bool show_frame_stats_ = false;
 };
 
 Window::Window(const std::string& title, int flags /*= 0*/)
@@ -672,6 +674,20 @@ void Window::CloseDialog() {
     PostRedraw();
 }
 
+FrameProfiler& Window::GetFrameProfiler() { return impl_->frame_profiler_; }
+
+void Window::ShowFrameStatistics(bool show) {
+    impl_->show_frame_stats_ = show;
+    if (show) {
+        impl_->frame_profiler_.SetEnabled(true);
+    }
+    PostRedraw();
+}
+
+bool Window::IsShowingFrameStatistics() const {
+    return impl_->show_frame_stats_;
+}
+
 void Window::ShowMessageBox(const char* title, const char* message) {
     auto em = GetTheme().font_size;
     auto margins = Margins(GetTheme().default_margin);
@@ -773,6 +789,30 @@ Widget::DrawResult DrawChild(DrawContext& dc,
 }
 }  // namespace
 
+void Window::DrawFrameStatistics(const DrawContext& dc) {
+    // Averaged over about a second, so that the numbers are readable.
+    static const size_t kNumAveragedFrames = 60;
+
+    auto& profiler = impl_->frame_profiler_;
+    auto average = profiler.GetAverage(kNumAveragedFrames);
+    auto content = GetContentRect();
+    ImGui::SetNextWindowPos(ImVec2(float(content.GetRight() - dc.emPx),
+                                   float(content.y + dc.emPx)),
+                            ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowBgAlpha(0.6f);
+    ImGui::Begin("frame_statistics", nullptr,
+                 ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoInputs |
+                         ImGuiWindowFlags_NoNav |
+                         ImGuiWindowFlags_AlwaysAutoResize |
+                         ImGuiWindowFlags_NoSavedSettings);
+    ImGui::Text("%.1f fps", profiler.GetFramesPerSecond());
+    ImGui::Text("Frame   %6.2f ms", average.GetTotalMs());
+    ImGui::Text("UI      %6.2f ms", average.GetUIMs());
+    ImGui::Text("Scene   %6.2f ms", average.GetSceneMs());
+    ImGui::Text("Present %6.2f ms", average.GetPresentMs());
+    ImGui::End();
+}
+
 Widget::DrawResult Window::DrawOnce(bool is_layout_pass) {
     // These are here to provide fast unique window names. (Hence using
     // char* instead of a std::string, just in case c_str() recreates
@@ -794,6 +834,8 @@ Widget::DrawResult Window::DrawOnce(bool is_layout_pass) {
     double now = Application::GetInstance().Now();
     double dt_sec = now - impl_->last_render_time_;
     impl_->last_render_time_ = now;
+    FrameProfiler::Frame frame_times;
+    frame_times.start = now;
 
     // Run the deferred callbacks that need to happen outside a draw
     while (!impl_->deferred_until_before_draw_.empty()) {
@@ -910,6 +952,10 @@ Widget::DrawResult Window::DrawOnce(bool is_layout_pass) {
         ImGui::PopStyleVar(2);
     }
 
+    if (impl_->show_frame_stats_) {
+        DrawFrameStatistics(dc);
+    }
+
     // Finish frame and generate the commands
     ImGui::PopFont();
     ImGui::EndFrame();
@@ -922,9 +968,14 @@ Widget::DrawResult Window::DrawOnce(bool is_layout_pass) {
     // draw, and if we are drawing for layout purposes, don't actually
     // draw, because we are just going to draw again after this returns.
     if (!is_layout_pass) {
+        auto& app = Application::GetInstance();
+        frame_times.ui_end = app.Now();
         impl_->renderer_->BeginFrame();
         impl_->renderer_->Draw();
+        frame_times.scene_end = app.Now();
         impl_->renderer_->EndFrame();
+        frame_times.end = app.Now();
+        impl_->frame_profiler_.AddFrame(frame_times);
     }
 
     if (needs_layout) {
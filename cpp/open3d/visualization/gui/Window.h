@@ -31,6 +31,7 @@
 #include <string>
 
 #include "open3d/visualization/gui/Events.h"
+#include "open3d/visualization/gui/FrameProfiler.h"
 #include "open3d/visualization/gui/Gui.h"
 #include "open3d/visualization/gui/Menu.h"
 #include "open3d/visualization/gui/Widget.h"
@@ -154,6 +155,14 @@ public:
 
     void ShowMessageBox(const char* title, const char* message);
 
+    /// Returns the profiler of this window's frames. It does not record
+    /// anything until it is enabled.
+    FrameProfiler& GetFrameProfiler();
+    /// Shows an overlay with the average frame timings, and enables the
+    /// frame profiler if \p show is true.
+    void ShowFrameStatistics(bool show);
+    bool IsShowingFrameStatistics() const;
+
     /// This is for internal use in rare circumstances when the destructor
     /// will not be called in a timely fashion.
     void DestroyWindow();
@@ -207,6 +216,7 @@ public:
 private:
     void CreateRenderer();
     Widget::DrawResult DrawOnce(bool is_layout_pass);
+    void DrawFrameStatistics(const DrawContext& dc);
     void* MakeDrawContextCurrent() const;
     void RestoreDrawContext(void* old_context) const;
 
@@ -0,0 +1,214 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/PointCloudLODStreamer.h"
+
+#include <algorithm>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+PointCloudLODStreamer::PointCloudLODStreamer(
+        std::shared_ptr<const t::io::PointCloudLOD> lod,
+        const PointCloudLODSettings& settings)
+    : lod_(lod), settings_(settings) {
+    if (!lod_) {
+        utility::LogError("PointCloudLODStreamer: lod must not be null.");
+    }
+    if (settings_.max_resident_points < settings_.point_budget) {
+        utility::LogWarning(
+                "PointCloudLODStreamer: max_resident_points {} is smaller "
+                "than point_budget {}, using the point budget.",
+                settings_.max_resident_points, settings_.point_budget);
+        settings_.max_resident_points = settings_.point_budget;
+    }
+    settings_.max_uploads_per_frame =
+            std::max(settings_.max_uploads_per_frame, 1);
+
+    const size_t num_nodes = lod_->nodes_.size();
+    parents_.assign(num_nodes, -1);
+    for (size_t i = 0; i < num_nodes; ++i) {
+        for (int child : lod_->nodes_[i].children_) {
+            if (child >= 0) {
+                parents_[child] = int(i);
+            }
+        }
+    }
+    shown_.assign(num_nodes, false);
+    last_shown_.assign(num_nodes, -1);
+    states_.assign(num_nodes, NodeState::Absent);
+    thread_ = std::thread(&PointCloudLODStreamer::Run, this);
+}
+
+PointCloudLODStreamer::~PointCloudLODStreamer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    requested_.notify_all();
+    thread_.join();
+}
+
+PointCloudLODStreamer::Changes PointCloudLODStreamer::Update(
+        const Eigen::Vector3d& eye, double pixels_per_radian) {
+    Changes changes;
+    ++frame_;
+    const std::vector<int> selected =
+            lod_->SelectNodes(eye, pixels_per_radian,
+                              settings_.max_error_pixels,
+                              settings_.point_budget);
+    const size_t num_nodes = lod_->nodes_.size();
+    std::vector<bool> show(num_nodes, false);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int i = 0; i < settings_.max_uploads_per_frame && !loaded_.empty();
+         ++i) {
+        const int node = loaded_.front().first;
+        states_[node] = NodeState::Resident;
+        resident_points_ += lod_->nodes_[node].num_points_;
+        last_shown_[node] = frame_;
+        changes.added.push_back(std::move(loaded_.front()));
+        loaded_.pop_front();
+    }
+
+    // Requests of nodes that are no longer selected are dropped. The missing
+    // nodes are requested in the order of the selection, coarse to fine.
+    for (int node : requests_) {
+        states_[node] = NodeState::Absent;
+    }
+    requests_.clear();
+    for (int node : selected) {
+        if (states_[node] == NodeState::Absent) {
+            states_[node] = NodeState::Queued;
+            requests_.push_back(node);
+        }
+    }
+    if (!requests_.empty()) {
+        requested_.notify_one();
+    }
+
+    // Parents precede their children in the selection.
+    for (int node : selected) {
+        const int parent = parents_[node];
+        show[node] = states_[node] == NodeState::Resident &&
+                     (parent < 0 || show[parent]);
+    }
+    shown_points_ = 0;
+    for (size_t i = 0; i < num_nodes; ++i) {
+        if (show[i]) {
+            last_shown_[i] = frame_;
+            shown_points_ += lod_->nodes_[i].num_points_;
+            if (!shown_[i]) {
+                changes.shown.push_back(int(i));
+            }
+        } else if (shown_[i]) {
+            changes.hidden.push_back(int(i));
+        }
+    }
+    shown_ = std::move(show);
+
+    // Evict the hidden nodes that were shown least recently.
+    if (resident_points_ > settings_.max_resident_points) {
+        std::vector<int> candidates;
+        for (size_t i = 0; i < num_nodes; ++i) {
+            if (states_[i] == NodeState::Resident && !shown_[i]) {
+                candidates.push_back(int(i));
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), [&](int a, int b) {
+            return last_shown_[a] < last_shown_[b];
+        });
+        for (int node : candidates) {
+            if (resident_points_ <= settings_.max_resident_points) {
+                break;
+            }
+            states_[node] = NodeState::Absent;
+            resident_points_ -= lod_->nodes_[node].num_points_;
+            changes.removed.push_back(node);
+        }
+    }
+    return changes;
+}
+
+void PointCloudLODStreamer::WaitForLoads() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock,
+               [this] { return requests_.empty() && num_loading_ == 0; });
+}
+
+bool PointCloudLODStreamer::HasPendingLoads() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !requests_.empty() || num_loading_ > 0 || !loaded_.empty();
+}
+
+bool PointCloudLODStreamer::IsResident(int node) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return states_[node] == NodeState::Resident;
+}
+
+void PointCloudLODStreamer::Run() {
+    while (true) {
+        int node;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            requested_.wait(lock,
+                            [this] { return stop_ || !requests_.empty(); });
+            if (stop_) {
+                return;
+            }
+            node = requests_.front();
+            requests_.pop_front();
+            states_[node] = NodeState::Loading;
+            ++num_loading_;
+        }
+
+        // The nodes are read on the CPU, from where the renderer uploads them.
+        auto pointcloud = std::make_shared<t::geometry::PointCloud>();
+        const bool success = lod_->ReadNode(node, *pointcloud);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --num_loading_;
+            if (success) {
+                states_[node] = NodeState::Loaded;
+                loaded_.emplace_back(node, std::move(pointcloud));
+            } else {
+                utility::LogWarning(
+                        "PointCloudLODStreamer: failed to read node {}.",
+                        lod_->nodes_[node].name_);
+                states_[node] = NodeState::Failed;
+            }
+        }
+        idle_.notify_all();
+    }
+}
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
@@ -0,0 +1,142 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudLOD.h"
+
+namespace open3d {
+namespace visualization {
+namespace rendering {
+
+/// Settings of the level-of-detail rendering of a t::io::PointCloudLOD.
+struct PointCloudLODSettings {
+    /// Maximal number of points shown at once.
+    int64_t point_budget = 5000000;
+    /// Nodes are refined until their point spacing is projected to at most
+    /// this number of pixels or the point budget is reached.
+    double max_error_pixels = 2.0;
+    /// Maximal number of nodes uploaded to the GPU per frame.
+    int max_uploads_per_frame = 8;
+    /// Maximal number of points kept in GPU memory, including hidden nodes
+    /// that may be shown again. The least recently shown nodes are evicted
+    /// first. Must not be smaller than point_budget.
+    int64_t max_resident_points = 20000000;
+};
+
+/// \class PointCloudLODStreamer
+///
+/// Decides which nodes of a t::io::PointCloudLOD are resident in GPU memory
+/// and shown, independently of the renderer. Update() is called once per
+/// frame with the camera. It selects the nodes by screen-space error within
+/// the point budget, requests the missing ones from a background thread,
+/// which reads them from disk, and returns the changes the renderer has to
+/// apply. A node is only shown together with its ancestors, since it stores
+/// just the points they do not, so that the shown nodes never leave holes
+/// while their children are loading.
+class PointCloudLODStreamer {
+public:
+    /// Changes to apply to the renderer after an Update().
+    struct Changes {
+        /// Nodes to upload with their points. They are hidden unless they
+        /// are also listed in shown.
+        std::vector<std::pair<int, std::shared_ptr<t::geometry::PointCloud>>>
+                added;
+        /// Resident nodes to show.
+        std::vector<int> shown;
+        /// Resident nodes to hide.
+        std::vector<int> hidden;
+        /// Hidden nodes to release.
+        std::vector<int> removed;
+    };
+
+    PointCloudLODStreamer(std::shared_ptr<const t::io::PointCloudLOD> lod,
+                          const PointCloudLODSettings& settings = {});
+    ~PointCloudLODStreamer();
+    PointCloudLODStreamer(const PointCloudLODStreamer&) = delete;
+    PointCloudLODStreamer& operator=(const PointCloudLODStreamer&) = delete;
+
+    /// Selects the nodes to show for a perspective camera at \p eye, in the
+    /// coordinates of the point cloud, with \p pixels_per_radian pixels per
+    /// radian of field of view.
+    Changes Update(const Eigen::Vector3d& eye, double pixels_per_radian);
+
+    /// Blocks until the background thread has read all requested nodes.
+    void WaitForLoads();
+    /// True if nodes are being read that will be returned by Update().
+    bool HasPendingLoads() const;
+
+    const t::io::PointCloudLOD& GetLOD() const { return *lod_; }
+    const PointCloudLODSettings& GetSettings() const { return settings_; }
+    bool IsResident(int node) const;
+    bool IsShown(int node) const { return shown_[node]; }
+    int64_t GetResidentPoints() const { return resident_points_; }
+    int64_t GetShownPoints() const { return shown_points_; }
+
+private:
+    enum class NodeState { Absent, Queued, Loading, Loaded, Resident, Failed };
+
+    void Run();
+
+    std::shared_ptr<const t::io::PointCloudLOD> lod_;
+    PointCloudLODSettings settings_;
+    /// Index of the parent of every node, -1 for the root.
+    std::vector<int> parents_;
+    std::vector<bool> shown_;
+    /// Frame in which every node was last shown.
+    std::vector<int64_t> last_shown_;
+    int64_t frame_ = 0;
+    int64_t resident_points_ = 0;
+    int64_t shown_points_ = 0;
+
+    // The node states and the queues are shared with the background thread.
+    mutable std::mutex mutex_;
+    std::condition_variable requested_;
+    std::condition_variable idle_;
+    std::vector<NodeState> states_;
+    std::deque<int> requests_;
+    int num_loading_ = 0;
+    std::deque<std::pair<int, std::shared_ptr<t::geometry::PointCloud>>>
+            loaded_;
+    bool stop_ = false;
+    std::thread thread_;
+};
+
+}  // namespace rendering
+}  // namespace visualization
+}  // namespace open3d
@@ -70,6 +70,10 @@ public:
                            bool depth_image,
                            BufferReadyCallback cb) = 0;
     virtual void SetDimensions(std::uint32_t width, std::uint32_t height) = 0;
+    // Reads back only the pixels of the given region of the rendered image,
+    // with the origin at the top left, instead of the whole image. Must be
+    // called after Configure() and SetDimensions(), which reset the region.
+    virtual void SetReadRegion(int x, int y, int width, int height) = 0;
     virtual View& GetView() = 0;
 
     virtual void Render() = 0;
@@ -88,6 +88,18 @@ void Renderer::RenderToImage(
         Scene* scene,
         std::function<void(std::shared_ptr<geometry::Image>)> cb) {
     auto vp = view->GetViewport();
+    RenderToImage(view, scene, 0, 0, vp[2], vp[3], cb);
+}
+
+void Renderer::RenderToImage(
+        View* view,
+        Scene* scene,
+        int x,
+        int y,
+        int width,
+        int height,
+        std::function<void(std::shared_ptr<geometry::Image>)> cb) {
+    auto vp = view->GetViewport();
     auto render = CreateBufferRenderer();
     render->Configure(
             view, scene, vp[2], vp[3], 3, false,
@@ -108,6 +120,7 @@ void Renderer::RenderToImage(
                 // The object will be freed when the callback is unassigned.
                 render = nullptr;
             });
+    render->SetReadRegion(x, y, width, height);
 }
 
 void Renderer::RenderToDepthImage(
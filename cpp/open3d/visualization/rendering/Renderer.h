@@ -132,6 +132,18 @@ public:
             Scene* scene,
             std::function<void(std::shared_ptr<geometry::Image>)> cb);
 
+    // Renders the view but only reads back the region (x, y, width, height),
+    // with the origin at the top left of the view, which is much faster for
+    // small regions, e.g. around the mouse for picking.
+    void RenderToImage(
+            View* view,
+            Scene* scene,
+            int x,
+            int y,
+            int width,
+            int height,
+            std::function<void(std::shared_ptr<geometry::Image>)> cb);
+
     // Returns a float image ranging from 0 (near plane) to 1 (far plane)
     void RenderToDepthImage(
             View* view,
@@ -44,6 +44,9 @@ namespace t {
 namespace geometry {
 class PointCloud;
 }
+namespace io {
+class PointCloudLOD;
+}
 }  // namespace t
 
 namespace visualization {
@@ -54,6 +57,7 @@ class View;
 struct TriangleMeshModel;
 struct Material;
 struct Light;
+struct PointCloudLODSettings;
 
 // Contains renderable objects like geometry and lights
 // Can have multiple views
@@ -101,10 +105,28 @@ public:
                              size_t downsample_threshold = SIZE_MAX) = 0;
     virtual bool AddGeometry(const std::string& object_name,
                              const TriangleMeshModel& model) = 0;
+    /// Adds a point cloud that is too large to be uploaded at once. Its
+    /// nodes are read in the background and shown by screen-space error
+    /// within the point budget of \p settings in every frame.
+    virtual bool AddPointCloudLOD(
+            const std::string& object_name,
+            std::shared_ptr<const t::io::PointCloudLOD> lod,
+            const Material& material,
+            const PointCloudLODSettings& settings) = 0;
     virtual bool HasGeometry(const std::string& object_name) const = 0;
     virtual void UpdateGeometry(const std::string& object_name,
                                 const t::geometry::PointCloud& point_cloud,
                                 uint32_t update_flags) = 0;
+    /// Updates the flagged arrays of the points \p first_point to
+    /// \p first_point + n - 1 of a point cloud from the n points of
+    /// \p point_cloud, e.g. the blocks extracted since the last update. The
+    /// geometry shows at least first_point + n points afterwards. Its buffers
+    /// grow as needed if the previous points are known, i.e. they were set
+    /// by UpdateGeometry() or UpdateGeometryRange() calls starting at 0.
+    virtual bool UpdateGeometryRange(const std::string& object_name,
+                                     const t::geometry::PointCloud& point_cloud,
+                                     uint32_t update_flags,
+                                     size_t first_point) = 0;
     virtual void RemoveGeometry(const std::string& object_name) = 0;
     virtual void ShowGeometry(const std::string& object_name, bool show) = 0;
     virtual bool GeometryIsVisible(const std::string& object_name) = 0;
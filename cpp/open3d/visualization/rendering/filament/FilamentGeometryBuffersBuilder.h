@@ -154,6 +154,24 @@ class TPointCloudBuffersBuilder : public GeometryBuffersBuilder {
 public:
     explicit TPointCloudBuffersBuilder(const t::geometry::PointCloud& geometry);
 
+    // Creates an empty vertex buffer with the layout of ConstructBuffers():
+    // positions (float3), colors (float3), tangents (float4) and uvs (float2)
+    // in the buffers 0 to 3.
+    static VertexBufferHandle CreateVertexBuffer(size_t n_vertices);
+
+    // Copy the positions, colors, tangents (float4 per point, converted from
+    // the normals) and uvs of a point cloud on any device to the host array
+    // dst in the layout of the vertex buffers. The arrays are converted on
+    // the device of the point cloud, so that CUDA point clouds are copied to
+    // the host once, already packed. Return false if the point cloud lacks
+    // the attribute.
+    static bool CopyPositions(const t::geometry::PointCloud& geometry,
+                              float* dst);
+    static bool CopyColors(const t::geometry::PointCloud& geometry, float* dst);
+    static bool CopyTangents(const t::geometry::PointCloud& geometry,
+                             float* dst);
+    static bool CopyUvs(const t::geometry::PointCloud& geometry, float* dst);
+
     filament::RenderableManager::PrimitiveType GetPrimitiveType()
             const override;
 
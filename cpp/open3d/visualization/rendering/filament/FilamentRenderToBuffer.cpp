@@ -51,6 +51,8 @@
 #pragma warning(pop)
 #endif  // _MSC_VER
 
+#include <algorithm>
+
 #include "open3d/utility/Logging.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
 #include "open3d/visualization/rendering/filament/FilamentRenderer.h"
@@ -138,11 +140,34 @@ void FilamentRenderToBuffer::SetDimensions(const std::uint32_t width,
 
     width_ = width;
     height_ = height;
+    region_x_ = 0;
+    region_y_ = 0;
+    region_width_ = width;
+    region_height_ = height;
+    AllocateBuffer();
+}
+
+void FilamentRenderToBuffer::SetReadRegion(int x,
+                                           int y,
+                                           int width,
+                                           int height) {
+    const int x0 = std::max(0, std::min(x, int(width_)));
+    const int y0 = std::max(0, std::min(y, int(height_)));
+    const int x1 = std::max(x0, std::min(x + width, int(width_)));
+    const int y1 = std::max(y0, std::min(y + height, int(height_)));
+    region_x_ = x0;
+    region_y_ = y0;
+    region_width_ = x1 - x0;
+    region_height_ = y1 - y0;
+    AllocateBuffer();
+}
 
+void FilamentRenderToBuffer::AllocateBuffer() {
+    const std::size_t n_pixels = region_width_ * region_height_;
     if (depth_image_) {
-        buffer_size_ = width * height * sizeof(std::float_t);
+        buffer_size_ = n_pixels * sizeof(std::float_t);
     } else {
-        buffer_size_ = width * height * n_channels_ * sizeof(std::uint8_t);
+        buffer_size_ = n_pixels * n_channels_ * sizeof(std::uint8_t);
     }
     if (buffer_) {
         buffer_ = static_cast<std::uint8_t*>(realloc(buffer_, buffer_size_));
@@ -176,8 +201,8 @@ void FilamentRenderToBuffer::ReadPixelsCallback(void*, size_t, void* user) {
     BufferReadyCallback callback;
     std::tie(self, callback) = *params;
 
-    callback({self->width_, self->height_, self->n_channels_, self->buffer_,
-              self->buffer_size_});
+    callback({self->region_width_, self->region_height_, self->n_channels_,
+              self->buffer_, self->buffer_size_});
 
     // Unassign the callback, in case it captured ourself. Then we would never
     // get freed.
@@ -207,8 +232,10 @@ void FilamentRenderToBuffer::Render() {
                                  ReadPixelsCallback, user_param);
         auto vp = view_->GetNativeView()->getViewport();
 
-        renderer_->readPixels(vp.left, vp.bottom, vp.width, vp.height,
-                              std::move(pd));
+        // readPixels() counts rows from the bottom.
+        const auto bottom = vp.height - region_y_ - region_height_;
+        renderer_->readPixels(vp.left + region_x_, vp.bottom + bottom,
+                              region_width_, region_height_, std::move(pd));
 
         renderer_->endFrame();
     }
@@ -61,6 +61,7 @@ public:
                    bool depth_image,
                    BufferReadyCallback cb) override;
     void SetDimensions(std::uint32_t width, std::uint32_t height) override;
+    void SetReadRegion(int x, int y, int width, int height) override;
     View& GetView() override;
 
     void Render() override;
@@ -80,6 +81,11 @@ private:
     std::size_t width_ = 0;
     std::size_t height_ = 0;
     std::size_t n_channels_ = 0;
+    // Region that is read back, with the origin at the top left.
+    std::size_t region_x_ = 0;
+    std::size_t region_y_ = 0;
+    std::size_t region_width_ = 0;
+    std::size_t region_height_ = 0;
     std::uint8_t* buffer_ = nullptr;
     std::size_t buffer_size_ = 0;
     bool depth_image_ = false;
@@ -90,6 +96,7 @@ private:
 
     static void ReadPixelsCallback(void* buffer, size_t size, void* user);
     void CopySettings(const View* view);
+    void AllocateBuffer();
 };
 
 }  // namespace rendering
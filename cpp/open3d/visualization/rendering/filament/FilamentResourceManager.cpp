@@ -26,6 +26,9 @@
 
 #include "open3d/visualization/rendering/filament/FilamentResourceManager.h"
 
+#include <future>
+#include <mutex>
+
 #include "open3d/core/Dtype.h"
 
 // 4068: Filament has some clang-specific vectorizing pragma's that MSVC flags
@@ -169,26 +172,85 @@ void FreeRetainedImage(void* buffer, size_t size, void* user_ptr) {
     }
 }
 
-filament::Material* LoadMaterialFromFile(const std::string& path,
-                                         filament::Engine& engine) {
-    std::vector<char> material_data;
+struct ResourceFile {
+    std::vector<char> data;
     std::string error_str;
+    int error_code = 0;
+};
 
+// Files being read or kept by FilamentResourceManager::PrefetchResourceFile(),
+// by platform path.
+std::mutex g_resource_files_mutex;
+std::unordered_map<std::string,
+                   std::shared_future<std::shared_ptr<const ResourceFile>>>
+        g_resource_files;
+
+std::string PlatformPath(const std::string& path) {
     std::string platform_path = path;
 #ifdef _WIN32
     std::replace(platform_path.begin(), platform_path.end(), '/', '\\');
 #endif  // _WIN32
-    utility::LogDebug("LoadMaterialFromFile(): {}", platform_path);
-    if (utility::filesystem::FReadToBuffer(platform_path, material_data,
-                                           &error_str)) {
+    return platform_path;
+}
+
+std::shared_ptr<const ResourceFile> ReadResourceFile(
+        const std::string& platform_path) {
+    auto file = std::make_shared<ResourceFile>();
+    if (!utility::filesystem::FReadToBuffer(platform_path, file->data,
+                                            &file->error_str)) {
+        file->error_code = errno != 0 ? errno : -1;
+    }
+    return file;
+}
+
+// Returns the contents of the file at path, waiting for its prefetch if there
+// is one. If keep, the contents stay in memory for the next requests.
+std::shared_ptr<const ResourceFile> GetResourceFile(const std::string& path,
+                                                    bool keep) {
+    const std::string platform_path = PlatformPath(path);
+    std::shared_future<std::shared_ptr<const ResourceFile>> prefetched;
+    {
+        std::lock_guard<std::mutex> lock(g_resource_files_mutex);
+        auto found = g_resource_files.find(platform_path);
+        if (found != g_resource_files.end()) {
+            prefetched = found->second;
+            if (!keep) {
+                g_resource_files.erase(found);
+            }
+        }
+    }
+    if (prefetched.valid()) {
+        auto file = prefetched.get();
+        if (keep && file->error_code != 0) {
+            std::lock_guard<std::mutex> lock(g_resource_files_mutex);
+            g_resource_files.erase(platform_path);
+        }
+        return file;
+    }
+
+    auto file = ReadResourceFile(platform_path);
+    if (keep && file->error_code == 0) {
+        std::promise<std::shared_ptr<const ResourceFile>> ready;
+        ready.set_value(file);
+        std::lock_guard<std::mutex> lock(g_resource_files_mutex);
+        g_resource_files.emplace(platform_path, ready.get_future().share());
+    }
+    return file;
+}
+
+filament::Material* LoadMaterialFromFile(const std::string& path,
+                                         filament::Engine& engine) {
+    utility::LogDebug("LoadMaterialFromFile(): {}", path);
+    auto file = GetResourceFile(path, false);
+    if (file->error_code == 0) {
         using namespace filament;
         return Material::Builder()
-                .package(material_data.data(), material_data.size())
+                .package(file->data.data(), file->data.size())
                 .build(engine);
     }
 
     utility::LogDebug("Failed to load default material from {}. Error: {}",
-                      platform_path, error_str);
+                      path, file->error_str);
 
     return nullptr;
 }
@@ -391,14 +453,12 @@ MaterialHandle FilamentResourceManager::CreateMaterial(
     MaterialHandle handle;
 
     if (!request.path_.empty()) {
-        std::vector<char> material_data;
-        std::string error_str;
-
-        if (utility::filesystem::FReadToBuffer(request.path_, material_data,
-                                               &error_str)) {
-            handle = CreateMaterial(material_data.data(), material_data.size());
+        auto file = GetResourceFile(request.path_, false);
+        if (file->error_code == 0) {
+            handle = CreateMaterial(file->data.data(), file->data.size());
         } else {
-            request.error_callback_(request, errno, error_str);
+            request.error_callback_(request, file->error_code,
+                                    file->error_str);
         }
     } else if (request.data_size_ > 0) {
         // TODO: Filament throws an exception if it can't parse the
@@ -580,16 +640,13 @@ IndirectLightHandle FilamentResourceManager::CreateIndirectLight(
     IndirectLightHandle handle;
 
     if (!request.path_.empty()) {
-        std::vector<char> ibl_data;
-        std::string error_str;
-
-        if (utility::filesystem::FReadToBuffer(request.path_, ibl_data,
-                                               &error_str)) {
+        auto file = GetResourceFile(request.path_, true);
+        if (file->error_code == 0) {
             using namespace filament;
             // will be destroyed later by image::ktx::createTexture
             auto* ibl_ktx = new image::KtxBundle(
-                    reinterpret_cast<std::uint8_t*>(ibl_data.data()),
-                    std::uint32_t(ibl_data.size()));
+                    reinterpret_cast<const std::uint8_t*>(file->data.data()),
+                    std::uint32_t(file->data.size()));
             auto* ibl_texture =
                     image::ktx::createTexture(&engine_, ibl_ktx, false);
 
@@ -621,7 +678,8 @@ IndirectLightHandle FilamentResourceManager::CreateIndirectLight(
                 engine_.destroy(ibl_texture);
             }
         } else {
-            request.error_callback_(request, errno, error_str);
+            request.error_callback_(request, file->error_code,
+                                    file->error_str);
         }
     } else {
         request.error_callback_(request, -1, "");
@@ -649,16 +707,13 @@ SkyboxHandle FilamentResourceManager::CreateSkybox(
     SkyboxHandle handle;
 
     if (!request.path_.empty()) {
-        std::vector<char> sky_data;
-        std::string error_str;
-
-        if (utility::filesystem::FReadToBuffer(request.path_, sky_data,
-                                               &error_str)) {
+        auto file = GetResourceFile(request.path_, true);
+        if (file->error_code == 0) {
             using namespace filament;
             // will be destroyed later by image::ktx::createTexture
             auto* sky_ktx = new image::KtxBundle(
-                    reinterpret_cast<std::uint8_t*>(sky_data.data()),
-                    std::uint32_t(sky_data.size()));
+                    reinterpret_cast<const std::uint8_t*>(file->data.data()),
+                    std::uint32_t(file->data.size()));
             auto* sky_texture =
                     image::ktx::createTexture(&engine_, sky_ktx, false);
 
@@ -680,7 +735,8 @@ SkyboxHandle FilamentResourceManager::CreateSkybox(
                 engine_.destroy(sky_texture);
             }
         } else {
-            request.error_callback_(request, errno, error_str);
+            request.error_callback_(request, file->error_code,
+                                    file->error_str);
         }
     } else {
         request.error_callback_(request, -1, "");
@@ -776,6 +832,22 @@ void FilamentResourceManager::DestroyAll() {
     skyboxes_.clear();
 }
 
+void FilamentResourceManager::PrefetchResourceFile(const std::string& path) {
+    const std::string platform_path = PlatformPath(path);
+    std::lock_guard<std::mutex> lock(g_resource_files_mutex);
+    if (g_resource_files.count(platform_path) == 0) {
+        g_resource_files.emplace(platform_path,
+                                 std::async(std::launch::async,
+                                            ReadResourceFile, platform_path)
+                                         .share());
+    }
+}
+
+void FilamentResourceManager::ReleaseResourceFileCache() {
+    std::lock_guard<std::mutex> lock(g_resource_files_mutex);
+    g_resource_files.clear();
+}
+
 void FilamentResourceManager::Destroy(const REHandle_abstract& id) {
     if (kDefaultResources.count(id) > 0) {
         utility::LogDebug(
@@ -931,6 +1003,21 @@ void FilamentResourceManager::LoadDefaults() {
     // FIXME: Move to precompiled resource blobs
     const std::string& resource_root = EngineInstance::GetResourcePath();
 
+    // Reads the material packages in parallel while the materials are built,
+    // and the default environment maps, which the first scene requests,
+    // in the background.
+    for (const char* name :
+         {"defaultLit.filamat", "defaultLitTransparency.filamat",
+          "defaultLitSSR.filamat", "defaultUnlit.filamat",
+          "defaultUnlitTransparency.filamat", "depth.filamat",
+          "unlitGradient.filamat", "normals.filamat", "colorMap.filamat",
+          "unlitSolidColor.filamat", "unlitBackground.filamat",
+          "infiniteGroundPlane.filamat", "unlitLine.filamat",
+          "unlitPolygonOffset.filamat", "default_ibl.ktx",
+          "default_skybox.ktx"}) {
+        PrefetchResourceFile(resource_root + "/" + name);
+    }
+
     const auto texture_path = resource_root + "/defaultTexture.png";
     auto texture_img = io::CreateImageFromFile(texture_path);
     auto texture = LoadTextureFromImage(texture_img, false);
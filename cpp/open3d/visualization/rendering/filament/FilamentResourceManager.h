@@ -27,6 +27,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -153,6 +154,15 @@ public:
     void DestroyAll();
     void Destroy(const REHandle_abstract& id);
 
+    // Starts reading the file at path on a background thread, so that a later
+    // CreateMaterial(), CreateIndirectLight() or CreateSkybox() from the path
+    // does not wait for the disk. The prefetched files are shared by all
+    // resource managers. Environment maps (.ktx) stay in memory after use,
+    // since every new scene requests them again, until
+    // ReleaseResourceFileCache().
+    static void PrefetchResourceFile(const std::string& path);
+    static void ReleaseResourceFileCache();
+
 public:
     // Only public so that .cpp file can use this
     template <class ResourceType>
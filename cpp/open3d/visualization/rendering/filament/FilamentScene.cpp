@@ -32,6 +32,7 @@
 //       32 so that x >> 32 gives a warning. (Or maybe the compiler can't
 //       determine the if statement does not run.)
 // 4305: LightManager.h needs to specify some constants as floats
+#include <algorithm>
 #include <unordered_set>
 
 #ifdef _MSC_VER
@@ -41,6 +42,7 @@
 
 #include <backend/PixelBufferDescriptor.h>  // bogus 4146 warning on MSVC
 #include <filament/Engine.h>
+#include <filament/IndexBuffer.h>
 #include <filament/IndirectLight.h>
 #include <filament/LightManager.h>
 #include <filament/MaterialInstance.h>
@@ -53,7 +55,6 @@
 #include <filament/TransformManager.h>
 #include <filament/VertexBuffer.h>
 #include <filament/View.h>
-#include <geometry/SurfaceOrientation.h>
 #include <utils/EntityManager.h>
 
 #ifdef _MSC_VER
@@ -78,6 +79,7 @@
 #include "open3d/visualization/rendering/Light.h"
 #include "open3d/visualization/rendering/Material.h"
 #include "open3d/visualization/rendering/Model.h"
+#include "open3d/visualization/rendering/PointCloudLODStreamer.h"
 #include "open3d/visualization/rendering/RendererHandle.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
 #include "open3d/visualization/rendering/filament/FilamentEntitiesMods.h"
@@ -383,15 +385,26 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
         Eigen::Vector3f min_pt = {1e30f, 1e30f, 1e30f};
         Eigen::Vector3f max_pt = {-1e30f, -1e30f, -1e30f};
         const auto& points = cloud.GetPoints();
-        const size_t n = points.GetLength();
-        float* pts = (float*)points.GetDataPtr();
-        for (size_t i = 0; i < 3 * n; i += 3) {
-            min_pt[0] = std::min(min_pt[0], pts[i]);
-            min_pt[1] = std::min(min_pt[1], pts[i + 1]);
-            min_pt[2] = std::min(min_pt[2], pts[i + 2]);
-            max_pt[0] = std::max(max_pt[0], pts[i]);
-            max_pt[1] = std::max(max_pt[1], pts[i + 1]);
-            max_pt[2] = std::max(max_pt[2], pts[i + 2]);
+        if (points.GetDevice().GetType() == core::Device::DeviceType::CUDA) {
+            // Reduce on the device instead of copying the points.
+            const core::Device host("CPU:0");
+            const auto min_bound = points.Min({0}).To(host);
+            const auto max_bound = points.Max({0}).To(host);
+            min_pt = Eigen::Map<const Eigen::Vector3f>(
+                    min_bound.GetDataPtr<float>());
+            max_pt = Eigen::Map<const Eigen::Vector3f>(
+                    max_bound.GetDataPtr<float>());
+        } else {
+            const size_t n = points.GetLength();
+            float* pts = (float*)points.GetDataPtr();
+            for (size_t i = 0; i < 3 * n; i += 3) {
+                min_pt[0] = std::min(min_pt[0], pts[i]);
+                min_pt[1] = std::min(min_pt[1], pts[i + 1]);
+                min_pt[2] = std::min(min_pt[2], pts[i + 2]);
+                max_pt[0] = std::max(max_pt[0], pts[i]);
+                max_pt[1] = std::max(max_pt[1], pts[i + 1]);
+                max_pt[2] = std::max(max_pt[2], pts[i + 2]);
+            }
         }
 
         filament::math::float3 min(min_pt.x(), min_pt.y(), min_pt.z());
@@ -418,18 +431,9 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
         return false;
     }
 
-    t::geometry::PointCloud cpu_pcloud;
-    std::unique_ptr<GeometryBuffersBuilder> buffer_builder;
-    if (points.GetDevice().GetType() == core::Device::DeviceType::CUDA) {
-        utility::LogWarning(
-                "GPU resident tensor point clouds are not supported at this "
-                "time for direct visualization. Copying point cloud to CPU.");
-        cpu_pcloud = point_cloud.CPU();
-        buffer_builder = GeometryBuffersBuilder::GetBuilder(cpu_pcloud);
-    } else {
-        cpu_pcloud = point_cloud;
-        buffer_builder = GeometryBuffersBuilder::GetBuilder(point_cloud);
-    }
+    // CUDA point clouds are packed on the device and copied to the host once.
+    std::unique_ptr<GeometryBuffersBuilder> buffer_builder =
+            GeometryBuffersBuilder::GetBuilder(point_cloud);
 
     if (!downsampled_name.empty()) {
         buffer_builder->SetDownsampleThreshold(downsample_threshold);
@@ -439,7 +443,7 @@ bool FilamentScene::AddGeometry(const std::string& object_name,
     auto vb = std::get<0>(buffers);
     auto ib = std::get<1>(buffers);
     auto ib_downsampled = std::get<2>(buffers);
-    filament::Box aabb = ComputeAABB(cpu_pcloud);
+    filament::Box aabb = ComputeAABB(point_cloud);
     bool success = CreateAndAddFilamentEntity(object_name, *buffer_builder,
                                               aabb, vb, ib, material);
     if (success && ib_downsampled) {
@@ -559,6 +563,128 @@ bool FilamentScene::CreateAndAddFilamentEntity(
     return true;
 }
 
+bool FilamentScene::AddPointCloudLOD(
+        const std::string& object_name,
+        std::shared_ptr<const t::io::PointCloudLOD> lod,
+        const Material& material,
+        const PointCloudLODSettings& settings) {
+    if (HasGeometry(object_name)) {
+        utility::LogWarning(
+                "Geometry {} has already been added to scene graph.",
+                object_name);
+        return false;
+    }
+    if (!lod || lod->nodes_.empty()) {
+        utility::LogWarning("Point cloud LOD {} has no nodes.", object_name);
+        return false;
+    }
+
+    // The nodes are added as they are loaded in Draw().
+    auto& entry = point_cloud_lods_[object_name];
+    entry.streamer.reset(new PointCloudLODStreamer(lod, settings));
+    entry.material = material;
+    model_geometries_[object_name];
+    return true;
+}
+
+void FilamentScene::UpdatePointCloudLODs() {
+    if (point_cloud_lods_.empty()) {
+        return;
+    }
+
+    // The nodes are selected for the first active view. Its pixels per radian
+    // are those of the axis along which the field of view is given.
+    FilamentView* view = nullptr;
+    for (auto& pair : views_) {
+        if (pair.second.is_active) {
+            view = pair.second.view.get();
+            break;
+        }
+    }
+    if (!view) {
+        return;
+    }
+    const auto viewport = view->GetViewport();
+    const Camera* camera = view->GetCamera();
+    const auto& projection = camera->GetProjection();
+    double pixels_per_radian;
+    if (projection.is_intrinsic) {
+        pixels_per_radian = projection.proj.intrinsics.fy * viewport[3] /
+                            projection.proj.intrinsics.height;
+    } else {
+        double fov = 60.0;
+        double pixels = viewport[3];
+        if (!projection.is_ortho) {
+            fov = projection.proj.perspective.fov;
+            if (projection.proj.perspective.fov_type ==
+                Camera::FovType::Horizontal) {
+                pixels = viewport[2];
+            }
+        }
+        pixels_per_radian = pixels / (fov * M_PI / 180.0);
+    }
+
+    for (auto& name_lod : point_cloud_lods_) {
+        const std::string& object_name = name_lod.first;
+        auto& entry = name_lod.second;
+        auto& streamer = *entry.streamer;
+        const auto& nodes = streamer.GetLOD().nodes_;
+        auto NodeName = [&](int node) {
+            return object_name + "/lod/" + nodes[node].name_;
+        };
+
+        const Eigen::Vector3f eye =
+                entry.transform.inverse() * camera->GetPosition();
+        auto changes = streamer.Update(eye.cast<double>(), pixels_per_radian);
+
+        auto& names = model_geometries_[object_name];
+        for (auto& node_pointcloud : changes.added) {
+            const std::string name = NodeName(node_pointcloud.first);
+            if (!AddGeometry(name, *node_pointcloud.second, entry.material)) {
+                continue;
+            }
+            names.push_back(name);
+            auto* geom = &geometries_[name];
+            auto itransform = GetGeometryTransformInstance(geom);
+            engine_.getTransformManager().setTransform(
+                    itransform, converters::FilamentMatrixFromEigenMatrix(
+                                        entry.transform.matrix()));
+            geom->visible = false;
+            scene_->remove(geom->filament_entity);
+        }
+        auto SetVisible = [&](int node, bool visible) {
+            auto geom_entry = geometries_.find(NodeName(node));
+            if (geom_entry == geometries_.end()) {
+                return;
+            }
+            auto& geom = geom_entry->second;
+            geom.visible = visible;
+            if (visible && entry.visible) {
+                scene_->addEntity(geom.filament_entity);
+            } else {
+                scene_->remove(geom.filament_entity);
+            }
+        };
+        for (int node : changes.hidden) {
+            SetVisible(node, false);
+        }
+        for (int node : changes.shown) {
+            SetVisible(node, true);
+        }
+        for (int node : changes.removed) {
+            const std::string name = NodeName(node);
+            auto geom_entry = geometries_.find(name);
+            if (geom_entry != geometries_.end()) {
+                scene_->remove(geom_entry->second.filament_entity);
+                geom_entry->second.ReleaseResources(engine_, resource_mgr_);
+                geometries_.erase(geom_entry);
+            }
+            names.erase(std::remove(names.begin(), names.end(), name),
+                        names.end());
+        }
+    }
+}
+
 bool FilamentScene::HasGeometry(const std::string& object_name) const {
     if (GeometryIsModel(object_name)) {
         return true;
@@ -567,137 +693,207 @@ bool FilamentScene::HasGeometry(const std::string& object_name) const {
     return (geom_entry != geometries_.end());
 }
 
+void FilamentScene::PointCloudStaging::Resize(size_t capacity) {
+    // The defaults of the new points match TPointCloudBuffersBuilder.
+    positions.resize(3 * capacity, 0.f);
+    colors.resize(3 * capacity, 1.f);
+    const size_t old_capacity = tangents.size() / 4;
+    tangents.resize(4 * capacity, 0.f);
+    for (size_t i = old_capacity; i < capacity; ++i) {
+        tangents[4 * i + 3] = 1.f;
+    }
+    uvs.resize(2 * capacity, 0.f);
+}
+
 void FilamentScene::UpdateGeometry(const std::string& object_name,
                                    const t::geometry::PointCloud& point_cloud,
                                    uint32_t update_flags) {
+    UpdatePointCloudBuffers(object_name, point_cloud, update_flags, 0, true);
+}
+
+bool FilamentScene::UpdateGeometryRange(
+        const std::string& object_name,
+        const t::geometry::PointCloud& point_cloud,
+        uint32_t update_flags,
+        size_t first_point) {
+    return UpdatePointCloudBuffers(object_name, point_cloud, update_flags,
+                                   first_point, false);
+}
+
+bool FilamentScene::UpdatePointCloudBuffers(
+        const std::string& object_name,
+        const t::geometry::PointCloud& point_cloud,
+        uint32_t update_flags,
+        size_t first_point,
+        bool replace) {
     auto geoms = GetGeometry(object_name, false);
-    if (!geoms.empty()) {
-        // Note: There should only be a single entry in geoms
-        auto* g = geoms[0];
-        auto vbuf_ptr = resource_mgr_.GetVertexBuffer(g->vb).lock();
-        auto vbuf = vbuf_ptr.get();
-
-        const auto& points = point_cloud.GetPoints();
-        const size_t n_vertices = points.GetLength();
-
-        // NOTE: number of points in the updated point cloud must be the
-        // same as the number of points when the vertex buffer was first
-        // created. If the number of points has changed then it cannot be
-        // updated. In that case, you must remove the geometry then add it
-        // again.
-        if (n_vertices > vbuf->getVertexCount()) {
+    if (geoms.empty() || !point_cloud.HasPoints()) {
+        return false;
+    }
+    // Note: There should only be a single entry in geoms
+    auto* g = geoms[0];
+    auto vbuf_ptr = resource_mgr_.GetVertexBuffer(g->vb).lock();
+    if (!vbuf_ptr) {
+        return false;
+    }
+    const auto& points = point_cloud.GetPoints();
+    if ((update_flags & kUpdatePointsFlag) &&
+        points.GetDtype() != core::Dtype::Float32) {
+        utility::LogWarning(
+                "Geometry for point cloud {} cannot be updated because its "
+                "points are not Float32",
+                object_name);
+        return false;
+    }
+    const size_t n_vertices = points.GetLength();
+    const size_t end = first_point + n_vertices;
+    const size_t old_capacity = vbuf_ptr->getVertexCount();
+
+    // The staged buffers start with the points of AddGeometry(), which are
+    // only known if they are all replaced.
+    if (!g->staging) {
+        g->staging = std::make_shared<PointCloudStaging>();
+        g->staging->count = old_capacity;
+        g->staging->Resize(old_capacity);
+    }
+    auto& staging = *g->staging;
+    const bool replaces_all = replace && first_point == 0 &&
+                              (update_flags & kUpdatePointsFlag);
+    size_t capacity = old_capacity;
+    if (end > capacity) {
+        if (!staging.complete && !replaces_all) {
             utility::LogWarning(
-                    "Geometry for point cloud {} cannot be updated because the "
-                    "number of points exceeds the existing point count (Old: "
-                    "{}, New: {})",
-                    object_name, vbuf->getVertexCount(), n_vertices);
+                    "Geometry for point cloud {} cannot grow to {} points "
+                    "because its previous points are unknown. Update it with "
+                    "UpdateGeometry() first.",
+                    object_name, end);
+            return false;
+        }
+        // Leave room for appending more points without growing again.
+        capacity = end + end / 2;
+        staging.Resize(capacity);
+    }
+    if (replaces_all) {
+        staging.complete = true;
+    }
+
+    // Convert the flagged attributes into the staged buffers. Only these are
+    // copied from CUDA point clouds, after being packed on the device.
+    if (update_flags & kUpdatePointsFlag) {
+        TPointCloudBuffersBuilder::CopyPositions(
+                point_cloud, staging.positions.data() + 3 * first_point);
+    }
+    if (update_flags & kUpdateColorsFlag) {
+        TPointCloudBuffersBuilder::CopyColors(
+                point_cloud, staging.colors.data() + 3 * first_point);
+    }
+    if (update_flags & kUpdateNormalsFlag) {
+        TPointCloudBuffersBuilder::CopyTangents(
+                point_cloud, staging.tangents.data() + 4 * first_point);
+    }
+    if (update_flags & kUpdateUv0Flag) {
+        TPointCloudBuffersBuilder::CopyUvs(
+                point_cloud, staging.uvs.data() + 2 * first_point);
+    }
+    const size_t old_count = staging.count;
+    staging.count = replace ? end : std::max(staging.count, end);
+
+    // The uploads copy the staged ranges, which Filament frees once they are
+    // consumed, so that neither the caller nor the renderer waits.
+    auto Upload = [this](filament::VertexBuffer* vbuf, uint8_t index,
+                         const std::vector<float>& data, size_t components,
+                         size_t from, size_t to) {
+        const size_t size = (to - from) * components * sizeof(float);
+        if (size == 0) {
             return;
         }
+        auto* copy = static_cast<float*>(malloc(size));
+        memcpy(copy, data.data() + from * components, size);
+        filament::VertexBuffer::BufferDescriptor descriptor(copy, size,
+                                                            DeallocateBuffer);
+        vbuf->setBufferAt(engine_, index, std::move(descriptor),
+                          uint32_t(from * components * sizeof(float)));
+    };
 
-        bool geometry_update_needed = n_vertices != vbuf->getVertexCount();
-        bool pcloud_is_gpu =
-                points.GetDevice().GetType() == core::Device::DeviceType::CUDA;
-        t::geometry::PointCloud cpu_pcloud;
-        if (pcloud_is_gpu) {
-            cpu_pcloud = point_cloud.CPU();
+    auto& renderable_mgr = engine_.getRenderableManager();
+    auto inst = renderable_mgr.getInstance(g->filament_entity);
+    if (capacity != old_capacity) {
+        // Replace the buffers by larger ones, uploaded from the staged copy.
+        auto vb = TPointCloudBuffersBuilder::CreateVertexBuffer(capacity);
+        auto ib = resource_mgr_.CreateIndexBuffer(
+                capacity, sizeof(GeometryBuffersBuilder::IndexType));
+        auto new_vbuf = resource_mgr_.GetVertexBuffer(vb).lock();
+        auto new_ibuf = resource_mgr_.GetIndexBuffer(ib).lock();
+        if (!new_vbuf || !new_ibuf) {
+            utility::LogWarning("Failed to grow the buffers of point cloud {}",
+                                object_name);
+            return false;
         }
-
-        // Update the each of the attribute requested
+        Upload(new_vbuf.get(), 0, staging.positions, 3, 0, capacity);
+        Upload(new_vbuf.get(), 1, staging.colors, 3, 0, capacity);
+        Upload(new_vbuf.get(), 2, staging.tangents, 4, 0, capacity);
+        Upload(new_vbuf.get(), 3, staging.uvs, 2, 0, capacity);
+
+        const size_t index_array_size =
+                capacity * sizeof(GeometryBuffersBuilder::IndexType);
+        auto* index_array = static_cast<GeometryBuffersBuilder::IndexType*>(
+                malloc(index_array_size));
+        for (size_t i = 0; i < capacity; ++i) {
+            index_array[i] = GeometryBuffersBuilder::IndexType(i);
+        }
+        filament::IndexBuffer::BufferDescriptor index_descriptor(
+                index_array, index_array_size, DeallocateBuffer);
+        new_ibuf->setBuffer(engine_, std::move(index_descriptor));
+
+        renderable_mgr.setGeometryAt(
+                inst, 0, filament::RenderableManager::PrimitiveType::POINTS,
+                new_vbuf.get(), new_ibuf.get(), 0, staging.count);
+        resource_mgr_.Destroy(g->vb);
+        resource_mgr_.Destroy(g->ib);
+        g->vb = vb;
+        g->ib = ib;
+    } else {
+        auto* vbuf = vbuf_ptr.get();
         if (update_flags & kUpdatePointsFlag) {
-            const size_t vertex_array_size = n_vertices * 3 * sizeof(float);
-            if (pcloud_is_gpu) {
-                auto vertex_data =
-                        static_cast<float*>(malloc(vertex_array_size));
-                memcpy(vertex_data, cpu_pcloud.GetPoints().GetDataPtr(),
-                       vertex_array_size);
-                filament::VertexBuffer::BufferDescriptor pts_descriptor(
-                        vertex_data, vertex_array_size, DeallocateBuffer);
-                vbuf->setBufferAt(engine_, 0, std::move(pts_descriptor));
-            } else {
-                filament::VertexBuffer::BufferDescriptor pts_descriptor(
-                        points.GetDataPtr(), vertex_array_size);
-                vbuf->setBufferAt(engine_, 0, std::move(pts_descriptor));
-            }
+            Upload(vbuf, 0, staging.positions, 3, first_point, end);
         }
-
-        if (update_flags & kUpdateColorsFlag && point_cloud.HasPointColors()) {
-            const size_t color_array_size = n_vertices * 3 * sizeof(float);
-            if (pcloud_is_gpu) {
-                auto color_data = static_cast<float*>(malloc(color_array_size));
-                memcpy(color_data, cpu_pcloud.GetPoints().GetDataPtr(),
-                       color_array_size);
-                filament::VertexBuffer::BufferDescriptor color_descriptor(
-                        color_data, color_array_size, DeallocateBuffer);
-                vbuf->setBufferAt(engine_, 1, std::move(color_descriptor));
-            } else {
-                filament::VertexBuffer::BufferDescriptor color_descriptor(
-                        point_cloud.GetPointColors().GetDataPtr(),
-                        color_array_size);
-                vbuf->setBufferAt(engine_, 1, std::move(color_descriptor));
-            }
+        if (update_flags & kUpdateColorsFlag) {
+            Upload(vbuf, 1, staging.colors, 3, first_point, end);
         }
-
-        if (update_flags & kUpdateNormalsFlag &&
-            point_cloud.HasPointNormals()) {
-            const size_t normal_array_size = n_vertices * 4 * sizeof(float);
-            const void* normal_data = nullptr;
-            if (pcloud_is_gpu) {
-                const auto& normals = point_cloud.GetPointNormals();
-                normal_data = normals.GetDataPtr();
-            } else {
-                normal_data = cpu_pcloud.GetPointNormals().GetDataPtr();
-            }
-
-            // Converting normals to Filament type - quaternions
-            auto float4v_tangents = static_cast<filament::math::quatf*>(
-                    malloc(normal_array_size));
-            auto orientation = filament::geometry::SurfaceOrientation::Builder()
-                                       .vertexCount(n_vertices)
-                                       .normals(reinterpret_cast<
-                                                const filament::math::float3*>(
-                                               normal_data))
-                                       .build();
-            orientation->getQuats(float4v_tangents, n_vertices);
-            filament::VertexBuffer::BufferDescriptor normals_descriptor(
-                    float4v_tangents, normal_array_size, DeallocateBuffer);
-            vbuf->setBufferAt(engine_, 2, std::move(normals_descriptor));
-            delete orientation;
+        if (update_flags & kUpdateNormalsFlag) {
+            Upload(vbuf, 2, staging.tangents, 4, first_point, end);
         }
-
         if (update_flags & kUpdateUv0Flag) {
-            const size_t uv_array_size = n_vertices * 2 * sizeof(float);
-            if (point_cloud.HasPointAttr("uv")) {
-                filament::VertexBuffer::BufferDescriptor uv_descriptor(
-                        point_cloud.GetPointAttr("uv").GetDataPtr(),
-                        uv_array_size);
-                vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor));
-            } else if (point_cloud.HasPointAttr("__visualization_scalar")) {
-                // Update in PointCloudBuffers.cpp, too:
-                //     TPointCloudBuffersBuilder::ConstructBuffers
-                float* uv_array = static_cast<float*>(malloc(uv_array_size));
-                memset(uv_array, 0, uv_array_size);
-                const float* src = static_cast<const float*>(
-                        point_cloud.GetPointAttr("__visualization_scalar")
-                                .GetDataPtr());
-                const size_t n = 2 * n_vertices;
-                for (size_t i = 0; i < n; i += 2) {
-                    uv_array[i] = *src++;
-                }
-                filament::VertexBuffer::BufferDescriptor uv_descriptor(
-                        uv_array, uv_array_size, DeallocateBuffer);
-                vbuf->setBufferAt(engine_, 3, std::move(uv_descriptor));
-            }
+            Upload(vbuf, 3, staging.uvs, 2, first_point, end);
         }
-
-        // Update the geometry to reflect new geometry count
-        if (geometry_update_needed) {
-            auto& renderable_mgr = engine_.getRenderableManager();
-            auto inst = renderable_mgr.getInstance(g->filament_entity);
+        if (staging.count != old_count) {
             renderable_mgr.setGeometryAt(
                     inst, 0, filament::RenderableManager::PrimitiveType::POINTS,
-                    0, n_vertices);
+                    0, staging.count);
+        }
+    }
+
+    // Grow the bounding box so that the new points are not culled.
+    if (update_flags & kUpdatePointsFlag) {
+        filament::math::float3 min_pt(1e30f);
+        filament::math::float3 max_pt(-1e30f);
+        if (!replace) {
+            const auto& aabb = renderable_mgr.getAxisAlignedBoundingBox(inst);
+            min_pt = aabb.getMin();
+            max_pt = aabb.getMax();
+        }
+        const float* pts = staging.positions.data() + 3 * first_point;
+        for (size_t i = 0; i < 3 * n_vertices; i += 3) {
+            for (int j = 0; j < 3; ++j) {
+                min_pt[j] = std::min(min_pt[j], pts[i + j]);
+                max_pt[j] = std::max(max_pt[j], pts[i + j]);
+            }
         }
+        filament::Box aabb;
+        aabb.set(min_pt, max_pt);
+        renderable_mgr.setAxisAlignedBoundingBox(inst, aabb);
     }
+    return true;
 }
 
 void FilamentScene::RemoveGeometry(const std::string& object_name) {
@@ -713,9 +909,24 @@ void FilamentScene::RemoveGeometry(const std::string& object_name) {
     if (GeometryIsModel(object_name)) {
         model_geometries_.erase(object_name);
     }
+    point_cloud_lods_.erase(object_name);
 }
 
 void FilamentScene::ShowGeometry(const std::string& object_name, bool show) {
+    // Only the nodes selected by the streamer of a LOD are shown.
+    auto lod = point_cloud_lods_.find(object_name);
+    if (lod != point_cloud_lods_.end()) {
+        lod->second.visible = show;
+        for (auto* g : GetGeometry(object_name)) {
+            if (g->visible && show) {
+                scene_->addEntity(g->filament_entity);
+            } else {
+                scene_->remove(g->filament_entity);
+            }
+        }
+        return;
+    }
+
     auto geoms = GetGeometry(object_name);
     for (auto* g : geoms) {
         if (g->visible != show) {
@@ -730,6 +941,10 @@ void FilamentScene::ShowGeometry(const std::string& object_name, bool show) {
 }
 
 bool FilamentScene::GeometryIsVisible(const std::string& object_name) {
+    auto lod = point_cloud_lods_.find(object_name);
+    if (lod != point_cloud_lods_.end()) {
+        return lod->second.visible;
+    }
     auto geoms = GetGeometry(object_name);
     if (!geoms.empty()) {
         // NOTE: all meshes of model share same visibility so we only need to
@@ -757,6 +972,10 @@ FilamentScene::GetGeometryTransformInstance(RenderableGeometry* geom) {
 
 void FilamentScene::SetGeometryTransform(const std::string& object_name,
                                          const Transform& transform) {
+    auto lod = point_cloud_lods_.find(object_name);
+    if (lod != point_cloud_lods_.end()) {
+        lod->second.transform = transform;
+    }
     auto geoms = GetGeometry(object_name);
     for (auto* g : geoms) {
         auto itransform = GetGeometryTransformInstance(g);
@@ -1226,6 +1445,10 @@ void FilamentScene::OverrideMaterialInternal(RenderableGeometry* geom,
 
 void FilamentScene::OverrideMaterial(const std::string& object_name,
                                      const Material& material) {
+    auto lod = point_cloud_lods_.find(object_name);
+    if (lod != point_cloud_lods_.end()) {
+        lod->second.material = material;
+    }
     auto geoms = GetGeometry(object_name);
     for (auto* g : geoms) {
         OverrideMaterialInternal(g, material);
@@ -1572,6 +1795,10 @@ Eigen::Vector3f FilamentScene::GetSunLightDirection() {
 }
 
 bool FilamentScene::SetIndirectLight(const std::string& ibl_name) {
+    // Read the matching skybox while the IBL is created
+    std::string skybox_path = ibl_name + std::string("_skybox.ktx");
+    FilamentResourceManager::PrefetchResourceFile(skybox_path);
+
     // Load IBL
     std::string ibl_path = ibl_name + std::string("_ibl.ktx");
     rendering::IndirectLightHandle new_ibl =
@@ -1588,7 +1815,6 @@ bool FilamentScene::SetIndirectLight(const std::string& ibl_name) {
     }
 
     // Load matching skybox
-    std::string skybox_path = ibl_name + std::string("_skybox.ktx");
     SkyboxHandle sky =
             renderer_.AddSkybox(ResourceLoadRequest(skybox_path.c_str()));
     auto wskybox = resource_mgr_.GetSkybox(sky);
@@ -1915,6 +2141,7 @@ void FilamentScene::RenderableGeometry::ReleaseResources(
 }
 
 void FilamentScene::Draw(filament::Renderer& renderer) {
+    UpdatePointCloudLODs();
     for (auto& pair : views_) {
         auto& container = pair.second;
         // Skip inactive views
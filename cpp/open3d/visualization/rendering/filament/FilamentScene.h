@@ -48,6 +48,7 @@
 #endif  // _MSC_VER
 
 #include <Eigen/Geometry>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -77,6 +78,7 @@ namespace rendering {
 
 class FilamentView;
 class GeometryBuffersBuilder;
+class PointCloudLODStreamer;
 class Renderer;
 class View;
 
@@ -123,10 +125,18 @@ public:
                      size_t downsample_threshold = SIZE_MAX) override;
     bool AddGeometry(const std::string& object_name,
                      const TriangleMeshModel& model) override;
+    bool AddPointCloudLOD(const std::string& object_name,
+                          std::shared_ptr<const t::io::PointCloudLOD> lod,
+                          const Material& material,
+                          const PointCloudLODSettings& settings) override;
     bool HasGeometry(const std::string& object_name) const override;
     void UpdateGeometry(const std::string& object_name,
                         const t::geometry::PointCloud& point_cloud,
                         uint32_t update_flags) override;
+    bool UpdateGeometryRange(const std::string& object_name,
+                             const t::geometry::PointCloud& point_cloud,
+                             uint32_t update_flags,
+                             size_t first_point) override;
     void RemoveGeometry(const std::string& object_name) override;
     void ShowGeometry(const std::string& object_name, bool show) override;
     bool GeometryIsVisible(const std::string& object_name) override;
@@ -275,6 +285,19 @@ private:
         MaterialInstanceHandle mat_instance;
     };
 
+    // CPU copy of the vertex buffers of an updated point cloud in the layout
+    // of TPointCloudBuffersBuilder, from which the buffers are re-uploaded
+    // when they grow.
+    struct PointCloudStaging {
+        size_t count = 0;  // number of points drawn
+        bool complete = false;  // false if the initial points are unknown
+        std::vector<float> positions;
+        std::vector<float> colors;
+        std::vector<float> tangents;
+        std::vector<float> uvs;
+        void Resize(size_t capacity);
+    };
+
     struct RenderableGeometry {
         std::string name;
         bool visible = true;
@@ -290,6 +313,7 @@ private:
         filament::RenderableManager::PrimitiveType primitive_type;
         VertexBufferHandle vb;
         IndexBufferHandle ib;
+        std::shared_ptr<PointCloudStaging> staging;
         void ReleaseResources(filament::Engine& engine,
                               FilamentResourceManager& manager);
     };
@@ -330,6 +354,12 @@ private:
     void UpdateUnlitPolygonOffsetShader(GeometryMaterialInstance& geom_mi);
     utils::EntityInstance<filament::TransformManager>
     GetGeometryTransformInstance(RenderableGeometry* geom);
+    bool UpdatePointCloudBuffers(const std::string& object_name,
+                                 const t::geometry::PointCloud& point_cloud,
+                                 uint32_t update_flags,
+                                 size_t first_point,
+                                 bool replace);
+    void UpdatePointCloudLODs();
     void CreateSunDirectionalLight();
     void CreateBackgroundGeometry();
     void CreateGroundPlaneGeometry();
@@ -338,6 +368,16 @@ private:
     std::unordered_map<std::string, LightEntity> lights_;
     std::unordered_map<std::string, std::vector<std::string>> model_geometries_;
 
+    // The resident nodes of a point cloud LOD are geometries of the model
+    // object_name, named object_name + "/lod/" + node name.
+    struct PointCloudLODEntry {
+        std::unique_ptr<PointCloudLODStreamer> streamer;
+        Material material;
+        Transform transform = Transform::Identity();
+        bool visible = true;
+    };
+    std::unordered_map<std::string, PointCloudLODEntry> point_cloud_lods_;
+
     Eigen::Vector4f background_color_;
     std::shared_ptr<geometry::Image> background_image_;
     std::string ibl_name_;
@@ -45,6 +45,7 @@
 #endif  // _MSC_VER
 
 #include "open3d/geometry/BoundingVolume.h"
+#include "open3d/core/MemoryManager.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/visualization/rendering/filament/FilamentEngine.h"
@@ -103,6 +104,14 @@ struct ColoredVertex {
         }
     }
 };
+
+// Copies \p tensor as contiguous floats to \p dst in host memory.
+void CopyFloatsToHost(const core::Tensor& tensor, float* dst) {
+    const core::Tensor floats = tensor.To(core::Dtype::Float32).Contiguous();
+    core::MemoryManager::MemcpyToHost(dst, floats.GetDataPtr(),
+                                      floats.GetDevice(),
+                                      floats.NumElements() * sizeof(float));
+}
 }  // namespace
 
 IndexBufferHandle GeometryBuffersBuilder::CreateIndexBuffer(
@@ -306,17 +315,11 @@ RenderableManager::PrimitiveType TPointCloudBuffersBuilder::GetPrimitiveType()
     return RenderableManager::PrimitiveType::POINTS;
 }
 
-GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
+VertexBufferHandle TPointCloudBuffersBuilder::CreateVertexBuffer(
+        size_t n_vertices) {
     auto& engine = EngineInstance::GetInstance();
     auto& resource_mgr = EngineInstance::GetResourceManager();
 
-    // NOTE: ConstructBuffers assumes caller has checked that DTYPE of the
-    // tensor is float32. It is an error to call this with a tensor of any other
-    // dtype
-
-    const auto& points = geometry_.GetPoints();
-    const size_t n_vertices = points.GetLength();
-
     // We use CUSTOM0 for tangents along with TANGENTS attribute
     // because Filament would optimize out anything about normals and lightning
     // from unlit materials. But our shader for normals visualizing is unlit, so
@@ -341,73 +344,51 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
     VertexBufferHandle vb_handle;
     if (vbuf) {
         vb_handle = resource_mgr.AddVertexBuffer(vbuf);
-    } else {
+    }
+    return vb_handle;
+}
+
+GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
+    auto& engine = EngineInstance::GetInstance();
+    auto& resource_mgr = EngineInstance::GetResourceManager();
+
+    // NOTE: ConstructBuffers assumes caller has checked that DTYPE of the
+    // tensor is float32. It is an error to call this with a tensor of any other
+    // dtype
+
+    const auto& points = geometry_.GetPoints();
+    const size_t n_vertices = points.GetLength();
+
+    VertexBufferHandle vb_handle = CreateVertexBuffer(n_vertices);
+    if (!vb_handle) {
         return {};
     }
+    auto vbuf_ptr = resource_mgr.GetVertexBuffer(vb_handle).lock();
+    auto vbuf = vbuf_ptr.get();
 
     const size_t vertex_array_size = n_vertices * 3 * sizeof(float);
     float* vertex_array = static_cast<float*>(malloc(vertex_array_size));
-    memcpy(vertex_array, points.GetDataPtr(), vertex_array_size);
+    CopyPositions(geometry_, vertex_array);
     VertexBuffer::BufferDescriptor pts_descriptor(
             vertex_array, vertex_array_size,
             GeometryBuffersBuilder::DeallocateBuffer);
     vbuf->setBufferAt(engine, 0, std::move(pts_descriptor));
 
     const size_t color_array_size = n_vertices * 3 * sizeof(float);
-    if (geometry_.HasPointColors()) {
-        float* color_array = static_cast<float*>(malloc(color_array_size));
-        if (geometry_.GetPointColors().GetDtype() == core::Dtype::UInt8) {
-            float* color_array_ptr = color_array;
-            const uint8_t* color_uint8_array = static_cast<const uint8_t*>(
-                    geometry_.GetPointColors().GetDataPtr());
-            for (size_t i = 0; i < n_vertices; ++i) {
-                *color_array_ptr++ = *color_uint8_array++ / 255.f;
-                *color_array_ptr++ = *color_uint8_array++ / 255.f;
-                *color_array_ptr++ = *color_uint8_array++ / 255.f;
-            }
-            VertexBuffer::BufferDescriptor color_descriptor(
-                    color_array, color_array_size,
-                    GeometryBuffersBuilder::DeallocateBuffer);
-            vbuf->setBufferAt(engine, 1, std::move(color_descriptor));
-        } else {
-            memcpy(color_array, geometry_.GetPointColors().GetDataPtr(),
-                   color_array_size);
-            VertexBuffer::BufferDescriptor color_descriptor(
-                    color_array, color_array_size,
-                    GeometryBuffersBuilder::DeallocateBuffer);
-            vbuf->setBufferAt(engine, 1, std::move(color_descriptor));
-        }
-    } else {
-        float* color_array = static_cast<float*>(malloc(color_array_size));
+    float* color_array = static_cast<float*>(malloc(color_array_size));
+    if (!CopyColors(geometry_, color_array)) {
         for (size_t i = 0; i < n_vertices * 3; ++i) {
             color_array[i] = 1.f;
         }
-        VertexBuffer::BufferDescriptor color_descriptor(
-                color_array, color_array_size,
-                GeometryBuffersBuilder::DeallocateBuffer);
-        vbuf->setBufferAt(engine, 1, std::move(color_descriptor));
     }
+    VertexBuffer::BufferDescriptor color_descriptor(
+            color_array, color_array_size,
+            GeometryBuffersBuilder::DeallocateBuffer);
+    vbuf->setBufferAt(engine, 1, std::move(color_descriptor));
 
     const size_t normal_array_size = n_vertices * 4 * sizeof(float);
-    if (geometry_.HasPointNormals()) {
-        const auto& normals = geometry_.GetPointNormals();
-
-        // Converting normals to Filament type - quaternions
-        auto float4v_tangents =
-                static_cast<math::quatf*>(malloc(normal_array_size));
-        auto orientation =
-                filament::geometry::SurfaceOrientation::Builder()
-                        .vertexCount(n_vertices)
-                        .normals(reinterpret_cast<const math::float3*>(
-                                normals.GetDataPtr()))
-                        .build();
-        orientation->getQuats(float4v_tangents, n_vertices);
-        VertexBuffer::BufferDescriptor normals_descriptor(
-                float4v_tangents, normal_array_size,
-                GeometryBuffersBuilder::DeallocateBuffer);
-        vbuf->setBufferAt(engine, 2, std::move(normals_descriptor));
-    } else {
-        float* normal_array = static_cast<float*>(malloc(normal_array_size));
+    float* normal_array = static_cast<float*>(malloc(normal_array_size));
+    if (!CopyTangents(geometry_, normal_array)) {
         float* normal_ptr = normal_array;
         for (size_t i = 0; i < n_vertices; ++i) {
             *normal_ptr++ = 0.f;
@@ -415,28 +396,15 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
             *normal_ptr++ = 0.f;
             *normal_ptr++ = 1.f;
         }
-        VertexBuffer::BufferDescriptor normals_descriptor(
-                normal_array, normal_array_size,
-                GeometryBuffersBuilder::DeallocateBuffer);
-        vbuf->setBufferAt(engine, 2, std::move(normals_descriptor));
     }
+    VertexBuffer::BufferDescriptor normals_descriptor(
+            normal_array, normal_array_size,
+            GeometryBuffersBuilder::DeallocateBuffer);
+    vbuf->setBufferAt(engine, 2, std::move(normals_descriptor));
 
     const size_t uv_array_size = n_vertices * 2 * sizeof(float);
     float* uv_array = static_cast<float*>(malloc(uv_array_size));
-    if (geometry_.HasPointAttr("uv")) {
-        const float* uv_src = static_cast<const float*>(
-                geometry_.GetPointAttr("uv").GetDataPtr());
-        memcpy(uv_array, uv_src, uv_array_size);
-    } else if (geometry_.HasPointAttr("__visualization_scalar")) {
-        // Update in FilamentScene::UpdateGeometry(), too.
-        memset(uv_array, 0, uv_array_size);
-        const float* src = static_cast<const float*>(
-                geometry_.GetPointAttr("__visualization_scalar").GetDataPtr());
-        const size_t n = 2 * n_vertices;
-        for (size_t i = 0; i < n; i += 2) {
-            uv_array[i] = *src++;
-        }
-    } else {
+    if (!CopyUvs(geometry_, uv_array)) {
         memset(uv_array, 0, uv_array_size);
     }
     VertexBuffer::BufferDescriptor uv_descriptor(
@@ -454,9 +422,73 @@ GeometryBuffersBuilder::Buffers TPointCloudBuffersBuilder::ConstructBuffers() {
     return std::make_tuple(vb_handle, ib_handle, downsampled_handle);
 }
 
+bool TPointCloudBuffersBuilder::CopyPositions(
+        const t::geometry::PointCloud& geometry, float* dst) {
+    if (!geometry.HasPoints()) {
+        return false;
+    }
+    CopyFloatsToHost(geometry.GetPoints(), dst);
+    return true;
+}
+
+bool TPointCloudBuffersBuilder::CopyColors(
+        const t::geometry::PointCloud& geometry, float* dst) {
+    if (!geometry.HasPointColors()) {
+        return false;
+    }
+    const auto& colors = geometry.GetPointColors();
+    if (colors.GetDtype() == core::Dtype::UInt8) {
+        CopyFloatsToHost(colors.To(core::Dtype::Float32) / 255.f, dst);
+    } else {
+        CopyFloatsToHost(colors, dst);
+    }
+    return true;
+}
+
+bool TPointCloudBuffersBuilder::CopyTangents(
+        const t::geometry::PointCloud& geometry, float* dst) {
+    if (!geometry.HasPointNormals()) {
+        return false;
+    }
+    // SurfaceOrientation runs on the CPU, so only the normals are copied.
+    const core::Tensor normals =
+            geometry.GetPointNormals()
+                    .To(core::Device("CPU:0"), core::Dtype::Float32)
+                    .Contiguous();
+    const size_t n_vertices = normals.GetLength();
+    auto orientation = filament::geometry::SurfaceOrientation::Builder()
+                               .vertexCount(n_vertices)
+                               .normals(reinterpret_cast<const math::float3*>(
+                                       normals.GetDataPtr()))
+                               .build();
+    orientation->getQuats(reinterpret_cast<math::quatf*>(dst), n_vertices);
+    delete orientation;
+    return true;
+}
+
+bool TPointCloudBuffersBuilder::CopyUvs(
+        const t::geometry::PointCloud& geometry, float* dst) {
+    if (geometry.HasPointAttr("uv")) {
+        CopyFloatsToHost(geometry.GetPointAttr("uv"), dst);
+        return true;
+    }
+    if (geometry.HasPointAttr("__visualization_scalar")) {
+        // The scalar is the u coordinate of the gradient texture.
+        const auto& scalar = geometry.GetPointAttr("__visualization_scalar");
+        const int64_t n_vertices = scalar.GetLength();
+        core::Tensor uvs = core::Tensor::Zeros(
+                {n_vertices, 2}, core::Dtype::Float32, scalar.GetDevice());
+        uvs.Slice(1, 0, 1) =
+                scalar.Reshape({n_vertices, 1}).To(core::Dtype::Float32);
+        CopyFloatsToHost(uvs, dst);
+        return true;
+    }
+    return false;
+}
+
 filament::Box TPointCloudBuffersBuilder::ComputeAABB() {
-    auto min_bounds = geometry_.GetMinBound();
-    auto max_bounds = geometry_.GetMaxBound();
+    auto min_bounds = geometry_.GetMinBound().To(core::Device("CPU:0"));
+    auto max_bounds = geometry_.GetMaxBound().To(core::Device("CPU:0"));
     auto* min_bounds_float = min_bounds.GetDataPtr<float>();
     auto* max_bounds_float = max_bounds.GetDataPtr<float>();
 
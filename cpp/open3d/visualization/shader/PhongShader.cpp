@@ -62,18 +62,18 @@ bool PhongShader::Compile() {
 
 void PhongShader::Release() {
     UnbindGeometry();
+    ReleaseArrayBuffer(vertex_position_buffer_, vertex_position_capacity_);
+    ReleaseArrayBuffer(vertex_normal_buffer_, vertex_normal_capacity_);
+    ReleaseArrayBuffer(vertex_color_buffer_, vertex_color_capacity_);
     ReleaseProgram();
 }
 
 bool PhongShader::BindGeometry(const geometry::Geometry &geometry,
                                const RenderOption &option,
                                const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace UnbindGeometry() with Buffer Object
-    // Streaming mechanisms.
+    // If there is already geometry, we first unbind it. The buffers are kept
+    // and overwritten in place, so that geometry that changes every frame
+    // does not reallocate them.
     UnbindGeometry();
 
     // Prepare data to be passed to GPU
@@ -85,19 +85,13 @@ bool PhongShader::BindGeometry(const geometry::Geometry &geometry,
         return false;
     }
 
-    // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_normal_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_normal_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, normals.size() * sizeof(Eigen::Vector3f),
-                 normals.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_color_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
-                 colors.data(), GL_STATIC_DRAW);
+    // Upload the data and bind the geometry
+    UploadArrayBuffer(vertex_position_buffer_, vertex_position_capacity_,
+                      points.data(), points.size() * sizeof(Eigen::Vector3f));
+    UploadArrayBuffer(vertex_normal_buffer_, vertex_normal_capacity_,
+                      normals.data(), normals.size() * sizeof(Eigen::Vector3f));
+    UploadArrayBuffer(vertex_color_buffer_, vertex_color_capacity_,
+                      colors.data(), colors.size() * sizeof(Eigen::Vector3f));
     bound_ = true;
     return true;
 }
@@ -137,14 +131,7 @@ bool PhongShader::RenderGeometry(const geometry::Geometry &geometry,
     return true;
 }
 
-void PhongShader::UnbindGeometry() {
-    if (bound_) {
-        glDeleteBuffers(1, &vertex_position_buffer_);
-        glDeleteBuffers(1, &vertex_normal_buffer_);
-        glDeleteBuffers(1, &vertex_color_buffer_);
-        bound_ = false;
-    }
-}
+void PhongShader::UnbindGeometry() { bound_ = false; }
 
 void PhongShader::SetLighting(const ViewControl &view,
                               const RenderOption &option) {
@@ -225,7 +212,8 @@ bool PhongShaderForPointCloud::PrepareBinding(
     points.resize(pointcloud.points_.size());
     normals.resize(pointcloud.points_.size());
     colors.resize(pointcloud.points_.size());
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < int64_t(pointcloud.points_.size()); i++) {
         const auto &point = pointcloud.points_[i];
         const auto &normal = pointcloud.normals_[i];
         points[i] = point.cast<float>();
@@ -135,6 +135,31 @@ void ShaderWrapper::ReleaseProgram() {
     }
 }
 
+void ShaderWrapper::UploadArrayBuffer(GLuint &buffer,
+                                      GLsizeiptr &capacity,
+                                      const void *data,
+                                      GLsizeiptr size) {
+    if (buffer == 0) {
+        glGenBuffers(1, &buffer);
+        capacity = 0;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    if (size > capacity) {
+        glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+        capacity = size;
+    } else if (size > 0) {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, size, data);
+    }
+}
+
+void ShaderWrapper::ReleaseArrayBuffer(GLuint &buffer, GLsizeiptr &capacity) {
+    if (buffer != 0) {
+        glDeleteBuffers(1, &buffer);
+        buffer = 0;
+    }
+    capacity = 0;
+}
+
 bool ShaderWrapper::ValidateShader(GLuint shader_index) {
     GLint result = GL_FALSE;
     int info_log_length;
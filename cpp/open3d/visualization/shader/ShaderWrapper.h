@@ -90,6 +90,16 @@ protected:
                         const char *const fragment_shader_code);
     void ReleaseProgram();
 
+    /// Uploads \p size bytes of \p data to the array buffer \p buffer, which
+    /// is created if it is 0. If the buffer's \p capacity is large enough, it
+    /// is overwritten in place, so that geometry updates of the same size do
+    /// not reallocate GPU memory.
+    static void UploadArrayBuffer(GLuint &buffer,
+                                  GLsizeiptr &capacity,
+                                  const void *data,
+                                  GLsizeiptr size);
+    static void ReleaseArrayBuffer(GLuint &buffer, GLsizeiptr &capacity);
+
 protected:
     GLuint vertex_shader_ = 0;
     GLuint geometry_shader_ = 0;
@@ -79,18 +79,17 @@ bool SimpleShader::Compile() {
 
 void SimpleShader::Release() {
     UnbindGeometry();
+    ReleaseArrayBuffer(vertex_position_buffer_, vertex_position_capacity_);
+    ReleaseArrayBuffer(vertex_color_buffer_, vertex_color_capacity_);
     ReleaseProgram();
 }
 
 bool SimpleShader::BindGeometry(const geometry::Geometry &geometry,
                                 const RenderOption &option,
                                 const ViewControl &view) {
-    // If there is already geometry, we first unbind it.
-    // We use GL_STATIC_DRAW. When geometry changes, we clear buffers and
-    // rebind the geometry. Note that this approach is slow. If the geometry is
-    // changing per frame, consider implementing a new ShaderWrapper using
-    // GL_STREAM_DRAW, and replace InvalidateGeometry() with Buffer Object
-    // Streaming mechanisms.
+    // If there is already geometry, we first unbind it. The buffers are kept
+    // and overwritten in place, so that geometry that changes every frame
+    // does not reallocate them.
     UnbindGeometry();
 
     // Prepare data to be passed to GPU
@@ -101,15 +100,11 @@ bool SimpleShader::BindGeometry(const geometry::Geometry &geometry,
         return false;
     }
 
-    // Create buffers and bind the geometry
-    glGenBuffers(1, &vertex_position_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_position_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Eigen::Vector3f),
-                 points.data(), GL_STATIC_DRAW);
-    glGenBuffers(1, &vertex_color_buffer_);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_color_buffer_);
-    glBufferData(GL_ARRAY_BUFFER, colors.size() * sizeof(Eigen::Vector3f),
-                 colors.data(), GL_STATIC_DRAW);
+    // Upload the data and bind the geometry
+    UploadArrayBuffer(vertex_position_buffer_, vertex_position_capacity_,
+                      points.data(), points.size() * sizeof(Eigen::Vector3f));
+    UploadArrayBuffer(vertex_color_buffer_, vertex_color_capacity_,
+                      colors.data(), colors.size() * sizeof(Eigen::Vector3f));
     bound_ = true;
     return true;
 }
@@ -135,13 +130,7 @@ bool SimpleShader::RenderGeometry(const geometry::Geometry &geometry,
     return true;
 }
 
-void SimpleShader::UnbindGeometry() {
-    if (bound_) {
-        glDeleteBuffers(1, &vertex_position_buffer_);
-        glDeleteBuffers(1, &vertex_color_buffer_);
-        bound_ = false;
-    }
-}
+void SimpleShader::UnbindGeometry() { bound_ = false; }
 
 bool SimpleShaderForPointCloud::PrepareRendering(
         const geometry::Geometry &geometry,
@@ -178,7 +167,8 @@ bool SimpleShaderForPointCloud::PrepareBinding(
     const ColorMap &global_color_map = *GetGlobalColorMap();
     points.resize(pointcloud.points_.size());
     colors.resize(pointcloud.points_.size());
-    for (size_t i = 0; i < pointcloud.points_.size(); i++) {
+#pragma omp parallel for schedule(static)
+    for (int64_t i = 0; i < int64_t(pointcloud.points_.size()); i++) {
         const auto &point = pointcloud.points_[i];
         points[i] = point.cast<float>();
         Eigen::Vector3d color;
@@ -66,9 +66,11 @@ protected:
 
 protected:
     GLuint vertex_position_;
-    GLuint vertex_position_buffer_;
+    GLuint vertex_position_buffer_ = 0;
+    GLsizeiptr vertex_position_capacity_ = 0;
     GLuint vertex_color_;
-    GLuint vertex_color_buffer_;
+    GLuint vertex_color_buffer_ = 0;
+    GLsizeiptr vertex_color_capacity_ = 0;
     GLuint MVP_;
 };
 
@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "open3d/utility/Logging.h"
+
+namespace open3d {
+namespace visualization {
+
+/// \class PointInPolygon
+///
+/// Even-odd test of points against a 2D polygon, which rejects the points
+/// outside of its bounding box before counting the edge crossings.
+class PointInPolygon {
+public:
+    explicit PointInPolygon(const std::vector<Eigen::Vector2d> &polygon)
+        : polygon_(polygon) {
+        min_bound_ = Eigen::Vector2d::Constant(0.0);
+        max_bound_ = Eigen::Vector2d::Constant(-1.0);
+        if (!polygon_.empty()) {
+            min_bound_ = max_bound_ = polygon_[0];
+            for (const auto &vertex : polygon_) {
+                min_bound_ = min_bound_.cwiseMin(vertex);
+                max_bound_ = max_bound_.cwiseMax(vertex);
+            }
+        }
+    }
+
+    /// True if an odd number of edges crosses the row of \p point to its
+    /// left.
+    bool Contains(const Eigen::Vector2d &point) const {
+        const double x = point(0);
+        const double y = point(1);
+        if (x < min_bound_(0) || x > max_bound_(0) || y < min_bound_(1) ||
+            y > max_bound_(1)) {
+            return false;
+        }
+        bool inside = false;
+        for (size_t i = 0, j = polygon_.size() - 1; i < polygon_.size();
+             j = i++) {
+            const Eigen::Vector2d &a = polygon_[i];
+            const Eigen::Vector2d &b = polygon_[j];
+            if ((a(1) < y && b(1) >= y) || (b(1) < y && a(1) >= y)) {
+                const double cross_x =
+                        a(0) + (y - a(1)) / (b(1) - a(1)) * (b(0) - a(0));
+                if (cross_x < x) {
+                    inside = !inside;
+                }
+            }
+        }
+        return inside;
+    }
+
+private:
+    std::vector<Eigen::Vector2d> polygon_;
+    Eigen::Vector2d min_bound_;
+    Eigen::Vector2d max_bound_;
+};
+
+/// Returns the indices of the points 0 to \p num_points - 1 for which
+/// \p is_selected returns true, in increasing order. The points are tested
+/// in parallel blocks.
+template <typename Predicate>
+std::vector<size_t> SelectIndices(size_t num_points, Predicate is_selected) {
+    const int64_t block_size = 65536;
+    const int64_t num_blocks =
+            (int64_t(num_points) + block_size - 1) / block_size;
+    std::vector<std::vector<size_t>> block_indices(num_blocks);
+    utility::ConsoleProgressBar progress_bar(num_points, "Cropping geometry: ");
+    size_t num_tested = 0;
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t block = 0; block < num_blocks; ++block) {
+        const size_t begin = size_t(block * block_size);
+        const size_t end = std::min(num_points, begin + size_t(block_size));
+        for (size_t i = begin; i < end; ++i) {
+            if (is_selected(i)) {
+                block_indices[block].push_back(i);
+            }
+        }
+#pragma omp critical(SelectIndices)
+        {
+            num_tested += end - begin;
+            progress_bar.SetCurrentCount(num_tested);
+        }
+    }
+
+    size_t num_selected = 0;
+    for (const auto &indices : block_indices) {
+        num_selected += indices.size();
+    }
+    std::vector<size_t> selected;
+    selected.reserve(num_selected);
+    for (const auto &indices : block_indices) {
+        selected.insert(selected.end(), indices.begin(), indices.end());
+    }
+    return selected;
+}
+
+}  // namespace visualization
+}  // namespace open3d
@@ -30,6 +30,7 @@
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/visualization/utility/GLHelper.h"
+#include "open3d/visualization/utility/PointInPolygon.h"
 #include "open3d/visualization/utility/SelectionPolygonVolume.h"
 #include "open3d/visualization/visualizer/ViewControl.h"
 #include "open3d/visualization/visualizer/ViewControlWithEditing.h"
@@ -229,67 +230,40 @@ SelectionPolygon::CropTriangleMeshInPolygon(const geometry::TriangleMesh &input,
 
 std::vector<size_t> SelectionPolygon::CropInRectangle(
         const std::vector<Eigen::Vector3d> &input, const ViewControl &view) {
-    std::vector<size_t> output_index;
     Eigen::Matrix4d mvp_matrix = view.GetMVPMatrix().cast<double>();
     double half_width = (double)view.GetWindowWidth() * 0.5;
     double half_height = (double)view.GetWindowHeight() * 0.5;
     auto min_bound = GetMinBound();
     auto max_bound = GetMaxBound();
-    utility::ConsoleProgressBar progress_bar((int64_t)input.size(),
-                                             "Cropping geometry: ");
-    for (size_t i = 0; i < input.size(); i++) {
-        ++progress_bar;
+    return SelectIndices(input.size(), [&](size_t i) {
         const auto &point = input[i];
         Eigen::Vector4d pos =
                 mvp_matrix * Eigen::Vector4d(point(0), point(1), point(2), 1.0);
-        if (pos(3) == 0.0) break;
+        if (pos(3) == 0.0) return false;
         pos /= pos(3);
         double x = (pos(0) + 1.0) * half_width;
         double y = (pos(1) + 1.0) * half_height;
-        if (x >= min_bound(0) && x <= max_bound(0) && y >= min_bound(1) &&
-            y <= max_bound(1)) {
-            output_index.push_back(i);
-        }
-    }
-    return output_index;
+        return x >= min_bound(0) && x <= max_bound(0) && y >= min_bound(1) &&
+               y <= max_bound(1);
+    });
 }
 
 std::vector<size_t> SelectionPolygon::CropInPolygon(
         const std::vector<Eigen::Vector3d> &input, const ViewControl &view) {
-    std::vector<size_t> output_index;
     Eigen::Matrix4d mvp_matrix = view.GetMVPMatrix().cast<double>();
     double half_width = (double)view.GetWindowWidth() * 0.5;
     double half_height = (double)view.GetWindowHeight() * 0.5;
-    std::vector<double> nodes;
-    utility::ConsoleProgressBar progress_bar((int64_t)input.size(),
-                                             "Cropping geometry: ");
-    for (size_t k = 0; k < input.size(); k++) {
-        ++progress_bar;
+    const PointInPolygon point_in_polygon(polygon_);
+    return SelectIndices(input.size(), [&](size_t k) {
         const auto &point = input[k];
         Eigen::Vector4d pos =
                 mvp_matrix * Eigen::Vector4d(point(0), point(1), point(2), 1.0);
-        if (pos(3) == 0.0) break;
+        if (pos(3) == 0.0) return false;
         pos /= pos(3);
         double x = (pos(0) + 1.0) * half_width;
         double y = (pos(1) + 1.0) * half_height;
-        nodes.clear();
-        for (size_t i = 0; i < polygon_.size(); i++) {
-            size_t j = (i + 1) % polygon_.size();
-            if ((polygon_[i](1) < y && polygon_[j](1) >= y) ||
-                (polygon_[j](1) < y && polygon_[i](1) >= y)) {
-                nodes.push_back(polygon_[i](0) +
-                                (y - polygon_[i](1)) /
-                                        (polygon_[j](1) - polygon_[i](1)) *
-                                        (polygon_[j](0) - polygon_[i](0)));
-            }
-        }
-        std::sort(nodes.begin(), nodes.end());
-        auto loc = std::lower_bound(nodes.begin(), nodes.end(), x);
-        if (std::distance(nodes.begin(), loc) % 2 == 1) {
-            output_index.push_back(k);
-        }
-    }
-    return output_index;
+        return point_in_polygon.Contains(Eigen::Vector2d(x, y));
+    });
 }
 
 }  // namespace visualization
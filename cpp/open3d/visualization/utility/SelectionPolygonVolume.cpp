@@ -31,6 +31,7 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/visualization/utility/PointInPolygon.h"
 
 namespace open3d {
 namespace visualization {
@@ -124,7 +125,6 @@ SelectionPolygonVolume::CropTriangleMeshInPolygon(
 
 std::vector<size_t> SelectionPolygonVolume::CropInPolygon(
         const std::vector<Eigen::Vector3d> &input) const {
-    std::vector<size_t> output_index;
     int u, v, w;
     if (orthogonal_axis_ == "x" || orthogonal_axis_ == "X") {
         u = 1;
@@ -139,35 +139,17 @@ std::vector<size_t> SelectionPolygonVolume::CropInPolygon(
         v = 1;
         w = 2;
     }
-    std::vector<double> nodes;
-    utility::ConsoleProgressBar progress_bar((int64_t)input.size(),
-                                             "Cropping geometry: ");
-    for (size_t k = 0; k < input.size(); k++) {
-        ++progress_bar;
-        const auto &point = input[k];
-        if (point(w) < axis_min_ || point(w) > axis_max_) continue;
-        nodes.clear();
-        for (size_t i = 0; i < bounding_polygon_.size(); i++) {
-            size_t j = (i + 1) % bounding_polygon_.size();
-            if ((bounding_polygon_[i](v) < point(v) &&
-                 bounding_polygon_[j](v) >= point(v)) ||
-                (bounding_polygon_[j](v) < point(v) &&
-                 bounding_polygon_[i](v) >= point(v))) {
-                nodes.push_back(bounding_polygon_[i](u) +
-                                (point(v) - bounding_polygon_[i](v)) /
-                                        (bounding_polygon_[j](v) -
-                                         bounding_polygon_[i](v)) *
-                                        (bounding_polygon_[j](u) -
-                                         bounding_polygon_[i](u)));
-            }
-        }
-        std::sort(nodes.begin(), nodes.end());
-        auto loc = std::lower_bound(nodes.begin(), nodes.end(), point(u));
-        if (std::distance(nodes.begin(), loc) % 2 == 1) {
-            output_index.push_back(k);
-        }
+    std::vector<Eigen::Vector2d> polygon;
+    polygon.reserve(bounding_polygon_.size());
+    for (const auto &vertex : bounding_polygon_) {
+        polygon.emplace_back(vertex(u), vertex(v));
     }
-    return output_index;
+    const PointInPolygon point_in_polygon(polygon);
+    return SelectIndices(input.size(), [&](size_t k) {
+        const auto &point = input[k];
+        return point(w) >= axis_min_ && point(w) <= axis_max_ &&
+               point_in_polygon.Contains(Eigen::Vector2d(point(u), point(v)));
+    });
 }
 
 }  // namespace visualization
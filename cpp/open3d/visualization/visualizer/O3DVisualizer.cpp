@@ -86,6 +86,7 @@ enum MenuId {
     MENU_EXPORT_RGB,
     MENU_CLOSE,
     MENU_SETTINGS,
+    MENU_FRAME_STATISTICS,
     MENU_ACTIONS_BASE = 1000 /* this should be last */
 };
 
@@ -1833,6 +1834,8 @@ O3DVisualizer::O3DVisualizer(const std::string &title, int width, int height)
     auto actions_menu = std::make_shared<Menu>();
     actions_menu->AddItem("Show Settings", MENU_SETTINGS);
     actions_menu->SetChecked(MENU_SETTINGS, false);
+    actions_menu->AddItem("Show Frame Statistics", MENU_FRAME_STATISTICS);
+    actions_menu->SetChecked(MENU_FRAME_STATISTICS, false);
     menu->AddMenu("Actions", actions_menu);
     impl_->settings.actions_menu = actions_menu.get();
 
@@ -1850,6 +1853,14 @@ O3DVisualizer::O3DVisualizer(const std::string &title, int width, int height)
     SetOnMenuItemActivated(MENU_CLOSE, [this]() { this->impl_->OnClose(); });
     SetOnMenuItemActivated(MENU_SETTINGS,
                            [this]() { this->impl_->OnToggleSettings(); });
+    SetOnMenuItemActivated(MENU_FRAME_STATISTICS, [this]() {
+        bool show = !IsShowingFrameStatistics();
+        ShowFrameStatistics(show);
+        auto menubar = Application::GetInstance().GetMenubar();
+        if (menubar) {
+            menubar->SetChecked(MENU_FRAME_STATISTICS, show);
+        }
+    });
 
     impl_->ShowSettings(false, false);
 }
@@ -29,6 +29,7 @@
 #include <api/video/i420_buffer.h>
 #include <libyuv/convert.h>
 #include <libyuv/video_common.h>
+#include <media/base/video_adapter.h>
 #include <media/base/video_broadcaster.h>
 #include <media/base/video_common.h>
 
@@ -62,6 +63,10 @@ ImageCapturer::ImageCapturer(const std::map<std::string, std::string>& opts)
     if (opts.find("height") != opts.end()) {
         height_ = std::stoi(opts.at("height"));
     }
+    if (opts.find("fps") != opts.end()) {
+        video_adapter_.OnOutputFormatRequest(absl::nullopt, absl::nullopt,
+                                             std::stoi(opts.at("fps")));
+    }
 }
 
 void ImageCapturer::OnCaptureResult(
@@ -69,6 +74,14 @@ void ImageCapturer::OnCaptureResult(
     int height = (int)frame->GetShape(0);
     int width = (int)frame->GetShape(1);
 
+    // Drop the frame before doing any work if it is not wanted.
+    int cropped_width = 0, cropped_height = 0, out_width = 0, out_height = 0;
+    if (!video_adapter_.AdaptFrameResolution(width, height, rtc::TimeNanos(),
+                                             &cropped_width, &cropped_height,
+                                             &out_width, &out_height)) {
+        return;
+    }
+
     rtc::scoped_refptr<webrtc::I420Buffer> i420_buffer =
             webrtc::I420Buffer::Create(width, height);
 
@@ -84,12 +97,16 @@ void ImageCapturer::OnCaptureResult(
         webrtc::VideoFrame video_frame(i420_buffer,
                                        webrtc::VideoRotation::kVideoRotation_0,
                                        rtc::TimeMicros());
-        if ((height_ == 0) && (width_ == 0)) {
+        if ((height_ == 0) && (width_ == 0) && (out_width == width) &&
+            (out_height == height)) {
             broadcaster_.OnFrame(video_frame);
         } else {
             int height = height_;
             int width = width_;
-            if (height == 0) {
+            if ((height == 0) && (width == 0)) {
+                height = out_height;
+                width = out_width;
+            } else if (height == 0) {
                 height = (video_frame.height() * width) / video_frame.width();
             } else if (width == 0) {
                 width = (video_frame.width() * height) / video_frame.height();
@@ -99,8 +116,11 @@ void ImageCapturer::OnCaptureResult(
             rtc::scoped_refptr<webrtc::I420Buffer> scaled_buffer =
                     webrtc::I420Buffer::Create(width, height, stride_y,
                                                stride_uv, stride_uv);
-            scaled_buffer->ScaleFrom(
-                    *video_frame.video_frame_buffer()->ToI420());
+            scaled_buffer->CropAndScaleFrom(
+                    *video_frame.video_frame_buffer()->ToI420(),
+                    (video_frame.width() - cropped_width) / 2,
+                    (video_frame.height() - cropped_height) / 2,
+                    cropped_width, cropped_height);
             webrtc::VideoFrame frame = webrtc::VideoFrame(
                     scaled_buffer, webrtc::kVideoRotation_0, rtc::TimeMicros());
 
@@ -117,11 +137,13 @@ void ImageCapturer::AddOrUpdateSink(
         rtc::VideoSinkInterface<webrtc::VideoFrame>* sink,
         const rtc::VideoSinkWants& wants) {
     broadcaster_.AddOrUpdateSink(sink, wants);
+    video_adapter_.OnSinkWants(broadcaster_.wants());
 }
 
 void ImageCapturer::RemoveSink(
         rtc::VideoSinkInterface<webrtc::VideoFrame>* sink) {
     broadcaster_.RemoveSink(sink);
+    video_adapter_.OnSinkWants(broadcaster_.wants());
 }
 
 }  // namespace webrtc_server
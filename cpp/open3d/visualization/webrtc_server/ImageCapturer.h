@@ -32,6 +32,7 @@
 #include <api/video/i420_buffer.h>
 #include <libyuv/convert.h>
 #include <libyuv/video_common.h>
+#include <media/base/video_adapter.h>
 #include <media/base/video_broadcaster.h>
 #include <media/base/video_common.h>
 
@@ -64,12 +65,19 @@ public:
     virtual void RemoveSink(
             rtc::VideoSinkInterface<webrtc::VideoFrame>* sink) override;
 
+    /// Converts \p frame to I420 and sends it to the sinks. Frames are
+    /// dropped before the conversion if the sinks ask for a lower frame rate,
+    /// e.g. because the encoder cannot keep up, and are downscaled to the
+    /// resolution the sinks ask for.
     void OnCaptureResult(const std::shared_ptr<core::Tensor>& frame);
 
 protected:
     int width_;
     int height_;
     rtc::VideoBroadcaster broadcaster_;
+    /// Adapts the frame rate and resolution to the aggregated sink wants,
+    /// which WebRTC lowers when encoding or the network is overused.
+    cricket::VideoAdapter video_adapter_;
 };
 
 class ImageTrackSource : public BitmapTrackSource {
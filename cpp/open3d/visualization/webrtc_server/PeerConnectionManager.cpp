@@ -712,6 +712,11 @@ PeerConnectionManager::GetVideoTrackSource(const std::string &window_uid) {
     }
 }
 
+bool PeerConnectionManager::HasVideoTrackSource(
+        const std::string &window_uid) {
+    return GetVideoTrackSource(window_uid) != nullptr;
+}
+
 void PeerConnectionManager::SendInitFramesToPeer(const std::string &peerid) {
     std::lock_guard<std::mutex> mutex_lock(window_uid_to_peerids_mutex_);
     const std::string window_uid = peerid_to_window_uid_.at(peerid);
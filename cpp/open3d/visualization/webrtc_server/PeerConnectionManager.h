@@ -402,6 +402,9 @@ public:
     void OnFrame(const std::string& window_uid,
                  const std::shared_ptr<core::Tensor>& im);
 
+    /// Returns true if a client is streaming the window.
+    bool HasVideoTrackSource(const std::string& window_uid);
+
 protected:
     rtc::scoped_refptr<BitmapTrackSourceInterface> GetVideoTrackSource(
             const std::string& window_uid);
@@ -150,6 +150,15 @@ WebRTCWindowSystem::WebRTCWindowSystem()
         OnFrame(GetWindowUID(window->GetOSWindow()), im);
     };
     SetOnWindowDraw(draw_callback);
+
+    // Only render windows that a client is streaming. SendInitFrames() redraws
+    // a window once a client connects to it.
+    auto wants_frames_callback = [this](const gui::Window *window) -> bool {
+        return impl_->peer_connection_manager_ &&
+               impl_->peer_connection_manager_->HasVideoTrackSource(
+                       GetWindowUID(window->GetOSWindow()));
+    };
+    SetOnWindowWantsFrames(wants_frames_callback);
 }
 
 WebRTCWindowSystem::~WebRTCWindowSystem() {
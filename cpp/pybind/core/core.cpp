@@ -49,6 +49,7 @@ void pybind_core(py::module& m) {
     pybind_core_kernel(m_core);
     pybind_core_hashmap(m_core);
     pybind_core_scalar(m_core);
+    pybind_core_profiler(m_core);
 
     // opn3d::core::nns namespace.
     nns::pybind_core_nns(m_core);
@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/core/CUDAUtils.h"
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "pybind/core/core.h"
 
 namespace open3d {
@@ -36,6 +37,40 @@ void pybind_cuda_utils(py::module &m) {
     m_cuda.def("device_count", core::cuda::DeviceCount);
     m_cuda.def("is_available", core::cuda::IsAvailable);
     m_cuda.def("release_cache", core::cuda::ReleaseCache);
+    m_cuda.def("set_memory_limit", core::cuda::SetMemoryLimit,
+               "Limits the memory reserved by the CUDA memory cache on the "
+               "device. 0 removes the limit.",
+               "device"_a, "byte_size"_a);
+    m_cuda.def("get_memory_limit", core::cuda::GetMemoryLimit,
+               "Returns the memory limit of the device, or 0 for no limit.",
+               "device"_a);
+    m_cuda.def(
+            "memory_stats",
+            [](const Device &device) {
+                const MemoryManagerStatistic::CacheStatistics statistics =
+                        MemoryManagerStatistic::GetInstance()
+                                .GetCacheStatistics(device);
+                py::dict result;
+                result["count_hit"] = statistics.count_hit_;
+                result["count_miss"] = statistics.count_miss_;
+                result["count_flush"] = statistics.count_flush_;
+                result["reserved_bytes"] = statistics.reserved_byte_size_;
+                // Caches that do not track reserved bytes report 0 in use.
+                result["in_use_bytes"] =
+                        statistics.reserved_byte_size_ >
+                                        statistics.cached_byte_size_
+                                ? statistics.reserved_byte_size_ -
+                                          statistics.cached_byte_size_
+                                : 0;
+                result["cached_bytes"] = statistics.cached_byte_size_;
+                result["largest_cached_block_bytes"] =
+                        statistics.largest_cached_block_size_;
+                result["fragmentation"] = statistics.Fragmentation();
+                return result;
+            },
+            "Returns the statistics of the memory cache of the device as a "
+            "dict.",
+            "device"_a);
 }
 
 }  // namespace core
@@ -25,8 +25,10 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/core/hashmap/HashMultimap.h"
 
 #include <pybind11/cast.h>
+#include <pybind11/functional.h>
 #include <pybind11/pytypes.h>
 
 #include "open3d/core/MemoryManager.h"
@@ -81,6 +83,12 @@ void pybind_core_hashmap(py::module& m) {
         return py::make_tuple(addrs, masks);
     });
 
+    hashmap.def("find_values", [](Hashmap& h, const Tensor& keys) {
+        Tensor values, masks;
+        h.FindValues(keys, values, masks);
+        return py::make_tuple(values, masks);
+    });
+
     hashmap.def("erase", [](Hashmap& h, const Tensor& keys) {
         Tensor masks;
         h.Erase(keys, masks);
@@ -93,6 +101,11 @@ void pybind_core_hashmap(py::module& m) {
         return addrs;
     });
 
+    hashmap.def("for_each_active_chunk", &Hashmap::ForEachActiveChunk,
+                "chunk_size"_a, "callback"_a,
+                "Call callback(addrs, keys, values) on the active entries in "
+                "chunks of at most chunk_size entries.");
+
     hashmap.def("get_key_buffer", &Hashmap::GetKeyBuffer);
     hashmap.def("get_value_buffer", &Hashmap::GetValueBuffer);
 
@@ -103,10 +116,64 @@ void pybind_core_hashmap(py::module& m) {
     hashmap.def("size", &Hashmap::Size);
     hashmap.def("capacity", &Hashmap::GetCapacity);
 
+    hashmap.def("save", &Hashmap::Save, "file_name"_a);
+    hashmap.def_static(
+            "load",
+            [](const std::string& file_name, const Device& device) {
+                return Hashmap::Load(file_name, device);
+            },
+            "file_name"_a, "device"_a = Device("CPU:0"));
+
     hashmap.def("to", &Hashmap::To, "device"_a, "copy"_a = false);
     hashmap.def("clone", &Hashmap::Clone);
     hashmap.def("cpu", &Hashmap::CPU);
     hashmap.def("cuda", &Hashmap::CUDA, "device_id"_a = 0);
+
+    py::class_<HashMultimap> multimap(
+            m, "HashMultimap",
+            "A HashMultimap is a map from key to a list of values wrapped by "
+            "Tensors.");
+
+    multimap.def(py::init([](int64_t init_capacity, const Dtype& dtype_key,
+                             const Dtype& dtype_value,
+                             const py::handle& element_shape_key,
+                             const py::handle& element_shape_value,
+                             const Device& device) {
+                     SizeVector element_shape_key_sv =
+                             PyHandleToSizeVector(element_shape_key);
+                     SizeVector element_shape_value_sv =
+                             PyHandleToSizeVector(element_shape_value);
+                     return HashMultimap(init_capacity, dtype_key, dtype_value,
+                                         element_shape_key_sv,
+                                         element_shape_value_sv, device);
+                 }),
+                 "init_capacity"_a, "dtype_key"_a, "dtype_value"_a,
+                 "element_shape_key"_a = SizeVector({1}),
+                 "element_shape_value"_a = SizeVector({1}),
+                 "device"_a = Device("CPU:0"));
+
+    multimap.def("insert", &HashMultimap::Insert, "keys"_a, "values"_a);
+
+    multimap.def(
+            "find",
+            [](HashMultimap& h, const Tensor& keys) {
+                Tensor offsets, values;
+                h.Find(keys, offsets, values);
+                return py::make_tuple(offsets, values);
+            },
+            "Returns (offsets, values): the values of keys[i] are "
+            "values[offsets[i]:offsets[i + 1]].",
+            "keys"_a);
+
+    multimap.def("erase", [](HashMultimap& h, const Tensor& keys) {
+        Tensor masks;
+        h.Erase(keys, masks);
+        return masks;
+    });
+
+    multimap.def("clear", &HashMultimap::Clear);
+    multimap.def("size", &HashMultimap::Size);
+    multimap.def("num_values", &HashMultimap::GetNumValues);
 }
 }  // namespace core
 }  // namespace open3d
@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/core/linalg/BatchedLinalg.h"
 #include "open3d/core/linalg/Det.h"
 #include "open3d/core/linalg/Inverse.h"
 #include "open3d/core/linalg/LU.h"
@@ -47,8 +48,9 @@ void pybind_core_linalg(py::module &m) {
                 Matmul(A, B, output);
                 return output;
             },
-            "Function to perform matrix multiplication of two 2D tensors with "
-            "compatible shapes.",
+            "Function to perform matrix multiplication of two tensors with "
+            "compatible shapes. Leading batch dimensions of tensors with more "
+            "than 2 dimensions are broadcasted.",
             "A"_a, "B"_a);
 
     m.def(
@@ -121,6 +123,39 @@ void pybind_core_linalg(py::module &m) {
             },
             "Function to decompose A with A = U S VT.", "A"_a);
 
+    m.def(
+            "batched_solve",
+            [](const Tensor &A, const Tensor &B) {
+                Tensor output;
+                BatchedSolve(A, B, output);
+                return output;
+            },
+            "Function to solve X_i for a batch of linear systems A_i X_i = B_i "
+            "where A has shape (batch, n, n).",
+            "A"_a, "B"_a);
+
+    m.def(
+            "batched_inv",
+            [](const Tensor &A) {
+                Tensor output;
+                BatchedInverse(A, output);
+                return output;
+            },
+            "Function to inverse a batch of square matrices of shape (batch, "
+            "n, n).",
+            "A"_a);
+
+    m.def(
+            "batched_svd",
+            [](const Tensor &A) {
+                Tensor U, S, VT;
+                BatchedSVD(A, U, S, VT);
+                return py::make_tuple(U, S, VT);
+            },
+            "Function to decompose a batch of square matrices with A_i = U_i "
+            "S_i VT_i.",
+            "A"_a);
+
     m.def(
             "triu",
             [](const Tensor &A, const int diagonal) {
@@ -27,6 +27,7 @@
 #include "pybind/core/nns/nearest_neighbor_search.h"
 
 #include "open3d/core/Tensor.h"
+#include "open3d/core/nns/BatchedNearestNeighborSearch.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
 #include "pybind/core/tensor_converter.h"
 #include "pybind/docstring.h"
@@ -50,6 +51,41 @@ void pybind_core_nns(py::module &m) {
                      "Maximum number of neighbors to search per query point."},
                     {"knn", "Number of neighbors to search per query point."}};
 
+    py::enum_<ApproximateKnnMethod>(m_nns, "ApproximateKnnMethod",
+                                    "Approximate knn index types.")
+            .value("HNSW", ApproximateKnnMethod::HNSW,
+                   "Built-in hierarchical navigable small world graph on CPU.")
+            .value("IVFPQ", ApproximateKnnMethod::IVFPQ,
+                   "Faiss inverted file with product quantization.")
+            .export_values();
+
+    py::class_<ApproximateKnnParams> approximate_knn_params(
+            m_nns, "ApproximateKnnParams",
+            "Parameters of an approximate knn index, trading recall for "
+            "speed.");
+    approximate_knn_params.def(py::init<>())
+            .def_readwrite("method", &ApproximateKnnParams::method,
+                           "Index type.")
+            .def_readwrite("hnsw_m", &ApproximateKnnParams::hnsw_m,
+                           "HNSW: number of graph neighbors per point.")
+            .def_readwrite("hnsw_ef_construction",
+                           &ApproximateKnnParams::hnsw_ef_construction,
+                           "HNSW: number of candidates kept while building.")
+            .def_readwrite("hnsw_ef_search",
+                           &ApproximateKnnParams::hnsw_ef_search,
+                           "HNSW: number of candidates kept while searching.")
+            .def_readwrite("ivf_nlist", &ApproximateKnnParams::ivf_nlist,
+                           "IVF-PQ: number of inverted lists, 0 for about "
+                           "4 * sqrt(n).")
+            .def_readwrite("ivf_nprobe", &ApproximateKnnParams::ivf_nprobe,
+                           "IVF-PQ: number of inverted lists visited per "
+                           "query.")
+            .def_readwrite("pq_m", &ApproximateKnnParams::pq_m,
+                           "IVF-PQ: number of sub-quantizers, 0 to choose "
+                           "from the dimension.")
+            .def_readwrite("pq_nbits", &ApproximateKnnParams::pq_nbits,
+                           "IVF-PQ: number of bits per sub-quantizer code.");
+
     py::class_<NearestNeighborSearch, std::shared_ptr<NearestNeighborSearch>>
             nns(m_nns, "NearestNeighborSearch",
                 "NearestNeighborSearch class for nearest neighbor search. "
@@ -60,8 +96,15 @@ void pybind_core_nns(py::module &m) {
     nns.def(py::init<const Tensor &>(), "dataset_points"_a);
 
     // Index functions.
+    // The index and search functions release the GIL while they run.
     nns.def("knn_index", &NearestNeighborSearch::KnnIndex,
+            py::call_guard<py::gil_scoped_release>(),
             "Set index for knn search.");
+    nns.def("approximate_knn_index",
+            &NearestNeighborSearch::ApproximateKnnIndex,
+            py::call_guard<py::gil_scoped_release>(),
+            "Set an approximate index for knn search.",
+            "params"_a = ApproximateKnnParams());
     nns.def(
             "fixed_radius_index",
             [](NearestNeighborSearch &self, utility::optional<double> radius) {
@@ -71,8 +114,10 @@ void pybind_core_nns(py::module &m) {
                     return self.FixedRadiusIndex(radius.value());
                 }
             },
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("radius") = py::none());
     nns.def("multi_radius_index", &NearestNeighborSearch::MultiRadiusIndex,
+            py::call_guard<py::gil_scoped_release>(),
             "Set index for multi-radius search.");
     nns.def(
             "hybrid_index",
@@ -83,10 +128,12 @@ void pybind_core_nns(py::module &m) {
                     return self.HybridIndex(radius.value());
                 }
             },
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("radius") = py::none());
 
     // Search functions.
-    nns.def("knn_search", &NearestNeighborSearch::KnnSearch, "query_points"_a,
+    nns.def("knn_search", &NearestNeighborSearch::KnnSearch,
+            py::call_guard<py::gil_scoped_release>(), "query_points"_a,
             "knn"_a, "Perform knn search.");
     nns.def(
             "fixed_radius_search",
@@ -99,15 +146,16 @@ void pybind_core_nns(py::module &m) {
                                                   sort.value());
                 }
             },
-            py::arg("query_points"), py::arg("radius"),
-            py::arg("sort") = py::none());
+            py::call_guard<py::gil_scoped_release>(), py::arg("query_points"),
+            py::arg("radius"), py::arg("sort") = py::none());
     nns.def("multi_radius_search", &NearestNeighborSearch::MultiRadiusSearch,
-            "query_points"_a, "radii"_a,
+            py::call_guard<py::gil_scoped_release>(), "query_points"_a,
+            "radii"_a,
             "Perform multi-radius search. Each query point has an independent "
             "radius.");
     nns.def("hybrid_search", &NearestNeighborSearch::HybridSearch,
-            "query_points"_a, "radius"_a, "max_knn"_a,
-            "Perform hybrid search.");
+            py::call_guard<py::gil_scoped_release>(), "query_points"_a,
+            "radius"_a, "max_knn"_a, "Perform hybrid search.");
 
     // Docstrings.
     docstring::ClassMethodDocInject(m_nns, "NearestNeighborSearch",
@@ -122,6 +170,42 @@ void pybind_core_nns(py::module &m) {
     docstring::ClassMethodDocInject(m_nns, "NearestNeighborSearch",
                                     "hybrid_search",
                                     map_nearest_neighbor_search_method_docs);
+
+    py::class_<BatchedNearestNeighborSearch,
+               std::shared_ptr<BatchedNearestNeighborSearch>>
+            batched_nns(m_nns, "BatchedNearestNeighborSearch",
+                        "Nearest neighbor search over a batch of point "
+                        "clouds, given as concatenated dataset_points of "
+                        "shape {n_dataset, d} and Int64 points_row_splits of "
+                        "shape {batch_size + 1,}. Each query cloud is "
+                        "searched against the dataset cloud with the same "
+                        "batch index.");
+    batched_nns.def(py::init<const Tensor &, const Tensor &>(),
+                    "dataset_points"_a, "points_row_splits"_a);
+    batched_nns.def("build_index", &BatchedNearestNeighborSearch::BuildIndex,
+                    py::call_guard<py::gil_scoped_release>(),
+                    "Build the index of each cloud.");
+    batched_nns.def("knn_search", &BatchedNearestNeighborSearch::KnnSearch,
+                    py::call_guard<py::gil_scoped_release>(),
+                    "query_points"_a, "queries_row_splits"_a, "knn"_a,
+                    "Perform knn search per cloud. Returns (indices, "
+                    "distances, neighbors_row_splits).");
+    batched_nns.def("fixed_radius_search",
+                    &BatchedNearestNeighborSearch::FixedRadiusSearch,
+                    py::call_guard<py::gil_scoped_release>(),
+                    "query_points"_a, "queries_row_splits"_a, "radius"_a,
+                    "sort"_a = true,
+                    "Perform fixed radius search per cloud. Returns "
+                    "(indices, distances, neighbors_row_splits).");
+    batched_nns.def("hybrid_search",
+                    &BatchedNearestNeighborSearch::HybridSearch,
+                    py::call_guard<py::gil_scoped_release>(),
+                    "query_points"_a, "queries_row_splits"_a, "radius"_a,
+                    "max_knn"_a,
+                    "Perform hybrid search per cloud. Returns (indices, "
+                    "distances, counts).");
+    batched_nns.def_property_readonly(
+            "batch_size", &BatchedNearestNeighborSearch::GetBatchSize);
 }
 
 }  // namespace nns
@@ -0,0 +1,74 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Profiler.h"
+
+#include "pybind/core/core.h"
+
+namespace open3d {
+namespace core {
+
+void pybind_core_profiler(py::module& m) {
+    py::module m_profiler = m.def_submodule(
+            "profiler",
+            "Per-op timing and memory profiling of Tensor operations. "
+            "Profiling can also be enabled by setting the OPEN3D_PROFILE or "
+            "OPEN3D_PROFILE_TRACE=<file> environment variables.");
+
+    m_profiler.def("is_enabled", &Profiler::IsEnabled,
+                   "Returns True if profiling is enabled.");
+    m_profiler.def("set_enabled", &Profiler::SetEnabled,
+                   "Enables or disables profiling.", "enabled"_a);
+    m_profiler.def(
+            "reset", []() { Profiler::GetInstance().Reset(); },
+            "Clears all recorded events and memory watermarks.");
+    m_profiler.def(
+            "set_max_num_events",
+            [](size_t max_num_events) {
+                Profiler::GetInstance().SetMaxNumEvents(max_num_events);
+            },
+            "Keeps only the latest max_num_events events in a ring buffer. 0 "
+            "keeps all events.",
+            "max_num_events"_a);
+    m_profiler.def(
+            "export_chrome_trace",
+            [](const std::string& file_name) {
+                Profiler::GetInstance().ExportChromeTrace(file_name);
+            },
+            "Writes all recorded events to a Chrome trace JSON file.",
+            "file_name"_a);
+    m_profiler.def(
+            "get_peak_byte_size",
+            [](const Device& device) {
+                return Profiler::GetInstance().GetPeakByteSize(device);
+            },
+            "Returns the peak number of bytes in use on the device since the "
+            "last reset.",
+            "device"_a);
+}
+
+}  // namespace core
+}  // namespace open3d
@@ -499,9 +499,9 @@ void pybind_core_tensor(py::module& m) {
         return core::PyArrayToTensor(np_array, true);
     });
 
-    tensor.def("to_dlpack", [](const Tensor& tensor) {
+    // See PyTorch's torch/csrc/Module.cpp
+    auto dlpack_capsule = [](const Tensor& tensor) {
         DLManagedTensor* dl_managed_tensor = tensor.ToDLPack();
-        // See PyTorch's torch/csrc/Module.cpp
         auto capsule_destructor = [](PyObject* data) {
             DLManagedTensor* dl_managed_tensor =
                     (DLManagedTensor*)PyCapsule_GetPointer(data, "dltensor");
@@ -517,9 +517,53 @@ void pybind_core_tensor(py::module& m) {
             }
         };
         return py::capsule(dl_managed_tensor, "dltensor", capsule_destructor);
+    };
+    tensor.def("to_dlpack", dlpack_capsule);
+
+    // DLPack protocol. The consumer passes the stream it will use the tensor
+    // on, which waits for the pending work on Open3D's current stream through
+    // a CUDA event instead of a device synchronization.
+    tensor.def(
+            "__dlpack__",
+            [dlpack_capsule](const Tensor& tensor, const py::object& stream) {
+                const Device& device = tensor.GetDevice();
+                if (device.GetType() == Device::DeviceType::CUDA) {
+                    // None means the legacy default stream.
+                    cuda::WaitForCurrentStream(
+                            device,
+                            stream.is_none() ? 1 : stream.cast<intptr_t>());
+                } else if (!stream.is_none()) {
+                    utility::LogError("stream must be None for {} tensors.",
+                                      device.ToString());
+                }
+                return dlpack_capsule(tensor);
+            },
+            "stream"_a = py::none());
+    tensor.def("__dlpack_device__", [](const Tensor& tensor) {
+        const Device& device = tensor.GetDevice();
+        int device_type = device.GetType() == Device::DeviceType::CUDA
+                                  ? DLDeviceType::kDLGPU
+                                  : DLDeviceType::kDLCPU;
+        return py::make_tuple(device_type, device.GetID());
     });
 
-    tensor.def_static("from_dlpack", [](py::capsule data) {
+    tensor.def_static("from_dlpack", [](py::object obj) {
+        py::capsule data;
+        if (py::hasattr(obj, "__dlpack__")) {
+            // Producers such as torch.Tensor synchronize their stream with
+            // the current Open3D stream of the calling thread.
+            py::tuple dl_device = obj.attr("__dlpack_device__")();
+            if (dl_device[0].cast<int>() == DLDeviceType::kDLGPU) {
+                Device device(Device::DeviceType::CUDA,
+                              dl_device[1].cast<int>());
+                data = obj.attr("__dlpack__")(
+                        "stream"_a = cuda::GetCurrentStreamHandle(device));
+            } else {
+                data = obj.attr("__dlpack__")();
+            }
+        } else {
+            data = obj.cast<py::capsule>();
+        }
         DLManagedTensor* dl_managed_tensor =
                 static_cast<DLManagedTensor*>(data);
         if (!dl_managed_tensor) {
@@ -539,8 +583,29 @@ void pybind_core_tensor(py::module& m) {
     // Numpy IO.
     tensor.def("save", &Tensor::Save, "Save tensor to Numpy's npy format.",
                "file_name"_a);
-    tensor.def_static("load", &Tensor::Load,
-                      "Load tensor from Numpy's npy format.", "file_name"_a);
+    tensor.def_static(
+            "load",
+            [](const std::string& file_name, const py::object& mmap_mode) {
+                Tensor::MmapMode mode = Tensor::MmapMode::None;
+                if (!mmap_mode.is_none()) {
+                    std::string mode_str = mmap_mode.cast<std::string>();
+                    if (mode_str == "r") {
+                        mode = Tensor::MmapMode::ReadOnly;
+                    } else if (mode_str == "c") {
+                        mode = Tensor::MmapMode::CopyOnWrite;
+                    } else {
+                        utility::LogError(
+                                "Invalid mmap_mode '{}', must be None, 'r' or "
+                                "'c'.",
+                                mode_str);
+                    }
+                }
+                return Tensor::Load(file_name, mode);
+            },
+            "Load tensor from Numpy's npy format. With mmap_mode='r' "
+            "(read-only) or 'c' (copy-on-write), the returned CPU tensor is "
+            "backed by the memory-mapped file.",
+            "file_name"_a, "mmap_mode"_a = py::none());
 
     /// Linalg operations.
     tensor.def("det", &Tensor::Det,
@@ -845,6 +910,76 @@ Ref:
               "original tensor. If ``as_tuple`` is False, Returns a vector of "
               "int64 Tensors, each containing the indices of the non-zero "
               "elements in each dimension."}});
+    tensor.def("sort", &Tensor::Sort,
+               "Returns the elements of a 1D tensor sorted in ascending "
+               "order.");
+    tensor.def("argsort", &Tensor::ArgSort,
+               "Returns the int64 indices that stably sort a 1D tensor in "
+               "ascending order.");
+    tensor.def(
+            "unique",
+            [](const Tensor& tensor, bool return_inverse,
+               bool return_counts) -> py::object {
+                Tensor unique, inverse, counts;
+                std::tie(unique, inverse, counts) =
+                        tensor.Unique(return_inverse, return_counts);
+                if (!return_inverse && !return_counts) {
+                    return py::cast(unique);
+                }
+                py::list results;
+                results.append(unique);
+                if (return_inverse) {
+                    results.append(inverse);
+                }
+                if (return_counts) {
+                    results.append(counts);
+                }
+                return py::tuple(results);
+            },
+            "Finds the sorted unique elements of a 1D tensor.",
+            "return_inverse"_a = false, "return_counts"_a = false);
+    docstring::ClassMethodDocInject(
+            m, "Tensor", "unique",
+            {{"return_inverse",
+              "If True, also returns the int64 indices into the unique "
+              "elements that reconstruct the tensor."},
+             {"return_counts",
+              "If True, also returns the int64 number of occurrences of each "
+              "unique element."}});
+    tensor.def("topk", &Tensor::TopK,
+               "Returns the k largest (or smallest) elements along a "
+               "dimension and their int64 indices, as a tuple (values, "
+               "indices).",
+               "k"_a, "dim"_a = -1, "largest"_a = true, "sorted"_a = true);
+    tensor.def("kthvalue", &Tensor::KthValue,
+               "Returns the k-th smallest element along a dimension and its "
+               "int64 index, as a tuple (values, indices).",
+               "k"_a, "dim"_a = -1, "keepdim"_a = false);
+    tensor.def("quantile", &Tensor::Quantile,
+               "Returns the q-th quantile along a dimension, interpolated "
+               "linearly between the two nearest elements.",
+               "q"_a, "dim"_a = -1, "keepdim"_a = false);
+    tensor.def("segment_sum", &Tensor::SegmentSum,
+               "Sums the rows of the tensor per segment, given sorted int64 "
+               "segment ids in [0, num_segments).",
+               "segment_ids"_a, "num_segments"_a);
+    tensor.def("segment_mean", &Tensor::SegmentMean,
+               "Averages the rows of the tensor per segment, given sorted "
+               "int64 segment ids in [0, num_segments).",
+               "segment_ids"_a, "num_segments"_a);
+    tensor.def("segment_max", &Tensor::SegmentMax,
+               "Takes the element-wise maximum of the rows of the tensor per "
+               "segment, given sorted int64 segment ids in [0, num_segments).",
+               "segment_ids"_a, "num_segments"_a);
+    tensor.def("segment_first", &Tensor::SegmentFirst,
+               "Takes the first row of the tensor per segment, given sorted "
+               "int64 segment ids in [0, num_segments).",
+               "segment_ids"_a, "num_segments"_a);
+    tensor.def("cumsum", &Tensor::CumSum,
+               "Returns the cumulative sum along dim. Boolean and integer "
+               "tensors are summed in int64. If exclusive is True, element i "
+               "excludes the i-th input element.",
+               "dim"_a, "exclusive"_a = false);
     tensor.def(
             "all", &Tensor::All,
             "Returns true if all elements in the tensor are true. Only works "
@@ -859,6 +994,7 @@ Ref:
     // Reduction ops.
     BIND_REDUCTION_OP(sum, Sum);
     BIND_REDUCTION_OP(mean, Mean);
+    BIND_REDUCTION_OP(mean_variance, MeanVariance);
     BIND_REDUCTION_OP(prod, Prod);
     BIND_REDUCTION_OP(min, Min);
     BIND_REDUCTION_OP(max, Max);
@@ -929,6 +1065,12 @@ Returns:
                     return py::float_(tensor.Item<float>());
                 if (dtype == Dtype::Float64)
                     return py::float_(tensor.Item<double>());
+                if (dtype == Dtype::Float16)
+                    return py::float_(
+                            static_cast<float>(tensor.Item<float16_t>()));
+                if (dtype == Dtype::BFloat16)
+                    return py::float_(
+                            static_cast<float>(tensor.Item<bfloat16_t>()));
                 if (dtype == Dtype::Int8)
                     return py::int_(tensor.Item<int8_t>());
                 if (dtype == Dtype::Int16)
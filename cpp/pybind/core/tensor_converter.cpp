@@ -125,10 +125,13 @@ Tensor PyArrayToTensor(py::array array, bool inplace) {
     Dtype dtype = pybind_utils::ArrayFormatToDtype(info.format, info.itemsize);
     Device device("CPU:0");
 
-    array.inc_ref();
-    std::function<void(void*)> deleter = [array](void*) -> void {
+    // Capture a plain handle rather than the py::array: the deleter may run on
+    // a thread without the GIL (e.g. inside a binding that released it), and
+    // destroying a captured py::array there would decref without the GIL.
+    py::handle array_handle = array.inc_ref();
+    std::function<void(void*)> deleter = [array_handle](void*) -> void {
         py::gil_scoped_acquire acquire;
-        array.dec_ref();
+        array_handle.dec_ref();
     };
     auto blob = std::make_shared<Blob>(device, info.ptr, deleter);
     Tensor t_inplace(shape, strides, info.ptr, dtype, blob);
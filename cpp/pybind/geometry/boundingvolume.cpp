@@ -75,6 +75,12 @@ void pybind_boundingvolume(py::module &m) {
                     &OrientedBoundingBox::CreateFromPoints,
                     "Creates the bounding box that encloses the set of points.",
                     "points"_a)
+            .def_static("create_from_point_sets",
+                        &OrientedBoundingBox::CreateFromPointSets,
+                        py::call_guard<py::gil_scoped_release>(),
+                        "Creates the bounding boxes of many sets of points in "
+                        "parallel.",
+                        "points"_a, "offsets"_a, "use_convex_hull"_a = true)
             .def("volume", &OrientedBoundingBox::Volume,
                  "Returns the volume of the bounding box.")
             .def("get_box_points", &OrientedBoundingBox::GetBoxPoints,
@@ -100,6 +106,16 @@ void pybind_boundingvolume(py::module &m) {
     docstring::ClassMethodDocInject(m, "OrientedBoundingBox",
                                     "create_from_points",
                                     {{"points", "A list of points."}});
+    docstring::ClassMethodDocInject(
+            m, "OrientedBoundingBox", "create_from_point_sets",
+            {{"points", "The points of all sets."},
+             {"offsets",
+              "The start of each set in points, followed by the number of "
+              "points."},
+             {"use_convex_hull",
+              "If true, the boxes are computed from the convex hulls like "
+              "create_from_points. If false, the boxes are aligned with the "
+              "principal axes of all points of each set, which is faster."}});
 
     py::class_<AxisAlignedBoundingBox, PyGeometry3D<AxisAlignedBoundingBox>,
                std::shared_ptr<AxisAlignedBoundingBox>, Geometry3D>
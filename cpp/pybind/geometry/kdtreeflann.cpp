@@ -25,6 +25,8 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/NeighborCache.h"
+#include "open3d/geometry/PointCloud.h"
 
 #include "pybind/docstring.h"
 #include "pybind/geometry/geometry.h"
@@ -115,7 +117,11 @@ void pybind_kdtreeflann(py::module &m) {
                      "At maximum, ``max_nn`` neighbors will be searched."},
                     {"knn", "``knn`` neighbors will be searched."},
                     {"feature", "Feature data."},
-                    {"data", "Matrix data."}};
+                    {"data", "Matrix data."},
+                    {"file_name", "Path to the file."},
+                    {"memory_map",
+                     "If ``True``, the data is backed by the read-only "
+                     "memory-mapped file, shared between processes."}};
     py::class_<KDTreeFlann, std::shared_ptr<KDTreeFlann>> kdtreeflann(
             m, "KDTreeFlann", "KDTree with FLANN for nearest neighbor search.");
     kdtreeflann.def(py::init<>())
@@ -130,6 +136,11 @@ void pybind_kdtreeflann(py::module &m) {
             .def("set_feature", &KDTreeFlann::SetFeature,
                  "Sets the data for the KDTree from the feature data.",
                  "feature"_a)
+            .def("save", &KDTreeFlann::Save,
+                 "Saves the data and the built tree to a file.", "file_name"_a)
+            .def("load", &KDTreeFlann::Load,
+                 "Loads a KDTree saved by save() without rebuilding it.",
+                 "file_name"_a, "memory_map"_a = true)
             // Although these C++ style functions are fast by orders of
             // magnitudes when similar queries are performed for a large number
             // of times and memory management is involved, we prefer not to
@@ -257,6 +268,10 @@ void pybind_kdtreeflann(py::module &m) {
                     "query"_a, "radius"_a, "max_nn"_a);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "search_hybrid_vector_3d",
                                     map_kd_tree_flann_method_docs);
+    docstring::ClassMethodDocInject(m, "KDTreeFlann", "load",
+                                    map_kd_tree_flann_method_docs);
+    docstring::ClassMethodDocInject(m, "KDTreeFlann", "save",
+                                    map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "search_hybrid_vector_xd",
                                     map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "search_knn_vector_3d",
@@ -277,6 +292,38 @@ void pybind_kdtreeflann(py::module &m) {
                                     map_kd_tree_flann_method_docs);
     docstring::ClassMethodDocInject(m, "KDTreeFlann", "set_matrix_data",
                                     map_kd_tree_flann_method_docs);
+
+    // open3d.geometry.NeighborCache
+    py::class_<NeighborCache, std::shared_ptr<NeighborCache>> neighbor_cache(
+            m, "NeighborCache",
+            "Neighbors of every point of a point cloud, searched once and "
+            "shared by normal estimation, ISS keypoints and FPFH features.");
+    neighbor_cache.def(py::init<>())
+            .def(py::init<const PointCloud &, const KDTreeSearchParam &>(),
+                 "pcd"_a, "search_param"_a)
+            .def("__repr__",
+                 [](const NeighborCache &cache) {
+                     return std::string("NeighborCache with ") +
+                            std::to_string(cache.NumQueries()) +
+                            " queries and " +
+                            std::to_string(cache.indices_.size()) +
+                            " neighbors.";
+                 })
+            .def("num_queries", &NeighborCache::NumQueries,
+                 "Returns the number of query points.")
+            .def("covers", &NeighborCache::Covers,
+                 "Returns True if the search can be answered from the cached "
+                 "neighbors.",
+                 "search_param"_a)
+            .def_readonly("offsets", &NeighborCache::offsets_,
+                          "Offsets of the neighbor lists of the queries.")
+            .def_readonly("indices", &NeighborCache::indices_,
+                          "Concatenated neighbor indices of all queries.")
+            .def_readonly("distance2", &NeighborCache::distance2_,
+                          "Squared distances of the neighbors.");
+    docstring::ClassMethodDocInject(
+            m, "NeighborCache", "covers",
+            {{"search_param", "KDTree search parameters."}});
 }
 
 }  // namespace geometry
@@ -30,6 +30,7 @@
 
 #include "open3d/geometry/Keypoint.h"
 
+#include "open3d/geometry/NeighborCache.h"
 #include "open3d/geometry/PointCloud.h"
 #include "pybind/docstring.h"
 #include "pybind/geometry/geometry.h"
@@ -39,17 +40,31 @@ namespace open3d {
 namespace geometry {
 
 void pybind_keypoint_methods(py::module &m) {
-    m.def("compute_iss_keypoints", &keypoint::ComputeISSKeypoints,
+    m.def("compute_iss_keypoints",
+          py::overload_cast<const PointCloud &, double, double, double,
+                            double, int>(&keypoint::ComputeISSKeypoints),
           "Function that computes the ISS keypoints from an input point "
           "cloud. This implements the keypoint detection modules "
           "proposed in Yu Zhong, 'Intrinsic Shape Signatures: A Shape "
           "Descriptor for 3D Object Recognition', 2009.",
           "input"_a, "salient_radius"_a = 0.0, "non_max_radius"_a = 0.0,
           "gamma_21"_a = 0.975, "gamma_32"_a = 0.975, "min_neighbors"_a = 5);
+    m.def("compute_iss_keypoints",
+          py::overload_cast<const PointCloud &, const NeighborCache &, double,
+                            double, double, double, int>(
+                  &keypoint::ComputeISSKeypoints),
+          "Function that computes the ISS keypoints from an input point "
+          "cloud and precomputed neighbors.",
+          "input"_a, "neighbor_cache"_a, "salient_radius"_a,
+          "non_max_radius"_a, "gamma_21"_a = 0.975, "gamma_32"_a = 0.975,
+          "min_neighbors"_a = 5);
 
     docstring::FunctionDocInject(
             m, "compute_iss_keypoints",
             {{"input", "The Input point cloud."},
+             {"neighbor_cache",
+              "Neighbors of every point of the input covering radius "
+              "searches with ``salient_radius`` and ``non_max_radius``."},
              {"salient_radius",
               "The radius of the spherical neighborhood used to detect "
               "keypoints."},
@@ -29,6 +29,7 @@
 #include <sstream>
 #include <unordered_map>
 
+#include "open3d/geometry/LinearOctree.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/VoxelGrid.h"
 #include "pybind/docstring.h"
@@ -361,6 +362,86 @@ void pybind_octree(py::module &m) {
     docstring::ClassMethodDocInject(
             m, "Octree", "create_from_voxel_grid",
             {{"voxel_grid", "geometry.VoxelGrid: The source voxel grid."}});
+
+    // LinearOctree
+    py::class_<LinearOctree> linear_octree(
+            m, "LinearOctree",
+            "Pointer-free octree stored as flat arrays sorted by Morton code, "
+            "built in parallel from a point cloud.");
+    py::detail::bind_copy_functions<LinearOctree>(linear_octree);
+    linear_octree
+            .def(py::init<size_t>(), "max_depth"_a = 0)
+            .def(py::init<size_t, const Eigen::Vector3d &, double>(),
+                 "max_depth"_a, "origin"_a, "size"_a)
+            .def("__repr__",
+                 [](const LinearOctree &octree) {
+                     std::ostringstream repr;
+                     repr << "LinearOctree with ";
+                     repr << "origin: [" << octree.origin_(0) << ", "
+                          << octree.origin_(1) << ", " << octree.origin_(2)
+                          << "]";
+                     repr << ", size: " << octree.size_;
+                     repr << ", max_depth: " << octree.max_depth_;
+                     repr << ", leaf nodes: " << octree.GetNumLeafNodes();
+                     return repr.str();
+                 })
+            .def("clear", &LinearOctree::Clear, "Clear all nodes.")
+            .def("is_empty", &LinearOctree::IsEmpty,
+                 "Returns True if the octree has no node.")
+            .def("convert_from_point_cloud",
+                 &LinearOctree::ConvertFromPointCloud, "point_cloud"_a,
+                 "size_expand"_a = 0.01, "Convert octree from point cloud.")
+            .def("traverse", &LinearOctree::Traverse, "f"_a,
+                 "DFS traversal of the octree from the root, with a callback "
+                 "function f(node_info, node_index, point_begin, point_end) "
+                 "being called for each node. If f returns True, children of "
+                 "the node are not traversed.")
+            .def("locate_leaf_node", &LinearOctree::LocateLeafNode, "point"_a,
+                 "Returns the index of the leaf node where the query point "
+                 "resides, or -1 if there is none.")
+            .def("get_leaf_node_info", &LinearOctree::GetLeafNodeInfo,
+                 "leaf_index"_a, "Returns the OctreeNodeInfo of a leaf node.")
+            .def("get_leaf_point_range", &LinearOctree::GetLeafPointRange,
+                 "leaf_index"_a,
+                 "Returns the range [begin, end) into point_indices of the "
+                 "points contained in a leaf node.")
+            .def("get_num_nodes", &LinearOctree::GetNumNodes, "depth"_a,
+                 "Returns the number of non-empty nodes at a depth.")
+            .def("get_num_leaf_nodes", &LinearOctree::GetNumLeafNodes,
+                 "Returns the number of non-empty leaf nodes.")
+            .def("to_voxel_grid", &LinearOctree::ToVoxelGrid,
+                 "Convert to VoxelGrid.")
+            .def("to_octree", &LinearOctree::ToOctree, "Convert to Octree.")
+            .def_property_readonly("point_indices",
+                                   &LinearOctree::GetPointIndices,
+                                   "List of int: Point indices, grouped by "
+                                   "leaf node in DFS order.")
+            .def_property_readonly("leaf_colors",
+                                   &LinearOctree::GetLeafColors,
+                                   "List of (3, 1) float numpy array: Colors "
+                                   "of the leaf nodes.")
+            .def_readwrite("origin", &LinearOctree::origin_,
+                           "(3, 1) float numpy array: Global min bound "
+                           "(include). A point is within bound iff origin <= "
+                           "point < origin + size.")
+            .def_readwrite("size", &LinearOctree::size_,
+                           "float: Outer bounding box edge size for the whole "
+                           "octree.")
+            .def_readwrite("max_depth", &LinearOctree::max_depth_,
+                           "int: Maximum depth of the octree.");
+
+    docstring::ClassMethodDocInject(m, "LinearOctree", "__init__");
+    docstring::ClassMethodDocInject(m, "LinearOctree",
+                                    "convert_from_point_cloud",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(m, "LinearOctree", "locate_leaf_node",
+                                    map_octree_argument_docstrings);
+    docstring::ClassMethodDocInject(
+            m, "LinearOctree", "get_leaf_node_info",
+            {{"leaf_index", "Index of the leaf node."}});
+    docstring::ClassMethodDocInject(
+            m, "LinearOctree", "get_leaf_point_range",
+            {{"leaf_index", "Index of the leaf node."}});
 }
 
 void pybind_octree_methods(py::module &m) {}
@@ -30,6 +30,7 @@
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/geometry/Image.h"
+#include "open3d/geometry/NeighborCache.h"
 #include "open3d/geometry/RGBDImage.h"
 #include "pybind/docstring.h"
 #include "pybind/geometry/geometry.h"
@@ -73,12 +74,14 @@ void pybind_pointcloud(py::module &m) {
                  "pointcloud.",
                  "indices"_a, "invert"_a = false)
             .def("voxel_down_sample", &PointCloud::VoxelDownSample,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to downsample input pointcloud into output "
                  "pointcloud with "
                  "a voxel. Normals and colors are averaged if they exist.",
                  "voxel_size"_a)
             .def("voxel_down_sample_and_trace",
                  &PointCloud::VoxelDownSampleAndTrace,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to downsample using "
                  "PointCloud::VoxelDownSample. Also records point "
                  "cloud index before downsampling",
@@ -113,20 +116,34 @@ void pybind_pointcloud(py::module &m) {
                  "Function to remove non-finite points from the PointCloud",
                  "remove_nan"_a = true, "remove_infinite"_a = true)
             .def("remove_radius_outlier", &PointCloud::RemoveRadiusOutliers,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to remove points that have less than nb_points"
                  " in a given sphere of a given radius",
                  "nb_points"_a, "radius"_a)
             .def("remove_statistical_outlier",
                  &PointCloud::RemoveStatisticalOutliers,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to remove points that are further away from their "
                  "neighbors in average",
                  "nb_neighbors"_a, "std_ratio"_a)
-            .def("estimate_normals", &PointCloud::EstimateNormals,
+            .def("estimate_normals",
+                 py::overload_cast<const KDTreeSearchParam &, bool>(
+                         &PointCloud::EstimateNormals),
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to compute the normals of a point cloud. Normals "
                  "are oriented with respect to the input point cloud if "
                  "normals exist",
                  "search_param"_a = KDTreeSearchParamKNN(),
                  "fast_normal_computation"_a = true)
+            .def("estimate_normals",
+                 py::overload_cast<const NeighborCache &,
+                                   const KDTreeSearchParam &, bool>(
+                         &PointCloud::EstimateNormals),
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Function to compute the normals of a point cloud from "
+                 "precomputed neighbors.",
+                 "neighbor_cache"_a, "search_param"_a,
+                 "fast_normal_computation"_a = true)
             .def("orient_normals_to_align_with_direction",
                  &PointCloud::OrientNormalsToAlignWithDirection,
                  "Function to orient the normals of a point cloud",
@@ -137,11 +154,13 @@ void pybind_pointcloud(py::module &m) {
                  "camera_location"_a = Eigen::Vector3d(0.0, 0.0, 0.0))
             .def("orient_normals_consistent_tangent_plane",
                  &PointCloud::OrientNormalsConsistentTangentPlane,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to orient the normals with respect to consistent "
                  "tangent planes",
                  "k"_a)
             .def("compute_point_cloud_distance",
                  &PointCloud::ComputePointCloudDistance,
+                 py::call_guard<py::gil_scoped_release>(),
                  "For each point in the source point cloud, compute the "
                  "distance to the target point cloud.",
                  "target"_a)
@@ -151,16 +170,20 @@ void pybind_pointcloud(py::module &m) {
                  "point cloud.")
             .def("compute_mahalanobis_distance",
                  &PointCloud::ComputeMahalanobisDistance,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to compute the Mahalanobis distance for points in a "
                  "point cloud. See: "
                  "https://en.wikipedia.org/wiki/Mahalanobis_distance.")
             .def("compute_nearest_neighbor_distance",
                  &PointCloud::ComputeNearestNeighborDistance,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to compute the distance from a point to its nearest "
                  "neighbor in the point cloud")
             .def("compute_convex_hull", &PointCloud::ComputeConvexHull,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Computes the convex hull of the point cloud.")
             .def("hidden_point_removal", &PointCloud::HiddenPointRemoval,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Removes hidden points from a point cloud and returns a mesh "
                  "of the remaining points. Based on Katz et al. 'Direct "
                  "Visibility of Point Sets', 2007. Additional information "
@@ -169,18 +192,30 @@ void pybind_pointcloud(py::module &m) {
                  "Data', 2010.",
                  "camera_location"_a, "radius"_a)
             .def("cluster_dbscan", &PointCloud::ClusterDBSCAN,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Cluster PointCloud using the DBSCAN algorithm  Ester et al., "
                  "'A Density-Based Algorithm for Discovering Clusters in Large "
                  "Spatial Databases with Noise', 1996. Returns a list of point "
                  "labels, -1 indicates noise according to the algorithm.",
                  "eps"_a, "min_points"_a, "print_progress"_a = false)
             .def("segment_plane", &PointCloud::SegmentPlane,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Segments a plane in the point cloud using the RANSAC "
                  "algorithm.",
-                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a)
+                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
+                 "probability"_a = 0.99999999)
+            .def("segment_planes", &PointCloud::SegmentPlanes,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Segments several planes in the point cloud by repeating the "
+                 "RANSAC plane segmentation on the remaining points. Returns "
+                 "a list of (plane_model, inliers) tuples.",
+                 "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
+                 "num_iterations"_a = 100, "max_num_planes"_a = 1,
+                 "min_num_inliers"_a = 3, "probability"_a = 0.99999999)
             .def_static(
                     "create_from_depth_image",
                     &PointCloud::CreateFromDepthImage,
+                    py::call_guard<py::gil_scoped_release>(),
                     R"(Factory function to create a pointcloud from a depth image and a
 camera. Given depth value d at (u, v) image coordinate, the corresponding 3d point is:
 
@@ -193,6 +228,7 @@ camera. Given depth value d at (u, v) image coordinate, the corresponding 3d poi
                     "stride"_a = 1, "project_valid_depth_only"_a = true)
             .def_static(
                     "create_from_rgbd_image", &PointCloud::CreateFromRGBDImage,
+                    py::call_guard<py::gil_scoped_release>(),
                     "Factory function to create a pointcloud from an RGB-D "
                     "image and a camera. Given depth value d at (u, "
                     "v) image coordinate, the corresponding 3d point is:\n\n"
@@ -263,7 +299,9 @@ camera. Given depth value d at (u, v) image coordinate, the corresponding 3d poi
              {"std_ratio", "Standard deviation ratio."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "estimate_normals",
-            {{"search_param",
+            {{"neighbor_cache",
+              "Neighbors of every point covering ``search_param``."},
+             {"search_param",
               "The KDTree search parameters for neighborhood search."},
              {"fast_normal_computation",
               "If true, the normal estiamtion uses a non-iterative method to "
@@ -314,7 +352,25 @@ camera. Given depth value d at (u, v) image coordinate, the corresponding 3d poi
              {"ransac_n",
               "Number of initial points to be considered inliers in each "
               "iteration."},
-             {"num_iterations", "Number of iterations."}});
+             {"num_iterations", "Maximum number of iterations."},
+             {"probability",
+              "Expected probability of finding the optimal plane. The "
+              "iterations stop early once enough hypotheses have been "
+              "sampled for the inlier ratio of the best plane so far."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "segment_planes",
+            {{"distance_threshold",
+              "Max distance a point can be from a plane model, and still be "
+              "considered an inlier."},
+             {"ransac_n",
+              "Number of initial points to be considered inliers in each "
+              "iteration."},
+             {"num_iterations", "Maximum number of iterations per plane."},
+             {"max_num_planes", "Maximum number of planes to segment."},
+             {"min_num_inliers",
+              "Segmentation stops when a plane would have fewer inliers."},
+             {"probability",
+              "Expected probability of finding the optimal plane."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "create_from_depth_image",
             {{"depth",
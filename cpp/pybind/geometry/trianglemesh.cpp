@@ -26,6 +26,7 @@
 
 #include "open3d/geometry/TriangleMesh.h"
 
+#include "open3d/geometry/AsRigidAsPossibleDeformation.h"
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/PointCloud.h"
 #include "pybind/docstring.h"
@@ -76,6 +77,7 @@ void pybind_trianglemesh(py::module &m) {
                  "rendering",
                  "normalized"_a = true)
             .def("compute_vertex_normals", &TriangleMesh::ComputeVertexNormals,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to compute vertex normals, usually called before "
                  "rendering",
                  "normalized"_a = true)
@@ -84,6 +86,7 @@ void pybind_trianglemesh(py::module &m) {
                  "list is needed")
             .def("remove_duplicated_vertices",
                  &TriangleMesh::RemoveDuplicatedVertices,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that removes duplicated verties, i.e., vertices "
                  "that have identical coordinates.")
             .def("remove_duplicated_triangles",
@@ -108,6 +111,7 @@ void pybind_trianglemesh(py::module &m) {
                  "area adjacent to the non-manifold edge until the number of "
                  "adjacent triangles to the edge is `<= 2`.")
             .def("merge_close_vertices", &TriangleMesh::MergeCloseVertices,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that will merge close by vertices to a single one. "
                  "The vertex position, "
                  "normal and color will be the average of the vertices. The "
@@ -117,6 +121,7 @@ void pybind_trianglemesh(py::module &m) {
                  "close triangle soups.",
                  "eps"_a)
             .def("filter_sharpen", &TriangleMesh::FilterSharpen,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to sharpen triangle mesh. The output value "
                  "(:math:`v_o`) is the input value (:math:`v_i`) plus strength "
                  "times the input value minus he sum of he adjacent values. "
@@ -125,6 +130,7 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_iterations"_a = 1, "strength"_a = 1,
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_simple", &TriangleMesh::FilterSmoothSimple,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh with simple neighbour "
                  "average. :math:`v_o = \\frac{v_i + \\sum_{n \\in N} "
                  "v_n)}{|N| + 1}`, with :math:`v_i` being the input value, "
@@ -134,6 +140,7 @@ void pybind_trianglemesh(py::module &m) {
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_laplacian",
                  &TriangleMesh::FilterSmoothLaplacian,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh using Laplacian. :math:`v_o "
                  "= v_i \\cdot \\lambda (sum_{n \\in N} w_n v_n - v_i)`, with "
                  ":math:`v_i` being the input value, :math:`v_o` the output "
@@ -144,6 +151,7 @@ void pybind_trianglemesh(py::module &m) {
                  "number_of_iterations"_a = 1, "lambda"_a = 0.5,
                  "filter_scope"_a = MeshBase::FilterScope::All)
             .def("filter_smooth_taubin", &TriangleMesh::FilterSmoothTaubin,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to smooth triangle mesh using method of Taubin, "
                  "\"Curve and Surface Smoothing Without Shrinkage\", 1995. "
                  "Applies in each iteration two times filter_smooth_laplacian, "
@@ -193,9 +201,11 @@ void pybind_trianglemesh(py::module &m) {
             .def("is_vertex_manifold", &TriangleMesh::IsVertexManifold,
                  "Tests if all vertices of the triangle mesh are manifold.")
             .def("is_self_intersecting", &TriangleMesh::IsSelfIntersecting,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Tests if the triangle mesh is self-intersecting.")
             .def("get_self_intersecting_triangles",
                  &TriangleMesh::GetSelfIntersectingTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Returns a list of indices to triangles that intersect the "
                  "mesh.")
             .def("is_intersecting", &TriangleMesh::IsIntersecting,
@@ -204,8 +214,10 @@ void pybind_trianglemesh(py::module &m) {
             .def("is_orientable", &TriangleMesh::IsOrientable,
                  "Tests if the triangle mesh is orientable.")
             .def("is_watertight", &TriangleMesh::IsWatertight,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Tests if the triangle mesh is watertight.")
             .def("orient_triangles", &TriangleMesh::OrientTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
                  "If the mesh is orientable this function orients all "
                  "triangles such that all normals point towards the same "
                  "direction.")
@@ -238,11 +250,13 @@ void pybind_trianglemesh(py::module &m) {
                  "condition that it is watertight and orientable.")
             .def("sample_points_uniformly",
                  &TriangleMesh::SamplePointsUniformly,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to uniformly sample points from the mesh.",
                  "number_of_points"_a = 100, "use_triangle_normal"_a = false,
                  "seed"_a = -1)
             .def("sample_points_poisson_disk",
                  &TriangleMesh::SamplePointsPoissonDisk,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to sample points from the mesh, where each point "
                  "has "
                  "approximately the same distance to the neighbouring points "
@@ -251,31 +265,54 @@ void pybind_trianglemesh(py::module &m) {
                  "Generating Poisson Disk Sample Sets\", EUROGRAPHICS, 2015.",
                  "number_of_points"_a, "init_factor"_a = 5, "pcl"_a = nullptr,
                  "use_triangle_normal"_a = false, "seed"_a = -1)
+            .def("sample_points_poisson_disk_parallel",
+                 &TriangleMesh::SamplePointsPoissonDiskParallel,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Function to sample points from the mesh like "
+                 "sample_points_poisson_disk, eliminating samples of "
+                 "distant grid cells in parallel.",
+                 "number_of_points"_a, "init_factor"_a = 5, "pcl"_a = nullptr,
+                 "use_triangle_normal"_a = false, "seed"_a = -1)
             .def("subdivide_midpoint", &TriangleMesh::SubdivideMidpoint,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function subdivide mesh using midpoint algorithm.",
                  "number_of_iterations"_a = 1)
             .def("subdivide_loop", &TriangleMesh::SubdivideLoop,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function subdivide mesh using Loop's algorithm. Loop, "
                  "\"Smooth "
                  "subdivision surfaces based on triangles\", 1987.",
                  "number_of_iterations"_a = 1)
             .def("simplify_vertex_clustering",
                  &TriangleMesh::SimplifyVertexClustering,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to simplify mesh using vertex clustering.",
                  "voxel_size"_a,
                  "contraction"_a = MeshBase::SimplificationContraction::Average)
             .def("simplify_quadric_decimation",
                  &TriangleMesh::SimplifyQuadricDecimation,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to simplify mesh using Quadric Error Metric "
                  "Decimation by "
                  "Garland and Heckbert",
                  "target_number_of_triangles"_a,
                  "maximum_error"_a = std::numeric_limits<double>::infinity(),
                  "boundary_weight"_a = 1.0)
+            .def("simplify_quadric_decimation_parallel",
+                 &TriangleMesh::SimplifyQuadricDecimationParallel,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Function to simplify mesh using Quadric Error Metric "
+                 "Decimation in parallel, collapsing an independent set of "
+                 "edges per round",
+                 "target_number_of_triangles"_a,
+                 "maximum_error"_a = std::numeric_limits<double>::infinity(),
+                 "boundary_weight"_a = 1.0)
             .def("compute_convex_hull", &TriangleMesh::ComputeConvexHull,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Computes the convex hull of the triangle mesh.")
             .def("cluster_connected_triangles",
                  &TriangleMesh::ClusterConnectedTriangles,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function that clusters connected triangles, i.e., triangles "
                  "that are connected via edges are assigned the same cluster "
                  "index.  This function returns an array that contains the "
@@ -307,6 +344,7 @@ void pybind_trianglemesh(py::module &m) {
                  "vertex_mask"_a)
             .def("deform_as_rigid_as_possible",
                  &TriangleMesh::DeformAsRigidAsPossible,
+                 py::call_guard<py::gil_scoped_release>(),
                  "This function deforms the mesh using the method by Sorkine "
                  "and Alexa, "
                  "'As-Rigid-As-Possible Surface Modeling', 2007",
@@ -320,6 +358,7 @@ void pybind_trianglemesh(py::module &m) {
                         return TriangleMesh::CreateFromPointCloudAlphaShape(
                                 pcd, alpha);
                     },
+                    py::call_guard<py::gil_scoped_release>(),
                     "Alpha shapes are a generalization of the convex hull. "
                     "With decreasing alpha value the shape schrinks and "
                     "creates cavities. See Edelsbrunner and Muecke, "
@@ -327,6 +366,7 @@ void pybind_trianglemesh(py::module &m) {
                     "pcd"_a, "alpha"_a)
             .def_static("create_from_point_cloud_alpha_shape",
                         &TriangleMesh::CreateFromPointCloudAlphaShape,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Alpha shapes are a generalization of the convex hull. "
                         "With decreasing alpha value the shape shrinks and "
                         "creates cavities. See Edelsbrunner and Muecke, "
@@ -335,6 +375,7 @@ void pybind_trianglemesh(py::module &m) {
             .def_static(
                     "create_from_point_cloud_ball_pivoting",
                     &TriangleMesh::CreateFromPointCloudBallPivoting,
+                    py::call_guard<py::gil_scoped_release>(),
                     "Function that computes a triangle mesh from a oriented "
                     "PointCloud. This implements the Ball Pivoting algorithm "
                     "proposed in F. Bernardini et al., \"The ball-pivoting "
@@ -348,6 +389,7 @@ void pybind_trianglemesh(py::module &m) {
                     "pcd"_a, "radii"_a)
             .def_static("create_from_point_cloud_poisson",
                         &TriangleMesh::CreateFromPointCloudPoisson,
+                        py::call_guard<py::gil_scoped_release>(),
                         "Function that computes a triangle mesh from a "
                         "oriented PointCloud pcd. This implements the Screened "
                         "Poisson Reconstruction proposed in Kazhdan and Hoppe, "
@@ -356,6 +398,16 @@ void pybind_trianglemesh(py::module &m) {
                         "Kazhdan. See https://github.com/mkazhdan/PoissonRecon",
                         "pcd"_a, "depth"_a = 8, "width"_a = 0, "scale"_a = 1.1,
                         "linear_fit"_a = false, "n_threads"_a = -1)
+            .def_static("create_from_point_cloud_poisson_tiled",
+                        &TriangleMesh::CreateFromPointCloudPoissonTiled,
+                        py::call_guard<py::gil_scoped_release>(),
+                        "Function that computes a triangle mesh from a large "
+                        "oriented PointCloud pcd tile by tile with the "
+                        "Screened Poisson Reconstruction, bounding the memory "
+                        "of the reconstruction, and stitches the tiles.",
+                        "pcd"_a, "tile_size"_a, "overlap"_a, "depth"_a = 8,
+                        "scale"_a = 1.1, "linear_fit"_a = false,
+                        "n_threads"_a = -1)
             .def_static("create_box", &TriangleMesh::CreateBox,
                         "Factory function to create a box. The left bottom "
                         "corner on the "
@@ -589,6 +641,23 @@ void pybind_trianglemesh(py::module &m) {
              {"seed",
               "Seed value used in the random generator, set to -1 to use a "
               "random seed value with each function call."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "sample_points_poisson_disk_parallel",
+            {{"number_of_points", "Number of points that should be sampled."},
+             {"init_factor",
+              "Factor for the initial uniformly sampled PointCloud. This init "
+              "PointCloud is used for sample elimination."},
+             {"pcl",
+              "Initial PointCloud that is used for sample elimination. If this "
+              "parameter is provided the init_factor is ignored."},
+             {"use_triangle_normal",
+              "If True assigns the triangle normals instead of the "
+              "interpolated vertex normals to the returned points. The "
+              "triangle normals will be computed and added to the mesh if "
+              "necessary."},
+             {"seed",
+              "Seed value used in the random generator, set to -1 to use a "
+              "random seed value with each function call."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "subdivide_midpoint",
             {{"number_of_iterations",
@@ -617,6 +686,16 @@ void pybind_trianglemesh(py::module &m) {
              {"boundary_weight",
               "A weight applied to edge vertices used to preserve "
               "boundaries"}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "simplify_quadric_decimation_parallel",
+            {{"target_number_of_triangles",
+              "The number of triangles that the simplified mesh should have. "
+              "It is not guaranteed that this number will be reached."},
+             {"maximum_error",
+              "The maximum error where a vertex is allowed to be merged"},
+             {"boundary_weight",
+              "A weight applied to edge vertices used to preserve "
+              "boundaries"}});
     docstring::ClassMethodDocInject(m, "TriangleMesh", "compute_convex_hull");
     docstring::ClassMethodDocInject(m, "TriangleMesh",
                                     "cluster_connected_triangles");
@@ -700,6 +779,26 @@ void pybind_trianglemesh(py::module &m) {
              {"n_threads",
               "Number of threads used for reconstruction. Set to -1 to "
               "automatically determine it."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "create_from_point_cloud_poisson_tiled",
+            {{"pcd",
+              "PointCloud from which the TriangleMesh surface is "
+              "reconstructed. Has to contain normals."},
+             {"tile_size", "Edge length of the cubic tiles."},
+             {"overlap",
+              "Distance by which each tile is extended on every side when "
+              "reconstructing it. Has to be in [0, tile_size]."},
+             {"depth", "Maximum depth of the tree of each tile."},
+             {"scale",
+              "Specifies the ratio between the diameter of the cube used for "
+              "the reconstruction of a tile and the diameter of its samples' "
+              "bounding cube."},
+             {"linear_fit",
+              "If true, the reconstructor will use linear interpolation to "
+              "estimate the positions of iso-vertices."},
+             {"n_threads",
+              "Number of threads used for the reconstruction of each tile. "
+              "Set to -1 to automatically determine it."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_box",
             {{"width", "x-directional length."},
@@ -792,6 +891,44 @@ void pybind_trianglemesh(py::module &m) {
              {"flatness", "Controls the flatness/height of the Moebius strip."},
              {"width", "Width of the Moebius strip."},
              {"scale", "Scale the complete Moebius strip."}});
+
+    // open3d.geometry.AsRigidAsPossibleDeformation
+    py::class_<AsRigidAsPossibleDeformation,
+               std::shared_ptr<AsRigidAsPossibleDeformation>>
+            arap(m, "AsRigidAsPossibleDeformation",
+                 "Reusable as-rigid-as-possible deformation for a fixed set of "
+                 "constraint vertices. The system matrix is factorized once, "
+                 "and each call to iterate continues from the previous "
+                 "deformation.");
+    arap.def(py::init<const TriangleMesh &, const std::vector<int> &,
+                      MeshBase::DeformAsRigidAsPossibleEnergy, double>(),
+             "mesh"_a, "constraint_vertex_indices"_a,
+             "energy"_a = MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+             "smoothed_alpha"_a = 0.01)
+            .def("set_constraint_positions",
+                 &AsRigidAsPossibleDeformation::SetConstraintPositions,
+                 "Sets the target positions of the constrained vertices.",
+                 "constraint_vertex_positions"_a)
+            .def("iterate", &AsRigidAsPossibleDeformation::Iterate,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Runs up to max_iter iterations, or until max_seconds have "
+                 "passed if positive. Returns the number of iterations run.",
+                 "max_iter"_a, "max_seconds"_a = 0.0)
+            .def("reset", &AsRigidAsPossibleDeformation::Reset,
+                 "Restores the rest pose, keeping the factorization.")
+            .def("get_deformed_mesh",
+                 &AsRigidAsPossibleDeformation::GetDeformedMesh,
+                 "Returns a copy of the mesh with the deformed vertices.")
+            .def_property_readonly("vertices",
+                                   &AsRigidAsPossibleDeformation::GetVertices,
+                                   "The deformed vertices.")
+            .def_property_readonly("energy",
+                                   &AsRigidAsPossibleDeformation::GetEnergy,
+                                   "Energy after the last iteration.")
+            .def_property_readonly(
+                    "num_iterations",
+                    &AsRigidAsPossibleDeformation::GetNumIterations,
+                    "Number of iterations since construction or reset.");
 }
 
 void pybind_trianglemesh_methods(py::module &m) {}
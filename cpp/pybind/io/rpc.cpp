@@ -43,7 +43,27 @@ void pybind_rpc(py::module& m_io) {
             py::cpp_function([]() { rpc::DestroyZMQContext(); }));
 
     py::class_<rpc::ConnectionBase, std::shared_ptr<rpc::ConnectionBase>>(
-            m, "_ConnectionBase");
+            m, "_ConnectionBase")
+            .def(
+                    "set_array_encoding",
+                    [](rpc::ConnectionBase& connection, bool compress,
+                       bool quantize_positions, bool quantize_colors,
+                       bool quantize_normals) {
+                        rpc::ArrayEncodingOptions options;
+                        options.compress = compress;
+                        options.quantize_positions = quantize_positions;
+                        options.quantize_colors = quantize_colors;
+                        options.quantize_normals = quantize_normals;
+                        connection.SetArrayEncodingOptions(options);
+                    },
+                    "compress"_a = false, "quantize_positions"_a = false,
+                    "quantize_colors"_a = false, "quantize_normals"_a = false,
+                    "Sets the encodings of the arrays of mesh data sent over "
+                    "this connection. The receiver decodes the arrays. "
+                    "compress uses lossless LZF compression, the quantize "
+                    "options store vertex positions with 16 bits relative to "
+                    "the bounding box, colors with 8 bits and normals with 16 "
+                    "bit octahedral coordinates.");
 
     py::class_<rpc::Connection, std::shared_ptr<rpc::Connection>,
                rpc::ConnectionBase>(m, "Connection")
@@ -55,7 +75,12 @@ void pybind_rpc(py::module& m_io) {
                  }),
                  "Creates a connection object",
                  "address"_a = "tcp://127.0.0.1:51454",
-                 "connect_timeout"_a = 5000, "timeout"_a = 10000);
+                 "connect_timeout"_a = 5000, "timeout"_a = 10000)
+            .def("set_shared_memory_threshold",
+                 &rpc::Connection::SetSharedMemoryThreshold, "min_bytes"_a,
+                 "Passes arrays with at least min_bytes bytes through shared "
+                 "memory files to a receiver on the same host. 0 disables "
+                 "it.");
 
     py::class_<rpc::DummyReceiver, std::shared_ptr<rpc::DummyReceiver>>(
             m, "_DummyReceiver",
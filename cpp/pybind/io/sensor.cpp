@@ -43,6 +43,9 @@ void pybind_sensor(py::module &m) {
                     {"timestamp", "Timestamp in the video (usec)."},
                     {"filename", "Path to the mkv file."},
                     {"enable_record", "Enable recording to mkv file."},
+                    {"max_queued_frames",
+                     "Maximum number of frames waiting to be written, further "
+                     "frames are dropped."},
                     {"enable_align_depth_to_color",
                      "Enable aligning WFOV depth image to the color image in "
                      "visualizer."}};
@@ -96,16 +99,48 @@ void pybind_sensor(py::module &m) {
     docstring::ClassMethodDocInject(m, "AzureKinectSensor", "list_devices",
                                     map_shared_argument_docstrings);
 
+    // Class record statistics
+    py::class_<RecordStatistics> record_statistics(
+            m, "RecordStatistics",
+            "Statistics of the frames recorded by AzureKinectRecorder.");
+    record_statistics
+            .def_readonly("num_frames_queued",
+                          &RecordStatistics::num_frames_queued,
+                          "Frames handed to the writer thread.")
+            .def_readonly("num_frames_written",
+                          &RecordStatistics::num_frames_written,
+                          "Frames written to the mkv file.")
+            .def_readonly("num_frames_dropped",
+                          &RecordStatistics::num_frames_dropped,
+                          "Frames dropped because the queue was full or "
+                          "writing failed.")
+            .def_readonly("queue_size", &RecordStatistics::queue_size,
+                          "Frames currently waiting to be written.")
+            .def_readonly("mean_latency_ms",
+                          &RecordStatistics::mean_latency_ms,
+                          "Mean time (in ms) from queuing to writing a frame.")
+            .def_readonly("max_latency_ms", &RecordStatistics::max_latency_ms,
+                          "Maximum time (in ms) from queuing to writing a "
+                          "frame.")
+            .def("__repr__", [](const RecordStatistics &s) {
+                return fmt::format(
+                        "RecordStatistics: {} queued, {} written, {} "
+                        "dropped, mean latency {:.1f} ms",
+                        s.num_frames_queued, s.num_frames_written,
+                        s.num_frames_dropped, s.mean_latency_ms);
+            });
+
     // Class recorder
     py::class_<AzureKinectRecorder> azure_kinect_recorder(
             m, "AzureKinectRecorder", "AzureKinect recorder.");
 
     azure_kinect_recorder.def(
             py::init([](const AzureKinectSensorConfig &sensor_config,
-                        size_t sensor_index) {
-                return new AzureKinectRecorder(sensor_config, sensor_index);
+                        size_t sensor_index, size_t max_queued_frames) {
+                return new AzureKinectRecorder(sensor_config, sensor_index,
+                                               max_queued_frames);
             }),
-            "sensor_config"_a, "sensor_index"_a);
+            "sensor_config"_a, "sensor_index"_a, "max_queued_frames"_a = 30);
     azure_kinect_recorder
             .def("init_sensor", &AzureKinectRecorder::InitSensor,
                  "Initialize sensor.")
@@ -118,7 +153,11 @@ void pybind_sensor(py::module &m) {
             .def("record_frame", &AzureKinectRecorder::RecordFrame,
                  "enable_record"_a, "enable_align_depth_to_color"_a,
                  "Record a frame to mkv if flag is on and return an RGBD "
-                 "object.");
+                 "object.")
+            .def("get_record_statistics",
+                 &AzureKinectRecorder::GetRecordStatistics,
+                 "Get the statistics of the frames recorded to the current "
+                 "or last mkv file.");
     docstring::ClassMethodDocInject(m, "AzureKinectRecorder", "init_sensor",
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "AzureKinectRecorder",
@@ -134,7 +173,10 @@ void pybind_sensor(py::module &m) {
     // Class mkv reader
     py::class_<MKVReader> azure_kinect_mkv_reader(
             m, "AzureKinectMKVReader", "AzureKinect mkv file reader.");
-    azure_kinect_mkv_reader.def(py::init([]() { return MKVReader(); }));
+    azure_kinect_mkv_reader.def(py::init<size_t>(), "prefetch_frames"_a = 0,
+                                "Number of frames decoded ahead of next_frame "
+                                "by a background thread. 0 decodes in "
+                                "next_frame.");
     azure_kinect_mkv_reader
             .def("is_opened", &MKVReader::IsOpened,
                  "Check if the mkv file  is opened.")
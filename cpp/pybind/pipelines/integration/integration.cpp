@@ -88,11 +88,14 @@ In SIGGRAPH, 1996)");
             .def("reset", &TSDFVolume::Reset,
                  "Function to reset the TSDFVolume")
             .def("integrate", &TSDFVolume::Integrate,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to integrate an RGB-D image into the volume",
                  "image"_a, "intrinsic"_a, "extrinsic"_a)
             .def("extract_point_cloud", &TSDFVolume::ExtractPointCloud,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to extract a point cloud with normals")
             .def("extract_triangle_mesh", &TSDFVolume::ExtractTriangleMesh,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Function to extract a triangle mesh")
             .def_readwrite("voxel_length", &TSDFVolume::voxel_length_,
                            "float: Length of the voxel in meters.")
@@ -144,8 +147,10 @@ In SIGGRAPH, 1996)");
                  })  // todo: extend
             .def("extract_voxel_point_cloud",
                  &UniformTSDFVolume::ExtractVoxelPointCloud,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Debug function to extract the voxel data into a point cloud.")
             .def("extract_voxel_grid", &UniformTSDFVolume::ExtractVoxelGrid,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Debug function to extract the voxel data VoxelGrid.")
             .def("extract_volume_tsdf", &UniformTSDFVolume::ExtractVolumeTSDF,
                  "Debug function to extract the volume TSDF data.")
@@ -210,10 +215,27 @@ In SIGGRAPH, 2013)");
                  })
             .def("extract_voxel_point_cloud",
                  &ScalableTSDFVolume::ExtractVoxelPointCloud,
+                 py::call_guard<py::gil_scoped_release>(),
                  "Debug function to extract the voxel data into a point "
-                 "cloud.");
+                 "cloud.")
+            .def("extract_triangle_mesh_tiles",
+                 py::overload_cast<const std::string &, int, bool>(
+                         &ScalableTSDFVolume::ExtractTriangleMeshTiles),
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Function to extract the triangle mesh tile by tile, writing "
+                 "every non-empty tile to "
+                 "``<file_prefix>_<x>_<y>_<z>.ply``. Returns the written file "
+                 "names.",
+                 "file_prefix"_a, "tile_num_units"_a = 8,
+                 "write_ascii"_a = false);
     docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
                                     "extract_voxel_point_cloud");
+    docstring::ClassMethodDocInject(
+            m, "ScalableTSDFVolume", "extract_triangle_mesh_tiles",
+            {{"file_prefix", "Prefix of the tile mesh files."},
+             {"tile_num_units",
+              "Number of volume units along each side of a tile."},
+             {"write_ascii", "Set to ``True`` to write the files in ASCII."}});
 }
 
 void pybind_integration_methods(py::module &m) {
@@ -177,7 +177,13 @@ Anonymous submission.)");
 }
 
 void pybind_odometry_methods(py::module &m) {
-    m.def("compute_rgbd_odometry", &ComputeRGBDOdometry,
+    m.def("compute_rgbd_odometry",
+          py::overload_cast<const geometry::RGBDImage &,
+                            const geometry::RGBDImage &,
+                            const camera::PinholeCameraIntrinsic &,
+                            const Eigen::Matrix4d &,
+                            const RGBDOdometryJacobian &,
+                            const OdometryOption &>(&ComputeRGBDOdometry),
           py::call_guard<py::gil_scoped_release>(),
           "Function to estimate 6D rigid motion from two RGBD image pairs. "
           "Output: (is_success, 4x4 motion matrix, 6x6 information matrix).",
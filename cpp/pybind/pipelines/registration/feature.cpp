@@ -26,6 +26,7 @@
 
 #include "open3d/pipelines/registration/Feature.h"
 
+#include "open3d/geometry/NeighborCache.h"
 #include "open3d/geometry/PointCloud.h"
 #include "pybind/docstring.h"
 #include "pybind/pipelines/registration/registration.h"
@@ -65,12 +66,26 @@ void pybind_feature(py::module &m) {
 }
 
 void pybind_feature_methods(py::module &m) {
-    m.def("compute_fpfh_feature", &ComputeFPFHFeature,
+    m.def("compute_fpfh_feature",
+          py::overload_cast<const geometry::PointCloud &,
+                            const geometry::KDTreeSearchParam &>(
+                  &ComputeFPFHFeature),
           "Function to compute FPFH feature for a point cloud", "input"_a,
           "search_param"_a);
+    m.def("compute_fpfh_feature",
+          py::overload_cast<const geometry::PointCloud &,
+                            const geometry::NeighborCache &,
+                            const geometry::KDTreeSearchParam &>(
+                  &ComputeFPFHFeature),
+          "Function to compute FPFH feature for a point cloud from "
+          "precomputed neighbors",
+          "input"_a, "neighbor_cache"_a, "search_param"_a);
     docstring::FunctionDocInject(
             m, "compute_fpfh_feature",
             {{"input", "The Input point cloud."},
+             {"neighbor_cache",
+              "Neighbors of every point of the input covering "
+              "``search_param``."},
              {"search_param", "KDTree KNN search parameter."}});
 }
 
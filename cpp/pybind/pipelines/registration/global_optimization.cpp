@@ -204,6 +204,29 @@ void pybind_global_optimization(py::module &m) {
                 return std::string("GlobalOptimizationGaussNewton");
             });
 
+    py::class_<GlobalOptimizationSlidingWindow,
+               PyGlobalOptimizationMethod<GlobalOptimizationSlidingWindow>,
+               GlobalOptimizationMethod>
+            global_optimization_method_sw(
+                    m, "GlobalOptimizationSlidingWindow",
+                    "Incremental global optimization for online mapping. "
+                    "Only the newest nodes are optimized with the "
+                    "Levenberg-Marquardt algorithm, and older nodes connected "
+                    "to them are held constant.");
+    py::detail::bind_copy_functions<GlobalOptimizationSlidingWindow>(
+            global_optimization_method_sw);
+    global_optimization_method_sw
+            .def(py::init<int>(), "window_size"_a = 20)
+            .def_readwrite("window_size",
+                           &GlobalOptimizationSlidingWindow::window_size_,
+                           "int: Number of the newest nodes to optimize.")
+            .def("__repr__", [](const GlobalOptimizationSlidingWindow &te) {
+                return std::string(
+                               "GlobalOptimizationSlidingWindow with "
+                               "window_size=") +
+                       std::to_string(te.window_size_);
+            });
+
     py::class_<GlobalOptimizationConvergenceCriteria> criteria(
             m, "GlobalOptimizationConvergenceCriteria",
             "Convergence criteria of GlobalOptimization.");
@@ -331,6 +354,7 @@ void pybind_global_optimization_methods(py::module &m) {
                const GlobalOptimizationOption &option) {
                 GlobalOptimization(pose_graph, method, criteria, option);
             },
+            py::call_guard<py::gil_scoped_release>(),
             "Function to optimize PoseGraph", "pose_graph"_a, "method"_a,
             "criteria"_a, "option"_a);
     docstring::FunctionDocInject(
@@ -338,9 +362,9 @@ void pybind_global_optimization_methods(py::module &m) {
             {{"pose_graph", "The pose_graph to be optimized (in-place)."},
              {"method",
               "Global optimization method. Either "
-              "``GlobalOptimizationGaussNewton()`` or "
-              "``GlobalOptimizationLevenbergMarquardt("
-              ")``."},
+              "``GlobalOptimizationGaussNewton()``, "
+              "``GlobalOptimizationLevenbergMarquardt()`` or "
+              "``GlobalOptimizationSlidingWindow()``."},
              {"criteria", "Global optimization convergence criteria."},
              {"option", "Global optimization option."}});
 }
@@ -29,6 +29,7 @@
 #include <memory>
 #include <utility>
 
+#include "open3d/core/nns/NearestNeighborSearch.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/pipelines/registration/ColoredICP.h"
 #include "open3d/pipelines/registration/CorrespondenceChecker.h"
@@ -543,14 +544,20 @@ static const std::unordered_map<std::string, std::string>
                  "``"
                  "TransformationEstimationForColoredICP``)"},
                 {"init", "Initial transformation estimation"},
+                {"inits", "Initial transformation estimation of each pair."},
                 {"lambda_geometric", "lambda_geometric value"},
                 {"kernel", "Robust Kernel used in the Optimization"},
+                {"knn_params",
+                 "Type and recall/speed parameters of the approximate nearest "
+                 "neighbor index used to match the features."},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
                 {"mutual_filter",
                  "Enables mutual filter such that the correspondence of the "
                  "source point's correspondence is itself."},
                 {"option", "Registration option"},
+                {"pairs", "(source, target) indices into ``point_clouds``."},
+                {"point_clouds", "The point clouds referenced by ``pairs``."},
                 {"ransac_n", "Fit ransac with ``ransac_n`` correspondences"},
                 {"source_feature", "Source point cloud feature."},
                 {"source", "The source point cloud."},
@@ -579,6 +586,18 @@ void pybind_registration_methods(py::module &m) {
     docstring::FunctionDocInject(m, "registration_icp",
                                  map_shared_argument_docstrings);
 
+    m.def("registration_icp_batch", &RegistrationICPBatch,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for ICP registration of a batch of point cloud pairs, "
+          "sharing the KD-tree of each target. Returns the registration "
+          "result and the information matrix of each pair.",
+          "point_clouds"_a, "pairs"_a, "inits"_a,
+          "max_correspondence_distance"_a,
+          "estimation_method"_a = TransformationEstimationPointToPoint(false),
+          "criteria"_a = ICPConvergenceCriteria());
+    docstring::FunctionDocInject(m, "registration_icp_batch",
+                                 map_shared_argument_docstrings);
+
     m.def("registration_colored_icp", &RegistrationColoredICP,
           py::call_guard<py::gil_scoped_release>(),
           "Function for Colored ICP registration", "source"_a, "target"_a,
@@ -605,7 +624,14 @@ void pybind_registration_methods(py::module &m) {
                                  map_shared_argument_docstrings);
 
     m.def("registration_ransac_based_on_feature_matching",
-          &RegistrationRANSACBasedOnFeatureMatching,
+          static_cast<RegistrationResult (*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  const Feature &, const Feature &, bool, double,
+                  const TransformationEstimation &, int,
+                  const std::vector<std::reference_wrapper<
+                          const CorrespondenceChecker>> &,
+                  const RANSACConvergenceCriteria &)>(
+                  &RegistrationRANSACBasedOnFeatureMatching),
           py::call_guard<py::gil_scoped_release>(),
           "Function for global RANSAC registration based on feature matching",
           "source"_a, "target"_a, "source_feature"_a, "target_feature"_a,
@@ -619,6 +645,30 @@ void pybind_registration_methods(py::module &m) {
             m, "registration_ransac_based_on_feature_matching",
             map_shared_argument_docstrings);
 
+    m.def("registration_ransac_based_on_approximate_feature_matching",
+          static_cast<RegistrationResult (*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  const Feature &, const Feature &, bool, double,
+                  const core::nns::ApproximateKnnParams &,
+                  const TransformationEstimation &, int,
+                  const std::vector<std::reference_wrapper<
+                          const CorrespondenceChecker>> &,
+                  const RANSACConvergenceCriteria &)>(
+                  &RegistrationRANSACBasedOnFeatureMatching),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for global RANSAC registration based on feature matching, "
+          "finding the nearest features with an approximate index",
+          "source"_a, "target"_a, "source_feature"_a, "target_feature"_a,
+          "mutual_filter"_a, "max_correspondence_distance"_a, "knn_params"_a,
+          "estimation_method"_a = TransformationEstimationPointToPoint(false),
+          "ransac_n"_a = 3,
+          "checkers"_a = std::vector<
+                  std::reference_wrapper<const CorrespondenceChecker>>(),
+          "criteria"_a = RANSACConvergenceCriteria(100000, 0.999));
+    docstring::FunctionDocInject(
+            m, "registration_ransac_based_on_approximate_feature_matching",
+            map_shared_argument_docstrings);
+
     m.def("registration_fast_based_on_feature_matching",
           &FastGlobalRegistration, py::call_guard<py::gil_scoped_release>(),
           "Function for fast global registration based on feature matching",
@@ -45,6 +45,8 @@ core::Dtype ArrayFormatToDtype(const std::string& format, size_t byte_size) {
         return core::Dtype::Float32;
     if (format == py::format_descriptor<double>::format() && byte_size == 8)
         return core::Dtype::Float64;
+    // "e" is the half-precision float format, e.g. numpy.float16.
+    if (format == "e" && byte_size == 2) return core::Dtype::Float16;
     if (format == py::format_descriptor<int8_t>::format() && byte_size == 1)
         return core::Dtype::Int8;
     if (format == py::format_descriptor<int16_t>::format() && byte_size == 2)
@@ -83,6 +85,7 @@ std::string DtypeToArrayFormat(const core::Dtype& dtype) {
         return py::format_descriptor<float>::format();
     if (dtype == core::Dtype::Float64)
         return py::format_descriptor<double>::format();
+    if (dtype == core::Dtype::Float16) return "e";
     if (dtype == core::Dtype::Int8)
         return py::format_descriptor<int8_t>::format();
     if (dtype == core::Dtype::Int16)
@@ -247,6 +247,25 @@ void pybind_image(py::module &m) {
                      "image_legacy"_a, "device"_a = core::Device("CPU:0"),
                      "Create a Image from a legacy Open3D Image.");
     image.def("as_tensor", &Image::AsTensor);
+    image.def_static("rgb_to_gray_batch", &Image::RGBToGrayBatch, "images"_a,
+                     "Converts a (N, rows, cols, 3) stack of RGB images to a "
+                     "(N, rows, cols, 1) stack of grayscale images.");
+    image.def_static("resize_batch", &Image::ResizeBatch, "images"_a,
+                     "sampling_rate"_a = 0.5,
+                     "interp_type"_a = Image::InterpType::Nearest,
+                     "Resizes a (N, rows, cols, channels) image stack with "
+                     "nearest or linear interpolation.");
+    image.def_static("dilate_batch", &Image::DilateBatch, "images"_a,
+                     "kernel_size"_a = 3,
+                     "Dilates a (N, rows, cols, channels) image stack.");
+    image.def_static("filter_batch", &Image::FilterBatch, "images"_a,
+                     "kernel"_a,
+                     "Filters a (N, rows, cols, channels) image stack with "
+                     "the given kernel.");
+    image.def_static("filter_gaussian_batch", &Image::FilterGaussianBatch,
+                     "images"_a, "kernel_size"_a = 3, "sigma"_a = 1.0,
+                     "Gaussian filters a (N, rows, cols, channels) image "
+                     "stack.");
 
     docstring::ClassMethodDocInject(m, "Image", "get_min_bound");
     docstring::ClassMethodDocInject(m, "Image", "get_max_bound");
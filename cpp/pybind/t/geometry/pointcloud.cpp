@@ -26,10 +26,12 @@
 
 #include "open3d/t/geometry/PointCloud.h"
 
+#include <limits>
 #include <string>
 #include <unordered_map>
 
 #include "open3d/core/hashmap/Hashmap.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "pybind/docstring.h"
 #include "pybind/t/geometry/geometry.h"
 
@@ -64,6 +66,15 @@ void pybind_pointcloud(py::module& m) {
             pointcloud(m, "PointCloud",
                        "A pointcloud contains a set of 3D points.");
 
+    py::enum_<PointCloud::VoxelReduction>(
+            m, "VoxelReduction",
+            "Reduction of the points of a voxel in voxel_down_sample.")
+            .value("Mean", PointCloud::VoxelReduction::Mean)
+            .value("First", PointCloud::VoxelReduction::First)
+            .value("CenterNearest", PointCloud::VoxelReduction::CenterNearest)
+            .value("Max", PointCloud::VoxelReduction::Max)
+            .export_values();
+
     // Constructors.
     pointcloud.def(py::init<const core::Device&>(), "device"_a)
             .def(py::init<const core::Tensor&>(), "points"_a)
@@ -85,6 +96,13 @@ void pybind_pointcloud(py::module& m) {
                    "device"_a, "copy"_a = false);
     pointcloud.def("clone", &PointCloud::Clone,
                    "Returns a copy of the point cloud on the same device.");
+    pointcloud.def("pack", &PointCloud::Pack,
+                   "Returns a point cloud with the same attributes, stored in "
+                   "a single allocation, which is then transferred with a "
+                   "single copy.");
+    pointcloud.def("is_packed", &PointCloud::IsPacked,
+                   "Returns true if the point attributes are stored in a "
+                   "single allocation.");
     pointcloud.def("cpu", &PointCloud::CPU,
                    "Transfer the point cloud to CPU. If the point cloud is "
                    "already on CPU, no copy will be performed.");
@@ -101,6 +119,14 @@ void pybind_pointcloud(py::module& m) {
                    "Returns the max bound for point coordinates.");
     pointcloud.def("get_center", &PointCloud::GetCenter,
                    "Returns the center for point coordinates.");
+    pointcloud.def(
+            "get_oriented_bounding_boxes",
+            &PointCloud::GetOrientedBoundingBoxes,
+            py::call_guard<py::gil_scoped_release>(), "offsets"_a,
+            "Returns the centers, rotations and extents of the oriented "
+            "bounding boxes of the clusters of points, which start at the "
+            "Int64 offsets followed by the number of points. The boxes are "
+            "aligned with the principal axes of the clusters.");
 
     pointcloud.def("append",
                    [](const PointCloud& self, const PointCloud& other) {
@@ -127,6 +153,129 @@ void pybind_pointcloud(py::module& m) {
             },
             "Downsamples a point cloud with a specified voxel size.",
             "voxel_size"_a);
+    pointcloud.def(
+            "voxel_down_sample",
+            [](const PointCloud& pointcloud, const double voxel_size,
+               PointCloud::VoxelReduction reduction) {
+                return pointcloud.VoxelDownSample(
+                        voxel_size, reduction, core::HashmapBackend::Default);
+            },
+            "Downsamples a point cloud with a specified voxel size, reducing "
+            "all the point attributes of each voxel with the given reduction.",
+            "voxel_size"_a, "reduction"_a);
+    pointcloud.def("select_by_mask", &PointCloud::SelectByMask,
+                   "boolean_mask"_a, "invert"_a = false,
+                   "Select points by a boolean mask, keeping all point "
+                   "attributes.");
+    pointcloud.def(
+            "crop",
+            [](const PointCloud& pointcloud,
+               const open3d::geometry::AxisAlignedBoundingBox& aabb,
+               bool invert) {
+                return pointcloud.Crop(aabb, invert);
+            },
+            "aabb"_a, "invert"_a = false,
+            "Crop the point cloud to an axis-aligned bounding box.");
+    pointcloud.def(
+            "crop",
+            [](const PointCloud& pointcloud,
+               const open3d::geometry::OrientedBoundingBox& obb, bool invert) {
+                return pointcloud.Crop(obb, invert);
+            },
+            "obb"_a, "invert"_a = false,
+            "Crop the point cloud to an oriented bounding box.");
+    pointcloud.def("remove_radius_outliers",
+                   &PointCloud::RemoveRadiusOutliers, "nb_points"_a,
+                   "search_radius"_a,
+                   "Remove points that have less than nb_points neighbors in "
+                   "a sphere of a given radius. Returns the filtered point "
+                   "cloud and the boolean mask of the kept points.");
+    pointcloud.def("remove_statistical_outliers",
+                   &PointCloud::RemoveStatisticalOutliers, "nb_neighbors"_a,
+                   "std_ratio"_a,
+                   "Remove points that are further away from their neighbors "
+                   "than the average. Returns the filtered point cloud and "
+                   "the boolean mask of the kept points.");
+    pointcloud.def("compute_point_cloud_distance",
+                   &PointCloud::ComputePointCloudDistance,
+                   py::call_guard<py::gil_scoped_release>(), "target"_a,
+                   "chunk_size"_a = 1 << 20,
+                   "Computes the distance of every point to its nearest "
+                   "neighbor in the target point cloud. Returns the distances "
+                   "and the indices of the nearest target points.");
+    pointcloud.def("compute_mesh_distance", &PointCloud::ComputeMeshDistance,
+                   py::call_guard<py::gil_scoped_release>(), "mesh"_a,
+                   "chunk_size"_a = 1 << 20,
+                   "Computes the distance of every point to the surface of "
+                   "the mesh. Returns the distances and the indices of the "
+                   "closest triangles.");
+    pointcloud.def(
+            "remove_hidden_points", &PointCloud::RemoveHiddenPoints,
+            py::call_guard<py::gil_scoped_release>(), "width"_a, "height"_a,
+            "intrinsics"_a,
+            "extrinsics"_a = core::Tensor::Eye(4, core::Dtype::Float32,
+                                               core::Device("CPU:0")),
+            "splat_radius"_a = 2, "depth_tolerance"_a = 0.01f,
+            "depth_max"_a = std::numeric_limits<float>::infinity(),
+            "Removes the points hidden in a pinhole camera view by splatting "
+            "the points to a depth buffer and testing them against a min "
+            "depth pyramid. A fast approximation of the legacy "
+            "hidden_point_removal. Returns the visible point cloud and the "
+            "mask of the visible points.");
+    pointcloud.def(
+            "project_to_depth_images", &PointCloud::ProjectToDepthImages,
+            py::call_guard<py::gil_scoped_release>(), "depth"_a,
+            "intrinsics"_a, "extrinsics"_a, "depth_scale"_a = 1000.0f,
+            "depth_max"_a = 3.0f, "splat_radius"_a = 0,
+            "depth_tolerance"_a = 0.0f,
+            "Projects the point cloud to the (v, h, w, 1) Float32 depth "
+            "images of a batch of views in place. The points are splatted to "
+            "the pixels within splat_radius, and the depths within "
+            "depth_tolerance of the nearest one are averaged.");
+    pointcloud.def(
+            "project_to_rgbd_images", &PointCloud::ProjectToRGBDImages,
+            py::call_guard<py::gil_scoped_release>(), "depth"_a, "color"_a,
+            "intrinsics"_a, "extrinsics"_a, "depth_scale"_a = 1000.0f,
+            "depth_max"_a = 3.0f, "splat_radius"_a = 0,
+            "depth_tolerance"_a = 0.0f,
+            "Projects the point cloud to the depth images and (v, h, w, 3) "
+            "UInt8 color images of a batch of views in place, like "
+            "project_to_depth_images.");
+    pointcloud.def("estimate_covariances", &PointCloud::EstimateCovariances,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "max_knn"_a = 30, "radius"_a = py::none(),
+                   "Estimates the covariance of the neighborhood of each "
+                   "point into the 'covariances' attribute. Uses hybrid "
+                   "search if both max_knn and radius are given, knn search "
+                   "if only max_knn is given and radius search otherwise.");
+    pointcloud.def("estimate_normals", &PointCloud::EstimateNormals,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "max_knn"_a = 30, "radius"_a = py::none(),
+                   "Estimates the normals from the neighborhood covariances, "
+                   "which are kept in the 'covariances' attribute. If both "
+                   "max_knn and radius are None, the existing 'covariances' "
+                   "are used. Existing normals are used for orientation.");
+    pointcloud.def("estimate_color_gradients",
+                   &PointCloud::EstimateColorGradients,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "max_knn"_a = 30, "radius"_a = py::none(),
+                   "Estimates the gradients of the point intensities in the "
+                   "tangent planes into the 'color_gradients' attribute, as "
+                   "used by colored ICP. Requires normals and colors.");
+    pointcloud.def("orient_normals_to_align_with_direction",
+                   &PointCloud::OrientNormalsToAlignWithDirection,
+                   "orientation_reference"_a =
+                           core::Tensor::Init<float>({0, 0, 1}),
+                   "Flips the normals to align with orientation_reference.");
+    pointcloud.def("orient_normals_towards_camera_location",
+                   &PointCloud::OrientNormalsTowardsCameraLocation,
+                   "camera_location"_a =
+                           core::Tensor::Zeros({3}, core::Dtype::Float32),
+                   "Flips the normals to point towards camera_location.");
+    pointcloud.def("orient_normals_consistent_tangent_plane",
+                   &PointCloud::OrientNormalsConsistentTangentPlane, "k"_a,
+                   "Orients the normals consistently along a minimum spanning "
+                   "tree of the k nearest neighbor graph.");
     pointcloud.def_static(
             "create_from_depth_image", &PointCloud::CreateFromDepthImage,
             py::call_guard<py::gil_scoped_release>(), "depth"_a, "intrinsics"_a,
@@ -153,7 +302,45 @@ void pybind_pointcloud(py::module& m) {
             "fx\n\n y "
             "= (v - cy) * z / fy");
     pointcloud.def_static(
-            "from_legacy_pointcloud", &PointCloud::FromLegacyPointCloud,
+            "create_from_depth_image_voxel_down_sample",
+            [](const Image& depth, const core::Tensor& intrinsics,
+               double voxel_size, const core::Tensor& extrinsics,
+               float depth_scale, float depth_max, int stride) {
+                return PointCloud::CreateFromDepthImageVoxelDownSample(
+                        depth, intrinsics, voxel_size, extrinsics, depth_scale,
+                        depth_max, stride, core::HashmapBackend::Default);
+            },
+            py::call_guard<py::gil_scoped_release>(), "depth"_a, "intrinsics"_a,
+            "voxel_size"_a,
+            "extrinsics"_a = core::Tensor::Eye(4, core::Dtype::Float32,
+                                               core::Device("CPU:0")),
+            "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f, "stride"_a = 1,
+            "Factory function to create a voxel downsampled pointcloud from a "
+            "depth image and a camera model, averaging the points of each "
+            "voxel without creating the full resolution pointcloud.");
+    pointcloud.def_static(
+            "create_from_rgbd_image_voxel_down_sample",
+            [](const RGBDImage& rgbd_image, const core::Tensor& intrinsics,
+               double voxel_size, const core::Tensor& extrinsics,
+               float depth_scale, float depth_max, int stride) {
+                return PointCloud::CreateFromRGBDImageVoxelDownSample(
+                        rgbd_image, intrinsics, voxel_size, extrinsics,
+                        depth_scale, depth_max, stride,
+                        core::HashmapBackend::Default);
+            },
+            py::call_guard<py::gil_scoped_release>(), "rgbd_image"_a,
+            "intrinsics"_a, "voxel_size"_a,
+            "extrinsics"_a = core::Tensor::Eye(4, core::Dtype::Float32,
+                                               core::Device("CPU:0")),
+            "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f, "stride"_a = 1,
+            "Factory function to create a voxel downsampled pointcloud (with "
+            "properties {'points', 'colors'}) from an RGBD image and a camera "
+            "model, averaging the points and colors of each voxel.");
+    pointcloud.def_static(
+            "from_legacy_pointcloud",
+            py::overload_cast<const open3d::geometry::PointCloud &,
+                              core::Dtype, const core::Device &>(
+                    &PointCloud::FromLegacyPointCloud),
             "pcd_legacy"_a, "dtype"_a = core::Dtype::Float32,
             "device"_a = core::Device("CPU:0"),
             "Create a PointCloud from a legacy Open3D PointCloud.");
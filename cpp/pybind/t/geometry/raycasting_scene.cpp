@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "open3d/t/geometry/RaycastingScene.h"
+#include "pybind/core/tensor_converter.h"
 #include "pybind/core/tensor_type_caster.h"
 #include "pybind/t/geometry/geometry.h"
 
@@ -41,7 +42,8 @@ or compute the closest point on the surface of a mesh with respect to one
 or more query points.
 It builds an internal acceleration structure to speed up those queries.
 
-This class supports only the CPU device.
+Scenes on the CPU use Embree, scenes on a CUDA device use a native bounding
+volume hierarchy. All tensors passed to a scene must be on its device.
 
 The following shows how to create a scene and compute ray intersections::
 
@@ -72,8 +74,20 @@ The following shows how to create a scene and compute ray intersections::
 
 )doc");
 
+    py::enum_<RaycastingScene::BuildQuality>(
+            raycasting_scene, "BuildQuality",
+            "Quality of the acceleration structure, which trades the build "
+            "time for the speed of the queries.")
+            .value("Low", RaycastingScene::BuildQuality::Low)
+            .value("Medium", RaycastingScene::BuildQuality::Medium)
+            .value("High", RaycastingScene::BuildQuality::High)
+            .export_values();
+
     // Constructors.
-    raycasting_scene.def(py::init<>());
+    raycasting_scene.def(
+            py::init<const core::Device&, RaycastingScene::BuildQuality>(),
+            "device"_a = core::Device("CPU:0"),
+            "build_quality"_a = RaycastingScene::BuildQuality::Medium);
 
     raycasting_scene.def(
             "add_triangles",
@@ -105,7 +119,95 @@ Returns:
     The geometry ID of the added mesh.
 )doc");
 
-    raycasting_scene.def("cast_rays", &RaycastingScene::CastRays, "rays"_a,
+    raycasting_scene.def("add_instance", &RaycastingScene::AddInstance,
+                         "geometry_id"_a, "transform"_a, R"doc(
+Add an instance of a triangle mesh of the scene.
+
+Instances share the triangles and the acceleration structure of their mesh.
+Moving an instance with set_transform() only updates the top level of the
+acceleration structure. The instanced mesh stays part of the scene unless it is
+removed with remove_geometry().
+
+Args:
+    geometry_id (int): The geometry ID of a triangle mesh of the scene.
+    transform (open3d.core.Tensor): The 4x4 transformation from the mesh to
+        the world coordinate system.
+
+Returns:
+    The geometry ID of the instance.
+)doc");
+
+    raycasting_scene.def("set_transform", &RaycastingScene::SetTransform,
+                         "geometry_id"_a, "transform"_a, R"doc(
+Set the transformation of an instance.
+
+Args:
+    geometry_id (int): The geometry ID of an instance.
+    transform (open3d.core.Tensor): The 4x4 transformation from the mesh to
+        the world coordinate system.
+)doc");
+
+    raycasting_scene.def("remove_geometry", &RaycastingScene::RemoveGeometry,
+                         "geometry_id"_a, R"doc(
+Remove a geometry from the scene.
+
+The IDs of the other geometries do not change. Instances of a removed triangle
+mesh remain in the scene.
+
+Args:
+    geometry_id (int): The geometry ID of a mesh or an instance.
+)doc");
+
+    raycasting_scene.def("save_bvh", &RaycastingScene::SaveBVH,
+                         py::call_guard<py::gil_scoped_release>(),
+                         "file_name"_a, R"doc(
+Save the scene as native bounding volume hierarchy to a binary file.
+
+Embree's acceleration structure cannot be serialized, so the hierarchy that
+CUDA scenes use is saved for scenes on all devices. Instances are stored with
+their transformed triangles.
+
+Args:
+    file_name (str): Path to the file, typically with the extension ".o3dt".
+)doc");
+
+    raycasting_scene.def(
+            "load_bvh",
+            [](RaycastingScene& scene, const std::string& file_name,
+               const py::object& mmap_mode) {
+                core::Tensor::MmapMode mode = core::Tensor::MmapMode::None;
+                if (!mmap_mode.is_none()) {
+                    std::string mode_str = mmap_mode.cast<std::string>();
+                    if (mode_str == "r") {
+                        mode = core::Tensor::MmapMode::ReadOnly;
+                    } else if (mode_str == "c") {
+                        mode = core::Tensor::MmapMode::CopyOnWrite;
+                    } else {
+                        utility::LogError(
+                                "Invalid mmap_mode '{}', must be None, 'r' or "
+                                "'c'.",
+                                mode_str);
+                    }
+                }
+                py::gil_scoped_release release;
+                scene.LoadBVH(file_name, mode);
+            },
+            "file_name"_a, "mmap_mode"_a = py::none(), R"doc(
+Load a hierarchy saved by save_bvh() into this empty scene.
+
+The scene then queries the loaded hierarchy on its device, also on the CPU,
+without building an acceleration structure. Geometries cannot be added to,
+moved in or removed from loaded scenes.
+
+Args:
+    file_name (str): Path to the file.
+    mmap_mode (str): None, or 'r' (read-only) or 'c' (copy-on-write) to back
+        the hierarchy of CPU scenes by the memory-mapped file.
+)doc");
+
+    // The queries release the GIL while they run.
+    raycasting_scene.def("cast_rays", &RaycastingScene::CastRays,
+                         py::call_guard<py::gil_scoped_release>(), "rays"_a,
                          R"doc(
 Computes the first intersection of the rays with the scene.
 
@@ -144,7 +246,9 @@ Returns:
 )doc");
 
     raycasting_scene.def("count_intersections",
-                         &RaycastingScene::CountIntersections, "rays"_a, R"doc(
+                         &RaycastingScene::CountIntersections,
+                         py::call_guard<py::gil_scoped_release>(), "rays"_a,
+                         R"doc(
 Computes the first intersection of the rays with the scene.
 
 Args:
@@ -162,6 +266,7 @@ Returns:
 
     raycasting_scene.def("compute_closest_points",
                          &RaycastingScene::ComputeClosestPoints,
+                         py::call_guard<py::gil_scoped_release>(),
                          "query_points"_a, R"doc(
 Computes the closest points on the surfaces of the scene.
 
@@ -188,6 +293,7 @@ Returns:
 )doc");
 
     raycasting_scene.def("compute_distance", &RaycastingScene::ComputeDistance,
+                         py::call_guard<py::gil_scoped_release>(),
                          "query_points"_a, R"doc(
 Computes the distance to the surface of the scene.
 
@@ -205,6 +311,7 @@ Returns:
 
     raycasting_scene.def("compute_signed_distance",
                          &RaycastingScene::ComputeSignedDistance,
+                         py::call_guard<py::gil_scoped_release>(),
                          "query_points"_a, R"doc(
 Computes the signed distance to the surface of the scene.
 
@@ -228,8 +335,9 @@ Returns:
 )doc");
 
     raycasting_scene.def("compute_occupancy",
-                         &RaycastingScene::ComputeOccupancy, "query_points"_a,
-                         R"doc(
+                         &RaycastingScene::ComputeOccupancy,
+                         py::call_guard<py::gil_scoped_release>(),
+                         "query_points"_a, R"doc(
 Computes the occupancy at the query point positions.
 
 This function computes whether the query points are inside or outside.
@@ -251,6 +359,68 @@ Returns:
     or 1. A point is occupied or inside if the value is 1.
 )doc");
 
+    raycasting_scene.def(
+            "compute_signed_distance_grid",
+            [](RaycastingScene& scene, const core::Tensor& min_bound,
+               const core::Tensor& max_bound, const py::handle& resolution,
+               int64_t tile_size) {
+                const core::SizeVector grid_resolution =
+                        core::PyHandleToSizeVector(resolution);
+                py::gil_scoped_release release;
+                return scene.ComputeSignedDistanceGrid(
+                        min_bound, max_bound, grid_resolution, tile_size);
+            },
+            "min_bound"_a, "max_bound"_a, "resolution"_a, "tile_size"_a = 64,
+            R"doc(
+Computes the signed distance at the points of a regular grid.
+
+The grid points are generated and evaluated in cubic tiles, so that the memory
+used for the queries is bounded by the tile size and neighboring grid points are
+queried together. See compute_signed_distance() for the assumptions about the
+meshes.
+
+Args:
+    min_bound (open3d.core.Tensor): The position [x, y, z] of the first grid
+        point with shape {3}.
+    max_bound (open3d.core.Tensor): The position [x, y, z] of the last grid
+        point with shape {3}.
+    resolution (Sequence[int]): The number of grid points [nx, ny, nz] along
+        each axis.
+    tile_size (int): The edge length in grid points of the tiles.
+
+Returns:
+    A Float32 tensor with shape {nz, ny, nx} with the signed distances.
+)doc");
+
+    raycasting_scene.def(
+            "compute_occupancy_grid",
+            [](RaycastingScene& scene, const core::Tensor& min_bound,
+               const core::Tensor& max_bound, const py::handle& resolution,
+               int64_t tile_size) {
+                const core::SizeVector grid_resolution =
+                        core::PyHandleToSizeVector(resolution);
+                py::gil_scoped_release release;
+                return scene.ComputeOccupancyGrid(
+                        min_bound, max_bound, grid_resolution, tile_size);
+            },
+            "min_bound"_a, "max_bound"_a, "resolution"_a, "tile_size"_a = 64,
+            R"doc(
+Computes the occupancy at the points of a regular grid in tiles, see
+compute_signed_distance_grid() and compute_occupancy().
+
+Args:
+    min_bound (open3d.core.Tensor): The position [x, y, z] of the first grid
+        point with shape {3}.
+    max_bound (open3d.core.Tensor): The position [x, y, z] of the last grid
+        point with shape {3}.
+    resolution (Sequence[int]): The number of grid points [nx, ny, nz] along
+        each axis.
+    tile_size (int): The edge length in grid points of the tiles.
+
+Returns:
+    A Float32 tensor with shape {nz, ny, nx} with the occupancy values.
+)doc");
+
     raycasting_scene.def_static(
             "create_rays_pinhole",
             py::overload_cast<const core::Tensor&, const core::Tensor&, int,
@@ -137,6 +137,10 @@ void pybind_tensormap(py::module &m) {
     tm.def("get_primary_key", &TensorMap::GetPrimaryKey);
     tm.def("is_size_synchronized", &TensorMap::IsSizeSynchronized);
     tm.def("assert_size_synchronized", &TensorMap::AssertSizeSynchronized);
+    tm.def("pack", &TensorMap::Pack,
+           "Returns a TensorMap with the same tensors, stored in a single "
+           "allocation.");
+    tm.def("is_packed", &TensorMap::IsPacked);
 }
 
 }  // namespace geometry
@@ -89,6 +89,58 @@ void pybind_trianglemesh(py::module& m) {
                       "Scale points.");
     triangle_mesh.def("rotate", &TriangleMesh::Rotate, "R"_a, "center"_a,
                       "Rotate points and normals (if exist).");
+    triangle_mesh.def("compute_triangle_normals",
+                      &TriangleMesh::ComputeTriangleNormals,
+                      "Computes the unit normals of the triangles.");
+    triangle_mesh.def("compute_vertex_normals",
+                      &TriangleMesh::ComputeVertexNormals,
+                      "Computes the unit normals of the vertices as the area "
+                      "weighted average of the normals of their triangles.");
+    triangle_mesh.def("get_surface_area", &TriangleMesh::GetSurfaceArea,
+                      "Returns the sum of the areas of the triangles.");
+    triangle_mesh.def("sample_points_uniformly",
+                      &TriangleMesh::SamplePointsUniformly,
+                      "Samples points uniformly on the surface of the mesh, "
+                      "interpolating the vertex colors and normals.",
+                      "number_of_points"_a, "use_triangle_normal"_a = false,
+                      "seed"_a = -1);
+    triangle_mesh.def(
+            "simplify_vertex_clustering",
+            [](const TriangleMesh& mesh, double voxel_size,
+               open3d::geometry::MeshBase::SimplificationContraction
+                       contraction) {
+                return mesh.SimplifyVertexClustering(
+                        voxel_size, contraction, core::HashmapBackend::Default);
+            },
+            "Simplifies the mesh by merging the vertices falling into the "
+            "same voxel.",
+            "voxel_size"_a,
+            "contraction"_a = open3d::geometry::MeshBase::
+                    SimplificationContraction::Average);
+    triangle_mesh.def("filter_smooth_laplacian",
+                      &TriangleMesh::FilterSmoothLaplacian,
+                      "Smooths the vertex attributes with an inverse distance "
+                      "weighted Laplacian filter.",
+                      "number_of_iterations"_a = 1, "lambda_filter"_a = 0.5,
+                      "filter_scope"_a =
+                              open3d::geometry::MeshBase::FilterScope::All);
+    triangle_mesh.def("filter_smooth_taubin",
+                      &TriangleMesh::FilterSmoothTaubin,
+                      "Smooths the vertex attributes with Taubin's "
+                      "lambda/mu filter, which avoids shrinkage.",
+                      "number_of_iterations"_a = 1, "lambda_filter"_a = 0.5,
+                      "mu"_a = -0.53,
+                      "filter_scope"_a =
+                              open3d::geometry::MeshBase::FilterScope::All);
+    triangle_mesh.def("subdivide_loop", &TriangleMesh::SubdivideLoop,
+                      "Subdivides the mesh with Loop's scheme, splitting each "
+                      "triangle into four per iteration.",
+                      "number_of_iterations"_a = 1);
+    triangle_mesh.def_static(
+            "create_isosurface", &TriangleMesh::CreateIsosurface,
+            "Extracts the iso surface of a dense (nz, ny, nx) scalar grid "
+            "spanning min_bound to max_bound with marching cubes.",
+            "grid"_a, "min_bound"_a, "max_bound"_a, "iso_value"_a = 0.0);
     triangle_mesh.def_static(
             "from_legacy_triangle_mesh", &TriangleMesh::FromLegacyTriangleMesh,
             "mesh_legacy"_a, "vertex_dtype"_a = core::Dtype::Float32,
@@ -26,7 +26,9 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
+#include "open3d/t/geometry/PartitionedTSDFVoxelGrid.h"
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
 #include "pybind/t/geometry/geometry.h"
 
@@ -63,48 +65,175 @@ void pybind_tsdf_voxelgrid(py::module& m) {
             "block_resolution"_a = 16, "block_count"_a = 100,
             "device"_a = core::Device("CPU:0"));
 
+    // The heavy operations below release the GIL so that other Python threads
+    // can run while they execute.
     tsdf_voxelgrid.def("integrate",
                        py::overload_cast<const Image&, const core::Tensor&,
                                          const core::Tensor&, float, float>(
                                &TSDFVoxelGrid::Integrate),
-                       "depth"_a, "intrinsics"_a, "extrinsics"_a,
-                       "depth_scale"_a, "depth_max"_a);
+                       py::call_guard<py::gil_scoped_release>(), "depth"_a,
+                       "intrinsics"_a, "extrinsics"_a, "depth_scale"_a,
+                       "depth_max"_a);
 
     tsdf_voxelgrid.def(
             "integrate",
             py::overload_cast<const Image&, const Image&, const core::Tensor&,
                               const core::Tensor&, float, float>(
                     &TSDFVoxelGrid::Integrate),
-            "depth"_a, "color"_a, "intrinsics"_a, "extrinsics"_a,
-            "depth_scale"_a, "depth_max"_a);
+            py::call_guard<py::gil_scoped_release>(), "depth"_a, "color"_a,
+            "intrinsics"_a, "extrinsics"_a, "depth_scale"_a, "depth_max"_a);
+
+    tsdf_voxelgrid.def("integrate_blocks", &TSDFVoxelGrid::IntegrateBlocks,
+                       py::call_guard<py::gil_scoped_release>(),
+                       "block_coords"_a, "depth"_a, "color"_a, "intrinsics"_a,
+                       "extrinsics"_a, "depth_scale"_a = 1000.0f,
+                       "depth_max"_a = 3.0f);
+    tsdf_voxelgrid.def("get_frustum_block_coords",
+                       &TSDFVoxelGrid::GetFrustumBlockCoords,
+                       py::call_guard<py::gil_scoped_release>(), "depth"_a,
+                       "intrinsics"_a, "extrinsics"_a,
+                       "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f);
+    tsdf_voxelgrid.def("set_frustum_block_cache",
+                       &TSDFVoxelGrid::SetFrustumBlockCache,
+                       "max_translation"_a, "max_rotation"_a);
+    tsdf_voxelgrid.def("set_ray_cast_graph_capture",
+                       &TSDFVoxelGrid::SetRayCastGraphCapture, "enable"_a);
+
+    tsdf_voxelgrid.def("save", &TSDFVoxelGrid::Save,
+                       py::call_guard<py::gil_scoped_release>(), "file_name"_a);
+    tsdf_voxelgrid.def_static("load", &TSDFVoxelGrid::Load,
+                              py::call_guard<py::gil_scoped_release>(),
+                              "file_name"_a,
+                              "device"_a = core::Device("CPU:0"),
+                              "backend"_a = core::HashmapBackend::Default);
+    tsdf_voxelgrid.def("offload_blocks", &TSDFVoxelGrid::OffloadBlocks,
+                       py::call_guard<py::gil_scoped_release>(),
+                       "extrinsics"_a, "radius"_a, "directory"_a = "");
+    tsdf_voxelgrid.def("reload_blocks", &TSDFVoxelGrid::ReloadBlocks,
+                       py::call_guard<py::gil_scoped_release>(),
+                       "extrinsics"_a, "radius"_a);
+    tsdf_voxelgrid.def("get_offloaded_block_count",
+                       &TSDFVoxelGrid::GetOffloadedBlockCount);
 
     // TODO(wei): expose mask code as a python class
     tsdf_voxelgrid.def(
-            "raycast", &TSDFVoxelGrid::RayCast, "intrinsics"_a, "extrinsics"_a,
-            "width"_a, "height"_a, "depth_scale"_a = 1000.0,
+            "raycast",
+            py::overload_cast<const core::Tensor&, const core::Tensor&, int,
+                              int, float, float, float, float, int>(
+                    &TSDFVoxelGrid::RayCast),
+            py::call_guard<py::gil_scoped_release>(), "intrinsics"_a,
+            "extrinsics"_a, "width"_a, "height"_a, "depth_scale"_a = 1000.0,
+            "depth_min"_a = 0.1f, "depth_max"_a = 3.0f,
+            "weight_threshold"_a = 3.0f,
+            "raycast_result_mask"_a = TSDFVoxelGrid::SurfaceMaskCode::DepthMap |
+                                      TSDFVoxelGrid::SurfaceMaskCode::ColorMap);
+    tsdf_voxelgrid.def(
+            "raycast_batch",
+            py::overload_cast<const core::Tensor&, const core::Tensor&, int,
+                              int, float, float, float, float, int>(
+                    &TSDFVoxelGrid::RayCastBatch),
+            py::call_guard<py::gil_scoped_release>(), "intrinsics"_a,
+            "extrinsics"_a, "width"_a, "height"_a, "depth_scale"_a = 1000.0,
             "depth_min"_a = 0.1f, "depth_max"_a = 3.0f,
             "weight_threshold"_a = 3.0f,
             "raycast_result_mask"_a = TSDFVoxelGrid::SurfaceMaskCode::DepthMap |
                                       TSDFVoxelGrid::SurfaceMaskCode::ColorMap);
     tsdf_voxelgrid.def(
             "extract_surface_points", &TSDFVoxelGrid::ExtractSurfacePoints,
-            "estimate_number"_a = -1, "weight_threshold"_a = 3.0f,
+            py::call_guard<py::gil_scoped_release>(), "estimate_number"_a = -1,
+            "weight_threshold"_a = 3.0f,
             "surface_mask"_a = TSDFVoxelGrid::SurfaceMaskCode::VertexMap |
                                TSDFVoxelGrid::SurfaceMaskCode::ColorMap);
     tsdf_voxelgrid.def(
             "extract_surface_mesh", &TSDFVoxelGrid::ExtractSurfaceMesh,
+            py::call_guard<py::gil_scoped_release>(), "estimate_number"_a = -1,
+            "weight_threshold"_a = 3.0f,
+            "surface_mask"_a = TSDFVoxelGrid::SurfaceMaskCode::VertexMap |
+                               TSDFVoxelGrid::SurfaceMaskCode::ColorMap |
+                               TSDFVoxelGrid::SurfaceMaskCode::NormalMap);
+    tsdf_voxelgrid.def(
+            "extract_updated_surface_mesh",
+            [](TSDFVoxelGrid& voxel_grid, int estimate_number,
+               float weight_threshold, int surface_mask) {
+                core::Tensor block_keys;
+                TriangleMesh mesh;
+                {
+                    py::gil_scoped_release release;
+                    mesh = voxel_grid.ExtractUpdatedSurfaceMesh(
+                            block_keys, estimate_number, weight_threshold,
+                            surface_mask);
+                }
+                return py::make_tuple(mesh, block_keys);
+            },
+            "Extract the mesh of the blocks updated since the last call. "
+            "Returns the mesh and the coordinates of the re-meshed blocks.",
             "estimate_number"_a = -1, "weight_threshold"_a = 3.0f,
             "surface_mask"_a = TSDFVoxelGrid::SurfaceMaskCode::VertexMap |
                                TSDFVoxelGrid::SurfaceMaskCode::ColorMap |
                                TSDFVoxelGrid::SurfaceMaskCode::NormalMap);
 
-    tsdf_voxelgrid.def("to", &TSDFVoxelGrid::To, "device"_a, "copy"_a = false);
-    tsdf_voxelgrid.def("clone", &TSDFVoxelGrid::Clone);
+    tsdf_voxelgrid.def("to", &TSDFVoxelGrid::To,
+                       py::call_guard<py::gil_scoped_release>(), "device"_a,
+                       "copy"_a = false);
+    tsdf_voxelgrid.def("clone", &TSDFVoxelGrid::Clone,
+                       py::call_guard<py::gil_scoped_release>());
     tsdf_voxelgrid.def("cpu", &TSDFVoxelGrid::CPU);
     tsdf_voxelgrid.def("cuda", &TSDFVoxelGrid::CUDA, "device_id"_a);
 
     tsdf_voxelgrid.def("get_block_hashmap", &TSDFVoxelGrid::GetBlockHashmap);
     tsdf_voxelgrid.def("get_device", &TSDFVoxelGrid::GetDevice);
+
+    py::class_<PartitionedTSDFVoxelGrid> partitioned_voxelgrid(
+            m, "PartitionedTSDFVoxelGrid",
+            "A TSDF voxel grid whose blocks are partitioned across several "
+            "devices.");
+    partitioned_voxelgrid.def(
+            py::init<const std::unordered_map<std::string, core::Dtype>&, float,
+                     float, int64_t, int64_t, const std::vector<core::Device>&,
+                     int64_t>(),
+            "map_attrs_to_dtypes"_a, "voxel_size"_a, "sdf_trunc"_a,
+            "block_resolution"_a, "block_count_per_partition"_a, "devices"_a,
+            "region_size"_a = 1);
+    partitioned_voxelgrid.def(
+            "integrate",
+            py::overload_cast<const Image&, const core::Tensor&,
+                              const core::Tensor&, float, float>(
+                    &PartitionedTSDFVoxelGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>(), "depth"_a,
+            "intrinsics"_a, "extrinsics"_a, "depth_scale"_a = 1000.0f,
+            "depth_max"_a = 3.0f);
+    partitioned_voxelgrid.def(
+            "integrate",
+            py::overload_cast<const Image&, const Image&, const core::Tensor&,
+                              const core::Tensor&, float, float>(
+                    &PartitionedTSDFVoxelGrid::Integrate),
+            py::call_guard<py::gil_scoped_release>(), "depth"_a, "color"_a,
+            "intrinsics"_a, "extrinsics"_a, "depth_scale"_a = 1000.0f,
+            "depth_max"_a = 3.0f);
+    partitioned_voxelgrid.def("integrate_frames",
+                              &PartitionedTSDFVoxelGrid::IntegrateFrames,
+                              py::call_guard<py::gil_scoped_release>(),
+                              "depths"_a, "colors"_a, "intrinsics"_a,
+                              "extrinsics"_a, "depth_scale"_a = 1000.0f,
+                              "depth_max"_a = 3.0f);
+    partitioned_voxelgrid.def(
+            "raycast", &PartitionedTSDFVoxelGrid::RayCast,
+            py::call_guard<py::gil_scoped_release>(), "intrinsics"_a,
+            "extrinsics"_a, "width"_a, "height"_a, "depth_scale"_a = 1000.0f,
+            "depth_min"_a = 0.1f, "depth_max"_a = 3.0f,
+            "weight_threshold"_a = 3.0f,
+            "raycast_result_mask"_a = TSDFVoxelGrid::SurfaceMaskCode::DepthMap |
+                                      TSDFVoxelGrid::SurfaceMaskCode::ColorMap);
+    partitioned_voxelgrid.def("gather", &PartitionedTSDFVoxelGrid::Gather,
+                              py::call_guard<py::gil_scoped_release>(),
+                              "device"_a);
+    partitioned_voxelgrid.def("get_partition_ids",
+                              &PartitionedTSDFVoxelGrid::GetPartitionIds,
+                              "block_coords"_a);
+    partitioned_voxelgrid.def("get_partition_count",
+                              &PartitionedTSDFVoxelGrid::GetPartitionCount);
+    partitioned_voxelgrid.def("get_block_count",
+                              &PartitionedTSDFVoxelGrid::GetBlockCount);
 }
 }  // namespace geometry
 }  // namespace t
@@ -30,6 +30,7 @@
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/io/ImageIO.h"
 #include "open3d/t/io/PointCloudIO.h"
+#include "open3d/t/io/TensorMapIO.h"
 #include "pybind/docstring.h"
 #include "pybind/t/io/io.h"
 
@@ -83,6 +84,8 @@ static const std::unordered_map<std::string, std::string>
                 {"feature", "The ``Feature`` object for I/O."},
                 {"print_progress",
                  "If set to true a progress bar is visualized in the console."},
+                {"tensor_map", "The ``TensorMap`` object for I/O."},
+                {"device", "The device to load the tensors to."},
 };
 
 void pybind_class_io(py::module &m_io) {
@@ -143,6 +146,31 @@ void pybind_class_io(py::module &m_io) {
             "quality"_a = kOpen3DImageIODefaultQuality);
     docstring::FunctionDocInject(m_io, "write_image",
                                  map_shared_argument_docstrings);
+
+    m_io.def(
+            "read_tensor_map",
+            [](const std::string &filename, const core::Device &device) {
+                py::gil_scoped_release release;
+                t::geometry::TensorMap tensor_map("Undefined");
+                ReadTensorMap(filename, tensor_map, device);
+                return tensor_map;
+            },
+            "Function to read TensorMap from a native binary file.",
+            "filename"_a, "device"_a = core::Device("CPU:0"));
+    docstring::FunctionDocInject(m_io, "read_tensor_map",
+                                 map_shared_argument_docstrings);
+
+    m_io.def(
+            "write_tensor_map",
+            [](const std::string &filename,
+               const t::geometry::TensorMap &tensor_map, bool compressed) {
+                py::gil_scoped_release release;
+                return WriteTensorMap(filename, tensor_map, compressed);
+            },
+            "Function to write TensorMap to a native binary file.",
+            "filename"_a, "tensor_map"_a, "compressed"_a = false);
+    docstring::FunctionDocInject(m_io, "write_tensor_map",
+                                 map_shared_argument_docstrings);
 }
 
 }  // namespace io
@@ -28,6 +28,7 @@
 
 #include "open3d/geometry/RGBDImage.h"
 #include "open3d/t/io/sensor/RGBDSensor.h"
+#include "open3d/t/io/sensor/RGBDVideoPrefetcher.h"
 #include "open3d/t/io/sensor/RGBDVideoReader.h"
 #ifdef BUILD_LIBREALSENSE
 #include "open3d/t/io/sensor/realsense/RSBagReader.h"
@@ -56,7 +57,8 @@ void pybind_sensor(py::module &m) {
                      "(default video length) Save frames till this time (us)"},
                     {"buffer_size",
                      "Size of internal frame buffer, increase this if you "
-                     "experience frame drops."}};
+                     "experience frame drops."},
+                    {"device", "Device of the returned frames."}};
 
     py::enum_<SensorType>(m, "SensorType", "Sensor type")
             .value("AZURE_KINECT", SensorType::AZURE_KINECT)
@@ -161,6 +163,47 @@ void pybind_sensor(py::module &m) {
     docstring::ClassMethodDocInject(m, "RGBDVideoReader", "save_frames",
                                     map_shared_argument_docstrings);
 
+    // Class RGBD video prefetcher
+    py::class_<RGBDVideoPrefetcher, std::unique_ptr<RGBDVideoPrefetcher>,
+               RGBDVideoReader>
+            rgbd_video_prefetcher(
+                    m, "RGBDVideoPrefetcher",
+                    "Decodes the frames of an RGBD video reader on a "
+                    "background thread into a ring buffer, optionally "
+                    "uploading them to a device.");
+    rgbd_video_prefetcher
+            .def_static("create", &RGBDVideoPrefetcher::Create, "filename"_a,
+                        "buffer_size"_a =
+                                RGBDVideoPrefetcher::DEFAULT_BUFFER_SIZE,
+                        "device"_a = core::Device("CPU:0"),
+                        "Create a prefetching RGBD video reader based on "
+                        "filename")
+            .def("is_opened", &RGBDVideoPrefetcher::IsOpened,
+                 "Check if the RGBD video file is opened.")
+            .def("open", &RGBDVideoPrefetcher::Open,
+                 py::call_guard<py::gil_scoped_release>(), "filename"_a,
+                 "Open an RGBD video playback.")
+            .def("close", &RGBDVideoPrefetcher::Close,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Close the opened RGBD video playback.")
+            .def("is_eof", &RGBDVideoPrefetcher::IsEOF,
+                 "Check if all frames have been read.")
+            .def_property_readonly(
+                    "metadata",
+                    py::overload_cast<>(&RGBDVideoPrefetcher::GetMetadata,
+                                        py::const_),
+                    "Get metadata of the RGBD video playback.")
+            .def("seek_timestamp", &RGBDVideoPrefetcher::SeekTimestamp,
+                 py::call_guard<py::gil_scoped_release>(), "timestamp"_a,
+                 "Seek to the timestamp (in us).")
+            .def("get_timestamp", &RGBDVideoPrefetcher::GetTimestamp,
+                 "Get the timestamp (in us) of the last frame read.")
+            .def("next_frame", &RGBDVideoPrefetcher::NextFrame,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Get the next prefetched frame.");
+    docstring::ClassMethodDocInject(m, "RGBDVideoPrefetcher", "create",
+                                    map_shared_argument_docstrings);
+
     // Class RGBD sensor
     py::class_<RGBDSensor> rgbd_sensor(
             m, "RGBDSensor", "Interface class for control of RGBD cameras.");
@@ -30,6 +30,9 @@
 #include <utility>
 
 #include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/pipelines/registration/Feature.h"
+#include "open3d/t/pipelines/registration/GlobalOptimization.h"
+#include "open3d/t/pipelines/registration/PoseGraph.h"
 #include "open3d/t/pipelines/registration/TransformationEstimation.h"
 #include "open3d/utility/Logging.h"
 #include "pybind/docstring.h"
@@ -74,8 +77,10 @@ void pybind_registration_classes(py::module &m) {
     py::detail::bind_copy_functions<ICPConvergenceCriteria>(
             convergence_criteria);
     convergence_criteria
-            .def(py::init<double, double, int>(), "relative_fitness"_a = 1e-6,
-                 "relative_rmse"_a = 1e-6, "max_iteration"_a = 30)
+            .def(py::init<double, double, int, double>(),
+                 "relative_fitness"_a = 1e-6, "relative_rmse"_a = 1e-6,
+                 "max_iteration"_a = 30,
+                 "correspondence_reuse_distance"_a = 0.0)
             .def_readwrite(
                     "relative_fitness",
                     &ICPConvergenceCriteria::relative_fitness_,
@@ -88,12 +93,76 @@ void pybind_registration_classes(py::module &m) {
             .def_readwrite("max_iteration",
                            &ICPConvergenceCriteria::max_iteration_,
                            "Maximum iteration before iteration stops.")
+            .def_readwrite(
+                    "correspondence_reuse_distance",
+                    &ICPConvergenceCriteria::correspondence_reuse_distance_,
+                    "If positive, the previous correspondences are reused "
+                    "while the source points have moved less than "
+                    "``correspondence_reuse_distance`` since the last nearest "
+                    "neighbor search.")
             .def("__repr__", [](const ICPConvergenceCriteria &c) {
                 return fmt::format(
                         "ICPConvergenceCriteria[relative_fitness_={:e}, "
-                        "relative_rmse={:e}, max_iteration_={:d}].",
+                        "relative_rmse={:e}, max_iteration_={:d}, "
+                        "correspondence_reuse_distance={:e}].",
                         c.relative_fitness_, c.relative_rmse_,
-                        c.max_iteration_);
+                        c.max_iteration_, c.correspondence_reuse_distance_);
+            });
+
+    // open3d.t.pipelines.registration.RANSACConvergenceCriteria
+    py::class_<RANSACConvergenceCriteria> ransac_criteria(
+            m, "RANSACConvergenceCriteria",
+            "Convergence criteria of RANSAC. RANSAC estimates and scores "
+            "batches of ``batch_size`` hypotheses, and stops after "
+            "``max_iteration`` hypotheses or once the best hypothesis has "
+            "been found with the desired ``confidence``.");
+    py::detail::bind_copy_functions<RANSACConvergenceCriteria>(
+            ransac_criteria);
+    ransac_criteria
+            .def(py::init<int, double, int>(), "max_iteration"_a = 100000,
+                 "confidence"_a = 0.999, "batch_size"_a = 1000)
+            .def_readwrite("max_iteration",
+                           &RANSACConvergenceCriteria::max_iteration_,
+                           "Maximum number of hypotheses.")
+            .def_readwrite("confidence",
+                           &RANSACConvergenceCriteria::confidence_,
+                           "Desired probability of success.")
+            .def_readwrite("batch_size",
+                           &RANSACConvergenceCriteria::batch_size_,
+                           "Number of hypotheses estimated and scored "
+                           "together.")
+            .def("__repr__", [](const RANSACConvergenceCriteria &c) {
+                return fmt::format(
+                        "RANSACConvergenceCriteria[max_iteration_={:d}, "
+                        "confidence_={:e}, batch_size_={:d}].",
+                        c.max_iteration_, c.confidence_, c.batch_size_);
+            });
+
+    // open3d.t.pipelines.registration.ICPTarget
+    py::class_<ICPTarget> icp_target(
+            m, "ICPTarget",
+            "Target of ICP prepared once for repeated registrations, holding "
+            "the downsampled target and its nearest neighbor index for each "
+            "scale.");
+    py::detail::bind_copy_functions<ICPTarget>(icp_target);
+    icp_target
+            .def(py::init<const t::geometry::PointCloud &, double>(),
+                 "target"_a, "max_correspondence_distance"_a)
+            .def(py::init<const t::geometry::PointCloud &,
+                          const std::vector<double> &,
+                          const std::vector<double> &>(),
+                 "target"_a, "voxel_sizes"_a,
+                 "max_correspondence_distances"_a)
+            .def("num_scales", &ICPTarget::NumScales,
+                 "Returns the number of scales.")
+            .def_readonly("voxel_sizes", &ICPTarget::voxel_sizes_,
+                          "Voxel sizes of the scales, from coarse to fine.")
+            .def_readonly("max_correspondence_distances",
+                          &ICPTarget::max_correspondence_distances_,
+                          "Maximum correspondence distances of the scales.")
+            .def("__repr__", [](const ICPTarget &target) {
+                return fmt::format("ICPTarget with {} scales.",
+                                   target.NumScales());
             });
 
     // open3d.t.pipelines.registration.RegistrationResult
@@ -196,6 +265,104 @@ void pybind_registration_classes(py::module &m) {
                  [](const TransformationEstimationPointToPlane &te) {
                      return std::string("TransformationEstimationPointToPlane");
                  });
+
+    // open3d.t.pipelines.registration.TransformationEstimationForGeneralizedICP
+    // TransformationEstimation
+    py::class_<TransformationEstimationForGeneralizedICP,
+               PyTransformationEstimation<
+                       TransformationEstimationForGeneralizedICP>,
+               TransformationEstimation>
+            te_gicp(m, "TransformationEstimationForGeneralizedICP",
+                    "Class to estimate a transformation for generalized ICP "
+                    "(plane to plane), with point covariances regularized "
+                    "from the normals of the source and target.");
+    py::detail::bind_copy_functions<TransformationEstimationForGeneralizedICP>(
+            te_gicp);
+    te_gicp.def(py::init<double>(), "epsilon"_a = 1e-3)
+            .def_readwrite(
+                    "epsilon",
+                    &TransformationEstimationForGeneralizedICP::epsilon_,
+                    "Covariance of a point along its normal, relative to the "
+                    "tangent directions.")
+            .def("__repr__",
+                 [](const TransformationEstimationForGeneralizedICP &te) {
+                     return fmt::format(
+                             "TransformationEstimationForGeneralizedICP("
+                             "epsilon={:e})",
+                             te.epsilon_);
+                 });
+
+    // open3d.t.pipelines.registration.TransformationEstimationForColoredICP
+    // TransformationEstimation
+    py::class_<TransformationEstimationForColoredICP,
+               PyTransformationEstimation<
+                       TransformationEstimationForColoredICP>,
+               TransformationEstimation>
+            te_cicp(m, "TransformationEstimationForColoredICP",
+                    "Class to estimate a transformation for colored ICP, "
+                    "from the point to plane distances and the intensity "
+                    "differences of the correspondences.");
+    py::detail::bind_copy_functions<TransformationEstimationForColoredICP>(
+            te_cicp);
+    te_cicp.def(py::init<double>(), "lambda_geometric"_a = 0.968)
+            .def_readwrite(
+                    "lambda_geometric",
+                    &TransformationEstimationForColoredICP::lambda_geometric_,
+                    "Weight of the geometric term, the photometric term is "
+                    "weighted by 1 - lambda_geometric.")
+            .def("__repr__",
+                 [](const TransformationEstimationForColoredICP &te) {
+                     return fmt::format(
+                             "TransformationEstimationForColoredICP("
+                             "lambda_geometric={:f})",
+                             te.lambda_geometric_);
+                 });
+
+    // open3d.t.pipelines.registration.PoseGraph
+    py::class_<PoseGraph> pose_graph(
+            m, "PoseGraph",
+            "Pose graph whose nodes and edges are stored as batched tensors "
+            "on a device, optimized by ``global_optimization``.");
+    py::detail::bind_copy_functions<PoseGraph>(pose_graph);
+    pose_graph
+            .def(py::init<const core::Device &>(),
+                 "device"_a = core::Device("CPU:0"))
+            .def(py::init<const core::Tensor &, const core::Tensor &,
+                          const core::Tensor &, const core::Tensor &,
+                          const core::Tensor &, const core::Tensor &>(),
+                 "poses"_a, "edge_indices"_a, "edge_transformations"_a,
+                 "edge_information"_a, "edge_confidence"_a,
+                 "edge_uncertain"_a)
+            .def_readwrite("poses", &PoseGraph::poses_,
+                           "``{N, 4, 4}`` float64 tensor: Node poses.")
+            .def_readwrite("edge_indices", &PoseGraph::edge_indices_,
+                           "``{E, 2}`` int64 tensor: Source and target node "
+                           "of the edges.")
+            .def_readwrite("edge_transformations",
+                           &PoseGraph::edge_transformations_,
+                           "``{E, 4, 4}`` float64 tensor: Transformation of "
+                           "the edges.")
+            .def_readwrite("edge_information", &PoseGraph::edge_information_,
+                           "``{E, 6, 6}`` float64 tensor: Information matrix "
+                           "of the edges.")
+            .def_readwrite("edge_confidence", &PoseGraph::edge_confidence_,
+                           "``{E}`` float64 tensor: Confidence of the edges.")
+            .def_readwrite("edge_uncertain", &PoseGraph::edge_uncertain_,
+                           "``{E}`` bool tensor: Whether the edges are "
+                           "uncertain.")
+            .def("to", &PoseGraph::To,
+                 "Returns a copy of the pose graph on the device.", "device"_a)
+            .def_static("from_legacy", &PoseGraph::FromLegacy,
+                        "Creates a pose graph from a legacy pose graph.",
+                        "pose_graph"_a, "device"_a = core::Device("CPU:0"))
+            .def("to_legacy", &PoseGraph::ToLegacy,
+                 "Converts to a legacy pose graph.")
+            .def("__repr__", [](const PoseGraph &pg) {
+                return fmt::format(
+                        "PoseGraph with {:d} nodes and {:d} edges on {}.",
+                        pg.GetNodeCount(), pg.GetEdgeCount(),
+                        pg.GetDevice().ToString());
+            });
 }
 
 // Registration functions have similar arguments, sharing arg docstrings.
@@ -211,7 +378,9 @@ static const std::unordered_map<std::string, std::string>
                 {"estimation_method",
                  "Estimation method. One of "
                  "(``TransformationEstimationPointToPoint``, "
-                 "``TransformationEstimationPointToPlane``)"},
+                 "``TransformationEstimationPointToPlane``, "
+                 "``TransformationEstimationForColoredICP``, "
+                 "``TransformationEstimationForGeneralizedICP``)"},
                 {"init_source_to_target", "Initial transformation estimation"},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
@@ -219,6 +388,7 @@ static const std::unordered_map<std::string, std::string>
                  "o3d.utility.DoubleVector of maximum correspondence "
                  "points-pair distances for multi-scale icp."},
                 {"option", "Registration option"},
+                {"ransac_n", "Fit ransac with ``ransac_n`` correspondences"},
                 {"source", "The source point cloud."},
                 {"target", "The target point cloud."},
                 {"transformation",
@@ -238,7 +408,12 @@ void pybind_registration_methods(py::module &m) {
     docstring::FunctionDocInject(m, "evaluate_registration",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_icp", &RegistrationICP,
+    m.def("registration_icp",
+          py::overload_cast<const t::geometry::PointCloud &,
+                            const t::geometry::PointCloud &, double,
+                            const core::Tensor &,
+                            const TransformationEstimation &,
+                            const ICPConvergenceCriteria &>(&RegistrationICP),
           py::call_guard<py::gil_scoped_release>(),
           "Function for ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
@@ -246,18 +421,97 @@ void pybind_registration_methods(py::module &m) {
                                                         core::Device("CPU:0")),
           "estimation_method"_a = TransformationEstimationPointToPoint(),
           "criteria"_a = ICPConvergenceCriteria());
+    m.def("registration_icp",
+          py::overload_cast<const t::geometry::PointCloud &, const ICPTarget &,
+                            const core::Tensor &,
+                            const TransformationEstimation &,
+                            const ICPConvergenceCriteria &>(&RegistrationICP),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for ICP registration against a prepared target",
+          "source"_a, "target"_a,
+          "init_source_to_target"_a = core::Tensor::Eye(4, core::Dtype::Float64,
+                                                        core::Device("CPU:0")),
+          "estimation_method"_a = TransformationEstimationPointToPoint(),
+          "criteria"_a = ICPConvergenceCriteria());
     docstring::FunctionDocInject(m, "registration_icp",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_multi_scale_icp", &RegistrationMultiScaleICP,
+    m.def("registration_multi_scale_icp",
+          py::overload_cast<const t::geometry::PointCloud &,
+                            const t::geometry::PointCloud &,
+                            const std::vector<double> &,
+                            const std::vector<ICPConvergenceCriteria> &,
+                            const std::vector<double> &, const core::Tensor &,
+                            const TransformationEstimation &>(
+                  &RegistrationMultiScaleICP),
           py::call_guard<py::gil_scoped_release>(),
           "Function for Multi-Scale ICP registration", "source"_a, "target"_a,
           "voxel_sizes"_a, "criteria_list"_a, "max_correspondence_distances"_a,
           "init_source_to_target"_a = core::Tensor::Eye(4, core::Dtype::Float64,
                                                         core::Device("CPU:0")),
           "estimation_method"_a = TransformationEstimationPointToPoint());
+    m.def("registration_multi_scale_icp",
+          py::overload_cast<const t::geometry::PointCloud &, const ICPTarget &,
+                            const std::vector<ICPConvergenceCriteria> &,
+                            const core::Tensor &,
+                            const TransformationEstimation &>(
+                  &RegistrationMultiScaleICP),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for Multi-Scale ICP registration against a prepared "
+          "target",
+          "source"_a, "target"_a, "criteria_list"_a,
+          "init_source_to_target"_a = core::Tensor::Eye(4, core::Dtype::Float64,
+                                                        core::Device("CPU:0")),
+          "estimation_method"_a = TransformationEstimationPointToPoint());
     docstring::FunctionDocInject(m, "registration_multi_scale_icp",
                                  map_shared_argument_docstrings);
+
+    m.def("registration_ransac_based_on_correspondence",
+          &RegistrationRANSACBasedOnCorrespondence,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for global RANSAC registration based on a set of "
+          "correspondences, estimating and scoring batches of hypotheses on "
+          "the device of the point clouds.",
+          "source"_a, "target"_a, "correspondences"_a,
+          "max_correspondence_distance"_a, "ransac_n"_a = 3,
+          "criteria"_a = RANSACConvergenceCriteria());
+    docstring::FunctionDocInject(m,
+                                 "registration_ransac_based_on_correspondence",
+                                 map_shared_argument_docstrings);
+
+    m.def("compute_fpfh_feature", &ComputeFPFHFeature,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to compute FPFH feature for a point cloud. It uses KNN "
+          "search if only max_nn parameter is provided, radius search if only "
+          "radius parameter is provided, and hybrid search if both are "
+          "provided.",
+          "input"_a, "max_nn"_a = 100, "radius"_a = py::none());
+    docstring::FunctionDocInject(
+            m, "compute_fpfh_feature",
+            {{"input", "The input point cloud with normals."},
+             {"max_nn", "Maximum number of neighbors."},
+             {"radius", "Radius of the neighborhood."}});
+
+    // The legacy criteria and option are bound after this module, so they
+    // cannot be used as default arguments.
+    m.def("global_optimization", &GlobalOptimization,
+          py::call_guard<py::gil_scoped_release>(),
+          "Function to optimize a tensor pose graph on its device with "
+          "Levenberg-Marquardt and line process weights.",
+          "pose_graph"_a, "criteria"_a, "option"_a);
+    m.def(
+            "global_optimization",
+            [](PoseGraph &pose_graph) { GlobalOptimization(pose_graph); },
+            py::call_guard<py::gil_scoped_release>(),
+            "Function to optimize a tensor pose graph on its device with "
+            "Levenberg-Marquardt and line process weights, with the default "
+            "criteria and option.",
+            "pose_graph"_a);
+    docstring::FunctionDocInject(
+            m, "global_optimization",
+            {{"pose_graph", "The pose graph to be optimized (in-place)."},
+             {"criteria", "Global optimization convergence criteria."},
+             {"option", "Global optimization option."}});
 }
 
 void pybind_registration(py::module &m) {
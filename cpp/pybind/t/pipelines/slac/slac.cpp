@@ -158,7 +158,7 @@ void pybind_slac_classes(py::module &m) {
                     "with 8 corners via indexing and interpolation. "
                     "Returns: A PointCloud with parameterization attributes: "
                     "\n- neighbors: Index of 8 neighbor control grid points of "
-                    "shape (8, ) in Int64. "
+                    "shape (8, ) in Int32. "
                     "\n- ratios: Interpolation ratios of 8 neighbor control "
                     "grid points of shape (8, ) in Float32.",
                     "pointcloud"_a)
@@ -168,7 +168,10 @@ void pybind_slac_classes(py::module &m) {
                        const geometry::PointCloud &pcd) {
                         return control_grid.Deform(pcd);
                     },
-                    "Non-rigidly deform a point cloud using the control grid.",
+                    "Non-rigidly deform a point cloud using the control grid. "
+                    "Point clouds that are not parameterized are deformed in "
+                    "a single pass, discarding points without all 8 "
+                    "neighbors in the grid.",
                     "pointcloud"_a)
             .def(
                     "deform",
@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstring>
+
 #include "pybind/docstring.h"
 #include "pybind/open3d_pybind.h"
 
@@ -46,6 +48,29 @@ py::class_<Vector, holder_type> bind_vector_without_repr(
     return cl;
 }
 
+// Copies a C-contiguous (n, EigenVector::SizeAtCompileTime) array into
+// \p eigen_vectors with a single memcpy. The Eigen vector types bound here have
+// no padding, so std::vector<EigenVector> has the same row-major layout as the
+// numpy array.
+template <typename EigenVector, typename Scalar, typename EigenAllocator>
+void py_array_copy_to_vectors(
+        const py::array_t<Scalar, py::array::c_style | py::array::forcecast>
+                &array,
+        std::vector<EigenVector, EigenAllocator> &eigen_vectors) {
+    static_assert(sizeof(EigenVector) ==
+                          sizeof(Scalar) * EigenVector::SizeAtCompileTime,
+                  "EigenVector must not be padded.");
+    int64_t eigen_vector_size = EigenVector::SizeAtCompileTime;
+    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
+        throw py::cast_error();
+    }
+    eigen_vectors.resize(array.shape(0));
+    if (!eigen_vectors.empty()) {
+        std::memcpy(eigen_vectors.data(), array.data(),
+                    sizeof(EigenVector) * eigen_vectors.size());
+    }
+}
+
 // - This function is used by Pybind for std::vector<SomeEigenType> constructor.
 //   This optional constructor is added to avoid too many Python <-> C++ API
 //   calls when the vector size is large using the default biding method.
@@ -53,36 +78,22 @@ py::class_<Vector, holder_type> bind_vector_without_repr(
 // - Directly using templates for the py::array_t<double> and py::array_t<int>
 //   and etc. doesn't work. The current solution is to explicitly implement
 //   bindings for each py array types.
+// - A std::vector cannot adopt the numpy buffer, so the constructors copy
+//   once. Arrays that are already C-contiguous with the matching dtype are not
+//   converted by forcecast beforehand.
 template <typename EigenVector>
 std::vector<EigenVector> py_array_to_vectors_double(
         py::array_t<double, py::array::c_style | py::array::forcecast> array) {
-    int64_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
-        throw py::cast_error();
-    }
-    std::vector<EigenVector> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        // The EigenVector here must be a double-typed eigen vector, since only
-        // open3d::Vector3dVector binds to py_array_to_vectors_double.
-        // Therefore, we can use the memory map directly.
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
+    std::vector<EigenVector> eigen_vectors;
+    py_array_copy_to_vectors(array, eigen_vectors);
     return eigen_vectors;
 }
 
 template <typename EigenVector>
 std::vector<EigenVector> py_array_to_vectors_int(
         py::array_t<int, py::array::c_style | py::array::forcecast> array) {
-    int64_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
-        throw py::cast_error();
-    }
-    std::vector<EigenVector> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
+    std::vector<EigenVector> eigen_vectors;
+    py_array_copy_to_vectors(array, eigen_vectors);
     return eigen_vectors;
 }
 
@@ -91,15 +102,8 @@ template <typename EigenVector,
 std::vector<EigenVector, EigenAllocator>
 py_array_to_vectors_int_eigen_allocator(
         py::array_t<int, py::array::c_style | py::array::forcecast> array) {
-    int64_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
-        throw py::cast_error();
-    }
-    std::vector<EigenVector, EigenAllocator> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
+    std::vector<EigenVector, EigenAllocator> eigen_vectors;
+    py_array_copy_to_vectors(array, eigen_vectors);
     return eigen_vectors;
 }
 
@@ -108,15 +112,8 @@ template <typename EigenVector,
 std::vector<EigenVector, EigenAllocator>
 py_array_to_vectors_int64_eigen_allocator(
         py::array_t<int64_t, py::array::c_style | py::array::forcecast> array) {
-    int64_t eigen_vector_size = EigenVector::SizeAtCompileTime;
-    if (array.ndim() != 2 || array.shape(1) != eigen_vector_size) {
-        throw py::cast_error();
-    }
-    std::vector<EigenVector, EigenAllocator> eigen_vectors(array.shape(0));
-    auto array_unchecked = array.mutable_unchecked<2>();
-    for (auto i = 0; i < array_unchecked.shape(0); ++i) {
-        eigen_vectors[i] = Eigen::Map<EigenVector>(&array_unchecked(i, 0));
-    }
+    std::vector<EigenVector, EigenAllocator> eigen_vectors;
+    py_array_copy_to_vectors(array, eigen_vectors);
     return eigen_vectors;
 }
 
@@ -363,6 +360,16 @@ Example usage
 
     # From Open3D to numpy
     np_points = np.asarray(pcd.points)
+
+The constructor copies the array once; C-contiguous float64 arrays are copied
+without an intermediate conversion. ``np.asarray`` returns a view of the
+Open3D memory without copying, which stays valid while the vector is not
+resized. For zero-copy construction from numpy, use the tensor geometry:
+
+.. code-block:: python
+
+    pcd = open3d.t.geometry.PointCloud(
+        open3d.core.Tensor.from_numpy(np_points))
 )";
             }),
             py::none(), py::none(), "");
@@ -0,0 +1,95 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Parallel.h"
+
+#include <memory>
+
+#include "pybind/docstring.h"
+#include "pybind/open3d_pybind.h"
+#include "pybind/utility/utility.h"
+
+namespace open3d {
+namespace utility {
+
+namespace {
+
+/// Python context manager for ScopedNumThreads.
+class NumThreadsContextManager {
+public:
+    explicit NumThreadsContextManager(int num_threads)
+        : num_threads_(num_threads) {}
+
+    void Enter() { scope_.reset(new ScopedNumThreads(num_threads_)); }
+
+    void Exit() { scope_.reset(); }
+
+private:
+    int num_threads_;
+    std::unique_ptr<ScopedNumThreads> scope_;
+};
+
+}  // namespace
+
+void pybind_parallel(py::module& m) {
+    m.def("set_num_threads", &SetNumThreads,
+          "Set the maximum number of threads used by the parallel CPU code of "
+          "Open3D",
+          "num_threads"_a);
+    docstring::FunctionDocInject(
+            m, "set_num_threads",
+            {{"num_threads",
+              "The maximum number of threads. Values <= 0 restore the default, "
+              "which is ``OMP_NUM_THREADS`` if set or the number of logical "
+              "cores."}});
+
+    m.def("get_num_threads", &GetNumThreads,
+          "Get the maximum number of threads used by the parallel CPU code of "
+          "Open3D on the calling thread");
+    docstring::FunctionDocInject(m, "get_num_threads");
+
+    py::class_<NumThreadsContextManager>(m, "NumThreadsContextManager",
+                                         "A context manager to temporally "
+                                         "limit the number of threads of "
+                                         "Open3D on the calling thread")
+            .def(py::init<int>(),
+                 "Create a NumThreadsContextManager with a given number of "
+                 "threads",
+                 "num_threads"_a)
+            .def(
+                    "__enter__",
+                    [](NumThreadsContextManager& cm) { cm.Enter(); },
+                    "Enter the context manager")
+            .def(
+                    "__exit__",
+                    [](NumThreadsContextManager& cm, py::object exc_type,
+                       py::object exc_value,
+                       py::object traceback) { cm.Exit(); },
+                    "Exit the context manager");
+}
+
+}  // namespace utility
+}  // namespace open3d
@@ -35,6 +35,7 @@ void pybind_utility(py::module &m);
 
 void pybind_logging(py::module &m);
 void pybind_eigen(py::module &m);
+void pybind_parallel(py::module &m);
 
 }  // namespace utility
 }  // namespace open3d
@@ -180,6 +180,27 @@ std::shared_ptr<geometry::Image> RenderToDepthImageWithoutWindow(
             height);
 }
 
+std::pair<std::vector<std::shared_ptr<geometry::Image>>,
+          std::vector<std::shared_ptr<geometry::Image>>>
+RenderToImagesWithoutWindow(rendering::Open3DScene *scene,
+                            int width,
+                            int height,
+                            const std::vector<Eigen::Matrix4d> &extrinsics,
+                            bool depth,
+                            int max_frames_in_flight) {
+    auto rendered = Application::GetInstance().RenderToImages(
+            scene->GetRenderer(), scene->GetView(), scene->GetScene(), width,
+            height, extrinsics, depth, max_frames_in_flight);
+    std::vector<std::shared_ptr<geometry::Image>> colors, depths;
+    for (auto &images : rendered) {
+        colors.push_back(images.color);
+        if (depth) {
+            depths.push_back(images.depth);
+        }
+    }
+    return std::make_pair(colors, depths);
+}
+
 enum class EventCallbackResult { IGNORED = 0, HANDLED, CONSUMED };
 
 void pybind_gui_classes(py::module &m) {
@@ -497,6 +518,27 @@ void pybind_gui_classes(py::module &m) {
                  "show_menu(show): shows or hides the menu in the window, "
                  "except on macOS since the menubar is not in the window "
                  "and all applications must have a menubar.")
+            .def("show_frame_statistics", &PyWindow::ShowFrameStatistics,
+                 "show"_a, "Shows or hides an overlay with the average UI, "
+                 "scene rendering and present times of the window's frames. "
+                 "Showing it also enables frame profiling")
+            .def(
+                    "set_frame_profiling",
+                    [](PyWindow &w, bool enabled) {
+                        w.GetFrameProfiler().SetEnabled(enabled);
+                    },
+                    "enabled"_a,
+                    "Enables or disables recording the timings of the "
+                    "window's frames, without showing them")
+            .def(
+                    "write_frame_trace",
+                    [](PyWindow &w, const std::string &path) {
+                        return w.GetFrameProfiler().WriteTrace(path);
+                    },
+                    "path"_a,
+                    "Writes the timings of the recently profiled frames as "
+                    "a Chrome trace event file, which can be opened in "
+                    "chrome://tracing or Perfetto")
             .def_property_readonly(
                     "renderer", &PyWindow::GetRenderer,
                     "Gets the rendering.Renderer object for the Window");
@@ -45,6 +45,14 @@ std::shared_ptr<geometry::Image> RenderToImageWithoutWindow(
         rendering::Open3DScene *scene, int width, int height);
 std::shared_ptr<geometry::Image> RenderToDepthImageWithoutWindow(
         rendering::Open3DScene *scene, int width, int height);
+std::pair<std::vector<std::shared_ptr<geometry::Image>>,
+          std::vector<std::shared_ptr<geometry::Image>>>
+RenderToImagesWithoutWindow(rendering::Open3DScene *scene,
+                            int width,
+                            int height,
+                            const std::vector<Eigen::Matrix4d> &extrinsics,
+                            bool depth,
+                            int max_frames_in_flight);
 
 void pybind_gui(py::module &m);
 
@@ -78,6 +78,16 @@ public:
         return gui::RenderToDepthImageWithoutWindow(scene_, width_, height_);
     }
 
+    std::pair<std::vector<std::shared_ptr<geometry::Image>>,
+              std::vector<std::shared_ptr<geometry::Image>>>
+    RenderToImages(const std::vector<Eigen::Matrix4d> &extrinsics,
+                   bool depth,
+                   int max_frames_in_flight) {
+        return gui::RenderToImagesWithoutWindow(scene_, width_, height_,
+                                                extrinsics, depth,
+                                                max_frames_in_flight);
+    }
+
     void SetupCamera(const camera::PinholeCameraIntrinsic &intrinsic,
                      const Eigen::Matrix4d &extrinsic) {
         SetupCamera(intrinsic.intrinsic_matrix_, extrinsic, intrinsic.width_,
@@ -207,7 +217,16 @@ void pybind_rendering_classes(py::module &m) {
                  &PyOffscreenRenderer::RenderToDepthImage,
                  "Renders scene depth buffer to a float image, blocking until "
                  "the image is returned. Pixels range from 0 (near plane) to "
-                 "1 (far plane)");
+                 "1 (far plane)")
+            .def("render_to_images", &PyOffscreenRenderer::RenderToImages,
+                 "extrinsics"_a, "depth"_a = false,
+                 "max_frames_in_flight"_a = 8,
+                 "Renders the scene once for each extrinsic matrix, keeping "
+                 "the current camera projection, and returns a tuple of the "
+                 "list of color images and the list of depth images (empty "
+                 "unless depth is True). Up to max_frames_in_flight poses are "
+                 "rendered and read back together, which is much faster than "
+                 "calling render_to_image() for each pose");
 
     // ---- Camera ----
     py::class_<Camera, std::shared_ptr<Camera>> cam(m, "Camera",
@@ -491,6 +510,11 @@ void pybind_rendering_classes(py::module &m) {
                  "The flags should be ORed from Scene.UPDATE_POINTS_FLAG, "
                  "Scene.UPDATE_NORMALS_FLAG, Scene.UPDATE_COLORS_FLAG, and "
                  "Scene.UPDATE_UV0_FLAG")
+            .def("update_geometry_range", &Scene::UpdateGeometryRange,
+                 "name"_a, "point_cloud"_a, "update_flag"_a, "first_point"_a,
+                 "Updates the flagged arrays of the points starting at "
+                 "first_point from the tgeometry.PointCloud, growing the "
+                 "buffers if needed. Returns False if the update failed.")
             .def("enable_indirect_light", &Scene::EnableIndirectLight,
                  "Enables or disables indirect lighting")
             .def("set_indirect_light", &Scene::SetIndirectLight,
@@ -0,0 +1,144 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/BatchedNearestNeighborSearch.h"
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class BatchedNNSPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(BatchedNearestNeighborSearch,
+                         BatchedNNSPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// Two clouds of 4 and 3 points on the x axis, and an empty third cloud.
+static core::Tensor DatasetPoints(const core::Device& device) {
+    std::vector<float> points{0.0, 0.0, 0.0, 0.1, 0.0, 0.0, 0.2, 0.0, 0.0,
+                              0.3, 0.0, 0.0, 1.0, 0.0, 0.0, 1.1, 0.0, 0.0,
+                              1.3, 0.0, 0.0};
+    return core::Tensor(points, {7, 3}, core::Dtype::Float32, device);
+}
+
+TEST_P(BatchedNNSPermuteDevices, KnnSearch) {
+    core::Device device = GetParam();
+    core::nns::BatchedNearestNeighborSearch nns(
+            DatasetPoints(device),
+            core::Tensor::Init<int64_t>({0, 4, 7, 7}, device));
+    nns.BuildIndex();
+
+    // One query for the first cloud, two for the second, one for the third.
+    core::Tensor query(std::vector<float>({0.12, 0.0, 0.0, 1.08, 0.0, 0.0,
+                                           1.25, 0.0, 0.0, 0.0, 0.0, 0.0}),
+                       {4, 3}, core::Dtype::Float32, device);
+    core::Tensor queries_row_splits =
+            core::Tensor::Init<int64_t>({0, 1, 3, 4}, device);
+
+    core::Tensor indices, distances, row_splits;
+    std::tie(indices, distances, row_splits) =
+            nns.KnnSearch(query, queries_row_splits, 2);
+    ExpectEQ(indices.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 2, 5, 4, 6, 5}));
+    ExpectEQ(row_splits.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({0, 2, 4, 6, 6}));
+    ExpectEQ(distances.ToFlatVector<float>(),
+             std::vector<float>({0.0004, 0.0064, 0.0004, 0.0064, 0.0025,
+                                 0.0225}));
+
+    // knn is clamped to the size of each cloud.
+    std::tie(indices, distances, row_splits) =
+            nns.KnnSearch(query, queries_row_splits, 4);
+    ExpectEQ(row_splits.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({0, 4, 7, 10, 10}));
+
+    // Mismatching batch sizes.
+    EXPECT_THROW(nns.KnnSearch(query,
+                               core::Tensor::Init<int64_t>({0, 4}, device), 2),
+                 std::runtime_error);
+}
+
+TEST_P(BatchedNNSPermuteDevices, FixedRadiusSearch) {
+    core::Device device = GetParam();
+    core::nns::BatchedNearestNeighborSearch nns(
+            DatasetPoints(device),
+            core::Tensor::Init<int64_t>({0, 4, 7, 7}, device));
+    nns.BuildIndex();
+
+    core::Tensor query(std::vector<float>({0.12, 0.0, 0.0, 1.04, 0.0, 0.0,
+                                           1.25, 0.0, 0.0, 0.0, 0.0, 0.0}),
+                       {4, 3}, core::Dtype::Float32, device);
+    core::Tensor queries_row_splits =
+            core::Tensor::Init<int64_t>({0, 1, 3, 4}, device);
+
+    core::Tensor indices, distances, row_splits;
+    std::tie(indices, distances, row_splits) =
+            nns.FixedRadiusSearch(query, queries_row_splits, 0.11);
+    ExpectEQ(indices.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 2, 4, 5, 6}));
+    ExpectEQ(row_splits.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({0, 2, 4, 5, 5}));
+
+    core::Tensor counts;
+    std::tie(indices, distances, counts) =
+            nns.HybridSearch(query, queries_row_splits, 0.11, 2);
+    ExpectEQ(indices.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 2, 4, 5, 6, -1, -1, -1}));
+    ExpectEQ(counts.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({2, 2, 1, 0}));
+}
+
+TEST_P(BatchedNNSPermuteDevices, RadiusSearchL1) {
+    core::Device device = GetParam();
+    core::nns::BatchedNearestNeighborSearch nns(
+            DatasetPoints(device),
+            core::Tensor::Init<int64_t>({0, 4, 7, 7}, device),
+            core::nns::L1);
+    nns.BuildIndex();
+
+    core::Tensor query(std::vector<float>({0.12, 0.05, 0.0, 1.04, 0.0, 0.0,
+                                           1.25, 0.0, 0.0, 0.0, 0.0, 0.0}),
+                       {4, 3}, core::Dtype::Float32, device);
+    core::Tensor queries_row_splits =
+            core::Tensor::Init<int64_t>({0, 1, 3, 4}, device);
+    core::Tensor radii =
+            core::Tensor::Init<float>({0.15, 0.05, 0.2, 1.0}, device);
+
+    // The L1 distances of the first query are 0.17, 0.07, 0.13 and 0.23.
+    core::Tensor indices, distances, row_splits;
+    std::tie(indices, distances, row_splits) =
+            nns.RadiusSearch(query, queries_row_splits, radii, false);
+    ExpectEQ(indices.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 2, 4, 5, 6}));
+    ExpectEQ(row_splits.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({0, 2, 3, 5, 5}));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -28,6 +28,7 @@
 
 #include "open3d/core/CUDAState.cuh"
 
+#include "open3d/core/Tensor.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -45,6 +46,59 @@ TEST(CUDAState, InitState) {
     }
 }
 
+TEST(CUDAState, ScopedStream) {
+    if (!core::cuda::IsAvailable()) {
+        GTEST_SKIP() << "No CUDA device available.";
+    }
+    core::Device device("CUDA:0");
+    core::CUDAStream stream(device);
+    EXPECT_TRUE(core::CUDAStream::IsCurrentDefault());
+    {
+        core::CUDAScopedStream scoped_stream(stream);
+        EXPECT_EQ(core::CUDAStream::GetCurrent(), stream.Get());
+        {
+            core::CUDAStream inner_stream(device);
+            core::CUDAScopedStream inner_scoped_stream(inner_stream);
+            EXPECT_EQ(core::CUDAStream::GetCurrent(), inner_stream.Get());
+        }
+        EXPECT_EQ(core::CUDAStream::GetCurrent(), stream.Get());
+    }
+    EXPECT_TRUE(core::CUDAStream::IsCurrentDefault());
+}
+
+TEST(CUDAState, StreamExecution) {
+    if (!core::cuda::IsAvailable()) {
+        GTEST_SKIP() << "No CUDA device available.";
+    }
+    core::Device device("CUDA:0");
+    core::CUDAStream upload_stream(device);
+    core::CUDAStream compute_stream(device);
+    core::CUDAEvent uploaded;
+
+    core::Tensor src_cpu = core::Tensor::Arange(0, 1 << 20, 1,
+                                                core::Dtype::Int64,
+                                                core::Device("CPU:0"));
+    core::Tensor src;
+    {
+        core::CUDAScopedStream scoped_stream(upload_stream);
+        src = src_cpu.To(device);
+        uploaded.Record();
+    }
+
+    core::Tensor dst;
+    {
+        core::CUDAScopedStream scoped_stream(compute_stream);
+        uploaded.Wait();
+        dst = (src * 2 + 1).Sum({0});
+        compute_stream.Synchronize();
+        EXPECT_TRUE(compute_stream.Query());
+    }
+    EXPECT_TRUE(uploaded.Query());
+
+    core::Tensor expected = (src_cpu * 2 + 1).Sum({0});
+    EXPECT_EQ(dst.Item<int64_t>(), expected.Item<int64_t>());
+}
+
 }  // namespace tests
 }  // namespace open3d
 
@@ -68,5 +68,58 @@ TEST(FixedRadiusIndex, SearchRadius) {
              std::vector<float>({0.00626358, 0.00747938}));
 }
 
+TEST(FixedRadiusIndex, InsertRemovePoints) {
+    core::Device device = core::Device("CUDA:0");
+    int size = 10;
+    std::vector<float> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0, 0.2, 0.0,
+                              0.1, 0.0, 0.0, 0.1, 0.1, 0.0, 0.1, 0.2, 0.0, 0.2,
+                              0.0, 0.0, 0.2, 0.1, 0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float32, device);
+    float radius = 0.1;
+    core::nns::FixedRadiusIndex index(ref, radius);
+    index.SetRebuildFraction(1.0);
+
+    core::Tensor query(std::vector<float>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float32, device);
+
+    // The inserted point is the closest one and gets the next id.
+    core::Tensor new_points(std::vector<float>({0.06, 0.04, 0.08}), {1, 3},
+                            core::Dtype::Float32, device);
+    core::Tensor ids = index.InsertPoints(new_points);
+    ExpectEQ(ids.ToFlatVector<int64_t>(), std::vector<int64_t>({10}));
+    EXPECT_EQ(index.GetNumPendingPoints(), 1);
+    EXPECT_EQ(index.GetNumPoints(), 11);
+
+    core::Tensor indices, distances, row_splits;
+    std::tie(indices, distances, row_splits) =
+            index.SearchRadius(query, radius);
+    ExpectEQ(indices.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({10, 1, 4}));
+    ExpectEQ(row_splits.ToFlatVector<int64_t>(), std::vector<int64_t>({0, 3}));
+
+    // Removed points are skipped before and after the rebuild.
+    index.RemovePoints(core::Tensor::Init<int64_t>({1}, device));
+    EXPECT_EQ(index.GetNumPoints(), 10);
+    std::tie(indices, distances, row_splits) =
+            index.SearchRadius(query, radius);
+    ExpectEQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({10, 4}));
+
+    index.Rebuild();
+    EXPECT_EQ(index.GetNumPendingPoints(), 0);
+    std::tie(indices, distances, row_splits) =
+            index.SearchRadius(query, radius);
+    ExpectEQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({10, 4}));
+
+    core::Tensor counts;
+    std::tie(indices, distances, counts) =
+            index.SearchHybrid(query, radius, 3);
+    ExpectEQ(indices.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({10, 4, -1}));
+    ExpectEQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({2}));
+
+    EXPECT_THROW(index.RemovePoints(core::Tensor::Init<int64_t>({11}, device)),
+                 std::runtime_error);
+}
+
 }  // namespace tests
 }  // namespace open3d
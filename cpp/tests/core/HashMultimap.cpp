@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/hashmap/HashMultimap.h"
+
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class HashMultimapPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(HashMultimap,
+                         HashMultimapPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(HashMultimapPermuteDevices, InsertFind) {
+    core::Device device = GetParam();
+    std::vector<core::HashmapBackend> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashmapBackend::Slab);
+        backends.push_back(core::HashmapBackend::StdGPU);
+    } else {
+        backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
+    }
+
+    for (auto backend : backends) {
+        // Small capacity to rehash between insertions.
+        core::HashMultimap multimap(2, core::Dtype::Int32, core::Dtype::Int64,
+                                    {2}, {1}, device, backend);
+        core::Tensor keys = core::Tensor::Init<int>(
+                {{0, 0}, {1, 1}, {0, 0}, {2, 2}, {0, 0}}, device);
+        core::Tensor values =
+                core::Tensor::Init<int64_t>({{0}, {1}, {2}, {3}, {4}}, device);
+        multimap.Insert(keys, values);
+        EXPECT_EQ(multimap.Size(), 3);
+
+        core::Tensor more_keys =
+                core::Tensor::Init<int>({{1, 1}, {3, 3}, {4, 4}}, device);
+        core::Tensor more_values =
+                core::Tensor::Init<int64_t>({{5}, {6}, {7}}, device);
+        multimap.Insert(more_keys, more_values);
+        EXPECT_EQ(multimap.Size(), 5);
+        EXPECT_EQ(multimap.GetNumValues(), 8);
+
+        core::Tensor query = core::Tensor::Init<int>(
+                {{1, 1}, {9, 9}, {0, 0}, {3, 3}}, device);
+        core::Tensor offsets, found_values;
+        multimap.Find(query, offsets, found_values);
+        EXPECT_EQ(offsets.ToFlatVector<int64_t>(),
+                  std::vector<int64_t>({0, 2, 2, 5, 6}));
+        EXPECT_EQ(found_values.GetShape(), core::SizeVector({6, 1}));
+        // Values are grouped per key in insertion order.
+        EXPECT_EQ(found_values.ToFlatVector<int64_t>(),
+                  std::vector<int64_t>({1, 5, 0, 2, 4, 6}));
+
+        core::Tensor masks;
+        multimap.Erase(core::Tensor::Init<int>({{0, 0}, {8, 8}}, device),
+                       masks);
+        EXPECT_EQ(masks.ToFlatVector<bool>(), std::vector<bool>({true, false}));
+        EXPECT_EQ(multimap.Size(), 4);
+        EXPECT_EQ(multimap.GetNumValues(), 5);
+
+        multimap.Find(query, offsets, found_values);
+        EXPECT_EQ(offsets.ToFlatVector<int64_t>(),
+                  std::vector<int64_t>({0, 2, 2, 2, 3}));
+        EXPECT_EQ(found_values.ToFlatVector<int64_t>(),
+                  std::vector<int64_t>({1, 5, 6}));
+
+        // No matches.
+        multimap.Find(core::Tensor::Init<int>({{9, 9}}, device), offsets,
+                      found_values);
+        EXPECT_EQ(offsets.ToFlatVector<int64_t>(),
+                  std::vector<int64_t>({0, 0}));
+        EXPECT_EQ(found_values.GetShape(), core::SizeVector({0, 1}));
+
+        multimap.Clear();
+        EXPECT_EQ(multimap.Size(), 0);
+        EXPECT_EQ(multimap.GetNumValues(), 0);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
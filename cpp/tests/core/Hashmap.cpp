@@ -26,6 +26,7 @@
 
 #include "open3d/core/hashmap/Hashmap.h"
 
+#include <algorithm>
 #include <random>
 #include <unordered_map>
 
@@ -80,6 +81,7 @@ TEST_P(HashmapPermuteDevices, SimpleInit) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     for (auto backend : backends) {
@@ -110,6 +112,7 @@ TEST_P(HashmapPermuteDevices, Find) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -154,6 +157,7 @@ TEST_P(HashmapPermuteDevices, Insert) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -207,6 +211,7 @@ TEST_P(HashmapPermuteDevices, Erase) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -272,6 +277,7 @@ TEST_P(HashmapPermuteDevices, Rehash) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -326,6 +332,7 @@ TEST_P(HashmapPermuteDevices, Clear) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -404,6 +411,7 @@ TEST_P(HashmapPermuteDevices, InsertComplexKeys) {
         backends.push_back(core::HashmapBackend::StdGPU);
     } else {
         backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
     }
 
     const int n = 1000000;
@@ -455,5 +463,248 @@ TEST_P(HashmapPermuteDevices, InsertComplexKeys) {
     }
 }
 
+TEST_P(HashmapPermuteDevices, IncrementalRehash) {
+    core::Device device = GetParam();
+    if (device.GetType() != core::Device::DeviceType::CPU) {
+        return;
+    }
+
+    core::HashmapGrowthPolicy policy;
+    policy.incremental = true;
+    policy.migration_batch_size = 4;
+
+    core::Hashmap tbb_hashmap(10, core::Dtype::Int32, core::Dtype::Int32, {1},
+                              {1}, device, core::HashmapBackend::TBB);
+    EXPECT_ANY_THROW(tbb_hashmap.SetGrowthPolicy(policy));
+
+    core::Hashmap hashmap(10, core::Dtype::Int32, core::Dtype::Int32, {1}, {1},
+                          device, core::HashmapBackend::OpenAddressing);
+    hashmap.SetGrowthPolicy(policy);
+
+    // Insert in batches so that the map grows while migrating.
+    const int n = 2000;
+    const int batch = 100;
+    core::Tensor addrs, masks;
+    bool was_rehashing = false;
+    for (int i = 0; i < n; i += batch) {
+        core::Tensor keys = core::Tensor::Arange(i, i + batch, 1,
+                                                 core::Dtype::Int32, device);
+        hashmap.Insert(keys, keys.Mul(2), addrs, masks);
+        EXPECT_TRUE(masks.All());
+        was_rehashing |= hashmap.IsRehashing();
+
+        // Duplicates of migrated and unmigrated keys are rejected.
+        core::Tensor prev_keys =
+                core::Tensor::Arange(0, i + batch, 1, core::Dtype::Int32,
+                                     device);
+        hashmap.Insert(prev_keys, prev_keys, addrs, masks);
+        EXPECT_FALSE(masks.Any());
+        EXPECT_EQ(hashmap.Size(), i + batch);
+    }
+    EXPECT_TRUE(was_rehashing);
+
+    // Erase every other key.
+    core::Tensor erase_keys =
+            core::Tensor::Arange(0, n, 2, core::Dtype::Int32, device);
+    hashmap.Erase(erase_keys, masks);
+    EXPECT_TRUE(masks.All());
+    EXPECT_EQ(hashmap.Size(), n / 2);
+
+    core::Tensor active_addrs;
+    hashmap.GetActiveIndices(active_addrs);
+    EXPECT_EQ(active_addrs.GetLength(), n / 2);
+
+    core::Tensor keys =
+            core::Tensor::Arange(0, n, 1, core::Dtype::Int32, device);
+    hashmap.Find(keys, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), n / 2);
+    core::Tensor found_keys = keys.IndexGet({masks});
+    core::Tensor found_indices =
+            addrs.IndexGet({masks}).To(core::Dtype::Int64);
+    EXPECT_TRUE(hashmap.GetKeyTensor()
+                        .IndexGet({found_indices})
+                        .View({n / 2})
+                        .AllClose(found_keys));
+    EXPECT_TRUE(hashmap.GetValueTensor()
+                        .IndexGet({found_indices})
+                        .View({n / 2})
+                        .AllClose(found_keys.Mul(2)));
+
+    hashmap.Rehash(hashmap.GetBucketCount());
+    EXPECT_FALSE(hashmap.IsRehashing());
+    EXPECT_EQ(hashmap.Size(), n / 2);
+    hashmap.Find(keys, addrs, masks);
+    EXPECT_EQ(masks.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(), n / 2);
+}
+
+TEST_P(HashmapPermuteDevices, Statistics) {
+    core::Device device = GetParam();
+    std::vector<core::HashmapBackend> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashmapBackend::Slab);
+        backends.push_back(core::HashmapBackend::StdGPU);
+    } else {
+        backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
+    }
+
+    const int n = 1000;
+    for (auto backend : backends) {
+        core::Hashmap hashmap(n, core::Dtype::Int32, core::Dtype::Int32, {1},
+                              {1}, device, backend);
+        hashmap.SetTimingSampleInterval(2);
+
+        core::Tensor keys =
+                core::Tensor::Arange(0, n, 1, core::Dtype::Int32, device);
+        core::Tensor addrs, masks;
+        hashmap.Insert(keys, keys, addrs, masks);
+        hashmap.Find(keys, addrs, masks);
+        hashmap.Find(keys, addrs, masks);
+        hashmap.Find(keys, addrs, masks);
+        hashmap.Erase(keys.Slice(0, 0, n / 2), masks);
+
+        core::HashmapStatistics stats = hashmap.GetStatistics();
+        EXPECT_EQ(stats.size, n / 2);
+        EXPECT_EQ(stats.capacity, hashmap.GetCapacity());
+        EXPECT_EQ(stats.bucket_count, hashmap.GetBucketCount());
+
+        int64_t num_entries = 0;
+        for (int64_t num_k : stats.probe_length_histogram) {
+            num_entries += num_k;
+        }
+        EXPECT_EQ(num_entries, n / 2);
+        EXPECT_EQ(int64_t(stats.probe_length_histogram.size()),
+                  stats.max_probe_length);
+        EXPECT_GE(stats.mean_probe_length, 1.0);
+        EXPECT_GE(stats.collision_rate, 0.0);
+        EXPECT_LT(stats.collision_rate, 1.0);
+        EXPECT_LE(stats.allocated_nodes, stats.node_capacity);
+
+        EXPECT_EQ(stats.insert.num_calls, 1);
+        EXPECT_EQ(stats.insert.num_sampled_calls, 1);
+        EXPECT_EQ(stats.insert.num_sampled_keys, n);
+        EXPECT_EQ(stats.find.num_calls, 3);
+        EXPECT_EQ(stats.find.num_sampled_calls, 2);
+        EXPECT_EQ(stats.activate.num_calls, 0);
+        EXPECT_EQ(stats.erase.num_calls, 1);
+        EXPECT_GE(stats.find.sampled_time_ms, 0.0);
+
+        hashmap.ResetStatistics();
+        hashmap.SetTimingSampleInterval(0);
+        hashmap.Find(keys, addrs, masks);
+        stats = hashmap.GetStatistics();
+        EXPECT_EQ(stats.find.num_calls, 1);
+        EXPECT_EQ(stats.find.num_sampled_calls, 0);
+        EXPECT_ANY_THROW(hashmap.SetTimingSampleInterval(-1));
+    }
+}
+
+TEST_P(HashmapPermuteDevices, ForEachActiveChunk) {
+    core::Device device = GetParam();
+    std::vector<core::HashmapBackend> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashmapBackend::Slab);
+        backends.push_back(core::HashmapBackend::StdGPU);
+    } else {
+        backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
+    }
+
+    const int n = 1000;
+    const int64_t chunk_size = 64;
+    for (auto backend : backends) {
+        core::Hashmap hashmap(n, core::Dtype::Int32, core::Dtype::Int32, {1},
+                              {1}, device, backend);
+        core::Tensor keys =
+                core::Tensor::Arange(0, n, 1, core::Dtype::Int32, device);
+        core::Tensor addrs, masks;
+        hashmap.Insert(keys, keys.Mul(2), addrs, masks);
+        hashmap.Erase(core::Tensor::Arange(0, n, 3, core::Dtype::Int32,
+                                           device),
+                      masks);
+
+        std::vector<int> visited_keys;
+        hashmap.ForEachActiveChunk(
+                chunk_size, [&](const core::Tensor& chunk_addrs,
+                                const core::Tensor& chunk_keys,
+                                const core::Tensor& chunk_values) {
+                    EXPECT_LE(chunk_addrs.GetLength(), chunk_size);
+                    EXPECT_EQ(chunk_keys.GetShape(),
+                              core::SizeVector({chunk_addrs.GetLength(), 1}));
+                    EXPECT_EQ(chunk_keys.GetDevice(), device);
+                    EXPECT_TRUE(chunk_values.AllClose(chunk_keys.Mul(2)));
+                    EXPECT_TRUE(hashmap.GetKeyTensor()
+                                        .IndexGet({chunk_addrs.To(
+                                                core::Dtype::Int64)})
+                                        .AllClose(chunk_keys));
+                    std::vector<int> chunk = chunk_keys.ToFlatVector<int>();
+                    visited_keys.insert(visited_keys.end(), chunk.begin(),
+                                        chunk.end());
+                });
+
+        std::sort(visited_keys.begin(), visited_keys.end());
+        std::vector<int> expected_keys;
+        for (int i = 0; i < n; ++i) {
+            if (i % 3 != 0) {
+                expected_keys.push_back(i);
+            }
+        }
+        EXPECT_EQ(visited_keys, expected_keys);
+
+        auto noop = [](const core::Tensor&, const core::Tensor&,
+                       const core::Tensor&) {};
+        EXPECT_ANY_THROW(hashmap.ForEachActiveChunk(0, noop));
+    }
+}
+
+TEST_P(HashmapPermuteDevices, FindValues) {
+    core::Device device = GetParam();
+    std::vector<core::HashmapBackend> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashmapBackend::Slab);
+        backends.push_back(core::HashmapBackend::StdGPU);
+    } else {
+        backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
+    }
+
+    const int n = 1000;
+    for (auto backend : backends) {
+        // Int32x3 keys with 8^3 Float32 values, and an unaligned value size.
+        for (int64_t value_size : {512, 3}) {
+            core::Dtype dtype_value = value_size == 3 ? core::Dtype::UInt8
+                                                      : core::Dtype::Float32;
+            core::Hashmap hashmap(n, core::Dtype::Int32, dtype_value, {3},
+                                  {value_size}, device, backend);
+            core::Tensor keys = core::Tensor::Arange(0, 3 * n, 1,
+                                                     core::Dtype::Int32, device)
+                                        .Reshape({n, 3});
+            core::Tensor values = core::Tensor::Arange(0, n, 1,
+                                                       core::Dtype::Int32,
+                                                       device)
+                                          .Reshape({n, 1})
+                                          .Mul(core::Tensor::Ones(
+                                                  {1, value_size},
+                                                  core::Dtype::Int32, device))
+                                          .To(dtype_value);
+            core::Tensor addrs, masks;
+            hashmap.Insert(keys.Slice(0, 0, n / 2), values.Slice(0, 0, n / 2),
+                           addrs, masks);
+
+            core::Tensor found_values;
+            hashmap.FindValues(keys, found_values, masks);
+            EXPECT_EQ(found_values.GetShape(),
+                      core::SizeVector({n, value_size}));
+            EXPECT_TRUE(masks.Slice(0, 0, n / 2).All());
+            EXPECT_FALSE(masks.Slice(0, n / 2, n).Any());
+            EXPECT_TRUE(found_values.Slice(0, 0, n / 2)
+                                .AllClose(values.Slice(0, 0, n / 2)));
+            EXPECT_TRUE(found_values.Slice(0, n / 2, n).AllClose(
+                    core::Tensor::Zeros({n / 2, value_size}, dtype_value,
+                                        device)));
+        }
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
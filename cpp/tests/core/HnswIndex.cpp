@@ -0,0 +1,148 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/HnswIndex.h"
+
+#include <algorithm>
+#include <random>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/nns/KnnIndex.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+static core::Tensor RandomPoints(int64_t n, int64_t d, int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    std::vector<float> values(n * d);
+    for (float& v : values) {
+        v = dist(rng);
+    }
+    return core::Tensor(values, {n, d}, core::Dtype::Float32);
+}
+
+/// Fraction of the exact knn that are found by the approximate search.
+static double Recall(const core::Tensor& indices,
+                     const core::Tensor& exact_indices) {
+    const std::vector<int64_t> found = indices.ToFlatVector<int64_t>();
+    const std::vector<int64_t> exact = exact_indices.ToFlatVector<int64_t>();
+    const int64_t knn = exact_indices.GetShape()[1];
+    int64_t num_found = 0;
+    for (size_t row = 0; row < exact.size(); row += knn) {
+        for (int64_t i = 0; i < knn; ++i) {
+            num_found += std::count(found.begin() + row,
+                                    found.begin() + row + knn, exact[row + i]);
+        }
+    }
+    return double(num_found) / double(exact.size());
+}
+
+TEST(HnswIndex, SearchKnn) {
+    int size = 10;
+    std::vector<double> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0,
+                               0.2, 0.0, 0.1, 0.0, 0.0, 0.1, 0.1, 0.0,
+                               0.1, 0.2, 0.0, 0.2, 0.0, 0.0, 0.2, 0.1,
+                               0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float64);
+    core::nns::HnswIndex index(ref);
+
+    core::Tensor query(std::vector<double>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float64);
+
+    EXPECT_THROW(index.SearchKnn(query, 0), std::runtime_error);
+
+    // Small graphs are searched exhaustively.
+    core::Tensor indices;
+    core::Tensor distances;
+    std::tie(indices, distances) = index.SearchKnn(query, 3);
+    ExpectEQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 4, 9}));
+    ExpectEQ(distances.ToFlatVector<double>(),
+             std::vector<double>({0.00626358, 0.00747938, 0.0108912}));
+
+    // knn larger than the dataset returns all points.
+    std::tie(indices, distances) = index.SearchKnn(query, 12);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({1, 10}));
+    ExpectEQ(indices.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, 9, 0, 3, 2, 5, 7, 6, 8}));
+}
+
+TEST(HnswIndex, Recall) {
+    const int64_t size = 5000;
+    const int64_t knn = 10;
+    core::Tensor ref = RandomPoints(size, 16, 0);
+    core::Tensor queries = RandomPoints(200, 16, 1);
+
+    core::nns::KnnIndex exact_index(ref);
+    core::Tensor exact_indices = exact_index.SearchKnn(queries, knn).first;
+
+    core::nns::HnswIndex index(ref, 16, 100);
+    double previous_recall = 0.0;
+    for (int ef_search : {10, 50, 200}) {
+        index.SetEfSearch(ef_search);
+        EXPECT_EQ(index.GetEfSearch(), ef_search);
+        core::Tensor indices, distances;
+        std::tie(indices, distances) = index.SearchKnn(queries, knn);
+        EXPECT_EQ(indices.GetShape(), core::SizeVector({200, knn}));
+
+        // The returned neighbors are sorted by distance.
+        core::Tensor order = distances.Slice(1, 1, knn).Ge(
+                distances.Slice(1, 0, knn - 1));
+        EXPECT_TRUE(order.All());
+
+        const double recall = Recall(indices, exact_indices);
+        EXPECT_GE(recall, previous_recall - 0.01);
+        previous_recall = recall;
+    }
+    EXPECT_GE(previous_recall, 0.95);
+    EXPECT_THROW(index.SetEfSearch(0), std::runtime_error);
+}
+
+TEST(HnswIndex, SearchHybrid) {
+    int size = 10;
+    std::vector<float> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0, 0.2, 0.0,
+                              0.1, 0.0, 0.0, 0.1, 0.1, 0.0, 0.1, 0.2, 0.0, 0.2,
+                              0.0, 0.0, 0.2, 0.1, 0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float32);
+    core::nns::HnswIndex index(ref);
+
+    core::Tensor query(std::vector<float>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float32);
+
+    core::Tensor indices, distances, counts;
+    std::tie(indices, distances, counts) = index.SearchHybrid(query, 0.1, 3);
+    ExpectEQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 4, -1}));
+    ExpectEQ(distances.ToFlatVector<float>(),
+             std::vector<float>({0.00626358, 0.00747938, 0}));
+    ExpectEQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({2}));
+
+    EXPECT_THROW(index.SearchRadius(query, 0.1, true), std::runtime_error);
+}
+
+}  // namespace tests
+}  // namespace open3d
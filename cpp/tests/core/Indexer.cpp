@@ -172,5 +172,47 @@ TEST_P(IndexerPermuteDevices, GetPointers) {
     EXPECT_EQ(indexer.GetOutputPtr(5), output_base_ptr + 5 * dtype_byte_size);
 }
 
+TEST_P(IndexerPermuteDevices, RepeatedLayouts) {
+    core::Device device = GetParam();
+
+    // The second Indexer reuses the cached layout of the first one, but must
+    // point to its own tensors.
+    core::Tensor input0({4, 4}, core::Dtype::Float32, device);
+    core::Tensor input1({4, 1}, core::Dtype::Float32, device);
+    core::Tensor output({4, 4}, core::Dtype::Float32, device);
+    core::Indexer indexer_a({input0, input1}, output);
+
+    core::Tensor input0_b({4, 4}, core::Dtype::Float32, device);
+    core::Tensor input1_b({4, 1}, core::Dtype::Float32, device);
+    core::Tensor output_b({4, 4}, core::Dtype::Float32, device);
+    core::Indexer indexer_b({input0_b, input1_b}, output_b);
+
+    int64_t dtype_byte_size = core::Dtype::Float32.ByteSize();
+    EXPECT_EQ(indexer_b.NumWorkloads(), indexer_a.NumWorkloads());
+    EXPECT_EQ(indexer_b.GetInputPtr(0, 5),
+              static_cast<char*>(input0_b.GetDataPtr()) + 5 * dtype_byte_size);
+    EXPECT_EQ(indexer_b.GetInputPtr(1, 5),
+              static_cast<char*>(input1_b.GetDataPtr()) + 1 * dtype_byte_size);
+    EXPECT_EQ(indexer_b.GetOutputPtr(5),
+              static_cast<char*>(output_b.GetDataPtr()) + 5 * dtype_byte_size);
+
+    // Same shapes, but different strides.
+    core::Tensor input0_t = input0_b.T();
+    core::Indexer indexer_c({input0_t, input1_b}, output_b);
+    EXPECT_EQ(indexer_c.GetInputPtr(0, 1),
+              static_cast<char*>(input0_b.GetDataPtr()) + 4 * dtype_byte_size);
+
+    // Same layouts, but reduced.
+    core::Tensor reduced({4, 1}, core::Dtype::Float32, device);
+    core::Indexer indexer_d({input0_b}, reduced, core::DtypePolicy::ALL_SAME,
+                            {1});
+    EXPECT_EQ(indexer_d.NumOutputElements(), 4);
+    core::Indexer indexer_e({input0}, reduced, core::DtypePolicy::ALL_SAME,
+                            {1});
+    EXPECT_EQ(indexer_e.NumOutputElements(), 4);
+    EXPECT_EQ(indexer_e.GetInputPtr(0, 0),
+              static_cast<char*>(input0.GetDataPtr()));
+}
+
 }  // namespace tests
 }  // namespace open3d
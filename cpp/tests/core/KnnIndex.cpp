@@ -0,0 +1,158 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/nns/KnnIndex.h"
+
+#include <random>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/SizeVector.h"
+#include "open3d/core/nns/NanoFlannIndex.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class KnnIndexPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(KnnIndex,
+                         KnnIndexPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static core::Tensor RandomPoints(int64_t n, int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    std::vector<double> values(n * 3);
+    for (double& v : values) {
+        v = dist(rng);
+    }
+    return core::Tensor(values, {n, 3}, core::Dtype::Float64);
+}
+
+TEST_P(KnnIndexPermuteDevices, SearchKnn) {
+    core::Device device = GetParam();
+    int size = 10;
+    std::vector<double> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0,
+                               0.2, 0.0, 0.1, 0.0, 0.0, 0.1, 0.1, 0.0,
+                               0.1, 0.2, 0.0, 0.2, 0.0, 0.0, 0.2, 0.1,
+                               0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float64, device);
+    core::nns::KnnIndex index(ref);
+
+    core::Tensor query(std::vector<double>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float64, device);
+
+    EXPECT_THROW(index.SearchKnn(query, 0), std::runtime_error);
+
+    core::Tensor indices;
+    core::Tensor distances;
+    std::tie(indices, distances) = index.SearchKnn(query, 3);
+    ExpectEQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 4, 9}));
+    ExpectEQ(distances.ToFlatVector<double>(),
+             std::vector<double>({0.00626358, 0.00747938, 0.0108912}));
+
+    // Larger knn uses the sorting path and is clamped to the dataset size.
+    std::tie(indices, distances) = index.SearchKnn(query, 20);
+    EXPECT_EQ(indices.GetShape(), core::SizeVector({1, 10}));
+    ExpectEQ(indices.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({1, 4, 9, 0, 3, 2, 5, 7, 6, 8}));
+}
+
+TEST_P(KnnIndexPermuteDevices, CompareNanoFlann) {
+    core::Device device = GetParam();
+    core::Tensor points = RandomPoints(500, 0);
+    core::Tensor queries = RandomPoints(70, 1);
+    core::nns::NanoFlannIndex reference(points);
+    core::nns::KnnIndex index(points.To(device));
+    // Force several query tiles.
+    index.SetTileSize(500 * 3 * 16);
+    core::Tensor device_queries = queries.To(device);
+
+    for (int knn : {5, 40}) {
+        core::Tensor ref_indices, ref_distances, indices, distances;
+        std::tie(ref_indices, ref_distances) =
+                reference.SearchKnn(queries, knn);
+        std::tie(indices, distances) = index.SearchKnn(device_queries, knn);
+        ExpectEQ(indices.ToFlatVector<int64_t>(),
+                 ref_indices.ToFlatVector<int64_t>());
+        EXPECT_TRUE(distances.To(core::Device("CPU:0"))
+                            .AllClose(ref_distances, 0, 1e-12));
+    }
+
+    core::Tensor radii = core::Tensor::Full({70}, 0.15, core::Dtype::Float64);
+    radii.Slice(0, 0, 35) =
+            core::Tensor::Full({35}, 0.08, core::Dtype::Float64);
+    core::Tensor ref_indices, ref_distances, ref_splits;
+    std::tie(ref_indices, ref_distances, ref_splits) =
+            reference.SearchRadius(queries, radii, true);
+    core::Tensor indices, distances, splits;
+    std::tie(indices, distances, splits) =
+            index.SearchRadius(device_queries, radii.To(device), true);
+    ExpectEQ(splits.ToFlatVector<int64_t>(),
+             ref_splits.ToFlatVector<int64_t>());
+    ExpectEQ(indices.ToFlatVector<int64_t>(),
+             ref_indices.ToFlatVector<int64_t>());
+    EXPECT_TRUE(distances.To(core::Device("CPU:0"))
+                        .AllClose(ref_distances, 0, 1e-12));
+
+    core::Tensor ref_counts, counts;
+    std::tie(ref_indices, ref_distances, ref_counts) =
+            reference.SearchHybrid(queries, 0.1, 8);
+    std::tie(indices, distances, counts) =
+            index.SearchHybrid(device_queries, 0.1, 8);
+    ExpectEQ(counts.ToFlatVector<int64_t>(),
+             ref_counts.ToFlatVector<int64_t>());
+    ExpectEQ(indices.ToFlatVector<int64_t>(),
+             ref_indices.ToFlatVector<int64_t>());
+    EXPECT_TRUE(distances.To(core::Device("CPU:0"))
+                        .AllClose(ref_distances, 0, 1e-12));
+}
+
+TEST_P(KnnIndexPermuteDevices, SearchRadiusUnsorted) {
+    core::Device device = GetParam();
+    core::Tensor points = RandomPoints(200, 2).To(device);
+    core::Tensor queries = RandomPoints(10, 3).To(device);
+    core::nns::KnnIndex index(points);
+
+    EXPECT_THROW(index.SearchRadius(queries, 0.0), std::runtime_error);
+
+    core::Tensor indices, distances, splits;
+    std::tie(indices, distances, splits) =
+            index.SearchRadius(queries, 0.2, false);
+    std::vector<int64_t> indices_vec = indices.ToFlatVector<int64_t>();
+    std::vector<int64_t> splits_vec = splits.ToFlatVector<int64_t>();
+    ASSERT_EQ(splits_vec.size(), 11u);
+    EXPECT_EQ(splits_vec.back(), static_cast<int64_t>(indices_vec.size()));
+    for (size_t i = 0; i < 10; ++i) {
+        for (int64_t j = splits_vec[i] + 1; j < splits_vec[i + 1]; ++j) {
+            EXPECT_LT(indices_vec[j - 1], indices_vec[j]);
+        }
+    }
+    EXPECT_TRUE(distances.Le(0.04).All());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,204 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/LazyTensor.h"
+
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class LazyTensorPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(LazyTensor,
+                         LazyTensorPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(LazyTensorPermuteDevices, Leaf) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Ones({2, 3}, core::Dtype::Float32, device);
+
+    core::LazyTensor lazy = a.Lazy();
+    EXPECT_TRUE(lazy.IsLeaf());
+    EXPECT_EQ(lazy.NumNodes(), 1);
+    EXPECT_EQ(lazy.GetShape(), core::SizeVector({2, 3}));
+    EXPECT_EQ(lazy.GetDtype(), core::Dtype::Float32);
+    EXPECT_EQ(lazy.GetDevice(), device);
+
+    // Evaluating a leaf does not copy.
+    EXPECT_TRUE(lazy.Eval().IsSame(a));
+}
+
+TEST_P(LazyTensorPermuteDevices, BroadcastExpression) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>(
+            {{0, 1, 2, 3}, {4, 5, 6, 7}, {8, 9, 10, 11}}, device);
+    core::Tensor mean = core::Tensor::Init<float>({1, 2, 3, 4}, device);
+    core::Tensor scale = core::Tensor::Init<float>({{2}, {3}, {4}}, device);
+    core::Tensor offset = core::Tensor::Init<float>({0.5}, device);
+
+    core::LazyTensor lazy = (a.Lazy() - mean) * scale + offset;
+    EXPECT_FALSE(lazy.IsLeaf());
+    EXPECT_EQ(lazy.NumNodes(), 7);
+    EXPECT_EQ(lazy.GetShape(), core::SizeVector({3, 4}));
+
+    core::Tensor fused = lazy;
+    core::Tensor eager = (a - mean) * scale + offset;
+    EXPECT_TRUE(fused.AllClose(eager));
+}
+
+TEST_P(LazyTensorPermuteDevices, Scalar) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<double>({1, 2, 4, 8}, device);
+
+    core::Tensor fused = ((a.Lazy() + 1) * 2.5 - 3) / 2;
+    core::Tensor eager = ((a + 1) * 2.5 - 3) / 2;
+    EXPECT_TRUE(fused.AllClose(eager));
+
+    fused = 10 - a.Lazy();
+    EXPECT_EQ(fused.ToFlatVector<double>(), std::vector<double>({9, 8, 6, 2}));
+
+    fused = 8 / a.Lazy();
+    EXPECT_EQ(fused.ToFlatVector<double>(),
+              std::vector<double>({8, 4, 2, 1}));
+}
+
+TEST_P(LazyTensorPermuteDevices, Unary) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({-2, -0.5, 0.25, 1, 3}, device);
+
+    core::Tensor fused = (-a.Lazy()).Abs().Sqrt().Exp() + a.Lazy().Sin() *
+                                                                 a.Lazy().Cos();
+    core::Tensor eager = a.Neg().Abs().Sqrt().Exp() + a.Sin() * a.Cos();
+    EXPECT_TRUE(fused.AllClose(eager));
+
+    // Float-only ops reject integer inputs when the expression is built.
+    core::Tensor b = core::Tensor::Init<int32_t>({1, 2}, device);
+    EXPECT_ANY_THROW(b.Lazy().Sqrt());
+}
+
+TEST_P(LazyTensorPermuteDevices, Int) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<int32_t>({-7, 3, 10, 5}, device);
+    core::Tensor b = core::Tensor::Init<int32_t>({2, -3, 4, 5}, device);
+
+    core::Tensor fused = (a.Lazy() * b - 4).Abs() / b + a;
+    core::Tensor eager = (a * b - 4).Abs() / b + a;
+    EXPECT_EQ(fused.GetDtype(), core::Dtype::Int32);
+    EXPECT_EQ(fused.ToFlatVector<int32_t>(), eager.ToFlatVector<int32_t>());
+}
+
+TEST_P(LazyTensorPermuteDevices, NonContiguous) {
+    core::Device device = GetParam();
+    core::Tensor a =
+            core::Tensor::Arange(0, 24, 1, core::Dtype::Float32, device)
+                    .View({2, 3, 4});
+    core::Tensor a_t = a.Transpose(0, 2);
+    core::Tensor b = a.Slice(2, 0, 4, 2);
+
+    EXPECT_FALSE(a_t.IsContiguous());
+    EXPECT_FALSE(b.IsContiguous());
+
+    core::Tensor fused = a_t.Lazy() * a_t + 1;
+    core::Tensor eager = a_t * a_t + 1;
+    EXPECT_TRUE(fused.AllClose(eager));
+
+    fused = b.Lazy() - a.Slice(2, 1, 4, 2) * 0.5;
+    eager = b - a.Slice(2, 1, 4, 2) * 0.5;
+    EXPECT_TRUE(fused.AllClose(eager));
+}
+
+TEST_P(LazyTensorPermuteDevices, EvalInto) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<float>({1, 2, 3, 4, 5, 6}, device);
+    core::Tensor b = core::Tensor::Init<float>({6, 5, 4, 3, 2, 1}, device);
+
+    // Evaluate into an existing tensor.
+    core::Tensor dst = core::Tensor::Zeros({6}, core::Dtype::Float32, device);
+    (a.Lazy() + b * 2).EvalInto(dst);
+    EXPECT_TRUE(dst.AllClose(a + b * 2));
+
+    // Evaluate in-place.
+    core::Tensor expected = a * a - b;
+    (a.Lazy() * a - b).EvalInto(a);
+    EXPECT_TRUE(a.AllClose(expected));
+
+    // Evaluate into a view that overlaps with an input.
+    core::Tensor c = core::Tensor::Init<float>({1, 2, 3, 4, 5, 6}, device);
+    expected = c.Slice(0, 0, 5) + 1;
+    core::Tensor c_tail = c.Slice(0, 1, 6);
+    (c.Slice(0, 0, 5).Lazy() + 1).EvalInto(c_tail);
+    EXPECT_TRUE(c.Slice(0, 1, 6).AllClose(expected));
+
+    // Shape mismatch.
+    core::Tensor wrong = core::Tensor::Zeros({3}, core::Dtype::Float32, device);
+    EXPECT_ANY_THROW((a.Lazy() + b).EvalInto(wrong));
+}
+
+TEST_P(LazyTensorPermuteDevices, Mismatch) {
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Ones({2, 3}, core::Dtype::Float32, device);
+    core::Tensor b = core::Tensor::Ones({2, 3}, core::Dtype::Float64, device);
+    core::Tensor c = core::Tensor::Ones({4}, core::Dtype::Float32, device);
+
+    EXPECT_ANY_THROW(a.Lazy() + b);
+    EXPECT_ANY_THROW(a.Lazy() + c);
+}
+
+TEST_P(LazyTensorPermuteDevices, LargeExpression) {
+    core::Device device = GetParam();
+
+    // More leaves and instructions than fit into a single fused kernel.
+    std::vector<core::Tensor> tensors;
+    for (int i = 0; i < 20; ++i) {
+        tensors.push_back(core::Tensor::Full({3, 2}, i, core::Dtype::Float32,
+                                             device));
+    }
+    core::LazyTensor lazy = tensors[0];
+    core::Tensor eager = tensors[0];
+    for (int i = 1; i < 20; ++i) {
+        lazy = (lazy + tensors[i]) * 0.5;
+        eager = (eager + tensors[i]) * 0.5;
+    }
+    core::Tensor fused = lazy;
+    EXPECT_TRUE(fused.AllClose(eager));
+
+    // A deep right-leaning expression exceeds the evaluation stack.
+    lazy = tensors[19];
+    eager = tensors[19];
+    for (int i = 18; i >= 0; --i) {
+        lazy = tensors[i].Lazy() - lazy;
+        eager = tensors[i] - eager;
+    }
+    fused = lazy;
+    EXPECT_TRUE(fused.AllClose(eager));
+}
+
+}  // namespace tests
+}  // namespace open3d
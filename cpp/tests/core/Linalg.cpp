@@ -26,6 +26,7 @@
 
 #include <cmath>
 #include <limits>
+#include <random>
 
 #include "open3d/core/AdvancedIndexing.h"
 #include "open3d/core/Dtype.h"
@@ -33,6 +34,7 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/kernel/Kernel.h"
+#include "open3d/core/linalg/BatchedLinalg.h"
 #include "open3d/core/linalg/kernel/SVD3x3.h"
 #include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
@@ -89,6 +91,72 @@ TEST_P(LinalgPermuteDevices, Matmul) {
     EXPECT_ANY_THROW(A.Matmul(core::Tensor::Zeros({2, 4}, dtype)));
 }
 
+TEST_P(LinalgPermuteDevices, MatmulBatched) {
+    const float EPSILON = 1e-8;
+
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::Tensor A(std::vector<float>{1, 2, 3, 4, 5, 6, 6, 5, 4, 3, 2, 1},
+                   {2, 2, 3}, dtype, device);
+    core::Tensor B(
+            std::vector<float>{7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18},
+            {3, 4}, dtype, device);
+
+    // Batched A with a shared B.
+    core::Tensor C = A.Matmul(B);
+    EXPECT_EQ(C.GetShape(), core::SizeVector({2, 2, 4}));
+    for (int64_t b = 0; b < 2; ++b) {
+        EXPECT_TRUE(C[b].AllClose(A[b].Matmul(B), EPSILON, EPSILON));
+    }
+
+    // Batched A and B.
+    core::Tensor B_batched = core::Tensor::Empty({2, 3, 4}, dtype, device);
+    B_batched[0] = B;
+    B_batched[1] = B * 2;
+    C = A.Matmul(B_batched);
+    EXPECT_EQ(C.GetShape(), core::SizeVector({2, 2, 4}));
+    for (int64_t b = 0; b < 2; ++b) {
+        EXPECT_TRUE(
+                C[b].AllClose(A[b].Matmul(B_batched[b]), EPSILON, EPSILON));
+    }
+
+    // Broadcasted batch dimensions: {2, 1} x {3} -> {2, 3}.
+    core::Tensor A_4d = A.View({2, 1, 2, 3});
+    core::Tensor B_3d = core::Tensor::Empty({3, 3, 4}, dtype, device);
+    for (int64_t b = 0; b < 3; ++b) {
+        B_3d[b] = B + static_cast<float>(b);
+    }
+    C = A_4d.Matmul(B_3d);
+    EXPECT_EQ(C.GetShape(), core::SizeVector({2, 3, 2, 4}));
+    for (int64_t i = 0; i < 2; ++i) {
+        for (int64_t j = 0; j < 3; ++j) {
+            EXPECT_TRUE(C[i][j].AllClose(A[i].Matmul(B_3d[j]), EPSILON,
+                                         EPSILON));
+        }
+    }
+
+    // Non-contiguous and Float64 inputs.
+    core::Tensor A_T = A.Transpose(1, 2);
+    core::Tensor C_T = A_T.To(core::Dtype::Float64)
+                               .Matmul(A.To(core::Dtype::Float64));
+    EXPECT_EQ(C_T.GetShape(), core::SizeVector({2, 3, 3}));
+    EXPECT_EQ(C_T.GetDtype(), core::Dtype::Float64);
+    for (int64_t b = 0; b < 2; ++b) {
+        EXPECT_TRUE(C_T[b].To(dtype).AllClose(A_T[b].Matmul(A[b]), EPSILON,
+                                              EPSILON));
+    }
+
+    // Empty batch.
+    C = core::Tensor::Empty({0, 2, 3}, dtype, device).Matmul(B);
+    EXPECT_EQ(C.GetShape(), core::SizeVector({0, 2, 4}));
+
+    // Incompatible shape test.
+    EXPECT_ANY_THROW(A.Matmul(core::Tensor::Zeros({3, 4, 5}, dtype, device)));
+    EXPECT_ANY_THROW(A.Matmul(core::Tensor::Zeros({2, 2, 4}, dtype, device)));
+    EXPECT_ANY_THROW(A.Matmul(core::Tensor::Zeros({3}, dtype, device)));
+}
+
 TEST_P(LinalgPermuteDevices, LU) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Dtype::Float32;
@@ -461,6 +529,121 @@ TEST_P(LinalgPermuteDevices, LeastSquares) {
     }
 }
 
+// Returns a batch of well-conditioned random square matrices.
+static core::Tensor RandomBatchedMatrices(int64_t batch,
+                                          int64_t n,
+                                          const core::Device& device) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> dist(-1.f, 1.f);
+    std::vector<float> values(batch * n * n);
+    for (int64_t i = 0; i < static_cast<int64_t>(values.size()); ++i) {
+        values[i] = dist(rng);
+        if ((i % (n * n)) % (n + 1) == 0) {
+            values[i] += n;
+        }
+    }
+    return core::Tensor(values, {batch, n, n}, core::Dtype::Float32, device);
+}
+
+TEST_P(LinalgPermuteDevices, BatchedSolve) {
+    core::Device device = GetParam();
+    const int64_t batch = 10;
+
+    for (int64_t n : {3, 4, 5, 6}) {
+        core::Tensor A = RandomBatchedMatrices(batch, n, device);
+        core::Tensor B = core::Tensor::Ones({batch, n}, core::Dtype::Float32,
+                                            device);
+        core::Tensor X;
+        core::BatchedSolve(A, B, X);
+        EXPECT_EQ(X.GetShape(), B.GetShape());
+        for (int64_t b = 0; b < batch; ++b) {
+            core::Tensor AX = A[b].Matmul(X[b].View({n, 1})).View({n});
+            EXPECT_TRUE(AX.AllClose(B[b], 1e-5, 1e-5));
+        }
+
+        core::Tensor B_multi = RandomBatchedMatrices(batch, n, device);
+        core::Tensor X_multi;
+        core::BatchedSolve(A, B_multi, X_multi);
+        for (int64_t b = 0; b < batch; ++b) {
+            EXPECT_TRUE(A[b].Matmul(X_multi[b]).AllClose(B_multi[b], 1e-5,
+                                                         1e-5));
+        }
+    }
+
+    // Singular test.
+    core::Tensor B = core::Tensor::Ones({2, 3}, core::Dtype::Float32, device);
+    EXPECT_ANY_THROW(core::BatchedSolve(
+            core::Tensor::Zeros({2, 3, 3}, core::Dtype::Float32, device), B,
+            B));
+
+    // Shape test.
+    EXPECT_ANY_THROW(core::BatchedSolve(
+            core::Tensor::Ones({2, 3, 4}, core::Dtype::Float32, device), B,
+            B));
+    EXPECT_ANY_THROW(core::BatchedSolve(
+            core::Tensor::Ones({3, 3}, core::Dtype::Float32, device), B, B));
+}
+
+TEST_P(LinalgPermuteDevices, BatchedInverse) {
+    core::Device device = GetParam();
+    const int64_t batch = 10;
+
+    for (int64_t n : {3, 4, 5, 6}) {
+        core::Tensor A = RandomBatchedMatrices(batch, n, device);
+        core::Tensor A_inv;
+        core::BatchedInverse(A, A_inv);
+        EXPECT_EQ(A_inv.GetShape(), A.GetShape());
+        core::Tensor I = core::Tensor::Eye(n, core::Dtype::Float32, device);
+        for (int64_t b = 0; b < batch; ++b) {
+            EXPECT_TRUE(A[b].Matmul(A_inv[b]).AllClose(I, 1e-5, 1e-5));
+        }
+    }
+
+    // Singular test.
+    core::Tensor output;
+    EXPECT_ANY_THROW(core::BatchedInverse(
+            core::Tensor::Zeros({2, 4, 4}, core::Dtype::Float32, device),
+            output));
+}
+
+TEST_P(LinalgPermuteDevices, BatchedSVD) {
+    core::Device device = GetParam();
+    const int64_t batch = 10;
+
+    for (int64_t n : {3, 4, 5, 6}) {
+        core::Tensor A = RandomBatchedMatrices(batch, n, device);
+        core::Tensor U, S, VT;
+        core::BatchedSVD(A, U, S, VT);
+        EXPECT_EQ(U.GetShape(), A.GetShape());
+        EXPECT_EQ(S.GetShape(), core::SizeVector({batch, n}));
+        EXPECT_EQ(VT.GetShape(), A.GetShape());
+        core::Tensor I = core::Tensor::Eye(n, core::Dtype::Float32, device);
+        for (int64_t b = 0; b < batch; ++b) {
+            core::Tensor US = U[b] * S[b].View({1, n});
+            EXPECT_TRUE(US.Matmul(VT[b]).AllClose(A[b], 1e-4, 1e-4));
+            EXPECT_TRUE(U[b].T().Matmul(U[b]).AllClose(I, 1e-4, 1e-4));
+            EXPECT_TRUE(VT[b].Matmul(VT[b].T()).AllClose(I, 1e-4, 1e-4));
+
+            std::vector<float> S_data = S[b].ToFlatVector<float>();
+            for (int64_t i = 1; i < n; ++i) {
+                EXPECT_GE(S_data[i - 1], S_data[i]);
+            }
+        }
+    }
+
+    // Rank-deficient input still yields orthogonal U and VT.
+    core::Tensor A = core::Tensor::Zeros({1, 3, 3}, core::Dtype::Float32,
+                                         device);
+    A[0][0][0] = 2.f;
+    core::Tensor U, S, VT;
+    core::BatchedSVD(A, U, S, VT);
+    core::Tensor I = core::Tensor::Eye(3, core::Dtype::Float32, device);
+    EXPECT_TRUE(U[0].T().Matmul(U[0]).AllClose(I, 1e-5, 1e-5));
+    EXPECT_TRUE(VT[0].Matmul(VT[0].T()).AllClose(I, 1e-5, 1e-5));
+    EXPECT_TRUE(S[0].AllClose(core::Tensor(std::vector<float>{2, 0, 0}, {3},
+                                           core::Dtype::Float32, device)));
+}
+
 TEST_P(LinalgPermuteDevices, KernelOps) {
     core::Tensor A_3x3 =
             core::Tensor::Init<float>({{0, 1, 0}, {1, 0, 0}, {0, 0, 1}});
@@ -26,10 +26,14 @@
 
 #include "open3d/core/MemoryManager.h"
 
+#include <cstring>
+#include <thread>
 #include <vector>
 
 #include "open3d/core/Blob.h"
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Device.h"
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "tests/UnitTest.h"
 #include "tests/core/CoreTest.h"
 
@@ -78,5 +82,143 @@ TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     core::MemoryManager::Free(src_ptr, src_device);
 }
 
+TEST(MemoryManager, MallocFreePinned) {
+    if (!core::cuda::IsAvailable()) {
+        EXPECT_ANY_THROW(core::MemoryManager::MallocPinned(10));
+        return;
+    }
+
+    void* ptr = core::MemoryManager::MallocPinned(1000);
+    EXPECT_TRUE(core::MemoryManager::IsPinned(ptr));
+    EXPECT_TRUE(core::MemoryManager::IsPinned(static_cast<char*>(ptr) + 999));
+    core::MemoryManager::FreePinned(ptr);
+
+    // Freed pinned blocks are cached and reused for similar sizes.
+    void* reused_ptr = core::MemoryManager::MallocPinned(900);
+    EXPECT_EQ(reused_ptr, ptr);
+    core::MemoryManager::FreePinned(reused_ptr);
+
+    std::vector<char> pageable(10);
+    EXPECT_FALSE(core::MemoryManager::IsPinned(pageable.data()));
+}
+
+TEST(MemoryManager, CPUCachedMallocFree) {
+    core::Device device("CPU:0");
+    core::CPUCachedMemoryManager manager;
+    core::CPUCachedMemoryManager::ReleaseCache();
+    const core::MemoryManagerStatistic& statistic =
+            core::MemoryManagerStatistic::GetInstance();
+    core::MemoryManagerStatistic::CacheStatistics before =
+            statistic.GetCacheStatistics(device);
+    EXPECT_EQ(before.cached_byte_size_, 0);
+
+    EXPECT_EQ(manager.Malloc(0, device), nullptr);
+
+    // Freed blocks are reused for requests of the same size class.
+    void* ptr = manager.Malloc(1000, device);
+    std::memset(ptr, 1, 1000);
+    manager.Free(ptr, device);
+    void* reused_ptr = manager.Malloc(1010, device);
+    EXPECT_EQ(reused_ptr, ptr);
+    manager.Free(reused_ptr, device);
+
+    core::MemoryManagerStatistic::CacheStatistics after =
+            statistic.GetCacheStatistics(device);
+    EXPECT_EQ(after.count_miss_ - before.count_miss_, 1);
+    EXPECT_EQ(after.count_hit_ - before.count_hit_, 1);
+    EXPECT_GE(after.cached_byte_size_, 1010u);
+
+    // Memory freed by another thread is returned to the pool.
+    std::thread worker([&]() {
+        void* worker_ptr = manager.Malloc(5000, device);
+        std::memset(worker_ptr, 2, 5000);
+        manager.Free(worker_ptr, device);
+    });
+    worker.join();
+    ptr = manager.Malloc(5000, device);
+    std::thread releaser([&]() { manager.Free(ptr, device); });
+    releaser.join();
+
+    // Large blocks are not cached.
+    const size_t large_byte_size = (size_t(1) << 28) + 1;
+    size_t cached_byte_size =
+            statistic.GetCacheStatistics(device).cached_byte_size_;
+    ptr = manager.Malloc(large_byte_size, device);
+    manager.Free(ptr, device);
+    EXPECT_EQ(statistic.GetCacheStatistics(device).cached_byte_size_,
+              cached_byte_size);
+
+    core::CPUCachedMemoryManager::ReleaseCache();
+    EXPECT_EQ(statistic.GetCacheStatistics(device).cached_byte_size_, 0);
+}
+
+#if defined(BUILD_CUDA_MODULE) && defined(BUILD_CACHED_CUDA_MANAGER)
+TEST(MemoryManager, CUDACachedMemoryLimit) {
+    if (!core::cuda::IsAvailable()) {
+        return;
+    }
+    core::Device device("CUDA:0");
+    core::CUDACachedMemoryManager manager;
+    core::CUDACachedMemoryManager::ReleaseCache(device);
+    const core::MemoryManagerStatistic& statistic =
+            core::MemoryManagerStatistic::GetInstance();
+
+    // Small allocations share a segment and merge back when freed.
+    void* ptr0 = manager.Malloc(1000, device);
+    void* ptr1 = manager.Malloc(1000, device);
+    core::MemoryManagerStatistic::CacheStatistics statistics =
+            statistic.GetCacheStatistics(device);
+    EXPECT_GT(statistics.reserved_byte_size_, 2000u);
+    EXPECT_GT(statistics.cached_byte_size_, 0u);
+    manager.Free(ptr0, device);
+    manager.Free(ptr1, device);
+    statistics = statistic.GetCacheStatistics(device);
+    EXPECT_EQ(statistics.cached_byte_size_, statistics.reserved_byte_size_);
+    EXPECT_EQ(statistics.largest_cached_block_size_,
+              statistics.cached_byte_size_);
+    EXPECT_EQ(statistics.Fragmentation(), 0.0);
+
+    // Within the limit, the cached segment is released to make room.
+    const size_t byte_size = size_t(64) << 20;
+    core::CUDACachedMemoryManager::SetMemoryLimit(device, byte_size);
+    EXPECT_EQ(core::CUDACachedMemoryManager::GetMemoryLimit(device),
+              byte_size);
+    void* ptr = manager.Malloc(byte_size, device);
+    statistics = statistic.GetCacheStatistics(device);
+    EXPECT_EQ(statistics.reserved_byte_size_, byte_size);
+    EXPECT_GE(statistics.count_flush_, 1);
+
+    // Beyond the limit, the allocation fails.
+    EXPECT_ANY_THROW(manager.Malloc(1000, device));
+    manager.Free(ptr, device);
+
+    core::CUDACachedMemoryManager::SetMemoryLimit(device, 0);
+    core::CUDACachedMemoryManager::ReleaseCache(device);
+    EXPECT_EQ(statistic.GetCacheStatistics(device).reserved_byte_size_, 0u);
+}
+#endif
+
+TEST(MemoryManager, CPUPlacement) {
+    core::Device device("CPU:0");
+    EXPECT_EQ(core::CPUMemoryManager::GetPlacement(),
+              core::CPUMemoryPlacement::Default);
+
+    // The placement only moves pages, the memory stays usable.
+    const size_t byte_size = (size_t(1) << 20) + 123;
+    for (core::CPUMemoryPlacement placement :
+         {core::CPUMemoryPlacement::ParallelFirstTouch,
+          core::CPUMemoryPlacement::Interleaved}) {
+        core::CPUMemoryManager::SetPlacement(placement, 0);
+        EXPECT_EQ(core::CPUMemoryManager::GetPlacement(), placement);
+        char* ptr = static_cast<char*>(
+                core::MemoryManager::Malloc(byte_size, device));
+        std::memset(ptr, 3, byte_size);
+        EXPECT_EQ(ptr[0], 3);
+        EXPECT_EQ(ptr[byte_size - 1], 3);
+        core::MemoryManager::Free(ptr, device);
+    }
+    core::CPUMemoryManager::SetPlacement(core::CPUMemoryPlacement::Default);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -27,6 +27,7 @@
 #include "open3d/core/nns/NanoFlannIndex.h"
 
 #include <cmath>
+#include <cstdio>
 #include <limits>
 
 #include "open3d/core/Dtype.h"
@@ -108,5 +109,44 @@ TEST(NanoFlannIndex, SearchRadius) {
              std::vector<double>({0.00626358, 0.00747938}));
 }
 
+TEST(NanoFlannIndex, SaveLoad) {
+    int size = 10;
+    std::vector<double> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0,
+                               0.2, 0.0, 0.1, 0.0, 0.0, 0.1, 0.1, 0.0,
+                               0.1, 0.2, 0.0, 0.2, 0.0, 0.0, 0.2, 0.1,
+                               0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor query(std::vector<double>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float64);
+    const std::string file_name = "test_nanoflann_index.o3dkd";
+    for (core::Dtype dtype : {core::Dtype::Float32, core::Dtype::Float64}) {
+        core::Tensor ref =
+                core::Tensor(points, {size, 3}, core::Dtype::Float64).To(dtype);
+        core::nns::NanoFlannIndex index(ref);
+        index.Save(file_name);
+
+        core::Tensor indices, distances;
+        std::tie(indices, distances) = index.SearchKnn(query.To(dtype), 3);
+        for (auto mmap_mode : {core::Tensor::MmapMode::None,
+                               core::Tensor::MmapMode::ReadOnly}) {
+            core::nns::NanoFlannIndex loaded;
+            EXPECT_TRUE(loaded.Load(file_name, mmap_mode));
+            EXPECT_EQ(loaded.GetDtype(), dtype);
+            EXPECT_EQ(loaded.GetDatasetSize(), size_t(size));
+            EXPECT_EQ(loaded.GetDimension(), 3);
+
+            core::Tensor loaded_indices, loaded_distances;
+            std::tie(loaded_indices, loaded_distances) =
+                    loaded.SearchKnn(query.To(dtype), 3);
+            EXPECT_TRUE(loaded_indices.AllClose(indices));
+            EXPECT_TRUE(loaded_distances.AllClose(distances));
+        }
+    }
+    std::remove(file_name.c_str());
+
+    core::nns::NanoFlannIndex empty;
+    EXPECT_THROW(empty.Save(file_name), std::runtime_error);
+    EXPECT_THROW(empty.Load("does_not_exist.o3dkd"), std::runtime_error);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -142,41 +142,45 @@ TEST_P(NNSPermuteDevices, FixedRadiusSearch) {
              std::vector<double>({0.00626358, 0.00747938}));
 }
 
-TEST(NearestNeighborSearch, MultiRadiusSearch) {
+TEST_P(NNSPermuteDevices, MultiRadiusSearch) {
     // Set up nns.
     int size = 10;
+    core::Device device = GetParam();
     std::vector<double> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0,
                                0.2, 0.0, 0.1, 0.0, 0.0, 0.1, 0.1, 0.0,
                                0.1, 0.2, 0.0, 0.2, 0.0, 0.0, 0.2, 0.1,
                                0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
-    core::Tensor ref(points, {size, 3}, core::Dtype::Float64);
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float64, device);
     core::nns::NearestNeighborSearch nns(ref);
     nns.MultiRadiusIndex();
 
     core::Tensor query(std::vector<double>({0.064705, 0.043921, 0.087843,
                                             0.064705, 0.043921, 0.087843}),
-                       {2, 3}, core::Dtype::Float64);
+                       {2, 3}, core::Dtype::Float64, device);
     core::Tensor radius;
 
     // If radius <= 0.
     radius = core::Tensor(std::vector<double>({1.0, 0.0}), {2},
-                          core::Dtype::Float64);
+                          core::Dtype::Float64, device);
     EXPECT_THROW(nns.MultiRadiusSearch(query, radius), std::runtime_error);
     EXPECT_THROW(nns.MultiRadiusSearch(query, radius), std::runtime_error);
 
     // If radius == 0.1.
     radius = core::Tensor(std::vector<double>({0.1, 0.1}), {2},
-                          core::Dtype::Float64);
+                          core::Dtype::Float64, device);
     std::tuple<core::Tensor, core::Tensor, core::Tensor> result =
             nns.MultiRadiusSearch(query, radius);
     core::Tensor indices = std::get<0>(result);
     core::Tensor distances = std::get<1>(result);
+    core::Tensor row_splits = std::get<2>(result);
 
     ExpectEQ(indices.ToFlatVector<int64_t>(),
              std::vector<int64_t>({1, 4, 1, 4}));
     ExpectEQ(distances.ToFlatVector<double>(),
              std::vector<double>(
                      {0.00626358, 0.00747938, 0.00626358, 0.00747938}));
+    ExpectEQ(row_splits.ToFlatVector<int64_t>(),
+             std::vector<int64_t>({0, 2, 4}));
 }
 
 TEST_P(NNSPermuteDevicesWithFaiss, HybridSearch) {
@@ -205,5 +209,32 @@ TEST_P(NNSPermuteDevicesWithFaiss, HybridSearch) {
     ExpectEQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({2}));
 }
 
+TEST(NearestNeighborSearch, ApproximateKnnSearch) {
+    int size = 10;
+    std::vector<float> points{0.0, 0.0, 0.0, 0.0, 0.0, 0.1, 0.0, 0.0, 0.2, 0.0,
+                              0.1, 0.0, 0.0, 0.1, 0.1, 0.0, 0.1, 0.2, 0.0, 0.2,
+                              0.0, 0.0, 0.2, 0.1, 0.0, 0.2, 0.2, 0.1, 0.0, 0.0};
+    core::Tensor ref(points, {size, 3}, core::Dtype::Float32);
+    core::nns::NearestNeighborSearch nns(ref);
+
+    core::nns::ApproximateKnnParams params;
+    params.method = core::nns::ApproximateKnnMethod::HNSW;
+    params.hnsw_ef_search = 16;
+    EXPECT_TRUE(nns.ApproximateKnnIndex(params));
+
+    core::Tensor query(std::vector<float>({0.064705, 0.043921, 0.087843}),
+                       {1, 3}, core::Dtype::Float32);
+    core::Tensor indices, distances;
+    std::tie(indices, distances) = nns.KnnSearch(query, 3);
+    ExpectEQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 4, 9}));
+    ExpectEQ(distances.ToFlatVector<float>(),
+             std::vector<float>({0.00626358, 0.00747938, 0.0108912}));
+
+    // The exact index replaces the approximate one.
+    EXPECT_TRUE(nns.KnnIndex());
+    std::tie(indices, distances) = nns.KnnSearch(query, 3);
+    ExpectEQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 4, 9}));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,112 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Prefetcher.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class PrefetcherPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Prefetcher,
+                         PrefetcherPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(PrefetcherPermuteDevices, Pop) {
+    core::Device device = GetParam();
+    const size_t num_items = 50;
+
+    for (size_t num_threads : {1, 4}) {
+        std::atomic<size_t> num_loaded(0);
+        core::Prefetcher<core::Tensor> prefetcher(
+                [&](size_t index, core::Tensor& item) {
+                    if (index >= num_items) {
+                        return false;
+                    }
+                    item = core::Tensor::Full({3}, int64_t(index),
+                                              core::Dtype::Int64)
+                                   .To(device);
+                    ++num_loaded;
+                    return true;
+                },
+                device, 4, num_threads);
+
+        core::Tensor item;
+        for (size_t i = 0; i < num_items; ++i) {
+            EXPECT_FALSE(prefetcher.IsEnd());
+            ASSERT_TRUE(prefetcher.Pop(item));
+            EXPECT_EQ(item.GetDevice(), device);
+            EXPECT_EQ(item.ToFlatVector<int64_t>(),
+                      std::vector<int64_t>(3, int64_t(i)));
+            // At most capacity items are loaded ahead of Pop().
+            EXPECT_LE(num_loaded.load(), i + 1 + 4);
+        }
+        EXPECT_FALSE(prefetcher.Pop(item));
+        EXPECT_TRUE(prefetcher.IsEnd());
+        EXPECT_EQ(prefetcher.GetNumPopped(), num_items);
+    }
+
+    // Items that are not popped are dropped.
+    {
+        core::Prefetcher<int> prefetcher(
+                [](size_t index, int& item) {
+                    item = int(index);
+                    return true;
+                },
+                device, 2, 2);
+    }
+}
+
+TEST_P(PrefetcherPermuteDevices, Error) {
+    core::Device device = GetParam();
+    core::Prefetcher<int> prefetcher(
+            [](size_t index, int& item) {
+                if (index == 1) {
+                    throw std::runtime_error("Failed to load item 1.");
+                }
+                item = int(index);
+                return index < 3;
+            },
+            device, 2);
+
+    int item = -1;
+    EXPECT_TRUE(prefetcher.Pop(item));
+    EXPECT_EQ(item, 0);
+    EXPECT_THROW(prefetcher.Pop(item), std::runtime_error);
+    EXPECT_TRUE(prefetcher.Pop(item));
+    EXPECT_EQ(item, 2);
+    EXPECT_FALSE(prefetcher.Pop(item));
+}
+
+}  // namespace tests
+}  // namespace open3d
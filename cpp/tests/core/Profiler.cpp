@@ -0,0 +1,171 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/Profiler.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/IJsonConvertible.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class ProfilerPermuteDevices : public PermuteDevices {
+protected:
+    void SetUp() override {
+        core::Profiler::SetEnabled(true);
+        core::Profiler::GetInstance().Reset();
+    }
+    void TearDown() override {
+        core::Profiler::SetEnabled(false);
+        core::Profiler::GetInstance().Reset();
+    }
+};
+INSTANTIATE_TEST_SUITE_P(Profiler,
+                         ProfilerPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(ProfilerPermuteDevices, Disabled) {
+    core::Device device = GetParam();
+    core::Profiler::SetEnabled(false);
+
+    core::Tensor a = core::Tensor::Ones({2, 3}, core::Dtype::Float32, device);
+    core::Tensor b = a + a;
+    EXPECT_TRUE(core::Profiler::GetInstance().GetEvents().empty());
+}
+
+// The scopes are removed at compile time with ENABLE_PROFILING=OFF.
+#ifndef OPEN3D_DISABLE_PROFILING
+TEST_P(ProfilerPermuteDevices, KernelEvents) {
+    core::Device device = GetParam();
+
+    core::Tensor a =
+            core::Tensor::Ones({100, 10}, core::Dtype::Float32, device);
+    core::Profiler::GetInstance().Reset();
+    {
+        OPEN3D_PROFILE_SCOPE("Outer", device);
+        core::Tensor b = a + a;
+        core::Tensor c = b.Sum({0});
+    }
+
+    std::vector<core::Profiler::Event> events =
+            core::Profiler::GetInstance().GetEvents();
+    auto find_event = [&](const std::string& name) {
+        return std::find_if(events.begin(), events.end(),
+                            [&](const core::Profiler::Event& event) {
+                                return event.name_ == name;
+                            });
+    };
+    auto add = find_event("BinaryEW::Add");
+    auto sum = find_event("Reduction::Sum");
+    auto outer = find_event("Outer");
+    ASSERT_NE(add, events.end());
+    ASSERT_NE(sum, events.end());
+    ASSERT_NE(outer, events.end());
+
+    // Events are ordered by their end time.
+    EXPECT_LT(add, sum);
+    EXPECT_EQ(outer, events.end() - 1);
+    EXPECT_EQ(add->depth_, 1);
+    EXPECT_EQ(outer->depth_, 0);
+    EXPECT_GE(add->start_us_, outer->start_us_);
+    for (const core::Profiler::Event& event : events) {
+        EXPECT_EQ(event.device_, device);
+        EXPECT_GE(event.duration_us_, 0.0);
+    }
+
+    // The outputs are allocated outside of the kernels, but inside the outer
+    // scope.
+    const size_t add_byte_size = 100 * 10 * sizeof(float);
+    const size_t sum_byte_size = 10 * sizeof(float);
+    EXPECT_GE(outer->allocated_byte_size_, add_byte_size + sum_byte_size);
+    EXPECT_GE(outer->peak_byte_size_, add_byte_size + sum_byte_size);
+    EXPECT_GE(core::Profiler::GetInstance().GetPeakByteSize(device),
+              outer->peak_byte_size_);
+}
+
+TEST_P(ProfilerPermuteDevices, ExportChromeTrace) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Ones({2, 3}, core::Dtype::Float32, device);
+    core::Tensor b = a * a;
+
+    const std::string file_name = "profiler_trace.json";
+    core::Profiler::GetInstance().ExportChromeTrace(file_name);
+
+    std::ifstream file(file_name);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    Json::Value trace = utility::StringToJson(buffer.str());
+    ASSERT_TRUE(trace["traceEvents"].isArray());
+    bool found = false;
+    for (const Json::Value& trace_event : trace["traceEvents"]) {
+        EXPECT_EQ(trace_event["ph"].asString(), "X");
+        EXPECT_TRUE(trace_event["dur"].isNumeric());
+        if (trace_event["name"].asString() == "BinaryEW::Mul") {
+            EXPECT_EQ(trace_event["args"]["device"].asString(),
+                      device.ToString());
+            found = true;
+        }
+    }
+    EXPECT_TRUE(found);
+    std::remove(file_name.c_str());
+}
+
+TEST_P(ProfilerPermuteDevices, MaxNumEvents) {
+    core::Device device = GetParam();
+
+    core::Profiler::GetInstance().SetMaxNumEvents(2);
+    {
+        OPEN3D_PROFILE_SCOPE("First", device);
+    }
+    {
+        OPEN3D_PROFILE_SCOPE("Second", device);
+    }
+    {
+        OPEN3D_PROFILE_SCOPE("Third", device);
+    }
+    std::vector<core::Profiler::Event> events =
+            core::Profiler::GetInstance().GetEvents();
+    core::Profiler::GetInstance().SetMaxNumEvents(0);
+
+    // The oldest event is dropped.
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0].name_, "Second");
+    EXPECT_EQ(events[1].name_, "Third");
+}
+#endif
+
+}  // namespace tests
+}  // namespace open3d
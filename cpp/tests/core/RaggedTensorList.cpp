@@ -0,0 +1,113 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/RaggedTensorList.h"
+
+#include <vector>
+
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class RaggedTensorListPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(RaggedTensorList,
+                         RaggedTensorListPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(RaggedTensorListPermuteDevices, EmptyConstructor) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::RaggedTensorList rtl({3}, dtype, device);
+    EXPECT_EQ(rtl.GetElementShape(), core::SizeVector({3}));
+    EXPECT_EQ(rtl.GetDtype(), dtype);
+    EXPECT_EQ(rtl.GetDevice(), device);
+    EXPECT_EQ(rtl.GetSize(), 0);
+    EXPECT_EQ(rtl.GetNumElements(), 0);
+    EXPECT_EQ(rtl.AsTensor().GetShape(), core::SizeVector({0, 3}));
+    EXPECT_EQ(rtl.GetOffsets().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0}));
+    EXPECT_ANY_THROW(rtl[0]);
+}
+
+TEST_P(RaggedTensorListPermuteDevices, PushBack) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::Tensor b0 = core::Tensor::Ones({2, 3}, dtype, device);
+    core::Tensor b1 = core::Tensor::Zeros({0, 3}, dtype, device);
+    core::Tensor b2 = core::Tensor::Ones({3, 3}, dtype, device) * 2;
+
+    core::RaggedTensorList rtl({3}, dtype, device);
+    rtl.PushBack(b0);
+    rtl.PushBack(b1);
+    rtl.PushBack(b2);
+    EXPECT_EQ(rtl.GetSize(), 3);
+    EXPECT_EQ(rtl.GetNumElements(), 5);
+    EXPECT_EQ(rtl.GetOffsets().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 2, 2, 5}));
+    EXPECT_TRUE(rtl[0].AllClose(b0));
+    EXPECT_FALSE(rtl[0].IsSame(b0));  // Values should be copied.
+    EXPECT_EQ(rtl[1].GetShape(), core::SizeVector({0, 3}));
+    EXPECT_TRUE(rtl[-1].AllClose(b2));
+    EXPECT_EQ(rtl.AsTensor().GetShape(), core::SizeVector({5, 3}));
+    EXPECT_EQ(rtl.AsTensor().GetDevice(), device);
+
+    // Batches must match the element shape, dtype and device.
+    EXPECT_ANY_THROW(rtl.PushBack(core::Tensor::Ones({2, 4}, dtype, device)));
+    EXPECT_ANY_THROW(rtl.PushBack(core::Tensor::Ones({3}, dtype, device)));
+    EXPECT_ANY_THROW(rtl.PushBack(
+            core::Tensor::Ones({2, 3}, core::Dtype::Int32, device)));
+}
+
+TEST_P(RaggedTensorListPermuteDevices, ReserveAndClear) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::RaggedTensorList rtl({3}, dtype, device);
+    rtl.Reserve(10, 100);
+    rtl.PushBack(core::Tensor::Ones({10, 3}, dtype, device));
+    const void* data_ptr = rtl.AsTensor().GetDataPtr();
+    for (int i = 1; i < 10; ++i) {
+        rtl.PushBack(core::Tensor::Ones({10, 3}, dtype, device));
+    }
+    // Growing within the reserved size does not reallocate.
+    EXPECT_EQ(rtl.AsTensor().GetDataPtr(), data_ptr);
+    EXPECT_EQ(rtl.GetSize(), 10);
+    EXPECT_EQ(rtl.GetNumElements(), 100);
+    EXPECT_EQ(rtl[9].GetShape(), core::SizeVector({10, 3}));
+
+    rtl.Clear();
+    EXPECT_EQ(rtl.GetSize(), 0);
+    EXPECT_EQ(rtl.GetNumElements(), 0);
+    EXPECT_EQ(rtl.GetOffsets().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0}));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/hashmap/ShardedHashmap.h"
+
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class ShardedHashmapPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(ShardedHashmap,
+                         ShardedHashmapPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(ShardedHashmapPermuteDevices, InsertFindErase) {
+    core::Device device = GetParam();
+    const int64_t n = 100;
+    const int num_shards = 3;
+    core::ShardedHashmap hashmap(10, core::Dtype::Int32, core::Dtype::Int32,
+                                 {3}, {1},
+                                 std::vector<core::Device>(num_shards, device));
+    EXPECT_EQ(hashmap.GetShardCount(), num_shards);
+
+    core::Tensor coords = core::Tensor::Arange(0, n, 1, core::Dtype::Int32,
+                                               device);
+    core::Tensor keys = core::Tensor::Zeros({n, 3}, core::Dtype::Int32, device);
+    keys.Slice(1, 0, 1) = coords.Reshape({n, 1});
+    keys.Slice(1, 1, 2) = coords.Reshape({n, 1}).Mul(7);
+    keys.Slice(1, 2, 3) = coords.Reshape({n, 1}).Neg();
+    core::Tensor values = coords.Mul(10).Reshape({n, 1});
+
+    core::Tensor shards, addrs, masks;
+    hashmap.Insert(keys, values, shards, addrs, masks);
+    EXPECT_TRUE(masks.All());
+    EXPECT_EQ(hashmap.Size(), n);
+    EXPECT_TRUE(shards.AllClose(hashmap.GetShardIds(keys)));
+    for (int i = 0; i < num_shards; ++i) {
+        EXPECT_GT(hashmap.GetShard(i).Size(), 0);
+    }
+
+    // Duplicates are rejected by the owning shard.
+    hashmap.Insert(keys.Slice(0, 0, 10), values.Slice(0, 0, 10), shards,
+                   addrs, masks);
+    EXPECT_FALSE(masks.Any());
+    EXPECT_EQ(hashmap.Size(), n);
+
+    // Values at (shard, addr) match the inserted values.
+    hashmap.Find(keys, shards, addrs, masks);
+    EXPECT_TRUE(masks.All());
+    std::vector<int64_t> shards_vec = shards.ToFlatVector<int64_t>();
+    std::vector<int> addrs_vec = addrs.ToFlatVector<int>();
+    for (int64_t i = 0; i < n; ++i) {
+        core::Tensor value =
+                hashmap.GetShard(shards_vec[i]).GetValueTensor()[addrs_vec[i]];
+        EXPECT_EQ(value.ToFlatVector<int>(), std::vector<int>({int(i * 10)}));
+    }
+
+    core::Tensor active_shards, active_addrs;
+    hashmap.GetActiveIndices(active_shards, active_addrs);
+    EXPECT_EQ(active_shards.GetLength(), n);
+    EXPECT_EQ(active_addrs.GetLength(), n);
+
+    hashmap.Erase(keys.Slice(0, 0, 50), masks);
+    EXPECT_TRUE(masks.All());
+    EXPECT_EQ(hashmap.Size(), n - 50);
+    hashmap.Find(keys, shards, addrs, masks);
+    EXPECT_FALSE(masks.Slice(0, 0, 50).Any());
+    EXPECT_TRUE(masks.Slice(0, 50, n).All());
+
+    hashmap.Clear();
+    EXPECT_EQ(hashmap.Size(), 0);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -26,14 +26,19 @@
 
 #include "open3d/core/Tensor.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <numeric>
+#include <random>
 
 #include "open3d/core/AdvancedIndexing.h"
+#include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/MemoryManager.h"
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/kernel/Kernel.h"
+#include "open3d/core/kernel/ParallelUtil.h"
 #include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "tests/UnitTest.h"
@@ -1115,6 +1120,103 @@ TEST_P(TensorPermuteDevicePairs, IndexSetBroadcast) {
                                   0, 0, 0, 0, 20, 20, 20, 0, 0, 0, 0, 0}));
 }
 
+TEST_P(TensorPermuteDevicePairs, IndexGetRows) {
+    core::Device idx_device;
+    core::Device src_device;
+    std::tie(idx_device, src_device) = GetParam();
+
+    core::Tensor src_t = core::Tensor::Init<float>(
+            {{0, 1, 2}, {3, 4, 5}, {6, 7, 8}, {9, 10, 11}}, src_device);
+
+    // Negative and repeated indices.
+    core::Tensor index = core::Tensor::Init<int64_t>({3, -4, 1, 3}, idx_device);
+    core::Tensor dst_t = src_t.IndexGet({index});
+    EXPECT_EQ(dst_t.GetShape(), core::SizeVector({4, 3}));
+    EXPECT_EQ(dst_t.GetDevice(), src_device);
+    EXPECT_EQ(dst_t.ToFlatVector<float>(),
+              std::vector<float>({9, 10, 11, 0, 1, 2, 3, 4, 5, 9, 10, 11}));
+
+    // Rows with an odd byte size, and a 1D tensor with single-element rows.
+    core::Tensor src_u8 = core::Tensor::Init<uint8_t>(
+            {{{1, 2, 3}}, {{4, 5, 6}}}, src_device);
+    index = core::Tensor::Init<int64_t>({1, 1, 0}, idx_device);
+    EXPECT_EQ(src_u8.IndexGet({index}).GetShape(),
+              core::SizeVector({3, 1, 3}));
+    EXPECT_EQ(src_u8.IndexGet({index}).ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({4, 5, 6, 4, 5, 6, 1, 2, 3}));
+    core::Tensor src_1d = core::Tensor::Init<int64_t>({5, 6, 7}, src_device);
+    EXPECT_EQ(src_1d.IndexGet({index}).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({6, 6, 5}));
+
+    // Empty index.
+    index = core::Tensor::Empty({0}, core::Dtype::Int64, idx_device);
+    EXPECT_EQ(src_t.IndexGet({index}).GetShape(), core::SizeVector({0, 3}));
+
+    // Non-contiguous tensors use the generic path with the same result.
+    core::Tensor src_t_t = src_t.T();
+    index = core::Tensor::Init<int64_t>({2, 0}, idx_device);
+    EXPECT_EQ(src_t_t.IndexGet({index}).ToFlatVector<float>(),
+              std::vector<float>({2, 5, 8, 11, 0, 3, 6, 9}));
+}
+
+TEST_P(TensorPermuteDevicePairs, IndexSetRows) {
+    core::Device idx_device;
+    core::Device dst_device;
+    std::tie(idx_device, dst_device) = GetParam();
+
+    core::Tensor dst_t = core::Tensor::Zeros({4, 2}, core::Dtype::Int32,
+                                             dst_device);
+    core::Tensor src_t =
+            core::Tensor::Init<int32_t>({{1, 2}, {3, 4}, {5, 6}}, idx_device);
+    core::Tensor index = core::Tensor::Init<int64_t>({2, -1, 0}, idx_device);
+    dst_t.IndexSet({index}, src_t);
+    EXPECT_EQ(dst_t.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({5, 6, 0, 0, 1, 2, 3, 4}));
+
+    // SetItem goes through the same path.
+    dst_t.SetItem(core::TensorKey::IndexTensor(
+                          core::Tensor::Init<int64_t>({1}, idx_device)),
+                  core::Tensor::Init<int32_t>({{7, 8}}, dst_device));
+    EXPECT_EQ(dst_t.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({5, 6, 7, 8, 1, 2, 3, 4}));
+}
+
+TEST_P(TensorPermuteDevicePairs, IndexGetMasked) {
+    core::Device mask_device;
+    core::Device src_device;
+    std::tie(mask_device, src_device) = GetParam();
+
+    core::Tensor src_t = core::Tensor::Init<double>(
+            {{0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}}, src_device);
+    core::Tensor mask = core::Tensor::Init<bool>(
+            {true, false, false, true, true}, mask_device);
+    core::Tensor dst_t = src_t.IndexGet({mask});
+    EXPECT_EQ(dst_t.GetShape(), core::SizeVector({3, 2}));
+    EXPECT_EQ(dst_t.ToFlatVector<double>(),
+              std::vector<double>({0, 1, 6, 7, 8, 9}));
+
+    mask = core::Tensor::Zeros({5}, core::Dtype::Bool, mask_device);
+    EXPECT_EQ(src_t.IndexGet({mask}).GetShape(), core::SizeVector({0, 2}));
+
+    // Large mask spanning several CPU threads, compared with the index
+    // gather of the NonZero indices.
+    const int64_t n = 100003;
+    core::Tensor src_large =
+            core::Tensor::Arange(0, 2 * n, 1, core::Dtype::Int64, src_device)
+                    .Reshape({n, 2});
+    std::vector<int64_t> mask_vals(n);
+    for (int64_t i = 0; i < n; ++i) {
+        mask_vals[i] = i % 3;
+    }
+    core::Tensor mask_large =
+            core::Tensor(mask_vals, {n}, core::Dtype::Int64, mask_device)
+                    .Eq(1);
+    core::Tensor ref = src_large.IndexGet({mask_large.NonZero()[0]});
+    core::Tensor result = src_large.IndexGet({mask_large});
+    EXPECT_EQ(result.GetShape(), ref.GetShape());
+    EXPECT_TRUE(result.AllClose(ref));
+}
+
 TEST_P(TensorPermuteDevices, Permute) {
     core::Device device = GetParam();
 
@@ -1294,6 +1396,52 @@ TEST_P(TensorPermuteDevices, Add_BroadcastException) {
                                   20, 22, 24, 26, 28, 30, 32, 34}));
 }
 
+TEST_P(TensorPermuteDevices, AddRareDtypes) {
+    // Dtypes outside of the hot scalar types go through the generic path.
+    core::Device device = GetParam();
+    core::Tensor a = core::Tensor::Init<int8_t>({{0, 1, 2}, {3, 4, 5}}, device);
+    core::Tensor b = core::Tensor::Init<int8_t>({{10, 11, 12}, {13, 14, 15}},
+                                                device);
+    EXPECT_EQ((a + b).ToFlatVector<int8_t>(),
+              std::vector<int8_t>({10, 12, 14, 16, 18, 20}));
+    EXPECT_EQ((a.T() + b.T()).T().ToFlatVector<int8_t>(),
+              std::vector<int8_t>({10, 12, 14, 16, 18, 20}));
+
+    core::Tensor c = a.To(core::Dtype::UInt16);
+    c += c;
+    EXPECT_EQ(c.ToFlatVector<uint16_t>(),
+              std::vector<uint16_t>({0, 2, 4, 6, 8, 10}));
+    EXPECT_EQ(c.Lt(5).ToFlatVector<bool>(),
+              std::vector<bool>({true, true, true, false, false, false}));
+    EXPECT_EQ(a.Neg().ToFlatVector<int8_t>(),
+              std::vector<int8_t>({0, -1, -2, -3, -4, -5}));
+}
+
+TEST_P(TensorPermuteDevices, ParallelThreshold) {
+    core::Device device = GetParam();
+    core::Tensor a =
+            core::Tensor::Arange(0, 2000, 1, core::Dtype::Int64, device)
+                    .Reshape({1000, 2});
+    core::Tensor b = core::Tensor::Init<int64_t>({{1, 2}}, device);
+    const int64_t default_threshold = core::kernel::GetParallelThreshold();
+
+    // Results do not depend on whether the kernels run in parallel.
+    std::vector<int64_t> sums;
+    for (int64_t threshold : {int64_t(0), int64_t(1) << 40}) {
+        core::kernel::SetParallelThreshold(threshold);
+        core::Tensor c = a.T() + b.T();
+        EXPECT_EQ(c.GetShape(), core::SizeVector({2, 1000}));
+        EXPECT_EQ(c[1][999].Item<int64_t>(), 2001);
+        sums.push_back(c.Sum({0, 1}).Item<int64_t>());
+        EXPECT_EQ(a.Sum({1}).ToFlatVector<int64_t>()[999], 3997);
+    }
+    EXPECT_EQ(sums[0], sums[1]);
+
+    EXPECT_THROW(core::kernel::SetParallelThreshold(-1), std::runtime_error);
+    core::kernel::SetParallelThreshold(default_threshold);
+    EXPECT_EQ(core::kernel::GetParallelThreshold(), default_threshold);
+}
+
 TEST_P(TensorPermuteDevices, Sub) {
     core::Device device = GetParam();
     core::Tensor a =
@@ -1354,6 +1502,77 @@ TEST_P(TensorPermuteDevices, Div_) {
     EXPECT_EQ(a.ToFlatVector<float>(), std::vector<float>({0, 1, 2, 3, 4, 5}));
 }
 
+TEST_P(TensorPermuteDevices, PinMemory) {
+    core::Device device = GetParam();
+    core::Tensor src = core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}});
+    EXPECT_FALSE(src.IsPinned());
+    if (!core::cuda::IsAvailable()) {
+        EXPECT_ANY_THROW(src.PinMemory());
+        return;
+    }
+
+    core::Tensor pinned = src.T().PinMemory();
+    EXPECT_TRUE(pinned.IsPinned());
+    EXPECT_TRUE(pinned.IsContiguous());
+    EXPECT_EQ(pinned.GetDevice(), core::Device("CPU:0"));
+    EXPECT_TRUE(pinned.PinMemory().IsSame(pinned));
+
+    core::Tensor dst = pinned.To(device);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({0, 3, 1, 4, 2, 5}));
+}
+
+TEST_P(TensorPermuteDevices, ToAsync) {
+    core::Device device = GetParam();
+    // Large enough to be staged in several chunks for CUDA devices.
+    core::Tensor src =
+            core::Tensor::Arange(0, 10 << 20, 1, core::Dtype::Int32);
+    std::future<core::Tensor> dst_future = src.ToAsync(device, true);
+    core::Tensor dst = dst_future.get();
+    EXPECT_EQ(dst.GetDevice(), device);
+    EXPECT_FALSE(dst.IsSame(src));
+
+    core::Tensor host = dst.ToAsync(core::Device("CPU:0")).get();
+    EXPECT_TRUE(host.AllClose(src));
+}
+
+TEST_P(TensorPermuteDevices, ElementWiseContiguousLarge) {
+    // Large enough to be split into several ranges by the contiguous CPU
+    // kernels, with an odd size to exercise the remainder.
+    core::Device device = GetParam();
+    const int64_t n = 100003;
+    core::Tensor a =
+            core::Tensor::Arange(0, n, 1, core::Dtype::Float32, device);
+    core::Tensor b =
+            core::Tensor::Arange(n, 0, -1, core::Dtype::Float32, device);
+
+    std::vector<float> a_vals = a.ToFlatVector<float>();
+    std::vector<float> b_vals = b.ToFlatVector<float>();
+    std::vector<float> sum(n), rsub(n), neg(n);
+    std::vector<bool> gt(n);
+    std::vector<int32_t> to_int(n);
+    for (int64_t i = 0; i < n; ++i) {
+        sum[i] = a_vals[i] + b_vals[i] * 2.f;
+        rsub[i] = 1.f - a_vals[i];
+        neg[i] = -b_vals[i];
+        gt[i] = a_vals[i] > b_vals[i];
+        to_int[i] = static_cast<int32_t>(a_vals[i]);
+    }
+
+    EXPECT_EQ((a + b * 2).ToFlatVector<float>(), sum);
+    EXPECT_EQ((1.f - a).ToFlatVector<float>(), rsub);
+    EXPECT_EQ(b.Neg().ToFlatVector<float>(), neg);
+    EXPECT_EQ(a.Gt(b).ToFlatVector<bool>(), gt);
+    EXPECT_EQ(a.To(core::Dtype::Int32).ToFlatVector<int32_t>(), to_int);
+
+    // Non-contiguous operands take the strided path.
+    core::Tensor a_strided = a.Slice(0, 0, n, 2);
+    core::Tensor b_strided = b.Slice(0, 0, n, 2);
+    EXPECT_TRUE((a_strided + b_strided)
+                        .AllClose(a_strided.Contiguous() +
+                                  b_strided.Contiguous()));
+}
+
 TEST_P(TensorPermuteDevices, ReduceSumKeepDim) {
     core::Device device = GetParam();
     core::Tensor src = core::Tensor::Init<float>({{{22.f, 23.f, 20.f, 9.f},
@@ -1711,6 +1930,48 @@ TEST_P(TensorPermuteDevices, ReduceSumLargeArray) {
     }
 }
 
+TEST_P(TensorPermuteDevices, ReduceFewOutputsLargeArray) {
+    core::Device device = GetParam();
+
+    // Few outputs with many workloads each, e.g. the per-column bounds of a
+    // point cloud, covering reductions over outer, inner and middle dims.
+    int64_t num_rows = 1000003;
+    std::vector<int> vals(num_rows * 3);
+    std::transform(vals.begin(), vals.end(), vals.begin(),
+                   [](int x) -> int { return utility::UniformRandInt(-9, 9); });
+    std::vector<int> ref_sum(3, 0);
+    std::vector<int> ref_min(3, std::numeric_limits<int>::max());
+    std::vector<int> ref_max(3, std::numeric_limits<int>::lowest());
+    for (int64_t i = 0; i < num_rows; ++i) {
+        for (int64_t j = 0; j < 3; ++j) {
+            int val = vals[i * 3 + j];
+            ref_sum[j] += val;
+            ref_min[j] = std::min(ref_min[j], val);
+            ref_max[j] = std::max(ref_max[j], val);
+        }
+    }
+
+    core::Tensor src(vals, {num_rows, 3}, core::Dtype::Int32, device);
+    EXPECT_EQ(src.Sum({0}).ToFlatVector<int>(), ref_sum);
+    EXPECT_EQ(src.Min({0}).ToFlatVector<int>(), ref_min);
+    EXPECT_EQ(src.Max({0}).ToFlatVector<int>(), ref_max);
+
+    // Non-contiguous input.
+    core::Tensor src_t = src.T();
+    EXPECT_EQ(src_t.Sum({1}).ToFlatVector<int>(), ref_sum);
+    EXPECT_EQ(src_t.Min({1}).ToFlatVector<int>(), ref_min);
+
+    // Contiguous input reduced along its inner dim.
+    core::Tensor src_tc = src_t.Contiguous();
+    EXPECT_EQ(src_tc.Sum({1}).ToFlatVector<int>(), ref_sum);
+    EXPECT_EQ(src_tc.Max({1}).ToFlatVector<int>(), ref_max);
+
+    // Reduction along a middle dim.
+    core::Tensor dst = src.Reshape({1, num_rows, 3}).Sum({1}, true);
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({1, 1, 3}));
+    EXPECT_EQ(dst.ToFlatVector<int>(), ref_sum);
+}
+
 TEST_P(TensorPermuteDevices, ReduceProd) {
     core::Device device = GetParam();
     core::Tensor src = core::Tensor::Init<float>({{{22.f, 23.f, 20.f, 9.f},
@@ -2446,6 +2707,362 @@ TEST_P(TensorPermuteDevices, NonZeroNumpy) {
     EXPECT_EQ(results[1].GetShape(), core::SizeVector{3});
 }
 
+TEST_P(TensorPermuteDevices, NonZeroCompact) {
+    core::Device device = GetParam();
+
+    // Tiny non-zero values and non-contiguous tensors.
+    core::Tensor a = core::Tensor::Init<double>({{0, 1e-50}, {0, 0}, {-2, 0}},
+                                                device);
+    EXPECT_EQ(a.NonZero().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 2, 1, 0}));
+    EXPECT_EQ(a.T().NonZero().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 2, 0}));
+    EXPECT_EQ(core::kernel::Compact(a).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 4}));
+
+    // Large input spanning several CPU threads. Indices are in order.
+    const int64_t n = 200003;
+    std::vector<uint8_t> vals(n);
+    std::vector<int64_t> expected;
+    for (int64_t i = 0; i < n; ++i) {
+        vals[i] = static_cast<uint8_t>((i * 7) % 5 == 0);
+        if (vals[i]) {
+            expected.push_back(i);
+        }
+    }
+    core::Tensor b(vals, {n}, core::Dtype::UInt8, device);
+    EXPECT_EQ(core::kernel::Compact(b).ToFlatVector<int64_t>(), expected);
+    EXPECT_EQ(b.NonZero().ToFlatVector<int64_t>(), expected);
+
+    core::Tensor empty = core::Tensor::Zeros({0, 3}, core::Dtype::Bool, device);
+    EXPECT_EQ(empty.NonZero().GetShape(), core::SizeVector({2, 0}));
+}
+
+TEST_P(TensorPermuteDevices, CumSum) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({{1, 2, 3}, {4, 5, 6}}, device);
+    EXPECT_TRUE(a.CumSum(0).AllClose(
+            core::Tensor::Init<float>({{1, 2, 3}, {5, 7, 9}}, device)));
+    EXPECT_TRUE(a.CumSum(1).AllClose(
+            core::Tensor::Init<float>({{1, 3, 6}, {4, 9, 15}}, device)));
+    EXPECT_TRUE(a.CumSum(-1, true).AllClose(
+            core::Tensor::Init<float>({{0, 1, 3}, {0, 4, 9}}, device)));
+    EXPECT_TRUE(a.T().CumSum(0).AllClose(
+            core::Tensor::Init<float>({{1, 4}, {3, 9}, {6, 15}}, device)));
+
+    // Boolean and integer tensors are summed in Int64.
+    core::Tensor b =
+            core::Tensor::Init<bool>({true, false, true, true}, device);
+    EXPECT_EQ(b.CumSum(0).GetDtype(), core::Dtype::Int64);
+    EXPECT_EQ(b.CumSum(0).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 1, 2, 3}));
+    EXPECT_EQ(b.CumSum(0, true).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 1, 2}));
+    core::Tensor c = core::Tensor::Init<int32_t>({{{1, 2}, {3, 4}}}, device);
+    EXPECT_EQ(c.CumSum(1).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 2, 4, 6}));
+
+    // A long line is scanned in parallel chunks.
+    const int64_t n = 100003;
+    core::Tensor ones = core::Tensor::Ones({n}, core::Dtype::Int32, device);
+    std::vector<int64_t> expected(n);
+    std::iota(expected.begin(), expected.end(), 1);
+    EXPECT_EQ(ones.CumSum(0).ToFlatVector<int64_t>(), expected);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(ones.CumSum(0, true).ToFlatVector<int64_t>(), expected);
+
+    core::Tensor empty = core::Tensor::Ones({0, 2}, core::Dtype::Float64,
+                                            device);
+    EXPECT_EQ(empty.CumSum(0).GetShape(), core::SizeVector({0, 2}));
+    EXPECT_THROW(core::Tensor::Ones({}, core::Dtype::Float32, device).CumSum(0),
+                 std::runtime_error);
+    EXPECT_THROW(a.CumSum(2), std::runtime_error);
+}
+
+TEST_P(TensorPermuteDevices, Sort) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>({3, -1.5, 0, -0.0, 2, -7},
+                                               device);
+    EXPECT_EQ(a.Sort().ToFlatVector<float>(),
+              std::vector<float>({-7, -1.5, 0, 0, 2, 3}));
+
+    core::Tensor b = core::Tensor::Init<int32_t>({5, -3, 5, 0, -3}, device);
+    EXPECT_EQ(b.Sort().ToFlatVector<int32_t>(),
+              std::vector<int32_t>({-3, -3, 0, 5, 5}));
+    // ArgSort is stable.
+    EXPECT_EQ(b.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 4, 3, 0, 2}));
+
+    core::Tensor c = core::Tensor::Init<bool>({true, false, true}, device);
+    EXPECT_EQ(c.Sort().ToFlatVector<bool>(),
+              std::vector<bool>({false, true, true}));
+
+    // Large inputs go through the radix sort.
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int64_t> dist(-1000000, 1000000);
+    std::vector<int64_t> values(100000);
+    for (int64_t& value : values) {
+        value = dist(rng);
+    }
+    core::Tensor d(values, {static_cast<int64_t>(values.size())},
+                   core::Dtype::Int64, device);
+    std::vector<int64_t> order(values.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int64_t l, int64_t r) {
+        return values[l] < values[r];
+    });
+    EXPECT_EQ(d.ArgSort().ToFlatVector<int64_t>(), order);
+    EXPECT_EQ(d.Sort().ToFlatVector<int64_t>(),
+              d.IndexGet({d.ArgSort()}).ToFlatVector<int64_t>());
+
+    core::Tensor e = d.To(core::Dtype::Float64).Div(1000);
+    EXPECT_EQ(e.ArgSort().ToFlatVector<int64_t>(), order);
+
+    // Empty and non-1D tensors.
+    EXPECT_EQ(core::Tensor::Empty({0}, core::Dtype::Float32, device)
+                      .Sort()
+                      .GetShape(),
+              core::SizeVector({0}));
+    EXPECT_ANY_THROW(
+            core::Tensor::Zeros({2, 2}, core::Dtype::Float32, device).Sort());
+}
+
+TEST_P(TensorPermuteDevices, Unique) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<int64_t>({4, 1, 4, 4, 2, 1}, device);
+    core::Tensor unique, inverse, counts;
+    std::tie(unique, inverse, counts) = a.Unique();
+    EXPECT_EQ(unique.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 2, 4}));
+    EXPECT_FALSE(inverse.GetBlob());
+    EXPECT_FALSE(counts.GetBlob());
+
+    std::tie(unique, inverse, counts) = a.Unique(true, true);
+    EXPECT_EQ(unique.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 2, 4}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({2, 0, 2, 2, 1, 0}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({2, 1, 3}));
+    EXPECT_EQ(unique.IndexGet({inverse}).ToFlatVector<int64_t>(),
+              a.ToFlatVector<int64_t>());
+
+    core::Tensor b = core::Tensor::Init<float>({0.5, 0.5}, device);
+    std::tie(unique, inverse, counts) = b.Unique(true, true);
+    EXPECT_EQ(unique.ToFlatVector<float>(), std::vector<float>({0.5}));
+    EXPECT_EQ(inverse.ToFlatVector<int64_t>(), std::vector<int64_t>({0, 0}));
+    EXPECT_EQ(counts.ToFlatVector<int64_t>(), std::vector<int64_t>({2}));
+
+    std::tie(unique, inverse, counts) =
+            core::Tensor::Empty({0}, core::Dtype::Int32, device)
+                    .Unique(true, true);
+    EXPECT_EQ(unique.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(inverse.GetShape(), core::SizeVector({0}));
+    EXPECT_EQ(counts.GetShape(), core::SizeVector({0}));
+}
+
+TEST_P(TensorPermuteDevices, TopKKthValueQuantile) {
+    core::Device device = GetParam();
+
+    core::Tensor a = core::Tensor::Init<float>(
+            {{3, -1.5, 0, 2, -7}, {1, 1, 5, 1, 0}}, device);
+    core::Tensor values, indices;
+    std::tie(values, indices) = a.TopK(2);
+    EXPECT_EQ(values.ToFlatVector<float>(),
+              std::vector<float>({3, 2, 5, 1}));
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 3, 2, 0}));
+
+    // Smallest elements, equal elements ordered by index.
+    std::tie(values, indices) = a.TopK(3, 1, false);
+    EXPECT_EQ(values.ToFlatVector<float>(),
+              std::vector<float>({-7, -1.5, 0, 0, 1, 1}));
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({4, 1, 2, 4, 0, 1}));
+
+    // Along the first dimension.
+    std::tie(values, indices) = a.TopK(1, 0);
+    EXPECT_EQ(values.GetShape(), core::SizeVector({1, 5}));
+    EXPECT_EQ(values.ToFlatVector<float>(),
+              std::vector<float>({3, 1, 5, 2, 0}));
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 1, 0, 1}));
+
+    std::tie(values, indices) = a.KthValue(2);
+    EXPECT_EQ(values.GetShape(), core::SizeVector({2}));
+    EXPECT_EQ(values.ToFlatVector<float>(), std::vector<float>({-1.5, 1}));
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(), std::vector<int64_t>({1, 0}));
+    std::tie(values, indices) = a.KthValue(5, 1, true);
+    EXPECT_EQ(values.GetShape(), core::SizeVector({2, 1}));
+    EXPECT_EQ(values.ToFlatVector<float>(), std::vector<float>({3, 5}));
+
+    EXPECT_EQ(a.Quantile(0.5).ToFlatVector<float>(),
+              std::vector<float>({0, 1}));
+    EXPECT_EQ(a.Quantile(0.125).ToFlatVector<float>(),
+              std::vector<float>({-4.25, 0.5}));
+    EXPECT_EQ(a.Quantile(1).ToFlatVector<float>(), std::vector<float>({3, 5}));
+
+    // Selection in large rows matches sorting.
+    std::mt19937 rng(0);
+    std::uniform_int_distribution<int64_t> dist(-1000, 1000);
+    std::vector<int64_t> row(10000);
+    for (int64_t& value : row) {
+        value = dist(rng);
+    }
+    core::Tensor b(row, {1, static_cast<int64_t>(row.size())},
+                   core::Dtype::Int64, device);
+    std::vector<int64_t> order(row.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int64_t l, int64_t r) {
+        return row[l] > row[r];
+    });
+    std::tie(values, indices) = b.TopK(100);
+    EXPECT_EQ(indices.ToFlatVector<int64_t>(),
+              std::vector<int64_t>(order.begin(), order.begin() + 100));
+    std::tie(values, indices) = b.KthValue(5000);
+    EXPECT_EQ(values.Item<int64_t>(), row[order[row.size() - 5000]]);
+
+    EXPECT_ANY_THROW(a.TopK(6));
+    EXPECT_ANY_THROW(a.KthValue(0));
+    EXPECT_ANY_THROW(a.To(core::Dtype::Int32).Quantile(0.5));
+    EXPECT_ANY_THROW(a.Quantile(1.5));
+}
+
+TEST_P(TensorPermuteDevices, SegmentReduction) {
+    core::Device device = GetParam();
+
+    core::Tensor values = core::Tensor::Init<float>(
+            {{1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}}, device);
+    core::Tensor segment_ids =
+            core::Tensor::Init<int64_t>({0, 0, 2, 2, 2}, device);
+
+    core::Tensor sum = values.SegmentSum(segment_ids, 4);
+    EXPECT_EQ(sum.GetShape(), core::SizeVector({4, 2}));
+    EXPECT_EQ(sum.ToFlatVector<float>(),
+              std::vector<float>({4, 6, 0, 0, 21, 24, 0, 0}));
+
+    core::Tensor mean = values.SegmentMean(segment_ids, 3);
+    EXPECT_EQ(mean.ToFlatVector<float>(),
+              std::vector<float>({2, 3, 0, 0, 7, 8}));
+
+    core::Tensor max = values.Neg().SegmentMax(segment_ids, 3);
+    EXPECT_EQ(max.ToFlatVector<float>(),
+              std::vector<float>({-1, -2, 0, 0, -5, -6}));
+
+    core::Tensor first = values.SegmentFirst(segment_ids, 3);
+    EXPECT_EQ(first.ToFlatVector<float>(),
+              std::vector<float>({1, 2, 0, 0, 5, 6}));
+
+    core::Tensor sum_1d =
+            core::Tensor::Init<int32_t>({1, 2, 3, 4, 5}, device)
+                    .SegmentSum(segment_ids, 3);
+    EXPECT_EQ(sum_1d.ToFlatVector<int32_t>(),
+              std::vector<int32_t>({3, 0, 12}));
+
+    // Unique and SegmentMean give per-key averages, e.g. voxel centroids.
+    core::Tensor keys = core::Tensor::Init<int64_t>({7, 3, 7, 3}, device);
+    core::Tensor key_values = core::Tensor::Init<float>({1, 2, 3, 4}, device);
+    core::Tensor unique, inverse, counts;
+    std::tie(unique, inverse, counts) = keys.Unique(true, false);
+    core::Tensor order = inverse.ArgSort();
+    core::Tensor key_mean = key_values.IndexGet({order}).SegmentMean(
+            inverse.IndexGet({order}), unique.GetLength());
+    EXPECT_EQ(key_mean.ToFlatVector<float>(), std::vector<float>({3, 2}));
+
+    // Invalid segment ids.
+    EXPECT_ANY_THROW(values.SegmentSum(segment_ids, 2));
+    EXPECT_ANY_THROW(values.SegmentSum(
+            core::Tensor::Init<int64_t>({0, 1, 0, 1, 2}, device), 3));
+    EXPECT_ANY_THROW(values.SegmentSum(
+            core::Tensor::Init<int64_t>({0, 0, 1}, device), 3));
+    EXPECT_ANY_THROW(values.SegmentSum(segment_ids.To(core::Dtype::Int32), 3));
+}
+
+TEST_P(TensorPermuteDevices, HalfDtypes) {
+    core::Device device = GetParam();
+
+    // Values exactly representable in both 16-bit formats survive the round
+    // trip. 65504 is the largest finite Float16.
+    core::Tensor a = core::Tensor::Init<float>(
+            {1.5, -2, 0.25, 65504, std::numeric_limits<float>::infinity()},
+            device);
+    core::Tensor a_fp16 = a.To(core::Dtype::Float16);
+    EXPECT_EQ(a_fp16.GetDtype(), core::Dtype::Float16);
+    EXPECT_EQ(a_fp16.GetDtype().ByteSize(), 2);
+    EXPECT_EQ(a_fp16.To(core::Dtype::Float32).ToFlatVector<float>(),
+              a.ToFlatVector<float>());
+    EXPECT_EQ(core::Tensor::Init<float>({1.5, -2, 0.25}, device)
+                      .To(core::Dtype::BFloat16)
+                      .To(core::Dtype::Float32)
+                      .ToFlatVector<float>(),
+              std::vector<float>({1.5, -2, 0.25}));
+
+    // Rounding to nearest even and overflow to infinity.
+    core::Tensor b = core::Tensor::Init<float>({1 + 1.0f / 4096, 70000, 1e-8},
+                                               device);
+    EXPECT_EQ(b.To(core::Dtype::Float16)
+                      .To(core::Dtype::Float32)
+                      .ToFlatVector<float>(),
+              std::vector<float>(
+                      {1, std::numeric_limits<float>::infinity(), 0}));
+    EXPECT_EQ(core::Tensor::Init<float>({1 + 1.0f / 256, 3.0f / 256}, device)
+                      .To(core::Dtype::BFloat16)
+                      .To(core::Dtype::Float32)
+                      .ToFlatVector<float>(),
+              std::vector<float>({1, 3.0f / 256}));
+    // Int conversions.
+    EXPECT_EQ(a_fp16.Slice(0, 0, 3).To(core::Dtype::Int32).ToFlatVector<
+                      int32_t>(),
+              std::vector<int32_t>({1, -2, 0}));
+
+    for (const core::Dtype &dtype :
+         {core::Dtype::Float16, core::Dtype::BFloat16}) {
+        core::Tensor x =
+                core::Tensor::Init<float>({1, 4, 9, 16}, device).To(dtype);
+        core::Tensor y =
+                core::Tensor::Init<float>({0.5, 2, -1, 16}, device).To(dtype);
+        auto to_float = [](const core::Tensor &t) {
+            return t.To(core::Dtype::Float32).ToFlatVector<float>();
+        };
+
+        // Element-wise ops.
+        EXPECT_EQ((x + y).GetDtype(), dtype);
+        EXPECT_EQ(to_float(x + y), std::vector<float>({1.5, 6, 8, 32}));
+        EXPECT_EQ(to_float(x * y), std::vector<float>({0.5, 8, -9, 256}));
+        EXPECT_EQ(to_float(x / 2), std::vector<float>({0.5, 2, 4.5, 8}));
+        EXPECT_EQ(to_float(y.Neg()), std::vector<float>({-0.5, -2, 1, -16}));
+        EXPECT_EQ(to_float(x.Sqrt()), std::vector<float>({1, 2, 3, 4}));
+        EXPECT_EQ((x > y).ToFlatVector<bool>(),
+                  std::vector<bool>({true, true, true, false}));
+        EXPECT_EQ((x == y).ToFlatVector<bool>(),
+                  std::vector<bool>({false, false, false, true}));
+        EXPECT_EQ(x.IsFinite().ToFlatVector<bool>(),
+                  std::vector<bool>({true, true, true, true}));
+
+        // Reductions. Sum accumulates in Float32: 4096 ones would stall at
+        // 2048 in Float16 and at 256 in BFloat16 otherwise.
+        core::Tensor ones = core::Tensor::Ones({4096}, dtype, device);
+        EXPECT_EQ(ones.Sum({0}).GetDtype(), dtype);
+        EXPECT_EQ(ones.Sum({0}).To(core::Dtype::Float32).Item<float>(), 4096);
+        EXPECT_EQ(y.Max({0}).To(core::Dtype::Float32).Item<float>(), 16);
+        EXPECT_EQ(y.Min({0}).To(core::Dtype::Float32).Item<float>(), -1);
+        EXPECT_EQ(y.ArgMin({0}).Item<int64_t>(), 2);
+        EXPECT_EQ(x.ArgMax({0}).Item<int64_t>(), 3);
+
+        // Indexing and filling.
+        core::Tensor idx = core::Tensor::Init<int64_t>({3, 0}, device);
+        EXPECT_EQ(to_float(x.IndexGet({idx})), std::vector<float>({16, 1}));
+        core::Tensor z = core::Tensor::Zeros({3}, dtype, device);
+        z.Fill(2.5);
+        EXPECT_EQ(to_float(z), std::vector<float>({2.5, 2.5, 2.5}));
+
+        // DLPack.
+        core::Tensor w = core::Tensor::FromDLPack(x.ToDLPack());
+        EXPECT_EQ(w.GetDtype(), dtype);
+        EXPECT_EQ(to_float(w), std::vector<float>({1, 4, 9, 16}));
+    }
+}
+
 TEST_P(TensorPermuteDevices, CreationEmpty) {
     core::Device device = GetParam();
 
@@ -2701,6 +3318,137 @@ TEST_P(TensorPermuteDevices, ReduceMean) {
     EXPECT_TRUE(std::isnan(dst.ToFlatVector<float>()[0]));
 }
 
+TEST_P(TensorPermuteDevices, ReduceMeanVariance) {
+    core::Device device = GetParam();
+    core::Tensor src;
+    core::Tensor mean;
+    core::Tensor variance;
+
+    // Only floating point dtypes support MeanVariance.
+    src = core::Tensor::Ones({2, 3}, core::Dtype::Int64, device);
+    EXPECT_THROW(src.MeanVariance({0}), std::runtime_error);
+
+    src = core::Tensor::Init<float>({{0, 1, 2}, {4, 6, 8}}, device);
+    std::tie(mean, variance) = src.MeanVariance({0});
+    EXPECT_EQ(mean.GetShape(), core::SizeVector({3}));
+    EXPECT_EQ(mean.ToFlatVector<float>(), std::vector<float>({2, 3.5, 5}));
+    EXPECT_EQ(variance.ToFlatVector<float>(),
+              std::vector<float>({4, 6.25, 9}));
+    std::tie(mean, variance) = src.MeanVariance({1}, true);
+    EXPECT_EQ(mean.GetShape(), core::SizeVector({2, 1}));
+    EXPECT_TRUE(mean.AllClose(core::Tensor::Init<float>({{1}, {6}}, device)));
+    EXPECT_TRUE(variance.AllClose(
+            core::Tensor::Init<float>({{2.f / 3.f}, {8.f / 3.f}}, device)));
+    std::tie(mean, variance) = src.MeanVariance({0, 1});
+    EXPECT_EQ(mean.GetShape(), core::SizeVector({}));
+    EXPECT_FLOAT_EQ(mean.Item<float>(), 3.5f);
+    EXPECT_FLOAT_EQ(variance.Item<float>(), 95.f / 12.f);
+
+    // Empty reduction.
+    src = core::Tensor::Ones({0, 2}, core::Dtype::Float32, device);
+    std::tie(mean, variance) = src.MeanVariance({0});
+    EXPECT_EQ(mean.GetShape(), core::SizeVector({2}));
+    EXPECT_TRUE(std::isnan(mean.ToFlatVector<float>()[0]));
+    EXPECT_TRUE(std::isnan(variance.ToFlatVector<float>()[1]));
+
+    // Large input with an offset, compared against the two-pass result.
+    // The offset of 1e4 makes a naive sum of squares lose precision.
+    std::vector<double> vals(3 * 5000);
+    for (size_t i = 0; i < vals.size(); ++i) {
+        vals[i] = 1e4 + static_cast<double>((i * 7919) % 101) / 10.0;
+    }
+    core::Tensor src_f64(vals, {5000, 3}, core::Dtype::Float64, device);
+    for (const core::SizeVector& dims :
+         std::vector<core::SizeVector>{{0}, {1}, {0, 1}}) {
+        core::Tensor ref_mean = src_f64.Mean(dims, true);
+        core::Tensor diff = src_f64 - ref_mean;
+        core::Tensor ref_var = (diff * diff).Mean(dims);
+        for (const core::Dtype& dtype :
+             {core::Dtype::Float32, core::Dtype::Float64}) {
+            src = src_f64.To(dtype);
+            std::tie(mean, variance) = src.MeanVariance(dims);
+            EXPECT_TRUE(mean.To(core::Dtype::Float64)
+                                .AllClose(ref_mean.Reshape(mean.GetShape()),
+                                          1e-5, 1e-5));
+            EXPECT_TRUE(variance.To(core::Dtype::Float64)
+                                .AllClose(ref_var, 1e-3, 1e-3));
+        }
+    }
+}
+
+TEST_P(TensorPermuteDevices, ReduceTallSkinny) {
+    core::Device device = GetParam();
+
+    // N x 3 tensors hit the dedicated tall-skinny reduction kernels on CUDA.
+    const int64_t n = 4099;
+    std::vector<float> vals(n * 3);
+    for (int64_t i = 0; i < n; ++i) {
+        vals[i * 3 + 0] = static_cast<float>(i % 13);
+        vals[i * 3 + 1] = static_cast<float>(i % 7) - 3.f;
+        vals[i * 3 + 2] = 1.f;
+    }
+    core::Tensor src(vals, {n, 3}, core::Dtype::Float32, device);
+
+    std::vector<float> ref_sum(3, 0.f);
+    std::vector<float> ref_min(3, std::numeric_limits<float>::max());
+    std::vector<float> ref_max(3, std::numeric_limits<float>::lowest());
+    for (int64_t i = 0; i < n; ++i) {
+        for (int64_t j = 0; j < 3; ++j) {
+            ref_sum[j] += vals[i * 3 + j];
+            ref_min[j] = std::min(ref_min[j], vals[i * 3 + j]);
+            ref_max[j] = std::max(ref_max[j], vals[i * 3 + j]);
+        }
+    }
+    EXPECT_EQ(src.Sum({0}).ToFlatVector<float>(), ref_sum);
+    EXPECT_EQ(src.Min({0}).ToFlatVector<float>(), ref_min);
+    EXPECT_EQ(src.Max({0}).ToFlatVector<float>(), ref_max);
+
+    std::vector<float> row_sum = src.Sum({1}).ToFlatVector<float>();
+    std::vector<float> row_max = src.Max({1}).ToFlatVector<float>();
+    ASSERT_EQ(static_cast<int64_t>(row_sum.size()), n);
+    for (int64_t i = 0; i < n; ++i) {
+        EXPECT_EQ(row_sum[i],
+                  vals[i * 3] + vals[i * 3 + 1] + vals[i * 3 + 2]);
+        EXPECT_EQ(row_max[i], std::max({vals[i * 3], vals[i * 3 + 1],
+                                        vals[i * 3 + 2]}));
+    }
+
+    // Unaligned 1D slice exercises the vectorized input loads.
+    core::Tensor ones = core::Tensor::Ones({10001}, core::Dtype::Int64, device);
+    EXPECT_EQ(ones.Slice(0, 3, 10001).Sum({0}).Item<int64_t>(), 9998);
+}
+
+TEST_P(TensorPermuteDevices, ReduceUnalignedRows) {
+    core::Device device = GetParam();
+    core::Device cpu_device("CPU:0");
+
+    // Many rows with an odd inner length: on CUDA, several warp rows of a
+    // block reduce different rows, each with an unaligned head or tail. The
+    // values are distinct integers, so the sums are exact and ArgMin/ArgMax
+    // have no ties.
+    const int64_t rows = 64;
+    const int64_t cols = 202;
+    std::vector<float> vals(rows * cols);
+    for (int64_t i = 0; i < rows * cols; ++i) {
+        vals[i] = static_cast<float>((i * 7919) % 20011) - 10000.f;
+    }
+    core::Tensor full(vals, {rows, cols}, core::Dtype::Float32, device);
+    for (const core::Tensor& src : {full.Slice(1, 0, cols - 1).Contiguous(),
+                                    full.Slice(1, 1, cols)}) {
+        core::Tensor src_cpu = src.To(cpu_device);
+        EXPECT_EQ(src.Sum({1}).ToFlatVector<float>(),
+                  src_cpu.Sum({1}).ToFlatVector<float>());
+        EXPECT_EQ(src.Min({1}).ToFlatVector<float>(),
+                  src_cpu.Min({1}).ToFlatVector<float>());
+        EXPECT_EQ(src.Max({1}).ToFlatVector<float>(),
+                  src_cpu.Max({1}).ToFlatVector<float>());
+        EXPECT_EQ(src.ArgMin({1}).ToFlatVector<int64_t>(),
+                  src_cpu.ArgMin({1}).ToFlatVector<int64_t>());
+        EXPECT_EQ(src.ArgMax({1}).ToFlatVector<int64_t>(),
+                  src_cpu.ArgMax({1}).ToFlatVector<int64_t>());
+    }
+}
+
 TEST_P(TensorPermuteDevices, ToDLPackFromDLPack) {
     core::Device device = GetParam();
     core::Tensor src_t = core::Tensor::Init<float>(
@@ -2736,6 +3484,18 @@ TEST_P(TensorPermuteDevices, ToDLPackFromDLPack) {
               std::vector<float>({12, 14, 20, 22}));
 }
 
+TEST(Tensor, FromDLPackPinned) {
+    // Producers may report pinned host memory as kDLCPUPinned.
+    core::Tensor src_t = core::Tensor::Init<float>({0, 1, 2, 3});
+    DLManagedTensor *dl_t = src_t.ToDLPack();
+    dl_t->dl_tensor.ctx.device_type = DLDeviceType::kDLCPUPinned;
+
+    core::Tensor dst_t = core::Tensor::FromDLPack(dl_t);
+    EXPECT_EQ(dst_t.GetDevice(), core::Device("CPU:0"));
+    EXPECT_EQ(dst_t.GetDataPtr(), src_t.GetDataPtr());
+    EXPECT_EQ(dst_t.ToFlatVector<float>(), std::vector<float>({0, 1, 2, 3}));
+}
+
 TEST_P(TensorPermuteDevices, IsSame) {
     core::Device device = GetParam();
 
@@ -2836,6 +3596,40 @@ TEST_P(TensorPermuteDevices, NumpyIO) {
     utility::filesystem::RemoveFile(file_name);
 }
 
+TEST_P(TensorPermuteDevices, NumpyIOMmap) {
+    const core::Device &device = GetParam();
+    const std::string file_name = "tensor_mmap.npy";
+
+    core::Tensor t = core::Tensor::Init<float>({{1, 2}, {3, 4}}, device);
+    t.Save(file_name);
+
+    // Read-only mapping.
+    core::Tensor t_load =
+            core::Tensor::Load(file_name, core::Tensor::MmapMode::ReadOnly);
+    EXPECT_EQ(t_load.GetDevice(), core::Device("CPU:0"));
+    EXPECT_TRUE(t_load.IsContiguous());
+    EXPECT_TRUE(t.AllClose(t_load.To(device)));
+
+    // Copy-on-write mapping, modifications are not written to the file.
+    core::Tensor t_cow =
+            core::Tensor::Load(file_name, core::Tensor::MmapMode::CopyOnWrite);
+    t_cow[0][0] = 100.f;
+    EXPECT_EQ(t_cow.ToFlatVector<float>(), std::vector<float>({100, 2, 3, 4}));
+    EXPECT_EQ(t_load.ToFlatVector<float>(), std::vector<float>({1, 2, 3, 4}));
+    EXPECT_TRUE(t.AllClose(core::Tensor::Load(file_name).To(device)));
+
+    // {0} tensor.
+    t = core::Tensor::Ones({0}, core::Dtype::Float32, device);
+    t.Save(file_name);
+    t_load = core::Tensor::Load(file_name, core::Tensor::MmapMode::ReadOnly);
+    EXPECT_EQ(t_load.GetShape(), core::SizeVector({0}));
+
+    // Clean up. The mapped tensors keep the file contents alive.
+    t_cow = core::Tensor();
+    t_load = core::Tensor();
+    utility::filesystem::RemoveFile(file_name);
+}
+
 TEST_P(TensorPermuteDevices, RValueScalar) {
     const core::Device &device = GetParam();
     core::Tensor t, t_ref;
@@ -368,6 +368,60 @@ TEST_P(TensorListPermuteDevices, Extend) {
     EXPECT_TRUE(tl1[7].AllClose(core::Tensor::Zeros({2, 3}, dtype, device)));
 }
 
+TEST_P(TensorListPermuteDevices, ExtendTensor) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::TensorList tl({2, 3}, dtype, device);
+    tl.Extend(core::Tensor::Ones({3, 2, 3}, dtype, device));
+    EXPECT_EQ(tl.GetSize(), 3);
+    EXPECT_TRUE(tl.AsTensor().AllClose(
+            core::Tensor::Ones({3, 2, 3}, dtype, device)));
+
+    // Extending with a view of itself.
+    tl.Extend(tl.AsTensor());
+    EXPECT_EQ(tl.GetSize(), 6);
+    EXPECT_TRUE(tl.AsTensor().AllClose(
+            core::Tensor::Ones({6, 2, 3}, dtype, device)));
+
+    tl.Extend(core::Tensor::Zeros({0, 2, 3}, dtype, device));
+    EXPECT_EQ(tl.GetSize(), 6);
+
+    EXPECT_ANY_THROW(tl.Extend(core::Tensor::Ones({2, 3}, dtype, device)));
+    EXPECT_ANY_THROW(tl.Extend(
+            core::Tensor::Ones({3, 2, 3}, core::Dtype::Int32, device)));
+}
+
+TEST_P(TensorListPermuteDevices, Reserve) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    core::TensorList tl({2, 3}, dtype, device);
+    tl.PushBack(core::Tensor::Ones({2, 3}, dtype, device));
+    tl.Reserve(100);
+    EXPECT_EQ(tl.GetSize(), 1);
+    EXPECT_GE(tl.GetReservedSize(), 100);
+    EXPECT_TRUE(tl[0].AllClose(core::Tensor::Ones({2, 3}, dtype, device)));
+
+    // Growing within the reserved size does not reallocate.
+    int64_t reserved_size = tl.GetReservedSize();
+    const void* data_ptr = tl.GetInternalTensor().GetDataPtr();
+    for (int i = 1; i < 100; ++i) {
+        tl.PushBack(core::Tensor::Ones({2, 3}, dtype, device));
+    }
+    EXPECT_EQ(tl.GetReservedSize(), reserved_size);
+    EXPECT_EQ(tl.GetInternalTensor().GetDataPtr(), data_ptr);
+
+    // Reserving less than the reserved size is a no-op.
+    tl.Reserve(10);
+    EXPECT_EQ(tl.GetSize(), 100);
+    EXPECT_EQ(tl.GetReservedSize(), reserved_size);
+
+    core::TensorList tl_inplace = core::TensorList::FromTensor(
+            core::Tensor::Ones({3, 2, 3}, dtype, device), true);
+    EXPECT_ANY_THROW(tl_inplace.Reserve(10));
+}
+
 TEST_P(TensorListPermuteDevices, Concatenate) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Dtype::Float32;
@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/core/hashmap/TieredHashmap.h"
+
+#include <vector>
+
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class TieredHashmapPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TieredHashmap,
+                         TieredHashmapPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static core::Tensor FindValues(core::TieredHashmap& hashmap,
+                               const core::Tensor& keys,
+                               core::Tensor& masks) {
+    core::Tensor addrs;
+    hashmap.Find(keys, addrs, masks);
+    return hashmap.GetDeviceHashmap().GetValueTensor().IndexGet(
+            {addrs.To(core::Dtype::Int64)});
+}
+
+TEST_P(TieredHashmapPermuteDevices, SpillAndFaultIn) {
+    core::Device device = GetParam();
+    std::vector<core::HashmapBackend> backends;
+    if (device.GetType() == core::Device::DeviceType::CUDA) {
+        backends.push_back(core::HashmapBackend::Slab);
+        backends.push_back(core::HashmapBackend::StdGPU);
+    } else {
+        backends.push_back(core::HashmapBackend::TBB);
+        backends.push_back(core::HashmapBackend::OpenAddressing);
+    }
+
+    for (auto backend : backends) {
+        core::TieredHashmap hashmap(4, core::Dtype::Int32, core::Dtype::Int32,
+                                    {1}, {1}, device, /*max_idle_frames=*/1,
+                                    backend);
+        const int64_t capacity = hashmap.GetDeviceHashmap().GetCapacity();
+
+        core::Tensor addrs, masks;
+        core::Tensor keys_a = core::Tensor::Init<int>({0, 1, 2, 3}, device);
+        hashmap.Insert(keys_a, keys_a.Mul(10), addrs, masks);
+        EXPECT_TRUE(masks.All());
+        hashmap.NextFrame();
+
+        // The device tier is full: the least recently used entries spill.
+        core::Tensor keys_b = core::Tensor::Init<int>({4, 5, 3}, device);
+        hashmap.Insert(keys_b, keys_b.Mul(10), addrs, masks);
+        EXPECT_EQ(masks.ToFlatVector<bool>(),
+                  std::vector<bool>({true, true, false}));
+        EXPECT_EQ(hashmap.Size(), 6);
+        EXPECT_LE(hashmap.GetDeviceSize(), 4);
+        EXPECT_EQ(hashmap.GetDeviceHashmap().GetCapacity(), capacity);
+        hashmap.NextFrame();
+
+        // Spilled entries are faulted back in with their values.
+        core::Tensor keys = core::Tensor::Init<int>({0, 1, 9}, device);
+        core::Tensor values = FindValues(hashmap, keys, masks);
+        EXPECT_EQ(masks.ToFlatVector<bool>(),
+                  std::vector<bool>({true, true, false}));
+        EXPECT_EQ(values.IndexGet({masks}).ToFlatVector<int>(),
+                  std::vector<int>({0, 10}));
+        EXPECT_EQ(hashmap.Size(), 6);
+
+        // Activating a spilled key restores it instead of resetting it.
+        hashmap.NextFrame();
+        hashmap.NextFrame();
+        EXPECT_EQ(hashmap.GetDeviceSize(), 0);
+        hashmap.Activate(core::Tensor::Init<int>({5, 6}, device), addrs,
+                         masks);
+        EXPECT_EQ(masks.ToFlatVector<bool>(), std::vector<bool>({false, true}));
+        values = FindValues(hashmap, core::Tensor::Init<int>({5}, device),
+                            masks);
+        EXPECT_EQ(values.ToFlatVector<int>(), std::vector<int>({50}));
+        EXPECT_EQ(hashmap.Size(), 7);
+
+        hashmap.Erase(core::Tensor::Init<int>({0, 5, 8}, device), masks);
+        EXPECT_EQ(masks.ToFlatVector<bool>(),
+                  std::vector<bool>({true, true, false}));
+        EXPECT_EQ(hashmap.Size(), 5);
+
+        // The working set of a single frame must fit on the device.
+        core::Tensor many_keys = core::Tensor::Arange(100, 110, 1,
+                                                      core::Dtype::Int32,
+                                                      device);
+        EXPECT_ANY_THROW(hashmap.Activate(many_keys, addrs, masks));
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/AsRigidAsPossibleDeformation.h"
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(AsRigidAsPossibleDeformation, MatchesDeformAsRigidAsPossible) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    const std::vector<int> indices = {0, 1, 5, 30};
+    std::vector<Eigen::Vector3d> positions;
+    for (int idx : indices) {
+        positions.push_back(mesh->vertices_[idx]);
+    }
+    positions[0] += Eigen::Vector3d(0, 0, 0.3);
+
+    using Energy = geometry::MeshBase::DeformAsRigidAsPossibleEnergy;
+    for (Energy energy : {Energy::Spokes, Energy::Smoothed}) {
+        auto expected = mesh->DeformAsRigidAsPossible(indices, positions, 20,
+                                                      energy);
+
+        // Iterating in several steps continues from the previous state.
+        geometry::AsRigidAsPossibleDeformation deformation(*mesh, indices,
+                                                           energy);
+        deformation.SetConstraintPositions(positions);
+        EXPECT_EQ(deformation.Iterate(5), 5u);
+        EXPECT_EQ(deformation.Iterate(15), 15u);
+        EXPECT_EQ(deformation.GetNumIterations(), 20u);
+        EXPECT_GE(deformation.GetEnergy(), 0);
+        ExpectEQ(deformation.GetVertices(), expected->vertices_, 1e-8);
+        ExpectEQ(deformation.GetDeformedMesh()->triangles_,
+                 mesh->triangles_);
+
+        deformation.Reset();
+        EXPECT_EQ(deformation.GetNumIterations(), 0u);
+        ExpectEQ(deformation.GetVertices(), mesh->vertices_);
+        deformation.Iterate(20);
+        ExpectEQ(deformation.GetVertices(), expected->vertices_, 1e-8);
+    }
+}
+
+TEST(AsRigidAsPossibleDeformation, WarmStart) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    const std::vector<int> indices = {0, 1};
+    std::vector<Eigen::Vector3d> positions = {mesh->vertices_[0],
+                                              mesh->vertices_[1]};
+    geometry::AsRigidAsPossibleDeformation deformation(*mesh, indices);
+    EXPECT_ANY_THROW(deformation.SetConstraintPositions({positions[0]}));
+
+    // Dragging the constraint in small steps.
+    for (int step = 1; step <= 5; ++step) {
+        positions[0] = mesh->vertices_[0] + Eigen::Vector3d(0, 0, 0.05 * step);
+        deformation.SetConstraintPositions(positions);
+        deformation.Iterate(5);
+    }
+    ExpectEQ(deformation.GetVertices()[0], positions[0], 1e-8);
+    ExpectEQ(deformation.GetVertices()[1], positions[1], 1e-8);
+    auto cold = mesh->DeformAsRigidAsPossible(indices, positions, 5);
+    auto converged = mesh->DeformAsRigidAsPossible(indices, positions, 100);
+    double warm_error = 0;
+    double cold_error = 0;
+    for (size_t i = 0; i < mesh->vertices_.size(); ++i) {
+        warm_error += (deformation.GetVertices()[i] - converged->vertices_[i])
+                              .squaredNorm();
+        cold_error +=
+                (cold->vertices_[i] - converged->vertices_[i]).squaredNorm();
+    }
+    EXPECT_LE(warm_error, cold_error);
+
+    // A time limit stops after the first iteration at the latest.
+    EXPECT_EQ(deformation.Iterate(100, 1e-12), 1u);
+}
+
+}  // namespace tests
+}  // namespace open3d
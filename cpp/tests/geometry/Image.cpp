@@ -891,6 +891,35 @@ TEST(Image, FilterHorizontal) {
     ExpectEQ(ref, output->data_);
 }
 
+TEST(Image, FilterSeparable) {
+    geometry::Image image;
+
+    // test image dimensions
+    int width = 37;
+    int height = 23;
+
+    image.Prepare(width, height, 1, 1);
+
+    Rand(image.data_, 0, 255, 0);
+
+    auto float_image = image.CreateFloatImage();
+
+    const std::vector<double> dx = {0.03125, 0.109375, 0.21875, 0.28125,
+                                    0.21875, 0.109375, 0.03125};
+    const std::vector<double> dy = {-1.0, 0.0, 1.0};
+
+    // The vertical pass must match filtering the transposed image.
+    auto ref = float_image->FilterHorizontal(dx)
+                       ->Transpose()
+                       ->FilterHorizontal(dy)
+                       ->Transpose();
+    auto output = float_image->Filter(dx, dy);
+
+    EXPECT_EQ(width, output->width_);
+    EXPECT_EQ(height, output->height_);
+    ExpectEQ(ref->data_, output->data_);
+}
+
 TEST(Image, Downsample) {
     // reference data used to validate the filtering of an image
     std::vector<uint8_t> ref = {172, 41, 59,  204, 93, 130, 242, 232,
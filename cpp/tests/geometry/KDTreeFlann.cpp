@@ -26,6 +26,8 @@
 
 #include "open3d/geometry/KDTreeFlann.h"
 
+#include <cstdio>
+
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "tests/UnitTest.h"
@@ -144,5 +146,142 @@ TEST(KDTreeFlann, SearchHybrid) {
     ExpectEQ(ref_distance2, distance2);
 }
 
+TEST(KDTreeFlann, SearchFloat32) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Eigen::Vector3d vmin(0.0, 0.0, 0.0);
+    Eigen::Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+    geometry::KDTreeFlann kdtree_float(
+            pc, geometry::KDTreeFlann::Precision::Float32);
+    EXPECT_EQ(kdtree_float.GetPrecision(),
+              geometry::KDTreeFlann::Precision::Float32);
+
+    Eigen::Vector3d query = {1.647059, 4.392157, 8.784314};
+    std::vector<int> indices, indices_float;
+    std::vector<double> distance2, distance2_float;
+
+    EXPECT_EQ(kdtree_float.SearchKNN(query, 30, indices_float,
+                                     distance2_float),
+              kdtree.SearchKNN(query, 30, indices, distance2));
+    ExpectEQ(indices, indices_float);
+    ExpectEQ(distance2, distance2_float, 1e-4);
+
+    EXPECT_EQ(kdtree_float.SearchRadius(query, 5.0, indices_float,
+                                        distance2_float),
+              kdtree.SearchRadius(query, 5.0, indices, distance2));
+    ExpectEQ(indices, indices_float);
+    ExpectEQ(distance2, distance2_float, 1e-4);
+}
+
+TEST(KDTreeFlann, BatchSearch) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Eigen::Vector3d vmin(0.0, 0.0, 0.0);
+    Eigen::Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    geometry::KDTreeFlann kdtree(pc);
+    Eigen::Map<const Eigen::MatrixXd> queries(pc.points_[0].data(), 3, size);
+
+    // knn larger than the dataset pads the rows with -1.
+    for (int knn : {30, 120}) {
+        std::vector<int> batch_indices(size * knn);
+        std::vector<double> batch_distance2(size * knn);
+        std::vector<int> counts(size);
+        EXPECT_TRUE(kdtree.SearchKNN(queries, knn, batch_indices.data(),
+                                     batch_distance2.data(), counts.data()));
+        for (int i = 0; i < size; ++i) {
+            std::vector<int> indices;
+            std::vector<double> distance2;
+            int k = kdtree.SearchKNN(pc.points_[i], knn, indices, distance2);
+            EXPECT_EQ(counts[i], k);
+            indices.resize(knn, -1);
+            distance2.resize(knn, 0.0);
+            ExpectEQ(indices, std::vector<int>(batch_indices.begin() + i * knn,
+                                               batch_indices.begin() +
+                                                       (i + 1) * knn));
+            ExpectEQ(distance2,
+                     std::vector<double>(
+                             batch_distance2.begin() + i * knn,
+                             batch_distance2.begin() + (i + 1) * knn));
+        }
+    }
+
+    int max_nn = 15;
+    double radius = 3.0;
+    std::vector<int> batch_indices(size * max_nn);
+    std::vector<double> batch_distance2(size * max_nn);
+    std::vector<int> counts(size);
+    EXPECT_TRUE(kdtree.SearchHybrid(queries, radius, max_nn,
+                                    batch_indices.data(),
+                                    batch_distance2.data(), counts.data()));
+    for (int i = 0; i < size; ++i) {
+        std::vector<int> indices;
+        std::vector<double> distance2;
+        int k = kdtree.SearchHybrid(pc.points_[i], radius, max_nn, indices,
+                                    distance2);
+        EXPECT_EQ(counts[i], k);
+        indices.resize(max_nn, -1);
+        ExpectEQ(indices, std::vector<int>(batch_indices.begin() + i * max_nn,
+                                           batch_indices.begin() +
+                                                   (i + 1) * max_nn));
+    }
+
+    // Mismatching query dimension.
+    Eigen::MatrixXd bad_queries = Eigen::MatrixXd::Zero(2, 4);
+    EXPECT_FALSE(kdtree.SearchKNN(bad_queries, 3, batch_indices.data(),
+                                  batch_distance2.data()));
+}
+
+TEST(KDTreeFlann, SaveLoad) {
+    int size = 100;
+
+    geometry::PointCloud pc;
+
+    Eigen::Vector3d vmin(0.0, 0.0, 0.0);
+    Eigen::Vector3d vmax(10.0, 10.0, 10.0);
+
+    pc.points_.resize(size);
+    Rand(pc.points_, vmin, vmax, 0);
+
+    Eigen::Vector3d query = {1.647059, 4.392157, 8.784314};
+    const std::string file_name = "test_kdtree_flann.o3dkd";
+    for (auto precision : {geometry::KDTreeFlann::Precision::Float64,
+                           geometry::KDTreeFlann::Precision::Float32}) {
+        geometry::KDTreeFlann kdtree(pc, precision);
+        EXPECT_TRUE(kdtree.Save(file_name));
+
+        std::vector<int> indices, loaded_indices;
+        std::vector<double> distance2, loaded_distance2;
+        kdtree.SearchHybrid(query, 5.0, 30, indices, distance2);
+        for (bool memory_map : {false, true}) {
+            geometry::KDTreeFlann loaded;
+            EXPECT_TRUE(loaded.Load(file_name, memory_map));
+            EXPECT_EQ(loaded.GetPrecision(), precision);
+            EXPECT_EQ(loaded.SearchHybrid(query, 5.0, 30, loaded_indices,
+                                          loaded_distance2),
+                      int(indices.size()));
+            ExpectEQ(indices, loaded_indices);
+            ExpectEQ(distance2, loaded_distance2);
+        }
+    }
+    std::remove(file_name.c_str());
+
+    geometry::KDTreeFlann empty;
+    EXPECT_FALSE(empty.Save(file_name));
+    EXPECT_ANY_THROW(empty.Load("does_not_exist.o3dkd"));
+}
+
 }  // namespace tests
 }  // namespace open3d
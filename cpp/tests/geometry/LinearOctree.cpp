@@ -0,0 +1,213 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LinearOctree.h"
+
+#include <memory>
+
+#include "open3d/geometry/Octree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/io/PointCloudIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(LinearOctree, Constructor) {
+    geometry::LinearOctree octree(10, Eigen::Vector3d(-1, -1, -1), 2);
+    ExpectEQ(octree.origin_, Eigen::Vector3d(-1, -1, -1));
+    EXPECT_EQ(octree.size_, 2);
+    EXPECT_EQ(octree.max_depth_, 10u);
+    EXPECT_TRUE(octree.IsEmpty());
+    EXPECT_ANY_THROW(geometry::LinearOctree(22));
+}
+
+TEST(LinearOctree, EightCubesTraverse) {
+    std::vector<Eigen::Vector3d> points{
+            Eigen::Vector3d(0.5, 0.5, 0.5), Eigen::Vector3d(1.5, 0.5, 0.5),
+            Eigen::Vector3d(0.5, 1.5, 0.5), Eigen::Vector3d(1.5, 1.5, 0.5),
+            Eigen::Vector3d(0.5, 0.5, 1.5), Eigen::Vector3d(1.5, 0.5, 1.5),
+            Eigen::Vector3d(0.5, 1.5, 1.5), Eigen::Vector3d(1.5, 1.5, 1.5),
+    };
+    std::vector<Eigen::Vector3d> colors{
+            Eigen::Vector3d(0.0, 0.0, 0.0), Eigen::Vector3d(0.1, 0.0, 0.0),
+            Eigen::Vector3d(0.0, 0.1, 0.0), Eigen::Vector3d(0.1, 0.1, 0.0),
+            Eigen::Vector3d(0.0, 0.0, 0.1), Eigen::Vector3d(0.1, 0.0, 0.1),
+            Eigen::Vector3d(0.0, 0.1, 0.1), Eigen::Vector3d(0.1, 0.1, 0.1),
+    };
+
+    // Points are reversed, so that the traversal order is not the insertion
+    // order.
+    std::vector<Eigen::Vector3d> points_reversed(points.rbegin(),
+                                                 points.rend());
+    std::vector<Eigen::Vector3d> colors_reversed(colors.rbegin(),
+                                                 colors.rend());
+    geometry::LinearOctree octree(1, Eigen::Vector3d(0, 0, 0), 2);
+    octree.Build(points_reversed, colors_reversed);
+    EXPECT_EQ(octree.GetNumNodes(0), 1u);
+    EXPECT_EQ(octree.GetNumLeafNodes(), 8u);
+
+    std::vector<Eigen::Vector3d> colors_traversed;
+    std::vector<size_t> child_indices_traversed;
+    std::vector<size_t> points_traversed;
+    octree.Traverse([&](const geometry::OctreeNodeInfo& node_info,
+                        size_t node_index, size_t point_begin,
+                        size_t point_end) -> bool {
+        if (node_info.depth_ == 0) {
+            ExpectEQ(node_info.origin_, Eigen::Vector3d(0, 0, 0));
+            EXPECT_EQ(node_info.size_, 2);
+            EXPECT_EQ(point_end - point_begin, 8u);
+        } else {
+            EXPECT_EQ(node_info.size_, 1);
+            Eigen::Vector3d center =
+                    node_info.origin_ + Eigen::Vector3d(0.5, 0.5, 0.5);
+            ExpectEQ(points_reversed[octree.GetPointIndices()[point_begin]],
+                     center);
+            colors_traversed.push_back(octree.GetLeafColors()[node_index]);
+            child_indices_traversed.push_back(node_info.child_index_);
+            points_traversed.push_back(point_end - point_begin);
+        }
+        return false;
+    });
+    ExpectEQ(colors_traversed, colors);
+    for (size_t i = 0; i < 8; ++i) {
+        EXPECT_EQ(child_indices_traversed[i], i);
+        EXPECT_EQ(points_traversed[i], 1u);
+    }
+
+    // Skipping the children of the root.
+    size_t num_traversed = 0;
+    octree.Traverse([&](const geometry::OctreeNodeInfo&, size_t, size_t,
+                        size_t) -> bool {
+        num_traversed++;
+        return true;
+    });
+    EXPECT_EQ(num_traversed, 1u);
+}
+
+TEST(LinearOctree, OutOfBound) {
+    geometry::LinearOctree octree(2, Eigen::Vector3d(0, 0, 0), 2);
+    octree.Build({Eigen::Vector3d(10, 10, 10), Eigen::Vector3d(2, 0, 0)});
+    EXPECT_TRUE(octree.IsEmpty());
+    EXPECT_EQ(octree.LocateLeafNode(Eigen::Vector3d(1, 1, 1)), -1);
+
+    octree.Build({Eigen::Vector3d(10, 10, 10), Eigen::Vector3d(1, 1, 1)});
+    EXPECT_EQ(octree.GetNumLeafNodes(), 1u);
+    EXPECT_EQ(octree.GetPointIndices(), std::vector<size_t>({1}));
+    EXPECT_EQ(octree.LocateLeafNode(Eigen::Vector3d(1.2, 1.2, 1.2)), 0);
+    EXPECT_EQ(octree.LocateLeafNode(Eigen::Vector3d(0.2, 0.2, 0.2)), -1);
+    EXPECT_EQ(octree.LocateLeafNode(Eigen::Vector3d(10, 10, 10)), -1);
+}
+
+TEST(LinearOctree, FragmentPLYToOctree) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd);
+    for (size_t max_depth : {0, 1, 5}) {
+        geometry::Octree octree(max_depth);
+        octree.ConvertFromPointCloud(pcd, 0.01);
+        geometry::LinearOctree linear_octree(max_depth);
+        linear_octree.ConvertFromPointCloud(pcd, 0.01);
+        EXPECT_TRUE(*linear_octree.ToOctree() == octree);
+    }
+}
+
+TEST(LinearOctree, FragmentPLYLocate) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd);
+    size_t max_depth = 5;
+    geometry::Octree octree(max_depth);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+    geometry::LinearOctree linear_octree(max_depth);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+
+    for (size_t idx = 0; idx < pcd.points_.size(); idx += 200) {
+        const Eigen::Vector3d& point = pcd.points_[idx];
+        int64_t leaf_index = linear_octree.LocateLeafNode(point);
+        ASSERT_GE(leaf_index, 0);
+        geometry::OctreeNodeInfo node_info =
+                linear_octree.GetLeafNodeInfo(leaf_index);
+        EXPECT_TRUE(geometry::Octree::IsPointInBound(point, node_info.origin_,
+                                                     node_info.size_));
+        EXPECT_EQ(node_info.depth_, max_depth);
+
+        std::shared_ptr<geometry::OctreeNodeInfo> expected_node_info =
+                octree.LocateLeafNode(point).second;
+        ExpectEQ(node_info.origin_, expected_node_info->origin_);
+        EXPECT_EQ(node_info.child_index_, expected_node_info->child_index_);
+
+        size_t point_begin, point_end;
+        std::tie(point_begin, point_end) =
+                linear_octree.GetLeafPointRange(leaf_index);
+        const std::vector<size_t>& indices = linear_octree.GetPointIndices();
+        EXPECT_NE(std::find(indices.begin() + point_begin,
+                            indices.begin() + point_end, idx),
+                  indices.begin() + point_end);
+    }
+}
+
+TEST(LinearOctree, FragmentPLYToVoxelGrid) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd);
+    size_t max_depth = 6;
+    geometry::Octree octree(max_depth);
+    octree.ConvertFromPointCloud(pcd, 0.01);
+    geometry::LinearOctree linear_octree(max_depth);
+    linear_octree.ConvertFromPointCloud(pcd, 0.01);
+
+    std::shared_ptr<geometry::VoxelGrid> voxel_grid =
+            linear_octree.ToVoxelGrid();
+    ExpectEQ(voxel_grid->origin_, octree.origin_);
+    EXPECT_DOUBLE_EQ(voxel_grid->voxel_size_,
+                     octree.size_ / pow(2, max_depth));
+    EXPECT_EQ(voxel_grid->voxels_.size(), linear_octree.GetNumLeafNodes());
+
+    // Each leaf of the Octree has a voxel with the same color.
+    size_t num_leaves = 0;
+    octree.Traverse(
+            [&](const std::shared_ptr<geometry::OctreeNode>& node,
+                const std::shared_ptr<geometry::OctreeNodeInfo>& node_info)
+                    -> bool {
+                if (auto leaf_node = std::dynamic_pointer_cast<
+                            geometry::OctreeColorLeafNode>(node)) {
+                    Eigen::Vector3d center = node_info->origin_.array() +
+                                             node_info->size_ / 2;
+                    Eigen::Vector3i grid_index =
+                            voxel_grid->GetVoxel(center);
+                    auto it = voxel_grid->voxels_.find(grid_index);
+                    EXPECT_TRUE(it != voxel_grid->voxels_.end());
+                    if (it != voxel_grid->voxels_.end()) {
+                        ExpectEQ(it->second.color_, leaf_node->color_);
+                    }
+                    num_leaves++;
+                }
+                return false;
+            });
+    EXPECT_EQ(num_leaves, voxel_grid->voxels_.size());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,116 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/MinimumSpanningTree.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+static int64_t FindRoot(std::vector<int64_t>& parents, int64_t v) {
+    while (parents[v] != v) {
+        v = parents[v] = parents[parents[v]];
+    }
+    return v;
+}
+
+// Reference weight of the minimum spanning forest (Kruskal).
+static double KruskalWeight(std::vector<geometry::WeightedEdge> edges,
+                            size_t num_vertices) {
+    std::sort(edges.begin(), edges.end(),
+              [](const geometry::WeightedEdge& e0,
+                 const geometry::WeightedEdge& e1) {
+                  return e0.weight_ < e1.weight_;
+              });
+    std::vector<int64_t> parents(num_vertices);
+    std::iota(parents.begin(), parents.end(), 0);
+    double weight = 0;
+    for (const geometry::WeightedEdge& e : edges) {
+        const int64_t r0 = FindRoot(parents, e.v0_);
+        const int64_t r1 = FindRoot(parents, e.v1_);
+        if (r0 != r1) {
+            parents[r0] = r1;
+            weight += e.weight_;
+        }
+    }
+    return weight;
+}
+
+TEST(MinimumSpanningTree, RandomGraph) {
+    std::mt19937 rng(0);
+    const size_t num_vertices = 1000;
+    std::uniform_int_distribution<size_t> vertex(0, num_vertices - 1);
+    std::uniform_real_distribution<double> weight(0.0, 1.0);
+    std::vector<geometry::WeightedEdge> edges;
+    for (size_t i = 0; i < 2500; ++i) {
+        edges.emplace_back(vertex(rng), vertex(rng), weight(rng));
+    }
+
+    std::vector<int64_t> components;
+    const std::vector<geometry::WeightedEdge> tree =
+            geometry::MinimumSpanningTree(edges, num_vertices, &components);
+    double tree_weight = 0;
+    std::vector<int64_t> parents(num_vertices);
+    std::iota(parents.begin(), parents.end(), 0);
+    for (const geometry::WeightedEdge& e : tree) {
+        // No cycles.
+        const int64_t r0 = FindRoot(parents, e.v0_);
+        const int64_t r1 = FindRoot(parents, e.v1_);
+        ASSERT_NE(r0, r1);
+        parents[r0] = r1;
+        tree_weight += e.weight_;
+        EXPECT_EQ(components[e.v0_], components[e.v1_]);
+    }
+    EXPECT_NEAR(tree_weight, KruskalWeight(edges, num_vertices), 1e-9);
+    for (size_t v = 0; v < num_vertices; ++v) {
+        for (size_t w = v + 1; w < num_vertices; w += 97) {
+            EXPECT_EQ(components[v] == components[w],
+                      FindRoot(parents, v) == FindRoot(parents, w));
+        }
+    }
+}
+
+TEST(MinimumSpanningTree, BreadthFirstTraversal) {
+    // Path 0 - 1 - 2 - 3 and the separate edge 4 - 5.
+    const std::vector<geometry::WeightedEdge> tree = {
+            {0, 1, 1.0}, {2, 1, 1.0}, {3, 2, 1.0}, {4, 5, 1.0}};
+    std::vector<int64_t> order, level_offsets, parents;
+    geometry::BreadthFirstTraversal(tree, 6, {1, 5}, order, level_offsets,
+                                    parents);
+    ASSERT_EQ(order.size(), 6u);
+    EXPECT_EQ(level_offsets, std::vector<int64_t>({0, 2, 5, 6}));
+    EXPECT_EQ(order[5], 3);
+    EXPECT_EQ(parents, std::vector<int64_t>({1, -1, 1, 2, 5, -1}));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/NeighborCache.h"
+
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/KDTreeFlann.h"
+#include "open3d/geometry/Keypoint.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(NeighborCache, Search) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    auto pcd = mesh->SamplePointsUniformly(2000);
+    geometry::KDTreeFlann kdtree(*pcd);
+
+    const geometry::KDTreeSearchParamHybrid cached_param(0.2, 30);
+    geometry::NeighborCache cache(*pcd, cached_param);
+    EXPECT_EQ(cache.NumQueries(), pcd->points_.size());
+
+    const geometry::KDTreeSearchParamHybrid param(0.1, 10);
+    ASSERT_TRUE(cache.Covers(param));
+    for (size_t i = 0; i < pcd->points_.size(); ++i) {
+        std::vector<int> indices, cached_indices;
+        std::vector<double> distance2, cached_distance2;
+        kdtree.Search(pcd->points_[i], cached_param, indices, distance2);
+        EXPECT_EQ(cache.NumNeighbors(i), int(indices.size()));
+
+        int k = kdtree.Search(pcd->points_[i], param, indices, distance2);
+        int cached_k =
+                cache.Search(i, param, cached_indices, cached_distance2);
+        EXPECT_EQ(cached_k, k);
+        ExpectEQ(cached_distance2, distance2);
+    }
+}
+
+TEST(NeighborCache, Covers) {
+    auto pcd = std::make_shared<geometry::PointCloud>();
+    pcd->points_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+
+    geometry::NeighborCache radius_cache(
+            *pcd, geometry::KDTreeSearchParamRadius(1.0));
+    EXPECT_TRUE(radius_cache.Covers(geometry::KDTreeSearchParamRadius(0.5)));
+    EXPECT_TRUE(
+            radius_cache.Covers(geometry::KDTreeSearchParamHybrid(1.0, 2)));
+    EXPECT_FALSE(radius_cache.Covers(geometry::KDTreeSearchParamRadius(2.0)));
+    EXPECT_FALSE(radius_cache.Covers(geometry::KDTreeSearchParamKNN(2)));
+
+    geometry::NeighborCache knn_cache(*pcd, geometry::KDTreeSearchParamKNN(3));
+    EXPECT_TRUE(knn_cache.Covers(geometry::KDTreeSearchParamKNN(2)));
+    EXPECT_TRUE(knn_cache.Covers(geometry::KDTreeSearchParamHybrid(5.0, 3)));
+    EXPECT_FALSE(knn_cache.Covers(geometry::KDTreeSearchParamKNN(4)));
+    EXPECT_FALSE(knn_cache.Covers(geometry::KDTreeSearchParamRadius(0.5)));
+
+    geometry::NeighborCache hybrid_cache(
+            *pcd, geometry::KDTreeSearchParamHybrid(1.0, 3));
+    EXPECT_TRUE(
+            hybrid_cache.Covers(geometry::KDTreeSearchParamHybrid(0.5, 2)));
+    EXPECT_FALSE(hybrid_cache.Covers(geometry::KDTreeSearchParamRadius(0.5)));
+}
+
+TEST(NeighborCache, SharedNeighborhoods) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    auto pcd = mesh->SamplePointsUniformly(2000);
+    auto pcd_cached = std::make_shared<geometry::PointCloud>(*pcd);
+
+    const geometry::KDTreeSearchParamHybrid param(0.25, 30);
+    geometry::NeighborCache cache(*pcd, param);
+    pcd->EstimateNormals(param);
+    pcd_cached->EstimateNormals(cache, param);
+    ExpectEQ(pcd_cached->normals_, pcd->normals_);
+
+    auto feature = pipelines::registration::ComputeFPFHFeature(*pcd, param);
+    auto feature_cached = pipelines::registration::ComputeFPFHFeature(
+            *pcd_cached, cache, param);
+    ExpectEQ(feature_cached->data_, feature->data_);
+
+    const double salient_radius = 0.2, non_max_radius = 0.15;
+    geometry::NeighborCache radius_cache(
+            *pcd, geometry::KDTreeSearchParamRadius(salient_radius));
+    auto keypoints = geometry::keypoint::ComputeISSKeypoints(
+            *pcd, salient_radius, non_max_radius);
+    auto keypoints_cached = geometry::keypoint::ComputeISSKeypoints(
+            *pcd, radius_cache, salient_radius, non_max_radius);
+    ExpectEQ(keypoints_cached->points_, keypoints->points_);
+}
+
+}  // namespace tests
+}  // namespace open3d
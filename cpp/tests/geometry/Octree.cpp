@@ -373,6 +373,34 @@ TEST(Octree, FragmentPLYLocate) {
     }
 }
 
+TEST(Octree, FragmentPLYConvertMatchesInsertPoint) {
+    geometry::PointCloud pcd;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd);
+    for (size_t max_depth : {0, 1, 6}) {
+        geometry::Octree octree(max_depth);
+        octree.ConvertFromPointCloud(pcd, 0.01);
+
+        // Serial insertion with the same bounds.
+        geometry::Octree serial_octree(max_depth, octree.origin_,
+                                       octree.size_);
+        for (size_t idx = 0; idx < pcd.points_.size(); idx++) {
+            serial_octree.InsertPoint(
+                    pcd.points_[idx],
+                    geometry::OctreePointColorLeafNode::GetInitFunction(),
+                    geometry::OctreePointColorLeafNode::GetUpdateFunction(
+                            idx, pcd.colors_[idx]),
+                    geometry::OctreeInternalPointNode::GetInitFunction(),
+                    geometry::OctreeInternalPointNode::GetUpdateFunction(idx));
+        }
+        EXPECT_TRUE(octree == serial_octree);
+
+        if (auto root_node = std::dynamic_pointer_cast<
+                    geometry::OctreeInternalPointNode>(octree.root_node_)) {
+            EXPECT_EQ(root_node->indices_.size(), pcd.points_.size());
+        }
+    }
+}
+
 TEST(Octree, ConvertFromPointCloudBoundSinglePoint) {
     geometry::Octree octree(10);
     geometry::PointCloud pcd;
@@ -27,6 +27,10 @@
 #include "open3d/geometry/PointCloud.h"
 
 #include <algorithm>
+#include <map>
+#include <numeric>
+#include <random>
+#include <tuple>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/geometry/BoundingVolume.h"
@@ -193,6 +197,67 @@ TEST(PointCloud, GetOrientedBoundingBox) {
                                                 {3, 2, 1}})));
 }
 
+TEST(PointCloud, CreateOrientedBoundingBoxesFromPointSets) {
+    std::vector<Eigen::Vector3d> points;
+    std::vector<size_t> offsets{0};
+    // Random boxes, a planar set and an empty set.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    for (int i = 0; i < 8; ++i) {
+        const Eigen::Matrix3d R =
+                geometry::Geometry3D::GetRotationMatrixFromXYZ(
+                        Eigen::Vector3d(uniform(rng), uniform(rng),
+                                        uniform(rng)));
+        const Eigen::Vector3d t(uniform(rng), uniform(rng), uniform(rng));
+        for (int j = 0; j < 50 + 10 * i; ++j) {
+            points.push_back(R * Eigen::Vector3d(3 * uniform(rng),
+                                                 2 * uniform(rng),
+                                                 uniform(rng)) +
+                             t);
+        }
+        offsets.push_back(points.size());
+    }
+    points.insert(points.end(), {{0, 0, 0}, {2, 0, 0}, {0, 1, 0}, {2, 1, 0}});
+    offsets.push_back(points.size());
+    offsets.push_back(points.size());
+
+    const std::vector<geometry::OrientedBoundingBox> boxes =
+            geometry::OrientedBoundingBox::CreateFromPointSets(points,
+                                                               offsets);
+    ASSERT_EQ(boxes.size(), offsets.size() - 1);
+    for (size_t i = 0; i < 8; ++i) {
+        const geometry::OrientedBoundingBox obb =
+                geometry::OrientedBoundingBox::CreateFromPoints(
+                        std::vector<Eigen::Vector3d>(
+                                points.begin() + offsets[i],
+                                points.begin() + offsets[i + 1]));
+        ExpectEQ(boxes[i].center_, obb.center_);
+        ExpectEQ(boxes[i].extent_, obb.extent_);
+        ExpectEQ(boxes[i].R_, obb.R_);
+    }
+    ExpectEQ(boxes[8].center_, Eigen::Vector3d(1, 0.5, 0));
+    ExpectEQ(boxes[8].extent_, Eigen::Vector3d(2, 1, 0));
+    ExpectEQ(boxes[9].extent_, Eigen::Vector3d(0, 0, 0));
+
+    // The principal axes of all points contain every point of the set.
+    const std::vector<geometry::OrientedBoundingBox> pca_boxes =
+            geometry::OrientedBoundingBox::CreateFromPointSets(points, offsets,
+                                                               false);
+    ASSERT_EQ(pca_boxes.size(), offsets.size() - 1);
+    for (size_t i = 0; i < 8; ++i) {
+        std::vector<Eigen::Vector3d> set_points(
+                points.begin() + offsets[i], points.begin() + offsets[i + 1]);
+        const geometry::OrientedBoundingBox obb = pca_boxes[i];
+        geometry::OrientedBoundingBox scaled = obb;
+        scaled.extent_ *= 1.0 + 1e-6;
+        EXPECT_EQ(scaled.GetPointIndicesWithinBoundingBox(set_points).size(),
+                  set_points.size());
+    }
+
+    EXPECT_ANY_THROW(geometry::OrientedBoundingBox::CreateFromPointSets(
+            points, {0, 10}));
+}
+
 TEST(PointCloud, Transform) {
     std::vector<Eigen::Vector3d> points = {
             {0, 0, 0},
@@ -594,6 +659,50 @@ TEST(PointCloud, VoxelDownSample) {
     ExpectEQ(ApplyIndices(pc_down->colors_, sort_indices), colors_down);
 }
 
+TEST(PointCloud, VoxelDownSampleSortedByVoxel) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(-2.0, 3.0);
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 20000; i++) {
+        pcd.points_.push_back({dist(rng), dist(rng), dist(rng)});
+        pcd.colors_.push_back({dist(rng), dist(rng), dist(rng)});
+    }
+
+    // Reference: serial per-voxel sums, in lexicographic voxel order.
+    const double voxel_size = 0.25;
+    const Eigen::Vector3d voxel_min_bound =
+            pcd.GetMinBound() - Eigen::Vector3d::Constant(voxel_size * 0.5);
+    std::map<std::tuple<int, int, int>,
+             std::tuple<Eigen::Vector3d, Eigen::Vector3d, int>>
+            voxels;
+    for (size_t i = 0; i < pcd.points_.size(); i++) {
+        Eigen::Vector3d ref_coord =
+                (pcd.points_[i] - voxel_min_bound) / voxel_size;
+        auto &voxel = voxels[std::make_tuple(int(floor(ref_coord(0))),
+                                             int(floor(ref_coord(1))),
+                                             int(floor(ref_coord(2))))];
+        if (std::get<2>(voxel) == 0) {
+            std::get<0>(voxel).setZero();
+            std::get<1>(voxel).setZero();
+        }
+        std::get<0>(voxel) += pcd.points_[i];
+        std::get<1>(voxel) += pcd.colors_[i];
+        std::get<2>(voxel)++;
+    }
+
+    std::shared_ptr<geometry::PointCloud> pc_down =
+            pcd.VoxelDownSample(voxel_size);
+    ASSERT_EQ(pc_down->points_.size(), voxels.size());
+    ASSERT_EQ(pc_down->colors_.size(), voxels.size());
+    size_t v = 0;
+    for (const auto &voxel : voxels) {
+        const int num_points = std::get<2>(voxel.second);
+        EXPECT_EQ(pc_down->points_[v], std::get<0>(voxel.second) / num_points);
+        EXPECT_EQ(pc_down->colors_[v], std::get<1>(voxel.second) / num_points);
+        v++;
+    }
+}
+
 TEST(PointCloud, UniformDownSample) {
     std::vector<Eigen::Vector3d> points({
             {0, 0, 0},
@@ -1021,6 +1130,22 @@ TEST(PointCloud, ClusterDBSCAN) {
     EXPECT_EQ(cluster_sum, 398580);
 }
 
+TEST(PointCloud, ClusterDBSCANBorderAndNoise) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {{1.1, 0, 0}, {1.0, 0, 0}, {1.2, 0, 0}, {0.1, 0, 0},
+                   {0.0, 0, 0}, {0.2, 0, 0}, {5.0, 0, 0}};
+
+    // Only points 0 and 3 are core points. Clusters are numbered in the order
+    // of their first core point, border points join them, and the isolated
+    // point is noise.
+    std::vector<int> labels = pcd.ClusterDBSCAN(0.15, 3, false);
+    EXPECT_EQ(labels, std::vector<int>({0, 0, 0, 1, 1, 1, -1}));
+
+    EXPECT_EQ(pcd.ClusterDBSCAN(0.15, 1, false),
+              std::vector<int>({0, 0, 0, 1, 1, 1, 2}));
+    EXPECT_TRUE(geometry::PointCloud().ClusterDBSCAN(0.15, 3, false).empty());
+}
+
 TEST(PointCloud, SegmentPlane) {
     geometry::PointCloud pcd;
     io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.pcd", pcd);
@@ -1050,6 +1175,59 @@ TEST(PointCloud, SegmentPlaneKnownPlane) {
     ExpectEQ(pcd.SelectByIndex(inliers)->points_, ref);
 }
 
+TEST(PointCloud, SegmentPlaneLarge) {
+    // 10000 points on the plane z = 1, with 2000 outliers.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 12000; i++) {
+        double z = i % 6 == 0 ? 3.0 + dist(rng) : 1.0;
+        pcd.points_.push_back({dist(rng), dist(rng), z});
+    }
+
+    Eigen::Vector4d plane_model;
+    std::vector<size_t> inliers;
+    std::tie(plane_model, inliers) = pcd.SegmentPlane(0.01, 3, 1000);
+    EXPECT_EQ(inliers.size(), 10000);
+    if (plane_model(2) < 0) {
+        plane_model = -plane_model;
+    }
+    ExpectEQ(plane_model, Eigen::Vector4d(0, 0, 1, -1), 1e-6);
+}
+
+TEST(PointCloud, SegmentPlanes) {
+    // Two perpendicular planes z = 0 and x = 2, and an isolated point.
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 20; i++) {
+        for (int j = 0; j < 20; j++) {
+            pcd.points_.push_back({i * 0.05, j * 0.05, 0.0});
+        }
+    }
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < 10; j++) {
+            pcd.points_.push_back({2.0, i * 0.05, 0.5 + j * 0.05});
+        }
+    }
+    pcd.points_.push_back({5.0, 5.0, 5.0});
+
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes =
+            pcd.SegmentPlanes(0.01, 3, 1000, 5, 10);
+    ASSERT_EQ(planes.size(), 2);
+
+    // The planes are found from the largest to the smallest.
+    std::vector<size_t> first(400), second(100);
+    std::iota(first.begin(), first.end(), 0);
+    std::iota(second.begin(), second.end(), 400);
+    EXPECT_EQ(std::get<1>(planes[0]), first);
+    EXPECT_EQ(std::get<1>(planes[1]), second);
+    Eigen::Vector4d plane0 = std::get<0>(planes[0]).cwiseAbs();
+    Eigen::Vector4d plane1 = std::get<0>(planes[1]).cwiseAbs();
+    ExpectEQ(plane0, Eigen::Vector4d(0, 0, 1, 0), 1e-6);
+    ExpectEQ(plane1, Eigen::Vector4d(1, 0, 0, 2), 1e-6);
+
+    EXPECT_EQ(pcd.SegmentPlanes(0.01, 3, 1000, 1, 10).size(), 1);
+}
+
 TEST(PointCloud, CreateFromDepthImage) {
     const std::string trajectory_path =
             std::string(TEST_DATA_DIR) + "/RGBD/trajectory.log";
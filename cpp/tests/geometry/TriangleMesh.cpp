@@ -646,6 +646,49 @@ TEST(TriangleMesh, Purge) {
     ExpectEQ(ref_triangle_normals, tm.triangle_normals_);
 }
 
+TEST(TriangleMesh, RemoveDuplicatedVertices) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0.0, 0.0, 0.0},
+                      {1.0, 0.0, 0.0},
+                      {-0.0, 0.0, 0.0},
+                      {0.0, 1.0, 0.0},
+                      {1.0, 0.0, 0.0}};
+    mesh.vertex_colors_ = {{0.1, 0.1, 0.1},
+                           {0.2, 0.2, 0.2},
+                           {0.3, 0.3, 0.3},
+                           {0.4, 0.4, 0.4},
+                           {0.5, 0.5, 0.5}};
+    mesh.triangles_ = {{0, 1, 3}, {2, 4, 3}};
+
+    // The first vertex at every position is kept, in the original order.
+    mesh.RemoveDuplicatedVertices();
+    ExpectEQ(mesh.vertices_, std::vector<Eigen::Vector3d>({{0.0, 0.0, 0.0},
+                                                           {1.0, 0.0, 0.0},
+                                                           {0.0, 1.0, 0.0}}));
+    ExpectEQ(mesh.vertex_colors_,
+             std::vector<Eigen::Vector3d>(
+                     {{0.1, 0.1, 0.1}, {0.2, 0.2, 0.2}, {0.4, 0.4, 0.4}}));
+    ExpectEQ(mesh.triangles_,
+             std::vector<Eigen::Vector3i>({{0, 1, 2}, {0, 1, 2}}));
+}
+
+TEST(TriangleMesh, RemoveDuplicatedTriangles) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}};
+    mesh.triangles_ = {{0, 1, 2}, {1, 2, 0}, {0, 2, 1}, {2, 0, 1}};
+    mesh.triangle_normals_ = {{0.0, 0.0, 1.0},
+                              {0.0, 0.0, 2.0},
+                              {0.0, 0.0, -1.0},
+                              {0.0, 0.0, 3.0}};
+
+    // Rotated triangles are duplicates, flipped ones are not.
+    mesh.RemoveDuplicatedTriangles();
+    ExpectEQ(mesh.triangles_,
+             std::vector<Eigen::Vector3i>({{0, 1, 2}, {0, 2, 1}}));
+    ExpectEQ(mesh.triangle_normals_,
+             std::vector<Eigen::Vector3d>({{0.0, 0.0, 1.0}, {0.0, 0.0, -1.0}}));
+}
+
 TEST(TriangleMesh, MergeCloseVertices) {
     geometry::TriangleMesh mesh;
     mesh.vertices_ = {{0.000000, 0.000000, 0.000000},
@@ -757,6 +800,44 @@ TEST(TriangleMesh, SamplePointsUniformly) {
     }
 }
 
+TEST(TriangleMesh, SamplePointsPoissonDiskParallel) {
+    auto mesh_empty = geometry::TriangleMesh();
+    EXPECT_THROW(mesh_empty.SamplePointsPoissonDiskParallel(100),
+                 std::runtime_error);
+
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    mesh->vertex_colors_.resize(mesh->vertices_.size(), {1, 0, 0});
+    size_t n_points = 500;
+    auto pcd = mesh->SamplePointsPoissonDiskParallel(n_points, 5, nullptr,
+                                                     false, 42);
+    EXPECT_EQ(pcd->points_.size(), n_points);
+    EXPECT_EQ(pcd->colors_.size(), n_points);
+    EXPECT_EQ(pcd->normals_.size(), 0u);
+    for (size_t pidx = 0; pidx < n_points; ++pidx) {
+        ExpectEQ(pcd->colors_[pidx], Eigen::Vector3d(1, 0, 0));
+    }
+
+    // The samples are spread more evenly than uniform samples.
+    auto MinDistance = [](const geometry::PointCloud &pcd) {
+        double min_dist = std::numeric_limits<double>::infinity();
+        for (size_t i = 0; i < pcd.points_.size(); ++i) {
+            for (size_t j = i + 1; j < pcd.points_.size(); ++j) {
+                min_dist = std::min(min_dist,
+                                    (pcd.points_[i] - pcd.points_[j]).norm());
+            }
+        }
+        return min_dist;
+    };
+    auto pcd_uniform = mesh->SamplePointsUniformly(n_points, false, 42);
+    EXPECT_GT(MinDistance(*pcd), 2 * MinDistance(*pcd_uniform));
+
+    // Eliminating from the same initial samples gives the same result.
+    auto pcd_init = mesh->SamplePointsUniformly(5 * n_points, false, 42);
+    auto pcd_from_init =
+            mesh->SamplePointsPoissonDiskParallel(n_points, 5, pcd_init);
+    ExpectEQ(pcd_from_init->points_, pcd->points_);
+}
+
 TEST(TriangleMesh, FilterSharpen) {
     auto mesh = std::make_shared<geometry::TriangleMesh>();
     mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
@@ -1427,6 +1508,43 @@ TEST(TriangleMesh, DeformAsRigidAsPossible) {
     ExpectMeshEQ(*mesh_deform, mesh_gt, 1e-5);
 }
 
+TEST(TriangleMesh, SimplifyQuadricDecimationParallel) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 40);
+    sphere->ComputeVertexNormals();
+    sphere->PaintUniformColor(Eigen::Vector3d(0.2, 0.4, 0.6));
+
+    auto mesh = sphere->SimplifyQuadricDecimationParallel(500);
+    EXPECT_LE(mesh->triangles_.size(), 500u);
+    EXPECT_GE(mesh->triangles_.size(), 450u);
+    EXPECT_EQ(mesh->vertex_normals_.size(), mesh->vertices_.size());
+    EXPECT_EQ(mesh->vertex_colors_.size(), mesh->vertices_.size());
+    EXPECT_TRUE(mesh->IsEdgeManifold(/*allow_boundary_edges=*/false));
+    EXPECT_EQ(mesh->EulerPoincareCharacteristic(), 2);
+    for (const Eigen::Vector3d& vertex : mesh->vertices_) {
+        EXPECT_NEAR(vertex.norm(), 1.0, 0.05);
+    }
+    ExpectEQ(mesh->vertex_colors_,
+             std::vector<Eigen::Vector3d>(mesh->vertices_.size(),
+                                          Eigen::Vector3d(0.2, 0.4, 0.6)));
+
+    // The simplification is deterministic.
+    auto mesh2 = sphere->SimplifyQuadricDecimationParallel(500);
+    ExpectEQ(mesh->vertices_, mesh2->vertices_);
+    ExpectEQ(mesh->triangles_, mesh2->triangles_);
+
+    // No edge of a plane is collapsed for a negative maximum error, and
+    // every edge for an infinite one.
+    auto plane = geometry::TriangleMesh::CreateBox(1.0, 1.0, 1.0);
+    plane = plane->SubdivideMidpoint(3);
+    mesh = plane->SimplifyQuadricDecimationParallel(0, -1.0);
+    EXPECT_EQ(mesh->triangles_.size(), plane->triangles_.size());
+    mesh = plane->SimplifyQuadricDecimationParallel(12);
+    EXPECT_LE(mesh->triangles_.size(), 12u);
+    for (const Eigen::Vector3d& vertex : mesh->vertices_) {
+        EXPECT_NEAR(vertex.cwiseAbs().maxCoeff(), 1.0, 1e-6);
+    }
+}
+
 TEST(TriangleMesh, SelectByIndex) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {360.784314, 717.647059, 800.000000},
@@ -1890,6 +2008,50 @@ TEST(TriangleMesh, CreateFromPointCloudPoisson) {
     ExpectEQ(densities_es, densities_gt, 1e-4);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudPoissonTiled) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    geometry::PointCloud pcd;
+    pcd.points_ = sphere->vertices_;
+    pcd.normals_ = sphere->vertices_;
+
+    EXPECT_ANY_THROW(geometry::TriangleMesh::CreateFromPointCloudPoissonTiled(
+            geometry::PointCloud(pcd.points_), 1.0, 0.1));
+    EXPECT_ANY_THROW(geometry::TriangleMesh::CreateFromPointCloudPoissonTiled(
+            pcd, 0.0, 0.0));
+    EXPECT_ANY_THROW(geometry::TriangleMesh::CreateFromPointCloudPoissonTiled(
+            pcd, 1.0, 2.0));
+
+    // A single tile reproduces the untiled reconstruction.
+    std::shared_ptr<geometry::TriangleMesh> mesh_gt;
+    std::vector<double> densities_gt;
+    std::tie(mesh_gt, densities_gt) =
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(
+                    pcd, 3, 0, 1.1f, false, /*n_threads=*/1);
+    std::shared_ptr<geometry::TriangleMesh> mesh_es;
+    std::vector<double> densities_es;
+    std::tie(mesh_es, densities_es) =
+            geometry::TriangleMesh::CreateFromPointCloudPoissonTiled(
+                    pcd, 10.0, 0.0, 3, 1.1f, false, /*n_threads=*/1);
+    ExpectMeshEQ(*mesh_es, *mesh_gt, 1e-4);
+    ExpectEQ(densities_es, densities_gt, 1e-4);
+
+    // Several tiles still give one density per vertex and valid triangles.
+    std::tie(mesh_es, densities_es) =
+            geometry::TriangleMesh::CreateFromPointCloudPoissonTiled(
+                    pcd, 0.8, 0.4, 3, 1.1f, false, /*n_threads=*/1);
+    EXPECT_FALSE(mesh_es->IsEmpty());
+    EXPECT_FALSE(mesh_es->triangles_.empty());
+    EXPECT_EQ(densities_es.size(), mesh_es->vertices_.size());
+    EXPECT_EQ(mesh_es->vertex_normals_.size(), mesh_es->vertices_.size());
+    for (const Eigen::Vector3i& triangle : mesh_es->triangles_) {
+        EXPECT_GE(triangle.minCoeff(), 0);
+        EXPECT_LT(triangle.maxCoeff(), int(mesh_es->vertices_.size()));
+        EXPECT_NE(triangle(0), triangle(1));
+        EXPECT_NE(triangle(1), triangle(2));
+        EXPECT_NE(triangle(0), triangle(2));
+    }
+}
+
 TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     geometry::PointCloud pcd;
     pcd.points_ = {
@@ -1915,6 +2077,23 @@ TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     ExpectMeshEQ(*mesh_es, mesh_gt);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudBallPivoting) {
+    // The sphere is large compared to the balls, so that the point cloud is
+    // split into cells whose fronts are grown in parallel.
+    auto sphere = geometry::TriangleMesh::CreateSphere(10.0, 60);
+    sphere->ComputeVertexNormals();
+    geometry::PointCloud pcd;
+    pcd.points_ = sphere->vertices_;
+    pcd.normals_ = sphere->vertex_normals_;
+
+    auto mesh = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, {0.6, 1.2});
+    EXPECT_EQ(mesh->vertices_.size(), pcd.points_.size());
+    EXPECT_EQ(mesh->triangle_normals_.size(), mesh->triangles_.size());
+    EXPECT_GT(mesh->triangles_.size(), sphere->triangles_.size() * 3 / 4);
+    EXPECT_TRUE(mesh->IsEdgeManifold(true));
+}
+
 TEST(TriangleMesh, CreateMeshSphere) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {0.000000, 0.000000, 1.000000},
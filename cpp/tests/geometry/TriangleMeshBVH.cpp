@@ -0,0 +1,169 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshBVH.h"
+
+#include <limits>
+#include <memory>
+
+#include "open3d/geometry/IntersectionTest.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TriangleMeshBVH, Constructor) {
+    geometry::TriangleMeshBVH empty_bvh;
+    EXPECT_TRUE(empty_bvh.IsEmpty());
+    Eigen::Vector3d closest_point;
+    EXPECT_EQ(empty_bvh.ComputeClosestPoint(Eigen::Vector3d::Zero(),
+                                            closest_point),
+              -1);
+
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    geometry::TriangleMeshBVH bvh(*mesh, 2);
+    EXPECT_FALSE(bvh.IsEmpty());
+    EXPECT_EQ(bvh.triangle_indices_.size(), mesh->triangles_.size());
+
+    // Every triangle is in exactly one leaf, and every node bounds its
+    // triangles.
+    std::vector<int> num_leaves(mesh->triangles_.size(), 0);
+    for (const geometry::TriangleMeshBVH::Node &node : bvh.nodes_) {
+        for (int i = node.begin_; i < node.end_; ++i) {
+            EXPECT_TRUE((bvh.triangle_min_bounds_[i].array() >=
+                         node.min_bound_.array())
+                                .all());
+            EXPECT_TRUE((bvh.triangle_max_bounds_[i].array() <=
+                         node.max_bound_.array())
+                                .all());
+            if (node.IsLeaf()) {
+                num_leaves[bvh.triangle_indices_[i]]++;
+            }
+        }
+        if (node.IsLeaf()) {
+            EXPECT_LE(node.end_ - node.begin_, 2);
+        }
+    }
+    EXPECT_EQ(num_leaves, std::vector<int>(mesh->triangles_.size(), 1));
+}
+
+TEST(TriangleMeshBVH, GetTrianglesIntersectingAABB) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    geometry::TriangleMeshBVH bvh(*mesh);
+    const Eigen::Vector3d box_center(0.5, 0.5, 0.5);
+    const Eigen::Vector3d box_half_size(0.4, 0.4, 0.4);
+
+    std::vector<int> expected;
+    for (int tidx = 0; tidx < int(mesh->triangles_.size()); ++tidx) {
+        const Eigen::Vector3i &triangle = mesh->triangles_[tidx];
+        if (geometry::IntersectionTest::TriangleAABB(
+                    box_center, box_half_size, mesh->vertices_[triangle(0)],
+                    mesh->vertices_[triangle(1)],
+                    mesh->vertices_[triangle(2)])) {
+            expected.push_back(tidx);
+        }
+    }
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(bvh.GetTrianglesIntersectingAABB(box_center, box_half_size),
+              expected);
+}
+
+TEST(TriangleMeshBVH, ComputeDistance) {
+    auto mesh = geometry::TriangleMesh::CreateBox();
+    geometry::TriangleMeshBVH bvh(*mesh);
+
+    Eigen::Vector3d closest_point;
+    int tidx = bvh.ComputeClosestPoint(Eigen::Vector3d(0.5, 0.5, 2.0),
+                                       closest_point);
+    ASSERT_GE(tidx, 0);
+    ExpectEQ(closest_point, Eigen::Vector3d(0.5, 0.5, 1.0));
+
+    std::vector<double> distances = bvh.ComputeDistance(
+            {Eigen::Vector3d(0.5, 0.5, 2.0), Eigen::Vector3d(0.5, 0.5, 0.25),
+             Eigen::Vector3d(2.0, 2.0, 1.0), Eigen::Vector3d(1.0, 0.0, 0.5)});
+    ExpectEQ(distances, std::vector<double>({1.0, 0.25, std::sqrt(2.0), 0.0}));
+
+    std::vector<double> empty_distances = geometry::TriangleMeshBVH()
+            .ComputeDistance({Eigen::Vector3d::Zero()});
+    EXPECT_EQ(empty_distances[0], std::numeric_limits<double>::infinity());
+}
+
+TEST(TriangleMeshBVH, ClosestPointOnTriangle) {
+    const Eigen::Vector3d p0(0, 0, 0);
+    const Eigen::Vector3d p1(1, 0, 0);
+    const Eigen::Vector3d p2(0, 1, 0);
+    ExpectEQ(geometry::TriangleMeshBVH::ClosestPointOnTriangle(
+                     Eigen::Vector3d(-1, -1, 1), p0, p1, p2),
+             p0);
+    ExpectEQ(geometry::TriangleMeshBVH::ClosestPointOnTriangle(
+                     Eigen::Vector3d(2, -1, 0), p0, p1, p2),
+             p1);
+    ExpectEQ(geometry::TriangleMeshBVH::ClosestPointOnTriangle(
+                     Eigen::Vector3d(0.5, -1, 0), p0, p1, p2),
+             Eigen::Vector3d(0.5, 0, 0));
+    ExpectEQ(geometry::TriangleMeshBVH::ClosestPointOnTriangle(
+                     Eigen::Vector3d(1, 1, 0), p0, p1, p2),
+             Eigen::Vector3d(0.5, 0.5, 0));
+    ExpectEQ(geometry::TriangleMeshBVH::ClosestPointOnTriangle(
+                     Eigen::Vector3d(0.25, 0.25, 3), p0, p1, p2),
+             Eigen::Vector3d(0.25, 0.25, 0));
+}
+
+TEST(TriangleMeshBVH, SelfIntersectingTriangles) {
+    // Two spheres merged into one mesh intersect each other.
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 8);
+    auto other = geometry::TriangleMesh::CreateSphere(1.0, 8);
+    other->Translate(Eigen::Vector3d(1.0, 0.2, 0.1));
+    *mesh += *other;
+
+    std::vector<Eigen::Vector2i> expected;
+    for (int tidx0 = 0; tidx0 < int(mesh->triangles_.size()); ++tidx0) {
+        const Eigen::Vector3i &p = mesh->triangles_[tidx0];
+        for (int tidx1 = tidx0 + 1; tidx1 < int(mesh->triangles_.size());
+             ++tidx1) {
+            const Eigen::Vector3i &q = mesh->triangles_[tidx1];
+            if ((p.array() == q(0)).any() || (p.array() == q(1)).any() ||
+                (p.array() == q(2)).any()) {
+                continue;
+            }
+            if (geometry::IntersectionTest::TriangleTriangle3d(
+                        mesh->vertices_[p(0)], mesh->vertices_[p(1)],
+                        mesh->vertices_[p(2)], mesh->vertices_[q(0)],
+                        mesh->vertices_[q(1)], mesh->vertices_[q(2)])) {
+                expected.push_back(Eigen::Vector2i(tidx0, tidx1));
+            }
+        }
+    }
+    EXPECT_FALSE(expected.empty());
+    ExpectEQ(mesh->GetSelfIntersectingTriangles(), expected);
+    EXPECT_TRUE(mesh->IsSelfIntersecting());
+    EXPECT_FALSE(other->IsSelfIntersecting());
+    EXPECT_TRUE(other->IsIntersecting(*geometry::TriangleMesh::CreateSphere()));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,95 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshTopology.h"
+
+#include <memory>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TriangleMeshTopology, Constructor) {
+    std::vector<Eigen::Vector3i> triangles = {{0, 1, 2}, {2, 1, 3}, {4, 3, 1}};
+    geometry::TriangleMeshTopology topology(triangles, 5);
+
+    ExpectEQ(topology.edges_, std::vector<Eigen::Vector2i>({{0, 1},
+                                                            {0, 2},
+                                                            {1, 2},
+                                                            {1, 3},
+                                                            {1, 4},
+                                                            {2, 3},
+                                                            {3, 4}}));
+    EXPECT_EQ(topology.edge_triangle_offsets_,
+              std::vector<int>({0, 1, 2, 4, 6, 7, 8, 9}));
+    EXPECT_EQ(topology.edge_triangles_,
+              std::vector<int>({0, 0, 0, 1, 1, 2, 2, 1, 2}));
+    EXPECT_EQ(topology.triangle_edges_,
+              std::vector<int>({0, 2, 1, 2, 3, 5, 6, 3, 4}));
+    EXPECT_EQ(topology.vertex_edge_offsets_,
+              std::vector<int>({0, 2, 5, 6, 7, 7}));
+    EXPECT_EQ(topology.neighbor_offsets_,
+              std::vector<int>({0, 2, 6, 9, 12, 14}));
+    EXPECT_EQ(topology.neighbors_,
+              std::vector<int>({1, 2, 0, 2, 3, 4, 0, 1, 3, 1, 2, 4, 1, 3}));
+
+    EXPECT_EQ(topology.NumEdges(), 7);
+    EXPECT_EQ(topology.NumEdgeTriangles(2), 2);
+    EXPECT_EQ(topology.NumNeighbors(1), 4);
+    EXPECT_EQ(topology.GetEdgeIndex(3, 1), 3);
+    EXPECT_EQ(topology.GetEdgeIndex(1, 3), 3);
+    EXPECT_EQ(topology.GetEdgeIndex(0, 3), -1);
+    EXPECT_EQ(topology.GetEdgeIndex(4, 4), -1);
+}
+
+TEST(TriangleMeshTopology, GetTopology) {
+    auto mesh = geometry::TriangleMesh::CreateBox();
+    auto topology = mesh->GetTopology();
+    EXPECT_EQ(topology->NumEdges(), 18);
+    for (int eidx = 0; eidx < topology->NumEdges(); ++eidx) {
+        EXPECT_EQ(topology->NumEdgeTriangles(eidx), 2);
+    }
+
+    // The topology is cached, also for copies of the mesh.
+    EXPECT_EQ(mesh->GetTopology(), topology);
+    geometry::TriangleMesh copy = *mesh;
+    EXPECT_EQ(copy.GetTopology(), topology);
+
+    // Modifying the triangles invalidates it.
+    copy.triangles_.pop_back();
+    auto copy_topology = copy.GetTopology();
+    EXPECT_NE(copy_topology, topology);
+    EXPECT_EQ(copy_topology->NumEdges(), 18);
+    EXPECT_FALSE(copy.IsEdgeManifold(false));
+    EXPECT_TRUE(mesh->IsEdgeManifold(false));
+    std::swap(copy.triangles_[0](0), copy.triangles_[0](1));
+    EXPECT_NE(copy.GetTopology(), copy_topology);
+}
+
+}  // namespace tests
+}  // namespace open3d
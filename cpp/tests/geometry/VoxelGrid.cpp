@@ -26,7 +26,9 @@
 
 #include "open3d/geometry/VoxelGrid.h"
 
+#include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/LineSet.h"
+#include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 #include "tests/UnitTest.h"
@@ -62,6 +64,57 @@ TEST(VoxelGrid, GetVoxel) {
              Eigen::Vector3i(0, 1, 0));
 }
 
+TEST(VoxelGrid, CreateFromPointCloud) {
+    geometry::PointCloud pcd;
+    pcd.points_ = {{0.1, 0.1, 0.1}, {0.2, 0.3, 0.1}, {1.2, 0.1, 0.1}};
+    pcd.colors_ = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    auto voxel_grid = geometry::VoxelGrid::CreateFromPointCloud(pcd, 1.0);
+    EXPECT_EQ(voxel_grid->voxels_.size(), 2u);
+    const geometry::Voxel &voxel =
+            voxel_grid->voxels_.at(Eigen::Vector3i(0, 0, 0));
+    ExpectEQ(voxel.color_, Eigen::Vector3d(0.5, 0.5, 0));
+    ExpectEQ(voxel_grid->voxels_.at(Eigen::Vector3i(1, 0, 0)).color_,
+             Eigen::Vector3d(0, 0, 1));
+}
+
+TEST(VoxelGrid, CreateFromTriangleMesh) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    const double voxel_size = 0.1;
+    auto voxel_grid =
+            geometry::VoxelGrid::CreateFromTriangleMesh(*mesh, voxel_size);
+
+    // Test every voxel of the dense grid against every triangle.
+    const Eigen::Vector3d half_size(voxel_size / 2, voxel_size / 2,
+                                    voxel_size / 2);
+    const Eigen::Vector3d min_bound = mesh->GetMinBound() - half_size;
+    const Eigen::Vector3d max_bound = mesh->GetMaxBound() + half_size;
+    const Eigen::Vector3i num_voxels =
+            ((max_bound - min_bound) / voxel_size).array().round().cast<int>();
+    size_t num_occupied = 0;
+    for (int w = 0; w < num_voxels(0); w++) {
+        for (int h = 0; h < num_voxels(1); h++) {
+            for (int d = 0; d < num_voxels(2); d++) {
+                const Eigen::Vector3d center =
+                        min_bound + Eigen::Vector3d(w, h, d) * voxel_size;
+                bool occupied = false;
+                for (const Eigen::Vector3i &tria : mesh->triangles_) {
+                    if (geometry::IntersectionTest::TriangleAABB(
+                                center, half_size, mesh->vertices_[tria(0)],
+                                mesh->vertices_[tria(1)],
+                                mesh->vertices_[tria(2)])) {
+                        occupied = true;
+                        break;
+                    }
+                }
+                const Eigen::Vector3i index(w, h, d);
+                EXPECT_EQ(voxel_grid->voxels_.count(index) > 0, occupied);
+                num_occupied += occupied;
+            }
+        }
+    }
+    EXPECT_EQ(voxel_grid->voxels_.size(), num_occupied);
+}
+
 TEST(VoxelGrid, Visualization) {
     auto voxel_grid = std::make_shared<geometry::VoxelGrid>();
     voxel_grid->origin_ = Eigen::Vector3d(0, 0, 0);
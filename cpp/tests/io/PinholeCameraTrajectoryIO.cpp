@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+
+#include "open3d/utility/FileSystem.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -50,5 +53,37 @@ TEST(PinholeCameraTrajectoryIO, DISABLED_WritePinholeCameraTrajectoryToLOG) {
     NotImplemented();
 }
 
+TEST(PinholeCameraTrajectoryIO, ReadWritePinholeCameraTrajectoryBIN) {
+    camera::PinholeCameraTrajectory trajectory;
+    for (int i = 0; i < 5; ++i) {
+        camera::PinholeCameraParameters parameters;
+        parameters.intrinsic_.SetIntrinsics(640, 480, 500 + i, 501 + i, 320,
+                                            240);
+        parameters.extrinsic_ = Eigen::Matrix4d::Identity();
+        parameters.extrinsic_(0, 3) = i;
+        trajectory.parameters_.push_back(parameters);
+    }
+
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/temp_trajectory.bin";
+    EXPECT_TRUE(io::WritePinholeCameraTrajectory(file_name, trajectory));
+    camera::PinholeCameraTrajectory read_trajectory;
+    EXPECT_TRUE(io::ReadPinholeCameraTrajectory(file_name, read_trajectory));
+    ASSERT_EQ(read_trajectory.parameters_.size(),
+              trajectory.parameters_.size());
+    for (size_t i = 0; i < trajectory.parameters_.size(); ++i) {
+        const auto &parameters = trajectory.parameters_[i];
+        const auto &read_parameters = read_trajectory.parameters_[i];
+        EXPECT_EQ(read_parameters.intrinsic_.width_,
+                  parameters.intrinsic_.width_);
+        EXPECT_EQ(read_parameters.intrinsic_.height_,
+                  parameters.intrinsic_.height_);
+        ExpectEQ(read_parameters.intrinsic_.intrinsic_matrix_,
+                 parameters.intrinsic_.intrinsic_matrix_);
+        ExpectEQ(read_parameters.extrinsic_, parameters.extrinsic_);
+    }
+    utility::filesystem::RemoveFile(file_name);
+}
+
 }  // namespace tests
 }  // namespace open3d
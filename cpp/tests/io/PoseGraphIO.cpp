@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/PoseGraphIO.h"
+
+#include "open3d/utility/FileSystem.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -35,5 +38,51 @@ TEST(PoseGraphIO, DISABLED_ReadPoseGraph) { NotImplemented(); }
 
 TEST(PoseGraphIO, DISABLED_WritePoseGraph) { NotImplemented(); }
 
+TEST(PoseGraphIO, ReadWritePoseGraphBIN) {
+    pipelines::registration::PoseGraph pose_graph;
+    for (int i = 0; i < 10; ++i) {
+        Eigen::Matrix4d pose = Eigen::Matrix4d::Identity();
+        pose.block<3, 1>(0, 3) = Eigen::Vector3d(i, 2 * i, 3 * i);
+        pose_graph.nodes_.emplace_back(pose);
+    }
+    for (int i = 0; i < 9; ++i) {
+        Eigen::Matrix6d information = Eigen::Matrix6d::Random();
+        pose_graph.edges_.emplace_back(i, i + 1,
+                                       pose_graph.nodes_[i + 1].pose_,
+                                       information, i % 2 == 0, 0.1 * i);
+    }
+
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/temp_pose_graph.bin";
+    EXPECT_TRUE(io::WritePoseGraph(file_name, pose_graph));
+    pipelines::registration::PoseGraph read_pose_graph;
+    EXPECT_TRUE(io::ReadPoseGraph(file_name, read_pose_graph));
+    ASSERT_EQ(read_pose_graph.nodes_.size(), pose_graph.nodes_.size());
+    ASSERT_EQ(read_pose_graph.edges_.size(), pose_graph.edges_.size());
+    for (size_t i = 0; i < pose_graph.nodes_.size(); ++i) {
+        ExpectEQ(read_pose_graph.nodes_[i].pose_, pose_graph.nodes_[i].pose_);
+    }
+    for (size_t i = 0; i < pose_graph.edges_.size(); ++i) {
+        const auto &edge = pose_graph.edges_[i];
+        const auto &read_edge = read_pose_graph.edges_[i];
+        EXPECT_EQ(read_edge.source_node_id_, edge.source_node_id_);
+        EXPECT_EQ(read_edge.target_node_id_, edge.target_node_id_);
+        EXPECT_EQ(read_edge.uncertain_, edge.uncertain_);
+        EXPECT_EQ(read_edge.confidence_, edge.confidence_);
+        ExpectEQ(read_edge.transformation_, edge.transformation_);
+        ExpectEQ(read_edge.information_, edge.information_);
+    }
+
+    // A JSON file is not a BIN pose graph.
+    EXPECT_TRUE(io::WritePoseGraph(
+            std::string(TEST_DATA_DIR) + "/temp_pose_graph.json", pose_graph));
+    EXPECT_FALSE(io::ReadPoseGraphFromBIN(
+            std::string(TEST_DATA_DIR) + "/temp_pose_graph.json",
+            read_pose_graph));
+    utility::filesystem::RemoveFile(file_name);
+    utility::filesystem::RemoveFile(std::string(TEST_DATA_DIR) +
+                                    "/temp_pose_graph.json");
+}
+
 }  // namespace tests
 }  // namespace open3d
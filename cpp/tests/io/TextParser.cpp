@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/TextParser.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(TextParser, ParseNumber) {
+    const std::vector<std::string> numbers = {
+            "0",         "-0",       "1",
+            "-1",        "+2.5",     "3.14159265358979",
+            ".5",        "-.25e-3",  "1e22",
+            "1e23",      "1.7976931348623157e308",
+            "4.9e-324",  "123456789012345678901234",
+            "0.1",       "0.000000000000000000000000001",
+            "0x1p3",     "inf",      "-nan"};
+    for (const std::string &number : numbers) {
+        const std::string line = "  " + number + " 7";
+        const char *end = line.data() + line.size();
+        double value = 0;
+        const char *ptr = io::ParseNumber(line.data(), end, value);
+        ASSERT_NE(ptr, nullptr) << number;
+        char *expected_end = nullptr;
+        const double expected = std::strtod(line.c_str(), &expected_end);
+        EXPECT_EQ(ptr, expected_end) << number;
+        if (std::isnan(expected)) {
+            EXPECT_TRUE(std::isnan(value)) << number;
+        } else {
+            EXPECT_EQ(std::memcmp(&value, &expected, sizeof(double)), 0)
+                    << number;
+        }
+        int next = 0;
+        EXPECT_NE(io::ParseNumber(ptr, end, next), nullptr);
+        EXPECT_EQ(next, 7);
+    }
+
+    double value = 0;
+    const std::string invalid = " x 1";
+    EXPECT_EQ(io::ParseNumber(invalid.data(),
+                              invalid.data() + invalid.size(), value),
+              nullptr);
+    // Numbers are not parsed beyond the end of the range.
+    const std::string truncated = "12345";
+    EXPECT_EQ(io::ParseNumber(truncated.data(), truncated.data() + 3, value),
+              truncated.data() + 3);
+    EXPECT_EQ(value, 123);
+
+    int64_t integer = 0;
+    const std::string integers = "-42 17";
+    const char *ptr = io::ParseNumber(
+            integers.data(), integers.data() + integers.size(), integer);
+    EXPECT_EQ(integer, -42);
+    io::ParseNumber(ptr, integers.data() + integers.size(), integer);
+    EXPECT_EQ(integer, 17);
+}
+
+TEST(TextParser, ParseLines) {
+    // Large enough to be split into several chunks.
+    const int num_lines = 200000;
+    std::string text;
+    for (int i = 0; i < num_lines; ++i) {
+        text += std::to_string(i) + " " + std::to_string(i * 0.5) + "\r\n";
+        if (i % 1000 == 0) {
+            text += "# comment\n\n";
+        }
+    }
+    EXPECT_GT(io::SplitLines(text.data(), text.data() + text.size()).size(),
+              size_t(2));
+
+    const std::vector<std::pair<int, double>> records =
+            io::ParseLines<std::pair<int, double>>(
+                    text.data(), text.data() + text.size(),
+                    [](const char *line, const char *line_end,
+                       std::pair<int, double> &record) {
+                        line = io::ParseNumber(line, line_end, record.first);
+                        return io::ParseNumber(line, line_end,
+                                               record.second) != nullptr;
+                    });
+    ASSERT_EQ(records.size(), size_t(num_lines));
+    for (int i = 0; i < num_lines; ++i) {
+        EXPECT_EQ(records[i].first, i);
+        EXPECT_EQ(records[i].second, i * 0.5);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,104 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/TriangleMeshStreamWriter.h"
+
+#include "open3d/io/TriangleMeshIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+/// Returns a quad of two triangles at height z.
+geometry::TriangleMesh CreateQuad(double z) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, z}, {1, 0, z}, {1, 1, z}, {0, 1, z}};
+    mesh.vertex_colors_ = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 1}};
+    mesh.triangles_ = {{0, 1, 2}, {0, 2, 3}};
+    return mesh;
+}
+
+}  // namespace
+
+TEST(TriangleMeshStreamWriter, WritePLY) {
+    for (bool background : {false, true}) {
+        const std::string file_name =
+                std::string(TEST_DATA_DIR) + "/temp_stream_mesh.ply";
+        io::TriangleMeshStreamWriter writer(background);
+        ASSERT_TRUE(writer.Open(file_name));
+        geometry::TriangleMesh expected;
+        for (int i = 0; i < 3; ++i) {
+            const geometry::TriangleMesh chunk = CreateQuad(i);
+            EXPECT_TRUE(writer.AddChunk(chunk));
+            expected += chunk;
+        }
+        // Chunks must keep the vertex attributes of the first chunk.
+        geometry::TriangleMesh no_colors = CreateQuad(3);
+        no_colors.vertex_colors_.clear();
+        EXPECT_FALSE(writer.AddChunk(no_colors));
+        EXPECT_EQ(writer.GetNumVertices(), 12);
+        EXPECT_EQ(writer.GetNumTriangles(), 6);
+        EXPECT_TRUE(writer.Close());
+        EXPECT_FALSE(utility::filesystem::FileExists(file_name +
+                                                     ".triangles.tmp"));
+
+        geometry::TriangleMesh mesh;
+        ASSERT_TRUE(io::ReadTriangleMesh(file_name, mesh));
+        ExpectEQ(mesh.vertices_, expected.vertices_);
+        ExpectEQ(mesh.vertex_colors_, expected.vertex_colors_);
+        ExpectEQ(mesh.triangles_, expected.triangles_);
+        EXPECT_TRUE(utility::filesystem::RemoveFile(file_name));
+    }
+}
+
+TEST(TriangleMeshStreamWriter, WriteGLB) {
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/temp_stream_mesh.glb";
+    io::TriangleMeshStreamWriter writer;
+    ASSERT_TRUE(writer.Open(file_name));
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(writer.AddChunk(CreateQuad(i)));
+    }
+    EXPECT_TRUE(writer.Close());
+
+    geometry::TriangleMesh mesh;
+    ASSERT_TRUE(io::ReadTriangleMesh(file_name, mesh));
+    EXPECT_EQ(mesh.vertices_.size(), 12u);
+    EXPECT_EQ(mesh.triangles_.size(), 6u);
+    EXPECT_TRUE(utility::filesystem::RemoveFile(file_name));
+}
+
+TEST(TriangleMeshStreamWriter, UnsupportedExtension) {
+    io::TriangleMeshStreamWriter writer;
+    EXPECT_FALSE(writer.Open(std::string(TEST_DATA_DIR) + "/temp.obj"));
+    EXPECT_FALSE(writer.IsOpened());
+}
+
+}  // namespace tests
+}  // namespace open3d
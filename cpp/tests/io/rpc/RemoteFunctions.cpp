@@ -30,11 +30,14 @@
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/rpc/ArrayEncoding.h"
 #include "open3d/io/rpc/BufferConnection.h"
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/DummyReceiver.h"
 #include "open3d/io/rpc/MessageUtils.h"
+#include "open3d/io/rpc/Messages.h"
 #include "open3d/io/rpc/ZMQContext.h"
+#include "open3d/utility/FileSystem.h"
 #include "tests/UnitTest.h"
 
 using namespace open3d::io::rpc;
@@ -243,5 +246,126 @@ TEST_F(RemoteFunctions, SendGarbage) {
     receiver.Stop();
 }
 
+TEST_F(RemoteFunctions, SharedMemoryArrays) {
+    std::vector<double> vertices(300);
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        vertices[i] = double(i);
+    }
+    std::vector<int32_t> faces = {0, 1, 2};
+    messages::MeshData data;
+    data.vertices = messages::Array::FromPtr(vertices.data(), {100, 3});
+    data.faces = messages::Array::FromPtr(faces.data(), {1, 3});
+
+    // Only arrays with at least 1000 bytes are moved.
+    const std::string file = MoveArraysToSharedMemory(data, 1000);
+    ASSERT_FALSE(file.empty());
+    EXPECT_EQ(data.vertices.file, file);
+    EXPECT_EQ(data.vertices.data.ptr, nullptr);
+    EXPECT_TRUE(data.faces.file.empty());
+    EXPECT_EQ(data.faces.Ptr<int32_t>(), faces.data());
+
+    {
+        auto mapped_files = MapSharedMemoryArrays(data);
+        EXPECT_EQ(mapped_files.size(), 1u);
+        ASSERT_NE(data.vertices.data.ptr, nullptr);
+        EXPECT_EQ(std::vector<double>(data.vertices.Ptr<double>(),
+                                      data.vertices.Ptr<double>() + 300),
+                  vertices);
+    }
+    EXPECT_TRUE(utility::filesystem::RemoveFile(file));
+
+    // Other files are not mapped.
+    data.vertices.file = "/etc/passwd";
+    EXPECT_ANY_THROW(MapSharedMemoryArrays(data));
+
+    // Send a point cloud through shared memory.
+    DummyReceiver receiver(connection_address, 500);
+    receiver.Start();
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000, Eigen::Vector3d(1, 2, 3));
+    auto connection =
+            std::make_shared<Connection>(connection_address, 500, 500);
+    connection->SetSharedMemoryThreshold(1);
+    EXPECT_EQ(connection->GetSharedMemoryThreshold(), 1u);
+    ASSERT_TRUE(SetPointCloud(pcd, "", 0, "", connection));
+    receiver.Stop();
+}
+
+TEST_F(RemoteFunctions, ArrayEncoding) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> dist(0, 1);
+    const int64_t num = 1000;
+    std::vector<double> vertices(num * 3), normals(num * 3), colors(num * 3);
+    for (int64_t i = 0; i < num; ++i) {
+        Eigen::Vector3d normal(dist(rng) - 0.5, dist(rng) - 0.5,
+                               dist(rng) - 0.5);
+        normal.normalize();
+        for (int d = 0; d < 3; ++d) {
+            vertices[3 * i + d] = 10 * dist(rng) - 5;
+            normals[3 * i + d] = normal(d);
+            colors[3 * i + d] = dist(rng);
+        }
+    }
+    std::vector<int32_t> faces(num * 3, 0);
+    messages::MeshData data;
+    data.vertices = messages::Array::FromPtr(vertices.data(), {num, 3});
+    data.faces = messages::Array::FromPtr(faces.data(), {num, 3});
+    data.vertex_attributes["normals"] =
+            messages::Array::FromPtr(normals.data(), {num, 3});
+    data.vertex_attributes["colors"] =
+            messages::Array::FromPtr(colors.data(), {num, 3});
+
+    ArrayEncodingOptions options;
+    options.compress = true;
+    options.quantize_positions = true;
+    options.quantize_colors = true;
+    options.quantize_normals = true;
+    std::vector<std::vector<char>> buffers;
+    const auto encodings = EncodeArrays(data, options, buffers);
+    EXPECT_EQ(encodings.size(), 4u);
+    for (const auto& encoding : encodings) {
+        EXPECT_TRUE(IsSupportedArrayEncoding(encoding));
+    }
+    EXPECT_FALSE(IsSupportedArrayEncoding("zstd"));
+    EXPECT_LT(data.vertices.data.size, num * 3 * sizeof(double));
+    EXPECT_LT(data.faces.data.size, num * 3 * sizeof(int32_t));
+
+    // Pack and unpack the message as the receiver does.
+    msgpack::sbuffer sbuf;
+    msgpack::pack(sbuf, data);
+    auto obj_handle = msgpack::unpack(sbuf.data(), sbuf.size());
+    messages::MeshData received = obj_handle.get().as<messages::MeshData>();
+    auto blobs = DecodeArrays(received);
+    EXPECT_EQ(blobs.size(), 4u);
+
+    auto ExpectNear = [](const messages::Array& array,
+                         const std::vector<double>& expected, double tol) {
+        ASSERT_TRUE(array.encodings.empty());
+        ASSERT_EQ(array.data.size, expected.size() * sizeof(double));
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_NEAR(array.Ptr<double>()[i], expected[i], tol);
+        }
+    };
+    ExpectNear(received.vertices, vertices, 10 / 65535.);
+    ExpectNear(received.vertex_attributes["normals"], normals, 1e-3);
+    ExpectNear(received.vertex_attributes["colors"], colors, 1. / 255);
+    ASSERT_EQ(received.faces.data.size, faces.size() * sizeof(int32_t));
+    EXPECT_EQ(std::vector<int32_t>(received.faces.Ptr<int32_t>(),
+                                   received.faces.Ptr<int32_t>() + num * 3),
+              faces);
+
+    // Send a point cloud with encoded arrays.
+    DummyReceiver receiver(connection_address, 500);
+    receiver.Start();
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000, Eigen::Vector3d(1, 2, 3));
+    pcd.colors_.resize(1000, Eigen::Vector3d(0.5, 0.5, 0.5));
+    auto connection =
+            std::make_shared<Connection>(connection_address, 500, 500);
+    connection->SetArrayEncodingOptions(options);
+    ASSERT_TRUE(SetPointCloud(pcd, "", 0, "", connection));
+    receiver.Stop();
+}
+
 }  // namespace tests
 }  // namespace open3d
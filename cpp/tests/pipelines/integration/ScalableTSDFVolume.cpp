@@ -24,11 +24,70 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/integration/ScalableTSDFVolume.h"
+
+#include <set>
+#include <tuple>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/pipelines/integration/UniformTSDFVolume.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
 namespace tests {
 
+// Fills the volume units around a sphere with its truncated signed distance.
+static void IntegrateSphere(pipelines::integration::ScalableTSDFVolume &volume,
+                            const Eigen::Vector3d &center,
+                            double radius) {
+    const double extent = radius + volume.sdf_trunc_ + volume.voxel_length_;
+    const Eigen::Vector3i min_index =
+            ((center.array() - extent) / volume.volume_unit_length_)
+                    .floor()
+                    .cast<int>();
+    const Eigen::Vector3i max_index =
+            ((center.array() + extent) / volume.volume_unit_length_)
+                    .floor()
+                    .cast<int>();
+    for (int ux = min_index(0); ux <= max_index(0); ux++) {
+        for (int uy = min_index(1); uy <= max_index(1); uy++) {
+            for (int uz = min_index(2); uz <= max_index(2); uz++) {
+                const Eigen::Vector3i index(ux, uy, uz);
+                auto &unit = volume.volume_units_[index];
+                unit.index_ = index;
+                unit.volume_ = std::make_shared<
+                        pipelines::integration::UniformTSDFVolume>(
+                        volume.volume_unit_length_,
+                        volume.volume_unit_resolution_, volume.sdf_trunc_,
+                        volume.color_type_,
+                        index.cast<double>() * volume.volume_unit_length_);
+                auto &uniform = *unit.volume_;
+                for (int x = 0; x < uniform.resolution_; x++) {
+                    for (int y = 0; y < uniform.resolution_; y++) {
+                        for (int z = 0; z < uniform.resolution_; z++) {
+                            const Eigen::Vector3d p =
+                                    uniform.origin_ +
+                                    (Eigen::Vector3d(x, y, z).array() + 0.5)
+                                                    .matrix() *
+                                            volume.voxel_length_;
+                            const double sdf = (p - center).norm() - radius;
+                            if (std::abs(sdf) >= volume.sdf_trunc_) {
+                                continue;
+                            }
+                            auto &voxel = uniform.voxels_[uniform.IndexOf(
+                                    x, y, z)];
+                            voxel.tsdf_ = float(sdf / volume.sdf_trunc_);
+                            voxel.weight_ = 1.0f;
+                            voxel.color_ = 255.0 *
+                                           (p - center).cwiseAbs() / radius;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
 TEST(ScalableTSDFVolume, DISABLED_VolumeUnit) { NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_Constructor) { NotImplemented(); }
@@ -43,7 +102,41 @@ TEST(ScalableTSDFVolume, DISABLED_Integrate) { NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_ExtractPointCloud) { NotImplemented(); }
 
-TEST(ScalableTSDFVolume, DISABLED_ExtractTriangleMesh) { NotImplemented(); }
+TEST(ScalableTSDFVolume, ExtractTriangleMesh) {
+    pipelines::integration::ScalableTSDFVolume volume(
+            0.01, 0.04, pipelines::integration::TSDFVolumeColorType::RGB8, 8);
+    const Eigen::Vector3d center(0.013, -0.021, 0.007);
+    const double radius = 0.2;
+    IntegrateSphere(volume, center, radius);
+
+    auto mesh = volume.ExtractTriangleMesh();
+    EXPECT_FALSE(mesh->triangles_.empty());
+    EXPECT_EQ(mesh->vertex_colors_.size(), mesh->vertices_.size());
+    EXPECT_TRUE(mesh->IsEdgeManifold(/*allow_boundary_edges=*/false));
+    for (const Eigen::Vector3d &vertex : mesh->vertices_) {
+        EXPECT_NEAR((vertex - center).norm(), radius, volume.voxel_length_);
+    }
+
+    // The tiles cover the same triangles, and repeat only the boundary
+    // vertices.
+    size_t num_triangles = 0;
+    std::set<std::tuple<double, double, double>> vertices;
+    std::set<std::tuple<int, int, int>> tiles;
+    volume.ExtractTriangleMeshTiles(
+            2, [&](const Eigen::Vector3i &tile,
+                   const geometry::TriangleMesh &tile_mesh) {
+                EXPECT_TRUE(tiles.emplace(tile(0), tile(1), tile(2)).second);
+                EXPECT_EQ(tile_mesh.vertex_colors_.size(),
+                          tile_mesh.vertices_.size());
+                num_triangles += tile_mesh.triangles_.size();
+                for (const Eigen::Vector3d &vertex : tile_mesh.vertices_) {
+                    vertices.emplace(vertex(0), vertex(1), vertex(2));
+                }
+            });
+    EXPECT_GT(tiles.size(), 1u);
+    EXPECT_EQ(num_triangles, mesh->triangles_.size());
+    EXPECT_EQ(vertices.size(), mesh->vertices_.size());
+}
 
 TEST(ScalableTSDFVolume, DISABLED_ExtractVoxelPointCloud) { NotImplemented(); }
 
@@ -24,13 +24,51 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/odometry/Odometry.h"
+
+#include "open3d/geometry/RGBDImage.h"
 #include "tests/UnitTest.h"
+#include "tests/pipelines/odometry/OdometryTools.h"
 
 namespace open3d {
 namespace tests {
 
 TEST(Odometry, DISABLED_ComputeRGBDOdometry) { NotImplemented(); }
 
+TEST(Odometry, ComputeRGBDOdometryReuseContext) {
+    const int width = 64;
+    const int height = 48;
+    camera::PinholeCameraIntrinsic intrinsic(width, height, 50.0, 50.0, 31.5,
+                                             23.5);
+    std::vector<geometry::RGBDImage> images;
+    for (int i = 0; i < 3; i++) {
+        auto color = odometry_tools::GenerateImage(width, height, 1, 4, 0.0f,
+                                                   1.0f, i);
+        auto depth = odometry_tools::GenerateImage(width, height, 1, 4, 1.0f,
+                                                   1.1f, i + 10);
+        images.emplace_back(*color, *depth);
+    }
+
+    // The buffers of the context must not leak into the next pairs.
+    pipelines::odometry::OdometryOption option({4, 2});
+    pipelines::odometry::RGBDOdometryContext context;
+    for (int i = 0; i < 2; i++) {
+        auto expected = pipelines::odometry::ComputeRGBDOdometry(
+                images[i], images[i + 1], intrinsic,
+                Eigen::Matrix4d::Identity(),
+                pipelines::odometry::RGBDOdometryJacobianFromHybridTerm(),
+                option);
+        auto result = pipelines::odometry::ComputeRGBDOdometry(
+                context, images[i], images[i + 1], intrinsic,
+                Eigen::Matrix4d::Identity(),
+                pipelines::odometry::RGBDOdometryJacobianFromHybridTerm(),
+                option);
+        EXPECT_EQ(std::get<0>(result), std::get<0>(expected));
+        ExpectEQ(std::get<1>(result), std::get<1>(expected));
+        ExpectEQ(std::get<2>(result), std::get<2>(expected));
+    }
+}
+
 TEST(Odometry, DISABLED_PinholeCameraIntrinsic) { NotImplemented(); }
 
 TEST(Odometry, DISABLED_RGBDOdometryJacobianFromHybridTerm) {
@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/CorrespondenceChecker.h"
+
+#include "open3d/geometry/PointCloud.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -37,6 +40,54 @@ TEST(CorrespondenceChecker, DISABLED_MemberData) { NotImplemented(); }
 
 TEST(CorrespondenceChecker, DISABLED_Check) { NotImplemented(); }
 
+TEST(CorrespondenceChecker, CheckBatch) {
+    std::vector<Eigen::Vector3d> points(20);
+    Rand(points, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 0);
+    geometry::PointCloud source(points);
+    geometry::PointCloud target(points);
+    Eigen::Vector6d v;
+    v << 0.0, 0.0, 0.5, 0.1, 0.0, 0.0;
+    Eigen::Matrix4d transformation = utility::TransformVector6dToMatrix4d(v);
+    target.Transform(transformation);
+
+    // Hypotheses alternate between the true transformation and the identity,
+    // and between exact correspondences and a shuffled one.
+    std::vector<pipelines::registration::CorrespondenceSet> corres;
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> transformations;
+    for (int k = 0; k < 8; k++) {
+        pipelines::registration::CorrespondenceSet c;
+        for (int j = 0; j < 3; j++) {
+            int i = 3 * k + j;
+            c.push_back(Eigen::Vector2i(i % 20, (k % 4 < 2 ? i : i + 1) % 20));
+        }
+        corres.push_back(c);
+        transformations.push_back(k % 2 == 0 ? transformation
+                                             : Eigen::Matrix4d::Identity());
+    }
+
+    pipelines::registration::CorrespondenceCheckerBasedOnEdgeLength
+            edge_length(0.9);
+    pipelines::registration::CorrespondenceCheckerBasedOnDistance distance(
+            0.05);
+    for (const pipelines::registration::CorrespondenceChecker *checker :
+         {static_cast<const pipelines::registration::CorrespondenceChecker *>(
+                  &edge_length),
+          static_cast<const pipelines::registration::CorrespondenceChecker *>(
+                  &distance)}) {
+        std::vector<bool> valid(corres.size(), true);
+        checker->CheckBatch(source, target, corres, transformations, valid);
+        for (size_t k = 0; k < corres.size(); k++) {
+            EXPECT_EQ(valid[k], checker->Check(source, target, corres[k],
+                                               transformations[k]));
+        }
+    }
+    std::vector<bool> valid(corres.size(), true);
+    distance.CheckBatch(source, target, corres, transformations, valid);
+    for (size_t k = 0; k < corres.size(); k++) {
+        EXPECT_EQ(valid[k], k % 4 == 0);
+    }
+}
+
 TEST(CorrespondenceChecker, DISABLED_CorrespondenceCheckerBasedOnEdgeLength) {
     NotImplemented();
 }
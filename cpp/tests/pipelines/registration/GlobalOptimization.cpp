@@ -24,6 +24,14 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/GlobalOptimization.h"
+
+#include <Eigen/Dense>
+
+#include "open3d/pipelines/registration/GlobalOptimizationConvergenceCriteria.h"
+#include "open3d/pipelines/registration/GlobalOptimizationMethod.h"
+#include "open3d/pipelines/registration/PoseGraph.h"
+#include "open3d/utility/Eigen.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -33,8 +41,108 @@ TEST(GlobalOptimization, DISABLED_Constructor) { NotImplemented(); }
 
 TEST(GlobalOptimization, DISABLED_MemberData) { NotImplemented(); }
 
-TEST(GlobalOptimization, DISABLED_GlobalOptimizationLevenbergMarquardt) {
-    NotImplemented();
+// A loop of poses whose initial estimates are perturbed. The odometry and loop
+// closure edges agree with the ground truth, so both solvers recover it.
+static void TestPoseGraphLoop(
+        const pipelines::registration::GlobalOptimizationMethod &method) {
+    const int n_nodes = 8;
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    for (int i = 0; i < n_nodes; i++) {
+        Eigen::Vector6d v;
+        v << 0.0, 0.0, 0.8 * i, 2.0 * std::cos(0.8 * i),
+                2.0 * std::sin(0.8 * i), 0.1 * i;
+        poses.push_back(utility::TransformVector6dToMatrix4d(v));
+    }
+    poses[0].setIdentity();
+
+    pipelines::registration::PoseGraph pose_graph;
+    for (int i = 0; i < n_nodes; i++) {
+        Eigen::Vector6d noise;
+        noise << 0.02, -0.01, 0.03, 0.05, -0.04, 0.02;
+        pose_graph.nodes_.push_back(pipelines::registration::PoseGraphNode(
+                i == 0 ? poses[i]
+                       : utility::TransformVector6dToMatrix4d(noise * i) *
+                                 poses[i]));
+    }
+    for (int i = 0; i < n_nodes; i++) {
+        int j = (i + 1) % n_nodes;
+        pose_graph.edges_.push_back(pipelines::registration::PoseGraphEdge(
+                i, j, poses[j].inverse() * poses[i]));
+    }
+
+    pipelines::registration::GlobalOptimizationConvergenceCriteria criteria;
+    pipelines::registration::GlobalOptimizationOption option(
+            /*max_correspondence_distance=*/0.075,
+            /*edge_prune_threshold=*/0.25,
+            /*preference_loop_closure=*/1.0,
+            /*reference_node=*/0);
+    pipelines::registration::GlobalOptimization(pose_graph, method, criteria,
+                                                option);
+
+    ASSERT_EQ(int(pose_graph.nodes_.size()), n_nodes);
+    for (int i = 0; i < n_nodes; i++) {
+        ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[i].pose_), poses[i], 1e-4);
+    }
+}
+
+TEST(GlobalOptimization, GlobalOptimizationLevenbergMarquardt) {
+    TestPoseGraphLoop(
+            pipelines::registration::GlobalOptimizationLevenbergMarquardt());
+}
+
+TEST(GlobalOptimization, GlobalOptimizationGaussNewton) {
+    TestPoseGraphLoop(pipelines::registration::GlobalOptimizationGaussNewton());
+}
+
+TEST(GlobalOptimization, GlobalOptimizationSlidingWindow) {
+    const int n_nodes = 10;
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    pipelines::registration::PoseGraph pose_graph;
+    for (int i = 0; i < n_nodes; i++) {
+        Eigen::Vector6d v;
+        v << 0.0, 0.05 * i, 0.3 * i, 1.0 * i, 0.2 * i, 0.0;
+        poses.push_back(utility::TransformVector6dToMatrix4d(v));
+        pose_graph.nodes_.push_back(
+                pipelines::registration::PoseGraphNode(poses[i]));
+    }
+    for (int i = 0; i + 1 < n_nodes - 2; i++) {
+        pose_graph.edges_.push_back(pipelines::registration::PoseGraphEdge(
+                i, i + 1, poses[i + 1].inverse() * poses[i]));
+    }
+
+    // The two newest nodes start off their poses, and are constrained by the
+    // odometry and by a loop closure to the first node.
+    Eigen::Vector6d noise;
+    noise << 0.02, -0.01, 0.03, 0.05, -0.04, 0.02;
+    pose_graph.nodes_[n_nodes - 2].pose_ =
+            utility::TransformVector6dToMatrix4d(noise) * poses[n_nodes - 2];
+    pose_graph.nodes_[n_nodes - 1].pose_ =
+            utility::TransformVector6dToMatrix4d(-noise) * poses[n_nodes - 1];
+    pose_graph.edges_.push_back(pipelines::registration::PoseGraphEdge(
+            n_nodes - 3, n_nodes - 2,
+            poses[n_nodes - 2].inverse() * poses[n_nodes - 3]));
+    pose_graph.edges_.push_back(pipelines::registration::PoseGraphEdge(
+            n_nodes - 2, n_nodes - 1,
+            poses[n_nodes - 1].inverse() * poses[n_nodes - 2]));
+    pose_graph.edges_.push_back(pipelines::registration::PoseGraphEdge(
+            0, n_nodes - 1, poses[n_nodes - 1].inverse() * poses[0]));
+
+    pipelines::registration::GlobalOptimizationConvergenceCriteria criteria;
+    pipelines::registration::GlobalOptimizationOption option(
+            /*max_correspondence_distance=*/0.075,
+            /*edge_prune_threshold=*/0.25,
+            /*preference_loop_closure=*/1.0,
+            /*reference_node=*/0);
+    pipelines::registration::GlobalOptimization(
+            pose_graph,
+            pipelines::registration::GlobalOptimizationSlidingWindow(3),
+            criteria, option);
+
+    ASSERT_EQ(int(pose_graph.nodes_.size()), n_nodes);
+    ASSERT_EQ(int(pose_graph.edges_.size()), n_nodes);
+    for (int i = 0; i < n_nodes; i++) {
+        ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[i].pose_), poses[i], 1e-4);
+    }
 }
 
 TEST(GlobalOptimization, DISABLED_GlobalOptimizationConvergenceCriteria) {
@@ -24,6 +24,9 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/pipelines/registration/Registration.h"
+
+#include "open3d/geometry/PointCloud.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -45,6 +48,44 @@ TEST(Registration, DISABLED_EvaluateRegistration) { NotImplemented(); }
 
 TEST(Registration, DISABLED_RegistrationICP) { NotImplemented(); }
 
+TEST(Registration, RegistrationICPBatch) {
+    std::vector<Eigen::Vector3d> points(500);
+    Rand(points, Eigen::Vector3d(0, 0, 0), Eigen::Vector3d(1, 1, 1), 0);
+    std::vector<geometry::PointCloud> point_clouds;
+    for (int i = 0; i < 3; i++) {
+        Eigen::Vector6d v;
+        v << 0.01 * i, -0.02 * i, 0.03 * i, 0.02 * i, 0.01 * i, -0.01 * i;
+        point_clouds.push_back(geometry::PointCloud(points));
+        point_clouds.back().Transform(utility::TransformVector6dToMatrix4d(v));
+    }
+    std::vector<std::pair<int, int>> pairs = {{1, 0}, {2, 0}, {2, 1}};
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> inits(
+            pairs.size(), Eigen::Matrix4d::Identity());
+
+    std::vector<pipelines::registration::RegistrationResult> results;
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> information;
+    std::tie(results, information) =
+            pipelines::registration::RegistrationICPBatch(point_clouds, pairs,
+                                                          inits, 0.1);
+
+    ASSERT_EQ(results.size(), pairs.size());
+    ASSERT_EQ(information.size(), pairs.size());
+    for (size_t i = 0; i < pairs.size(); i++) {
+        const geometry::PointCloud &source = point_clouds[pairs[i].first];
+        const geometry::PointCloud &target = point_clouds[pairs[i].second];
+        pipelines::registration::RegistrationResult result =
+                pipelines::registration::RegistrationICP(source, target, 0.1,
+                                                         inits[i]);
+        ExpectEQ(Eigen::Matrix4d(results[i].transformation_),
+                 Eigen::Matrix4d(result.transformation_));
+        EXPECT_EQ(results[i].correspondence_set_.size(),
+                  result.correspondence_set_.size());
+        ExpectEQ(information[i],
+                 pipelines::registration::GetInformationMatrixFromPointClouds(
+                         source, target, 0.1, result.transformation_));
+    }
+}
+
 TEST(Registration, DISABLED_TransformationEstimationPointToPoint) {
     NotImplemented();
 }
@@ -32,6 +32,7 @@
 #include "open3d/core/TensorList.h"
 #include "open3d/io/ImageIO.h"
 #include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/t/geometry/ImagePyramid.h"
 #include "open3d/t/io/ImageIO.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 #include "tests/UnitTest.h"
@@ -866,6 +867,150 @@ TEST_P(ImagePermuteDevices, DepthToVertexNormalMaps) {
     EXPECT_TRUE(normal_map.AsTensor().AllClose(t_normal_ref));
 }
 
+TEST_P(ImagePermuteDevices, ImagePyramid) {
+    core::Device device = GetParam();
+
+    std::vector<uint16_t> depth_data(8 * 8);
+    for (int i = 0; i < 64; ++i) {
+        depth_data[i] = uint16_t(1000 + 10 * (i % 8) + 5 * (i / 8));
+    }
+    t::geometry::Image depth(core::Tensor(depth_data, {8, 8, 1},
+                                          core::Dtype::UInt16, device));
+    core::Tensor intrinsics = core::Tensor::Init<double>(
+            {{4.0, 0.0, 4.0}, {0.0, 4.0, 4.0}, {0.0, 0.0, 1.0}});
+    core::Tensor intrinsics_down = core::Tensor::Init<double>(
+            {{2.0, 0.0, 2.0}, {0.0, 2.0, 2.0}, {0.0, 0.0, 1.0}});
+
+    t::geometry::ImagePyramid pyramid(8, 8, 2, device);
+    // Levels are reused by further updates.
+    for (int update = 0; update < 2; ++update) {
+        pyramid.UpdateDepth(depth, intrinsics, 1000.0, 3.0, 0.14);
+
+        t::geometry::Image depth0 = depth.ClipTransform(1000.0, 0, 3.0, NAN);
+        t::geometry::Image depth1 = depth0.PyrDownDepth(0.14, NAN);
+        EXPECT_TRUE(pyramid.GetDepth(0).AsTensor().AllClose(
+                depth0.AsTensor()));
+        EXPECT_TRUE(pyramid.GetVertexMap(0).AsTensor().AllClose(
+                depth0.CreateVertexMap(intrinsics, NAN).AsTensor()));
+        EXPECT_TRUE(pyramid.GetDepth(1).AsTensor().AllClose(
+                depth1.AsTensor()));
+        EXPECT_TRUE(pyramid.GetVertexMap(1).AsTensor().AllClose(
+                depth1.CreateVertexMap(intrinsics_down, NAN).AsTensor()));
+        EXPECT_TRUE(pyramid.GetIntrinsics(1).AllClose(intrinsics_down));
+    }
+
+    // clang-format off
+    const std::vector<float> input_data =
+      {0, 0, 0, 0, 1,
+       0, 1, 1, 0, 0,
+       0, 0, 1, 0, 0,
+       1, 0, 1, 0, 0,
+       0, 0, 1, 1, 0};
+    const std::vector<float> output_dx_ref =
+      {1, 1, -1, 2, 3,
+       2, 3, -2, -2, 1,
+       0, 3, -1, -4, 0,
+       -2, 2, 1, -4, -1,
+       -1, 3, 3, -4, -3};
+    const std::vector<float> output_dy_ref =
+      {1, 3, 3, 0, -3,
+       0, 1, 2, 0, -3,
+       2, -1, -1, 0, 0,
+       0, 0, 1, 2, 1,
+       -3, -1, 1, 2, 1};
+    // clang-format on
+
+    t::geometry::ImagePyramid intensity_pyramid(5, 5, 1, device);
+    intensity_pyramid.UpdateIntensity(t::geometry::Image(core::Tensor(
+            input_data, {5, 5, 1}, core::Dtype::Float32, device)));
+    EXPECT_TRUE(intensity_pyramid.GetIntensityDx(0).AsTensor().AllClose(
+            core::Tensor(output_dx_ref, {5, 5, 1}, core::Dtype::Float32,
+                         device)));
+    EXPECT_TRUE(intensity_pyramid.GetIntensityDy(0).AsTensor().AllClose(
+            core::Tensor(output_dy_ref, {5, 5, 1}, core::Dtype::Float32,
+                         device)));
+}
+
+TEST_P(ImagePermuteDevices, ImageBatch) {
+    core::Device device = GetParam();
+
+    // clang-format off
+    const std::vector<float> input_data =
+      {0, 0, 0, 0, 0, 0, 0, 0,
+       1.2, 1, 0, 0, 0, 0, 1, 0,
+       0, 0, 1, 0, 0, 0, 0, 0,
+       0, 0, 0, 0, 0, 0, 0, 0,
+       // Second image of the stack.
+       0, 0, 0, 0, 0, 0, 0, 0,
+       0, 0, 0, 0, 0, 0, 0, 0,
+       0, 0, 0, 0, 0, 0, 0, 0,
+       0, 0, 0, 0, 0, 0, 0, 2};
+    const std::vector<float> dilate_ref =
+      {1.2, 1.2, 1, 0, 0, 1, 1, 1,
+       1.2, 1.2, 1, 1, 0, 1, 1, 1,
+       1.2, 1.2, 1, 1, 0, 1, 1, 1,
+       0, 1, 1, 1, 0, 0, 0, 0,
+       0, 0, 0, 0, 0, 0, 0, 0,
+       0, 0, 0, 0, 0, 0, 0, 0,
+       0, 0, 0, 0, 0, 0, 2, 2,
+       0, 0, 0, 0, 0, 0, 2, 2};
+    const std::vector<float> resize_ref =
+      {0, 0, 0, 0,
+       0, 1, 0, 0,
+       0, 0, 0, 0,
+       0, 0, 0, 0};
+    // clang-format on
+
+    core::Tensor images(input_data, {2, 4, 8, 1}, core::Dtype::Float32,
+                        device);
+    EXPECT_TRUE(t::geometry::Image::DilateBatch(images, 3).AllClose(
+            core::Tensor(dilate_ref, {2, 4, 8, 1}, core::Dtype::Float32,
+                         device)));
+    EXPECT_TRUE(t::geometry::Image::ResizeBatch(images, 0.5).AllClose(
+            core::Tensor(resize_ref, {2, 2, 4, 1}, core::Dtype::Float32,
+                         device)));
+
+    // Every image of the stack is processed like a stack of one image.
+    core::Tensor kernel = core::Tensor::Init<float>(
+            {{0, 1, 0}, {1, 2, 3}, {0, 4, 0}}, device);
+    core::Tensor filtered = t::geometry::Image::FilterBatch(images, kernel);
+    core::Tensor blurred = t::geometry::Image::FilterGaussianBatch(images);
+    core::Tensor upsampled = t::geometry::Image::ResizeBatch(
+            images, 2.0, t::geometry::Image::InterpType::Linear);
+    for (int64_t i = 0; i < 2; ++i) {
+        core::Tensor image = images.Slice(0, i, i + 1);
+        EXPECT_TRUE(filtered.Slice(0, i, i + 1).AllClose(
+                t::geometry::Image::FilterBatch(image, kernel)));
+        EXPECT_TRUE(blurred.Slice(0, i, i + 1).AllClose(
+                t::geometry::Image::FilterGaussianBatch(image)));
+        EXPECT_TRUE(upsampled.Slice(0, i, i + 1).AllClose(
+                t::geometry::Image::ResizeBatch(
+                        image, 2.0, t::geometry::Image::InterpType::Linear)));
+    }
+    // The filter correlates with the kernel, with replicated borders.
+    EXPECT_TRUE(filtered[1][3][7].AllClose(
+            core::Tensor::Init<float>({2 * 9}, device)));
+    EXPECT_TRUE(filtered[1][2][7].AllClose(
+            core::Tensor::Init<float>({2 * 4}, device)));
+
+    // A constant image is preserved by the normalized Gaussian filter.
+    core::Tensor constant =
+            core::Tensor::Full({3, 6, 5, 3}, 100, core::Dtype::UInt8, device);
+    EXPECT_TRUE(t::geometry::Image::FilterGaussianBatch(constant, 5, 1.5f)
+                        .AllClose(constant));
+
+    core::Tensor colors(std::vector<uint8_t>{255, 0, 0, 0, 255, 0, 0, 0, 255},
+                        {1, 1, 3, 3}, core::Dtype::UInt8, device);
+    core::Tensor gray = t::geometry::Image::RGBToGrayBatch(colors);
+    EXPECT_EQ(gray.GetShape(), core::SizeVector({1, 1, 3, 1}));
+    EXPECT_EQ(gray.ToFlatVector<uint8_t>(),
+              std::vector<uint8_t>({76, 150, 29}));
+
+    EXPECT_ANY_THROW(t::geometry::Image::RGBToGrayBatch(constant[0]));
+    EXPECT_ANY_THROW(t::geometry::Image::ResizeBatch(
+            images, 0.5, t::geometry::Image::InterpType::Cubic));
+}
+
 TEST_P(ImagePermuteDevices, DISABLED_CreateVertexMap_Visual) {
     core::Device device = GetParam();
 
@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Octree.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/Octree.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class OctreePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Octree,
+                         OctreePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(OctreePermuteDevices, Build) {
+    core::Device device = GetParam();
+
+    // The last point is out of bound.
+    core::Tensor points(std::vector<float>{1.5, 0.5, 0.5, 0.5, 0.5, 0.5, 1.5,
+                                           1.5, 1.5, 0.6, 0.6, 0.6, 2.5, 0.5,
+                                           0.5},
+                        {5, 3}, core::Dtype::Float32, device);
+    t::geometry::Octree octree(
+            1, core::Tensor::Zeros({3}, core::Dtype::Float64), 2);
+    EXPECT_TRUE(octree.IsEmpty());
+    octree.Build(points);
+    EXPECT_FALSE(octree.IsEmpty());
+    EXPECT_EQ(octree.GetDevice(), device);
+
+    EXPECT_EQ(octree.GetNumNodes(0), 1);
+    EXPECT_EQ(octree.GetNumNodes(1), 3);
+    EXPECT_EQ(octree.GetNodeCodes(1).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 1, 7}));
+    EXPECT_EQ(octree.GetNodeOffsets(0).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 3}));
+    EXPECT_EQ(octree.GetNodeOffsets(1).ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 2, 3, 4}));
+    EXPECT_EQ(octree.GetPointIndices().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 3, 0, 2}));
+    EXPECT_EQ(octree.GetLeafColors().NumElements(), 0);
+}
+
+TEST_P(OctreePermuteDevices, FragmentPLYToLegacyOctree) {
+    core::Device device = GetParam();
+
+    geometry::PointCloud legacy_pcd;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply",
+                       legacy_pcd);
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            legacy_pcd, core::Dtype::Float64, device);
+
+    for (int64_t max_depth : {0, 1, 5}) {
+        geometry::Octree legacy_octree(max_depth);
+        legacy_octree.ConvertFromPointCloud(legacy_pcd, 0.01);
+        t::geometry::Octree octree = t::geometry::Octree::CreateFromPointCloud(
+                pcd, max_depth, 0.01);
+        EXPECT_EQ(octree.GetLeafColors().GetLength(),
+                  octree.GetNumNodes(max_depth));
+        EXPECT_TRUE(*octree.ToLegacyOctree() == legacy_octree);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
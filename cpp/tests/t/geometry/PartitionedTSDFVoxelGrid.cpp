@@ -0,0 +1,160 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/PartitionedTSDFVoxelGrid.h"
+
+#include <vector>
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/t/io/ImageIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class PartitionedTSDFVoxelGridPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(PartitionedTSDFVoxelGrid,
+                         PartitionedTSDFVoxelGridPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(PartitionedTSDFVoxelGridPermuteDevices, GetPartitionIds) {
+    core::Device device = GetParam();
+    const int num_partitions = 3;
+    t::geometry::PartitionedTSDFVoxelGrid voxel_grid(
+            {{"tsdf", core::Dtype::Float32}, {"weight", core::Dtype::UInt16}},
+            0.008f, 0.04f, 16, 10,
+            std::vector<core::Device>(num_partitions, device),
+            /*region_size=*/2);
+
+    // The blocks of a region of 2^3 blocks share the partition.
+    core::Tensor block_coords = core::Tensor::Init<int>(
+            {{-2, 4, 6}, {-1, 5, 7}, {-2, 5, 6}, {0, 0, 0}, {1, 1, 1}},
+            device);
+    std::vector<int64_t> ids =
+            voxel_grid.GetPartitionIds(block_coords).ToFlatVector<int64_t>();
+    for (int64_t id : ids) {
+        EXPECT_GE(id, 0);
+        EXPECT_LT(id, num_partitions);
+    }
+    EXPECT_EQ(ids[0], ids[1]);
+    EXPECT_EQ(ids[0], ids[2]);
+    EXPECT_EQ(ids[3], ids[4]);
+}
+
+TEST_P(PartitionedTSDFVoxelGridPermuteDevices, IntegrateRayCast) {
+    core::Device device = GetParam();
+    core::HashmapBackend backend =
+            device.GetType() == core::Device::DeviceType::CUDA
+                    ? core::HashmapBackend::StdGPU
+                    : core::HashmapBackend::TBB;
+    std::unordered_map<std::string, core::Dtype> attr_dtype_map = {
+            {"tsdf", core::Dtype::Float32},
+            {"weight", core::Dtype::UInt16},
+            {"color", core::Dtype::UInt16}};
+
+    // Intrinsics
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    // Extrinsics
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+
+    std::vector<t::geometry::Image> depths, colors;
+    std::vector<core::Tensor> extrinsics;
+    for (int i = 0; i < 3; ++i) {
+        depths.push_back(t::io::CreateImageFromFile(
+                                 fmt::format("{}/RGBD/depth/{:05d}.png",
+                                             std::string(TEST_DATA_DIR), i))
+                                 ->To(device));
+        colors.push_back(t::io::CreateImageFromFile(
+                                 fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                             std::string(TEST_DATA_DIR), i))
+                                 ->To(device));
+        extrinsics.push_back(core::eigen_converter::EigenMatrixToTensor(
+                trajectory->parameters_[i].extrinsic_));
+    }
+
+    t::geometry::TSDFVoxelGrid voxel_grid(attr_dtype_map, 0.008f, 0.04f, 16,
+                                          1000, device, backend);
+    for (int i = 0; i < 3; ++i) {
+        voxel_grid.Integrate(depths[i], colors[i], intrinsic_t, extrinsics[i]);
+    }
+    int64_t num_points =
+            voxel_grid.ExtractSurfacePoints(-1, 0.0f).GetPoints().GetLength();
+    EXPECT_GT(num_points, 0);
+
+    // Partitioned integration updates the same blocks and voxels.
+    for (int64_t region_size : {1, 4}) {
+        t::geometry::PartitionedTSDFVoxelGrid partitioned_grid(
+                attr_dtype_map, 0.008f, 0.04f, 16, 1000,
+                std::vector<core::Device>(3, device), region_size, backend);
+        partitioned_grid.IntegrateFrames(depths, colors, {intrinsic_t},
+                                         extrinsics);
+        EXPECT_EQ(partitioned_grid.GetBlockCount(),
+                  voxel_grid.GetBlockHashmap()->Size());
+        EXPECT_EQ(partitioned_grid.Gather(device)
+                          .ExtractSurfacePoints(-1, 0.0f)
+                          .GetPoints()
+                          .GetLength(),
+                  num_points);
+    }
+
+    // Ray casting gathers the visible blocks of all partitions.
+    t::geometry::TSDFVoxelGrid frame_grid(attr_dtype_map, 0.008f, 0.04f, 16,
+                                          1000, device, backend);
+    frame_grid.Integrate(depths[0], colors[0], intrinsic_t, extrinsics[0]);
+    t::geometry::PartitionedTSDFVoxelGrid partitioned_grid(
+            attr_dtype_map, 0.008f, 0.04f, 16, 1000,
+            std::vector<core::Device>(3, device), 1, backend);
+    partitioned_grid.Integrate(depths[0], colors[0], intrinsic_t,
+                               extrinsics[0]);
+
+    using MaskCode = t::geometry::TSDFVoxelGrid::SurfaceMaskCode;
+    int mask = MaskCode::DepthMap | MaskCode::VertexMap;
+    auto result = frame_grid.RayCast(intrinsic_t, extrinsics[0], 640, 480,
+                                     1000.0f, 0.1f, 3.0f, 1.0f, mask);
+    auto partitioned_result = partitioned_grid.RayCast(
+            intrinsic_t, extrinsics[0], 640, 480, 1000.0f, 0.1f, 3.0f, 1.0f,
+            mask);
+    for (MaskCode code : {MaskCode::DepthMap, MaskCode::VertexMap}) {
+        EXPECT_TRUE(partitioned_result[code].AllClose(result[code]));
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
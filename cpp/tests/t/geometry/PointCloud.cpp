@@ -27,11 +27,17 @@
 #include "open3d/t/geometry/PointCloud.h"
 
 #include <gmock/gmock.h>
+#include <random>
 
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/geometry/BoundingVolume.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/geometry/TriangleMeshBVH.h"
 #include "open3d/io/PointCloudIO.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 #include "tests/UnitTest.h"
 
 namespace open3d {
@@ -121,6 +127,81 @@ TEST_P(PointCloudPermuteDevices, GetMinBound_GetMaxBound_GetCenter) {
               std::vector<float>({2.5, 3.5, 4.5}));
 }
 
+TEST_P(PointCloudPermuteDevices, GetOrientedBoundingBoxes) {
+    core::Device device = GetParam();
+
+    // Random boxes of different sizes and an empty cluster.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::vector<Eigen::Vector3d> points;
+    std::vector<size_t> offsets{0};
+    for (int i = 0; i < 16; ++i) {
+        const Eigen::Matrix3d R =
+                geometry::Geometry3D::GetRotationMatrixFromXYZ(
+                        Eigen::Vector3d(uniform(rng), uniform(rng),
+                                        uniform(rng)));
+        const Eigen::Vector3d t(uniform(rng), uniform(rng), uniform(rng));
+        for (int j = 0; j < 20 + 5 * i; ++j) {
+            points.push_back(R * Eigen::Vector3d(3 * uniform(rng),
+                                                 2 * uniform(rng),
+                                                 uniform(rng)) +
+                             t);
+        }
+        offsets.push_back(points.size());
+    }
+    offsets.push_back(points.size());
+
+    const std::vector<geometry::OrientedBoundingBox> boxes =
+            geometry::OrientedBoundingBox::CreateFromPointSets(points, offsets,
+                                                               false);
+    t::geometry::PointCloud pcd(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    points, core::Dtype::Float64, device));
+    core::Tensor centers, rotations, extents;
+    std::tie(centers, rotations, extents) = pcd.GetOrientedBoundingBoxes(
+            core::Tensor(std::vector<int64_t>(offsets.begin(), offsets.end()),
+                         {int64_t(offsets.size())}, core::Dtype::Int64,
+                         device));
+    EXPECT_EQ(centers.GetShape(), core::SizeVector({17, 3}));
+    EXPECT_EQ(rotations.GetShape(), core::SizeVector({17, 3, 3}));
+    EXPECT_EQ(extents.GetShape(), core::SizeVector({17, 3}));
+
+    const std::vector<double> centers_vec = centers.ToFlatVector<double>();
+    const std::vector<double> rotations_vec = rotations.ToFlatVector<double>();
+    const std::vector<double> extents_vec = extents.ToFlatVector<double>();
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        for (int j = 0; j < 3; ++j) {
+            EXPECT_NEAR(centers_vec[3 * i + j], boxes[i].center_(j), 1e-6);
+            EXPECT_NEAR(extents_vec[3 * i + j], boxes[i].extent_(j), 1e-6);
+            for (int k = 0; k < 3; ++k) {
+                // The axes are unique up to their sign.
+                EXPECT_NEAR(std::abs(rotations_vec[9 * i + 3 * j + k]),
+                            std::abs(boxes[i].R_(j, k)), 1e-6);
+            }
+        }
+    }
+
+    // Float32 points give Float32 boxes.
+    const geometry::OrientedBoundingBox box =
+            geometry::OrientedBoundingBox::CreateFromPointSets(
+                    points, {0, points.size()}, false)[0];
+    t::geometry::PointCloud pcd_float(
+            pcd.GetPoints().To(core::Dtype::Float32));
+    std::tie(centers, rotations, extents) =
+            pcd_float.GetOrientedBoundingBoxes(core::Tensor::Init<int64_t>(
+                    {0, int64_t(points.size())}, device));
+    EXPECT_EQ(extents.GetDtype(), core::Dtype::Float32);
+    EXPECT_TRUE(extents.AllClose(
+            core::Tensor(std::vector<float>{float(box.extent_(0)),
+                                            float(box.extent_(1)),
+                                            float(box.extent_(2))},
+                         {1, 3}, core::Dtype::Float32, device),
+            1e-4, 1e-4));
+
+    EXPECT_ANY_THROW(pcd.GetOrientedBoundingBoxes(
+            core::Tensor::Init<int64_t>({0, 10}, device)));
+}
+
 TEST_P(PointCloudPermuteDevicePairs, CopyDevice) {
     core::Device dst_device;
     core::Device src_device;
@@ -284,6 +365,41 @@ TEST_P(PointCloudPermuteDevices, FromLegacyPointCloud) {
             core::Tensor::Ones({2, 3}, dtype, device)));
 }
 
+TEST_P(PointCloudPermuteDevices, FromLegacyPointCloudMove) {
+    core::Device device = GetParam();
+    geometry::PointCloud legacy_pcd;
+    legacy_pcd.points_ = std::vector<Eigen::Vector3d>{Eigen::Vector3d(0, 1, 2),
+                                                      Eigen::Vector3d(3, 4, 5)};
+    legacy_pcd.normals_ = std::vector<Eigen::Vector3d>{
+            Eigen::Vector3d(0, 0, 1), Eigen::Vector3d(0, 0, 1)};
+    const double *points_data = legacy_pcd.points_[0].data();
+
+    // Float64 on CPU aliases the legacy storage.
+    core::Dtype dtype = core::Dtype::Float64;
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            std::move(legacy_pcd), dtype, device);
+    EXPECT_FALSE(legacy_pcd.HasPoints());
+    EXPECT_TRUE(pcd.HasPoints());
+    EXPECT_FALSE(pcd.HasPointColors());
+    EXPECT_TRUE(pcd.HasPointNormals());
+    EXPECT_EQ(pcd.GetPoints().GetDevice(), device);
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        EXPECT_EQ(pcd.GetPoints().GetDataPtr(), points_data);
+    }
+    EXPECT_EQ(pcd.GetPoints().ToFlatVector<double>(),
+              std::vector<double>({0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(pcd.GetPointNormals().ToFlatVector<double>(),
+              std::vector<double>({0, 0, 1, 0, 0, 1}));
+
+    // Other dtypes copy.
+    pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            pcd.ToLegacyPointCloud(), core::Dtype::Float32, device);
+    EXPECT_EQ(pcd.GetPoints().ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(pcd.GetPointNormals().ToFlatVector<float>(),
+              std::vector<float>({0, 0, 1, 0, 0, 1}));
+}
+
 TEST_P(PointCloudPermuteDevices, ToLegacyPointCloud) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Dtype::Float32;
@@ -408,6 +524,37 @@ TEST_P(PointCloudPermuteDevices, Append) {
     EXPECT_ANY_THROW(pcd2 + pcd);
 }
 
+TEST_P(PointCloudPermuteDevices, Pack) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(
+            core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}));
+    pcd.SetPointColors(core::Tensor::Init<float>({{1, 0, 0}, {0, 1, 0}}));
+    pcd.SetPointAttr("labels", core::Tensor::Init<int32_t>({3, 4}));
+    pcd = pcd.To(device);
+    EXPECT_FALSE(pcd.IsPacked());
+
+    t::geometry::PointCloud pcd_packed = pcd.Pack();
+    EXPECT_TRUE(pcd_packed.IsPacked());
+    EXPECT_TRUE(pcd_packed.GetPoints().AllClose(pcd.GetPoints()));
+
+    t::geometry::PointCloud pcd_clone = pcd_packed.Clone();
+    EXPECT_TRUE(pcd_clone.IsPacked());
+    EXPECT_FALSE(pcd_clone.GetPoints().IsSame(pcd_packed.GetPoints()));
+    EXPECT_TRUE(pcd_clone.GetPointColors().AllClose(pcd.GetPointColors()));
+    EXPECT_TRUE(pcd_clone.GetPointAttr("labels").AllClose(
+            pcd.GetPointAttr("labels")));
+
+    t::geometry::PointCloud pcd_cpu = pcd_packed.To(core::Device("CPU:0"));
+    EXPECT_TRUE(pcd_cpu.IsPacked());
+    EXPECT_TRUE(pcd_cpu.GetPointAttr("labels").AllClose(
+            pcd.GetPointAttr("labels").To(core::Device("CPU:0"))));
+
+    t::geometry::PointCloud pcd_appended = pcd_packed + pcd;
+    EXPECT_TRUE(pcd_appended.IsPacked());
+    EXPECT_EQ(pcd_appended.GetPointAttr("labels").GetLength(), 4);
+}
+
 TEST_P(PointCloudPermuteDevices, Has) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Dtype::Float32;
@@ -498,6 +645,62 @@ TEST_P(PointCloudPermuteDevices, CreateFromRGBDImage) {
     EXPECT_FALSE(pcd_out.HasPointNormals());
 }
 
+TEST_P(PointCloudPermuteDevices, CreateFromRGBDImageVoxelDownSample) {
+    core::Device device = GetParam();
+
+    // Pixel (u, v) is unprojected to (u, v, 1), except for the invalid pixel
+    // (3, 3), with the color (u / 10, v / 10, 0.5).
+    std::vector<uint16_t> depth_data(16, 1000);
+    depth_data[15] = 0;
+    std::vector<float> color_data;
+    for (int v = 0; v < 4; ++v) {
+        for (int u = 0; u < 4; ++u) {
+            color_data.insert(color_data.end(), {u / 10.f, v / 10.f, 0.5f});
+        }
+    }
+    t::geometry::RGBDImage rgbd(
+            core::Tensor(color_data, {4, 4, 3}, core::Dtype::Float32, device),
+            core::Tensor(depth_data, {4, 4, 1}, core::Dtype::UInt16, device));
+    core::Tensor intrinsics = core::Tensor::Eye(3, core::Dtype::Float32,
+                                                core::Device("CPU:0"));
+
+    t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::CreateFromRGBDImageVoxelDownSample(
+                    rgbd, intrinsics, 2.0);
+    ASSERT_EQ(pcd.GetPoints().GetLength(), 4);
+    EXPECT_EQ(pcd.GetDevice(), device);
+
+    // Points of 2 x 2 pixel blocks are averaged, in any order.
+    const std::vector<std::vector<float>> points_ref = {
+            {0.5, 0.5, 1}, {2.5, 0.5, 1}, {0.5, 2.5, 1}, {7 / 3.f, 7 / 3.f, 1}};
+    const std::vector<float> points = pcd.GetPoints().ToFlatVector<float>();
+    const std::vector<float> colors =
+            pcd.GetPointColors().ToFlatVector<float>();
+    int num_matches = 0;
+    for (int i = 0; i < 4; ++i) {
+        for (const std::vector<float>& point_ref : points_ref) {
+            num_matches += std::abs(points[3 * i] - point_ref[0]) < 1e-5 &&
+                           std::abs(points[3 * i + 1] - point_ref[1]) < 1e-5 &&
+                           std::abs(points[3 * i + 2] - point_ref[2]) < 1e-5;
+        }
+        EXPECT_NEAR(colors[3 * i], points[3 * i] / 10, 1e-5);
+        EXPECT_NEAR(colors[3 * i + 1], points[3 * i + 1] / 10, 1e-5);
+        EXPECT_NEAR(colors[3 * i + 2], 0.5, 1e-5);
+    }
+    EXPECT_EQ(num_matches, 4);
+
+    // Without colors, and with depth truncation removing every point.
+    pcd = t::geometry::PointCloud::CreateFromDepthImageVoxelDownSample(
+            rgbd.depth_, intrinsics, 2.0);
+    EXPECT_EQ(pcd.GetPoints().GetLength(), 4);
+    EXPECT_FALSE(pcd.HasPointColors());
+    pcd = t::geometry::PointCloud::CreateFromDepthImageVoxelDownSample(
+            rgbd.depth_, intrinsics, 2.0,
+            core::Tensor::Eye(4, core::Dtype::Float32, core::Device("CPU:0")),
+            1000.0f, 0.5f);
+    EXPECT_EQ(pcd.GetPoints().GetLength(), 0);
+}
+
 TEST_P(PointCloudPermuteDevices, CreateFromRGBDOrDepthImageWithNormals) {
     core::Device device = GetParam();
 
@@ -646,5 +849,498 @@ TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
             core::Tensor::Init<float>({{0, 0, 0}}, device)));
 }
 
+TEST_P(PointCloudPermuteDevices, VoxelDownSampleReduction) {
+    using VoxelReduction = t::geometry::PointCloud::VoxelReduction;
+    core::Device device = GetParam();
+
+    // Two points in voxel (0, 0, 0) and one point in voxel (1, 0, 0).
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>(
+            {{0.1, 0.1, 0.1}, {0.3, 0.3, 0.3}, {1.6, 0.2, 0.2}}, device));
+    pcd.SetPointColors(core::Tensor::Init<float>(
+            {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}, device));
+    pcd.SetPointAttr("intensities",
+                     core::Tensor::Init<uint8_t>({10, 21, 30}, device));
+
+    auto check = [&](VoxelReduction reduction,
+                     const std::vector<float>& point_ref,
+                     const std::vector<float>& color_ref,
+                     uint8_t intensity_ref) {
+        t::geometry::PointCloud pcd_down = pcd.VoxelDownSample(1, reduction);
+        ASSERT_EQ(pcd_down.GetPoints().GetLength(), 2);
+        EXPECT_EQ(pcd_down.GetPointAttr("intensities").GetDtype(),
+                  core::Dtype::UInt8);
+        // The voxels are in no particular order.
+        int64_t i = pcd_down.GetPoints()[0][0].Item<float>() < 1 ? 0 : 1;
+        EXPECT_TRUE(pcd_down.GetPoints()[i].AllClose(
+                core::Tensor(point_ref, {3}, core::Dtype::Float32, device)));
+        EXPECT_TRUE(pcd_down.GetPointColors()[i].AllClose(
+                core::Tensor(color_ref, {3}, core::Dtype::Float32, device)));
+        EXPECT_EQ(pcd_down.GetPointAttr("intensities")[i].Item<uint8_t>(),
+                  intensity_ref);
+        EXPECT_EQ(pcd_down.GetPointAttr("intensities")[1 - i].Item<uint8_t>(),
+                  30);
+    };
+    check(VoxelReduction::Mean, {0.2, 0.2, 0.2}, {0.5, 0.5, 0}, 16);
+    check(VoxelReduction::First, {0.1, 0.1, 0.1}, {1, 0, 0}, 10);
+    check(VoxelReduction::CenterNearest, {0.3, 0.3, 0.3}, {0, 1, 0}, 21);
+    check(VoxelReduction::Max, {0.3, 0.3, 0.3}, {1, 1, 0}, 21);
+}
+
+TEST_P(PointCloudPermuteDevices, SelectByMask) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 2}}, device));
+    pcd.SetPointColors(core::Tensor::Init<float>(
+            {{0, 0, 0}, {0.1, 0, 0}, {0, 0.1, 0}, {0, 0, 0.2}}, device));
+    core::Tensor mask =
+            core::Tensor::Init<bool>({true, false, false, true}, device);
+
+    t::geometry::PointCloud pcd_select = pcd.SelectByMask(mask);
+    EXPECT_TRUE(pcd_select.GetPoints().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0}, {0, 0, 2}}, device)));
+    EXPECT_TRUE(pcd_select.GetPointColors().AllClose(
+            core::Tensor::Init<float>({{0, 0, 0}, {0, 0, 0.2}}, device)));
+
+    pcd_select = pcd.SelectByMask(mask, /*invert=*/true);
+    EXPECT_TRUE(pcd_select.GetPoints().AllClose(
+            core::Tensor::Init<float>({{1, 0, 0}, {0, 1, 0}}, device)));
+}
+
+TEST_P(PointCloudPermuteDevices, Crop) {
+    core::Device device = GetParam();
+
+    geometry::PointCloud pcd_legacy = *io::CreatePointCloudFromFile(
+            std::string(TEST_DATA_DIR) + "/ICP/cloud_bin_2.pcd");
+    t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    pcd_legacy, core::Dtype::Float64, device);
+
+    geometry::AxisAlignedBoundingBox aabb =
+            pcd_legacy.GetAxisAlignedBoundingBox();
+    aabb.Scale(0.5, aabb.GetCenter());
+    geometry::OrientedBoundingBox obb =
+            geometry::OrientedBoundingBox::CreateFromAxisAlignedBoundingBox(
+                    aabb);
+    obb.Rotate(geometry::Geometry3D::GetRotationMatrixFromXYZ({0.3, 0.2, 0.1}),
+               obb.GetCenter());
+
+    auto check = [&](const t::geometry::PointCloud& pcd_crop,
+                     const geometry::PointCloud& pcd_crop_legacy) {
+        EXPECT_EQ(pcd_crop.GetPoints().GetLength(),
+                  int64_t(pcd_crop_legacy.points_.size()));
+        EXPECT_TRUE(pcd_crop.HasPointColors());
+        EXPECT_TRUE(pcd_crop.HasPointNormals());
+    };
+    check(pcd.Crop(aabb), *pcd_legacy.Crop(aabb));
+    check(pcd.Crop(obb), *pcd_legacy.Crop(obb));
+    EXPECT_EQ(pcd.Crop(aabb).GetPoints().GetLength() +
+                      pcd.Crop(aabb, /*invert=*/true).GetPoints().GetLength(),
+              pcd.GetPoints().GetLength());
+}
+
+TEST_P(PointCloudPermuteDevices, RemoveOutliers) {
+    core::Device device = GetParam();
+
+    geometry::PointCloud pcd_legacy = *io::CreatePointCloudFromFile(
+            std::string(TEST_DATA_DIR) + "/ICP/cloud_bin_2.pcd");
+    t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    pcd_legacy, core::Dtype::Float64, device);
+
+    auto check = [&](const std::tuple<t::geometry::PointCloud, core::Tensor>&
+                             result,
+                     const std::vector<size_t>& indices_legacy) {
+        std::vector<bool> mask_legacy(pcd_legacy.points_.size(), false);
+        for (size_t idx : indices_legacy) {
+            mask_legacy[idx] = true;
+        }
+        const core::Tensor& mask = std::get<1>(result);
+        EXPECT_EQ(mask.GetDtype(), core::Dtype::Bool);
+        EXPECT_EQ(mask.GetDevice(), device);
+        EXPECT_EQ(mask.ToFlatVector<bool>(), mask_legacy);
+        EXPECT_EQ(std::get<0>(result).GetPoints().GetLength(),
+                  int64_t(indices_legacy.size()));
+        EXPECT_TRUE(std::get<0>(result).HasPointColors());
+    };
+    check(pcd.RemoveRadiusOutliers(16, 0.05),
+          std::get<1>(pcd_legacy.RemoveRadiusOutliers(16, 0.05)));
+    check(pcd.RemoveStatisticalOutliers(20, 1.0),
+          std::get<1>(pcd_legacy.RemoveStatisticalOutliers(20, 1.0)));
+}
+
+TEST_P(PointCloudPermuteDevices, ComputePointCloudDistance) {
+    core::Device device = GetParam();
+
+    geometry::PointCloud source_legacy = *io::CreatePointCloudFromFile(
+            std::string(TEST_DATA_DIR) + "/ICP/cloud_bin_0.pcd");
+    geometry::PointCloud target_legacy = *io::CreatePointCloudFromFile(
+            std::string(TEST_DATA_DIR) + "/ICP/cloud_bin_1.pcd");
+    t::geometry::PointCloud source =
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    source_legacy, core::Dtype::Float64, device);
+    t::geometry::PointCloud target =
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    target_legacy, core::Dtype::Float64, device);
+
+    core::Tensor distances, indices;
+    std::tie(distances, indices) =
+            source.ComputePointCloudDistance(target, /*chunk_size=*/1000);
+    EXPECT_EQ(distances.GetDevice(), device);
+    EXPECT_EQ(indices.GetDtype(), core::Dtype::Int64);
+    const std::vector<double> distances_legacy =
+            source_legacy.ComputePointCloudDistance(target_legacy);
+    EXPECT_TRUE(distances.AllClose(
+            core::Tensor(distances_legacy, {int64_t(distances_legacy.size())},
+                         core::Dtype::Float64, device),
+            0, 1e-10));
+    const core::Tensor diff =
+            source.GetPoints() - target.GetPoints().IndexGet({indices});
+    EXPECT_TRUE((diff * diff).Sum({1}).Sqrt().AllClose(distances, 0, 1e-10));
+
+    std::tie(distances, indices) =
+            source.ComputePointCloudDistance(t::geometry::PointCloud(device));
+    EXPECT_TRUE(distances.IsInf().All());
+    EXPECT_TRUE(indices.Eq(-1).All());
+}
+
+TEST_P(PointCloudPermuteDevices, ComputeMeshDistance) {
+    core::Device device = GetParam();
+
+    auto mesh_legacy = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *mesh_legacy, core::Dtype::Float32, core::Dtype::Int64,
+                    device);
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> uniform(-2.0f, 2.0f);
+    std::vector<float> points(3 * 1000);
+    for (float& x : points) {
+        x = uniform(rng);
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {1000, 3}, core::Dtype::Float32, device));
+
+    core::Tensor distances, indices;
+    std::tie(distances, indices) =
+            pcd.ComputeMeshDistance(mesh, /*chunk_size=*/300);
+    EXPECT_EQ(distances.GetDevice(), device);
+    EXPECT_EQ(indices.GetDtype(), core::Dtype::Int64);
+    const std::vector<float> result = distances.ToFlatVector<float>();
+    const std::vector<int64_t> triangles = indices.ToFlatVector<int64_t>();
+    for (size_t i = 0; i < result.size(); ++i) {
+        const Eigen::Vector3d p(points[3 * i], points[3 * i + 1],
+                                points[3 * i + 2]);
+        const Eigen::Vector3i& triangle = mesh_legacy->triangles_[triangles[i]];
+        const Eigen::Vector3d q =
+                geometry::TriangleMeshBVH::ClosestPointOnTriangle(
+                        p, mesh_legacy->vertices_[triangle(0)],
+                        mesh_legacy->vertices_[triangle(1)],
+                        mesh_legacy->vertices_[triangle(2)]);
+        EXPECT_NEAR(result[i], (p - q).norm(), 1e-5);
+    }
+    const std::vector<double> distances_legacy =
+            geometry::TriangleMeshBVH(*mesh_legacy)
+                    .ComputeDistance(pcd.ToLegacyPointCloud().points_);
+    EXPECT_TRUE(distances.AllClose(
+            core::Tensor(distances_legacy, {1000}, core::Dtype::Float64,
+                         device)
+                    .To(core::Dtype::Float32),
+            0, 1e-5));
+
+    std::tie(distances, indices) =
+            pcd.ComputeMeshDistance(t::geometry::TriangleMesh(device));
+    EXPECT_TRUE(distances.IsInf().All());
+    EXPECT_TRUE(indices.Eq(-1).All());
+}
+
+TEST_P(PointCloudPermuteDevices, RemoveHiddenPoints) {
+    core::Device device = GetParam();
+
+    // A square at depth 2 in front of a larger square at depth 3, followed by
+    // a point behind the camera and a point outside of the image.
+    std::vector<float> points;
+    for (int i = -50; i <= 50; ++i) {
+        for (int j = -50; j <= 50; ++j) {
+            points.insert(points.end(), {0.01f * i, 0.01f * j, 2.0f});
+        }
+    }
+    for (int i = -50; i <= 50; ++i) {
+        for (int j = -50; j <= 50; ++j) {
+            points.insert(points.end(), {0.02f * i, 0.02f * j, 3.0f});
+        }
+    }
+    points.insert(points.end(), {0.0f, 0.0f, -1.0f, 5.0f, 0.0f, 1.0f});
+    const int64_t n = int64_t(points.size() / 3);
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {n, 3}, core::Dtype::Float32, device));
+    core::Tensor intrinsics = core::Tensor::Init<double>(
+            {{100, 0, 50}, {0, 100, 50}, {0, 0, 1}});
+    core::Tensor extrinsics =
+            core::Tensor::Eye(4, core::Dtype::Float64, core::Device("CPU:0"));
+
+    for (int splat_radius : {0, 1}) {
+        t::geometry::PointCloud visible_pcd;
+        core::Tensor visible;
+        std::tie(visible_pcd, visible) = pcd.RemoveHiddenPoints(
+                100, 100, intrinsics, extrinsics, splat_radius);
+        EXPECT_EQ(visible.GetDevice(), device);
+        EXPECT_EQ(visible_pcd.GetPoints().GetLength(),
+                  visible.To(core::Dtype::Int64).Sum({0}).Item<int64_t>());
+
+        const std::vector<bool> result = visible.ToFlatVector<bool>();
+        for (int64_t i = 0; i < 101 * 101; ++i) {
+            EXPECT_TRUE(result[i]);
+        }
+        // The front square covers the pixels [25, 75], i.e. the back square
+        // within 0.75. Splats reach at most 6 pixels further.
+        for (int64_t i = 101 * 101; i < 2 * 101 * 101; ++i) {
+            const float x = std::abs(points[3 * i]);
+            const float y = std::abs(points[3 * i + 1]);
+            if (std::max(x, y) < 0.74f) {
+                EXPECT_FALSE(result[i]);
+            } else if (std::max(x, y) > 0.95f) {
+                EXPECT_TRUE(result[i]);
+            }
+        }
+        EXPECT_FALSE(result[n - 2]);
+        EXPECT_FALSE(result[n - 1]);
+    }
+
+    // depth_max between the squares removes the back square.
+    core::Tensor visible = std::get<1>(pcd.RemoveHiddenPoints(
+            100, 100, intrinsics, extrinsics, 1, 0.01f, /*depth_max=*/2.5f));
+    EXPECT_EQ(visible.To(core::Dtype::Int64).Sum({0}).Item<int64_t>(),
+              101 * 101);
+}
+
+TEST_P(PointCloudPermuteDevices, ProjectToRGBDImages) {
+    core::Device device = GetParam();
+
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<float> uniform(-1.0f, 1.0f);
+    std::vector<float> points(3 * 2000), colors(3 * 2000);
+    for (size_t i = 0; i < points.size(); i += 3) {
+        points[i] = uniform(rng);
+        points[i + 1] = uniform(rng);
+        points[i + 2] = 2.0f + uniform(rng);
+        colors[i] = 0.5f + 0.5f * uniform(rng);
+        colors[i + 1] = 0.5f + 0.5f * uniform(rng);
+        colors[i + 2] = 0.5f + 0.5f * uniform(rng);
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {2000, 3}, core::Dtype::Float32, device));
+    pcd.SetPointColors(
+            core::Tensor(colors, {2000, 3}, core::Dtype::Float32, device));
+    core::Tensor intrinsics = core::Tensor::Init<double>(
+            {{50, 0, 32}, {0, 50, 24}, {0, 0, 1}});
+    core::Tensor extrinsics = core::Tensor::Init<double>({{{1, 0, 0, 0},
+                                                           {0, 1, 0, 0},
+                                                           {0, 0, 1, 0},
+                                                           {0, 0, 0, 1}},
+                                                          {{1, 0, 0, 0.2},
+                                                           {0, 1, 0, -0.1},
+                                                           {0, 0, 1, 0.5},
+                                                           {0, 0, 0, 1}}});
+
+    // Without splats, the views match the single view projection, which
+    // drops the points projecting to the last row and column.
+    core::Tensor depth({2, 48, 64, 1}, core::Dtype::Float32, device);
+    core::Tensor color({2, 48, 64, 3}, core::Dtype::UInt8, device);
+    pcd.ProjectToRGBDImages(depth, color, intrinsics, extrinsics);
+    for (int64_t i = 0; i < 2; ++i) {
+        t::geometry::RGBDImage rgbd = pcd.ProjectToRGBDImage(
+                64, 48, intrinsics, extrinsics[i], 1000.0f, 3.0f);
+        EXPECT_TRUE(depth[i].Slice(0, 0, 47).Slice(1, 0, 63).AllClose(
+                rgbd.depth_.AsTensor().Slice(0, 0, 47).Slice(1, 0, 63)));
+        EXPECT_TRUE(color[i].Slice(0, 0, 47).Slice(1, 0, 63).AllClose(
+                rgbd.color_.AsTensor().Slice(0, 0, 47).Slice(1, 0, 63)));
+    }
+    core::Tensor depth_only({2, 48, 64, 1}, core::Dtype::Float32, device);
+    pcd.ProjectToDepthImages(depth_only, intrinsics, extrinsics);
+    EXPECT_TRUE(depth_only.AllClose(depth));
+
+    // A single point covers a disk of 13 pixels with a radius of 2.
+    t::geometry::PointCloud single(core::Tensor::Init<float>(
+            {{0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.004f}}, device));
+    single.ProjectToDepthImages(depth, intrinsics, extrinsics[0], 1.0f, 3.0f,
+                                2);
+    core::Tensor covered = depth.Gt(0).To(core::Dtype::Int64);
+    EXPECT_EQ(covered.Sum({0, 1, 2, 3}).Item<int64_t>(), 2 * 13);
+    EXPECT_EQ(depth[0][24][32][0].Item<float>(), 1.0f);
+
+    // The soft z-buffer averages the depths within the tolerance.
+    single.ProjectToDepthImages(depth, intrinsics, extrinsics[0], 1.0f, 3.0f,
+                                0, 0.01f);
+    EXPECT_NEAR(depth[0][24][32][0].Item<float>(), 1.002f, 1e-6);
+}
+
+TEST_P(PointCloudPermuteDevices, EstimateNormals) {
+    core::Device device = GetParam();
+
+    geometry::PointCloud pcd_legacy = *io::CreatePointCloudFromFile(
+            std::string(TEST_DATA_DIR) + "/ICP/cloud_bin_2.pcd");
+    pcd_legacy.normals_.clear();
+    pcd_legacy.colors_.clear();
+
+    // Knn, hybrid and radius search match the legacy estimation up to sign,
+    // except for points with ties in their neighborhood.
+    auto check = [&](const geometry::KDTreeSearchParam& param,
+                     utility::optional<int> max_knn,
+                     utility::optional<double> radius) {
+        geometry::PointCloud pcd_ref = pcd_legacy;
+        pcd_ref.EstimateNormals(param);
+        for (core::Dtype dtype : {core::Dtype::Float32, core::Dtype::Float64}) {
+            t::geometry::PointCloud pcd =
+                    t::geometry::PointCloud::FromLegacyPointCloud(
+                            pcd_legacy, dtype, device);
+            pcd.EstimateNormals(max_knn, radius);
+            EXPECT_TRUE(pcd.HasPointNormals());
+            EXPECT_TRUE(pcd.HasPointAttr("covariances"));
+            EXPECT_EQ(pcd.GetPointAttr("covariances").GetShape(),
+                      core::SizeVector({pcd.GetPoints().GetLength(), 3, 3}));
+
+            std::vector<double> normals =
+                    pcd.GetPointNormals()
+                            .To(core::Dtype::Float64)
+                            .ToFlatVector<double>();
+            size_t num_matches = 0;
+            for (size_t i = 0; i < pcd_ref.normals_.size(); ++i) {
+                Eigen::Vector3d normal(normals[3 * i], normals[3 * i + 1],
+                                       normals[3 * i + 2]);
+                num_matches += std::abs(normal.dot(pcd_ref.normals_[i])) > 0.99;
+            }
+            EXPECT_GT(num_matches, 0.99 * pcd_ref.normals_.size());
+        }
+    };
+    check(geometry::KDTreeSearchParamKNN(30), 30, utility::nullopt);
+    check(geometry::KDTreeSearchParamHybrid(0.05, 30), 30, 0.05);
+    check(geometry::KDTreeSearchParamRadius(0.05), utility::nullopt, 0.05);
+
+    // Normals are recomputed from the cached covariances.
+    t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    pcd_legacy, core::Dtype::Float32, device);
+    pcd.EstimateNormals(30);
+    core::Tensor normals = pcd.GetPointNormals().Clone();
+    pcd.RemovePointAttr("normals");
+    pcd.EstimateNormals(utility::nullopt, utility::nullopt);
+    EXPECT_TRUE(pcd.GetPointNormals().AllClose(normals));
+
+    // Without covariances, neither max_knn nor radius is an error.
+    pcd.RemovePointAttr("covariances");
+    EXPECT_ANY_THROW(pcd.EstimateNormals(utility::nullopt, utility::nullopt));
+}
+
+TEST_P(PointCloudPermuteDevices, EstimateColorGradients) {
+    core::Device device = GetParam();
+
+    // A planar grid with a linear intensity 0.2 + 0.3 x + 0.1 y, and an
+    // isolated point.
+    std::vector<float> points_vec, colors_vec;
+    for (int u = 0; u < 8; ++u) {
+        for (int v = 0; v < 8; ++v) {
+            const float x = 0.1f * u, y = 0.1f * v;
+            const float intensity = 0.2f + 0.3f * x + 0.1f * y;
+            points_vec.insert(points_vec.end(), {x, y, 0});
+            colors_vec.insert(colors_vec.end(),
+                              {intensity - 0.1f, intensity, intensity + 0.1f});
+        }
+    }
+    points_vec.insert(points_vec.end(), {5, 5, 5});
+    colors_vec.insert(colors_vec.end(), {1, 1, 1});
+    const int64_t n = int64_t(points_vec.size() / 3);
+
+    for (core::Dtype dtype : {core::Dtype::Float32, core::Dtype::Float64}) {
+        t::geometry::PointCloud pcd(
+                core::Tensor(points_vec, {n, 3}, core::Dtype::Float32, device)
+                        .To(dtype));
+        pcd.SetPointColors(core::Tensor(colors_vec, {n, 3},
+                                        core::Dtype::Float32, device));
+
+        // Normals are required.
+        EXPECT_ANY_THROW(pcd.EstimateColorGradients(30, 0.15));
+
+        pcd.SetPointNormals(core::Tensor::Init<float>({0, 0, 1}, device)
+                                    .To(dtype)
+                                    .Reshape({1, 3})
+                                    .Expand({n, 3})
+                                    .Contiguous());
+        pcd.EstimateColorGradients(utility::nullopt, 0.15);
+        core::Tensor gradients = pcd.GetPointAttr("color_gradients");
+        EXPECT_EQ(gradients.GetDtype(), dtype);
+        EXPECT_EQ(gradients.GetShape(), core::SizeVector({n, 3}));
+
+        core::Tensor expected =
+                core::Tensor::Init<double>({0.3, 0.1, 0}, device)
+                        .Reshape({1, 3})
+                        .Expand({n - 1, 3});
+        EXPECT_TRUE(gradients.Slice(0, 0, n - 1)
+                            .To(core::Dtype::Float64)
+                            .AllClose(expected, 1e-4, 1e-4));
+        // Points with too few neighbors get a zero gradient.
+        EXPECT_TRUE(gradients.Slice(0, n - 1, n)
+                            .To(core::Dtype::Float64)
+                            .AllClose(core::Tensor::Zeros(
+                                    {1, 3}, core::Dtype::Float64, device)));
+    }
+}
+
+TEST_P(PointCloudPermuteDevices, OrientNormals) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 2}}, device));
+    EXPECT_ANY_THROW(pcd.OrientNormalsToAlignWithDirection());
+
+    pcd.SetPointNormals(core::Tensor::Init<float>(
+            {{0, 0, 1}, {0, 0, -1}, {0, 0, 0}, {1, 0, 0}}, device));
+    pcd.OrientNormalsToAlignWithDirection(
+            core::Tensor::Init<float>({0, 0, -1}));
+    EXPECT_TRUE(pcd.GetPointNormals().AllClose(core::Tensor::Init<float>(
+            {{0, 0, -1}, {0, 0, -1}, {0, 0, -1}, {1, 0, 0}}, device)));
+
+    pcd.SetPointNormals(core::Tensor::Init<float>(
+            {{0, 0, 1}, {-1, 0, 0}, {0, 0, 0}, {0, 0, 0}}, device));
+    pcd.OrientNormalsTowardsCameraLocation(
+            core::Tensor::Init<float>({0, 0, 2}));
+    EXPECT_TRUE(pcd.GetPointNormals().AllClose(core::Tensor::Init<float>(
+            {{0, 0, 1}, {-1, 0, 0}, {0, -0.447214, 0.894427}, {0, 0, 1}},
+            device)));
+}
+
+TEST_P(PointCloudPermuteDevices, OrientNormalsConsistentTangentPlane) {
+    core::Device device = GetParam();
+
+    // Upper cap of the unit sphere, with randomly flipped outward normals.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::vector<float> points, normals;
+    while (points.size() < 3 * 2000) {
+        const Eigen::Vector3d p =
+                Eigen::Vector3d(uniform(rng), uniform(rng), uniform(rng))
+                        .normalized();
+        if (p.z() < 0.3) {
+            continue;
+        }
+        const double sign = uniform(rng) < 0 ? -1.0 : 1.0;
+        for (int c = 0; c < 3; ++c) {
+            points.push_back(float(p(c)));
+            normals.push_back(float(sign * p(c)));
+        }
+    }
+    const int64_t n = int64_t(points.size() / 3);
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {n, 3}, core::Dtype::Float32, device));
+    EXPECT_ANY_THROW(pcd.OrientNormalsConsistentTangentPlane(10));
+
+    pcd.SetPointNormals(
+            core::Tensor(normals, {n, 3}, core::Dtype::Float32, device));
+    pcd.OrientNormalsConsistentTangentPlane(10);
+    const core::Tensor dots =
+            (pcd.GetPointNormals() * pcd.GetPoints()).Sum({1});
+    EXPECT_TRUE(dots.Gt(0).All());
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -0,0 +1,156 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/RaycastingScene.h"
+
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+#include "open3d/t/geometry/TensorMap.h"
+#include "open3d/t/io/TensorMapIO.h"
+#include "tests/UnitTest.h"
+#include "tests/core/CoreTest.h"
+
+namespace open3d {
+namespace tests {
+
+class RaycastingScenePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(RaycastingScene,
+                         RaycastingScenePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// Adds a grid of 8 x 8 quads in the z = 0 plane, enough triangles for a
+// hierarchy with inner nodes and several leaves.
+static void AddGrid(t::geometry::RaycastingScene& scene) {
+    const int n = 8;
+    std::vector<float> vertices;
+    std::vector<uint32_t> triangles;
+    for (int y = 0; y <= n; ++y) {
+        for (int x = 0; x <= n; ++x) {
+            vertices.insert(vertices.end(), {float(x), float(y), 0.f});
+        }
+    }
+    for (uint32_t y = 0; y < n; ++y) {
+        for (uint32_t x = 0; x < n; ++x) {
+            const uint32_t v = y * (n + 1) + x;
+            triangles.insert(triangles.end(),
+                             {v, v + 1, v + n + 2, v, v + n + 2, v + n + 1});
+        }
+    }
+    scene.AddTriangles(
+            core::Tensor(vertices, {(n + 1) * (n + 1), 3},
+                         core::Dtype::Float32),
+            core::Tensor(triangles, {2 * n * n, 3}, core::Dtype::UInt32));
+}
+
+TEST_P(RaycastingScenePermuteDevices, LoadBVHInvalid) {
+    core::Device device = GetParam();
+    const std::string file_name = "test_bvh.o3dt";
+    const std::string invalid_file_name = "test_invalid_bvh.o3dt";
+    {
+        t::geometry::RaycastingScene scene;
+        AddGrid(scene);
+        scene.SaveBVH(file_name);
+    }
+    t::geometry::TensorMap bvh("triangle_vertices");
+    ASSERT_TRUE(t::io::ReadTensorMap(file_name, bvh));
+    const int64_t num_triangles = bvh["triangle_vertices"].GetLength();
+    const int64_t num_nodes = bvh["node_children"].GetLength();
+    ASSERT_GT(num_nodes, 1);
+
+    // The saved hierarchy loads and is queried on the device.
+    t::geometry::RaycastingScene loaded(device);
+    loaded.LoadBVH(file_name);
+    core::Tensor rays = core::Tensor::Init<float>({{0.5, 0.25, 1, 0, 0, -1},
+                                                   {-1, -1, 1, 0, 0, -1}},
+                                                  device);
+    core::Tensor t_hit = loaded.CastRays(rays)["t_hit"].To(core::Device());
+    EXPECT_FLOAT_EQ(t_hit[0].Item<float>(), 1.f);
+    EXPECT_TRUE(std::isinf(t_hit[1].Item<float>()));
+
+    // Each modification makes the file invalid.
+    std::vector<std::function<void(t::geometry::TensorMap&)>> modifications = {
+            [](t::geometry::TensorMap& tm) {
+                tm["node_bounds"] = tm["node_bounds"].To(core::Dtype::Float64);
+            },
+            [](t::geometry::TensorMap& tm) {
+                tm["node_children"] = tm["node_children"].Reshape({-1});
+            },
+            [](t::geometry::TensorMap& tm) {
+                tm["node_children"] =
+                        tm["node_children"].To(core::Dtype::Int64);
+            },
+            [](t::geometry::TensorMap& tm) {
+                tm["triangle_vertices"] =
+                        tm["triangle_vertices"].Reshape({-1, 3});
+            },
+            [&](t::geometry::TensorMap& tm) {
+                // A child index past the last node.
+                tm["node_children"][0][1] = core::Tensor::Init<int>(
+                        static_cast<int>(num_nodes));
+            },
+            [](t::geometry::TensorMap& tm) {
+                // The root as its own child, a cycle.
+                tm["node_children"][0][0] = core::Tensor::Init<int>(0);
+            },
+            [&](t::geometry::TensorMap& tm) {
+                // A leaf with triangles past the last triangle.
+                std::vector<int> children =
+                        tm["node_children"].ToFlatVector<int>();
+                int64_t leaf = 0;
+                while (children[2 * leaf] >= 0) ++leaf;
+                tm["node_children"][leaf][1] = core::Tensor::Init<int>(
+                        static_cast<int>(num_triangles + 1));
+            },
+            [&](t::geometry::TensorMap& tm) {
+                tm["triangle_geometry_ids"] =
+                        tm["triangle_geometry_ids"].Slice(0, 0,
+                                                          num_triangles - 1);
+            },
+            [&](t::geometry::TensorMap& tm) {
+                tm["triangle_primitive_ids"] =
+                        tm["triangle_primitive_ids"].Slice(0, 1,
+                                                           num_triangles);
+            },
+    };
+    for (const auto& modify : modifications) {
+        t::geometry::TensorMap invalid("triangle_vertices");
+        for (const auto& kv : bvh) {
+            invalid[kv.first] = kv.second.Clone();
+        }
+        modify(invalid);
+        ASSERT_TRUE(t::io::WriteTensorMap(invalid_file_name, invalid));
+        t::geometry::RaycastingScene scene(device);
+        EXPECT_ANY_THROW(scene.LoadBVH(invalid_file_name));
+    }
+    std::remove(file_name.c_str());
+    std::remove(invalid_file_name.c_str());
+}
+
+}  // namespace tests
+}  // namespace open3d
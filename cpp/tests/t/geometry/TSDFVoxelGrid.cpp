@@ -26,6 +26,9 @@
 
 #include "open3d/t/geometry/TSDFVoxelGrid.h"
 
+#include <algorithm>
+#include <cstdio>
+
 #include "core/CoreTest.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/Tensor.h"
@@ -34,6 +37,7 @@
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/pipelines/registration/Registration.h"
 #include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
 #include "tests/UnitTest.h"
 
@@ -115,6 +119,522 @@ TEST_P(TSDFVoxelGridPermuteDevices, Integrate) {
     }
 }
 
+TEST_P(TSDFVoxelGridPermuteDevices, ExtractUpdatedSurfaceMesh) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+
+    // Intrinsics
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    // Extrinsics
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+
+    auto integrate = [&](size_t i) {
+        t::geometry::Image depth =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/depth/{:05d}.png",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        t::geometry::Image color =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        core::Tensor extrinsic_t = core::eigen_converter::EigenMatrixToTensor(
+                trajectory->parameters_[i].extrinsic_);
+        voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t);
+    };
+
+    for (size_t i = 0; i < 3; ++i) {
+        integrate(i);
+    }
+
+    // All blocks are updated at first, which re-meshes the whole grid.
+    core::Tensor block_keys;
+    auto mesh_full = voxel_grid.ExtractSurfaceMesh(-1, 0.0f);
+    auto mesh_updated =
+            voxel_grid.ExtractUpdatedSurfaceMesh(block_keys, -1, 0.0f);
+    EXPECT_EQ(block_keys.GetLength(), voxel_grid.GetBlockHashmap()->Size());
+    EXPECT_EQ(mesh_updated.GetVertices().GetLength(),
+              mesh_full.GetVertices().GetLength());
+    EXPECT_EQ(mesh_updated.GetTriangles().GetLength(),
+              mesh_full.GetTriangles().GetLength());
+
+    // Nothing is updated without integration.
+    mesh_updated = voxel_grid.ExtractUpdatedSurfaceMesh(block_keys, -1, 0.0f);
+    EXPECT_EQ(block_keys.GetLength(), 0);
+    EXPECT_EQ(mesh_updated.GetTriangles().GetLength(), 0);
+
+    // Only the integrated blocks and their neighbors are re-meshed, and the
+    // triangles are grouped by block.
+    integrate(3);
+    mesh_updated = voxel_grid.ExtractUpdatedSurfaceMesh(block_keys, -1, 0.0f);
+    EXPECT_GT(block_keys.GetLength(), 0);
+    EXPECT_LE(block_keys.GetLength(), voxel_grid.GetBlockHashmap()->Size());
+    core::Tensor block_ids =
+            mesh_updated.GetTriangleAttr("block_ids").To(core::Device("CPU:0"));
+    EXPECT_EQ(block_ids.GetLength(), mesh_updated.GetTriangles().GetLength());
+    std::vector<int64_t> block_ids_vec = block_ids.ToFlatVector<int64_t>();
+    EXPECT_TRUE(std::is_sorted(block_ids_vec.begin(), block_ids_vec.end()));
+    for (int64_t block_id : block_ids_vec) {
+        EXPECT_GE(block_id, 0);
+        EXPECT_LT(block_id, block_keys.GetLength());
+    }
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, FrustumBlockCache) {
+    core::Device device = GetParam();
+
+    float voxel_size = 0.008;
+    auto make_voxel_grid = [&]() {
+        return t::geometry::TSDFVoxelGrid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device);
+    };
+
+    // Intrinsics
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    // Extrinsics
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+    core::Tensor extrinsic_t = core::eigen_converter::EigenMatrixToTensor(
+            trajectory->parameters_[0].extrinsic_);
+
+    t::geometry::Image depth =
+            t::io::CreateImageFromFile(fmt::format("{}/RGBD/depth/{:05d}.png",
+                                                   std::string(TEST_DATA_DIR),
+                                                   0))
+                    ->To(device);
+    t::geometry::Image color =
+            t::io::CreateImageFromFile(fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                                   std::string(TEST_DATA_DIR),
+                                                   0))
+                    ->To(device);
+
+    // Integrating a static camera with the cache, or into precomputed blocks,
+    // is the same as recomputing the blocks every frame.
+    auto voxel_grid = make_voxel_grid();
+    auto voxel_grid_cached = make_voxel_grid();
+    voxel_grid_cached.SetFrustumBlockCache(0.01f, 0.01f);
+    auto voxel_grid_blocks = make_voxel_grid();
+    core::Tensor block_coords = voxel_grid_blocks.GetFrustumBlockCoords(
+            depth, intrinsic_t, extrinsic_t);
+    for (int i = 0; i < 3; ++i) {
+        voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t);
+        voxel_grid_cached.Integrate(depth, color, intrinsic_t, extrinsic_t);
+        voxel_grid_blocks.IntegrateBlocks(block_coords, depth, color,
+                                          intrinsic_t, extrinsic_t);
+    }
+
+    auto count_points = [](t::geometry::TSDFVoxelGrid& grid) {
+        return grid.ExtractSurfacePoints(-1, 0.0f).GetPoints().GetLength();
+    };
+    int64_t num_points = count_points(voxel_grid);
+    EXPECT_GT(num_points, 0);
+    EXPECT_EQ(voxel_grid_cached.GetBlockHashmap()->Size(),
+              voxel_grid.GetBlockHashmap()->Size());
+    EXPECT_EQ(count_points(voxel_grid_cached), num_points);
+    EXPECT_EQ(voxel_grid_blocks.GetBlockHashmap()->Size(),
+              voxel_grid.GetBlockHashmap()->Size());
+    EXPECT_EQ(count_points(voxel_grid_blocks), num_points);
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, QuantizedVoxels) {
+    core::Device device = GetParam();
+
+    // Intrinsics
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    // Extrinsics
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+
+    float voxel_size = 0.008;
+    auto integrate = [&](const std::unordered_map<std::string, core::Dtype>&
+                                 attr_dtype_map) {
+        t::geometry::TSDFVoxelGrid voxel_grid(attr_dtype_map, voxel_size,
+                                              0.04f, 16, 1000, device);
+        for (size_t i = 0; i < 5; ++i) {
+            t::geometry::Image depth =
+                    t::io::CreateImageFromFile(
+                            fmt::format("{}/RGBD/depth/{:05d}.png",
+                                        std::string(TEST_DATA_DIR), i))
+                            ->To(device);
+            t::geometry::Image color =
+                    t::io::CreateImageFromFile(
+                            fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                        std::string(TEST_DATA_DIR), i))
+                            ->To(device);
+            core::Tensor extrinsic_t =
+                    core::eigen_converter::EigenMatrixToTensor(
+                            trajectory->parameters_[i].extrinsic_);
+            voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t);
+        }
+        return voxel_grid;
+    };
+
+    auto voxel_grid = integrate({{"tsdf", core::Dtype::Float32},
+                                 {"weight", core::Dtype::Float32},
+                                 {"color", core::Dtype::Float32}});
+    auto pcd = voxel_grid.ExtractSurfacePoints(-1, 1.0f).ToLegacyPointCloud();
+
+    std::vector<std::unordered_map<std::string, core::Dtype>> attr_dtype_maps =
+            {{{"tsdf", core::Dtype::Int16},
+              {"weight", core::Dtype::UInt16},
+              {"color", core::Dtype::UInt16}},
+             {{"tsdf", core::Dtype::Int8},
+              {"weight", core::Dtype::UInt8},
+              {"color", core::Dtype::UInt8}},
+             {{"tsdf", core::Dtype::Int16}, {"weight", core::Dtype::UInt16}},
+             {{"tsdf", core::Dtype::Int8}, {"weight", core::Dtype::UInt8}}};
+    std::vector<int64_t> voxel_bytes = {10, 5, 4, 2};
+    for (size_t k = 0; k < attr_dtype_maps.size(); ++k) {
+        auto voxel_grid_q = integrate(attr_dtype_maps[k]);
+        EXPECT_EQ(voxel_grid_q.GetBlockHashmap()->GetValueTensor().GetShape(4),
+                  voxel_bytes[k]);
+
+        // The surfaces agree up to the quantization of the TSDF.
+        auto pcd_q = voxel_grid_q.ExtractSurfacePoints(-1, 1.0f)
+                             .ToLegacyPointCloud();
+        auto result = pipelines::registration::EvaluateRegistration(
+                pcd_q, pcd, voxel_size);
+        EXPECT_GT(result.fitness_, 0.95);
+        EXPECT_LT(result.inlier_rmse_, 0.25 * voxel_size);
+        EXPECT_EQ(pcd_q.HasColors(), attr_dtype_maps[k].count("color") != 0);
+    }
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, SaveLoadAndOffload) {
+    core::Device device = GetParam();
+
+    // Intrinsics
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    // Extrinsics
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+    core::Tensor extrinsic_t = core::eigen_converter::EigenMatrixToTensor(
+            trajectory->parameters_[0].extrinsic_);
+
+    t::geometry::Image depth =
+            t::io::CreateImageFromFile(fmt::format("{}/RGBD/depth/{:05d}.png",
+                                                   std::string(TEST_DATA_DIR),
+                                                   0))
+                    ->To(device);
+    t::geometry::Image color =
+            t::io::CreateImageFromFile(fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                                   std::string(TEST_DATA_DIR),
+                                                   0))
+                    ->To(device);
+
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          0.008f, 0.04f, 16, 1000, device);
+    voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t);
+    int64_t num_blocks = voxel_grid.GetBlockHashmap()->Size();
+    int64_t num_points =
+            voxel_grid.ExtractSurfacePoints(-1, 0.0f).GetPoints().GetLength();
+    EXPECT_GT(num_points, 0);
+
+    // Save and load.
+    const std::string file_name = "test_tsdf_voxel_grid.o3dt";
+    voxel_grid.Save(file_name);
+    t::geometry::TSDFVoxelGrid loaded_voxel_grid =
+            t::geometry::TSDFVoxelGrid::Load(file_name, device);
+    EXPECT_EQ(loaded_voxel_grid.GetBlockHashmap()->Size(), num_blocks);
+    EXPECT_EQ(loaded_voxel_grid.ExtractSurfacePoints(-1, 0.0f)
+                      .GetPoints()
+                      .GetLength(),
+              num_points);
+    std::remove(file_name.c_str());
+
+    // Offload to host memory and to disk, then reload.
+    const std::string directory = "test_tsdf_voxel_grid_blocks";
+    for (const std::string& offload_directory : {std::string(), directory}) {
+        // A radius of 1m around the camera keeps only the near blocks.
+        int64_t num_offloaded =
+                voxel_grid.OffloadBlocks(extrinsic_t, 1.0f, offload_directory);
+        EXPECT_GT(num_offloaded, 0);
+        EXPECT_EQ(voxel_grid.GetOffloadedBlockCount(), num_offloaded);
+        EXPECT_EQ(voxel_grid.GetBlockHashmap()->Size() + num_offloaded,
+                  num_blocks);
+
+        // Offloaded blocks are saved too.
+        voxel_grid.Save(file_name);
+        EXPECT_EQ(t::geometry::TSDFVoxelGrid::Load(file_name, device)
+                          .GetBlockHashmap()
+                          ->Size(),
+                  num_blocks);
+        std::remove(file_name.c_str());
+
+        EXPECT_EQ(voxel_grid.ReloadBlocks(extrinsic_t, 100.0f), num_offloaded);
+        EXPECT_EQ(voxel_grid.GetOffloadedBlockCount(), 0);
+        EXPECT_EQ(voxel_grid.GetBlockHashmap()->Size(), num_blocks);
+        EXPECT_EQ(voxel_grid.ExtractSurfacePoints(-1, 0.0f)
+                          .GetPoints()
+                          .GetLength(),
+                  num_points);
+    }
+    std::vector<std::string> block_files;
+    utility::filesystem::ListFilesInDirectory(directory, block_files);
+    for (const std::string& block_file : block_files) {
+        utility::filesystem::RemoveFile(block_file);
+    }
+    utility::filesystem::DeleteDirectory(directory);
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, RayCastDepth) {
+    core::Device device = GetParam();
+    core::HashmapBackend backend =
+            device.GetType() == core::Device::DeviceType::CUDA
+                    ? core::HashmapBackend::StdGPU
+                    : core::HashmapBackend::TBB;
+
+    // Intrinsics
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    // Extrinsics
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+    core::Tensor extrinsic_t = core::eigen_converter::EigenMatrixToTensor(
+            trajectory->parameters_[0].extrinsic_);
+
+    t::geometry::Image depth =
+            t::io::CreateImageFromFile(fmt::format("{}/RGBD/depth/{:05d}.png",
+                                                   std::string(TEST_DATA_DIR),
+                                                   0))
+                    ->To(device);
+    t::geometry::Image color =
+            t::io::CreateImageFromFile(fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                                   std::string(TEST_DATA_DIR),
+                                                   0))
+                    ->To(device);
+
+    float voxel_size = 0.008f;
+    float depth_scale = 1000.0f;
+    float depth_max = 3.0f;
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          voxel_size, 0.04f, 16, 1000, device,
+                                          backend);
+    voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t, depth_scale,
+                         depth_max);
+
+    // Rays skipping empty blocks still stop at the integrated surface.
+    using MaskCode = t::geometry::TSDFVoxelGrid::SurfaceMaskCode;
+    auto result = voxel_grid.RayCast(intrinsic_t, extrinsic_t, depth.GetCols(),
+                                     depth.GetRows(), depth_scale, 0.1f,
+                                     depth_max, 1.0f, MaskCode::DepthMap);
+    core::Device host("CPU:0");
+    core::Tensor depth_raycast =
+            result[MaskCode::DepthMap].To(host).View({-1});
+    core::Tensor depth_input = depth.AsTensor()
+                                       .To(host, core::Dtype::Float32)
+                                       .View({-1});
+    core::Tensor valid = depth_raycast.Gt(0).LogicalAnd(depth_input.Gt(0));
+    int64_t num_valid = valid.To(core::Dtype::Int64).Sum({0}).Item<int64_t>();
+    EXPECT_GT(num_valid, depth_input.GetLength() / 2);
+
+    core::Tensor diff = (depth_raycast.IndexGet({valid}) -
+                         depth_input.IndexGet({valid}))
+                                .Abs();
+    int64_t num_close = diff.Le(2 * voxel_size * depth_scale)
+                                .To(core::Dtype::Int64)
+                                .Sum({0})
+                                .Item<int64_t>();
+    EXPECT_GT(num_close, 0.95 * num_valid);
+
+    // Ray casting into the maps of a previous call reuses their buffers.
+    core::Tensor depth_buffer = result[MaskCode::DepthMap];
+    depth_buffer.Fill(0);
+    voxel_grid.RayCast(result, intrinsic_t, extrinsic_t, depth.GetCols(),
+                       depth.GetRows(), depth_scale, 0.1f, depth_max, 1.0f,
+                       MaskCode::DepthMap);
+    EXPECT_EQ(result[MaskCode::DepthMap].GetDataPtr(),
+              depth_buffer.GetDataPtr());
+    EXPECT_TRUE(depth_buffer.To(host).View({-1}).AllClose(depth_raycast));
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, RayCastBatch) {
+    core::Device device = GetParam();
+    core::HashmapBackend backend =
+            device.GetType() == core::Device::DeviceType::CUDA
+                    ? core::HashmapBackend::StdGPU
+                    : core::HashmapBackend::TBB;
+
+    // Intrinsics
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    // Extrinsics
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          0.008f, 0.04f, 16, 1000, device,
+                                          backend);
+    const int64_t n_views = 3;
+    core::Tensor extrinsics({n_views, 4, 4}, core::Dtype::Float64);
+    for (int64_t i = 0; i < n_views; ++i) {
+        t::geometry::Image depth =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/depth/{:05d}.png",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        t::geometry::Image color =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        extrinsics[i] = core::eigen_converter::EigenMatrixToTensor(
+                trajectory->parameters_[i].extrinsic_);
+        voxel_grid.Integrate(depth, color, intrinsic_t, extrinsics[i]);
+    }
+
+    // A batch renders the same maps as one view at a time.
+    using MaskCode = t::geometry::TSDFVoxelGrid::SurfaceMaskCode;
+    int mask = MaskCode::DepthMap | MaskCode::VertexMap;
+    auto batch_result = voxel_grid.RayCastBatch(
+            intrinsic_t, extrinsics, 640, 480, 1000.0f, 0.1f, 3.0f, 1.0f, mask);
+    EXPECT_EQ(batch_result[MaskCode::DepthMap].GetShape(),
+              core::SizeVector({n_views, 480, 640, 1}));
+    for (int64_t i = 0; i < n_views; ++i) {
+        auto result = voxel_grid.RayCast(intrinsic_t, extrinsics[i], 640, 480,
+                                         1000.0f, 0.1f, 3.0f, 1.0f, mask);
+        for (MaskCode code : {MaskCode::DepthMap, MaskCode::VertexMap}) {
+            EXPECT_TRUE(batch_result[code][i].AllClose(result[code]));
+        }
+    }
+}
+
+TEST_P(TSDFVoxelGridPermuteDevices, RayCastGraphCapture) {
+    core::Device device = GetParam();
+    core::HashmapBackend backend =
+            device.GetType() == core::Device::DeviceType::CUDA
+                    ? core::HashmapBackend::StdGPU
+                    : core::HashmapBackend::TBB;
+
+    // Intrinsics
+    camera::PinholeCameraIntrinsic intrinsic = camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto focal_length = intrinsic.GetFocalLength();
+    auto principal_point = intrinsic.GetPrincipalPoint();
+    core::Tensor intrinsic_t = core::Tensor::Init<double>(
+            {{focal_length.first, 0, principal_point.first},
+             {0, focal_length.second, principal_point.second},
+             {0, 0, 1}});
+
+    // Extrinsics
+    std::string trajectory_path =
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log";
+    auto trajectory =
+            io::CreatePinholeCameraTrajectoryFromFile(trajectory_path);
+
+    t::geometry::TSDFVoxelGrid voxel_grid({{"tsdf", core::Dtype::Float32},
+                                           {"weight", core::Dtype::UInt16},
+                                           {"color", core::Dtype::UInt16}},
+                                          0.008f, 0.04f, 16, 1000, device,
+                                          backend);
+
+    // Ray casting with a graph renders the same maps as without, also when
+    // the blocks change between the calls.
+    using MaskCode = t::geometry::TSDFVoxelGrid::SurfaceMaskCode;
+    int mask = MaskCode::DepthMap | MaskCode::VertexMap;
+    for (int i = 0; i < 3; ++i) {
+        t::geometry::Image depth =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/depth/{:05d}.png",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        t::geometry::Image color =
+                t::io::CreateImageFromFile(
+                        fmt::format("{}/RGBD/color/{:05d}.jpg",
+                                    std::string(TEST_DATA_DIR), i))
+                        ->To(device);
+        core::Tensor extrinsic_t = core::eigen_converter::EigenMatrixToTensor(
+                trajectory->parameters_[i].extrinsic_);
+        voxel_grid.Integrate(depth, color, intrinsic_t, extrinsic_t);
+
+        voxel_grid.SetRayCastGraphCapture(false);
+        auto result = voxel_grid.RayCast(intrinsic_t, extrinsic_t, 640, 480,
+                                         1000.0f, 0.1f, 3.0f, 1.0f, mask);
+        voxel_grid.SetRayCastGraphCapture(true);
+        for (int j = 0; j < 2; ++j) {
+            auto graph_result =
+                    voxel_grid.RayCast(intrinsic_t, extrinsic_t, 640, 480,
+                                       1000.0f, 0.1f, 3.0f, 1.0f, mask);
+            for (MaskCode code : {MaskCode::DepthMap, MaskCode::VertexMap}) {
+                EXPECT_TRUE(graph_result[code].AllClose(result[code]));
+            }
+        }
+    }
+}
+
 TEST_P(TSDFVoxelGridPermuteDevices, DISABLED_Raycast) {
     core::Device device = GetParam();
     std::vector<core::HashmapBackend> backends;
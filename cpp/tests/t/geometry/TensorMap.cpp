@@ -113,5 +113,56 @@ TEST_P(TensorMapPermuteDevices, Contains) {
     EXPECT_FALSE(tm.Contains("normals"));
 }
 
+TEST_P(TensorMapPermuteDevices, ToAsync) {
+    core::Dtype dtype = core::Dtype::Float32;
+    core::Device device = GetParam();
+
+    t::geometry::TensorMap tm(
+            "points", {{"points", core::Tensor::Zeros({5, 3}, dtype)},
+                       {"colors", core::Tensor::Ones({5, 3}, dtype)}});
+    t::geometry::TensorMap tm_device = tm.ToAsync(device).get();
+    EXPECT_EQ(tm_device.GetPrimaryKey(), "points");
+    EXPECT_TRUE(tm_device.Contains("colors"));
+    EXPECT_EQ(tm_device["points"].GetDevice(), device);
+    EXPECT_TRUE(tm_device["colors"].AllClose(tm["colors"].To(device)));
+    EXPECT_TRUE(tm.To(core::Device("CPU:0"))["points"].IsSame(tm["points"]));
+}
+
+TEST_P(TensorMapPermuteDevices, Pack) {
+    core::Device device = GetParam();
+
+    t::geometry::TensorMap tm(
+            "points",
+            {{"points", core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}})},
+             {"labels", core::Tensor::Init<uint8_t>({7, 9})}});
+    EXPECT_FALSE(tm.IsPacked());
+
+    t::geometry::TensorMap tm_packed = tm.Pack();
+    EXPECT_TRUE(tm_packed.IsPacked());
+    EXPECT_EQ(tm_packed.GetPrimaryKey(), "points");
+    EXPECT_EQ(tm_packed["points"].GetBlob(), tm_packed["labels"].GetBlob());
+    EXPECT_TRUE(tm_packed["points"].AllClose(tm["points"]));
+    EXPECT_TRUE(tm_packed["labels"].AllClose(tm["labels"]));
+
+    // The packed allocation is transferred at once and stays packed.
+    t::geometry::TensorMap tm_device = tm_packed.To(device, /*copy=*/true);
+    EXPECT_TRUE(tm_device.IsPacked());
+    EXPECT_EQ(tm_device["labels"].GetDevice(), device);
+    EXPECT_NE(tm_device["points"].GetBlob(), tm_packed["points"].GetBlob());
+    EXPECT_TRUE(tm_device["points"].AllClose(tm["points"].To(device)));
+    EXPECT_TRUE(tm_device["labels"].AllClose(tm["labels"].To(device)));
+
+    // Replacing a tensor unpacks the map.
+    tm_device["labels"] = tm_device["labels"].Clone();
+    EXPECT_FALSE(tm_device.IsPacked());
+
+    // Slices of a larger tensor are not packed.
+    core::Tensor large = core::Tensor::Zeros({100, 3}, core::Dtype::Float32);
+    t::geometry::TensorMap tm_slices(
+            "points", {{"points", large.Slice(0, 0, 2)},
+                       {"normals", large.Slice(0, 98, 100)}});
+    EXPECT_FALSE(tm_slices.IsPacked());
+}
+
 }  // namespace tests
 }  // namespace open3d
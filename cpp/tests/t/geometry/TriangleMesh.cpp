@@ -27,6 +27,7 @@
 #include "open3d/t/geometry/TriangleMesh.h"
 
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/TensorList.h"
 #include "tests/UnitTest.h"
 
@@ -300,5 +301,273 @@ TEST_P(TriangleMeshPermuteDevices, ToLegacyTriangleMesh) {
                       {Eigen::Vector3d(4, 4, 4), Eigen::Vector3d(4, 4, 4)}));
 }
 
+TEST_P(TriangleMeshPermuteDevices, Transform) {
+    core::Device device = GetParam();
+
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<float>({{0, 0, 0}, {1, 0, 0}, {0, 1, 0}},
+                                      device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}}, device));
+    mesh.ComputeVertexNormals().ComputeTriangleNormals();
+    EXPECT_TRUE(mesh.GetMinBound().AllClose(
+            core::Tensor::Init<float>({0, 0, 0}, device)));
+    EXPECT_TRUE(mesh.GetMaxBound().AllClose(
+            core::Tensor::Init<float>({1, 1, 0}, device)));
+
+    // Rotation of pi / 2 around x, then a translation.
+    core::Tensor transformation = core::Tensor::Init<float>(
+            {{1, 0, 0, 1}, {0, 0, -1, 2}, {0, 1, 0, 3}, {0, 0, 0, 1}}, device);
+    mesh.Transform(transformation);
+    EXPECT_TRUE(mesh.GetVertices().AllClose(core::Tensor::Init<float>(
+            {{1, 2, 3}, {2, 2, 3}, {1, 2, 4}}, device)));
+    EXPECT_TRUE(mesh.GetVertexNormals().AllClose(core::Tensor::Init<float>(
+            {{0, -1, 0}, {0, -1, 0}, {0, -1, 0}}, device)));
+    EXPECT_TRUE(mesh.GetTriangleNormals().AllClose(
+            core::Tensor::Init<float>({{0, -1, 0}}, device)));
+
+    mesh.Scale(2, core::Tensor::Init<float>({1, 2, 3}, device));
+    mesh.Translate(core::Tensor::Init<float>({0, 0, 0}, device),
+                   /*relative=*/false);
+    EXPECT_TRUE(mesh.GetCenter().AllClose(
+            core::Tensor::Init<float>({0, 0, 0}, device), 1e-6, 1e-6));
+    EXPECT_NEAR(mesh.GetSurfaceArea(), 2, 1e-6);
+}
+
+TEST_P(TriangleMeshPermuteDevices, ComputeNormals) {
+    core::Device device = GetParam();
+
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *legacy_mesh, core::Dtype::Float64, core::Dtype::Int32,
+                    device);
+    legacy_mesh->ComputeVertexNormals();
+    mesh.ComputeVertexNormals().ComputeTriangleNormals();
+
+    EXPECT_TRUE(mesh.GetVertexNormals().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy_mesh->vertex_normals_, core::Dtype::Float64,
+                    device)));
+    EXPECT_TRUE(mesh.GetTriangleNormals().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy_mesh->triangle_normals_, core::Dtype::Float64,
+                    device)));
+    EXPECT_NEAR(mesh.GetSurfaceArea(), legacy_mesh->GetSurfaceArea(), 1e-9);
+}
+
+TEST_P(TriangleMeshPermuteDevices, SamplePointsUniformly) {
+    core::Device device = GetParam();
+
+    // The unit square in the z = 0 plane.
+    t::geometry::TriangleMesh mesh(
+            core::Tensor::Init<float>(
+                    {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}}, device),
+            core::Tensor::Init<int64_t>({{0, 1, 2}, {0, 2, 3}}, device));
+    mesh.SetVertexColors(core::Tensor::Init<float>(
+            {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}}, device));
+
+    t::geometry::PointCloud pcd = mesh.SamplePointsUniformly(
+            1000, /*use_triangle_normal=*/true, /*seed=*/42);
+    const core::Tensor &points = pcd.GetPoints();
+    EXPECT_EQ(points.GetShape(), core::SizeVector({1000, 3}));
+    EXPECT_EQ(points.GetDevice(), device);
+    EXPECT_TRUE(points.Slice(1, 2, 3).AllClose(
+            core::Tensor::Zeros({1000, 1}, core::Dtype::Float32, device)));
+    EXPECT_GE(points.Min({0, 1}).Item<float>(), 0);
+    EXPECT_LE(points.Max({0, 1}).Item<float>(), 1);
+    // The colors are the interpolated positions.
+    EXPECT_TRUE(pcd.GetPointColors().AllClose(points, 1e-5, 1e-5));
+    EXPECT_TRUE(pcd.GetPointNormals().AllClose(
+            core::Tensor::Init<float>({0, 0, 1}, device)
+                    .Reshape({1, 3})
+                    .Expand({1000, 3})));
+    // About half of the points are in each triangle.
+    const int64_t num_lower =
+            (points.Slice(1, 0, 1) > points.Slice(1, 1, 2))
+                    .To(core::Dtype::Int64)
+                    .Sum({0, 1})
+                    .Item<int64_t>();
+    EXPECT_GT(num_lower, 400);
+    EXPECT_LT(num_lower, 600);
+
+    // The samples of a seed do not depend on the device.
+    t::geometry::PointCloud pcd_cpu =
+            mesh.CPU().SamplePointsUniformly(1000, false, 42);
+    EXPECT_TRUE(pcd_cpu.GetPoints().AllClose(points.To(core::Device("CPU:0"))));
+    EXPECT_FALSE(pcd_cpu.HasPointNormals());
+}
+
+TEST_P(TriangleMeshPermuteDevices, SimplifyVertexClustering) {
+    core::Device device = GetParam();
+
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    legacy_mesh->ComputeVertexNormals();
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *legacy_mesh, core::Dtype::Float64, core::Dtype::Int64,
+                    device);
+
+    for (auto contraction :
+         {geometry::MeshBase::SimplificationContraction::Average,
+          geometry::MeshBase::SimplificationContraction::Quadric}) {
+        auto legacy_simplified =
+                legacy_mesh->SimplifyVertexClustering(0.3, contraction);
+        t::geometry::TriangleMesh simplified =
+                mesh.SimplifyVertexClustering(0.3, contraction);
+
+        EXPECT_EQ(simplified.GetVertices().GetLength(),
+                  int64_t(legacy_simplified->vertices_.size()));
+        EXPECT_EQ(simplified.GetTriangles().GetLength(),
+                  int64_t(legacy_simplified->triangles_.size()));
+        EXPECT_EQ(simplified.GetVertexNormals().GetLength(),
+                  simplified.GetVertices().GetLength());
+        EXPECT_NEAR(simplified.GetSurfaceArea(),
+                    legacy_simplified->GetSurfaceArea(), 1e-6);
+        const Eigen::Vector3d min_bound = legacy_simplified->GetMinBound();
+        EXPECT_TRUE(simplified.GetMinBound().AllClose(
+                core::Tensor::Init<double>(
+                        {min_bound(0), min_bound(1), min_bound(2)}, device)));
+    }
+}
+
+TEST_P(TriangleMeshPermuteDevices, FilterSmooth) {
+    core::Device device = GetParam();
+
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    legacy_mesh->ComputeVertexNormals();
+    legacy_mesh->PaintUniformColor(Eigen::Vector3d(0.2, 0.4, 0.6));
+    for (size_t i = 0; i < legacy_mesh->vertices_.size(); i += 3) {
+        legacy_mesh->vertices_[i] *= 1.1;
+    }
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *legacy_mesh, core::Dtype::Float64, core::Dtype::Int64,
+                    device);
+
+    auto expect_eq = [](const t::geometry::TriangleMesh &filtered,
+                        const geometry::TriangleMesh &legacy_filtered) {
+        geometry::TriangleMesh result = filtered.ToLegacyTriangleMesh();
+        ExpectEQ(result.vertices_, legacy_filtered.vertices_, 1e-10);
+        ExpectEQ(result.vertex_normals_, legacy_filtered.vertex_normals_,
+                 1e-10);
+        ExpectEQ(result.vertex_colors_, legacy_filtered.vertex_colors_, 1e-10);
+        ExpectEQ(result.triangles_, legacy_filtered.triangles_);
+    };
+    expect_eq(mesh.FilterSmoothLaplacian(3, 0.5),
+              *legacy_mesh->FilterSmoothLaplacian(3, 0.5));
+    expect_eq(mesh.FilterSmoothTaubin(3), *legacy_mesh->FilterSmoothTaubin(3));
+
+    // The legacy mesh does not keep unfiltered attributes, so only the
+    // normals are compared.
+    t::geometry::TriangleMesh filtered = mesh.FilterSmoothLaplacian(
+            1, 0.3, geometry::MeshBase::FilterScope::Normal);
+    auto legacy_filtered = legacy_mesh->FilterSmoothLaplacian(
+            1, 0.3, geometry::MeshBase::FilterScope::Normal);
+    ExpectEQ(filtered.ToLegacyTriangleMesh().vertex_normals_,
+             legacy_filtered->vertex_normals_, 1e-10);
+    EXPECT_TRUE(filtered.GetVertices().AllClose(mesh.GetVertices()));
+    EXPECT_TRUE(filtered.GetVertexColors().AllClose(mesh.GetVertexColors()));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SubdivideLoop) {
+    core::Device device = GetParam();
+
+    // Open mesh, so that both boundary and interior rules are used.
+    auto legacy_mesh = geometry::TriangleMesh::CreateSphere(1.0, 6);
+    legacy_mesh->RemoveTrianglesByIndex({0, 1, 2});
+    legacy_mesh->PaintUniformColor(Eigen::Vector3d(0.2, 0.4, 0.6));
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacyTriangleMesh(
+                    *legacy_mesh, core::Dtype::Float64, core::Dtype::Int64,
+                    device);
+    mesh.SetTriangleAttr(
+            "labels", core::Tensor::Arange(0, mesh.GetTriangles().GetLength(),
+                                           1, core::Dtype::Int64, device));
+
+    auto legacy_subdivided = legacy_mesh->SubdivideLoop(2);
+    t::geometry::TriangleMesh subdivided = mesh.SubdivideLoop(2);
+    const int64_t num_vertices = subdivided.GetVertices().GetLength();
+    ASSERT_EQ(num_vertices, int64_t(legacy_subdivided->vertices_.size()));
+    EXPECT_EQ(subdivided.GetTriangles().GetLength(),
+              int64_t(legacy_subdivided->triangles_.size()));
+    EXPECT_NEAR(subdivided.GetSurfaceArea(),
+                legacy_subdivided->GetSurfaceArea(), 1e-10);
+    EXPECT_TRUE(subdivided.GetVertexColors().AllClose(
+            core::Tensor::Init<double>({{0.2, 0.4, 0.6}}, device)
+                    .Expand({num_vertices, 3})));
+    EXPECT_TRUE(subdivided.GetTriangleAttr("labels").Eq(
+            core::Tensor::Arange(0, subdivided.GetTriangles().GetLength(), 1,
+                                 core::Dtype::Int64, device)
+                    .Div(16)).All());
+
+    // The new vertices are numbered differently, but are at the same
+    // positions.
+    const geometry::TriangleMesh result = subdivided.ToLegacyTriangleMesh();
+    for (const Eigen::Vector3d &vertex : result.vertices_) {
+        double min_distance = std::numeric_limits<double>::max();
+        for (const Eigen::Vector3d &legacy_vertex :
+             legacy_subdivided->vertices_) {
+            min_distance =
+                    std::min(min_distance, (vertex - legacy_vertex).norm());
+        }
+        EXPECT_LT(min_distance, 1e-10);
+    }
+}
+
+TEST_P(TriangleMeshPermuteDevices, CreateIsosurface) {
+    core::Device device = GetParam();
+
+    // Signed distances of a sphere of radius 0.55 on a grid over [-1, 1]^3,
+    // with spacing 0.1 so that no grid point is on the sphere.
+    const int64_t n = 21;
+    const double radius = 0.55;
+    std::vector<float> values;
+    for (int64_t z = 0; z < n; ++z) {
+        for (int64_t y = 0; y < n; ++y) {
+            for (int64_t x = 0; x < n; ++x) {
+                Eigen::Vector3d p(x, y, z);
+                p = p * 2.0 / double(n - 1) - Eigen::Vector3d::Ones();
+                values.push_back(float(p.norm() - radius));
+            }
+        }
+    }
+    core::Tensor grid(values, {n, n, n}, core::Dtype::Float32, device);
+    core::Tensor min_bound = core::Tensor::Init<float>({-1, -1, -1}, device);
+    core::Tensor max_bound = core::Tensor::Init<float>({1, 1, 1}, device);
+
+    t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::CreateIsosurface(grid, min_bound,
+                                                        max_bound);
+    EXPECT_EQ(mesh.GetDevice(), device);
+    EXPECT_GT(mesh.GetTriangles().GetLength(), 0);
+
+    // The vertices are on the sphere, up to the linear interpolation error.
+    core::Tensor norms = (mesh.GetVertices() * mesh.GetVertices())
+                                 .Sum({1})
+                                 .Sqrt();
+    EXPECT_TRUE(norms.AllClose(
+            core::Tensor::Full(norms.GetShape(), radius, core::Dtype::Float32,
+                               device),
+            0, 0.02));
+
+    // The vertices are shared, so that the mesh is closed, and the normals
+    // point outwards.
+    EXPECT_TRUE(mesh.ToLegacyTriangleMesh().IsWatertight());
+    mesh.ComputeVertexNormals();
+    EXPECT_TRUE((mesh.GetVertexNormals() * mesh.GetVertices())
+                        .Sum({1})
+                        .Gt(0)
+                        .All());
+    const double area = 4 * M_PI * radius * radius;
+    EXPECT_NEAR(mesh.GetSurfaceArea(), area, 0.05 * area);
+
+    // Grids without the iso value give empty meshes.
+    t::geometry::TriangleMesh empty =
+            t::geometry::TriangleMesh::CreateIsosurface(grid, min_bound,
+                                                        max_bound, 10.0);
+    EXPECT_EQ(empty.GetVertices().GetLength(), 0);
+    EXPECT_EQ(empty.GetTriangles().GetLength(), 0);
+}
+
 }  // namespace tests
 }  // namespace open3d
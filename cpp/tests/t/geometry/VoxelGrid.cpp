@@ -0,0 +1,173 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/VoxelGrid.h"
+
+#include <map>
+#include <tuple>
+
+#include "core/CoreTest.h"
+#include "open3d/camera/PinholeCameraParameters.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/Image.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class VoxelGridPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(VoxelGrid,
+                         VoxelGridPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+/// Expects both voxel grids to hold the same voxels and colors.
+static void ExpectEqualVoxels(const geometry::VoxelGrid &voxel_grid,
+                              const geometry::VoxelGrid &voxel_grid_ref) {
+    using Index = std::tuple<int, int, int>;
+    auto to_map = [](const geometry::VoxelGrid &grid) {
+        std::map<Index, Eigen::Vector3d> voxels;
+        for (const auto &kv : grid.voxels_) {
+            voxels[Index(kv.first(0), kv.first(1), kv.first(2))] =
+                    kv.second.color_;
+        }
+        return voxels;
+    };
+    std::map<Index, Eigen::Vector3d> voxels = to_map(voxel_grid);
+    std::map<Index, Eigen::Vector3d> voxels_ref = to_map(voxel_grid_ref);
+    ASSERT_EQ(voxels.size(), voxels_ref.size());
+    for (const auto &kv : voxels_ref) {
+        auto it = voxels.find(kv.first);
+        ASSERT_TRUE(it != voxels.end());
+        ExpectEQ(it->second, kv.second, 1e-6);
+    }
+    ExpectEQ(voxel_grid.origin_, voxel_grid_ref.origin_);
+    EXPECT_DOUBLE_EQ(voxel_grid.voxel_size_, voxel_grid_ref.voxel_size_);
+}
+
+TEST_P(VoxelGridPermuteDevices, CreateFromPointCloud) {
+    core::Device device = GetParam();
+
+    geometry::PointCloud pcd_legacy;
+    for (int i = 0; i < 1000; ++i) {
+        const double t = i * 0.01;
+        pcd_legacy.points_.emplace_back(std::cos(t), std::sin(t), 0.1 * t);
+        pcd_legacy.colors_.emplace_back(t / 10, 0.5, 1 - t / 10);
+    }
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacyPointCloud(
+            pcd_legacy, core::Dtype::Float64, device);
+
+    t::geometry::VoxelGrid voxel_grid =
+            t::geometry::VoxelGrid::CreateFromPointCloud(pcd, 0.1);
+    EXPECT_EQ(voxel_grid.GetDevice(), device);
+    auto voxel_grid_legacy =
+            geometry::VoxelGrid::CreateFromPointCloud(pcd_legacy, 0.1);
+    EXPECT_EQ(voxel_grid.GetNumVoxels(),
+              int64_t(voxel_grid_legacy->voxels_.size()));
+    ExpectEqualVoxels(voxel_grid.ToLegacyVoxelGrid(), *voxel_grid_legacy);
+
+    // Queries on and next to the curve.
+    std::vector<Eigen::Vector3d> queries;
+    for (int i = 0; i < 100; ++i) {
+        const double t = i * 0.1;
+        queries.emplace_back(std::cos(t), std::sin(t), 0.1 * t);
+        queries.emplace_back(0.5 * std::cos(t), 0.5 * std::sin(t), 0.1 * t);
+    }
+    std::vector<bool> included_legacy =
+            voxel_grid_legacy->CheckIfIncluded(queries);
+    std::vector<uint8_t> included_ref(included_legacy.begin(),
+                                      included_legacy.end());
+    std::vector<uint8_t> included =
+            voxel_grid
+                    .CheckIfIncluded(
+                            core::eigen_converter::EigenVector3dVectorToTensor(
+                                    queries, core::Dtype::Float64, device))
+                    .To(core::Device("CPU:0"), core::Dtype::UInt8)
+                    .ToFlatVector<uint8_t>();
+    EXPECT_EQ(included, included_ref);
+}
+
+TEST_P(VoxelGridPermuteDevices, Carve) {
+    core::Device device = GetParam();
+
+    auto voxel_grid_legacy = geometry::VoxelGrid::CreateDense(
+            Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(0.5, 0.5, 0.5), 0.1,
+            2, 2, 2);
+    auto silhouette_grid_legacy =
+            std::make_shared<geometry::VoxelGrid>(*voxel_grid_legacy);
+    t::geometry::VoxelGrid voxel_grid =
+            t::geometry::VoxelGrid::FromLegacyVoxelGrid(*voxel_grid_legacy,
+                                                        device);
+    t::geometry::VoxelGrid silhouette_grid =
+            t::geometry::VoxelGrid::FromLegacyVoxelGrid(*voxel_grid_legacy,
+                                                        device);
+    ExpectEqualVoxels(voxel_grid.ToLegacyVoxelGrid(), *voxel_grid_legacy);
+
+    // A camera 3 units in front of the grid, seeing a wall at depth 3.2 in
+    // the left half of the image and nothing in the right half.
+    camera::PinholeCameraParameters camera;
+    camera.intrinsic_ =
+            camera::PinholeCameraIntrinsic(64, 48, 50, 50, 31.5, 23.5);
+    camera.extrinsic_ = Eigen::Matrix4d::Identity();
+    camera.extrinsic_(2, 3) = 3;
+    geometry::Image depth_legacy;
+    depth_legacy.Prepare(64, 48, 1, 4);
+    for (int v = 0; v < 48; ++v) {
+        for (int u = 0; u < 64; ++u) {
+            *depth_legacy.PointerAt<float>(u, v) = u < 32 ? 3.2f : 0.0f;
+        }
+    }
+    core::Tensor intrinsics = core::eigen_converter::EigenMatrixToTensor(
+            camera.intrinsic_.intrinsic_matrix_);
+    core::Tensor extrinsics =
+            core::eigen_converter::EigenMatrixToTensor(camera.extrinsic_);
+    t::geometry::Image depth =
+            t::geometry::Image::FromLegacyImage(depth_legacy, device);
+
+    for (bool keep_voxels_outside_image : {false, true}) {
+        voxel_grid_legacy->CarveDepthMap(depth_legacy, camera,
+                                         keep_voxels_outside_image);
+        voxel_grid.CarveDepthMap(depth, intrinsics, extrinsics,
+                                 keep_voxels_outside_image);
+        ExpectEqualVoxels(voxel_grid.ToLegacyVoxelGrid(), *voxel_grid_legacy);
+
+        silhouette_grid_legacy->CarveSilhouette(depth_legacy, camera,
+                                                keep_voxels_outside_image);
+        silhouette_grid.CarveSilhouette(depth, intrinsics, extrinsics,
+                                        keep_voxels_outside_image);
+        ExpectEqualVoxels(silhouette_grid.ToLegacyVoxelGrid(),
+                          *silhouette_grid_legacy);
+    }
+    EXPECT_GT(voxel_grid.GetNumVoxels(), 0);
+    EXPECT_LT(voxel_grid.GetNumVoxels(), 8000);
+}
+
+}  // namespace tests
+}  // namespace open3d
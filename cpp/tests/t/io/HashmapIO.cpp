@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/HashmapIO.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/hashmap/Hashmap.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class HashmapIOPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(HashmapIO,
+                         HashmapIOPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(HashmapIOPermuteDevices, WriteReadHashmap) {
+    core::Device device = GetParam();
+
+    const int64_t n = 1000;
+    core::Hashmap hashmap(n * 2, core::Dtype::Int32, core::Dtype::Float32, {3},
+                          {2}, device);
+    core::Tensor keys =
+            core::Tensor::Arange(0, n * 3, 1, core::Dtype::Int32, device)
+                    .Reshape({n, 3});
+    core::Tensor values =
+            core::Tensor::Arange(0, n * 2, 1, core::Dtype::Float32, device)
+                    .Reshape({n, 2});
+    core::Tensor addrs, masks;
+    hashmap.Insert(keys, values, addrs, masks);
+
+    // Erased entries are not written.
+    core::Tensor erase_keys = keys.Slice(0, 0, n / 2);
+    hashmap.Erase(erase_keys, masks);
+
+    const std::string file_name = "test_hashmap.o3dt";
+    EXPECT_TRUE(t::io::WriteHashmap(file_name, hashmap));
+
+    for (auto mmap_mode : {core::Tensor::MmapMode::None,
+                           core::Tensor::MmapMode::ReadOnly}) {
+        std::shared_ptr<core::Hashmap> read_hashmap =
+                t::io::CreateHashmapFromFile(file_name, device,
+                                             core::HashmapBackend::Default,
+                                             mmap_mode);
+        ASSERT_NE(read_hashmap, nullptr);
+        EXPECT_EQ(read_hashmap->GetDevice(), device);
+        EXPECT_EQ(read_hashmap->Size(), n / 2);
+        EXPECT_EQ(read_hashmap->GetCapacity(), hashmap.GetCapacity());
+
+        read_hashmap->Find(keys, addrs, masks);
+        EXPECT_FALSE(masks.Slice(0, 0, n / 2).Any());
+        EXPECT_TRUE(masks.Slice(0, n / 2, n).All());
+
+        core::Tensor found_indices =
+                addrs.Slice(0, n / 2, n).To(core::Dtype::Int64);
+        EXPECT_TRUE(read_hashmap->GetValueTensor()
+                            .IndexGet({found_indices})
+                            .AllClose(values.Slice(0, n / 2, n)));
+    }
+
+    core::Hashmap loaded = core::Hashmap::Load(file_name, device);
+    EXPECT_EQ(loaded.Size(), n / 2);
+    std::remove(file_name.c_str());
+
+    // Empty hashmaps round-trip.
+    hashmap.Clear();
+    hashmap.Save(file_name);
+    loaded = core::Hashmap::Load(file_name, device);
+    EXPECT_EQ(loaded.Size(), 0);
+    std::remove(file_name.c_str());
+
+    EXPECT_EQ(t::io::CreateHashmapFromFile("does_not_exist.o3dt"), nullptr);
+    EXPECT_ANY_THROW(core::Hashmap::Load("does_not_exist.o3dt"));
+}
+
+}  // namespace tests
+}  // namespace open3d
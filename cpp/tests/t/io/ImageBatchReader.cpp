@@ -0,0 +1,108 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ImageBatchReader.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/io/ImageIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+/// Writes \p num_images 16-bit PNG images whose pixels hold their index.
+std::vector<std::string> WriteTestImages(int num_images) {
+    std::vector<std::string> filenames;
+    for (int i = 0; i < num_images; ++i) {
+        const std::string filename = std::string(TEST_DATA_DIR) +
+                                     "/test_batch_" + std::to_string(i) +
+                                     ".png";
+        EXPECT_TRUE(t::io::WriteImage(
+                filename, t::geometry::Image(core::Tensor::Full(
+                                  {48, 64, 1}, i, core::Dtype::UInt16))));
+        filenames.push_back(filename);
+    }
+    return filenames;
+}
+
+void RemoveTestImages(const std::vector<std::string> &filenames) {
+    for (const std::string &filename : filenames) {
+        std::remove(filename.c_str());
+    }
+}
+
+}  // namespace
+
+TEST(ImageBatchReader, Pop) {
+    std::vector<std::string> filenames = WriteTestImages(20);
+    filenames.insert(filenames.begin() + 5,
+                     std::string(TEST_DATA_DIR) + "/test_batch_missing.png");
+    t::io::ImageBatchReader reader(filenames, core::Device("CPU:0"), 4, 3);
+    EXPECT_EQ(reader.GetNumImages(), filenames.size());
+
+    // The images come in order, an unreadable file as an empty image.
+    t::geometry::Image image;
+    for (size_t i = 0; i < filenames.size(); ++i) {
+        EXPECT_EQ(reader.GetNumPopped(), i);
+        ASSERT_TRUE(reader.Pop(image));
+        if (i == 5) {
+            EXPECT_TRUE(image.IsEmpty());
+            continue;
+        }
+        const int value = int(i < 5 ? i : i - 1);
+        EXPECT_TRUE(image.AsTensor().AllClose(core::Tensor::Full(
+                {48, 64, 1}, value, core::Dtype::UInt16)));
+    }
+    EXPECT_FALSE(reader.Pop(image));
+    filenames.erase(filenames.begin() + 5);
+    RemoveTestImages(filenames);
+}
+
+TEST(ImageBatchReader, ReadImages) {
+    const std::vector<std::string> filenames = WriteTestImages(10);
+    const std::vector<t::geometry::Image> images = t::io::ReadImages(filenames);
+    ASSERT_EQ(images.size(), filenames.size());
+    for (size_t i = 0; i < images.size(); ++i) {
+        t::geometry::Image expected;
+        t::io::ReadImage(filenames[i], expected);
+        EXPECT_TRUE(images[i].AsTensor().AllClose(expected.AsTensor()));
+    }
+
+    // Images that are not popped are dropped.
+    { t::io::ImageBatchReader reader(filenames, core::Device("CPU:0"), 2, 2); }
+    RemoveTestImages(filenames);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,74 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/ImageBatchWriter.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
+#include "open3d/t/io/ImageIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(ImageBatchWriter, Push) {
+    std::vector<std::string> filenames;
+    {
+        t::io::ImageBatchWriter writer(4, 3, 1);
+        t::geometry::Image image(
+                core::Tensor::Zeros({48, 64, 1}, core::Dtype::UInt16));
+        for (int i = 0; i < 20; ++i) {
+            filenames.push_back(std::string(TEST_DATA_DIR) +
+                                "/test_batch_writer_" + std::to_string(i) +
+                                ".png");
+            // The writer copies the image, so it can be reused.
+            image.AsTensor().Fill(i);
+            writer.Push(filenames.back(), image);
+        }
+        EXPECT_TRUE(writer.Flush());
+
+        writer.Push(std::string(TEST_DATA_DIR) + "/test_batch_writer.bmp",
+                    image);
+        EXPECT_FALSE(writer.Flush());
+        EXPECT_TRUE(writer.Flush());
+    }
+
+    for (size_t i = 0; i < filenames.size(); ++i) {
+        t::geometry::Image image;
+        EXPECT_TRUE(t::io::ReadImage(filenames[i], image));
+        EXPECT_TRUE(image.AsTensor().AllClose(
+                core::Tensor::Full({48, 64, 1}, i, core::Dtype::UInt16)));
+        std::remove(filenames[i].c_str());
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
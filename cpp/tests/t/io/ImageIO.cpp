@@ -28,6 +28,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "open3d/core/Device.h"
 #include "open3d/core/Dtype.h"
 #include "open3d/core/SizeVector.h"
@@ -169,6 +171,67 @@ TEST(ImageIO, WriteImageToPNG) {
     RemoveTestImage(std::string(TEST_DATA_DIR) + "/test_imageio.png");
 }
 
+TEST(ImageIO, WriteImageToPNGOptions) {
+    // A depth image with smooth rows and a discontinuity.
+    std::vector<uint16_t> values(48 * 64);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = uint16_t(i % 64 < 32 ? 1000 + i : 40000 + 3 * (i % 64));
+    }
+    t::geometry::Image img(
+            core::Tensor(values, {48, 64, 1}, core::Dtype::UInt16));
+    const std::string filename =
+            std::string(TEST_DATA_DIR) + "/test_imageio_options.png";
+
+    for (t::io::PNGFilter filter :
+         {t::io::PNGFilter::None, t::io::PNGFilter::Sub, t::io::PNGFilter::Up,
+          t::io::PNGFilter::Average, t::io::PNGFilter::Paeth,
+          t::io::PNGFilter::Adaptive}) {
+        for (int level : {0, 1, 9}) {
+            t::io::PNGWriteOptions options;
+            options.compression_level_ = level;
+            options.filter_ = filter;
+            options.strategy_ = level == 1 ? t::io::PNGStrategy::RLE
+                                           : t::io::PNGStrategy::Default;
+            EXPECT_TRUE(t::io::WriteImageToPNG(filename, img, options));
+            t::geometry::Image read_img;
+            EXPECT_TRUE(t::io::ReadImage(filename, read_img));
+            EXPECT_TRUE(img.AsTensor().AllClose(read_img.AsTensor()));
+        }
+    }
+
+    // RGBA and the fast preset.
+    t::geometry::Image rgba(core::Tensor::Full({10, 20, 4}, 7,
+                                               core::Dtype::UInt8));
+    EXPECT_TRUE(t::io::WriteImageToPNG(filename, rgba,
+                                       t::io::PNGWriteOptions::FromQuality(1)));
+    t::geometry::Image read_rgba;
+    EXPECT_TRUE(t::io::ReadImage(filename, read_rgba));
+    EXPECT_TRUE(rgba.AsTensor().AllClose(read_rgba.AsTensor()));
+
+    t::io::PNGWriteOptions invalid;
+    invalid.compression_level_ = 10;
+    EXPECT_FALSE(t::io::WriteImageToPNG(filename, img, invalid));
+    EXPECT_FALSE(t::io::WriteImageToPNG(filename, img, 10));
+
+    RemoveTestImage(filename);
+}
+
+TEST(ImageIO, WriteImageToO3DT) {
+    const std::string filename =
+            std::string(TEST_DATA_DIR) + "/test_imageio.o3dt";
+    for (const core::Dtype &dtype :
+         {core::Dtype::UInt16, core::Dtype::Float32}) {
+        t::geometry::Image img(
+                core::Tensor::Full({48, 64, 1}, 1234, dtype));
+        EXPECT_TRUE(t::io::WriteImage(filename, img));
+        t::geometry::Image read_img;
+        EXPECT_TRUE(t::io::ReadImage(filename, read_img));
+        EXPECT_EQ(read_img.GetDtype(), dtype);
+        EXPECT_TRUE(img.AsTensor().AllClose(read_img.AsTensor()));
+    }
+    RemoveTestImage(filename);
+}
+
 TEST(ImageIO, ReadImageFromJPG) {
     WriteTestImage(CreateTestImage());
     t::geometry::Image img;
@@ -34,6 +34,7 @@
 #include "open3d/core/SizeVector.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorList.h"
+#include "open3d/io/PointCloudIO.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "tests/UnitTest.h"
 
@@ -82,6 +83,18 @@ const std::vector<ReadWritePCArgs> pcArgs({
          IsAscii::ASCII,
          Compressed::UNCOMPRESSED,
          {{"points", 1e-5}, {"intensities", 1e-5}}},  // 1
+        {"test.pcd",
+         IsAscii::ASCII,
+         Compressed::UNCOMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 2
+        {"test.pcd",
+         IsAscii::BINARY,
+         Compressed::UNCOMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 3
+        {"test.pcd",
+         IsAscii::BINARY,
+         Compressed::COMPRESSED,
+         {{"points", 1e-5}, {"intensities", 1e-5}}},  // 4
 });
 
 class ReadWriteTPC : public testing::TestWithParam<ReadWritePCArgs> {};
@@ -192,6 +205,88 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY4) {
     EXPECT_EQ(pcd.GetPointAttr("intensity").GetLength(), 7);
 }
 
+// PCD fields are read as attributes, colors are unpacked from rgb.
+TEST(TPointCloudIO, ReadWritePointCloudPCD) {
+    t::geometry::PointCloud pcd;
+    EXPECT_TRUE(t::io::ReadPointCloud(
+            std::string(TEST_DATA_DIR) + "/fragment.pcd", pcd,
+            {"auto", false, false, true}));
+    geometry::PointCloud legacy_pcd;
+    EXPECT_TRUE(io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.pcd",
+                                   legacy_pcd, {"auto", false, false, true}));
+    const int64_t num_points = int64_t(legacy_pcd.points_.size());
+    EXPECT_EQ(pcd.GetPoints().GetLength(), num_points);
+    EXPECT_EQ(pcd.GetPoints().GetDtype(), core::Dtype::Float32);
+    EXPECT_EQ(pcd.GetPointColors().GetDtype(), core::Dtype::UInt8);
+    EXPECT_EQ(pcd.GetPointAttr("curvature").GetShape(),
+              core::SizeVector({num_points, 1}));
+    t::geometry::PointCloud expected = t::geometry::PointCloud::
+            FromLegacyPointCloud(legacy_pcd, core::Dtype::Float32);
+    EXPECT_TRUE(pcd.GetPoints().AllClose(expected.GetPoints()));
+    EXPECT_TRUE(pcd.GetPointNormals().AllClose(expected.GetPointNormals()));
+    EXPECT_TRUE(pcd.GetPointColors().AllClose(
+            expected.GetPointColors().Mul(255).Round().To(core::Dtype::UInt8)));
+
+    // Integer fields with several values per point round trip.
+    pcd.SetPointAttr("ring", core::Tensor::Ones({num_points, 1},
+                                                core::Dtype::UInt16));
+    pcd.SetPointAttr("timestamp",
+                     core::Tensor::Full({num_points, 2}, 1e9,
+                                        core::Dtype::Float64));
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_fields.pcd";
+    for (bool compressed : {false, true}) {
+        for (bool ascii : {false, true}) {
+            if (ascii && compressed) {
+                continue;
+            }
+            t::geometry::PointCloud pcd_read;
+            EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd,
+                                               {ascii, compressed, true}));
+            EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd_read,
+                                              {"auto", false, false, true}));
+            for (const char *key : {"points", "normals", "colors",
+                                    "curvature", "ring", "timestamp"}) {
+                SCOPED_TRACE(key);
+                EXPECT_EQ(pcd_read.GetPointAttr(key).GetDtype(),
+                          pcd.GetPointAttr(key).GetDtype());
+                EXPECT_TRUE(pcd_read.GetPointAttr(key).AllClose(
+                        pcd.GetPointAttr(key)));
+            }
+        }
+    }
+    std::remove(file_name.c_str());
+}
+
+// Mapped binary vertices match the rply reader.
+TEST(TPointCloudIO, ReadPointCloudFromPLYMapped) {
+    t::geometry::PointCloud pcd, pcd_binary, pcd_ascii;
+    t::io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd,
+                          {"auto", false, false, true});
+
+    std::string binary_file = std::string(TEST_DATA_DIR) + "/test_binary.ply";
+    std::string ascii_file = std::string(TEST_DATA_DIR) + "/test_ascii.ply";
+    EXPECT_TRUE(t::io::WritePointCloud(binary_file, pcd, {false, false, true}));
+    EXPECT_TRUE(t::io::WritePointCloud(ascii_file, pcd, {true, false, true}));
+    EXPECT_TRUE(t::io::ReadPointCloud(binary_file, pcd_binary,
+                                      {"auto", false, false, true}));
+    EXPECT_TRUE(t::io::ReadPointCloud(ascii_file, pcd_ascii,
+                                      {"auto", false, false, true}));
+    for (const char *key : {"points", "normals", "colors", "curvature"}) {
+        EXPECT_TRUE(pcd_binary.GetPointAttr(key).IsContiguous());
+        EXPECT_TRUE(pcd_binary.GetPointAttr(key).AllClose(
+                pcd_ascii.GetPointAttr(key)));
+    }
+
+    // Attributes are private to the point cloud and do not modify the file.
+    pcd_binary.GetPoints().Fill(0);
+    EXPECT_TRUE(t::io::ReadPointCloud(binary_file, pcd_ascii,
+                                      {"auto", false, false, true}));
+    EXPECT_TRUE(pcd.GetPoints().AllClose(pcd_ascii.GetPoints()));
+    std::remove(binary_file.c_str());
+    std::remove(ascii_file.c_str());
+}
+
 // Read write empty point cloud.
 TEST(TPointCloudIO, ReadWriteEmptyPTS) {
     t::geometry::PointCloud pcd, pcd_read;
@@ -0,0 +1,178 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudLOD.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+t::geometry::PointCloud CreateRandomPointCloud(int64_t num_points) {
+    std::mt19937 engine(0);
+    std::uniform_real_distribution<double> distribution(-1, 1);
+    std::vector<double> points(3 * num_points);
+    for (double &value : points) {
+        value = distribution(engine);
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {num_points, 3}, core::Dtype::Float64));
+    pcd.SetPointAttr("indices",
+                     core::Tensor::Arange(0, num_points, 1, core::Dtype::Int64)
+                             .Reshape({num_points, 1}));
+    return pcd;
+}
+
+/// Checks that every point is stored once, in a node whose cube holds it.
+void ExpectLODComplete(const std::string &directory,
+                       const t::geometry::PointCloud &pcd) {
+    t::io::PointCloudLOD lod;
+    ASSERT_TRUE(lod.Open(directory));
+    const int64_t num_points = pcd.GetPoints().GetLength();
+    EXPECT_EQ(lod.num_points_, num_points);
+    ASSERT_FALSE(lod.nodes_.empty());
+    EXPECT_EQ(lod.nodes_[0].name_, "r");
+
+    std::vector<int> counts(num_points, 0);
+    const core::Tensor points = pcd.GetPoints();
+    for (int i = 0; i < int(lod.nodes_.size()); ++i) {
+        const t::io::PointCloudLODNode &node = lod.nodes_[i];
+        t::geometry::PointCloud node_pcd;
+        ASSERT_TRUE(lod.ReadNode(i, node_pcd));
+        if (node.num_points_ == 0) {
+            continue;
+        }
+        EXPECT_EQ(node_pcd.GetPoints().GetLength(), node.num_points_);
+        const core::Tensor min_bound(
+                std::vector<double>{node.min_bound_(0) - 1e-9,
+                                    node.min_bound_(1) - 1e-9,
+                                    node.min_bound_(2) - 1e-9},
+                {3}, core::Dtype::Float64);
+        EXPECT_TRUE(node_pcd.GetPoints().Ge(min_bound).All());
+        EXPECT_TRUE(node_pcd.GetPoints()
+                            .Le(min_bound.Add(node.size_ + 2e-9))
+                            .All());
+        const std::vector<int64_t> indices =
+                node_pcd.GetPointAttr("indices").ToFlatVector<int64_t>();
+        for (size_t p = 0; p < indices.size(); ++p) {
+            counts[indices[p]]++;
+            EXPECT_TRUE(node_pcd.GetPoints()[p].AllClose(
+                    points[indices[p]]));
+        }
+    }
+    EXPECT_EQ(std::count(counts.begin(), counts.end(), 1), num_points);
+}
+
+/// Removes the node files, the node list and \p directory.
+void RemoveLOD(const std::string &directory) {
+    t::io::PointCloudLOD lod;
+    if (lod.Open(directory)) {
+        for (const t::io::PointCloudLODNode &node : lod.nodes_) {
+            std::remove((directory + "/" + node.name_ + ".o3dt").c_str());
+        }
+    }
+    std::remove((directory + "/lod.json").c_str());
+    utility::filesystem::DeleteDirectory(directory);
+}
+
+}  // namespace
+
+TEST(PointCloudLOD, WriteInMemory) {
+    const std::string directory = std::string(TEST_DATA_DIR) + "/test_lod";
+    const t::geometry::PointCloud pcd = CreateRandomPointCloud(5000);
+    t::io::PointCloudLODOptions options;
+    options.max_node_points_ = 200;
+    options.grid_size_ = 8;
+    EXPECT_TRUE(t::io::WritePointCloudLOD(pcd, directory, options));
+    ExpectLODComplete(directory, pcd);
+    RemoveLOD(directory);
+}
+
+TEST(PointCloudLOD, WriteOutOfCore) {
+    const std::string directory = std::string(TEST_DATA_DIR) + "/test_lod";
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_lod.pcd";
+    const t::geometry::PointCloud pcd = CreateRandomPointCloud(20000);
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd, {false, false, true}));
+
+    // The points are distributed to chunks of at most 3000 points.
+    t::io::PointCloudLODOptions options;
+    options.max_node_points_ = 200;
+    options.grid_size_ = 8;
+    options.max_chunk_points_ = 3000;
+    options.read_points_ = 1000;
+    EXPECT_TRUE(t::io::WritePointCloudLOD(file_name, directory, options));
+    ExpectLODComplete(directory, pcd);
+    std::remove(file_name.c_str());
+    RemoveLOD(directory);
+}
+
+TEST(PointCloudLOD, SelectNodes) {
+    const std::string directory = std::string(TEST_DATA_DIR) + "/test_lod";
+    const t::geometry::PointCloud pcd = CreateRandomPointCloud(5000);
+    t::io::PointCloudLODOptions options;
+    options.max_node_points_ = 200;
+    options.grid_size_ = 8;
+    EXPECT_TRUE(t::io::WritePointCloudLOD(pcd, directory, options));
+    t::io::PointCloudLOD lod;
+    ASSERT_TRUE(lod.Open(directory));
+
+    // A distant camera only needs the root, a close one all the nodes.
+    const Eigen::Vector3d far_eye(0, 0, 1e6);
+    EXPECT_EQ(lod.SelectNodes(far_eye, 1000, 1, 5000), std::vector<int>{0});
+    const Eigen::Vector3d near_eye(0, 0, 0);
+    std::vector<int> all(lod.nodes_.size());
+    for (int i = 0; i < int(all.size()); ++i) {
+        all[i] = i;
+    }
+    EXPECT_EQ(lod.SelectNodes(near_eye, 1000, 1, 5000), all);
+
+    // The point budget limits the refinement.
+    const std::vector<int> limited = lod.SelectNodes(near_eye, 1000, 1, 1000);
+    int64_t num_points = 0;
+    for (int index : limited) {
+        num_points += lod.nodes_[index].num_points_;
+    }
+    EXPECT_LE(num_points, 1000);
+    EXPECT_EQ(limited.front(), 0);
+    RemoveLOD(directory);
+}
+
+}  // namespace tests
+}  // namespace open3d
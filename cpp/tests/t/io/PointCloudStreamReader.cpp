@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/PointCloudStreamReader.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+/// Reads \p file_name in chunks of \p chunk_size points and compares them with
+/// the point cloud read at once.
+void ExpectChunksEqual(const std::string &file_name, int64_t chunk_size) {
+    SCOPED_TRACE(file_name);
+    t::geometry::PointCloud pcd;
+    EXPECT_TRUE(t::io::ReadPointCloud(file_name, pcd,
+                                      {"auto", false, false, true}));
+    const int64_t num_points = pcd.GetPoints().GetLength();
+
+    t::io::PointCloudStreamReader reader;
+    ASSERT_TRUE(reader.Open(file_name));
+    t::geometry::PointCloud chunk;
+    int64_t offset = 0;
+    while (reader.ReadNext(chunk_size, chunk)) {
+        const int64_t length = chunk.GetPoints().GetLength();
+        EXPECT_GT(length, 0);
+        EXPECT_LE(length, chunk_size);
+        ASSERT_LE(offset + length, num_points);
+        for (const auto &it : pcd.GetPointAttr()) {
+            SCOPED_TRACE(it.first);
+            ASSERT_TRUE(chunk.HasPointAttr(it.first));
+            const core::Tensor &data = chunk.GetPointAttr(it.first);
+            EXPECT_EQ(data.GetDtype(), it.second.GetDtype());
+            EXPECT_TRUE(data.AllClose(
+                    it.second.Slice(0, offset, offset + length)));
+        }
+        offset += length;
+    }
+    EXPECT_TRUE(reader.IsEOF());
+    EXPECT_EQ(offset, num_points);
+    EXPECT_FALSE(reader.ReadNext(chunk_size, chunk));
+}
+
+}  // namespace
+
+TEST(PointCloudStreamReader, ReadPLYPCD) {
+    t::geometry::PointCloud pcd;
+    t::io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/fragment.ply", pcd,
+                          {"auto", false, false, true});
+    for (const char *extension : {"ply", "pcd"}) {
+        for (bool ascii : {false, true}) {
+            const std::string file_name =
+                    std::string(TEST_DATA_DIR) + "/test_stream." + extension;
+            EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd,
+                                               {ascii, false, true}));
+            ExpectChunksEqual(file_name, 10000);
+            std::remove(file_name.c_str());
+        }
+    }
+}
+
+TEST(PointCloudStreamReader, ReadText) {
+    const int64_t num_points = 2500;
+    t::geometry::PointCloud pcd;
+    pcd.SetPoints(core::Tensor::Arange(0, 3 * num_points, 1,
+                                       core::Dtype::Float64)
+                          .Reshape({num_points, 3})
+                          .Div(7));
+    pcd.SetPointAttr("intensities", core::Tensor::Ones({num_points, 1},
+                                                       core::Dtype::Float64));
+    for (const char *extension : {"xyz", "xyzi", "pts"}) {
+        const std::string file_name =
+                std::string(TEST_DATA_DIR) + "/test_stream." + extension;
+        EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd));
+        ExpectChunksEqual(file_name, 1000);
+        std::remove(file_name.c_str());
+    }
+}
+
+TEST(PointCloudStreamReader, Open) {
+    t::io::PointCloudStreamReader reader;
+    t::geometry::PointCloud chunk;
+    EXPECT_FALSE(reader.IsOpened());
+    EXPECT_FALSE(reader.ReadNext(100, chunk));
+
+    const std::string file_name =
+            std::string(TEST_DATA_DIR) + "/test_stream.pcd";
+    t::geometry::PointCloud pcd;
+    pcd.SetPoints(core::Tensor::Ones({10, 3}, core::Dtype::Float32));
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd, {false, false, true}));
+    EXPECT_TRUE(reader.Open(file_name));
+    EXPECT_EQ(reader.GetNumPoints(), 10);
+
+    // Compressed fields are stored one after the other.
+    EXPECT_TRUE(t::io::WritePointCloud(file_name, pcd, {false, true, true}));
+    EXPECT_FALSE(reader.Open(file_name));
+    EXPECT_FALSE(reader.IsOpened());
+    std::remove(file_name.c_str());
+}
+
+}  // namespace tests
+}  // namespace open3d
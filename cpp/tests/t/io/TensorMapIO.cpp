@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/TensorMapIO.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+#include "core/CoreTest.h"
+#include "open3d/core/Device.h"
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/TensorMap.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class TensorMapIOPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(TensorMapIO,
+                         TensorMapIOPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+static t::geometry::TensorMap CreateTensorMap(const core::Device& device) {
+    // Large enough to be split into several compression chunks.
+    core::Tensor points =
+            core::Tensor::Arange(0, 3 << 19, 1, core::Dtype::Float32, device)
+                    .Reshape({1 << 19, 3});
+    core::Tensor colors =
+            core::Tensor::Ones({1 << 19, 3}, core::Dtype::UInt8, device);
+    core::Tensor labels = core::Tensor::Init<int64_t>({{5}, {-1}}, device);
+    core::Tensor empty = core::Tensor::Empty({0, 3}, core::Dtype::Bool, device);
+    return t::geometry::TensorMap("points", {{"points", points},
+                                             {"colors", colors},
+                                             {"labels", labels.T()},
+                                             {"empty", empty}});
+}
+
+static void ExpectTensorMapEq(const t::geometry::TensorMap& actual,
+                              const t::geometry::TensorMap& expected,
+                              const core::Device& device) {
+    EXPECT_EQ(actual.GetPrimaryKey(), expected.GetPrimaryKey());
+    EXPECT_EQ(actual.size(), expected.size());
+    for (const auto& kv : expected) {
+        ASSERT_TRUE(actual.Contains(kv.first));
+        const core::Tensor& tensor = actual.at(kv.first);
+        EXPECT_EQ(tensor.GetDevice(), device);
+        EXPECT_EQ(tensor.GetDtype(), kv.second.GetDtype());
+        EXPECT_EQ(tensor.GetShape(), kv.second.GetShape());
+        if (tensor.NumElements() > 0) {
+            EXPECT_TRUE(tensor.Eq(kv.second.To(device)).All());
+        }
+    }
+}
+
+TEST_P(TensorMapIOPermuteDevices, WriteReadTensorMap) {
+    core::Device device = GetParam();
+    t::geometry::TensorMap tensor_map = CreateTensorMap(device);
+
+    for (bool compressed : {false, true}) {
+        const std::string file_name = "test_tensor_map.o3dt";
+        EXPECT_TRUE(t::io::WriteTensorMap(file_name, tensor_map, compressed));
+
+        t::geometry::TensorMap read_tensor_map("undefined");
+        EXPECT_TRUE(t::io::ReadTensorMap(file_name, read_tensor_map, device));
+        ExpectTensorMapEq(read_tensor_map, tensor_map, device);
+
+        // Uncompressed blocks are backed by the mapped file on CPU.
+        t::geometry::TensorMap mmap_tensor_map("undefined");
+        EXPECT_TRUE(t::io::ReadTensorMap(file_name, mmap_tensor_map,
+                                         core::Device("CPU:0"),
+                                         core::Tensor::MmapMode::ReadOnly));
+        ExpectTensorMapEq(mmap_tensor_map, tensor_map, core::Device("CPU:0"));
+        std::remove(file_name.c_str());
+    }
+}
+
+TEST_P(TensorMapIOPermuteDevices, WriteReadTensor) {
+    core::Device device = GetParam();
+    core::Tensor tensor =
+            core::Tensor::Init<double>({{0, 1.5}, {2, 3}}, device);
+    const std::string file_name = "test_tensor.o3dt";
+    EXPECT_TRUE(t::io::WriteTensor(file_name, tensor, true));
+
+    core::Tensor read_tensor;
+    EXPECT_TRUE(t::io::ReadTensor(file_name, read_tensor, device));
+    EXPECT_EQ(read_tensor.GetDtype(), core::Dtype::Float64);
+    EXPECT_TRUE(read_tensor.AllClose(tensor));
+    std::remove(file_name.c_str());
+}
+
+TEST(TensorMapIO, ReadInvalidFile) {
+    const std::string file_name = "test_invalid.o3dt";
+    FILE* fp = fopen(file_name.c_str(), "wb");
+    fputs("O3DTMAP", fp);
+    fclose(fp);
+
+    t::geometry::TensorMap tensor_map("points");
+    EXPECT_FALSE(t::io::ReadTensorMap(file_name, tensor_map));
+    EXPECT_FALSE(t::io::ReadTensorMap("does_not_exist.o3dt", tensor_map));
+    std::remove(file_name.c_str());
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -91,6 +91,34 @@ TEST(TriangleMeshIO, ReadWriteTriangleMeshOBJ) {
     std::remove(file_name.c_str());
 }
 
+TEST(TriangleMeshIO, ReadWriteTriangleMeshGLB) {
+    t::geometry::TriangleMesh mesh, mesh_read;
+    EXPECT_TRUE(t::io::ReadTriangleMesh(TEST_DATA_DIR "/knot.ply", mesh));
+    const int64_t num_vertices = mesh.GetVertices().GetLength();
+    mesh.SetVertexColors(core::Tensor::Ones({num_vertices, 3},
+                                            core::Dtype::Float32) *
+                         0.5);
+
+    // The vertex attributes are interleaved in one buffer view, which the
+    // reader maps with strides.
+    std::string file_name = std::string(TEST_DATA_DIR) + "/test_mesh.glb";
+    EXPECT_TRUE(t::io::WriteTriangleMesh(file_name, mesh));
+    EXPECT_TRUE(t::io::ReadTriangleMesh(file_name, mesh_read));
+    EXPECT_TRUE(mesh.GetTriangles().AllClose(mesh_read.GetTriangles()));
+    EXPECT_TRUE(mesh.GetVertices().To(core::Dtype::Float32).AllClose(
+            mesh_read.GetVertices()));
+    EXPECT_TRUE(mesh.GetVertexColors().AllClose(mesh_read.GetVertexColors()));
+
+    // The file is readable by the legacy reader.
+    geometry::TriangleMesh mesh_legacy;
+    EXPECT_TRUE(io::ReadTriangleMesh(file_name, mesh_legacy));
+    EXPECT_EQ(static_cast<int64_t>(mesh_legacy.vertices_.size()),
+              num_vertices);
+    EXPECT_EQ(static_cast<int64_t>(mesh_legacy.triangles_.size()),
+              mesh.GetTriangles().GetLength());
+    std::remove(file_name.c_str());
+}
+
 // TODO: Add tests for triangle_uvs, materials, triangle_material_ids and
 // textures once these are supported.
 TEST(TriangleMeshIO, TriangleMeshLegecyCompatibility) {
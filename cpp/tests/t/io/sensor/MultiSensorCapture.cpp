@@ -0,0 +1,166 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/MultiSensorCapture.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// A camera synchronized to a shared clock. Frame k is captured at
+/// start + k * 2ms, has the timestamp k * 2000us and depth pixels holding k.
+class FakeSensor : public t::io::RGBDSensor {
+public:
+    explicit FakeSensor(Clock::time_point start) : start_(start) {}
+
+    bool InitSensor(const RGBDSensorConfig &,
+                    size_t,
+                    const std::string &) override {
+        return true;
+    }
+    bool StartCapture(bool) override { return true; }
+    void PauseRecord() override {}
+    void ResumeRecord() override {}
+    t::geometry::RGBDImage CaptureFrame(bool, bool) override {
+        const auto period = std::chrono::milliseconds(2);
+        const int64_t k = (Clock::now() - start_) / period + 1;
+        std::this_thread::sleep_until(start_ + k * period);
+        timestamp_ = uint64_t(k) * 2000;
+        return t::geometry::RGBDImage(
+                core::Tensor::Full({4, 6, 3}, k % 256, core::Dtype::UInt8),
+                core::Tensor::Full({4, 6}, k, core::Dtype::UInt16));
+    }
+    uint64_t GetTimestamp() const override { return timestamp_; }
+    void StopCapture() override {}
+    const t::io::RGBDVideoMetadata &GetMetadata() const override {
+        return metadata_;
+    }
+    std::string GetFilename() const override { return ""; }
+
+private:
+    Clock::time_point start_;
+    uint64_t timestamp_ = 0;
+    t::io::RGBDVideoMetadata metadata_;
+};
+
+int64_t FrameIndex(const t::geometry::RGBDImage &frame) {
+    return frame.depth_.AsTensor()[0][0][0].Item<uint16_t>();
+}
+
+std::vector<std::shared_ptr<t::io::RGBDSensor>> CreateSensors(int n) {
+    const Clock::time_point start = Clock::now();
+    std::vector<std::shared_ptr<t::io::RGBDSensor>> sensors;
+    for (int i = 0; i < n; ++i) {
+        sensors.push_back(std::make_shared<FakeSensor>(start));
+    }
+    return sensors;
+}
+
+}  // namespace
+
+TEST(MultiSensorCapture, CaptureFrameInto) {
+    FakeSensor sensor(Clock::now());
+    t::geometry::RGBDImage frame;
+    ASSERT_TRUE(sensor.CaptureFrameInto(frame));
+    EXPECT_EQ(frame.depth_.AsTensor().GetShape(), core::SizeVector({4, 6, 1}));
+    const void *color_ptr = frame.color_.GetDataPtr();
+    const void *depth_ptr = frame.depth_.GetDataPtr();
+    const int64_t first = FrameIndex(frame);
+
+    // The second frame is captured into the memory of the first.
+    ASSERT_TRUE(sensor.CaptureFrameInto(frame));
+    EXPECT_GT(FrameIndex(frame), first);
+    EXPECT_EQ(frame.color_.GetDataPtr(), color_ptr);
+    EXPECT_EQ(frame.depth_.GetDataPtr(), depth_ptr);
+}
+
+TEST(MultiSensorCapture, NextFrameSet) {
+    const int num_sensors = 4;
+    t::io::MultiSensorCapture capture(CreateSensors(num_sensors), 4, 500);
+    EXPECT_EQ(capture.GetNumSensors(), size_t(num_sensors));
+    ASSERT_TRUE(capture.StartCapture());
+
+    std::vector<t::geometry::RGBDImage> frames;
+    std::vector<uint64_t> timestamps;
+    int64_t last = 0;
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_TRUE(capture.NextFrameSet(frames, timestamps));
+        ASSERT_EQ(frames.size(), size_t(num_sensors));
+        const int64_t k = FrameIndex(frames[0]);
+        EXPECT_GT(k, last);
+        for (int s = 0; s < num_sensors; ++s) {
+            EXPECT_EQ(FrameIndex(frames[s]), k);
+            EXPECT_EQ(timestamps[s], uint64_t(k) * 2000);
+        }
+        last = k;
+    }
+
+    capture.StopCapture();
+    EXPECT_FALSE(capture.IsCapturing());
+    EXPECT_FALSE(capture.NextFrameSet(frames, timestamps, false));
+}
+
+TEST(MultiSensorCapture, FrameSetCallback) {
+    const int num_sensors = 2;
+    t::io::MultiSensorCapture capture(CreateSensors(num_sensors), 4, 500);
+    std::atomic<int> num_frame_sets(0);
+    std::atomic<bool> synchronized(true);
+    capture.SetFrameSetCallback(
+            [&](const std::vector<t::geometry::RGBDImage> &frames,
+                const std::vector<uint64_t> &timestamps) {
+                if (FrameIndex(frames[0]) != FrameIndex(frames[1]) ||
+                    timestamps[0] != timestamps[1]) {
+                    synchronized = false;
+                }
+                ++num_frame_sets;
+            });
+    ASSERT_TRUE(capture.StartCapture());
+    std::vector<t::geometry::RGBDImage> frames;
+    std::vector<uint64_t> timestamps;
+    EXPECT_ANY_THROW(capture.NextFrameSet(frames, timestamps));
+
+    while (num_frame_sets < 10) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    capture.StopCapture();
+    EXPECT_TRUE(synchronized);
+}
+
+}  // namespace tests
+}  // namespace open3d
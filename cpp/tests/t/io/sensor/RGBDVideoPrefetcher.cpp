@@ -0,0 +1,143 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/sensor/RGBDVideoPrefetcher.h"
+
+#include <gtest/gtest.h>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+/// A video of num_frames frames, 1000us apart, whose depth pixels hold the
+/// frame index. If stall is set, every other NextFrame() call returns an
+/// empty frame before the end of the video, like a reader whose next frame is
+/// not ready yet.
+class FakeVideoReader : public t::io::RGBDVideoReader {
+public:
+    explicit FakeVideoReader(int num_frames, bool stall = false)
+        : num_frames_(num_frames), stall_(stall) {
+        metadata_.fps_ = 1000;
+    }
+
+    bool IsOpened() const override { return is_opened_; }
+    bool IsEOF() const override { return next_ >= num_frames_; }
+    bool Open(const std::string &filename) override {
+        filename_ = filename;
+        next_ = 0;
+        is_opened_ = true;
+        return true;
+    }
+    void Close() override { is_opened_ = false; }
+    t::io::RGBDVideoMetadata &GetMetadata() override { return metadata_; }
+    const t::io::RGBDVideoMetadata &GetMetadata() const override {
+        return metadata_;
+    }
+    bool SeekTimestamp(uint64_t timestamp) override {
+        next_ = int(timestamp / 1000);
+        return next_ < num_frames_;
+    }
+    uint64_t GetTimestamp() const override {
+        return next_ == 0 ? 0 : uint64_t(next_ - 1) * 1000;
+    }
+    t::geometry::RGBDImage NextFrame() override {
+        if (IsEOF() || (stall_ && (num_calls_++ % 2 == 0))) {
+            return t::geometry::RGBDImage();
+        }
+        const int index = next_++;
+        return t::geometry::RGBDImage(
+                core::Tensor::Full({4, 6, 3}, index, core::Dtype::UInt8),
+                core::Tensor::Full({4, 6}, index, core::Dtype::UInt16));
+    }
+    std::string GetFilename() const override { return filename_; }
+
+private:
+    int num_frames_;
+    bool stall_;
+    int num_calls_ = 0;
+    int next_ = 0;
+    bool is_opened_ = false;
+    std::string filename_;
+    t::io::RGBDVideoMetadata metadata_;
+};
+
+int FrameIndex(const t::geometry::RGBDImage &frame) {
+    return frame.depth_.AsTensor()[0][0][0].Item<uint16_t>();
+}
+
+}  // namespace
+
+TEST(RGBDVideoPrefetcher, NextFrame) {
+    t::io::RGBDVideoPrefetcher prefetcher(
+            std::make_unique<FakeVideoReader>(20), 3);
+    EXPECT_FALSE(prefetcher.IsOpened());
+    EXPECT_TRUE(prefetcher.Open("fake.video"));
+    EXPECT_EQ(prefetcher.GetFilename(), "fake.video");
+
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_FALSE(prefetcher.IsEOF());
+        t::geometry::RGBDImage frame = prefetcher.NextFrame();
+        ASSERT_FALSE(frame.IsEmpty());
+        EXPECT_EQ(FrameIndex(frame), i);
+        EXPECT_EQ(prefetcher.GetTimestamp(), uint64_t(i) * 1000);
+    }
+    EXPECT_TRUE(prefetcher.NextFrame().IsEmpty());
+    EXPECT_TRUE(prefetcher.IsEOF());
+
+    // Seeking drops the prefetched frames.
+    EXPECT_TRUE(prefetcher.SeekTimestamp(5000));
+    EXPECT_FALSE(prefetcher.IsEOF());
+    EXPECT_EQ(FrameIndex(prefetcher.NextFrame()), 5);
+    EXPECT_TRUE(prefetcher.SeekTimestamp(12000));
+    EXPECT_EQ(FrameIndex(prefetcher.NextFrame()), 12);
+    EXPECT_EQ(prefetcher.GetTimestamp(), uint64_t(12000));
+
+    prefetcher.Close();
+    EXPECT_FALSE(prefetcher.IsOpened());
+}
+
+TEST(RGBDVideoPrefetcher, EmptyFramesBeforeEOF) {
+    t::io::RGBDVideoPrefetcher prefetcher(
+            std::make_unique<FakeVideoReader>(10, true), 3);
+    EXPECT_TRUE(prefetcher.Open("fake.video"));
+
+    // Empty frames before the end of the video are not returned.
+    for (int i = 0; i < 10; ++i) {
+        t::geometry::RGBDImage frame = prefetcher.NextFrame();
+        ASSERT_FALSE(frame.IsEmpty());
+        EXPECT_EQ(FrameIndex(frame), i);
+    }
+    EXPECT_TRUE(prefetcher.NextFrame().IsEmpty());
+    EXPECT_TRUE(prefetcher.IsEOF());
+}
+
+}  // namespace tests
+}  // namespace open3d
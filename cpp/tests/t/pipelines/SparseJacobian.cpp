@@ -0,0 +1,115 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/kernel/SparseJacobian.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class SparseJacobianPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(SparseJacobian,
+                         SparseJacobianPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// 3 rows of 2 entries over 6 variables, and the dense J of the same rows.
+static void GetJacobian(const core::Device& device,
+                        core::Tensor& jacobians,
+                        core::Tensor& jacobian_indices,
+                        core::Tensor& dense) {
+    std::vector<float> J_vals{1, 2, 3, -1, 0.5, 4};
+    std::vector<int> idx_vals{0, 4, 1, 2, 5, 0};
+    jacobians = core::Tensor(J_vals, {3, 2}, core::Dtype::Float32, device);
+    jacobian_indices =
+            core::Tensor(idx_vals, {3, 2}, core::Dtype::Int32, device);
+
+    std::vector<float> dense_vals(3 * 6, 0);
+    for (int r = 0; r < 3; ++r) {
+        for (int k = 0; k < 2; ++k) {
+            dense_vals[r * 6 + idx_vals[r * 2 + k]] += J_vals[r * 2 + k];
+        }
+    }
+    dense = core::Tensor(dense_vals, {3, 6}, core::Dtype::Float32, device);
+}
+
+TEST_P(SparseJacobianPermuteDevices, ComputeJtJxAndJtr) {
+    core::Device device = GetParam();
+    core::Tensor jacobians, jacobian_indices, dense;
+    GetJacobian(device, jacobians, jacobian_indices, dense);
+
+    core::Tensor x(std::vector<float>{1, -2, 3, 0.5, 1, 2}, {6},
+                   core::Dtype::Float32, device);
+    core::Tensor y = core::Tensor::Zeros({6}, core::Dtype::Float32, device);
+    t::pipelines::kernel::ComputeJtJx(jacobians, jacobian_indices, x, y);
+    core::Tensor y_ref =
+            dense.T().Matmul(dense.Matmul(x.View({6, 1}))).View({6});
+    EXPECT_TRUE(y.AllClose(y_ref));
+
+    core::Tensor residuals(std::vector<float>{0.5, -1, 2}, {3},
+                           core::Dtype::Float32, device);
+    core::Tensor Jtr = core::Tensor::Zeros({6}, core::Dtype::Float32, device);
+    t::pipelines::kernel::ComputeJtr(jacobians, jacobian_indices, residuals,
+                                     Jtr);
+    core::Tensor Jtr_ref = dense.T().Matmul(residuals.View({3, 1})).View({6});
+    EXPECT_TRUE(Jtr.AllClose(Jtr_ref));
+}
+
+TEST_P(SparseJacobianPermuteDevices, BlockDiagonal) {
+    core::Device device = GetParam();
+    core::Tensor jacobians, jacobian_indices, dense;
+    GetJacobian(device, jacobians, jacobian_indices, dense);
+
+    core::Tensor blocks =
+            core::Tensor::Zeros({2, 3, 3}, core::Dtype::Float32, device);
+    t::pipelines::kernel::ComputeJtJBlockDiagonal(jacobians, jacobian_indices,
+                                                  blocks);
+    core::Tensor JtJ = dense.T().Matmul(dense);
+    EXPECT_TRUE(blocks[0].AllClose(JtJ.Slice(0, 0, 3).Slice(1, 0, 3)));
+    EXPECT_TRUE(blocks[1].AllClose(JtJ.Slice(0, 3, 6).Slice(1, 3, 6)));
+
+    // A singular block falls back to its inverse diagonal, with 1 for zeros.
+    core::Tensor block = core::Tensor::Eye(3, core::Dtype::Float32, device);
+    block[0][0] = core::Tensor::Init<float>(2, device);
+    core::Tensor inverse = block.Inverse();
+    core::Tensor singular =
+            core::Tensor::Zeros({1, 3, 3}, core::Dtype::Float32, device);
+    singular[0][1][1] = core::Tensor::Init<float>(4, device);
+    core::Tensor invertible = block.View({1, 3, 3}).Clone();
+    t::pipelines::kernel::InvertBlockDiagonal(invertible);
+    t::pipelines::kernel::InvertBlockDiagonal(singular);
+    EXPECT_TRUE(invertible[0].AllClose(inverse));
+
+    core::Tensor singular_ref =
+            core::Tensor::Eye(3, core::Dtype::Float32, device);
+    singular_ref[1][1] = core::Tensor::Init<float>(0.25, device);
+    EXPECT_TRUE(singular[0].AllClose(singular_ref));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/color_map/RigidOptimizer.h"
+
+#include "core/CoreTest.h"
+#include "open3d/pipelines/color_map/RigidOptimizer.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class ColorMapPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(ColorMap,
+                         ColorMapPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(ColorMapPermuteDevices, RunRigidOptimizer) {
+    core::Device device = GetParam();
+
+    // A plane at depth 1 seen by two cameras, the second one slightly off.
+    const int width = 64;
+    const int height = 48;
+    geometry::Image color, depth;
+    color.Prepare(width, height, 3, 1);
+    depth.Prepare(width, height, 1, 4);
+    for (int v = 0; v < height; ++v) {
+        for (int u = 0; u < width; ++u) {
+            *color.PointerAt<uint8_t>(u, v, 0) = uint8_t(u * 3);
+            *color.PointerAt<uint8_t>(u, v, 1) = uint8_t(v * 4);
+            *color.PointerAt<uint8_t>(u, v, 2) = uint8_t((u + v) * 2);
+            *depth.PointerAt<float>(u, v) = 1.0f;
+        }
+    }
+    std::vector<geometry::RGBDImage> images_rgbd(
+            2, geometry::RGBDImage(color, depth));
+
+    camera::PinholeCameraTrajectory camera_trajectory;
+    camera_trajectory.parameters_.resize(2);
+    for (auto& parameters : camera_trajectory.parameters_) {
+        parameters.intrinsic_.SetIntrinsics(width, height, 50.0, 50.0, 31.5,
+                                            23.5);
+        parameters.extrinsic_.setIdentity();
+    }
+    camera_trajectory.parameters_[1].extrinsic_(0, 3) = 0.01;
+
+    geometry::TriangleMesh mesh;
+    for (int i = 0; i < 30; ++i) {
+        for (int j = 0; j < 20; ++j) {
+            mesh.vertices_.emplace_back(-0.6 + 0.04 * i, -0.45 + 0.045 * j,
+                                        1.0);
+        }
+    }
+
+    pipelines::color_map::RigidOptimizerOption option;
+    option.maximum_iteration_ = 3;
+    option.image_boundary_margin_ = 2;
+    option.invisible_vertex_color_knn_ = 0;
+    geometry::TriangleMesh expected = pipelines::color_map::RunRigidOptimizer(
+            mesh, images_rgbd, camera_trajectory, option);
+    geometry::TriangleMesh result = t::pipelines::color_map::RunRigidOptimizer(
+            mesh, images_rgbd, camera_trajectory, option, device);
+
+    ASSERT_EQ(result.vertex_colors_.size(), expected.vertex_colors_.size());
+    for (size_t i = 0; i < result.vertex_colors_.size(); ++i) {
+        ExpectEQ(result.vertex_colors_[i], expected.vertex_colors_[i], 1e-2);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
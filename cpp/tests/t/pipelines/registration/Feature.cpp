@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/Feature.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/pipelines/registration/Feature.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class FeaturePermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(Feature,
+                         FeaturePermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FeaturePermuteDevices, ComputeFPFHFeature) {
+    core::Device device = GetParam();
+
+    auto pcd_legacy = io::CreatePointCloudFromFile(std::string(TEST_DATA_DIR) +
+                                                   "/ICP/cloud_bin_2.pcd")
+                              ->VoxelDownSample(0.05);
+    t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::FromLegacyPointCloud(
+                    *pcd_legacy, core::Dtype::Float64, device);
+
+    const double radius = 0.25;
+    const int max_nn = 100;
+    auto check = [&](const core::Tensor &fpfh,
+                     const geometry::KDTreeSearchParam &search_param) {
+        auto fpfh_legacy = pipelines::registration::ComputeFPFHFeature(
+                *pcd_legacy, search_param);
+        core::Tensor fpfh_ref =
+                core::eigen_converter::EigenMatrixToTensor(fpfh_legacy->data_)
+                        .T()
+                        .To(device);
+        EXPECT_EQ(fpfh.GetShape(),
+                  core::SizeVector({pcd.GetPoints().GetLength(), 33}));
+        EXPECT_TRUE(fpfh.AllClose(fpfh_ref, 1e-4, 1e-4));
+    };
+    check(t::pipelines::registration::ComputeFPFHFeature(pcd, max_nn, radius),
+          geometry::KDTreeSearchParamHybrid(radius, max_nn));
+    check(t::pipelines::registration::ComputeFPFHFeature(pcd, max_nn),
+          geometry::KDTreeSearchParamKNN(max_nn));
+    check(t::pipelines::registration::ComputeFPFHFeature(pcd, utility::nullopt,
+                                                         radius),
+          geometry::KDTreeSearchParamRadius(radius));
+
+    // Points without normals are rejected.
+    t::geometry::PointCloud pcd_no_normals(pcd.GetPoints());
+    EXPECT_ANY_THROW(
+            t::pipelines::registration::ComputeFPFHFeature(pcd_no_normals));
+}
+
+}  // namespace tests
+}  // namespace open3d
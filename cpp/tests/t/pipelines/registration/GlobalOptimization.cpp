@@ -0,0 +1,138 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/registration/GlobalOptimization.h"
+
+#include <Eigen/Dense>
+#include <cmath>
+
+#include "core/CoreTest.h"
+#include "open3d/t/pipelines/registration/PoseGraph.h"
+#include "open3d/utility/Eigen.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class GlobalOptimizationPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(GlobalOptimization,
+                         GlobalOptimizationPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+// A loop of poses whose initial estimates are perturbed. The odometry and loop
+// closure edges agree with the ground truth.
+static pipelines::registration::PoseGraph CreatePoseGraphLoop(
+        std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> &poses) {
+    const int n_nodes = 8;
+    poses.clear();
+    for (int i = 0; i < n_nodes; i++) {
+        Eigen::Vector6d v;
+        v << 0.0, 0.0, 0.8 * i, 2.0 * std::cos(0.8 * i),
+                2.0 * std::sin(0.8 * i), 0.1 * i;
+        poses.push_back(utility::TransformVector6dToMatrix4d(v));
+    }
+    poses[0].setIdentity();
+
+    pipelines::registration::PoseGraph pose_graph;
+    for (int i = 0; i < n_nodes; i++) {
+        Eigen::Vector6d noise;
+        noise << 0.02, -0.01, 0.03, 0.05, -0.04, 0.02;
+        pose_graph.nodes_.push_back(pipelines::registration::PoseGraphNode(
+                i == 0 ? poses[i]
+                       : utility::TransformVector6dToMatrix4d(noise * i) *
+                                 poses[i]));
+    }
+    for (int i = 0; i < n_nodes; i++) {
+        int j = (i + 1) % n_nodes;
+        pose_graph.edges_.push_back(pipelines::registration::PoseGraphEdge(
+                i, j, poses[j].inverse() * poses[i],
+                Eigen::Matrix6d::Identity(), /*uncertain=*/j == 0));
+    }
+    return pose_graph;
+}
+
+TEST_P(GlobalOptimizationPermuteDevices, PoseGraphFromLegacy) {
+    core::Device device = GetParam();
+
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    pipelines::registration::PoseGraph pose_graph_legacy =
+            CreatePoseGraphLoop(poses);
+    t::pipelines::registration::PoseGraph pose_graph =
+            t::pipelines::registration::PoseGraph::FromLegacy(
+                    pose_graph_legacy, device);
+    EXPECT_EQ(pose_graph.GetDevice(), device);
+    EXPECT_EQ(pose_graph.GetNodeCount(), 8);
+    EXPECT_EQ(pose_graph.GetEdgeCount(), 8);
+
+    pipelines::registration::PoseGraph pose_graph_back = pose_graph.ToLegacy();
+    ASSERT_EQ(pose_graph_back.nodes_.size(), pose_graph_legacy.nodes_.size());
+    ASSERT_EQ(pose_graph_back.edges_.size(), pose_graph_legacy.edges_.size());
+    for (size_t i = 0; i < pose_graph_legacy.nodes_.size(); i++) {
+        ExpectEQ(Eigen::Matrix4d(pose_graph_back.nodes_[i].pose_),
+                 Eigen::Matrix4d(pose_graph_legacy.nodes_[i].pose_));
+    }
+    for (size_t i = 0; i < pose_graph_legacy.edges_.size(); i++) {
+        const auto &edge = pose_graph_legacy.edges_[i];
+        const auto &edge_back = pose_graph_back.edges_[i];
+        EXPECT_EQ(edge_back.source_node_id_, edge.source_node_id_);
+        EXPECT_EQ(edge_back.target_node_id_, edge.target_node_id_);
+        EXPECT_EQ(edge_back.uncertain_, edge.uncertain_);
+        EXPECT_DOUBLE_EQ(edge_back.confidence_, edge.confidence_);
+        ExpectEQ(Eigen::Matrix4d(edge_back.transformation_),
+                 Eigen::Matrix4d(edge.transformation_));
+    }
+}
+
+TEST_P(GlobalOptimizationPermuteDevices, GlobalOptimization) {
+    core::Device device = GetParam();
+
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    t::pipelines::registration::PoseGraph pose_graph =
+            t::pipelines::registration::PoseGraph::FromLegacy(
+                    CreatePoseGraphLoop(poses), device);
+
+    pipelines::registration::GlobalOptimizationConvergenceCriteria criteria;
+    pipelines::registration::GlobalOptimizationOption option(
+            /*max_correspondence_distance=*/0.075,
+            /*edge_prune_threshold=*/0.25,
+            /*preference_loop_closure=*/1.0,
+            /*reference_node=*/0);
+    t::pipelines::registration::GlobalOptimization(pose_graph, criteria,
+                                                   option);
+
+    EXPECT_EQ(pose_graph.GetDevice(), device);
+    pipelines::registration::PoseGraph pose_graph_legacy =
+            pose_graph.ToLegacy();
+    ASSERT_EQ(int(pose_graph_legacy.nodes_.size()), 8);
+    ASSERT_EQ(int(pose_graph_legacy.edges_.size()), 8);
+    for (int i = 0; i < 8; i++) {
+        ExpectEQ(Eigen::Matrix4d(pose_graph_legacy.nodes_[i].pose_), poses[i],
+                 1e-3);
+    }
+}
+
+}  // namespace tests
+}  // namespace open3d
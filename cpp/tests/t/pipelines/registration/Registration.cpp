@@ -47,6 +47,7 @@ TEST_P(RegistrationPermuteDevices, ICPConvergenceCriteriaConstructor) {
     EXPECT_EQ(convergence_criteria.max_iteration_, 30);
     EXPECT_DOUBLE_EQ(convergence_criteria.relative_fitness_, 1e-6);
     EXPECT_DOUBLE_EQ(convergence_criteria.relative_rmse_, 1e-6);
+    EXPECT_DOUBLE_EQ(convergence_criteria.correspondence_reuse_distance_, 0.0);
 }
 
 TEST_P(RegistrationPermuteDevices, RegistrationResultConstructor) {
@@ -196,6 +197,148 @@ TEST_P(RegistrationPermuteDevices, RegistrationICPPointToPoint) {
     EXPECT_NEAR(reg_p2p_t.inlier_rmse_, reg_p2p_l.inlier_rmse_, 0.0005);
 }
 
+TEST_P(RegistrationPermuteDevices, RegistrationICPCorrespondenceReuse) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    std::vector<float> src_points_vec{
+            1.15495,  2.40671, 1.15061,  1.81481,  2.06281, 1.71927, 0.888322,
+            2.05068,  2.04879, 3.78842,  1.70788,  1.30246, 1.8437,  2.22894,
+            0.986237, 2.95706, 2.2018,   0.987878, 1.72644, 1.24356, 1.93486,
+            0.922024, 1.14872, 2.34317,  3.70293,  1.85134, 1.15357, 3.06505,
+            1.30386,  1.55279, 0.634826, 1.04995,  2.47046, 1.40107, 1.37469,
+            1.09687,  2.93002, 1.96242,  1.48532,  3.74384, 1.30258, 1.30244};
+    core::Tensor source_points(src_points_vec, {14, 3}, dtype, device);
+    t::geometry::PointCloud source_device(device);
+    source_device.SetPoints(source_points);
+
+    std::vector<float> target_points_vec{
+            2.41766, 2.05397, 1.74994, 1.37848, 2.19793, 1.66553, 2.24325,
+            2.27183, 1.33708, 3.09898, 1.98482, 1.77401, 1.81615, 1.48337,
+            1.49697, 3.01758, 2.20312, 1.51502, 2.38836, 1.39096, 1.74914,
+            1.30911, 1.4252,  1.37429, 3.16847, 1.39194, 1.90959, 1.59412,
+            1.53304, 1.5804,  1.34342, 2.19027, 1.30075};
+    core::Tensor target_points(target_points_vec, {11, 3}, dtype, device);
+    t::geometry::PointCloud target_device(device);
+    target_device.SetPoints(target_points);
+
+    core::Tensor init_trans_t =
+            core::Tensor::Eye(4, core::Dtype::Float64, device);
+    double max_correspondence_dist = 1.25;
+    int max_iterations = 5;
+
+    auto run_icp = [&](double reuse_distance) {
+        return t::pipelines::registration::RegistrationICP(
+                source_device, target_device, max_correspondence_dist,
+                init_trans_t,
+                t::pipelines::registration::
+                        TransformationEstimationPointToPoint(),
+                t::pipelines::registration::ICPConvergenceCriteria(
+                        1e-6, 1e-6, max_iterations, reuse_distance));
+    };
+
+    // A negligible reuse distance searches in every iteration.
+    t::pipelines::registration::RegistrationResult reg_search = run_icp(0.0);
+    t::pipelines::registration::RegistrationResult reg_tiny = run_icp(1e-12);
+    EXPECT_NEAR(reg_tiny.fitness_, reg_search.fitness_, 1e-6);
+    EXPECT_NEAR(reg_tiny.inlier_rmse_, reg_search.inlier_rmse_, 1e-6);
+    EXPECT_TRUE(reg_tiny.transformation_.AllClose(reg_search.transformation_));
+
+    // A large reuse distance keeps the initial correspondences, of which the
+    // pairs that moved out of range are dropped.
+    t::pipelines::registration::RegistrationResult evaluation =
+            t::pipelines::registration::EvaluateRegistration(
+                    source_device, target_device, max_correspondence_dist,
+                    init_trans_t);
+    t::pipelines::registration::RegistrationResult reg_reuse = run_icp(1e9);
+    EXPECT_GT(reg_reuse.fitness_, 0.0);
+    EXPECT_LE(reg_reuse.fitness_, evaluation.fitness_);
+    EXPECT_LE(reg_reuse.correspondence_set_.first.GetLength(),
+              evaluation.correspondence_set_.first.GetLength());
+}
+
+TEST_P(RegistrationPermuteDevices, RegistrationICPPreparedTarget) {
+    core::Device device = GetParam();
+    core::Dtype dtype = core::Dtype::Float32;
+
+    std::vector<float> src_points_vec{
+            1.15495,  2.40671, 1.15061,  1.81481,  2.06281, 1.71927, 0.888322,
+            2.05068,  2.04879, 3.78842,  1.70788,  1.30246, 1.8437,  2.22894,
+            0.986237, 2.95706, 2.2018,   0.987878, 1.72644, 1.24356, 1.93486,
+            0.922024, 1.14872, 2.34317,  3.70293,  1.85134, 1.15357, 3.06505,
+            1.30386,  1.55279, 0.634826, 1.04995,  2.47046, 1.40107, 1.37469,
+            1.09687,  2.93002, 1.96242,  1.48532,  3.74384, 1.30258, 1.30244};
+    core::Tensor source_points(src_points_vec, {14, 3}, dtype, device);
+    t::geometry::PointCloud source_device(device);
+    source_device.SetPoints(source_points);
+
+    std::vector<float> target_points_vec{
+            2.41766, 2.05397, 1.74994, 1.37848, 2.19793, 1.66553, 2.24325,
+            2.27183, 1.33708, 3.09898, 1.98482, 1.77401, 1.81615, 1.48337,
+            1.49697, 3.01758, 2.20312, 1.51502, 2.38836, 1.39096, 1.74914,
+            1.30911, 1.4252,  1.37429, 3.16847, 1.39194, 1.90959, 1.59412,
+            1.53304, 1.5804,  1.34342, 2.19027, 1.30075};
+    core::Tensor target_points(target_points_vec, {11, 3}, dtype, device);
+    t::geometry::PointCloud target_device(device);
+    target_device.SetPoints(target_points);
+
+    core::Tensor init_trans_t =
+            core::Tensor::Eye(4, core::Dtype::Float64, device);
+    t::pipelines::registration::ICPConvergenceCriteria criteria(1e-6, 1e-6,
+                                                                 5);
+
+    // Single scale.
+    double max_correspondence_dist = 1.25;
+    t::pipelines::registration::ICPTarget target(target_device,
+                                                 max_correspondence_dist);
+    EXPECT_EQ(target.NumScales(), 1);
+    EXPECT_EQ(target.GetDevice(), device);
+    t::pipelines::registration::RegistrationResult reg_t =
+            t::pipelines::registration::RegistrationICP(
+                    source_device, target_device, max_correspondence_dist,
+                    init_trans_t,
+                    t::pipelines::registration::
+                            TransformationEstimationPointToPoint(),
+                    criteria);
+    // The prepared target is reused by several calls.
+    for (int i = 0; i < 2; ++i) {
+        t::pipelines::registration::RegistrationResult reg_prepared =
+                t::pipelines::registration::RegistrationICP(
+                        source_device, target, init_trans_t,
+                        t::pipelines::registration::
+                                TransformationEstimationPointToPoint(),
+                        criteria);
+        EXPECT_DOUBLE_EQ(reg_prepared.fitness_, reg_t.fitness_);
+        EXPECT_DOUBLE_EQ(reg_prepared.inlier_rmse_, reg_t.inlier_rmse_);
+        EXPECT_TRUE(reg_prepared.transformation_.AllClose(
+                reg_t.transformation_));
+    }
+
+    // Multi-scale.
+    std::vector<double> voxel_sizes{0.5, -1};
+    std::vector<double> max_correspondence_dists{1.5, 1.25};
+    t::pipelines::registration::ICPTarget multi_scale_target(
+            target_device, voxel_sizes, max_correspondence_dists);
+    EXPECT_EQ(multi_scale_target.NumScales(), 2);
+    t::pipelines::registration::RegistrationResult reg_multi_scale_t =
+            t::pipelines::registration::RegistrationMultiScaleICP(
+                    source_device, target_device, voxel_sizes,
+                    {criteria, criteria}, max_correspondence_dists,
+                    init_trans_t);
+    t::pipelines::registration::RegistrationResult reg_multi_scale_prepared =
+            t::pipelines::registration::RegistrationMultiScaleICP(
+                    source_device, multi_scale_target, {criteria, criteria},
+                    init_trans_t);
+    EXPECT_DOUBLE_EQ(reg_multi_scale_prepared.fitness_,
+                     reg_multi_scale_t.fitness_);
+    EXPECT_DOUBLE_EQ(reg_multi_scale_prepared.inlier_rmse_,
+                     reg_multi_scale_t.inlier_rmse_);
+
+    // The number of criteria has to match the scales of the target.
+    EXPECT_ANY_THROW(t::pipelines::registration::RegistrationMultiScaleICP(
+            source_device, multi_scale_target, {criteria}, init_trans_t));
+}
+
 TEST_P(RegistrationPermuteDevices, RegistrationICPPointToPlane) {
     core::Device device = GetParam();
     core::Dtype dtype = core::Dtype::Float32;
@@ -272,5 +415,61 @@ TEST_P(RegistrationPermuteDevices, RegistrationICPPointToPlane) {
     EXPECT_NEAR(reg_p2plane_t.inlier_rmse_, reg_p2plane_l.inlier_rmse_, 0.0005);
 }
 
+TEST_P(RegistrationPermuteDevices, RegistrationRANSACBasedOnCorrespondence) {
+    core::Device device = GetParam();
+
+    t::pipelines::registration::RANSACConvergenceCriteria criteria;
+    EXPECT_EQ(criteria.max_iteration_, 100000);
+    EXPECT_DOUBLE_EQ(criteria.confidence_, 0.999);
+    EXPECT_EQ(criteria.batch_size_, 1000);
+
+    // The target is the source moved by a rotation about z and a translation.
+    const int64_t n = 60;
+    std::vector<float> points_vec;
+    for (int64_t i = 0; i < n; ++i) {
+        points_vec.push_back(std::sin(1.3f * i));
+        points_vec.push_back(std::cos(0.7f * i));
+        points_vec.push_back(std::sin(0.37f * i + 1.0f));
+    }
+    t::geometry::PointCloud source_device(core::Tensor(
+            points_vec, {n, 3}, core::Dtype::Float32, device));
+    const double angle = 0.5, c = std::cos(angle), s = std::sin(angle);
+    core::Tensor transformation = core::Tensor::Init<double>(
+            {{c, -s, 0, 0.3}, {s, c, 0, -0.2}, {0, 0, 1, 0.1}, {0, 0, 0, 1}});
+    t::geometry::PointCloud target_device = source_device.Clone();
+    target_device.Transform(transformation.To(device, core::Dtype::Float32));
+
+    // 40 correct correspondences, followed by 20 wrong ones.
+    std::vector<int64_t> first_vec, second_vec;
+    for (int64_t i = 0; i < n; ++i) {
+        first_vec.push_back(i);
+        second_vec.push_back(i < 40 ? i : (i + 7) % n);
+    }
+    t::pipelines::registration::CorrespondenceSet correspondences(
+            core::Tensor(first_vec, {n}, core::Dtype::Int64, device),
+            core::Tensor(second_vec, {n}, core::Dtype::Int64, device));
+
+    t::pipelines::registration::RegistrationResult result =
+            t::pipelines::registration::RegistrationRANSACBasedOnCorrespondence(
+                    source_device, target_device, correspondences, 0.01, 3,
+                    t::pipelines::registration::RANSACConvergenceCriteria(
+                            10000, 0.999, 256));
+    EXPECT_TRUE(result.transformation_.AllClose(transformation, 1e-3, 1e-3));
+    EXPECT_NEAR(result.fitness_, 40.0 / 60.0, 1e-6);
+    EXPECT_LT(result.inlier_rmse_, 1e-4);
+    EXPECT_EQ(result.correspondence_set_.first.GetLength(), 40);
+    EXPECT_TRUE(result.correspondence_set_.second.To(core::Device("CPU:0"))
+                        .Lt(40)
+                        .All());
+
+    // Too few correspondences for a sample give an empty result.
+    t::pipelines::registration::RegistrationResult empty_result =
+            t::pipelines::registration::RegistrationRANSACBasedOnCorrespondence(
+                    source_device, target_device, correspondences, 0.01, 61);
+    EXPECT_DOUBLE_EQ(empty_result.fitness_, 0.0);
+    EXPECT_TRUE(empty_result.transformation_.AllClose(core::Tensor::Eye(
+            4, core::Dtype::Float64, core::Device("CPU:0"))));
+}
+
 }  // namespace tests
 }  // namespace open3d
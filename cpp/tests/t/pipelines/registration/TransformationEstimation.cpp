@@ -28,6 +28,7 @@
 
 #include "core/CoreTest.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/ComputeTransform.h"
 #include "open3d/t/pipelines/registration/Registration.h"
 #include "tests/UnitTest.h"
 
@@ -296,6 +297,160 @@ TEST_P(TransformationEstimationPermuteDevices,
 
     // Compare the new RMSE, after transformation.
     EXPECT_NEAR(p2plane_rmse, 0.41425, 0.0005);
+
+    // Same pose from the target index of every source point, -1 if none.
+    core::Tensor target_indices = core::Tensor::Init<int64_t>(
+            {10, 1, 1, 3, 2, 5, 9, -1, 5, 8, -1, 7, 5, 8}, device);
+    core::Tensor pose = t::pipelines::kernel::ComputePosePointToPlane(
+            source_points, target_points, target_normals, corres);
+    core::Tensor pose_dense = t::pipelines::kernel::ComputePosePointToPlane(
+            source_points, target_points, target_normals, target_indices);
+    EXPECT_TRUE(pose_dense.AllClose(pose, 1e-5, 1e-6));
+}
+
+TEST_P(TransformationEstimationPermuteDevices,
+       ComputeTransformationGeneralizedICP) {
+    core::Device device = GetParam();
+
+    // Points on three orthogonal planes, with their normals.
+    std::vector<float> points_vec, normals_vec;
+    for (int plane = 0; plane < 3; ++plane) {
+        for (int u = 1; u <= 6; ++u) {
+            for (int v = 1; v <= 6; ++v) {
+                float p[3] = {0, 0, 0}, n[3] = {0, 0, 0};
+                p[(plane + 1) % 3] = 0.1f * u;
+                p[(plane + 2) % 3] = 0.1f * v;
+                n[plane] = 1;
+                points_vec.insert(points_vec.end(), p, p + 3);
+                normals_vec.insert(normals_vec.end(), n, n + 3);
+            }
+        }
+    }
+    const int64_t n = int64_t(points_vec.size() / 3);
+    t::geometry::PointCloud target_device(device);
+    target_device.SetPoints(core::Tensor(points_vec, {n, 3},
+                                         core::Dtype::Float32, device));
+    target_device.SetPointNormals(core::Tensor(normals_vec, {n, 3},
+                                               core::Dtype::Float32, device));
+
+    // The source is the target moved by the inverse of a rotation about z
+    // and a translation.
+    const double angle = 0.03, c = std::cos(angle), s = std::sin(angle);
+    const double tx = 0.02, ty = -0.01, tz = 0.015;
+    core::Tensor transformation = core::Tensor::Init<double>(
+            {{c, -s, 0, tx}, {s, c, 0, ty}, {0, 0, 1, tz}, {0, 0, 0, 1}});
+    core::Tensor inverse = core::Tensor::Init<double>(
+            {{c, s, 0, -(c * tx + s * ty)},
+             {-s, c, 0, -(-s * tx + c * ty)},
+             {0, 0, 1, -tz},
+             {0, 0, 0, 1}});
+    t::geometry::PointCloud source_device = target_device.Clone();
+    source_device.Transform(inverse.To(device, core::Dtype::Float32));
+
+    t::pipelines::registration::TransformationEstimationForGeneralizedICP
+            estimation_gicp;
+    EXPECT_EQ(estimation_gicp.GetTransformationEstimationType(),
+              t::pipelines::registration::TransformationEstimationType::
+                      GeneralizedICP);
+
+    t::pipelines::registration::RegistrationResult reg_gicp =
+            t::pipelines::registration::RegistrationICP(
+                    source_device, target_device, 0.08,
+                    core::Tensor::Eye(4, core::Dtype::Float64,
+                                      core::Device("CPU:0")),
+                    estimation_gicp,
+                    t::pipelines::registration::ICPConvergenceCriteria(
+                            1e-6, 1e-6, 30));
+    EXPECT_TRUE(reg_gicp.transformation_.AllClose(transformation, 1e-3,
+                                                  1e-3));
+    EXPECT_NEAR(reg_gicp.fitness_, 1.0, 1e-6);
+
+    // The Mahalanobis RMSE vanishes at the registered pose.
+    source_device.Transform(
+            reg_gicp.transformation_.To(device, core::Dtype::Float32));
+    EXPECT_NEAR(estimation_gicp.ComputeRMSE(source_device, target_device,
+                                            reg_gicp.correspondence_set_),
+                0.0, 1e-3);
+
+    // Normals are required.
+    t::geometry::PointCloud source_no_normals(source_device.GetPoints());
+    EXPECT_ANY_THROW(estimation_gicp.ComputeTransformation(
+            source_no_normals, target_device, reg_gicp.correspondence_set_));
+}
+
+TEST_P(TransformationEstimationPermuteDevices,
+       ComputeTransformationColoredICP) {
+    core::Device device = GetParam();
+
+    // A planar grid with a smooth intensity, which constrains the in-plane
+    // motion that the geometric term alone leaves free.
+    std::vector<float> points_vec, colors_vec;
+    for (int u = 0; u < 8; ++u) {
+        for (int v = 0; v < 8; ++v) {
+            const float x = 0.1f * (u + 1), y = 0.1f * (v + 1);
+            const float intensity = 0.2f + 0.5f * x * x + 0.3f * y;
+            points_vec.insert(points_vec.end(), {x, y, 0});
+            colors_vec.insert(colors_vec.end(),
+                              {intensity, intensity, intensity});
+        }
+    }
+    const int64_t n = int64_t(points_vec.size() / 3);
+    t::geometry::PointCloud target_device(device);
+    target_device.SetPoints(core::Tensor(points_vec, {n, 3},
+                                         core::Dtype::Float32, device));
+    target_device.SetPointColors(core::Tensor(colors_vec, {n, 3},
+                                              core::Dtype::Float32, device));
+    target_device.SetPointNormals(core::Tensor::Init<float>({0, 0, 1}, device)
+                                          .Reshape({1, 3})
+                                          .Expand({n, 3})
+                                          .Contiguous());
+
+    // The source is the target moved in its plane by the inverse of a
+    // rotation about z and a translation.
+    const double angle = 0.02, c = std::cos(angle), s = std::sin(angle);
+    const double tx = 0.02, ty = -0.01;
+    core::Tensor transformation = core::Tensor::Init<double>(
+            {{c, -s, 0, tx}, {s, c, 0, ty}, {0, 0, 1, 0}, {0, 0, 0, 1}});
+    core::Tensor inverse = core::Tensor::Init<double>(
+            {{c, s, 0, -(c * tx + s * ty)},
+             {-s, c, 0, -(-s * tx + c * ty)},
+             {0, 0, 1, 0},
+             {0, 0, 0, 1}});
+    t::geometry::PointCloud source_device = target_device.Clone();
+    source_device.Transform(inverse.To(device, core::Dtype::Float32));
+
+    t::pipelines::registration::TransformationEstimationForColoredICP
+            estimation_cicp;
+    EXPECT_EQ(estimation_cicp.GetTransformationEstimationType(),
+              t::pipelines::registration::TransformationEstimationType::
+                      ColoredICP);
+
+    // The color gradients of the target are estimated by the registration.
+    t::pipelines::registration::RegistrationResult reg_cicp =
+            t::pipelines::registration::RegistrationICP(
+                    source_device, target_device, 0.08,
+                    core::Tensor::Eye(4, core::Dtype::Float64,
+                                      core::Device("CPU:0")),
+                    estimation_cicp,
+                    t::pipelines::registration::ICPConvergenceCriteria(
+                            1e-6, 1e-6, 50));
+    EXPECT_TRUE(reg_cicp.transformation_.AllClose(transformation, 1e-3,
+                                                  1e-3));
+    EXPECT_NEAR(reg_cicp.fitness_, 1.0, 1e-6);
+    EXPECT_FALSE(target_device.HasPointAttr("color_gradients"));
+
+    // The weighted RMSE vanishes at the registered pose.
+    target_device.EstimateColorGradients(30, 0.16);
+    source_device.Transform(
+            reg_cicp.transformation_.To(device, core::Dtype::Float32));
+    EXPECT_NEAR(estimation_cicp.ComputeRMSE(source_device, target_device,
+                                            reg_cicp.correspondence_set_),
+                0.0, 1e-3);
+
+    // Colors are required.
+    t::geometry::PointCloud source_no_colors(source_device.GetPoints());
+    EXPECT_ANY_THROW(estimation_cicp.ComputeTransformation(
+            source_no_colors, target_device, reg_cicp.correspondence_set_));
 }
 
 }  // namespace tests
@@ -78,6 +78,35 @@ TEST_P(ControlGridPermuteDevices, Deform) {
     curr[2][1] += 0.5;
 }
 
+TEST_P(ControlGridPermuteDevices, DeformFused) {
+    core::Device device = GetParam();
+    t::pipelines::slac::ControlGrid cgrid(0.5, 1000, device);
+
+    t::geometry::PointCloud pcd = CreateTPCDFromFile(
+            std::string(TEST_DATA_DIR) + "/ICP/cloud_bin_0.pcd", device);
+    cgrid.Touch(pcd);
+    cgrid.Compactify();
+
+    // The undeformed grid interpolates the points themselves.
+    t::geometry::PointCloud pcd_param = cgrid.Parameterize(pcd);
+    EXPECT_EQ(pcd_param.GetPoints().GetLength(), pcd.GetPoints().GetLength());
+    t::geometry::PointCloud pcd_deformed = cgrid.Deform(pcd_param);
+    EXPECT_TRUE(pcd_deformed.GetPoints().AllClose(pcd.GetPoints(), 1e-5,
+                                                  1e-5));
+
+    // Deforming without parameterization matches the two passes.
+    core::Tensor curr = cgrid.GetCurrPositions();
+    curr[0][0] += 0.2;
+    curr[1][2] -= 0.2;
+    curr[2][1] += 0.2;
+    t::geometry::PointCloud pcd_two_pass = cgrid.Deform(pcd_param);
+    t::geometry::PointCloud pcd_fused = cgrid.Deform(pcd);
+    EXPECT_TRUE(pcd_fused.GetPoints().AllClose(pcd_two_pass.GetPoints(), 1e-5,
+                                               1e-5));
+    EXPECT_TRUE(pcd_fused.GetPointNormals().AllClose(
+            pcd_two_pass.GetPointNormals(), 1e-5, 1e-5));
+}
+
 TEST_P(ControlGridPermuteDevices, Regularizer) {
     core::Device device = GetParam();
     t::pipelines::slac::ControlGrid cgrid(0.5, 1000, device);
@@ -0,0 +1,96 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/pipelines/slac/FragmentLoader.h"
+
+#include "core/CoreTest.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/io/PointCloudIO.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+class FragmentLoaderPermuteDevices : public PermuteDevices {};
+INSTANTIATE_TEST_SUITE_P(FragmentLoader,
+                         FragmentLoaderPermuteDevices,
+                         testing::ValuesIn(PermuteDevices::TestCases()));
+
+TEST_P(FragmentLoaderPermuteDevices, Pop) {
+    core::Device device = GetParam();
+
+    std::vector<std::string> fnames = {
+            std::string(TEST_DATA_DIR) + "/ICP/cloud_bin_0.pcd",
+            std::string(TEST_DATA_DIR) + "/ICP/cloud_bin_2.pcd",
+            std::string(TEST_DATA_DIR) + "/ICP/cloud_bin_0.pcd"};
+    std::vector<t::geometry::PointCloud> pcds;
+    for (auto& fname : fnames) {
+        auto pcd = io::CreatePointCloudFromFile(fname);
+        pcds.push_back(t::geometry::PointCloud::FromLegacyPointCloud(
+                *pcd, core::Dtype::Float32, device));
+    }
+
+    // The fragments are popped in order for any capacity.
+    for (size_t capacity : {1, 2, 4}) {
+        t::pipelines::slac::FragmentLoader loader(fnames, device, capacity);
+        for (auto& pcd : pcds) {
+            t::geometry::PointCloud fragment;
+            EXPECT_TRUE(loader.Pop(fragment));
+            EXPECT_EQ(fragment.GetDevice(), device);
+            EXPECT_TRUE(fragment.GetPoints().AllClose(pcd.GetPoints()));
+            // Some normals are NaN, which IsClose() never matches.
+            core::Tensor normals = fragment.GetPointNormals();
+            core::Tensor normals_ref = pcd.GetPointNormals();
+            EXPECT_TRUE((normals.IsClose(normals_ref) ||
+                         (normals.IsNan() && normals_ref.IsNan()))
+                                .All());
+        }
+        t::geometry::PointCloud fragment;
+        EXPECT_FALSE(loader.Pop(fragment));
+    }
+
+    // Fragments not popped are dropped.
+    {
+        t::pipelines::slac::FragmentLoader loader(fnames, device, 2);
+        t::geometry::PointCloud fragment;
+        EXPECT_TRUE(loader.Pop(fragment));
+    }
+
+    // A missing fragment is popped as an empty point cloud, like reading it
+    // directly.
+    t::pipelines::slac::FragmentLoader loader(
+            {std::string(TEST_DATA_DIR) + "/does_not_exist.pcd", fnames[1]},
+            device);
+    t::geometry::PointCloud fragment;
+    EXPECT_TRUE(loader.Pop(fragment));
+    EXPECT_TRUE(fragment.IsEmpty());
+    EXPECT_TRUE(loader.Pop(fragment));
+    EXPECT_TRUE(fragment.GetPoints().AllClose(pcds[1].GetPoints()));
+    EXPECT_FALSE(loader.Pop(fragment));
+}
+
+}  // namespace tests
+}  // namespace open3d
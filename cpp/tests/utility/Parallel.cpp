@@ -0,0 +1,86 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/utility/Parallel.h"
+
+#include <atomic>
+#include <vector>
+
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+TEST(Parallel, SetNumThreads) {
+    const int num_threads = utility::GetNumThreads();
+    utility::SetNumThreads(2);
+    EXPECT_EQ(utility::GetNumThreads(), 2);
+    utility::SetNumThreads(0);
+    EXPECT_EQ(utility::GetNumThreads(), utility::GetDefaultNumThreads());
+    utility::SetNumThreads(num_threads);
+}
+
+TEST(Parallel, ScopedNumThreads) {
+    const int num_threads = utility::GetNumThreads();
+    EXPECT_EQ(utility::GetScopedTaskArena(), nullptr);
+    {
+        utility::ScopedNumThreads outer(3);
+        EXPECT_EQ(utility::GetNumThreads(), 3);
+        {
+            utility::ScopedNumThreads inner(1);
+            EXPECT_EQ(utility::GetNumThreads(), 1);
+        }
+        EXPECT_EQ(utility::GetNumThreads(), 3);
+        EXPECT_NE(utility::GetScopedTaskArena(), nullptr);
+    }
+    EXPECT_EQ(utility::GetNumThreads(), num_threads);
+    EXPECT_EQ(utility::GetScopedTaskArena(), nullptr);
+    EXPECT_THROW(utility::ScopedNumThreads(0), std::runtime_error);
+}
+
+TEST(Parallel, ParallelFor) {
+    std::vector<int> values(10000, 0);
+    std::atomic<int64_t> sum(0);
+    auto func = [&](int64_t i) {
+        values[i] = int(i);
+        sum += i;
+    };
+    utility::ParallelFor(0, int64_t(values.size()), func);
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(values[i], int(i));
+    }
+    EXPECT_EQ(sum, int64_t(values.size()) * (int64_t(values.size()) - 1) / 2);
+
+    utility::ScopedNumThreads scope(1);
+    sum = 0;
+    utility::ParallelFor(10, 20, func, 4);
+    EXPECT_EQ(sum, 145);
+    utility::ParallelFor(20, 10, func);
+    EXPECT_EQ(sum, 145);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,91 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/gui/FrameProfiler.h"
+
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+using visualization::gui::FrameProfiler;
+
+static FrameProfiler::Frame MakeFrame(double start) {
+    FrameProfiler::Frame frame;
+    frame.start = start;
+    frame.ui_end = start + 0.002;
+    frame.scene_end = start + 0.006;
+    frame.end = start + 0.010;
+    return frame;
+}
+
+TEST(FrameProfiler, AddFrame) {
+    FrameProfiler profiler(3);
+    profiler.AddFrame(MakeFrame(0.0));
+    EXPECT_TRUE(profiler.GetFrames().empty());
+
+    profiler.SetEnabled(true);
+    for (int i = 0; i < 5; ++i) {
+        profiler.AddFrame(MakeFrame(0.02 * i));
+    }
+    ASSERT_EQ(profiler.GetFrames().size(), 3u);
+    EXPECT_DOUBLE_EQ(profiler.GetFrames().front().start, 0.04);
+    EXPECT_NEAR(profiler.GetFramesPerSecond(), 50.0, 1e-9);
+
+    auto average = profiler.GetAverage(2);
+    EXPECT_DOUBLE_EQ(average.start, 0.06);
+    EXPECT_NEAR(average.GetUIMs(), 2.0, 1e-9);
+    EXPECT_NEAR(average.GetSceneMs(), 4.0, 1e-9);
+    EXPECT_NEAR(average.GetPresentMs(), 4.0, 1e-9);
+    EXPECT_NEAR(average.GetTotalMs(), 10.0, 1e-9);
+
+    profiler.Clear();
+    EXPECT_EQ(profiler.GetAverage(10).GetTotalMs(), 0.0);
+    EXPECT_EQ(profiler.GetFramesPerSecond(), 0.0);
+}
+
+TEST(FrameProfiler, WriteTrace) {
+    FrameProfiler profiler;
+    profiler.SetEnabled(true);
+    profiler.AddFrame(MakeFrame(1.0));
+    profiler.AddFrame(MakeFrame(1.02));
+
+    const std::string path = "frame_profiler_trace.json";
+    ASSERT_TRUE(profiler.WriteTrace(path));
+    std::vector<char> bytes;
+    ASSERT_TRUE(utility::filesystem::FReadToBuffer(path, bytes, nullptr));
+    utility::filesystem::RemoveFile(path);
+    const std::string trace(bytes.begin(), bytes.end());
+
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\": \"Scene\", \"ph\": \"X\", \"pid\": 0, "
+                         "\"tid\": 0, \"ts\": 1002000, \"dur\": 4000"),
+              std::string::npos);
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -0,0 +1,181 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/visualization/rendering/PointCloudLODStreamer.h"
+
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <set>
+
+#include "open3d/core/Dtype.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudLOD.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/UnitTest.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+std::shared_ptr<t::io::PointCloudLOD> CreateLOD(const std::string &directory) {
+    const int64_t num_points = 5000;
+    std::mt19937 engine(0);
+    std::uniform_real_distribution<float> distribution(-1, 1);
+    std::vector<float> points(3 * num_points);
+    for (float &value : points) {
+        value = distribution(engine);
+    }
+    t::geometry::PointCloud pcd(
+            core::Tensor(points, {num_points, 3}, core::Dtype::Float32));
+    t::io::PointCloudLODOptions options;
+    options.max_node_points_ = 200;
+    options.grid_size_ = 8;
+    EXPECT_TRUE(t::io::WritePointCloudLOD(pcd, directory, options));
+    auto lod = std::make_shared<t::io::PointCloudLOD>();
+    EXPECT_TRUE(lod->Open(directory));
+    return lod;
+}
+
+void RemoveLOD(const t::io::PointCloudLOD &lod) {
+    for (const auto &node : lod.nodes_) {
+        std::remove((lod.directory_ + "/" + node.name_ + ".o3dt").c_str());
+    }
+    std::remove((lod.directory_ + "/lod.json").c_str());
+    utility::filesystem::DeleteDirectory(lod.directory_);
+}
+
+/// Resident and shown nodes of a renderer that applies the changes.
+struct RendererState {
+    std::set<int> resident;
+    std::set<int> shown;
+
+    void Apply(const visualization::rendering::PointCloudLODStreamer::Changes
+                       &changes) {
+        for (const auto &node_pointcloud : changes.added) {
+            EXPECT_TRUE(resident.insert(node_pointcloud.first).second);
+            EXPECT_TRUE(node_pointcloud.second->HasPoints());
+        }
+        for (int node : changes.hidden) {
+            EXPECT_EQ(shown.erase(node), 1u);
+        }
+        for (int node : changes.shown) {
+            EXPECT_TRUE(resident.count(node));
+            EXPECT_TRUE(shown.insert(node).second);
+        }
+        for (int node : changes.removed) {
+            EXPECT_FALSE(shown.count(node));
+            EXPECT_EQ(resident.erase(node), 1u);
+        }
+    }
+};
+
+/// Updates \p streamer until all the selected nodes are loaded.
+void UpdateUntilLoaded(
+        visualization::rendering::PointCloudLODStreamer &streamer,
+        RendererState &state,
+        const Eigen::Vector3d &eye) {
+    for (int i = 0; i < 1000; ++i) {
+        streamer.WaitForLoads();
+        const auto changes = streamer.Update(eye, 1000);
+        state.Apply(changes);
+        if (changes.added.empty() && !streamer.HasPendingLoads()) {
+            return;
+        }
+    }
+    FAIL() << "The selected nodes were not loaded.";
+}
+
+}  // namespace
+
+TEST(PointCloudLODStreamer, Update) {
+    const std::string directory = std::string(TEST_DATA_DIR) + "/test_lod";
+    auto lod = CreateLOD(directory);
+    visualization::rendering::PointCloudLODSettings settings;
+    settings.point_budget = 5000;
+    settings.max_error_pixels = 1;
+    settings.max_uploads_per_frame = 2;
+    settings.max_resident_points = 5000;
+    RendererState state;
+    {
+        visualization::rendering::PointCloudLODStreamer streamer(lod,
+                                                                 settings);
+
+        // Nothing is shown before the first node is loaded.
+        const auto changes = streamer.Update(Eigen::Vector3d::Zero(), 1000);
+        EXPECT_TRUE(changes.added.empty());
+        EXPECT_TRUE(changes.shown.empty());
+
+        // A close camera shows all the nodes.
+        UpdateUntilLoaded(streamer, state, Eigen::Vector3d::Zero());
+        EXPECT_EQ(state.shown.size(), lod->nodes_.size());
+        EXPECT_EQ(streamer.GetShownPoints(), 5000);
+
+        // A distant camera only shows the root and keeps the other nodes.
+        UpdateUntilLoaded(streamer, state, Eigen::Vector3d(0, 0, 1e6));
+        EXPECT_EQ(state.shown, std::set<int>{0});
+        EXPECT_EQ(state.resident.size(), lod->nodes_.size());
+        for (int node = 0; node < int(lod->nodes_.size()); ++node) {
+            EXPECT_EQ(streamer.IsResident(node), state.resident.count(node));
+            EXPECT_EQ(streamer.IsShown(node), state.shown.count(node));
+        }
+    }
+    RemoveLOD(*lod);
+}
+
+TEST(PointCloudLODStreamer, Eviction) {
+    const std::string directory = std::string(TEST_DATA_DIR) + "/test_lod";
+    auto lod = CreateLOD(directory);
+    visualization::rendering::PointCloudLODSettings settings;
+    settings.point_budget = 1000;
+    settings.max_error_pixels = 1;
+    settings.max_resident_points = 1000;
+    RendererState state;
+    {
+        visualization::rendering::PointCloudLODStreamer streamer(lod,
+                                                                 settings);
+
+        // The point budget limits the shown and the resident points. Moving
+        // the camera evicts the nodes that are no longer shown.
+        for (const Eigen::Vector3d &eye :
+             {Eigen::Vector3d(-1, -1, -1), Eigen::Vector3d(1, 1, 1)}) {
+            UpdateUntilLoaded(streamer, state, eye);
+            EXPECT_LE(streamer.GetShownPoints(), 1000);
+            EXPECT_LE(streamer.GetResidentPoints(), 1000);
+            int64_t num_points = 0;
+            for (int node : state.resident) {
+                num_points += lod->nodes_[node].num_points_;
+            }
+            EXPECT_EQ(num_points, streamer.GetResidentPoints());
+        }
+    }
+    RemoveLOD(*lod);
+}
+
+}  // namespace tests
+}  // namespace open3d
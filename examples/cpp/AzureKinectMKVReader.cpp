@@ -129,7 +129,8 @@ int main(int argc, char **argv) {
         }
     }
 
-    io::MKVReader mkv_reader;
+    // Decode frames ahead while the previous ones are shown and written.
+    io::MKVReader mkv_reader(/*prefetch_frames=*/8);
     mkv_reader.Open(mkv_filename);
     if (!mkv_reader.IsOpened()) {
         utility::LogError("Unable to open {}", mkv_filename);
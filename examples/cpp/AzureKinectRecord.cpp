@@ -148,6 +148,11 @@ int main(int argc, char **argv) {
     } while (!flag_exit);
 
     recorder.CloseRecord();
+    const io::RecordStatistics statistics = recorder.GetRecordStatistics();
+    utility::LogInfo("Frames written: {}, dropped: {}, mean latency {:.1f} ms.",
+                     statistics.num_frames_written,
+                     statistics.num_frames_dropped,
+                     statistics.mean_latency_ms);
 
     return 0;
 }
@@ -38,6 +38,7 @@ using namespace open3d::visualization::rendering;
 static const bool kUseHeadless = false;
 
 static const std::string kOutputFilename = "offscreen.png";
+static const int kNumOrbitImages = 12;
 
 int main(int argc, const char *argv[]) {
     const int width = 640;
@@ -75,6 +76,34 @@ int main(int argc, const char *argv[]) {
     std::cout << "Writing file to " << kOutputFilename << std::endl;
     io::WriteImage(kOutputFilename, *img);
 
+    // Many poses are rendered much faster in a batch, e.g. to generate
+    // training data. Here the camera orbits around the torus.
+    std::vector<Eigen::Matrix4d> extrinsics;
+    for (int i = 0; i < kNumOrbitImages; ++i) {
+        const double angle = 2.0 * EIGEN_PI * i / kNumOrbitImages;
+        const Eigen::Vector3d eye(3.0 * std::cos(angle), 3.0,
+                                  3.0 * std::sin(angle));
+        const Eigen::Vector3d forward = -eye.normalized();
+        const Eigen::Vector3d right =
+                forward.cross(Eigen::Vector3d::UnitY()).normalized();
+        const Eigen::Vector3d down = forward.cross(right);
+        // The extrinsic matrix maps world to camera coordinates, where the
+        // camera looks down +z with +y pointing down.
+        Eigen::Matrix4d extrinsic = Eigen::Matrix4d::Identity();
+        extrinsic.block<1, 3>(0, 0) = right.transpose();
+        extrinsic.block<1, 3>(1, 0) = down.transpose();
+        extrinsic.block<1, 3>(2, 0) = forward.transpose();
+        extrinsic.block<3, 1>(0, 3) = -extrinsic.block<3, 3>(0, 0) * eye;
+        extrinsics.push_back(extrinsic);
+    }
+    auto orbit = app.RenderToImages(*renderer, scene->GetView(),
+                                    scene->GetScene(), width, height,
+                                    extrinsics, /*depth=*/true);
+    for (size_t i = 0; i < orbit.size(); ++i) {
+        io::WriteImage(fmt::format("offscreen_orbit_{:02d}.png", i),
+                       *orbit[i].color);
+    }
+
     // We manually delete these because Filament requires that things get
     // destructed in the right order.
     delete scene;
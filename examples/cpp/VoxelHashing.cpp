@@ -44,6 +44,7 @@ void PrintHelp() {
     utility::LogInfo("    --block_count [=10000]");
     utility::LogInfo("    --device [CPU:0]");
     utility::LogInfo("    --pointcloud");
+    utility::LogInfo("    --loop_closure [keyframe_interval=10]");
     // clang-format on
     utility::LogInfo("");
 }
@@ -139,14 +140,41 @@ int main(int argc, char* argv[]) {
     t::pipelines::voxelhashing::Frame raycast_frame(
             ref_depth.GetRows(), ref_depth.GetCols(), intrinsic_t, device);
 
+    // Load the next frames in the background while processing the current
+    // one.
+    size_t next_frame = 0;
+    t::pipelines::voxelhashing::FrameLoader loader(
+            [&](Image& depth, Image& color) {
+                if (next_frame >= iterations) {
+                    return false;
+                }
+                depth = *t::io::CreateImageFromFile(
+                        depth_filenames[next_frame]);
+                color = *t::io::CreateImageFromFile(
+                        color_filenames[next_frame]);
+                ++next_frame;
+                return true;
+            },
+            ref_depth.GetRows(), ref_depth.GetCols(), intrinsic_t, device);
+
+    // Keyframes are collected for loop closure, which is optional.
+    std::unique_ptr<t::pipelines::voxelhashing::LoopClosure> loop_closure;
+    int keyframe_interval = 0;
+    if (utility::ProgramOptionExists(argc, argv, "--loop_closure")) {
+        keyframe_interval = std::max(1, utility::GetProgramOptionAsInt(
+                                                argc, argv, "--loop_closure",
+                                                10));
+        t::pipelines::voxelhashing::LoopClosureOption option;
+        option.depth_scale = depth_scale;
+        option.depth_max = depth_max;
+        loop_closure =
+                std::make_unique<t::pipelines::voxelhashing::LoopClosure>(
+                        option);
+    }
+
     // Iterate over frames
-    for (size_t i = 0; i < iterations; ++i) {
+    for (size_t i = 0; i < iterations && loader.Pop(input_frame); ++i) {
         utility::LogInfo("Processing {}/{}...", i, iterations);
-        // Load image into frame
-        Image input_depth = *t::io::CreateImageFromFile(depth_filenames[i]);
-        Image input_color = *t::io::CreateImageFromFile(color_filenames[i]);
-        input_frame.SetDataFromImage("depth", input_depth);
-        input_frame.SetDataFromImage("color", input_color);
 
         bool tracking_success = true;
         if (i > 0) {
@@ -181,6 +209,18 @@ int main(int argc, char* argv[]) {
             model.Integrate(input_frame, depth_scale, depth_max);
         }
         model.SynthesizeModelFrame(raycast_frame, depth_scale, 0.1, depth_max);
+
+        if (loop_closure && tracking_success && i % keyframe_interval == 0) {
+            loop_closure->AddKeyframe(input_frame, T_frame_to_model);
+        }
+    }
+
+    if (loop_closure) {
+        std::vector<Tensor> poses = loop_closure->OptimizePoses();
+        utility::LogInfo("Closed {} loops over {} keyframes, reintegrating.",
+                         loop_closure->GetLoopClosureCount(), poses.size());
+        model.Reintegrate(loop_closure->GetKeyframes(), poses, depth_scale,
+                          depth_max);
     }
 
     if (utility::ProgramOptionExists(argc, argv, "--pointcloud")) {
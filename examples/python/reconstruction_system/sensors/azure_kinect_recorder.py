@@ -79,6 +79,7 @@ class RecorderWithCallback:
             vis.update_renderer()
 
         self.recorder.close_record()
+        print(self.recorder.get_record_statistics())
 
 
 if __name__ == '__main__':
@@ -7,12 +7,33 @@
 import numpy as np
 import open3d as o3d
 import sys
+from collections import deque
+from concurrent.futures import ThreadPoolExecutor
 sys.path.append("../utility")
 from file import join, get_rgbd_file_lists
 
 sys.path.append(".")
 
 
+def read_rgbd_images(color_files, depth_files, device, num_prefetch=4):
+    """Yields the (depth, color) images on the device in order. Background
+    threads read at most num_prefetch images ahead of the caller."""
+
+    def read(k):
+        depth = o3d.t.io.read_image(depth_files[k]).to(device)
+        color = o3d.t.io.read_image(color_files[k]).to(device)
+        return depth, color
+
+    with ThreadPoolExecutor(max_workers=2) as executor:
+        futures = deque()
+        for k in range(len(depth_files)):
+            futures.append(executor.submit(read, k))
+            if len(futures) > num_prefetch:
+                yield futures.popleft().result()
+        while futures:
+            yield futures.popleft().result()
+
+
 def run(config):
     print("slac non-rigid optimisation.")
     o3d.utility.set_verbosity_level(o3d.utility.VerbosityLevel.Debug)
@@ -69,6 +90,8 @@ def run(config):
 
     fragment_folder = join(path_dataset, config["folder_fragment"])
 
+    images = read_rgbd_images(color_files, depth_files, device)
+
     k = 0
     for i in range(len(posegraph.nodes)):
         fragment_pose_graph = o3d.io.read_pose_graph(
@@ -80,8 +103,7 @@ def run(config):
             pose = np.dot(posegraph.nodes[i].pose, node.pose)
             extrinsic_t = o3d.core.Tensor(np.linalg.inv(pose))
 
-            depth = o3d.t.io.read_image(depth_files[k]).to(device)
-            color = o3d.t.io.read_image(color_files[k]).to(device)
+            depth, color = next(images)
             rgbd = o3d.t.geometry.RGBDImage(color, depth)
 
             rgbd_projected = ctr_grid.deform(rgbd, intrinsic_t,
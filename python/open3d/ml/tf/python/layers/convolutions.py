@@ -29,7 +29,10 @@ from .neighbor_search import FixedRadiusSearch, RadiusSearch
 import tensorflow as tf
 import numpy as np
 
-__all__ = ['ContinuousConv', 'SparseConv', 'SparseConvTranspose']
+__all__ = [
+    'ContinuousConv', 'SparseConv', 'SparseConvTranspose',
+    'SparseConvKernelMaps'
+]
 
 
 class ContinuousConv(tf.keras.layers.Layer):
@@ -389,6 +392,112 @@ class ContinuousConv(tf.keras.layers.Layer):
         return tf.TensorShape((None, self.filters))
 
 
+def _same_value(a, b):
+    """Returns True if a and b are the same object or have the same value.
+    Symbolic tensors are only compared by identity."""
+    if a is b:
+        return True
+    if tf.is_tensor(a) != tf.is_tensor(b):
+        return False
+    if tf.is_tensor(a):
+        if not (hasattr(a, 'numpy') and hasattr(b, 'numpy')):
+            return False
+        return np.array_equal(a.numpy(), b.numpy())
+    return a == b
+
+
+class SparseConvKernelMaps:
+    """Cache for the kernel maps of sparse convolutions.
+
+    The kernel map of a sparse convolution is the neighbor list which connects
+    the input and the output voxels. The SparseConv and SparseConvTranspose
+    layers compute it with a fixed radius search in every call. Layers which
+    operate on the same voxel sets with the same kernel size, voxel size and
+    offset can share the kernel map by passing the same cache to the layers.
+    The voxel sets are identified by the position tensors and not by their
+    values. A SparseConvTranspose layer shares the kernel map with a SparseConv
+    layer with swapped input and output positions. The cached neighbor lists
+    are also used by the backward pass of each layer.
+
+    The cache keeps references to the position tensors and should be created
+    for each forward pass, or cleared with clear().
+
+    Example:
+      This shows how two layers share the kernel map::
+
+        import tensorflow as tf
+        import open3d.ml.tf as ml3d
+
+        positions = tf.random.uniform([20,3], 0, 10, dtype=tf.int32)
+        positions = tf.cast(positions, tf.float32)+0.5
+        features = tf.random.normal([20,8])
+
+        conv1 = ml3d.layers.SparseConv(filters=16, kernel_size=[3,3,3])
+        conv2 = ml3d.layers.SparseConv(filters=16, kernel_size=[3,3,3])
+
+        kernel_maps = ml3d.layers.SparseConvKernelMaps()
+        features = conv1(features, positions, positions, voxel_size=1.0,
+                         kernel_maps=kernel_maps)
+        # reuses the kernel map computed by conv1
+        features = conv2(features, positions, positions, voxel_size=1.0,
+                         kernel_maps=kernel_maps)
+    """
+
+    def __init__(self):
+        self._entries = []
+
+    def __len__(self):
+        """Returns the number of cached kernel maps."""
+        return len(self._entries)
+
+    def clear(self):
+        """Removes all kernel maps from the cache."""
+        self._entries = []
+
+    def get(self, points, queries, kernel_size, voxel_size, offset, name, fn):
+        """Returns a value of the kernel map for the neighbor search of the
+        queries shifted by offset*voxel_size in the points.
+
+        Arguments:
+          points: The positions which are searched.
+
+          queries: The positions for which the neighbors are searched.
+
+          kernel_size: The size of the cubic kernel along one dimension.
+
+          voxel_size: The voxel size as number or scalar tensor.
+
+          offset: The offset tensor of the layer.
+
+          name: The name of the value.
+
+          fn: Function without arguments which computes the value if it is not
+            in the cache.
+
+        Returns: The cached value or the result of fn().
+        """
+        for entry in self._entries:
+            if (entry['points'] is points and entry['queries'] is queries and
+                    entry['kernel_size'] == kernel_size and
+                    _same_value(entry['voxel_size'], voxel_size) and
+                    _same_value(entry['offset'], offset)):
+                break
+        else:
+            entry = {
+                'points': points,
+                'queries': queries,
+                'kernel_size': kernel_size,
+                'voxel_size': voxel_size,
+                'offset': offset,
+                'values': {},
+            }
+            self._entries.append(entry)
+
+        if name not in entry['values']:
+            entry['values'][name] = fn()
+        return entry['values'][name]
+
+
 class SparseConv(tf.keras.layers.Layer):
     """Sparse Convolution.
 
@@ -511,7 +620,8 @@ class SparseConv(tf.keras.layers.Layer):
              out_positions,
              voxel_size,
              inp_importance=None,
-             fixed_radius_search_hash_table=None):
+             fixed_radius_search_hash_table=None,
+             kernel_maps=None):
         """This function computes the output features.
 
         Arguments:
@@ -534,10 +644,14 @@ class SparseConv(tf.keras.layers.Layer):
             Note that the hash table must have been generated with the same 'points'
             array. Note that this parameter is only used if 'extents' is a scalar.
 
+          kernel_maps: Optional SparseConvKernelMaps object for sharing the
+            neighbor search results with other layers.
+
         Returns: A tensor of shape [num output points, filters] with the output
           features.
         """
         offset = self.offset
+        voxel_size_key = voxel_size
         voxel_size = tf.convert_to_tensor(voxel_size, dtype=inp_positions.dtype)
         if voxel_size.shape.rank != 0:
             raise Exception("voxel_size must be a scalar")
@@ -553,12 +667,21 @@ class SparseConv(tf.keras.layers.Layer):
                 )
 
         hash_table_size_factor = 1 / 64
-        self.nns = self.fixed_radius_search(
-            inp_positions,
-            queries=out_positions - offset * voxel_size,
-            radius=self.kernel_size[0] * voxel_size * 0.51,
-            hash_table_size_factor=hash_table_size_factor,
-            hash_table=fixed_radius_search_hash_table)
+
+        def search():
+            return self.fixed_radius_search(
+                inp_positions,
+                queries=out_positions - offset * voxel_size,
+                radius=self.kernel_size[0] * voxel_size * 0.51,
+                hash_table_size_factor=hash_table_size_factor,
+                hash_table=fixed_radius_search_hash_table)
+
+        if kernel_maps is None:
+            self.nns = search()
+        else:
+            self.nns = kernel_maps.get(inp_positions, out_positions,
+                                       self.kernel_size[0], voxel_size_key,
+                                       offset, 'nns', search)
 
         out_positions_split = None
         if isinstance(inp_positions, tf.RaggedTensor):
@@ -727,7 +850,8 @@ class SparseConvTranspose(tf.keras.layers.Layer):
              out_positions,
              voxel_size,
              out_importance=None,
-             fixed_radius_search_hash_table=None):
+             fixed_radius_search_hash_table=None,
+             kernel_maps=None):
         """This function computes the output features.
 
         Arguments:
@@ -750,10 +874,14 @@ class SparseConvTranspose(tf.keras.layers.Layer):
             Note that the hash table must have been generated with the same 'points'
             array. Note that this parameter is only used if 'extents' is a scalar.
 
+          kernel_maps: Optional SparseConvKernelMaps object for sharing the
+            neighbor search results with other layers.
+
         Returns: A tensor of shape [num output points, filters] with the output
           features.
         """
         offset = self.offset
+        voxel_size_key = voxel_size
         voxel_size = tf.convert_to_tensor(voxel_size, dtype=inp_positions.dtype)
         if voxel_size.shape.rank != 0:
             raise Exception("voxel_size must be a scalar")
@@ -771,12 +899,21 @@ class SparseConvTranspose(tf.keras.layers.Layer):
                 )
 
         hash_table_size_factor = 1 / 64
-        self.nns_inp = self.fixed_radius_search(
-            out_positions,
-            queries=inp_positions - offset * voxel_size,
-            radius=self.kernel_size[0] * voxel_size * 0.51,
-            hash_table_size_factor=hash_table_size_factor,
-            hash_table=fixed_radius_search_hash_table)
+
+        def search():
+            return self.fixed_radius_search(
+                out_positions,
+                queries=inp_positions - offset * voxel_size,
+                radius=self.kernel_size[0] * voxel_size * 0.51,
+                hash_table_size_factor=hash_table_size_factor,
+                hash_table=fixed_radius_search_hash_table)
+
+        kernel_map_key = (out_positions, inp_positions, self.kernel_size[0],
+                          voxel_size_key, offset)
+        if kernel_maps is None:
+            self.nns_inp = search()
+        else:
+            self.nns_inp = kernel_maps.get(*kernel_map_key, 'nns', search)
 
         out_positions_split = None
         if isinstance(inp_positions, tf.RaggedTensor):
@@ -787,9 +924,17 @@ class SparseConvTranspose(tf.keras.layers.Layer):
 
         num_out = tf.shape(out_positions, out_type=tf.int64)[0]
 
-        neighbors_index, neighbors_row_splits, _ = ops.invert_neighbors_list(
-            num_out, self.nns_inp.neighbors_index,
-            self.nns_inp.neighbors_row_splits, empty_vec)
+        def invert():
+            return ops.invert_neighbors_list(num_out,
+                                             self.nns_inp.neighbors_index,
+                                             self.nns_inp.neighbors_row_splits,
+                                             empty_vec)
+
+        if kernel_maps is None:
+            inverted = invert()
+        else:
+            inverted = kernel_maps.get(*kernel_map_key, 'inverted_nns', invert)
+        neighbors_index, neighbors_row_splits, _ = inverted
 
         # for stats and debugging
         num_pairs = tf.shape(neighbors_index)[0]
@@ -616,6 +616,22 @@ def test_reduction_mean(dim, keepdim, device):
     np.testing.assert_allclose(o3_dst.cpu().numpy(), np_dst)
 
 
+@pytest.mark.parametrize(
+    "dim",
+    [0, 1, 2, (), (0,), (1,), (2,), (0, 1), (0, 2), (1, 2), (0, 1, 2), None])
+@pytest.mark.parametrize("keepdim", [True, False])
+@pytest.mark.parametrize("device", list_devices())
+def test_reduction_mean_variance(dim, keepdim, device):
+    np_src = np.array(range(24)).reshape((2, 3, 4)).astype(np.float32)
+    o3_src = o3d.core.Tensor(np_src, device=device)
+
+    np_mean = np_src.mean(axis=dim, keepdims=keepdim)
+    np_var = np_src.var(axis=dim, keepdims=keepdim)
+    o3_mean, o3_var = o3_src.mean_variance(dim=dim, keepdim=keepdim)
+    np.testing.assert_allclose(o3_mean.cpu().numpy(), np_mean, rtol=1e-6)
+    np.testing.assert_allclose(o3_var.cpu().numpy(), np_var, rtol=1e-5)
+
+
 @pytest.mark.parametrize(
     "dim",
     [0, 1, 2, (), (0,), (1,), (2,), (0, 1), (0, 2), (1, 2), (0, 1, 2), None])
@@ -805,6 +821,99 @@ def test_non_zero(device):
         np.testing.assert_equal(np_t, o3_t.cpu().numpy())
 
 
+@pytest.mark.parametrize("device", list_devices())
+def test_sort_unique(device):
+    np_x = np.array([4, 1, 4, 4, 2, 1], dtype=np.int64)
+    o3_x = o3d.core.Tensor(np_x, device=device)
+    np.testing.assert_equal(o3_x.sort().cpu().numpy(), np.sort(np_x))
+    np.testing.assert_equal(o3_x.argsort().cpu().numpy(),
+                            np.argsort(np_x, kind="stable"))
+    np.testing.assert_equal(o3_x.unique().cpu().numpy(), np.unique(np_x))
+
+    np_unique, np_inverse, np_counts = np.unique(np_x,
+                                                 return_inverse=True,
+                                                 return_counts=True)
+    o3_unique, o3_inverse, o3_counts = o3_x.unique(return_inverse=True,
+                                                   return_counts=True)
+    np.testing.assert_equal(o3_unique.cpu().numpy(), np_unique)
+    np.testing.assert_equal(o3_inverse.cpu().numpy(), np_inverse)
+    np.testing.assert_equal(o3_counts.cpu().numpy(), np_counts)
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_segment_reduction(device):
+    o3_values = o3d.core.Tensor([[1, 2], [3, 4], [5, 6]],
+                                dtype=o3d.core.Dtype.Float32,
+                                device=device)
+    o3_ids = o3d.core.Tensor([0, 0, 2],
+                             dtype=o3d.core.Dtype.Int64,
+                             device=device)
+    np.testing.assert_equal(
+        o3_values.segment_sum(o3_ids, 3).cpu().numpy(),
+        np.array([[4, 6], [0, 0], [5, 6]], dtype=np.float32))
+    np.testing.assert_equal(
+        o3_values.segment_mean(o3_ids, 3).cpu().numpy(),
+        np.array([[2, 3], [0, 0], [5, 6]], dtype=np.float32))
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_cumsum(device):
+    np_x = np.array([[1, 2, 3], [4, 5, 6]], dtype=np.float32)
+    o3_x = o3d.core.Tensor(np_x, device=device)
+    np.testing.assert_equal(o3_x.cumsum(0).cpu().numpy(), np.cumsum(np_x, 0))
+    np.testing.assert_equal(o3_x.cumsum(1).cpu().numpy(), np.cumsum(np_x, 1))
+    np.testing.assert_equal(
+        o3_x.cumsum(1, exclusive=True).cpu().numpy(),
+        np.cumsum(np_x, 1) - np_x)
+
+    np_mask = np.array([True, False, True, True])
+    o3_mask = o3d.core.Tensor(np_mask, device=device)
+    assert o3_mask.cumsum(0).dtype == o3d.core.Dtype.Int64
+    np.testing.assert_equal(o3_mask.cumsum(0).cpu().numpy(),
+                            np.cumsum(np_mask))
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_dlpack_protocol(device):
+    o3_x = o3d.core.Tensor.ones((2, 3), o3d.core.Dtype.Float32, device)
+    dl_device = o3_x.__dlpack_device__()
+    if device.get_type() == o3d.core.Device.DeviceType.CUDA:
+        assert dl_device == (2, device.get_id())
+        o3_y = o3d.core.Tensor.from_dlpack(o3_x.__dlpack__(stream=1))
+    else:
+        assert dl_device == (1, 0)
+        with pytest.raises(RuntimeError):
+            o3_x.__dlpack__(stream=1)
+        o3_y = o3d.core.Tensor.from_dlpack(o3_x.__dlpack__())
+
+    # Objects implementing __dlpack__ are accepted directly. All tensors share
+    # the same memory.
+    o3_z = o3d.core.Tensor.from_dlpack(o3_x)
+    o3_x[0, 0] = 100
+    assert o3_y[0, 0].item() == 100
+    assert o3_z[0, 0].item() == 100
+    assert o3_z.device == device
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_half_dtypes(device):
+    np_x = np.array([1.5, -2, 0.25, 65504], dtype=np.float16)
+    o3_x = o3d.core.Tensor(np_x, device=device)
+    assert o3_x.dtype == o3d.core.Dtype.Float16
+    np.testing.assert_equal(o3_x.cpu().numpy(), np_x)
+    np.testing.assert_equal((o3_x * 2).cpu().numpy(), np_x * 2)
+    assert o3_x[0].item() == 1.5
+
+    o3_ones = o3d.core.Tensor.ones((4096,), o3d.core.Dtype.Float16, device)
+    assert o3_ones.sum().item() == 4096
+
+    o3_y = o3_x.to(o3d.core.Dtype.BFloat16)
+    assert o3_y.dtype == o3d.core.Dtype.BFloat16
+    np.testing.assert_equal(
+        o3_y[:3].to(o3d.core.Dtype.Float32).cpu().numpy(),
+        np.array([1.5, -2, 0.25], dtype=np.float32))
+
+
 @pytest.mark.parametrize("device", list_devices())
 def test_boolean_advanced_indexing(device):
     np_a = np.array([1, -1, -2, 3])
@@ -1205,6 +1314,18 @@ def test_save_load(device):
             o3_t_load = o3d.core.Tensor.load(file_name)
             np.testing.assert_equal(o3_t_load.cpu().numpy(), np_t)
 
+        # Memory-mapped loading.
+        np_t = np.array([[1, 2], [3, 4]], dtype=np.float32)
+        np.save(file_name, np_t)
+        o3_t_load = o3d.core.Tensor.load(file_name, mmap_mode="r")
+        np.testing.assert_equal(o3_t_load.numpy(), np_t)
+        o3_t_load = o3d.core.Tensor.load(file_name, mmap_mode="c")
+        o3_t_load[0, 0] = 100
+        np.testing.assert_equal(np.load(file_name), np_t)
+        del o3_t_load
+        with pytest.raises(RuntimeError):
+            o3d.core.Tensor.load(file_name, mmap_mode="w")
+
         # Ragged tensor: exception.
         np_t = np.array([[1, 2, 3], [4, 5]], dtype=np.dtype(object))
         np.save(file_name, np_t)
@@ -27,6 +27,7 @@
 import open3d as o3d
 import numpy as np
 import pytest
+import tempfile
 
 import sys, os
 sys.path.append(os.path.dirname(os.path.realpath(__file__)) + "/..")
@@ -174,3 +175,84 @@ def test_complex_shape(device):
 
     np.testing.assert_equal(masks.cpu().numpy().flatten(),
                             np.array([True, False]))
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_save_load(device):
+    hashmap = o3d.core.Hashmap(10, o3d.core.Dtype.Int64, o3d.core.Dtype.Int64,
+                               [1], [1], device)
+    keys = o3d.core.Tensor([100, 300, 500, 700, 900],
+                           dtype=o3d.core.Dtype.Int64,
+                           device=device)
+    values = o3d.core.Tensor([1, 3, 5, 7, 9],
+                             dtype=o3d.core.Dtype.Int64,
+                             device=device)
+    hashmap.insert(keys, values)
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        file_name = os.path.join(temp_dir, "hashmap.o3dt")
+        hashmap.save(file_name)
+        loaded = o3d.core.Hashmap.load(file_name, device)
+
+    assert loaded.size() == 5
+    addrs, masks = loaded.find(keys)
+    assert masks.cpu().numpy().all()
+    found_values = loaded.get_value_tensor()[addrs.to(o3d.core.Dtype.Int64)]
+    np.testing.assert_equal(found_values.cpu().numpy().flatten(),
+                            np.array([1, 3, 5, 7, 9]))
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_for_each_active_chunk(device):
+    hashmap = o3d.core.Hashmap(10, o3d.core.Dtype.Int64, o3d.core.Dtype.Int64,
+                               [1], [1], device)
+    keys = o3d.core.Tensor([100, 300, 500, 700, 900],
+                           dtype=o3d.core.Dtype.Int64,
+                           device=device)
+    values = o3d.core.Tensor([1, 3, 5, 7, 9],
+                             dtype=o3d.core.Dtype.Int64,
+                             device=device)
+    hashmap.insert(keys, values)
+
+    chunks = []
+
+    def collect(addrs, chunk_keys, chunk_values):
+        assert len(addrs) <= 2
+        chunks.append((chunk_keys.cpu().numpy().flatten(),
+                       chunk_values.cpu().numpy().flatten()))
+
+    hashmap.for_each_active_chunk(2, collect)
+    visited_keys = np.concatenate([k for k, _ in chunks])
+    visited_values = np.concatenate([v for _, v in chunks])
+    order = np.argsort(visited_keys)
+    np.testing.assert_equal(visited_keys[order],
+                            np.array([100, 300, 500, 700, 900]))
+    np.testing.assert_equal(visited_values[order], np.array([1, 3, 5, 7, 9]))
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_multimap(device):
+    multimap = o3d.core.HashMultimap(10, o3d.core.Dtype.Int64,
+                                     o3d.core.Dtype.Int64, [1], [1], device)
+    keys = o3d.core.Tensor([100, 300, 100, 500, 100],
+                           dtype=o3d.core.Dtype.Int64,
+                           device=device)
+    values = o3d.core.Tensor([[0], [1], [2], [3], [4]],
+                             dtype=o3d.core.Dtype.Int64,
+                             device=device)
+    multimap.insert(keys, values)
+    assert multimap.size() == 3
+    assert multimap.num_values() == 5
+
+    query = o3d.core.Tensor([300, 700, 100],
+                            dtype=o3d.core.Dtype.Int64,
+                            device=device)
+    offsets, found_values = multimap.find(query)
+    np.testing.assert_equal(offsets.cpu().numpy(), np.array([0, 1, 1, 4]))
+    np.testing.assert_equal(found_values.cpu().numpy().flatten(),
+                            np.array([1, 0, 2, 4]))
+
+    masks = multimap.erase(query)
+    np.testing.assert_equal(masks.cpu().numpy(),
+                            np.array([True, False, True]))
+    assert multimap.num_values() == 1
@@ -213,3 +213,79 @@ def test_fixed_radius_search_random(dtype):
                                        rtol=1e-5,
                                        atol=0)
             np.testing.assert_equal(indices.numpy(), indices_cuda.cpu().numpy())
+
+
+@pytest.mark.parametrize("dtype", [o3c.Dtype.Float32, o3c.Dtype.Float64])
+def test_approximate_knn_search(dtype):
+    dataset_size, query_size, k = 2000, 100, 5
+    dataset_np = np.random.rand(dataset_size, 8)
+    query_np = np.random.rand(query_size, 8)
+    dataset_points = o3c.Tensor(dataset_np, dtype=dtype)
+    query_points = o3c.Tensor(query_np, dtype=dtype)
+
+    params = o3c.nns.ApproximateKnnParams()
+    params.method = o3c.nns.ApproximateKnnMethod.HNSW
+    params.hnsw_ef_search = 100
+    nns = o3c.nns.NearestNeighborSearch(dataset_points)
+    assert nns.approximate_knn_index(params)
+    indices, distances = nns.knn_search(query_points, k)
+    assert indices.shape == o3c.SizeVector([query_size, k])
+
+    distances_np = np.sum(
+        (query_np[:, None, :] - dataset_np[None, :, :])**2, axis=-1)
+    exact_indices = np.argsort(distances_np, axis=1)[:, :k]
+    recall = np.mean([
+        len(np.intersect1d(a, b)) / k
+        for a, b in zip(indices.numpy(), exact_indices)
+    ])
+    assert recall > 0.9
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_batched_nns(device):
+    dtype = o3c.Dtype.Float32
+    clouds = [np.random.rand(n, 3) for n in [50, 0, 20]]
+    queries = [np.random.rand(n, 3) for n in [10, 5, 7]]
+
+    def splits(arrays):
+        return o3c.Tensor(np.cumsum([0] + [len(a) for a in arrays]),
+                          dtype=o3c.Dtype.Int64,
+                          device=device)
+
+    nns = o3c.nns.BatchedNearestNeighborSearch(
+        o3c.Tensor(np.concatenate(clouds), dtype=dtype, device=device),
+        splits(clouds))
+    assert nns.build_index()
+    assert nns.batch_size == 3
+
+    query_points = o3c.Tensor(np.concatenate(queries),
+                              dtype=dtype,
+                              device=device)
+    indices, distances, row_splits = nns.knn_search(query_points,
+                                                    splits(queries), 4)
+    np.testing.assert_equal(
+        row_splits.cpu().numpy(),
+        np.array([0] + [4] * 10 + [0] * 5 + [4] * 7, dtype=np.int64).cumsum())
+
+    # Compare against brute force in each cloud.
+    indices = indices.cpu().numpy()
+    distances = distances.cpu().numpy()
+    offset = 0
+    query_list = [(0, i) for i in range(10)] + [(2, i) for i in range(7)]
+    for cloud_idx, i in query_list:
+        query = queries[cloud_idx][i]
+        dist = ((clouds[cloud_idx] - query)**2).sum(axis=1)
+        start = 0 if cloud_idx == 0 else 50
+        np.testing.assert_equal(indices[offset:offset + 4] - start,
+                                np.argsort(dist)[:4])
+        np.testing.assert_allclose(distances[offset:offset + 4],
+                                   np.sort(dist)[:4],
+                                   rtol=1e-5,
+                                   atol=1e-7)
+        offset += 4
+
+    indices, distances, row_splits = nns.fixed_radius_search(
+        query_points, splits(queries), 0.3)
+    row_splits = row_splits.cpu().numpy()
+    assert row_splits[10] == row_splits[15]
+    assert (distances.cpu().numpy() <= 0.09 + 1e-6).all()
@@ -114,3 +114,19 @@ def test_tensor_numpy_to_open3d_to_pytorch():
     np.testing.assert_equal(r, a)
     np.testing.assert_equal(r, b.cpu().numpy())
     np.testing.assert_equal(r, c.cpu().numpy())
+
+
+@pytest.mark.parametrize("device", list_devices_with_torch())
+def test_tensor_dlpack_protocol_pytorch(device):
+    # torch.from_dlpack() and torch.Tensor.__dlpack__() need PyTorch >= 1.10.
+    if not torch_available() or not hasattr(torch, "from_dlpack"):
+        return
+
+    a = o3d.core.Tensor.ones((2, 2), o3d.core.Dtype.Float32, device)
+    b = torch.from_dlpack(a)
+    c = o3d.core.Tensor.from_dlpack(b)
+
+    b[0, 0] = 100
+    r = np.array([[100., 1.], [1., 1.]])
+    np.testing.assert_equal(r, a.cpu().numpy())
+    np.testing.assert_equal(r, c.cpu().numpy())
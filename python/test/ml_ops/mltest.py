@@ -257,6 +257,10 @@ parametrize = SimpleNamespace(
         'ml', [v for k, v in _ml_modules.items() if not v.device_is_gpu]),
     ml_gpu_only=pytest.mark.parametrize(
         'ml', [v for k, v in _ml_modules.items() if v.device_is_gpu]),
+    ml_cpu_and_torch_gpu=pytest.mark.parametrize('ml', [
+        v for k, v in _ml_modules.items()
+        if not v.device_is_gpu or v.module.__name__ == 'torch'
+    ]),
     ml_torch_only=pytest.mark.parametrize(
         'ml',
         [v for k, v in _ml_modules.items() if v.module.__name__ == 'torch']),
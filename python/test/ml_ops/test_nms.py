@@ -74,3 +74,45 @@ def test_nms_empty(ml):
 
     np.testing.assert_equal(keep_indices, keep_indices_ref)
     assert keep_indices.dtype == keep_indices_ref.dtype
+
+
+@mltest.parametrize.ml
+def test_batched_nms(ml):
+    rng = np.random.RandomState(123)
+    batch_sizes = [200, 0, 1, 500]
+    row_splits = np.cumsum([0] + batch_sizes).astype(np.int64)
+    centers = rng.uniform(0, 20, size=(row_splits[-1], 2))
+    sizes = rng.uniform(0.5, 3, size=(row_splits[-1], 2))
+    angles = rng.uniform(-np.pi, np.pi, size=(row_splits[-1], 1))
+    boxes = np.concatenate(
+        [centers - 0.5 * sizes, centers + 0.5 * sizes, angles],
+        axis=1).astype(np.float32)
+    scores = rng.uniform(size=row_splits[-1]).astype(np.float32)
+    nms_overlap_thresh = 0.3
+
+    keep_indices, keep_row_splits = mltest.run_op(
+        ml,
+        ml.device,
+        True,
+        ml.ops.batched_nms,
+        boxes,
+        scores,
+        row_splits,
+        nms_overlap_thresh=nms_overlap_thresh)
+
+    assert keep_indices.dtype == np.int64
+    assert keep_row_splits.dtype == np.int64
+    assert keep_row_splits.shape == row_splits.shape
+    for b in range(len(batch_sizes)):
+        begin, end = row_splits[b:b + 2]
+        keep_indices_ref = mltest.run_op(
+            ml,
+            ml.device,
+            False,
+            ml.ops.nms,
+            boxes[begin:end],
+            scores[begin:end],
+            nms_overlap_thresh=nms_overlap_thresh) + begin
+        np.testing.assert_equal(
+            keep_indices[keep_row_splits[b]:keep_row_splits[b + 1]],
+            keep_indices_ref)
@@ -39,7 +39,7 @@ dtypes = pytest.mark.parametrize('dtype', [np.float32, np.float64])
 
 
 @dtypes
-@mltest.parametrize.ml_cpu_only
+@mltest.parametrize.ml_cpu_and_torch_gpu
 @pytest.mark.parametrize('num_points_queries', [(10, 5), (31, 33), (33, 31),
                                                 (123, 345)])
 @pytest.mark.parametrize('metric', ['L1', 'L2'])
@@ -93,7 +93,8 @@ def test_radius_search(dtype, ml, num_points_queries, metric,
             gt_set.remove(i)
         assert gt_set == set(q_neighbors_index)
 
-        # check distances
+        # check distances, the GPU may sum in a different order
+        rtol = 1e-6 if ml.device_is_gpu else 1e-7
         if return_distances:
             q_neighbors_dist = ans.neighbors_distance[start:end]
             for j, dist in zip(q_neighbors_index, q_neighbors_dist):
@@ -106,10 +107,10 @@ def test_radius_search(dtype, ml, num_points_queries, metric,
                     if normalize_distances:
                         gt_dist /= radii[i]
 
-                np.testing.assert_allclose(dist, gt_dist, rtol=1e-7, atol=1e-8)
+                np.testing.assert_allclose(dist, gt_dist, rtol=rtol, atol=1e-8)
 
 
-@mltest.parametrize.ml_cpu_only
+@mltest.parametrize.ml_cpu_and_torch_gpu
 def test_radius_search_empty_point_sets(ml):
     rng = np.random.RandomState(123)
 
@@ -157,7 +158,7 @@ def test_radius_search_empty_point_sets(ml):
     assert ans.neighbors_distance.shape == (0,)
 
 
-@mltest.parametrize.ml_cpu_only
+@mltest.parametrize.ml_cpu_and_torch_gpu
 @pytest.mark.parametrize('batch_size', [2, 3, 8])
 def test_radius_search_batches(ml, batch_size):
 
@@ -226,7 +227,8 @@ def test_radius_search_batches(ml, batch_size):
             gt_set.remove(i)
         assert gt_set == set(q_neighbors_index)
 
-        # check distances
+        # check distances, the GPU may sum in a different order
+        rtol = 1e-6 if ml.device_is_gpu else 1e-7
         if return_distances:
             q_neighbors_dist = ans.neighbors_distance[start:end]
             for j, dist in zip(q_neighbors_index, q_neighbors_dist):
@@ -239,4 +241,4 @@ def test_radius_search_batches(ml, batch_size):
                     if normalize_distances:
                         gt_dist /= radii[i]
 
-                np.testing.assert_allclose(dist, gt_dist, rtol=1e-7, atol=1e-8)
+                np.testing.assert_allclose(dist, gt_dist, rtol=rtol, atol=1e-8)
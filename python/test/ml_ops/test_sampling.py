@@ -33,7 +33,7 @@ import mltest
 pytestmark = mltest.default_marks
 
 
-@mltest.parametrize.ml_gpu_only
+@mltest.parametrize.ml
 def test_furthest_point_sampling(ml):
 
     values = mltest.fetch_numpy(
@@ -48,3 +48,25 @@ def test_furthest_point_sampling(ml):
         'https://storage.googleapis.com/isl-datasets/open3d-dev/test/ml_ops/data/sampling/out.npy'
     )
     np.testing.assert_equal(ans, expected)
+
+
+@mltest.parametrize.ml
+def test_furthest_point_sampling_large(ml):
+    # Large enough for the bucketed CUDA implementation.
+    rng = np.random.RandomState(0)
+    values = rng.normal(size=(2, 70000, 3)).astype(np.float32)
+    values[1] *= [1, 5, 0.1]
+    samples = 64
+
+    ans = mltest.run_op(ml, ml.device, True, ml.ops.furthest_point_sampling,
+                        values, samples)
+
+    assert ans.shape == (2, samples)
+    for points, idxs in zip(values.astype(np.float64), ans):
+        assert idxs[0] == 0
+        dists = np.full(points.shape[0], np.inf)
+        for i in range(1, samples):
+            dists = np.minimum(
+                dists, np.sum((points - points[idxs[i - 1]])**2, axis=1))
+            # The sampled point is the furthest point up to rounding errors.
+            assert dists[idxs[i]] >= (1 - 1e-5) * dists.max()
@@ -534,3 +534,70 @@ def test_compare_to_conv3dtranspose_batches(ml, dtype, kernel_size,
         y_conv3d += bias
 
         np.testing.assert_allclose(y_out, y_conv3d, rtol=1e-3, atol=1e-5)
+
+
+@mltest.parametrize.ml
+@pytest.mark.parametrize('dtype', [np.float32])
+def test_kernel_maps(ml, dtype):
+    """Checks that layers sharing a kernel map cache compute the same results
+    as layers computing their own kernel maps"""
+    np.random.seed(0)
+
+    channels = 4
+    kernel_size = [3, 3, 3]
+    voxel_size = 0.2
+    max_grid_extent = 10
+    inp_positions = np.unique(np.random.randint(0, max_grid_extent,
+                                                (256, 3)).astype(dtype),
+                              axis=0) * voxel_size
+    out_positions = np.unique(np.random.randint(0, max_grid_extent,
+                                                (64, 3)).astype(dtype),
+                              axis=0) * voxel_size
+    inp_features = np.random.uniform(size=inp_positions.shape[0:1] +
+                                     (channels,)).astype(dtype)
+
+    conv1 = ml.layers.SparseConv(in_channels=channels,
+                                 filters=channels,
+                                 kernel_size=kernel_size)
+    conv2 = ml.layers.SparseConv(in_channels=channels,
+                                 filters=channels,
+                                 kernel_size=kernel_size)
+    conv_transpose = ml.layers.SparseConvTranspose(in_channels=channels,
+                                                   filters=channels,
+                                                   kernel_size=kernel_size)
+    if ml.module.__name__ == 'torch':
+        conv1.to(ml.device)
+        conv2.to(ml.device)
+        conv_transpose.to(ml.device)
+
+    def fn(features, inp_positions, out_positions, kernel_maps):
+        if ml.module.__name__ == 'tensorflow':
+            inp_positions = ml.module.convert_to_tensor(inp_positions)
+            out_positions = ml.module.convert_to_tensor(out_positions)
+        x = conv1(features,
+                  inp_positions,
+                  out_positions,
+                  voxel_size,
+                  kernel_maps=kernel_maps)
+        y = conv_transpose(x,
+                           out_positions,
+                           inp_positions,
+                           voxel_size,
+                           kernel_maps=kernel_maps)
+        z = conv2(y,
+                  inp_positions,
+                  out_positions,
+                  voxel_size,
+                  kernel_maps=kernel_maps)
+        return x, y, z
+
+    kernel_maps = ml.layers.SparseConvKernelMaps()
+    ans = mltest.run_op(ml, ml.device, True, fn, inp_features, inp_positions,
+                        out_positions, kernel_maps)
+    # all layers use the same voxel sets
+    assert len(kernel_maps) == 1
+
+    expected = mltest.run_op(ml, ml.device, True, fn, inp_features,
+                             inp_positions, out_positions, None)
+    for a, b in zip(ans, expected):
+        np.testing.assert_allclose(a, b, rtol=1e-5, atol=1e-6)
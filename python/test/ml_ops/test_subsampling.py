@@ -92,3 +92,40 @@ def test_tf_batch_subsampling():
 
     with pytest.raises(ValueError):
         ops.batch_grid_subsampling(points, None, 1)
+
+
+@pytest.mark.skipif(not o3d._build_config['BUILD_TENSORFLOW_OPS'],
+                    reason='tf ops not built')
+def test_tf_batch_subsampling_random():
+    ops = importlib.import_module('open3d.ml.tf.ops')
+
+    rng = np.random.RandomState(0)
+    batches = np.array([1000, 0, 3000, 500], dtype=np.int32)
+    points = rng.uniform(-2, 2, size=(batches.sum(), 3)).astype(np.float32)
+    voxel_size = 0.5
+
+    (sub_points, sub_batch) = ops.batch_grid_subsampling(
+        points, batches, voxel_size)
+    sub_points, sub_batch = sub_points.cpu().numpy(), sub_batch.cpu().numpy()
+
+    begin = 0
+    sub_begin = 0
+    for b, num_points in enumerate(batches):
+        batch_points = points[begin:begin + num_points]
+        voxels = np.floor(batch_points / voxel_size).astype(np.int64)
+        _, inverse, counts = np.unique(voxels,
+                                       axis=0,
+                                       return_inverse=True,
+                                       return_counts=True)
+        sub_points_ref = np.zeros((counts.shape[0], 3), dtype=np.float64)
+        np.add.at(sub_points_ref, inverse.reshape(-1), batch_points)
+        sub_points_ref /= counts[:, np.newaxis]
+        assert sub_batch[b] == counts.shape[0]
+
+        batch_sub_points = sub_points[sub_begin:sub_begin + sub_batch[b]]
+        batch_sub_points = batch_sub_points[np.lexsort(batch_sub_points.T)]
+        sub_points_ref = sub_points_ref[np.lexsort(sub_points_ref.T)]
+        np.testing.assert_allclose(batch_sub_points, sub_points_ref, atol=1e-5)
+
+        begin += num_points
+        sub_begin += sub_batch[b]
@@ -179,3 +179,79 @@ def test_voxelize_random(ml, point_dtype, ndim, max_voxels,
         max_points_per_voxel=max_points_per_voxel,
         max_voxels=max_voxels)
     assert_equal_voxel_dicts(voxels, ref=voxels_reference)
+
+
+def voxelize_reduce_python(points, features, voxel_size, point_range_min,
+                           point_range_max, position_fn, feature_fn):
+    voxels = {tuple(c): [] for c in voxelize_python(
+        points, voxel_size, point_range_min, point_range_max)}
+    inv_voxel_size = 1 / voxel_size[np.newaxis, :]
+    voxel_coords = ((points - point_range_min[np.newaxis, :]) *
+                    inv_voxel_size).astype(np.int32)
+    for i, c in enumerate(voxel_coords):
+        if tuple(c) in voxels:
+            voxels[tuple(c)].append(i)
+
+    # the voxels are sorted by their linear index
+    voxel_keys = sorted(voxels.keys(), key=lambda x: x[::-1])
+    positions = []
+    feats = []
+    for k in voxel_keys:
+        idx = voxels[k]
+        center = point_range_min + (np.array(k) + 0.5) * voxel_size
+        nearest = idx[np.argmin(
+            np.sum((points[idx] - center[np.newaxis, :])**2, axis=1))]
+        positions.append({
+            'average': np.mean(points[idx], axis=0),
+            'nearest_neighbor': points[nearest],
+            'center': center,
+        }[position_fn])
+        feats.append({
+            'average': np.mean(features[idx], axis=0),
+            'nearest_neighbor': features[nearest],
+            'max': np.max(features[idx], axis=0),
+        }[feature_fn])
+
+    ndim = points.shape[1]
+    channels = features.shape[1]
+    return (np.array(voxel_keys, dtype=np.int32).reshape(-1, ndim),
+            np.array(positions, dtype=points.dtype).reshape(-1, ndim),
+            np.array(feats, dtype=features.dtype).reshape(-1, channels),
+            np.array([len(voxels[k]) for k in voxel_keys], dtype=np.int64))
+
+
+@mltest.parametrize.ml
+@point_dtypes
+@ndims
+@pytest.mark.parametrize('position_fn',
+                         ['average', 'nearest_neighbor', 'center'])
+@pytest.mark.parametrize('feature_fn', ['average', 'nearest_neighbor', 'max'])
+def test_voxelize_reduce_random(ml, point_dtype, ndim, position_fn,
+                                feature_fn):
+    rng = np.random.RandomState(123)
+    points = rng.rand(rng.randint(0, 10000), ndim).astype(point_dtype)
+    features = rng.rand(points.shape[0], 5).astype(point_dtype)
+
+    voxel_size = rng.uniform(0.01, 0.1, size=(ndim,)).astype(point_dtype)
+    point_range_min = rng.uniform(0.0, 0.3, size=(ndim,)).astype(point_dtype)
+    point_range_max = rng.uniform(0.7, 1.0, size=(ndim,)).astype(point_dtype)
+
+    ans = mltest.run_op(ml,
+                        ml.device,
+                        True,
+                        ml.ops.voxelize_reduce,
+                        points,
+                        features,
+                        voxel_size,
+                        point_range_min,
+                        point_range_max,
+                        position_fn=position_fn,
+                        feature_fn=feature_fn)
+
+    ref = voxelize_reduce_python(points, features, voxel_size,
+                                 point_range_min, point_range_max, position_fn,
+                                 feature_fn)
+    np.testing.assert_equal(ans.voxel_coords, ref[0])
+    np.testing.assert_allclose(ans.voxel_positions, ref[1], rtol=1e-5)
+    np.testing.assert_allclose(ans.voxel_features, ref[2], rtol=1e-5)
+    np.testing.assert_equal(ans.voxel_point_counts, ref[3])
@@ -181,3 +181,57 @@ def test_member_functions(device):
     pcd_small_down = pcd.voxel_down_sample(1)
     assert pcd_small_down.point["points"].allclose(
         o3c.Tensor([[0, 0, 0]], dtype, device))
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_estimate_normals(device):
+    # Noisy samples of the plane z = 0.5 x.
+    rng = np.random.default_rng(0)
+    xy = rng.uniform(-1, 1, size=(2000, 2))
+    z = 0.5 * xy[:, :1] + rng.normal(0, 1e-4, size=(2000, 1))
+    points = np.hstack([xy, z]).astype(np.float32)
+    expected = np.array([-0.5, 0, 1]) / np.linalg.norm([-0.5, 0, 1])
+
+    for max_knn, radius in [(30, None), (30, 0.1), (None, 0.1)]:
+        pcd = o3d.t.geometry.PointCloud(o3c.Tensor(points, device=device))
+        pcd.estimate_normals(max_knn, radius)
+        assert "covariances" in pcd.point
+        assert pcd.point["covariances"].shape == o3c.SizeVector([2000, 3, 3])
+        normals = pcd.point["normals"].cpu().numpy()
+        np.testing.assert_allclose(np.abs(normals @ expected),
+                                   np.ones(2000),
+                                   atol=1e-3)
+
+        pcd.orient_normals_to_align_with_direction(
+            o3c.Tensor([0, 0, -1], o3c.Dtype.Float32))
+        assert (pcd.point["normals"].cpu().numpy()[:, 2] < 0).all()
+        pcd.orient_normals_towards_camera_location(
+            o3c.Tensor([0, 0, 10], o3c.Dtype.Float32))
+        assert (pcd.point["normals"].cpu().numpy()[:, 2] > 0).all()
+
+
+@pytest.mark.parametrize("device", list_devices())
+def test_select_by_mask_and_crop(device):
+    dtype = o3c.Dtype.Float32
+    pcd = o3d.t.geometry.PointCloud(device)
+    pcd.point["points"] = o3c.Tensor(
+        [[0.1, 0.3, 0.9], [0.9, 0.2, 0.4], [0.3, 0.6, 0.8], [0.2, 0.4, 0.2]],
+        dtype, device)
+    pcd.point["colors"] = o3c.Tensor.ones((4, 3), dtype, device)
+
+    mask = o3c.Tensor([True, False, True, False], o3c.Dtype.Bool, device)
+    pcd_select = pcd.select_by_mask(mask)
+    assert pcd_select.point["points"].allclose(
+        o3c.Tensor([[0.1, 0.3, 0.9], [0.3, 0.6, 0.8]], dtype, device))
+    assert pcd_select.point["colors"].shape == o3c.SizeVector([2, 3])
+    assert len(pcd.select_by_mask(mask, invert=True).point["points"]) == 2
+
+    aabb = o3d.geometry.AxisAlignedBoundingBox([0, 0, 0.3], [0.5, 0.5, 1])
+    assert pcd.crop(aabb).point["points"].allclose(
+        o3c.Tensor([[0.1, 0.3, 0.9]], dtype, device))
+    assert len(pcd.crop(aabb, invert=True).point["points"]) == 3
+
+    obb_class = o3d.geometry.OrientedBoundingBox
+    obb = obb_class.create_from_axis_aligned_bounding_box(aabb)
+    assert pcd.crop(obb).point["points"].allclose(
+        o3c.Tensor([[0.1, 0.3, 0.9]], dtype, device))
@@ -28,6 +28,11 @@ import open3d as o3d
 import numpy as np
 import pytest
 
+import sys
+import os
+sys.path.append(os.path.dirname(os.path.realpath(__file__)) + "/../..")
+from open3d_test import list_devices
+
 
 # test intersection with a single triangle
 def test_cast_rays():
@@ -67,6 +72,29 @@ def test_cast_lots_of_rays():
     _ = scene.cast_rays(rays)
 
 
+# rays organized as an image are traced in coherent tiles, which gives the
+# same results as unorganized rays
+def test_cast_coherent_rays():
+    cube = o3d.t.geometry.TriangleMesh.from_legacy_triangle_mesh(
+        o3d.geometry.TriangleMesh.create_box())
+
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(cube)
+
+    rays = o3d.t.geometry.RaycastingScene.create_rays_pinhole(
+        fov_deg=60,
+        center=[0.5, 0.5, 0.5],
+        eye=[-1, -1, -1],
+        up=[0, 0, 1],
+        width_px=101,
+        height_px=67)
+    ans = scene.cast_rays(rays)
+    ans_flat = scene.cast_rays(rays.reshape((-1, 6)))
+    for k in ans:
+        np.testing.assert_equal(ans[k].numpy().reshape(-1),
+                                ans_flat[k].numpy().reshape(-1))
+
+
 def test_add_triangle_mesh():
     cube = o3d.t.geometry.TriangleMesh.from_legacy_triangle_mesh(
         o3d.geometry.TriangleMesh.create_box())
@@ -225,3 +253,193 @@ def test_output_shapes(shape):
             v.shape
         ) == expected_shape, 'shape mismatch: expected {} but got {} for {}'.format(
             expected_shape, list(v.shape), k)
+
+
+# scenes on other devices give the same answers as the cpu scene
+@pytest.mark.parametrize("device", list_devices())
+def test_device_scene(device):
+    sphere = o3d.t.geometry.TriangleMesh.from_legacy_triangle_mesh(
+        o3d.geometry.TriangleMesh.create_sphere(resolution=20))
+    box = o3d.t.geometry.TriangleMesh.from_legacy_triangle_mesh(
+        o3d.geometry.TriangleMesh.create_box().translate([2, 0, 0]))
+
+    cpu_scene = o3d.t.geometry.RaycastingScene()
+    scene = o3d.t.geometry.RaycastingScene(device)
+    for mesh in (sphere, box):
+        cpu_scene.add_triangles(mesh)
+        scene.add_triangles(
+            mesh.vertices['vertices'].to(device),
+            mesh.triangles['triangles'].to(device, o3d.core.Dtype.UInt32))
+
+    rays = o3d.t.geometry.RaycastingScene.create_rays_pinhole(
+        fov_deg=90,
+        center=[1, 0, 0],
+        eye=[1, -4, 1],
+        up=[0, 0, 1],
+        width_px=64,
+        height_px=48)
+    cpu_ans = cpu_scene.cast_rays(rays)
+    ans = scene.cast_rays(rays.to(device))
+    np.testing.assert_allclose(ans['t_hit'].cpu().numpy(),
+                               cpu_ans['t_hit'].numpy(),
+                               rtol=1e-4)
+    np.testing.assert_equal(ans['geometry_ids'].cpu().numpy(),
+                            cpu_ans['geometry_ids'].numpy())
+    np.testing.assert_equal(
+        scene.count_intersections(rays.to(device)).cpu().numpy(),
+        cpu_scene.count_intersections(rays).numpy())
+
+    rs = np.random.RandomState(123)
+    query_points = o3d.core.Tensor.from_numpy(
+        rs.uniform(-2, 4, size=(1000, 3)).astype(np.float32))
+    np.testing.assert_allclose(
+        scene.compute_distance(query_points.to(device)).cpu().numpy(),
+        cpu_scene.compute_distance(query_points).numpy(),
+        rtol=1e-4,
+        atol=1e-5)
+    np.testing.assert_equal(
+        scene.compute_occupancy(query_points.to(device)).cpu().numpy(),
+        cpu_scene.compute_occupancy(query_points).numpy())
+
+
+# instances can be moved and geometries removed after the first query
+@pytest.mark.parametrize("device", list_devices())
+def test_instances(device):
+    vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
+                               dtype=o3d.core.Dtype.Float32,
+                               device=device)
+    triangles = o3d.core.Tensor([[0, 1, 2]],
+                                dtype=o3d.core.Dtype.UInt32,
+                                device=device)
+
+    scene = o3d.t.geometry.RaycastingScene(device)
+    mesh_id = scene.add_triangles(vertices, triangles)
+    transform = np.eye(4, dtype=np.float32)
+    transform[:3, 3] = [10, 0, 0]
+    instance_id = scene.add_instance(mesh_id,
+                                     o3d.core.Tensor.from_numpy(transform))
+
+    rays = o3d.core.Tensor([[0.2, 0.1, 1, 0, 0, -1], [10.2, 0.1, 1, 0, 0, -1]],
+                           dtype=o3d.core.Dtype.Float32,
+                           device=device)
+    ans = scene.cast_rays(rays)
+    np.testing.assert_equal(ans['geometry_ids'].cpu().numpy(),
+                            [mesh_id, instance_id])
+    np.testing.assert_allclose(ans['t_hit'].cpu().numpy(), [1, 1])
+
+    # move the instance down and rotate it upside down
+    transform[:3, :3] = np.diag([1, -1, -1])
+    transform[:3, 3] = [10, 0.2, -1]
+    scene.set_transform(instance_id, o3d.core.Tensor.from_numpy(transform))
+    ans = scene.cast_rays(rays)
+    np.testing.assert_allclose(ans['t_hit'].cpu().numpy(), [1, 2], rtol=1e-5)
+    np.testing.assert_allclose(ans['primitive_normals'][1].cpu().numpy(),
+                               [0, 0, -1],
+                               atol=1e-6)
+
+    query_points = o3d.core.Tensor([[10.5, 0, -1.5]],
+                                   dtype=o3d.core.Dtype.Float32,
+                                   device=device)
+    ans = scene.compute_closest_points(query_points)
+    assert ans['geometry_ids'][0].item() == instance_id
+    np.testing.assert_allclose(ans['points'].cpu().numpy(), [[10.5, 0, -1]],
+                               atol=1e-6)
+
+    scene.remove_geometry(mesh_id)
+    ans = scene.cast_rays(rays)
+    np.testing.assert_equal(ans['geometry_ids'].cpu().numpy(), [
+        o3d.t.geometry.RaycastingScene.INVALID_ID, instance_id
+    ])
+    assert scene.count_intersections(rays).cpu().numpy().tolist() == [0, 1]
+
+
+# grid queries evaluated in tiles match the queries of all grid points
+def test_compute_signed_distance_grid():
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(
+        o3d.t.geometry.TriangleMesh.from_legacy_triangle_mesh(
+            o3d.geometry.TriangleMesh.create_box()))
+
+    min_bound = o3d.core.Tensor([-0.5, -0.5, -0.5],
+                                dtype=o3d.core.Dtype.Float32)
+    max_bound = o3d.core.Tensor([1.5, 1.5, 2.0], dtype=o3d.core.Dtype.Float32)
+    resolution = [8, 6, 10]
+    xs = np.linspace(-0.5, 1.5, 8, dtype=np.float32)
+    ys = np.linspace(-0.5, 1.5, 6, dtype=np.float32)
+    zs = np.linspace(-0.5, 2.0, 10, dtype=np.float32)
+    points = np.stack(np.meshgrid(zs, ys, xs, indexing='ij')[::-1], axis=-1)
+    query_points = o3d.core.Tensor.from_numpy(
+        np.ascontiguousarray(points, dtype=np.float32))
+
+    sdf = scene.compute_signed_distance_grid(min_bound,
+                                             max_bound,
+                                             resolution,
+                                             tile_size=4)
+    assert list(sdf.shape) == [10, 6, 8]
+    np.testing.assert_allclose(
+        sdf.numpy(),
+        scene.compute_signed_distance(query_points).numpy(),
+        rtol=1e-5,
+        atol=1e-5)
+
+    occupancy = scene.compute_occupancy_grid(min_bound,
+                                             max_bound,
+                                             resolution,
+                                             tile_size=4)
+    np.testing.assert_equal(occupancy.numpy(),
+                            scene.compute_occupancy(query_points).numpy())
+
+
+# a saved bvh gives the same answers on all devices, with any build quality
+@pytest.mark.parametrize("device", list_devices())
+def test_save_load_bvh(device, tmp_path):
+    sphere = o3d.t.geometry.TriangleMesh.from_legacy_triangle_mesh(
+        o3d.geometry.TriangleMesh.create_sphere(resolution=20))
+    box = o3d.t.geometry.TriangleMesh.from_legacy_triangle_mesh(
+        o3d.geometry.TriangleMesh.create_box())
+
+    cpu_scene = o3d.t.geometry.RaycastingScene()
+    cpu_scene.add_triangles(sphere)
+    box_id = cpu_scene.add_triangles(box)
+    transform = np.eye(4, dtype=np.float32)
+    transform[:3, 3] = [2, 0, 0]
+    cpu_scene.add_instance(box_id, o3d.core.Tensor.from_numpy(transform))
+
+    rays = o3d.t.geometry.RaycastingScene.create_rays_pinhole(
+        fov_deg=90,
+        center=[1, 0, 0],
+        eye=[1, -4, 1],
+        up=[0, 0, 1],
+        width_px=64,
+        height_px=48)
+    rs = np.random.RandomState(123)
+    query_points = o3d.core.Tensor.from_numpy(
+        rs.uniform(-2, 4, size=(1000, 3)).astype(np.float32))
+    cpu_ans = cpu_scene.cast_rays(rays)
+    cpu_distance = cpu_scene.compute_distance(query_points)
+
+    for quality in (o3d.t.geometry.RaycastingScene.BuildQuality.Low,
+                    o3d.t.geometry.RaycastingScene.BuildQuality.High):
+        scene = o3d.t.geometry.RaycastingScene(build_quality=quality)
+        scene.add_triangles(sphere)
+        box_id = scene.add_triangles(box)
+        scene.add_instance(box_id, o3d.core.Tensor.from_numpy(transform))
+        file_name = str(tmp_path / "bvh.o3dt")
+        scene.save_bvh(file_name)
+
+        for mmap_mode in (None, 'r'):
+            loaded = o3d.t.geometry.RaycastingScene(device)
+            loaded.load_bvh(file_name, mmap_mode=mmap_mode)
+            ans = loaded.cast_rays(rays.to(device))
+            np.testing.assert_allclose(ans['t_hit'].cpu().numpy(),
+                                       cpu_ans['t_hit'].numpy(),
+                                       rtol=1e-4)
+            np.testing.assert_equal(ans['geometry_ids'].cpu().numpy(),
+                                    cpu_ans['geometry_ids'].numpy())
+            np.testing.assert_allclose(
+                loaded.compute_distance(query_points.to(device)).cpu().numpy(),
+                cpu_distance.numpy(),
+                rtol=1e-4,
+                atol=1e-5)
+            with pytest.raises(RuntimeError):
+                loaded.add_triangles(sphere.to(device))
@@ -162,3 +162,40 @@ def test_locate_leaf_node():
         assert node_info.depth == max_depth
         # Leaf node's size must match
         assert node_info.size == octree.size / np.power(2, max_depth)
+
+
+def test_linear_octree():
+    pcd_path = os.path.join(test_data_dir, "fragment.ply")
+    pcd = o3d.io.read_point_cloud(pcd_path)
+
+    max_depth = 5
+    octree = o3d.geometry.Octree(max_depth)
+    octree.convert_from_point_cloud(pcd, 0.01)
+    linear_octree = o3d.geometry.LinearOctree(max_depth)
+    linear_octree.convert_from_point_cloud(pcd, 0.01)
+    assert isinstance(linear_octree.to_octree(), o3d.geometry.Octree)
+    assert len(linear_octree.point_indices) == len(pcd.points)
+
+    for idx in range(0, len(pcd.points), 200):
+        point = pcd.points[idx]
+        leaf_index = linear_octree.locate_leaf_node(np.array(point))
+        assert leaf_index >= 0
+        node_info = linear_octree.get_leaf_node_info(leaf_index)
+        _, expected_node_info = octree.locate_leaf_node(np.array(point))
+        np.testing.assert_allclose(node_info.origin, expected_node_info.origin)
+        assert node_info.depth == max_depth
+        begin, end = linear_octree.get_leaf_point_range(leaf_index)
+        assert idx in linear_octree.point_indices[begin:end]
+
+    num_leaves = [0]
+
+    def f_traverse(node_info, node_index, point_begin, point_end):
+        if node_info.depth == max_depth:
+            num_leaves[0] += 1
+        return False
+
+    linear_octree.traverse(f_traverse)
+    assert num_leaves[0] == linear_octree.get_num_leaf_nodes()
+
+    voxel_grid = linear_octree.to_voxel_grid()
+    assert len(voxel_grid.get_voxels()) == num_leaves[0]